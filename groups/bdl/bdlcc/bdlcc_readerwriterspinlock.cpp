@@ -0,0 +1,118 @@
+// bdlcc_readerwriterspinlock.cpp                                     -*-C++-*-
+#include <bdlcc_readerwriterspinlock.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlcc_readerwriterspinlock_cpp,"$Id$ $CSID$")
+
+#include <bsls_platform.h>
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+#include <windows.h>   // 'SwitchToThread', 'YieldProcessor'
+#else
+#include <sched.h>     // 'sched_yield'
+#endif
+
+namespace BloombergLP {
+namespace bdlcc {
+
+namespace {
+
+// LOCAL CONSTANTS
+enum {
+    k_SPINS_BEFORE_YIELD = 64  // number of failed attempts to acquire a lock
+                               // after which a waiting thread yields
+};
+
+// LOCAL FUNCTIONS
+void backoff(int *numSpins)
+    // Pause the calling thread before its next attempt to acquire a lock,
+    // having made the specified '*numSpins' unsuccessful attempts since it
+    // last yielded, and update '*numSpins'.  Pause the processor for a few
+    // cycles until 'k_SPINS_BEFORE_YIELD' attempts have failed, and then yield
+    // the remainder of the time slice of the calling thread.
+{
+    if (++*numSpins < k_SPINS_BEFORE_YIELD) {
+#if defined(BSLS_PLATFORM_OS_WINDOWS)
+        YieldProcessor();
+#elif (defined(BSLS_PLATFORM_CMP_GNU) || defined(BSLS_PLATFORM_CMP_CLANG))   \
+   && (defined(BSLS_PLATFORM_CPU_X86) || defined(BSLS_PLATFORM_CPU_X86_64))
+        __asm__ __volatile__("pause" ::: "memory");
+#endif
+        return;                                                       // RETURN
+    }
+
+    *numSpins = 0;
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    SwitchToThread();
+#else
+    sched_yield();
+#endif
+}
+
+}  // close unnamed namespace
+
+                        // --------------------------
+                        // class ReaderWriterSpinLock
+                        // --------------------------
+
+// PRIVATE MANIPULATORS
+void ReaderWriterSpinLock::lockReadContended()
+{
+    int numSpins = 0;
+    for (;;) {
+        backoff(&numSpins);
+
+        const int state = d_state.loadRelaxed();
+        if (0 == (state & (k_WRITER | k_WRITER_WAITING))
+         && state == d_state.testAndSwapAcqRel(state, state + 1)) {
+            return;                                                   // RETURN
+        }
+    }
+}
+
+void ReaderWriterSpinLock::lockWriteContended()
+{
+    int numSpins = 0;
+    for (;;) {
+        const int state = d_state.loadRelaxed();
+        if (0 == (state & ~k_WRITER_WAITING)) {
+            // The lock is free.  Acquiring it clears 'k_WRITER_WAITING'; any
+            // other waiting writer sets it again on its next attempt.
+
+            if (state == d_state.testAndSwapAcqRel(state, k_WRITER)) {
+                return;                                               // RETURN
+            }
+            continue;
+        }
+
+        if (0 == (state & k_WRITER_WAITING)) {
+            d_state.testAndSwapAcqRel(state, state | k_WRITER_WAITING);
+        }
+        backoff(&numSpins);
+    }
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,434 @@
+// bdlcc_readerwriterspinlock.h                                       -*-C++-*-
+#ifndef INCLUDED_BDLCC_READERWRITERSPINLOCK
+#define INCLUDED_BDLCC_READERWRITERSPINLOCK
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a writer-biased reader/writer spin lock.
+//
+//@CLASSES:
+//  bdlcc::ReaderWriterSpinLock: reader/writer lock that busy-waits
+//  bdlcc::ReaderWriterSpinLockReadGuard: scoped guard holding a read lock
+//  bdlcc::ReaderWriterSpinLockWriteGuard: scoped guard holding a write lock
+//
+//@SEE_ALSO: bdlcc_shardedhashmap
+//
+//@DESCRIPTION: This component provides a mechanism,
+// 'bdlcc::ReaderWriterSpinLock', that allows any number of threads to hold a
+// *read* lock concurrently, or exactly one thread to hold a *write* lock, and
+// two guard classes, 'bdlcc::ReaderWriterSpinLockReadGuard' and
+// 'bdlcc::ReaderWriterSpinLockWriteGuard', that hold a read or a write lock
+// (respectively) for the duration of a scope.
+//
+// The state of the lock is a single 'bsls::AtomicInt', so a lock occupies
+// four bytes, requires no system resources, and is acquired or released
+// without contention by a single atomic operation.  A thread that cannot
+// acquire a lock immediately does not block in the operating system; it
+// spins, briefly pausing the processor between attempts, and yields its time
+// slice if the lock stays unavailable.  A 'ReaderWriterSpinLock' is therefore
+// appropriate only for protecting critical sections that are short and never
+// block, e.g., a lookup in an in-memory table.
+//
+///Writer Bias
+///-----------
+// A thread waiting to acquire a write lock marks the lock as having a waiting
+// writer, after which no further read lock is granted until a write lock has
+// been acquired.  Writers therefore cannot be starved by a steady stream of
+// readers, while a steady stream of writers may delay readers indefinitely.
+//
+// Note that a 'ReaderWriterSpinLock' is not recursive: a thread holding a
+// lock of either kind must not attempt to acquire another lock on the same
+// object, and a read lock cannot be upgraded to a write lock.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Protecting a Shared Counter Table
+/// - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we have a small table of counters that is read far more often than
+// it is updated, and whose every access is a handful of instructions.
+//
+// First, we define the table, holding a 'bdlcc::ReaderWriterSpinLock' next to
+// the data it protects:
+//..
+//  class CounterTable {
+//      // This class provides a thread-safe table of 'int' counters.
+//
+//      // DATA
+//      mutable bdlcc::ReaderWriterSpinLock d_lock;
+//      int                                 d_counters[16];
+//
+//    public:
+//      // CREATORS
+//      CounterTable()
+//          // Create a table having all counters equal to 0.
+//      {
+//          for (int i = 0; i < 16; ++i) {
+//              d_counters[i] = 0;
+//          }
+//      }
+//
+//      // MANIPULATORS
+//      void increment(int index)
+//          // Increment the counter at the specified 'index'.
+//      {
+//          bdlcc::ReaderWriterSpinLockWriteGuard guard(&d_lock);
+//          ++d_counters[index];
+//      }
+//
+//      // ACCESSORS
+//      int value(int index) const
+//          // Return the value of the counter at the specified 'index'.
+//      {
+//          bdlcc::ReaderWriterSpinLockReadGuard guard(&d_lock);
+//          return d_counters[index];
+//      }
+//  };
+//..
+// Then, we use the table, which may now be shared between threads:
+//..
+//  CounterTable table;
+//  table.increment(3);
+//  table.increment(3);
+//  assert(2 == table.value(3));
+//  assert(0 == table.value(4));
+//..
+
+#ifndef INCLUDED_BDLSCM_VERSION
+#include <bdlscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ATOMIC
+#include <bsls_atomic.h>
+#endif
+
+namespace BloombergLP {
+namespace bdlcc {
+
+                        // ==========================
+                        // class ReaderWriterSpinLock
+                        // ==========================
+
+class ReaderWriterSpinLock {
+    // This class provides a reader/writer lock that busy-waits to acquire a
+    // lock, and that grants no read lock while a writer is waiting (see
+    // {Writer Bias}).
+
+    // PRIVATE TYPES
+    enum {
+        k_WRITER         = 0x40000000,  // set while a write lock is held
+
+        k_WRITER_WAITING = 0x20000000,  // set while a writer is waiting
+
+        k_READERS_MASK   = 0x1fffffff   // number of read locks held
+    };
+
+    // DATA
+    bsls::AtomicInt d_state;  // bitwise-or of 'k_WRITER', 'k_WRITER_WAITING',
+                              // and the number of read locks held
+
+  private:
+    // NOT IMPLEMENTED
+    ReaderWriterSpinLock(const ReaderWriterSpinLock&);
+    ReaderWriterSpinLock& operator=(const ReaderWriterSpinLock&);
+
+    // PRIVATE MANIPULATORS
+    void lockReadContended();
+        // Spin until a read lock is acquired on this object.
+
+    void lockWriteContended();
+        // Spin until a write lock is acquired on this object, indicating that
+        // a writer is waiting until it is.
+
+  public:
+    // CREATORS
+    ReaderWriterSpinLock();
+        // Create an unlocked reader/writer spin lock.
+
+    ~ReaderWriterSpinLock();
+        // Destroy this object.  The behavior is undefined unless this object
+        // is unlocked.
+
+    // MANIPULATORS
+    void lockRead();
+        // Acquire a read lock on this object, waiting until no write lock is
+        // held and no writer is waiting.  The behavior is undefined if the
+        // calling thread already holds a lock on this object.
+
+    void lockWrite();
+        // Acquire a write lock on this object, waiting until no other lock is
+        // held.  The behavior is undefined if the calling thread already holds
+        // a lock on this object.
+
+    int tryLockRead();
+        // Attempt to acquire a read lock on this object without waiting.
+        // Return 0 on success, and a non-zero value if a write lock is held or
+        // a writer is waiting.
+
+    int tryLockWrite();
+        // Attempt to acquire a write lock on this object without waiting.
+        // Return 0 on success, and a non-zero value if any lock is held.
+
+    void unlockRead();
+        // Release a read lock held by the calling thread on this object.  The
+        // behavior is undefined unless the calling thread holds a read lock on
+        // this object.
+
+    void unlockWrite();
+        // Release the write lock held by the calling thread on this object.
+        // The behavior is undefined unless the calling thread holds the write
+        // lock on this object.
+
+    // ACCESSORS
+    bool isLocked() const;
+        // Return 'true' if a read or write lock is held on this object, and
+        // 'false' otherwise.  Note that the returned value may be out of date
+        // by the time it is examined unless the calling thread holds a lock.
+
+    bool isLockedRead() const;
+        // Return 'true' if one or more read locks are held on this object, and
+        // 'false' otherwise.  Note that the returned value may be out of date
+        // by the time it is examined unless the calling thread holds a lock.
+
+    bool isLockedWrite() const;
+        // Return 'true' if a write lock is held on this object, and 'false'
+        // otherwise.  Note that the returned value may be out of date by the
+        // time it is examined unless the calling thread holds a lock.
+};
+
+                    // ===================================
+                    // class ReaderWriterSpinLockReadGuard
+                    // ===================================
+
+class ReaderWriterSpinLockReadGuard {
+    // This class implements a guard that acquires a read lock on a
+    // 'ReaderWriterSpinLock' on construction, and releases it on destruction.
+
+    // DATA
+    ReaderWriterSpinLock *d_lock_p;  // guarded lock (held, not owned)
+
+  private:
+    // NOT IMPLEMENTED
+    ReaderWriterSpinLockReadGuard(const ReaderWriterSpinLockReadGuard&);
+    ReaderWriterSpinLockReadGuard& operator=(
+                                         const ReaderWriterSpinLockReadGuard&);
+
+  public:
+    // CREATORS
+    explicit
+    ReaderWriterSpinLockReadGuard(ReaderWriterSpinLock *lock);
+        // Create a guard holding a read lock on the specified 'lock', waiting
+        // until the lock is acquired.
+
+    ~ReaderWriterSpinLockReadGuard();
+        // Release the read lock held by this guard, and destroy this object.
+};
+
+                    // ====================================
+                    // class ReaderWriterSpinLockWriteGuard
+                    // ====================================
+
+class ReaderWriterSpinLockWriteGuard {
+    // This class implements a guard that acquires a write lock on a
+    // 'ReaderWriterSpinLock' on construction, and releases it on destruction.
+
+    // DATA
+    ReaderWriterSpinLock *d_lock_p;  // guarded lock (held, not owned)
+
+  private:
+    // NOT IMPLEMENTED
+    ReaderWriterSpinLockWriteGuard(const ReaderWriterSpinLockWriteGuard&);
+    ReaderWriterSpinLockWriteGuard& operator=(
+                                        const ReaderWriterSpinLockWriteGuard&);
+
+  public:
+    // CREATORS
+    explicit
+    ReaderWriterSpinLockWriteGuard(ReaderWriterSpinLock *lock);
+        // Create a guard holding the write lock on the specified 'lock',
+        // waiting until the lock is acquired.
+
+    ~ReaderWriterSpinLockWriteGuard();
+        // Release the write lock held by this guard, and destroy this object.
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                        // --------------------------
+                        // class ReaderWriterSpinLock
+                        // --------------------------
+
+// CREATORS
+inline
+ReaderWriterSpinLock::ReaderWriterSpinLock()
+: d_state(0)
+{
+}
+
+inline
+ReaderWriterSpinLock::~ReaderWriterSpinLock()
+{
+    BSLS_ASSERT_SAFE(0 == (d_state.loadRelaxed() & ~k_WRITER_WAITING));
+}
+
+// MANIPULATORS
+inline
+void ReaderWriterSpinLock::lockRead()
+{
+    const int state = d_state.loadRelaxed();
+    if (0 == (state & (k_WRITER | k_WRITER_WAITING))
+     && state == d_state.testAndSwapAcqRel(state, state + 1)) {
+        return;                                                       // RETURN
+    }
+    lockReadContended();
+}
+
+inline
+void ReaderWriterSpinLock::lockWrite()
+{
+    if (0 != d_state.testAndSwapAcqRel(0, k_WRITER)) {
+        lockWriteContended();
+    }
+}
+
+inline
+int ReaderWriterSpinLock::tryLockRead()
+{
+    int state = d_state.loadRelaxed();
+    while (0 == (state & (k_WRITER | k_WRITER_WAITING))) {
+        const int previous = d_state.testAndSwapAcqRel(state, state + 1);
+        if (previous == state) {
+            return 0;                                                 // RETURN
+        }
+        state = previous;
+    }
+    return 1;
+}
+
+inline
+int ReaderWriterSpinLock::tryLockWrite()
+{
+    const int state = d_state.loadRelaxed();
+    if (0 == (state & ~k_WRITER_WAITING)
+     && state == d_state.testAndSwapAcqRel(state, k_WRITER)) {
+        return 0;                                                     // RETURN
+    }
+    return 1;
+}
+
+inline
+void ReaderWriterSpinLock::unlockRead()
+{
+    BSLS_ASSERT_SAFE(0 != (d_state.loadRelaxed() & k_READERS_MASK));
+
+    d_state.addAcqRel(-1);
+}
+
+inline
+void ReaderWriterSpinLock::unlockWrite()
+{
+    BSLS_ASSERT_SAFE(0 != (d_state.loadRelaxed() & k_WRITER));
+
+    // Subtract, rather than store 0, to preserve the 'k_WRITER_WAITING' bit
+    // of any writer now waiting.
+
+    d_state.addAcqRel(-k_WRITER);
+}
+
+// ACCESSORS
+inline
+bool ReaderWriterSpinLock::isLocked() const
+{
+    return 0 != (d_state.loadRelaxed() & ~k_WRITER_WAITING);
+}
+
+inline
+bool ReaderWriterSpinLock::isLockedRead() const
+{
+    return 0 != (d_state.loadRelaxed() & k_READERS_MASK);
+}
+
+inline
+bool ReaderWriterSpinLock::isLockedWrite() const
+{
+    return 0 != (d_state.loadRelaxed() & k_WRITER);
+}
+
+                    // -----------------------------------
+                    // class ReaderWriterSpinLockReadGuard
+                    // -----------------------------------
+
+// CREATORS
+inline
+ReaderWriterSpinLockReadGuard::ReaderWriterSpinLockReadGuard(
+                                                    ReaderWriterSpinLock *lock)
+: d_lock_p(lock)
+{
+    BSLS_ASSERT_SAFE(lock);
+
+    d_lock_p->lockRead();
+}
+
+inline
+ReaderWriterSpinLockReadGuard::~ReaderWriterSpinLockReadGuard()
+{
+    d_lock_p->unlockRead();
+}
+
+                    // ------------------------------------
+                    // class ReaderWriterSpinLockWriteGuard
+                    // ------------------------------------
+
+// CREATORS
+inline
+ReaderWriterSpinLockWriteGuard::ReaderWriterSpinLockWriteGuard(
+                                                    ReaderWriterSpinLock *lock)
+: d_lock_p(lock)
+{
+    BSLS_ASSERT_SAFE(lock);
+
+    d_lock_p->lockWrite();
+}
+
+inline
+ReaderWriterSpinLockWriteGuard::~ReaderWriterSpinLockWriteGuard()
+{
+    d_lock_p->unlockWrite();
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
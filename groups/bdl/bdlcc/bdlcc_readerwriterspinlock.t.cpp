@@ -0,0 +1,648 @@
+// bdlcc_readerwriterspinlock.t.cpp                                   -*-C++-*-
+#include <bdlcc_readerwriterspinlock.h>
+
+#include <bdls_testutil.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_atomic.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+#include <windows.h>
+#else
+#include <pthread.h>
+#endif
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                                TEST PLAN
+// ----------------------------------------------------------------------------
+//                                Overview
+//                                --------
+// 'bdlcc::ReaderWriterSpinLock' is a mechanism whose state is a single atomic
+// integer.  We first verify, in a single thread, that each manipulator moves
+// the lock between the unlocked, read-locked, write-locked, and
+// writer-waiting states as documented, observing the state with the
+// accessors and the 'try' manipulators.  We then verify the two guards.
+// Finally, we verify mutual exclusion with several threads: writers update a
+// pair of counters that must always be observed equal by readers.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] ReaderWriterSpinLock();
+// [ 2] ~ReaderWriterSpinLock();
+//
+// MANIPULATORS
+// [ 2] void lockRead();
+// [ 2] void lockWrite();
+// [ 2] int tryLockRead();
+// [ 2] int tryLockWrite();
+// [ 2] void unlockRead();
+// [ 2] void unlockWrite();
+//
+// ACCESSORS
+// [ 2] bool isLocked() const;
+// [ 2] bool isLockedRead() const;
+// [ 2] bool isLockedWrite() const;
+//
+// ReaderWriterSpinLockReadGuard
+// [ 3] ReaderWriterSpinLockReadGuard(ReaderWriterSpinLock *lock);
+// [ 3] ~ReaderWriterSpinLockReadGuard();
+//
+// ReaderWriterSpinLockWriteGuard
+// [ 3] ReaderWriterSpinLockWriteGuard(ReaderWriterSpinLock *lock);
+// [ 3] ~ReaderWriterSpinLockWriteGuard();
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 5] USAGE EXAMPLE
+// [ 4] CONCERN: Readers and writers are mutually excluded.
+// [ 4] CONCERN: A waiting writer blocks further readers.
+
+// ============================================================================
+//                    STANDARD BDE ASSERT TEST MACRO
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(int c, const char *s, int i)
+{
+    if (c) {
+        cout << "Error " << __FILE__ << "(" << i << "): " << s
+             << "    (failed)" << endl;
+        if (0 <= testStatus && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BDLS_TESTUTIL_ASSERT
+#define LOOP_ASSERT  BDLS_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BDLS_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BDLS_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BDLS_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BDLS_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BDLS_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BDLS_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BDLS_TESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BDLS_TESTUTIL_ASSERTV
+
+#define Q   BDLS_TESTUTIL_Q   // Quote identifier literally.
+#define P   BDLS_TESTUTIL_P   // Print identifier and value.
+#define P_  BDLS_TESTUTIL_P_  // P(X) without '\n'.
+#define T_  BDLS_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BDLS_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+//=============================================================================
+//                  GLOBAL VARIABLES / TYPEDEFS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef bdlcc::ReaderWriterSpinLock           Obj;
+typedef bdlcc::ReaderWriterSpinLockReadGuard  ReadGuard;
+typedef bdlcc::ReaderWriterSpinLockWriteGuard WriteGuard;
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+typedef HANDLE    ThreadId;
+#else
+typedef pthread_t ThreadId;
+#endif
+
+typedef void *(*ThreadFunction)(void *arg);
+
+// ============================================================================
+//                  HELPER CLASSES AND FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+static
+ThreadId createThread(ThreadFunction func, void *arg)
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    return CreateThread(0, 0, (LPTHREAD_START_ROUTINE)func, arg, 0, 0);
+#else
+    ThreadId id;
+    pthread_create(&id, 0, func, arg);
+    return id;
+#endif
+}
+
+static
+void joinThread(ThreadId id)
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    WaitForSingleObject(id, INFINITE);
+    CloseHandle(id);
+#else
+    pthread_join(id, 0);
+#endif
+}
+
+namespace TestCase4 {
+
+struct SharedData {
+    Obj             d_lock;           // lock under test
+    int             d_first;          // incremented by writers
+    int             d_second;         // incremented by writers, after a
+                                      // delay
+    int             d_numIterations;  // iterations per thread
+    bsls::AtomicInt d_numErrors;      // unequal counters observed by readers
+};
+
+extern "C" void *writerFunction(void *arg)
+{
+    SharedData *data = static_cast<SharedData *>(arg);
+
+    for (int i = 0; i < data->d_numIterations; ++i) {
+        WriteGuard guard(&data->d_lock);
+
+        ++data->d_first;
+        for (volatile int spin = 0; spin < 10; ++spin) {
+        }
+        ++data->d_second;
+    }
+    return arg;
+}
+
+extern "C" void *readerFunction(void *arg)
+{
+    SharedData *data = static_cast<SharedData *>(arg);
+
+    for (int i = 0; i < data->d_numIterations; ++i) {
+        ReadGuard guard(&data->d_lock);
+
+        const int first = data->d_first;
+        for (volatile int spin = 0; spin < 10; ++spin) {
+        }
+        if (first != data->d_second) {
+            ++data->d_numErrors;
+        }
+    }
+    return arg;
+}
+
+struct WaitingWriterData {
+    Obj             d_lock;       // lock under test, initially read-locked
+    bsls::AtomicInt d_acquired;   // set once the writer holds the lock
+};
+
+extern "C" void *waitingWriterFunction(void *arg)
+{
+    WaitingWriterData *data = static_cast<WaitingWriterData *>(arg);
+
+    data->d_lock.lockWrite();
+    data->d_acquired = 1;
+    data->d_lock.unlockWrite();
+    return arg;
+}
+
+}  // close namespace TestCase4
+
+// ============================================================================
+//                                USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Protecting a Shared Counter Table
+/// - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we have a small table of counters that is read far more often than
+// it is updated, and whose every access is a handful of instructions.
+//
+// First, we define the table, holding a 'bdlcc::ReaderWriterSpinLock' next to
+// the data it protects:
+//..
+    class CounterTable {
+        // This class provides a thread-safe table of 'int' counters.
+
+        // DATA
+        mutable bdlcc::ReaderWriterSpinLock d_lock;
+        int                                 d_counters[16];
+
+      public:
+        // CREATORS
+        CounterTable()
+            // Create a table having all counters equal to 0.
+        {
+            for (int i = 0; i < 16; ++i) {
+                d_counters[i] = 0;
+            }
+        }
+
+        // MANIPULATORS
+        void increment(int index)
+            // Increment the counter at the specified 'index'.
+        {
+            bdlcc::ReaderWriterSpinLockWriteGuard guard(&d_lock);
+            ++d_counters[index];
+        }
+
+        // ACCESSORS
+        int value(int index) const
+            // Return the value of the counter at the specified 'index'.
+        {
+            bdlcc::ReaderWriterSpinLockReadGuard guard(&d_lock);
+            return d_counters[index];
+        }
+    };
+//..
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    switch (test) { case 0:
+      case 5: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+// Then, we use the table, which may now be shared between threads:
+//..
+    CounterTable table;
+    table.increment(3);
+    table.increment(3);
+    ASSERT(2 == table.value(3));
+    ASSERT(0 == table.value(4));
+//..
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // CONCURRENCY
+        //   Ensure that the lock provides the documented exclusion.
+        //
+        // Concerns:
+        //: 1 No reader holds a lock while a writer holds the lock, and no two
+        //:   writers hold the lock at the same time.
+        //:
+        //: 2 A writer waiting for the lock prevents further read locks from
+        //:   being granted, and acquires the lock once the readers release it.
+        //
+        // Plan:
+        //: 1 Create several writer threads that, holding a write lock,
+        //:   increment two counters with a delay between the increments, and
+        //:   several reader threads that, holding a read lock, read both
+        //:   counters with a delay between the reads.  Verify that the readers
+        //:   never observe unequal counters, and that the final value of each
+        //:   counter equals the total number of writes.  (C-1)
+        //:
+        //: 2 Holding a read lock, create a thread that acquires and releases
+        //:   a write lock.  Wait until 'tryLockRead' fails (the writer is
+        //:   waiting), verify that the writer has not yet acquired the lock,
+        //:   release the read lock, and verify that the writer completes.
+        //:   (C-2)
+        //
+        // Testing:
+        //   CONCERN: Readers and writers are mutually excluded.
+        //   CONCERN: A waiting writer blocks further readers.
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCURRENCY" << endl
+                          << "===========" << endl;
+
+        using namespace TestCase4;
+
+        if (veryVerbose) cout << "\tTesting mutual exclusion." << endl;
+        {
+            enum { k_NUM_WRITERS = 4, k_NUM_READERS = 4 };
+
+            SharedData data;
+            data.d_first         = 0;
+            data.d_second        = 0;
+            data.d_numIterations = 20000;
+            data.d_numErrors     = 0;
+
+            ThreadId writers[k_NUM_WRITERS];
+            ThreadId readers[k_NUM_READERS];
+
+            for (int i = 0; i < k_NUM_WRITERS; ++i) {
+                writers[i] = createThread(&writerFunction, &data);
+                readers[i] = createThread(&readerFunction, &data);
+            }
+            for (int i = 0; i < k_NUM_WRITERS; ++i) {
+                joinThread(writers[i]);
+                joinThread(readers[i]);
+            }
+
+            ASSERTV(data.d_numErrors, 0 == data.d_numErrors);
+            ASSERTV(data.d_first,
+                    k_NUM_WRITERS * data.d_numIterations == data.d_first);
+            ASSERTV(data.d_second,
+                    k_NUM_WRITERS * data.d_numIterations == data.d_second);
+            ASSERT(false == data.d_lock.isLocked());
+        }
+
+        if (veryVerbose) cout << "\tTesting a waiting writer." << endl;
+        {
+            WaitingWriterData data;
+            data.d_acquired = 0;
+
+            data.d_lock.lockRead();
+
+            ThreadId writer = createThread(&waitingWriterFunction, &data);
+
+            // Wait for the writer to announce itself.
+
+            while (0 == data.d_lock.tryLockRead()) {
+                data.d_lock.unlockRead();
+            }
+
+            ASSERT(0    == data.d_acquired);
+            ASSERT(true == data.d_lock.isLockedRead());
+
+            data.d_lock.unlockRead();
+            joinThread(writer);
+
+            ASSERT(1     == data.d_acquired);
+            ASSERT(false == data.d_lock.isLocked());
+            ASSERT(0     == data.d_lock.tryLockRead());
+            data.d_lock.unlockRead();
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // GUARDS
+        //   Ensure that each guard holds the intended lock for its lifetime.
+        //
+        // Concerns:
+        //: 1 A 'ReaderWriterSpinLockReadGuard' acquires a read lock on
+        //:   construction, and releases it on destruction.
+        //:
+        //: 2 A 'ReaderWriterSpinLockWriteGuard' acquires a write lock on
+        //:   construction, and releases it on destruction.
+        //:
+        //: 3 Read guards on the same lock may be nested.
+        //:
+        //: 4 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Create guards in nested scopes, and verify the state of the lock
+        //:   with its accessors in and after each scope.  (C-1..3)
+        //:
+        //: 2 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for a null lock address.  (C-4)
+        //
+        // Testing:
+        //   ReaderWriterSpinLockReadGuard(ReaderWriterSpinLock *lock);
+        //   ~ReaderWriterSpinLockReadGuard();
+        //   ReaderWriterSpinLockWriteGuard(ReaderWriterSpinLock *lock);
+        //   ~ReaderWriterSpinLockWriteGuard();
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "GUARDS" << endl
+                          << "======" << endl;
+
+        Obj mX;  const Obj& X = mX;
+
+        {
+            ReadGuard guard(&mX);
+            ASSERT(true  == X.isLockedRead());
+            ASSERT(false == X.isLockedWrite());
+            {
+                ReadGuard guard2(&mX);
+                ASSERT(true == X.isLockedRead());
+            }
+            ASSERT(true  == X.isLockedRead());
+            ASSERT(0     != mX.tryLockWrite());
+        }
+        ASSERT(false == X.isLocked());
+
+        {
+            WriteGuard guard(&mX);
+            ASSERT(true  == X.isLockedWrite());
+            ASSERT(false == X.isLockedRead());
+            ASSERT(0     != mX.tryLockRead());
+        }
+        ASSERT(false == X.isLocked());
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertFailureHandlerGuard hG(
+                                             bsls::AssertTest::failTestDriver);
+
+            ASSERT_SAFE_FAIL(ReadGuard(0));
+            ASSERT_SAFE_FAIL(WriteGuard(0));
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // LOCK STATES
+        //   Ensure that each manipulator changes the state of the lock as
+        //   documented.
+        //
+        // Concerns:
+        //: 1 A newly created lock is unlocked.
+        //:
+        //: 2 'lockRead' and 'tryLockRead' acquire a read lock unless a write
+        //:   lock is held, and read locks may be held concurrently.
+        //:
+        //: 3 'lockWrite' and 'tryLockWrite' acquire a write lock only if no
+        //:   lock is held.
+        //:
+        //: 4 'unlockRead' releases one read lock, and 'unlockWrite' releases
+        //:   the write lock.
+        //:
+        //: 5 The accessors report the state of the lock.
+        //:
+        //: 6 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Using a single thread, move a lock through each of its states,
+        //:   verifying the result of the 'try' manipulators and the accessors
+        //:   in each.  (C-1..5)
+        //:
+        //: 2 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered when releasing a lock that is not held.  (C-6)
+        //
+        // Testing:
+        //   ReaderWriterSpinLock();
+        //   ~ReaderWriterSpinLock();
+        //   void lockRead();
+        //   void lockWrite();
+        //   int tryLockRead();
+        //   int tryLockWrite();
+        //   void unlockRead();
+        //   void unlockWrite();
+        //   bool isLocked() const;
+        //   bool isLockedRead() const;
+        //   bool isLockedWrite() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "LOCK STATES" << endl
+                          << "===========" << endl;
+
+        Obj mX;  const Obj& X = mX;
+
+        ASSERT(false == X.isLocked());
+        ASSERT(false == X.isLockedRead());
+        ASSERT(false == X.isLockedWrite());
+
+        if (veryVerbose) cout << "\tTesting read locks." << endl;
+
+        mX.lockRead();
+        ASSERT(true  == X.isLocked());
+        ASSERT(true  == X.isLockedRead());
+        ASSERT(false == X.isLockedWrite());
+
+        ASSERT(0     == mX.tryLockRead());
+        ASSERT(0     != mX.tryLockWrite());
+        mX.lockRead();
+
+        mX.unlockRead();
+        mX.unlockRead();
+        ASSERT(true  == X.isLockedRead());
+        ASSERT(0     != mX.tryLockWrite());
+
+        mX.unlockRead();
+        ASSERT(false == X.isLocked());
+
+        if (veryVerbose) cout << "\tTesting write locks." << endl;
+
+        mX.lockWrite();
+        ASSERT(true  == X.isLocked());
+        ASSERT(false == X.isLockedRead());
+        ASSERT(true  == X.isLockedWrite());
+        ASSERT(0     != mX.tryLockRead());
+        ASSERT(0     != mX.tryLockWrite());
+
+        mX.unlockWrite();
+        ASSERT(false == X.isLocked());
+
+        ASSERT(0     == mX.tryLockWrite());
+        ASSERT(true  == X.isLockedWrite());
+        mX.unlockWrite();
+
+        ASSERT(0     == mX.tryLockRead());
+        mX.unlockRead();
+        ASSERT(false == X.isLocked());
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertFailureHandlerGuard hG(
+                                             bsls::AssertTest::failTestDriver);
+
+            Obj mY;
+
+            ASSERT_SAFE_FAIL(mY.unlockRead());
+            ASSERT_SAFE_FAIL(mY.unlockWrite());
+
+            mY.lockRead();
+            ASSERT_SAFE_FAIL(mY.unlockWrite());
+            ASSERT_SAFE_PASS(mY.unlockRead());
+
+            mY.lockWrite();
+            ASSERT_SAFE_FAIL(mY.unlockRead());
+            ASSERT_SAFE_PASS(mY.unlockWrite());
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Acquire and release read and write locks.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        Obj mX;  const Obj& X = mX;
+
+        mX.lockRead();
+        ASSERT(X.isLockedRead());
+        mX.unlockRead();
+
+        mX.lockWrite();
+        ASSERT(X.isLockedWrite());
+        mX.unlockWrite();
+
+        ASSERT(!X.isLocked());
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,931 @@
+// bdlcc_shardedhashmap.h                                             -*-C++-*-
+#ifndef INCLUDED_BDLCC_SHARDEDHASHMAP
+#define INCLUDED_BDLCC_SHARDEDHASHMAP
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a thread-safe hash map partitioned into locked shards.
+//
+//@CLASSES:
+//  bdlcc::ShardedHashMap: thread-safe, lock-striped unordered key-value map
+//
+//@SEE_ALSO: bdlcc_readerwriterspinlock, bslstl_hashtable, bslstl_unorderedmap
+//
+//@DESCRIPTION: This component provides a class template,
+// 'bdlcc::ShardedHashMap', implementing a thread-safe map from unique keys to
+// values.  The map is partitioned into a number of *shards*, each of which is
+// a 'bslstl::HashTable' protected by its own 'bdlcc::ReaderWriterSpinLock'.
+// Each key belongs to exactly one shard, selected by its hash code, and every
+// operation on a single key locks only the shard to which the key belongs.
+// Threads operating on keys in different shards therefore never contend for a
+// lock, whereas a 'bsl::unordered_map' guarded by a single mutex serializes
+// every access.  Operations that only read the map (e.g., 'getValue' and
+// 'visit') acquire a read lock, so any number of readers may access the same
+// shard concurrently.  An operation on a single key invokes the 'HASH'
+// functor once, and uses the resulting hash code both to select the shard and
+// to locate the key within it.
+//
+// The number of shards is fixed at construction; it is the requested number
+// rounded up to a power of two.  A number of shards several times the number
+// of threads accessing the map keeps the probability of two threads
+// contending for the same shard low.  Shards are laid out so that the locks of
+// different shards do not share a cache line.
+//
+///Callbacks
+///---------
+// A 'ShardedHashMap' provides no iterators and no references to its elements,
+// because neither could remain valid once the shard lock is released.
+// Instead, clients access elements in place by supplying a functor, which the
+// map invokes while holding the lock of the shard containing the element:
+//
+//: o 'insertOrUpdate' and 'update' invoke an *updater* with the address of
+//:   the value associated with a key, under a write lock.
+//:
+//: o 'visit' invokes a *visitor* with the value associated with a key, under a
+//:   read lock, and 'visitAll' invokes a visitor with each key and value in
+//:   the map, holding the read lock of one shard at a time.
+//:
+//: o 'eraseIf' invokes a *predicate* with the value associated with a key (or
+//:   with each key and value in the map), under a write lock, and removes each
+//:   element for which the predicate returns 'true'.
+//
+// A callback must be short and must not block, since other threads accessing
+// the same shard spin while it runs.  A callback must not access the map on
+// which it was invoked: doing so may deadlock.
+//
+// Note that 'visitAll', whole-map 'eraseIf', 'size', and 'clear' lock each
+// shard in turn rather than all shards at once, so they do not observe (or
+// produce) an atomic snapshot of a map that is concurrently modified.
+//
+///Memory Allocation
+///-----------------
+// The array of shards is allocated from the allocator supplied at
+// construction (or the default allocator).  By default, each shard also
+// allocates its elements and buckets from that allocator.  Alternatively, a
+// distinct allocator may be supplied for each shard, e.g., to give each shard
+// an unsynchronized pool, or to place the memory of each shard on a specific
+// NUMA node.  Note that an allocator supplied for a shard is used only while
+// the lock of that shard is held for writing, so it need not be thread-safe
+// unless it is shared with other shards or other clients.
+//
+///Thread Safety
+///-------------
+// All methods of 'bdlcc::ShardedHashMap' are thread-safe, except that the
+// constructors and the destructor must not be called concurrently with any
+// other method on the same object.  The 'KEY' and 'VALUE' types, the 'HASH'
+// and 'EQUAL' functors, and the supplied callbacks must be safe to use
+// concurrently with distinct objects, and with a single object from
+// concurrent 'const' methods.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Counting Words From Several Threads
+/// - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that several threads each scan a part of a large document, and we
+// want to count the occurrences of each word in the document.
+//
+// First, we define an updater that increments a count:
+//..
+//  struct IncrementCount {
+//      // This 'struct' provides an updater that increments a count.
+//
+//      void operator()(int *count) const
+//          // Increment the specified 'count'.
+//      {
+//          ++*count;
+//      }
+//  };
+//..
+// Then, we create a map shared by all threads.  Sixteen shards are ample for
+// a handful of threads:
+//..
+//  bdlcc::ShardedHashMap<bsl::string, int> wordCounts(16);
+//..
+// Next, each thread, for each word that it reads, inserts a count of 1 if the
+// word has not been seen before, or increments the existing count:
+//..
+//  const char *words[] = { "the", "quick", "brown", "fox", "jumps", "over",
+//                          "the", "lazy", "dog" };
+//  const int   NUM_WORDS = sizeof words / sizeof *words;
+//
+//  for (int i = 0; i < NUM_WORDS; ++i) {
+//      wordCounts.insertOrUpdate(words[i], 1, IncrementCount());
+//  }
+//..
+// Then, once every thread has finished, we look up the count of a word:
+//..
+//  int count;
+//  assert(true == wordCounts.getValue(&count, "the"));
+//  assert(2    == count);
+//  assert(8    == wordCounts.size());
+//..
+// Finally, we remove the words that occur only once, using a predicate that
+// the map invokes with each key and value:
+//..
+//  struct IsUnique {
+//      // This 'struct' provides a predicate selecting unique words.
+//
+//      bool operator()(const bsl::string&, int count) const
+//          // Return 'true' if the specified 'count' is 1, and 'false'
+//          // otherwise.
+//      {
+//          return 1 == count;
+//      }
+//  };
+//
+//  assert(7 == wordCounts.eraseIf(IsUnique()));
+//  assert(1 == wordCounts.size());
+//..
+
+#ifndef INCLUDED_BDLSCM_VERSION
+#include <bdlscm_version.h>
+#endif
+
+#ifndef INCLUDED_BDLCC_READERWRITERSPINLOCK
+#include <bdlcc_readerwriterspinlock.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_BIDIRECTIONALLINK
+#include <bslalg_bidirectionallink.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_HASHTABLEIMPUTIL
+#include <bslalg_hashtableimputil.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_ALLOCATOR
+#include <bslma_allocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_AUTODESTRUCTOR
+#include <bslma_autodestructor.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_DEALLOCATORPROCTOR
+#include <bslma_deallocatorproctor.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_DEFAULT
+#include <bslma_default.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_HASHTABLE
+#include <bslstl_hashtable.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_UNORDEREDMAPKEYCONFIGURATION
+#include <bslstl_unorderedmapkeyconfiguration.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_BSLS_TYPES
+#include <bsls_types.h>
+#endif
+
+#ifndef INCLUDED_BSL_CSTDDEF
+#include <bsl_cstddef.h>
+#endif
+
+#ifndef INCLUDED_BSL_FUNCTIONAL
+#include <bsl_functional.h>
+#endif
+
+#ifndef INCLUDED_BSL_MEMORY
+#include <bsl_memory.h>
+#endif
+
+#ifndef INCLUDED_BSL_NEW
+#include <bsl_new.h>
+#endif
+
+#ifndef INCLUDED_BSL_UTILITY
+#include <bsl_utility.h>
+#endif
+
+namespace BloombergLP {
+namespace bdlcc {
+
+                           // ====================
+                           // class ShardedHashMap
+                           // ====================
+
+template <class KEY,
+          class VALUE,
+          class HASH  = bsl::hash<KEY>,
+          class EQUAL = bsl::equal_to<KEY> >
+class ShardedHashMap {
+    // This class template implements a thread-safe map from unique keys of the
+    // (template parameter) type 'KEY' to values of the (template parameter)
+    // type 'VALUE', using the (template parameter) types 'HASH' to hash keys
+    // and 'EQUAL' to compare keys for equality.  The map is partitioned into
+    // shards, each of which is locked independently (see {Callbacks} and
+    // {Thread Safety}).
+
+    // PRIVATE TYPES
+    typedef bsl::pair<const KEY, VALUE>                   Element;
+    typedef bslstl::UnorderedMapKeyConfiguration<Element> KeyConfig;
+    typedef bslstl::HashTable<KeyConfig,
+                              HASH,
+                              EQUAL,
+                              bsl::allocator<Element> >   Table;
+    typedef bslalg::HashTableImpUtil                      ImpUtil;
+
+    enum {
+        k_CACHE_LINE_SIZE = 64   // assumed size of a cache line, in bytes
+    };
+
+    struct Shard {
+        // This 'struct' holds one partition of a map, together with the lock
+        // protecting it.  Trailing padding keeps the lock and table of
+        // adjacent shards in an array on distinct cache lines.
+
+        // DATA
+        ReaderWriterSpinLock d_lock;                        // shard lock
+        Table                d_table;                       // shard elements
+        char                 d_padding[k_CACHE_LINE_SIZE];  // isolation
+
+        // CREATORS
+        Shard(const HASH&       hash,
+              const EQUAL&      equal,
+              bslma::Allocator *basicAllocator);
+            // Create an empty shard that uses the specified 'hash' and
+            // 'equal' functors to hash and compare keys, and the specified
+            // 'basicAllocator' to supply memory.
+    };
+
+    // DATA
+    Shard            *d_shards_p;     // array of 'd_numShards' shards (owned)
+
+    int               d_numShards;    // number of shards (a power of two)
+
+    HASH              d_hash;         // hashes a key once, both to select
+                                      // its shard and to locate it within
+                                      // that shard
+
+    bslma::Allocator *d_allocator_p;  // memory allocator for 'd_shards_p'
+                                      // (held, not owned)
+
+  private:
+    // NOT IMPLEMENTED
+    ShardedHashMap(const ShardedHashMap&);
+    ShardedHashMap& operator=(const ShardedHashMap&);
+
+    // PRIVATE CLASS METHODS
+    static int roundUpNumShards(int numShards);
+        // Return the smallest power of two that is not less than the specified
+        // 'numShards'.  The behavior is undefined unless '0 < numShards' and
+        // 'numShards <= 65536'.
+
+    static VALUE& valueOf(bslalg::BidirectionalLink *node);
+        // Return a reference providing modifiable access to the value held by
+        // the element at the specified 'node'.
+
+    // PRIVATE MANIPULATORS
+    void createShards(bslma::Allocator *const *shardAllocators,
+                      const HASH&              hash,
+                      const EQUAL&             equal);
+        // Allocate and create the 'd_numShards' shards of this map, each
+        // using the specified 'hash' and 'equal' functors, and using the
+        // corresponding allocator in the specified 'shardAllocators' array to
+        // supply memory, or the allocator of this map if 'shardAllocators' is
+        // 0, or if that allocator is 0.
+
+    // PRIVATE ACCESSORS
+    int shardIndexForHashCode(bsl::size_t hashCode) const;
+        // Return the index of the shard to which a key having the specified
+        // 'hashCode' belongs.
+
+    Shard& shardOf(bsl::size_t *hashCode, const KEY& key) const;
+        // Load into the specified 'hashCode' the hash code of the specified
+        // 'key', and return a reference providing modifiable access to the
+        // shard to which 'key' belongs.  Note that the shard's hash table
+        // uses a copy of the same 'HASH' functor, so that 'hashCode' may be
+        // supplied to it rather than hashing 'key' again.
+
+  public:
+    // CREATORS
+    explicit
+    ShardedHashMap(int numShards, bslma::Allocator *basicAllocator = 0);
+    ShardedHashMap(int               numShards,
+                   const HASH&       hash,
+                   const EQUAL&      equal,
+                   bslma::Allocator *basicAllocator = 0);
+        // Create an empty map having the specified 'numShards' rounded up to a
+        // power of two shards.  Optionally specify a 'hash' functor used to
+        // hash keys and an 'equal' functor used to compare keys for equality;
+        // if these are not supplied, default-constructed functors are used.
+        // Optionally specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.  The behavior is undefined unless '0 < numShards' and
+        // 'numShards <= 65536'.
+
+    ShardedHashMap(int                      numShards,
+                   bslma::Allocator *const *shardAllocators,
+                   const HASH&              hash = HASH(),
+                   const EQUAL&             equal = EQUAL(),
+                   bslma::Allocator        *basicAllocator = 0);
+        // Create an empty map having the specified 'numShards' rounded up to a
+        // power of two shards, where the shard at each index 'i' uses
+        // 'shardAllocators[i]' to supply memory for its elements.  Optionally
+        // specify a 'hash' functor used to hash keys and an 'equal' functor
+        // used to compare keys for equality; if these are not supplied,
+        // default-constructed functors are used.  Optionally specify a
+        // 'basicAllocator' used to supply memory for the shards themselves,
+        // and for the elements of each shard whose supplied allocator is 0.
+        // If 'basicAllocator' is 0, the currently installed default allocator
+        // is used.  The behavior is undefined unless '0 < numShards',
+        // 'numShards <= 65536', and 'shardAllocators' has at least
+        // 'numShards()' elements.
+
+    ~ShardedHashMap();
+        // Destroy this object.
+
+    // MANIPULATORS
+    void clear();
+        // Remove all the elements from this map.
+
+    bsl::size_t erase(const KEY& key);
+        // Remove the element having the specified 'key' from this map, if it
+        // exists.  Return the number of elements removed (i.e., 1 if 'key' was
+        // found, and 0 otherwise).
+
+    template <class PREDICATE>
+    bsl::size_t eraseIf(PREDICATE predicate);
+        // Invoke the specified 'predicate' with the key and value of each
+        // element in this map, as 'predicate(key, value)', under the write
+        // lock of the shard containing the element, and remove each element
+        // for which 'predicate' returns 'true'.  Return the number of elements
+        // removed.
+
+    template <class PREDICATE>
+    bsl::size_t eraseIf(const KEY& key, PREDICATE predicate);
+        // If this map contains an element having the specified 'key', invoke
+        // the specified 'predicate' with the value of that element, as
+        // 'predicate(value)', under the write lock of its shard, and remove
+        // the element if 'predicate' returns 'true'.  Return the number of
+        // elements removed.
+
+    bool insert(const KEY& key, const VALUE& value);
+        // Insert into this map an element having the specified 'key' and
+        // 'value' if 'key' is not already in this map.  Return 'true' if the
+        // element was inserted, and 'false' (leaving the map unchanged)
+        // otherwise.
+
+    template <class UPDATER>
+    bool insertOrUpdate(const KEY&   key,
+                        const VALUE& value,
+                        UPDATER      updater);
+        // Insert into this map an element having the specified 'key' and
+        // 'value' if 'key' is not already in this map; otherwise, invoke the
+        // specified 'updater' with the address of the value associated with
+        // 'key', as 'updater(&existingValue)', under the write lock of its
+        // shard.  Return 'true' if the element was inserted, and 'false'
+        // otherwise.
+
+    bool setValue(const KEY& key, const VALUE& value);
+        // Associate the specified 'value' with the specified 'key' in this
+        // map, inserting an element if 'key' is not already in this map, and
+        // assigning 'value' to the existing element otherwise.  Return 'true'
+        // if an element was inserted, and 'false' otherwise.
+
+    template <class UPDATER>
+    bool update(const KEY& key, UPDATER updater);
+        // If this map contains an element having the specified 'key', invoke
+        // the specified 'updater' with the address of its value, as
+        // 'updater(&value)', under the write lock of its shard.  Return 'true'
+        // if 'key' was found, and 'false' otherwise.
+
+    // ACCESSORS
+    bslma::Allocator *allocator() const;
+        // Return the allocator used by this map to supply memory for its
+        // shards.
+
+    bool contains(const KEY& key) const;
+        // Return 'true' if this map contains an element having the specified
+        // 'key', and 'false' otherwise.
+
+    bool getValue(VALUE *value, const KEY& key) const;
+        // Load into the specified 'value' a copy of the value associated with
+        // the specified 'key' in this map, if 'key' is found.  Return 'true'
+        // if 'key' was found, and 'false' (leaving 'value' unchanged)
+        // otherwise.
+
+    bool isEmpty() const;
+        // Return 'true' if this map contains no elements, and 'false'
+        // otherwise.  Note that the returned value may be out of date by the
+        // time it is examined if the map is concurrently modified.
+
+    int numShards() const;
+        // Return the number of shards of this map.
+
+    bslma::Allocator *shardAllocator(int index) const;
+        // Return the allocator used to supply memory for the elements of the
+        // shard at the specified 'index'.  The behavior is undefined unless
+        // '0 <= index < numShards()'.
+
+    int shardIndex(const KEY& key) const;
+        // Return the index of the shard to which the specified 'key' belongs.
+
+    bsl::size_t shardSize(int index) const;
+        // Return the number of elements in the shard at the specified 'index'.
+        // The behavior is undefined unless '0 <= index < numShards()'.
+
+    bsl::size_t size() const;
+        // Return the number of elements in this map.  Note that the returned
+        // value may be out of date by the time it is examined if the map is
+        // concurrently modified.
+
+    template <class VISITOR>
+    bool visit(const KEY& key, VISITOR visitor) const;
+        // If this map contains an element having the specified 'key', invoke
+        // the specified 'visitor' with the value of that element, as
+        // 'visitor(value)', under the read lock of its shard.  Return 'true'
+        // if 'key' was found, and 'false' otherwise.
+
+    template <class VISITOR>
+    VISITOR visitAll(VISITOR visitor) const;
+        // Invoke the specified 'visitor' with the key and value of each
+        // element in this map, as 'visitor(key, value)', holding the read lock
+        // of one shard at a time.  Return the 'visitor' (reflecting any
+        // changes to its state made by the invocations).
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                        // ---------------------------
+                        // class ShardedHashMap::Shard
+                        // ---------------------------
+
+// CREATORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+ShardedHashMap<KEY, VALUE, HASH, EQUAL>::Shard::Shard(
+                                             const HASH&       hash,
+                                             const EQUAL&      equal,
+                                             bslma::Allocator *basicAllocator)
+: d_lock()
+, d_table(hash, equal, 0, 1.0f, basicAllocator)
+{
+}
+
+                           // --------------------
+                           // class ShardedHashMap
+                           // --------------------
+
+// PRIVATE CLASS METHODS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+int ShardedHashMap<KEY, VALUE, HASH, EQUAL>::roundUpNumShards(int numShards)
+{
+    BSLS_ASSERT(0 < numShards);
+    BSLS_ASSERT(numShards <= 65536);
+
+    int result = 1;
+    while (result < numShards) {
+        result *= 2;
+    }
+    return result;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+VALUE& ShardedHashMap<KEY, VALUE, HASH, EQUAL>::valueOf(
+                                               bslalg::BidirectionalLink *node)
+{
+    return ImpUtil::extractValue<KeyConfig>(node).second;
+}
+
+// PRIVATE MANIPULATORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void ShardedHashMap<KEY, VALUE, HASH, EQUAL>::createShards(
+                                     bslma::Allocator *const *shardAllocators,
+                                     const HASH&              hash,
+                                     const EQUAL&             equal)
+{
+    // Creating an empty 'HashTable' does not allocate memory, but copying the
+    // 'hash' and 'equal' functors into it may throw, so both the array of
+    // shards and the shards already created are guarded until every shard
+    // has been created.
+
+    Shard *shards = static_cast<Shard *>(
+                         d_allocator_p->allocate(d_numShards * sizeof(Shard)));
+
+    bslma::DeallocatorProctor<bslma::Allocator> deallocatorProctor(
+                                                                shards,
+                                                                d_allocator_p);
+    bslma::AutoDestructor<Shard>                destructorProctor(shards, 0);
+
+    for (int i = 0; i < d_numShards; ++i) {
+        bslma::Allocator *allocator = shardAllocators && shardAllocators[i]
+                                    ? shardAllocators[i]
+                                    : d_allocator_p;
+        new (shards + i) Shard(hash, equal, allocator);
+        ++destructorProctor;
+    }
+
+    destructorProctor.release();
+    deallocatorProctor.release();
+
+    d_shards_p = shards;
+}
+
+// PRIVATE ACCESSORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+int ShardedHashMap<KEY, VALUE, HASH, EQUAL>::shardIndexForHashCode(
+                                                   bsl::size_t hashCode) const
+{
+    // Take the shard index from the high-order bits of a multiplicative hash,
+    // which are independent of the low-order bits of the hash code that the
+    // hash table of the shard uses to select a bucket.
+
+    const bsls::Types::Uint64 mixed =
+                       static_cast<bsls::Types::Uint64>(hashCode)
+                     * static_cast<bsls::Types::Uint64>(0x9E3779B97F4A7C15ULL);
+
+    return static_cast<int>((mixed >> 40) & (d_numShards - 1));
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename ShardedHashMap<KEY, VALUE, HASH, EQUAL>::Shard&
+ShardedHashMap<KEY, VALUE, HASH, EQUAL>::shardOf(bsl::size_t *hashCode,
+                                                 const KEY&   key) const
+{
+    BSLS_ASSERT_SAFE(hashCode);
+
+    *hashCode = d_hash(key);
+    return d_shards_p[shardIndexForHashCode(*hashCode)];
+}
+
+// CREATORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+ShardedHashMap<KEY, VALUE, HASH, EQUAL>::ShardedHashMap(
+                                              int               numShards,
+                                              bslma::Allocator *basicAllocator)
+: d_shards_p(0)
+, d_numShards(roundUpNumShards(numShards))
+, d_hash()
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    createShards(0, HASH(), EQUAL());
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+ShardedHashMap<KEY, VALUE, HASH, EQUAL>::ShardedHashMap(
+                                              int               numShards,
+                                              const HASH&       hash,
+                                              const EQUAL&      equal,
+                                              bslma::Allocator *basicAllocator)
+: d_shards_p(0)
+, d_numShards(roundUpNumShards(numShards))
+, d_hash(hash)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    createShards(0, hash, equal);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+ShardedHashMap<KEY, VALUE, HASH, EQUAL>::ShardedHashMap(
+                                      int                      numShards,
+                                      bslma::Allocator *const *shardAllocators,
+                                      const HASH&              hash,
+                                      const EQUAL&             equal,
+                                      bslma::Allocator        *basicAllocator)
+: d_shards_p(0)
+, d_numShards(roundUpNumShards(numShards))
+, d_hash(hash)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(shardAllocators);
+
+    createShards(shardAllocators, hash, equal);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+ShardedHashMap<KEY, VALUE, HASH, EQUAL>::~ShardedHashMap()
+{
+    for (int i = 0; i < d_numShards; ++i) {
+        d_shards_p[i].~Shard();
+    }
+    d_allocator_p->deallocate(d_shards_p);
+}
+
+// MANIPULATORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void ShardedHashMap<KEY, VALUE, HASH, EQUAL>::clear()
+{
+    for (int i = 0; i < d_numShards; ++i) {
+        ReaderWriterSpinLockWriteGuard guard(&d_shards_p[i].d_lock);
+        d_shards_p[i].d_table.removeAll();
+    }
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+bsl::size_t ShardedHashMap<KEY, VALUE, HASH, EQUAL>::erase(const KEY& key)
+{
+    bsl::size_t                    hashCode;
+    Shard&                         shard = shardOf(&hashCode, key);
+    ReaderWriterSpinLockWriteGuard guard(&shard.d_lock);
+
+    bslalg::BidirectionalLink *node =
+                                 shard.d_table.findWithHashCode(key, hashCode);
+    if (!node) {
+        return 0;                                                     // RETURN
+    }
+    shard.d_table.removeWithHashCode(node, hashCode);
+    return 1;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+template <class PREDICATE>
+bsl::size_t ShardedHashMap<KEY, VALUE, HASH, EQUAL>::eraseIf(
+                                                           PREDICATE predicate)
+{
+    bsl::size_t numErased = 0;
+
+    for (int i = 0; i < d_numShards; ++i) {
+        ReaderWriterSpinLockWriteGuard guard(&d_shards_p[i].d_lock);
+
+        Table&                     table = d_shards_p[i].d_table;
+        bslalg::BidirectionalLink *node  = table.elementListRoot();
+        while (node) {
+            const Element& element =
+                               ImpUtil::extractValue<KeyConfig>(node);
+            if (predicate(element.first, element.second)) {
+                node = table.remove(node);
+                ++numErased;
+            }
+            else {
+                node = node->nextLink();
+            }
+        }
+    }
+    return numErased;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+template <class PREDICATE>
+bsl::size_t ShardedHashMap<KEY, VALUE, HASH, EQUAL>::eraseIf(
+                                                       const KEY& key,
+                                                       PREDICATE  predicate)
+{
+    bsl::size_t                    hashCode;
+    Shard&                         shard = shardOf(&hashCode, key);
+    ReaderWriterSpinLockWriteGuard guard(&shard.d_lock);
+
+    bslalg::BidirectionalLink *node =
+                                 shard.d_table.findWithHashCode(key, hashCode);
+    if (!node || !predicate(static_cast<const VALUE&>(valueOf(node)))) {
+        return 0;                                                     // RETURN
+    }
+    shard.d_table.removeWithHashCode(node, hashCode);
+    return 1;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+bool ShardedHashMap<KEY, VALUE, HASH, EQUAL>::insert(const KEY&   key,
+                                                     const VALUE& value)
+{
+    bsl::size_t                    hashCode;
+    Shard&                         shard = shardOf(&hashCode, key);
+    ReaderWriterSpinLockWriteGuard guard(&shard.d_lock);
+
+    bool isInserted;
+    shard.d_table.insertIfMissingWithHashCode(&isInserted,
+                                              Element(key, value),
+                                              hashCode);
+    return isInserted;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+template <class UPDATER>
+bool ShardedHashMap<KEY, VALUE, HASH, EQUAL>::insertOrUpdate(
+                                                        const KEY&   key,
+                                                        const VALUE& value,
+                                                        UPDATER      updater)
+{
+    bsl::size_t                    hashCode;
+    Shard&                         shard = shardOf(&hashCode, key);
+    ReaderWriterSpinLockWriteGuard guard(&shard.d_lock);
+
+    bslalg::BidirectionalLink *node =
+                                 shard.d_table.findWithHashCode(key, hashCode);
+    if (node) {
+        updater(&valueOf(node));
+        return false;                                                 // RETURN
+    }
+    bool isInserted;  // not used
+    shard.d_table.insertIfMissingWithHashCode(&isInserted,
+                                              Element(key, value),
+                                              hashCode);
+    return true;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+bool ShardedHashMap<KEY, VALUE, HASH, EQUAL>::setValue(const KEY&   key,
+                                                       const VALUE& value)
+{
+    bsl::size_t                    hashCode;
+    Shard&                         shard = shardOf(&hashCode, key);
+    ReaderWriterSpinLockWriteGuard guard(&shard.d_lock);
+
+    bslalg::BidirectionalLink *node =
+                                 shard.d_table.findWithHashCode(key, hashCode);
+    if (node) {
+        valueOf(node) = value;
+        return false;                                                 // RETURN
+    }
+    bool isInserted;  // not used
+    shard.d_table.insertIfMissingWithHashCode(&isInserted,
+                                              Element(key, value),
+                                              hashCode);
+    return true;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+template <class UPDATER>
+bool ShardedHashMap<KEY, VALUE, HASH, EQUAL>::update(const KEY& key,
+                                                     UPDATER    updater)
+{
+    bsl::size_t                    hashCode;
+    Shard&                         shard = shardOf(&hashCode, key);
+    ReaderWriterSpinLockWriteGuard guard(&shard.d_lock);
+
+    bslalg::BidirectionalLink *node =
+                                 shard.d_table.findWithHashCode(key, hashCode);
+    if (!node) {
+        return false;                                                 // RETURN
+    }
+    updater(&valueOf(node));
+    return true;
+}
+
+// ACCESSORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bslma::Allocator *ShardedHashMap<KEY, VALUE, HASH, EQUAL>::allocator() const
+{
+    return d_allocator_p;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+bool ShardedHashMap<KEY, VALUE, HASH, EQUAL>::contains(const KEY& key) const
+{
+    bsl::size_t                   hashCode;
+    Shard&                        shard = shardOf(&hashCode, key);
+    ReaderWriterSpinLockReadGuard guard(&shard.d_lock);
+
+    return 0 != shard.d_table.findWithHashCode(key, hashCode);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+bool ShardedHashMap<KEY, VALUE, HASH, EQUAL>::getValue(VALUE      *value,
+                                                       const KEY&  key) const
+{
+    BSLS_ASSERT_SAFE(value);
+
+    bsl::size_t                   hashCode;
+    Shard&                        shard = shardOf(&hashCode, key);
+    ReaderWriterSpinLockReadGuard guard(&shard.d_lock);
+
+    bslalg::BidirectionalLink *node =
+                                 shard.d_table.findWithHashCode(key, hashCode);
+    if (!node) {
+        return false;                                                 // RETURN
+    }
+    *value = valueOf(node);
+    return true;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+bool ShardedHashMap<KEY, VALUE, HASH, EQUAL>::isEmpty() const
+{
+    for (int i = 0; i < d_numShards; ++i) {
+        ReaderWriterSpinLockReadGuard guard(&d_shards_p[i].d_lock);
+        if (0 != d_shards_p[i].d_table.size()) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+int ShardedHashMap<KEY, VALUE, HASH, EQUAL>::numShards() const
+{
+    return d_numShards;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bslma::Allocator *
+ShardedHashMap<KEY, VALUE, HASH, EQUAL>::shardAllocator(int index) const
+{
+    BSLS_ASSERT_SAFE(0 <= index);
+    BSLS_ASSERT_SAFE(index < d_numShards);
+
+    return d_shards_p[index].d_table.allocator().mechanism();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+int ShardedHashMap<KEY, VALUE, HASH, EQUAL>::shardIndex(const KEY& key) const
+{
+    return shardIndexForHashCode(d_hash(key));
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+bsl::size_t ShardedHashMap<KEY, VALUE, HASH, EQUAL>::shardSize(
+                                                               int index) const
+{
+    BSLS_ASSERT_SAFE(0 <= index);
+    BSLS_ASSERT_SAFE(index < d_numShards);
+
+    ReaderWriterSpinLockReadGuard guard(&d_shards_p[index].d_lock);
+    return d_shards_p[index].d_table.size();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+bsl::size_t ShardedHashMap<KEY, VALUE, HASH, EQUAL>::size() const
+{
+    bsl::size_t result = 0;
+    for (int i = 0; i < d_numShards; ++i) {
+        result += shardSize(i);
+    }
+    return result;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+template <class VISITOR>
+bool ShardedHashMap<KEY, VALUE, HASH, EQUAL>::visit(const KEY& key,
+                                                    VISITOR    visitor) const
+{
+    bsl::size_t                   hashCode;
+    Shard&                        shard = shardOf(&hashCode, key);
+    ReaderWriterSpinLockReadGuard guard(&shard.d_lock);
+
+    bslalg::BidirectionalLink *node =
+                                 shard.d_table.findWithHashCode(key, hashCode);
+    if (!node) {
+        return false;                                                 // RETURN
+    }
+    visitor(static_cast<const VALUE&>(valueOf(node)));
+    return true;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+template <class VISITOR>
+VISITOR ShardedHashMap<KEY, VALUE, HASH, EQUAL>::visitAll(
+                                                         VISITOR visitor) const
+{
+    for (int i = 0; i < d_numShards; ++i) {
+        ReaderWriterSpinLockReadGuard guard(&d_shards_p[i].d_lock);
+
+        for (bslalg::BidirectionalLink *node =
+                                       d_shards_p[i].d_table.elementListRoot();
+             node;
+             node = node->nextLink()) {
+            const Element& element =
+                               ImpUtil::extractValue<KeyConfig>(node);
+            visitor(element.first, element.second);
+        }
+    }
+    return visitor;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1303 @@
+// bdlcc_shardedhashmap.t.cpp                                         -*-C++-*-
+#include <bdlcc_shardedhashmap.h>
+
+#include <bdls_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_atomic.h>
+#include <bsls_stopwatch.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+#include <bsl_string.h>
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+#include <windows.h>
+#else
+#include <pthread.h>
+#endif
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                                TEST PLAN
+// ----------------------------------------------------------------------------
+//                                Overview
+//                                --------
+// 'bdlcc::ShardedHashMap' is a thread-safe container whose elements are
+// partitioned between independently locked 'bslstl::HashTable' shards.  Its
+// correctness as a map is tested in a single thread, using a
+// 'bslma::TestAllocator' to verify that memory is supplied by the intended
+// allocator and is not leaked.  Its thread safety is then tested by having
+// several threads update shared and private keys, and verifying the final
+// contents.  A negative test case measures the throughput of a mix of
+// lookups and updates for various numbers of threads and shards.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] ShardedHashMap(int numShards, Allocator *ba = 0);
+// [ 2] ShardedHashMap(int, const HASH&, const EQUAL&, Allocator *ba = 0);
+// [ 2] ShardedHashMap(int, Allocator *const *, HASH, EQUAL, Allocator *);
+// [ 2] ~ShardedHashMap();
+//
+// MANIPULATORS
+// [ 3] void clear();
+// [ 3] size_t erase(const KEY& key);
+// [ 5] size_t eraseIf(PREDICATE predicate);
+// [ 4] size_t eraseIf(const KEY& key, PREDICATE predicate);
+// [ 3] bool insert(const KEY& key, const VALUE& value);
+// [ 4] bool insertOrUpdate(const KEY&, const VALUE&, UPDATER);
+// [ 3] bool setValue(const KEY& key, const VALUE& value);
+// [ 4] bool update(const KEY& key, UPDATER updater);
+//
+// ACCESSORS
+// [ 2] bslma::Allocator *allocator() const;
+// [ 3] bool contains(const KEY& key) const;
+// [ 3] bool getValue(VALUE *value, const KEY& key) const;
+// [ 3] bool isEmpty() const;
+// [ 2] int numShards() const;
+// [ 2] bslma::Allocator *shardAllocator(int index) const;
+// [ 3] int shardIndex(const KEY& key) const;
+// [ 3] size_t shardSize(int index) const;
+// [ 3] size_t size() const;
+// [ 4] bool visit(const KEY& key, VISITOR visitor) const;
+// [ 5] VISITOR visitAll(VISITOR visitor) const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 7] USAGE EXAMPLE
+// [ 6] CONCERN: Concurrent updates of shared keys are not lost.
+// [-1] PERFORMANCE: throughput for various numbers of threads and shards
+
+// ============================================================================
+//                    STANDARD BDE ASSERT TEST MACRO
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(int c, const char *s, int i)
+{
+    if (c) {
+        cout << "Error " << __FILE__ << "(" << i << "): " << s
+             << "    (failed)" << endl;
+        if (0 <= testStatus && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BDLS_TESTUTIL_ASSERT
+#define LOOP_ASSERT  BDLS_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BDLS_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BDLS_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BDLS_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BDLS_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BDLS_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BDLS_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BDLS_TESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BDLS_TESTUTIL_ASSERTV
+
+#define Q   BDLS_TESTUTIL_Q   // Quote identifier literally.
+#define P   BDLS_TESTUTIL_P   // Print identifier and value.
+#define P_  BDLS_TESTUTIL_P_  // P(X) without '\n'.
+#define T_  BDLS_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BDLS_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+//=============================================================================
+//                  GLOBAL VARIABLES / TYPEDEFS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef bdlcc::ShardedHashMap<int, int> Obj;
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+typedef HANDLE    ThreadId;
+#else
+typedef pthread_t ThreadId;
+#endif
+
+typedef void *(*ThreadFunction)(void *arg);
+
+// ============================================================================
+//                  HELPER CLASSES AND FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+static
+ThreadId createThread(ThreadFunction func, void *arg)
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    return CreateThread(0, 0, (LPTHREAD_START_ROUTINE)func, arg, 0, 0);
+#else
+    ThreadId id;
+    pthread_create(&id, 0, func, arg);
+    return id;
+#endif
+}
+
+static
+void joinThread(ThreadId id)
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    WaitForSingleObject(id, INFINITE);
+    CloseHandle(id);
+#else
+    pthread_join(id, 0);
+#endif
+}
+
+struct ModuloHash {
+    // This 'struct' provides a hash functor for 'int' that returns its
+    // argument modulo 'k_MODULUS', so that many keys share a hash code.
+
+    enum { k_MODULUS = 7 };
+
+    bsl::size_t operator()(int value) const
+        // Return the specified 'value' modulo 'k_MODULUS'.
+    {
+        return static_cast<bsl::size_t>(value % k_MODULUS);
+    }
+};
+
+struct CountingHash {
+    // This 'struct' provides a hash functor for 'int' that counts the number
+    // of times it is invoked (by any object of this type).
+
+    static int s_numCalls;  // number of calls to 'operator()'
+
+    bsl::size_t operator()(int value) const
+        // Return the hash code of the specified 'value'.
+    {
+        ++s_numCalls;
+        return bsl::hash<int>()(value);
+    }
+};
+
+int CountingHash::s_numCalls = 0;
+
+struct ThrowingHash {
+    // This 'struct' provides a hash functor for 'int' whose copy constructor
+    // throws once a configurable number of copies (of any object of this
+    // type) has been made, so that a test can inject an exception into the
+    // construction of a map.
+
+    static int s_numCopiesBeforeThrow;  // copies to make before throwing, or
+                                        // negative to never throw
+
+    ThrowingHash()
+        // Create a hash functor.
+    {
+    }
+
+    ThrowingHash(const ThrowingHash&)
+        // Create a copy of a hash functor, throwing an 'int' if
+        // 's_numCopiesBeforeThrow' is 0, and decrementing it otherwise.
+    {
+        if (0 == s_numCopiesBeforeThrow--) {
+            throw 1;
+        }
+    }
+
+    bsl::size_t operator()(int value) const
+        // Return the hash code of the specified 'value'.
+    {
+        return bsl::hash<int>()(value);
+    }
+};
+
+int ThrowingHash::s_numCopiesBeforeThrow = -1;
+
+struct AddValue {
+    // This 'struct' provides an updater that adds a fixed amount to a value.
+
+    int d_amount;  // amount to add
+
+    explicit AddValue(int amount)
+        // Create an updater adding the specified 'amount'.
+    : d_amount(amount)
+    {
+    }
+
+    void operator()(int *value) const
+        // Add 'd_amount' to the specified 'value'.
+    {
+        *value += d_amount;
+    }
+};
+
+struct SaveValue {
+    // This 'struct' provides a visitor that saves the value it visits.
+
+    int *d_result_p;  // address at which to save (held, not owned)
+
+    explicit SaveValue(int *result)
+        // Create a visitor saving the value it visits to the specified
+        // 'result'.
+    : d_result_p(result)
+    {
+    }
+
+    void operator()(const int& value) const
+        // Save the specified 'value'.
+    {
+        *d_result_p = value;
+    }
+};
+
+struct IsNegative {
+    // This 'struct' provides a predicate selecting negative values.
+
+    bool operator()(const int& value) const
+        // Return 'true' if the specified 'value' is negative, and 'false'
+        // otherwise.
+    {
+        return value < 0;
+    }
+
+    bool operator()(const int&, const int& value) const
+        // Return 'true' if the specified 'value' is negative, and 'false'
+        // otherwise.
+    {
+        return value < 0;
+    }
+};
+
+struct SumElements {
+    // This 'struct' provides a visitor that accumulates the number of
+    // elements it visits, and the sums of their keys and values.
+
+    int d_count;     // number of elements visited
+    int d_keySum;    // sum of the keys visited
+    int d_valueSum;  // sum of the values visited
+
+    SumElements()
+        // Create a visitor that has visited no elements.
+    : d_count(0)
+    , d_keySum(0)
+    , d_valueSum(0)
+    {
+    }
+
+    void operator()(const int& key, const int& value)
+        // Accumulate the specified 'key' and 'value'.
+    {
+        ++d_count;
+        d_keySum   += key;
+        d_valueSum += value;
+    }
+};
+
+namespace TestCase6 {
+
+enum {
+    k_NUM_THREADS      = 8,
+    k_NUM_SHARED_KEYS  = 64,
+    k_NUM_PRIVATE_KEYS = 1000,
+    k_NUM_ITERATIONS   = 20
+};
+
+struct ThreadInfo {
+    Obj *d_obj_p;     // map under test
+    int  d_threadId;  // index of this thread
+};
+
+extern "C" void *updateThreadFunction(void *arg)
+{
+    ThreadInfo *info = static_cast<ThreadInfo *>(arg);
+    Obj&        mX   = *info->d_obj_p;
+
+    const int privateBase = 1000000 * (info->d_threadId + 1);
+
+    for (int iteration = 0; iteration < k_NUM_ITERATIONS; ++iteration) {
+        for (int i = 0; i < k_NUM_SHARED_KEYS; ++i) {
+            mX.insertOrUpdate(i, 1, AddValue(1));
+        }
+
+        for (int i = 0; i < k_NUM_PRIVATE_KEYS; ++i) {
+            const int key = privateBase + i;
+            if (0 == iteration % 2) {
+                ASSERTV(key, true == mX.insert(key, iteration));
+            }
+            else {
+                int value = -1;
+                ASSERTV(key, true      == mX.getValue(&value, key));
+                ASSERTV(key, iteration == value + 1);
+                ASSERTV(key, 1         == mX.erase(key));
+            }
+        }
+    }
+    return arg;
+}
+
+}  // close namespace TestCase6
+
+namespace TestCaseNegative1 {
+
+struct ThreadInfo {
+    Obj             *d_obj_p;          // map under test
+    int              d_threadId;       // index of this thread
+    int              d_numOperations;  // number of operations to perform
+    int              d_numKeys;        // number of distinct keys
+    bsls::AtomicInt *d_numFound_p;     // lookups that found their key
+};
+
+extern "C" void *throughputThreadFunction(void *arg)
+{
+    ThreadInfo *info = static_cast<ThreadInfo *>(arg);
+    Obj&        mX   = *info->d_obj_p;
+
+    // Perform nine lookups for every update, on a pseudo-random sequence of
+    // keys that differs for each thread.
+
+    unsigned int seed     = 12345u + 1000u * info->d_threadId;
+    int          numFound = 0;
+
+    for (int i = 0; i < info->d_numOperations; ++i) {
+        seed = seed * 1103515245u + 12345u;
+        const int key = static_cast<int>((seed >> 8) % info->d_numKeys);
+
+        if (0 == i % 10) {
+            mX.insertOrUpdate(key, 1, AddValue(1));
+        }
+        else {
+            int value;
+            numFound += mX.getValue(&value, key);
+        }
+    }
+    info->d_numFound_p->add(numFound);
+    return arg;
+}
+
+}  // close namespace TestCaseNegative1
+
+// ============================================================================
+//                                USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Counting Words From Several Threads
+/// - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that several threads each scan a part of a large document, and we
+// want to count the occurrences of each word in the document.
+//
+// First, we define an updater that increments a count:
+//..
+    struct IncrementCount {
+        // This 'struct' provides an updater that increments a count.
+
+        void operator()(int *count) const
+            // Increment the specified 'count'.
+        {
+            ++*count;
+        }
+    };
+//..
+
+    struct IsUnique {
+        // This 'struct' provides a predicate selecting unique words.
+
+        bool operator()(const bsl::string&, int count) const
+            // Return 'true' if the specified 'count' is 1, and 'false'
+            // otherwise.
+        {
+            return 1 == count;
+        }
+    };
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+    bool     veryVeryVerbose = argc > 4;
+    bool veryVeryVeryVerbose = argc > 5;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    switch (test) { case 0:
+      case 7: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+// Then, we create a map shared by all threads.  Sixteen shards are ample for
+// a handful of threads:
+//..
+    bdlcc::ShardedHashMap<bsl::string, int> wordCounts(16);
+//..
+// Next, each thread, for each word that it reads, inserts a count of 1 if the
+// word has not been seen before, or increments the existing count:
+//..
+    const char *words[] = { "the", "quick", "brown", "fox", "jumps", "over",
+                            "the", "lazy", "dog" };
+    const int   NUM_WORDS = sizeof words / sizeof *words;
+
+    for (int i = 0; i < NUM_WORDS; ++i) {
+        wordCounts.insertOrUpdate(words[i], 1, IncrementCount());
+    }
+//..
+// Then, once every thread has finished, we look up the count of a word:
+//..
+    int count;
+    ASSERT(true == wordCounts.getValue(&count, "the"));
+    ASSERT(2    == count);
+    ASSERT(8    == wordCounts.size());
+//..
+// Finally, we remove the words that occur only once, using a predicate that
+// the map invokes with each key and value:
+//..
+    ASSERT(7 == wordCounts.eraseIf(IsUnique()));
+    ASSERT(1 == wordCounts.size());
+//..
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // CONCURRENCY
+        //   Ensure that concurrent operations are correctly serialized.
+        //
+        // Concerns:
+        //: 1 Concurrent 'insertOrUpdate' calls on the same keys are neither
+        //:   lost nor duplicated.
+        //:
+        //: 2 Concurrent insertions and removals of distinct keys, including
+        //:   keys in the same shard, do not interfere with one another.
+        //:
+        //: 3 No memory is leaked.
+        //
+        // Plan:
+        //: 1 Create a map with fewer shards than threads.  In each of several
+        //:   threads, repeatedly increment a set of shared keys with
+        //:   'insertOrUpdate', and alternately insert and remove a set of keys
+        //:   private to the thread, verifying each private key with
+        //:   'getValue'.  (C-2)
+        //:
+        //: 2 When the threads are done, verify that each shared key has the
+        //:   total number of increments, and that no private key remains.
+        //:   (C-1)
+        //:
+        //: 3 Verify that the test allocator has no outstanding blocks once the
+        //:   map is destroyed.  (C-3)
+        //
+        // Testing:
+        //   CONCERN: Concurrent updates of shared keys are not lost.
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCURRENCY" << endl
+                          << "===========" << endl;
+
+        using namespace TestCase6;
+
+        bslma::TestAllocator da("default",  veryVeryVeryVerbose);
+        bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        {
+            Obj mX(4, &sa);  const Obj& X = mX;
+
+            ThreadInfo info[k_NUM_THREADS];
+            ThreadId   ids[k_NUM_THREADS];
+
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                info[i].d_obj_p    = &mX;
+                info[i].d_threadId = i;
+                ids[i] = createThread(&updateThreadFunction, &info[i]);
+            }
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                joinThread(ids[i]);
+            }
+
+            ASSERTV(X.size(), k_NUM_SHARED_KEYS == X.size());
+            for (int i = 0; i < k_NUM_SHARED_KEYS; ++i) {
+                int value = 0;
+                ASSERTV(i, X.getValue(&value, i));
+                ASSERTV(i, value,
+                        k_NUM_THREADS * k_NUM_ITERATIONS == value);
+            }
+        }
+        ASSERTV(sa.numBlocksInUse(), 0 == sa.numBlocksInUse());
+        ASSERTV(da.numBlocksTotal(), 0 == da.numBlocksTotal());
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // WHOLE-MAP CALLBACKS
+        //   Ensure that 'visitAll' and 'eraseIf' reach every element.
+        //
+        // Concerns:
+        //: 1 'visitAll' invokes the visitor exactly once with the key and
+        //:   value of each element, and returns the visitor.
+        //:
+        //: 2 'eraseIf' removes exactly the elements selected by the predicate,
+        //:   in every shard, and returns the number removed.
+        //:
+        //: 3 The nodes of the removed elements are made available for reuse
+        //:   by their shard.
+        //
+        // Plan:
+        //: 1 Populate a map with keys whose values alternate in sign.  Verify
+        //:   the count and sums accumulated by a visitor.  (C-1)
+        //:
+        //: 2 Erase the negative values, and verify the number removed and the
+        //:   remaining elements.  (C-2)
+        //:
+        //: 3 Re-insert the erased keys, and verify that no memory is
+        //:   allocated.  (C-3)
+        //
+        // Testing:
+        //   size_t eraseIf(PREDICATE predicate);
+        //   VISITOR visitAll(VISITOR visitor) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "WHOLE-MAP CALLBACKS" << endl
+                          << "===================" << endl;
+
+        bslma::TestAllocator da("default",  veryVeryVeryVerbose);
+        bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        {
+            Obj mX(8, &sa);  const Obj& X = mX;
+
+            const int NUM_KEYS = 200;
+
+            int expectedKeySum   = 0;
+            int expectedValueSum = 0;
+            for (int i = 0; i < NUM_KEYS; ++i) {
+                const int value = i % 2 ? -i : i;
+                mX.insert(i, value);
+                expectedKeySum   += i;
+                expectedValueSum += value;
+            }
+
+            SumElements sum = X.visitAll(SumElements());
+            ASSERTV(sum.d_count,    NUM_KEYS         == sum.d_count);
+            ASSERTV(sum.d_keySum,   expectedKeySum   == sum.d_keySum);
+            ASSERTV(sum.d_valueSum, expectedValueSum == sum.d_valueSum);
+
+            ASSERT(NUM_KEYS / 2 == mX.eraseIf(IsNegative()));
+            ASSERT(NUM_KEYS / 2 == X.size());
+
+            for (int i = 0; i < NUM_KEYS; ++i) {
+                ASSERTV(i, (0 == i % 2) == X.contains(i));
+            }
+
+            ASSERT(0 == mX.eraseIf(IsNegative()));
+
+            sum = X.visitAll(SumElements());
+            ASSERTV(sum.d_count, NUM_KEYS / 2 == sum.d_count);
+
+            const bsls::Types::Int64 BLOCKS = sa.numBlocksTotal();
+
+            for (int i = 1; i < NUM_KEYS; i += 2) {
+                ASSERTV(i, true == mX.insert(i, i));
+            }
+            ASSERTV(BLOCKS, sa.numBlocksTotal(),
+                    BLOCKS == sa.numBlocksTotal());
+        }
+        ASSERTV(sa.numBlocksInUse(), 0 == sa.numBlocksInUse());
+        ASSERTV(da.numBlocksTotal(), 0 == da.numBlocksTotal());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // KEYED CALLBACKS
+        //   Ensure that the updaters, visitors, and predicates supplied for a
+        //   key are invoked as documented.
+        //
+        // Concerns:
+        //: 1 'insertOrUpdate' inserts the supplied value for a new key without
+        //:   invoking the updater, and invokes the updater on the existing
+        //:   value otherwise.
+        //:
+        //: 2 'update' and 'visit' invoke their callback only if the key is
+        //:   found, and report whether it was.
+        //:
+        //: 3 'eraseIf' for a key removes the element only if it exists and the
+        //:   predicate returns 'true'.
+        //:
+        //: 4 The callbacks work with keys that share a hash code (and so a
+        //:   shard and a bucket).
+        //
+        // Plan:
+        //: 1 Using a map whose hash functor maps many keys to the same hash
+        //:   code, exercise each method on present and absent keys, and verify
+        //:   the return values and the resulting values.  (C-1..4)
+        //
+        // Testing:
+        //   size_t eraseIf(const KEY& key, PREDICATE predicate);
+        //   bool insertOrUpdate(const KEY&, const VALUE&, UPDATER);
+        //   bool update(const KEY& key, UPDATER updater);
+        //   bool visit(const KEY& key, VISITOR visitor) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "KEYED CALLBACKS" << endl
+                          << "===============" << endl;
+
+        typedef bdlcc::ShardedHashMap<int, int, ModuloHash> MObj;
+
+        bslma::TestAllocator da("default",  veryVeryVeryVerbose);
+        bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        {
+            MObj mX(4, &sa);  const MObj& X = mX;
+
+            const int NUM_KEYS = 50;
+
+            for (int i = 0; i < NUM_KEYS; ++i) {
+                ASSERTV(i, true == mX.insertOrUpdate(i, i, AddValue(1000)));
+            }
+            for (int i = 0; i < NUM_KEYS; i += 2) {
+                ASSERTV(i, false == mX.insertOrUpdate(i, -1, AddValue(1000)));
+            }
+            ASSERT(NUM_KEYS == X.size());
+
+            for (int i = 0; i < NUM_KEYS; ++i) {
+                int value = 0;
+                ASSERTV(i, true == X.visit(i, SaveValue(&value)));
+                ASSERTV(i, value, (i % 2 ? i : i + 1000) == value);
+            }
+
+            int value = 7;
+            ASSERT(false == X.visit(NUM_KEYS, SaveValue(&value)));
+            ASSERT(7     == value);
+
+            ASSERT(true  == mX.update(1, AddValue(-2)));
+            ASSERT(false == mX.update(NUM_KEYS, AddValue(-2)));
+            ASSERT(false == X.contains(NUM_KEYS));
+
+            ASSERT(true  == X.getValue(&value, 1));
+            ASSERT(-1    == value);
+
+            ASSERT(0 == mX.eraseIf(NUM_KEYS, IsNegative()));
+            ASSERT(0 == mX.eraseIf(2, IsNegative()));
+            ASSERT(1 == mX.eraseIf(1, IsNegative()));
+            ASSERT(false == X.contains(1));
+            ASSERT(true  == X.contains(2));
+            ASSERT(NUM_KEYS - 1 == X.size());
+        }
+        ASSERTV(sa.numBlocksInUse(), 0 == sa.numBlocksInUse());
+        ASSERTV(da.numBlocksTotal(), 0 == da.numBlocksTotal());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // BASIC MANIPULATORS AND ACCESSORS
+        //   Ensure that the map behaves as a map of unique keys.
+        //
+        // Concerns:
+        //: 1 'insert' adds an element only if its key is absent, and reports
+        //:   whether it did.
+        //:
+        //: 2 'setValue' adds an element if its key is absent, and otherwise
+        //:   assigns the value of the existing element.
+        //:
+        //: 3 'getValue' and 'contains' find exactly the elements inserted, and
+        //:   'getValue' leaves its output unchanged if the key is absent.
+        //:
+        //: 4 'erase' removes only the element having the key, and reports
+        //:   whether it did.
+        //:
+        //: 5 'size', 'isEmpty', and 'shardSize' report the number of elements,
+        //:   and each key is held by the shard reported by 'shardIndex'.
+        //:
+        //: 6 Keys are spread over all shards.
+        //:
+        //: 7 'clear' removes all elements, and releases their memory.
+        //:
+        //: 8 Each operation on a key hashes the key once, both to select its
+        //:   shard and to locate it within that shard.
+        //
+        // Plan:
+        //: 1 Insert, assign, look up, and erase a sequence of keys, verifying
+        //:   the return values and the accessors after each step.  (C-1..5)
+        //:
+        //: 2 Verify that each shard of a map holding many keys is non-empty,
+        //:   and that the shard sizes sum to 'size()'.  (C-6)
+        //:
+        //: 3 Clear the map and verify that it is empty, and that the allocator
+        //:   has no outstanding blocks other than the shard array.  (C-7)
+        //:
+        //: 4 Using a 'CountingHash' functor, verify that each operation on a
+        //:   key already in the map (so that the shard does not grow) invokes
+        //:   the functor exactly once.  (C-8)
+        //
+        // Testing:
+        //   void clear();
+        //   size_t erase(const KEY& key);
+        //   bool insert(const KEY& key, const VALUE& value);
+        //   bool setValue(const KEY& key, const VALUE& value);
+        //   bool contains(const KEY& key) const;
+        //   bool getValue(VALUE *value, const KEY& key) const;
+        //   bool isEmpty() const;
+        //   int shardIndex(const KEY& key) const;
+        //   size_t shardSize(int index) const;
+        //   size_t size() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BASIC MANIPULATORS AND ACCESSORS" << endl
+                          << "================================" << endl;
+
+        bslma::TestAllocator da("default",  veryVeryVeryVerbose);
+        bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        {
+            Obj mX(16, &sa);  const Obj& X = mX;
+
+            const bsls::Types::Int64 SHARD_BLOCKS = sa.numBlocksInUse();
+
+            ASSERT(true == X.isEmpty());
+            ASSERT(0    == X.size());
+
+            const int NUM_KEYS = 1000;
+
+            for (int i = 0; i < NUM_KEYS; ++i) {
+                ASSERTV(i, true  == mX.insert(i, i * 10));
+                ASSERTV(i, false == mX.insert(i, -1));
+                ASSERTV(i, false == X.isEmpty());
+                ASSERTV(i, i + 1 == static_cast<int>(X.size()));
+            }
+
+            for (int i = 0; i < NUM_KEYS; ++i) {
+                int value = -1;
+                ASSERTV(i, true   == X.getValue(&value, i));
+                ASSERTV(i, i * 10 == value);
+                ASSERTV(i, true   == X.contains(i));
+            }
+
+            int value = -1;
+            ASSERT(false == X.getValue(&value, NUM_KEYS));
+            ASSERT(-1    == value);
+            ASSERT(false == X.contains(NUM_KEYS));
+
+            ASSERT(false == mX.setValue(5, 55));
+            ASSERT(true  == mX.setValue(NUM_KEYS, 1));
+            ASSERT(true  == X.getValue(&value, 5));
+            ASSERT(55    == value);
+            ASSERT(NUM_KEYS + 1 == static_cast<int>(X.size()));
+
+            ASSERT(1 == mX.erase(NUM_KEYS));
+            ASSERT(0 == mX.erase(NUM_KEYS));
+            ASSERT(false == X.contains(NUM_KEYS));
+            ASSERT(NUM_KEYS == static_cast<int>(X.size()));
+
+            bsl::size_t total = 0;
+            for (int i = 0; i < X.numShards(); ++i) {
+                ASSERTV(i, 0 < X.shardSize(i));
+                total += X.shardSize(i);
+            }
+            ASSERTV(total, X.size() == total);
+
+            int counts[16] = { 0 };
+            for (int i = 0; i < NUM_KEYS; ++i) {
+                const int index = X.shardIndex(i);
+                ASSERTV(i, index, 0 <= index && index < X.numShards());
+                ++counts[index];
+            }
+            for (int i = 0; i < X.numShards(); ++i) {
+                ASSERTV(i, counts[i],
+                        X.shardSize(i) == static_cast<bsl::size_t>(counts[i]));
+            }
+
+            mX.clear();
+            ASSERT(true == X.isEmpty());
+            ASSERT(0    == X.size());
+            ASSERT(false == X.contains(0));
+            ASSERTV(sa.numBlocksInUse(),
+                    SHARD_BLOCKS <= sa.numBlocksInUse());
+
+            ASSERT(true == mX.insert(0, 0));
+            ASSERT(1    == X.size());
+        }
+        ASSERTV(sa.numBlocksInUse(), 0 == sa.numBlocksInUse());
+
+        if (veryVerbose) cout << "\tTesting calls to the hasher." << endl;
+        {
+            typedef bdlcc::ShardedHashMap<int, int, CountingHash> CObj;
+
+            CObj mX(4, &sa);  const CObj& X = mX;
+
+            const int NUM_KEYS = 100;
+
+            for (int i = 0; i < NUM_KEYS; ++i) {
+                mX.insert(i, i);
+            }
+
+            int value;
+
+            CountingHash::s_numCalls = 0;
+            ASSERT(false == mX.insert(1, 1));
+            ASSERTV(CountingHash::s_numCalls, 1 == CountingHash::s_numCalls);
+
+            CountingHash::s_numCalls = 0;
+            ASSERT(true == X.contains(2));
+            ASSERTV(CountingHash::s_numCalls, 1 == CountingHash::s_numCalls);
+
+            CountingHash::s_numCalls = 0;
+            ASSERT(true == X.getValue(&value, 3));
+            ASSERTV(CountingHash::s_numCalls, 1 == CountingHash::s_numCalls);
+
+            CountingHash::s_numCalls = 0;
+            ASSERT(false == mX.setValue(4, 40));
+            ASSERTV(CountingHash::s_numCalls, 1 == CountingHash::s_numCalls);
+
+            CountingHash::s_numCalls = 0;
+            ASSERT(1 == mX.erase(5));
+            ASSERTV(CountingHash::s_numCalls, 1 == CountingHash::s_numCalls);
+
+            ASSERT(NUM_KEYS - 1 == static_cast<int>(X.size()));
+        }
+        ASSERTV(sa.numBlocksInUse(), 0 == sa.numBlocksInUse());
+        ASSERTV(da.numBlocksTotal(), 0 == da.numBlocksTotal());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CREATORS
+        //   Ensure that each constructor creates an empty map having the
+        //   intended number of shards and allocators.
+        //
+        // Concerns:
+        //: 1 The number of shards is the requested number rounded up to a
+        //:   power of two.
+        //:
+        //: 2 The shard array is allocated from the supplied allocator, or the
+        //:   default allocator if none is supplied.
+        //:
+        //: 3 Each shard allocates its elements from the allocator supplied for
+        //:   it, or from the allocator of the map if that is 0.
+        //:
+        //: 4 The supplied hash and equality functors are used.
+        //:
+        //: 5 All memory is released on destruction.
+        //:
+        //: 6 QoI: Asserted precondition violations are detected when enabled.
+        //:
+        //: 7 If copying a functor throws while the shards are created, no
+        //:   memory is leaked.
+        //
+        // Plan:
+        //: 1 For a sequence of requested shard counts, create a map with each
+        //:   constructor, and verify 'numShards', 'allocator', and
+        //:   'shardAllocator'.  (C-1..2)
+        //:
+        //: 2 Create a map with an array of test allocators, one of which is 0,
+        //:   insert keys, and verify that each test allocator supplies memory
+        //:   exactly when its shard is non-empty.  (C-3)
+        //:
+        //: 3 Create a map with a 'ModuloHash' functor, and verify that keys
+        //:   having the same hash code are distinguished.  (C-4)
+        //:
+        //: 4 Verify that the test allocators have no outstanding blocks once
+        //:   the maps are destroyed.  (C-5)
+        //:
+        //: 5 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid shard counts and indices.  (C-6)
+        //:
+        //: 6 Using a 'ThrowingHash' functor, make the copy of the functor at
+        //:   each successive position throw while constructing a map, until
+        //:   construction succeeds, and verify that the supplied allocator
+        //:   has no outstanding blocks after each attempt.  (C-7)
+        //
+        // Testing:
+        //   ShardedHashMap(int numShards, Allocator *ba = 0);
+        //   ShardedHashMap(int, const HASH&, const EQUAL&, Allocator *ba = 0);
+        //   ShardedHashMap(int, Allocator *const *, HASH, EQUAL, Allocator *);
+        //   ~ShardedHashMap();
+        //   bslma::Allocator *allocator() const;
+        //   int numShards() const;
+        //   bslma::Allocator *shardAllocator(int index) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CREATORS" << endl
+                          << "========" << endl;
+
+        bslma::TestAllocator da("default",  veryVeryVeryVerbose);
+        bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        if (veryVerbose) cout << "\tTesting the number of shards." << endl;
+
+        static const struct {
+            int d_line;       // source line number
+            int d_requested;  // requested number of shards
+            int d_expected;   // expected number of shards
+        } DATA[] = {
+            //LINE  REQUESTED  EXPECTED
+            //----  ---------  --------
+            { L_,           1,        1 },
+            { L_,           2,        2 },
+            { L_,           3,        4 },
+            { L_,          16,       16 },
+            { L_,          17,       32 },
+            { L_,       65536,    65536 },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int LINE      = DATA[ti].d_line;
+            const int REQUESTED = DATA[ti].d_requested;
+            const int EXPECTED  = DATA[ti].d_expected;
+
+            {
+                Obj mX(REQUESTED);  const Obj& X = mX;
+                ASSERTV(LINE, EXPECTED == X.numShards());
+                ASSERTV(LINE, &da      == X.allocator());
+                ASSERTV(LINE, &da      == X.shardAllocator(0));
+                ASSERTV(LINE, &da      == X.shardAllocator(EXPECTED - 1));
+                ASSERTV(LINE, 0 < da.numBlocksInUse());
+            }
+            ASSERTV(LINE, 0 == da.numBlocksInUse());
+            {
+                Obj mX(REQUESTED, &sa);  const Obj& X = mX;
+                ASSERTV(LINE, EXPECTED == X.numShards());
+                ASSERTV(LINE, &sa      == X.allocator());
+                ASSERTV(LINE, &sa      == X.shardAllocator(EXPECTED - 1));
+                ASSERTV(LINE, 0 < sa.numBlocksInUse());
+            }
+            ASSERTV(LINE, 0 == sa.numBlocksInUse());
+        }
+        ASSERTV(da.numBlocksInUse(), 0 == da.numBlocksInUse());
+
+        if (veryVerbose) cout << "\tTesting per-shard allocators." << endl;
+        {
+            enum { k_NUM_SHARDS = 4 };
+
+            bslma::TestAllocator  ta0("shard0", veryVeryVeryVerbose);
+            bslma::TestAllocator  ta1("shard1", veryVeryVeryVerbose);
+            bslma::TestAllocator  ta3("shard3", veryVeryVeryVerbose);
+            bslma::TestAllocator *TA[k_NUM_SHARDS] = { &ta0, &ta1, 0, &ta3 };
+
+            bslma::Allocator *shardAllocators[k_NUM_SHARDS] = {
+                &ta0, &ta1, 0, &ta3
+            };
+            {
+                Obj mX(k_NUM_SHARDS, shardAllocators, bsl::hash<int>(),
+                       bsl::equal_to<int>(), &sa);
+                const Obj& X = mX;
+
+                ASSERT(k_NUM_SHARDS == X.numShards());
+                ASSERT(&sa          == X.allocator());
+                ASSERT(&ta0         == X.shardAllocator(0));
+                ASSERT(&ta1         == X.shardAllocator(1));
+                ASSERT(&sa          == X.shardAllocator(2));
+                ASSERT(&ta3         == X.shardAllocator(3));
+
+                const bsls::Types::Int64 SHARD_BLOCKS = sa.numBlocksInUse();
+
+                for (int i = 0; i < 100; ++i) {
+                    mX.insert(i, i);
+                }
+
+                for (int i = 0; i < k_NUM_SHARDS; ++i) {
+                    ASSERTV(i, 0 < X.shardSize(i));
+                    if (TA[i]) {
+                        ASSERTV(i, 0 < TA[i]->numBlocksInUse());
+                    }
+                }
+                ASSERT(SHARD_BLOCKS < sa.numBlocksInUse());
+            }
+            ASSERT(0 == ta0.numBlocksInUse());
+            ASSERT(0 == ta1.numBlocksInUse());
+            ASSERT(0 == ta3.numBlocksInUse());
+            ASSERT(0 == sa.numBlocksInUse());
+        }
+
+        if (veryVerbose) cout << "\tTesting supplied functors." << endl;
+        {
+            typedef bdlcc::ShardedHashMap<int, int, ModuloHash> MObj;
+
+            MObj mX(8, ModuloHash(), bsl::equal_to<int>(), &sa);
+            const MObj& X = mX;
+
+            for (int i = 0; i < 100; ++i) {
+                ASSERTV(i, true == mX.insert(i, i));
+            }
+            ASSERT(100 == X.size());
+
+            int numNonEmpty = 0;
+            for (int i = 0; i < X.numShards(); ++i) {
+                numNonEmpty += 0 < X.shardSize(i);
+            }
+            ASSERTV(numNonEmpty, numNonEmpty <= ModuloHash::k_MODULUS);
+        }
+        ASSERT(0 == sa.numBlocksInUse());
+        ASSERT(0 == da.numBlocksInUse());
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertFailureHandlerGuard hG(
+                                             bsls::AssertTest::failTestDriver);
+
+            ASSERT_FAIL(Obj(0,     &sa));
+            ASSERT_FAIL(Obj(65537, &sa));
+            ASSERT_PASS(Obj(65536, &sa));
+
+            Obj mX(4, &sa);  const Obj& X = mX;
+
+            ASSERT_SAFE_FAIL(X.shardAllocator(-1));
+            ASSERT_SAFE_PASS(X.shardAllocator( 0));
+            ASSERT_SAFE_PASS(X.shardAllocator( 3));
+            ASSERT_SAFE_FAIL(X.shardAllocator( 4));
+
+            ASSERT_SAFE_FAIL(X.shardSize(-1));
+            ASSERT_SAFE_FAIL(X.shardSize( 4));
+
+            int value;
+            ASSERT_SAFE_FAIL(X.getValue(0, 1));
+            ASSERT_SAFE_PASS(X.getValue(&value, 1));
+        }
+
+#ifdef BDE_BUILD_TARGET_EXC
+        if (veryVerbose) cout << "\tTesting exception safety." << endl;
+        {
+            typedef bdlcc::ShardedHashMap<int, int, ThrowingHash> TObj;
+
+            bool threw        = true;
+            int  numThrowings = 0;
+            for (int n = 0; threw; ++n) {
+                ThrowingHash::s_numCopiesBeforeThrow = n;
+                threw = false;
+                try {
+                    TObj mX(8, ThrowingHash(), bsl::equal_to<int>(), &sa);
+                    ASSERTV(n, true == mX.insert(n, n));
+                }
+                catch (int) {
+                    threw = true;
+                    ++numThrowings;
+                }
+                ASSERTV(n, sa.numBlocksInUse(), 0 == sa.numBlocksInUse());
+            }
+            ThrowingHash::s_numCopiesBeforeThrow = -1;
+
+            // At least one copy is made for each of the 8 shards.
+
+            ASSERTV(numThrowings, 8 < numThrowings);
+        }
+        ASSERT(0 == da.numBlocksInUse());
+#endif
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Insert, look up, update, and erase a few elements.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+        {
+            Obj mX(4, &ta);  const Obj& X = mX;
+
+            ASSERT(4    == X.numShards());
+            ASSERT(true == X.isEmpty());
+
+            ASSERT(true  == mX.insert(1, 10));
+            ASSERT(true  == mX.insert(2, 20));
+            ASSERT(false == mX.insert(1, 11));
+            ASSERT(2     == X.size());
+
+            int value = 0;
+            ASSERT(true == X.getValue(&value, 1));
+            ASSERT(10   == value);
+
+            ASSERT(false == mX.insertOrUpdate(1, 0, AddValue(5)));
+            ASSERT(true  == X.getValue(&value, 1));
+            ASSERT(15    == value);
+
+            ASSERT(1     == mX.erase(2));
+            ASSERT(false == X.contains(2));
+            ASSERT(1     == X.size());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: THROUGHPUT
+        //   Measure the throughput of a read-mostly workload.
+        //
+        // Concerns:
+        //: 1 Throughput scales with the number of threads when there are
+        //:   enough shards, whereas a single shard (equivalent to a map
+        //:   guarded by one lock) serializes the threads.
+        //
+        // Plan:
+        //: 1 For 1, 2, 4, 8, and 16 threads, and for maps of 1, 16, and 256
+        //:   shards pre-populated with half of the key range, run a fixed
+        //:   number of operations per thread (nine 'getValue' calls for every
+        //:   'insertOrUpdate'), and report the aggregate number of operations
+        //:   per second.  Optionally specify the number of operations per
+        //:   thread as the second argument.
+        //
+        // Testing:
+        //   PERFORMANCE: throughput for various numbers of threads and shards
+        // --------------------------------------------------------------------
+
+        cout << endl
+             << "PERFORMANCE: THROUGHPUT" << endl
+             << "=======================" << endl;
+
+        using namespace TestCaseNegative1;
+
+        const int NUM_OPERATIONS = argc > 2 ? atoi(argv[2]) : 1000000;
+        const int NUM_KEYS       = 100000;
+        const int MAX_THREADS    = 16;
+
+        const int SHARD_COUNTS[]   = { 1, 16, 256 };
+        const int NUM_SHARD_COUNTS =
+                                   sizeof SHARD_COUNTS / sizeof *SHARD_COUNTS;
+
+        cout << "operations per thread: " << NUM_OPERATIONS << endl;
+
+        for (int si = 0; si < NUM_SHARD_COUNTS; ++si) {
+            for (int numThreads = 1;
+                 numThreads <= MAX_THREADS;
+                 numThreads *= 2) {
+                Obj mX(SHARD_COUNTS[si]);
+
+                for (int i = 0; i < NUM_KEYS; i += 2) {
+                    mX.insert(i, 0);
+                }
+
+                bsls::AtomicInt numFound(0);
+                ThreadInfo      info[MAX_THREADS];
+                ThreadId        ids[MAX_THREADS];
+
+                bsls::Stopwatch timer;
+                timer.start(true);
+
+                for (int i = 0; i < numThreads; ++i) {
+                    info[i].d_obj_p         = &mX;
+                    info[i].d_threadId      = i;
+                    info[i].d_numOperations = NUM_OPERATIONS;
+                    info[i].d_numKeys       = NUM_KEYS;
+                    info[i].d_numFound_p    = &numFound;
+                    ids[i] = createThread(&throughputThreadFunction, &info[i]);
+                }
+                for (int i = 0; i < numThreads; ++i) {
+                    joinThread(ids[i]);
+                }
+
+                timer.stop();
+
+                const double seconds = timer.elapsedTime();
+                const double totalOperations =
+                           static_cast<double>(NUM_OPERATIONS) * numThreads;
+
+                cout << "shards: "    << SHARD_COUNTS[si]
+                     << "\tthreads: " << numThreads
+                     << "\tops/sec: " << totalOperations / seconds
+                     << "\tcpu/wall: "
+                     << (timer.accumulatedUserTime() +
+                         timer.accumulatedSystemTime()) / seconds
+                     << endl;
+
+                if (veryVerbose) {
+                    P_(numFound) P(mX.size())
+                }
+            }
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    LOOP_ASSERT(globalAllocator.numBlocksTotal(),
+                0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -4,8 +4,11 @@
 #include <bsls_ident.h>
 BSLS_IDENT_RCSID(bdlma_bufferedsequentialallocator_cpp,"$Id$ $CSID$")
 
+#include <bsls_assert.h>
 #include <bsls_performancehint.h>
 
+#include <bsl_limits.h>
+
 namespace BloombergLP {
 namespace bdlma {
 
@@ -30,6 +33,26 @@ void *BufferedSequentialAllocator::allocate(size_type size)
     return d_pool.allocate(size);
 }
 
+bool BufferedSequentialAllocator::tryExpandInPlace(void      *address,
+                                                   size_type  currentSize,
+                                                   size_type  newSize)
+{
+    BSLS_ASSERT(address);
+    BSLS_ASSERT(currentSize <= newSize);
+
+    const size_type maxSize = bsl::numeric_limits<int>::max();
+
+    if (0 == currentSize || maxSize < newSize) {
+        return false;                                                 // RETURN
+    }
+
+    const int size = static_cast<int>(newSize);
+
+    return size == d_pool.extend(address,
+                                 static_cast<int>(currentSize),
+                                 size);
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
@@ -56,6 +56,24 @@ int BufferManager::expand(void *address, int size)
     return size;
 }
 
+int BufferManager::extend(void *address, int originalSize, int newSize)
+{
+    BSLS_ASSERT(address);
+    BSLS_ASSERT(0 < originalSize);
+    BSLS_ASSERT(originalSize <= newSize);
+    BSLS_ASSERT(d_buffer_p);
+    BSLS_ASSERT(0 <= d_cursor);
+    BSLS_ASSERT(d_cursor <= d_bufferSize);
+
+    if (static_cast<char *>(address) + originalSize == d_buffer_p + d_cursor
+     && newSize - originalSize <= d_bufferSize - d_cursor) {
+        d_cursor += newSize - originalSize;
+        return newSize;                                               // RETURN
+    }
+
+    return originalSize;
+}
+
 int BufferManager::truncate(void *address, int originalSize, int newSize)
 {
     BSLS_ASSERT(address);
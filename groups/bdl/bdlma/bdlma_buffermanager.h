@@ -368,6 +368,21 @@ class BufferManager {
         // 'address' is 'size', and 'release' was not called after allocating
         // the memory at 'address'.
 
+    int extend(void *address, int originalSize, int newSize);
+        // Increase the amount of memory allocated at the specified 'address'
+        // of the specified 'originalSize' (in bytes) to the specified
+        // 'newSize' (in bytes).  Return 'newSize' after extending, or
+        // 'originalSize' if the memory at 'address' cannot be extended.  This
+        // method can only 'extend' the memory block returned by the most
+        // recent 'allocate' or 'allocateRaw' request from this buffer manager
+        // (or extended by the most recent call to 'expand' or 'extend'), and
+        // only if the buffer has at least 'newSize - originalSize' bytes
+        // remaining, and otherwise has no effect.  The behavior is undefined
+        // unless the memory at 'address' was originally allocated by this
+        // buffer manager, the size of the memory at 'address' is
+        // 'originalSize', '0 < originalSize', 'originalSize <= newSize', and
+        // 'release' was not called after allocating the memory at 'address'.
+
     char *replaceBuffer(char *newBuffer, int newBufferSize);
         // Replace the buffer currently managed by this object with the
         // specified 'newBuffer' of the specified 'newBufferSize' (in bytes);
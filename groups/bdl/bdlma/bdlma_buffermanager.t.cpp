@@ -58,6 +58,7 @@ using namespace bsl;
 // [ 8] void deleteObjectRaw(const TYPE *object);
 // [ 8] void deleteObject(const TYPE *object);
 // [ 9] int expand(void *address, int size);
+// [11] int extend(void *address, int originalSize, int newSize);
 // [ 4] char *replaceBuffer(char *newBuffer, int newBufferSize);
 // [ 5] void release();
 // [ 6] void reset();
@@ -69,7 +70,7 @@ using namespace bsl;
 // [ 7] bool hasSufficientCapacity(int size) const;
 //-----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [11] USAGE EXAMPLE
+// [12] USAGE EXAMPLE
 
 //=============================================================================
 //                      STANDARD BDE ASSERT TEST MACRO
@@ -369,7 +370,7 @@ int main(int argc, char *argv[])
     cout << "TEST " << __FILE__ << " CASE " << test << endl;
 
     switch (test) { case 0:
-      case 11: {
+      case 12: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -399,6 +400,76 @@ int main(int argc, char *argv[])
         result = detectNOccurrences(3, array, 5);
         ASSERT(false == result);
 
+      } break;
+      case 11: {
+        // --------------------------------------------------------------------
+        // EXTEND TEST
+        //
+        // Concerns:
+        //   1. That 'extend' grows the most recently allocated block in place
+        //      when the buffer has sufficient remaining capacity, and
+        //      subsequent allocations start after the extended block.
+        //   2. That when 'extend' fails (the block is not the most recently
+        //      allocated one, or the buffer is too small), 'originalSize' is
+        //      returned and the cursor is unchanged.
+        //   3. QoI: Asserted precondition violations are detected when
+        //      enabled.
+        //
+        // Plan:
+        //   Allocate two blocks from a buffer, attempt to extend each of
+        //   them, and verify the return value and the address of the next
+        //   allocation.  Finally, verify that, in appropriate build modes,
+        //   defensive checks are triggered.
+        //
+        // Testing:
+        //   int extend(void *address, int originalSize, int newSize);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "EXTEND TEST" << endl
+                                  << "===========" << endl;
+
+        enum { k_BUFFER_SIZE = 64 };
+
+        char *buffer = bufferStorage.buffer();
+
+        Obj mX(buffer, k_BUFFER_SIZE, bsls::Alignment::BSLS_BYTEALIGNED);
+
+        char *addr1 = static_cast<char *>(mX.allocate(8));
+        char *addr2 = static_cast<char *>(mX.allocate(8));
+        ASSERT(buffer     == addr1);
+        ASSERT(buffer + 8 == addr2);
+
+        if (verbose) cout << "\nTesting failed 'extend'." << endl;
+
+        ASSERT( 8 == mX.extend(addr1,  8, 16));
+        ASSERT( 8 == mX.extend(addr2,  8, 57));
+
+        if (verbose) cout << "\nTesting successful 'extend'." << endl;
+
+        ASSERT(16 == mX.extend(addr2,  8, 16));
+        ASSERT(16 == mX.extend(addr2, 16, 16));
+        ASSERT(56 == mX.extend(addr2, 16, 56));
+
+        ASSERT(0 == mX.allocate(1));
+
+        mX.truncate(addr2, 56, 24);
+
+        char *addr3 = static_cast<char *>(mX.allocate(8));
+        ASSERT(buffer + 32 == addr3);
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Obj mY(buffer, k_BUFFER_SIZE, bsls::Alignment::BSLS_BYTEALIGNED);
+            void *addr = mY.allocate(2);
+
+            ASSERT_SAFE_PASS(mY.extend(addr, 2, 3));
+            ASSERT_SAFE_FAIL(mY.extend(   0, 3, 4));
+            ASSERT_SAFE_FAIL(mY.extend(addr, 0, 4));
+            ASSERT_SAFE_FAIL(mY.extend(addr, 3, 2));
+        }
+
       } break;
       case 10: {
         // --------------------------------------------------------------------
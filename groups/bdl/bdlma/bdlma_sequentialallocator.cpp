@@ -4,8 +4,11 @@
 #include <bsls_ident.h>
 BSLS_IDENT_RCSID(bdlma_sequentialallocator_cpp,"$Id$ $CSID$")
 
+#include <bsls_assert.h>
 #include <bsls_performancehint.h>
 
+#include <bsl_limits.h>
+
 namespace BloombergLP {
 namespace bdlma {
 
@@ -53,6 +56,26 @@ void SequentialAllocator::reserveCapacity(int numBytes)
     d_sequentialPool.reserveCapacity(numBytes);
 }
 
+bool SequentialAllocator::tryExpandInPlace(void      *address,
+                                           size_type  currentSize,
+                                           size_type  newSize)
+{
+    BSLS_ASSERT(address);
+    BSLS_ASSERT(currentSize <= newSize);
+
+    const size_type maxSize = bsl::numeric_limits<int>::max();
+
+    if (0 == currentSize || maxSize < newSize) {
+        return false;                                                 // RETURN
+    }
+
+    const int size = static_cast<int>(newSize);
+
+    return size == d_sequentialPool.extend(address,
+                                           static_cast<int>(currentSize),
+                                           size);
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
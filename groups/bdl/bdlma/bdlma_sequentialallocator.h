@@ -400,6 +400,24 @@ class SequentialAllocator : public ManagedAllocator {
         // 'address' is 'originalSize', 'newSize <= originalSize',
         // '0 <= newSize', and 'release' was not called after allocating the
         // memory block at 'address'.
+
+    virtual bool tryExpandInPlace(void      *address,
+                                  size_type  currentSize,
+                                  size_type  newSize);
+        // Attempt to increase the size of the memory block at the specified
+        // 'address', having the specified 'currentSize' (in bytes), to the
+        // specified 'newSize' (in bytes) without changing its address.
+        // Return 'true' on success, and 'false' with no effect otherwise.
+        // This method can only extend the memory block returned by the most
+        // recent 'allocate' request from this allocator, and only if the
+        // current buffer has sufficient free memory space remaining.  The
+        // behavior is undefined unless the memory at 'address' was allocated
+        // by this allocator with a size of 'currentSize' (possibly as the
+        // result of a previous call to 'tryExpandInPlace' or 'reallocate'),
+        // 'currentSize <= newSize', and 'release' was not called after
+        // allocating the memory block at 'address'.  Note that containers
+        // using this allocator can thereby grow their most recently allocated
+        // array without copying its elements.
 };
 
 // ============================================================================
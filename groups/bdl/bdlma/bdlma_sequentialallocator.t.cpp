@@ -12,6 +12,7 @@
 
 #include <bsl_cstdlib.h>
 #include <bsl_iostream.h>
+#include <bsl_vector.h>
 
 using namespace BloombergLP;
 using namespace bsl;
@@ -73,9 +74,10 @@ using namespace bsl;
 // [ 4] void release();
 // [ 7] void reserveCapacity(int numBytes);
 // [ 6] int truncate(void *address, int originalSize, int newSize);
+// [ 8] bool tryExpandInPlace(void *addr, size_type size, size_type newSize);
 //-----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [ 8] USAGE TEST
+// [ 9] USAGE TEST
 
 //=============================================================================
 //                      STANDARD BDE ASSERT TEST MACRO
@@ -279,7 +281,7 @@ int main(int argc, char *argv[])
     bslma::Default::setGlobalAllocator(&globalAllocator);
 
     switch (test) { case 0:
-      case 8: {
+      case 9: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -313,6 +315,95 @@ int main(int argc, char *argv[])
 //  }
 //..
 
+      } break;
+      case 8: {
+        // --------------------------------------------------------------------
+        // 'tryExpandInPlace' TEST
+        //
+        // Concerns:
+        //   1. That 'tryExpandInPlace' extends the most recently allocated
+        //      memory block when the current buffer has sufficient space, and
+        //      that subsequent allocations start after the extended block.
+        //
+        //   2. That when 'tryExpandInPlace' fails, 'false' is returned and no
+        //      memory is consumed.
+        //
+        //   3. That a 'bsl::vector' of a bitwise-moveable type using the
+        //      allocator grows in place when reserving additional capacity.
+        //
+        // Plan:
+        //   Reserve capacity in a sequential allocator, allocate two memory
+        //   blocks, and attempt to extend each of them, verifying the return
+        //   value and the address of the next allocation.  Then verify that
+        //   the data of a 'bsl::vector<int>' keeps its address as it grows,
+        //   and that the backing test allocator is not used.
+        //
+        // Testing:
+        //   bool tryExpandInPlace(void *addr, size_type size, size_type new);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "'tryExpandInPlace' TEST" << endl
+                                  << "=======================" << endl;
+
+        bslma::TestAllocator ta(veryVeryVeryVerbose);
+
+        {
+            Obj mX(bsls::Alignment::BSLS_BYTEALIGNED, &ta);
+            mX.reserveCapacity(DEFAULT_SIZE);
+
+            const bsls::Types::Int64 NUM_BLOCKS = ta.numBlocksInUse();
+
+            char *addr1 = static_cast<char *>(mX.allocate(8));
+            char *addr2 = static_cast<char *>(mX.allocate(8));
+            ASSERT(addr1 + 8 == addr2);
+
+            if (verbose) cout << "\nTesting failed 'tryExpandInPlace'."
+                              << endl;
+
+            ASSERT(false == mX.tryExpandInPlace(addr1, 8, 16));
+            ASSERT(false == mX.tryExpandInPlace(addr2, 8, 1 << 20));
+
+            if (verbose) cout << "\nTesting successful 'tryExpandInPlace'."
+                              << endl;
+
+            ASSERT(true  == mX.tryExpandInPlace(addr2,  8, 16));
+            ASSERT(true  == mX.tryExpandInPlace(addr2, 16, 32));
+
+            char *addr3 = static_cast<char *>(mX.allocate(1));
+            ASSERT(addr2 + 32 == addr3);
+
+            ASSERT(NUM_BLOCKS == ta.numBlocksInUse());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\nTesting in-place 'bsl::vector' growth."
+                          << endl;
+        {
+            Obj mX(&ta);
+            mX.reserveCapacity(DEFAULT_SIZE);
+
+            const bsls::Types::Int64 NUM_BLOCKS = ta.numBlocksInUse();
+
+            bsl::vector<int> mV(&mX);
+            mV.reserve(4);
+            const int *DATA = mV.data();
+
+            for (int i = 0; i < 32; ++i) {
+                mV.push_back(i);
+                LOOP_ASSERT(i, DATA == mV.data());
+            }
+
+            mV.reserve(48);
+            ASSERT(DATA == mV.data());
+
+            for (int i = 0; i < 32; ++i) {
+                LOOP_ASSERT(i, i == mV[i]);
+            }
+
+            ASSERT(NUM_BLOCKS == ta.numBlocksInUse());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
       } break;
       case 7: {
         // --------------------------------------------------------------------
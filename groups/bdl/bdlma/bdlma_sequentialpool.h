@@ -492,6 +492,22 @@ class SequentialPool {
         // effect as the 'deleteObjectRaw' method (since no deallocation is
         // involved), and exists for consistency across pools.
 
+    int extend(void *address, int originalSize, int newSize);
+        // Increase the amount of memory allocated at the specified 'address'
+        // of the specified 'originalSize' (in bytes) to the specified
+        // 'newSize' (in bytes) without changing its address.  Return
+        // 'newSize' after extending, or 'originalSize' if the memory block at
+        // 'address' cannot be extended.  This method can only 'extend' the
+        // memory block returned by the most recent 'allocate' request from
+        // this memory pool, and only if the current buffer has sufficient
+        // free memory space remaining, and otherwise has no effect.  The
+        // behavior is undefined unless the memory at 'address' was originally
+        // allocated by this memory pool, the size of the memory block at
+        // 'address' is 'originalSize', '0 < originalSize',
+        // 'originalSize <= newSize', and 'release' was not called after
+        // allocating the memory block at 'address'.  Note that no memory is
+        // allocated by this method.
+
     void release();
         // Release all memory allocated through this pool.  The pool is reset
         // to its default-constructed state, retaining the alignment and
@@ -622,6 +638,18 @@ void SequentialPool::deleteObject(const TYPE *object)
     deleteObjectRaw(object);
 }
 
+inline
+int SequentialPool::extend(void *address, int originalSize, int newSize)
+{
+    BSLS_ASSERT_SAFE(address);
+    BSLS_ASSERT_SAFE(0 < originalSize);
+    BSLS_ASSERT_SAFE(originalSize <= newSize);
+
+    return d_buffer.buffer()
+           ? d_buffer.extend(address, originalSize, newSize)
+           : originalSize;
+}
+
 inline
 void SequentialPool::release()
 {
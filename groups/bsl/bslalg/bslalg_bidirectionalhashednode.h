@@ -0,0 +1,226 @@
+// bslalg_bidirectionalhashednode.h                                   -*-C++-*-
+#ifndef INCLUDED_BSLALG_BIDIRECTIONALHASHEDNODE
+#define INCLUDED_BSLALG_BIDIRECTIONALHASHEDNODE
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a list node holding a value and the hash code of its key.
+//
+//@CLASSES:
+//   bslalg::BidirectionalHashedNode : list node with a value and hash code
+//
+//@SEE_ALSO: bslalg_bidirectionalnode, bslalg_hashtableimputil
+//
+//@DESCRIPTION: This component provides a single POD-like class template,
+// 'bslalg::BidirectionalHashedNode', used to represent a node in a
+// doubly-linked (bidirectional) list that holds both a value of a
+// parameterized type and a 'native_std::size_t' hash code.  A
+// 'bslalg::BidirectionalHashedNode' publicly derives from
+// 'bslalg::BidirectionalNode', so it may be used anywhere a
+// 'bslalg::BidirectionalNode' holding the same 'VALUE' type is expected
+// (e.g., by the iterators of the hash containers, and by
+// 'bslalg::HashTableImpUtil::extractKey'), and adds a 'hashCode' attribute.
+// The following inheritance hierarchy diagram shows the classes involved and
+// their methods:
+//..
+//               ,-------------------------------.
+//              ( bslalg::BidirectionalHashedNode )
+//               `-------------------------------'
+//                               |      setHashCode
+//                               |      hashCode
+//                               |      (all CREATORS unimplemented)
+//                               V
+//                  ,-------------------------.
+//                 ( bslalg::BidirectionalNode )
+//                  `-------------------------'
+//                               |      value
+//                               |      (all CREATORS unimplemented)
+//                               V
+//                  ,-------------------------.
+//                 ( bslalg::BidirectionalLink )
+//                  `-------------------------'
+//                                      ctor
+//                                      dtor
+//                                      setNextLink
+//                                      setPreviousLink
+//                                      nextLink
+//                                      previousLink
+//..
+// A hash table whose nodes record the hash code of the key they hold need
+// never call the user-supplied hash functor again for an element once it has
+// been inserted: rehashing, and removing an element, can use the stored hash
+// code, and a lookup can compare the stored hash code with that of the key
+// being sought before calling the (potentially expensive) key-equality
+// comparator.  The price is an additional 'native_std::size_t' in every node.
+//
+// Like 'bslalg::BidirectionalNode', this class is "POD-like" to facilitate
+// efficient allocation and use in the context of container implementations:
+// it defines no constructor or destructor, the 'value' attribute is
+// constructed in-place by the container, and the 'hashCode' attribute has an
+// unspecified value until it is set by 'setHashCode'.
+//
+///Usage
+///-----
+// This section illustrates intended usage of this component.
+//
+///Example 1: Avoiding Calls to a Hash Functor
+///- - - - - - - - - - - - - - - - - - - - - -
+// Suppose we have a (very simple) hash function for strings, and we want to
+// avoid calling it more than once for the value held in each list node.
+//
+// First, we define the hash function:
+//..
+//  native_std::size_t hashString(const char *string)
+//      // Return a hash code for the specified null-terminated 'string'.
+//  {
+//      native_std::size_t result = 5381;
+//      while (*string) {
+//          result = result * 33 + static_cast<unsigned char>(*string++);
+//      }
+//      return result;
+//  }
+//..
+// Then, we allocate a node holding a 'const char *' value, and record the
+// hash code of its value in the node when the node is populated:
+//..
+//  typedef bslalg::BidirectionalHashedNode<const char *> Node;
+//
+//  bslma::TestAllocator oa;
+//
+//  Node *node = static_cast<Node *>(oa.allocate(sizeof(Node)));
+//  node->reset();
+//  node->value() = "hello world";
+//  node->setHashCode(hashString(node->value()));
+//..
+// Next, we observe that the node may be used wherever a
+// 'bslalg::BidirectionalNode' holding the same type is expected:
+//..
+//  bslalg::BidirectionalNode<const char *> *base = node;
+//  assert(0 == strcmp("hello world", base->value()));
+//..
+// Now, we use the stored hash code to rule out a mismatch without comparing
+// the strings:
+//..
+//  const char *key = "goodbye world";
+//  assert(hashString(key) != node->hashCode());
+//..
+// Finally, we return the memory of the node to the allocator:
+//..
+//  oa.deallocate(node);
+//..
+
+#ifndef INCLUDED_BSLSCM_VERSION
+#include <bslscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_BIDIRECTIONALNODE
+#include <bslalg_bidirectionalnode.h>
+#endif
+
+#ifndef INCLUDED_BSLS_NATIVESTD
+#include <bsls_nativestd.h>
+#endif
+
+#ifndef INCLUDED_CSTDDEF
+#include <cstddef>  // std::size_t
+#define INCLUDED_CSTDDEF
+#endif
+
+namespace BloombergLP {
+
+namespace bslalg {
+
+                        // =============================
+                        // class BidirectionalHashedNode
+                        // =============================
+
+template <class VALUE>
+class BidirectionalHashedNode : public bslalg::BidirectionalNode<VALUE> {
+    // This POD-like 'class' describes a node suitable for use in a doubly-
+    // linked (bidirectional) list, holding a value of the (template parameter)
+    // type 'VALUE' together with a hash code for that value.  This class is a
+    // "POD-like" to facilitate efficient allocation and use in the context of
+    // a container implementation.  In order to meet the essential requirements
+    // of a POD type, this 'class' does not define a constructor or destructor.
+
+  private:
+    // DATA
+    native_std::size_t d_hashCode;  // hash code of 'value'
+
+    // The following creators are not defined because a
+    // 'BidirectionalHashedNode' should never be constructed, destructed, or
+    // assigned.
+
+  private:
+    // NOT IMPLEMENTED
+    BidirectionalHashedNode();
+    BidirectionalHashedNode(const BidirectionalHashedNode&);
+    BidirectionalHashedNode& operator=(const BidirectionalHashedNode&);
+    ~BidirectionalHashedNode();
+
+  public:
+    // MANIPULATORS
+    void setHashCode(native_std::size_t value);
+        // Set the 'hashCode' attribute of this object to the specified
+        // 'value'.
+
+    // ACCESSORS
+    native_std::size_t hashCode() const;
+        // Return the 'hashCode' attribute of this object.  The behavior is
+        // undefined unless 'setHashCode' has been called on this object.
+};
+
+// ===========================================================================
+//                  TEMPLATE AND INLINE FUNCTION DEFINITIONS
+// ===========================================================================
+
+                        // -----------------------------
+                        // class BidirectionalHashedNode
+                        // -----------------------------
+
+// MANIPULATORS
+template <class VALUE>
+inline
+void BidirectionalHashedNode<VALUE>::setHashCode(native_std::size_t value)
+{
+    d_hashCode = value;
+}
+
+// ACCESSORS
+template <class VALUE>
+inline
+native_std::size_t BidirectionalHashedNode<VALUE>::hashCode() const
+{
+    return d_hashCode;
+}
+
+}  // close namespace bslalg
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,327 @@
+// bslalg_bidirectionalhashednode.t.cpp                               -*-C++-*-
+#include <bslalg_bidirectionalhashednode.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bsls_bsltestutil.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                              TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test is a POD-like class template that adds a single
+// attribute, 'hashCode', to 'bslalg::BidirectionalNode'.  We test that the new
+// attribute may be set and observed independently of the attributes of the
+// base classes, and that an object may be used through a pointer to its base
+// class.
+//
+// Global Concerns:
+//: o No memory is ever allocated.
+//-----------------------------------------------------------------------------
+// MANIPULATORS
+// [ 2] void setHashCode(native_std::size_t value);
+//
+// ACCESSORS
+// [ 2] native_std::size_t hashCode() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 3] USAGE EXAMPLE
+
+// ============================================================================
+//                      STANDARD BDE ASSERT TEST MACROS
+// ----------------------------------------------------------------------------
+// NOTE: THIS IS A LOW-LEVEL COMPONENT AND MAY NOT USE ANY C++ LIBRARY
+// FUNCTIONS, INCLUDING IOSTREAMS.
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool b, const char *s, int i)
+{
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+//=============================================================================
+//                              USAGE EXAMPLE
+//-----------------------------------------------------------------------------
+
+///Example 1: Avoiding Calls to a Hash Functor
+///- - - - - - - - - - - - - - - - - - - - - -
+// Suppose we have a (very simple) hash function for strings, and we want to
+// avoid calling it more than once for the value held in each list node.
+//
+// First, we define the hash function:
+//..
+native_std::size_t hashString(const char *string)
+    // Return a hash code for the specified null-terminated 'string'.
+{
+    native_std::size_t result = 5381;
+    while (*string) {
+        result = result * 33 + static_cast<unsigned char>(*string++);
+    }
+    return result;
+}
+//..
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int  test                = argc > 1 ? atoi(argv[1]) : 0;
+    bool verbose             = argc > 2;
+//  bool veryVerbose         = argc > 3;
+//  bool veryVeryVerbose     = argc > 4;
+    bool veryVeryVeryVerbose = argc > 5;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    // CONCERN: In no case is memory allocated from the global allocator.
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    bslma::TestAllocator         da("default", veryVeryVeryVerbose);
+    bslma::DefaultAllocatorGuard dag(&da);
+
+    switch (test) { case 0:
+      case 3: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+// Then, we allocate a node holding a 'const char *' value, and record the
+// hash code of its value in the node when the node is populated:
+//..
+    typedef bslalg::BidirectionalHashedNode<const char *> Node;
+
+    bslma::TestAllocator oa;
+
+    Node *node = static_cast<Node *>(oa.allocate(sizeof(Node)));
+    node->reset();
+    node->value() = "hello world";
+    node->setHashCode(hashString(node->value()));
+//..
+// Next, we observe that the node may be used wherever a
+// 'bslalg::BidirectionalNode' holding the same type is expected:
+//..
+    bslalg::BidirectionalNode<const char *> *base = node;
+    ASSERT(0 == strcmp("hello world", base->value()));
+//..
+// Now, we use the stored hash code to rule out a mismatch without comparing
+// the strings:
+//..
+    const char *key = "goodbye world";
+    ASSERT(hashString(key) != node->hashCode());
+//..
+// Finally, we return the memory of the node to the allocator:
+//..
+    oa.deallocate(node);
+//..
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // MANIPULATORS AND ACCESSORS
+        //
+        // Concerns:
+        //: 1 'hashCode' returns the value most recently passed to
+        //:   'setHashCode', including the extreme values of 'size_t'.
+        //:
+        //: 2 'hashCode' is a 'const' method.
+        //:
+        //: 3 Setting the hash code does not affect the value or the links of
+        //:   the node, and setting those does not affect the hash code.
+        //:
+        //: 4 The object is usable through a pointer to either base class.
+        //
+        // Plan:
+        //: 1 Allocate an object and populate each of its attributes.  Set a
+        //:   sequence of hash codes, observing each through a 'const'
+        //:   reference, and verify that the other attributes are unchanged.
+        //:   (C-1..3)
+        //:
+        //: 2 Modify the value and links through pointers to the base classes,
+        //:   and verify that the hash code is unchanged.  (C-3..4)
+        //
+        // Testing:
+        //   void setHashCode(native_std::size_t value);
+        //   native_std::size_t hashCode() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nMANIPULATORS AND ACCESSORS"
+                            "\n==========================\n");
+
+        typedef bslalg::BidirectionalHashedNode<int> Obj;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        Obj *xPtr = static_cast<Obj *>(oa.allocate(sizeof(Obj)));
+        Obj& mX = *xPtr;  const Obj& X = mX;
+
+        bslalg::BidirectionalLink * const K1 =
+                           reinterpret_cast<bslalg::BidirectionalLink *>(0x10);
+        bslalg::BidirectionalLink * const K2 =
+                           reinterpret_cast<bslalg::BidirectionalLink *>(0x20);
+
+        mX.setPreviousLink(K1);
+        mX.setNextLink(K2);
+        mX.value() = 42;
+
+        const native_std::size_t DATA[] = {
+            0, 1, 42, 0x5a5a5a5a, ~native_std::size_t(0), 7
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int ti = 0; ti != NUM_DATA; ++ti) {
+            mX.setHashCode(DATA[ti]);
+
+            ASSERTV(ti, DATA[ti] == X.hashCode());
+            ASSERTV(ti, 42       == X.value());
+            ASSERTV(ti, K1       == X.previousLink());
+            ASSERTV(ti, K2       == X.nextLink());
+        }
+
+        bslalg::BidirectionalNode<int> *base = xPtr;
+        base->value() = -1;
+        ASSERTV(X.value(), -1 == X.value());
+        ASSERTV(X.hashCode(), 7 == X.hashCode());
+
+        bslalg::BidirectionalLink *link = xPtr;
+        link->reset();
+        ASSERT(0 == X.previousLink());
+        ASSERT(0 == X.nextLink());
+        ASSERTV(X.hashCode(), 7 == X.hashCode());
+
+        oa.deallocate(xPtr);
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Allocate an object, set its value and hash code, and observe
+        //:   them.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        typedef bslalg::BidirectionalHashedNode<int> Obj;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        Obj *xPtr = static_cast<Obj *>(oa.allocate(sizeof(Obj)));
+        Obj& mX = *xPtr;  const Obj& X = mX;
+
+        ASSERT(sizeof(bslalg::BidirectionalNode<int>) < sizeof(Obj));
+
+        mX.reset();
+        mX.value() = 1;
+        mX.setHashCode(2);
+        ASSERTV(X.value(),    1 == X.value());
+        ASSERTV(X.hashCode(), 2 == X.hashCode());
+
+        oa.deallocate(xPtr);
+        ASSERTV(oa.numBytesInUse(), 0 == oa.numBytesInUse());
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    ASSERTV(da.numBlocksTotal(), 0 == da.numBlocksTotal());
+
+    // CONCERN: In no case is memory allocated from the global allocator.
+
+    ASSERTV(globalAllocator.numBlocksTotal(),
+            0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,434 @@
+// bslalg_bulkmemoryutil.cpp                                          -*-C++-*-
+#include <bslalg_bulkmemoryutil.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id$ $CSID$")
+
+#include <bsls_assert.h>
+#include <bsls_platform.h>
+#include <bsls_types.h>
+
+#if (defined(BSLS_PLATFORM_CPU_X86_64) || defined(BSLS_PLATFORM_CPU_X86))     \
+ && (defined(BSLS_PLATFORM_CMP_CLANG)                                         \
+  || (defined(BSLS_PLATFORM_CMP_GNU) && BSLS_PLATFORM_CMP_VERSION >= 40900))
+// These compilers accept the 'target' attribute, allowing SSE2 instructions
+// to be used in builds whose baseline does not include them, and provide
+// '__builtin_cpu_supports' to decide at run time whether they may be used.
+
+#define BSLALG_BULKMEMORYUTIL_X86_STREAMING 1
+#include <emmintrin.h>
+#endif
+
+// IMPLEMENTATION NOTES: A bulk operation is described by a 'BulkOperation'
+// object, and divided into jobs, each processing a contiguous chunk of the
+// destination.  The chunk size is a multiple of 'k_MIN_CHUNK_SIZE' (or, for
+// 'replicate', of the size of the block being repeated), so that each job
+// starts on a page boundary relative to the start of the range, and no two
+// jobs write the same cache line unless the destination is not aligned.
+//
+// Non-temporal stores are weakly ordered: each job completes its stores with
+// a store fence, and the "parallel for" function, by joining the jobs,
+// publishes the results to the calling thread.
+
+namespace BloombergLP {
+
+namespace {
+
+typedef bslalg::BulkMemoryUtil   Util;
+typedef bslalg::BulkMemoryPolicy Policy;
+
+std::size_t roundUp(std::size_t value, std::size_t granularity)
+    // Return the smallest multiple of the specified 'granularity' that is not
+    // less than the specified 'value'.
+{
+    return (value + granularity - 1) / granularity * granularity;
+}
+
+void doublingFill(char        *begin,
+                  std::size_t  numBytesInitialized,
+                  std::size_t  numBytes)
+    // Fill the specified 'numBytes' at the specified 'begin' address by
+    // repeating the specified 'numBytesInitialized' at its start, copying the
+    // initialized prefix onto itself, doubling its size at every iteration.
+{
+    char *end = begin + numBytesInitialized;
+    numBytes -= numBytesInitialized;            // bytes remaining to be copied
+
+    while (numBytesInitialized <= numBytes) {
+        std::memcpy(end, begin, numBytesInitialized);
+        end += numBytesInitialized;
+        numBytes -= numBytesInitialized;
+        numBytesInitialized *= 2;
+    }
+    if (0 < numBytes) {
+        std::memcpy(end, begin, numBytes);   // finish copying end of the range
+    }
+}
+
+#ifdef BSLALG_BULKMEMORYUTIL_X86_STREAMING
+
+                        // -----------------------
+                        // non-temporal (SSE2) I/O
+                        // -----------------------
+
+bool isStreamingSupported()
+    // Return 'true' if the executing processor supports the non-temporal
+    // stores used by this component, and 'false' otherwise.
+{
+    return __builtin_cpu_supports("sse2");
+}
+
+std::size_t alignmentPrefix(const char *destination, std::size_t size)
+    // Return the number of bytes, not exceeding the specified 'size', that
+    // precede the first 16-byte aligned address at or after the specified
+    // 'destination'.
+{
+    const std::size_t offset = static_cast<std::size_t>(
+                           reinterpret_cast<bsls::Types::UintPtr>(destination)
+                                                                        % 16);
+    const std::size_t prefix = offset ? 16 - offset : 0;
+    return prefix < size ? prefix : size;
+}
+
+__attribute__((target("sse2")))
+void streamCopy(char *destination, const char *source, std::size_t size)
+    // Copy the specified 'size' bytes from the specified 'source' to the
+    // specified 'destination', writing the aligned 16-byte blocks of
+    // 'destination' with non-temporal stores.
+{
+    const std::size_t prefix = alignmentPrefix(destination, size);
+    std::memcpy(destination, source, prefix);
+    destination += prefix;
+    source      += prefix;
+    size        -= prefix;
+
+    __m128i       *to   = reinterpret_cast<__m128i *>(destination);
+    const __m128i *from = reinterpret_cast<const __m128i *>(source);
+
+    for (; 64 <= size; size -= 64, to += 4, from += 4) {
+        const __m128i a = _mm_loadu_si128(from);
+        const __m128i b = _mm_loadu_si128(from + 1);
+        const __m128i c = _mm_loadu_si128(from + 2);
+        const __m128i d = _mm_loadu_si128(from + 3);
+        _mm_stream_si128(to,     a);
+        _mm_stream_si128(to + 1, b);
+        _mm_stream_si128(to + 2, c);
+        _mm_stream_si128(to + 3, d);
+    }
+    for (; 16 <= size; size -= 16, ++to, ++from) {
+        _mm_stream_si128(to, _mm_loadu_si128(from));
+    }
+    _mm_sfence();
+
+    std::memcpy(to, from, size);
+}
+
+__attribute__((target("sse2")))
+void streamFill(char *destination, int byte, std::size_t size)
+    // Set each of the specified 'size' bytes at the specified 'destination'
+    // to the specified 'byte', writing the aligned 16-byte blocks of
+    // 'destination' with non-temporal stores.
+{
+    const std::size_t prefix = alignmentPrefix(destination, size);
+    std::memset(destination, byte, prefix);
+    destination += prefix;
+    size        -= prefix;
+
+    const __m128i  value = _mm_set1_epi8(static_cast<char>(byte));
+    __m128i       *to    = reinterpret_cast<__m128i *>(destination);
+
+    for (; 64 <= size; size -= 64, to += 4) {
+        _mm_stream_si128(to,     value);
+        _mm_stream_si128(to + 1, value);
+        _mm_stream_si128(to + 2, value);
+        _mm_stream_si128(to + 3, value);
+    }
+    for (; 16 <= size; size -= 16, ++to) {
+        _mm_stream_si128(to, value);
+    }
+    _mm_sfence();
+
+    std::memset(to, byte, size);
+}
+
+#else
+
+bool isStreamingSupported()
+    // Return 'false', as non-temporal stores are not supported on this
+    // platform.
+{
+    return false;
+}
+
+#endif  // BSLALG_BULKMEMORYUTIL_X86_STREAMING
+
+void copyChunk(char        *destination,
+               const char  *source,
+               std::size_t  size,
+               bool         isStreaming)
+    // Copy the specified 'size' bytes from the specified 'source' to the
+    // specified 'destination', using non-temporal stores if the specified
+    // 'isStreaming' is 'true'.
+{
+#ifdef BSLALG_BULKMEMORYUTIL_X86_STREAMING
+    if (isStreaming) {
+        streamCopy(destination, source, size);
+        return;                                                       // RETURN
+    }
+#else
+    (void)isStreaming;
+#endif
+    std::memcpy(destination, source, size);
+}
+
+void fillChunk(char *destination, int byte, std::size_t size, bool isStreaming)
+    // Set each of the specified 'size' bytes at the specified 'destination'
+    // to the specified 'byte', using non-temporal stores if the specified
+    // 'isStreaming' is 'true'.
+{
+#ifdef BSLALG_BULKMEMORYUTIL_X86_STREAMING
+    if (isStreaming) {
+        streamFill(destination, byte, size);
+        return;                                                       // RETURN
+    }
+#else
+    (void)isStreaming;
+#endif
+    std::memset(destination, byte, size);
+}
+
+                        // -------------------
+                        // class BulkOperation
+                        // -------------------
+
+struct BulkOperation {
+    // This 'struct' describes a bulk copy, fill, or replication of a range
+    // of memory, and the size of the chunks processed by each job.
+
+    // TYPES
+    enum Kind {
+        e_COPY,       // copy from 'd_source_p'
+        e_FILL,       // set to 'd_byte'
+        e_REPLICATE   // repeat the 'd_blockSize' bytes at 'd_source_p'
+    };
+
+    // DATA
+    Kind         d_kind;           // kind of operation
+    char        *d_destination_p;  // start of the destination range
+    const char  *d_source_p;       // source range or repeated block
+    int          d_byte;           // fill value
+    std::size_t  d_size;           // number of bytes to write
+    std::size_t  d_blockSize;      // size of the repeated block
+    std::size_t  d_chunkSize;      // number of bytes written by each job
+    bool         d_isStreaming;    // use non-temporal stores
+};
+
+void runJob(void *context, std::size_t jobIndex)
+    // Process the chunk having the specified 'jobIndex' of the
+    // 'BulkOperation' at the specified 'context' address.
+{
+    const BulkOperation& op = *static_cast<const BulkOperation *>(context);
+
+    const std::size_t begin = jobIndex * op.d_chunkSize;
+    BSLS_ASSERT(begin < op.d_size);
+
+    const std::size_t end = op.d_size - begin > op.d_chunkSize
+                          ? begin + op.d_chunkSize
+                          : op.d_size;
+
+    switch (op.d_kind) {
+      case BulkOperation::e_COPY: {
+        copyChunk(op.d_destination_p + begin,
+                  op.d_source_p + begin,
+                  end - begin,
+                  op.d_isStreaming);
+      } break;
+      case BulkOperation::e_FILL: {
+        fillChunk(op.d_destination_p + begin,
+                  op.d_byte,
+                  end - begin,
+                  op.d_isStreaming);
+      } break;
+      case BulkOperation::e_REPLICATE: {
+        // 'begin' is a multiple of 'd_blockSize', so each copy of the block
+        // is in phase with the pattern.
+
+        for (std::size_t offset = begin; offset < end;
+                                                   offset += op.d_blockSize) {
+            const std::size_t size = end - offset < op.d_blockSize
+                                   ? end - offset
+                                   : op.d_blockSize;
+            copyChunk(op.d_destination_p + offset,
+                      op.d_source_p,
+                      size,
+                      op.d_isStreaming);
+        }
+      } break;
+    }
+}
+
+void execute(BulkOperation *op, std::size_t granularity, const Policy& policy)
+    // Perform the specified 'op' according to the specified 'policy',
+    // dividing it into chunks that are each a multiple of the specified
+    // 'granularity' in size.
+{
+    op->d_isStreaming = policy.streamingThreshold() <= op->d_size
+                     && isStreamingSupported();
+
+    const Policy::ParallelForFunction parallelFor = policy.parallelFor();
+    const int                         maxNumJobs  = policy.maxNumJobs();
+
+    std::size_t numJobs = 1;
+
+    op->d_chunkSize = op->d_size;
+
+    if (parallelFor
+     && 1 < maxNumJobs
+     && policy.parallelThreshold() <= op->d_size) {
+        const std::size_t minChunkSize = roundUp(Util::k_MIN_CHUNK_SIZE,
+                                                 granularity);
+        std::size_t chunkSize = roundUp((op->d_size + maxNumJobs - 1)
+                                                                  / maxNumJobs,
+                                        granularity);
+        if (chunkSize < minChunkSize) {
+            chunkSize = minChunkSize;
+        }
+        op->d_chunkSize = chunkSize;
+        numJobs = (op->d_size + chunkSize - 1) / chunkSize;
+    }
+
+    if (1 < numJobs) {
+        parallelFor(&runJob, op, numJobs);
+    }
+    else {
+        runJob(op, 0);
+    }
+}
+
+}  // close unnamed namespace
+
+namespace bslalg {
+
+                          // ----------------------
+                          // class BulkMemoryPolicy
+                          // ----------------------
+
+// MANIPULATORS
+void BulkMemoryPolicy::setParallelFor(ParallelForFunction parallelFor,
+                                      int                 maxNumJobs,
+                                      std::size_t         numBytes)
+{
+    BSLS_ASSERT(0 < maxNumJobs);
+
+    d_parallelFor_p     = parallelFor;
+    d_maxNumJobs        = maxNumJobs;
+    d_parallelThreshold = numBytes;
+}
+
+                          // ---------------------
+                          // struct BulkMemoryUtil
+                          // ---------------------
+
+// PRIVATE CLASS METHODS
+void BulkMemoryUtil::copyBulk(void                    *destination,
+                              const void              *source,
+                              std::size_t              numBytes,
+                              const BulkMemoryPolicy&  policy)
+{
+    BSLS_ASSERT_SAFE(destination);
+    BSLS_ASSERT_SAFE(source);
+
+    BulkOperation op;
+    op.d_kind          = BulkOperation::e_COPY;
+    op.d_destination_p = static_cast<char *>(destination);
+    op.d_source_p      = static_cast<const char *>(source);
+    op.d_byte          = 0;
+    op.d_size          = numBytes;
+    op.d_blockSize     = 0;
+
+    execute(&op, k_MIN_CHUNK_SIZE, policy);
+}
+
+void BulkMemoryUtil::fillBulk(void                    *destination,
+                              int                      byte,
+                              std::size_t              numBytes,
+                              const BulkMemoryPolicy&  policy)
+{
+    BSLS_ASSERT_SAFE(destination);
+
+    BulkOperation op;
+    op.d_kind          = BulkOperation::e_FILL;
+    op.d_destination_p = static_cast<char *>(destination);
+    op.d_source_p      = 0;
+    op.d_byte          = byte;
+    op.d_size          = numBytes;
+    op.d_blockSize     = 0;
+
+    execute(&op, k_MIN_CHUNK_SIZE, policy);
+}
+
+// CLASS METHODS
+void BulkMemoryUtil::replicate(void                    *destination,
+                               std::size_t              patternSize,
+                               std::size_t              size,
+                               const BulkMemoryPolicy&  policy)
+{
+    BSLS_ASSERT_SAFE(destination);
+    BSLS_ASSERT(0 < patternSize);
+    BSLS_ASSERT(patternSize <= size);
+
+    char *begin = static_cast<char *>(destination);
+
+    if (!policy.isBulk(size)) {
+        doublingFill(begin, patternSize, size);
+        return;                                                       // RETURN
+    }
+
+    // Fill a block of at least 'k_MIN_CHUNK_SIZE' bytes, holding a whole
+    // number of copies of the pattern, in the cache, then repeat that block.
+
+    std::size_t blockSize = roundUp(k_MIN_CHUNK_SIZE, patternSize);
+    if (size < blockSize) {
+        blockSize = size;
+    }
+    doublingFill(begin, patternSize, blockSize);
+
+    if (blockSize == size) {
+        return;                                                       // RETURN
+    }
+
+    BulkOperation op;
+    op.d_kind          = BulkOperation::e_REPLICATE;
+    op.d_destination_p = begin + blockSize;
+    op.d_source_p      = begin;
+    op.d_byte          = 0;
+    op.d_size          = size - blockSize;
+    op.d_blockSize     = blockSize;
+
+    execute(&op, blockSize, policy);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
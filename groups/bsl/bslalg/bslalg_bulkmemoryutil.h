@@ -0,0 +1,511 @@
+// bslalg_bulkmemoryutil.h                                            -*-C++-*-
+#ifndef INCLUDED_BSLALG_BULKMEMORYUTIL
+#define INCLUDED_BSLALG_BULKMEMORYUTIL
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide bulk copy and fill of raw memory for very large ranges.
+//
+//@CLASSES:
+//  bslalg::BulkMemoryPolicy: how very large ranges are copied and filled
+//  bslalg::BulkMemoryUtil: namespace for large, possibly parallel, copy/fill
+//  bslalg::UsesBulkMemoryPolicy: trait opting a type into a bulk policy
+//
+//@SEE_ALSO: bslalg_arrayprimitives, bslstl_vector
+//
+//@DESCRIPTION: This component provides a utility 'struct',
+// 'bslalg::BulkMemoryUtil', supplying functions that copy ('copy'), fill
+// with a byte value ('fill'), and fill with a repeated pattern of bytes
+// ('replicate') a range of raw memory according to a *policy*, described by
+// an object of the class 'bslalg::BulkMemoryPolicy' that is supplied to each
+// call.  Ranges smaller than the thresholds of the policy are handled exactly
+// as by 'std::memcpy' and 'std::memset'.  Ranges of at least that size are
+// handled according to the policy, which may:
+//
+//: o write the destination using non-temporal ("streaming") stores, which
+//:   bypass the cache, so that filling or copying a range much larger than the
+//:   cache does not evict the working set of the program (and does not read
+//:   each destination cache line before overwriting it), and
+//:
+//: o divide the range into contiguous chunks, processed concurrently by a
+//:   user-supplied "parallel for" function (e.g., one dispatching to a small
+//:   pool of worker threads).
+//
+// This component also provides a trait, 'bslalg::UsesBulkMemoryPolicy', by
+// which a bit-wise copyable type opts into a policy for the containers that
+// hold it.  'bsl::vector' checks this trait at compile time, and uses the
+// policy of its element type to copy and fill large ranges in 'assign',
+// 'resize', 'reserve', and copy construction.  Containers of types that do
+// not opt in, and 'bslalg::ArrayPrimitives', always use 'std::memcpy' and
+// 'std::memset' directly.
+//
+///Policy
+///------
+// A default-constructed 'BulkMemoryPolicy' copies and fills all ranges with
+// 'std::memcpy' and 'std::memset'.  Bulk handling is enabled by the following
+// manipulators:
+//
+//: 'setStreamingThreshold': Ranges of at least the specified number of bytes
+//:   are written with non-temporal stores.  A value somewhat larger than the
+//:   last-level cache of the executing processor is recommended, as streaming
+//:   stores are slower than cached stores when the destination is read soon
+//:   afterwards.  Non-temporal stores are supported on x86 platforms compiled
+//:   by GCC or clang; elsewhere, this threshold has no effect.
+//:
+//: 'setParallelFor': Ranges of at least the specified number of bytes are
+//:   divided into (at most) the specified number of chunks, each at least a
+//:   page in size, that are passed to the specified "parallel for" function.
+//
+// A policy is an ordinary object: it is not shared unless the program shares
+// it, and a policy used by several threads must not be modified while any of
+// them is copying or filling memory with it.
+//
+///"Parallel For" Functions
+///------------------------
+// A "parallel for" function, of type 'BulkMemoryPolicy::ParallelForFunction',
+// takes a job function, an opaque context pointer, and a number of jobs, 'n',
+// and must invoke the job function once for each job index in the range
+// '[0 .. n - 1]', passing the context pointer and the index, possibly
+// concurrently, returning only after all invocations have returned.  The
+// calling thread may execute any number of the jobs itself.  The job function
+// does not throw and does not allocate memory.  This component does not
+// create threads; the "parallel for" function is the point at which a thread
+// pool, provided by a higher-level library, is integrated.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Speeding Up Copies of Large Vectors of Ticks
+///- - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we keep a history of market ticks, a bit-wise copyable 'struct', in
+// vectors of several hundred megabytes that we copy and fill in bulk.
+//
+// First, we define a "parallel for" function that runs each job on a thread
+// of its own.  (A production program would dispatch the jobs to a pool of
+// existing threads instead.)  'createThread' and 'joinThread' are assumed to
+// wrap the thread creation facilities of the platform:
+//..
+//  struct JobInfo {
+//      bslalg::BulkMemoryPolicy::Job  d_job;
+//      void                          *d_context;
+//      std::size_t                    d_index;
+//  };
+//
+//  extern "C" void *runJob(void *arg)
+//  {
+//      JobInfo *info = static_cast<JobInfo *>(arg);
+//      info->d_job(info->d_context, info->d_index);
+//      return 0;
+//  }
+//
+//  void threadedParallelFor(bslalg::BulkMemoryPolicy::Job  job,
+//                           void                          *context,
+//                           std::size_t                    numJobs)
+//  {
+//      enum { k_MAX_JOBS = 8 };
+//      assert(numJobs <= k_MAX_JOBS);
+//
+//      JobInfo  info[k_MAX_JOBS];
+//      ThreadId ids[k_MAX_JOBS];
+//
+//      for (std::size_t i = 1; i < numJobs; ++i) {
+//          JobInfo jobInfo = { job, context, i };
+//          info[i] = jobInfo;
+//          ids[i]  = createThread(&runJob, &info[i]);
+//      }
+//      job(context, 0);
+//      for (std::size_t i = 1; i < numJobs; ++i) {
+//          joinThread(ids[i]);
+//      }
+//  }
+//..
+// Then, we define the 'Tick' type, and a policy for copying and filling
+// arrays of ticks, that we will configure before any thread is started:
+//..
+//  struct Tick {
+//      double d_price;
+//      int    d_volume;
+//      int    d_flags;
+//  };
+//
+//  bslalg::BulkMemoryPolicy tickPolicy;
+//..
+// Next, we opt 'Tick' into this policy, so that a 'bsl::vector<Tick>' (or any
+// other container checking the trait) copies and fills large ranges of ticks
+// according to it.  Note that 'bsl::vector' also requires 'Tick' to have the
+// 'bsl::is_trivially_copyable' trait:
+//..
+//  namespace BloombergLP {
+//  namespace bslalg {
+//
+//  template <>
+//  struct UsesBulkMemoryPolicy<Tick> : bsl::true_type {
+//      static const BulkMemoryPolicy& policy()
+//      {
+//          return tickPolicy;
+//      }
+//  };
+//
+//  }  // close package namespace
+//  }  // close enterprise namespace
+//..
+// Now, early in 'main', we configure the policy to stream ranges of 16
+// megabytes or more, and to split ranges of 64 megabytes or more across 4
+// jobs:
+//..
+//  tickPolicy.setStreamingThreshold(16 * 1024 * 1024);
+//  tickPolicy.setParallelFor(&threadedParallelFor, 4, 64 * 1024 * 1024);
+//..
+// Finally, we copy a large array of ticks directly, using the policy selected
+// by the trait:
+//..
+//  const std::size_t k_NUM_TICKS = 4 * 1024 * 1024;
+//  const std::size_t k_SIZE      = k_NUM_TICKS * sizeof(Tick);  // 64 MB
+//
+//  Tick *source      = static_cast<Tick *>(std::malloc(k_SIZE));
+//  Tick *destination = static_cast<Tick *>(std::malloc(k_SIZE));
+//
+//  const bslalg::BulkMemoryPolicy& policy =
+//                          bslalg::UsesBulkMemoryPolicy<Tick>::policy();
+//  assert(policy.isBulk(k_SIZE));
+//
+//  bslalg::BulkMemoryUtil::fill(source, 0, k_SIZE, policy);
+//  source[k_NUM_TICKS - 1].d_volume = 100;
+//
+//  bslalg::BulkMemoryUtil::copy(destination, source, k_SIZE, policy);
+//
+//  assert(  0 == destination[0].d_volume);
+//  assert(100 == destination[k_NUM_TICKS - 1].d_volume);
+//
+//  std::free(destination);
+//  std::free(source);
+//..
+// Copying a 'bsl::vector<Tick>' of that size is likewise performed by 4 jobs
+// using non-temporal stores, whereas copying a 'bsl::vector<double>' of the
+// same size is performed by a single call to 'std::memcpy'.
+
+#ifndef INCLUDED_BSLSCM_VERSION
+#include <bslscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_INTEGRALCONSTANT
+#include <bslmf_integralconstant.h>
+#endif
+
+#ifndef INCLUDED_CSTDDEF
+#include <cstddef>
+#define INCLUDED_CSTDDEF
+#endif
+
+#ifndef INCLUDED_CSTRING
+#include <cstring>
+#define INCLUDED_CSTRING
+#endif
+
+namespace BloombergLP {
+
+namespace bslalg {
+
+                          // ======================
+                          // class BulkMemoryPolicy
+                          // ======================
+
+class BulkMemoryPolicy {
+    // This attribute class describes how 'BulkMemoryUtil' copies and fills
+    // ranges of raw memory: ranges of at least a streaming threshold are
+    // written using non-temporal stores, and ranges of at least a parallel
+    // threshold are divided among concurrent jobs run by a "parallel for"
+    // function.  A default-constructed policy handles all ranges with
+    // 'std::memcpy' and 'std::memset'.
+
+  public:
+    // TYPES
+    typedef void (*Job)(void *context, std::size_t jobIndex);
+        // 'Job' is an alias for a function processing the job having the
+        // specified 'jobIndex' of a bulk operation described by the specified
+        // 'context'.
+
+    typedef void (*ParallelForFunction)(Job          job,
+                                        void        *context,
+                                        std::size_t  numJobs);
+        // 'ParallelForFunction' is an alias for a function that invokes the
+        // specified 'job', passing the specified 'context' and each job index
+        // in the range '[0 .. numJobs - 1]', possibly concurrently, and
+        // returns after all invocations have returned.
+
+  private:
+    // DATA
+    std::size_t         d_streamingThreshold;  // minimum size of a range
+                                               // written with non-temporal
+                                               // stores
+
+    std::size_t         d_parallelThreshold;   // minimum size of a range
+                                               // divided into concurrent jobs
+
+    ParallelForFunction d_parallelFor_p;       // "parallel for" function, or
+                                               // 0
+
+    int                 d_maxNumJobs;          // maximum number of concurrent
+                                               // jobs
+
+  public:
+    // CREATORS
+    BulkMemoryPolicy();
+        // Create a policy handling all ranges with 'std::memcpy' and
+        // 'std::memset'.
+
+    //! BulkMemoryPolicy(const BulkMemoryPolicy& original) = default;
+        // Create a policy having the same attributes as the specified
+        // 'original' policy.
+
+    //! ~BulkMemoryPolicy() = default;
+        // Destroy this object.
+
+    // MANIPULATORS
+    //! BulkMemoryPolicy& operator=(const BulkMemoryPolicy& rhs) = default;
+        // Assign to this policy the attributes of the specified 'rhs' policy,
+        // and return a reference providing modifiable access to this object.
+
+    void setStreamingThreshold(std::size_t numBytes);
+        // Write ranges of at least the specified 'numBytes' using
+        // non-temporal stores, where supported.
+
+    void setParallelFor(ParallelForFunction parallelFor,
+                        int                 maxNumJobs,
+                        std::size_t         numBytes);
+        // Divide ranges of at least the specified 'numBytes' into at most the
+        // specified 'maxNumJobs' jobs of at least
+        // 'BulkMemoryUtil::k_MIN_CHUNK_SIZE' bytes each, and pass them to the
+        // specified 'parallelFor' function.  If 'parallelFor' is 0, ranges
+        // are not divided.  The behavior is undefined unless '0 < maxNumJobs'.
+
+    // ACCESSORS
+    std::size_t streamingThreshold() const;
+        // Return the minimum size of a range written using non-temporal
+        // stores.  Note that the value returned is the maximum value of
+        // 'std::size_t' if streaming stores are not enabled.
+
+    std::size_t parallelThreshold() const;
+        // Return the minimum size of a range divided into concurrent jobs.
+        // Note that the value returned is the maximum value of 'std::size_t'
+        // if there is no "parallel for" function.
+
+    ParallelForFunction parallelFor() const;
+        // Return the "parallel for" function of this policy, or 0 if there is
+        // none.
+
+    int maxNumJobs() const;
+        // Return the maximum number of jobs into which a range is divided.
+
+    bool isBulk(std::size_t numBytes) const;
+        // Return 'true' if a range of the specified 'numBytes' is handled
+        // according to this policy (i.e., is not simply passed to
+        // 'std::memcpy' or 'std::memset'), and 'false' otherwise.
+};
+
+                          // =====================
+                          // struct BulkMemoryUtil
+                          // =====================
+
+struct BulkMemoryUtil {
+    // This 'struct' provides a namespace for functions that copy and fill
+    // ranges of raw memory, handling very large ranges according to a
+    // supplied policy that may use non-temporal stores and divide the work
+    // among concurrent jobs.
+
+    // TYPES
+    enum {
+        k_MIN_CHUNK_SIZE = 4096  // minimum number of bytes processed by a job
+    };
+
+  private:
+    // PRIVATE CLASS METHODS
+    static void copyBulk(void                    *destination,
+                         const void              *source,
+                         std::size_t              numBytes,
+                         const BulkMemoryPolicy&  policy);
+        // Copy the specified 'numBytes' from the specified 'source' to the
+        // specified 'destination' according to the specified 'policy'.  The
+        // behavior is undefined unless the two ranges do not overlap.
+
+    static void fillBulk(void                    *destination,
+                         int                      byte,
+                         std::size_t              numBytes,
+                         const BulkMemoryPolicy&  policy);
+        // Set each of the specified 'numBytes' at the specified 'destination'
+        // to the specified 'byte' (converted to 'unsigned char') according to
+        // the specified 'policy'.
+
+  public:
+    // CLASS METHODS
+    static void copy(void                    *destination,
+                     const void              *source,
+                     std::size_t              size,
+                     const BulkMemoryPolicy&  policy);
+        // Copy the specified 'size' bytes from the specified 'source' to the
+        // specified 'destination', as if by 'std::memcpy', according to the
+        // specified 'policy'.  The behavior is undefined unless the two
+        // ranges do not overlap.
+
+    static void fill(void                    *destination,
+                     int                      byte,
+                     std::size_t              size,
+                     const BulkMemoryPolicy&  policy);
+        // Set each of the specified 'size' bytes at the specified
+        // 'destination' to the specified 'byte' (converted to 'unsigned
+        // char'), as if by 'std::memset', according to the specified
+        // 'policy'.
+
+    static void replicate(void                    *destination,
+                          std::size_t              patternSize,
+                          std::size_t              size,
+                          const BulkMemoryPolicy&  policy);
+        // Fill the specified 'size' bytes at the specified 'destination' by
+        // repeating the specified 'patternSize' bytes at the start of
+        // 'destination', as if by copying them to every offset that is a
+        // multiple of 'patternSize' (the last copy being truncated if 'size'
+        // is not a multiple of 'patternSize'), according to the specified
+        // 'policy'.  The behavior is undefined unless '0 < patternSize' and
+        // 'patternSize <= size'.
+};
+
+                        // ===========================
+                        // struct UsesBulkMemoryPolicy
+                        // ===========================
+
+template <class TYPE>
+struct UsesBulkMemoryPolicy : bsl::false_type {
+    // This 'struct' template implements a meta-function to determine whether
+    // containers of the (template parameter) 'TYPE' copy and fill large
+    // arrays of 'TYPE' objects according to a 'BulkMemoryPolicy'.  This
+    // primary template derives from 'bsl::false_type'.  A bit-wise copyable
+    // type opts in by specializing this template to derive from
+    // 'bsl::true_type' and to provide a class method:
+    //..
+    //  static const BulkMemoryPolicy& policy();
+    //..
+    // returning the policy to be applied to arrays of 'TYPE'.  Note that the
+    // policy is read on each copy or fill of an array, and so must not be
+    // modified while containers of 'TYPE' are in use by other threads.
+};
+
+// ============================================================================
+//                          INLINE DEFINITIONS
+// ============================================================================
+
+                          // ----------------------
+                          // class BulkMemoryPolicy
+                          // ----------------------
+
+// CREATORS
+inline
+BulkMemoryPolicy::BulkMemoryPolicy()
+: d_streamingThreshold(~std::size_t())
+, d_parallelThreshold(~std::size_t())
+, d_parallelFor_p(0)
+, d_maxNumJobs(1)
+{
+}
+
+// MANIPULATORS
+inline
+void BulkMemoryPolicy::setStreamingThreshold(std::size_t numBytes)
+{
+    d_streamingThreshold = numBytes;
+}
+
+// ACCESSORS
+inline
+std::size_t BulkMemoryPolicy::streamingThreshold() const
+{
+    return d_streamingThreshold;
+}
+
+inline
+std::size_t BulkMemoryPolicy::parallelThreshold() const
+{
+    return d_parallelFor_p ? d_parallelThreshold : ~std::size_t();
+}
+
+inline
+BulkMemoryPolicy::ParallelForFunction BulkMemoryPolicy::parallelFor() const
+{
+    return d_parallelFor_p;
+}
+
+inline
+int BulkMemoryPolicy::maxNumJobs() const
+{
+    return d_maxNumJobs;
+}
+
+inline
+bool BulkMemoryPolicy::isBulk(std::size_t numBytes) const
+{
+    return d_streamingThreshold <= numBytes
+        || (d_parallelFor_p && d_parallelThreshold <= numBytes);
+}
+
+                          // ---------------------
+                          // struct BulkMemoryUtil
+                          // ---------------------
+
+// CLASS METHODS
+inline
+void BulkMemoryUtil::copy(void                    *destination,
+                          const void              *source,
+                          std::size_t              size,
+                          const BulkMemoryPolicy&  policy)
+{
+    if (policy.isBulk(size)) {
+        copyBulk(destination, source, size, policy);
+    }
+    else {
+        std::memcpy(destination, source, size);
+    }
+}
+
+inline
+void BulkMemoryUtil::fill(void                    *destination,
+                          int                      byte,
+                          std::size_t              size,
+                          const BulkMemoryPolicy&  policy)
+{
+    if (policy.isBulk(size)) {
+        fillBulk(destination, byte, size, policy);
+    }
+    else {
+        std::memset(destination, byte, size);
+    }
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1087 @@
+// bslalg_bulkmemoryutil.t.cpp                                        -*-C++-*-
+#include <bslalg_bulkmemoryutil.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_atomic.h>
+#include <bsls_bsltestutil.h>
+#include <bsls_platform.h>
+#include <bsls_stopwatch.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+#include <windows.h>
+#else
+#include <pthread.h>
+#endif
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                             TEST PLAN
+//-----------------------------------------------------------------------------
+//                             Overview
+//                             --------
+// The component under test is an attribute class describing a policy, and a
+// utility whose functions must produce exactly the results of 'memcpy',
+// 'memset', and a repeated copy of a pattern, whatever the policy supplied,
+// the size of the range, and the alignment of the destination.  We verify the
+// policy manipulators and accessors first, then compare the output of each
+// function with a reference computed byte by byte, for a variety of sizes,
+// offsets, and policies, using a "parallel for" function that records the
+// jobs it is asked to run and one that runs them on separate threads.
+//-----------------------------------------------------------------------------
+// class BulkMemoryPolicy
+//
+// CREATORS
+// [ 2] BulkMemoryPolicy();
+// [ 2] BulkMemoryPolicy(const BulkMemoryPolicy& original);
+//
+// MANIPULATORS
+// [ 2] BulkMemoryPolicy& operator=(const BulkMemoryPolicy& rhs);
+// [ 2] void setStreamingThreshold(size_t numBytes);
+// [ 2] void setParallelFor(ParallelForFunction, int, size_t);
+//
+// ACCESSORS
+// [ 2] size_t streamingThreshold() const;
+// [ 2] size_t parallelThreshold() const;
+// [ 2] ParallelForFunction parallelFor() const;
+// [ 2] int maxNumJobs() const;
+// [ 2] bool isBulk(size_t numBytes) const;
+//
+// struct BulkMemoryUtil
+//
+// CLASS METHODS
+// [ 3] void copy(void *, const void *, size_t, const BulkMemoryPolicy&);
+// [ 3] void fill(void *, int, size_t, const BulkMemoryPolicy&);
+// [ 4] void replicate(void *, size_t, size_t, const BulkMemoryPolicy&);
+//
+// struct UsesBulkMemoryPolicy
+// [ 2] UsesBulkMemoryPolicy<TYPE>::value
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 5] USAGE EXAMPLE
+// [-1] PERFORMANCE TEST
+
+// ============================================================================
+//                      STANDARD BDE ASSERT TEST MACROS
+// ----------------------------------------------------------------------------
+// NOTE: THIS IS A LOW-LEVEL COMPONENT AND MAY NOT USE ANY C++ LIBRARY
+// FUNCTIONS, INCLUDING IOSTREAMS.
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool b, const char *s, int i)
+{
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+//=============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef bslalg::BulkMemoryUtil   Util;
+typedef bslalg::BulkMemoryPolicy Policy;
+
+const size_t k_MAX_SIZE = ~size_t();
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+typedef HANDLE    ThreadId;
+#else
+typedef pthread_t ThreadId;
+#endif
+
+typedef void *(*ThreadFunction)(void *arg);
+
+//=============================================================================
+//                  HELPER CLASSES AND FUNCTIONS FOR TESTING
+//-----------------------------------------------------------------------------
+
+static
+ThreadId createThread(ThreadFunction func, void *arg)
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    return CreateThread(0, 0, (LPTHREAD_START_ROUTINE)func, arg, 0, 0);
+#else
+    ThreadId id;
+    pthread_create(&id, 0, func, arg);
+    return id;
+#endif
+}
+
+static
+void joinThread(ThreadId id)
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    WaitForSingleObject(id, INFINITE);
+    CloseHandle(id);
+#else
+    pthread_join(id, 0);
+#endif
+}
+
+namespace {
+
+                        // =====================
+                        // recording parallelFor
+                        // =====================
+
+int    numParallelForCalls = 0;   // number of calls to 'recordingParallelFor'
+size_t lastNumJobs         = 0;   // 'numJobs' passed by the last call
+
+void recordingParallelFor(Policy::Job job, void *context, size_t numJobs)
+    // Record the specified 'numJobs', then invoke the specified 'job' with
+    // the specified 'context' for each job index, in reverse order, on the
+    // calling thread.
+{
+    ++numParallelForCalls;
+    lastNumJobs = numJobs;
+
+    for (size_t i = numJobs; 0 < i; --i) {
+        job(context, i - 1);
+    }
+}
+
+                        // ====================
+                        // threaded parallelFor
+                        // ====================
+
+enum { k_MAX_JOBS = 8 };
+
+struct ThreadJobInfo {
+    // This 'struct' describes a job to be run on a thread of its own.
+
+    Policy::Job  d_job;      // job function
+    void      *d_context;  // context passed to 'd_job'
+    size_t     d_index;    // job index passed to 'd_job'
+};
+
+bsls::AtomicInt numThreadedJobs(0);  // number of jobs run by 'runThreadJob'
+
+extern "C" void *runThreadJob(void *arg)
+    // Run the job described by the 'ThreadJobInfo' object at the specified
+    // 'arg' address.
+{
+    ThreadJobInfo *info = static_cast<ThreadJobInfo *>(arg);
+    info->d_job(info->d_context, info->d_index);
+    ++numThreadedJobs;
+    return 0;
+}
+
+void testParallelFor(Policy::Job job, void *context, size_t numJobs)
+    // Invoke the specified 'job' with the specified 'context' for each job
+    // index in '[0 .. numJobs - 1]', running each job but the first on a
+    // thread of its own.
+{
+    ASSERT(numJobs <= k_MAX_JOBS);
+
+    ThreadJobInfo info[k_MAX_JOBS];
+    ThreadId      ids[k_MAX_JOBS];
+
+    for (size_t i = 1; i < numJobs; ++i) {
+        ThreadJobInfo jobInfo = { job, context, i };
+        info[i] = jobInfo;
+        ids[i]  = createThread(&runThreadJob, &info[i]);
+    }
+    job(context, 0);
+    for (size_t i = 1; i < numJobs; ++i) {
+        joinThread(ids[i]);
+    }
+}
+
+                        // =======
+                        // helpers
+                        // =======
+
+void fillRandom(char *buffer, size_t size, unsigned seed)
+    // Load into the specified 'buffer' the specified 'size' pseudo-random
+    // bytes generated from the specified 'seed'.
+{
+    for (size_t i = 0; i < size; ++i) {
+        seed = seed * 1103515245 + 12345;
+        buffer[i] = static_cast<char>(seed >> 16);
+    }
+}
+
+bool isRepeated(const char *buffer, size_t patternSize, size_t size)
+    // Return 'true' if each of the specified 'size' bytes at the specified
+    // 'buffer' equals the byte 'patternSize' bytes before it, for the
+    // specified 'patternSize', and 'false' otherwise.
+{
+    for (size_t i = patternSize; i < size; ++i) {
+        if (buffer[i] != buffer[i - patternSize]) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+bool isFilled(const char *buffer, char byte, size_t size)
+    // Return 'true' if each of the specified 'size' bytes at the specified
+    // 'buffer' equals the specified 'byte', and 'false' otherwise.
+{
+    for (size_t i = 0; i < size; ++i) {
+        if (buffer[i] != byte) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+enum PolicyId {
+    // Enumerate the policies exercised by the test cases.
+
+    e_DEFAULT,             // 'memcpy' and 'memset'
+    e_STREAMING,           // non-temporal stores, single job
+    e_PARALLEL,            // cached stores, recorded jobs
+    e_STREAMING_PARALLEL,  // non-temporal stores, recorded jobs
+    e_THREADED,            // non-temporal stores, threaded jobs
+    k_NUM_POLICIES
+};
+
+Policy makePolicy(PolicyId id)
+    // Return the policy identified by the specified 'id', which, unless 'id'
+    // is 'e_DEFAULT', makes every non-empty range bulk.
+{
+    Policy policy;
+
+    switch (id) {
+      case e_DEFAULT: {
+      } break;
+      case e_STREAMING: {
+        policy.setStreamingThreshold(1);
+      } break;
+      case e_PARALLEL: {
+        policy.setParallelFor(&recordingParallelFor, 3, 1);
+      } break;
+      case e_STREAMING_PARALLEL: {
+        policy.setStreamingThreshold(1);
+        policy.setParallelFor(&recordingParallelFor, 5, 1);
+      } break;
+      case e_THREADED: {
+        policy.setStreamingThreshold(1);
+        policy.setParallelFor(&testParallelFor, 4, 1);
+      } break;
+      default: {
+        ASSERT(!"Unexpected policy");
+      } break;
+    }
+    return policy;
+}
+
+struct BulkType {
+    // This 'struct' is a bit-wise copyable type that opts into a bulk
+    // memory policy.
+
+    int d_value;  // value
+};
+
+Policy bulkTypePolicy;  // policy applied to arrays of 'BulkType'
+
+}  // close unnamed namespace
+
+namespace BloombergLP {
+namespace bslalg {
+
+template <>
+struct UsesBulkMemoryPolicy<BulkType> : bsl::true_type {
+    static const BulkMemoryPolicy& policy()
+        // Return the policy applied to arrays of 'BulkType'.
+    {
+        return bulkTypePolicy;
+    }
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+
+namespace {
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                              USAGE EXAMPLE
+//-----------------------------------------------------------------------------
+
+namespace usage {
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Speeding Up Copies of Large Vectors of Ticks
+///- - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we keep a history of market ticks, a bit-wise copyable 'struct', in
+// vectors of several hundred megabytes that we copy and fill in bulk.
+//
+// First, we define a "parallel for" function that runs each job on a thread
+// of its own.  (A production program would dispatch the jobs to a pool of
+// existing threads instead.)  'createThread' and 'joinThread' are assumed to
+// wrap the thread creation facilities of the platform:
+//..
+    struct JobInfo {
+        bslalg::BulkMemoryPolicy::Job  d_job;
+        void                          *d_context;
+        std::size_t                    d_index;
+    };
+
+    extern "C" void *runJob(void *arg)
+    {
+        JobInfo *info = static_cast<JobInfo *>(arg);
+        info->d_job(info->d_context, info->d_index);
+        return 0;
+    }
+
+    void threadedParallelFor(bslalg::BulkMemoryPolicy::Job  job,
+                             void                          *context,
+                             std::size_t                    numJobs)
+    {
+        enum { k_MAX_JOBS = 8 };
+        ASSERT(numJobs <= k_MAX_JOBS);
+
+        JobInfo  info[k_MAX_JOBS];
+        ThreadId ids[k_MAX_JOBS];
+
+        for (std::size_t i = 1; i < numJobs; ++i) {
+            JobInfo jobInfo = { job, context, i };
+            info[i] = jobInfo;
+            ids[i]  = createThread(&runJob, &info[i]);
+        }
+        job(context, 0);
+        for (std::size_t i = 1; i < numJobs; ++i) {
+            joinThread(ids[i]);
+        }
+    }
+//..
+// Then, we define the 'Tick' type, and a policy for copying and filling
+// arrays of ticks, that we will configure before any thread is started:
+//..
+    struct Tick {
+        double d_price;
+        int    d_volume;
+        int    d_flags;
+    };
+
+    bslalg::BulkMemoryPolicy tickPolicy;
+//..
+
+}  // close namespace usage
+
+// Next, we opt 'Tick' into this policy, so that a 'bsl::vector<Tick>' (or any
+// other container checking the trait) copies and fills large ranges of ticks
+// according to it.  Note that 'bsl::vector' also requires 'Tick' to have the
+// 'bsl::is_trivially_copyable' trait:
+//..
+    namespace BloombergLP {
+    namespace bslalg {
+
+    template <>
+    struct UsesBulkMemoryPolicy<usage::Tick> : bsl::true_type {
+        static const BulkMemoryPolicy& policy()
+        {
+            return usage::tickPolicy;
+        }
+    };
+
+    }  // close package namespace
+    }  // close enterprise namespace
+//..
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+    bool     veryVeryVerbose = argc > 4;
+    bool veryVeryVeryVerbose = argc > 5;
+
+    (void)veryVeryVerbose;
+    (void)veryVeryVeryVerbose;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 5: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+        using namespace usage;
+
+// Now, early in 'main', we configure the policy to stream ranges of 16
+// megabytes or more, and to split ranges of 64 megabytes or more across 4
+// jobs:
+//..
+    tickPolicy.setStreamingThreshold(16 * 1024 * 1024);
+    tickPolicy.setParallelFor(&threadedParallelFor, 4, 64 * 1024 * 1024);
+//..
+// Finally, we copy a large array of ticks directly, using the policy selected
+// by the trait:
+//..
+    const std::size_t k_NUM_TICKS = 4 * 1024 * 1024;
+    const std::size_t k_SIZE      = k_NUM_TICKS * sizeof(Tick);  // 64 MB
+
+    Tick *source      = static_cast<Tick *>(std::malloc(k_SIZE));
+    Tick *destination = static_cast<Tick *>(std::malloc(k_SIZE));
+
+    const bslalg::BulkMemoryPolicy& policy =
+                            bslalg::UsesBulkMemoryPolicy<Tick>::policy();
+    ASSERT(policy.isBulk(k_SIZE));
+
+    bslalg::BulkMemoryUtil::fill(source, 0, k_SIZE, policy);
+    source[k_NUM_TICKS - 1].d_volume = 100;
+
+    bslalg::BulkMemoryUtil::copy(destination, source, k_SIZE, policy);
+
+    ASSERT(  0 == destination[0].d_volume);
+    ASSERT(100 == destination[k_NUM_TICKS - 1].d_volume);
+
+    std::free(destination);
+    std::free(source);
+//..
+// Copying a 'bsl::vector<Tick>' of that size is likewise performed by 4 jobs
+// using non-temporal stores, whereas copying a 'bsl::vector<double>' of the
+// same size is performed by a single call to 'std::memcpy'.
+
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // 'replicate'
+        //
+        // Concerns:
+        //: 1 'replicate' repeats the pattern at the start of the range over
+        //:   the whole range, truncating the last copy, whatever the size of
+        //:   the pattern relative to the internal block size.
+        //:
+        //: 2 Bytes outside the range are not modified.
+        //:
+        //: 3 The result does not depend on the policy, or on the alignment of
+        //:   the destination.
+        //:
+        //: 4 Ranges are divided into at most the maximum number of jobs.
+        //:
+        //: 5 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For each policy, pattern size, range size, and offset from an
+        //:   aligned address, fill a guarded buffer with random bytes,
+        //:   replicate the pattern, and verify the range, the guard bytes,
+        //:   and, for the recording policies, the number of jobs.  (C-1..4)
+        //:
+        //: 2 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-5)
+        //
+        // Testing:
+        //   void replicate(void *, size_t, size_t, const BulkMemoryPolicy&);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\n'replicate'"
+                            "\n===========\n");
+
+        static const size_t PATTERN_SIZES[] = {
+            1, 2, 3, 8, 24, 100, 4095, 4096, 4097, 9000
+        };
+        const int NUM_PATTERN_SIZES =
+                               sizeof PATTERN_SIZES / sizeof *PATTERN_SIZES;
+
+        static const size_t SIZES[] = {
+            9000, 4096 * 3 + 7, 100000, 1000003
+        };
+        const int NUM_SIZES = sizeof SIZES / sizeof *SIZES;
+
+        enum { k_GUARD = 64 };
+
+        const size_t BUFFER_SIZE = 1000003 + 2 * k_GUARD + 16;
+        char *buffer   = static_cast<char *>(malloc(BUFFER_SIZE));
+        char *expected = static_cast<char *>(malloc(BUFFER_SIZE));
+
+        for (int tp = 0; tp < k_NUM_POLICIES; ++tp) {
+            const PolicyId POLICY = static_cast<PolicyId>(tp);
+            const Policy   X      = makePolicy(POLICY);
+
+            for (int ti = 0; ti < NUM_PATTERN_SIZES; ++ti) {
+                const size_t PATTERN = PATTERN_SIZES[ti];
+
+                for (int tj = 0; tj < NUM_SIZES; ++tj) {
+                    const size_t SIZE = SIZES[tj];
+
+                    for (int offset = 0; offset < 16; offset += 5) {
+                        if (veryVerbose) {
+                            P_(POLICY) P_(PATTERN) P_(SIZE) P(offset)
+                        }
+
+                        char *begin = buffer + k_GUARD + offset;
+
+                        fillRandom(buffer, BUFFER_SIZE, ti * 31 + tj);
+                        memcpy(expected, buffer, BUFFER_SIZE);
+                        char *exp = expected + k_GUARD + offset;
+                        for (size_t i = PATTERN; i < SIZE; ++i) {
+                            exp[i] = exp[i % PATTERN];
+                        }
+
+                        numParallelForCalls = 0;
+                        lastNumJobs         = 0;
+
+                        Util::replicate(begin, PATTERN, SIZE, X);
+
+                        ASSERTV(POLICY, PATTERN, SIZE, offset,
+                                isRepeated(begin, PATTERN, SIZE));
+                        ASSERTV(POLICY, PATTERN, SIZE, offset,
+                                0 == memcmp(buffer, expected, BUFFER_SIZE));
+
+                        if (e_PARALLEL           == POLICY
+                         || e_STREAMING_PARALLEL == POLICY) {
+                            const size_t MAX_JOBS = e_PARALLEL == POLICY
+                                                  ? 3
+                                                  : 5;
+                            ASSERTV(POLICY, PATTERN, SIZE,
+                                    lastNumJobs <= MAX_JOBS);
+                            ASSERTV(POLICY, PATTERN, SIZE,
+                                    numParallelForCalls <= 1);
+                        }
+                    }
+                }
+            }
+        }
+
+        free(expected);
+        free(buffer);
+
+        if (verbose) printf("\nNegative Testing.\n");
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            const Policy X;
+
+            char buf[8];
+
+            ASSERT_PASS(Util::replicate(buf, 1, 8, X));
+            ASSERT_FAIL(Util::replicate(buf, 0, 8, X));
+            ASSERT_FAIL(Util::replicate(buf, 9, 8, X));
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // 'copy' AND 'fill'
+        //
+        // Concerns:
+        //: 1 'copy' and 'fill' write exactly the bytes that 'memcpy' and
+        //:   'memset' write, whatever the policy, the size of the range
+        //:   (including sizes that are not multiples of the block size of the
+        //:   non-temporal stores), and the alignment of the destination and
+        //:   source.
+        //:
+        //: 2 Bytes outside the range are not modified.
+        //:
+        //: 3 Ranges are divided among jobs only if they are at least the
+        //:   parallel threshold in size, into at most the maximum number of
+        //:   jobs, each (but the last) at least 'k_MIN_CHUNK_SIZE' bytes.
+        //:
+        //: 4 Ranges smaller than the thresholds are not divided.
+        //
+        // Plan:
+        //: 1 For each policy, size, and pair of offsets from aligned
+        //:   addresses, copy and fill a guarded buffer, verifying the result
+        //:   against 'memcpy' and 'memset'.  (C-1..2)
+        //:
+        //: 2 Using the recording "parallel for" function, verify the number
+        //:   of jobs for ranges of several sizes.  (C-3..4)
+        //
+        // Testing:
+        //   void copy(void *, const void *, size_t, const BulkMemoryPolicy&);
+        //   void fill(void *, int, size_t, const BulkMemoryPolicy&);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\n'copy' AND 'fill'"
+                            "\n=================\n");
+
+        static const size_t SIZES[] = {
+            0, 1, 15, 16, 17, 63, 64, 65, 200, 4095, 4096, 4097, 10000,
+            65536 + 13, 1000003
+        };
+        const int NUM_SIZES = sizeof SIZES / sizeof *SIZES;
+
+        enum { k_GUARD = 64 };
+
+        const size_t BUFFER_SIZE = 1000003 + 2 * k_GUARD + 16;
+        char *source   = static_cast<char *>(malloc(BUFFER_SIZE));
+        char *buffer   = static_cast<char *>(malloc(BUFFER_SIZE));
+        char *expected = static_cast<char *>(malloc(BUFFER_SIZE));
+
+        fillRandom(source, BUFFER_SIZE, 7);
+
+        if (verbose) printf("\nComparing with 'memcpy' and 'memset'.\n");
+
+        for (int tp = 0; tp < k_NUM_POLICIES; ++tp) {
+            const PolicyId POLICY = static_cast<PolicyId>(tp);
+            const Policy   X      = makePolicy(POLICY);
+
+            for (int ti = 0; ti < NUM_SIZES; ++ti) {
+                const size_t SIZE = SIZES[ti];
+
+                for (int to = 0; to < 16; to += 3) {
+                for (int from = 0; from < 16; from += 7) {
+                    if (veryVerbose) { P_(POLICY) P_(SIZE) P_(to) P(from) }
+
+                    fillRandom(buffer, BUFFER_SIZE, ti);
+
+                    memcpy(expected, buffer, BUFFER_SIZE);
+                    memcpy(expected + k_GUARD + to, source + from, SIZE);
+
+                    Util::copy(buffer + k_GUARD + to, source + from, SIZE, X);
+
+                    ASSERTV(POLICY, SIZE, to, from,
+                            0 == memcmp(buffer, expected, BUFFER_SIZE));
+
+                    memset(expected + k_GUARD + to, 0xA5, SIZE);
+
+                    Util::fill(buffer + k_GUARD + to, 0xA5, SIZE, X);
+
+                    ASSERTV(POLICY, SIZE, to, from,
+                            0 == memcmp(buffer, expected, BUFFER_SIZE));
+                    ASSERTV(POLICY, SIZE, to,
+                            isFilled(buffer + k_GUARD + to,
+                                     static_cast<char>(0xA5),
+                                     SIZE));
+                }
+                }
+            }
+        }
+
+        if (verbose) printf("\nVerifying the division into jobs.\n");
+        {
+            static const struct {
+                int    d_line;        // source line number
+                size_t d_size;        // size of the range
+                int    d_maxNumJobs;  // maximum number of jobs
+                size_t d_threshold;   // parallel threshold
+                size_t d_expNumJobs;  // expected number of jobs, or 0 if
+                                      // 'parallelFor' is not called
+            } DATA[] = {
+                //LINE      SIZE    MAX    THRESHOLD  EXP
+                //----  --------    ---    ---------  ---
+                { L_,          0,     4,           1,   0 },
+                { L_,       4096,     4,        4097,   0 },
+                { L_,       4096,     4,        4096,   0 },
+                { L_,       4097,     4,        4096,   2 },
+                { L_,      16384,     4,        4096,   4 },
+                { L_,      16385,     4,        4096,   3 },
+                { L_,      16384,     1,        4096,   0 },
+                { L_,    1000003,     4,        4096,   4 },
+                { L_,    1000003,     7,        4096,   7 },
+                { L_,    1000003,     8,     1000004,   0 },
+                { L_,    1000003,     8,     1000003,   8 },
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int    LINE      = DATA[ti].d_line;
+                const size_t SIZE      = DATA[ti].d_size;
+                const int    MAX       = DATA[ti].d_maxNumJobs;
+                const size_t THRESHOLD = DATA[ti].d_threshold;
+                const size_t EXP       = DATA[ti].d_expNumJobs;
+
+                if (veryVerbose) { P_(LINE) P_(SIZE) P_(MAX) P(THRESHOLD) }
+
+                Policy mX;  const Policy& X = mX;
+                mX.setParallelFor(&recordingParallelFor, MAX, THRESHOLD);
+
+                numParallelForCalls = 0;
+                lastNumJobs         = 0;
+                Util::copy(buffer, source, SIZE, X);
+                ASSERTV(LINE, EXP, lastNumJobs, EXP == lastNumJobs);
+                ASSERTV(LINE, numParallelForCalls, (0 != EXP) ==
+                                                   (1 == numParallelForCalls));
+                ASSERTV(LINE, 0 == memcmp(buffer, source, SIZE));
+
+                numParallelForCalls = 0;
+                lastNumJobs         = 0;
+                Util::fill(buffer, 'x', SIZE, X);
+                ASSERTV(LINE, EXP, lastNumJobs, EXP == lastNumJobs);
+                ASSERTV(LINE, isFilled(buffer, 'x', SIZE));
+            }
+        }
+
+        if (verbose) printf("\nVerifying threaded jobs.\n");
+        {
+            Policy mX;  const Policy& X = mX;
+            mX.setParallelFor(&testParallelFor, 4, 4096);
+
+            numThreadedJobs = 0;
+            Util::fill(buffer, 'y', 1000003, X);
+            ASSERT(3 == numThreadedJobs);
+            ASSERT(isFilled(buffer, 'y', 1000003));
+        }
+
+        free(expected);
+        free(buffer);
+        free(source);
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // 'BulkMemoryPolicy' AND 'UsesBulkMemoryPolicy'
+        //
+        // Concerns:
+        //: 1 A default-constructed policy makes no range bulk, and its
+        //:   thresholds are the maximum value of 'size_t'.
+        //:
+        //: 2 Each manipulator sets the corresponding attributes, and a range
+        //:   is bulk if it is at least either threshold, the parallel
+        //:   threshold applying only if there is a "parallel for" function.
+        //:
+        //: 3 The copy constructor and the assignment operator copy every
+        //:   attribute.
+        //:
+        //: 4 'UsesBulkMemoryPolicy' is 'false' for types that do not
+        //:   specialize it, and 'true', with the specified policy, for types
+        //:   that do.
+        //:
+        //: 5 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Set each attribute of a policy in turn, and verify the accessors
+        //:   and 'isBulk' at the thresholds.  (C-1..2)
+        //:
+        //: 2 Copy construct and assign policies, and verify the attributes.
+        //:   (C-3)
+        //:
+        //: 3 Verify the trait for fundamental types, and for a type that
+        //:   specializes it.  (C-4)
+        //:
+        //: 4 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-5)
+        //
+        // Testing:
+        //   BulkMemoryPolicy();
+        //   BulkMemoryPolicy(const BulkMemoryPolicy& original);
+        //   BulkMemoryPolicy& operator=(const BulkMemoryPolicy& rhs);
+        //   void setStreamingThreshold(size_t numBytes);
+        //   void setParallelFor(ParallelForFunction, int, size_t);
+        //   size_t streamingThreshold() const;
+        //   size_t parallelThreshold() const;
+        //   ParallelForFunction parallelFor() const;
+        //   int maxNumJobs() const;
+        //   bool isBulk(size_t numBytes) const;
+        //   UsesBulkMemoryPolicy<TYPE>::value
+        // --------------------------------------------------------------------
+
+        if (verbose) printf(
+                       "\n'BulkMemoryPolicy' AND 'UsesBulkMemoryPolicy'"
+                       "\n=============================================\n");
+
+        Policy mX;  const Policy& X = mX;
+
+        ASSERT(k_MAX_SIZE == X.streamingThreshold());
+        ASSERT(k_MAX_SIZE == X.parallelThreshold());
+        ASSERT(0          == X.parallelFor());
+        ASSERT(1          == X.maxNumJobs());
+        ASSERT(!X.isBulk(0));
+        ASSERT(!X.isBulk(k_MAX_SIZE / 4));
+
+        mX.setStreamingThreshold(1000);
+
+        ASSERT(1000       == X.streamingThreshold());
+        ASSERT(k_MAX_SIZE == X.parallelThreshold());
+        ASSERT(!X.isBulk(999));
+        ASSERT( X.isBulk(1000));
+
+        mX.setParallelFor(0, 4, 100);
+
+        ASSERT(k_MAX_SIZE == X.parallelThreshold());
+        ASSERT(!X.isBulk(999));
+        ASSERT( X.isBulk(1000));
+
+        mX.setParallelFor(&recordingParallelFor, 4, 100);
+
+        ASSERT(1000                  == X.streamingThreshold());
+        ASSERT(100                   == X.parallelThreshold());
+        ASSERT(&recordingParallelFor == X.parallelFor());
+        ASSERT(4                     == X.maxNumJobs());
+        ASSERT(!X.isBulk(99));
+        ASSERT( X.isBulk(100));
+
+        mX.setStreamingThreshold(k_MAX_SIZE);
+
+        ASSERT(k_MAX_SIZE == X.streamingThreshold());
+        ASSERT(!X.isBulk(99));
+        ASSERT( X.isBulk(100));
+
+        mX.setParallelFor(&recordingParallelFor, 2, 5000);
+
+        ASSERT(5000 == X.parallelThreshold());
+        ASSERT(2    == X.maxNumJobs());
+        ASSERT(!X.isBulk(4999));
+        ASSERT( X.isBulk(5000));
+
+        if (verbose) printf("\nCopying policies.\n");
+        {
+            mX.setStreamingThreshold(3000);
+
+            const Policy Y(X);
+
+            ASSERT(3000                  == Y.streamingThreshold());
+            ASSERT(5000                  == Y.parallelThreshold());
+            ASSERT(&recordingParallelFor == Y.parallelFor());
+            ASSERT(2                     == Y.maxNumJobs());
+
+            Policy mZ;  const Policy& Z = mZ;
+
+            mZ = Y;
+
+            ASSERT(3000                  == Z.streamingThreshold());
+            ASSERT(5000                  == Z.parallelThreshold());
+            ASSERT(&recordingParallelFor == Z.parallelFor());
+            ASSERT(2                     == Z.maxNumJobs());
+
+            mZ = Policy();
+
+            ASSERT(k_MAX_SIZE == Z.streamingThreshold());
+            ASSERT(k_MAX_SIZE == Z.parallelThreshold());
+            ASSERT(0          == Z.parallelFor());
+            ASSERT(1          == Z.maxNumJobs());
+            ASSERT(!Z.isBulk(5000));
+        }
+
+        if (verbose) printf("\nTesting 'UsesBulkMemoryPolicy'.\n");
+        {
+            ASSERT(!bslalg::UsesBulkMemoryPolicy<int>::value);
+            ASSERT(!bslalg::UsesBulkMemoryPolicy<char *>::value);
+            ASSERT( bslalg::UsesBulkMemoryPolicy<BulkType>::value);
+
+            ASSERT(&bulkTypePolicy ==
+                            &bslalg::UsesBulkMemoryPolicy<BulkType>::policy());
+        }
+
+        if (verbose) printf("\nNegative Testing.\n");
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Policy mY;
+
+            ASSERT_PASS(mY.setParallelFor(&recordingParallelFor, 1, 0));
+            ASSERT_FAIL(mY.setParallelFor(&recordingParallelFor, 0, 0));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Copy and fill a buffer with a default-constructed policy, and
+        //:   with a policy making every range bulk.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        char source[1000];
+        char buffer[1000];
+
+        fillRandom(source, sizeof source, 1);
+
+        const Policy D;
+
+        Util::copy(buffer, source, sizeof buffer, D);
+        ASSERT(0 == memcmp(buffer, source, sizeof buffer));
+
+        Util::fill(buffer, 'a', sizeof buffer, D);
+        ASSERT(isFilled(buffer, 'a', sizeof buffer));
+
+        Policy mX;  const Policy& X = mX;
+        mX.setStreamingThreshold(0);
+        mX.setParallelFor(&recordingParallelFor, 2, 0);
+
+        Util::copy(buffer, source, sizeof buffer, X);
+        ASSERT(0 == memcmp(buffer, source, sizeof buffer));
+
+        Util::fill(buffer, 'b', sizeof buffer, X);
+        ASSERT(isFilled(buffer, 'b', sizeof buffer));
+
+        memcpy(buffer, "abc", 3);
+        Util::replicate(buffer, 3, sizeof buffer, X);
+        ASSERT(isRepeated(buffer, 3, sizeof buffer));
+        ASSERT(0 == memcmp(buffer + 996, "abca", 4));
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST
+        //
+        // Concerns:
+        //: 1 Non-temporal stores and parallel jobs reduce the time taken to
+        //:   copy and fill ranges much larger than the cache.
+        //
+        // Plan:
+        //: 1 For each size class, from 64 kilobytes to 256 megabytes, time
+        //:   'copy' and 'fill' with the default policy, with non-temporal
+        //:   stores, and with non-temporal stores split across 4 threads,
+        //:   reporting the throughput of each.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nPERFORMANCE TEST"
+                            "\n================\n");
+
+        const size_t MAX_SIZE    = 256 * 1024 * 1024;
+        const size_t TOTAL_BYTES = 2048u * 1024 * 1024;
+
+        char *source      = static_cast<char *>(malloc(MAX_SIZE));
+        char *destination = static_cast<char *>(malloc(MAX_SIZE));
+
+        memset(source, 1, MAX_SIZE);
+        memset(destination, 2, MAX_SIZE);
+
+        static const char *POLICY_NAMES[] = {
+            "memcpy/memset", "streaming", "streaming, 4 threads"
+        };
+
+        printf("%-10s %-22s %12s %12s\n",
+               "size", "policy", "copy(GB/s)", "fill(GB/s)");
+
+        for (size_t size = 64 * 1024; size <= MAX_SIZE; size *= 4) {
+            const int NUM_ITERATIONS = static_cast<int>(TOTAL_BYTES / size);
+
+            for (int tp = 0; tp < 3; ++tp) {
+                Policy mX;  const Policy& X = mX;
+                if (1 <= tp) {
+                    mX.setStreamingThreshold(0);
+                }
+                if (2 <= tp) {
+                    mX.setParallelFor(&testParallelFor, 4, 0);
+                }
+
+                bsls::Stopwatch timer;
+
+                timer.start();
+                for (int i = 0; i < NUM_ITERATIONS; ++i) {
+                    Util::copy(destination, source, size, X);
+                }
+                timer.stop();
+                const double copyTime = timer.accumulatedWallTime();
+
+                timer.reset();
+                timer.start();
+                for (int i = 0; i < NUM_ITERATIONS; ++i) {
+                    Util::fill(destination, i, size, X);
+                }
+                timer.stop();
+                const double fillTime = timer.accumulatedWallTime();
+
+                const double GB = static_cast<double>(size)
+                                * NUM_ITERATIONS / 1e9;
+
+                printf("%7uKiB %-22s %12.2f %12.2f\n",
+                       static_cast<unsigned>(size / 1024),
+                       POLICY_NAMES[tp],
+                       GB / copyTime,
+                       GB / fillTime);
+            }
+        }
+
+        free(destination);
+        free(source);
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -19,6 +19,14 @@ BSLS_IDENT("$Id: $")
 // STL-style containers.  A container should derive from this class to take
 // advantage of empty-base optimization when a non-'bslma' allocator is used.
 //
+// In addition to allocating and deallocating arrays, 'ContainerBase' lets a
+// container grow an array it allocated without copying its elements, when
+// the allocator supports it: 'tryExpandN' attempts to extend the array in
+// place, and 'reallocateN' (for bitwise-moveable elements only) obtains a
+// larger array by way of 'bslma::Allocator::reallocate'.  For allocators not
+// based on 'bslma::Allocator', 'tryExpandN' always fails and 'reallocateN'
+// allocates, copies, and deallocates.
+//
 ///Usage
 ///-----
 // This section illustrates intended use of this component.
@@ -101,6 +109,16 @@ BSLS_IDENT("$Id: $")
 #include <bslmf_isconvertible.h>
 #endif
 
+#ifndef INCLUDED_CSTDDEF
+#include <cstddef>  // 'std::size_t'
+#define INCLUDED_CSTDDEF
+#endif
+
+#ifndef INCLUDED_CSTRING
+#include <cstring>  // 'std::memcpy'
+#define INCLUDED_CSTRING
+#endif
+
 namespace BloombergLP {
 
 namespace bslma { class Allocator; }
@@ -271,6 +289,55 @@ class ContainerBase : public
         return Rebound(this->allocator());
     }
 
+    template <class T>
+    T *reallocateImp(bslma::Allocator *mechanism,
+                     T                *p,
+                     std::size_t       n,
+                     std::size_t       newN)
+        // Return 'mechanism->reallocate' applied to the array of the specified
+        // 'n' objects of type 'T' at the specified 'p' for the specified
+        // 'newN' objects.
+    {
+        return static_cast<T *>(mechanism->reallocate(p,
+                                                      n * sizeof(T),
+                                                      newN * sizeof(T)));
+    }
+
+    template <class T>
+    T *reallocateImp(void *, T *p, std::size_t n, std::size_t newN)
+        // Allocate an array of the specified 'newN' objects of type 'T', copy
+        // to it the bits of the first 'min(n, newN)' objects of the array of
+        // the specified 'n' objects at the specified 'p', deallocate 'p', and
+        // return the new array.
+    {
+        T *result = allocateN(p, newN);
+        std::memcpy(static_cast<void *>(result),
+                    static_cast<const void *>(p),
+                    (n < newN ? n : newN) * sizeof(T));
+        deallocateN(p, n);
+        return result;
+    }
+
+    // PRIVATE CLASS METHODS
+    template <class T>
+    static bool tryExpandImp(bslma::Allocator *mechanism,
+                             T                *p,
+                             std::size_t       n,
+                             std::size_t       newN)
+        // Return 'mechanism->tryExpandInPlace' applied to the array of the
+        // specified 'n' objects of type 'T' at the specified 'p' for the
+        // specified 'newN' objects.
+    {
+        return mechanism->tryExpandInPlace(p, n * sizeof(T), newN * sizeof(T));
+    }
+
+    template <class T>
+    static bool tryExpandImp(void *, T *, std::size_t, std::size_t)
+        // Return 'false'.
+    {
+        return false;
+    }
+
   public:
     // PUBLIC TYPES
     typedef typename Base::AllocatorType            AllocatorType;
@@ -338,6 +405,37 @@ class ContainerBase : public
         rebindAllocator(p).deallocate(p, n);
     }
 
+    template <class T>
+    T *reallocateN(T *p, size_type n, size_type newN)
+        // Return an array of 'newN' objects of type 'T' holding the bits of
+        // the first 'min(n, newN)' objects of the array of 'n' objects at 'p',
+        // previously obtained from 'allocateN' (or from 'reallocateN' or
+        // 'tryExpandN'), and return 'p' to the allocator returned by
+        // 'allocator' unless it is returned.  If 'ALLOCATOR' is based on
+        // 'bslma::Allocator', use its 'reallocate' method, which may avoid
+        // copying; otherwise use 'allocateN', 'memcpy', and 'deallocateN'.
+        // If an exception is thrown, 'p' is not affected.  The behavior is
+        // undefined unless 'p' is not null, '0 < newN', and 'T' is bitwise
+        // moveable.
+    {
+        return reallocateImp(this->bslmaAllocator(), p, n, newN);
+    }
+
+    template <class T>
+    bool tryExpandN(T *p, size_type n, size_type newN)
+        // Attempt to extend the array of 'n' objects of type 'T' at 'p',
+        // previously obtained from 'allocateN' (or from 'reallocateN' or
+        // 'tryExpandN'), to 'newN' objects without changing its address.
+        // Return 'true' on success, and 'false' with no effect otherwise.
+        // Always return 'false' unless 'ALLOCATOR' is based on
+        // 'bslma::Allocator' (see 'bslma::Allocator::tryExpandInPlace').  The
+        // behavior is undefined unless 'p' is not null and 'n <= newN'.  Note
+        // that, since the objects are not moved, 'T' need not be bitwise
+        // moveable.
+    {
+        return tryExpandImp(this->bslmaAllocator(), p, n, newN);
+    }
+
     void destroy(pointer p);
         // Call the 'T' destructor for the object pointed to by 'p'.  Do not
         // directly deallocate any memory.
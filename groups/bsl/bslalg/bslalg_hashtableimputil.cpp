@@ -19,15 +19,13 @@ namespace bslalg
                         // class HashTableImpUtil
                         //-----------------------
 
-// CLASS METHODS
-void HashTableImpUtil::insertAtFrontOfBucket(HashTableAnchor    *anchor,
-                                             BidirectionalLink  *link,
-                                             native_std::size_t  hashCode)
+// PRIVATE CLASS METHODS
+void HashTableImpUtil::insertAtFrontOfBucketImp(HashTableAnchor   *anchor,
+                                                BidirectionalLink *link,
+                                                HashTableBucket   *bucket)
 {
     BSLS_ASSERT(anchor);
     BSLS_ASSERT(link);
-
-    HashTableBucket *bucket = findBucketForHashCode(*anchor, hashCode);
     BSLS_ASSERT_SAFE(bucket);
 
     if (bucket->first()) {
@@ -52,14 +50,12 @@ void HashTableImpUtil::insertAtFrontOfBucket(HashTableAnchor    *anchor,
     }
 }
 
-void HashTableImpUtil::insertAtBackOfBucket(HashTableAnchor    *anchor,
-                                            BidirectionalLink  *link,
-                                            native_std::size_t  hashCode)
+void HashTableImpUtil::insertAtBackOfBucketImp(HashTableAnchor   *anchor,
+                                               BidirectionalLink *link,
+                                               HashTableBucket   *bucket)
 {
     BSLS_ASSERT(anchor);
     BSLS_ASSERT(link);
-
-    HashTableBucket *bucket = findBucketForHashCode(*anchor, hashCode);
     BSLS_ASSERT_SAFE(bucket);
 
     if (bucket->last()) {
@@ -81,16 +77,15 @@ void HashTableImpUtil::insertAtBackOfBucket(HashTableAnchor    *anchor,
     }
 }
 
-void HashTableImpUtil::insertAtPosition(HashTableAnchor    *anchor,
-                                        BidirectionalLink  *link,
-                                        native_std::size_t  hashCode,
-                                        BidirectionalLink  *position)
+void HashTableImpUtil::insertAtPositionImp(HashTableAnchor   *anchor,
+                                           BidirectionalLink *link,
+                                           HashTableBucket   *bucket,
+                                           BidirectionalLink *position)
 {
     BSLS_ASSERT(anchor);
     BSLS_ASSERT(link);
     BSLS_ASSERT(position);
 
-    HashTableBucket *bucket = findBucketForHashCode(*anchor, hashCode);
 #ifdef BDE_BUILD_TARGET_SAFE_2
     BSLS_ASSERT(bucket);
     BSLS_ASSERT_SAFE(bucketContainsLink(*bucket, position));
@@ -106,9 +101,9 @@ void HashTableImpUtil::insertAtPosition(HashTableAnchor    *anchor,
     }
 }
 
-void HashTableImpUtil::remove(HashTableAnchor    *anchor,
-                              BidirectionalLink  *link,
-                              native_std::size_t  hashCode)
+void HashTableImpUtil::removeImp(HashTableAnchor   *anchor,
+                                 BidirectionalLink *link,
+                                 HashTableBucket   *bucket)
 {
     BSLS_ASSERT(link);
     BSLS_ASSERT(anchor);
@@ -117,7 +112,6 @@ void HashTableImpUtil::remove(HashTableAnchor    *anchor,
     // Note that we must update the bucket *before* we unlink from the list,
     // as otherwise we will lose our nextLink()/prev pointers.
 
-    HashTableBucket *bucket = findBucketForHashCode(*anchor, hashCode);
 #ifdef BDE_BUILD_TARGET_SAFE_2
     BSLS_ASSERT(bucket);
     BSLS_ASSERT_SAFE(bucketContainsLink(*bucket, link));
@@ -142,6 +136,51 @@ void HashTableImpUtil::remove(HashTableAnchor    *anchor,
     }
 }
 
+// CLASS METHODS
+void HashTableImpUtil::insertAtFrontOfBucket(HashTableAnchor    *anchor,
+                                             BidirectionalLink  *link,
+                                             native_std::size_t  hashCode)
+{
+    BSLS_ASSERT(anchor);
+
+    insertAtFrontOfBucketImp(anchor,
+                             link,
+                             findBucketForHashCode(*anchor, hashCode));
+}
+
+void HashTableImpUtil::insertAtBackOfBucket(HashTableAnchor    *anchor,
+                                            BidirectionalLink  *link,
+                                            native_std::size_t  hashCode)
+{
+    BSLS_ASSERT(anchor);
+
+    insertAtBackOfBucketImp(anchor,
+                            link,
+                            findBucketForHashCode(*anchor, hashCode));
+}
+
+void HashTableImpUtil::insertAtPosition(HashTableAnchor    *anchor,
+                                        BidirectionalLink  *link,
+                                        native_std::size_t  hashCode,
+                                        BidirectionalLink  *position)
+{
+    BSLS_ASSERT(anchor);
+
+    insertAtPositionImp(anchor,
+                        link,
+                        findBucketForHashCode(*anchor, hashCode),
+                        position);
+}
+
+void HashTableImpUtil::remove(HashTableAnchor    *anchor,
+                              BidirectionalLink  *link,
+                              native_std::size_t  hashCode)
+{
+    BSLS_ASSERT(anchor);
+
+    removeImp(anchor, link, findBucketForHashCode(*anchor, hashCode));
+}
+
 }  // close namespace BloombergLP::bslalg
 
 }  // close namespace BloombergLP
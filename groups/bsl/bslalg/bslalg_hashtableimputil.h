@@ -11,6 +11,7 @@ BSLS_IDENT("$Id: $")
 //
 //@CLASSES:
 //  bslalg::HashTableImpUtil: functions used to implement a hash table
+//  bslalg::HashTableImpUtil_BucketIndex: compile-time bucket-index selector
 //
 //@SEE_ALSO: bslalg_bidirectionallinklistutil, bslalg_hashtableanchor,
 //           bslstl_hashtable
@@ -73,6 +74,29 @@ BSLS_IDENT("$Id: $")
 // lower order bits do not participate to the final adjusted value); however,
 // the means of adjustment may change in the future.
 //
+// A hash table whose bucket array size is always a power of two may instead
+// pass a 'HashTableImpUtil_BucketIndex<true>' tag as the last argument of the
+// functions that locate a bucket (e.g., 'find', 'insertAtFrontOfBucket',
+// 'remove', and 'rehash').  Those overloads compute the (equivalent) adjusted
+// value by masking the low-order bits of the hash value, avoiding an integer
+// division.  The choice is made at compile time, so the overloads without the
+// tag, used by tables of other sizes, are unaffected.  A hash table choosing
+// such bucket array sizes is responsible for supplying hash values whose
+// low-order bits are well distributed (see 'bslstl_usespoweroftwobuckets').
+//
+///Stored Hash Codes
+///-----------------
+// A hash table may allocate its elements as 'BidirectionalHashedNode' objects
+// (rather than 'BidirectionalNode' objects), recording in each node the hash
+// code that was used to place the node in the table.  The functions
+// 'findUsingStoredHashCodes' and 'rehashUsingStoredHashCodes' support such
+// tables: the former compares the stored hash code of each node in a bucket
+// with the hash code of the key being sought, and calls the equality functor
+// only if they match; the latter re-indexes the nodes without calling a hash
+// functor at all.  Note that, as 'BidirectionalHashedNode' derives from
+// 'BidirectionalNode', every other function in this component applies to such
+// a table unchanged.
+//
 ///Well-Formed 'HashTableAnchor' Objects
 ///--------------------------------------
 // Many of the algorithms defined in this component operate on
@@ -498,6 +522,10 @@ BSLS_IDENT("$Id: $")
 #include <bslscm_version.h>
 #endif
 
+#ifndef INCLUDED_BSLALG_BIDIRECTIONALHASHEDNODE
+#include <bslalg_bidirectionalhashednode.h>
+#endif
+
 #ifndef INCLUDED_BSLALG_BIDIRECTIONALLINK
 #include <bslalg_bidirectionallink.h>
 #endif
@@ -589,6 +617,38 @@ struct HashTableImpUtil_ExtractKeyResult {
                                       KeyType>::type>::type Type;
 };
 
+                     // ==================================
+                     // class HashTableImpUtil_BucketIndex
+                     // ==================================
+
+template <bool POWER_OF_TWO_BUCKETS>
+struct HashTableImpUtil_BucketIndex {
+    // This 'struct' template, an object of which is passed as the last
+    // argument of the 'HashTableImpUtil' functions that locate a bucket,
+    // selects at compile time how the index of that bucket is computed from a
+    // hash code.  This primary template uses an integer division, and so
+    // supports bucket arrays of any size.
+
+    // CLASS METHODS
+    static native_std::size_t compute(native_std::size_t hashCode,
+                                      native_std::size_t numBuckets);
+        // Return 'hashCode % numBuckets'.  The behavior is undefined if
+        // 'numBuckets' is 0.
+};
+
+template <>
+struct HashTableImpUtil_BucketIndex<true> {
+    // This specialization masks the low-order bits of the hash code, and so
+    // supports only bucket arrays whose size is a power of two.
+
+    // CLASS METHODS
+    static native_std::size_t compute(native_std::size_t hashCode,
+                                      native_std::size_t numBuckets);
+        // Return 'hashCode & (numBuckets - 1)', which is equal to
+        // 'hashCode % numBuckets'.  The behavior is undefined unless
+        // 'numBuckets' is a power of two.
+};
+
                           // ======================
                           // class HashTableImpUtil
                           // ======================
@@ -611,6 +671,44 @@ struct HashTableImpUtil {
         // 'computeBucketIndex').  The behavior is undefined if 'anchor'
         // has 0 buckets.
 
+    template <bool POWER_OF_TWO_BUCKETS>
+    static HashTableBucket *findBucketForHashCode(
+              const HashTableAnchor&                                    anchor,
+              native_std::size_t                                      hashCode,
+              HashTableImpUtil_BucketIndex<POWER_OF_TWO_BUCKETS>  bucketIndex);
+        // Return the address of the 'HashTableBucket' in the array of buckets
+        // referred to by the specified hash-table 'anchor' whose index is the
+        // value of the specified 'hashCode' adjusted as selected by the
+        // specified 'bucketIndex'.  The behavior is undefined if 'anchor' has
+        // 0 buckets, or if 'POWER_OF_TWO_BUCKETS' is 'true' and the number of
+        // buckets of 'anchor' is not a power of two.
+
+    static void insertAtFrontOfBucketImp(HashTableAnchor   *anchor,
+                                         BidirectionalLink *link,
+                                         HashTableBucket   *bucket);
+        // Insert the specified 'link' into the specified 'anchor', at the
+        // front of the specified 'bucket' of 'anchor'.
+
+    static void insertAtBackOfBucketImp(HashTableAnchor   *anchor,
+                                        BidirectionalLink *link,
+                                        HashTableBucket   *bucket);
+        // Insert the specified 'link' into the specified 'anchor', after the
+        // last node in the specified 'bucket' of 'anchor'.
+
+    static void insertAtPositionImp(HashTableAnchor   *anchor,
+                                    BidirectionalLink *link,
+                                    HashTableBucket   *bucket,
+                                    BidirectionalLink *position);
+        // Insert the specified 'link' into the specified 'anchor' immediately
+        // before the specified 'position', which is in the specified 'bucket'
+        // of 'anchor'.
+
+    static void removeImp(HashTableAnchor   *anchor,
+                          BidirectionalLink *link,
+                          HashTableBucket   *bucket);
+        // Remove the specified 'link', which is in the specified 'bucket' of
+        // the specified 'anchor', from 'anchor'.
+
   public:
     // CLASS METHODS
     static bool bucketContainsLink(const HashTableBucket&  bucket,
@@ -682,6 +780,20 @@ struct HashTableImpUtil {
         // hash-codes of the elements) are adjusted for the specified
         // 'numBuckets'.  The behavior is undefined if 'numBuckets' is 0.
 
+    template <bool POWER_OF_TWO_BUCKETS>
+    static native_std::size_t computeBucketIndex(
+             native_std::size_t                                 hashCode,
+             native_std::size_t                                 numBuckets,
+             HashTableImpUtil_BucketIndex<POWER_OF_TWO_BUCKETS> bucketIndex);
+        // Return the index of the bucket referring to the elements whose
+        // adjusted hash codes are the same as the adjusted value of the
+        // specified 'hashCode', where 'hashCode' is adjusted for the specified
+        // 'numBuckets' as selected by the specified 'bucketIndex'.  The
+        // behavior is undefined if 'numBuckets' is 0, or if
+        // 'POWER_OF_TWO_BUCKETS' is 'true' and 'numBuckets' is not a power of
+        // two.  Note that the result is the same as that of the overload
+        // without 'bucketIndex' whenever the behavior is defined.
+
     static void insertAtFrontOfBucket(HashTableAnchor    *anchor,
                                       BidirectionalLink  *link,
                                       native_std::size_t  hashCode);
@@ -695,6 +807,16 @@ struct HashTableImpUtil {
         // 'BidirectionalNode<KEY_CONFIG::ValueType>' and
         // 'HASHER(extractKey<KEY_CONFIG>(link))' returns 'hashCode'.
 
+    template <bool POWER_OF_TWO_BUCKETS>
+    static void insertAtFrontOfBucket(
+             HashTableAnchor                                    *anchor,
+             BidirectionalLink                                  *link,
+             native_std::size_t                                  hashCode,
+             HashTableImpUtil_BucketIndex<POWER_OF_TWO_BUCKETS>  bucketIndex);
+        // Behave as the overload above, except adjust the specified 'hashCode'
+        // as selected by the specified 'bucketIndex' (see
+        // 'computeBucketIndex').
+
     static void insertAtBackOfBucket(HashTableAnchor    *anchor,
                                      BidirectionalLink  *link,
                                      native_std::size_t  hashCode);
@@ -707,6 +829,16 @@ struct HashTableImpUtil {
         // 'BidirectionalNode<KEY_CONFIG::ValueType>' and
         // 'HASHER(extractKey<KEY_CONFIG>(link))' returns 'hashCode'.
 
+    template <bool POWER_OF_TWO_BUCKETS>
+    static void insertAtBackOfBucket(
+             HashTableAnchor                                    *anchor,
+             BidirectionalLink                                  *link,
+             native_std::size_t                                  hashCode,
+             HashTableImpUtil_BucketIndex<POWER_OF_TWO_BUCKETS>  bucketIndex);
+        // Behave as the overload above, except adjust the specified 'hashCode'
+        // as selected by the specified 'bucketIndex' (see
+        // 'computeBucketIndex').
+
     static void insertAtPosition(HashTableAnchor    *anchor,
                                  BidirectionalLink  *link,
                                  native_std::size_t  hashCode,
@@ -721,6 +853,18 @@ struct HashTableImpUtil {
         // 'BidirectionalNode<KEY_CONFIG::ValueType>' and
         // 'HASHER(extractKey<KEY_CONFIG>(link))' returns 'hashCode'.
 
+    template <bool POWER_OF_TWO_BUCKETS>
+    static void insertAtPosition(
+             HashTableAnchor                                    *anchor,
+             BidirectionalLink                                  *link,
+             native_std::size_t                                  hashCode,
+             BidirectionalLink                                  *position,
+             HashTableImpUtil_BucketIndex<POWER_OF_TWO_BUCKETS>  bucketIndex);
+        // Behave as the overload above, except adjust the specified 'hashCode'
+        // as selected by the specified 'bucketIndex' (see
+        // 'computeBucketIndex') to find the bucket of the specified
+        // 'position'.
+
     static void remove(HashTableAnchor    *anchor,
                        BidirectionalLink  *link,
                        native_std::size_t  hashCode);
@@ -731,6 +875,16 @@ struct HashTableImpUtil {
         // a node of type 'BidirectionalNode<KEY_CONFIG::ValueType>' and
         // 'HASHER(extractKey<KEY_CONFIG>(link))' returns 'hashCode'.
 
+    template <bool POWER_OF_TWO_BUCKETS>
+    static void remove(
+             HashTableAnchor                                    *anchor,
+             BidirectionalLink                                  *link,
+             native_std::size_t                                  hashCode,
+             HashTableImpUtil_BucketIndex<POWER_OF_TWO_BUCKETS>  bucketIndex);
+        // Behave as the overload above, except adjust the specified 'hashCode'
+        // as selected by the specified 'bucketIndex' (see
+        // 'computeBucketIndex').
+
     template <class KEY_CONFIG, class KEY_EQUAL>
     static BidirectionalLink *find(
               const HashTableAnchor&                                    anchor,
@@ -758,6 +912,91 @@ struct HashTableImpUtil {
         //                  const KEY_CONFIG::KeyType& key2)
         //..
 
+    template <class KEY_CONFIG, class KEY_EQUAL, bool POWER_OF_TWO_BUCKETS>
+    static BidirectionalLink *find(
+              const HashTableAnchor&                                    anchor,
+              typename HashTableImpUtil_ExtractKeyResult<KEY_CONFIG>::Type key,
+              const KEY_EQUAL&                                 equalityFunctor,
+              native_std::size_t                                      hashCode,
+              HashTableImpUtil_BucketIndex<POWER_OF_TWO_BUCKETS>  bucketIndex);
+        // Behave as the overload above, except adjust the specified 'hashCode'
+        // as selected by the specified 'bucketIndex' (see
+        // 'computeBucketIndex').
+
+    template <class KEY_CONFIG, class LOOKUP_KEY, class KEY_EQUAL>
+    static BidirectionalLink *findTransparent(
+                              const HashTableAnchor&  anchor,
+                              const LOOKUP_KEY&       key,
+                              const KEY_EQUAL&        equalityFunctor,
+                              native_std::size_t      hashCode);
+        // Return the address of the first link in the list element of the
+        // specified 'anchor', having a value matching (according to the
+        // specified 'equalityFunctor') the specified 'key' in the bucket that
+        // holds elements with the specified 'hashCode' if such a link exists,
+        // and return 0 otherwise.  The behavior is undefined unless, for the
+        // provided 'KEY_CONFIG' and some hash function, 'HASHER', 'anchor' is
+        // well-formed (see 'isWellFormed') and 'HASHER(key)' returns
+        // 'hashCode'.  'KEY_CONFIG' shall meet the requirements described for
+        // 'find'.  'KEY_EQUAL' shall be a functor that can be called as if it
+        // had the following signature:
+        //..
+        //  bool operator()(const LOOKUP_KEY&          key1,
+        //                  const KEY_CONFIG::KeyType& key2)
+        //..
+        // Note that, unlike 'find', this function does not convert 'key' to
+        // 'KEY_CONFIG::KeyType', and so supports heterogeneous (transparent)
+        // lookup with a 'key' of a different type that 'equalityFunctor'
+        // (and 'HASHER') treat as equivalent to a 'KeyType'.
+
+    template <class KEY_CONFIG,
+              class LOOKUP_KEY,
+              class KEY_EQUAL,
+              bool  POWER_OF_TWO_BUCKETS>
+    static BidirectionalLink *findTransparent(
+              const HashTableAnchor&                                    anchor,
+              const LOOKUP_KEY&                                            key,
+              const KEY_EQUAL&                                 equalityFunctor,
+              native_std::size_t                                      hashCode,
+              HashTableImpUtil_BucketIndex<POWER_OF_TWO_BUCKETS>  bucketIndex);
+        // Behave as the overload above, except adjust the specified 'hashCode'
+        // as selected by the specified 'bucketIndex' (see
+        // 'computeBucketIndex').
+
+    template <class KEY_CONFIG, class LOOKUP_KEY, class KEY_EQUAL>
+    static BidirectionalLink *findUsingStoredHashCodes(
+                              const HashTableAnchor&  anchor,
+                              const LOOKUP_KEY&       key,
+                              const KEY_EQUAL&        equalityFunctor,
+                              native_std::size_t      hashCode);
+        // Return the address of the first link in the list element of the
+        // specified 'anchor', having a value matching (according to the
+        // specified 'equalityFunctor') the specified 'key' in the bucket that
+        // holds elements with the specified 'hashCode' if such a link exists,
+        // and return 0 otherwise.  'equalityFunctor' is called only for links
+        // whose stored hash code is 'hashCode'.  The behavior is undefined
+        // unless, for the provided 'KEY_CONFIG' and some hash function,
+        // 'HASHER', 'anchor' is well-formed (see 'isWellFormed'), each link in
+        // 'anchor' refers to a node of type
+        // 'BidirectionalHashedNode<KEY_CONFIG::ValueType>' whose 'hashCode' is
+        // the value of 'HASHER' for the key held by the node, and
+        // 'HASHER(key)' returns 'hashCode'.  'KEY_CONFIG' shall meet the
+        // requirements described for 'find', and 'KEY_EQUAL' those described
+        // for 'findTransparent'.
+
+    template <class KEY_CONFIG,
+              class LOOKUP_KEY,
+              class KEY_EQUAL,
+              bool  POWER_OF_TWO_BUCKETS>
+    static BidirectionalLink *findUsingStoredHashCodes(
+              const HashTableAnchor&                                    anchor,
+              const LOOKUP_KEY&                                            key,
+              const KEY_EQUAL&                                 equalityFunctor,
+              native_std::size_t                                      hashCode,
+              HashTableImpUtil_BucketIndex<POWER_OF_TWO_BUCKETS>  bucketIndex);
+        // Behave as the overload above, except adjust the specified 'hashCode'
+        // as selected by the specified 'bucketIndex' (see
+        // 'computeBucketIndex').
+
     template <class KEY_CONFIG, class HASHER>
     static void rehash(HashTableAnchor   *newAnchor,
                        BidirectionalLink *elementList,
@@ -775,12 +1014,74 @@ struct HashTableImpUtil {
         // whose nodes are each of type
         // 'BidirectionalNode<KEY_CONFIG::ValueType>', the previous address of
         // the first node and the next address of the last node are 0.
+
+    template <class KEY_CONFIG, class HASHER, bool POWER_OF_TWO_BUCKETS>
+    static void rehash(
+              HashTableAnchor                                    *newAnchor,
+              BidirectionalLink                                  *elementList,
+              const HASHER&                                       hasher,
+              HashTableImpUtil_BucketIndex<POWER_OF_TWO_BUCKETS>  bucketIndex);
+        // Behave as the overload above, except adjust the hash code of each
+        // element as selected by the specified 'bucketIndex' (see
+        // 'computeBucketIndex').
+
+    template <class KEY_CONFIG>
+    static void rehashUsingStoredHashCodes(HashTableAnchor   *newAnchor,
+                                           BidirectionalLink *elementList);
+        // Populate the specified 'newAnchor' with all the elements in the
+        // specified 'elementList', using the hash code stored in each node to
+        // determine the bucket for that element.  The buckets in the array in
+        // 'newAnchor' and the list root address in 'newAnchor' are assumed to
+        // be garbage and overwritten.  The behavior is undefined unless
+        // 'newAnchor' has one or more buckets, and 'elementList' is a
+        // well-formed bi-directional list (see
+        // 'BidirectionalLinkListUtil::isWellFormed') whose nodes are each of
+        // type 'BidirectionalHashedNode<KEY_CONFIG::ValueType>', the previous
+        // address of the first node and the next address of the last node are
+        // 0.  Note that, unlike 'rehash', this operation calls no
+        // user-supplied code, and so cannot throw.
+
+    template <class KEY_CONFIG, bool POWER_OF_TWO_BUCKETS>
+    static void rehashUsingStoredHashCodes(
+              HashTableAnchor                                    *newAnchor,
+              BidirectionalLink                                  *elementList,
+              HashTableImpUtil_BucketIndex<POWER_OF_TWO_BUCKETS>  bucketIndex);
+        // Behave as the overload above, except adjust the hash code stored in
+        // each node as selected by the specified 'bucketIndex' (see
+        // 'computeBucketIndex').
 };
 
 // ===========================================================================
 //                  TEMPLATE AND INLINE FUNCTION DEFINITIONS
 // ===========================================================================
 
+                    //-----------------------------------
+                    // class HashTableImpUtil_BucketIndex
+                    //-----------------------------------
+
+// CLASS METHODS
+template <bool POWER_OF_TWO_BUCKETS>
+inline
+native_std::size_t HashTableImpUtil_BucketIndex<POWER_OF_TWO_BUCKETS>::compute(
+                                                 native_std::size_t hashCode,
+                                                 native_std::size_t numBuckets)
+{
+    BSLS_ASSERT_SAFE(0 != numBuckets);
+
+    return hashCode % numBuckets;
+}
+
+inline
+native_std::size_t HashTableImpUtil_BucketIndex<true>::compute(
+                                                 native_std::size_t hashCode,
+                                                 native_std::size_t numBuckets)
+{
+    BSLS_ASSERT_SAFE(0 != numBuckets);
+    BSLS_ASSERT_SAFE(0 == (numBuckets & (numBuckets - 1)));
+
+    return hashCode & (numBuckets - 1);
+}
+
                         //-----------------------
                         // class HashTableImpUtil
                         //-----------------------
@@ -800,6 +1101,24 @@ HashTableBucket *HashTableImpUtil::findBucketForHashCode(
     return &(anchor.bucketArrayAddress()[bucketId]);
 }
 
+template <bool POWER_OF_TWO_BUCKETS>
+inline
+HashTableBucket *HashTableImpUtil::findBucketForHashCode(
+               const HashTableAnchor&                             anchor,
+               native_std::size_t                                 hashCode,
+               HashTableImpUtil_BucketIndex<POWER_OF_TWO_BUCKETS> bucketIndex)
+{
+    BSLS_ASSERT_SAFE(anchor.bucketArrayAddress());
+    BSLS_ASSERT_SAFE(anchor.bucketArraySize());
+
+    native_std::size_t bucketId = HashTableImpUtil::computeBucketIndex(
+                                                      hashCode,
+                                                      anchor.bucketArraySize(),
+                                                      bucketIndex);
+    return &(anchor.bucketArrayAddress()[bucketId]);
+}
+
+// CLASS METHODS
 inline
 native_std::size_t HashTableImpUtil::computeBucketIndex(
                                                  native_std::size_t hashCode,
@@ -810,6 +1129,84 @@ native_std::size_t HashTableImpUtil::computeBucketIndex(
     return hashCode % numBuckets;
 }
 
+template <bool POWER_OF_TWO_BUCKETS>
+inline
+native_std::size_t HashTableImpUtil::computeBucketIndex(
+                          native_std::size_t hashCode,
+                          native_std::size_t numBuckets,
+                          HashTableImpUtil_BucketIndex<POWER_OF_TWO_BUCKETS>)
+{
+    return HashTableImpUtil_BucketIndex<POWER_OF_TWO_BUCKETS>::compute(
+                                                                   hashCode,
+                                                                   numBuckets);
+}
+
+template <bool POWER_OF_TWO_BUCKETS>
+inline
+void HashTableImpUtil::insertAtFrontOfBucket(
+              HashTableAnchor                                    *anchor,
+              BidirectionalLink                                  *link,
+              native_std::size_t                                  hashCode,
+              HashTableImpUtil_BucketIndex<POWER_OF_TWO_BUCKETS>  bucketIndex)
+{
+    BSLS_ASSERT_SAFE(anchor);
+
+    insertAtFrontOfBucketImp(anchor,
+                             link,
+                             findBucketForHashCode(*anchor,
+                                                   hashCode,
+                                                   bucketIndex));
+}
+
+template <bool POWER_OF_TWO_BUCKETS>
+inline
+void HashTableImpUtil::insertAtBackOfBucket(
+              HashTableAnchor                                    *anchor,
+              BidirectionalLink                                  *link,
+              native_std::size_t                                  hashCode,
+              HashTableImpUtil_BucketIndex<POWER_OF_TWO_BUCKETS>  bucketIndex)
+{
+    BSLS_ASSERT_SAFE(anchor);
+
+    insertAtBackOfBucketImp(anchor,
+                            link,
+                            findBucketForHashCode(*anchor,
+                                                  hashCode,
+                                                  bucketIndex));
+}
+
+template <bool POWER_OF_TWO_BUCKETS>
+inline
+void HashTableImpUtil::insertAtPosition(
+              HashTableAnchor                                    *anchor,
+              BidirectionalLink                                  *link,
+              native_std::size_t                                  hashCode,
+              BidirectionalLink                                  *position,
+              HashTableImpUtil_BucketIndex<POWER_OF_TWO_BUCKETS>  bucketIndex)
+{
+    BSLS_ASSERT_SAFE(anchor);
+
+    insertAtPositionImp(anchor,
+                        link,
+                        findBucketForHashCode(*anchor, hashCode, bucketIndex),
+                        position);
+}
+
+template <bool POWER_OF_TWO_BUCKETS>
+inline
+void HashTableImpUtil::remove(
+              HashTableAnchor                                    *anchor,
+              BidirectionalLink                                  *link,
+              native_std::size_t                                  hashCode,
+              HashTableImpUtil_BucketIndex<POWER_OF_TWO_BUCKETS>  bucketIndex)
+{
+    BSLS_ASSERT_SAFE(anchor);
+
+    removeImp(anchor,
+              link,
+              findBucketForHashCode(*anchor, hashCode, bucketIndex));
+}
+
 inline
 bool HashTableImpUtil::bucketContainsLink(const HashTableBucket&   bucket,
                                           BidirectionalLink       *linkAddress)
@@ -831,7 +1228,6 @@ bool HashTableImpUtil::bucketContainsLink(const HashTableBucket&   bucket,
     return false;
 }
 
-// CLASS METHODS
 template<class KEY_CONFIG>
 inline
 typename KEY_CONFIG::ValueType& HashTableImpUtil::extractValue(
@@ -863,11 +1259,29 @@ BidirectionalLink *HashTableImpUtil::find(
   typename HashTableImpUtil_ExtractKeyResult<KEY_CONFIG>::Type key,
   const KEY_EQUAL&                                             equalityFunctor,
   native_std::size_t                                           hashCode)
+{
+    return find<KEY_CONFIG>(anchor,
+                            key,
+                            equalityFunctor,
+                            hashCode,
+                            HashTableImpUtil_BucketIndex<false>());
+}
+
+template <class KEY_CONFIG, class KEY_EQUAL, bool POWER_OF_TWO_BUCKETS>
+inline
+BidirectionalLink *HashTableImpUtil::find(
+  const HashTableAnchor&                                       anchor,
+  typename HashTableImpUtil_ExtractKeyResult<KEY_CONFIG>::Type key,
+  const KEY_EQUAL&                                             equalityFunctor,
+  native_std::size_t                                           hashCode,
+  HashTableImpUtil_BucketIndex<POWER_OF_TWO_BUCKETS>           bucketIndex)
 {
     BSLS_ASSERT_SAFE(anchor.bucketArrayAddress());
     BSLS_ASSERT_SAFE(anchor.bucketArraySize());
 
-    const HashTableBucket *bucket = findBucketForHashCode(anchor, hashCode);
+    const HashTableBucket *bucket = findBucketForHashCode(anchor,
+                                                          hashCode,
+                                                          bucketIndex);
     BSLS_ASSERT_SAFE(bucket);
 
     for (BidirectionalLink *cursor     = bucket->first(),
@@ -881,10 +1295,121 @@ BidirectionalLink *HashTableImpUtil::find(
     return 0;
 }
 
+template <class KEY_CONFIG, class LOOKUP_KEY, class KEY_EQUAL>
+inline
+BidirectionalLink *HashTableImpUtil::findTransparent(
+                                const HashTableAnchor&  anchor,
+                                const LOOKUP_KEY&       key,
+                                const KEY_EQUAL&        equalityFunctor,
+                                native_std::size_t      hashCode)
+{
+    return findTransparent<KEY_CONFIG>(
+                                        anchor,
+                                        key,
+                                        equalityFunctor,
+                                        hashCode,
+                                        HashTableImpUtil_BucketIndex<false>());
+}
+
+template <class KEY_CONFIG,
+          class LOOKUP_KEY,
+          class KEY_EQUAL,
+          bool  POWER_OF_TWO_BUCKETS>
+inline
+BidirectionalLink *HashTableImpUtil::findTransparent(
+              const HashTableAnchor&                             anchor,
+              const LOOKUP_KEY&                                  key,
+              const KEY_EQUAL&                            equalityFunctor,
+              native_std::size_t                                 hashCode,
+              HashTableImpUtil_BucketIndex<POWER_OF_TWO_BUCKETS> bucketIndex)
+{
+    BSLS_ASSERT_SAFE(anchor.bucketArrayAddress());
+    BSLS_ASSERT_SAFE(anchor.bucketArraySize());
+
+    const HashTableBucket *bucket = findBucketForHashCode(anchor,
+                                                          hashCode,
+                                                          bucketIndex);
+    BSLS_ASSERT_SAFE(bucket);
+
+    for (BidirectionalLink *cursor     = bucket->first(),
+                           * const end = bucket->end();
+                                 end != cursor; cursor = cursor->nextLink() ) {
+        if (equalityFunctor(key, extractKey<KEY_CONFIG>(cursor))) {
+            return cursor;                                            // RETURN
+        }
+    }
+
+    return 0;
+}
+
+template <class KEY_CONFIG, class LOOKUP_KEY, class KEY_EQUAL>
+inline
+BidirectionalLink *HashTableImpUtil::findUsingStoredHashCodes(
+                                const HashTableAnchor&  anchor,
+                                const LOOKUP_KEY&       key,
+                                const KEY_EQUAL&        equalityFunctor,
+                                native_std::size_t      hashCode)
+{
+    return findUsingStoredHashCodes<KEY_CONFIG>(
+                                        anchor,
+                                        key,
+                                        equalityFunctor,
+                                        hashCode,
+                                        HashTableImpUtil_BucketIndex<false>());
+}
+
+template <class KEY_CONFIG,
+          class LOOKUP_KEY,
+          class KEY_EQUAL,
+          bool  POWER_OF_TWO_BUCKETS>
+inline
+BidirectionalLink *HashTableImpUtil::findUsingStoredHashCodes(
+              const HashTableAnchor&                             anchor,
+              const LOOKUP_KEY&                                  key,
+              const KEY_EQUAL&                            equalityFunctor,
+              native_std::size_t                                 hashCode,
+              HashTableImpUtil_BucketIndex<POWER_OF_TWO_BUCKETS> bucketIndex)
+{
+    BSLS_ASSERT_SAFE(anchor.bucketArrayAddress());
+    BSLS_ASSERT_SAFE(anchor.bucketArraySize());
+
+    typedef BidirectionalHashedNode<typename KEY_CONFIG::ValueType> HNode;
+
+    const HashTableBucket *bucket = findBucketForHashCode(anchor,
+                                                          hashCode,
+                                                          bucketIndex);
+    BSLS_ASSERT_SAFE(bucket);
+
+    for (BidirectionalLink *cursor     = bucket->first(),
+                           * const end = bucket->end();
+                                 end != cursor; cursor = cursor->nextLink() ) {
+        if (static_cast<HNode *>(cursor)->hashCode() == hashCode
+         && equalityFunctor(key, extractKey<KEY_CONFIG>(cursor))) {
+            return cursor;                                            // RETURN
+        }
+    }
+
+    return 0;
+}
+
 template <class KEY_CONFIG, class HASHER>
+inline
 void HashTableImpUtil::rehash(HashTableAnchor   *newAnchor,
                               BidirectionalLink *elementList,
                               const HASHER&      hasher)
+{
+    rehash<KEY_CONFIG>(newAnchor,
+                       elementList,
+                       hasher,
+                       HashTableImpUtil_BucketIndex<false>());
+}
+
+template <class KEY_CONFIG, class HASHER, bool POWER_OF_TWO_BUCKETS>
+void HashTableImpUtil::rehash(
+              HashTableAnchor                                    *newAnchor,
+              BidirectionalLink                                  *elementList,
+              const HASHER&                                       hasher,
+              HashTableImpUtil_BucketIndex<POWER_OF_TWO_BUCKETS>  bucketIndex)
 {
     BSLS_ASSERT_SAFE(newAnchor);
     BSLS_ASSERT_SAFE(newAnchor->bucketArrayAddress());
@@ -953,7 +1478,55 @@ void HashTableImpUtil::rehash(HashTableAnchor   *newAnchor,
 
         insertAtBackOfBucket(newAnchor,
                              nextNode,
-                             hasher(extractKey<KEY_CONFIG>(nextNode)));
+                             hasher(extractKey<KEY_CONFIG>(nextNode)),
+                             bucketIndex);
+    }
+}
+
+template <class KEY_CONFIG>
+inline
+void HashTableImpUtil::rehashUsingStoredHashCodes(
+                                              HashTableAnchor   *newAnchor,
+                                              BidirectionalLink *elementList)
+{
+    rehashUsingStoredHashCodes<KEY_CONFIG>(
+                                        newAnchor,
+                                        elementList,
+                                        HashTableImpUtil_BucketIndex<false>());
+}
+
+template <class KEY_CONFIG, bool POWER_OF_TWO_BUCKETS>
+void HashTableImpUtil::rehashUsingStoredHashCodes(
+              HashTableAnchor                                    *newAnchor,
+              BidirectionalLink                                  *elementList,
+              HashTableImpUtil_BucketIndex<POWER_OF_TWO_BUCKETS>  bucketIndex)
+{
+    BSLS_ASSERT_SAFE(newAnchor);
+    BSLS_ASSERT_SAFE(newAnchor->bucketArrayAddress());
+    BSLS_ASSERT_SAFE(0 != newAnchor->bucketArraySize());
+    BSLS_ASSERT_SAFE(!elementList || !elementList->previousLink());
+
+    typedef BidirectionalHashedNode<typename KEY_CONFIG::ValueType> HNode;
+
+    // No user-supplied code is called, so (unlike 'rehash') no proctor is
+    // needed to keep the list intact.
+
+    for (void **cursor     = (void **)  newAnchor->bucketArrayAddress(),
+              ** const end = (void **) (newAnchor->bucketArrayAddress() +
+                                        newAnchor->bucketArraySize());
+                                                      cursor < end; ++cursor) {
+        *cursor = 0;
+    }
+    newAnchor->setListRootAddress(0);
+
+    while (elementList) {
+        BidirectionalLink *nextNode = elementList;
+        elementList = elementList->nextLink();
+
+        insertAtBackOfBucket(newAnchor,
+                             nextNode,
+                             static_cast<HNode *>(nextNode)->hashCode(),
+                             bucketIndex);
     }
 }
 
@@ -2,6 +2,7 @@
 
 #include <bslalg_hashtableimputil.h>
 
+#include <bslalg_bidirectionalhashednode.h>
 #include <bslalg_bidirectionallinklistutil.h>
 #include <bslalg_bidirectionalnode.h>
 #include <bslalg_hashtablebucket.h>
@@ -48,7 +49,10 @@ using namespace BloombergLP::bslalg;
 // [10] remove(HashTableAnchor *a, BidirectionalLink *l, size_t  h);
 // [10] bucketContainsLink(const Bucket& b, BidirectionalLink *l);
 // [ 9] find(const HashTableAnchor& a, KeyType& key, comparator, size_t h);
+// [ 9] findTransparent(const Anchor& a, const LOOKUP& k, comp, size_t h);
+// [12] findUsingStoredHashCodes(const Anchor&, const LOOKUP&, comp, h);
 // [ 8] rehash(  HashTableAnchor *a, BidirectionalLink *r, const HASHER& h);
+// [12] rehashUsingStoredHashCodes(HashTableAnchor *a, Link *r);
 // [ 7] isWellFormed(const HashTableAnchor& anchor, bslma::Allocator *a = 0);
 // [ 6] insertAtPosition(Anchor *a, Link *l, size_t h, Link  *p);
 // [ 5] insertAtBackOfBucket( Anchor *a, BidirectionalLink *l, size_t h);
@@ -56,8 +60,18 @@ using namespace BloombergLP::bslalg;
 // [ 3] const KeyType& extractKey(const BidirectionalLink *link);
 // [ 3] typename ValueType& extractValue(BidirectionalLink *link);
 // [ 2] computeBucketIndex(size_t hashCode, size_t numBuckets);
+// [ 2] computeBucketIndex(size_t h, size_t n, BucketIndex<B>);
+// [13] insertAtFrontOfBucket(Anchor *a, Link *l, size_t h, BucketIndex<B>);
+// [13] insertAtBackOfBucket(Anchor *a, Link *l, size_t h, BucketIndex<B>);
+// [13] insertAtPosition(Anchor *a, Link *l, h, Link *p, BucketIndex<B>);
+// [13] remove(Anchor *a, Link *l, size_t h, BucketIndex<B>);
+// [13] find(const Anchor& a, KeyType& key, comp, h, BucketIndex<B>);
+// [13] findTransparent(const Anchor&, const LOOKUP&, c, h, BucketIndex);
+// [13] findUsingStoredHashCodes(const Anchor&, LOOKUP, c, h, BucketIdx);
+// [13] rehash(Anchor *a, Link *r, const HASHER& h, BucketIndex<B>);
+// [13] rehashUsingStoredHashCodes(Anchor *a, Link *r, BucketIndex<B>);
 // [ 1] BREATHING TEST
-// [  ] USAGE EXAMPLE
+// [14] USAGE EXAMPLE
 
 // ============================================================================
 //                      STANDARD BDE ASSERT TEST MACROS
@@ -123,6 +137,9 @@ typedef HashTableImpUtil          Obj;
 typedef BidirectionalLink         Link;
 typedef BidirectionalLinkListUtil Util;
 
+typedef HashTableImpUtil_BucketIndex<false> DivideIndex;
+typedef HashTableImpUtil_BucketIndex<true>  MaskIndex;
+
 template <int N>
 struct ArrayLength_Imp {
     char d_array[N];
@@ -248,6 +265,16 @@ struct Equals {
     }
 };
 
+struct HeterogeneousEquals {
+    // This 'struct' provides a comparator between a 'double' lookup key and
+    // an 'int' key, matching only if the 'double' has an integral value.
+
+    bool operator()(const double& lhs, const int& rhs) const
+    {
+        return lhs == static_cast<double>(rhs);
+    }
+};
+
 bool listMatches(Link *first,
                  Link *last,
                  Link **arrayBegin,
@@ -321,6 +348,21 @@ struct WeirdRecordKeyConfiguration {
     }
 };
 
+struct CountingEquals {
+    // This 'struct' provides an 'int' equality comparator that counts the
+    // number of times it is called in the object supplied at construction.
+
+    int *d_numCalls_p;
+
+    explicit CountingEquals(int *numCalls) : d_numCalls_p(numCalls) {}
+
+    bool operator()(const int& lhs, const int& rhs) const
+    {
+        ++*d_numCalls_p;
+        return lhs == rhs;
+    }
+};
+
 struct Mod100Hasher {
     size_t operator()(int value) const
     {
@@ -668,7 +710,7 @@ int main(int argc, char *argv[])
     printf("TEST " __FILE__ " CASE %d\n", test);
 
     switch (test) { case 0:
-      case 12: {
+      case 14: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //
@@ -749,6 +791,387 @@ int main(int argc, char *argv[])
         ASSERT(0 == hs.count("chomp"));
 //..
       } break;
+      case 13: {
+        // --------------------------------------------------------------------
+        // TESTING BUCKET INDEX SELECTION
+        //
+        // Concerns:
+        //: 1 The overloads taking a 'HashTableImpUtil_BucketIndex' tag place,
+        //:   find, and remove each link in the same bucket as the overloads
+        //:   without the tag, for both values of the tag, when the number of
+        //:   buckets is a power of two.
+        //:
+        //: 2 The tagged 'rehash' and 'rehashUsingStoredHashCodes' produce an
+        //:   anchor that is well-formed for the hasher.
+        //
+        // Plan:
+        //: 1 For each tag, and for numbers of buckets that are powers of two,
+        //:   insert 'BidirectionalHashedNode<int>' nodes (storing the hash
+        //:   codes of 'IntTestHasherIdent') using the tagged insertion
+        //:   functions, and verify the anchor is well-formed.  (C-1)
+        //:
+        //: 2 Look up every key, present or not, with the tagged 'find',
+        //:   'findTransparent', and 'findUsingStoredHashCodes', and compare
+        //:   with the untagged 'find'.  (C-1)
+        //:
+        //: 3 Remove every other node with the tagged 'remove', verifying the
+        //:   anchor stays well-formed, then rehash the remaining nodes into a
+        //:   larger bucket array with each tagged rehash function.  (C-1..2)
+        //
+        // Testing:
+        //   computeBucketIndex(size_t h, size_t n, BucketIndex<B>);
+        //   insertAtFrontOfBucket(Anchor *a, Link *l, size_t h, BucketIndex);
+        //   insertAtBackOfBucket(Anchor *a, Link *l, size_t h, BucketIndex);
+        //   insertAtPosition(Anchor *a, Link *l, h, Link *p, BucketIndex<B>);
+        //   remove(Anchor *a, Link *l, size_t h, BucketIndex<B>);
+        //   find(const Anchor& a, KeyType& key, comp, h, BucketIndex<B>);
+        //   findTransparent(const Anchor&, const LOOKUP&, c, h, BucketIndex);
+        //   findUsingStoredHashCodes(const Anchor&, LOOKUP, c, h, BucketIdx);
+        //   rehash(Anchor *a, Link *r, const HASHER& h, BucketIndex<B>);
+        //   rehashUsingStoredHashCodes(Anchor *a, Link *r, BucketIndex<B>);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("TESTING BUCKET INDEX SELECTION\n"
+                            "==============================\n");
+
+        bslma::TestAllocator da("defaultAllocator", veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard defaultGuard(&da);
+
+        bslma::TestAllocator oa("objectAllocator", veryVeryVeryVerbose);
+
+        typedef BidirectionalHashedNode<int> HNode;
+        typedef TestSetKeyPolicy<int>        TestPolicy;
+
+        const int NUM_NODES = 24;
+
+        IntTestHasherIdent hasher;
+
+        static const size_t NUM_BUCKETS[] = { 1, 2, 8, 16 };
+        const int NUM_SIZES = ARRAY_LENGTH(NUM_BUCKETS);
+
+        for (int ti = 0; ti != NUM_SIZES; ++ti) {
+          for (int mask = 0; mask != 2; ++mask) {
+            const size_t NB = NUM_BUCKETS[ti];
+
+            if (veryVerbose) { T_ P_(NB) P(mask) }
+
+            Bucket buckets[64];
+            memset(buckets, 0, sizeof(buckets));
+
+            Anchor anchor(buckets, NB, 0);    const Anchor& ANCHOR = anchor;
+
+            HNode *nodes[NUM_NODES];
+            for (int i = 0; i != NUM_NODES; ++i) {
+                const int KEY = 3 * (i / 2);  // pairs of equal keys
+
+                nodes[i] = static_cast<HNode *>(oa.allocate(sizeof(HNode)));
+                nodes[i]->reset();
+                nodes[i]->value() = KEY;
+                nodes[i]->setHashCode(hasher(KEY));
+
+                Link *position = mask
+                               ? Obj::find<TestPolicy>(ANCHOR,
+                                                       KEY,
+                                                       Equals<int>(),
+                                                       hasher(KEY),
+                                                       MaskIndex())
+                               : Obj::find<TestPolicy>(ANCHOR,
+                                                       KEY,
+                                                       Equals<int>(),
+                                                       hasher(KEY),
+                                                       DivideIndex());
+                if (position) {
+                    ASSERTV(NB, i, i % 2);
+                    if (mask) {
+                        Obj::insertAtPosition(&anchor,
+                                              nodes[i],
+                                              hasher(KEY),
+                                              position,
+                                              MaskIndex());
+                    }
+                    else {
+                        Obj::insertAtPosition(&anchor,
+                                              nodes[i],
+                                              hasher(KEY),
+                                              position,
+                                              DivideIndex());
+                    }
+                }
+                else if (i % 4) {
+                    if (mask) {
+                        Obj::insertAtBackOfBucket(&anchor,
+                                                  nodes[i],
+                                                  hasher(KEY),
+                                                  MaskIndex());
+                    }
+                    else {
+                        Obj::insertAtBackOfBucket(&anchor,
+                                                  nodes[i],
+                                                  hasher(KEY),
+                                                  DivideIndex());
+                    }
+                }
+                else {
+                    if (mask) {
+                        Obj::insertAtFrontOfBucket(&anchor,
+                                                   nodes[i],
+                                                   hasher(KEY),
+                                                   MaskIndex());
+                    }
+                    else {
+                        Obj::insertAtFrontOfBucket(&anchor,
+                                                   nodes[i],
+                                                   hasher(KEY),
+                                                   DivideIndex());
+                    }
+                }
+                ASSERTV(NB, i, (Obj::isWellFormed<TestPolicy>(anchor,
+                                                               hasher)));
+            }
+            ASSERTV(NB, NUM_NODES == countElements(anchor.listRootAddress()));
+
+            for (int key = -1; key <= 3 * NUM_NODES / 2; ++key) {
+                Link *expected = Obj::find<TestPolicy>(ANCHOR,
+                                                       key,
+                                                       Equals<int>(),
+                                                       hasher(key));
+                if (mask) {
+                    ASSERTV(NB, key, expected == Obj::find<TestPolicy>(
+                                                               ANCHOR,
+                                                               key,
+                                                               Equals<int>(),
+                                                               hasher(key),
+                                                               MaskIndex()));
+                    ASSERTV(NB, key, expected ==
+                                        Obj::findTransparent<TestPolicy>(
+                                                               ANCHOR,
+                                                               key,
+                                                               Equals<int>(),
+                                                               hasher(key),
+                                                               MaskIndex()));
+                    ASSERTV(NB, key, expected ==
+                                        Obj::findUsingStoredHashCodes<
+                                                               TestPolicy>(
+                                                               ANCHOR,
+                                                               key,
+                                                               Equals<int>(),
+                                                               hasher(key),
+                                                               MaskIndex()));
+                }
+                else {
+                    ASSERTV(NB, key, expected == Obj::find<TestPolicy>(
+                                                               ANCHOR,
+                                                               key,
+                                                               Equals<int>(),
+                                                               hasher(key),
+                                                               DivideIndex()));
+                    ASSERTV(NB, key, expected ==
+                                        Obj::findTransparent<TestPolicy>(
+                                                               ANCHOR,
+                                                               key,
+                                                               Equals<int>(),
+                                                               hasher(key),
+                                                               DivideIndex()));
+                    ASSERTV(NB, key, expected ==
+                                        Obj::findUsingStoredHashCodes<
+                                                               TestPolicy>(
+                                                               ANCHOR,
+                                                               key,
+                                                               Equals<int>(),
+                                                               hasher(key),
+                                                               DivideIndex()));
+                }
+            }
+
+            for (int i = 0; i < NUM_NODES; i += 2) {
+                if (mask) {
+                    Obj::remove(&anchor,
+                                nodes[i],
+                                nodes[i]->hashCode(),
+                                MaskIndex());
+                }
+                else {
+                    Obj::remove(&anchor,
+                                nodes[i],
+                                nodes[i]->hashCode(),
+                                DivideIndex());
+                }
+                oa.deallocate(nodes[i]);
+                ASSERTV(NB, i, (Obj::isWellFormed<TestPolicy>(anchor,
+                                                               hasher)));
+            }
+            ASSERTV(NB, NUM_NODES / 2 ==
+                                     countElements(anchor.listRootAddress()));
+
+            Bucket newBuckets[64];
+            memset(newBuckets, 0xab, sizeof(newBuckets));  // garbage
+
+            Anchor newAnchor(newBuckets, 2 * NB, 0);
+            if (mask) {
+                Obj::rehash<TestPolicy>(&newAnchor,
+                                        anchor.listRootAddress(),
+                                        hasher,
+                                        MaskIndex());
+            }
+            else {
+                Obj::rehash<TestPolicy>(&newAnchor,
+                                        anchor.listRootAddress(),
+                                        hasher,
+                                        DivideIndex());
+            }
+            ASSERTV(NB, (Obj::isWellFormed<TestPolicy>(newAnchor, hasher)));
+            ASSERTV(NB, NUM_NODES / 2 ==
+                                  countElements(newAnchor.listRootAddress()));
+
+            Anchor lastAnchor(buckets, 4 * NB, 0);
+            if (mask) {
+                Obj::rehashUsingStoredHashCodes<TestPolicy>(
+                                                 &lastAnchor,
+                                                 newAnchor.listRootAddress(),
+                                                 MaskIndex());
+            }
+            else {
+                Obj::rehashUsingStoredHashCodes<TestPolicy>(
+                                                 &lastAnchor,
+                                                 newAnchor.listRootAddress(),
+                                                 DivideIndex());
+            }
+            ASSERTV(NB, (Obj::isWellFormed<TestPolicy>(lastAnchor, hasher)));
+            ASSERTV(NB, NUM_NODES / 2 ==
+                                 countElements(lastAnchor.listRootAddress()));
+
+            Link *cursor = lastAnchor.listRootAddress();
+            while (cursor) {
+                Link *next = cursor->nextLink();
+                oa.deallocate(cursor);
+                cursor = next;
+            }
+          }
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+      } break;
+      case 12: {
+        // --------------------------------------------------------------------
+        // TESTING STORED HASH CODES
+        //
+        // Concerns:
+        //: 1 'findUsingStoredHashCodes' returns the same link as 'find' for
+        //:   both present and absent keys.
+        //:
+        //: 2 'findUsingStoredHashCodes' calls the equality functor only for
+        //:   nodes whose stored hash code equals the supplied hash code.
+        //:
+        //: 3 'rehashUsingStoredHashCodes' produces a well-formed anchor for
+        //:   the hasher whose codes were stored, without calling any hasher.
+        //:
+        //: 4 Neither function allocates memory.
+        //
+        // Plan:
+        //: 1 Create 'BidirectionalHashedNode<int>' nodes storing the hash
+        //:   codes of 'IntTestHasherIdent', and link them into an anchor with
+        //:   a single bucket using 'insertAtBackOfBucket'.  (Every node then
+        //:   falls in the same bucket.)
+        //:
+        //: 2 For a range of keys, compare the result of
+        //:   'findUsingStoredHashCodes' with that of 'find', counting the
+        //:   calls to the equality functor.  (C-1..2)
+        //:
+        //: 3 Rehash the list into anchors with several numbers of buckets, and
+        //:   verify that each is well-formed for 'IntTestHasherIdent' and
+        //:   holds every node.  (C-3)
+        //:
+        //: 4 Monitor the object allocator across P-2 and P-3.  (C-4)
+        //
+        // Testing:
+        //   findUsingStoredHashCodes(const Anchor&, const LOOKUP&, comp, h);
+        //   rehashUsingStoredHashCodes(HashTableAnchor *a, Link *r);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("TESTING STORED HASH CODES\n"
+                            "=========================\n");
+
+        bslma::TestAllocator da("defaultAllocator", veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard defaultGuard(&da);
+
+        bslma::TestAllocator oa("objectAllocator", veryVeryVeryVerbose);
+
+        typedef BidirectionalHashedNode<int> HNode;
+        typedef TestSetKeyPolicy<int>        TestPolicy;
+
+        const int NUM_NODES = 20;
+
+        Bucket buckets[32];
+        memset(buckets, 0, sizeof(buckets));
+
+        Anchor anchor(buckets, 1, 0);    const Anchor& ANCHOR = anchor;
+        IntTestHasherIdent hasher;
+
+        for (int i = 0; i != NUM_NODES; ++i) {
+            HNode *node = static_cast<HNode *>(oa.allocate(sizeof(HNode)));
+            node->reset();
+            node->value() = 2 * i;
+            node->setHashCode(hasher(2 * i));
+
+            Obj::insertAtBackOfBucket(&anchor, node, hasher(2 * i));
+        }
+        ASSERT(NUM_NODES == countElements(anchor.listRootAddress()));
+        ASSERT((Obj::isWellFormed<TestPolicy>(anchor, hasher)));
+
+        bslma::TestAllocatorMonitor oam(&oa);
+
+        if (verbose) printf("Testing 'findUsingStoredHashCodes'\n");
+
+        for (int key = -1; key <= 2 * NUM_NODES; ++key) {
+            int numCalls = 0;
+            const CountingEquals EQ(&numCalls);
+
+            Link *expected = Obj::find<TestPolicy>(ANCHOR,
+                                                   key,
+                                                   Equals<int>(),
+                                                   hasher(key));
+            Link *result = Obj::findUsingStoredHashCodes<TestPolicy>(
+                                                                 ANCHOR,
+                                                                 key,
+                                                                 EQ,
+                                                                 hasher(key));
+
+            ASSERTV(key, expected == result);
+            ASSERTV(key, numCalls, (0 != expected) == numCalls);
+        }
+
+        if (verbose) printf("Testing 'rehashUsingStoredHashCodes'\n");
+
+        static const size_t NUM_BUCKETS[] = { 1, 2, 7, 8, 32 };
+        const int NUM_REHASHES = ARRAY_LENGTH(NUM_BUCKETS);
+
+        for (int ti = 0; ti != NUM_REHASHES; ++ti) {
+            const size_t NB = NUM_BUCKETS[ti];
+
+            Bucket newBuckets[32];
+            memset(newBuckets, 0xab, sizeof(newBuckets));  // garbage
+
+            Anchor newAnchor(newBuckets, NB, 0);
+            Obj::rehashUsingStoredHashCodes<TestPolicy>(
+                                                   &newAnchor,
+                                                   anchor.listRootAddress());
+
+            ASSERTV(NB, (Obj::isWellFormed<TestPolicy>(newAnchor, hasher)));
+            ASSERTV(NB, NUM_NODES ==
+                                  countElements(newAnchor.listRootAddress()));
+
+            anchor.setListRootAddress(newAnchor.listRootAddress());
+        }
+
+        ASSERT(oam.isTotalSame());
+
+        Link *cursor = anchor.listRootAddress();
+        while (cursor) {
+            Link *next = cursor->nextLink();
+            oa.deallocate(cursor);
+            cursor = next;
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+      } break;
       case 11: {
         // --------------------------------------------------------------------
         // ATTEMPTED USAGE EXAMPLE
@@ -1331,6 +1754,21 @@ int main(int argc, char *argv[])
                                                                  i % 2)));
         }
 
+        if (verbose) printf("Testing 'findTransparent'\n");
+
+        for (int i = 0; i < ARRAY_LENGTH(links); ++i) {
+            const HeterogeneousEquals EQ = HeterogeneousEquals();
+
+            ASSERTV(i, links[i] == Obj::findTransparent<TestPolicy>(ANCHOR,
+                                                                    i + 0.0,
+                                                                    EQ,
+                                                                    i % 2));
+            ASSERTV(i, 0 == Obj::findTransparent<TestPolicy>(ANCHOR,
+                                                             i + 0.5,
+                                                             EQ,
+                                                             i % 2));
+        }
+
         {
             Link *matches[] = { node001, node011 };
             ASSERT(2 == ARRAY_LENGTH(matches));
@@ -2236,7 +2674,11 @@ int main(int argc, char *argv[])
             { L_,  81,  1,  0 },
             { L_, 100, 11,  1 },
             { L_, 100, 12,  4 },
-            { L_, 100,  7,  2 } };
+            { L_, 100,  7,  2 },
+            { L_, 100,  4,  0 },
+            { L_, 101,  8,  5 },
+            { L_,  39, 16,  7 },
+            { L_,  15,  2,  1 } };
         const int NUM_DATA = sizeof DATA / sizeof *DATA;
 
         for (int i = 0; i < NUM_DATA; ++i) {
@@ -2248,6 +2690,17 @@ int main(int argc, char *argv[])
             const size_t RESULT = Obj::computeBucketIndex(HASH_CODE,
                                                           NUM_BUCKETS);
             ASSERTV(LINE, RESULT, EXPECTED == RESULT);
+
+            ASSERTV(LINE, EXPECTED == Obj::computeBucketIndex(HASH_CODE,
+                                                              NUM_BUCKETS,
+                                                              DivideIndex()));
+
+            if (0 == (NUM_BUCKETS & (NUM_BUCKETS - 1))) {
+                ASSERTV(LINE, EXPECTED == Obj::computeBucketIndex(
+                                                                 HASH_CODE,
+                                                                 NUM_BUCKETS,
+                                                                 MaskIndex()));
+            }
         }
       } break;
       case 1: {
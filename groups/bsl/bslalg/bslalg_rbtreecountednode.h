@@ -0,0 +1,242 @@
+// bslalg_rbtreecountednode.h                                         -*-C++-*-
+#ifndef INCLUDED_BSLALG_RBTREECOUNTEDNODE
+#define INCLUDED_BSLALG_RBTREECOUNTEDNODE
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a red-black tree node recording the size of its subtree.
+//
+//@CLASSES:
+//  bslalg::RbTreeCountedNode: red-black tree node with a subtree size
+//
+//@SEE_ALSO: bslalg_rbtreenode, bslalg_rbtreeutil
+//
+//@DESCRIPTION: This component provides a single POD-like class,
+// 'bslalg::RbTreeCountedNode', used to represent a node in a red-black binary
+// search tree that records the number of nodes in the subtree rooted at that
+// node (i.e., the node itself and all of its descendants).  A
+// 'bslalg::RbTreeCountedNode' publicly derives from 'bslalg::RbTreeNode', so
+// it may be used anywhere a 'bslalg::RbTreeNode' is expected, and adds a
+// 'subtreeSize' attribute.  The following inheritance hierarchy diagram shows
+// the classes involved and their methods:
+//..
+//                  ,-------------------------.
+//                 ( bslalg::RbTreeCountedNode )
+//                  `-------------------------'
+//                               |      setSubtreeSize
+//                               |      subtreeSize
+//                               V
+//                      ,------------------.
+//                     ( bslalg::RbTreeNode )
+//                      `------------------'
+//                                      ctor
+//                                      dtor
+//                                      makeBlack
+//                                      makeRed
+//                                      setParent
+//                                      setLeftChild
+//                                      setRightChild
+//                                      setColor
+//                                      toggleColor
+//                                      reset
+//                                      parent
+//                                      leftChild
+//                                      rightChild
+//                                      isBlack
+//                                      isRed
+//                                      color
+//..
+// A tree whose nodes record the sizes of their subtrees (sometimes called an
+// "order-statistic tree") can locate the node at a given position in the
+// in-order sequence of its nodes, and compute the position of a given node,
+// in time proportional to the height of the tree, rather than by visiting
+// each preceding node.  The price is an additional 'int' in every node, and
+// the cost of keeping the subtree sizes accurate whenever the tree is
+// modified; 'bslalg::RbTreeUtil' provides variants of its insertion, removal,
+// and rotation functions that maintain the sizes (see 'bslalg_rbtreeutil').
+//
+// Like 'bslalg::RbTreeNode', this class is "POD-like" to facilitate efficient
+// allocation and use in the context of container implementations, and the
+// 'subtreeSize' attribute has an unspecified value until it is set by
+// 'setSubtreeSize'.
+//
+///Usage
+///-----
+// This section illustrates intended usage of this component.
+//
+///Example 1: Finding a Node by Its Position
+///- - - - - - - - - - - - - - - - - - - - -
+// Suppose we want to find the node at a given position in the in-order
+// sequence of the nodes of a tree without visiting the nodes that precede it.
+//
+// First, we define a function that returns the size of a (possibly empty)
+// subtree:
+//..
+//  int sizeOf(const bslalg::RbTreeNode *subtree)
+//      // Return the number of nodes in the specified 'subtree', or 0 if
+//      // 'subtree' is 0.  The behavior is undefined unless each node of
+//      // 'subtree' is a 'bslalg::RbTreeCountedNode' whose subtree size is
+//      // accurate.
+//  {
+//      return subtree
+//             ? static_cast<const bslalg::RbTreeCountedNode *>(subtree)->
+//                                                              subtreeSize()
+//             : 0;
+//  }
+//..
+// Then, we define a function that descends from the root of a tree, using the
+// subtree sizes to decide in which subtree the sought node lies:
+//..
+//  const bslalg::RbTreeNode *findNth(const bslalg::RbTreeNode *root,
+//                                    int                       index)
+//      // Return the address of the node at the specified 'index' position in
+//      // an in-order traversal of the tree rooted at the specified 'root'.
+//      // The behavior is undefined unless '0 <= index < sizeOf(root)', and
+//      // each node of the tree is a 'bslalg::RbTreeCountedNode' whose
+//      // subtree size is accurate.
+//  {
+//      const bslalg::RbTreeNode *node = root;
+//      while (true) {
+//          const int numLeft = sizeOf(node->leftChild());
+//          if (index == numLeft) {
+//              return node;                                          // RETURN
+//          }
+//          if (index < numLeft) {
+//              node = node->leftChild();
+//          }
+//          else {
+//              index -= numLeft + 1;
+//              node   = node->rightChild();
+//          }
+//      }
+//  }
+//..
+// Next, we create three nodes and arrange them into a tree having 'b' at its
+// root, and 'a' and 'c' as its left and right children, recording the size of
+// each subtree:
+//..
+//  bslalg::RbTreeCountedNode a, b, c;
+//
+//  b.reset(0,  &a, &c, bslalg::RbTreeNode::BSLALG_BLACK);
+//  a.reset(&b,  0,  0, bslalg::RbTreeNode::BSLALG_RED);
+//  c.reset(&b,  0,  0, bslalg::RbTreeNode::BSLALG_RED);
+//
+//  a.setSubtreeSize(1);
+//  b.setSubtreeSize(3);
+//  c.setSubtreeSize(1);
+//..
+// Finally, we find each node by its position:
+//..
+//  assert(&a == findNth(&b, 0));
+//  assert(&b == findNth(&b, 1));
+//  assert(&c == findNth(&b, 2));
+//..
+
+#ifndef INCLUDED_BSLSCM_VERSION
+#include <bslscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_RBTREENODE
+#include <bslalg_rbtreenode.h>
+#endif
+
+namespace BloombergLP {
+namespace bslalg {
+
+                        // =======================
+                        // class RbTreeCountedNode
+                        // =======================
+
+class RbTreeCountedNode : public RbTreeNode {
+    // This POD-like 'class' describes a node suitable for use in a red-black
+    // binary search tree that, in addition to the addresses of its parent and
+    // children and its color (see 'RbTreeNode'), records the number of nodes
+    // in the subtree rooted at this node.  This class is a "POD-like" to
+    // facilitate efficient allocation and use in the context of a container
+    // implementation.  In order to meet the essential requirements of a POD
+    // type, this 'class' does not define a constructor or destructor.
+
+    // DATA
+    int d_subtreeSize;  // number of nodes in the subtree rooted at this node
+
+  public:
+    //! RbTreeCountedNode() = default;
+        // Create a 'RbTreeCountedNode' object having uninitialized values.
+
+    //! RbTreeCountedNode(const RbTreeCountedNode& original) = default;
+        // Create a 'RbTreeCountedNode' object having the same value as the
+        // specified 'original' object.
+
+    //! ~RbTreeCountedNode() = default;
+        // Destroy this object.
+
+    // MANIPULATORS
+    //! RbTreeCountedNode& operator=(const RbTreeCountedNode& rhs) = default;
+        // Assign to this object the value of the specified 'rhs' object, and
+        // return a reference providing modifiable access to this object.
+
+    void setSubtreeSize(int value);
+        // Set the 'subtreeSize' attribute of this node to the specified
+        // 'value'.  The behavior is undefined unless '0 < value'.
+
+    // ACCESSORS
+    int subtreeSize() const;
+        // Return the 'subtreeSize' attribute of this node, i.e., the number of
+        // nodes in the subtree rooted at this node, if it has been maintained
+        // accurately.  The behavior is undefined unless 'setSubtreeSize' has
+        // been called on this node.
+};
+
+// ===========================================================================
+//                      INLINE FUNCTION DEFINITIONS
+// ===========================================================================
+
+                        // -----------------------
+                        // class RbTreeCountedNode
+                        // -----------------------
+
+// MANIPULATORS
+inline
+void RbTreeCountedNode::setSubtreeSize(int value)
+{
+    BSLS_ASSERT_SAFE(0 < value);
+
+    d_subtreeSize = value;
+}
+
+// ACCESSORS
+inline
+int RbTreeCountedNode::subtreeSize() const
+{
+    return d_subtreeSize;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
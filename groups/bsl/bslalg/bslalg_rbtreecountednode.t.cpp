@@ -0,0 +1,374 @@
+// bslalg_rbtreecountednode.t.cpp                                     -*-C++-*-
+#include <bslalg_rbtreecountednode.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_bsltestutil.h>
+
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                              TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test is a POD-like class that adds a single attribute,
+// 'subtreeSize', to 'bslalg::RbTreeNode'.  We test that the new attribute may
+// be set and observed independently of the attributes of the base class, and
+// that an object may be used through a pointer to its base class.
+//
+// Global Concerns:
+//: o No memory is ever allocated.
+//: o Precondition violations are detected in appropriate build modes.
+//-----------------------------------------------------------------------------
+// MANIPULATORS
+// [ 2] void setSubtreeSize(int value);
+//
+// ACCESSORS
+// [ 2] int subtreeSize() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 3] USAGE EXAMPLE
+
+// ============================================================================
+//                      STANDARD BDE ASSERT TEST MACROS
+// ----------------------------------------------------------------------------
+// NOTE: THIS IS A LOW-LEVEL COMPONENT AND MAY NOT USE ANY C++ LIBRARY
+// FUNCTIONS, INCLUDING IOSTREAMS.
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool b, const char *s, int i)
+{
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+
+//=============================================================================
+//                              USAGE EXAMPLE
+//-----------------------------------------------------------------------------
+
+///Example 1: Finding a Node by Its Position
+///- - - - - - - - - - - - - - - - - - - - -
+// Suppose we want to find the node at a given position in the in-order
+// sequence of the nodes of a tree without visiting the nodes that precede it.
+//
+// First, we define a function that returns the size of a (possibly empty)
+// subtree:
+//..
+int sizeOf(const bslalg::RbTreeNode *subtree)
+    // Return the number of nodes in the specified 'subtree', or 0 if
+    // 'subtree' is 0.  The behavior is undefined unless each node of
+    // 'subtree' is a 'bslalg::RbTreeCountedNode' whose subtree size is
+    // accurate.
+{
+    return subtree
+           ? static_cast<const bslalg::RbTreeCountedNode *>(subtree)->
+                                                              subtreeSize()
+           : 0;
+}
+//..
+// Then, we define a function that descends from the root of a tree, using the
+// subtree sizes to decide in which subtree the sought node lies:
+//..
+const bslalg::RbTreeNode *findNth(const bslalg::RbTreeNode *root,
+                                  int                       index)
+    // Return the address of the node at the specified 'index' position in
+    // an in-order traversal of the tree rooted at the specified 'root'.
+    // The behavior is undefined unless '0 <= index < sizeOf(root)', and
+    // each node of the tree is a 'bslalg::RbTreeCountedNode' whose
+    // subtree size is accurate.
+{
+    const bslalg::RbTreeNode *node = root;
+    while (true) {
+        const int numLeft = sizeOf(node->leftChild());
+        if (index == numLeft) {
+            return node;                                          // RETURN
+        }
+        if (index < numLeft) {
+            node = node->leftChild();
+        }
+        else {
+            index -= numLeft + 1;
+            node   = node->rightChild();
+        }
+    }
+}
+//..
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int  test                = argc > 1 ? atoi(argv[1]) : 0;
+    bool verbose             = argc > 2;
+//  bool veryVerbose         = argc > 3;
+//  bool veryVeryVerbose     = argc > 4;
+    bool veryVeryVeryVerbose = argc > 5;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    // CONCERN: In no case is memory allocated from the global allocator.
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    bslma::TestAllocator         da("default", veryVeryVeryVerbose);
+    bslma::DefaultAllocatorGuard dag(&da);
+
+    switch (test) { case 0:
+      case 3: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+// Next, we create three nodes and arrange them into a tree having 'b' at its
+// root, and 'a' and 'c' as its left and right children, recording the size of
+// each subtree:
+//..
+    bslalg::RbTreeCountedNode a, b, c;
+
+    b.reset(0,  &a, &c, bslalg::RbTreeNode::BSLALG_BLACK);
+    a.reset(&b,  0,  0, bslalg::RbTreeNode::BSLALG_RED);
+    c.reset(&b,  0,  0, bslalg::RbTreeNode::BSLALG_RED);
+
+    a.setSubtreeSize(1);
+    b.setSubtreeSize(3);
+    c.setSubtreeSize(1);
+//..
+// Finally, we find each node by its position:
+//..
+    ASSERT(&a == findNth(&b, 0));
+    ASSERT(&b == findNth(&b, 1));
+    ASSERT(&c == findNth(&b, 2));
+//..
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // MANIPULATORS AND ACCESSORS
+        //
+        // Concerns:
+        //: 1 'subtreeSize' returns the value most recently passed to
+        //:   'setSubtreeSize', including the extreme positive values of 'int'.
+        //:
+        //: 2 'subtreeSize' is a 'const' method.
+        //:
+        //: 3 Setting the subtree size does not affect the links or the color
+        //:   of the node, and setting those does not affect the subtree size.
+        //:
+        //: 4 The object is usable through a pointer to its base class.
+        //:
+        //: 5 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Populate each attribute of an object.  Set a sequence of subtree
+        //:   sizes, observing each through a 'const' reference, and verify
+        //:   that the other attributes are unchanged.  (C-1..3)
+        //:
+        //: 2 Modify the links and color through a pointer to the base class,
+        //:   and verify that the subtree size is unchanged.  (C-3..4)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid subtree sizes (using the
+        //:   'BSLS_ASSERTTEST_*' macros).  (C-5)
+        //
+        // Testing:
+        //   void setSubtreeSize(int value);
+        //   int subtreeSize() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nMANIPULATORS AND ACCESSORS"
+                            "\n==========================\n");
+
+        typedef bslalg::RbTreeCountedNode Obj;
+
+        Obj mX;  const Obj& X = mX;
+
+        bslalg::RbTreeNode * const K1 =
+                                  reinterpret_cast<bslalg::RbTreeNode *>(0x10);
+        bslalg::RbTreeNode * const K2 =
+                                  reinterpret_cast<bslalg::RbTreeNode *>(0x20);
+        bslalg::RbTreeNode * const K3 =
+                                  reinterpret_cast<bslalg::RbTreeNode *>(0x30);
+
+        mX.reset(K1, K2, K3, bslalg::RbTreeNode::BSLALG_RED);
+
+        const int DATA[] = { 1, 2, 3, 1000, INT_MAX - 1, INT_MAX, 7 };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int ti = 0; ti != NUM_DATA; ++ti) {
+            mX.setSubtreeSize(DATA[ti]);
+
+            ASSERTV(ti, DATA[ti] == X.subtreeSize());
+            ASSERTV(ti, K1       == X.parent());
+            ASSERTV(ti, K2       == X.leftChild());
+            ASSERTV(ti, K3       == X.rightChild());
+            ASSERTV(ti, X.isRed());
+        }
+
+        bslalg::RbTreeNode *base = &mX;
+        base->reset(0, 0, 0, bslalg::RbTreeNode::BSLALG_BLACK);
+        ASSERT(0 == X.parent());
+        ASSERT(0 == X.leftChild());
+        ASSERT(0 == X.rightChild());
+        ASSERT(X.isBlack());
+        ASSERTV(X.subtreeSize(), 7 == X.subtreeSize());
+
+        base->setParent(K3);
+        base->makeRed();
+        ASSERT(K3 == X.parent());
+        ASSERT(X.isRed());
+        ASSERTV(X.subtreeSize(), 7 == X.subtreeSize());
+
+        if (verbose) printf("\tNegative Testing.\n");
+        {
+            bsls::AssertFailureHandlerGuard hG(
+                                             bsls::AssertTest::failTestDriver);
+
+            ASSERT_SAFE_PASS(mX.setSubtreeSize(1));
+            ASSERT_SAFE_FAIL(mX.setSubtreeSize(0));
+            ASSERT_SAFE_FAIL(mX.setSubtreeSize(-1));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create an object, set its links, color, and subtree size, and
+        //:   observe them.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        typedef bslalg::RbTreeCountedNode Obj;
+
+        ASSERT(sizeof(bslalg::RbTreeNode) < sizeof(Obj));
+
+        Obj mX;  const Obj& X = mX;
+
+        mX.reset(0, 0, 0, bslalg::RbTreeNode::BSLALG_BLACK);
+        mX.setSubtreeSize(1);
+        ASSERT(0 == X.parent());
+        ASSERT(X.isBlack());
+        ASSERTV(X.subtreeSize(), 1 == X.subtreeSize());
+
+        Obj mY;  const Obj& Y = mY;
+
+        mY.reset(&mX, 0, 0, bslalg::RbTreeNode::BSLALG_RED);
+        mY.setSubtreeSize(1);
+        mX.setLeftChild(&mY);
+        mX.setSubtreeSize(2);
+        ASSERT(&mY == X.leftChild());
+        ASSERT(&mX == Y.parent());
+        ASSERTV(X.subtreeSize(), 2 == X.subtreeSize());
+        ASSERTV(Y.subtreeSize(), 1 == Y.subtreeSize());
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    ASSERTV(da.numBlocksTotal(), 0 == da.numBlocksTotal());
+
+    // CONCERN: In no case is memory allocated from the global allocator.
+
+    ASSERTV(globalAllocator.numBlocksTotal(),
+            0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
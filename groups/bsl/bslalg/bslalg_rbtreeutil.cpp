@@ -16,6 +16,47 @@ BSLS_IDENT("$Id$ $CSID$")
 namespace BloombergLP {
 namespace bslalg {
 
+namespace {
+
+struct PlainRotations {
+    // This 'struct' provides a namespace for the rotations used to rebalance
+    // a tree of 'RbTreeNode' objects.
+
+    static void rotateLeft(RbTreeNode *node)
+        // Rotate the specified 'node' counter-clockwise.
+    {
+        RbTreeUtil::rotateLeft(node);
+    }
+
+    static void rotateRight(RbTreeNode *node)
+        // Rotate the specified 'node' clockwise.
+    {
+        RbTreeUtil::rotateRight(node);
+    }
+};
+
+struct CountedRotations {
+    // This 'struct' provides a namespace for the rotations used to rebalance
+    // a tree of 'RbTreeCountedNode' objects, which maintain the subtree size
+    // of each node.
+
+    static void rotateLeft(RbTreeNode *node)
+        // Rotate the specified 'node' counter-clockwise, maintaining the
+        // subtree sizes.
+    {
+        RbTreeUtil::rotateLeftCounted(node);
+    }
+
+    static void rotateRight(RbTreeNode *node)
+        // Rotate the specified 'node' clockwise, maintaining the subtree
+        // sizes.
+    {
+        RbTreeUtil::rotateRightCounted(node);
+    }
+};
+
+}  // close unnamed namespace
+
 static inline bool isBlackOrNull(const RbTreeNode *node)
     // Return 'true' if 'node' is 0 or colored black, and 'false' otherwise.
 {
@@ -46,14 +87,171 @@ static void indent(FILE *file, int level, int spacesPerLevel)
     }
 }
 
+static RbTreeNode *balanceSubchain(RbTreeNode **chain,
+                                   int          numNodes,
+                                   int          depth,
+                                   int          redDepth)
+    // Remove the specified 'numNodes' first nodes from the specified 'chain'
+    // (a list of nodes linked by their right-child pointers), arrange them
+    // into a perfectly balanced subtree whose root is at the specified
+    // 'depth', and return the root of that subtree, or 0 if '0 == numNodes'.
+    // Color red the nodes at the specified 'redDepth', and black all other
+    // nodes.  Load into 'chain' the address of the first remaining node.
+    // The parent of the returned root is left unset.
+{
+    if (0 == numNodes) {
+        return 0;                                                     // RETURN
+    }
+
+    // Build the left subtree first, so that the nodes are taken from the
+    // chain in order.  The right subtree is at least as large as the left
+    // one, and their sizes differ by at most one, so every level of the
+    // resulting tree, except possibly the deepest, is full.
+
+    const int   numLeft = (numNodes - 1) / 2;
+    RbTreeNode *left    = balanceSubchain(chain, numLeft, depth + 1, redDepth);
+
+    RbTreeNode *root = *chain;
+    *chain = root->rightChild();
+
+    RbTreeNode *right = balanceSubchain(chain,
+                                        numNodes - 1 - numLeft,
+                                        depth + 1,
+                                        redDepth);
+
+    root->setLeftChild(left);
+    if (left) {
+        left->setParent(root);
+    }
+    root->setRightChild(right);
+    if (right) {
+        right->setParent(root);
+    }
+    root->setColor(depth == redDepth ? RbTreeNode::BSLALG_RED
+                                     : RbTreeNode::BSLALG_BLACK);
+    return root;
+}
+
+static void loadChildSubtree(RbTreeUtil_Subtree *result,
+                             RbTreeNode         *child,
+                             int                 blackHeight)
+    // Load into the specified 'result' the subtree rooted at the specified
+    // 'child' of a node, where the specified 'blackHeight' is the number of
+    // black nodes on each path from 'child' to a leaf, coloring 'child' black
+    // (and incrementing the black height of 'result') if it is red.
+{
+    result->d_root_p      = child;
+    result->d_blackHeight = blackHeight;
+    if (child && child->isRed()) {
+        child->makeBlack();
+        ++result->d_blackHeight;
+    }
+}
+
+template <class ROTATIONS>
+static void recolorTreeAfterInsertion(RbTreeNode *sentinel, RbTreeNode *node)
+    // Rebalance the nodes of the tree whose root is the left child of the
+    // specified 'sentinel', which has been potentially unbalanced by the
+    // insertion of the specified red 'node', using the rotations provided by
+    // the (template parameter) type 'ROTATIONS'.  The behavior is undefined
+    // unless the tree is a valid binary search tree (but not necessarily a
+    // valid red-black tree), the parent of its root is 'sentinel', and the
+    // tree would be a valid red-black tree if 'node' were colored black and
+    // had no parent (i.e., the potential violation of red-black constraints
+    // is localized to 'node' and its parent).  Note that the root of the
+    // resulting tree may be red.
+{
+    // Implementation Note:  The following is adapted with few changes from
+    // "Introduction to Algorithms" [Cormen, Leiserson, Rivest] , except that
+    // explicit conditions are required to treat NULL values as Black, and
+    // consequently to avoid setting a color (BLACK) on a (already BLACK) null
+    // node.
+
+    typedef RbTreeUtil Op;
+    while (node != sentinel->leftChild() && node->parent()->isRed()) {
+        if (Op::isLeftChild(node->parent())) {
+            RbTreeNode *uncle = node->parent()->parent()->rightChild();
+            // Test if 'uncle' is BLACK (0 is considered BLACK)
+
+            if (uncle && uncle->isRed()) {
+                // Case 1:  grandParent[node] ->  (X:B)
+                //                               /    \.
+                //           parent[node]- > (Y:R)     (uncle:R)
+                //                          /
+                //                      (node:R)
+
+                node->parent()->parent()->makeRed();
+                node->parent()->makeBlack();
+                uncle->makeBlack();
+
+                node = node->parent()->parent();
+            }
+            else {
+                if (Op::isRightChild(node)) {
+                    // Case 2:  grandParent[node] -> (X:B)
+                    //                              /     \.
+                    //           parent[node]- > (Y:R)    (uncle:B)
+                    //                             \.
+                    //                              (node:R)
+                    //
+                    // Perform a left rotation on parent[node] to reduce to
+                    // case 3.
+
+                    node = node->parent();
+                    ROTATIONS::rotateLeft(node);
+                }
+
+                // Case 3:  grandParent[node] -> (X:B)
+                //                              /     \.
+                //           parent[node]- > (Y:R)    (uncle:B)
+                //                            /
+                //                        (node:R)
+                //
+                // Recolor the parent black, the grand parent-red, then rotate
+                // the grand-parent right, so that its the new root of the
+                // sub-tree.
+
+                node->parent()->makeBlack();
+                node->parent()->parent()->makeRed();
+                ROTATIONS::rotateRight(node->parent()->parent());
+            }
+        }
+        else {
+            // The following mirrors the cases above, but with right and left
+            // exchanged.
+
+            RbTreeNode *uncle = node->parent()->parent()->leftChild();
+            if (uncle && uncle->isRed()) {
+                node->parent()->parent()->makeRed();
+                node->parent()->makeBlack();
+                uncle->makeBlack();
+
+                node = node->parent()->parent();
+            }
+            else {
+                if (Op::isLeftChild(node)) {
+                    node = node->parent();
+                    ROTATIONS::rotateRight(node);
+
+                }
+                node->parent()->makeBlack();
+                node->parent()->parent()->makeRed();
+                ROTATIONS::rotateLeft(node->parent()->parent());
+            }
+        }
+    }
+}
+
+template <class ROTATIONS>
 static void recolorTreeAfterRemoval(RbTreeAnchor *tree,
                                     RbTreeNode   *node,
                                     RbTreeNode   *parentOfNode)
      // Rebalance the nodes in the specified 'tree', which has been
      // potentially unbalanced by the insertion of the the specified 'node' as
-     // the child of the specified 'parentOfNode'.  The behavior is undefined
-     // unless 'tree' refers to a valid binary search tree (but not
-     // necessarily a valid red-black tree), and 'tree' would be a valid
+     // the child of the specified 'parentOfNode', using the rotations
+     // provided by the (template parameter) type 'ROTATIONS'.  The behavior
+     // is undefined unless 'tree' refers to a valid binary search tree (but
+     // not necessarily a valid red-black tree), and 'tree' would be a valid
      // red-black tree if 'node' were removed (i.e., the potential violation
      // of red-black constraints is localized to 'node').
 {
@@ -63,7 +261,6 @@ static void recolorTreeAfterRemoval(RbTreeAnchor *tree,
     // consequently to avoid setting a color (BLACK) on a (already BLACK) null
     // node.
 
-    typedef RbTreeUtil Op;
     while (node != tree->rootNode() && (0 == node || node->isBlack())) {
         if (node == parentOfNode->leftChild()) {
             RbTreeNode *sibling = parentOfNode->rightChild();
@@ -72,7 +269,7 @@ static void recolorTreeAfterRemoval(RbTreeAnchor *tree,
 
                 sibling->makeBlack();
                 parentOfNode->makeRed();
-                Op::rotateLeft(parentOfNode);
+                ROTATIONS::rotateLeft(parentOfNode);
                 sibling = parentOfNode->rightChild();
             }
 
@@ -92,7 +289,7 @@ static void recolorTreeAfterRemoval(RbTreeAnchor *tree,
                         sibling->leftChild()->makeBlack();
                     }
                     sibling->makeRed();
-                    Op::rotateRight(sibling);
+                    ROTATIONS::rotateRight(sibling);
                     sibling = parentOfNode->rightChild();
                 }
                 // Case 4.
@@ -102,7 +299,7 @@ static void recolorTreeAfterRemoval(RbTreeAnchor *tree,
                 if (sibling->rightChild()) {
                     sibling->rightChild()->makeBlack();
                 }
-                Op::rotateLeft(parentOfNode);
+                ROTATIONS::rotateLeft(parentOfNode);
                 break;
             }
         }
@@ -113,7 +310,7 @@ static void recolorTreeAfterRemoval(RbTreeAnchor *tree,
 
                 sibling->makeBlack();
                 parentOfNode->makeRed();
-                Op::rotateRight(parentOfNode);
+                ROTATIONS::rotateRight(parentOfNode);
                 sibling = parentOfNode->leftChild();
             }
 
@@ -133,7 +330,7 @@ static void recolorTreeAfterRemoval(RbTreeAnchor *tree,
                         sibling->rightChild()->makeBlack();
                     }
                     sibling->makeRed();
-                    Op::rotateLeft(sibling);
+                    ROTATIONS::rotateLeft(sibling);
                     sibling = parentOfNode->leftChild();
                 }
                 // Case 4.
@@ -143,7 +340,7 @@ static void recolorTreeAfterRemoval(RbTreeAnchor *tree,
                 if (sibling->leftChild()) {
                     sibling->leftChild()->makeBlack();
                 }
-                Op::rotateRight(parentOfNode);
+                ROTATIONS::rotateRight(parentOfNode);
                 break;
             }
         }
@@ -153,72 +350,18 @@ static void recolorTreeAfterRemoval(RbTreeAnchor *tree,
     }
 }
 
-                        // ----------------
-                        // class RbTreeUtil
-                        // ----------------
-// CLASS METHODS
-const RbTreeNode *RbTreeUtil::leftmost(const RbTreeNode *subtree)
-{
-    BSLS_ASSERT(subtree);
-
-    while (subtree->leftChild()) {
-        subtree = subtree->leftChild();
-    }
-    return subtree;
-}
-
-
-const RbTreeNode *RbTreeUtil::rightmost(const RbTreeNode *subtree)
-{
-    BSLS_ASSERT(subtree);
-
-    while (subtree->rightChild()) {
-        subtree = subtree->rightChild();
-    }
-    return subtree;
-}
-
-const RbTreeNode *RbTreeUtil::next(const RbTreeNode *node)
-{
-    BSLS_ASSERT(node);
-
-    if (node->rightChild()) {
-        return leftmost(node->rightChild());                          // RETURN
-    }
-    const RbTreeNode *parent = node->parent();
-    while (node != parent->leftChild()) {
-        node   = parent;
-        parent = node->parent();
-    }
-
-    return parent;
-}
-
-const RbTreeNode *RbTreeUtil::previous(const RbTreeNode *node)
-{
-    BSLS_ASSERT(node);
-
-    if (node->leftChild()) {
-        return rightmost(node->leftChild());                          // RETURN
-    }
-    const RbTreeNode *parent = node->parent();
-    while (node == parent->leftChild()) {
-        node   = parent;
-        parent = node->parent();
-    }
-
-    return parent;
-}
-
-void RbTreeUtil::insertAt(RbTreeAnchor *tree,
-                          RbTreeNode   *parentNode,
-                          bool          leftChildFlag,
-                          RbTreeNode   *newNode)
+template <class ROTATIONS>
+static void insertNode(RbTreeAnchor *tree,
+                       RbTreeNode   *parentNode,
+                       bool          leftChildFlag,
+                       RbTreeNode   *newNode)
+    // Insert the specified 'newNode' into the specified 'tree' as either the
+    // left or right child of the specified 'parentNode', as indicated by the
+    // specified 'leftChildFlag', and then rebalance the tree, using the
+    // rotations provided by the (template parameter) type 'ROTATIONS', so
+    // that it is a valid red-black tree.  The behavior is undefined unless
+    // the arguments meet the requirements of 'RbTreeUtil::insertAt'.
 {
-    BSLS_ASSERT(parentNode);
-    BSLS_ASSERT(newNode);
-    BSLS_ASSERT(tree);
-
     newNode->setLeftChild(0);
     newNode->setRightChild(0);
 
@@ -238,95 +381,23 @@ void RbTreeUtil::insertAt(RbTreeAnchor *tree,
     }
 
     // Fix the tree coloring (if necessary).
-    // Implementation Note:  The following is adapted with few changes from
-    // "Introduction to Algorithms" [Cormen, Leiserson, Rivest] , except that
-    // explicit conditions are required to treat NULL values as Black, and
-    // consequently to avoid setting a color (BLACK) on a (already BLACK) null
-    // node.
-
-    RbTreeNode *node = newNode;
-    while (node != tree->rootNode() && node->parent()->isRed()) {
-        if (isLeftChild(node->parent())) {
-            RbTreeNode *uncle = node->parent()->parent()->rightChild();
-            // Test if 'uncle' is BLACK (0 is considered BLACK)
-
-            if (uncle && uncle->isRed()) {
-                // Case 1:  grandParent[node] ->  (X:B)
-                //                               /    \.
-                //           parent[node]- > (Y:R)     (uncle:R)
-                //                          /
-                //                      (node:R)
 
-                node->parent()->parent()->makeRed();
-                node->parent()->makeBlack();
-                uncle->makeBlack();
+    recolorTreeAfterInsertion<ROTATIONS>(tree->sentinel(), newNode);
 
-                node = node->parent()->parent();
-            }
-            else {
-                if (isRightChild(node)) {
-                    // Case 2:  grandParent[node] -> (X:B)
-                    //                              /     \.
-                    //           parent[node]- > (Y:R)    (uncle:B)
-                    //                             \.
-                    //                              (node:R)
-                    //
-                    // Perform a left rotation on parent[node] to reduce to
-                    // case 3.
-
-                    node = node->parent();
-                    rotateLeft(node);
-                }
-
-                // Case 3:  grandParent[node] -> (X:B)
-                //                              /     \.
-                //           parent[node]- > (Y:R)    (uncle:B)
-                //                            /
-                //                        (node:R)
-                //
-                // Recolor the parent black, the grand parent-red, then rotate
-                // the grand-parent right, so that its the new root of the
-                // sub-tree.
-
-                node->parent()->makeBlack();
-                node->parent()->parent()->makeRed();
-                rotateRight(node->parent()->parent());
-            }
-        }
-        else {
-            // The following mirrors the cases above, but with right and left
-            // exchanged.
-
-            RbTreeNode *uncle = node->parent()->parent()->leftChild();
-            if (uncle && uncle->isRed()) {
-                node->parent()->parent()->makeRed();
-                node->parent()->makeBlack();
-                uncle->makeBlack();
-
-                node = node->parent()->parent();
-            }
-            else {
-                if (isLeftChild(node)) {
-                    node = node->parent();
-                    rotateRight(node);
-
-                }
-                node->parent()->makeBlack();
-                node->parent()->parent()->makeRed();
-                rotateLeft(node->parent()->parent());
-            }
-        }
-    }
     BSLS_ASSERT(tree->sentinel() == tree->rootNode()->parent());
     tree->rootNode()->makeBlack();
     tree->incrementNumNodes();
 }
 
-void RbTreeUtil::remove(RbTreeAnchor *tree, RbTreeNode *node)
+template <class ROTATIONS>
+static void removeNode(RbTreeAnchor *tree, RbTreeNode *node)
+    // Remove the specified 'node' from the specified 'tree', and then
+    // rebalance 'tree', using the rotations provided by the (template
+    // parameter) type 'ROTATIONS', so that it again forms a valid red-black
+    // tree.  The behavior is undefined unless the arguments meet the
+    // requirements of 'RbTreeUtil::remove'.
 {
-    BSLS_ASSERT(0 != node);
-    BSLS_ASSERT(0 != tree);
-    BSLS_ASSERT(0 != tree->rootNode());
+    typedef RbTreeUtil Op;
 
     RbTreeNode *x, *y;
     RbTreeNode *parentOfX;
@@ -357,7 +428,7 @@ void RbTreeUtil::remove(RbTreeAnchor *tree, RbTreeNode *node)
         // Case 2: Otherwise the 'node' will be replaced by its successor in
         // the tree.
 
-        y = leftmost(node->rightChild());
+        y = Op::leftmost(node->rightChild());
         x = y->rightChild();
     }
     yIsBlackFlag = y->isBlack();
@@ -371,12 +442,12 @@ void RbTreeUtil::remove(RbTreeAnchor *tree, RbTreeNode *node)
         // tree.
 
         BSLS_ASSERT_SAFE(0 == node->leftChild() || 0 == node->rightChild());
-        if (isLeftChild(node)) {
+        if (Op::isLeftChild(node)) {
             // If the node being removed is to the left of its parent, it may
             // be the first node of the tree.
 
             if (node == tree->firstNode()) {
-                tree->setFirstNode(next(node));
+                tree->setFirstNode(Op::next(node));
             }
             node->parent()->setLeftChild(x);
         }
@@ -400,7 +471,7 @@ void RbTreeUtil::remove(RbTreeAnchor *tree, RbTreeNode *node)
         BSLS_ASSERT_SAFE(0 == y->leftChild());
         BSLS_ASSERT_SAFE(x == y->rightChild());
 
-        if (isLeftChild(node)) {
+        if (Op::isLeftChild(node)) {
             node->parent()->setLeftChild(y);
         }
         else {
@@ -433,13 +504,288 @@ void RbTreeUtil::remove(RbTreeAnchor *tree, RbTreeNode *node)
     }
 
     if (yIsBlackFlag) {
-        recolorTreeAfterRemoval(tree, x, parentOfX);
+        recolorTreeAfterRemoval<ROTATIONS>(tree, x, parentOfX);
     }
     BSLS_ASSERT(!tree->rootNode() ||
                 tree->sentinel() == tree->rootNode()->parent());
     tree->decrementNumNodes();
 }
 
+static int updateSubtreeSize(RbTreeNode *subtree)
+    // Set the subtree size of each node of the specified 'subtree' to the
+    // number of nodes in the subtree rooted at that node, and return the
+    // number of nodes in 'subtree', or 0 if 'subtree' is 0.  The behavior is
+    // undefined unless each node of 'subtree' is an 'RbTreeCountedNode'
+    // object.
+{
+    if (!subtree) {
+        return 0;                                                     // RETURN
+    }
+    const int numNodes = updateSubtreeSize(subtree->leftChild())
+                       + updateSubtreeSize(subtree->rightChild())
+                       + 1;
+    static_cast<RbTreeCountedNode *>(subtree)->setSubtreeSize(numNodes);
+    return numNodes;
+}
+
+                        // ----------------
+                        // class RbTreeUtil
+                        // ----------------
+// CLASS METHODS
+const RbTreeNode *RbTreeUtil::leftmost(const RbTreeNode *subtree)
+{
+    BSLS_ASSERT(subtree);
+
+    while (subtree->leftChild()) {
+        subtree = subtree->leftChild();
+    }
+    return subtree;
+}
+
+
+const RbTreeNode *RbTreeUtil::rightmost(const RbTreeNode *subtree)
+{
+    BSLS_ASSERT(subtree);
+
+    while (subtree->rightChild()) {
+        subtree = subtree->rightChild();
+    }
+    return subtree;
+}
+
+const RbTreeNode *RbTreeUtil::next(const RbTreeNode *node)
+{
+    BSLS_ASSERT(node);
+
+    if (node->rightChild()) {
+        return leftmost(node->rightChild());                          // RETURN
+    }
+    const RbTreeNode *parent = node->parent();
+    while (node != parent->leftChild()) {
+        node   = parent;
+        parent = node->parent();
+    }
+
+    return parent;
+}
+
+const RbTreeNode *RbTreeUtil::previous(const RbTreeNode *node)
+{
+    BSLS_ASSERT(node);
+
+    if (node->leftChild()) {
+        return rightmost(node->leftChild());                          // RETURN
+    }
+    const RbTreeNode *parent = node->parent();
+    while (node == parent->leftChild()) {
+        node   = parent;
+        parent = node->parent();
+    }
+
+    return parent;
+}
+
+void RbTreeUtil::appendToChain(RbTreeAnchor *chain,
+                               RbTreeNode   *lastNode,
+                               RbTreeNode   *newNode)
+{
+    BSLS_ASSERT(chain);
+    BSLS_ASSERT(lastNode);
+    BSLS_ASSERT(newNode);
+
+    newNode->setLeftChild(0);
+    newNode->setRightChild(0);
+    newNode->makeBlack();
+    newNode->setParent(lastNode);
+    if (chain->sentinel() == lastNode) {
+        BSLS_ASSERT_SAFE(0 == chain->rootNode());
+
+        chain->reset(newNode, newNode, 1);
+    }
+    else {
+        BSLS_ASSERT_SAFE(0 == lastNode->rightChild());
+
+        lastNode->setRightChild(newNode);
+        chain->incrementNumNodes();
+    }
+}
+
+void RbTreeUtil::balanceChain(RbTreeAnchor *chain)
+{
+    BSLS_ASSERT(chain);
+
+    const int numNodes = chain->numNodes();
+    if (0 == numNodes) {
+        return;                                                       // RETURN
+    }
+
+    // In a perfectly balanced tree, every path from the root to a leaf has
+    // the same number of black nodes if every node is black, except, when
+    // the deepest level is not full, those on the deepest level, which are
+    // red (and whose parents are black).  The deepest level is
+    // 'floor(log2(numNodes))', and is full if 'numNodes + 1' is a power of 2.
+
+    int maxDepth = 0;
+    while (numNodes >> (maxDepth + 1)) {
+        ++maxDepth;
+    }
+    const int redDepth = 0 == ((numNodes + 1) & numNodes) ? -1 : maxDepth;
+
+    RbTreeNode *first = chain->rootNode();
+    RbTreeNode *node  = first;
+    RbTreeNode *root  = balanceSubchain(&node, numNodes, 0, redDepth);
+
+    BSLS_ASSERT(0 == node);
+
+    root->setParent(chain->sentinel());
+    chain->reset(root, first, numNodes);
+}
+
+void RbTreeUtil::insertAt(RbTreeAnchor *tree,
+                          RbTreeNode   *parentNode,
+                          bool          leftChildFlag,
+                          RbTreeNode   *newNode)
+{
+    BSLS_ASSERT(parentNode);
+    BSLS_ASSERT(newNode);
+    BSLS_ASSERT(tree);
+
+    insertNode<PlainRotations>(tree, parentNode, leftChildFlag, newNode);
+}
+
+void RbTreeUtil::insertAtCounted(RbTreeAnchor *tree,
+                                 RbTreeNode   *parentNode,
+                                 bool          leftChildFlag,
+                                 RbTreeNode   *newNode)
+{
+    BSLS_ASSERT(parentNode);
+    BSLS_ASSERT(newNode);
+    BSLS_ASSERT(tree);
+
+    // Count 'newNode' in the subtree of each of its ancestors before the tree
+    // is rebalanced, so that the subtree sizes are accurate when each
+    // rotation updates them.
+
+    static_cast<RbTreeCountedNode *>(newNode)->setSubtreeSize(1);
+    for (RbTreeNode *node = parentNode;
+         tree->sentinel() != node;
+         node = node->parent()) {
+        RbTreeCountedNode *countedNode =
+                                      static_cast<RbTreeCountedNode *>(node);
+        countedNode->setSubtreeSize(countedNode->subtreeSize() + 1);
+    }
+
+    insertNode<CountedRotations>(tree, parentNode, leftChildFlag, newNode);
+}
+
+void RbTreeUtil::join(RbTreeAnchor *tree,
+                      RbTreeNode   *middleNode,
+                      RbTreeAnchor *rightTree)
+{
+    BSLS_ASSERT(tree);
+    BSLS_ASSERT(middleNode);
+    BSLS_ASSERT(rightTree);
+    BSLS_ASSERT(tree != rightTree);
+
+    typedef RbTreeUtil_SetOperations Op;
+
+    const int numNodes = tree->numNodes() + 1 + rightTree->numNodes();
+
+    RbTreeUtil_Subtree left;
+    RbTreeUtil_Subtree right;
+
+    Op::detach(&left, tree);
+    Op::detach(&right, rightTree);
+    Op::join(&left, middleNode, &right);
+    Op::attach(tree, &left, numNodes);
+}
+
+const RbTreeNode *RbTreeUtil::nth(const RbTreeAnchor& tree, int index)
+{
+    BSLS_ASSERT(0 <= index);
+    BSLS_ASSERT(index <= tree.numNodes());
+
+    const RbTreeNode *node = tree.rootNode();
+    while (node) {
+        const int numLeft = subtreeSize(node->leftChild());
+        if (index < numLeft) {
+            node = node->leftChild();
+        }
+        else if (index == numLeft) {
+            return node;                                              // RETURN
+        }
+        else {
+            index -= numLeft + 1;
+            node   = node->rightChild();
+        }
+    }
+
+    // 'index' is 'tree.numNodes()'.
+
+    return tree.sentinel();
+}
+
+int RbTreeUtil::rank(const RbTreeAnchor& tree, const RbTreeNode *node)
+{
+    BSLS_ASSERT(node);
+
+    if (tree.sentinel() == node) {
+        return tree.numNodes();                                       // RETURN
+    }
+
+    // The nodes preceding 'node' are those of its left subtree, and, for each
+    // ancestor of which it is a right descendant, that ancestor and the nodes
+    // of its left subtree.
+
+    int result = subtreeSize(node->leftChild());
+    while (tree.sentinel() != node->parent()) {
+        if (isRightChild(node)) {
+            result += subtreeSize(node->parent()->leftChild()) + 1;
+        }
+        node = node->parent();
+    }
+    return result;
+}
+
+void RbTreeUtil::remove(RbTreeAnchor *tree, RbTreeNode *node)
+{
+    BSLS_ASSERT(0 != node);
+    BSLS_ASSERT(0 != tree);
+    BSLS_ASSERT(0 != tree->rootNode());
+
+    removeNode<PlainRotations>(tree, node);
+}
+
+void RbTreeUtil::removeCounted(RbTreeAnchor *tree, RbTreeNode *node)
+{
+    BSLS_ASSERT(0 != node);
+    BSLS_ASSERT(0 != tree);
+    BSLS_ASSERT(0 != tree->rootNode());
+
+    // The node removed from its position in the tree is 'node' if 'node' has
+    // at most one child, and the successor of 'node' (which then takes the
+    // place, color, and subtree size of 'node') otherwise (see 'removeNode').
+    // Uncount it from the subtree of each of its ancestors (which include
+    // 'node' in the latter case) before the tree is rebalanced.
+
+    RbTreeNode *removedNode = node->leftChild() && node->rightChild()
+                            ? leftmost(node->rightChild())
+                            : node;
+    for (RbTreeNode *ancestor = removedNode->parent();
+         tree->sentinel() != ancestor;
+         ancestor = ancestor->parent()) {
+        RbTreeCountedNode *countedNode =
+                                  static_cast<RbTreeCountedNode *>(ancestor);
+        countedNode->setSubtreeSize(countedNode->subtreeSize() - 1);
+    }
+    if (removedNode != node) {
+        static_cast<RbTreeCountedNode *>(removedNode)->setSubtreeSize(
+                        static_cast<RbTreeCountedNode *>(node)->subtreeSize());
+    }
+
+    removeNode<CountedRotations>(tree, node);
+}
+
 void RbTreeUtil::printTreeStructure(
                     FILE             *file,
                     const RbTreeNode *subtree,
@@ -527,6 +873,44 @@ void RbTreeUtil::rotateRight(RbTreeNode *node)
     }
 }
 
+void RbTreeUtil::rotateLeftCounted(RbTreeNode *node)
+{
+    BSLS_ASSERT(node);
+    BSLS_ASSERT(node->rightChild());
+
+    // The pivot takes the place, and so the subtree size, of 'node', whose
+    // subtree loses the pivot and the pivot's right subtree.
+
+    RbTreeCountedNode *countedNode  = static_cast<RbTreeCountedNode *>(node);
+    RbTreeCountedNode *countedPivot =
+                         static_cast<RbTreeCountedNode *>(node->rightChild());
+
+    countedPivot->setSubtreeSize(countedNode->subtreeSize());
+    rotateLeft(node);
+    countedNode->setSubtreeSize(subtreeSize(node->leftChild())
+                              + subtreeSize(node->rightChild())
+                              + 1);
+}
+
+void RbTreeUtil::rotateRightCounted(RbTreeNode *node)
+{
+    BSLS_ASSERT(node);
+    BSLS_ASSERT(node->leftChild());
+
+    // The pivot takes the place, and so the subtree size, of 'node', whose
+    // subtree loses the pivot and the pivot's left subtree.
+
+    RbTreeCountedNode *countedNode  = static_cast<RbTreeCountedNode *>(node);
+    RbTreeCountedNode *countedPivot =
+                          static_cast<RbTreeCountedNode *>(node->leftChild());
+
+    countedPivot->setSubtreeSize(countedNode->subtreeSize());
+    rotateRight(node);
+    countedNode->setSubtreeSize(subtreeSize(node->leftChild())
+                              + subtreeSize(node->rightChild())
+                              + 1);
+}
+
 void RbTreeUtil::swap(RbTreeAnchor *a, RbTreeAnchor *b)
 {
     BSLS_ASSERT(a);
@@ -555,6 +939,13 @@ void RbTreeUtil::swap(RbTreeAnchor *a, RbTreeAnchor *b)
     }
 }
 
+void RbTreeUtil::updateSubtreeSizes(RbTreeAnchor *tree)
+{
+    BSLS_ASSERT(tree);
+
+    updateSubtreeSize(tree->rootNode());
+}
+
                       // --------------------------
                       // class RbTreeUtil_Validator
                       // --------------------------
@@ -604,6 +995,282 @@ bool RbTreeUtil_Validator::isWellFormedAnchor(const RbTreeAnchor& tree)
     return count == tree.numNodes();
 }
 
+                      // -------------------------------
+                      // struct RbTreeUtil_SetOperations
+                      // -------------------------------
+
+// CLASS METHODS
+void RbTreeUtil_SetOperations::attach(RbTreeAnchor       *tree,
+                                      RbTreeUtil_Subtree *subtree,
+                                      int                 numNodes)
+{
+    BSLS_ASSERT(tree);
+    BSLS_ASSERT(subtree);
+    BSLS_ASSERT(0 == tree->rootNode());
+
+    RbTreeNode *root = subtree->d_root_p;
+    if (root) {
+        BSLS_ASSERT_SAFE(root->isBlack());
+
+        root->setParent(tree->sentinel());
+        tree->reset(root,
+                    RbTreeUtil::leftmost(root),
+                    0 <= numNodes ? numNodes : countNodes(root));
+    }
+    else {
+        tree->reset(0, tree->sentinel(), 0);
+    }
+    subtree->d_root_p      = 0;
+    subtree->d_blackHeight = 0;
+}
+
+int RbTreeUtil_SetOperations::blackHeight(const RbTreeNode *root)
+{
+    int height = 0;
+    for (const RbTreeNode *node = root; node; node = node->leftChild()) {
+        if (node->isBlack()) {
+            ++height;
+        }
+    }
+    return height;
+}
+
+void RbTreeUtil_SetOperations::concatenate(RbTreeUtil_Subtree *left,
+                                           RbTreeUtil_Subtree *right)
+{
+    BSLS_ASSERT(left);
+    BSLS_ASSERT(right);
+
+    if (0 == right->d_root_p) {
+        return;                                                       // RETURN
+    }
+    if (0 == left->d_root_p) {
+        *left = *right;
+        right->d_root_p      = 0;
+        right->d_blackHeight = 0;
+        return;                                                       // RETURN
+    }
+
+    RbTreeNode *middleNode = removeFirst(right);
+    join(left, middleNode, right);
+}
+
+int RbTreeUtil_SetOperations::countNodes(const RbTreeNode *root)
+{
+    if (0 == root) {
+        return 0;                                                     // RETURN
+    }
+    return 1 + countNodes(root->leftChild()) + countNodes(root->rightChild());
+}
+
+void RbTreeUtil_SetOperations::detach(RbTreeUtil_Subtree *result,
+                                      RbTreeAnchor       *tree)
+{
+    BSLS_ASSERT(result);
+    BSLS_ASSERT(tree);
+
+    result->d_root_p      = tree->rootNode();
+    result->d_blackHeight = blackHeight(tree->rootNode());
+    tree->reset(0, tree->sentinel(), 0);
+}
+
+void RbTreeUtil_SetOperations::join(RbTreeUtil_Subtree *left,
+                                    RbTreeNode         *middleNode,
+                                    RbTreeUtil_Subtree *right)
+{
+    BSLS_ASSERT(left);
+    BSLS_ASSERT(middleNode);
+    BSLS_ASSERT(right);
+
+    RbTreeNode *leftRoot    = left->d_root_p;
+    RbTreeNode *rightRoot   = right->d_root_p;
+    const int   leftHeight  = left->d_blackHeight;
+    const int   rightHeight = right->d_blackHeight;
+
+    right->d_root_p      = 0;
+    right->d_blackHeight = 0;
+
+    if (leftHeight == rightHeight) {
+        // 'middleNode' becomes the (black) root of the joined subtree.
+
+        middleNode->reset(0, leftRoot, rightRoot, RbTreeNode::BSLALG_BLACK);
+        if (leftRoot) {
+            leftRoot->setParent(middleNode);
+        }
+        if (rightRoot) {
+            rightRoot->setParent(middleNode);
+        }
+        left->d_root_p      = middleNode;
+        left->d_blackHeight = leftHeight + 1;
+        return;                                                       // RETURN
+    }
+
+    // Otherwise, descend the right spine of the taller left subtree (or the
+    // left spine of the taller right subtree) to the first node that is not
+    // red and whose subtree has the black height of the shorter subtree.
+    // Replace that node (which may be 0) by 'middleNode', colored red, having
+    // that node and the shorter subtree as its children, then recolor the
+    // taller subtree as if 'middleNode' had just been inserted.  A local
+    // node serves as the sentinel of the taller subtree while it is
+    // rebalanced.
+
+    const bool  leftTallerFlag = rightHeight < leftHeight;
+    const int   shorterHeight  = leftTallerFlag ? rightHeight : leftHeight;
+    RbTreeNode *tallerRoot     = leftTallerFlag ? leftRoot : rightRoot;
+    int         height         = leftTallerFlag ? leftHeight : rightHeight;
+
+    RbTreeNode sentinel;
+    sentinel.reset(0, tallerRoot, 0, RbTreeNode::BSLALG_BLACK);
+    tallerRoot->setParent(&sentinel);
+
+    RbTreeNode *parent = &sentinel;
+    RbTreeNode *node   = tallerRoot;
+    while (shorterHeight < height || (node && node->isRed())) {
+        if (node->isBlack()) {
+            --height;
+        }
+        parent = node;
+        node   = leftTallerFlag ? node->rightChild() : node->leftChild();
+    }
+    BSLS_ASSERT(&sentinel != parent);
+
+    if (leftTallerFlag) {
+        middleNode->reset(parent, node, rightRoot, RbTreeNode::BSLALG_RED);
+        parent->setRightChild(middleNode);
+        if (rightRoot) {
+            rightRoot->setParent(middleNode);
+        }
+    }
+    else {
+        middleNode->reset(parent, leftRoot, node, RbTreeNode::BSLALG_RED);
+        parent->setLeftChild(middleNode);
+        if (leftRoot) {
+            leftRoot->setParent(middleNode);
+        }
+    }
+    if (node) {
+        node->setParent(middleNode);
+    }
+
+    recolorTreeAfterInsertion<PlainRotations>(&sentinel, middleNode);
+
+    // If the recoloring reached the root, coloring it black increments the
+    // black height of the joined subtree.
+
+    RbTreeNode *root = sentinel.leftChild();
+    left->d_root_p      = root;
+    left->d_blackHeight = (leftTallerFlag ? leftHeight : rightHeight)
+                        + (root->isRed() ? 1 : 0);
+    root->makeBlack();
+}
+
+RbTreeNode *RbTreeUtil_SetOperations::removeFirst(RbTreeUtil_Subtree *tree)
+{
+    BSLS_ASSERT(tree);
+    BSLS_ASSERT(tree->d_root_p);
+
+    // Note that 'RbTreeUtil::remove' does not otherwise use the node count
+    // of the (temporary) anchor.
+
+    RbTreeNode   *first = RbTreeUtil::leftmost(tree->d_root_p);
+    RbTreeAnchor  anchor(tree->d_root_p, first, 1);
+
+    tree->d_root_p->setParent(anchor.sentinel());
+    RbTreeUtil::remove(&anchor, first);
+
+    tree->d_root_p      = anchor.rootNode();
+    tree->d_blackHeight = blackHeight(anchor.rootNode());
+    anchor.reset(0, anchor.sentinel(), 0);
+    return first;
+}
+
+void RbTreeUtil_SetOperations::splitAlongPath(RbTreeUtil_Subtree *left,
+                                              RbTreeUtil_Subtree *tree,
+                                              const bool         *leftFlags,
+                                              int                 length)
+{
+    BSLS_ASSERT(left);
+    BSLS_ASSERT(tree);
+    BSLS_ASSERT(0 == length || leftFlags);
+    BSLS_ASSERT(0 <= length && length <= k_MAX_HEIGHT);
+
+    // Record the nodes on the path, and the black heights of their subtrees,
+    // before any of them is modified.
+
+    RbTreeNode *path[k_MAX_HEIGHT];
+    int         heights[k_MAX_HEIGHT];
+
+    RbTreeNode *node   = tree->d_root_p;
+    int         height = tree->d_blackHeight;
+    for (int i = 0; i < length; ++i) {
+        BSLS_ASSERT(node);
+
+        path[i]    = node;
+        heights[i] = height;
+        if (node->isBlack()) {
+            --height;
+        }
+        node = leftFlags[i] ? node->rightChild() : node->leftChild();
+    }
+    BSLS_ASSERT(0 == node);
+
+    // Then, from the bottom of the path up, join each node on the path, with
+    // its child that is not on the path, to the subtree being accumulated on
+    // the same side.
+
+    RbTreeUtil_Subtree lower = { 0, 0 };
+    RbTreeUtil_Subtree upper = { 0, 0 };
+    for (int i = length - 1; 0 <= i; --i) {
+        node = path[i];
+
+        const int childHeight = heights[i] - (node->isBlack() ? 1 : 0);
+
+        RbTreeUtil_Subtree child;
+
+        if (leftFlags[i]) {
+            loadChildSubtree(&child, node->leftChild(), childHeight);
+            join(&child, node, &lower);
+            lower = child;
+        }
+        else {
+            loadChildSubtree(&child, node->rightChild(), childHeight);
+            join(&upper, node, &child);
+        }
+    }
+    *left = lower;
+    *tree = upper;
+}
+
+void RbTreeUtil_SetOperations::splitAtRoot(RbTreeUtil_Subtree *left,
+                                           RbTreeUtil_Subtree *tree,
+                                           RbTreeUtil_Subtree *right)
+{
+    BSLS_ASSERT(left);
+    BSLS_ASSERT(tree);
+    BSLS_ASSERT(tree->d_root_p);
+    BSLS_ASSERT(right);
+
+    RbTreeNode *root        = tree->d_root_p;
+    const int   childHeight = tree->d_blackHeight - 1;
+
+    loadChildSubtree(left, root->leftChild(), childHeight);
+    loadChildSubtree(right, root->rightChild(), childHeight);
+
+    root->setLeftChild(0);
+    root->setRightChild(0);
+    tree->d_blackHeight = 1;
+}
+
+             // ----------------------------------------------------
+             // struct RbTreeUtil_SetOperations::KeepEquivalentNodes
+             // ----------------------------------------------------
+
+// MANIPULATORS
+void RbTreeUtil_SetOperations::KeepEquivalentNodes::deleteNode(RbTreeNode *)
+{
+    BSLS_ASSERT_OPT(false);
+}
+
 }  // close namespace bslalg
 }  // close namespace BloombergLP
 
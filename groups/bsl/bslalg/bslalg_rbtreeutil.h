@@ -12,8 +12,9 @@ BSLS_IDENT("$Id$ $CSID$")
 //@CLASSES:
 //  bslalg::RbTreeUtil: namespace for red-black tree functions
 //  bslalg::RbTreeUtilTreeProctor: proctor to manage all nodes in a tree
+//  bslalg::RbTreeUtilChainGuard: guard to balance a chain of ordered nodes
 //
-//@SEE_ALSO: bslalg_rbtreenode
+//@SEE_ALSO: bslalg_rbtreenode, bslalg_rbtreecountednode
 //
 //@DESCRIPTION: This component provides a variety of algorithms that operate
 // on nodes forming a red-black binary search tree.
@@ -52,6 +53,10 @@ BSLS_IDENT("$Id$ $CSID$")
 // The following algorithms are used in the process of manipulating the
 // structure of a tree:
 //..
+//  appendToChain       Append the supplied node to a chain of ordered nodes.
+//
+//  balanceChain        Build a balanced tree from a chain of ordered nodes.
+//
 //  copyTree            Return a deep-copy of the supplied tree.
 //
 //  deleteTree          Delete all the nodes of the supplied tree.
@@ -65,11 +70,41 @@ BSLS_IDENT("$Id$ $CSID$")
 //
 //  insertAt            Insert the supplied node at the indicated position.
 //
+//  intersect           Remove the nodes not equivalent to any in another tree.
+//
+//  join                Join two trees separated by the supplied node.
+//
+//  merge               Move all the nodes of another tree into the tree.
+//
+//  mergeUnion          Move the nodes of another tree not already present.
+//
 //  remove              Remove the supplied node from the tree.
 //
+//  subtract            Remove the nodes equivalent to any in another tree.
+//
 //  swap                Swap the contents of two trees.
 //..
 //
+///Order Statistics
+/// - - - - - - - -
+// The following algorithms operate on trees whose nodes are
+// 'RbTreeCountedNode' objects, maintaining, or making use of, the number of
+// nodes in the subtree rooted at each node (see 'Order-Statistic Trees'
+// below):
+//..
+//  insertAtCounted     'insertAt', maintaining the subtree sizes.
+//
+//  nth                 Return the node at the supplied in-order position.
+//
+//  rank                Return the in-order position of the supplied node.
+//
+//  removeCounted       'remove', maintaining the subtree sizes.
+//
+//  subtreeSize         Return the number of nodes in the supplied subtree.
+//
+//  updateSubtreeSizes  Set the subtree size of every node of the tree.
+//..
+//
 ///Utility
 ///- - - -
 // The following algorithms are typically used when implementing higher-level
@@ -82,6 +117,10 @@ BSLS_IDENT("$Id$ $CSID$")
 //  rotateLeft          Perform a counter-clockwise rotation on a node.
 //
 //  rotateRight         Perform a clockwise rotation on a node.
+//
+//  rotateLeftCounted   'rotateLeft', maintaining the subtree sizes.
+//
+//  rotateRightCounted  'rotateRight', maintaining the subtree sizes.
 //..
 //
 ///Testing
@@ -131,6 +170,35 @@ BSLS_IDENT("$Id$ $CSID$")
 // not a canonical requirement of a red-black tree but an additional invariant
 // enforced by the methods of 'RbTreeUtil' to simplify the implementations.
 //
+///Set Operations
+///- - - - - - - -
+// 'mergeUnion', 'merge', 'intersect', and 'subtract' combine two trees
+// without visiting every node of the larger one.  They are implemented by
+// splitting a tree into the nodes ordered before and after a given node, and
+// by joining two trees separated by a node into one, using the algorithms
+// described in "Just Join for Parallel Ordered Sets" [Blelloch, Ferizovic,
+// Sun, SPAA 2016].  Splitting and joining take O(log(N)) time, so that, if
+// all the nodes of one tree order before those of the other, the trees are
+// spliced together in O(log(N)) time, and, in general, each operation takes
+// O(M * log(N / M + 1)) time, where M and N are the number of nodes in the
+// smaller and larger of the two trees.  Nodes are moved between trees, or
+// deleted, but never copied.
+//
+///Order-Statistic Trees
+///- - - - - - - - - - -
+// A tree whose nodes are all 'RbTreeCountedNode' objects, each recording the
+// number of nodes in the subtree rooted at that node, can locate the node at
+// a given in-order position ('nth'), and compute the position of a given
+// node ('rank'), in O(log(N)) time.  The subtree sizes are maintained by
+// 'insertAtCounted', 'removeCounted', 'rotateLeftCounted', and
+// 'rotateRightCounted', which must be used in place of 'insertAt', 'remove',
+// 'rotateLeft', and 'rotateRight' on such a tree.  The other operations that
+// restructure a tree ('balanceChain', 'copyTree', 'insert', 'join', and the
+// set operations) do not maintain the subtree sizes, which must be recomputed
+// afterwards, in O(N) time, by 'updateSubtreeSizes'.  Trees of plain
+// 'RbTreeNode' objects are unaffected: none of the functions used to
+// manipulate them inspects or maintains a subtree size.
+//
 ///The Sentinel Node
 ///- - - - - - - - -
 // The sentinel node is 'RbTreeNode' object (unique to an 'RbTreeAnchor'
@@ -683,6 +751,10 @@ BSLS_IDENT("$Id$ $CSID$")
 #include <bslalg_rbtreeanchor.h>
 #endif
 
+#ifndef INCLUDED_BSLALG_RBTREECOUNTEDNODE
+#include <bslalg_rbtreecountednode.h>
+#endif
+
 #ifndef INCLUDED_BSLALG_RBTREENODE
 #include <bslalg_rbtreenode.h>
 #endif
@@ -707,11 +779,14 @@ struct RbTreeUtil {
     // This 'struct' provides a namespace for a suite of utility functions that
     // operate on elements of type 'RbTreeNode'.
     //
-    // Each method of this class, other than 'copyTree', provides the
-    // *no-throw* exception guarantee if the the client-supplied comparator
-    // provides the no-throw guarantee, and provides the *strong* guarantee
-    // otherwise (see 'bsldoc_glossary').  'copyTree' provides the *strong*
-    // guarantee.
+    // Each method of this class, other than 'copyTree' and the set
+    // operations ('intersect', 'merge', 'mergeUnion', and 'subtract'),
+    // provides the *no-throw* exception guarantee if the the client-supplied
+    // comparator provides the no-throw guarantee, and provides the *strong*
+    // guarantee otherwise (see 'bsldoc_glossary').  'copyTree' provides the
+    // *strong* guarantee.  The set operations provide the *no-throw*
+    // guarantee if the client-supplied comparator provides the no-throw
+    // guarantee, and the *basic* guarantee otherwise.
 
     // CLASS METHODS
                                  // Navigation
@@ -830,6 +905,31 @@ struct RbTreeUtil {
 
                                  // Modification
 
+    static void appendToChain(RbTreeAnchor *chain,
+                              RbTreeNode   *lastNode,
+                              RbTreeNode   *newNode);
+        // Append the specified 'newNode' to the specified 'chain', as the
+        // right child of the specified 'lastNode', where a chain is a tree in
+        // which no node has a left child (i.e., each node is the right child
+        // of its predecessor).  The resulting 'chain' is an ordered binary
+        // tree (but not a valid red-black tree) that can be destroyed using
+        // 'deleteTree' and turned into a valid red-black tree using
+        // 'balanceChain'.  The behavior is undefined unless 'chain' is a chain
+        // or an empty tree, 'lastNode' is the last node of 'chain', or
+        // 'chain->sentinel()' if 'chain' is empty, and 'newNode' is ordered
+        // at or after 'lastNode'.  Note that this operation is intended to
+        // build a tree from an ordered sequence of values in linear time.
+
+    static void balanceChain(RbTreeAnchor *chain);
+        // Rearrange the nodes of the specified 'chain', a tree in which no
+        // node has a left child (see 'appendToChain'), into a perfectly
+        // balanced valid red-black tree, preserving their order.  This
+        // operation takes O(N) time and O(log(N)) stack space, where N is the
+        // number of nodes in 'chain', and performs no rotations.  On return,
+        // 'chain' is well-formed (see 'isWellFormed').  The behavior is
+        // undefined unless 'chain' is a chain (or empty) whose anchor refers
+        // to its first node and holds the number of its nodes.
+
     template <class FACTORY>
     static void copyTree(RbTreeAnchor        *result,
                          const RbTreeAnchor&  original,
@@ -980,18 +1080,200 @@ struct RbTreeUtil {
         // conjunction with the 'findInsertLocation' or
         // 'findUniqueInsertLocation' methods.
 
+    template <class NODE_COMPARATOR, class FACTORY>
+    static void intersect(RbTreeAnchor        *tree,
+                          const RbTreeAnchor&  other,
+                          NODE_COMPARATOR&     comparator,
+                          FACTORY             *nodeFactory);
+        // Remove from the specified 'tree', and destroy using
+        // 'nodeFactory->deleteNode', each node that is not equivalent to any
+        // node of the specified 'other' tree, where both trees are organized
+        // according to the specified 'comparator'.  'NODE_COMPARATOR' shall
+        // be a functor providing a method that can be called as if it had the
+        // following signature:
+        //..
+        //  bool operator()(const RbTreeNode&, const RbTreeNode&) const;
+        //..
+        // 'FACTORY' shall be a class providing a method that can be called as
+        // if it had the following signature:
+        //..
+        //  void deleteNode(RbTreeNode *);
+        //..
+        // If an exception is thrown by 'comparator', 'tree' is left a
+        // well-formed tree holding a subset of its original nodes that
+        // includes each node equivalent to a node of 'other'.  The behavior
+        // is undefined unless 'comparator' provides a strict weak ordering on
+        // the nodes of both trees, 'tree' and 'other' are well-formed (see
+        // 'isWellFormed') and distinct, and 'nodeFactory->deleteNode' does not
+        // throw.  Note that 'other' is not modified, and that, if neither
+        // tree holds two equivalent nodes, the result is the set
+        // intersection of the two trees.
+
+    static void join(RbTreeAnchor *tree,
+                     RbTreeNode   *middleNode,
+                     RbTreeAnchor *rightTree);
+        // Move into the specified 'tree' the specified 'middleNode' followed
+        // by each node of the specified 'rightTree', leaving 'rightTree'
+        // empty, and rebalance 'tree' so that it is a valid red-black tree.
+        // This operation takes O(log(N)) time, where N is the number of nodes
+        // in the resulting tree.  The behavior is undefined unless 'tree' and
+        // 'rightTree' are well-formed (see 'isWellFormed') and distinct,
+        // 'middleNode' is not a node of either tree, and placing the nodes of
+        // 'tree', then 'middleNode', then the nodes of 'rightTree' in that
+        // order would form an ordered sequence.
+
+    template <class NODE_COMPARATOR>
+    static void merge(RbTreeAnchor     *tree,
+                      RbTreeAnchor     *source,
+                      NODE_COMPARATOR&  comparator);
+        // Move each node of the specified 'source' tree into the specified
+        // 'tree', where both trees are organized according to the specified
+        // 'comparator', leaving 'source' empty.  Each node moved from
+        // 'source' is placed after any equivalent nodes of 'tree', and after
+        // any equivalent nodes that preceded it in 'source'.
+        // 'NODE_COMPARATOR' shall be a functor providing a method that can be
+        // called as if it had the following signature:
+        //..
+        //  bool operator()(const RbTreeNode&, const RbTreeNode&) const;
+        //..
+        // If an exception is thrown by 'comparator', 'tree' is left a
+        // well-formed tree holding its original nodes and some of the nodes
+        // of 'source', and 'source' a well-formed tree holding the other
+        // nodes.  The behavior is undefined unless 'comparator' provides a
+        // strict weak ordering on the nodes of both trees, and 'tree' and
+        // 'source' are well-formed (see 'isWellFormed') and distinct.
+
+    template <class NODE_COMPARATOR, class FACTORY>
+    static void mergeUnion(RbTreeAnchor     *tree,
+                           RbTreeAnchor     *source,
+                           NODE_COMPARATOR&  comparator,
+                           FACTORY          *nodeFactory);
+        // Move each node of the specified 'source' tree that is not
+        // equivalent to a node of the specified 'tree' into 'tree', where
+        // both trees are organized according to the specified 'comparator',
+        // and destroy each remaining node of 'source' using
+        // 'nodeFactory->deleteNode', leaving 'source' empty.
+        // 'NODE_COMPARATOR' shall be a functor providing a method that can be
+        // called as if it had the following signature:
+        //..
+        //  bool operator()(const RbTreeNode&, const RbTreeNode&) const;
+        //..
+        // 'FACTORY' shall be a class providing a method that can be called as
+        // if it had the following signature:
+        //..
+        //  void deleteNode(RbTreeNode *);
+        //..
+        // If an exception is thrown by 'comparator', 'tree' is left a
+        // well-formed tree holding its original nodes and some of the nodes
+        // of 'source', and 'source' a well-formed tree holding some of the
+        // other nodes of 'source' (the remaining ones having been destroyed),
+        // with no two equivalent nodes held by either tree.  The behavior is
+        // undefined unless 'comparator' provides a strict weak ordering on the
+        // nodes of both trees, 'tree' and 'source' are well-formed (see
+        // 'isWellFormed') and distinct, neither tree holds two equivalent
+        // nodes, and 'nodeFactory->deleteNode' does not throw.
+
     static void remove(RbTreeAnchor *tree, RbTreeNode *node);
         // Remove the specified 'node' from the specified 'tree', and then
         // rebalance 'tree' so that it again forms a valid red-black tree (see
         // 'validateRbTree').  The behavior is undefined unless 'tree' is
         // well-formed (see 'isWellFormed').
 
+    template <class NODE_COMPARATOR, class FACTORY>
+    static void subtract(RbTreeAnchor        *tree,
+                         const RbTreeAnchor&  other,
+                         NODE_COMPARATOR&     comparator,
+                         FACTORY             *nodeFactory);
+        // Remove from the specified 'tree', and destroy using
+        // 'nodeFactory->deleteNode', each node that is equivalent to a node of
+        // the specified 'other' tree, where both trees are organized according
+        // to the specified 'comparator'.  'NODE_COMPARATOR' shall be a functor
+        // providing a method that can be called as if it had the following
+        // signature:
+        //..
+        //  bool operator()(const RbTreeNode&, const RbTreeNode&) const;
+        //..
+        // 'FACTORY' shall be a class providing a method that can be called as
+        // if it had the following signature:
+        //..
+        //  void deleteNode(RbTreeNode *);
+        //..
+        // If an exception is thrown by 'comparator', 'tree' is left a
+        // well-formed tree holding a subset of its original nodes that
+        // includes each node not equivalent to any node of 'other'.  The
+        // behavior is undefined unless 'comparator' provides a strict weak
+        // ordering on the nodes of both trees, 'tree' and 'other' are
+        // well-formed (see 'isWellFormed') and distinct, and
+        // 'nodeFactory->deleteNode' does not throw.  Note that 'other' is not
+        // modified, and that, if neither tree holds two equivalent nodes, the
+        // result is the set difference of the two trees.
+
     static void swap(RbTreeAnchor *a, RbTreeAnchor *b);
         // Efficiently exchange the nodes in the specified 'a' tree with the
         // nodes in the specified 'b' tree.  This method provides the no-throw
         // exception-safety guarantee.  The behavior is undefined unless 'a'
         // and 'b' are well-formed (see 'isWellFormed').
 
+                                 // Order Statistics
+
+    static void insertAtCounted(RbTreeAnchor *tree,
+                                RbTreeNode   *parentNode,
+                                bool          leftChildFlag,
+                                RbTreeNode   *newNode);
+        // Insert the specified 'newNode' into the specified 'tree' as either
+        // the left or right child of the specified 'parentNode', as indicated
+        // by the specified 'leftChildFlag', and then rebalance the tree so
+        // that it is a valid red-black tree (see 'validateRbTree'), setting
+        // the subtree size of 'newNode', and updating that of each other node
+        // whose subtree is changed.  The behavior is undefined unless 'tree',
+        // 'parentNode', and 'leftChildFlag' meet the requirements of
+        // 'insertAt', 'newNode' and each node of 'tree' are
+        // 'RbTreeCountedNode' objects, and the subtree size of each node of
+        // 'tree' is accurate.
+
+    static const RbTreeNode *nth(const RbTreeAnchor& tree, int index);
+    static       RbTreeNode *nth(RbTreeAnchor&       tree, int index);
+        // Return the address of the node preceded by the specified 'index'
+        // nodes in an in-order traversal of the specified 'tree', or
+        // 'tree.sentinel()' if 'index == tree.numNodes()'.  This operation
+        // takes O(log(N)) time, where N is the number of nodes in 'tree'.
+        // The behavior is undefined unless '0 <= index <= tree.numNodes()',
+        // 'tree' is well-formed (see 'isWellFormed'), and each node of 'tree'
+        // is an 'RbTreeCountedNode' object whose subtree size is accurate.
+
+    static int rank(const RbTreeAnchor& tree, const RbTreeNode *node);
+        // Return the number of nodes preceding the specified 'node' in an
+        // in-order traversal of the specified 'tree', or 'tree.numNodes()' if
+        // 'node' is 'tree.sentinel()'.  This operation takes O(log(N)) time,
+        // where N is the number of nodes in 'tree'.  The behavior is undefined
+        // unless 'node' is a node of 'tree' or its sentinel, 'tree' is
+        // well-formed (see 'isWellFormed'), and each node of 'tree' is an
+        // 'RbTreeCountedNode' object whose subtree size is accurate.
+
+    static void removeCounted(RbTreeAnchor *tree, RbTreeNode *node);
+        // Remove the specified 'node' from the specified 'tree', and then
+        // rebalance 'tree' so that it again forms a valid red-black tree (see
+        // 'validateRbTree'), updating the subtree size of each remaining node
+        // whose subtree is changed.  The behavior is undefined unless 'tree'
+        // is well-formed (see 'isWellFormed'), 'node' is a node of 'tree', and
+        // each node of 'tree' is an 'RbTreeCountedNode' object whose subtree
+        // size is accurate.
+
+    static int subtreeSize(const RbTreeNode *subtree);
+        // Return the number of nodes in the specified 'subtree', or 0 if
+        // 'subtree' is 0.  The behavior is undefined unless 'subtree' is 0 or
+        // an 'RbTreeCountedNode' object whose subtree size is accurate.
+
+    static void updateSubtreeSizes(RbTreeAnchor *tree);
+        // Set the subtree size of each node of the specified 'tree' to the
+        // number of nodes in the subtree rooted at that node.  This operation
+        // takes O(N) time, where N is the number of nodes in 'tree'.  The
+        // behavior is undefined unless 'tree' is well-formed (see
+        // 'isWellFormed'), and each node of 'tree' is an 'RbTreeCountedNode'
+        // object.  Note that this operation is intended to be used after
+        // restructuring 'tree' with an operation that does not maintain the
+        // subtree sizes (e.g., 'balanceChain' or 'copyTree').
+
                                  // Utility
 
     static bool isLeftChild(const RbTreeNode *node);
@@ -1048,6 +1330,24 @@ struct RbTreeUtil {
         // left child, and an 'RbTreeAnchor' object returns the left child of
         // the sentinel node as the root of the tree.
 
+    static void rotateLeftCounted(RbTreeNode *node);
+        // Perform counter-clockwise rotation on the specified 'node' (see
+        // 'rotateLeft'), and update the subtree sizes of 'node' and of its
+        // right child (the pivot), which are the only nodes whose subtrees
+        // are changed by the rotation.  The behavior is undefined unless
+        // 'node' meets the requirements of 'rotateLeft', 'node' and its
+        // descendants are 'RbTreeCountedNode' objects, and the subtree size
+        // of each of them is accurate.
+
+    static void rotateRightCounted(RbTreeNode *node);
+        // Perform clockwise rotation on the specified 'node' (see
+        // 'rotateRight'), and update the subtree sizes of 'node' and of its
+        // left child (the pivot), which are the only nodes whose subtrees are
+        // changed by the rotation.  The behavior is undefined unless 'node'
+        // meets the requirements of 'rotateRight', 'node' and its descendants
+        // are 'RbTreeCountedNode' objects, and the subtree size of each of
+        // them is accurate.
+
                                  // Testing
 
     static void printTreeStructure(
@@ -1237,6 +1537,320 @@ class RbTreeUtilTreeProctor {
         // Release from management the tree supplied at construction.
 };
 
+                        // ==========================
+                        // class RbTreeUtilChainGuard
+                        // ==========================
+
+class RbTreeUtilChainGuard {
+    // This class implements a guard that, unless 'balance' has been called,
+    // invokes 'RbTreeUtil::balanceChain' on the chain supplied at
+    // construction when the guard is destroyed, so that a chain being built
+    // with 'RbTreeUtil::appendToChain' is left a valid red-black tree if an
+    // exception is thrown.
+
+    // DATA
+    RbTreeAnchor *d_chain_p;  // address of the chain (held, not owned), or 0
+                              // if it has been balanced
+
+  private:
+    // NOT IMPLEMENTED
+    RbTreeUtilChainGuard(const RbTreeUtilChainGuard&);
+    RbTreeUtilChainGuard& operator=(const RbTreeUtilChainGuard&);
+
+  public:
+    // CREATORS
+    explicit RbTreeUtilChainGuard(RbTreeAnchor *chain);
+        // Create a guard object that, unless 'balance' is called, will, on
+        // destruction, balance the specified 'chain'.  The behavior is
+        // undefined unless 'chain' is a chain, or an empty tree, for the
+        // lifetime of this guard (see 'RbTreeUtil::appendToChain').
+
+    ~RbTreeUtilChainGuard();
+        // Unless 'balance' has been called, balance the chain supplied at
+        // construction.
+
+    // MANIPULATORS
+    void balance();
+        // Balance the chain supplied at construction, and release it from
+        // management.  The behavior is undefined if 'balance' has already
+        // been called.
+};
+
+                         // =========================
+                         // struct RbTreeUtil_Subtree
+                         // =========================
+
+struct RbTreeUtil_Subtree {
+    // This component-private 'struct' describes a red-black tree that is not
+    // referred to by an 'RbTreeAnchor' object, as produced and consumed by the
+    // split and join operations used to implement the set operations of
+    // 'RbTreeUtil'.  The root of a non-empty subtree is colored black, and
+    // its parent is unspecified.
+
+    // PUBLIC DATA
+    RbTreeNode *d_root_p;       // root of the subtree, or 0 if it is empty
+
+    int         d_blackHeight;  // number of black nodes on each path from the
+                                // root to a leaf, or 0 if the subtree is empty
+};
+
+                      // ===============================
+                      // struct RbTreeUtil_SetOperations
+                      // ===============================
+
+struct RbTreeUtil_SetOperations {
+    // This component-private 'struct' provides a namespace for the auxiliary
+    // functions used to implement the set operations of 'RbTreeUtil' by
+    // splitting and joining red-black trees described by
+    // 'RbTreeUtil_Subtree' objects.  Unless stated otherwise, the behavior of
+    // each function is undefined unless each supplied subtree is valid (see
+    // 'RbTreeUtil::validateRbTree') and its black height is accurate.
+
+    // TYPES
+    enum {
+        k_MAX_HEIGHT = 128  // exceeds the height of any red-black tree
+                            // having fewer than 2^63 nodes
+    };
+
+    struct KeepEquivalentNodes {
+        // This 'struct' provides the node factory type supplied (as a null
+        // pointer) to 'merge' to indicate that equivalent nodes are kept.
+
+        // MANIPULATORS
+        void deleteNode(RbTreeNode *node);
+            // The behavior is undefined if this method is called.
+    };
+
+    // CLASS METHODS
+    static void attach(RbTreeAnchor       *tree,
+                       RbTreeUtil_Subtree *subtree,
+                       int                 numNodes);
+        // Load into the specified 'tree' the nodes of the specified 'subtree',
+        // holding the specified 'numNodes' nodes, or, if 'numNodes' is
+        // negative, count those nodes, and make 'subtree' empty.  The behavior
+        // is undefined unless 'tree' is empty, and 'numNodes' is negative or
+        // the number of nodes in 'subtree'.
+
+    static int blackHeight(const RbTreeNode *root);
+        // Return the number of black nodes on the path from the specified
+        // 'root' to its leftmost leaf, or 0 if 'root' is 0.
+
+    static void concatenate(RbTreeUtil_Subtree *left,
+                            RbTreeUtil_Subtree *right);
+        // Move into the specified 'left' subtree each node of the specified
+        // 'right' subtree, leaving 'right' empty, in O(log(N)) time.  The
+        // behavior is undefined unless placing the nodes of 'left' before
+        // those of 'right' would form an ordered sequence.
+
+    static int countNodes(const RbTreeNode *root);
+        // Return the number of nodes in the tree rooted at the specified
+        // 'root', or 0 if 'root' is 0.
+
+    static void detach(RbTreeUtil_Subtree *result, RbTreeAnchor *tree);
+        // Load into the specified 'result' the nodes of the specified 'tree',
+        // and make 'tree' empty.  The behavior is undefined unless 'tree' is
+        // well-formed (see 'RbTreeUtil::isWellFormed').
+
+    static void join(RbTreeUtil_Subtree *left,
+                     RbTreeNode         *middleNode,
+                     RbTreeUtil_Subtree *right);
+        // Move into the specified 'left' subtree the specified 'middleNode'
+        // followed by each node of the specified 'right' subtree, leaving
+        // 'right' empty, in time proportional to the difference between the
+        // black heights of 'left' and 'right'.  The behavior is undefined
+        // unless placing the nodes of 'left', then 'middleNode', then the
+        // nodes of 'right' would form an ordered sequence.
+
+    static RbTreeNode *removeFirst(RbTreeUtil_Subtree *tree);
+        // Remove the leftmost node of the specified 'tree' and return its
+        // address.  The behavior is undefined unless 'tree' is not empty.
+
+    static void splitAlongPath(RbTreeUtil_Subtree *left,
+                               RbTreeUtil_Subtree *tree,
+                               const bool         *leftFlags,
+                               int                 length);
+        // Move into the specified 'left' subtree (whose value is ignored) the
+        // nodes of the specified 'tree' ordered before the leaf at the end of
+        // the path from the root of 'tree' described by the specified
+        // 'length' first elements of the specified 'leftFlags', and keep in
+        // 'tree' the nodes ordered after that leaf, where 'leftFlags[i]'
+        // indicates whether the 'i'th node on the path moves to 'left' (and
+        // the path continues to its right child), or stays in 'tree' (and the
+        // path continues to its left child).  The behavior is undefined
+        // unless the path ends with a null child, and
+        // 'length <= k_MAX_HEIGHT'.
+
+    static void splitAtRoot(RbTreeUtil_Subtree *left,
+                            RbTreeUtil_Subtree *tree,
+                            RbTreeUtil_Subtree *right);
+        // Load into the specified 'left' and 'right' subtrees the left and
+        // right subtrees of the root of the specified 'tree', and keep in
+        // 'tree' only its root.  The behavior is undefined unless 'tree' is
+        // not empty.
+
+    template <class NODE_COMPARATOR>
+    static bool areDisjoint(const RbTreeNode& lhsRoot,
+                            const RbTreeNode& rhsRoot,
+                            NODE_COMPARATOR&  comparator);
+        // Return 'true' if each node of the tree rooted at the specified
+        // 'lhsRoot' orders before each node of the tree rooted at the
+        // specified 'rhsRoot', or after each of them, according to the
+        // specified 'comparator', and 'false' otherwise.
+
+    template <class FACTORY>
+    static void deleteSubtree(RbTreeUtil_Subtree *tree,
+                              FACTORY            *nodeFactory,
+                              int                *numDeleted);
+        // Destroy each node of the specified 'tree' using
+        // 'nodeFactory->deleteNode', make 'tree' empty, and add the number of
+        // destroyed nodes to the specified 'numDeleted'.
+
+    template <class NODE_COMPARATOR, class FACTORY>
+    static void intersect(RbTreeUtil_Subtree *tree,
+                          const RbTreeNode   *other,
+                          NODE_COMPARATOR&    comparator,
+                          FACTORY            *nodeFactory,
+                          int                *numDeleted);
+        // Destroy each node of the specified 'tree' that is not equivalent to
+        // a node of the tree rooted at the specified 'other' (if not 0)
+        // according to the specified 'comparator', using
+        // 'nodeFactory->deleteNode', and add the number of destroyed nodes to
+        // the specified 'numDeleted'.  If an exception is thrown, 'tree' is
+        // left a valid subtree.
+
+    template <class NODE_COMPARATOR, class FACTORY>
+    static void merge(RbTreeUtil_Subtree *tree,
+                      RbTreeUtil_Subtree *source,
+                      NODE_COMPARATOR&    comparator,
+                      FACTORY            *nodeFactory,
+                      int                *numDeleted);
+        // Move each node of the specified 'source' subtree into the specified
+        // 'tree', leaving 'source' empty, according to the specified
+        // 'comparator'.  If the specified 'nodeFactory' is not 0, instead
+        // destroy, using 'nodeFactory->deleteNode', each node of 'source'
+        // equivalent to a node of 'tree', and add the number of destroyed
+        // nodes to the specified 'numDeleted'; otherwise, place the nodes of
+        // 'source' after the equivalent nodes of 'tree'.  If an exception is
+        // thrown, 'tree' and 'source' are left valid subtrees, each holding
+        // some of the nodes of either subtree.  The behavior is undefined
+        // unless, if 'nodeFactory' is not 0, neither subtree holds two
+        // equivalent nodes.
+
+    template <class NODE_COMPARATOR>
+    static void split(RbTreeUtil_Subtree *left,
+                      RbTreeUtil_Subtree *tree,
+                      const RbTreeNode&   value,
+                      NODE_COMPARATOR&    comparator,
+                      bool                inclusiveFlag);
+        // Move into the specified 'left' subtree (whose value is ignored) the
+        // nodes of the specified 'tree' ordered before the specified 'value',
+        // or, if the specified 'inclusiveFlag' is 'true', the nodes not
+        // ordered after 'value', according to the specified 'comparator', and
+        // keep the remaining nodes in 'tree'.  If an exception is thrown,
+        // neither subtree is modified.
+
+    template <class NODE_COMPARATOR, class FACTORY>
+    static void subtract(RbTreeUtil_Subtree *tree,
+                         const RbTreeNode   *other,
+                         NODE_COMPARATOR&    comparator,
+                         FACTORY            *nodeFactory,
+                         int                *numDeleted);
+        // Destroy each node of the specified 'tree' that is equivalent to a
+        // node of the tree rooted at the specified 'other' (if not 0)
+        // according to the specified 'comparator', using
+        // 'nodeFactory->deleteNode', and add the number of destroyed nodes to
+        // the specified 'numDeleted'.  If an exception is thrown, 'tree' is
+        // left a valid subtree.
+};
+
+                    // ===================================
+                    // class RbTreeUtil_ConcatenationGuard
+                    // ===================================
+
+class RbTreeUtil_ConcatenationGuard {
+    // This component-private class implements a guard that, unless 'release'
+    // is called, concatenates up to three ordered subtrees into a result
+    // subtree on destruction, so that a tree being split and joined by
+    // 'RbTreeUtil_SetOperations' is reassembled if an exception is thrown.
+
+    // DATA
+    RbTreeUtil_Subtree *d_result_p;  // subtree to load (held, not owned), or
+                                     // 0 if released
+
+    RbTreeUtil_Subtree *d_first_p;   // first subtree (held, not owned)
+
+    RbTreeUtil_Subtree *d_second_p;  // second subtree (held, not owned), or 0
+
+    RbTreeUtil_Subtree *d_third_p;   // third subtree (held, not owned)
+
+  private:
+    // NOT IMPLEMENTED
+    RbTreeUtil_ConcatenationGuard(const RbTreeUtil_ConcatenationGuard&);
+    RbTreeUtil_ConcatenationGuard& operator=(
+                                         const RbTreeUtil_ConcatenationGuard&);
+
+  public:
+    // CREATORS
+    RbTreeUtil_ConcatenationGuard(RbTreeUtil_Subtree *result,
+                                  RbTreeUtil_Subtree *first,
+                                  RbTreeUtil_Subtree *second,
+                                  RbTreeUtil_Subtree *third);
+        // Create a guard object that, unless 'release' is called, will, on
+        // destruction, load into the specified 'result' the nodes of the
+        // specified 'first', 'second' (if not 0), and 'third' subtrees, in
+        // that order.  The behavior is undefined unless, at destruction,
+        // these subtrees are ordered with respect to each other.  Note that
+        // 'result' may be the same object as 'second' or 'third'.
+
+    ~RbTreeUtil_ConcatenationGuard();
+        // Unless 'release' has been called, load into the result subtree
+        // supplied at construction the concatenation of the other subtrees
+        // supplied at construction.
+
+    // MANIPULATORS
+    void release();
+        // Release from management the subtrees supplied at construction.
+};
+
+                        // ============================
+                        // class RbTreeUtil_AttachGuard
+                        // ============================
+
+class RbTreeUtil_AttachGuard {
+    // This component-private class implements a guard that, unless 'attach'
+    // is called, loads a subtree, whose nodes were detached from a tree, back
+    // into that tree on destruction, counting its nodes.
+
+    // DATA
+    RbTreeAnchor       *d_tree_p;     // tree (held, not owned), or 0 if the
+                                      // subtree has been attached
+
+    RbTreeUtil_Subtree *d_subtree_p;  // subtree (held, not owned)
+
+  private:
+    // NOT IMPLEMENTED
+    RbTreeUtil_AttachGuard(const RbTreeUtil_AttachGuard&);
+    RbTreeUtil_AttachGuard& operator=(const RbTreeUtil_AttachGuard&);
+
+  public:
+    // CREATORS
+    RbTreeUtil_AttachGuard(RbTreeAnchor *tree, RbTreeUtil_Subtree *subtree);
+        // Create a guard object that, unless 'attach' is called, will, on
+        // destruction, load the nodes of the specified 'subtree' into the
+        // specified empty 'tree'.
+
+    ~RbTreeUtil_AttachGuard();
+        // Unless 'attach' has been called, load the nodes of the subtree
+        // supplied at construction into the tree supplied at construction.
+
+    // MANIPULATORS
+    void attach(int numNodes);
+        // Load the nodes of the subtree supplied at construction, of which
+        // there are the specified 'numNodes', into the tree supplied at
+        // construction, and release both from management.  The behavior is
+        // undefined if 'attach' has already been called.
+};
+
 // ============================================================================
 //                      INLINE FUNCTION DEFINITIONS
 // ============================================================================
@@ -1673,6 +2287,159 @@ void RbTreeUtil::insert(RbTreeAnchor           *tree,
     return insertAt(tree, parent, leftChildFlag, newNode);
 }
 
+template <class NODE_COMPARATOR, class FACTORY>
+void RbTreeUtil::intersect(RbTreeAnchor        *tree,
+                           const RbTreeAnchor&  other,
+                           NODE_COMPARATOR&     comparator,
+                           FACTORY             *nodeFactory)
+{
+    BSLS_ASSERT_SAFE(tree);
+    BSLS_ASSERT_SAFE(tree != &other);
+    BSLS_ASSERT_SAFE(nodeFactory);
+
+    typedef RbTreeUtil_SetOperations Op;
+
+    if (0 == tree->rootNode()) {
+        return;                                                       // RETURN
+    }
+
+    const int          numNodes = tree->numNodes();
+    int                numDeleted = 0;
+    RbTreeUtil_Subtree subtree;
+
+    Op::detach(&subtree, tree);
+    RbTreeUtil_AttachGuard guard(tree, &subtree);
+
+    Op::intersect(&subtree,
+                  other.rootNode(),
+                  comparator,
+                  nodeFactory,
+                  &numDeleted);
+
+    guard.attach(numNodes - numDeleted);
+}
+
+template <class NODE_COMPARATOR>
+void RbTreeUtil::merge(RbTreeAnchor     *tree,
+                       RbTreeAnchor     *source,
+                       NODE_COMPARATOR&  comparator)
+{
+    BSLS_ASSERT_SAFE(tree);
+    BSLS_ASSERT_SAFE(source);
+    BSLS_ASSERT_SAFE(tree != source);
+
+    typedef RbTreeUtil_SetOperations Op;
+
+    if (0 == source->rootNode()) {
+        return;                                                       // RETURN
+    }
+
+    const int          numNodes = tree->numNodes() + source->numNodes();
+    int                numDeleted = 0;
+    RbTreeUtil_Subtree treeSubtree;
+    RbTreeUtil_Subtree sourceSubtree;
+
+    Op::detach(&treeSubtree, tree);
+    RbTreeUtil_AttachGuard treeGuard(tree, &treeSubtree);
+
+    Op::detach(&sourceSubtree, source);
+    RbTreeUtil_AttachGuard sourceGuard(source, &sourceSubtree);
+
+    Op::merge(&treeSubtree,
+              &sourceSubtree,
+              comparator,
+              static_cast<Op::KeepEquivalentNodes *>(0),
+              &numDeleted);
+
+    sourceGuard.attach(0);
+    treeGuard.attach(numNodes);
+}
+
+template <class NODE_COMPARATOR, class FACTORY>
+void RbTreeUtil::mergeUnion(RbTreeAnchor     *tree,
+                            RbTreeAnchor     *source,
+                            NODE_COMPARATOR&  comparator,
+                            FACTORY          *nodeFactory)
+{
+    BSLS_ASSERT_SAFE(tree);
+    BSLS_ASSERT_SAFE(source);
+    BSLS_ASSERT_SAFE(tree != source);
+    BSLS_ASSERT_SAFE(nodeFactory);
+
+    typedef RbTreeUtil_SetOperations Op;
+
+    if (0 == source->rootNode()) {
+        return;                                                       // RETURN
+    }
+
+    const int          numNodes = tree->numNodes() + source->numNodes();
+    int                numDeleted = 0;
+    RbTreeUtil_Subtree treeSubtree;
+    RbTreeUtil_Subtree sourceSubtree;
+
+    Op::detach(&treeSubtree, tree);
+    RbTreeUtil_AttachGuard treeGuard(tree, &treeSubtree);
+
+    Op::detach(&sourceSubtree, source);
+    RbTreeUtil_AttachGuard sourceGuard(source, &sourceSubtree);
+
+    Op::merge(&treeSubtree,
+              &sourceSubtree,
+              comparator,
+              nodeFactory,
+              &numDeleted);
+
+    sourceGuard.attach(0);
+    treeGuard.attach(numNodes - numDeleted);
+}
+
+template <class NODE_COMPARATOR, class FACTORY>
+void RbTreeUtil::subtract(RbTreeAnchor        *tree,
+                          const RbTreeAnchor&  other,
+                          NODE_COMPARATOR&     comparator,
+                          FACTORY             *nodeFactory)
+{
+    BSLS_ASSERT_SAFE(tree);
+    BSLS_ASSERT_SAFE(tree != &other);
+    BSLS_ASSERT_SAFE(nodeFactory);
+
+    typedef RbTreeUtil_SetOperations Op;
+
+    if (0 == tree->rootNode() || 0 == other.rootNode()) {
+        return;                                                       // RETURN
+    }
+
+    const int          numNodes = tree->numNodes();
+    int                numDeleted = 0;
+    RbTreeUtil_Subtree subtree;
+
+    Op::detach(&subtree, tree);
+    RbTreeUtil_AttachGuard guard(tree, &subtree);
+
+    Op::subtract(&subtree,
+                 other.rootNode(),
+                 comparator,
+                 nodeFactory,
+                 &numDeleted);
+
+    guard.attach(numNodes - numDeleted);
+}
+
+inline
+RbTreeNode *RbTreeUtil::nth(RbTreeAnchor& tree, int index)
+{
+    return const_cast<RbTreeNode *>(
+                           nth(const_cast<const RbTreeAnchor&>(tree), index));
+}
+
+inline
+int RbTreeUtil::subtreeSize(const RbTreeNode *subtree)
+{
+    return subtree
+           ? static_cast<const RbTreeCountedNode *>(subtree)->subtreeSize()
+           : 0;
+}
+
 inline
 bool RbTreeUtil::isLeftChild(const RbTreeNode *node)
 {
@@ -1869,6 +2636,341 @@ void RbTreeUtilTreeProctor<DELETER>::release()
     d_tree_p = 0;
 }
 
+                        // --------------------------
+                        // class RbTreeUtilChainGuard
+                        // --------------------------
+
+// CREATORS
+inline
+RbTreeUtilChainGuard::RbTreeUtilChainGuard(RbTreeAnchor *chain)
+: d_chain_p(chain)
+{
+    BSLS_ASSERT_SAFE(chain);
+}
+
+inline
+RbTreeUtilChainGuard::~RbTreeUtilChainGuard()
+{
+    if (d_chain_p) {
+        RbTreeUtil::balanceChain(d_chain_p);
+    }
+}
+
+// MANIPULATORS
+inline
+void RbTreeUtilChainGuard::balance()
+{
+    BSLS_ASSERT_SAFE(d_chain_p);
+
+    RbTreeUtil::balanceChain(d_chain_p);
+    d_chain_p = 0;
+}
+
+                      // -------------------------------
+                      // struct RbTreeUtil_SetOperations
+                      // -------------------------------
+
+// CLASS METHODS
+template <class NODE_COMPARATOR>
+inline
+bool RbTreeUtil_SetOperations::areDisjoint(const RbTreeNode& lhsRoot,
+                                           const RbTreeNode& rhsRoot,
+                                           NODE_COMPARATOR&  comparator)
+{
+    return comparator(*RbTreeUtil::rightmost(&lhsRoot),
+                      *RbTreeUtil::leftmost(&rhsRoot))
+        || comparator(*RbTreeUtil::rightmost(&rhsRoot),
+                      *RbTreeUtil::leftmost(&lhsRoot));
+}
+
+template <class FACTORY>
+void RbTreeUtil_SetOperations::deleteSubtree(RbTreeUtil_Subtree *tree,
+                                             FACTORY            *nodeFactory,
+                                             int                *numDeleted)
+{
+    BSLS_ASSERT_SAFE(tree);
+    BSLS_ASSERT_SAFE(nodeFactory);
+    BSLS_ASSERT_SAFE(numDeleted);
+
+    if (0 == tree->d_root_p) {
+        return;                                                       // RETURN
+    }
+
+    const int    numNodes = countNodes(tree->d_root_p);
+    RbTreeAnchor anchor;
+
+    attach(&anchor, tree, numNodes);
+    RbTreeUtil::deleteTree(&anchor, nodeFactory);
+    *numDeleted += numNodes;
+}
+
+template <class NODE_COMPARATOR, class FACTORY>
+void RbTreeUtil_SetOperations::intersect(RbTreeUtil_Subtree *tree,
+                                         const RbTreeNode   *other,
+                                         NODE_COMPARATOR&    comparator,
+                                         FACTORY            *nodeFactory,
+                                         int                *numDeleted)
+{
+    BSLS_ASSERT_SAFE(tree);
+
+    if (0 == tree->d_root_p) {
+        return;                                                       // RETURN
+    }
+
+    if (0 == other || areDisjoint(*tree->d_root_p, *other, comparator)) {
+        deleteSubtree(tree, nodeFactory, numDeleted);
+        return;                                                       // RETURN
+    }
+
+    // Split 'tree' into the nodes ordered before, equivalent to, and after
+    // the root of 'other', and intersect the first and last of these with
+    // the left and right subtrees of 'other', respectively.
+
+    RbTreeUtil_Subtree lower;
+    RbTreeUtil_Subtree equivalent = { 0, 0 };
+
+    split(&lower, tree, *other, comparator, false);
+
+    RbTreeUtil_ConcatenationGuard guard(tree, &lower, &equivalent, tree);
+
+    split(&equivalent, tree, *other, comparator, true);
+
+    intersect(&lower, other->leftChild(), comparator, nodeFactory, numDeleted);
+    intersect(tree, other->rightChild(), comparator, nodeFactory, numDeleted);
+
+    guard.release();
+
+    concatenate(&equivalent, tree);
+    concatenate(&lower, &equivalent);
+    *tree = lower;
+}
+
+template <class NODE_COMPARATOR, class FACTORY>
+void RbTreeUtil_SetOperations::merge(RbTreeUtil_Subtree *tree,
+                                     RbTreeUtil_Subtree *source,
+                                     NODE_COMPARATOR&    comparator,
+                                     FACTORY            *nodeFactory,
+                                     int                *numDeleted)
+{
+    BSLS_ASSERT_SAFE(tree);
+    BSLS_ASSERT_SAFE(source);
+
+    if (0 == source->d_root_p) {
+        return;                                                       // RETURN
+    }
+
+    if (0 == tree->d_root_p) {
+        *tree = *source;
+        source->d_root_p      = 0;
+        source->d_blackHeight = 0;
+        return;                                                       // RETURN
+    }
+
+    // If the nodes of one subtree all order before those of the other (where,
+    // unless equivalent nodes are destroyed, the nodes of 'source' may be
+    // equivalent to the last node of 'tree'), concatenate the two subtrees.
+
+    const RbTreeNode& treeFirst   = *RbTreeUtil::leftmost(tree->d_root_p);
+    const RbTreeNode& treeLast    = *RbTreeUtil::rightmost(tree->d_root_p);
+    const RbTreeNode& sourceFirst = *RbTreeUtil::leftmost(source->d_root_p);
+    const RbTreeNode& sourceLast  = *RbTreeUtil::rightmost(source->d_root_p);
+
+    if (nodeFactory ? comparator(treeLast, sourceFirst)
+                    : !comparator(sourceFirst, treeLast)) {
+        concatenate(tree, source);
+        return;                                                       // RETURN
+    }
+
+    if (comparator(sourceLast, treeFirst)) {
+        concatenate(source, tree);
+        *tree = *source;
+        source->d_root_p      = 0;
+        source->d_blackHeight = 0;
+        return;                                                       // RETURN
+    }
+
+    // Otherwise, split 'source' around the root of 'tree', and merge the
+    // resulting subtrees into the left and right subtrees of that root.  Note
+    // that 'source' is split before 'tree' is modified, and that an exception
+    // thrown by 'comparator' after that point leaves the parts of each
+    // subtree to be reassembled by the guards.
+
+    RbTreeNode         *middleNode = tree->d_root_p;
+    RbTreeUtil_Subtree  lowerSource;
+    RbTreeUtil_Subtree  lowerTree;
+    RbTreeUtil_Subtree  upperTree;
+
+    split(&lowerSource, source, *middleNode, comparator, false);
+    splitAtRoot(&lowerTree, tree, &upperTree);
+
+    RbTreeUtil_ConcatenationGuard treeGuard(tree,
+                                            &lowerTree,
+                                            tree,
+                                            &upperTree);
+    RbTreeUtil_ConcatenationGuard sourceGuard(source,
+                                              &lowerSource,
+                                              0,
+                                              source);
+
+    if (nodeFactory
+     && source->d_root_p
+     && !comparator(*middleNode, *RbTreeUtil::leftmost(source->d_root_p))) {
+        nodeFactory->deleteNode(removeFirst(source));
+        ++*numDeleted;
+    }
+
+    merge(&lowerTree, &lowerSource, comparator, nodeFactory, numDeleted);
+    merge(&upperTree, source, comparator, nodeFactory, numDeleted);
+
+    sourceGuard.release();
+    treeGuard.release();
+
+    join(&lowerTree, middleNode, &upperTree);
+    *tree = lowerTree;
+}
+
+template <class NODE_COMPARATOR>
+void RbTreeUtil_SetOperations::split(RbTreeUtil_Subtree *left,
+                                     RbTreeUtil_Subtree *tree,
+                                     const RbTreeNode&   value,
+                                     NODE_COMPARATOR&    comparator,
+                                     bool                inclusiveFlag)
+{
+    BSLS_ASSERT_SAFE(left);
+    BSLS_ASSERT_SAFE(tree);
+
+    // Record the path to the leaf at which 'value' would be inserted before
+    // modifying 'tree', so that an exception thrown by 'comparator' leaves
+    // 'tree' unchanged.
+
+    bool leftFlags[k_MAX_HEIGHT];
+    int  length = 0;
+
+    const RbTreeNode *node = tree->d_root_p;
+    while (node) {
+        BSLS_ASSERT(length < k_MAX_HEIGHT);
+
+        const bool leftFlag = inclusiveFlag ? !comparator(value, *node)
+                                            : comparator(*node, value);
+        leftFlags[length++] = leftFlag;
+        node = leftFlag ? node->rightChild() : node->leftChild();
+    }
+
+    splitAlongPath(left, tree, leftFlags, length);
+}
+
+template <class NODE_COMPARATOR, class FACTORY>
+void RbTreeUtil_SetOperations::subtract(RbTreeUtil_Subtree *tree,
+                                        const RbTreeNode   *other,
+                                        NODE_COMPARATOR&    comparator,
+                                        FACTORY            *nodeFactory,
+                                        int                *numDeleted)
+{
+    BSLS_ASSERT_SAFE(tree);
+
+    if (0 == tree->d_root_p
+     || 0 == other
+     || areDisjoint(*tree->d_root_p, *other, comparator)) {
+        return;                                                       // RETURN
+    }
+
+    // Split 'tree' into the nodes ordered before, equivalent to, and after
+    // the root of 'other', destroy the second of these, and subtract the left
+    // and right subtrees of 'other' from the first and last, respectively.
+
+    RbTreeUtil_Subtree lower;
+    RbTreeUtil_Subtree equivalent;
+
+    split(&lower, tree, *other, comparator, false);
+
+    RbTreeUtil_ConcatenationGuard guard(tree, &lower, 0, tree);
+
+    split(&equivalent, tree, *other, comparator, true);
+    deleteSubtree(&equivalent, nodeFactory, numDeleted);
+
+    subtract(&lower, other->leftChild(), comparator, nodeFactory, numDeleted);
+    subtract(tree, other->rightChild(), comparator, nodeFactory, numDeleted);
+
+    guard.release();
+
+    concatenate(&lower, tree);
+    *tree = lower;
+}
+
+                    // -----------------------------------
+                    // class RbTreeUtil_ConcatenationGuard
+                    // -----------------------------------
+
+// CREATORS
+inline
+RbTreeUtil_ConcatenationGuard::RbTreeUtil_ConcatenationGuard(
+                                                RbTreeUtil_Subtree *result,
+                                                RbTreeUtil_Subtree *first,
+                                                RbTreeUtil_Subtree *second,
+                                                RbTreeUtil_Subtree *third)
+: d_result_p(result)
+, d_first_p(first)
+, d_second_p(second)
+, d_third_p(third)
+{
+    BSLS_ASSERT_SAFE(result);
+    BSLS_ASSERT_SAFE(first);
+    BSLS_ASSERT_SAFE(third);
+}
+
+inline
+RbTreeUtil_ConcatenationGuard::~RbTreeUtil_ConcatenationGuard()
+{
+    if (d_result_p) {
+        if (d_second_p) {
+            RbTreeUtil_SetOperations::concatenate(d_first_p, d_second_p);
+        }
+        RbTreeUtil_SetOperations::concatenate(d_first_p, d_third_p);
+        *d_result_p = *d_first_p;
+    }
+}
+
+// MANIPULATORS
+inline
+void RbTreeUtil_ConcatenationGuard::release()
+{
+    d_result_p = 0;
+}
+
+                        // ----------------------------
+                        // class RbTreeUtil_AttachGuard
+                        // ----------------------------
+
+// CREATORS
+inline
+RbTreeUtil_AttachGuard::RbTreeUtil_AttachGuard(RbTreeAnchor       *tree,
+                                               RbTreeUtil_Subtree *subtree)
+: d_tree_p(tree)
+, d_subtree_p(subtree)
+{
+    BSLS_ASSERT_SAFE(tree);
+    BSLS_ASSERT_SAFE(subtree);
+}
+
+inline
+RbTreeUtil_AttachGuard::~RbTreeUtil_AttachGuard()
+{
+    if (d_tree_p) {
+        RbTreeUtil_SetOperations::attach(d_tree_p, d_subtree_p, -1);
+    }
+}
+
+// MANIPULATORS
+inline
+void RbTreeUtil_AttachGuard::attach(int numNodes)
+{
+    BSLS_ASSERT_SAFE(d_tree_p);
+    BSLS_ASSERT_SAFE(0 <= numNodes);
+
+    RbTreeUtil_SetOperations::attach(d_tree_p, d_subtree_p, numNodes);
+    d_tree_p = 0;
+}
+
 }  // close namespace bslalg
 }  // close enterprise namespace
 
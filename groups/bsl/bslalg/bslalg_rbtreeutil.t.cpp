@@ -65,6 +65,8 @@ using namespace bslalg;
 // [12] const RbTreeNode *upperBound(const Anchor&, const COMP&, const VALUE&);
 // [12]       RbTreeNode *upperBound(Anchor&, const COMP&, const VALUE&);
 // Modification
+// [26] void appendToChain(RbTreeAnchor *, RbTreeNode *, RbTreeNode *);
+// [26] void balanceChain(RbTreeAnchor *);
 // [20] void copyTree(RbTreeAnchor *, const RbTreeAnchor& , FACTORY *);
 // [19] void deleteTree(RbTreeAnchor *, FACTORY *);
 // [14] RbTreeNode *findInsertLocation(bool*,Anchor*,COMP&,const VALUE&);
@@ -73,21 +75,41 @@ using namespace bslalg;
 // [16] RbTreeNode *findUniqueInsertLocation(int *,Anchor*,COMP&,VALUE&,Node*);
 // [ 9] void insert(RbTreeAnchor *, const COMP& , RbTreeNode *);
 // [17] void insertAt(RbTreeAnchor *,RbTreeNode *, bool, RbTreeNode *);
+// [27] void intersect(RbTreeAnchor *, const RbTreeAnchor&, COMP&, FACT *);
+// [27] void join(RbTreeAnchor *, RbTreeNode *, RbTreeAnchor *);
+// [27] void merge(RbTreeAnchor *, RbTreeAnchor *, COMP&);
+// [27] void mergeUnion(RbTreeAnchor *, RbTreeAnchor *, COMP&, FACTORY *);
 // [18] void remove(RbTreeAnchor *, RbTreeNode *);
+// [27] void subtract(RbTreeAnchor *, const RbTreeAnchor&, COMP&, FACT *);
 // [21] void swap(RbTreeAnchor *, RbTreeAnchor *);
+// Order Statistics
+// [28] void insertAtCounted(Anchor *, RbTreeNode *, bool, RbTreeNode *);
+// [28] const RbTreeNode *nth(const RbTreeAnchor&, int);
+// [28]       RbTreeNode *nth(RbTreeAnchor&, int);
+// [28] int rank(const RbTreeAnchor&, const RbTreeNode *);
+// [28] void removeCounted(RbTreeAnchor *, RbTreeNode *);
+// [28] int subtreeSize(const RbTreeNode *);
+// [28] void updateSubtreeSizes(RbTreeAnchor *);
 // [22] bool isLeftChild(const RbTreeNode *);
 // [22] bool isRightChild(const RbTreeNode *);
 // [23] void rotateLeft(RbTreeNode *);
 // [23] void rotateRight(RbTreeNode *);
+// [28] void rotateLeftCounted(RbTreeNode *);
+// [28] void rotateRightCounted(RbTreeNode *);
 // Testing
 // [24] void printTreeStructure(FILE *, const Node *, Callback, int, int);
 // [ 7] int validateRbTree(const RbTreeNode *, const COMP& );
 // [ 7] int validateRbTree(const RbTreeNode **, const char **, Node *, COMP&);
 // [ 8] bool isWellFormed(const RbTreeAnchor& ,const COMPR& );
 // [ 2] Validator::isWellFormedAnchor(const RbTreeAnchor& ,const COMPR& );
+//
+// RbTreeUtilChainGuard
+// [26] RbTreeUtilChainGuard(RbTreeAnchor *);
+// [26] ~RbTreeUtilChainGuard();
+// [26] void balance();
 //-----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [26] USAGE EXAMPLE
+// [29] USAGE EXAMPLE
 // [ 3] CONCERN: gg Generator
 // [25] CONCERN: Additional verification of exception safety of 'copyTree'
 
@@ -716,6 +738,521 @@ int countNodes(RbTreeNode *node)
     return 1 + countNodes(node->leftChild()) + countNodes(node->rightChild());
 }
 
+int treeHeight(const RbTreeNode *node)
+    // Return the number of nodes on the longest path from the specified
+    // 'node' to a leaf, or 0 if 'node' is 0.
+{
+    if (0 == node) {
+        return 0;
+    }
+    const int leftHeight  = treeHeight(node->leftChild());
+    const int rightHeight = treeHeight(node->rightChild());
+    return 1 + (leftHeight < rightHeight ? rightHeight : leftHeight);
+}
+
+                      // ===============================
+                      // class CountingIntNodeComparator
+                      // ===============================
+
+class CountingIntNodeComparator {
+    // This class provides a comparison functor for 'IntNode' objects that
+    // counts the comparisons it performs, and, if a limit is supplied at
+    // construction, throws an exception of type 'int' instead of performing
+    // a comparison once that many comparisons have been performed.
+
+    // DATA
+    mutable int d_numComparisons;  // number of comparisons performed
+    int         d_limit;           // limit, or negative for no limit
+
+  public:
+    // CREATORS
+    explicit CountingIntNodeComparator(int limit = -1)
+        // Create a comparator that, if the optionally specified 'limit' is
+        // not negative, throws once 'limit' comparisons have been performed.
+    : d_numComparisons(0)
+    , d_limit(limit)
+    {
+    }
+
+    // ACCESSORS
+    bool operator()(const RbTreeNode& lhs, const RbTreeNode& rhs) const
+        // Return 'true' if the integer value in the specified 'lhs' node is
+        // less than that of the specified 'rhs' node.
+    {
+        if (d_numComparisons == d_limit) {
+#ifdef BDE_BUILD_TARGET_EXC
+            throw d_limit;
+#endif
+        }
+        ++d_numComparisons;
+        return static_cast<const IntNode&>(lhs).value() <
+               static_cast<const IntNode&>(rhs).value();
+    }
+
+    int numComparisons() const { return d_numComparisons; }
+        // Return the number of comparisons performed by this object.
+};
+
+                           // ====================
+                           // class IntNodeDeleter
+                           // ====================
+
+class IntNodeDeleter {
+    // This class provides a node factory for 'IntNode' objects holding
+    // non-negative values, which counts the nodes it deletes and marks each
+    // of them by setting its value to -1.
+
+    // DATA
+    int d_numDeleted;  // number of deleted nodes
+
+  public:
+    // CREATORS
+    IntNodeDeleter() : d_numDeleted(0) {}
+        // Create a deleter that has deleted no nodes.
+
+    // MANIPULATORS
+    void deleteNode(RbTreeNode *node)
+        // Mark the specified 'node' as deleted.
+    {
+        IntNode *intNode = static_cast<IntNode *>(node);
+        ASSERTV(intNode->value(), 0 <= intNode->value());
+        intNode->value() = -1;
+        ++d_numDeleted;
+    }
+
+    // ACCESSORS
+    int numDeleted() const { return d_numDeleted; }
+        // Return the number of nodes deleted by this object.
+};
+
+int intValue(const RbTreeNode *node)
+    // Return the value of the specified 'node', which must be an 'IntNode'.
+{
+    return static_cast<const IntNode *>(node)->value();
+}
+
+int collectNodes(const RbTreeNode **result, const RbTreeAnchor& tree)
+    // Load, into the specified 'result' array, the addresses of the nodes of
+    // the specified 'tree' in order, and return their number.
+{
+    int numNodes = 0;
+    for (const RbTreeNode *node = tree.firstNode();
+         tree.sentinel() != node;
+         node = Obj::next(node)) {
+        result[numNodes++] = node;
+    }
+    return numNodes;
+}
+
+unsigned nextRandom(unsigned *seed)
+    // Advance the specified 'seed' of a linear congruential generator, and
+    // return a pseudo-random number in the range '[0 .. 32767]'.
+{
+    *seed = *seed * 1103515245 + 12345;
+    return (*seed >> 16) & 0x7fff;
+}
+
+void buildIntTree(RbTreeAnchor *tree,
+                  IntNode      *nodes,
+                  const int    *values,
+                  int           numValues,
+                  unsigned     *seed)
+    // Load the specified 'numValues' 'values' into the first 'numValues'
+    // elements of the specified 'nodes', and insert these nodes into the
+    // specified empty 'tree', in an order determined by the specified 'seed',
+    // so as to vary the shape of the resulting tree.
+{
+    for (int i = 0; i < numValues; ++i) {
+        nodes[i].value() = values[i];
+    }
+
+    // Insert the nodes taken at random from either end of the array.
+
+    IntNodeComparator comparator;
+    int               first = 0;
+    int               last  = numValues;
+    while (first < last) {
+        if (nextRandom(seed) & 1) {
+            Obj::insert(tree, comparator, &nodes[first++]);
+        }
+        else {
+            Obj::insert(tree, comparator, &nodes[--last]);
+        }
+    }
+}
+
+int generateValues(int      *values,
+                   int       firstValue,
+                   int       numKeys,
+                   int       percent,
+                   int       maxCount,
+                   unsigned *seed)
+    // Load into the specified 'values' array, in increasing order, each of
+    // the specified 'numKeys' values starting at the specified 'firstValue'
+    // with the specified 'percent' probability, each selected value
+    // appearing from 1 to the specified 'maxCount' times, using the specified
+    // 'seed', and return the number of loaded values.
+{
+    int numValues = 0;
+    for (int key = firstValue; key < firstValue + numKeys; ++key) {
+        if (static_cast<int>(nextRandom(seed) % 100) < percent) {
+            const int count = 1
+                            + static_cast<int>(nextRandom(seed)) % maxCount;
+            for (int i = 0; i < count; ++i) {
+                values[numValues++] = key;
+            }
+        }
+    }
+    return numValues;
+}
+
+enum SetOperation {
+    // Enumerate the set operations of 'RbTreeUtil'.
+
+    e_MERGE_UNION,
+    e_MERGE,
+    e_INTERSECT,
+    e_SUBTRACT
+};
+
+int expectedSetOperationResult(const RbTreeNode        **result,
+                               SetOperation              operation,
+                               const RbTreeNode *const  *lhs,
+                               int                       numLhs,
+                               const RbTreeNode *const  *rhs,
+                               int                       numRhs)
+    // Load, into the specified 'result' array, the ordered sequence of nodes
+    // expected to be held by the tree after applying the specified
+    // 'operation' to the trees holding the specified ordered sequences 'lhs'
+    // and 'rhs', of the specified 'numLhs' and 'numRhs' nodes, and return
+    // the number of loaded nodes.
+{
+    int numResult = 0;
+    int i = 0;
+    int j = 0;
+    while (i < numLhs || j < numRhs) {
+        if (j == numRhs
+         || (i < numLhs && intValue(lhs[i]) < intValue(rhs[j]))) {
+            // 'lhs[i]' is not equivalent to any remaining node of 'rhs'.
+
+            if (e_INTERSECT != operation) {
+                result[numResult++] = lhs[i];
+            }
+            ++i;
+        }
+        else if (i == numLhs || intValue(rhs[j]) < intValue(lhs[i])) {
+            // 'rhs[j]' is not equivalent to any remaining node of 'lhs'.
+
+            if (e_MERGE_UNION == operation || e_MERGE == operation) {
+                result[numResult++] = rhs[j];
+            }
+            ++j;
+        }
+        else {
+            // 'lhs[i]' and 'rhs[j]' are equivalent: take all the equivalent
+            // nodes of 'lhs' then, for 'merge', those of 'rhs'.
+
+            const int value = intValue(lhs[i]);
+            while (i < numLhs && value == intValue(lhs[i])) {
+                if (e_SUBTRACT != operation) {
+                    result[numResult++] = lhs[i];
+                }
+                ++i;
+            }
+            while (j < numRhs && value == intValue(rhs[j])) {
+                if (e_MERGE == operation) {
+                    result[numResult++] = rhs[j];
+                }
+                ++j;
+            }
+        }
+    }
+    return numResult;
+}
+
+bool testSetOperation(SetOperation  operation,
+                      const int    *lhsValues,
+                      int           numLhs,
+                      const int    *rhsValues,
+                      int           numRhs,
+                      unsigned      seed,
+                      int           limit = -1,
+                      int          *numComparisons = 0)
+    // Apply the specified 'operation' to trees built, in an order determined
+    // by the specified 'seed', from the specified 'numLhs' 'lhsValues' and
+    // 'numRhs' 'rhsValues', using a comparator that throws once the
+    // specified 'limit' comparisons have been performed (if 'limit' is not
+    // negative), and verify the resulting trees.  Return 'true' if the
+    // operation completed, and 'false' if an exception was thrown.
+    // Optionally specify 'numComparisons' in which to load the number of
+    // comparisons performed.
+{
+    bslma::TestAllocator ta(veryVeryVeryVerbose);
+
+    Array<IntNode>            lhsNodes(&ta);
+    Array<IntNode>            rhsNodes(&ta);
+    Array<const RbTreeNode *> lhsSequence(&ta);
+    Array<const RbTreeNode *> rhsSequence(&ta);
+    Array<const RbTreeNode *> expected(&ta);
+    Array<const RbTreeNode *> actual(&ta);
+    Array<int>                numOccurrences(&ta);
+
+    lhsNodes.reset(numLhs);
+    rhsNodes.reset(numRhs);
+    lhsSequence.reset(numLhs + 1);
+    rhsSequence.reset(numRhs + 1);
+    expected.reset(numLhs + numRhs + 1);
+    actual.reset(numLhs + numRhs + 1);
+    numOccurrences.reset(numLhs + numRhs + 1);
+
+    RbTreeAnchor lhs;
+    RbTreeAnchor rhs;
+    buildIntTree(&lhs, lhsNodes.data(), lhsValues, numLhs, &seed);
+    buildIntTree(&rhs, rhsNodes.data(), rhsValues, numRhs, &seed);
+
+    collectNodes(lhsSequence.data(), lhs);
+    collectNodes(rhsSequence.data(), rhs);
+
+    const int NUM_EXPECTED = expectedSetOperationResult(expected.data(),
+                                                        operation,
+                                                        lhsSequence.data(),
+                                                        numLhs,
+                                                        rhsSequence.data(),
+                                                        numRhs);
+
+    IntNodeComparator         nodeComparator;
+    CountingIntNodeComparator comparator(limit);
+    IntNodeDeleter            deleter;
+
+    bool completedFlag = true;
+#ifdef BDE_BUILD_TARGET_EXC
+    try
+#endif
+    {
+        switch (operation) {
+          case e_MERGE_UNION: {
+            Obj::mergeUnion(&lhs, &rhs, comparator, &deleter);
+          } break;
+          case e_MERGE: {
+            Obj::merge(&lhs, &rhs, comparator);
+          } break;
+          case e_INTERSECT: {
+            Obj::intersect(&lhs, rhs, comparator, &deleter);
+          } break;
+          case e_SUBTRACT: {
+            Obj::subtract(&lhs, rhs, comparator, &deleter);
+          } break;
+        }
+    }
+#ifdef BDE_BUILD_TARGET_EXC
+    catch (int) {
+        completedFlag = false;
+    }
+#endif
+    if (numComparisons) {
+        *numComparisons = comparator.numComparisons();
+    }
+
+    // Both trees are well-formed, whether or not an exception was thrown.
+
+    ASSERTV(operation, Obj::isWellFormed(lhs, nodeComparator));
+    ASSERTV(operation, Obj::isWellFormed(rhs, nodeComparator));
+
+    // Each node is held by exactly one tree, or has been deleted.
+
+    for (int i = 0; i < numLhs + numRhs; ++i) {
+        numOccurrences[i] = 0;
+    }
+    const RbTreeAnchor *TREES[] = { &lhs, &rhs };
+    for (int t = 0; t < 2; ++t) {
+        const int NUM_NODES = collectNodes(actual.data(), *TREES[t]);
+        for (int i = 0; i < NUM_NODES; ++i) {
+            const IntNode *node = static_cast<const IntNode *>(actual[i]);
+            const int      index =
+                          lhsNodes.data() <= node
+                                       && node < lhsNodes.data() + numLhs
+                          ? static_cast<int>(node - lhsNodes.data())
+                          : numLhs + static_cast<int>(node - rhsNodes.data());
+            ASSERTV(operation, i, 0 <= index && index < numLhs + numRhs);
+            ASSERTV(operation, i, 0 <= node->value());
+            ++numOccurrences[index];
+        }
+    }
+    int numDeleted = 0;
+    for (int i = 0; i < numLhs + numRhs; ++i) {
+        const IntNode& node = i < numLhs ? lhsNodes[i] : rhsNodes[i - numLhs];
+        if (-1 == node.value()) {
+            ++numDeleted;
+            ASSERTV(operation, i, 0 == numOccurrences[i]);
+        }
+        else {
+            ASSERTV(operation, i, 1 == numOccurrences[i]);
+        }
+    }
+    ASSERTV(operation, numDeleted == deleter.numDeleted());
+
+    if (e_INTERSECT == operation || e_SUBTRACT == operation) {
+        // 'rhs' is not modified, and every node of 'lhs' in the expected
+        // result is kept.
+
+        ASSERTV(operation, numRhs == collectNodes(actual.data(), rhs));
+        for (int i = 0; i < numRhs; ++i) {
+            ASSERTV(operation, i, rhsSequence[i] == actual[i]);
+        }
+        for (int i = 0; i < NUM_EXPECTED; ++i) {
+            ASSERTV(operation, i, 0 <= intValue(expected[i]));
+        }
+    }
+    else {
+        // 'lhs' still holds all of its original nodes.
+
+        const int NUM_NODES   = collectNodes(actual.data(), lhs);
+        int       numOriginal = 0;
+        for (int i = 0; i < NUM_NODES; ++i) {
+            const IntNode *node = static_cast<const IntNode *>(actual[i]);
+            if (lhsNodes.data() <= node && node < lhsNodes.data() + numLhs) {
+                ++numOriginal;
+            }
+        }
+        ASSERTV(operation, numOriginal, numLhs == numOriginal);
+    }
+
+    if (e_MERGE_UNION == operation) {
+        // Neither tree holds equivalent nodes.
+
+        for (int t = 0; t < 2; ++t) {
+            const int NUM_NODES = collectNodes(actual.data(), *TREES[t]);
+            for (int i = 1; i < NUM_NODES; ++i) {
+                ASSERTV(operation, t, i,
+                        intValue(actual[i - 1]) < intValue(actual[i]));
+            }
+        }
+    }
+
+    if (completedFlag) {
+        // The tree holds the expected nodes in the expected order.
+
+        ASSERTV(operation, NUM_EXPECTED, lhs.numNodes(),
+                NUM_EXPECTED == lhs.numNodes());
+        ASSERTV(operation, NUM_EXPECTED == collectNodes(actual.data(), lhs));
+        for (int i = 0; i < NUM_EXPECTED && i < lhs.numNodes(); ++i) {
+            ASSERTV(operation, i, expected[i] == actual[i]);
+        }
+        if (e_MERGE_UNION == operation || e_MERGE == operation) {
+            ASSERTV(operation, 0 == rhs.rootNode());
+            ASSERTV(operation, 0 == rhs.numNodes());
+        }
+    }
+    return completedFlag;
+}
+
+class CountedIntNode : public RbTreeCountedNode {
+    // A trivial node type holding an integer payload and the size of its
+    // subtree.
+
+    // DATA
+    int d_value;
+
+  public:
+    // MANIPULATORS
+    int& value() { return d_value; }
+        // Return a reference providing modifiable access to the 'value' of
+        // this object.
+
+    // ACCESSORS
+    const int& value() const { return d_value; }
+        // Return a reference providing non-modifiable access to the 'value'
+        // of this object.
+};
+
+struct CountedIntNodeComparator {
+    // A 'RbTreeUtil' complaint node comparison functor for 'CountedIntNode'
+    // objects.
+
+    bool operator()(const RbTreeNode& lhs, const RbTreeNode& rhs) const {
+        // Return 'true' if the integer value in the specified 'lhs' node is
+        // less than that of the specified 'rhs' node.
+
+        return static_cast<const CountedIntNode&>(lhs).value() <
+               static_cast<const CountedIntNode&>(rhs).value();
+    }
+};
+
+struct CountedIntNodeValueComparator {
+    // A 'RbTreeUtil' complaint node-value comparison functor for
+    // 'CountedIntNode' objects.
+
+    bool operator()(const RbTreeNode& node, int value) const {
+        // Return 'true' if the integer value in the specified 'node' is less
+        // than the specified 'value'.
+
+        return static_cast<const CountedIntNode&>(node).value() < value;
+    }
+
+    bool operator()(int value, const RbTreeNode& node) const {
+        // Return 'true' if the specified 'value' is less than the integer
+        // value in the specified 'node'.
+
+        return value < static_cast<const CountedIntNode&>(node).value();
+    }
+};
+
+int verifySubtreeSizes(const RbTreeNode *subtree)
+    // Return the number of nodes in the specified 'subtree' if the subtree
+    // size recorded by each of its nodes is accurate, and a negative value
+    // otherwise.  The behavior is undefined unless each node of 'subtree' is
+    // a 'CountedIntNode' object.
+{
+    if (!subtree) {
+        return 0;                                                     // RETURN
+    }
+    const int numLeft  = verifySubtreeSizes(subtree->leftChild());
+    const int numRight = verifySubtreeSizes(subtree->rightChild());
+    if (numLeft < 0 || numRight < 0) {
+        return -1;                                                    // RETURN
+    }
+    const int numNodes = numLeft + numRight + 1;
+    return numNodes ==
+                 static_cast<const RbTreeCountedNode *>(subtree)->subtreeSize()
+           ? numNodes
+           : -1;
+}
+
+void verifyOrderStatistics(const RbTreeAnchor& tree, int line)
+    // Verify that the specified 'tree' is well-formed, that the subtree size
+    // recorded by each of its nodes is accurate, and that 'nth' and 'rank'
+    // are consistent with an in-order traversal of 'tree', reporting any
+    // failure with the specified 'line'.  The behavior is undefined unless
+    // each node of 'tree' is a 'CountedIntNode' object.
+{
+    ASSERTV(line, Obj::isWellFormed(tree, CountedIntNodeComparator()));
+    ASSERTV(line, tree.numNodes(), verifySubtreeSizes(tree.rootNode()),
+            tree.numNodes() == verifySubtreeSizes(tree.rootNode()));
+
+    int index = 0;
+    for (const RbTreeNode *node = tree.firstNode();
+         tree.sentinel() != node;
+         node = Obj::next(node), ++index) {
+        ASSERTV(line, index, node == Obj::nth(tree, index));
+        ASSERTV(line, index, index == Obj::rank(tree, node));
+    }
+    ASSERTV(line, tree.numNodes() == index);
+    ASSERTV(line, tree.sentinel() == Obj::nth(tree, index));
+    ASSERTV(line, index == Obj::rank(tree, tree.sentinel()));
+}
+
+void shuffleValues(int *values, int numValues, unsigned *seed)
+    // Arrange the specified 'numValues' elements of the specified 'values'
+    // array in a pseudo-random order determined by the specified 'seed'.
+{
+    for (int i = numValues - 1; 0 < i; --i) {
+        const int j = static_cast<int>(nextRandom(seed) % (i + 1));
+        const int tmp = values[i];
+        values[i] = values[j];
+        values[j] = tmp;
+    }
+}
+
 
 class RbTreeNodeRangeIterator {
     // This class provides a trivial iterator to simplify the process of
@@ -5703,7 +6240,7 @@ int main(int argc, char *argv[])
     printf("TEST " __FILE__ " CASE %d\n", test);
 
     switch (test) { case 0:
-      case 26: {
+      case 29: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //
@@ -5779,6 +6316,973 @@ int main(int argc, char *argv[])
               }
           }
       } break;
+      case 28: {
+        // --------------------------------------------------------------------
+        // CLASS METHODS: insertAtCounted, removeCounted, nth, rank
+        //
+        // Concerns:
+        //: 1 'insertAtCounted' and 'removeCounted' insert and remove nodes as
+        //:   'insertAt' and 'remove' do, leaving a well-formed, valid
+        //:   red-black tree, and keep the subtree size of each node accurate,
+        //:   for any shape of tree and any position of the affected node.
+        //:
+        //: 2 'nth' returns the node at each in-order position of a tree, and
+        //:   the sentinel for the position following the last node.
+        //:
+        //: 3 'rank' returns the in-order position of each node of a tree, and
+        //:   the number of nodes in the tree for the sentinel.
+        //:
+        //: 4 'rotateLeftCounted' and 'rotateRightCounted' rotate a node as
+        //:   'rotateLeft' and 'rotateRight' do, and keep the subtree size of
+        //:   each node accurate.
+        //:
+        //: 5 'updateSubtreeSizes' sets the subtree size of each node of a
+        //:   tree built by an operation that does not maintain them.
+        //:
+        //: 6 'subtreeSize' returns 0 for a null subtree, and the recorded
+        //:   subtree size otherwise.
+        //:
+        //: 7 The operations on trees of 'RbTreeNode' objects ('insertAt',
+        //:   'remove', 'rotateLeft', and 'rotateRight') do not modify the
+        //:   subtree size of a 'RbTreeCountedNode'.
+        //:
+        //: 8 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For each number of nodes up to 64, and several seeds, insert the
+        //:   nodes into a tree in a pseudo-random order using
+        //:   'insertAtCounted', and then remove them in another pseudo-random
+        //:   order using 'removeCounted'.  After each operation verify that
+        //:   the tree is well-formed, that the subtree size of each node is
+        //:   accurate, and that 'nth' and 'rank' agree with an in-order
+        //:   traversal of the tree for every position.  (C-1..3, 6)
+        //:
+        //: 2 For a number of trees, rotate each node having a right child to
+        //:   the left using 'rotateLeftCounted', and then back to the right
+        //:   using 'rotateRightCounted', verifying the subtree sizes after
+        //:   each rotation, and that the original shape of the tree is
+        //:   restored.  (C-4)
+        //:
+        //: 3 For each number of nodes up to 64, build a tree using
+        //:   'appendToChain' and 'balanceChain', set the subtree size of each
+        //:   node to an arbitrary value, call 'updateSubtreeSizes', and verify
+        //:   the subtree sizes.  (C-5)
+        //:
+        //: 4 Set the subtree size of each of a sequence of 'CountedIntNode'
+        //:   objects to a marker value, insert the nodes into a tree, rotate
+        //:   them, and remove them, using the operations for trees of
+        //:   'RbTreeNode' objects, and verify that the marker values are
+        //:   unchanged.  (C-7)
+        //:
+        //: 5 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-8)
+        //
+        // Testing:
+        //   void insertAtCounted(Anchor *, RbTreeNode *, bool, RbTreeNode *);
+        //   const RbTreeNode *nth(const RbTreeAnchor&, int);
+        //         RbTreeNode *nth(RbTreeAnchor&, int);
+        //   int rank(const RbTreeAnchor&, const RbTreeNode *);
+        //   void removeCounted(RbTreeAnchor *, RbTreeNode *);
+        //   int subtreeSize(const RbTreeNode *);
+        //   void updateSubtreeSizes(RbTreeAnchor *);
+        //   void rotateLeftCounted(RbTreeNode *);
+        //   void rotateRightCounted(RbTreeNode *);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf(
+                   "\nCLASS METHODS: insertAtCounted, removeCounted, nth, rank"
+                   "\n========================================================"
+                   "\n");
+
+        enum { k_MAX_NODES = 64 };
+
+        CountedIntNodeValueComparator valueComparator;
+
+        if (verbose) printf("\tInserting and removing nodes.\n");
+        {
+            ASSERT(0 == Obj::subtreeSize(0));
+
+            for (int numNodes = 0; numNodes <= k_MAX_NODES; ++numNodes) {
+                for (unsigned si = 0; si < 4; ++si) {
+                    unsigned seed = si * 7919 + numNodes;
+
+                    CountedIntNode nodes[k_MAX_NODES];
+                    int            order[k_MAX_NODES];
+                    for (int i = 0; i < numNodes; ++i) {
+                        order[i] = i;
+                    }
+                    shuffleValues(order, numNodes, &seed);
+
+                    RbTreeAnchor tree;
+                    for (int i = 0; i < numNodes; ++i) {
+                        CountedIntNode *node = nodes + i;
+                        node->value() = order[i];
+
+                        int         comparisonResult;
+                        RbTreeNode *location = Obj::findUniqueInsertLocation(
+                                                             &comparisonResult,
+                                                             &tree,
+                                                             valueComparator,
+                                                             node->value());
+                        ASSERTV(numNodes, si, i, 0 != comparisonResult);
+
+                        Obj::insertAtCounted(&tree,
+                                             location,
+                                             comparisonResult < 0,
+                                             node);
+
+                        ASSERTV(numNodes, si, i, i + 1 == tree.numNodes());
+                        ASSERTV(numNodes, si, i, 1 == Obj::subtreeSize(node)
+                                              || 0 != node->leftChild()
+                                              || 0 != node->rightChild());
+                        verifyOrderStatistics(tree, L_);
+
+                        // Verify the non-'const' overload of 'nth' returns
+                        // the same node as the 'const' one.
+
+                        const int   INDEX  = node->value() % (i + 1);
+                        RbTreeNode *mX     = Obj::nth(tree, INDEX);
+                        const RbTreeAnchor& X = tree;
+                        ASSERTV(numNodes, si, i, Obj::nth(X, INDEX) == mX);
+                    }
+
+                    shuffleValues(order, numNodes, &seed);
+
+                    for (int i = 0; i < numNodes; ++i) {
+                        Obj::removeCounted(&tree, nodes + order[i]);
+
+                        ASSERTV(numNodes, si, i,
+                                numNodes - i - 1 == tree.numNodes());
+                        verifyOrderStatistics(tree, L_);
+                    }
+                    ASSERTV(numNodes, si, 0 == tree.rootNode());
+                }
+            }
+        }
+
+        if (verbose) printf("\tRotating nodes.\n");
+        {
+            for (int numNodes = 1; numNodes <= 32; ++numNodes) {
+                unsigned seed = numNodes;
+
+                CountedIntNode nodes[k_MAX_NODES];
+                int            order[k_MAX_NODES];
+                for (int i = 0; i < numNodes; ++i) {
+                    order[i] = i;
+                }
+                shuffleValues(order, numNodes, &seed);
+
+                RbTreeAnchor tree;
+                for (int i = 0; i < numNodes; ++i) {
+                    nodes[i].value() = order[i];
+
+                    int         comparisonResult;
+                    RbTreeNode *location = Obj::findUniqueInsertLocation(
+                                                             &comparisonResult,
+                                                             &tree,
+                                                             valueComparator,
+                                                             nodes[i].value());
+                    Obj::insertAtCounted(&tree,
+                                         location,
+                                         comparisonResult < 0,
+                                         nodes + i);
+                }
+
+                for (int i = 0; i < numNodes; ++i) {
+                    CountedIntNode *node = nodes + i;
+
+                    if (!node->rightChild()) {
+                        continue;
+                    }
+
+                    RbTreeNode *const PARENT = node->parent();
+                    RbTreeNode *const LEFT   = node->leftChild();
+                    RbTreeNode *const RIGHT  = node->rightChild();
+                    const int         SIZE   = node->subtreeSize();
+
+                    Obj::rotateLeftCounted(node);
+
+                    ASSERTV(numNodes, i, RIGHT == node->parent());
+                    ASSERTV(numNodes, i, SIZE  == Obj::subtreeSize(RIGHT));
+                    ASSERTV(numNodes, i, numNodes ==
+                                        verifySubtreeSizes(tree.rootNode()));
+
+                    Obj::rotateRightCounted(RIGHT);
+
+                    ASSERTV(numNodes, i, PARENT == node->parent());
+                    ASSERTV(numNodes, i, LEFT   == node->leftChild());
+                    ASSERTV(numNodes, i, RIGHT  == node->rightChild());
+                    ASSERTV(numNodes, i, SIZE   == node->subtreeSize());
+
+                    verifyOrderStatistics(tree, L_);
+                }
+            }
+        }
+
+        if (verbose) printf("\tUpdating the sizes of a balanced chain.\n");
+        {
+            for (int numNodes = 0; numNodes <= k_MAX_NODES; ++numNodes) {
+                CountedIntNode nodes[k_MAX_NODES];
+
+                RbTreeAnchor tree;
+                RbTreeNode  *last = tree.sentinel();
+                for (int i = 0; i < numNodes; ++i) {
+                    nodes[i].value() = i;
+                    nodes[i].setSubtreeSize(12345);
+                    Obj::appendToChain(&tree, last, nodes + i);
+                    last = nodes + i;
+                }
+                Obj::balanceChain(&tree);
+
+                Obj::updateSubtreeSizes(&tree);
+
+                verifyOrderStatistics(tree, L_);
+                ASSERTV(numNodes, numNodes == Obj::subtreeSize(
+                                                             tree.rootNode()));
+            }
+        }
+
+        if (verbose) printf("\tOperating on a tree of plain nodes.\n");
+        {
+            const int MARKER = 12345;
+
+            CountedIntNode nodes[k_MAX_NODES];
+            int            order[k_MAX_NODES];
+            for (int i = 0; i < k_MAX_NODES; ++i) {
+                order[i] = i;
+                nodes[i].value() = i;
+                nodes[i].setSubtreeSize(MARKER);
+            }
+            unsigned seed = 1;
+            shuffleValues(order, k_MAX_NODES, &seed);
+
+            RbTreeAnchor tree;
+            for (int i = 0; i < k_MAX_NODES; ++i) {
+                CountedIntNode *node = nodes + order[i];
+
+                int         comparisonResult;
+                RbTreeNode *location = Obj::findUniqueInsertLocation(
+                                                             &comparisonResult,
+                                                             &tree,
+                                                             valueComparator,
+                                                             node->value());
+                Obj::insertAt(&tree, location, comparisonResult < 0, node);
+            }
+            ASSERT(Obj::isWellFormed(tree, CountedIntNodeComparator()));
+
+            for (int i = 0; i < k_MAX_NODES; ++i) {
+                if (nodes[i].rightChild()) {
+                    RbTreeNode *pivot = nodes[i].rightChild();
+                    Obj::rotateLeft(nodes + i);
+                    Obj::rotateRight(pivot);
+                }
+            }
+            ASSERT(Obj::isWellFormed(tree, CountedIntNodeComparator()));
+
+            shuffleValues(order, k_MAX_NODES, &seed);
+            for (int i = 0; i < k_MAX_NODES; ++i) {
+                Obj::remove(&tree, nodes + order[i]);
+            }
+            ASSERT(0 == tree.rootNode());
+
+            for (int i = 0; i < k_MAX_NODES; ++i) {
+                ASSERTV(i, MARKER == nodes[i].subtreeSize());
+            }
+        }
+
+        if (verbose) printf("\tNegative Testing.\n");
+        {
+            bsls::AssertFailureHandlerGuard hG(
+                                             bsls::AssertTest::failTestDriver);
+
+            CountedIntNode nodes[2];
+            nodes[0].value() = 0;
+            nodes[1].value() = 1;
+
+            RbTreeAnchor        tree;
+            const RbTreeAnchor& X = tree;
+
+            ASSERT_FAIL(Obj::insertAtCounted(0, tree.sentinel(), true, nodes));
+            ASSERT_FAIL(Obj::insertAtCounted(&tree, 0, true, nodes));
+            ASSERT_FAIL(Obj::insertAtCounted(&tree,
+                                             tree.sentinel(),
+                                             true,
+                                             0));
+            ASSERT_PASS(Obj::insertAtCounted(&tree,
+                                             tree.sentinel(),
+                                             true,
+                                             nodes));
+
+            ASSERT_FAIL(Obj::nth(X, -1));
+            ASSERT_PASS(Obj::nth(X,  0));
+            ASSERT_PASS(Obj::nth(X,  1));
+            ASSERT_FAIL(Obj::nth(X,  2));
+
+            ASSERT_FAIL(Obj::nth(tree, -1));
+            ASSERT_PASS(Obj::nth(tree,  1));
+            ASSERT_FAIL(Obj::nth(tree,  2));
+
+            ASSERT_FAIL(Obj::rank(X, 0));
+            ASSERT_PASS(Obj::rank(X, nodes));
+
+            ASSERT_FAIL(Obj::rotateLeftCounted(0));
+            ASSERT_FAIL(Obj::rotateLeftCounted(nodes));
+            ASSERT_FAIL(Obj::rotateRightCounted(0));
+            ASSERT_FAIL(Obj::rotateRightCounted(nodes));
+
+            ASSERT_FAIL(Obj::updateSubtreeSizes(0));
+            ASSERT_PASS(Obj::updateSubtreeSizes(&tree));
+
+            ASSERT_FAIL(Obj::removeCounted(0, nodes));
+            ASSERT_FAIL(Obj::removeCounted(&tree, 0));
+            ASSERT_PASS(Obj::removeCounted(&tree, nodes));
+            ASSERT_FAIL(Obj::removeCounted(&tree, nodes));
+        }
+      } break;
+      case 27: {
+        // --------------------------------------------------------------------
+        // CLASS METHODS: join, mergeUnion, merge, intersect, subtract
+        //
+        // Concerns:
+        //: 1 'join' produces a well-formed, valid red-black tree holding the
+        //:   nodes of the left tree, the middle node, and the nodes of the
+        //:   right tree, in that order, for any sizes and shapes of the two
+        //:   trees, and leaves the right tree empty.
+        //:
+        //: 2 'mergeUnion' moves into the tree each node of the source tree
+        //:   that is not equivalent to a node of the tree, deletes the other
+        //:   nodes of the source tree, and leaves the source tree empty.
+        //:
+        //: 3 'merge' moves every node of the source tree into the tree,
+        //:   after the equivalent nodes of the tree, and preserving the
+        //:   relative order of equivalent nodes of the source tree.
+        //:
+        //: 4 'intersect' and 'subtract' delete each node of the tree that is
+        //:   not equivalent, or is equivalent, respectively, to a node of the
+        //:   other tree, which is not modified, and keep the relative order
+        //:   of the remaining nodes.
+        //:
+        //: 5 No node is copied: the resulting trees are made of the original
+        //:   nodes, and each node is held by exactly one tree or deleted.
+        //:
+        //: 6 If all the nodes of one tree order before those of the other,
+        //:   the operations perform a constant number of comparisons, and an
+        //:   operation involving a single node performs O(log(N))
+        //:   comparisons.
+        //:
+        //: 7 If the comparator throws, both trees are left well-formed, each
+        //:   node is held by exactly one tree or deleted, the unique trees
+        //:   supplied to 'mergeUnion' still hold no equivalent nodes, the
+        //:   other tree supplied to 'intersect' and 'subtract' is not
+        //:   modified, and no node that belongs to the result of these
+        //:   operations has been deleted.
+        //:
+        //: 8 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For all sizes of the left and right trees up to 40, and a few
+        //:   larger ones, build the trees by inserting nodes in a
+        //:   pseudo-random order, join them with a middle node, and verify,
+        //:   using 'isWellFormed' and an in-order traversal, the resulting
+        //:   trees.  (C-1)
+        //:
+        //: 2 Using 'testSetOperation', apply each operation to every pair of
+        //:   subsets of a universe of 6 values, and 'merge', 'intersect', and
+        //:   'subtract' to every pair of multisets of a universe of 4 values
+        //:   each occurring up to twice.  Verify the resulting trees against
+        //:   an expected sequence of node addresses computed from the
+        //:   sequences of the original trees.  (C-2..5)
+        //:
+        //: 3 Repeat P-2 on larger pseudo-random trees of various sizes and
+        //:   densities, whose ranges of values are disjoint, overlapping, or
+        //:   nested.  (C-2..5)
+        //:
+        //: 4 Apply the operations to trees of 2000 nodes whose ranges of
+        //:   values are disjoint, and to a tree of 2000 nodes and a tree of
+        //:   one node, and verify the number of comparisons performed.
+        //:   (C-6)
+        //:
+        //: 5 For pairs of pseudo-random trees, repeat each operation with a
+        //:   comparator throwing after 0, 1, 2, ... comparisons until the
+        //:   operation completes, verifying the resulting trees after each
+        //:   exception with 'testSetOperation'.  (C-7)
+        //:
+        //: 6 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-8)
+        //
+        // Testing:
+        //   void join(RbTreeAnchor *, RbTreeNode *, RbTreeAnchor *);
+        //   void mergeUnion(RbTreeAnchor *, RbTreeAnchor *, COMP&, FACTORY *);
+        //   void merge(RbTreeAnchor *, RbTreeAnchor *, COMP&);
+        //   void intersect(RbTreeAnchor *, const RbTreeAnchor&, COMP&, FACT*);
+        //   void subtract(RbTreeAnchor *, const RbTreeAnchor&, COMP&, FACT *);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCLASS METHODS: join and set operations"
+                            "\n======================================\n");
+
+        IntNodeComparator    nodeComparator;
+        bslma::TestAllocator ta(veryVeryVeryVerbose);
+
+        if (verbose) printf("\tTesting 'join'.\n");
+        {
+            static const int SIZES[] = { 100, 127, 128, 1000, 3000 };
+            const int NUM_SIZES = sizeof SIZES / sizeof *SIZES;
+            const int NUM_TRIALS = 41 + NUM_SIZES;
+
+            unsigned seed = 1;
+            for (int ti = 0; ti < NUM_TRIALS; ++ti) {
+                const int NUM_LEFT = ti <= 40 ? ti : SIZES[ti - 41];
+                for (int tj = 0; tj < NUM_TRIALS; ++tj) {
+                    const int NUM_RIGHT = tj <= 40 ? tj : SIZES[tj - 41];
+                    const int N         = NUM_LEFT + 1 + NUM_RIGHT;
+
+                    if (veryVerbose) { T_ P_(NUM_LEFT) P(NUM_RIGHT) }
+
+                    Array<int>                values(&ta);
+                    Array<IntNode>            nodes(&ta);
+                    Array<const RbTreeNode *> sequence(&ta);
+                    values.reset(N);
+                    nodes.reset(N);
+                    sequence.reset(N);
+
+                    for (int i = 0; i < N; ++i) {
+                        values[i] = i / 2;
+                    }
+
+                    RbTreeAnchor left;
+                    RbTreeAnchor right;
+                    buildIntTree(&left, nodes.data(), values.data(),
+                                 NUM_LEFT, &seed);
+                    buildIntTree(&right, nodes.data() + NUM_LEFT + 1,
+                                 values.data() + NUM_LEFT + 1,
+                                 NUM_RIGHT, &seed);
+                    nodes[NUM_LEFT].value() = values[NUM_LEFT];
+
+                    // Record the order of the nodes, as equivalent nodes may
+                    // not be ordered by address.
+
+                    collectNodes(sequence.data(), left);
+                    sequence[NUM_LEFT] = &nodes[NUM_LEFT];
+                    collectNodes(sequence.data() + NUM_LEFT + 1, right);
+
+                    Obj::join(&left, &nodes[NUM_LEFT], &right);
+
+                    ASSERTV(NUM_LEFT, NUM_RIGHT, N == left.numNodes());
+                    ASSERTV(NUM_LEFT, NUM_RIGHT,
+                            Obj::isWellFormed(left, nodeComparator));
+                    ASSERTV(NUM_LEFT, NUM_RIGHT,
+                            0 <= validateIntRbTree(left.rootNode()));
+                    ASSERTV(NUM_LEFT, NUM_RIGHT, 0 == right.rootNode());
+                    ASSERTV(NUM_LEFT, NUM_RIGHT, 0 == right.numNodes());
+                    ASSERTV(NUM_LEFT, NUM_RIGHT,
+                            Obj::isWellFormed(right, nodeComparator));
+
+                    const RbTreeNode *node = left.firstNode();
+                    for (int i = 0; i < N; ++i) {
+                        ASSERTV(NUM_LEFT, NUM_RIGHT, i, sequence[i] == node);
+                        node = Obj::next(node);
+                    }
+                    ASSERTV(NUM_LEFT, NUM_RIGHT, left.sentinel() == node);
+                }
+            }
+        }
+
+        if (verbose) printf("\tTesting all pairs of small sets.\n");
+        {
+            enum { NUM_KEYS = 6, NUM_SETS = 1 << NUM_KEYS };
+
+            int lhsValues[NUM_KEYS];
+            int rhsValues[NUM_KEYS];
+
+            unsigned seed = 2;
+            for (int ti = 0; ti < NUM_SETS; ++ti) {
+                int numLhs = 0;
+                for (int k = 0; k < NUM_KEYS; ++k) {
+                    if (ti & (1 << k)) {
+                        lhsValues[numLhs++] = k;
+                    }
+                }
+                for (int tj = 0; tj < NUM_SETS; ++tj) {
+                    int numRhs = 0;
+                    for (int k = 0; k < NUM_KEYS; ++k) {
+                        if (tj & (1 << k)) {
+                            rhsValues[numRhs++] = k;
+                        }
+                    }
+                    if (veryVerbose) { T_ P_(ti) P(tj) }
+
+                    for (int op = 0; op <= e_SUBTRACT; ++op) {
+                        ASSERTV(ti, tj, op,
+                                testSetOperation(SetOperation(op),
+                                                 lhsValues,
+                                                 numLhs,
+                                                 rhsValues,
+                                                 numRhs,
+                                                 seed++));
+                    }
+                }
+            }
+        }
+
+        if (verbose) printf("\tTesting all pairs of small multisets.\n");
+        {
+            enum { NUM_KEYS = 4, NUM_SETS = 3 * 3 * 3 * 3 };
+
+            int lhsValues[2 * NUM_KEYS];
+            int rhsValues[2 * NUM_KEYS];
+
+            unsigned seed = 3;
+            for (int ti = 0; ti < NUM_SETS; ++ti) {
+                int numLhs = 0;
+                for (int k = 0, n = ti; k < NUM_KEYS; ++k, n /= 3) {
+                    for (int c = 0; c < n % 3; ++c) {
+                        lhsValues[numLhs++] = k;
+                    }
+                }
+                for (int tj = 0; tj < NUM_SETS; ++tj) {
+                    int numRhs = 0;
+                    for (int k = 0, n = tj; k < NUM_KEYS; ++k, n /= 3) {
+                        for (int c = 0; c < n % 3; ++c) {
+                            rhsValues[numRhs++] = k;
+                        }
+                    }
+                    if (veryVerbose) { T_ P_(ti) P(tj) }
+
+                    for (int op = e_MERGE; op <= e_SUBTRACT; ++op) {
+                        ASSERTV(ti, tj, op,
+                                testSetOperation(SetOperation(op),
+                                                 lhsValues,
+                                                 numLhs,
+                                                 rhsValues,
+                                                 numRhs,
+                                                 seed++));
+                    }
+                }
+            }
+        }
+
+        if (verbose) printf("\tTesting larger pseudo-random trees.\n");
+        {
+            static const struct {
+                int d_line;         // source line number
+                int d_lhsFirst;     // first key of 'lhs'
+                int d_lhsNumKeys;   // number of keys of 'lhs'
+                int d_lhsPercent;   // probability of each 'lhs' key
+                int d_rhsFirst;     // first key of 'rhs'
+                int d_rhsNumKeys;   // number of keys of 'rhs'
+                int d_rhsPercent;   // probability of each 'rhs' key
+            } DATA[] = {
+                //LINE  LFIRST  LNUM  LPCT  RFIRST  RNUM  RPCT
+                //----  ------  ----  ----  ------  ----  ----
+                { L_,       0,  100,   50,      0,  100,   50 },
+                { L_,       0, 1000,   90,      0, 1000,   10 },
+                { L_,       0, 1000,   10,      0, 1000,   90 },
+                { L_,       0, 1000,  100,    500, 1000,  100 },
+                { L_,     500, 1000,   50,      0, 1000,   50 },
+                { L_,       0, 2000,   50,    900,  200,   50 },
+                { L_,     900,  200,   50,      0, 2000,   50 },
+                { L_,       0, 1000,   75,   1000, 1000,   75 },
+                { L_,    1000, 1000,   75,      0, 1000,   75 },
+                { L_,       0, 2000,  100,   1000,    1,  100 },
+                { L_,       0,    1,  100,      0, 2000,  100 },
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            Array<int> lhsValues(&ta);
+            Array<int> rhsValues(&ta);
+            lhsValues.reset(2 * 2000);
+            rhsValues.reset(2 * 2000);
+
+            unsigned seed = 4;
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int LINE = DATA[ti].d_line;
+
+                if (veryVerbose) { T_ P(LINE) }
+
+                for (int maxCount = 1; maxCount <= 2; ++maxCount) {
+                    const int NUM_LHS = generateValues(lhsValues.data(),
+                                                       DATA[ti].d_lhsFirst,
+                                                       DATA[ti].d_lhsNumKeys,
+                                                       DATA[ti].d_lhsPercent,
+                                                       maxCount,
+                                                       &seed);
+                    const int NUM_RHS = generateValues(rhsValues.data(),
+                                                       DATA[ti].d_rhsFirst,
+                                                       DATA[ti].d_rhsNumKeys,
+                                                       DATA[ti].d_rhsPercent,
+                                                       maxCount,
+                                                       &seed);
+
+                    for (int op = 1 == maxCount ? e_MERGE_UNION : e_MERGE;
+                         op <= e_SUBTRACT;
+                         ++op) {
+                        ASSERTV(LINE, maxCount, op,
+                                testSetOperation(SetOperation(op),
+                                                 lhsValues.data(),
+                                                 NUM_LHS,
+                                                 rhsValues.data(),
+                                                 NUM_RHS,
+                                                 seed++));
+                    }
+                }
+            }
+        }
+
+        if (verbose) printf("\tTesting the number of comparisons.\n");
+        {
+            enum { N = 2000 };
+
+            Array<int> lowValues(&ta);
+            Array<int> highValues(&ta);
+            lowValues.reset(N);
+            highValues.reset(N);
+            for (int i = 0; i < N; ++i) {
+                lowValues[i]  = i;
+                highValues[i] = N + i;
+            }
+            const int SINGLE_VALUE[] = { N / 3 };
+
+            for (int op = 0; op <= e_SUBTRACT; ++op) {
+                int numComparisons;
+
+                testSetOperation(SetOperation(op),
+                                 lowValues.data(), N,
+                                 highValues.data(), N,
+                                 5, -1, &numComparisons);
+                ASSERTV(op, numComparisons, numComparisons <= 2);
+
+                testSetOperation(SetOperation(op),
+                                 highValues.data(), N,
+                                 lowValues.data(), N,
+                                 6, -1, &numComparisons);
+                ASSERTV(op, numComparisons, numComparisons <= 2);
+
+                testSetOperation(SetOperation(op),
+                                 lowValues.data(), N,
+                                 SINGLE_VALUE, 1,
+                                 7, -1, &numComparisons);
+                ASSERTV(op, numComparisons, numComparisons <= 100);
+
+                testSetOperation(SetOperation(op),
+                                 SINGLE_VALUE, 1,
+                                 lowValues.data(), N,
+                                 8, -1, &numComparisons);
+                ASSERTV(op, numComparisons, numComparisons <= 100);
+            }
+        }
+
+#ifdef BDE_BUILD_TARGET_EXC
+        if (verbose) printf("\tTesting exception safety.\n");
+        {
+            enum { NUM_KEYS = 40 };
+
+            int lhsValues[2 * NUM_KEYS];
+            int rhsValues[2 * NUM_KEYS];
+
+            unsigned seed = 9;
+            for (int ti = 0; ti < 40; ++ti) {
+                const int MAX_COUNT = ti % 2 + 1;
+                const int NUM_LHS = generateValues(lhsValues,
+                                                   0,
+                                                   NUM_KEYS,
+                                                   ti % 4 * 25 + 10,
+                                                   MAX_COUNT,
+                                                   &seed);
+                const int NUM_RHS = generateValues(rhsValues,
+                                                   ti % 3 * 10,
+                                                   NUM_KEYS,
+                                                   ti % 5 * 20 + 10,
+                                                   MAX_COUNT,
+                                                   &seed);
+
+                if (veryVerbose) { T_ P_(ti) P_(NUM_LHS) P(NUM_RHS) }
+
+                for (int op = 1 == MAX_COUNT ? e_MERGE_UNION : e_MERGE;
+                     op <= e_SUBTRACT;
+                     ++op) {
+                    const unsigned SEED = seed++;
+
+                    int limit = 0;
+                    while (!testSetOperation(SetOperation(op),
+                                             lhsValues,
+                                             NUM_LHS,
+                                             rhsValues,
+                                             NUM_RHS,
+                                             SEED,
+                                             limit)) {
+                        ++limit;
+                    }
+                    if (veryVeryVerbose) { T_ T_ P_(op) P(limit) }
+                }
+            }
+        }
+#endif
+
+        if (verbose) printf("\tNegative Testing.\n");
+        {
+            bsls::AssertFailureHandlerGuard hG(
+                                             bsls::AssertTest::failTestDriver);
+
+            RbTreeAnchor   tree;
+            RbTreeAnchor   other;
+            IntNode        nodes[2];
+            IntNodeDeleter deleter;
+
+            nodes[0].value() = 0;
+            nodes[1].value() = 1;
+
+            ASSERT_FAIL(Obj::join(0, nodes, &other));
+            ASSERT_FAIL(Obj::join(&tree, 0, &other));
+            ASSERT_FAIL(Obj::join(&tree, nodes, 0));
+            ASSERT_FAIL(Obj::join(&tree, nodes, &tree));
+            ASSERT_PASS(Obj::join(&tree, nodes, &other));
+
+            ASSERT_SAFE_FAIL(Obj::mergeUnion(0, &other, nodeComparator,
+                                             &deleter));
+            ASSERT_SAFE_FAIL(Obj::mergeUnion(&tree, 0, nodeComparator,
+                                             &deleter));
+            ASSERT_SAFE_FAIL(Obj::mergeUnion(&tree, &tree, nodeComparator,
+                                             &deleter));
+            ASSERT_SAFE_FAIL(Obj::mergeUnion(&tree, &other, nodeComparator,
+                                             (IntNodeDeleter *)0));
+            ASSERT_SAFE_PASS(Obj::mergeUnion(&tree, &other, nodeComparator,
+                                             &deleter));
+
+            ASSERT_SAFE_FAIL(Obj::merge(0, &other, nodeComparator));
+            ASSERT_SAFE_FAIL(Obj::merge(&tree, 0, nodeComparator));
+            ASSERT_SAFE_FAIL(Obj::merge(&tree, &tree, nodeComparator));
+            ASSERT_SAFE_PASS(Obj::merge(&tree, &other, nodeComparator));
+
+            ASSERT_SAFE_FAIL(Obj::intersect(0, other, nodeComparator,
+                                            &deleter));
+            ASSERT_SAFE_FAIL(Obj::intersect(&tree, tree, nodeComparator,
+                                            &deleter));
+            ASSERT_SAFE_FAIL(Obj::intersect(&tree, other, nodeComparator,
+                                            (IntNodeDeleter *)0));
+            ASSERT_SAFE_PASS(Obj::intersect(&tree, other, nodeComparator,
+                                            &deleter));
+
+            ASSERT_SAFE_FAIL(Obj::subtract(0, other, nodeComparator,
+                                           &deleter));
+            ASSERT_SAFE_FAIL(Obj::subtract(&tree, tree, nodeComparator,
+                                           &deleter));
+            ASSERT_SAFE_FAIL(Obj::subtract(&tree, other, nodeComparator,
+                                           (IntNodeDeleter *)0));
+            ASSERT_SAFE_PASS(Obj::subtract(&tree, other, nodeComparator,
+                                           &deleter));
+        }
+      } break;
+      case 26: {
+        // --------------------------------------------------------------------
+        // CLASS METHODS: appendToChain, balanceChain
+        //
+        // Concerns:
+        //: 1 'appendToChain' links the first node of an empty tree as its
+        //:   root, and each subsequent node as the right child of the
+        //:   supplied last node, and updates the node count.
+        //:
+        //: 2 A chain is a tree that can be destroyed with 'deleteTree'.
+        //:
+        //: 3 'balanceChain' produces a well-formed, valid red-black tree
+        //:   holding the nodes of the chain in their original order, and whose
+        //:   height is the minimum possible for its number of nodes.
+        //:
+        //: 4 'balanceChain' preserves the order of equivalent nodes.
+        //:
+        //: 5 'balanceChain' does nothing on an empty tree.
+        //:
+        //: 6 The balanced tree can be further modified using 'insert' and
+        //:   'remove'.
+        //:
+        //: 7 An 'RbTreeUtilChainGuard' balances the chain supplied at
+        //:   construction when it is destroyed, unless 'balance' was called,
+        //:   in which case the chain is balanced by 'balance' (only).
+        //:
+        //: 8 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For every number of nodes up to 300, and a few larger ones
+        //:   (including numbers one less than, equal to, and one more than
+        //:   powers of 2), append 'IntNode' objects, holding non-decreasing
+        //:   values having duplicates, to an empty tree using
+        //:   'appendToChain', and verify the shape of the chain after each
+        //:   append.  (C-1)
+        //:
+        //: 2 Balance the chain, and verify, using 'isWellFormed',
+        //:   'validateRbTree', 'treeHeight', and an in-order traversal, that
+        //:   the result is a valid red-black tree of minimum height holding
+        //:   the nodes in their original order.  (C-3..5)
+        //:
+        //: 3 Insert a node into, and remove the first node from, the
+        //:   balanced tree, and verify that the tree remains well-formed.
+        //:   (C-6)
+        //:
+        //: 4 Build chains of 'DeleteTestNode' objects and destroy them using
+        //:   'deleteTree', verifying that every node is deleted.  (C-2)
+        //:
+        //: 5 Build chains in the scope of an 'RbTreeUtilChainGuard', calling
+        //:   'balance' on some of the guards, and verify that the tree is
+        //:   well-formed after the guard is destroyed, and, if 'balance' was
+        //:   called, immediately after that call.  (C-7)
+        //:
+        //: 6 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-8)
+        //
+        // Testing:
+        //   void appendToChain(RbTreeAnchor *, RbTreeNode *, RbTreeNode *);
+        //   void balanceChain(RbTreeAnchor *);
+        //   RbTreeUtilChainGuard(RbTreeAnchor *);
+        //   ~RbTreeUtilChainGuard();
+        //   void RbTreeUtilChainGuard::balance();
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCLASS METHODS: appendToChain, balanceChain"
+                            "\n==========================================\n");
+
+        static const int SIZES[] = { 1023, 1024, 1025, 4095, 4096, 10000 };
+        const int NUM_SIZES = sizeof SIZES / sizeof *SIZES;
+
+        IntNodeComparator    nodeComparator;
+        bslma::TestAllocator ta;
+
+        for (int ti = 0; ti < 301 + NUM_SIZES; ++ti) {
+            const int N = ti <= 300 ? ti : SIZES[ti - 301];
+
+            if (veryVerbose) { T_ P(N) }
+
+            Array<IntNode> nodes(&ta);
+            nodes.reset(N + 1);
+
+            RbTreeAnchor tree;
+            RbTreeNode   *lastNode = tree.sentinel();
+            for (int i = 0; i < N; ++i) {
+                // Each value occurs three times, and the order of the nodes
+                // among equivalent ones is the order of their addresses.
+
+                nodes[i].value() = i / 3;
+                Obj::appendToChain(&tree, lastNode, &nodes[i]);
+
+                ASSERTV(N, i, &nodes[0] == tree.rootNode());
+                ASSERTV(N, i, &nodes[0] == tree.firstNode());
+                ASSERTV(N, i, i + 1     == tree.numNodes());
+                ASSERTV(N, i, lastNode  == nodes[i].parent());
+                ASSERTV(N, i, 0         == nodes[i].leftChild());
+                ASSERTV(N, i, 0         == nodes[i].rightChild());
+                ASSERTV(N, i, tree.sentinel() == lastNode
+                           || &nodes[i] == lastNode->rightChild());
+                lastNode = &nodes[i];
+            }
+
+            Obj::balanceChain(&tree);
+
+            ASSERTV(N, N == tree.numNodes());
+            ASSERTV(N, Obj::isWellFormed(tree, nodeComparator));
+            ASSERTV(N, 0 <= validateIntRbTree(tree.rootNode()));
+
+            int minHeight = 0;
+            while (N >> minHeight) {
+                ++minHeight;
+            }
+            ASSERTV(N, minHeight, minHeight == treeHeight(tree.rootNode()));
+
+            const RbTreeNode *node = tree.firstNode();
+            for (int i = 0; i < N; ++i) {
+                ASSERTV(N, i, &nodes[i] == node);
+                node = Obj::next(node);
+            }
+            ASSERTV(N, tree.sentinel() == node);
+
+            if (0 < N) {
+                nodes[N].value() = N / 2;
+                Obj::insert(&tree, nodeComparator, &nodes[N]);
+                Obj::remove(&tree, tree.firstNode());
+
+                ASSERTV(N, N == tree.numNodes());
+                ASSERTV(N, Obj::isWellFormed(tree, nodeComparator));
+            }
+        }
+
+        if (verbose) printf("\tDestroy chains using 'deleteTree'.\n");
+        {
+            enum { NUM_NODES = 10 };
+
+            for (int n = 0; n < NUM_NODES; ++n) {
+                DeleteTestNode        nodes[NUM_NODES];
+                DeleteTestNodeFactory factory;
+
+                RbTreeAnchor  tree;
+                RbTreeNode   *lastNode = tree.sentinel();
+                for (int i = 0; i < n; ++i) {
+                    nodes[i].d_value   = i;
+                    nodes[i].d_deleted = false;
+                    Obj::appendToChain(&tree, lastNode, &nodes[i]);
+                    lastNode = &nodes[i];
+                }
+                Obj::deleteTree(&tree, &factory);
+
+                ASSERTV(n, 0 == tree.rootNode());
+                ASSERTV(n, 0 == tree.numNodes());
+                for (int i = 0; i < n; ++i) {
+                    ASSERTV(n, i, nodes[i].d_deleted);
+                }
+            }
+        }
+
+        if (verbose) printf("\tTesting 'RbTreeUtilChainGuard'.\n");
+        {
+            enum { NUM_NODES = 20 };
+
+            for (int n = 0; n < NUM_NODES; ++n) {
+                for (int balanceFlag = 0; balanceFlag < 2; ++balanceFlag) {
+                    IntNode      nodes[NUM_NODES];
+                    RbTreeAnchor tree;
+                    {
+                        RbTreeUtilChainGuard  guard(&tree);
+                        RbTreeNode           *lastNode = tree.sentinel();
+                        for (int i = 0; i < n; ++i) {
+                            nodes[i].value() = i;
+                            Obj::appendToChain(&tree, lastNode, &nodes[i]);
+                            lastNode = &nodes[i];
+                        }
+                        if (balanceFlag) {
+                            guard.balance();
+
+                            ASSERTV(n, Obj::isWellFormed(tree,
+                                                         nodeComparator));
+                        }
+                        else if (2 < n) {
+                            ASSERTV(n, !Obj::isWellFormed(tree,
+                                                          nodeComparator));
+                        }
+                    }
+                    ASSERTV(n, balanceFlag, n == tree.numNodes());
+                    ASSERTV(n, balanceFlag,
+                            Obj::isWellFormed(tree, nodeComparator));
+                }
+            }
+        }
+
+        if (verbose) printf("\tNegative Testing.\n");
+        {
+            bsls::AssertFailureHandlerGuard hG(
+                                             bsls::AssertTest::failTestDriver);
+
+            RbTreeAnchor tree;
+            IntNode      nodes[2];
+
+            ASSERT_SAFE_FAIL(RbTreeUtilChainGuard guard(0));
+
+            ASSERT_FAIL(Obj::appendToChain(0, tree.sentinel(), nodes));
+            ASSERT_FAIL(Obj::appendToChain(&tree, 0, nodes));
+            ASSERT_FAIL(Obj::appendToChain(&tree, tree.sentinel(), 0));
+            ASSERT_PASS(Obj::appendToChain(&tree, tree.sentinel(), nodes));
+            ASSERT_PASS(Obj::appendToChain(&tree, nodes, nodes + 1));
+
+            ASSERT_FAIL(Obj::balanceChain(0));
+            ASSERT_PASS(Obj::balanceChain(&tree));
+        }
+      } break;
       case 25: {
         // --------------------------------------------------------------------
         // CLASS METHOD: copyTree (Additional Exception Safety Tests)
@@ -4,8 +4,11 @@
 #include <bsls_ident.h>
 BSLS_IDENT("$Id$ $CSID$")
 
+#include <bsls_assert.h>
 #include <bsls_bslexceptionutil.h>
 
+#include <cstring>  // 'std::memcpy'
+
 namespace BloombergLP {
 
 namespace bslma {
@@ -20,6 +23,48 @@ Allocator::~Allocator()
 {
 }
 
+// MANIPULATORS
+void *Allocator::reallocate(void      *address,
+                            size_type  currentSize,
+                            size_type  newSize)
+{
+    if (!address) {
+        return allocate(newSize);                                     // RETURN
+    }
+
+    if (!newSize) {
+        deallocate(address);
+        return 0;                                                     // RETURN
+    }
+
+    if (currentSize <= newSize
+     && tryExpandInPlace(address, currentSize, newSize)) {
+        return address;                                               // RETURN
+    }
+
+    void *result = allocate(newSize);
+
+    std::memcpy(result, address, currentSize < newSize ? currentSize
+                                                       : newSize);
+    deallocate(address);
+
+    return result;
+}
+
+bool Allocator::tryExpandInPlace(void      *address,
+                                 size_type  currentSize,
+                                 size_type  newSize)
+{
+    BSLS_ASSERT(address);
+    BSLS_ASSERT(currentSize <= newSize);
+
+    (void) address;
+    (void) currentSize;
+    (void) newSize;
+
+    return false;
+}
+
 }  // close package namespace
 
 }  // close enterprise namespace
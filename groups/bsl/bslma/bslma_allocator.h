@@ -68,6 +68,33 @@ BSLS_IDENT("$Id: $")
 // memory.  Memory is allocated from the pool until it is dry; only then does
 // new memory flow into the pool from the allocator.
 //
+///Growing Allocated Blocks
+///------------------------
+// In addition to the pure virtual 'allocate' and 'deallocate' methods, the
+// protocol provides two virtual methods having default implementations, which
+// concrete allocators can override to let containers grow a block without
+// copying its contents:
+//
+//: 'tryExpandInPlace':
+//:   Attempt to extend a block to a larger size without changing its address.
+//:   The default implementation always fails (i.e., returns 'false'), which
+//:   is correct for every allocator.  Allocators that dispense memory
+//:   sequentially from a buffer can succeed whenever the block is the most
+//:   recently allocated one and the buffer has sufficient space remaining.
+//:
+//: 'reallocate':
+//:   Return a block of the new size holding the contents of the old block,
+//:   which may be at a different address.  The default implementation calls
+//:   'tryExpandInPlace' and, if that fails, 'allocate', 'memcpy', and
+//:   'deallocate', which is what a container would have done otherwise.
+//:   Allocators based on 'std::malloc' can use 'std::realloc', which can
+//:   avoid the copy altogether (e.g., by remapping the pages of a large
+//:   block).
+//
+// Since 'reallocate' relocates the contents of the block bitwise, it can be
+// used only for blocks holding objects of bitwise-moveable types, whereas
+// 'tryExpandInPlace' can be used for blocks holding objects of any type.
+//
 ///Overloaded Global Operators 'new' and 'delete'
 ///----------------------------------------------
 // This component overloads the global operator 'new' to allow convenient
@@ -435,6 +462,46 @@ class Allocator {
         // behavior is undefined unless 'address' was allocated using this
         // allocator object and has not already been deallocated.
 
+    virtual void *reallocate(void      *address,
+                             size_type  currentSize,
+                             size_type  newSize);
+        // Return the address of a block of memory of (at least) the specified
+        // 'newSize' (in bytes) whose first 'min(currentSize, newSize)' bytes
+        // have the values of those of the memory block at the specified
+        // 'address', having the specified 'currentSize', and return that
+        // block to this allocator unless its address is returned.  If
+        // 'address' is 0, this method has the same effect as
+        // 'allocate(newSize)'; otherwise, if 'newSize' is 0, it has the same
+        // effect as 'deallocate(address)' and returns a null pointer.  If
+        // this allocator cannot return the requested number of bytes, then it
+        // will throw a 'std::bad_alloc' exception in an exception-enabled
+        // build, or else will abort the program in a non-exception build, and
+        // the block at 'address' is not affected.  The behavior is undefined
+        // unless 'address' is 0 or was allocated using this allocator object
+        // with a size of 'currentSize' (possibly as the result of a previous
+        // call to 'reallocate' or 'tryExpandInPlace') and has not already
+        // been deallocated, and '0 <= newSize'.  Note that the contents of the
+        // block are relocated bitwise, so the block must not hold objects
+        // that are not bitwise moveable.  Also note that the default
+        // implementation uses 'tryExpandInPlace', and then 'allocate',
+        // 'memcpy', and 'deallocate'.
+
+    virtual bool tryExpandInPlace(void      *address,
+                                  size_type  currentSize,
+                                  size_type  newSize);
+        // Attempt to increase the size of the memory block at the specified
+        // 'address', having the specified 'currentSize' (in bytes), to (at
+        // least) the specified 'newSize' (in bytes) without changing its
+        // address.  Return 'true' on success, in which case the block has a
+        // size of 'newSize' for the purpose of subsequent calls to
+        // 'reallocate' and 'tryExpandInPlace', and 'false' with no effect
+        // otherwise.  The behavior is undefined unless 'address' was
+        // allocated using this allocator object with a size of 'currentSize'
+        // (possibly as the result of a previous call to 'reallocate' or
+        // 'tryExpandInPlace') and has not already been deallocated, and
+        // 'currentSize <= newSize'.  Note that the default implementation
+        // returns 'false'.
+
     template <class TYPE>
     void deleteObject(const TYPE *object);
         // Destroy the specified 'object' based on its dynamic type and then
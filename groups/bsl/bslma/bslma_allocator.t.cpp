@@ -33,11 +33,13 @@ using namespace BloombergLP;
 // [ 3] template<typename TYPE> deleteObjectRaw(const TYPE *);
 // [ 4] void *operator new(int size, bslma::Allocator& basicAllocator);
 // [ 5] void operator delete(void *address, bslma::Allocator& basicAllocator);
+// [ 6] virtual void *reallocate(void *, size_type, size_type);
+// [ 6] virtual bool tryExpandInPlace(void *, size_type, size_type);
 //-----------------------------------------------------------------------------
 // [ 1] PROTOCOL TEST - Make sure derived class compiles and links.
 // [ 4] OPERATOR TEST - Make sure overloaded operators call correct functions.
 // [ 5] EXCEPTION SAFETY - Ensure operator delete is invoked on an exception.
-// [ 6] USAGE EXAMPLE - Make sure usage examples compiles and works properly.
+// [ 7] USAGE EXAMPLE - Make sure usage examples compiles and works properly.
 //=============================================================================
 
 //=============================================================================
@@ -166,6 +168,55 @@ class my_NewDeleteAllocator : public bslma::Allocator {
     int getCount() const            { return d_count; }
 };
 
+class my_BumpAllocator : public bslma::Allocator {
+    // Test class that dispenses memory sequentially from a fixed buffer, and
+    // can extend the most recently allocated block in place.
+
+    bsls::AlignmentUtil::MaxAlignedType d_buffer[32];  // memory dispensed
+
+    size_type  d_cursor;           // offset of the first free byte
+    char      *d_last_p;           // most recently allocated block
+    int        d_allocateCount;    // number of times allocate called
+    int        d_deallocateCount;  // number of times deallocate called
+
+    char *base() { return reinterpret_cast<char *>(d_buffer); }
+
+  public:
+    my_BumpAllocator()
+    : d_cursor(0), d_last_p(0), d_allocateCount(0), d_deallocateCount(0) { }
+    ~my_BumpAllocator() { }
+
+    void *allocate(size_type size) {
+        ++d_allocateCount;
+        d_cursor = (d_cursor + 15) & ~static_cast<size_type>(15);
+        ASSERT(d_cursor + size <= sizeof d_buffer);
+        d_last_p  = base() + d_cursor;
+        d_cursor += size;
+        return d_last_p;
+    }
+
+    void deallocate(void *address) { if (address) ++d_deallocateCount; }
+
+    bool tryExpandInPlace(void      *address,
+                          size_type  currentSize,
+                          size_type  newSize) {
+        if (address != d_last_p
+         || d_cursor != static_cast<size_type>(d_last_p - base())
+                                                              + currentSize
+         || sizeof d_buffer < d_cursor + newSize - currentSize) {
+            return false;                                             // RETURN
+        }
+        d_cursor += newSize - currentSize;
+        return true;
+    }
+
+    int allocateCount() const { return d_allocateCount; }
+        // Return number of times allocate called.
+
+    int deallocateCount() const { return d_deallocateCount; }
+        // Return number of times deallocate called.
+};
+
 //=============================================================================
 //                   CONCRETE OBJECTS FOR TESTING 'deleteObject'
 //-----------------------------------------------------------------------------
@@ -425,7 +476,7 @@ int main(int argc, char *argv[])
     printf("TEST " __FILE__ " CASE %d\n", test);
 
     switch (test) { case 0:
-      case 6: {
+      case 7: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         //   The usage example provided in the component header file must
@@ -479,6 +530,91 @@ int main(int argc, char *argv[])
             deleteMyType(&a, t);
         }
 
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // REALLOCATE AND TRYEXPANDINPLACE TEST:
+        //   We want to make sure that the default implementations of
+        //   'reallocate' and 'tryExpandInPlace' are correct for any allocator,
+        //   and that 'reallocate' avoids copying if a derived allocator can
+        //   extend a block in place.
+        //
+        // Plan:
+        //   Using an allocator that overrides neither method, verify that
+        //   'tryExpandInPlace' fails, and that 'reallocate' allocates a new
+        //   block holding the contents of the old one and deallocates the
+        //   old one, for larger and smaller sizes, and that it behaves as
+        //   'allocate' and 'deallocate' for a null address and a zero size,
+        //   respectively.  Then, using an allocator that can extend its most
+        //   recent block, verify that 'reallocate' returns the same address
+        //   without allocating for that block, and moves any other block.
+        //
+        // Testing:
+        //   virtual void *reallocate(void *, size_type, size_type);
+        //   virtual bool tryExpandInPlace(void *, size_type, size_type);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nREALLOCATE AND TRYEXPANDINPLACE TEST"
+                            "\n====================================\n");
+
+        if (verbose) printf("\nDefault implementations.\n");
+        {
+            my_NewDeleteAllocator myA;
+            bslma::Allocator&     a = myA;
+
+            char *p = static_cast<char *>(a.reallocate(0, 0, 8));
+            ASSERT(p);
+            ASSERT(1 == myA.getCount());
+            memcpy(p, "abcdefgh", 8);
+
+            ASSERT(!a.tryExpandInPlace(p, 8, 16));
+            ASSERT(!a.tryExpandInPlace(p, 8, 8));
+            ASSERT(1 == myA.getCount());
+
+            char *q = static_cast<char *>(a.reallocate(p, 8, 64));
+            ASSERT(q);
+            ASSERT(3 == myA.getCount());
+            ASSERT(0 == memcmp(q, "abcdefgh", 8));
+
+            char *r = static_cast<char *>(a.reallocate(q, 64, 4));
+            ASSERT(r);
+            ASSERT(5 == myA.getCount());
+            ASSERT(0 == memcmp(r, "abcd", 4));
+
+            ASSERT(0 == a.reallocate(r, 4, 0));
+            ASSERT(6 == myA.getCount());
+        }
+
+        if (verbose) printf("\nExtending in place.\n");
+        {
+            my_BumpAllocator  myA;
+            bslma::Allocator& a = myA;
+
+            char *p = static_cast<char *>(a.allocate(8));
+            memcpy(p, "abcdefgh", 8);
+
+            ASSERT(p == a.reallocate(p, 8, 32));
+            ASSERT(1 == myA.allocateCount());
+            ASSERT(0 == myA.deallocateCount());
+            ASSERT(0 == memcmp(p, "abcdefgh", 8));
+
+            char *q = static_cast<char *>(a.allocate(8));
+            ASSERT(2 == myA.allocateCount());
+
+            // 'p' is no longer the most recent block.
+
+            ASSERT(!a.tryExpandInPlace(p, 32, 40));
+
+            char *r = static_cast<char *>(a.reallocate(p, 32, 40));
+            ASSERT(r != p);
+            ASSERT(r != q);
+            ASSERT(3 == myA.allocateCount());
+            ASSERT(1 == myA.deallocateCount());
+            ASSERT(0 == memcmp(r, "abcdefgh", 8));
+
+            ASSERT(a.tryExpandInPlace(r, 40, 48));
+        }
+
       } break;
       case 5: {
         // --------------------------------------------------------------------
@@ -116,6 +116,30 @@ void *MallocFreeAllocator::allocate(size_type size)
 
     return result;
 }
+
+void *MallocFreeAllocator::reallocate(void      *address,
+                                      size_type  currentSize,
+                                      size_type  newSize)
+{
+    (void) currentSize;
+
+    if (!address) {
+        return allocate(newSize);                                     // RETURN
+    }
+
+    if (!newSize) {
+        deallocate(address);
+        return 0;                                                     // RETURN
+    }
+
+    void *result = std::realloc(address, newSize);
+    if (!result) {
+        bsls::BslExceptionUtil::throwBadAlloc();
+    }
+
+    return result;
+}
+
 }  // close package namespace
 
 }  // close enterprise namespace
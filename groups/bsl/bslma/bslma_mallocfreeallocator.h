@@ -184,6 +184,27 @@ class MallocFreeAllocator : public Allocator {
         // 'std::free' is *not* called when 'address' is 0 (in order to avoid
         // having to acquire a lock, and potential contention in multi-treaded
         // programs).
+
+    virtual void *reallocate(void      *address,
+                             size_type  currentSize,
+                             size_type  newSize);
+        // Return the address of a block of memory of (at least) the specified
+        // 'newSize' (in bytes) whose first 'min(currentSize, newSize)' bytes
+        // have the values of those of the memory block at the specified
+        // 'address', having the specified 'currentSize', and return that
+        // block to this allocator unless its address is returned.  If
+        // 'address' is 0, this method has the same effect as
+        // 'allocate(newSize)'; otherwise, if 'newSize' is 0, it has the same
+        // effect as 'deallocate(address)' and returns a null pointer.  If
+        // this allocator cannot return the requested number of bytes, then it
+        // will throw a 'std::bad_alloc' exception in an exception-enabled
+        // build, or else will abort the program in a non-exception build, and
+        // the block at 'address' is not affected.  The behavior is undefined
+        // unless 'address' is 0 or was allocated using this allocator object
+        // and has not already been deallocated.  Note that this method calls
+        // 'std::realloc', which can extend the block in place, or (for large
+        // blocks, on some platforms) move it by remapping its pages rather
+        // than copying its contents.
 };
 
 // ============================================================================
@@ -8,6 +8,7 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 #ifdef BDE_BUILD_TARGET_EXC
 #include <new>
@@ -34,9 +35,10 @@ using namespace BloombergLP;
 // [ 2] void *allocate(size_type size)   // allocate 0
 // [ 2] void deallocate((void *address)  // deallocate 0
 // [ 3] static bslma::MallocFreeAllocator& singleton()
+// [ 4] void *reallocate(void *address, size_type, size_type newSize)
 //-----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [ 4] USAGE EXAMPLE
+// [ 5] USAGE EXAMPLE
 
 //=============================================================================
 //                  STANDARD BDE ASSERT TEST MACRO
@@ -253,7 +255,7 @@ int main(int argc, char *argv[])
     printf("TEST " __FILE__ " CASE %d\n", test);
 
     switch (test) { case 0:
-      case 4: {
+      case 5: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //
@@ -321,6 +323,71 @@ int main(int argc, char *argv[])
         ASSERT(0 == globalDeleteCalledCount);
         ASSERT(0 == globalDeleteCalledLastArg);
 
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // REALLOCATE TEST
+        //
+        // Concerns:
+        //   1. That 'reallocate' preserves the contents of the block, up to
+        //      the smaller of the old and new sizes, for larger and smaller
+        //      sizes, including sizes large enough for 'std::realloc' to
+        //      remap pages on some platforms.
+        //   2. That 'reallocate' with a null address allocates, and with a
+        //      zero size deallocates and returns a null pointer.
+        //   3. That global 'new' and 'delete' are not invoked.
+        //
+        // Plan:
+        //   Grow a block filled with a pattern through a sequence of sizes,
+        //   verifying the pattern after each step, then shrink it, with
+        //   global 'new' and 'delete' monitored.
+        //
+        // Testing:
+        //   void *reallocate(void *address, size_type, size_type newSize)
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nREALLOCATE TEST"
+                            "\n===============\n");
+
+        bslma::MallocFreeAllocator a;
+
+        globalNewCalledCountIsEnabled    = 1;
+        globalDeleteCalledCountIsEnabled = 1;
+
+        bslma::Allocator::size_type size = 16;
+
+        char *p = static_cast<char *>(a.reallocate(0, 0, size));
+        ASSERT(p);
+        memset(p, 'a', size);
+
+        for (int i = 0; i < 8; ++i) {
+            const bslma::Allocator::size_type newSize = size * 8;
+
+            p = static_cast<char *>(a.reallocate(p, size, newSize));
+            LOOP_ASSERT(i, p);
+
+            bool same = true;
+            for (bslma::Allocator::size_type j = 0; j < size; ++j) {
+                same = same && 'a' + i == p[j];
+            }
+            LOOP_ASSERT(i, same);
+
+            memset(p, 'a' + i + 1, newSize);
+            size = newSize;
+        }
+
+        p = static_cast<char *>(a.reallocate(p, size, 8));
+        ASSERT(p);
+        ASSERT(0 == memcmp(p, "iiiiiiii", 8));
+
+        ASSERT(0 == a.reallocate(p, 8, 0));
+
+        globalNewCalledCountIsEnabled    = 0;
+        globalDeleteCalledCountIsEnabled = 0;
+
+        ASSERT(0 == globalNewCalledCount);
+        ASSERT(0 == globalDeleteCalledCount);
+
       } break;
       case 3: {
         // --------------------------------------------------------------------
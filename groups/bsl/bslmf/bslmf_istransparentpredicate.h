@@ -0,0 +1,166 @@
+// bslmf_istransparentpredicate.h                                     -*-C++-*-
+#ifndef INCLUDED_BSLMF_ISTRANSPARENTPREDICATE
+#define INCLUDED_BSLMF_ISTRANSPARENTPREDICATE
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a compile-time check for transparent functor types.
+//
+//@CLASSES:
+//  bslmf::IsTransparentPredicate: detects a nested 'is_transparent' type
+//
+//@SEE_ALSO: bslmf_enableif, bslstl_equalto
+//
+//@DESCRIPTION: This component defines a meta-function,
+// 'bslmf::IsTransparentPredicate', that may be used to query whether a
+// functor type (typically a hasher or an equality comparator) declares a
+// nested type named 'is_transparent'.  By convention (see the C++14 standard,
+// [associative.reqmts]), such a functor accepts arguments of types other than
+// the key type of a container, so that the container may offer lookup
+// operations taking any key type the functor accepts without first converting
+// the supplied key to the container's key type.
+//
+// 'bslmf::IsTransparentPredicate<COMPARATOR, KEY>' derives from
+// 'bsl::true_type' if 'COMPARATOR::is_transparent' names a type, and from
+// 'bsl::false_type' otherwise (including when 'COMPARATOR' is not a class
+// type, e.g., a function pointer).  The (template parameter) 'KEY' type is
+// not inspected; it is present so that the meta-function depends on the
+// deduced key type of a member function template, and so may be used to
+// remove that template from overload resolution (with 'bsl::enable_if')
+// without being evaluated when the enclosing class template is instantiated.
+//
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: Detecting a Transparent Comparator
+///- - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we are writing a container that should accept a lookup key of
+// any type when its comparator is transparent.
+//
+// First, we define a transparent comparator, and one that is not:
+//..
+//  struct TransparentEqual {
+//      // This 'struct' compares values of any two types for equality.
+//
+//      typedef void is_transparent;
+//
+//      template <class LHS, class RHS>
+//      bool operator()(const LHS& lhs, const RHS& rhs) const
+//          // Return 'lhs == rhs'.
+//      {
+//          return lhs == rhs;
+//      }
+//  };
+//
+//  struct IntEqual {
+//      // This 'struct' compares 'int' values for equality.
+//
+//      bool operator()(int lhs, int rhs) const
+//          // Return 'lhs == rhs'.
+//      {
+//          return lhs == rhs;
+//      }
+//  };
+//..
+// Then, we observe that only the first is detected as transparent:
+//..
+//  assert( (bslmf::IsTransparentPredicate<TransparentEqual, long>::value));
+//  assert(!(bslmf::IsTransparentPredicate<IntEqual,         long>::value));
+//..
+// Finally, we note that a container would typically use the meta-function
+// with 'bsl::enable_if' to declare a lookup member function template that
+// participates in overload resolution only for a transparent comparator:
+//..
+//  template <class LOOKUP_KEY>
+//  typename bsl::enable_if<
+//      BloombergLP::bslmf::IsTransparentPredicate<EQUAL, LOOKUP_KEY>::value,
+//      const_iterator>::type
+//  find(const LOOKUP_KEY& key) const;
+//..
+
+#ifndef INCLUDED_BSLSCM_VERSION
+#include <bslscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_INTEGRALCONSTANT
+#include <bslmf_integralconstant.h>
+#endif
+
+namespace BloombergLP {
+namespace bslmf {
+
+                    // =================================
+                    // struct IsTransparentPredicate_Imp
+                    // =================================
+
+template <class TYPE>
+struct IsTransparentPredicate_VoidType {
+    // This 'struct' template maps any (template parameter) 'TYPE' to 'void',
+    // so that a partial specialization of 'IsTransparentPredicate_Imp' can be
+    // selected if, and only if, 'TYPE' is well-formed.
+
+    typedef void Type;
+};
+
+template <class COMPARATOR, class = void>
+struct IsTransparentPredicate_Imp : bsl::false_type {
+    // This 'struct' template implements a meta-function that derives from
+    // 'bsl::false_type' for a (template parameter) 'COMPARATOR' type that
+    // does not declare a nested 'is_transparent' type.
+};
+
+template <class COMPARATOR>
+struct IsTransparentPredicate_Imp<
+               COMPARATOR,
+               typename IsTransparentPredicate_VoidType<
+                             typename COMPARATOR::is_transparent>::Type>
+    : bsl::true_type {
+    // This partial specialization of 'IsTransparentPredicate_Imp' derives
+    // from 'bsl::true_type' for a (template parameter) 'COMPARATOR' type that
+    // declares a nested 'is_transparent' type.
+};
+
+                       // =============================
+                       // struct IsTransparentPredicate
+                       // =============================
+
+template <class COMPARATOR, class KEY>
+struct IsTransparentPredicate
+    : IsTransparentPredicate_Imp<COMPARATOR>::type {
+    // This 'struct' template implements a meta-function that derives from
+    // 'bsl::true_type' if the (template parameter) 'COMPARATOR' type declares
+    // a nested 'is_transparent' type, and from 'bsl::false_type' otherwise.
+    // The (template parameter) 'KEY' type is unused (see the component-level
+    // documentation).
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,317 @@
+// bslmf_istransparentpredicate.t.cpp                                 -*-C++-*-
+#include <bslmf_istransparentpredicate.h>
+
+#include <bslmf_enableif.h>
+#include <bsls_bsltestutil.h>
+
+#include <stdio.h>   // 'printf'
+#include <stdlib.h>  // 'atoi'
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                                TEST PLAN
+//-----------------------------------------------------------------------------
+//                                Overview
+//                                --------
+// The component under test defines a meta-function,
+// 'bslmf::IsTransparentPredicate', that determines whether a functor type
+// declares a nested 'is_transparent' type.  We verify the result for class
+// types that do and do not declare the nested type (whatever type it names),
+// and for non-class types, for which the nested type cannot be formed.  We
+// also verify that the meta-function can remove a member function template
+// from overload resolution.
+//-----------------------------------------------------------------------------
+// [ 2] bslmf::IsTransparentPredicate::value
+// [ 2] bslmf::IsTransparentPredicate::type
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 3] USAGE EXAMPLE
+
+//=============================================================================
+//                       STANDARD BDE ASSERT TEST MACRO
+//-----------------------------------------------------------------------------
+// NOTE: THIS IS A LOW-LEVEL COMPONENT AND MAY NOT USE ANY C++ LIBRARY
+// FUNCTIONS, INCLUDING IOSTREAMS.
+static int testStatus = 0;
+
+void aSsErT(bool b, const char *s, int i)
+{
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+# define ASSERT(X) { aSsErT(!(X), #X, __LINE__); }
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+//=============================================================================
+//                  GLOBAL HELPER FUNCTIONS FOR TESTING
+//-----------------------------------------------------------------------------
+
+namespace {
+
+struct TransparentVoid {
+    // This 'struct' declares 'is_transparent' as 'void'.
+
+    typedef void is_transparent;
+};
+
+struct TransparentInt {
+    // This 'struct' declares 'is_transparent' as a non-'void' type.
+
+    typedef int is_transparent;
+};
+
+struct Opaque {
+    // This 'struct' declares no 'is_transparent' type.
+
+    typedef void is_not_transparent;
+};
+
+struct DerivedTransparent : TransparentVoid {
+    // This 'struct' inherits an 'is_transparent' type.
+};
+
+typedef bool Function(int, int);
+
+template <class COMPARATOR>
+struct Finder {
+    // This 'struct' provides a lookup function template that participates in
+    // overload resolution only for a transparent (template parameter)
+    // 'COMPARATOR'.
+
+    int find(const int&) const
+        // Return 1.
+    {
+        return 1;
+    }
+
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+        bslmf::IsTransparentPredicate<COMPARATOR, LOOKUP_KEY>::value,
+        int>::type
+    find(const LOOKUP_KEY&) const
+        // Return 2.
+    {
+        return 2;
+    }
+};
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                              USAGE EXAMPLE
+//-----------------------------------------------------------------------------
+
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: Detecting a Transparent Comparator
+///- - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we are writing a container that should accept a lookup key of
+// any type when its comparator is transparent.
+//
+// First, we define a transparent comparator, and one that is not:
+//..
+    struct TransparentEqual {
+        // This 'struct' compares values of any two types for equality.
+
+        typedef void is_transparent;
+
+        template <class LHS, class RHS>
+        bool operator()(const LHS& lhs, const RHS& rhs) const
+            // Return 'lhs == rhs'.
+        {
+            return lhs == rhs;
+        }
+    };
+
+    struct IntEqual {
+        // This 'struct' compares 'int' values for equality.
+
+        bool operator()(int lhs, int rhs) const
+            // Return 'lhs == rhs'.
+        {
+            return lhs == rhs;
+        }
+    };
+//..
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+    bool verbose = argc > 2;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 3: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+// Then, we observe that only the first is detected as transparent:
+//..
+    ASSERT( (bslmf::IsTransparentPredicate<TransparentEqual, long>::value));
+    ASSERT(!(bslmf::IsTransparentPredicate<IntEqual,         long>::value));
+//..
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // 'bslmf::IsTransparentPredicate::value'
+        //   Ensure that the meta-function returns the correct value for each
+        //   category of type.
+        //
+        // Concerns:
+        //: 1 The meta-function returns 'true' for a class type declaring a
+        //:   nested 'is_transparent' type, whether that type is 'void' or not,
+        //:   and whether it is declared directly or inherited.
+        //:
+        //: 2 The meta-function returns 'false' for a class type not declaring
+        //:   a nested 'is_transparent' type.
+        //:
+        //: 3 The meta-function returns 'false' for non-class types, and does
+        //:   not fail to compile for them.
+        //:
+        //: 4 The meta-function derives from 'bsl::true_type' or
+        //:   'bsl::false_type' as appropriate.
+        //:
+        //: 5 The meta-function can remove a function template from overload
+        //:   resolution.
+        //
+        // Plan:
+        //: 1 Verify 'value' for each category of type.  (C-1..3)
+        //:
+        //: 2 Verify the nested 'type' is 'true_type' or 'false_type'.  (C-4)
+        //:
+        //: 3 Call a function overloaded with a function template constrained
+        //:   by the meta-function, and verify which overload is chosen.  (C-5)
+        //
+        // Testing:
+        //   bslmf::IsTransparentPredicate::value
+        //   bslmf::IsTransparentPredicate::type
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\n'bslmf::IsTransparentPredicate::value'"
+                            "\n======================================\n");
+
+#define TEST(TYPE) bslmf::IsTransparentPredicate<TYPE, int>::value
+
+        ASSERT( TEST(TransparentVoid));
+        ASSERT( TEST(TransparentInt));
+        ASSERT( TEST(DerivedTransparent));
+
+        ASSERT(!TEST(Opaque));
+        ASSERT(!TEST(int));
+        ASSERT(!TEST(Function *));
+        ASSERT(!TEST(Function&));
+        ASSERT(!TEST(TransparentVoid *));
+
+#undef TEST
+
+        bsl::true_type  t = bslmf::IsTransparentPredicate<TransparentVoid,
+                                                          int>::type();
+        bsl::false_type f = bslmf::IsTransparentPredicate<Opaque,
+                                                          int>::type();
+        (void)t;
+        (void)f;
+
+        ASSERT(1 == Finder<Opaque>().find(5));
+        ASSERT(1 == Finder<Opaque>().find(5L));
+        ASSERT(1 == Finder<TransparentVoid>().find(5));
+        ASSERT(2 == Finder<TransparentVoid>().find(5L));
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Verify the meta-function for one transparent and one
+        //:   non-transparent type.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        ASSERT( (bslmf::IsTransparentPredicate<TransparentVoid, int>::value));
+        ASSERT(!(bslmf::IsTransparentPredicate<Opaque,          int>::value));
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -23,6 +23,14 @@ BSLS_IDENT("$Id: $")
 // 'bslstl_simplepool' component in its implementation to provide memory for
 // the nodes (see 'bslstl_simplepool').
 //
+// By default, the nodes are of type 'bslalg::BidirectionalNode<VALUE>'.  A
+// type derived from 'bslalg::BidirectionalNode<VALUE>' that adds
+// (trivially-constructible) attributes, such as
+// 'bslalg::BidirectionalHashedNode<VALUE>', may be supplied instead as the
+// optional (template parameter) type 'NODE'; the pool constructs and destroys
+// only the 'value' attribute of each node, leaving any additional attributes
+// for the client to initialize.
+//
 ///Memory Allocation
 ///-----------------
 // 'BidirectionalNodePool' uses an allocator of the (template parameter) type
@@ -186,6 +194,10 @@ BSLS_IDENT("$Id: $")
 #include <bslstl_allocatortraits.h>
 #endif
 
+#ifndef INCLUDED_BSLSTL_NODEHANDLE
+#include <bslstl_nodehandle.h>
+#endif
+
 #ifndef INCLUDED_BSLSTL_SIMPLEPOOL
 #include <bslstl_simplepool.h>
 #endif
@@ -202,10 +214,22 @@ BSLS_IDENT("$Id: $")
 #include <bslma_deallocatorproctor.h>
 #endif
 
+#ifndef INCLUDED_BSLMA_DESTRUCTORPROCTOR
+#include <bslma_destructorproctor.h>
+#endif
+
 #ifndef INCLUDED_BSLMF_ISBITWISEMOVEABLE
 #include <bslmf_isbitwisemoveable.h>
 #endif
 
+#ifndef INCLUDED_BSLMF_REMOVECONST
+#include <bslmf_removeconst.h>
+#endif
+
+#ifndef INCLUDED_BSLS_COMPILERFEATURES
+#include <bsls_compilerfeatures.h>
+#endif
+
 #ifndef INCLUDED_BSLS_NATIVESTD
 #include <bsls_nativestd.h>
 #endif
@@ -221,13 +245,16 @@ namespace bslstl {
                        // class BidirectionalNodePool
                        // ===========================
 
-template <class VALUE, class ALLOCATOR>
+template <class VALUE,
+          class ALLOCATOR,
+          class NODE = bslalg::BidirectionalNode<VALUE> >
 class BidirectionalNodePool {
-    // This class provides methods for creating and destroying nodes using the
-    // appropriate allocator-traits of the (template parameter) type
-    // 'ALLOCATOR'.
+    // This class provides methods for creating and destroying nodes of the
+    // (template parameter) type 'NODE' using the appropriate allocator-traits
+    // of the (template parameter) type 'ALLOCATOR'.  'NODE' shall be
+    // 'bslalg::BidirectionalNode<VALUE>' or a type derived from it.
 
-    typedef SimplePool<bslalg::BidirectionalNode<VALUE>, ALLOCATOR>       Pool;
+    typedef SimplePool<NODE, ALLOCATOR>                                   Pool;
         // This 'typedef' is an alias for the memory pool allocator.
 
     typedef typename Pool::AllocatorTraits AllocatorTraits;
@@ -260,10 +287,10 @@ class BidirectionalNodePool {
 
     // ~BidirectionalNodePool() = default;
         // Destroy the memory pool maintained by this object, releasing all
-        // memory used by the nodes of the type 'BidirectionalNode<VALUE>' in
-        // the pool.  Any memory allocated for the nodes' 'value' attribute of
-        // the (template parameter) type 'VALUE' will be leaked unless the
-        // nodes are explicitly destroyed via the 'destroyNode' method.
+        // memory used by the nodes of the type 'NODE' in the pool.  Any memory
+        // allocated for the nodes' 'value' attribute of the (template
+        // parameter) type 'VALUE' will be leaked unless the nodes are
+        // explicitly destroyed via the 'destroyNode' method.
 
     // MANIPULATORS
     AllocatorType& allocator();
@@ -275,15 +302,15 @@ class BidirectionalNodePool {
         // allocator.
 
     bslalg::BidirectionalLink *createNode();
-        // Allocate a node of the type 'BidirectionalNode<VALUE>', and default
-        // construct an object of the (template parameter) type 'VALUE' at the
-        // 'value' attribute of the node.  Return the address of the Node.
-        // Note that the 'next' and 'prev' attributes of the returned node will
-        // be uninitialized.
+        // Allocate a node of the (template parameter) type 'NODE', and
+        // default construct an object of the (template parameter) type 'VALUE'
+        // at the 'value' attribute of the node.  Return the address of the
+        // Node.  Note that the 'next' and 'prev' attributes of the returned
+        // node will be uninitialized.
 
     template <class SOURCE>
     bslalg::BidirectionalLink *createNode(const SOURCE& value);
-        // Allocate a node of the type 'BidirectionalNode<VALUE>', and
+        // Allocate a node of the (template parameter) type 'NODE', and
         // construct an object of the (template parameter) type 'VALUE', using
         // its single-argument constructor passing the specified 'value' as the
         // argument, at the 'value' attribute of the node.  Return the address
@@ -293,7 +320,7 @@ class BidirectionalNodePool {
     template <class FIRST_ARG, class SECOND_ARG>
     bslalg::BidirectionalLink *createNode(const FIRST_ARG&  first,
                                           const SECOND_ARG& second);
-        // Allocate a node of the type 'BidirectionalNode<VALUE>', and
+        // Allocate a node of the (template parameter) type 'NODE', and
         // construct an object of the (template parameter) type 'VALUE', using
         // its two-arguments constructor passing the specified 'first' as the
         // first argument and the specified 'second' as the second argument, at
@@ -301,26 +328,124 @@ class BidirectionalNodePool {
         // Note that the 'next' and 'prev' attributes of the returned node will
         // be uninitialized.
 
+    template <class FIRST_ARG>
+    bslalg::BidirectionalLink *createNodePiecewise(const FIRST_ARG& first);
+
+    template <class FIRST_ARG, class ARG_1>
+    bslalg::BidirectionalLink *createNodePiecewise(
+                                const FIRST_ARG&                         first,
+                                BSLS_COMPILERFEATURES_FORWARD_REF(ARG_1) arg1);
+
+    template <class FIRST_ARG, class ARG_1, class ARG_2>
+    bslalg::BidirectionalLink *createNodePiecewise(
+                                const FIRST_ARG&                         first,
+                                BSLS_COMPILERFEATURES_FORWARD_REF(ARG_1) arg1,
+                                BSLS_COMPILERFEATURES_FORWARD_REF(ARG_2) arg2);
+
+    template <class FIRST_ARG, class ARG_1, class ARG_2, class ARG_3>
+    bslalg::BidirectionalLink *createNodePiecewise(
+                                const FIRST_ARG&                         first,
+                                BSLS_COMPILERFEATURES_FORWARD_REF(ARG_1) arg1,
+                                BSLS_COMPILERFEATURES_FORWARD_REF(ARG_2) arg2,
+                                BSLS_COMPILERFEATURES_FORWARD_REF(ARG_3) arg3);
+        // Allocate a node of the (template parameter) type 'NODE', and
+        // construct the 'value' attribute of the node, which must be a
+        // 'bsl::pair' (or have compatible 'first' and 'second' members),
+        // piecewise: its 'first' member from the specified 'first', and its
+        // 'second' member from the optionally specified 'arg1', 'arg2', and
+        // 'arg3', or value-initialized if no such arguments are supplied.
+        // Both members are constructed through the allocator traits of
+        // 'allocator()', and no temporary 'VALUE' is created.  Return the
+        // address of the node.  Note that the 'next' and 'prev' attributes of
+        // the returned node will be uninitialized.
+
     bslalg::BidirectionalLink *cloneNode(
                                     const bslalg::BidirectionalLink& original);
-        // Allocate a node of the type 'BidirectionalNode<VALUE>', and
+        // Allocate a node of the (template parameter) type 'NODE', and
         // copy-construct an object of the (template parameter) type 'VALUE'
         // having the same value as the specified 'original' at the 'value'
         // attribute of the node.  Return the address of the node.  Note that
         // the 'next' and 'prev' attributes of the returned node will be
         // uninitialized.
 
+    bslalg::BidirectionalLink *createNodeByRelocation(
+                                                 VALUE *original,
+                                                 bool   isSameAllocator);
+        // Allocate a node of the (template parameter) type 'NODE', and
+        // relocate the object at the specified 'original' address to the
+        // 'value' attribute of the node, ending the lifetime of that object
+        // (see 'NodeHandleUtil::relocate').  Return the address of the node.
+        // The specified 'isSameAllocator' indicates whether the object at
+        // 'original' was created using an allocator that compares equal to
+        // 'allocator()'.  If an exception is thrown, the object at 'original'
+        // is unchanged.  Note that the 'next' and 'prev' attributes of the
+        // returned node will be uninitialized.
+
+    bslalg::BidirectionalLink *createDetachedNode(
+                                         bslalg::BidirectionalLink *original);
+        // Allocate a detached node of the (template parameter) type 'NODE',
+        // which is not owned by this pool (see
+        // {'bslstl_simplepool'|Detached Blocks}), relocate the 'value'
+        // attribute of the specified 'original' node to the 'value' attribute
+        // of the new node, ending the lifetime of that object (see
+        // 'NodeHandleUtil::relocate'), and return the address of the new
+        // node.  The memory footprint of 'original' is left to the caller to
+        // deallocate (see 'deallocateNode').  If an exception is thrown, no
+        // memory is allocated and 'original' is unchanged.  The behavior is
+        // undefined unless 'original' refers to a 'NODE' that was allocated by
+        // this pool.  Note that the returned node is intended to be owned by
+        // a 'NodeHandle', that its memory remains valid after this pool is
+        // released, and that its 'next' and 'prev' attributes will be
+        // uninitialized.
+
+    void adoptNode(bslalg::BidirectionalLink *linkNode);
+        // Take over the ownership of the specified detached 'linkNode', and
+        // of its 'value' attribute, so that 'linkNode' may later be deleted
+        // (or deallocated) by this pool (see
+        // {'bslstl_simplepool'|Detached Blocks}).  This method does not
+        // allocate memory, and provides the no-throw exception-safety
+        // guarantee.  The behavior is undefined unless 'linkNode' refers to a
+        // 'NODE' created by 'createDetachedNode' from a pool whose allocator
+        // compares equal to 'allocator()', and is not owned by a pool.
+
+    void deallocateNode(bslalg::BidirectionalLink *linkNode);
+        // Return the memory footprint of the specified 'linkNode' to this pool
+        // for potential reuse without destroying its 'VALUE' attribute, whose
+        // lifetime must already have ended (e.g., by relocating it).  The
+        // behavior is undefined unless 'linkNode' refers to a 'NODE' that was
+        // allocated by this pool.
+
     void deleteNode(bslalg::BidirectionalLink *linkNode);
         // Destroy the 'VALUE' attribute of the specified 'linkNode' and return
         // the memory footprint of 'linkNode' to this pool for potential reuse.
-        // The behavior is undefined unless 'node' refers to a
-        // 'bslalg::BidirectionalNode<VALUE>' that was allocated by this pool.
+        // The behavior is undefined unless 'node' refers to a 'NODE' that was
+        // allocated by this pool.
 
     void reserveNodes(size_type numNodes);
         // Reserve memory from this pool to satisfy memory requests for at
         // least the specified 'numNodes' before the pool replenishes.  The
         // behavior is undefined unless '0 < numNodes'.
 
+    template <class NODE_HANDLE>
+    bslalg::BidirectionalLink *takeNode(NODE_HANDLE *handle,
+                                        bool         isSameAllocator);
+        // Take over the node owned by the specified 'handle', make 'handle'
+        // empty, and return the address of the node holding the element of
+        // 'handle'.  The specified 'isSameAllocator' indicates whether the
+        // element of 'handle' was created using an allocator that compares
+        // equal to 'allocator()'.  If 'isSameAllocator' is 'true' and this
+        // pool has no free node, the node of 'handle' is adopted (see
+        // 'adoptNode'), so that the element keeps its address and no memory is
+        // allocated; otherwise, the element is relocated into a node of this
+        // pool (see 'createNodeByRelocation'), and the node of 'handle' is
+        // returned to the allocator of 'handle', so that adopting nodes never
+        // makes this pool hold more nodes than it has had in use at once.  If
+        // an exception is thrown, this pool and 'handle' are unchanged.  The
+        // behavior is undefined unless 'handle' is a non-empty
+        // 'bslstl::NodeHandle' whose nodes have the type 'NODE'.  Note that
+        // the 'next' and 'prev' attributes of the returned node will be
+        // uninitialized.
+
     void swapRetainAllocators(BidirectionalNodePool& other);
         // Efficiently exchange the nodes of this object with those of the
         // specified 'other' object.  This method provides the no-throw
@@ -341,9 +466,9 @@ class BidirectionalNodePool {
 };
 
 // FREE FUNCTIONS
-template <class VALUE, class ALLOCATOR>
-void swap(BidirectionalNodePool<VALUE, ALLOCATOR>& a,
-          BidirectionalNodePool<VALUE, ALLOCATOR>& b);
+template <class VALUE, class ALLOCATOR, class NODE>
+void swap(BidirectionalNodePool<VALUE, ALLOCATOR, NODE>& a,
+          BidirectionalNodePool<VALUE, ALLOCATOR, NODE>& b);
         // Efficiently exchange the nodes of the specified 'a' object with
         // those of the specified 'b' object.  This method provides the
         // no-throw exception-safety guarantee.  The behavior is undefined
@@ -361,8 +486,9 @@ void swap(BidirectionalNodePool<VALUE, ALLOCATOR>& a,
 
 namespace bslmf {
 
-template <class VALUE, class ALLOCATOR>
-struct IsBitwiseMoveable<bslstl::BidirectionalNodePool<VALUE, ALLOCATOR> >
+template <class VALUE, class ALLOCATOR, class NODE>
+struct IsBitwiseMoveable<
+                       bslstl::BidirectionalNodePool<VALUE, ALLOCATOR, NODE> >
 : bsl::integral_constant<bool, bslmf::IsBitwiseMoveable<ALLOCATOR>::value>
 {};
 
@@ -375,30 +501,29 @@ struct IsBitwiseMoveable<bslstl::BidirectionalNodePool<VALUE, ALLOCATOR> >
 namespace bslstl {
 
 // CREATORS
-template <class VALUE, class ALLOCATOR>
+template <class VALUE, class ALLOCATOR, class NODE>
 inline
-BidirectionalNodePool<VALUE, ALLOCATOR>::BidirectionalNodePool(
+BidirectionalNodePool<VALUE, ALLOCATOR, NODE>::BidirectionalNodePool(
                                                     const ALLOCATOR& allocator)
 : d_pool(allocator)
 {
 }
 
 // MANIPULATORS
-template <class VALUE, class ALLOCATOR>
+template <class VALUE, class ALLOCATOR, class NODE>
 inline
-typename SimplePool<bslalg::BidirectionalNode<VALUE>, ALLOCATOR>::
-                                                                 AllocatorType&
-BidirectionalNodePool<VALUE, ALLOCATOR>::allocator()
+typename SimplePool<NODE, ALLOCATOR>::AllocatorType&
+BidirectionalNodePool<VALUE, ALLOCATOR, NODE>::allocator()
 {
     return d_pool.allocator();
 }
 
-template <class VALUE, class ALLOCATOR>
+template <class VALUE, class ALLOCATOR, class NODE>
 inline
 bslalg::BidirectionalLink *
-BidirectionalNodePool<VALUE, ALLOCATOR>::createNode()
+BidirectionalNodePool<VALUE, ALLOCATOR, NODE>::createNode()
 {
-    bslalg::BidirectionalNode<VALUE> *node = d_pool.allocate();
+    NODE *node = d_pool.allocate();
     bslma::DeallocatorProctor<Pool> proctor(node, &d_pool);
 
     AllocatorTraits::construct(allocator(),
@@ -408,13 +533,13 @@ BidirectionalNodePool<VALUE, ALLOCATOR>::createNode()
     return node;
 }
 
-template <class VALUE, class ALLOCATOR>
+template <class VALUE, class ALLOCATOR, class NODE>
 template <class SOURCE>
 inline
 bslalg::BidirectionalLink *
-BidirectionalNodePool<VALUE, ALLOCATOR>::createNode(const SOURCE& value)
+BidirectionalNodePool<VALUE, ALLOCATOR, NODE>::createNode(const SOURCE& value)
 {
-    bslalg::BidirectionalNode<VALUE> *node = d_pool.allocate();
+    NODE *node = d_pool.allocate();
     bslma::DeallocatorProctor<Pool> proctor(node, &d_pool);
 
     AllocatorTraits::construct(allocator(),
@@ -424,14 +549,15 @@ BidirectionalNodePool<VALUE, ALLOCATOR>::createNode(const SOURCE& value)
     return node;
 }
 
-template <class VALUE, class ALLOCATOR>
+template <class VALUE, class ALLOCATOR, class NODE>
 template <class FIRST_ARG, class SECOND_ARG>
 inline
 bslalg::BidirectionalLink *
-BidirectionalNodePool<VALUE, ALLOCATOR>::createNode(const FIRST_ARG&  first,
+BidirectionalNodePool<VALUE, ALLOCATOR, NODE>::createNode(
+                                                    const FIRST_ARG&  first,
                                                     const SECOND_ARG& second)
 {
-    bslalg::BidirectionalNode<VALUE> *node = d_pool.allocate();
+    NODE *node = d_pool.allocate();
     bslma::DeallocatorProctor<Pool> proctor(node, &d_pool);
 
     AllocatorTraits::construct(allocator(),
@@ -442,74 +568,266 @@ BidirectionalNodePool<VALUE, ALLOCATOR>::createNode(const FIRST_ARG&  first,
     return node;
 }
 
-template <class VALUE, class ALLOCATOR>
+template <class VALUE, class ALLOCATOR, class NODE>
+template <class FIRST_ARG>
+inline
+bslalg::BidirectionalLink *
+BidirectionalNodePool<VALUE, ALLOCATOR, NODE>::createNodePiecewise(
+                                                        const FIRST_ARG& first)
+{
+    typedef typename bsl::remove_const<typename VALUE::first_type>::type
+                                                                     FirstType;
+
+    NODE *node = d_pool.allocate();
+    bslma::DeallocatorProctor<Pool> proctor(node, &d_pool);
+
+    FirstType *firstAddress = const_cast<FirstType *>(
+                                   bsls::Util::addressOf(node->value().first));
+    AllocatorTraits::construct(allocator(), firstAddress, first);
+    bslma::DestructorProctor<FirstType> firstProctor(firstAddress);
+
+    AllocatorTraits::construct(allocator(),
+                               bsls::Util::addressOf(node->value().second));
+    firstProctor.release();
+    proctor.release();
+    return node;
+}
+
+template <class VALUE, class ALLOCATOR, class NODE>
+template <class FIRST_ARG, class ARG_1>
+inline
+bslalg::BidirectionalLink *
+BidirectionalNodePool<VALUE, ALLOCATOR, NODE>::createNodePiecewise(
+                                const FIRST_ARG&                         first,
+                                BSLS_COMPILERFEATURES_FORWARD_REF(ARG_1) arg1)
+{
+    typedef typename bsl::remove_const<typename VALUE::first_type>::type
+                                                                     FirstType;
+
+    NODE *node = d_pool.allocate();
+    bslma::DeallocatorProctor<Pool> proctor(node, &d_pool);
+
+    FirstType *firstAddress = const_cast<FirstType *>(
+                                   bsls::Util::addressOf(node->value().first));
+    AllocatorTraits::construct(allocator(), firstAddress, first);
+    bslma::DestructorProctor<FirstType> firstProctor(firstAddress);
+
+    AllocatorTraits::construct(allocator(),
+                               bsls::Util::addressOf(node->value().second),
+                               BSLS_COMPILERFEATURES_FORWARD(ARG_1, arg1));
+    firstProctor.release();
+    proctor.release();
+    return node;
+}
+
+template <class VALUE, class ALLOCATOR, class NODE>
+template <class FIRST_ARG, class ARG_1, class ARG_2>
+inline
+bslalg::BidirectionalLink *
+BidirectionalNodePool<VALUE, ALLOCATOR, NODE>::createNodePiecewise(
+                                const FIRST_ARG&                         first,
+                                BSLS_COMPILERFEATURES_FORWARD_REF(ARG_1) arg1,
+                                BSLS_COMPILERFEATURES_FORWARD_REF(ARG_2) arg2)
+{
+    typedef typename bsl::remove_const<typename VALUE::first_type>::type
+                                                                     FirstType;
+
+    NODE *node = d_pool.allocate();
+    bslma::DeallocatorProctor<Pool> proctor(node, &d_pool);
+
+    FirstType *firstAddress = const_cast<FirstType *>(
+                                   bsls::Util::addressOf(node->value().first));
+    AllocatorTraits::construct(allocator(), firstAddress, first);
+    bslma::DestructorProctor<FirstType> firstProctor(firstAddress);
+
+    AllocatorTraits::construct(allocator(),
+                               bsls::Util::addressOf(node->value().second),
+                               BSLS_COMPILERFEATURES_FORWARD(ARG_1, arg1),
+                               BSLS_COMPILERFEATURES_FORWARD(ARG_2, arg2));
+    firstProctor.release();
+    proctor.release();
+    return node;
+}
+
+template <class VALUE, class ALLOCATOR, class NODE>
+template <class FIRST_ARG, class ARG_1, class ARG_2, class ARG_3>
 inline
 bslalg::BidirectionalLink *
-BidirectionalNodePool<VALUE, ALLOCATOR>::cloneNode(
+BidirectionalNodePool<VALUE, ALLOCATOR, NODE>::createNodePiecewise(
+                                const FIRST_ARG&                         first,
+                                BSLS_COMPILERFEATURES_FORWARD_REF(ARG_1) arg1,
+                                BSLS_COMPILERFEATURES_FORWARD_REF(ARG_2) arg2,
+                                BSLS_COMPILERFEATURES_FORWARD_REF(ARG_3) arg3)
+{
+    typedef typename bsl::remove_const<typename VALUE::first_type>::type
+                                                                     FirstType;
+
+    NODE *node = d_pool.allocate();
+    bslma::DeallocatorProctor<Pool> proctor(node, &d_pool);
+
+    FirstType *firstAddress = const_cast<FirstType *>(
+                                   bsls::Util::addressOf(node->value().first));
+    AllocatorTraits::construct(allocator(), firstAddress, first);
+    bslma::DestructorProctor<FirstType> firstProctor(firstAddress);
+
+    AllocatorTraits::construct(allocator(),
+                               bsls::Util::addressOf(node->value().second),
+                               BSLS_COMPILERFEATURES_FORWARD(ARG_1, arg1),
+                               BSLS_COMPILERFEATURES_FORWARD(ARG_2, arg2),
+                               BSLS_COMPILERFEATURES_FORWARD(ARG_3, arg3));
+    firstProctor.release();
+    proctor.release();
+    return node;
+}
+
+template <class VALUE, class ALLOCATOR, class NODE>
+inline
+bslalg::BidirectionalLink *
+BidirectionalNodePool<VALUE, ALLOCATOR, NODE>::cloneNode(
                                      const bslalg::BidirectionalLink& original)
 {
     return createNode(static_cast<const bslalg::BidirectionalNode<VALUE>&>
                                                            (original).value());
 }
 
-template <class VALUE, class ALLOCATOR>
+template <class VALUE, class ALLOCATOR, class NODE>
 inline
-void BidirectionalNodePool<VALUE, ALLOCATOR>::deleteNode(
+bslalg::BidirectionalLink *
+BidirectionalNodePool<VALUE, ALLOCATOR, NODE>::createNodeByRelocation(
+                                                 VALUE *original,
+                                                 bool   isSameAllocator)
+{
+    BSLS_ASSERT_SAFE(original);
+
+    NODE *node = d_pool.allocate();
+    bslma::DeallocatorProctor<Pool> proctor(node, &d_pool);
+
+    NodeHandleUtil::relocate(bsls::Util::addressOf(node->value()),
+                             original,
+                             &allocator(),
+                             isSameAllocator);
+    proctor.release();
+    return node;
+}
+
+template <class VALUE, class ALLOCATOR, class NODE>
+inline
+bslalg::BidirectionalLink *
+BidirectionalNodePool<VALUE, ALLOCATOR, NODE>::createDetachedNode(
+                                           bslalg::BidirectionalLink *original)
+{
+    BSLS_ASSERT_SAFE(original);
+
+    NODE *node = d_pool.allocateDetached();
+    SimplePool_DetachedProctor<NODE, ALLOCATOR> proctor(node, &d_pool);
+
+    NODE *originalNode = static_cast<NODE *>(original);
+    NodeHandleUtil::relocate(bsls::Util::addressOf(node->value()),
+                             bsls::Util::addressOf(originalNode->value()),
+                             &allocator(),
+                             true);
+    proctor.release();
+    return node;
+}
+
+template <class VALUE, class ALLOCATOR, class NODE>
+inline
+void BidirectionalNodePool<VALUE, ALLOCATOR, NODE>::adoptNode(
+                                           bslalg::BidirectionalLink *linkNode)
+{
+    BSLS_ASSERT(linkNode);
+
+    d_pool.adoptDetached(static_cast<NODE *>(linkNode));
+}
+
+template <class VALUE, class ALLOCATOR, class NODE>
+inline
+void BidirectionalNodePool<VALUE, ALLOCATOR, NODE>::deallocateNode(
                                            bslalg::BidirectionalLink *linkNode)
 {
     BSLS_ASSERT(linkNode);
 
-    bslalg::BidirectionalNode<VALUE> *node =
-                     static_cast<bslalg::BidirectionalNode<VALUE> *>(linkNode);
+    d_pool.deallocate(static_cast<NODE *>(linkNode));
+}
+
+template <class VALUE, class ALLOCATOR, class NODE>
+inline
+void BidirectionalNodePool<VALUE, ALLOCATOR, NODE>::deleteNode(
+                                           bslalg::BidirectionalLink *linkNode)
+{
+    BSLS_ASSERT(linkNode);
+
+    NODE *node = static_cast<NODE *>(linkNode);
     AllocatorTraits::destroy(allocator(),
                              bsls::Util::addressOf(node->value()));
     d_pool.deallocate(node);
 }
 
-template <class VALUE, class ALLOCATOR>
+template <class VALUE, class ALLOCATOR, class NODE>
 inline
-void BidirectionalNodePool<VALUE, ALLOCATOR>::reserveNodes(size_type numNodes)
+void BidirectionalNodePool<VALUE, ALLOCATOR, NODE>::reserveNodes(
+                                                            size_type numNodes)
 {
     BSLS_ASSERT_SAFE(0 < numNodes);
 
     d_pool.reserve(numNodes);
 }
 
-template <class VALUE, class ALLOCATOR>
+template <class VALUE, class ALLOCATOR, class NODE>
+template <class NODE_HANDLE>
+bslalg::BidirectionalLink *
+BidirectionalNodePool<VALUE, ALLOCATOR, NODE>::takeNode(
+                                                 NODE_HANDLE *handle,
+                                                 bool         isSameAllocator)
+{
+    BSLS_ASSERT_SAFE(handle);
+    BSLS_ASSERT_SAFE(!handle->empty());
+
+    if (isSameAllocator && !d_pool.hasFreeBlocks()) {
+        adoptNode(handle->node());
+        return handle->releaseNode();                                 // RETURN
+    }
+
+    bslalg::BidirectionalLink *node = createNodeByRelocation(
+                                        bsls::Util::addressOf(handle->value()),
+                                        isSameAllocator);
+    handle->releaseValue();
+    return node;
+}
+
+template <class VALUE, class ALLOCATOR, class NODE>
 inline
-void BidirectionalNodePool<VALUE, ALLOCATOR>::swapRetainAllocators(
-                                BidirectionalNodePool<VALUE, ALLOCATOR>& other)
+void BidirectionalNodePool<VALUE, ALLOCATOR, NODE>::swapRetainAllocators(
+                          BidirectionalNodePool<VALUE, ALLOCATOR, NODE>& other)
 {
     BSLS_ASSERT_SAFE(allocator() == other.allocator());
 
     d_pool.quickSwapRetainAllocators(other.d_pool);
 }
 
-template <class VALUE, class ALLOCATOR>
+template <class VALUE, class ALLOCATOR, class NODE>
 inline
-void BidirectionalNodePool<VALUE, ALLOCATOR>::swapExchangeAllocators(
-                                BidirectionalNodePool<VALUE, ALLOCATOR>& other)
+void BidirectionalNodePool<VALUE, ALLOCATOR, NODE>::swapExchangeAllocators(
+                          BidirectionalNodePool<VALUE, ALLOCATOR, NODE>& other)
 {
     d_pool.quickSwapExchangeAllocators(other.d_pool);
 }
 
 // ACCESSORS
-template <class VALUE, class ALLOCATOR>
+template <class VALUE, class ALLOCATOR, class NODE>
 inline
-const typename
-              SimplePool<bslalg::BidirectionalNode<VALUE>, ALLOCATOR>::
-                                                                 AllocatorType&
-BidirectionalNodePool<VALUE, ALLOCATOR>::allocator() const
+const typename SimplePool<NODE, ALLOCATOR>::AllocatorType&
+BidirectionalNodePool<VALUE, ALLOCATOR, NODE>::allocator() const
 {
     return d_pool.allocator();
 }
 
 }  // close namespace bslstl
 
-template <class VALUE, class ALLOCATOR>
+template <class VALUE, class ALLOCATOR, class NODE>
 inline
-void bslstl::swap(bslstl::BidirectionalNodePool<VALUE, ALLOCATOR>& a,
-                  bslstl::BidirectionalNodePool<VALUE, ALLOCATOR>& b)
+void bslstl::swap(bslstl::BidirectionalNodePool<VALUE, ALLOCATOR, NODE>& a,
+                  bslstl::BidirectionalNodePool<VALUE, ALLOCATOR, NODE>& b)
 {
     a.swapRetainAllocators(b);
 }
@@ -2,7 +2,10 @@
 #include <bslstl_bidirectionalnodepool.h>
 
 #include <bslstl_allocator.h>
+#include <bslstl_nodehandle.h>
+#include <bslstl_pair.h>
 
+#include <bslalg_bidirectionalhashednode.h>
 #include <bslalg_bidirectionallink.h>
 #include <bslalg_bidirectionallinklistutil.h>
 #include <bslalg_bidirectionalnode.h>
@@ -14,10 +17,13 @@
 #include <bslma_testallocatormonitor.h>
 #include <bslma_usesbslmaallocator.h>
 
+#include <bslmf_nestedtraitdeclaration.h>
+
 #include <bsls_assert.h>
 #include <bsls_asserttest.h>
 #include <bsls_bsltestutil.h>
 
+#include <bsltf_alloctesttype.h>
 #include <bsltf_stdtestallocator.h>
 #include <bsltf_templatetestfacility.h>
 #include <bsltf_testvaluesarray.h>
@@ -83,6 +89,12 @@ using namespace bslstl;
 // [ 7] bslalg::BidirectionalLink *createNode(const VALUE& value);
 // [ 8] bslalg::BidirectionalLink *createNode(first, second);
 // [ 9] bslalg::BidirectionalLink *cloneNode(const BidirectionalLink&);
+// [13] bslalg::BidirectionalLink *createNodeByRelocation(VALUE *, bool);
+// [13] void deallocateNode(bslalg::BidirectionalLink *linkNode);
+// [13] BidirectionalLink *createDetachedNode(BidirectionalLink *);
+// [13] void adoptNode(bslalg::BidirectionalLink *);
+// [13] bslalg::BidirectionalLink *takeNode(NODE_HANDLE *, bool);
+// [14] createNodePiecewise(const FIRST_ARG& first, ARGS&&... args);
 // [ 5] void deleteNode(bslalg::BidirectionalLink *node);
 // [ 6] void reserveNodes(std::size_t numNodes);
 // [10] void swapRetainAllocators(other);
@@ -95,6 +107,8 @@ using namespace bslstl;
 // [10] void swap(BidirectionalNodePool& a, b);
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
+// [12] CONCERN: Node types derived from 'BidirectionalNode' supported.
+// [15] USAGE EXAMPLE
 // [ *] CONCERN: No memory is ever allocated from the global allocator.
 //-----------------------------------------------------------------------------
 //=============================================================================
@@ -195,6 +209,111 @@ bool expectToAllocate(size_t n)
 
 }  // close unnamed namespace
 
+                            // ==================
+                            // class EmplacedType
+                            // ==================
+
+class EmplacedType {
+    // This allocator-aware test type records the number of 'int' arguments it
+    // was constructed from, the sum of those arguments, and the allocator it
+    // was supplied, and counts the objects created by copy construction.
+    // Constructing an object from a negative first argument throws that
+    // argument as an exception.
+
+    // CLASS DATA
+    static int        s_numCopies;    // number of copy-constructed objects
+
+    // DATA
+    int               d_numArgs;      // number of constructor arguments
+    int               d_sum;          // sum of constructor arguments
+    bslma::Allocator *d_allocator_p;  // allocator supplied (held)
+
+    // PRIVATE CLASS METHODS
+    static void throwIfNegative(int value)
+        // Throw the specified 'value' if it is negative and exceptions are
+        // enabled.
+    {
+#ifdef BDE_BUILD_TARGET_EXC
+        if (value < 0) {
+            throw value;
+        }
+#else
+        (void) value;
+#endif
+    }
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(EmplacedType, bslma::UsesBslmaAllocator);
+
+    // CLASS METHODS
+    static int numCopies()
+        // Return the number of 'EmplacedType' objects created by copy
+        // construction since the start of the program.
+    {
+        return s_numCopies;
+    }
+
+    // CREATORS
+    explicit EmplacedType(bslma::Allocator *basicAllocator = 0)
+    : d_numArgs(0)
+    , d_sum(0)
+    , d_allocator_p(bslma::Default::allocator(basicAllocator))
+    {
+    }
+
+    explicit EmplacedType(int a1, bslma::Allocator *basicAllocator = 0)
+    : d_numArgs(1)
+    , d_sum(a1)
+    , d_allocator_p(bslma::Default::allocator(basicAllocator))
+    {
+        throwIfNegative(a1);
+    }
+
+    EmplacedType(int a1, int a2, bslma::Allocator *basicAllocator = 0)
+    : d_numArgs(2)
+    , d_sum(a1 + a2)
+    , d_allocator_p(bslma::Default::allocator(basicAllocator))
+    {
+        throwIfNegative(a1);
+    }
+
+    EmplacedType(int               a1,
+                 int               a2,
+                 int               a3,
+                 bslma::Allocator *basicAllocator = 0)
+    : d_numArgs(3)
+    , d_sum(a1 + a2 + a3)
+    , d_allocator_p(bslma::Default::allocator(basicAllocator))
+    {
+        throwIfNegative(a1);
+    }
+
+    EmplacedType(const EmplacedType&  original,
+                 bslma::Allocator    *basicAllocator = 0)
+    : d_numArgs(original.d_numArgs)
+    , d_sum(original.d_sum)
+    , d_allocator_p(bslma::Default::allocator(basicAllocator))
+    {
+        ++s_numCopies;
+    }
+
+    // MANIPULATORS
+    EmplacedType& operator=(const EmplacedType& rhs)
+    {
+        d_numArgs = rhs.d_numArgs;
+        d_sum     = rhs.d_sum;
+        return *this;
+    }
+
+    // ACCESSORS
+    bslma::Allocator *allocator() const { return d_allocator_p; }
+    int numArgs() const                 { return d_numArgs; }
+    int sum() const                     { return d_sum; }
+};
+
+int EmplacedType::s_numCopies = 0;
+
 //=============================================================================
 //                               TEST FACILITIES
 //-----------------------------------------------------------------------------
@@ -472,6 +591,12 @@ class TestDriver {
 
   public:
     // TEST CASES
+    static void testCase14();
+        // Test 'createNodePiecewise'.
+
+    static void testCase13();
+        // Test 'createNodeByRelocation' and 'deallocateNode'.
+
     static void testCase11();
         // Test type traits.
 
@@ -556,6 +681,349 @@ void TestDriver<VALUE>::createFreeBlocks(Obj   *result,
     }
 }
 
+template<class VALUE>
+void TestDriver<VALUE>::testCase14()
+{
+    // --------------------------------------------------------------------
+    // MANIPULATOR 'createNodePiecewise'
+    //
+    // Concerns:
+    //: 1 The 'first' member of the new node value is copy-constructed from
+    //:   the first argument, and its 'second' member is constructed from the
+    //:   remaining arguments (or value-initialized if there are none).
+    //:
+    //: 2 Both members are supplied with the allocator of the pool, and no
+    //:   memory is allocated from the default allocator.
+    //:
+    //: 3 No temporary value is created: the 'second' member is never
+    //:   copy-constructed.
+    //:
+    //: 4 If constructing the 'second' member throws, the 'first' member is
+    //:   destroyed, the node is returned to the pool, and no memory is
+    //:   leaked.
+    //
+    // Plan:
+    //: 1 Using a pool of 'bsl::pair<const VALUE, EmplacedType>', create a
+    //:   node with each number of mapped arguments, and verify the members of
+    //:   its value, the allocators they hold, and the number of copies of
+    //:   'EmplacedType' made.  (C-1..3)
+    //:
+    //: 2 Supply a negative first mapped argument, so that the constructor of
+    //:   'EmplacedType' throws, and verify that the memory in use is
+    //:   unchanged.  (C-4)
+    //
+    // Testing:
+    //   createNodePiecewise(const FIRST_ARG& first, ARGS&&... args);
+    // --------------------------------------------------------------------
+
+    if (verbose) printf("\nMANIPULATOR 'createNodePiecewise'"
+                        "\n=================================\n");
+
+    typedef bsl::pair<const VALUE, EmplacedType>         PairType;
+    typedef bslstl::BidirectionalNodePool<PairType,
+                                          bsl::allocator<PairType> >
+                                                         PairPool;
+    typedef bslalg::BidirectionalNode<PairType>          PairNode;
+
+    const int TYPE_ALLOC = bslma::UsesBslmaAllocator<VALUE>::value;
+
+    const int NUM_VALUES = 4;
+
+    bslma::TestAllocator da("default", veryVeryVeryVerbose);
+    bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+
+    bslma::DefaultAllocatorGuard dag(&da);
+
+    {
+        bsltf::TestValuesArray<VALUE> VALUES;
+
+        PairPool mX(&oa);
+        mX.reserveNodes(NUM_VALUES + 1);
+
+        Stack used;
+
+        for (int numArgs = 0; numArgs < NUM_VALUES; ++numArgs) {
+            const VALUE& K = VALUES[numArgs];
+
+            const int NUM_COPIES = EmplacedType::numCopies();
+
+            bslma::TestAllocatorMonitor oam(&oa);
+
+            Link *node = 0;
+            switch (numArgs) {
+              case 0: node = mX.createNodePiecewise(K);          break;
+              case 1: node = mX.createNodePiecewise(K, 1);       break;
+              case 2: node = mX.createNodePiecewise(K, 1, 2);    break;
+              case 3: node = mX.createNodePiecewise(K, 1, 2, 3); break;
+            }
+
+            const PairType& P = static_cast<PairNode *>(node)->value();
+
+            ASSERTV(numArgs, K       == P.first);
+            ASSERTV(numArgs, numArgs == P.second.numArgs());
+            ASSERTV(numArgs, P.second.sum(),
+                    numArgs * (numArgs + 1) / 2 == P.second.sum());
+            ASSERTV(numArgs, &oa     == P.second.allocator());
+            ASSERTV(numArgs, TYPE_ALLOC == oam.numBlocksInUseChange());
+            ASSERTV(numArgs, NUM_COPIES == EmplacedType::numCopies());
+
+            used.push(node);
+        }
+
+#ifdef BDE_BUILD_TARGET_EXC
+        {
+            bslma::TestAllocatorMonitor oam(&oa);
+
+            bool caught = false;
+            try {
+                mX.createNodePiecewise(VALUES[NUM_VALUES], -1, 2);
+            }
+            catch (int) {
+                caught = true;
+            }
+            ASSERT(caught);
+            ASSERT(oam.isInUseSame());
+
+            // The node is returned to the pool and reused.
+
+            used.push(mX.createNodePiecewise(VALUES[NUM_VALUES], 1));
+            ASSERTV(oam.numBlocksTotalChange(),
+                    2 * TYPE_ALLOC == oam.numBlocksTotalChange());
+        }
+#endif
+
+        while (!used.empty()) {
+            mX.deleteNode(used.back());
+            used.pop();
+        }
+    }
+
+    // Verify all memory is released on object destruction.
+
+    ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+    ASSERTV(da.numBlocksTotal(), 0 == da.numBlocksTotal());
+}
+
+template<class VALUE>
+void TestDriver<VALUE>::testCase13()
+{
+    // --------------------------------------------------------------------
+    // MANIPULATORS 'createNodeByRelocation' and 'deallocateNode'
+    //
+    // Concerns:
+    //: 1 'createNodeByRelocation' creates a node holding the value of the
+    //:   original object, and ends the lifetime of the original.
+    //:
+    //: 2 If 'VALUE' is bitwise moveable and 'isSameAllocator' is 'true', the
+    //:   value is relocated without allocating or deallocating memory.
+    //:
+    //: 3 Otherwise, the value is copied using the allocator of the pool, and
+    //:   the memory of the original object is released.
+    //:
+    //: 4 'deallocateNode' returns a node to the pool without destroying its
+    //:   value.
+    //:
+    //: 5 No memory is leaked, and every value is destroyed once.
+    //:
+    //: 6 'createDetachedNode' relocates the value of a node into a new node,
+    //:   allocated in a single block, that remains valid after its pool is
+    //:   destroyed.
+    //:
+    //: 7 A detached node can be adopted by another pool, by 'adoptNode' or by
+    //:   'takeNode' (if 'isSameAllocator' and the pool has no free node),
+    //:   without allocating memory and without moving its value, and is then
+    //:   deleted by that pool, and deallocated when that pool is destroyed.
+    //:
+    //: 8 'takeNode' relocates the value into a node of the pool, reusing a
+    //:   free node if any, if 'isSameAllocator' is 'false' or the pool has a
+    //:   free node, and deallocates the detached node.
+    //
+    // Plan:
+    //: 1 Create nodes in a pool, and relocate the value of each node into a
+    //:   node of the same pool (reserved beforehand), and into a node of a
+    //:   pool using another allocator, then deallocate the original node
+    //:   with 'deallocateNode'.  Verify the values of the new nodes and,
+    //:   using test allocator monitors, the memory allocated.  (C-1..4)
+    //:
+    //: 2 Delete the remaining nodes, and verify that no memory is in use.
+    //:   (C-5)
+    //:
+    //: 3 Detach the value of a node into a 'bslstl::NodeHandle', destroy the
+    //:   pool, and insert the node into another pool with 'takeNode'.
+    //:   Verify the address of the node and of its value, and the memory
+    //:   allocated.  Repeat with 'adoptNode', with a pool having free
+    //:   nodes, and with a pool using another allocator.  (C-6..8)
+    //
+    // Testing:
+    //   bslalg::BidirectionalLink *createNodeByRelocation(VALUE *, bool);
+    //   void deallocateNode(bslalg::BidirectionalLink *linkNode);
+    //   BidirectionalLink *createDetachedNode(BidirectionalLink *);
+    //   void adoptNode(bslalg::BidirectionalLink *);
+    //   bslalg::BidirectionalLink *takeNode(NODE_HANDLE *, bool);
+    // --------------------------------------------------------------------
+
+    if (verbose) printf("\nMANIPULATOR 'createNodeByRelocation'"
+                        "\n====================================\n");
+
+    const int TYPE_ALLOC = bslma::UsesBslmaAllocator<VALUE>::value;
+    const int TYPE_MOVE  = bslmf::IsBitwiseMoveable<VALUE>::value;
+
+    const int NUM_VALUES = 16;
+
+    bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+    bslma::TestAllocator za("other",  veryVeryVeryVerbose);
+
+    {
+        bsltf::TestValuesArray<VALUE> VALUES;
+
+        Obj mX(&oa);
+        Obj mY(&za);
+
+        Stack usedX;
+        Stack usedY;
+
+        for (int i = 0; i < NUM_VALUES; ++i) {
+            usedX.push(mX.createNode(VALUES[i]));
+        }
+        mX.reserveNodes(NUM_VALUES);
+        mY.reserveNodes(NUM_VALUES);
+
+        for (int i = 0; i < NUM_VALUES; ++i) {
+            ValueNode *original = static_cast<ValueNode *>(usedX[i]);
+
+            bslma::TestAllocatorMonitor oam(&oa);
+
+            ValueNode *node = static_cast<ValueNode *>(
+                   mX.createNodeByRelocation(&original->value(), true));
+            mX.deallocateNode(original);
+
+            ASSERTV(i, VALUES[i] == node->value());
+            ASSERTV(i, oam.isInUseSame());
+            ASSERTV(i, TYPE_MOVE || !TYPE_ALLOC,
+                    (TYPE_MOVE ? 0 : TYPE_ALLOC) ==
+                                                  oam.numBlocksTotalChange());
+
+            usedX.push(node);
+        }
+
+        for (int i = NUM_VALUES; i < 2 * NUM_VALUES; ++i) {
+            ValueNode *original = static_cast<ValueNode *>(usedX[i]);
+
+            bslma::TestAllocatorMonitor oam(&oa);
+            bslma::TestAllocatorMonitor zam(&za);
+
+            ValueNode *node = static_cast<ValueNode *>(
+                   mY.createNodeByRelocation(&original->value(), false));
+            mX.deallocateNode(original);
+
+            ASSERTV(i, VALUES[i - NUM_VALUES] == node->value());
+            ASSERTV(i, -TYPE_ALLOC == oam.numBlocksInUseChange());
+            ASSERTV(i,  TYPE_ALLOC == zam.numBlocksInUseChange());
+
+            usedY.push(node);
+        }
+
+        while (!usedY.empty()) {
+            mY.deleteNode(usedY.back());
+            usedY.pop();
+        }
+    }
+
+    // Verify all memory is released on object destruction.
+
+    ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+    ASSERTV(za.numBlocksInUse(), 0 == za.numBlocksInUse());
+
+    if (verbose) printf("\nMANIPULATORS 'createDetachedNode', 'adoptNode',"
+                        " and 'takeNode'\n");
+    {
+        typedef bsl::allocator<VALUE>                          Allocator;
+        typedef bslstl::NodeHandle<VALUE, ValueNode, Allocator> Handle;
+
+        bsltf::TestValuesArray<VALUE> VALUES;
+
+        Obj  mW(&oa);
+        Obj  mZ(&za);
+        Obj *mX = new (oa) Obj(&oa);
+
+        bslalg::BidirectionalLink *original = mX->createNode(VALUES[0]);
+
+        bslma::TestAllocatorMonitor oam(&oa);
+
+        ValueNode *node = static_cast<ValueNode *>(
+                                           mX->createDetachedNode(original));
+        ASSERT(1 == oam.numBlocksInUseChange());
+        ASSERT(VALUES[0] == node->value());
+        mX->deallocateNode(original);
+
+        const VALUE *address = &node->value();
+
+        Handle handle;
+        handle.adoptNode(node, Allocator(&oa));
+
+        oa.deleteObject(mX);
+        ASSERT(VALUES[0] == handle.value());
+        ASSERT(address == &handle.value());
+
+        oam.reset();
+
+        ASSERT(node == mW.takeNode(&handle, true));
+        ASSERT(handle.empty());
+        ASSERT(address == &node->value());
+        ASSERT(VALUES[0] == node->value());
+        ASSERT(oam.isTotalSame());
+        ASSERT(oam.isInUseSame());
+
+        bslalg::BidirectionalLink *other   = mW.createNode(VALUES[1]);
+        bslalg::BidirectionalLink *adopted = mW.createDetachedNode(other);
+        mW.deallocateNode(other);
+        ASSERT(oam.isInUseUp());
+
+        oam.reset();
+
+        mW.adoptNode(adopted);
+        ASSERT(oam.isTotalSame());
+        ASSERT(oam.isInUseSame());
+
+        mW.deleteNode(adopted);
+
+        // 'mW' now has free nodes, one of which 'takeNode' reuses instead of
+        // adopting the node of the handle.
+
+        bslalg::BidirectionalLink *detached = mW.createDetachedNode(node);
+        mW.deallocateNode(node);
+        handle.adoptNode(static_cast<ValueNode *>(detached), Allocator(&oa));
+
+        oam.reset();
+
+        node = static_cast<ValueNode *>(mW.takeNode(&handle, true));
+        ASSERT(handle.empty());
+        ASSERT(detached != node);
+        ASSERT(VALUES[0] == node->value());
+        ASSERTV(oam.numBlocksInUseChange(), -1 == oam.numBlocksInUseChange());
+
+        // Detach the value again, and relocate it into a pool using another
+        // allocator.
+
+        detached = mW.createDetachedNode(node);
+        mW.deallocateNode(node);
+        handle.adoptNode(static_cast<ValueNode *>(detached), Allocator(&oa));
+
+        bslma::TestAllocatorMonitor zam(&za);
+
+        ValueNode *copy = static_cast<ValueNode *>(
+                                                mZ.takeNode(&handle, false));
+        ASSERT(handle.empty());
+        ASSERT(detached != copy);
+        ASSERT(VALUES[0] == copy->value());
+        ASSERT(zam.isTotalUp());
+
+        mZ.deleteNode(copy);
+    }
+    ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+    ASSERTV(za.numBlocksInUse(), 0 == za.numBlocksInUse());
+}
+
 template<class VALUE>
 void TestDriver<VALUE>::testCase11()
 {
@@ -2026,7 +2494,7 @@ int main(int argc, char *argv[])
     bslma::TestAllocatorMonitor gam(&ga);
 
     switch (test) { case 0:
-      case 12: {
+      case 15: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -2076,6 +2544,93 @@ int main(int argc, char *argv[])
         ASSERT(NUM_DATA == ti);
 
       } break;
+      case 14: {
+        // --------------------------------------------------------------------
+        // MANIPULATOR 'createNodePiecewise'
+        // --------------------------------------------------------------------
+        RUN_EACH_TYPE(TestDriver,
+                      testCase14,
+                      BSLTF_TEMPLATETESTFACILITY_TEST_TYPES_REGULAR);
+      } break;
+      case 13: {
+        // --------------------------------------------------------------------
+        // MANIPULATOR 'createNodeByRelocation'
+        // --------------------------------------------------------------------
+        RUN_EACH_TYPE(TestDriver,
+                      testCase13,
+                      BSLTF_TEMPLATETESTFACILITY_TEST_TYPES_REGULAR);
+      } break;
+      case 12: {
+        // --------------------------------------------------------------------
+        // CUSTOM NODE TYPE
+        //
+        // Concerns:
+        //: 1 A pool may be instantiated with a 'NODE' type derived from
+        //:   'bslalg::BidirectionalNode<VALUE>'.
+        //:
+        //: 2 Each node supplied by such a pool is large enough to hold a
+        //:   'NODE', and the additional attributes of 'NODE' are usable.
+        //:
+        //: 3 'createNode' and 'cloneNode' construct, and 'deleteNode'
+        //:   destroys, the 'value' attribute of such a node, using the
+        //:   allocator supplied at construction.
+        //
+        // Plan:
+        //: 1 Create a pool of 'bslalg::BidirectionalHashedNode' nodes holding
+        //:   an allocating type.  Create a node, clone it, and set and
+        //:   observe the hash code of each.  Delete the nodes, and verify
+        //:   that the memory allocated for the values is released.  (C-1..3)
+        //
+        // Testing:
+        //   CONCERN: Node types derived from 'BidirectionalNode' supported.
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCUSTOM NODE TYPE"
+                            "\n================\n");
+
+        typedef bsltf::AllocTestType                        ValueType;
+        typedef bslalg::BidirectionalHashedNode<ValueType> Node;
+        typedef bslstl::BidirectionalNodePool<ValueType,
+                                              bsl::allocator<Node>,
+                                              Node>         Obj;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+        bslma::TestAllocator da("default", veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        {
+            const ValueType VALUE(5, &sa);
+
+            Obj mX(&oa);
+
+            Node *node = static_cast<Node *>(mX.createNode(VALUE));
+            node->setHashCode(17);
+
+            const bsls::Types::Int64 BLOCKS = oa.numBlocksInUse();
+
+            Node *clone = static_cast<Node *>(mX.cloneNode(*node));
+            clone->setHashCode(node->hashCode() + 1);
+
+            ASSERTV(oa.numBlocksInUse(), BLOCKS < oa.numBlocksInUse());
+
+            ASSERTV(node->value().data(),   5 == node->value().data());
+            ASSERTV(clone->value().data(),  5 == clone->value().data());
+            ASSERTV(node->hashCode(),      17 == node->hashCode());
+            ASSERTV(clone->hashCode(),     18 == clone->hashCode());
+            ASSERTV(&oa == clone->value().allocator());
+
+            const char *nodeAddress  = reinterpret_cast<const char *>(node);
+            const char *cloneAddress = reinterpret_cast<const char *>(clone);
+            ASSERTV(cloneAddress + sizeof(Node) <= nodeAddress
+                 || nodeAddress  + sizeof(Node) <= cloneAddress);
+
+            mX.deleteNode(clone);
+            mX.deleteNode(node);
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+        ASSERTV(da.numBlocksTotal(), 0 == da.numBlocksTotal());
+      } break;
       case 11: {
         // --------------------------------------------------------------------
         // TYPE TRAITS
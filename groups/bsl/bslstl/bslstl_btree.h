@@ -0,0 +1,2772 @@
+// bslstl_btree.h                                                     -*-C++-*-
+#ifndef INCLUDED_BSLSTL_BTREE
+#define INCLUDED_BSLSTL_BTREE
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a B-tree with cache-line-sized nodes for ordered lookup.
+//
+//@CLASSES:
+//  bslstl::BTree: B-tree implementing the 'btree' ordered containers
+//  bslstl::BTree_ImpUtil: node-size constants and in-node key search
+//  bslstl::BTree_NodeHeader: header common to leaf and internal nodes
+//  bslstl::BTree_NodeUtil: layout and navigation of the nodes of a 'BTree'
+//  bslstl::BTree_NodeSearch: search of the keys held by one node
+//  bslstl::BTreeIterator: bidirectional iterator over a 'BTree'
+//
+//@SEE_ALSO: bslstl_btreemap, bslstl_btreeset, bslstl_btreemultimap
+//
+//@DESCRIPTION: This component provides a class template, 'bslstl::BTree',
+// implementing the common machinery of the B-tree based ordered containers,
+// 'bsl::btree_map', 'bsl::btree_set', and 'bsl::btree_multimap'.  Unlike the
+// red-black tree used by 'bsl::map' (see 'bslalg_rbtreeutil'), which
+// allocates one node per element and links every node to its parent and two
+// children, a 'BTree' stores many elements in each node, in key order, so
+// that the height of the tree (and hence the number of cache misses incurred
+// by a lookup) is several times smaller, and no per-element link overhead is
+// paid.  For example, a red-black tree holding ten million 'int' keys has a
+// height of about 24, whereas a 'BTree' holding the same keys has a height of
+// 5.
+//
+///Node Layout
+///-----------
+// Every node of a 'BTree' begins with a 'BTree_NodeHeader', holding the
+// address of the parent node, the index of the node among the children of
+// its parent, the number of elements held, and whether the node is a leaf.
+// A *leaf* node follows the header with an array of 'k_MAX_VALUES' *slots*;
+// an *internal* node additionally holds an array of 'k_MAX_VALUES + 1' child
+// pointers, such that every element of the subtree rooted at child 'i' is
+// ordered before the element in slot 'i', and after the element in slot
+// 'i - 1'.  The number of slots in a node is chosen (by 'BTree_NodeUtil') so
+// that a leaf node occupies about 'BTree_ImpUtil::k_TARGET_NODE_SIZE' (256)
+// bytes, and the memory allocated for every node is rounded up to a multiple
+// of 'BTree_ImpUtil::k_CACHE_LINE_SIZE' (64) bytes.  Note that nodes are
+// obtained from the allocator of the tree, and so are aligned to a cache line
+// only if the allocator returns memory so aligned.
+//
+// Every leaf node is at the same depth, and every node other than the root
+// holds at least one element.  Erasing an element leaving a node holding
+// fewer than 'k_MIN_VALUES' (half of 'k_MAX_VALUES') elements rebalances the
+// node, by merging it with, or borrowing elements from, a sibling.
+//
+///Element Storage
+///---------------
+// If the 'ValueType' (defined by the 'KEY_CONFIG' policy) is bitwise-moveable
+// (see 'bslmf_isbitwisemoveable'), each slot holds an element inline, and
+// elements are moved between slots (and nodes) with 'memcpy' and 'memmove'.
+// Otherwise, each element is allocated separately, from the allocator of the
+// tree, and each slot holds the address of an element; in that case only the
+// addresses are moved when nodes are split or merged.  In either case,
+// inserting into and erasing from a node never invokes a copy constructor,
+// assignment operator, or destructor of any element other than the one being
+// inserted or erased.
+//
+///In-Node Search
+///--------------
+// A node is searched for a key by one of three methods, selected at compile
+// time by 'BTree_NodeSearch':
+//
+//: o If the key is an arithmetic type compared by 'std::less', and the
+//:   elements are the keys themselves (i.e., for a set) stored inline, the
+//:   keys of a node form a contiguous sorted array, which is searched by
+//:   'BTree_ImpUtil::countLess' and 'BTree_ImpUtil::countNotGreater'.  On
+//:   platforms supporting SSE2, keys of type 'int' and 'double' are compared
+//:   four (respectively, two) at a time.
+//:
+//: o If the key is an arithmetic type compared by 'std::less', and the
+//:   elements are stored inline, the keys are counted with a branch-free
+//:   linear scan.
+//:
+//: o Otherwise, the keys are searched using a binary search.
+//
+///Sequential Insertion
+///--------------------
+// An element whose key is ordered after every key in the tree is appended to
+// the rightmost leaf without searching the tree.  Furthermore, when a full
+// node is split to make room for an element being appended (or prepended),
+// the split is biased so that the node retains all of its elements, and the
+// new sibling receives only the new element.  Therefore, building a tree from
+// a sorted sequence of elements takes linear time, and yields a tree whose
+// nodes are (but for those on its right spine) full.
+//
+///Iterator and Reference Invalidation
+///-----------------------------------
+// Since inserting or erasing an element may move other elements between, and
+// within, nodes, *any* insertion or removal invalidates all iterators to the
+// elements of the tree.  If the 'ValueType' is bitwise-moveable, any
+// insertion or removal also invalidates all pointers and references to the
+// elements of the tree; otherwise, pointers and references to elements other
+// than an erased element remain valid.
+//
+///Usage
+///-----
+// This component is an implementation detail of 'bsl::btree_map',
+// 'bsl::btree_set', and 'bsl::btree_multimap', and is not intended for direct
+// use by clients.  See 'bslstl_btreemap', 'bslstl_btreeset', and
+// 'bslstl_btreemultimap' for usage examples.
+
+#ifndef INCLUDED_BSLSCM_VERSION
+#include <bslscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_ALLOCATORTRAITS
+#include <bslstl_allocatortraits.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_ITERATOR
+#include <bslstl_iterator.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_PAIR
+#include <bslstl_pair.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_SWAPUTIL
+#include <bslalg_swaputil.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_CONDITIONAL
+#include <bslmf_conditional.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_ISARITHMETIC
+#include <bslmf_isarithmetic.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_ISBITWISEMOVEABLE
+#include <bslmf_isbitwisemoveable.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_ISSAME
+#include <bslmf_issame.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_METAINT
+#include <bslmf_metaint.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_REMOVECVQ
+#include <bslmf_removecvq.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ALIGNMENTUTIL
+#include <bsls_alignmentutil.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_BSLS_NATIVESTD
+#include <bsls_nativestd.h>
+#endif
+
+#ifndef INCLUDED_BSLS_OBJECTBUFFER
+#include <bsls_objectbuffer.h>
+#endif
+
+#ifndef INCLUDED_BSLS_PERFORMANCEHINT
+#include <bsls_performancehint.h>
+#endif
+
+#ifndef INCLUDED_BSLS_PLATFORM
+#include <bsls_platform.h>
+#endif
+
+#ifndef INCLUDED_CSTDDEF
+#include <cstddef>
+#define INCLUDED_CSTDDEF
+#endif
+
+#ifndef INCLUDED_CSTRING
+#include <cstring>
+#define INCLUDED_CSTRING
+#endif
+
+#ifndef INCLUDED_FUNCTIONAL
+#include <functional>
+#define INCLUDED_FUNCTIONAL
+#endif
+
+#if defined(BSLS_PLATFORM_CPU_X86_64)                                         \
+ || defined(__SSE2__)                                                         \
+ || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define BSLSTL_BTREE_USE_SSE2 1
+#endif
+
+#ifdef BSLSTL_BTREE_USE_SSE2
+#ifndef INCLUDED_EMMINTRIN
+#include <emmintrin.h>
+#define INCLUDED_EMMINTRIN
+#endif
+#endif
+
+namespace BloombergLP {
+
+namespace bslstl {
+
+                        // ====================
+                        // struct BTree_ImpUtil
+                        // ====================
+
+struct BTree_ImpUtil {
+    // This 'struct' provides a namespace for the constants, independent of
+    // the element type, that determine the size of the nodes of a 'BTree',
+    // and for functions counting the keys of a sorted array that are ordered
+    // before a given key.
+
+    // TYPES
+    enum {
+        k_CACHE_LINE_SIZE  = 64,   // granularity of node allocations
+        k_TARGET_NODE_SIZE = 256,  // approximate size of a leaf node
+        k_MAX_FAN_OUT      = 255   // upper bound on the slots of a node
+    };
+
+    // CLASS METHODS
+    template <class KEY_TYPE>
+    static int countLess(const KEY_TYPE *keys,
+                         int             numKeys,
+                         const KEY_TYPE& key);
+    static int countLess(const int *keys, int numKeys, int key);
+    static int countLess(const double *keys, int numKeys, double key);
+        // Return the number of the specified 'numKeys' elements of the
+        // specified 'keys' array that are less than the specified 'key'.  The
+        // behavior is undefined unless 'keys' is sorted in non-decreasing
+        // order, and '0 <= numKeys'.  Note that the overloads for 'int' and
+        // 'double' use SSE2 where available.
+
+    template <class KEY_TYPE>
+    static int countNotGreater(const KEY_TYPE *keys,
+                               int             numKeys,
+                               const KEY_TYPE& key);
+    static int countNotGreater(const int *keys, int numKeys, int key);
+    static int countNotGreater(const double *keys, int numKeys, double key);
+        // Return the number of the specified 'numKeys' elements of the
+        // specified 'keys' array that are not greater than the specified
+        // 'key'.  The behavior is undefined unless 'keys' is sorted in
+        // non-decreasing order, and '0 <= numKeys'.  Note that the overloads
+        // for 'int' and 'double' use SSE2 where available.
+
+    static native_std::size_t roundUpToCacheLine(native_std::size_t size);
+        // Return the smallest multiple of 'k_CACHE_LINE_SIZE' that is not
+        // less than the specified 'size'.
+};
+
+                        // =======================
+                        // struct BTree_NodeHeader
+                        // =======================
+
+struct BTree_NodeHeader {
+    // This 'struct' defines the header at the start of every node of a
+    // 'BTree' (see {Node Layout}).  The slots (and, for an internal node, the
+    // child pointers) following the header are accessed using
+    // 'BTree_NodeUtil'.
+
+    // DATA
+    BTree_NodeHeader *d_parent_p;  // parent node, or 0 for the root
+
+    unsigned short    d_position;  // index of this node among the children
+                                   // of its parent
+
+    unsigned short    d_count;     // number of elements held by this node
+
+    bool              d_isLeaf;    // 'true' if this node has no children
+};
+
+                        // =====================
+                        // struct BTree_LeafNode
+                        // =====================
+
+template <class SLOT_TYPE, int MAX_VALUES>
+struct BTree_LeafNode {
+    // This 'struct' defines the layout of a leaf node of a 'BTree' holding
+    // up to the (template parameter) 'MAX_VALUES' slots of the (template
+    // parameter) 'SLOT_TYPE'.
+
+    // DATA
+    BTree_NodeHeader d_header;              // common node header
+    SLOT_TYPE        d_slots[MAX_VALUES];   // elements, in key order
+};
+
+                        // =========================
+                        // struct BTree_InternalNode
+                        // =========================
+
+template <class SLOT_TYPE, int MAX_VALUES>
+struct BTree_InternalNode {
+    // This 'struct' defines the layout of an internal node of a 'BTree'
+    // holding up to the (template parameter) 'MAX_VALUES' slots of the
+    // (template parameter) 'SLOT_TYPE', and one more child than slots.
+
+    // DATA
+    BTree_LeafNode<SLOT_TYPE, MAX_VALUES>  d_leaf;   // header and slots
+
+    BTree_NodeHeader                      *d_children[MAX_VALUES + 1];
+                                                     // subtrees, in key order
+};
+
+                        // =====================
+                        // struct BTree_NodeUtil
+                        // =====================
+
+template <class VALUE_TYPE>
+struct BTree_NodeUtil {
+    // This 'struct' provides a namespace for the types, constants, and
+    // functions describing the layout of the nodes of a 'BTree' holding
+    // elements of the (template parameter) 'VALUE_TYPE', and for navigating
+    // between the elements of such a tree in key order.
+
+    // TYPES
+    enum {
+        k_IS_INLINE = bslmf::IsBitwiseMoveable<VALUE_TYPE>::value
+                                     // 'true' if elements are held in slots
+    };
+
+    typedef typename bsl::conditional<k_IS_INLINE,
+                                      bsls::ObjectBuffer<VALUE_TYPE>,
+                                      VALUE_TYPE *>::type SlotType;
+        // Type of a slot of a node: either suitably aligned storage for an
+        // element, or the address of an (out-of-line) element.
+
+  private:
+    // PRIVATE TYPES
+    enum {
+        k_NUM_FITTING = (BTree_ImpUtil::k_TARGET_NODE_SIZE
+                                                   - sizeof(BTree_NodeHeader))
+                      / sizeof(SlotType)
+    };
+
+  public:
+    enum {
+        k_MAX_VALUES = k_NUM_FITTING < 3
+                       ? 3
+                       : k_NUM_FITTING > int(BTree_ImpUtil::k_MAX_FAN_OUT)
+                         ? int(BTree_ImpUtil::k_MAX_FAN_OUT)
+                         : int(k_NUM_FITTING),
+                                     // maximum number of elements in a node
+
+        k_MIN_VALUES = k_MAX_VALUES / 2
+                                     // fewest elements left in a non-root
+                                     // node by an erasure before rebalancing
+    };
+
+    typedef BTree_LeafNode<SlotType, k_MAX_VALUES>     LeafNode;
+    typedef BTree_InternalNode<SlotType, k_MAX_VALUES> InternalNode;
+
+    // CLASS METHODS
+    static native_std::size_t nodeSize(bool isLeaf);
+        // Return the number of bytes allocated for a node that is a leaf if
+        // the specified 'isLeaf' is 'true', and an internal node otherwise.
+        // Note that the returned value is a multiple of
+        // 'BTree_ImpUtil::k_CACHE_LINE_SIZE'.
+
+    static SlotType *slots(BTree_NodeHeader *node);
+    static const SlotType *slots(const BTree_NodeHeader *node);
+        // Return the address of the first slot of the specified 'node'.
+
+    static BTree_NodeHeader **children(BTree_NodeHeader *node);
+    static BTree_NodeHeader *const *children(const BTree_NodeHeader *node);
+        // Return the address of the first child pointer of the specified
+        // 'node'.  The behavior is undefined if 'node' is a leaf.
+
+    static VALUE_TYPE *address(bsls::ObjectBuffer<VALUE_TYPE> *slot);
+    static VALUE_TYPE *address(VALUE_TYPE **slot);
+    static const VALUE_TYPE *address(
+                                   const bsls::ObjectBuffer<VALUE_TYPE> *slot);
+    static const VALUE_TYPE *address(VALUE_TYPE *const *slot);
+        // Return the address of the element held by the specified 'slot'.
+
+    static VALUE_TYPE& value(BTree_NodeHeader *node, int index);
+    static const VALUE_TYPE& value(const BTree_NodeHeader *node, int index);
+        // Return a reference to the element at the specified 'index' of the
+        // specified 'node'.  The behavior is undefined unless
+        // '0 <= index < node->d_count'.
+
+    static BTree_NodeHeader *leftmostLeaf(BTree_NodeHeader *node);
+        // Return the leftmost leaf of the subtree rooted at the specified
+        // 'node'.
+
+    static BTree_NodeHeader *rightmostLeaf(BTree_NodeHeader *node);
+        // Return the rightmost leaf of the subtree rooted at the specified
+        // 'node'.
+
+    static void next(BTree_NodeHeader **node, int *position);
+        // Load into the specified 'node' and 'position' the node and index of
+        // the element following (in key order) the element at '*position' in
+        // '*node', or the root and the number of elements of the root if
+        // there is no such element.  The behavior is undefined unless
+        // '*position' refers to an element of '*node'.
+
+    static void previous(BTree_NodeHeader **node, int *position);
+        // Load into the specified 'node' and 'position' the node and index of
+        // the element preceding (in key order) the position '*position' in
+        // '*node'.  The behavior is undefined unless there is such an element.
+};
+
+                        // =======================
+                        // struct BTree_NodeSearch
+                        // =======================
+
+template <class KEY_CONFIG, class COMPARATOR>
+struct BTree_NodeSearch {
+    // This 'struct' provides a namespace for functions searching the elements
+    // of one node of a 'BTree', whose elements are of the 'ValueType', and
+    // whose keys are of the 'KeyType', defined by the (template parameter)
+    // 'KEY_CONFIG', ordered by the (template parameter) 'COMPARATOR'.  The
+    // search method is selected at compile-time (see {In-Node Search}).
+
+    // TYPES
+    typedef typename KEY_CONFIG::KeyType              KeyType;
+    typedef typename KEY_CONFIG::ValueType            ValueType;
+    typedef typename bslmf::RemoveCvq<KeyType>::Type  NcKeyType;
+    typedef BTree_NodeUtil<ValueType>                 NodeUtil;
+    typedef typename NodeUtil::SlotType               SlotType;
+
+    enum {
+        k_IS_LINEAR     = bsl::is_arithmetic<NcKeyType>::value
+                       && bslmf::IsSame<COMPARATOR,
+                                        native_std::less<NcKeyType> >::value
+                       && NodeUtil::k_IS_INLINE,
+                                     // keys are counted by a linear scan
+
+        k_IS_CONTIGUOUS = k_IS_LINEAR
+                       && bslmf::IsSame<ValueType, NcKeyType>::value,
+                                     // keys form a contiguous array
+
+        k_METHOD        = k_IS_CONTIGUOUS ? 2 : k_IS_LINEAR ? 1 : 0
+    };
+
+  private:
+    // PRIVATE CLASS METHODS
+    static int lowerBoundImp(const BTree_NodeHeader *node,
+                             const KeyType&          key,
+                             const COMPARATOR&       comparator,
+                             bslmf::MetaInt<0>);
+    static int lowerBoundImp(const BTree_NodeHeader *node,
+                             const KeyType&          key,
+                             const COMPARATOR&       comparator,
+                             bslmf::MetaInt<1>);
+    static int lowerBoundImp(const BTree_NodeHeader *node,
+                             const KeyType&          key,
+                             const COMPARATOR&       comparator,
+                             bslmf::MetaInt<2>);
+        // Return the number of elements of the specified 'node' whose keys
+        // are ordered before the specified 'key' by the specified
+        // 'comparator', using a binary search, a linear scan of strided keys,
+        // or a search of a contiguous array of keys, respectively.
+
+    static int upperBoundImp(const BTree_NodeHeader *node,
+                             const KeyType&          key,
+                             const COMPARATOR&       comparator,
+                             bslmf::MetaInt<0>);
+    static int upperBoundImp(const BTree_NodeHeader *node,
+                             const KeyType&          key,
+                             const COMPARATOR&       comparator,
+                             bslmf::MetaInt<1>);
+    static int upperBoundImp(const BTree_NodeHeader *node,
+                             const KeyType&          key,
+                             const COMPARATOR&       comparator,
+                             bslmf::MetaInt<2>);
+        // Return the number of elements of the specified 'node' whose keys
+        // are not ordered after the specified 'key' by the specified
+        // 'comparator', using a binary search, a linear scan of strided keys,
+        // or a search of a contiguous array of keys, respectively.
+
+  public:
+    // CLASS METHODS
+    static int lowerBound(const BTree_NodeHeader *node,
+                          const KeyType&          key,
+                          const COMPARATOR&       comparator);
+        // Return the index of the first element of the specified 'node' whose
+        // key is not ordered before the specified 'key' by the specified
+        // 'comparator', or 'node->d_count' if there is no such element.
+
+    static int upperBound(const BTree_NodeHeader *node,
+                          const KeyType&          key,
+                          const COMPARATOR&       comparator);
+        // Return the index of the first element of the specified 'node' whose
+        // key is ordered after the specified 'key' by the specified
+        // 'comparator', or 'node->d_count' if there is no such element.
+};
+
+                        // ===================
+                        // class BTreeIterator
+                        // ===================
+
+#ifdef BSLS_PLATFORM_OS_SOLARIS
+// On Solaris just to keep studio12-v4 happy, since algorithms take only
+// iterators inheriting from 'std::iterator'.
+
+template <class VALUE_TYPE, class DIFFERENCE_TYPE>
+class BTreeIterator
+: public native_std::iterator<native_std::bidirectional_iterator_tag,
+                              VALUE_TYPE> {
+#else
+template <class VALUE_TYPE, class DIFFERENCE_TYPE>
+class BTreeIterator {
+#endif
+    // This class template implements an in-core value semantic type that is a
+    // standard-conforming bidirectional iterator (see section 24.2.6
+    // [bidirectional.iterators] of the C++11 standard) over the elements of a
+    // 'BTree'.  An iterator refers to an element by holding the address of
+    // the node holding the element and the index of the element within that
+    // node; the past-the-end iterator of a non-empty tree refers to the root
+    // node, at an index equal to the number of elements of the root, and the
+    // past-the-end iterator of an empty tree is default-constructed.  The
+    // (template parameter) 'DIFFERENCE_TYPE' determines the standard mandated
+    // 'difference_type' of the iterator.
+
+    // PRIVATE TYPES
+    typedef typename bslmf::RemoveCvq<VALUE_TYPE>::Type NcType;
+    typedef BTreeIterator<NcType, DIFFERENCE_TYPE>      NcIter;
+    typedef BTree_NodeUtil<NcType>                      NodeUtil;
+
+  public:
+    // PUBLIC TYPES
+    typedef NcType                           value_type;
+    typedef DIFFERENCE_TYPE                  difference_type;
+    typedef VALUE_TYPE                      *pointer;
+    typedef VALUE_TYPE&                      reference;
+    typedef bsl::bidirectional_iterator_tag  iterator_category;
+        // Standard iterator defined types [24.4.2].
+
+  private:
+    // DATA
+    BTree_NodeHeader *d_node_p;    // node holding the element referred to by
+                                   // this iterator
+
+    int               d_position;  // index of the element within 'd_node_p'
+
+  public:
+    // CREATORS
+    BTreeIterator();
+        // Create a default-constructed iterator.  All default-constructed
+        // iterators are non-dereferenceable, compare equal to one another,
+        // and to the past-the-end iterator of an empty tree.
+
+    BTreeIterator(BTree_NodeHeader *node, int position);
+        // Create an iterator referring to the element at the specified
+        // 'position' of the specified 'node', or, if 'node' is the root of a
+        // tree and 'position' is the number of elements of the root, the
+        // past-the-end iterator of that tree.  Note that this constructor is
+        // an implementation detail and is not part of the C++ standard.
+
+    BTreeIterator(const NcIter& original);                          // IMPLICIT
+        // Create an iterator at the same position as the specified 'original'
+        // iterator.  Note that this constructor enables converting from
+        // modifiable to 'const' iterator types.
+
+    //! BTreeIterator(const BTreeIterator& original) = default;
+        // Create an iterator having the same value as the specified
+        // 'original'.
+
+    //! ~BTreeIterator() = default;
+        // Destroy this object.
+
+    // MANIPULATORS
+    //! BTreeIterator& operator=(const BTreeIterator& rhs) = default;
+        // Assign to this object the value of the specified 'rhs' object, and
+        // a return a reference providing modifiable access to this object.
+
+    BTreeIterator& operator++();
+        // Move this iterator to the next element in the tree and return a
+        // reference providing modifiable access to this iterator.  The
+        // behavior is undefined unless this iterator refers to an element of
+        // a tree that has not been modified since this iterator was obtained.
+
+    BTreeIterator& operator--();
+        // Move this iterator to the previous element in the tree and return a
+        // reference providing modifiable access to this iterator.  The
+        // behavior is undefined unless this iterator refers to an element,
+        // other than the first, or to the past-the-end position, of a
+        // non-empty tree that has not been modified since this iterator was
+        // obtained.
+
+    // ACCESSORS
+    reference operator*() const;
+        // Return a reference to the element at which this iterator is
+        // positioned.  The behavior is undefined unless this iterator refers
+        // to an element of a tree.
+
+    pointer operator->() const;
+        // Return the address of the element at which this iterator is
+        // positioned.  The behavior is undefined unless this iterator refers
+        // to an element of a tree.
+
+    BTree_NodeHeader *node() const;
+        // Return the address of the node at which this iterator is
+        // positioned.  Note that this method is an implementation detail and
+        // is not part of the C++ standard.
+
+    int position() const;
+        // Return the index of the element, within 'node()', at which this
+        // iterator is positioned.  Note that this method is an implementation
+        // detail and is not part of the C++ standard.
+};
+
+// FREE OPERATORS
+template <class VALUE_TYPE, class DIFFERENCE_TYPE>
+bool operator==(const BTreeIterator<VALUE_TYPE, DIFFERENCE_TYPE>& lhs,
+                const BTreeIterator<VALUE_TYPE, DIFFERENCE_TYPE>& rhs);
+template <class VALUE_TYPE, class DIFFERENCE_TYPE>
+bool operator==(const BTreeIterator<VALUE_TYPE, DIFFERENCE_TYPE>&       lhs,
+                const BTreeIterator<const VALUE_TYPE, DIFFERENCE_TYPE>& rhs);
+template <class VALUE_TYPE, class DIFFERENCE_TYPE>
+bool operator==(const BTreeIterator<const VALUE_TYPE, DIFFERENCE_TYPE>& lhs,
+                const BTreeIterator<VALUE_TYPE, DIFFERENCE_TYPE>&       rhs);
+    // Return 'true' if the specified 'lhs' and the specified 'rhs' iterators
+    // have the same value and 'false' otherwise.  Two iterators have the same
+    // value if they refer to the same position of the same node, or if both
+    // are default-constructed.
+
+template <class VALUE_TYPE, class DIFFERENCE_TYPE>
+bool operator!=(const BTreeIterator<VALUE_TYPE, DIFFERENCE_TYPE>& lhs,
+                const BTreeIterator<VALUE_TYPE, DIFFERENCE_TYPE>& rhs);
+template <class VALUE_TYPE, class DIFFERENCE_TYPE>
+bool operator!=(const BTreeIterator<VALUE_TYPE, DIFFERENCE_TYPE>&       lhs,
+                const BTreeIterator<const VALUE_TYPE, DIFFERENCE_TYPE>& rhs);
+template <class VALUE_TYPE, class DIFFERENCE_TYPE>
+bool operator!=(const BTreeIterator<const VALUE_TYPE, DIFFERENCE_TYPE>& lhs,
+                const BTreeIterator<VALUE_TYPE, DIFFERENCE_TYPE>&       rhs);
+    // Return 'true' if the specified 'lhs' and the specified 'rhs' iterators
+    // do not have the same value and 'false' otherwise.  Two iterators do not
+    // have the same value if they refer to different positions.
+
+template <class VALUE_TYPE, class DIFFERENCE_TYPE>
+BTreeIterator<VALUE_TYPE, DIFFERENCE_TYPE>
+operator++(BTreeIterator<VALUE_TYPE, DIFFERENCE_TYPE>& iter, int);
+    // Move the specified 'iter' to the next element in the tree and return
+    // value of 'iter' prior to this call.  The behavior is undefined unless
+    // 'iter' refers to an element of a tree.
+
+template <class VALUE_TYPE, class DIFFERENCE_TYPE>
+BTreeIterator<VALUE_TYPE, DIFFERENCE_TYPE>
+operator--(BTreeIterator<VALUE_TYPE, DIFFERENCE_TYPE>& iter, int);
+    // Move the specified 'iter' to the previous element in the tree and
+    // return value of 'iter' prior to this call.  The behavior is undefined
+    // unless 'iter' refers to an element, other than the first, or to the
+    // past-the-end position, of a non-empty tree.
+
+                        // ====================
+                        // class BTree_Proctor
+                        // ====================
+
+template <class BTREE>
+class BTree_Proctor {
+    // This class implements a proctor that, unless its 'release' method is
+    // called, destroys every element of a 'BTREE' object and returns its
+    // nodes to the tree's allocator on destruction.  This proctor is used to
+    // provide the basic exception-safety guarantee while populating a tree
+    // under construction.
+
+    // DATA
+    BTREE *d_tree_p;  // tree to clean up, or 0 if released
+
+  private:
+    // NOT IMPLEMENTED
+    BTree_Proctor(const BTree_Proctor&);
+    BTree_Proctor& operator=(const BTree_Proctor&);
+
+  public:
+    // CREATORS
+    explicit BTree_Proctor(BTREE *tree);
+        // Create a proctor to manage the specified 'tree'.
+
+    ~BTree_Proctor();
+        // Destroy this proctor, and, unless 'release' has been called, every
+        // element and node of the managed tree.
+
+    // MANIPULATORS
+    void release();
+        // Release from management the tree currently managed by this proctor.
+};
+
+                        // ========================
+                        // class BTree_NodeProctor
+                        // ========================
+
+template <class BTREE>
+class BTree_NodeProctor {
+    // This class implements a proctor that, unless its 'release' method is
+    // called, returns a (newly allocated, and not yet linked) node to the
+    // allocator of a 'BTREE' object on destruction.
+
+    // DATA
+    BTREE            *d_tree_p;  // tree that allocated the node
+    BTree_NodeHeader *d_node_p;  // node to deallocate, or 0 if released
+
+  private:
+    // NOT IMPLEMENTED
+    BTree_NodeProctor(const BTree_NodeProctor&);
+    BTree_NodeProctor& operator=(const BTree_NodeProctor&);
+
+  public:
+    // CREATORS
+    BTree_NodeProctor(BTREE *tree, BTree_NodeHeader *node);
+        // Create a proctor to manage the specified 'node' allocated by the
+        // specified 'tree'.
+
+    ~BTree_NodeProctor();
+        // Destroy this proctor, and, unless 'release' has been called,
+        // deallocate the managed node.
+
+    // MANIPULATORS
+    void release();
+        // Release from management the node currently managed by this proctor.
+};
+
+                        // ========================
+                        // class BTree_SlotProctor
+                        // ========================
+
+template <class BTREE>
+class BTree_SlotProctor {
+    // This class implements a proctor that, unless its 'release' method is
+    // called, releases the storage of a slot, not yet placed in a node, of a
+    // 'BTREE' object on destruction, first destroying the element held by
+    // the slot if 'setConstructed' has been called.
+
+  public:
+    // TYPES
+    typedef typename BTREE::SlotType SlotType;
+
+  private:
+    // DATA
+    BTREE    *d_tree_p;         // tree owning the slot
+    SlotType *d_slot_p;         // slot to release, or 0 if released
+    bool      d_isConstructed;  // 'true' if the slot holds an element
+
+  private:
+    // NOT IMPLEMENTED
+    BTree_SlotProctor(const BTree_SlotProctor&);
+    BTree_SlotProctor& operator=(const BTree_SlotProctor&);
+
+  public:
+    // CREATORS
+    BTree_SlotProctor(BTREE *tree, SlotType *slot);
+        // Create a proctor to manage the specified 'slot', whose storage has
+        // been acquired from the specified 'tree', but which does not yet
+        // hold an element.
+
+    ~BTree_SlotProctor();
+        // Destroy this proctor, and, unless 'release' has been called,
+        // destroy the element held by the managed slot (if any) and release
+        // the storage of the slot.
+
+    // MANIPULATORS
+    void setConstructed();
+        // Indicate that the managed slot now holds an element.
+
+    void release();
+        // Release from management the slot currently managed by this proctor.
+};
+
+                        // ===========
+                        // class BTree
+                        // ===========
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+class BTree {
+    // This class template implements a B-tree holding elements of the
+    // 'ValueType' defined by the (template parameter) 'KEY_CONFIG', ordered
+    // by their keys using the (template parameter) 'COMPARATOR', in nodes
+    // obtained from the (template parameter) 'ALLOCATOR' (see {Node Layout}).
+    // The 'KEY_CONFIG' type must provide 'KeyType' and 'ValueType' typedefs,
+    // and a static 'extractKey' function returning a reference to the key of
+    // a 'ValueType' object.  Elements are created and destroyed through
+    // 'bsl::allocator_traits' of the 'ALLOCATOR', so that elements using
+    // 'bslma' allocators are supplied with the allocator of the tree.  A
+    // tree may hold either unique keys (using 'insertUnique') or equivalent
+    // keys (using 'insertMulti'), but clients should use only one of the two
+    // on a given tree.
+
+  public:
+    // TYPES
+    typedef ALLOCATOR                                   AllocatorType;
+    typedef COMPARATOR                                  ComparatorType;
+    typedef ::bsl::allocator_traits<ALLOCATOR>          AllocatorTraits;
+    typedef typename KEY_CONFIG::KeyType                KeyType;
+    typedef typename KEY_CONFIG::ValueType              ValueType;
+    typedef typename AllocatorTraits::size_type         SizeType;
+    typedef typename AllocatorTraits::difference_type   DifferenceType;
+    typedef BTree_NodeUtil<ValueType>                   NodeUtil;
+    typedef typename NodeUtil::SlotType                 SlotType;
+    typedef BTreeIterator<ValueType, DifferenceType>    Iterator;
+
+  private:
+    // PRIVATE TYPES
+    typedef BTree_NodeHeader                            NodeHeader;
+    typedef BTree_NodeSearch<KEY_CONFIG, COMPARATOR>    NodeSearch;
+    typedef bsls::AlignmentUtil::MaxAlignedType         BlockType;
+    typedef typename AllocatorTraits::template
+                                   rebind_traits<BlockType> BlockAllocTraits;
+    typedef typename BlockAllocTraits::allocator_type       BlockAllocator;
+
+    enum {
+        k_MAX_VALUES = NodeUtil::k_MAX_VALUES,
+        k_MIN_VALUES = NodeUtil::k_MIN_VALUES
+    };
+
+    // DATA
+    NodeHeader  *d_root_p;       // root node, or 0 if empty
+    NodeHeader  *d_leftmost_p;   // leftmost leaf, or 0 if empty
+    NodeHeader  *d_rightmost_p;  // rightmost leaf, or 0 if empty
+    SizeType     d_size;         // number of elements
+    COMPARATOR   d_comparator;   // key-ordering functor
+    ALLOCATOR    d_allocator;    // allocator for elements and nodes
+
+    // FRIENDS
+    friend class BTree_Proctor<BTree>;
+    friend class BTree_NodeProctor<BTree>;
+    friend class BTree_SlotProctor<BTree>;
+
+  private:
+    // PRIVATE CLASS METHODS
+    static native_std::size_t numBlocks(bool isLeaf);
+        // Return the number of 'BlockType' objects allocated for a node that
+        // is a leaf if the specified 'isLeaf' is 'true', and an internal node
+        // otherwise.
+
+    static void setChild(NodeHeader *parent, int index, NodeHeader *child);
+        // Set the child at the specified 'index' of the specified 'parent' to
+        // the specified 'child', and update the parent link and position of
+        // 'child'.
+
+    // PRIVATE MANIPULATORS
+    NodeHeader *allocateNode(bool isLeaf);
+        // Return the address of an empty, unlinked node, allocated from the
+        // allocator of this tree, that is a leaf if the specified 'isLeaf' is
+        // 'true', and an internal node otherwise.
+
+    void deallocateNode(NodeHeader *node);
+        // Return the memory of the specified 'node' to the allocator of this
+        // tree.  Note that the elements of 'node' are not destroyed.
+
+    ValueType *acquireSlotStorage(bsls::ObjectBuffer<ValueType> *slot);
+    ValueType *acquireSlotStorage(ValueType **slot);
+        // Prepare the specified 'slot' to hold an element, allocating memory
+        // for the element if elements are stored out-of-line, and return the
+        // address at which the element should be constructed.
+
+    void releaseSlotStorage(bsls::ObjectBuffer<ValueType> *slot);
+    void releaseSlotStorage(ValueType **slot);
+        // Release any memory allocated for an element by 'acquireSlotStorage'
+        // for the specified 'slot', without destroying the element.
+
+    void destroySlot(SlotType *slot);
+        // Destroy the element held by the specified 'slot', and release any
+        // memory allocated for the element.
+
+    void destroyNode(NodeHeader *node);
+        // Destroy every element of the subtree rooted at the specified
+        // 'node', and deallocate every node of that subtree.
+
+    Iterator insertSlot(NodeHeader *node, int position, SlotType *slot);
+        // Move the element held by the specified 'slot' into this tree,
+        // before the element at the specified 'position' of the specified
+        // leaf 'node' (or at the end of 'node' if 'position' is
+        // 'node->d_count'), splitting nodes as needed, and return an iterator
+        // referring to the inserted element.  If 'node' is 0, this tree must
+        // be empty.  If an exception is thrown, this tree is unchanged, and
+        // the element remains owned by the caller.
+
+    void splitNode(NodeHeader **node, int *position);
+        // Split the specified full '*node' into two nodes, moving one element
+        // into the parent of '*node' (first splitting the parent if it is
+        // full, and creating a new root if '*node' is the root), and load into
+        // 'node' and the specified 'position' the node and index at which an
+        // element that would have been inserted at '*position' in the
+        // original node should be inserted.  If an exception is thrown, this
+        // tree is unchanged.
+
+    void rebalance(NodeHeader *node, NodeHeader **resultNode, int *result);
+        // Restore the invariants of this tree after the removal of an element
+        // from the specified 'node', by merging underfull nodes with, or
+        // borrowing elements from, their siblings, up to the root, and
+        // collapsing the root if it is left empty.  Update the specified
+        // 'resultNode' and 'result' to track the position of the element
+        // (or end of node) at '*result' in '*resultNode' as elements move
+        // between nodes.
+
+    void mergeWithRight(NodeHeader  *left,
+                        NodeHeader **resultNode,
+                        int         *result);
+        // Move the separating element in the parent of the specified 'left'
+        // node, and every element (and child) of the right sibling of 'left',
+        // into 'left', deallocate the right sibling, and update the specified
+        // 'resultNode' and 'result' accordingly.  The behavior is undefined
+        // unless 'left' has a right sibling, and the combined elements fit in
+        // one node.
+
+    void borrowFromRight(NodeHeader  *left,
+                         int          numElements,
+                         NodeHeader **resultNode,
+                         int         *result);
+        // Rotate the specified 'numElements' elements (and their children)
+        // from the right sibling of the specified 'left' node, through the
+        // parent, into 'left', and update the specified 'resultNode' and
+        // 'result' accordingly.  The behavior is undefined unless the right
+        // sibling of 'left' holds more than 'numElements' elements.
+
+    void borrowFromLeft(NodeHeader  *right,
+                        int          numElements,
+                        NodeHeader **resultNode,
+                        int         *result);
+        // Rotate the specified 'numElements' elements (and their children)
+        // from the left sibling of the specified 'right' node, through the
+        // parent, into 'right', and update the specified 'resultNode' and
+        // 'result' accordingly.  The behavior is undefined unless the left
+        // sibling of 'right' holds more than 'numElements' elements.
+
+    Iterator appendValue(const ValueType& value);
+        // Insert a copy of the specified 'value' after every element of this
+        // tree, and return an iterator referring to the new element.  The
+        // behavior is undefined unless the key of 'value' is not ordered
+        // before the key of any element of this tree.
+
+    void quickSwapRetainAllocators(BTree *other);
+        // Exchange the value and comparator of this object with those of the
+        // specified 'other' object, without exchanging allocators.  This
+        // method provides the no-throw exception-safety guarantee unless the
+        // comparator throws on swap.  The behavior is undefined unless the
+        // allocators of this object and 'other' compare equal.
+
+    // PRIVATE ACCESSORS
+    const KeyType& lastKey() const;
+        // Return a reference to the key of the last element of this tree.
+        // The behavior is undefined if this tree is empty.
+
+    Iterator makeIterator(NodeHeader *node, int position) const;
+        // Return an iterator referring to the element at the specified
+        // 'position' of the specified 'node', or, if 'position' is
+        // 'node->d_count', the element following the last element of 'node'.
+
+  public:
+    // CREATORS
+    explicit BTree(const COMPARATOR& comparator     = COMPARATOR(),
+                   const ALLOCATOR&  basicAllocator = ALLOCATOR());
+        // Create an empty tree.  Optionally specify a 'comparator' used to
+        // order keys.  If 'comparator' is not supplied, a default-constructed
+        // object of the (template parameter) type 'COMPARATOR' is used.
+        // Optionally specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is not supplied, a default-constructed object of
+        // the (template parameter) type 'ALLOCATOR' is used.  No memory is
+        // allocated.
+
+    BTree(const BTree& original, const ALLOCATOR& basicAllocator);
+        // Create a tree having the same value and comparator as the specified
+        // 'original', and using the specified 'basicAllocator' to supply
+        // memory.  Note that the elements are appended in order (see
+        // {Sequential Insertion}), so that the nodes of the new tree are
+        // fuller than those of 'original' may be.
+
+    ~BTree();
+        // Destroy this object.
+
+    // MANIPULATORS
+    BTree& operator=(const BTree& rhs);
+        // Assign to this object the value and comparator of the specified
+        // 'rhs' object, propagate to this object the allocator of 'rhs' if the
+        // 'ALLOCATOR' type has trait 'propagate_on_container_copy_assignment',
+        // and return a reference providing modifiable access to this object.
+        // If an exception is thrown, this object is unchanged.
+
+    bsl::pair<Iterator, bool> insertUnique(const ValueType& value);
+        // Insert a copy of the specified 'value' into this tree if no element
+        // having an equivalent key is present.  Return a pair whose 'first'
+        // member is an iterator referring to the (possibly newly inserted)
+        // element having a key equivalent to that of 'value', and whose
+        // 'second' member is 'true' if an element was inserted, and 'false'
+        // otherwise.  If an exception is thrown, this tree is unchanged.
+
+    Iterator insertMulti(const ValueType& value);
+        // Insert a copy of the specified 'value' into this tree, after every
+        // element having an equivalent key, and return an iterator referring
+        // to the new element.  If an exception is thrown, this tree is
+        // unchanged.  Note that 'value' may refer to an element of this tree.
+
+    Iterator insertIfMissing(const KeyType& key);
+        // Insert into this tree an element having the specified 'key' and a
+        // value-initialized mapped value, if no element having an equivalent
+        // key is present.  Return an iterator referring to the (possibly
+        // newly inserted) element having a key equivalent to 'key'.  If an
+        // exception is thrown, this tree is unchanged.  The behavior is
+        // undefined unless 'ValueType' is a 'pair' whose 'first' member has
+        // the type 'KeyType'.
+
+    Iterator remove(Iterator position);
+        // Destroy the element at the specified 'position' of this tree, and
+        // return an iterator referring to the element that followed it.  The
+        // behavior is undefined unless 'position' refers to an element of
+        // this tree.
+
+    void removeAll();
+        // Destroy every element of this tree, and deallocate every node.
+
+    void swap(BTree& other);
+        // Exchange the value and comparator of this object with those of the
+        // specified 'other' object.  Additionally, if
+        // 'bsl::allocator_traits<ALLOCATOR>::propagate_on_container_swap' is
+        // 'true', then exchange the allocator of this object with that of the
+        // 'other' object, and do not modify either allocator otherwise.  This
+        // method provides the no-throw exception-safety guarantee unless the
+        // comparator throws on swap.  The behavior is undefined unless either
+        // this object has an allocator that compares equal to the allocator
+        // of 'other', or the trait 'propagate_on_container_swap' is 'true'.
+
+    // ACCESSORS
+    ALLOCATOR allocator() const;
+        // Return (a copy of) the allocator used by this tree.
+
+    Iterator begin() const;
+        // Return an iterator referring to the first element of this tree, or
+        // 'end()' if this tree is empty.
+
+    const COMPARATOR& comparator() const;
+        // Return a reference providing non-modifiable access to the
+        // key-ordering functor of this tree.
+
+    Iterator end() const;
+        // Return the past-the-end iterator of this tree.
+
+    Iterator find(const KeyType& key) const;
+        // Return an iterator referring to an element of this tree having a
+        // key equivalent to the specified 'key', or 'end()' if there is no
+        // such element.  Note that if several elements have keys equivalent
+        // to 'key', it is unspecified which is returned.
+
+    int height() const;
+        // Return the number of nodes on a path from the root to a leaf of
+        // this tree, or 0 if this tree is empty.
+
+    Iterator lowerBound(const KeyType& key) const;
+        // Return an iterator referring to the first element of this tree
+        // whose key is not ordered before the specified 'key', or 'end()' if
+        // there is no such element.
+
+    SizeType maxSize() const;
+        // Return a theoretical upper bound on the largest number of elements
+        // that this tree could possibly hold.
+
+    const BTree_NodeHeader *rootNode() const;
+        // Return the address of the root node of this tree, or 0 if this tree
+        // is empty.  Note that this method is intended for testing.
+
+    SizeType size() const;
+        // Return the number of elements in this tree.
+
+    Iterator upperBound(const KeyType& key) const;
+        // Return an iterator referring to the first element of this tree
+        // whose key is ordered after the specified 'key', or 'end()' if there
+        // is no such element.
+};
+
+// ============================================================================
+//                  TEMPLATE AND INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+                        // --------------------
+                        // struct BTree_ImpUtil
+                        // --------------------
+
+// CLASS METHODS
+template <class KEY_TYPE>
+inline
+int BTree_ImpUtil::countLess(const KEY_TYPE *keys,
+                             int             numKeys,
+                             const KEY_TYPE& key)
+{
+    BSLS_ASSERT_SAFE(0 <= numKeys);
+
+    int result = 0;
+    for (int i = 0; i < numKeys; ++i) {
+        result += keys[i] < key;
+    }
+    return result;
+}
+
+inline
+int BTree_ImpUtil::countLess(const int *keys, int numKeys, int key)
+{
+    BSLS_ASSERT_SAFE(0 <= numKeys);
+
+    int i = 0;
+
+#ifdef BSLSTL_BTREE_USE_SSE2
+    // Since 'keys' is sorted, the lanes of a group that are less than 'key'
+    // form a prefix of the group, and the first group that is not entirely
+    // less than 'key' determines the result.
+
+    const __m128i needle = _mm_set1_epi32(key);
+    for (; i + 4 <= numKeys; i += 4) {
+        const __m128i group = _mm_loadu_si128(
+                                  reinterpret_cast<const __m128i *>(keys + i));
+        const int mask = _mm_movemask_ps(
+                          _mm_castsi128_ps(_mm_cmplt_epi32(group, needle)));
+        if (0xF != mask) {
+            return i + (mask & 1) + ((mask >> 1) & 1) + ((mask >> 2) & 1);
+                                                                      // RETURN
+        }
+    }
+#endif
+
+    for (; i < numKeys && keys[i] < key; ++i) {
+    }
+    return i;
+}
+
+inline
+int BTree_ImpUtil::countLess(const double *keys, int numKeys, double key)
+{
+    BSLS_ASSERT_SAFE(0 <= numKeys);
+
+    int i = 0;
+
+#ifdef BSLSTL_BTREE_USE_SSE2
+    const __m128d needle = _mm_set1_pd(key);
+    for (; i + 2 <= numKeys; i += 2) {
+        const int mask = _mm_movemask_pd(
+                                _mm_cmplt_pd(_mm_loadu_pd(keys + i), needle));
+        if (0x3 != mask) {
+            return i + (mask & 1);                                    // RETURN
+        }
+    }
+#endif
+
+    for (; i < numKeys && keys[i] < key; ++i) {
+    }
+    return i;
+}
+
+template <class KEY_TYPE>
+inline
+int BTree_ImpUtil::countNotGreater(const KEY_TYPE *keys,
+                                   int             numKeys,
+                                   const KEY_TYPE& key)
+{
+    BSLS_ASSERT_SAFE(0 <= numKeys);
+
+    int result = 0;
+    for (int i = 0; i < numKeys; ++i) {
+        result += !(key < keys[i]);
+    }
+    return result;
+}
+
+inline
+int BTree_ImpUtil::countNotGreater(const int *keys, int numKeys, int key)
+{
+    BSLS_ASSERT_SAFE(0 <= numKeys);
+
+    int i = 0;
+
+#ifdef BSLSTL_BTREE_USE_SSE2
+    const __m128i needle = _mm_set1_epi32(key);
+    for (; i + 4 <= numKeys; i += 4) {
+        const __m128i group = _mm_loadu_si128(
+                                  reinterpret_cast<const __m128i *>(keys + i));
+        const int mask = ~_mm_movemask_ps(
+                          _mm_castsi128_ps(_mm_cmpgt_epi32(group, needle)));
+        if (0xF != (mask & 0xF)) {
+            return i + (mask & 1) + ((mask >> 1) & 1) + ((mask >> 2) & 1);
+                                                                      // RETURN
+        }
+    }
+#endif
+
+    for (; i < numKeys && !(key < keys[i]); ++i) {
+    }
+    return i;
+}
+
+inline
+int BTree_ImpUtil::countNotGreater(const double *keys,
+                                   int           numKeys,
+                                   double        key)
+{
+    BSLS_ASSERT_SAFE(0 <= numKeys);
+
+    int i = 0;
+
+#ifdef BSLSTL_BTREE_USE_SSE2
+    const __m128d needle = _mm_set1_pd(key);
+    for (; i + 2 <= numKeys; i += 2) {
+        const int mask = _mm_movemask_pd(
+                                _mm_cmple_pd(_mm_loadu_pd(keys + i), needle));
+        if (0x3 != mask) {
+            return i + (mask & 1);                                    // RETURN
+        }
+    }
+#endif
+
+    for (; i < numKeys && !(key < keys[i]); ++i) {
+    }
+    return i;
+}
+
+inline
+native_std::size_t BTree_ImpUtil::roundUpToCacheLine(native_std::size_t size)
+{
+    return (size + k_CACHE_LINE_SIZE - 1)
+         & ~native_std::size_t(k_CACHE_LINE_SIZE - 1);
+}
+
+                        // ---------------------
+                        // struct BTree_NodeUtil
+                        // ---------------------
+
+// CLASS METHODS
+template <class VALUE_TYPE>
+inline
+native_std::size_t BTree_NodeUtil<VALUE_TYPE>::nodeSize(bool isLeaf)
+{
+    return BTree_ImpUtil::roundUpToCacheLine(isLeaf ? sizeof(LeafNode)
+                                                    : sizeof(InternalNode));
+}
+
+template <class VALUE_TYPE>
+inline
+typename BTree_NodeUtil<VALUE_TYPE>::SlotType *
+BTree_NodeUtil<VALUE_TYPE>::slots(BTree_NodeHeader *node)
+{
+    BSLS_ASSERT_SAFE(node);
+
+    return reinterpret_cast<LeafNode *>(node)->d_slots;
+}
+
+template <class VALUE_TYPE>
+inline
+const typename BTree_NodeUtil<VALUE_TYPE>::SlotType *
+BTree_NodeUtil<VALUE_TYPE>::slots(const BTree_NodeHeader *node)
+{
+    BSLS_ASSERT_SAFE(node);
+
+    return reinterpret_cast<const LeafNode *>(node)->d_slots;
+}
+
+template <class VALUE_TYPE>
+inline
+BTree_NodeHeader **
+BTree_NodeUtil<VALUE_TYPE>::children(BTree_NodeHeader *node)
+{
+    BSLS_ASSERT_SAFE(node);
+    BSLS_ASSERT_SAFE(!node->d_isLeaf);
+
+    return reinterpret_cast<InternalNode *>(node)->d_children;
+}
+
+template <class VALUE_TYPE>
+inline
+BTree_NodeHeader *const *
+BTree_NodeUtil<VALUE_TYPE>::children(const BTree_NodeHeader *node)
+{
+    BSLS_ASSERT_SAFE(node);
+    BSLS_ASSERT_SAFE(!node->d_isLeaf);
+
+    return reinterpret_cast<const InternalNode *>(node)->d_children;
+}
+
+template <class VALUE_TYPE>
+inline
+VALUE_TYPE *
+BTree_NodeUtil<VALUE_TYPE>::address(bsls::ObjectBuffer<VALUE_TYPE> *slot)
+{
+    return &slot->object();
+}
+
+template <class VALUE_TYPE>
+inline
+VALUE_TYPE *BTree_NodeUtil<VALUE_TYPE>::address(VALUE_TYPE **slot)
+{
+    return *slot;
+}
+
+template <class VALUE_TYPE>
+inline
+const VALUE_TYPE *BTree_NodeUtil<VALUE_TYPE>::address(
+                                    const bsls::ObjectBuffer<VALUE_TYPE> *slot)
+{
+    return &slot->object();
+}
+
+template <class VALUE_TYPE>
+inline
+const VALUE_TYPE *BTree_NodeUtil<VALUE_TYPE>::address(
+                                                     VALUE_TYPE *const *slot)
+{
+    return *slot;
+}
+
+template <class VALUE_TYPE>
+inline
+VALUE_TYPE& BTree_NodeUtil<VALUE_TYPE>::value(BTree_NodeHeader *node,
+                                              int               index)
+{
+    BSLS_ASSERT_SAFE(0 <= index);
+    BSLS_ASSERT_SAFE(index < node->d_count);
+
+    return *address(slots(node) + index);
+}
+
+template <class VALUE_TYPE>
+inline
+const VALUE_TYPE& BTree_NodeUtil<VALUE_TYPE>::value(
+                                                const BTree_NodeHeader *node,
+                                                int                     index)
+{
+    BSLS_ASSERT_SAFE(0 <= index);
+    BSLS_ASSERT_SAFE(index < node->d_count);
+
+    return *address(slots(node) + index);
+}
+
+template <class VALUE_TYPE>
+inline
+BTree_NodeHeader *
+BTree_NodeUtil<VALUE_TYPE>::leftmostLeaf(BTree_NodeHeader *node)
+{
+    BSLS_ASSERT_SAFE(node);
+
+    while (!node->d_isLeaf) {
+        node = children(node)[0];
+    }
+    return node;
+}
+
+template <class VALUE_TYPE>
+inline
+BTree_NodeHeader *
+BTree_NodeUtil<VALUE_TYPE>::rightmostLeaf(BTree_NodeHeader *node)
+{
+    BSLS_ASSERT_SAFE(node);
+
+    while (!node->d_isLeaf) {
+        node = children(node)[node->d_count];
+    }
+    return node;
+}
+
+template <class VALUE_TYPE>
+inline
+void BTree_NodeUtil<VALUE_TYPE>::next(BTree_NodeHeader **node, int *position)
+{
+    BSLS_ASSERT_SAFE(node);
+    BSLS_ASSERT_SAFE(position);
+    BSLS_ASSERT_SAFE(*position < (*node)->d_count);
+
+    BTree_NodeHeader *current = *node;
+    int               index   = *position + 1;
+
+    if (!current->d_isLeaf) {
+        *node     = leftmostLeaf(children(current)[index]);
+        *position = 0;
+        return;                                                       // RETURN
+    }
+
+    // Climb while 'index' is past the last element of 'current'; the root at
+    // its element count is the past-the-end position.
+
+    while (index == current->d_count && current->d_parent_p) {
+        index   = current->d_position;
+        current = current->d_parent_p;
+    }
+    *node     = current;
+    *position = index;
+}
+
+template <class VALUE_TYPE>
+inline
+void BTree_NodeUtil<VALUE_TYPE>::previous(BTree_NodeHeader **node,
+                                          int               *position)
+{
+    BSLS_ASSERT_SAFE(node);
+    BSLS_ASSERT_SAFE(*node);
+    BSLS_ASSERT_SAFE(position);
+
+    BTree_NodeHeader *current = *node;
+    int               index   = *position;
+
+    if (!current->d_isLeaf) {
+        current   = rightmostLeaf(children(current)[index]);
+        *node     = current;
+        *position = current->d_count - 1;
+        return;                                                       // RETURN
+    }
+
+    while (0 == index) {
+        BSLS_ASSERT_SAFE(current->d_parent_p);
+
+        index   = current->d_position;
+        current = current->d_parent_p;
+    }
+    *node     = current;
+    *position = index - 1;
+}
+
+                        // -----------------------
+                        // struct BTree_NodeSearch
+                        // -----------------------
+
+// PRIVATE CLASS METHODS
+template <class KEY_CONFIG, class COMPARATOR>
+inline
+int BTree_NodeSearch<KEY_CONFIG, COMPARATOR>::lowerBoundImp(
+                                          const BTree_NodeHeader *node,
+                                          const KeyType&          key,
+                                          const COMPARATOR&       comparator,
+                                          bslmf::MetaInt<0>)
+{
+    const SlotType *slots  = NodeUtil::slots(node);
+    int             first  = 0;
+    int             length = node->d_count;
+
+    while (0 < length) {
+        const int half = length / 2;
+        const KeyType& probe = KEY_CONFIG::extractKey(
+                                     *NodeUtil::address(slots + first + half));
+        if (comparator(probe, key)) {
+            first  += half + 1;
+            length -= half + 1;
+        }
+        else {
+            length = half;
+        }
+    }
+    return first;
+}
+
+template <class KEY_CONFIG, class COMPARATOR>
+inline
+int BTree_NodeSearch<KEY_CONFIG, COMPARATOR>::lowerBoundImp(
+                                          const BTree_NodeHeader *node,
+                                          const KeyType&          key,
+                                          const COMPARATOR&,
+                                          bslmf::MetaInt<1>)
+{
+    const SlotType *slots  = NodeUtil::slots(node);
+    const int       count  = node->d_count;
+    int             result = 0;
+
+    for (int i = 0; i < count; ++i) {
+        result += KEY_CONFIG::extractKey(*NodeUtil::address(slots + i)) < key;
+    }
+    return result;
+}
+
+template <class KEY_CONFIG, class COMPARATOR>
+inline
+int BTree_NodeSearch<KEY_CONFIG, COMPARATOR>::lowerBoundImp(
+                                          const BTree_NodeHeader *node,
+                                          const KeyType&          key,
+                                          const COMPARATOR&,
+                                          bslmf::MetaInt<2>)
+{
+    return BTree_ImpUtil::countLess(
+                         reinterpret_cast<const NcKeyType *>(
+                                                    NodeUtil::slots(node)),
+                         node->d_count,
+                         key);
+}
+
+template <class KEY_CONFIG, class COMPARATOR>
+inline
+int BTree_NodeSearch<KEY_CONFIG, COMPARATOR>::upperBoundImp(
+                                          const BTree_NodeHeader *node,
+                                          const KeyType&          key,
+                                          const COMPARATOR&       comparator,
+                                          bslmf::MetaInt<0>)
+{
+    const SlotType *slots  = NodeUtil::slots(node);
+    int             first  = 0;
+    int             length = node->d_count;
+
+    while (0 < length) {
+        const int half = length / 2;
+        const KeyType& probe = KEY_CONFIG::extractKey(
+                                     *NodeUtil::address(slots + first + half));
+        if (!comparator(key, probe)) {
+            first  += half + 1;
+            length -= half + 1;
+        }
+        else {
+            length = half;
+        }
+    }
+    return first;
+}
+
+template <class KEY_CONFIG, class COMPARATOR>
+inline
+int BTree_NodeSearch<KEY_CONFIG, COMPARATOR>::upperBoundImp(
+                                          const BTree_NodeHeader *node,
+                                          const KeyType&          key,
+                                          const COMPARATOR&,
+                                          bslmf::MetaInt<1>)
+{
+    const SlotType *slots  = NodeUtil::slots(node);
+    const int       count  = node->d_count;
+    int             result = 0;
+
+    for (int i = 0; i < count; ++i) {
+        result +=
+               !(key < KEY_CONFIG::extractKey(*NodeUtil::address(slots + i)));
+    }
+    return result;
+}
+
+template <class KEY_CONFIG, class COMPARATOR>
+inline
+int BTree_NodeSearch<KEY_CONFIG, COMPARATOR>::upperBoundImp(
+                                          const BTree_NodeHeader *node,
+                                          const KeyType&          key,
+                                          const COMPARATOR&,
+                                          bslmf::MetaInt<2>)
+{
+    return BTree_ImpUtil::countNotGreater(
+                         reinterpret_cast<const NcKeyType *>(
+                                                    NodeUtil::slots(node)),
+                         node->d_count,
+                         key);
+}
+
+// CLASS METHODS
+template <class KEY_CONFIG, class COMPARATOR>
+inline
+int BTree_NodeSearch<KEY_CONFIG, COMPARATOR>::lowerBound(
+                                          const BTree_NodeHeader *node,
+                                          const KeyType&          key,
+                                          const COMPARATOR&       comparator)
+{
+    BSLS_ASSERT_SAFE(node);
+
+    return lowerBoundImp(node, key, comparator, bslmf::MetaInt<k_METHOD>());
+}
+
+template <class KEY_CONFIG, class COMPARATOR>
+inline
+int BTree_NodeSearch<KEY_CONFIG, COMPARATOR>::upperBound(
+                                          const BTree_NodeHeader *node,
+                                          const KeyType&          key,
+                                          const COMPARATOR&       comparator)
+{
+    BSLS_ASSERT_SAFE(node);
+
+    return upperBoundImp(node, key, comparator, bslmf::MetaInt<k_METHOD>());
+}
+
+                        // -------------------
+                        // class BTreeIterator
+                        // -------------------
+
+// CREATORS
+template <class VALUE_TYPE, class DIFFERENCE_TYPE>
+inline
+BTreeIterator<VALUE_TYPE, DIFFERENCE_TYPE>::BTreeIterator()
+: d_node_p(0)
+, d_position(0)
+{
+}
+
+template <class VALUE_TYPE, class DIFFERENCE_TYPE>
+inline
+BTreeIterator<VALUE_TYPE, DIFFERENCE_TYPE>::BTreeIterator(
+                                                    BTree_NodeHeader *node,
+                                                    int               position)
+: d_node_p(node)
+, d_position(position)
+{
+}
+
+template <class VALUE_TYPE, class DIFFERENCE_TYPE>
+inline
+BTreeIterator<VALUE_TYPE, DIFFERENCE_TYPE>::BTreeIterator(
+                                                       const NcIter& original)
+: d_node_p(original.node())
+, d_position(original.position())
+{
+}
+
+// MANIPULATORS
+template <class VALUE_TYPE, class DIFFERENCE_TYPE>
+inline
+BTreeIterator<VALUE_TYPE, DIFFERENCE_TYPE>&
+BTreeIterator<VALUE_TYPE, DIFFERENCE_TYPE>::operator++()
+{
+    BSLS_ASSERT_SAFE(d_node_p);
+
+    NodeUtil::next(&d_node_p, &d_position);
+    return *this;
+}
+
+template <class VALUE_TYPE, class DIFFERENCE_TYPE>
+inline
+BTreeIterator<VALUE_TYPE, DIFFERENCE_TYPE>&
+BTreeIterator<VALUE_TYPE, DIFFERENCE_TYPE>::operator--()
+{
+    BSLS_ASSERT_SAFE(d_node_p);
+
+    NodeUtil::previous(&d_node_p, &d_position);
+    return *this;
+}
+
+// ACCESSORS
+template <class VALUE_TYPE, class DIFFERENCE_TYPE>
+inline
+typename BTreeIterator<VALUE_TYPE, DIFFERENCE_TYPE>::reference
+BTreeIterator<VALUE_TYPE, DIFFERENCE_TYPE>::operator*() const
+{
+    BSLS_ASSERT_SAFE(d_node_p);
+
+    return NodeUtil::value(d_node_p, d_position);
+}
+
+template <class VALUE_TYPE, class DIFFERENCE_TYPE>
+inline
+typename BTreeIterator<VALUE_TYPE, DIFFERENCE_TYPE>::pointer
+BTreeIterator<VALUE_TYPE, DIFFERENCE_TYPE>::operator->() const
+{
+    BSLS_ASSERT_SAFE(d_node_p);
+
+    return &NodeUtil::value(d_node_p, d_position);
+}
+
+template <class VALUE_TYPE, class DIFFERENCE_TYPE>
+inline
+BTree_NodeHeader *BTreeIterator<VALUE_TYPE, DIFFERENCE_TYPE>::node() const
+{
+    return d_node_p;
+}
+
+template <class VALUE_TYPE, class DIFFERENCE_TYPE>
+inline
+int BTreeIterator<VALUE_TYPE, DIFFERENCE_TYPE>::position() const
+{
+    return d_position;
+}
+
+// FREE OPERATORS
+template <class VALUE_TYPE, class DIFFERENCE_TYPE>
+inline
+bool operator==(const BTreeIterator<VALUE_TYPE, DIFFERENCE_TYPE>& lhs,
+                const BTreeIterator<VALUE_TYPE, DIFFERENCE_TYPE>& rhs)
+{
+    return lhs.node()     == rhs.node()
+        && lhs.position() == rhs.position();
+}
+
+template <class VALUE_TYPE, class DIFFERENCE_TYPE>
+inline
+bool operator==(const BTreeIterator<VALUE_TYPE, DIFFERENCE_TYPE>&       lhs,
+                const BTreeIterator<const VALUE_TYPE, DIFFERENCE_TYPE>& rhs)
+{
+    return lhs.node()     == rhs.node()
+        && lhs.position() == rhs.position();
+}
+
+template <class VALUE_TYPE, class DIFFERENCE_TYPE>
+inline
+bool operator==(const BTreeIterator<const VALUE_TYPE, DIFFERENCE_TYPE>& lhs,
+                const BTreeIterator<VALUE_TYPE, DIFFERENCE_TYPE>&       rhs)
+{
+    return lhs.node()     == rhs.node()
+        && lhs.position() == rhs.position();
+}
+
+template <class VALUE_TYPE, class DIFFERENCE_TYPE>
+inline
+bool operator!=(const BTreeIterator<VALUE_TYPE, DIFFERENCE_TYPE>& lhs,
+                const BTreeIterator<VALUE_TYPE, DIFFERENCE_TYPE>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+template <class VALUE_TYPE, class DIFFERENCE_TYPE>
+inline
+bool operator!=(const BTreeIterator<VALUE_TYPE, DIFFERENCE_TYPE>&       lhs,
+                const BTreeIterator<const VALUE_TYPE, DIFFERENCE_TYPE>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+template <class VALUE_TYPE, class DIFFERENCE_TYPE>
+inline
+bool operator!=(const BTreeIterator<const VALUE_TYPE, DIFFERENCE_TYPE>& lhs,
+                const BTreeIterator<VALUE_TYPE, DIFFERENCE_TYPE>&       rhs)
+{
+    return !(lhs == rhs);
+}
+
+template <class VALUE_TYPE, class DIFFERENCE_TYPE>
+inline
+BTreeIterator<VALUE_TYPE, DIFFERENCE_TYPE>
+operator++(BTreeIterator<VALUE_TYPE, DIFFERENCE_TYPE>& iter, int)
+{
+    BTreeIterator<VALUE_TYPE, DIFFERENCE_TYPE> temp(iter);
+    ++iter;
+    return temp;
+}
+
+template <class VALUE_TYPE, class DIFFERENCE_TYPE>
+inline
+BTreeIterator<VALUE_TYPE, DIFFERENCE_TYPE>
+operator--(BTreeIterator<VALUE_TYPE, DIFFERENCE_TYPE>& iter, int)
+{
+    BTreeIterator<VALUE_TYPE, DIFFERENCE_TYPE> temp(iter);
+    --iter;
+    return temp;
+}
+
+                        // --------------------
+                        // class BTree_Proctor
+                        // --------------------
+
+// CREATORS
+template <class BTREE>
+inline
+BTree_Proctor<BTREE>::BTree_Proctor(BTREE *tree)
+: d_tree_p(tree)
+{
+    BSLS_ASSERT_SAFE(tree);
+}
+
+template <class BTREE>
+inline
+BTree_Proctor<BTREE>::~BTree_Proctor()
+{
+    if (d_tree_p) {
+        d_tree_p->removeAll();
+    }
+}
+
+// MANIPULATORS
+template <class BTREE>
+inline
+void BTree_Proctor<BTREE>::release()
+{
+    d_tree_p = 0;
+}
+
+                        // ------------------------
+                        // class BTree_NodeProctor
+                        // ------------------------
+
+// CREATORS
+template <class BTREE>
+inline
+BTree_NodeProctor<BTREE>::BTree_NodeProctor(BTREE            *tree,
+                                            BTree_NodeHeader *node)
+: d_tree_p(tree)
+, d_node_p(node)
+{
+    BSLS_ASSERT_SAFE(tree);
+    BSLS_ASSERT_SAFE(node);
+}
+
+template <class BTREE>
+inline
+BTree_NodeProctor<BTREE>::~BTree_NodeProctor()
+{
+    if (d_node_p) {
+        d_tree_p->deallocateNode(d_node_p);
+    }
+}
+
+// MANIPULATORS
+template <class BTREE>
+inline
+void BTree_NodeProctor<BTREE>::release()
+{
+    d_node_p = 0;
+}
+
+                        // ------------------------
+                        // class BTree_SlotProctor
+                        // ------------------------
+
+// CREATORS
+template <class BTREE>
+inline
+BTree_SlotProctor<BTREE>::BTree_SlotProctor(BTREE *tree, SlotType *slot)
+: d_tree_p(tree)
+, d_slot_p(slot)
+, d_isConstructed(false)
+{
+    BSLS_ASSERT_SAFE(tree);
+    BSLS_ASSERT_SAFE(slot);
+}
+
+template <class BTREE>
+inline
+BTree_SlotProctor<BTREE>::~BTree_SlotProctor()
+{
+    if (d_slot_p) {
+        if (d_isConstructed) {
+            d_tree_p->destroySlot(d_slot_p);
+        }
+        else {
+            d_tree_p->releaseSlotStorage(d_slot_p);
+        }
+    }
+}
+
+// MANIPULATORS
+template <class BTREE>
+inline
+void BTree_SlotProctor<BTREE>::setConstructed()
+{
+    d_isConstructed = true;
+}
+
+template <class BTREE>
+inline
+void BTree_SlotProctor<BTREE>::release()
+{
+    d_slot_p = 0;
+}
+
+                        // -----------
+                        // class BTree
+                        // -----------
+
+// PRIVATE CLASS METHODS
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+native_std::size_t
+BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::numBlocks(bool isLeaf)
+{
+    return (NodeUtil::nodeSize(isLeaf) + sizeof(BlockType) - 1)
+         / sizeof(BlockType);
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+void BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::setChild(NodeHeader *parent,
+                                                        int         index,
+                                                        NodeHeader *child)
+{
+    NodeUtil::children(parent)[index] = child;
+    child->d_parent_p = parent;
+    child->d_position = static_cast<unsigned short>(index);
+}
+
+// PRIVATE MANIPULATORS
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+typename BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::NodeHeader *
+BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::allocateNode(bool isLeaf)
+{
+    BlockAllocator  blockAllocator(d_allocator);
+    BlockType      *block = BlockAllocTraits::allocate(blockAllocator,
+                                                       numBlocks(isLeaf));
+    NodeHeader     *node  = reinterpret_cast<NodeHeader *>(block);
+
+    node->d_parent_p = 0;
+    node->d_position = 0;
+    node->d_count    = 0;
+    node->d_isLeaf   = isLeaf;
+    return node;
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+void BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::deallocateNode(NodeHeader *node)
+{
+    BlockAllocator blockAllocator(d_allocator);
+    BlockAllocTraits::deallocate(blockAllocator,
+                                 reinterpret_cast<BlockType *>(node),
+                                 numBlocks(node->d_isLeaf));
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+typename BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::ValueType *
+BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::acquireSlotStorage(
+                                         bsls::ObjectBuffer<ValueType> *slot)
+{
+    return &slot->object();
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+typename BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::ValueType *
+BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::acquireSlotStorage(ValueType **slot)
+{
+    *slot = AllocatorTraits::allocate(d_allocator, 1);
+    return *slot;
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+void BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::releaseSlotStorage(
+                                               bsls::ObjectBuffer<ValueType> *)
+{
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+void BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::releaseSlotStorage(
+                                                              ValueType **slot)
+{
+    AllocatorTraits::deallocate(d_allocator, *slot, 1);
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+void BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::destroySlot(SlotType *slot)
+{
+    AllocatorTraits::destroy(d_allocator, NodeUtil::address(slot));
+    releaseSlotStorage(slot);
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+void BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::destroyNode(NodeHeader *node)
+{
+    SlotType *slots = NodeUtil::slots(node);
+    for (int i = 0; i < node->d_count; ++i) {
+        destroySlot(slots + i);
+    }
+    if (!node->d_isLeaf) {
+        NodeHeader **children = NodeUtil::children(node);
+        for (int i = 0; i <= node->d_count; ++i) {
+            destroyNode(children[i]);
+        }
+    }
+    deallocateNode(node);
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+typename BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::Iterator
+BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::insertSlot(NodeHeader *node,
+                                                     int         position,
+                                                     SlotType   *slot)
+{
+    if (0 == node) {
+        BSLS_ASSERT_SAFE(0 == d_root_p);
+        BSLS_ASSERT_SAFE(0 == position);
+
+        node = allocateNode(true);
+        d_root_p      = node;
+        d_leftmost_p  = node;
+        d_rightmost_p = node;
+    }
+    else if (k_MAX_VALUES == node->d_count) {
+        splitNode(&node, &position);
+    }
+
+    BSLS_ASSERT_SAFE(node->d_isLeaf);
+    BSLS_ASSERT_SAFE(position <= node->d_count);
+
+    SlotType *slots = NodeUtil::slots(node);
+    native_std::memmove(static_cast<void *>(slots + position + 1),
+                        static_cast<void *>(slots + position),
+                        (node->d_count - position) * sizeof(SlotType));
+    native_std::memcpy(static_cast<void *>(slots + position),
+                       static_cast<void *>(slot),
+                       sizeof(SlotType));
+    ++node->d_count;
+    ++d_size;
+
+    return Iterator(node, position);
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+void BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::splitNode(NodeHeader **node,
+                                                         int         *position)
+{
+    NodeHeader *left = *node;
+
+    BSLS_ASSERT_SAFE(k_MAX_VALUES == left->d_count);
+
+    // Allocate everything that may be needed before modifying the tree, so
+    // that this tree is unchanged if an exception is thrown.
+
+    NodeHeader *right = allocateNode(left->d_isLeaf);
+    BTree_NodeProctor<BTree> rightProctor(this, right);
+
+    NodeHeader *parent = left->d_parent_p;
+    if (0 == parent) {
+        parent = allocateNode(false);
+        setChild(parent, 0, left);
+        d_root_p = parent;
+    }
+    else if (k_MAX_VALUES == parent->d_count) {
+        int parentPosition = left->d_position;
+        splitNode(&parent, &parentPosition);
+        parent = left->d_parent_p;
+    }
+    rightProctor.release();
+
+    // Choose the index of the element moving up to 'parent': an element
+    // being appended (or prepended) leaves 'left' full, so that a tree built
+    // from a sorted sequence has full nodes (see {Sequential Insertion}).
+
+    const int index = k_MAX_VALUES == *position
+                      ? k_MAX_VALUES - 1
+                      : 0 == *position
+                        ? 0
+                        : k_MAX_VALUES / 2;
+    const int numMoved = k_MAX_VALUES - index - 1;
+
+    SlotType *leftSlots  = NodeUtil::slots(left);
+    native_std::memcpy(static_cast<void *>(NodeUtil::slots(right)),
+                       static_cast<void *>(leftSlots + index + 1),
+                       numMoved * sizeof(SlotType));
+    if (!left->d_isLeaf) {
+        NodeHeader **leftChildren = NodeUtil::children(left);
+        for (int i = 0; i <= numMoved; ++i) {
+            setChild(right, i, leftChildren[index + 1 + i]);
+        }
+    }
+    right->d_count = static_cast<unsigned short>(numMoved);
+    left->d_count  = static_cast<unsigned short>(index);
+
+    // Insert the separating element, and 'right', into 'parent'.
+
+    const int     separator     = left->d_position;
+    SlotType     *parentSlots   = NodeUtil::slots(parent);
+    NodeHeader  **parentChildren = NodeUtil::children(parent);
+    const int     parentCount   = parent->d_count;
+
+    native_std::memmove(static_cast<void *>(parentSlots + separator + 1),
+                        static_cast<void *>(parentSlots + separator),
+                        (parentCount - separator) * sizeof(SlotType));
+    native_std::memcpy(static_cast<void *>(parentSlots + separator),
+                       static_cast<void *>(leftSlots + index),
+                       sizeof(SlotType));
+    for (int i = parentCount; i > separator; --i) {
+        setChild(parent, i + 1, parentChildren[i]);
+    }
+    setChild(parent, separator + 1, right);
+    ++parent->d_count;
+
+    if (left == d_rightmost_p) {
+        d_rightmost_p = right;
+    }
+
+    if (*position > index) {
+        *node      = right;
+        *position -= index + 1;
+    }
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+void BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::rebalance(
+                                                    NodeHeader  *node,
+                                                    NodeHeader **resultNode,
+                                                    int         *result)
+{
+    while (node != d_root_p && node->d_count < k_MIN_VALUES) {
+        NodeHeader *parent   = node->d_parent_p;
+        const int   position = node->d_position;
+        NodeHeader *left     = 0 < position
+                               ? NodeUtil::children(parent)[position - 1]
+                               : 0;
+        NodeHeader *right    = position < parent->d_count
+                               ? NodeUtil::children(parent)[position + 1]
+                               : 0;
+
+        if (right && node->d_count + right->d_count < k_MAX_VALUES) {
+            mergeWithRight(node, resultNode, result);
+        }
+        else if (left && left->d_count + node->d_count < k_MAX_VALUES) {
+            mergeWithRight(left, resultNode, result);
+        }
+        else if (right) {
+            borrowFromRight(node,
+                            (right->d_count - node->d_count) / 2,
+                            resultNode,
+                            result);
+            return;                                                   // RETURN
+        }
+        else {
+            borrowFromLeft(node,
+                           (left->d_count - node->d_count) / 2,
+                           resultNode,
+                           result);
+            return;                                                   // RETURN
+        }
+        node = parent;
+    }
+
+    if (0 == d_root_p->d_count) {
+        NodeHeader *root = d_root_p;
+        if (root->d_isLeaf) {
+            d_root_p      = 0;
+            d_leftmost_p  = 0;
+            d_rightmost_p = 0;
+        }
+        else {
+            d_root_p = NodeUtil::children(root)[0];
+            d_root_p->d_parent_p = 0;
+            d_root_p->d_position = 0;
+        }
+        deallocateNode(root);
+    }
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+void BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::mergeWithRight(
+                                                    NodeHeader  *left,
+                                                    NodeHeader **resultNode,
+                                                    int         *result)
+{
+    NodeHeader *parent    = left->d_parent_p;
+    const int   separator = left->d_position;
+    NodeHeader *right     = NodeUtil::children(parent)[separator + 1];
+    const int   leftCount = left->d_count;
+    const int   rightCount = right->d_count;
+
+    BSLS_ASSERT_SAFE(leftCount + rightCount < k_MAX_VALUES);
+
+    SlotType *leftSlots   = NodeUtil::slots(left);
+    SlotType *parentSlots = NodeUtil::slots(parent);
+
+    native_std::memcpy(static_cast<void *>(leftSlots + leftCount),
+                       static_cast<void *>(parentSlots + separator),
+                       sizeof(SlotType));
+    native_std::memcpy(static_cast<void *>(leftSlots + leftCount + 1),
+                       static_cast<void *>(NodeUtil::slots(right)),
+                       rightCount * sizeof(SlotType));
+    if (!left->d_isLeaf) {
+        NodeHeader **rightChildren = NodeUtil::children(right);
+        for (int i = 0; i <= rightCount; ++i) {
+            setChild(left, leftCount + 1 + i, rightChildren[i]);
+        }
+    }
+    left->d_count = static_cast<unsigned short>(leftCount + 1 + rightCount);
+
+    const int parentCount = parent->d_count;
+    native_std::memmove(static_cast<void *>(parentSlots + separator),
+                        static_cast<void *>(parentSlots + separator + 1),
+                        (parentCount - separator - 1) * sizeof(SlotType));
+    NodeHeader **parentChildren = NodeUtil::children(parent);
+    for (int i = separator + 2; i <= parentCount; ++i) {
+        setChild(parent, i - 1, parentChildren[i]);
+    }
+    --parent->d_count;
+
+    if (right == d_rightmost_p) {
+        d_rightmost_p = left;
+    }
+    if (right == *resultNode) {
+        *resultNode = left;
+        *result    += leftCount + 1;
+    }
+    else if (parent == *resultNode && separator <= *result) {
+        if (separator == *result) {
+            *resultNode = left;
+            *result     = leftCount;
+        }
+        else {
+            --*result;
+        }
+    }
+    deallocateNode(right);
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+void BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::borrowFromRight(
+                                                    NodeHeader  *left,
+                                                    int          numElements,
+                                                    NodeHeader **resultNode,
+                                                    int         *result)
+{
+    NodeHeader *parent     = left->d_parent_p;
+    const int   separator  = left->d_position;
+    NodeHeader *right      = NodeUtil::children(parent)[separator + 1];
+    const int   leftCount  = left->d_count;
+    const int   rightCount = right->d_count;
+    const int   k          = numElements;
+
+    BSLS_ASSERT_SAFE(0 < k);
+    BSLS_ASSERT_SAFE(k < rightCount);
+
+    SlotType *leftSlots   = NodeUtil::slots(left);
+    SlotType *rightSlots  = NodeUtil::slots(right);
+    SlotType *parentSlots = NodeUtil::slots(parent);
+
+    native_std::memcpy(static_cast<void *>(leftSlots + leftCount),
+                       static_cast<void *>(parentSlots + separator),
+                       sizeof(SlotType));
+    native_std::memcpy(static_cast<void *>(leftSlots + leftCount + 1),
+                       static_cast<void *>(rightSlots),
+                       (k - 1) * sizeof(SlotType));
+    native_std::memcpy(static_cast<void *>(parentSlots + separator),
+                       static_cast<void *>(rightSlots + k - 1),
+                       sizeof(SlotType));
+    native_std::memmove(static_cast<void *>(rightSlots),
+                        static_cast<void *>(rightSlots + k),
+                        (rightCount - k) * sizeof(SlotType));
+    if (!left->d_isLeaf) {
+        NodeHeader **rightChildren = NodeUtil::children(right);
+        for (int i = 0; i < k; ++i) {
+            setChild(left, leftCount + 1 + i, rightChildren[i]);
+        }
+        for (int i = k; i <= rightCount; ++i) {
+            setChild(right, i - k, rightChildren[i]);
+        }
+    }
+    left->d_count  = static_cast<unsigned short>(leftCount + k);
+    right->d_count = static_cast<unsigned short>(rightCount - k);
+
+    if (right == *resultNode) {
+        if (k <= *result) {
+            *result -= k;
+        }
+        else if (k - 1 == *result) {
+            *resultNode = parent;
+            *result     = separator;
+        }
+        else {
+            *resultNode = left;
+            *result    += leftCount + 1;
+        }
+    }
+    else if (parent == *resultNode && separator == *result) {
+        *resultNode = left;
+        *result     = leftCount;
+    }
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+void BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::borrowFromLeft(
+                                                    NodeHeader  *right,
+                                                    int          numElements,
+                                                    NodeHeader **resultNode,
+                                                    int         *result)
+{
+    NodeHeader *parent     = right->d_parent_p;
+    const int   separator  = right->d_position - 1;
+    NodeHeader *left       = NodeUtil::children(parent)[separator];
+    const int   leftCount  = left->d_count;
+    const int   rightCount = right->d_count;
+    const int   k          = numElements;
+
+    BSLS_ASSERT_SAFE(0 < k);
+    BSLS_ASSERT_SAFE(k < leftCount);
+
+    SlotType *leftSlots   = NodeUtil::slots(left);
+    SlotType *rightSlots  = NodeUtil::slots(right);
+    SlotType *parentSlots = NodeUtil::slots(parent);
+
+    native_std::memmove(static_cast<void *>(rightSlots + k),
+                        static_cast<void *>(rightSlots),
+                        rightCount * sizeof(SlotType));
+    native_std::memcpy(static_cast<void *>(rightSlots + k - 1),
+                       static_cast<void *>(parentSlots + separator),
+                       sizeof(SlotType));
+    native_std::memcpy(static_cast<void *>(rightSlots),
+                       static_cast<void *>(leftSlots + leftCount - k + 1),
+                       (k - 1) * sizeof(SlotType));
+    native_std::memcpy(static_cast<void *>(parentSlots + separator),
+                       static_cast<void *>(leftSlots + leftCount - k),
+                       sizeof(SlotType));
+    if (!right->d_isLeaf) {
+        NodeHeader **rightChildren = NodeUtil::children(right);
+        NodeHeader **leftChildren  = NodeUtil::children(left);
+        for (int i = rightCount; i >= 0; --i) {
+            setChild(right, i + k, rightChildren[i]);
+        }
+        for (int i = 0; i < k; ++i) {
+            setChild(right, i, leftChildren[leftCount - k + 1 + i]);
+        }
+    }
+    left->d_count  = static_cast<unsigned short>(leftCount - k);
+    right->d_count = static_cast<unsigned short>(rightCount + k);
+
+    if (right == *resultNode) {
+        *result += k;
+    }
+    else if (left == *resultNode && leftCount - k <= *result) {
+        if (leftCount - k == *result) {
+            *resultNode = parent;
+            *result     = separator;
+        }
+        else {
+            *resultNode = right;
+            *result    -= leftCount - k + 1;
+        }
+    }
+    else if (parent == *resultNode && separator == *result) {
+        *resultNode = right;
+        *result     = k - 1;
+    }
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+typename BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::Iterator
+BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::appendValue(const ValueType& value)
+{
+    SlotType  slot;
+    ValueType *address = acquireSlotStorage(&slot);
+
+    BTree_SlotProctor<BTree> proctor(this, &slot);
+    AllocatorTraits::construct(d_allocator, address, value);
+    proctor.setConstructed();
+
+    Iterator result = insertSlot(d_rightmost_p,
+                                 d_rightmost_p ? d_rightmost_p->d_count : 0,
+                                 &slot);
+    proctor.release();
+    return result;
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+void BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::quickSwapRetainAllocators(
+                                                                 BTree *other)
+{
+    BSLS_ASSERT_SAFE(other);
+
+    bslalg::SwapUtil::swap(&d_root_p,      &other->d_root_p);
+    bslalg::SwapUtil::swap(&d_leftmost_p,  &other->d_leftmost_p);
+    bslalg::SwapUtil::swap(&d_rightmost_p, &other->d_rightmost_p);
+    bslalg::SwapUtil::swap(&d_size,        &other->d_size);
+    bslalg::SwapUtil::swap(&d_comparator,  &other->d_comparator);
+}
+
+// PRIVATE ACCESSORS
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+const typename BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::KeyType&
+BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::lastKey() const
+{
+    BSLS_ASSERT_SAFE(d_rightmost_p);
+
+    return KEY_CONFIG::extractKey(
+               NodeUtil::value(static_cast<const NodeHeader *>(d_rightmost_p),
+                               d_rightmost_p->d_count - 1));
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+typename BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::Iterator
+BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::makeIterator(NodeHeader *node,
+                                                       int         position)
+                                                                         const
+{
+    while (position == node->d_count && node->d_parent_p) {
+        position = node->d_position;
+        node     = node->d_parent_p;
+    }
+    return Iterator(node, position);
+}
+
+// CREATORS
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::BTree(
+                                            const COMPARATOR& comparator,
+                                            const ALLOCATOR&  basicAllocator)
+: d_root_p(0)
+, d_leftmost_p(0)
+, d_rightmost_p(0)
+, d_size(0)
+, d_comparator(comparator)
+, d_allocator(basicAllocator)
+{
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::BTree(
+                                              const BTree&     original,
+                                              const ALLOCATOR& basicAllocator)
+: d_root_p(0)
+, d_leftmost_p(0)
+, d_rightmost_p(0)
+, d_size(0)
+, d_comparator(original.d_comparator)
+, d_allocator(basicAllocator)
+{
+    BTree_Proctor<BTree> proctor(this);
+    for (Iterator it = original.begin(); it != original.end(); ++it) {
+        appendValue(*it);
+    }
+    proctor.release();
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::~BTree()
+{
+    removeAll();
+}
+
+// MANIPULATORS
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>&
+BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::operator=(const BTree& rhs)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(this != &rhs)) {
+
+        if (AllocatorTraits::propagate_on_container_copy_assignment::VALUE) {
+            BTree other(rhs, rhs.d_allocator);
+            bslalg::SwapUtil::swap(&d_allocator, &other.d_allocator);
+            quickSwapRetainAllocators(&other);
+        }
+        else {
+            BTree other(rhs, d_allocator);
+            quickSwapRetainAllocators(&other);
+        }
+    }
+    return *this;
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+bsl::pair<typename BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::Iterator, bool>
+BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::insertUnique(const ValueType& value)
+{
+    typedef bsl::pair<Iterator, bool> ResultType;
+
+    const KeyType& key      = KEY_CONFIG::extractKey(value);
+    NodeHeader    *node     = d_rightmost_p;
+    int            position = node ? node->d_count : 0;
+
+    if (node && !d_comparator(lastKey(), key)) {
+        node = d_root_p;
+        while (true) {
+            position = NodeSearch::lowerBound(node, key, d_comparator);
+            if (position < node->d_count
+             && !d_comparator(key,
+                              KEY_CONFIG::extractKey(
+                                  NodeUtil::value(node, position)))) {
+                return ResultType(Iterator(node, position), false);   // RETURN
+            }
+            if (node->d_isLeaf) {
+                break;
+            }
+            node = NodeUtil::children(node)[position];
+        }
+    }
+
+    // 'value' cannot refer to an element of this tree (otherwise it would
+    // have been found), so it remains valid if nodes are split.
+
+    SlotType   slot;
+    ValueType *address = acquireSlotStorage(&slot);
+
+    BTree_SlotProctor<BTree> proctor(this, &slot);
+    AllocatorTraits::construct(d_allocator, address, value);
+    proctor.setConstructed();
+
+    Iterator result = insertSlot(node, position, &slot);
+    proctor.release();
+    return ResultType(result, true);
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+typename BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::Iterator
+BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::insertMulti(const ValueType& value)
+{
+    // Copy 'value' before searching, since it may refer to an element of this
+    // tree that would be moved by splitting a node.
+
+    SlotType   slot;
+    ValueType *address = acquireSlotStorage(&slot);
+
+    BTree_SlotProctor<BTree> proctor(this, &slot);
+    AllocatorTraits::construct(d_allocator, address, value);
+    proctor.setConstructed();
+
+    const KeyType& key      = KEY_CONFIG::extractKey(*address);
+    NodeHeader    *node     = d_rightmost_p;
+    int            position = node ? node->d_count : 0;
+
+    if (node && d_comparator(key, lastKey())) {
+        node = d_root_p;
+        while (true) {
+            position = NodeSearch::upperBound(node, key, d_comparator);
+            if (node->d_isLeaf) {
+                break;
+            }
+            node = NodeUtil::children(node)[position];
+        }
+    }
+
+    Iterator result = insertSlot(node, position, &slot);
+    proctor.release();
+    return result;
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+typename BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::Iterator
+BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::insertIfMissing(const KeyType& key)
+{
+    typedef typename ValueType::second_type MappedType;
+
+    NodeHeader *node     = d_rightmost_p;
+    int         position = node ? node->d_count : 0;
+
+    if (node && !d_comparator(lastKey(), key)) {
+        node = d_root_p;
+        while (true) {
+            position = NodeSearch::lowerBound(node, key, d_comparator);
+            if (position < node->d_count
+             && !d_comparator(key,
+                              KEY_CONFIG::extractKey(
+                                  NodeUtil::value(node, position)))) {
+                return Iterator(node, position);                      // RETURN
+            }
+            if (node->d_isLeaf) {
+                break;
+            }
+            node = NodeUtil::children(node)[position];
+        }
+    }
+
+    SlotType   slot;
+    ValueType *address = acquireSlotStorage(&slot);
+
+    BTree_SlotProctor<BTree> proctor(this, &slot);
+    AllocatorTraits::construct(d_allocator, address, key, MappedType());
+    proctor.setConstructed();
+
+    Iterator result = insertSlot(node, position, &slot);
+    proctor.release();
+    return result;
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+typename BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::Iterator
+BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::remove(Iterator position)
+{
+    NodeHeader *node  = position.node();
+    const int   index = position.position();
+
+    BSLS_ASSERT(node);
+    BSLS_ASSERT(0 <= index);
+    BSLS_ASSERT(index < node->d_count);
+
+    SlotType *slots = NodeUtil::slots(node);
+    destroySlot(slots + index);
+
+    // An element of an internal node is replaced by its predecessor, taken
+    // from the end of the rightmost leaf of its left subtree, so that an
+    // element is always physically removed from a leaf.  The position of the
+    // element following the removed one is tracked through rebalancing.
+
+    NodeHeader *leaf;
+    int         result;
+    const bool  isInternal = !node->d_isLeaf;
+
+    if (isInternal) {
+        leaf = NodeUtil::rightmostLeaf(NodeUtil::children(node)[index]);
+        --leaf->d_count;
+        native_std::memcpy(
+                 static_cast<void *>(slots + index),
+                 static_cast<void *>(NodeUtil::slots(leaf) + leaf->d_count),
+                 sizeof(SlotType));
+        result = leaf->d_count;
+    }
+    else {
+        leaf = node;
+        native_std::memmove(static_cast<void *>(slots + index),
+                            static_cast<void *>(slots + index + 1),
+                            (node->d_count - index - 1) * sizeof(SlotType));
+        --leaf->d_count;
+        result = index;
+    }
+    --d_size;
+
+    NodeHeader *resultNode = leaf;
+    rebalance(leaf, &resultNode, &result);
+
+    if (0 == d_root_p) {
+        return end();                                                 // RETURN
+    }
+
+    // For an internal element, the tracked position is that of the
+    // predecessor, now holding the slot of the removed element.
+
+    Iterator next = makeIterator(resultNode, result);
+    if (isInternal) {
+        ++next;
+    }
+    return next;
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+void BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::removeAll()
+{
+    if (d_root_p) {
+        destroyNode(d_root_p);
+        d_root_p      = 0;
+        d_leftmost_p  = 0;
+        d_rightmost_p = 0;
+        d_size        = 0;
+    }
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+void BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::swap(BTree& other)
+{
+    if (AllocatorTraits::propagate_on_container_swap::VALUE) {
+        bslalg::SwapUtil::swap(&d_allocator, &other.d_allocator);
+    }
+    else {
+        // C++11 behavior: undefined for unequal allocators
+
+        BSLS_ASSERT(d_allocator == other.d_allocator);
+    }
+    quickSwapRetainAllocators(&other);
+}
+
+// ACCESSORS
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+ALLOCATOR BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::allocator() const
+{
+    return d_allocator;
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+typename BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::Iterator
+BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::begin() const
+{
+    return d_root_p ? Iterator(d_leftmost_p, 0) : Iterator();
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+const COMPARATOR& BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::comparator() const
+{
+    return d_comparator;
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+typename BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::Iterator
+BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::end() const
+{
+    return d_root_p ? Iterator(d_root_p, d_root_p->d_count) : Iterator();
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+typename BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::Iterator
+BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::find(const KeyType& key) const
+{
+    NodeHeader *node = d_root_p;
+    while (node) {
+        const int position = NodeSearch::lowerBound(node, key, d_comparator);
+        if (position < node->d_count
+         && !d_comparator(key,
+                          KEY_CONFIG::extractKey(
+                                          NodeUtil::value(node, position)))) {
+            return Iterator(node, position);                          // RETURN
+        }
+        if (node->d_isLeaf) {
+            break;
+        }
+        node = NodeUtil::children(node)[position];
+    }
+    return end();
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+int BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::height() const
+{
+    int result = 0;
+    for (const NodeHeader *node = d_root_p; node; ++result) {
+        if (node->d_isLeaf) {
+            node = 0;
+        }
+        else {
+            node = NodeUtil::children(node)[0];
+        }
+    }
+    return result;
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+typename BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::Iterator
+BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::lowerBound(const KeyType& key) const
+{
+    // The candidate found in a subtree precedes the one found in its parent,
+    // so the last candidate found on the way down is the result.
+
+    Iterator    result = end();
+    NodeHeader *node   = d_root_p;
+    while (node) {
+        const int position = NodeSearch::lowerBound(node, key, d_comparator);
+        if (position < node->d_count) {
+            result = Iterator(node, position);
+        }
+        node = node->d_isLeaf ? 0 : NodeUtil::children(node)[position];
+    }
+    return result;
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+typename BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::SizeType
+BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::maxSize() const
+{
+    return AllocatorTraits::max_size(d_allocator) / sizeof(ValueType);
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+const BTree_NodeHeader *
+BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::rootNode() const
+{
+    return d_root_p;
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+typename BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::SizeType
+BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::size() const
+{
+    return d_size;
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+typename BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::Iterator
+BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::upperBound(const KeyType& key) const
+{
+    Iterator    result = end();
+    NodeHeader *node   = d_root_p;
+    while (node) {
+        const int position = NodeSearch::upperBound(node, key, d_comparator);
+        if (position < node->d_count) {
+            result = Iterator(node, position);
+        }
+        node = node->d_isLeaf ? 0 : NodeUtil::children(node)[position];
+    }
+    return result;
+}
+
+}  // close package namespace
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
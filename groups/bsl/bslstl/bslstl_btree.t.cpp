@@ -0,0 +1,1175 @@
+// bslstl_btree.t.cpp                                                 -*-C++-*-
+
+#include <bslstl_btree.h>
+
+#include <bslstl_allocator.h>
+#include <bslstl_pair.h>
+#include <bslstl_unorderedmapkeyconfiguration.h>
+#include <bslstl_unorderedsetkeyconfiguration.h>
+#include <bslstl_vector.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatorexception.h>
+#include <bslmf_isbitwisemoveable.h>
+#include <bslmf_nestedtraitdeclaration.h>
+#include <bsls_bsltestutil.h>
+#include <bsls_nativestd.h>
+#include <bsltf_stdstatefulallocator.h>
+
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+
+using namespace BloombergLP;
+using namespace std;
+
+//=============================================================================
+//                             TEST PLAN
+//-----------------------------------------------------------------------------
+//                             Overview
+//                             --------
+// The component under test is a B-tree that is an implementation detail of
+// 'bsl::btree_map', 'bsl::btree_set', and 'bsl::btree_multimap'.  We first
+// verify the key-counting functions of 'BTree_ImpUtil' against a brute-force
+// computation, so that the (platform-dependent) SSE2 and portable
+// implementations are both checked against the same oracle, and verify the
+// node layout computed by 'BTree_NodeUtil'.  We then drive trees of each
+// storage and search flavor (inline and out-of-line elements; contiguous,
+// strided, and binary-searched keys) with a pseudo-random sequence of
+// insertions and removals, checking the structural invariants of the tree
+// and comparing its contents with a reference array after every operation.
+// We verify that a tree built by sequential insertion is densely packed, that
+// insertion provides the strong exception-safety guarantee, and finally that
+// copy construction, assignment, and swap propagate allocators as directed by
+// 'bsl::allocator_traits'.
+//-----------------------------------------------------------------------------
+// BTree_ImpUtil
+// [ 2] int countLess(const KEY_TYPE *keys, int numKeys, const KEY_TYPE&);
+// [ 2] int countNotGreater(const KEY_TYPE *keys, int n, const KEY_TYPE&);
+// [ 2] size_t roundUpToCacheLine(size_t size);
+//
+// BTree_NodeUtil
+// [ 2] size_t nodeSize(bool isLeaf);
+//
+// BTree_NodeSearch
+// [ 2] int lowerBound(node, key, comparator);
+// [ 2] int upperBound(node, key, comparator);
+//
+// CREATORS
+// [ 1] BTree(const COMPARATOR& comparator, const ALLOCATOR& basicAllocator);
+// [ 6] BTree(const BTree& original, const ALLOCATOR& basicAllocator);
+// [ 1] ~BTree();
+//
+// MANIPULATORS
+// [ 6] BTree& operator=(const BTree& rhs);
+// [ 3] pair<Iterator, bool> insertUnique(const ValueType& value);
+// [ 3] Iterator insertMulti(const ValueType& value);
+// [ 3] Iterator insertIfMissing(const KeyType& key);
+// [ 3] Iterator remove(Iterator position);
+// [ 3] void removeAll();
+// [ 6] void swap(BTree& other);
+//
+// ACCESSORS
+// [ 6] ALLOCATOR allocator() const;
+// [ 3] Iterator begin() const;
+// [ 3] Iterator end() const;
+// [ 3] Iterator find(const KeyType& key) const;
+// [ 4] int height() const;
+// [ 3] Iterator lowerBound(const KeyType& key) const;
+// [ 3] Iterator upperBound(const KeyType& key) const;
+// [ 3] const BTree_NodeHeader *rootNode() const;
+// [ 3] SizeType size() const;
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] CONCERN: Sequential insertion yields full nodes
+// [ 5] CONCERN: Insertion provides the strong exception-safety guarantee
+//-----------------------------------------------------------------------------
+
+//=============================================================================
+//                  STANDARD BDE ASSERT TEST MACRO
+//-----------------------------------------------------------------------------
+static int testStatus = 0;
+
+static void aSsErT(bool b, const char *s, int i) {
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+//=============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef bslstl::BTree_ImpUtil                         ImpUtil;
+typedef bslstl::BTree_NodeHeader                      NodeHeader;
+typedef bslstl::UnorderedSetKeyConfiguration<int>     IntConfig;
+
+typedef bslstl::BTree<IntConfig,
+                      native_std::less<int>,
+                      bsl::allocator<int> >           Obj;
+
+namespace {
+
+class Tracked {
+    // This class holds an 'int' and counts the number of live objects.  It is
+    // not bitwise-moveable, so a 'BTree' holds its elements out-of-line.
+
+    // DATA
+    int d_value;
+
+  public:
+    // CLASS DATA
+    static int s_numLive;
+
+    // CREATORS
+    Tracked(int value) : d_value(value) { ++s_numLive; }            // IMPLICIT
+        // Create an object having the specified 'value'.
+
+    Tracked(const Tracked& original) : d_value(original.d_value)
+        // Create an object having the value of the specified 'original'.
+    {
+        ++s_numLive;
+    }
+
+    ~Tracked() { --s_numLive; }
+        // Destroy this object.
+
+    // ACCESSORS
+    operator int() const { return d_value; }
+        // Return the value of this object.
+};
+
+int Tracked::s_numLive = 0;
+
+struct Big {
+    // This 'struct' provides a bitwise-moveable type too large for more than
+    // a few elements to fit in a node of the target size.
+
+    // DATA
+    char d_data[300];
+
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(Big, bslmf::IsBitwiseMoveable);
+};
+
+class Random {
+    // This class provides a deterministic linear congruential generator.
+
+    // DATA
+    unsigned int d_state;
+
+  public:
+    // CREATORS
+    explicit Random(unsigned int seed) : d_state(seed) {}
+        // Create a generator having the specified 'seed'.
+
+    // MANIPULATORS
+    int operator()(int range)
+        // Return a pseudo-random integer in the range '[0, range)'.
+    {
+        d_state = d_state * 1103515245u + 12345u;
+        return static_cast<int>((d_state >> 8) % range);
+    }
+};
+
+int keyOf(int value)
+    // Return the specified 'value'.
+{
+    return value;
+}
+
+int keyOf(const bsl::pair<const int, int>& value)
+    // Return the key of the specified 'value'.
+{
+    return value.first;
+}
+
+template <class VALUE_TYPE>
+struct MakeValue {
+    // This 'struct' provides a function creating an element having a given
+    // key.
+
+    static VALUE_TYPE make(int key)
+        // Return an element having the specified 'key'.
+    {
+        return VALUE_TYPE(key);
+    }
+};
+
+template <>
+struct MakeValue<bsl::pair<const int, int> > {
+    // This specialization creates a key-value pair whose value is the
+    // negation of its key.
+
+    static bsl::pair<const int, int> make(int key)
+        // Return a pair having the specified 'key'.
+    {
+        return bsl::pair<const int, int>(key, -key);
+    }
+};
+
+template <class TREE>
+int collectNode(bsl::vector<int>  *keys,
+                const NodeHeader  *node,
+                const NodeHeader  *parent,
+                int                position,
+                int                depth,
+                int               *leafDepth)
+    // Append to the specified 'keys' the keys of the subtree of a 'TREE'
+    // rooted at the specified 'node', in order, and return the number of
+    // nodes in the subtree.  Verify that 'node' has the specified 'parent'
+    // and 'position', is at the same 'depth' as every other leaf (recorded in
+    // the specified 'leafDepth') if it is a leaf, and holds an allowed number
+    // of elements.
+{
+    typedef typename TREE::NodeUtil NodeUtil;
+
+    ASSERTV(depth, node->d_parent_p == parent);
+    ASSERTV(depth, position, node->d_position, position == node->d_position);
+    ASSERTV(depth, node->d_count, node->d_count <= NodeUtil::k_MAX_VALUES);
+    ASSERTV(depth, !parent || 0 < node->d_count);
+
+    int numNodes = 1;
+    for (int i = 0; i <= node->d_count; ++i) {
+        if (!node->d_isLeaf) {
+            numNodes += collectNode<TREE>(keys,
+                                          NodeUtil::children(node)[i],
+                                          node,
+                                          i,
+                                          depth + 1,
+                                          leafDepth);
+        }
+        if (i < node->d_count) {
+            keys->push_back(keyOf(NodeUtil::value(node, i)));
+        }
+    }
+    if (node->d_isLeaf) {
+        if (*leafDepth < 0) {
+            *leafDepth = depth;
+        }
+        ASSERTV(depth, *leafDepth, depth == *leafDepth);
+    }
+    return numNodes;
+}
+
+template <class TREE>
+int verifyTree(bsl::vector<int> *keys, const TREE& tree)
+    // Verify the structural invariants of the specified 'tree', load into the
+    // specified 'keys' the keys of its elements in order, verify that
+    // iterating over 'tree' in either direction visits the same keys, and
+    // return the number of nodes of 'tree'.
+{
+    typedef typename TREE::Iterator Iterator;
+
+    keys->clear();
+
+    const NodeHeader *root = tree.rootNode();
+    if (!root) {
+        ASSERT(0 == tree.size());
+        ASSERT(0 == tree.height());
+        ASSERT(tree.begin() == tree.end());
+        return 0;                                                     // RETURN
+    }
+    ASSERT(0 < root->d_count);
+
+    int leafDepth = -1;
+    const int numNodes = collectNode<TREE>(keys, root, 0, 0, 0, &leafDepth);
+
+    ASSERTV(tree.size(), keys->size(), tree.size() == keys->size());
+    ASSERTV(leafDepth, tree.height(), leafDepth + 1 == tree.height());
+
+    for (native_std::size_t i = 1; i < keys->size(); ++i) {
+        ASSERTV(i, !tree.comparator()((*keys)[i], (*keys)[i - 1]));
+    }
+
+    native_std::size_t i = 0;
+    for (Iterator it = tree.begin(); it != tree.end(); ++it, ++i) {
+        ASSERTV(i, i < keys->size() && keyOf(*it) == (*keys)[i]);
+    }
+    ASSERTV(i, keys->size(), i == keys->size());
+
+    Iterator it = tree.end();
+    for (i = keys->size(); 0 < i; --i) {
+        --it;
+        ASSERTV(i, keyOf(*it) == (*keys)[i - 1]);
+    }
+    ASSERT(tree.begin() == it);
+
+    return numNodes;
+}
+
+template <class TREE>
+void testRandom(unsigned int seed,
+                int          range,
+                int          numOperations,
+                bool         isMulti,
+                bool         veryVerbose)
+    // Apply the specified 'numOperations' pseudo-random insertions (using
+    // 'insertMulti' if the specified 'isMulti' is 'true', and 'insertUnique'
+    // otherwise) and removals of keys in the range '[0, range)', generated
+    // from the specified 'seed', to a 'TREE', and verify the contents and
+    // invariants of the tree after each operation.  Optionally specify
+    // 'veryVerbose' to print the height of the tree at the end.
+{
+    typedef typename TREE::ValueType ValueType;
+    typedef typename TREE::Iterator  Iterator;
+
+    bslma::TestAllocator oa("object", false);
+
+    Random           random(seed);
+    bsl::vector<int> counts(range, 0);
+    bsl::vector<int> keys;
+    int              size = 0;
+    {
+        const typename TREE::ComparatorType COMPARATOR;
+        const typename TREE::AllocatorType  ALLOCATOR(&oa);
+
+        TREE mX(COMPARATOR, ALLOCATOR);  const TREE& X = mX;
+
+        for (int op = 0; op < numOperations; ++op) {
+            // Grow the tree over the first half of the operations, and shrink
+            // it over the second half.
+
+            const int  key      = random(range);
+            const int  percent  = op < numOperations / 2 ? 70 : 30;
+            const bool isInsert = random(100) < percent;
+            if (isInsert) {
+                if (isMulti) {
+                    Iterator it = mX.insertMulti(
+                                           MakeValue<ValueType>::make(key));
+                    ASSERTV(op, key == keyOf(*it));
+                    ++it;
+                    ASSERTV(op, it == X.upperBound(key));
+                    ++counts[key];
+                    ++size;
+                }
+                else {
+                    bsl::pair<Iterator, bool> result =
+                           mX.insertUnique(MakeValue<ValueType>::make(key));
+                    ASSERTV(op, key == keyOf(*result.first));
+                    ASSERTV(op, result.second == (0 == counts[key]));
+                    if (result.second) {
+                        ++counts[key];
+                        ++size;
+                    }
+                }
+            }
+            else {
+                // Remove either the element returned by 'find' (which may be
+                // any of several equivalent elements) or the first one, and
+                // verify that the returned iterator refers to the element
+                // that followed the removed element.
+
+                Iterator it = op % 2 ? X.find(key) : X.lowerBound(key);
+                ASSERTV(op, (X.find(key) == X.end()) == (0 == counts[key]));
+                if (0 < counts[key]) {
+                    ASSERTV(op, it != X.end() && key == keyOf(*it));
+
+                    int index = 0;
+                    for (Iterator jt = X.begin(); jt != it; ++jt) {
+                        ++index;
+                    }
+
+                    Iterator next = mX.remove(it);
+                    --counts[key];
+                    --size;
+
+                    int nextIndex = 0;
+                    for (Iterator jt = X.begin(); jt != next; ++jt) {
+                        ++nextIndex;
+                    }
+                    ASSERTV(op, index, nextIndex, index == nextIndex);
+                    if (0 == counts[key]) {
+                        ASSERTV(op, next == X.upperBound(key));
+                    }
+                }
+            }
+
+            verifyTree(&keys, X);
+            ASSERTV(op, size == static_cast<int>(X.size()));
+
+            // Verify the searches against the reference for a few keys.
+
+            for (int j = 0; j < 3; ++j) {
+                const int probe = random(range + 2) - 1;
+                int       less  = 0;
+                int       equal = 0;
+                for (native_std::size_t k = 0; k < keys.size(); ++k) {
+                    less  += X.comparator()(keys[k], probe);
+                    equal += !X.comparator()(keys[k], probe)
+                          && !X.comparator()(probe, keys[k]);
+                }
+                const int C = 0 <= probe && probe < range ? counts[probe] : 0;
+                ASSERTV(op, probe, C == equal);
+
+                Iterator lower = X.lowerBound(probe);
+                Iterator upper = X.upperBound(probe);
+                int      n     = 0;
+                for (Iterator it = X.begin(); it != lower; ++it) {
+                    ++n;
+                }
+                ASSERTV(op, probe, less == n);
+                for (Iterator it = lower; it != upper; ++it) {
+                    ASSERTV(op, probe, probe == keyOf(*it));
+                    --n;
+                }
+                ASSERTV(op, probe, less - equal == n);
+                ASSERTV(op, probe,
+                        (0 == C) == (X.find(probe) == X.end()));
+            }
+        }
+
+        if (veryVerbose) {
+            P_(X.size()) P(X.height())
+        }
+
+        mX.removeAll();
+        ASSERT(0 == X.size());
+        ASSERT(0 == X.rootNode());
+        ASSERT(0 == oa.numBlocksInUse());
+
+        for (int i = 0; i < 100; ++i) {
+            mX.insertMulti(MakeValue<ValueType>::make(i));
+        }
+    }
+    ASSERT(0 == oa.numBlocksInUse());
+}
+
+template <class ALLOCATOR>
+void testAllocatorPropagation()
+    // Verify that copy construction, copy assignment, and swap of a 'BTree'
+    // using the (template parameter) 'ALLOCATOR' type propagate the allocator
+    // as directed by 'bsl::allocator_traits'.
+{
+    typedef bsl::allocator_traits<ALLOCATOR>             Traits;
+    typedef typename Traits::propagate_on_container_copy_assignment Pocca;
+    typedef typename Traits::propagate_on_container_swap            Pocs;
+
+    const bool propagateOnCopyAssignment = Pocca::value;
+    const bool propagateOnSwap           = Pocs::value;
+
+    typedef bslstl::BTree<IntConfig, native_std::less<int>, ALLOCATOR> Tree;
+    typedef typename Tree::Iterator                                   Iter;
+
+    bslma::TestAllocator sa("source", false);
+    bslma::TestAllocator ta("target", false);
+
+    const ALLOCATOR SA(&sa);
+    const ALLOCATOR TA(&ta);
+
+    bsl::vector<int> keysX;
+    bsl::vector<int> keysY;
+    {
+        Tree mX(native_std::less<int>(), SA);  const Tree& X = mX;
+        for (int i = 0; i < 1000; ++i) {
+            mX.insertUnique((i * 7919) % 1000);
+        }
+
+        Tree mY(X, TA);  const Tree& Y = mY;
+        verifyTree(&keysX, X);
+        verifyTree(&keysY, Y);
+        ASSERT(keysX == keysY);
+        ASSERT(TA == Y.allocator());
+        ASSERT(0  <  ta.numBlocksInUse());
+
+        Tree mZ(native_std::less<int>(), TA);  const Tree& Z = mZ;
+        mZ.insertUnique(-1);
+        mZ = X;
+        verifyTree(&keysY, Z);
+        ASSERT(keysX == keysY);
+        if (propagateOnCopyAssignment) {
+            ASSERT(SA == Z.allocator());
+        }
+        else {
+            ASSERT(TA == Z.allocator());
+        }
+
+        Tree mW(native_std::less<int>(), propagateOnSwap ? TA : SA);
+        const Tree& W = mW;
+        mW.insertUnique(-1);
+        mW.swap(mX);
+        ASSERT(SA   == W.allocator());
+        ASSERT(1000 == W.size());
+        ASSERT(1    == X.size());
+        ASSERT(-1   == *X.begin());
+        if (propagateOnSwap) {
+            ASSERT(TA == X.allocator());
+        }
+        else {
+            ASSERT(SA == X.allocator());
+        }
+        Iter it = W.find(999);
+        ASSERT(W.end() != it);
+        ASSERT(W.end() == ++it);
+    }
+    ASSERT(0 == sa.numBlocksInUse());
+    ASSERT(0 == ta.numBlocksInUse());
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+    bool verbose = argc > 2;
+    bool veryVerbose = argc > 3;
+    bool veryVeryVerbose = argc > 4;
+
+    (void)veryVerbose;
+    (void)veryVeryVerbose;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVerbose);
+    bslma::DefaultAllocatorGuard defaultAllocatorGuard(&defaultAllocator);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 6: {
+        // --------------------------------------------------------------------
+        // COPY, ASSIGNMENT, AND SWAP
+        //
+        // Concerns:
+        //: 1 A copy has the same value as the original, and uses the supplied
+        //:   allocator.
+        //:
+        //: 2 Copy assignment propagates the allocator of the source if and
+        //:   only if the allocator has the
+        //:   'propagate_on_container_copy_assignment' trait.
+        //:
+        //: 3 Swap exchanges allocators if and only if the allocator has the
+        //:   'propagate_on_container_swap' trait.
+        //:
+        //: 4 No memory is leaked.
+        //
+        // Plan:
+        //: 1 Using 'bsl::allocator' and 'bsltf::StdStatefulAllocator'
+        //:   instantiated with each combination of the propagation traits,
+        //:   copy, assign, and swap trees, and verify the value and
+        //:   allocator of each result against the traits reported by
+        //:   'bsl::allocator_traits'.  (C-1..4)
+        //
+        // Testing:
+        //   BTree(const BTree& original, const ALLOCATOR& basicAllocator);
+        //   BTree& operator=(const BTree& rhs);
+        //   void swap(BTree& other);
+        //   ALLOCATOR allocator() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCOPY, ASSIGNMENT, AND SWAP"
+                            "\n==========================\n");
+
+        testAllocatorPropagation<
+                      bsltf::StdStatefulAllocator<int, true, true,  true > >();
+        testAllocatorPropagation<
+                      bsltf::StdStatefulAllocator<int, true, false, true > >();
+        testAllocatorPropagation<
+                      bsltf::StdStatefulAllocator<int, true, true,  false> >();
+        testAllocatorPropagation<
+                      bsltf::StdStatefulAllocator<int, true, false, false> >();
+        testAllocatorPropagation<bsl::allocator<int> >();
+
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // CONCERN: Insertion provides the strong exception-safety guarantee
+        //
+        // Concerns:
+        //: 1 If allocating a node (or an out-of-line element) throws during
+        //:   an insertion, the tree is unchanged.
+        //:
+        //: 2 No memory is leaked, and no element is leaked or destroyed
+        //:   twice.
+        //
+        // Plan:
+        //: 1 Build trees, holding inline and out-of-line elements, whose
+        //:   right spines are full, so that appending an element splits a
+        //:   node at every level and creates a new root.  Insert elements at
+        //:   the end, the beginning, and the middle of each tree within the
+        //:   'bslma' exception-test loop, verifying at the start of each
+        //:   iteration that the tree is unchanged by the previous (failed)
+        //:   attempt.  (C-1..2)
+        //
+        // Testing:
+        //   CONCERN: Insertion provides the strong exception-safety guarantee
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCONCERN: STRONG EXCEPTION SAFETY"
+                            "\n================================\n");
+
+        typedef bslstl::UnorderedSetKeyConfiguration<Tracked> TrackedConfig;
+        typedef bslstl::BTree<TrackedConfig,
+                              native_std::less<int>,
+                              bsl::allocator<Tracked> >       TrackedObj;
+
+        bslma::TestAllocator oa("object", veryVeryVerbose);
+
+        const int KEYS[] = { 1000000, -1, 12345 };
+        const int NUM_KEYS = sizeof KEYS / sizeof *KEYS;
+
+        if (verbose) printf("\tInline elements.\n");
+        for (int ti = 0; ti < NUM_KEYS; ++ti) {
+            const int KEY = KEYS[ti];
+
+            Obj mX(native_std::less<int>(), &oa);  const Obj& X = mX;
+            const int N = Obj::NodeUtil::k_MAX_VALUES
+                        * (Obj::NodeUtil::k_MAX_VALUES + 1);
+            for (int i = 0; i < N; ++i) {
+                mX.insertUnique(i * 2);
+            }
+            bsl::vector<int> expected;
+            bsl::vector<int> keys;
+            verifyTree(&expected, X);
+            const int HEIGHT = X.height();
+
+            BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                verifyTree(&keys, X);
+                ASSERTV(KEY, expected == keys);
+                ASSERTV(KEY, HEIGHT == X.height());
+
+                mX.insertUnique(KEY);
+            } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+            verifyTree(&keys, X);
+            ASSERTV(KEY, expected.size() + 1 == keys.size());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+
+        if (verbose) printf("\tOut-of-line elements.\n");
+        for (int ti = 0; ti < NUM_KEYS; ++ti) {
+            const int KEY = KEYS[ti];
+            {
+                TrackedObj mX(native_std::less<int>(), &oa);
+                const TrackedObj& X = mX;
+
+                const int N = TrackedObj::NodeUtil::k_MAX_VALUES
+                            * (TrackedObj::NodeUtil::k_MAX_VALUES + 1);
+                for (int i = 0; i < N; ++i) {
+                    mX.insertMulti(Tracked(i * 2));
+                }
+                bsl::vector<int> expected;
+                bsl::vector<int> keys;
+                verifyTree(&expected, X);
+
+                BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                    verifyTree(&keys, X);
+                    ASSERTV(KEY, expected == keys);
+                    ASSERTV(KEY, N == Tracked::s_numLive);
+
+                    mX.insertMulti(Tracked(KEY));
+                } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+                ASSERTV(KEY, N + 1 == Tracked::s_numLive);
+            }
+            ASSERTV(KEY, Tracked::s_numLive, 0 == Tracked::s_numLive);
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // CONCERN: Sequential insertion yields full nodes
+        //
+        // Concerns:
+        //: 1 Inserting keys in increasing (or decreasing) order produces a
+        //:   tree whose nodes, other than those on its right (respectively,
+        //:   left) spine, are full.
+        //:
+        //: 2 The height of such a tree is the minimum possible.
+        //:
+        //: 3 A copy of a tree built in random order is densely packed.
+        //
+        // Plan:
+        //: 1 Insert 'N' keys in increasing order, and in decreasing order,
+        //:   and verify that the number of nodes is close to the minimum
+        //:   needed to hold 'N' elements, by counting the nodes reachable
+        //:   from the root and the blocks allocated.  (C-1..2)
+        //:
+        //: 2 Copy a tree built in random order, and verify that the copy has
+        //:   no more nodes than the tree built in increasing order.  (C-3)
+        //
+        // Testing:
+        //   CONCERN: Sequential insertion yields full nodes
+        //   int height() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCONCERN: SEQUENTIAL INSERTION"
+                            "\n=============================\n");
+
+        const int MAX = Obj::NodeUtil::k_MAX_VALUES;
+        const int N   = 100000;
+
+        // A tree of 'N' elements needs at least 'N / MAX' leaves, and (for
+        // nodes at each level being full) few more nodes than that.
+
+        const int MIN_NODES = (N + MAX - 1) / MAX;
+
+        bslma::TestAllocator oa("object", veryVeryVerbose);
+
+        bsl::vector<int> keys;
+        int              ascendingNodes;
+        {
+            Obj mX(native_std::less<int>(), &oa);  const Obj& X = mX;
+            for (int i = 0; i < N; ++i) {
+                mX.insertUnique(i);
+            }
+            ascendingNodes = verifyTree(&keys, X);
+            if (veryVerbose) {
+                P_(MAX) P_(MIN_NODES) P_(ascendingNodes) P(X.height())
+            }
+            ASSERTV(ascendingNodes, MIN_NODES,
+                    ascendingNodes <= MIN_NODES + MIN_NODES / MAX + 4);
+            ASSERTV(ascendingNodes, oa.numBlocksInUse(),
+                    ascendingNodes == oa.numBlocksInUse());
+
+            int minHeight = 1;
+            for (long long capacity = MAX;
+                 capacity < N;
+                 capacity = capacity * (MAX + 1) + MAX) {
+                ++minHeight;
+            }
+            ASSERTV(minHeight, X.height(), minHeight == X.height());
+        }
+        {
+            Obj mX(native_std::less<int>(), &oa);  const Obj& X = mX;
+            for (int i = N; 0 < i; --i) {
+                mX.insertUnique(i);
+            }
+            const int NUM_NODES = verifyTree(&keys, X);
+            ASSERTV(NUM_NODES, ascendingNodes, NUM_NODES <= ascendingNodes);
+        }
+        {
+            Obj mX(native_std::less<int>(), &oa);  const Obj& X = mX;
+            Random random(7);
+            while (X.size() < static_cast<Obj::SizeType>(N)) {
+                mX.insertUnique(random(4 * N));
+            }
+            const int NUM_RANDOM = verifyTree(&keys, X);
+
+            Obj mY(X, &oa);  const Obj& Y = mY;
+            const int NUM_COPY = verifyTree(&keys, Y);
+            if (veryVerbose) {
+                P_(NUM_RANDOM) P(NUM_COPY)
+            }
+            ASSERTV(NUM_COPY, ascendingNodes, NUM_COPY <= ascendingNodes);
+            ASSERTV(NUM_COPY, NUM_RANDOM, NUM_COPY < NUM_RANDOM);
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // INSERTION, REMOVAL, AND SEARCH
+        //
+        // Concerns:
+        //: 1 After every insertion and removal, every leaf is at the same
+        //:   depth, every non-root node holds between 1 and 'k_MAX_VALUES'
+        //:   elements, the parent link and position of every node are
+        //:   correct, and the elements are in key order.
+        //:
+        //: 2 The tree holds the expected elements, and 'find', 'lowerBound',
+        //:   and 'upperBound' agree with a brute-force search.
+        //:
+        //: 3 'remove' returns an iterator to the element following the one
+        //:   removed, including when the removed element is in an internal
+        //:   node, and when nodes are merged or rebalanced.
+        //:
+        //: 4 Iteration in either direction visits every element in order.
+        //:
+        //: 5 Concerns 1..4 hold for elements stored inline and out-of-line,
+        //:   for unique and non-unique keys, and for each in-node search
+        //:   method.
+        //:
+        //: 6 'insertIfMissing' inserts a default mapped value only if the key
+        //:   is absent.
+        //:
+        //: 7 No memory is leaked, and every element is destroyed.
+        //
+        // Plan:
+        //: 1 For trees of 'int' (contiguous keys), of 'pair<const int, int>'
+        //:   (strided keys), of 'int' ordered by 'greater' (binary search),
+        //:   and of a non-bitwise-moveable type (out-of-line elements),
+        //:   apply a long pseudo-random sequence of insertions and removals,
+        //:   using a small key range for both unique and non-unique
+        //:   insertion, and after each operation verify the invariants,
+        //:   contents, iteration, and searches of the tree.  (C-1..5, 7)
+        //:
+        //: 2 Use 'insertIfMissing' on a map-configured tree.  (C-6)
+        //
+        // Testing:
+        //   pair<Iterator, bool> insertUnique(const ValueType& value);
+        //   Iterator insertMulti(const ValueType& value);
+        //   Iterator insertIfMissing(const KeyType& key);
+        //   Iterator remove(Iterator position);
+        //   void removeAll();
+        //   Iterator begin() const;
+        //   Iterator end() const;
+        //   Iterator find(const KeyType& key) const;
+        //   Iterator lowerBound(const KeyType& key) const;
+        //   Iterator upperBound(const KeyType& key) const;
+        //   const BTree_NodeHeader *rootNode() const;
+        //   SizeType size() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nINSERTION, REMOVAL, AND SEARCH"
+                            "\n==============================\n");
+
+        typedef bsl::pair<const int, int>                      Pair;
+        typedef bslstl::UnorderedMapKeyConfiguration<Pair>     PairConfig;
+        typedef bslstl::UnorderedSetKeyConfiguration<Tracked>  TrackedConfig;
+
+        typedef bslstl::BTree<PairConfig,
+                              native_std::less<int>,
+                              bsl::allocator<Pair> >       PairObj;
+        typedef bslstl::BTree<IntConfig,
+                              native_std::greater<int>,
+                              bsl::allocator<int> >        GreaterObj;
+        typedef bslstl::BTree<TrackedConfig,
+                              native_std::less<int>,
+                              bsl::allocator<Tracked> >    TrackedObj;
+
+        ASSERT(2 == (bslstl::BTree_NodeSearch<IntConfig,
+                                           native_std::less<int> >::k_METHOD));
+        ASSERT(1 == (bslstl::BTree_NodeSearch<PairConfig,
+                                           native_std::less<int> >::k_METHOD));
+        ASSERT(0 == (bslstl::BTree_NodeSearch<IntConfig,
+                                        native_std::greater<int> >::k_METHOD));
+        ASSERT(0 == (bslstl::BTree_NodeSearch<TrackedConfig,
+                                           native_std::less<int> >::k_METHOD));
+
+        const struct {
+            int          d_line;
+            unsigned int d_seed;
+            int          d_range;
+            int          d_numOperations;
+        } DATA[] = {
+            //LINE  SEED  RANGE  NUM_OPS
+            //----  ----  -----  -------
+            { L_,      1,     4,     200 },
+            { L_,      2,    50,    2000 },
+            { L_,      3,   400,    4000 },
+            { L_,      4,  1500,    6000 },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const unsigned int SEED    = DATA[ti].d_seed;
+            const int          RANGE   = DATA[ti].d_range;
+            const int          NUM_OPS = DATA[ti].d_numOperations;
+
+            if (veryVerbose) {
+                T_ P_(DATA[ti].d_line) P_(RANGE) P(NUM_OPS)
+            }
+
+            for (int isMulti = 0; isMulti < 2; ++isMulti) {
+                testRandom<Obj>(SEED, RANGE, NUM_OPS, isMulti, veryVerbose);
+                testRandom<PairObj>(SEED, RANGE, NUM_OPS, isMulti,
+                                    veryVerbose);
+                testRandom<GreaterObj>(SEED, RANGE, NUM_OPS, isMulti,
+                                       veryVerbose);
+                testRandom<TrackedObj>(SEED, RANGE, NUM_OPS, isMulti,
+                                       veryVerbose);
+                ASSERTV(Tracked::s_numLive, 0 == Tracked::s_numLive);
+            }
+        }
+
+        if (verbose) printf("\nTesting 'insertIfMissing'.\n");
+        {
+            bslma::TestAllocator oa("object", veryVeryVerbose);
+
+            PairObj mX(native_std::less<int>(), &oa);  const PairObj& X = mX;
+            for (int i = 0; i < 1000; ++i) {
+                mX.insertUnique(Pair(i * 2, i));
+            }
+            for (int i = 0; i < 2000; ++i) {
+                PairObj::Iterator it = mX.insertIfMissing(i);
+                ASSERTV(i, i == it->first);
+                ASSERTV(i, it->second, (i % 2 ? 0 : i / 2) == it->second);
+            }
+            ASSERT(2000 == X.size());
+
+            bsl::vector<int> keys;
+            verifyTree(&keys, X);
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // IN-NODE SEARCH AND NODE LAYOUT
+        //
+        // Concerns:
+        //: 1 'countLess' and 'countNotGreater' return the number of keys in a
+        //:   sorted array that are less than (respectively, not greater than)
+        //:   the given key, for every array length and key position, for the
+        //:   SSE2 ('int' and 'double') and generic implementations.
+        //:
+        //: 2 'roundUpToCacheLine' rounds up to a multiple of 64.
+        //:
+        //: 3 The memory allocated for every node is a multiple of 64 bytes,
+        //:   a leaf node holding small elements occupies about
+        //:   'k_TARGET_NODE_SIZE' bytes, and every node holds at least 3
+        //:   elements.
+        //:
+        //: 4 'BTree_NodeSearch' selects the expected method for each key
+        //:   type and comparator.
+        //
+        // Plan:
+        //: 1 For arrays of every length up to 70 holding sorted keys with
+        //:   runs of duplicates, compare the counting functions with a
+        //:   brute-force computation for every key in and around the array.
+        //:   (C-1)
+        //:
+        //: 2 Verify 'roundUpToCacheLine' and the node sizes for several
+        //:   element types directly.  (C-2..3)
+        //:
+        //: 3 Verify the compile-time method of 'BTree_NodeSearch' for
+        //:   several configurations.  (C-4)
+        //
+        // Testing:
+        //   int countLess(const KEY_TYPE *keys, int numKeys, const KEY_TYPE&);
+        //   int countNotGreater(const KEY_TYPE *keys, int n, const KEY_TYPE&);
+        //   size_t roundUpToCacheLine(size_t size);
+        //   size_t nodeSize(bool isLeaf);
+        //   int lowerBound(node, key, comparator);
+        //   int upperBound(node, key, comparator);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nIN-NODE SEARCH AND NODE LAYOUT"
+                            "\n==============================\n");
+
+        if (verbose) printf("\nTesting counting functions.\n");
+        {
+            enum { k_MAX_LENGTH = 70 };
+
+            int          intKeys[k_MAX_LENGTH];
+            double       doubleKeys[k_MAX_LENGTH];
+            unsigned int unsignedKeys[k_MAX_LENGTH];
+
+            Random random(5);
+            for (int length = 0; length <= k_MAX_LENGTH; ++length) {
+                for (int trial = 0; trial < 4; ++trial) {
+                    int value = -3 * length;
+                    for (int i = 0; i < length; ++i) {
+                        value += random(3);  // runs of duplicates
+                        intKeys[i]      = value;
+                        doubleKeys[i]   = value * 0.5;
+                        unsignedKeys[i] = value + 1000;
+                    }
+
+                    for (int key = -3 * length - 2; key <= value + 2; ++key) {
+                        int less    = 0;
+                        int notMore = 0;
+                        for (int i = 0; i < length; ++i) {
+                            less    += intKeys[i] <  key;
+                            notMore += intKeys[i] <= key;
+                        }
+                        ASSERTV(length, key, less ==
+                                   ImpUtil::countLess(intKeys, length, key));
+                        ASSERTV(length, key, notMore ==
+                             ImpUtil::countNotGreater(intKeys, length, key));
+                        ASSERTV(length, key, less ==
+                                  ImpUtil::countLess(doubleKeys,
+                                                     length,
+                                                     key * 0.5));
+                        ASSERTV(length, key, notMore ==
+                                  ImpUtil::countNotGreater(doubleKeys,
+                                                           length,
+                                                           key * 0.5));
+
+                        const unsigned int UKEY = key + 1000;
+                        ASSERTV(length, key, less ==
+                                  ImpUtil::countLess(unsignedKeys,
+                                                     length,
+                                                     UKEY));
+                        ASSERTV(length, key, notMore ==
+                                  ImpUtil::countNotGreater(unsignedKeys,
+                                                           length,
+                                                           UKEY));
+                    }
+                }
+            }
+        }
+
+        if (verbose) printf("\nTesting node layout.\n");
+        {
+            ASSERT(  0 == ImpUtil::roundUpToCacheLine(0));
+            ASSERT( 64 == ImpUtil::roundUpToCacheLine(1));
+            ASSERT( 64 == ImpUtil::roundUpToCacheLine(64));
+            ASSERT(128 == ImpUtil::roundUpToCacheLine(65));
+
+            typedef bslstl::BTree_NodeUtil<int>                      IntUtil;
+            typedef bslstl::BTree_NodeUtil<bsl::pair<const int, int> >
+                                                                     PairUtil;
+            typedef bslstl::BTree_NodeUtil<Tracked>                  TUtil;
+
+            typedef bslstl::BTree_NodeUtil<Big>                      BigUtil;
+
+            ASSERT(IntUtil::k_IS_INLINE);
+            ASSERT(PairUtil::k_IS_INLINE);
+            ASSERT(!TUtil::k_IS_INLINE);
+            ASSERT(sizeof(Tracked *) == sizeof(TUtil::SlotType));
+
+            const native_std::size_t SIZES[] = {
+                IntUtil::nodeSize(true),  IntUtil::nodeSize(false),
+                PairUtil::nodeSize(true), PairUtil::nodeSize(false),
+                TUtil::nodeSize(true),    TUtil::nodeSize(false),
+                BigUtil::nodeSize(true),  BigUtil::nodeSize(false)
+            };
+            const int NUM_SIZES = sizeof SIZES / sizeof *SIZES;
+            for (int i = 0; i < NUM_SIZES; ++i) {
+                ASSERTV(i, SIZES[i], 0 == SIZES[i] % 64);
+            }
+
+            ASSERTV(IntUtil::nodeSize(true),
+                    ImpUtil::k_TARGET_NODE_SIZE == IntUtil::nodeSize(true));
+            const native_std::size_t AVAILABLE =
+                          ImpUtil::k_TARGET_NODE_SIZE - sizeof(NodeHeader);
+            const int EXP_MAX_VALUES =
+                                  static_cast<int>(AVAILABLE / sizeof(int));
+            ASSERTV(IntUtil::k_MAX_VALUES,
+                    EXP_MAX_VALUES == IntUtil::k_MAX_VALUES);
+            ASSERT(IntUtil::k_MAX_VALUES / 2 == IntUtil::k_MIN_VALUES);
+            ASSERT(BigUtil::k_IS_INLINE);
+            ASSERT(3 == BigUtil::k_MAX_VALUES);
+            ASSERT(1 == BigUtil::k_MIN_VALUES);
+
+            typedef bslstl::UnorderedSetKeyConfiguration<double> DConfig;
+
+            typedef bslstl::BTree_NodeSearch<DConfig,
+                                             native_std::less<double> >
+                                                                 DoubleSearch;
+            typedef bslstl::BTree_NodeSearch<IntConfig,
+                                             native_std::less<int> >
+                                                                 IntSearch;
+            ASSERT(2 == DoubleSearch::k_METHOD);
+            ASSERT(2 == IntSearch::k_METHOD);
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create a tree, insert, find, and remove values, and verify the
+        //:   results.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        bslma::TestAllocator oa("object", veryVeryVerbose);
+        {
+            Obj mX(native_std::less<int>(), &oa);  const Obj& X = mX;
+            ASSERT(0 == X.size());
+            ASSERT(0 == X.height());
+            ASSERT(0 == oa.numBlocksTotal());
+            ASSERT(X.begin() == X.end());
+            ASSERT(X.end()   == X.find(1));
+
+            bsl::pair<Obj::Iterator, bool> result = mX.insertUnique(1);
+            ASSERT(result.second);
+            ASSERT(1 == *result.first);
+            ASSERT(1 == X.size());
+            ASSERT(1 == X.height());
+            ASSERT(X.begin() == result.first);
+            ASSERT(X.find(1) == result.first);
+
+            result = mX.insertUnique(1);
+            ASSERT(!result.second);
+            ASSERT(1 == X.size());
+
+            for (int i = 1000; 1 < i; --i) {
+                ASSERT(mX.insertUnique(i).second);
+            }
+            ASSERT(1000 == X.size());
+            ASSERT(2    <= X.height());
+
+            int expected = 1;
+            for (Obj::Iterator it = X.begin(); it != X.end(); ++it) {
+                ASSERTV(expected, *it, expected == *it);
+                ++expected;
+            }
+
+            Obj::Iterator it = mX.remove(X.find(500));
+            ASSERT(501 == *it);
+            ASSERT(999 == X.size());
+            ASSERT(X.end() == X.find(500));
+            ASSERT(501 == *X.lowerBound(500));
+            ASSERT(502 == *X.upperBound(501));
+
+            while (X.begin() != X.end()) {
+                mX.remove(X.begin());
+            }
+            ASSERT(0 == X.size());
+            ASSERT(0 == oa.numBlocksInUse());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
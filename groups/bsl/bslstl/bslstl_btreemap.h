@@ -0,0 +1,1335 @@
+// bslstl_btreemap.h                                                  -*-C++-*-
+#ifndef INCLUDED_BSLSTL_BTREEMAP
+#define INCLUDED_BSLSTL_BTREEMAP
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an ordered map of unique keys stored in a B-tree.
+//
+//@CLASSES:
+//   bsl::btree_map: ordered map of unique keys, with cache-friendly nodes
+//
+//@SEE_ALSO: bslstl_btree, bslstl_btreeset, bslstl_btreemultimap, bslstl_map
+//
+//@DESCRIPTION: This component defines a single class template, 'btree_map',
+// implementing an ordered container holding a collection of unique keys,
+// each mapped to an associated value, having an interface closely modeled on
+// the standard 'map' [map].
+//
+// A 'bsl::map' is a red-black tree that allocates a separate node for every
+// key-value pair, so that a lookup follows one dependent pointer (and,
+// typically, incurs one cache miss) per level of a tree whose height is about
+// twice the logarithm (base 2) of its size.  A 'btree_map' instead stores its
+// key-value pairs, in order, in the nodes of a B-tree (see 'bslstl_btree')
+// that each occupy a few cache lines and hold many elements, so that a lookup
+// visits several times fewer nodes.  Moreover, for arithmetic keys compared
+// by 'std::less', each node is searched with a branch-free (and, where
+// available, SIMD) scan of its keys.  The price of this layout is weaker
+// stability guarantees:
+//
+//: o Any insertion (including by 'operator[]') and any erasure may invalidate
+//:   all iterators to the elements of the map.
+//:
+//: o If 'bsl::pair<const KEY, VALUE>' is bitwise-moveable (see
+//:   'bslmf_isbitwisemoveable'), any insertion or erasure also invalidates
+//:   all pointers and references to the elements of the map; otherwise, each
+//:   element is allocated separately, and pointers and references to an
+//:   element remain valid until that element is erased.
+//
+// Inserting a key-value pair whose key is ordered after every key in the map
+// appends it to the last node of the tree without a search.  Consequently,
+// constructing (or inserting into) a 'btree_map' from a range sorted by key
+// takes linear time, and yields a densely packed tree.
+//
+// An instantiation of 'btree_map' is an allocator-aware, value-semantic type
+// whose salient attributes are its size (number of keys) and the sorted
+// sequence of key-value pairs the map contains.  If 'btree_map' is
+// instantiated with a key type or mapped-value type that is not itself
+// value-semantic, then it will not retain all of its value-semantic
+// qualities.  In particular, if the key or value type cannot be tested for
+// equality, then a 'btree_map' containing that type cannot be tested for
+// equality.
+//
+///Requirements on 'KEY' and 'VALUE'
+///---------------------------------
+// A 'btree_map' is a fully "Value-Semantic Type" (see {'bsldoc_glossary'})
+// only if the supplied 'KEY' and 'VALUE' template parameters are fully
+// value-semantic.  In addition, 'KEY' and 'VALUE' must be "copy-constructible"
+// to insert an element, 'VALUE' must be "default-constructible" to use
+// 'operator[]', both must be "equality-comparable" for two 'btree_map'
+// objects to be compared using 'operator==', and 'KEY' and 'VALUE' must be
+// "less-than-comparable" for two 'btree_map' objects to be compared using
+// 'operator<'.
+//
+///Memory Allocation
+///-----------------
+// The type supplied as a 'btree_map''s 'ALLOCATOR' template parameter
+// determines how that map will allocate memory.  The 'btree_map' template
+// supports allocators meeting the requirements of the C++11 standard
+// [17.6.3.5].  In addition, it supports scoped-allocators derived from the
+// 'bslma::Allocator' memory allocation protocol.  Clients intending to use
+// 'bslma' style allocators should use the template's default 'ALLOCATOR'
+// type: The default type for the 'ALLOCATOR' template parameter,
+// 'bsl::allocator', provides a C++11 standard-compatible adapter for a
+// 'bslma::Allocator' object.
+//
+///'bslma'-Style Allocators
+/// - - - - - - - - - - - -
+// If the (template parameter) type 'ALLOCATOR' of a 'btree_map' instantiation
+// is 'bsl::allocator', then objects of that map type will conform to the
+// standard behavior of a 'bslma'-allocator-enabled type.  Such a map accepts
+// an optional 'bslma::Allocator' argument at construction.  If the address of
+// a 'bslma::Allocator' object is explicitly supplied at construction, it will
+// be used to supply memory for the map throughout its lifetime; otherwise,
+// the map will use the default allocator installed at the time of the map's
+// construction (see 'bslma_default').  In addition to directly allocating
+// memory from the indicated 'bslma::Allocator', a map supplies that
+// allocator's address to the constructors of contained objects of the
+// (template parameter) type 'KEY' and 'VALUE', if respectively, the types
+// define the 'bslma::UsesBslmaAllocator' trait.
+//
+///Operations
+///----------
+// This section describes the run-time complexity of operations on instances
+// of 'btree_map':
+//..
+//  Legend
+//  ------
+//  'K'             - (template parameter) type 'KEY' of the map
+//  'V'             - (template parameter) type 'VALUE' of the map
+//  'a', 'b'        - two distinct objects of type 'btree_map<K, V>'
+//  'n', 'm'        - number of elements in 'a' and 'b' respectively
+//  'c'             - comparator providing an ordering for objects of type 'K'
+//  'al'            - an STL-style memory allocator
+//  'i1', 'i2'      - two iterators defining a sequence of 'value_type' objects
+//  'k'             - an object of type 'K'
+//  'v'             - an object of type 'V'
+//  'p1', 'p2'      - two iterators belonging to 'a'
+//  distance(i1,i2) - the number of elements in the range [i1, i2)
+//
+//  +----------------------------------------------------+--------------------+
+//  | Operation                                          | Complexity         |
+//  +====================================================+====================+
+//  | btree_map<K, V> a;    (default construction)       | O[1]               |
+//  | btree_map<K, V> a(al);                             |                    |
+//  | btree_map<K, V> a(c, al);                          |                    |
+//  +----------------------------------------------------+--------------------+
+//  | btree_map<K, V> a(b); (copy construction)          | O[n]               |
+//  | btree_map<K, V> a(b, al);                          |                    |
+//  +----------------------------------------------------+--------------------+
+//  | btree_map<K, V> a(i1, i2);                         | O[N] if [i1, i2)   |
+//  | btree_map<K, V> a(i1, i2, al);                     | is sorted with     |
+//  | btree_map<K, V> a(i1, i2, c, al);                  | 'a.value_comp()',  |
+//  |                                                    | O[N * log(N)]      |
+//  |                                                    | otherwise, where N |
+//  |                                                    | is distance(i1,i2) |
+//  +----------------------------------------------------+--------------------+
+//  | a.~btree_map<K, V>(); (destruction)                | O[n]               |
+//  +----------------------------------------------------+--------------------+
+//  | a = b;          (assignment)                       | O[n + m]           |
+//  +----------------------------------------------------+--------------------+
+//  | a.begin(), a.end(), a.cbegin(), a.cend(),          | O[1]               |
+//  | a.rbegin(), a.rend(), a.crbegin(), a.crend()       |                    |
+//  +----------------------------------------------------+--------------------+
+//  | a == b, a != b                                     | O[n]               |
+//  +----------------------------------------------------+--------------------+
+//  | a < b, a <= b, a > b, a >= b                       | O[n]               |
+//  +----------------------------------------------------+--------------------+
+//  | a.swap(b), swap(a,b)                               | O[1]               |
+//  +----------------------------------------------------+--------------------+
+//  | a.size(), a.max_size(), a.empty(), get_allocator() | O[1]               |
+//  +----------------------------------------------------+--------------------+
+//  | a[k], a.at(k)                                      | O[log(n)]          |
+//  +----------------------------------------------------+--------------------+
+//  | a.insert(value_type(k, v))                         | O[1] if k is       |
+//  | a.insert(p1, value_type(k, v))                     | ordered after the  |
+//  |                                                    | last key in 'a',   |
+//  |                                                    | O[log(n)]          |
+//  |                                                    | otherwise          |
+//  +----------------------------------------------------+--------------------+
+//  | a.insert(i1, i2)                                   | O[log(N) *         |
+//  |                                                    |   distance(i1,i2)] |
+//  |                                                    |                    |
+//  |                                                    | where N is         |
+//  |                                                    | n + distance(i1,i2)|
+//  +----------------------------------------------------+--------------------+
+//  | a.erase(p1), a.erase(k)                            | O[log(n)]          |
+//  +----------------------------------------------------+--------------------+
+//  | a.erase(p1, p2)                                    | O[log(n) *         |
+//  |                                                    | distance(p1, p2)]  |
+//  +----------------------------------------------------+--------------------+
+//  | a.clear()                                          | O[n]               |
+//  +----------------------------------------------------+--------------------+
+//  | a.key_comp(), a.value_comp()                       | O[1]               |
+//  +----------------------------------------------------+--------------------+
+//  | a.find(k), a.count(k), a.lower_bound(k),           | O[log(n)]          |
+//  | a.upper_bound(k), a.equal_range(k)                 |                    |
+//  +----------------------------------------------------+--------------------+
+//..
+// Note that the base of the logarithm for lookups is the number of elements
+// per node (for example, 30 for 'btree_map<int, int>'), rather than 2.
+//
+///Usage
+///-----
+// This section illustrates intended usage of this component.
+//
+///Example 1: Indexing Prices by Timestamp
+///- - - - - - - - - - - - - - - - - - - -
+// Suppose we record the price of a security every time it changes, and later
+// need to look up the price in effect at arbitrary times.  The records arrive
+// in increasing order of time, and are then searched many times, so we store
+// them in a 'btree_map', which is built in linear time from sorted input and
+// searched with few cache misses.
+//
+// First, we define the (sorted) sequence of price changes:
+//..
+//  typedef bsl::pair<const int, double> Record;
+//
+//  const Record RECORDS[] = {
+//      Record( 0, 100.00), Record( 5, 100.25), Record( 7, 100.50),
+//      Record(12, 100.25), Record(20, 101.00), Record(31, 100.75)
+//  };
+//  const int NUM_RECORDS = sizeof RECORDS / sizeof *RECORDS;
+//..
+// Then, we create a 'btree_map' from timestamp to price holding the records:
+//..
+//  bsl::btree_map<int, double> prices(RECORDS, RECORDS + NUM_RECORDS);
+//  assert(6 == prices.size());
+//..
+// Next, we define a function that returns the price in effect at a given
+// time, which is the price of the last change at or before that time:
+//..
+//  struct PriceUtil {
+//      static double priceAt(const bsl::btree_map<int, double>& prices,
+//                            int                                time)
+//      {
+//          bsl::btree_map<int, double>::const_iterator it =
+//                                                   prices.upper_bound(time);
+//          assert(it != prices.begin());
+//          return (--it)->second;
+//      }
+//  };
+//..
+// Finally, we look up the price in effect at several times:
+//..
+//  assert(100.00 == PriceUtil::priceAt(prices,  0));
+//  assert(100.00 == PriceUtil::priceAt(prices,  4));
+//  assert(100.50 == PriceUtil::priceAt(prices, 11));
+//  assert(100.75 == PriceUtil::priceAt(prices, 99));
+//..
+
+#ifndef INCLUDED_BSLSCM_VERSION
+#include <bslscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_ALLOCATOR
+#include <bslstl_allocator.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_ALLOCATORTRAITS
+#include <bslstl_allocatortraits.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_BTREE
+#include <bslstl_btree.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_ITERATOR
+#include <bslstl_iterator.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_PAIR
+#include <bslstl_pair.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_STDEXCEPTUTIL
+#include <bslstl_stdexceptutil.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_UNORDEREDMAPKEYCONFIGURATION
+#include <bslstl_unorderedmapkeyconfiguration.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_RANGECOMPARE
+#include <bslalg_rangecompare.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_TYPETRAITHASSTLITERATORS
+#include <bslalg_typetraithasstliterators.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_USESBSLMAALLOCATOR
+#include <bslma_usesbslmaallocator.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_FUNCTIONAL
+#include <functional>
+#define INCLUDED_FUNCTIONAL
+#endif
+
+namespace bsl {
+
+                             // ===============
+                             // class btree_map
+                             // ===============
+
+template <class KEY,
+          class VALUE,
+          class COMPARATOR = std::less<KEY>,
+          class ALLOCATOR  = bsl::allocator<bsl::pair<const KEY, VALUE> > >
+class btree_map {
+    // This class template implements a value-semantic container type holding
+    // an ordered sequence of unique keys (of template parameter type 'KEY'),
+    // each mapped to an associated value (of template parameter type
+    // 'VALUE'), stored in a B-tree.
+    //
+    // This class:
+    //: o supports a complete set of *value-semantic* operations
+    //:   o except for 'bdex' serialization
+    //: o is *exception-neutral* (agnostic except for the 'at' method)
+    //: o is *alias-safe*
+    //: o is 'const' *thread-safe*
+    // For terminology see {'bsldoc_glossary'}.
+
+    // PRIVATE TYPES
+    typedef bsl::allocator_traits<ALLOCATOR> AllocatorTraits;
+        // This typedef is an alias for the allocator traits type associated
+        // with this container.
+
+    typedef bsl::pair<const KEY, VALUE>  ValueType;
+        // This typedef is an alias for the type of key-value pair objects
+        // maintained by this map.
+
+    typedef ::BloombergLP::bslstl::UnorderedMapKeyConfiguration<ValueType>
+                                                             KeyConfiguration;
+        // This typedef is an alias for the policy used internally by this
+        // container to extract the 'KEY' value from the key-value pair
+        // objects maintained by this map.
+
+    typedef ::BloombergLP::bslstl::BTree<KeyConfiguration,
+                                         COMPARATOR,
+                                         ALLOCATOR> Tree;
+        // This typedef is an alias for the template instantiation of the
+        // underlying 'bslstl::BTree' used to implement this map.
+
+    typedef typename Tree::Iterator TreeIterator;
+        // This typedef is an alias for the iterator type of the underlying
+        // tree.
+
+  public:
+    // PUBLIC TYPES
+    typedef KEY                                        key_type;
+    typedef VALUE                                      mapped_type;
+    typedef bsl::pair<const KEY, VALUE>                value_type;
+    typedef COMPARATOR                                 key_compare;
+    typedef ALLOCATOR                                  allocator_type;
+    typedef value_type&                                reference;
+    typedef const value_type&                          const_reference;
+
+    typedef typename AllocatorTraits::size_type        size_type;
+    typedef typename AllocatorTraits::difference_type  difference_type;
+    typedef typename AllocatorTraits::pointer          pointer;
+    typedef typename AllocatorTraits::const_pointer    const_pointer;
+
+    typedef ::BloombergLP::bslstl::BTreeIterator<
+                                         value_type, difference_type> iterator;
+    typedef ::BloombergLP::bslstl::BTreeIterator<
+                             const value_type, difference_type> const_iterator;
+    typedef bsl::reverse_iterator<iterator>            reverse_iterator;
+    typedef bsl::reverse_iterator<const_iterator>      const_reverse_iterator;
+
+    class value_compare {
+        // This nested class defines a mechanism for comparing two objects of
+        // 'value_type' using the (template parameter) type 'COMPARATOR'.
+        // Note that this class exactly matches the definition of
+        // 'map::value_compare' in the C++11 standard [23.4.4.1].
+
+        // FRIENDS
+        friend class btree_map;
+
+      protected:
+        COMPARATOR comp;  // we would not have elected to make this data
+                          // member protected ourselves
+
+        value_compare(COMPARATOR comparator) : comp(comparator) {}
+            // Create a 'value_compare' object that will delegate to the
+            // specified 'comparator' for comparisons.
+
+      public:
+        typedef bool result_type;
+            // This 'typedef' is an alias for the result type of a call to the
+            // overload of 'operator()' (the comparison function) provided by
+            // a 'btree_map::value_compare' object.
+
+        typedef value_type first_argument_type;
+            // This 'typedef' is an alias for the type of the first parameter
+            // of the overload of 'operator()' (the comparison function)
+            // provided by a 'btree_map::value_compare' object.
+
+        typedef value_type second_argument_type;
+            // This 'typedef' is an alias for the type of the second parameter
+            // of the overload of 'operator()' (the comparison function)
+            // provided by a 'btree_map::value_compare' object.
+
+        bool operator()(const value_type& x, const value_type& y) const
+            // Return 'true' if the specified 'x' object is ordered before the
+            // specified 'y' object, as determined by the comparator supplied
+            // at construction.
+        {
+            return comp(x.first, y.first);
+        }
+    };
+
+  private:
+    // DATA
+    Tree  d_tree;  // B-tree holding the key-value pairs of this map
+
+  public:
+    // CREATORS
+    explicit btree_map(const COMPARATOR& comparator     = COMPARATOR(),
+                       const ALLOCATOR&  basicAllocator = ALLOCATOR());
+        // Create an empty map.  Optionally specify a 'comparator' used to
+        // order keys contained in this object.  If 'comparator' is not
+        // supplied, a default-constructed object of the (template parameter)
+        // type 'COMPARATOR' is used.  Optionally specify the 'basicAllocator'
+        // used to supply memory.  If 'basicAllocator' is not supplied, a
+        // default-constructed object of the (template parameter) type
+        // 'ALLOCATOR' is used.  If the 'ALLOCATOR' is 'bsl::allocator' (the
+        // default), then 'basicAllocator' shall be convertible to
+        // 'bslma::Allocator *', and, if 'basicAllocator' is not supplied, the
+        // currently installed default allocator will be used to supply
+        // memory.  No memory is allocated.
+
+    explicit btree_map(const ALLOCATOR& basicAllocator);
+        // Create an empty map that uses the specified 'basicAllocator' to
+        // supply memory.  Use a default-constructed object of the (template
+        // parameter) type 'COMPARATOR' to order the keys contained in this
+        // map.  If the 'ALLOCATOR' is 'bsl::allocator' (the default), then
+        // 'basicAllocator' shall be convertible to 'bslma::Allocator *'.
+
+    btree_map(const btree_map& original);
+    btree_map(const btree_map& original, const ALLOCATOR& basicAllocator);
+        // Create a map having the same value and comparator as the specified
+        // 'original'.  Optionally specify the 'basicAllocator' used to supply
+        // memory.  If 'basicAllocator' is not supplied, the allocator is
+        // obtained by calling 'bsl::allocator_traits<ALLOCATOR>::
+        // select_on_container_copy_construction' on the allocator of
+        // 'original'.  If the 'ALLOCATOR' is 'bsl::allocator' (the default),
+        // then 'basicAllocator' shall be convertible to
+        // 'bslma::Allocator *'.  Note that the nodes of the new map are
+        // densely packed regardless of the history of 'original'.
+
+    template <class INPUT_ITERATOR>
+    btree_map(INPUT_ITERATOR    first,
+              INPUT_ITERATOR    last,
+              const COMPARATOR& comparator     = COMPARATOR(),
+              const ALLOCATOR&  basicAllocator = ALLOCATOR());
+        // Create a map, and insert each 'value_type' object in the sequence
+        // starting at the specified 'first' element, and ending immediately
+        // before the specified 'last' element, ignoring those pairs having a
+        // key that appears earlier in the sequence.  Optionally specify a
+        // 'comparator' and 'basicAllocator' having the same meaning as for
+        // the default constructor.  If the sequence is sorted by key, this
+        // operation has O[N] complexity, where N is the number of elements
+        // between 'first' and 'last'.  The (template parameter) type
+        // 'INPUT_ITERATOR' shall meet the requirements of an input iterator
+        // defined in the C++11 standard [24.2.3] providing access to values
+        // of a type convertible to 'value_type'.  The behavior is undefined
+        // unless 'first' and 'last' refer to a sequence of valid values where
+        // 'first' is at a position at or before 'last'.
+
+    ~btree_map();
+        // Destroy this object.
+
+    // MANIPULATORS
+    btree_map& operator=(const btree_map& rhs);
+        // Assign to this object the value and comparator of the specified
+        // 'rhs' object, propagate to this object the allocator of 'rhs' if
+        // the 'ALLOCATOR' type has trait
+        // 'propagate_on_container_copy_assignment', and return a reference
+        // providing modifiable access to this object.
+
+    mapped_type& operator[](const key_type& key);
+        // Return a reference providing modifiable access to the mapped-value
+        // associated with the specified 'key' in this map; if this map does
+        // not already contain a 'value_type' object with 'key', first insert
+        // a new 'value_type' object having 'key' and a default-constructed
+        // 'VALUE' object.  This method requires that the (template parameter)
+        // type 'KEY' is "copy-constructible" and the (template parameter)
+        // 'VALUE' is "default-constructible" (see {Requirements on 'KEY' and
+        // 'VALUE'}).
+
+    mapped_type& at(const key_type& key);
+        // Return a reference providing modifiable access to the mapped-value
+        // associated with the specified 'key', if such an entry exists;
+        // otherwise throw a 'std::out_of_range' exception.  Note that this
+        // method is not exception agnostic.
+
+    iterator begin();
+        // Return an iterator providing modifiable access to the first
+        // 'value_type' object in the ordered sequence of 'value_type' objects
+        // maintained by this map, or the 'end' iterator if this map is empty.
+
+    iterator end();
+        // Return an iterator providing modifiable access to the past-the-end
+        // element in the ordered sequence of 'value_type' objects maintained
+        // by this map.
+
+    reverse_iterator rbegin();
+        // Return a reverse iterator providing modifiable access to the last
+        // 'value_type' object in the ordered sequence of 'value_type' objects
+        // maintained by this map, or 'rend' if this map is empty.
+
+    reverse_iterator rend();
+        // Return a reverse iterator providing modifiable access to the
+        // prior-to-the-beginning element in the ordered sequence of
+        // 'value_type' objects maintained by this map.
+
+    pair<iterator, bool> insert(const value_type& value);
+        // Insert the specified 'value' into this map if the key (the 'first'
+        // element) of 'value' does not already exist in this map; otherwise,
+        // if a 'value_type' object having the same key as 'value' already
+        // exists in this map, this method has no effect.  Return a pair whose
+        // 'first' member is an iterator referring to the (possibly newly
+        // inserted) 'value_type' object in this map whose key is the same as
+        // that of 'value', and whose 'second' member is 'true' if a new value
+        // was inserted, and 'false' if the key was already present.  This
+        // method requires that the (template parameter) types 'KEY' and
+        // 'VALUE' both be "copy-constructible" (see {Requirements on 'KEY'
+        // and 'VALUE'}).
+
+    iterator insert(const_iterator hint, const value_type& value);
+        // Insert the specified 'value' into this map if the key (the 'first'
+        // element) of 'value' does not already exist in this map, and return
+        // an iterator referring to the (possibly newly inserted) 'value_type'
+        // object in this map whose key is the same as that of 'value'.  The
+        // specified 'hint' is ignored; note that inserting a key ordered after
+        // every key in this map does not require a search in any case.  This
+        // method requires that the (template parameter) types 'KEY' and
+        // 'VALUE' both be "copy-constructible" (see {Requirements on 'KEY'
+        // and 'VALUE'}).
+
+    template <class INPUT_ITERATOR>
+    void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        // Insert into this map the value of each 'value_type' object in the
+        // range starting at the specified 'first' iterator and ending
+        // immediately before the specified 'last' iterator, whose key is not
+        // already contained in this map.  The (template parameter) type
+        // 'INPUT_ITERATOR' shall meet the requirements of an input iterator
+        // defined in the C++11 standard [24.2.3] providing access to values of
+        // a type convertible to 'value_type'.  This method requires that the
+        // (template parameter) types 'KEY' and 'VALUE' both be
+        // "copy-constructible" (see {Requirements on 'KEY' and 'VALUE'}).
+
+    iterator erase(const_iterator position);
+        // Remove from this map the 'value_type' object at the specified
+        // 'position', and return an iterator referring to the element
+        // immediately following the removed element, or to the past-the-end
+        // position if the removed element was the last element in the
+        // sequence of elements maintained by this map.  The behavior is
+        // undefined unless 'position' refers to a 'value_type' object in this
+        // map.
+
+    size_type erase(const key_type& key);
+        // Remove from this map the 'value_type' object having the specified
+        // 'key', if it exists, and return 1; otherwise, if there is no
+        // 'value_type' object having 'key', return 0 with no other effect.
+
+    iterator erase(const_iterator first, const_iterator last);
+        // Remove from this map the 'value_type' objects starting at the
+        // specified 'first' position up to, but not including the specified
+        // 'last' position, and return an iterator referring to the element
+        // that 'last' referred to (or the past-the-end iterator).  The
+        // behavior is undefined unless 'first' and 'last' either refer to
+        // elements in this map or are the 'end' iterator, and the 'first'
+        // position is at or before the 'last' position in the ordered
+        // sequence provided by this container.
+
+    void swap(btree_map& other);
+        // Exchange the value and comparator of this object with those of the
+        // specified 'other' object.  Additionally, if
+        // 'bsl::allocator_traits<ALLOCATOR>::propagate_on_container_swap' is
+        // 'true', then exchange the allocator of this object with that of the
+        // 'other' object, and do not modify either allocator otherwise.  This
+        // method provides the no-throw exception-safety guarantee and
+        // guarantees O[1] complexity.  The behavior is undefined unless either
+        // this object was created with the same allocator as 'other' or
+        // 'propagate_on_container_swap' is 'true'.
+
+    void clear();
+        // Remove all entries from this map, and release all memory held by
+        // this map.
+
+    iterator find(const key_type& key);
+        // Return an iterator providing modifiable access to the 'value_type'
+        // object in this map having the specified 'key', if such an entry
+        // exists, and the past-the-end ('end') iterator otherwise.
+
+    iterator lower_bound(const key_type& key);
+        // Return an iterator providing modifiable access to the first (i.e.,
+        // ordered least) 'value_type' object in this map whose key is
+        // greater-than or equal-to the specified 'key', and the past-the-end
+        // iterator if this map does not contain a 'value_type' object whose
+        // key is greater-than or equal-to 'key'.
+
+    iterator upper_bound(const key_type& key);
+        // Return an iterator providing modifiable access to the first (i.e.,
+        // ordered least) 'value_type' object in this map whose key is greater
+        // than the specified 'key', and the past-the-end iterator if this map
+        // does not contain a 'value_type' object whose key is greater-than
+        // 'key'.
+
+    pair<iterator, iterator> equal_range(const key_type& key);
+        // Return a pair of iterators providing modifiable access to the
+        // sequence of 'value_type' objects in this map having the specified
+        // 'key', where the first iterator is positioned at the start of the
+        // sequence, and the second is positioned one past the end of the
+        // sequence.  If this map contains no 'value_type' objects having
+        // 'key', then the two returned iterators will have the same value.
+        // Note that since a map maintains unique keys, the range will contain
+        // at most one element.
+
+    // ACCESSORS
+    allocator_type get_allocator() const;
+        // Return (a copy of) the allocator used for memory allocation by this
+        // map.
+
+    const mapped_type& at(const key_type& key) const;
+        // Return a reference providing non-modifiable access to the
+        // mapped-value associated with the specified 'key', if such an entry
+        // exists; otherwise throw a 'std::out_of_range' exception.  Note that
+        // this method is not exception agnostic.
+
+    const_iterator begin() const;
+    const_iterator cbegin() const;
+        // Return an iterator providing non-modifiable access to the first
+        // 'value_type' object in the ordered sequence of 'value_type' objects
+        // maintained by this map, or the 'end' iterator if this map is empty.
+
+    const_iterator end() const;
+    const_iterator cend() const;
+        // Return an iterator providing non-modifiable access to the
+        // past-the-end element in the ordered sequence of 'value_type'
+        // objects maintained by this map.
+
+    const_reverse_iterator rbegin() const;
+    const_reverse_iterator crbegin() const;
+        // Return a reverse iterator providing non-modifiable access to the
+        // last 'value_type' object in the ordered sequence of 'value_type'
+        // objects maintained by this map, or 'rend' if this map is empty.
+
+    const_reverse_iterator rend() const;
+    const_reverse_iterator crend() const;
+        // Return a reverse iterator providing non-modifiable access to the
+        // prior-to-the-beginning element in the ordered sequence of
+        // 'value_type' objects maintained by this map.
+
+    bool empty() const;
+        // Return 'true' if this map contains no elements, and 'false'
+        // otherwise.
+
+    size_type size() const;
+        // Return the number of elements in this map.
+
+    size_type max_size() const;
+        // Return a theoretical upper bound on the largest number of elements
+        // that this map could possibly hold.  Note that there is no guarantee
+        // that the map can successfully grow to the returned size, or even
+        // close to that size without running out of resources.
+
+    key_compare key_comp() const;
+        // Return the key-comparison functor (or function pointer) used by
+        // this map; if a comparator was supplied at construction, return its
+        // value, otherwise return a default constructed 'key_compare' object.
+
+    value_compare value_comp() const;
+        // Return a functor for comparing two 'value_type' objects by
+        // comparing their respective keys using 'key_comp()'.
+
+    const_iterator find(const key_type& key) const;
+        // Return an iterator providing non-modifiable access to the
+        // 'value_type' object in this map having the specified 'key', if such
+        // an entry exists, and the past-the-end ('end') iterator otherwise.
+
+    size_type count(const key_type& key) const;
+        // Return the number of 'value_type' objects within this map having the
+        // specified 'key'.  Note that since a map maintains unique keys, the
+        // returned value will be either 0 or 1.
+
+    const_iterator lower_bound(const key_type& key) const;
+        // Return an iterator providing non-modifiable access to the first
+        // (i.e., ordered least) 'value_type' object in this map whose key is
+        // greater-than or equal-to the specified 'key', and the past-the-end
+        // iterator if this map does not contain a 'value_type' object whose
+        // key is greater-than or equal-to 'key'.
+
+    const_iterator upper_bound(const key_type& key) const;
+        // Return an iterator providing non-modifiable access to the first
+        // (i.e., ordered least) 'value_type' object in this map whose key is
+        // greater than the specified 'key', and the past-the-end iterator if
+        // this map does not contain a 'value_type' object whose key is
+        // greater-than 'key'.
+
+    pair<const_iterator, const_iterator> equal_range(
+                                                    const key_type& key) const;
+        // Return a pair of iterators providing non-modifiable access to the
+        // sequence of 'value_type' objects in this map having the specified
+        // 'key', where the first iterator is positioned at the start of the
+        // sequence and the second iterator is positioned one past the end of
+        // the sequence.  If this map contains no 'value_type' objects having
+        // 'key' then the two returned iterators will have the same value.
+        // Note that since a map maintains unique keys, the range will contain
+        // at most one element.
+};
+
+// FREE OPERATORS
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+bool operator==(const btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+                const btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects have the same
+    // value, and 'false' otherwise.  Two 'btree_map' objects have the same
+    // value if they have the same number of key-value pairs, and each
+    // key-value pair that is contained in one of the objects is also contained
+    // in the other object.  This method requires that the (template
+    // parameter) types 'KEY' and 'VALUE' both be "equality-comparable" (see
+    // {Requirements on 'KEY' and 'VALUE'}).
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+bool operator!=(const btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+                const btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects do not have the
+    // same value, and 'false' otherwise.  Two 'btree_map' objects do not have
+    // the same value if they do not have the same number of key-value pairs,
+    // or some key-value pair that is contained in one of the objects is not
+    // also contained in the other object.  This method requires that the
+    // (template parameter) types 'KEY' and 'VALUE' both be
+    // "equality-comparable" (see {Requirements on 'KEY' and 'VALUE'}).
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+bool operator<(const btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+               const btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the value of the specified 'lhs' map is
+    // lexicographically less than that of the specified 'rhs' map, and
+    // 'false' otherwise.  Given iterators 'i' and 'j' over the respective
+    // sequences '[lhs.begin() .. lhs.end())' and '[rhs.begin() .. rhs.end())',
+    // the value of map 'lhs' is lexicographically less than that of map 'rhs'
+    // if 'true == *i < *j' for the first pair of corresponding iterator
+    // positions where '*i' and '*j' differ, or if 'rhs.size() > lhs.size()'
+    // and '*i == *j' for every position of 'i' in
+    // '[lhs.begin() .. lhs.end())'.  This method requires that 'operator<',
+    // inducing a total order, be defined for 'value_type'.
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+bool operator>(const btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+               const btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the value of the specified 'lhs' map is
+    // lexicographically greater than that of the specified 'rhs' map, and
+    // 'false' otherwise.  This method requires that 'operator<', inducing a
+    // total order, be defined for 'value_type'.
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+bool operator<=(const btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+                const btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the value of the specified 'lhs' map is
+    // lexicographically less than or equal to that of the specified 'rhs'
+    // map, and 'false' otherwise.  This method requires that 'operator<',
+    // inducing a total order, be defined for 'value_type'.
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+bool operator>=(const btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+                const btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the value of the specified 'lhs' map is
+    // lexicographically greater than or equal to that of the specified 'rhs'
+    // map, and 'false' otherwise.  This method requires that 'operator<',
+    // inducing a total order, be defined for 'value_type'.
+
+// FREE FUNCTIONS
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+void swap(btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& a,
+          btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& b);
+    // Exchange the value and comparator of the specified 'a' object with
+    // those of the specified 'b' object.  Additionally, if
+    // 'bsl::allocator_traits<ALLOCATOR>::propagate_on_container_swap' is
+    // 'true', then exchange the allocator of 'a' with that of 'b', and do not
+    // modify either allocator otherwise.  This method provides the no-throw
+    // exception-safety guarantee and guarantees O[1] complexity.  The
+    // behavior is undefined unless either 'a' was created with the same
+    // allocator as 'b' or 'propagate_on_container_swap' is 'true'.
+
+// ============================================================================
+//                  TEMPLATE AND INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+                             // ---------------
+                             // class btree_map
+                             // ---------------
+
+// CREATORS
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::btree_map(
+                                          const COMPARATOR& comparator,
+                                          const ALLOCATOR&  basicAllocator)
+: d_tree(comparator, basicAllocator)
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::btree_map(
+                                               const ALLOCATOR& basicAllocator)
+: d_tree(COMPARATOR(), basicAllocator)
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::btree_map(
+                                                     const btree_map& original)
+: d_tree(original.d_tree,
+         AllocatorTraits::select_on_container_copy_construction(
+                                                     original.get_allocator()))
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::btree_map(
+                                              const btree_map& original,
+                                              const ALLOCATOR& basicAllocator)
+: d_tree(original.d_tree, basicAllocator)
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+inline
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::btree_map(
+                                          INPUT_ITERATOR    first,
+                                          INPUT_ITERATOR    last,
+                                          const COMPARATOR& comparator,
+                                          const ALLOCATOR&  basicAllocator)
+: d_tree(comparator, basicAllocator)
+{
+    this->insert(first, last);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::~btree_map()
+{
+    // All memory management is handled by the 'd_tree' member.
+}
+
+// MANIPULATORS
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>&
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::operator=(const btree_map& rhs)
+{
+    d_tree = rhs.d_tree;
+    return *this;
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::mapped_type&
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::operator[](const key_type& key)
+{
+    return d_tree.insertIfMissing(key)->second;
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::mapped_type&
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::at(const key_type& key)
+{
+    const TreeIterator it = d_tree.find(key);
+
+    if (it == d_tree.end()) {
+        BloombergLP::bslstl::StdExceptUtil::throwOutOfRange(
+                            "btree_map<...>::at(key_type): invalid key value");
+    }
+
+    return it->second;
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::begin()
+{
+    return d_tree.begin();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::end()
+{
+    return d_tree.end();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::reverse_iterator
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::rbegin()
+{
+    return reverse_iterator(end());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::reverse_iterator
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::rend()
+{
+    return reverse_iterator(begin());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bsl::pair<typename btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator,
+          bool>
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::insert(const value_type& value)
+{
+    return d_tree.insertUnique(value);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::insert(const_iterator,
+                                                     const value_type& value)
+{
+    // Appending to the tree is already detected without a search, and a hint
+    // elsewhere would not save the descent needed to find its node's parent.
+
+    return d_tree.insertUnique(value).first;
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+inline
+void btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::insert(INPUT_ITERATOR first,
+                                                          INPUT_ITERATOR last)
+{
+    while (first != last) {
+        d_tree.insertUnique(*first);
+        ++first;
+    }
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::erase(const_iterator position)
+{
+    BSLS_ASSERT(position != this->end());
+
+    return d_tree.remove(TreeIterator(position.node(), position.position()));
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::size_type
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::erase(const key_type& key)
+{
+    const TreeIterator it = d_tree.find(key);
+    if (it != d_tree.end()) {
+        d_tree.remove(it);
+        return 1;                                                     // RETURN
+    }
+    return 0;
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+typename btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::erase(const_iterator first,
+                                                    const_iterator last)
+{
+    // Removing an element invalidates every iterator, including 'last', so
+    // the elements are counted first, and then removed one at a time.
+
+    size_type numElements = 0;
+    for (const_iterator it = first; it != last; ++it) {
+        ++numElements;
+    }
+
+    TreeIterator result(first.node(), first.position());
+    for (; 0 < numElements; --numElements) {
+        result = d_tree.remove(result);
+    }
+    return result;
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+void btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::swap(btree_map& other)
+{
+    d_tree.swap(other.d_tree);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+void btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::clear()
+{
+    d_tree.removeAll();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::find(const key_type& key)
+{
+    return d_tree.find(key);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::lower_bound(const key_type& key)
+{
+    return d_tree.lowerBound(key);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::upper_bound(const key_type& key)
+{
+    return d_tree.upperBound(key);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bsl::pair<typename btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator,
+          typename btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator>
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::equal_range(const key_type& key)
+{
+    typedef bsl::pair<iterator, iterator> ResultType;
+
+    iterator first = this->find(key);
+    if (first == this->end()) {
+        first = this->lower_bound(key);
+        return ResultType(first, first);                              // RETURN
+    }
+    iterator next = first;
+    return ResultType(first, ++next);
+}
+
+// ACCESSORS
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+ALLOCATOR btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::get_allocator() const
+{
+    return d_tree.allocator();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+const typename btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::mapped_type&
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::at(const key_type& key) const
+{
+    const TreeIterator it = d_tree.find(key);
+
+    if (it == d_tree.end()) {
+        BloombergLP::bslstl::StdExceptUtil::throwOutOfRange(
+                      "btree_map<...>::at(key_type) const: invalid key value");
+    }
+
+    return it->second;
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_iterator
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::begin() const
+{
+    return d_tree.begin();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_iterator
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::cbegin() const
+{
+    return d_tree.begin();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_iterator
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::end() const
+{
+    return d_tree.end();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_iterator
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::cend() const
+{
+    return d_tree.end();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_reverse_iterator
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::rbegin() const
+{
+    return const_reverse_iterator(end());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_reverse_iterator
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::crbegin() const
+{
+    return const_reverse_iterator(end());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_reverse_iterator
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::rend() const
+{
+    return const_reverse_iterator(begin());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_reverse_iterator
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::crend() const
+{
+    return const_reverse_iterator(begin());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bool btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::empty() const
+{
+    return 0 == d_tree.size();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::size_type
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::size() const
+{
+    return d_tree.size();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::size_type
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::max_size() const
+{
+    return d_tree.maxSize();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::key_compare
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::key_comp() const
+{
+    return d_tree.comparator();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::value_compare
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::value_comp() const
+{
+    return value_compare(key_comp());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_iterator
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::find(const key_type& key) const
+{
+    return d_tree.find(key);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::size_type
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::count(const key_type& key) const
+{
+    return d_tree.find(key) != d_tree.end();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_iterator
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::lower_bound(
+                                                     const key_type& key) const
+{
+    return d_tree.lowerBound(key);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_iterator
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::upper_bound(
+                                                     const key_type& key) const
+{
+    return d_tree.upperBound(key);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bsl::pair<
+    typename btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_iterator,
+    typename btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_iterator>
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::equal_range(
+                                                     const key_type& key) const
+{
+    typedef bsl::pair<const_iterator, const_iterator> ResultType;
+
+    const_iterator first = this->find(key);
+    if (first == this->end()) {
+        first = this->lower_bound(key);
+        return ResultType(first, first);                              // RETURN
+    }
+    const_iterator next = first;
+    return ResultType(first, ++next);
+}
+
+}  // close namespace bsl
+
+// FREE OPERATORS
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator==(
+                const bsl::btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+                const bsl::btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return BloombergLP::bslalg::RangeCompare::equal(lhs.begin(),
+                                                    lhs.end(),
+                                                    lhs.size(),
+                                                    rhs.begin(),
+                                                    rhs.end(),
+                                                    rhs.size());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator!=(
+                const bsl::btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+                const bsl::btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator<(
+                const bsl::btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+                const bsl::btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return 0 > BloombergLP::bslalg::RangeCompare::lexicographical(lhs.begin(),
+                                                                  lhs.end(),
+                                                                  lhs.size(),
+                                                                  rhs.begin(),
+                                                                  rhs.end(),
+                                                                  rhs.size());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator>(
+                const bsl::btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+                const bsl::btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return rhs < lhs;
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator<=(
+                const bsl::btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+                const bsl::btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return !(rhs < lhs);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator>=(
+                const bsl::btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+                const bsl::btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return !(lhs < rhs);
+}
+
+// FREE FUNCTIONS
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+void bsl::swap(bsl::btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& a,
+               bsl::btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& b)
+{
+    a.swap(b);
+}
+
+// ============================================================================
+//                                TYPE TRAITS
+// ============================================================================
+
+// Type traits for B-tree containers:
+//: o A B-tree container defines STL iterators.
+//: o A B-tree container uses 'bslma' allocators if the parameterized
+//:      'ALLOCATOR' is convertible from 'bslma::Allocator*'.
+
+namespace BloombergLP {
+
+namespace bslalg {
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+struct HasStlIterators<bsl::btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR> >
+     : bsl::true_type
+{};
+
+}  // close package namespace
+
+namespace bslma {
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+struct UsesBslmaAllocator<bsl::btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR> >
+     : bsl::is_convertible<Allocator*, ALLOCATOR>::type
+{};
+
+}  // close package namespace
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
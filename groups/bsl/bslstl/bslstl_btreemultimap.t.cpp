@@ -0,0 +1,1748 @@
+// bslstl_btreemultimap.t.cpp                                         -*-C++-*-
+
+#include <bslstl_btreemultimap.h>
+
+#include <bslstl_btree.h>
+#include <bslstl_vector.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatormonitor.h>
+#include <bsls_bsltestutil.h>
+#include <bsls_nativestd.h>
+#include <bsls_types.h>
+
+#include <bsltf_alloctesttype.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+
+using namespace BloombergLP;
+using namespace std;
+
+//=============================================================================
+//                             TEST PLAN
+//-----------------------------------------------------------------------------
+//                             Overview
+//                             --------
+// The component under test is a value-semantic container that forwards most
+// of its work to 'bslstl::BTree', which is tested in its own test driver.
+// Here we test each method of the standard 'multimap' interface in turn,
+// paying particular attention to runs of elements having equivalent keys:
+// such a run may span several nodes, its elements must remain in insertion
+// order, and splitting or merging nodes must not reorder them.  Since the
+// elements of a 'btree_multimap<int, int>' are held in the nodes, each node
+// is one allocation, and we observe splits and merges through the number of
+// blocks in use by a test allocator, with the node capacity taken from
+// 'bslstl::BTree_NodeUtil'.  The mapped value of each element records the
+// order of its insertion, so that the relative order of equivalent keys can
+// be verified.  We use 'bsltf::AllocTestType', which is not bitwise-moveable
+// (so that the elements are held out of line), to verify the propagation of
+// the allocator of the container to its elements, and that references to
+// such elements remain valid when nodes are split or merged.
+//-----------------------------------------------------------------------------
+// CREATORS
+// [ 1] explicit btree_multimap(const COMPARATOR&, const ALLOCATOR&);
+// [ 1] explicit btree_multimap(const ALLOCATOR& basicAllocator);
+// [ 8] btree_multimap(const btree_multimap& original);
+// [ 8] btree_multimap(const btree_multimap& original, basicAllocator);
+// [ 7] btree_multimap(INPUT_ITERATOR first, INPUT_ITERATOR last, ...);
+// [ 1] ~btree_multimap();
+//
+// MANIPULATORS
+// [ 8] btree_multimap& operator=(const btree_multimap& rhs);
+// [ 3] iterator begin();
+// [ 3] iterator end();
+// [ 3] reverse_iterator rbegin();
+// [ 3] reverse_iterator rend();
+// [ 2] iterator insert(const value_type& value);
+// [ 7] iterator insert(const_iterator hint, const value_type& value);
+// [ 7] void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+// [ 5] iterator erase(const_iterator position);
+// [ 5] size_type erase(const key_type& key);
+// [ 6] iterator erase(const_iterator first, const_iterator last);
+// [ 8] void swap(btree_multimap& other);
+// [ 6] void clear();
+// [ 4] iterator find(const key_type& key);
+// [ 4] iterator lower_bound(const key_type& key);
+// [ 4] iterator upper_bound(const key_type& key);
+// [ 4] pair<iterator, iterator> equal_range(const key_type& key);
+//
+// ACCESSORS
+// [ 8] allocator_type get_allocator() const;
+// [ 3] const_iterator begin() const;
+// [ 3] const_iterator cbegin() const;
+// [ 3] const_iterator end() const;
+// [ 3] const_iterator cend() const;
+// [ 3] const_reverse_iterator rbegin() const;
+// [ 3] const_reverse_iterator crbegin() const;
+// [ 3] const_reverse_iterator rend() const;
+// [ 3] const_reverse_iterator crend() const;
+// [ 1] bool empty() const;
+// [ 1] size_type size() const;
+// [ 1] key_compare key_comp() const;
+// [ 1] value_compare value_comp() const;
+// [ 4] const_iterator find(const key_type& key) const;
+// [ 4] size_type count(const key_type& key) const;
+// [ 4] const_iterator lower_bound(const key_type& key) const;
+// [ 4] const_iterator upper_bound(const key_type& key) const;
+// [ 4] pair<const_iterator, const_iterator> equal_range(key) const;
+//
+// FREE OPERATORS
+// [ 8] bool operator==(const btree_multimap& lhs, const btree_multimap&);
+// [ 8] bool operator!=(const btree_multimap& lhs, const btree_multimap&);
+// [ 8] bool operator<(const btree_multimap& lhs, const btree_multimap&);
+// [ 8] bool operator>(const btree_multimap& lhs, const btree_multimap&);
+// [ 8] bool operator<=(const btree_multimap& lhs, const btree_multimap&);
+// [ 8] bool operator>=(const btree_multimap& lhs, const btree_multimap&);
+// [ 8] void swap(btree_multimap& a, btree_multimap& b);
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 2] CONCERN: Splitting a full node when appending, prepending, or not
+// [ 2] CONCERN: Equivalent keys are kept in insertion order
+// [ 3] CONCERN: Out-of-line elements are not moved by a split or merge
+// [ 4] CONCERN: Lookup finds runs of equivalent keys spanning nodes
+// [ 5] CONCERN: Erasing merges a node with, or borrows from, a sibling
+// [ 5] CONCERN: Erasing a key removes a run spanning several nodes
+// [ 9] USAGE EXAMPLE
+//-----------------------------------------------------------------------------
+
+//=============================================================================
+//                  STANDARD BDE ASSERT TEST MACRO
+//-----------------------------------------------------------------------------
+static int testStatus = 0;
+
+static void aSsErT(bool b, const char *s, int i) {
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+//=============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef bsl::btree_multimap<int, int>                      Obj;
+typedef bsl::btree_multimap<int, int, std::greater<int> >  GreaterObj;
+typedef bsl::btree_multimap<int, bsltf::AllocTestType>     AllocObj;
+typedef bsl::vector<int>                                   Keys;
+
+const int MAX_VALUES = bslstl::BTree_NodeUtil<Obj::value_type>::k_MAX_VALUES;
+    // maximum number of elements in a node of an 'Obj'
+
+const int MIN_VALUES = bslstl::BTree_NodeUtil<Obj::value_type>::k_MIN_VALUES;
+    // fewest elements left in a non-root node of an 'Obj' by an erasure that
+    // does not rebalance the node
+
+const int TWO_LEVELS = MAX_VALUES * (MAX_VALUES + 1);
+    // number of elements of an 'Obj' built by appending elements in key
+    // order, above which the root of the tree is split for the second time
+
+namespace {
+
+int numNewNodes(int size)
+    // Return the number of nodes allocated by appending an element to an
+    // 'Obj' built by appending the specified 'size' elements in key order
+    // (see {'bslstl_btree'|Sequential Insertion}), or by prepending an
+    // element to an 'Obj' built by prepending 'size' elements in reverse key
+    // order.  The behavior is undefined unless 'size <= TWO_LEVELS'.  Note
+    // that an element having a key equivalent to the last key is appended.
+{
+    return 0 == size               ? 1
+         : 0 != size % MAX_VALUES  ? 0
+         : MAX_VALUES == size      ? 2   // a new leaf and a new root
+         : TWO_LEVELS == size      ? 3   // and the root is split again
+         :                           1;  // a new leaf
+}
+
+template <class OBJ>
+bool hasKeys(const OBJ& object, const Keys& keys)
+    // Return 'true' if the keys of the elements of the specified 'object' are
+    // the specified 'keys', in order, both when iterating forward from
+    // 'begin' and backward from 'end', and 'false' otherwise.
+{
+    if (object.size() != keys.size()) {
+        return false;                                                 // RETURN
+    }
+    typename OBJ::const_iterator it = object.begin();
+    for (Keys::size_type i = 0; i < keys.size(); ++i, ++it) {
+        if (object.end() == it || keys[i] != it->first) {
+            return false;                                             // RETURN
+        }
+    }
+    if (object.end() != it) {
+        return false;                                                 // RETURN
+    }
+    for (Keys::size_type i = keys.size(); 0 < i; --i) {
+        if (keys[i - 1] != (--it)->first) {
+            return false;                                             // RETURN
+        }
+    }
+    return object.begin() == it;
+}
+
+template <class OBJ>
+bool isInInsertionOrder(const OBJ& object)
+    // Return 'true' if the mapped values of each pair of adjacent elements of
+    // the specified 'object' having the same key are in increasing order,
+    // and 'false' otherwise.  Note that the tests insert elements having
+    // increasing mapped values, so that this function verifies that
+    // equivalent keys are in insertion order.
+{
+    if (object.empty()) {
+        return true;                                                  // RETURN
+    }
+    typename OBJ::const_iterator prev = object.begin();
+    typename OBJ::const_iterator it   = prev;
+    for (++it; object.end() != it; prev = it, ++it) {
+        if (prev->first == it->first && !(prev->second < it->second)) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+void appendKeys(Keys *keys, int first, int last, int numCopies = 1)
+    // Append to the specified 'keys' the integers from the specified 'first'
+    // up to, but not including, the specified 'last', each repeated the
+    // optionally specified 'numCopies' times.
+{
+    for (int key = first; key < last; ++key) {
+        for (int i = 0; i < numCopies; ++i) {
+            keys->push_back(key);
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+    bool verbose = argc > 2;
+    bool veryVerbose = argc > 3;
+    bool veryVeryVerbose = argc > 4;
+
+    (void)veryVerbose;
+    (void)veryVeryVerbose;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVerbose);
+    bslma::DefaultAllocatorGuard defaultAllocatorGuard(&defaultAllocator);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 9: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+///Usage
+///-----
+// This section illustrates intended usage of this component.
+//
+///Example 1: Grouping Orders by Price Level
+///- - - - - - - - - - - - - - - - - - - - -
+// Suppose we maintain the resting orders of an order book, keyed by price
+// (in ticks), where several orders may rest at the same price and must be
+// filled in the order in which they arrived.
+//
+// First, we create a 'btree_multimap' from price to order identifier:
+//..
+    typedef bsl::btree_multimap<int, int> OrderBook;
+    typedef OrderBook::value_type         Order;
+
+    OrderBook book;
+//..
+// Then, we add some orders:
+//..
+    book.insert(Order(1005, 1));
+    book.insert(Order(1003, 2));
+    book.insert(Order(1005, 3));
+    book.insert(Order(1004, 4));
+    book.insert(Order(1005, 5));
+    ASSERT(5 == book.size());
+    ASSERT(3 == book.count(1005));
+//..
+// Next, we fill the orders at price 1005, which are visited in arrival order:
+//..
+    bsl::pair<OrderBook::iterator, OrderBook::iterator> level =
+                                                       book.equal_range(1005);
+    ASSERT(1 == level.first->second);
+    ASSERT(3 == (++level.first)->second);
+    ASSERT(5 == (++level.first)->second);
+
+    ASSERT(3 == book.erase(1005));
+//..
+// Finally, we verify that the best remaining price is 1004:
+//..
+    ASSERT(2    == book.size());
+    ASSERT(1004 == book.rbegin()->first);
+//..
+      } break;
+      case 8: {
+        // --------------------------------------------------------------------
+        // COPY, ASSIGNMENT, SWAP, AND COMPARISON
+        //
+        // Concerns:
+        //: 1 A copy compares equal to the original, keeps the order of
+        //:   equivalent keys, and it and its elements use the supplied
+        //:   allocator, or the default allocator if none is supplied.
+        //:
+        //: 2 Assignment gives the target the value of the source, and retains
+        //:   the allocator of the target.
+        //:
+        //: 3 Member and free 'swap' exchange the values of two multimaps
+        //:   having the same allocator without allocating memory.
+        //:
+        //: 4 Multimaps compare unequal if an element has a different mapped
+        //:   value, or if the elements having equivalent keys are in a
+        //:   different order.
+        //:
+        //: 5 The relational operators order multimaps lexicographically.
+        //
+        // Plan:
+        //: 1 Using test allocators, create multimaps of
+        //:   'bsltf::AllocTestType' having two elements per key, and sizes at
+        //:   the boundaries of one, two, and three levels of nodes, copy,
+        //:   assign, and swap them, and verify the values, allocators, and
+        //:   allocations of the results.  (C-1..4)
+        //:
+        //: 2 Compare multimaps of integers that differ in their last element,
+        //:   in their length, or in the order of two elements having the same
+        //:   key, using each relational operator.  (C-4..5)
+        //
+        // Testing:
+        //   btree_multimap(const btree_multimap& original);
+        //   btree_multimap(const btree_multimap& original, basicAllocator);
+        //   btree_multimap& operator=(const btree_multimap& rhs);
+        //   void swap(btree_multimap& other);
+        //   allocator_type get_allocator() const;
+        //   bool operator==(const btree_multimap& lhs, const btree_multimap&);
+        //   bool operator!=(const btree_multimap& lhs, const btree_multimap&);
+        //   bool operator<(const btree_multimap& lhs, const btree_multimap&);
+        //   bool operator>(const btree_multimap& lhs, const btree_multimap&);
+        //   bool operator<=(const btree_multimap& lhs, const btree_multimap&);
+        //   bool operator>=(const btree_multimap& lhs, const btree_multimap&);
+        //   void swap(btree_multimap& a, btree_multimap& b);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCOPY, ASSIGNMENT, SWAP, AND COMPARISON"
+                            "\n======================================\n");
+
+        bslma::TestAllocator oa("object",  veryVeryVerbose);
+        bslma::TestAllocator za("other",   veryVeryVerbose);
+
+        const int SIZES[] = { 0, 1, 2, MAX_VALUES, MAX_VALUES + 1,
+                              TWO_LEVELS, TWO_LEVELS + 1 };
+        const int NUM_SIZES = sizeof SIZES / sizeof *SIZES;
+
+        for (int ti = 0; ti < NUM_SIZES; ++ti) {
+            const int N = SIZES[ti];
+
+            AllocObj mX(&oa);  const AllocObj& X = mX;
+            for (int i = 0; i < N; ++i) {
+                mX.insert(AllocObj::value_type(i / 2,
+                                               bsltf::AllocTestType(i + 1)));
+            }
+
+            {
+                AllocObj mY(X);  const AllocObj& Y = mY;
+                ASSERTV(N, X == Y);
+                ASSERTV(N, &defaultAllocator ==
+                                              Y.get_allocator().mechanism());
+            }
+            ASSERT(0 == defaultAllocator.numBlocksInUse());
+            {
+                AllocObj mY(X, &za);  const AllocObj& Y = mY;
+                ASSERTV(N, X == Y);
+                ASSERTV(N, &za == Y.get_allocator().mechanism());
+
+                int count = 0;
+                for (AllocObj::const_iterator it = Y.begin();
+                     it != Y.end();
+                     ++it) {
+                    ++count;
+                    ASSERTV(N, count, count == it->second.data());
+                    ASSERTV(N, count, &za == it->second.allocator());
+                }
+
+                if (N) {
+                    mY.rbegin()->second.setData(0);
+                    ASSERTV(N, X != Y);
+                }
+            }
+            {
+                AllocObj mY(&za);  const AllocObj& Y = mY;
+                mY.insert(AllocObj::value_type(N, bsltf::AllocTestType(N)));
+                mY = X;
+                ASSERTV(N, X == Y);
+                ASSERTV(N, &za == Y.get_allocator().mechanism());
+            }
+            {
+                AllocObj mY(&oa);  const AllocObj& Y = mY;
+                mY.insert(AllocObj::value_type(N, bsltf::AllocTestType(N)));
+                const AllocObj XX(X, &za);
+                const AllocObj YY(Y, &za);
+
+                bslma::TestAllocatorMonitor oam(&oa);
+                mY.swap(mX);
+                ASSERTV(N, XX == Y);
+                ASSERTV(N, YY == X);
+
+                swap(mX, mY);
+                ASSERTV(N, XX == X);
+                ASSERTV(N, YY == Y);
+                ASSERTV(N, oam.isTotalSame());
+            }
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+        ASSERT(0 == za.numBlocksInUse());
+        ASSERT(0 == defaultAllocator.numBlocksInUse());
+
+        if (verbose) printf("\nTesting relational operators.\n");
+        {
+            Obj mA(&oa);  const Obj& A = mA;
+            Obj mB(&oa);  const Obj& B = mB;
+            for (int i = 0; i < TWO_LEVELS; ++i) {
+                mA.insert(Obj::value_type(i / 2, i));
+                mB.insert(Obj::value_type(i / 2, i));
+            }
+            ASSERT(  A == B);
+            ASSERT(!(A <  B));
+            ASSERT(  A <= B);
+            ASSERT(!(A >  B));
+            ASSERT(  A >= B);
+
+            // Replace the last element of 'B' by one having a greater mapped
+            // value.
+
+            const int LAST_KEY = (TWO_LEVELS - 1) / 2;
+
+            mB.erase(--mB.end());
+            mB.insert(Obj::value_type(LAST_KEY, TWO_LEVELS));
+            ASSERT(  A != B);
+            ASSERT(  A <  B);
+            ASSERT(  A <= B);
+            ASSERT(!(A >  B));
+            ASSERT(!(A >= B));
+            ASSERT(  B >  A);
+
+            mB.erase(--mB.end());
+            mB.insert(Obj::value_type(LAST_KEY, TWO_LEVELS - 1));
+            ASSERT(  A == B);
+
+            mB.insert(Obj::value_type(LAST_KEY, 0));
+            ASSERT(  A <  B);
+            ASSERT(  B >= A);
+
+            // Give 'A' and 'B' the same elements, with those having the key
+            // 'LAST_KEY + 1' in a different order.
+
+            mA.insert(Obj::value_type(LAST_KEY + 1, 1));
+            mA.insert(Obj::value_type(LAST_KEY + 1, 2));
+            mB.erase(--mB.end());
+            mB.insert(Obj::value_type(LAST_KEY + 1, 2));
+            mB.insert(Obj::value_type(LAST_KEY + 1, 1));
+            ASSERT(A.size() == B.size());
+            ASSERT(  A != B);
+            ASSERT(  A <  B);
+            ASSERT(  B >  A);
+        }
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // 'insert' WITH HINT, RANGE 'insert', AND RANGE CONSTRUCTOR
+        //
+        // Concerns:
+        //: 1 'insert' with a hint inserts the value after every element having
+        //:   an equivalent key, and returns an iterator referring to the new
+        //:   element, whatever the hint.
+        //:
+        //: 2 Range 'insert' inserts every value in the range, including values
+        //:   that are out of order or have equivalent keys, and values having
+        //:   equivalent keys follow any elements having the key, in the order
+        //:   in which they appear in the range.
+        //:
+        //: 3 The range constructor creates a multimap holding the same
+        //:   elements as range 'insert', ordered by the supplied comparator,
+        //:   and using the supplied allocator.
+        //:
+        //: 4 No memory is leaked, and the default allocator is not used.
+        //
+        // Plan:
+        //: 1 Insert odd and even keys into an object holding even keys, with
+        //:   hints referring to the beginning, the end, the lower bound of
+        //:   the key, and an unrelated element, and verify the returned
+        //:   iterator, the size, and the order of the elements.  (C-1)
+        //:
+        //: 2 Insert an unsorted range of values having duplicate keys, and
+        //:   spanning many nodes, into an object holding some of the keys, and
+        //:   verify the keys and the order of the elements.  (C-2)
+        //:
+        //: 3 Construct an 'Obj' and a 'GreaterObj' from the range of P-2, and
+        //:   verify their elements and allocator.  (C-3)
+        //:
+        //: 4 Verify that no memory is in use by the object allocator at the
+        //:   end of the test, and that no memory was allocated by the default
+        //:   allocator.  (C-4)
+        //
+        // Testing:
+        //   iterator insert(const_iterator hint, const value_type& value);
+        //   void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        //   btree_multimap(INPUT_ITERATOR first, INPUT_ITERATOR last, ...);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\n'insert' WITH HINT, RANGE 'insert', AND RANGE"
+                            " CONSTRUCTOR"
+                            "\n=============================================="
+                            "============\n");
+
+        bslma::TestAllocator oa("object",  veryVeryVerbose);
+        bslma::TestAllocator sa("scratch", veryVeryVerbose);
+
+        if (verbose) printf("\nTesting 'insert' with a hint.\n");
+        {
+            const int N = TWO_LEVELS;
+
+            Obj mX(&oa);  const Obj& X = mX;
+            for (int i = 0; i < N; ++i) {
+                mX.insert(Obj::value_type(2 * i, -1));
+            }
+
+            for (int i = 0; i < 2 * N; ++i) {
+                const int KEY = (i * 7919) % (2 * N);
+
+                Obj::const_iterator hint;
+                switch (i % 4) {
+                  case 0: hint = X.begin();                          break;
+                  case 1: hint = X.end();                            break;
+                  case 2: hint = X.lower_bound(KEY);                 break;
+                  case 3: hint = X.find((KEY + N) / 2 / 2 * 2);      break;
+                }
+
+                const Obj::size_type SIZE = X.size();
+
+                Obj::iterator R = mX.insert(hint, Obj::value_type(KEY, i));
+                ASSERTV(KEY, KEY == R->first);
+                ASSERTV(KEY, i   == R->second);
+                ASSERTV(KEY, SIZE + 1 == X.size());
+                ASSERTV(KEY, X.upper_bound(KEY) == ++R);
+            }
+
+            Keys keys(&sa);
+            for (int key = 0; key < 2 * N; ++key) {
+                keys.push_back(key);
+                if (0 == key % 2) {
+                    keys.push_back(key);
+                }
+            }
+            ASSERT(hasKeys(X, keys));
+            ASSERT(isInInsertionOrder(X));
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+
+        if (verbose) printf("\nTesting range 'insert'.\n");
+
+        const int NUM_KEYS   = 2 * TWO_LEVELS;
+        const int NUM_VALUES = 3 * NUM_KEYS;
+
+        bsl::vector<Obj::value_type> values(&sa);
+        for (int i = 0; i < NUM_VALUES; ++i) {
+            values.push_back(Obj::value_type((i * 7919) % NUM_KEYS, i));
+        }
+
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+            for (int key = 0; key < NUM_KEYS; key += 3) {
+                mX.insert(Obj::value_type(key, -1));
+            }
+
+            mX.insert(values.begin(), values.end());
+
+            Keys keys(&sa);
+            for (int key = 0; key < NUM_KEYS; ++key) {
+                keys.insert(keys.end(), key % 3 ? 3 : 4, key);
+            }
+            ASSERT(hasKeys(X, keys));
+            ASSERT(isInInsertionOrder(X));
+
+            for (int key = 0; key < NUM_KEYS; key += 3) {
+                ASSERTV(key, -1 == X.find(key)->second);
+            }
+
+            const Obj::size_type SIZE = X.size();
+            mX.insert(values.begin(), values.begin());
+            ASSERT(SIZE == X.size());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+
+        if (verbose) printf("\nTesting the range constructor.\n");
+        {
+            const Obj X(values.begin(), values.end(), std::less<int>(), &oa);
+            ASSERT(NUM_VALUES == static_cast<int>(X.size()));
+            ASSERT(isInInsertionOrder(X));
+            ASSERT(&oa == X.get_allocator().mechanism());
+
+            Keys keys(&sa);
+            appendKeys(&keys, 0, NUM_KEYS, 3);
+            ASSERT(hasKeys(X, keys));
+
+            const GreaterObj Y(values.begin(),
+                               values.end(),
+                               std::greater<int>(),
+                               &oa);
+            ASSERT(X.size() == Y.size());
+            ASSERT(isInInsertionOrder(Y));
+            ASSERT(&oa == Y.get_allocator().mechanism());
+
+            for (int key = 0; key < NUM_KEYS; ++key) {
+                const bsl::pair<Obj::const_iterator, Obj::const_iterator> XR =
+                                                          X.equal_range(key);
+                const bsl::pair<GreaterObj::const_iterator,
+                                GreaterObj::const_iterator>
+                                                      YR = Y.equal_range(key);
+
+                Obj::const_iterator        it = XR.first;
+                GreaterObj::const_iterator jt = YR.first;
+                for (; XR.second != it && YR.second != jt; ++it, ++jt) {
+                    ASSERTV(key, it->second == jt->second);
+                }
+                ASSERTV(key, XR.second == it && YR.second == jt);
+            }
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // RANGE 'erase' AND 'clear'
+        //
+        // Concerns:
+        //: 1 Range 'erase' removes exactly the elements in the range, and
+        //:   returns an iterator referring to the element that 'last' referred
+        //:   to, for empty ranges, and ranges within a node, spanning several
+        //:   nodes, splitting a run of equivalent keys, or holding every
+        //:   element.
+        //:
+        //: 2 Range 'erase' does not allocate memory, and leaves the remaining
+        //:   elements having equivalent keys in their original order.
+        //:
+        //: 3 'clear' removes every element and frees every node, and the
+        //:   object can be used afterwards.
+        //
+        // Plan:
+        //: 1 Using a table of index ranges, erase each range from an object
+        //:   having three levels and two elements per key, and verify the
+        //:   returned iterator, the remaining elements, and that no memory is
+        //:   allocated.  (C-1..2)
+        //:
+        //: 2 Clear objects of several sizes, verify that they are empty and
+        //:   that no memory is in use, and insert elements again.  (C-3)
+        //
+        // Testing:
+        //   iterator erase(const_iterator first, const_iterator last);
+        //   void clear();
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nRANGE 'erase' AND 'clear'"
+                            "\n=========================\n");
+
+        bslma::TestAllocator oa("object",  veryVeryVerbose);
+        bslma::TestAllocator sa("scratch", veryVeryVerbose);
+
+        const int N = TWO_LEVELS + 1;
+
+        if (verbose) printf("\nTesting range 'erase'.\n");
+        {
+            const struct {
+                int d_line;   // source line number
+                int d_first;  // index of the first erased element
+                int d_last;   // index of the element after the range
+            } DATA[] = {
+                //LINE  FIRST                LAST
+                //----  -------------------  ------------------------
+                { L_,   0,                   0                        },
+                { L_,   0,                   1                        },
+                { L_,   1,                   2                        },
+                { L_,   1,                   MIN_VALUES               },
+                { L_,   0,                   MAX_VALUES - 1           },
+                { L_,   MAX_VALUES - 1,      MAX_VALUES + 1           },
+                { L_,   MAX_VALUES,          2 * MAX_VALUES + 1       },
+                { L_,   MIN_VALUES,          N - MIN_VALUES           },
+                { L_,   1,                   N - 1                    },
+                { L_,   0,                   N - 1                    },
+                { L_,   N - 1,               N                        },
+                { L_,   TWO_LEVELS / 2 + 1,  N                        },
+                { L_,   0,                   N                        },
+                { L_,   N,                   N                        },
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int LINE  = DATA[ti].d_line;
+                const int FIRST = DATA[ti].d_first;
+                const int LAST  = DATA[ti].d_last;
+
+                if (veryVerbose) { T_ P_(LINE) P_(FIRST) P(LAST) }
+
+                // The element at index 'i' has the key 'i / 2' and the mapped
+                // value 'i'.
+
+                Obj mX(&oa);  const Obj& X = mX;
+                for (int i = 0; i < N; ++i) {
+                    mX.insert(Obj::value_type(i / 2, i));
+                }
+
+                Obj::const_iterator first = X.begin();
+                for (int i = 0; i < FIRST; ++i) {
+                    ++first;
+                }
+                Obj::const_iterator last = first;
+                for (int i = FIRST; i < LAST; ++i) {
+                    ++last;
+                }
+
+                bslma::TestAllocatorMonitor oam(&oa);
+
+                const Obj::iterator R = mX.erase(first, last);
+                ASSERTV(LINE, oam.isTotalSame());
+                if (N == LAST) {
+                    ASSERTV(LINE, X.end() == R);
+                }
+                else {
+                    ASSERTV(LINE, LAST / 2 == R->first);
+                    ASSERTV(LINE, LAST     == R->second);
+                }
+
+                Keys keys(&sa);
+                for (int i = 0; i < N; ++i) {
+                    if (i < FIRST || LAST <= i) {
+                        keys.push_back(i / 2);
+                    }
+                }
+                ASSERTV(LINE, hasKeys(X, keys));
+                ASSERTV(LINE, isInInsertionOrder(X));
+                if (FIRST == LAST) {
+                    ASSERTV(LINE, oam.isInUseSame());
+                }
+            }
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+
+        if (verbose) printf("\nTesting 'clear'.\n");
+        {
+            const int SIZES[] = { 0, 1, MAX_VALUES, MAX_VALUES + 1, N };
+            const int NUM_SIZES = sizeof SIZES / sizeof *SIZES;
+
+            for (int ti = 0; ti < NUM_SIZES; ++ti) {
+                const int SIZE = SIZES[ti];
+
+                Obj mX(&oa);  const Obj& X = mX;
+                for (int i = 0; i < SIZE; ++i) {
+                    mX.insert(Obj::value_type(0, i));
+                }
+
+                mX.clear();
+                ASSERTV(SIZE, X.empty());
+                ASSERTV(SIZE, X.begin() == X.end());
+                ASSERTV(SIZE, 0 == oa.numBlocksInUse());
+
+                mX.clear();
+                ASSERTV(SIZE, X.empty());
+
+                for (int i = 0; i < SIZE; ++i) {
+                    mX.insert(Obj::value_type(SIZE - i, i));
+                }
+                ASSERTV(SIZE, SIZE == static_cast<int>(X.size()));
+                if (SIZE) {
+                    ASSERTV(SIZE, 1 == X.begin()->first);
+                }
+            }
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // 'erase' AND NODE MERGES
+        //
+        // Concerns:
+        //: 1 'erase' with a key removes every element having the key, if any,
+        //:   including runs of elements spanning several nodes, and returns
+        //:   the number of removed elements.
+        //:
+        //: 2 'erase' with an iterator removes only the element at the
+        //:   position, even if other elements have the same key, and returns
+        //:   an iterator referring to the following element, if any, and to
+        //:   the past-the-end position otherwise.
+        //:
+        //: 3 An erasure leaving a leaf holding fewer than 'MIN_VALUES'
+        //:   elements merges the leaf with a sibling, freeing a node, if they
+        //:   fit in one node, and otherwise moves elements from the sibling
+        //:   into the leaf, freeing no node; the returned iterator refers to
+        //:   the following element in either case.
+        //:
+        //: 4 A merge leaving an internal node holding too few elements merges
+        //:   that node in turn, and a root left without elements is freed,
+        //:   which removes a level from the tree.
+        //:
+        //: 5 Erasure leaves the remaining elements having equivalent keys in
+        //:   their original order.
+        //:
+        //: 6 Erasing every element of a tree having three levels, in any
+        //:   order, frees every node, and 'erase' never allocates memory.
+        //
+        // Plan:
+        //: 1 From an object built by appending 'MAX_VALUES + 1' elements
+        //:   having the same key, having a root and two leaves, the second of
+        //:   which holds one element, repeatedly erase the first element, and
+        //:   verify the returned iterator, the remaining elements, and that
+        //:   the three nodes remain in use until the first leaf holds fewer
+        //:   than 'MIN_VALUES' elements, whereupon the leaves are merged into
+        //:   one node.  (C-2..3, 5)
+        //:
+        //: 2 From an object built by appending 'MAX_VALUES + 2' elements, the
+        //:   second leaf of which holds two elements, erase the last key,
+        //:   leaving the second leaf with too few elements to merge, and
+        //:   verify that no node is freed.  Erase the new last key, and
+        //:   verify that the leaves are merged.  (C-1, 3)
+        //:
+        //: 3 Repeat P-2 with an object built by prepending elements, erasing
+        //:   the first element using an iterator.  (C-2..3)
+        //:
+        //: 4 From an object built by appending 'TWO_LEVELS + 1' elements,
+        //:   having three levels, erase the last element, and verify that a
+        //:   leaf, an internal node, and the root are freed.  (C-4)
+        //:
+        //: 5 From an object holding runs of 'MAX_VALUES + 1' elements for each
+        //:   of several keys, inserted in an interleaved order, erase the keys
+        //:   in the middle, at the start, and at the end, and verify the
+        //:   returned count, the remaining elements, and that no memory is
+        //:   allocated.  (C-1, 5)
+        //:
+        //: 6 Insert '4 * TWO_LEVELS' elements having four elements per key in
+        //:   a pseudo-random order, and erase them in another order,
+        //:   alternately by key and by erasing the first element having the
+        //:   key four times, verifying the returned values, periodically
+        //:   verifying the keys, and monitoring the object allocator.
+        //:   (C-1..2, 5..6)
+        //
+        // Testing:
+        //   iterator erase(const_iterator position);
+        //   size_type erase(const key_type& key);
+        //   CONCERN: Erasing merges a node with, or borrows from, a sibling
+        //   CONCERN: Erasing a key removes a run spanning several nodes
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\n'erase' AND NODE MERGES"
+                            "\n=======================\n");
+
+        bslma::TestAllocator oa("object",  veryVeryVerbose);
+        bslma::TestAllocator sa("scratch", veryVeryVerbose);
+
+        if (verbose) printf("\nMerging leaves.\n");
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+            for (int i = 0; i <= MAX_VALUES; ++i) {
+                mX.insert(Obj::value_type(0, i));
+            }
+            ASSERT(3 == oa.numBlocksInUse());
+
+            for (int i = 0; i <= MAX_VALUES; ++i) {
+                const Obj::iterator R = mX.erase(X.begin());
+                if (MAX_VALUES == i) {
+                    ASSERTV(i, X.end() == R);
+                }
+                else {
+                    ASSERTV(i, i + 1 == R->second);
+                    ASSERTV(i, X.begin() == R);
+                }
+
+                // After 'i + 1' erasures, the first leaf holds
+                // 'MAX_VALUES - 2 - i' elements.
+
+                const int EXP_NODES = MAX_VALUES == i                   ? 0
+                                    : MAX_VALUES - 2 - i >= MIN_VALUES  ? 3
+                                    :                                     1;
+                ASSERTV(i, EXP_NODES, oa.numBlocksInUse(),
+                        EXP_NODES == oa.numBlocksInUse());
+
+                ASSERTV(i, MAX_VALUES - i == static_cast<int>(X.count(0)));
+                ASSERTV(i, isInInsertionOrder(X));
+            }
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+
+        if (verbose) printf("\nBorrowing from the left sibling.\n");
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+            for (int i = 0; i <= MAX_VALUES + 1; ++i) {
+                mX.insert(Obj::value_type(i, i));
+            }
+            ASSERT(3 == oa.numBlocksInUse());
+
+            ASSERT(1 == mX.erase(MAX_VALUES + 1));
+            ASSERT(0 == mX.erase(MAX_VALUES + 1));
+            ASSERT(3 == oa.numBlocksInUse());
+
+            Keys keys(&sa);
+            appendKeys(&keys, 0, MAX_VALUES + 1);
+            ASSERT(hasKeys(X, keys));
+
+            ASSERT(1 == mX.erase(MAX_VALUES));
+            ASSERT(1 == oa.numBlocksInUse());
+
+            keys.pop_back();
+            ASSERT(hasKeys(X, keys));
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+
+        if (verbose) printf("\nBorrowing from the right sibling.\n");
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+            for (int i = 0; i <= MAX_VALUES + 1; ++i) {
+                mX.insert(Obj::value_type(-i, i));
+            }
+            ASSERT(3 == oa.numBlocksInUse());
+
+            Obj::iterator R = mX.erase(X.begin());
+            ASSERT(X.begin() == R);
+            ASSERT(-MAX_VALUES == R->first);
+            ASSERT(3 == oa.numBlocksInUse());
+
+            Keys keys(&sa);
+            appendKeys(&keys, -MAX_VALUES, 1);
+            ASSERT(hasKeys(X, keys));
+
+            R = mX.erase(R);
+            ASSERT(X.begin() == R);
+            ASSERT(1 - MAX_VALUES == R->first);
+            ASSERT(1 == oa.numBlocksInUse());
+
+            keys.erase(keys.begin());
+            ASSERT(hasKeys(X, keys));
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+
+        if (verbose) printf("\nMerging internal nodes.\n");
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+            for (int i = 0; i < TWO_LEVELS; ++i) {
+                mX.insert(Obj::value_type(i, i));
+            }
+            const bsls::Types::Int64 BLOCKS = oa.numBlocksInUse();
+
+            mX.insert(Obj::value_type(TWO_LEVELS, TWO_LEVELS));
+            ASSERT(BLOCKS + 3 == oa.numBlocksInUse());
+
+            ASSERT(X.end() == mX.erase(X.find(TWO_LEVELS)));
+            ASSERT(BLOCKS == oa.numBlocksInUse());
+
+            Keys keys(&sa);
+            appendKeys(&keys, 0, TWO_LEVELS);
+            ASSERT(hasKeys(X, keys));
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+
+        if (verbose) printf("\nErasing runs of equivalent keys.\n");
+        {
+            const int RUN      = MAX_VALUES + 1;
+            const int NUM_KEYS = 5;
+
+            Obj mX(&oa);  const Obj& X = mX;
+            for (int j = 0; j < RUN; ++j) {
+                for (int key = 0; key < NUM_KEYS; ++key) {
+                    mX.insert(Obj::value_type(key, j));
+                }
+            }
+
+            Keys keys(&sa);
+            appendKeys(&keys, 0, NUM_KEYS, RUN);
+            ASSERT(hasKeys(X, keys));
+
+            bslma::TestAllocatorMonitor oam(&oa);
+
+            const int ORDER[] = { 2, 0, NUM_KEYS - 1, 1, 3 };
+            for (int i = 0; i < NUM_KEYS; ++i) {
+                const int KEY = ORDER[i];
+
+                ASSERTV(KEY, RUN == static_cast<int>(mX.erase(KEY)));
+                ASSERTV(KEY, 0   == mX.erase(KEY));
+                ASSERTV(KEY, 0   == X.count(KEY));
+
+                keys.erase(native_std::lower_bound(keys.begin(),
+                                                   keys.end(),
+                                                   KEY),
+                           native_std::upper_bound(keys.begin(),
+                                                   keys.end(),
+                                                   KEY));
+                ASSERTV(KEY, hasKeys(X, keys));
+                ASSERTV(KEY, isInInsertionOrder(X));
+            }
+            ASSERT(X.empty());
+            ASSERT(oam.isTotalSame());
+            ASSERT(0 == oa.numBlocksInUse());
+        }
+
+        if (verbose) printf("\nErasing every element.\n");
+        {
+            const int NUM_KEYS = TWO_LEVELS;
+            const int N        = 4 * NUM_KEYS;
+
+            Obj mX(&oa);  const Obj& X = mX;
+            for (int i = 0; i < N; ++i) {
+                mX.insert(Obj::value_type((i * 7919) % N / 4, i));
+            }
+
+            Keys keys(&sa);
+            appendKeys(&keys, 0, NUM_KEYS, 4);
+            ASSERT(hasKeys(X, keys));
+            ASSERT(isInInsertionOrder(X));
+
+            bslma::TestAllocatorMonitor oam(&oa);
+
+            for (int i = 0; i < NUM_KEYS; ++i) {
+                const int KEY = (i * 4799) % NUM_KEYS;
+
+                const Keys::iterator position =
+                                 native_std::lower_bound(keys.begin(),
+                                                         keys.end(),
+                                                         KEY);
+                const Keys::iterator next = keys.erase(position,
+                                                       position + 4);
+
+                if (i % 2) {
+                    ASSERTV(KEY, 4 == mX.erase(KEY));
+                }
+                else {
+                    for (int j = 3; 0 <= j; --j) {
+                        const Obj::iterator R = mX.erase(X.find(KEY));
+                        if (0 < j) {
+                            ASSERTV(KEY, j, KEY == R->first);
+                            ASSERTV(KEY, j, X.find(KEY) == R);
+                        }
+                        else if (keys.end() == next) {
+                            ASSERTV(KEY, X.end() == R);
+                        }
+                        else {
+                            ASSERTV(KEY, *next == R->first);
+                        }
+                    }
+                }
+                ASSERTV(KEY, 0 == mX.erase(KEY));
+                ASSERTV(KEY, X.end() == X.find(KEY));
+                ASSERTV(KEY, keys.size() == X.size());
+
+                if (0 == i % 97) {
+                    ASSERTV(KEY, hasKeys(X, keys));
+                    ASSERTV(KEY, isInInsertionOrder(X));
+                }
+            }
+            ASSERT(X.empty());
+            ASSERT(oam.isTotalSame());
+            ASSERT(0 == oa.numBlocksInUse());
+        }
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // LOOKUP
+        //
+        // Concerns:
+        //: 1 'find' returns an iterator referring to the first element having
+        //:   the key, if any, and the past-the-end iterator otherwise, even
+        //:   when the elements having the key span several nodes.
+        //:
+        //: 2 'count' returns the number of elements having the key.
+        //:
+        //: 3 'lower_bound' returns the first element not ordered before the
+        //:   key, 'upper_bound' returns the first element ordered after the
+        //:   key, and 'equal_range' returns both, for keys before, between,
+        //:   at, and after the elements, and the range holds the elements
+        //:   having the key in insertion order.
+        //:
+        //: 4 The concerns hold for a comparator other than 'std::less', and
+        //:   for both the 'const' and non-'const' overloads.
+        //
+        // Plan:
+        //: 1 For several run lengths, from 1 up to more than twice
+        //:   'MAX_VALUES', insert runs of elements having each of the even
+        //:   keys in '[0 .. 2 * NUM_KEYS)', interleaving the keys, into an
+        //:   'Obj' and a 'GreaterObj'.  Look up each key in
+        //:   '[-2 .. 2 * NUM_KEYS]' using each method, verify the results,
+        //:   and verify the mapped values of the elements in each range
+        //:   returned by 'equal_range'.  (C-1..4)
+        //
+        // Testing:
+        //   iterator find(const key_type& key);
+        //   iterator lower_bound(const key_type& key);
+        //   iterator upper_bound(const key_type& key);
+        //   pair<iterator, iterator> equal_range(const key_type& key);
+        //   const_iterator find(const key_type& key) const;
+        //   size_type count(const key_type& key) const;
+        //   const_iterator lower_bound(const key_type& key) const;
+        //   const_iterator upper_bound(const key_type& key) const;
+        //   pair<const_iterator, const_iterator> equal_range(key) const;
+        //   CONCERN: Lookup finds runs of equivalent keys spanning nodes
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nLOOKUP"
+                            "\n======\n");
+
+        bslma::TestAllocator oa("object", veryVeryVerbose);
+
+        const int NUM_KEYS = 8;
+        const int LAST     = 2 * NUM_KEYS - 2;  // largest key
+
+        const int RUNS[] = { 1, 2, MAX_VALUES - 1, MAX_VALUES + 1,
+                             2 * MAX_VALUES + 3 };
+        const int NUM_RUNS = sizeof RUNS / sizeof *RUNS;
+
+        for (int ti = 0; ti < NUM_RUNS; ++ti) {
+            const int RUN = RUNS[ti];
+
+            if (veryVerbose) { T_ P(RUN) }
+
+            // The 'j'th element having each key has the mapped value 'j'.
+
+            Obj        mX(&oa);  const Obj&        X = mX;
+            GreaterObj mY(&oa);  const GreaterObj& Y = mY;
+            for (int j = 0; j < RUN; ++j) {
+                for (int i = 0; i < NUM_KEYS; ++i) {
+                    mX.insert(Obj::value_type(2 * i, j));
+                    mY.insert(GreaterObj::value_type(2 * i, j));
+                }
+            }
+
+            for (int key = -2; key <= 2 * NUM_KEYS; ++key) {
+                const bool FOUND = 0 == key % 2 && 0 <= key && key <= LAST;
+                const int  COUNT = FOUND ? RUN : 0;
+
+                ASSERTV(RUN, key, COUNT == static_cast<int>(X.count(key)));
+                ASSERTV(RUN, key, COUNT == static_cast<int>(Y.count(key)));
+
+                const Obj::iterator        F = mX.find(key);
+                const GreaterObj::iterator G = mY.find(key);
+                ASSERTV(RUN, key, F == X.find(key));
+                ASSERTV(RUN, key, G == Y.find(key));
+                if (FOUND) {
+                    ASSERTV(RUN, key, key == F->first && 0 == F->second);
+                    ASSERTV(RUN, key, key == G->first && 0 == G->second);
+                }
+                else {
+                    ASSERTV(RUN, key, X.end() == F);
+                    ASSERTV(RUN, key, Y.end() == G);
+                }
+
+                // Compute the keys of the first elements of the bounds, in
+                // 'X' and then in 'Y', where a key outside '[0 .. LAST]'
+                // denotes 'end()'.
+
+                const int XLB = key < 0 ? 0 : key + key % 2;
+                const int XUB = key < 0 ? 0 : key + 2 - key % 2;
+                const int YLB = key > LAST ? LAST : key - (key + 2) % 2;
+                const int YUB = key > LAST ? LAST : key - 2 + (key + 2) % 2;
+
+                const Obj::iterator XL = XLB > LAST ? mX.end()
+                                                    : mX.find(XLB);
+                const Obj::iterator XU = XUB > LAST ? mX.end()
+                                                    : mX.find(XUB);
+                const GreaterObj::iterator YL = YLB < 0 ? mY.end()
+                                                        : mY.find(YLB);
+                const GreaterObj::iterator YU = YUB < 0 ? mY.end()
+                                                        : mY.find(YUB);
+
+                ASSERTV(RUN, key, XL == mX.lower_bound(key));
+                ASSERTV(RUN, key, XL ==  X.lower_bound(key));
+                ASSERTV(RUN, key, XU == mX.upper_bound(key));
+                ASSERTV(RUN, key, XU ==  X.upper_bound(key));
+                ASSERTV(RUN, key, YL == mY.lower_bound(key));
+                ASSERTV(RUN, key, YL ==  Y.lower_bound(key));
+                ASSERTV(RUN, key, YU == mY.upper_bound(key));
+                ASSERTV(RUN, key, YU ==  Y.upper_bound(key));
+
+                const bsl::pair<Obj::iterator, Obj::iterator> XR =
+                                                         mX.equal_range(key);
+                const bsl::pair<Obj::const_iterator, Obj::const_iterator> XC =
+                                                          X.equal_range(key);
+                ASSERTV(RUN, key, XL == XR.first && XU == XR.second);
+                ASSERTV(RUN, key, XL == XC.first && XU == XC.second);
+
+                const bsl::pair<GreaterObj::iterator, GreaterObj::iterator>
+                                                     YR = mY.equal_range(key);
+                const bsl::pair<GreaterObj::const_iterator,
+                                GreaterObj::const_iterator>
+                                                      YC = Y.equal_range(key);
+                ASSERTV(RUN, key, YL == YR.first && YU == YR.second);
+                ASSERTV(RUN, key, YL == YC.first && YU == YC.second);
+
+                int j = 0;
+                for (Obj::iterator it = XR.first; XR.second != it; ++it) {
+                    ASSERTV(RUN, key, j, key == it->first && j == it->second);
+                    ++j;
+                }
+                ASSERTV(RUN, key, j, COUNT == j);
+
+                j = 0;
+                for (GreaterObj::iterator it = YR.first;
+                     YR.second != it;
+                     ++it) {
+                    ASSERTV(RUN, key, j, key == it->first && j == it->second);
+                    ++j;
+                }
+                ASSERTV(RUN, key, j, COUNT == j);
+            }
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // ITERATORS
+        //
+        // Concerns:
+        //: 1 Iterating from 'begin' to 'end', and from 'rbegin' to 'rend',
+        //:   visits every element once, in key order and in reverse key order,
+        //:   respectively, crossing the boundaries between nodes at every
+        //:   level of the tree.
+        //:
+        //: 2 'cbegin', 'cend', 'crbegin', and 'crend' return the same
+        //:   positions as 'begin', 'end', 'rbegin', and 'rend'.
+        //:
+        //: 3 An 'iterator' converts to a 'const_iterator' referring to the
+        //:   same element, and provides modifiable access to the mapped value.
+        //:
+        //: 4 Elements that are not bitwise-moveable, and are therefore held
+        //:   out of line, are not moved by inserting or erasing other
+        //:   elements, whether or not nodes are split or merged.
+        //
+        // Plan:
+        //: 1 For objects having three elements per key, of sizes at the
+        //:   boundaries of one, two, and three levels of nodes, iterate
+        //:   forward and backward using each pair of accessors, verifying the
+        //:   key of each element and the number of elements visited, and set
+        //:   each mapped value through an 'iterator'.  (C-1..3)
+        //:
+        //: 2 Insert '3 * TWO_LEVELS' elements having four elements per key in
+        //:   a pseudo-random order into an 'AllocObj', recording the address
+        //:   of each element.  Verify that the address and allocator of each
+        //:   element are unchanged after all the insertions, and again after
+        //:   erasing every other element.  (C-4)
+        //
+        // Testing:
+        //   iterator begin();
+        //   iterator end();
+        //   reverse_iterator rbegin();
+        //   reverse_iterator rend();
+        //   const_iterator begin() const;
+        //   const_iterator cbegin() const;
+        //   const_iterator end() const;
+        //   const_iterator cend() const;
+        //   const_reverse_iterator rbegin() const;
+        //   const_reverse_iterator crbegin() const;
+        //   const_reverse_iterator rend() const;
+        //   const_reverse_iterator crend() const;
+        //   CONCERN: Out-of-line elements are not moved by a split or merge
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nITERATORS"
+                            "\n=========\n");
+
+        bslma::TestAllocator oa("object",  veryVeryVerbose);
+        bslma::TestAllocator sa("scratch", veryVeryVerbose);
+
+        if (verbose) printf("\nTraversing objects.\n");
+        {
+            const int SIZES[] = { 0, 1, 2, MAX_VALUES, MAX_VALUES + 1,
+                                  2 * MAX_VALUES + 1, TWO_LEVELS,
+                                  TWO_LEVELS + 1, 3 * TWO_LEVELS };
+            const int NUM_SIZES = sizeof SIZES / sizeof *SIZES;
+
+            for (int ti = 0; ti < NUM_SIZES; ++ti) {
+                const int N = SIZES[ti];
+
+                if (veryVerbose) { T_ P(N) }
+
+                Obj mX(&oa);  const Obj& X = mX;
+                for (int i = 0; i < N; ++i) {
+                    mX.insert(Obj::value_type((i * 7919) % N / 3, 0));
+                }
+
+                ASSERTV(N, X.begin()  == mX.begin());
+                ASSERTV(N, X.begin()  == X.cbegin());
+                ASSERTV(N, X.end()    == mX.end());
+                ASSERTV(N, X.end()    == X.cend());
+                ASSERTV(N, X.rbegin() == mX.rbegin());
+                ASSERTV(N, X.rbegin() == X.crbegin());
+                ASSERTV(N, X.rend()   == mX.rend());
+                ASSERTV(N, X.rend()   == X.crend());
+                ASSERTV(N, (0 == N) == (X.begin() == X.end()));
+
+                int count = 0;
+                for (Obj::iterator it = mX.begin(); it != mX.end(); ++it) {
+                    ASSERTV(N, count, count / 3 == it->first);
+                    if (0 == count % 3) {
+                        ASSERTV(N, count,
+                                Obj::const_iterator(it) == X.find(count / 3));
+                    }
+                    it->second = count + 1;
+                    ++count;
+                }
+                ASSERTV(N, count, N == count);
+
+                count = 0;
+                for (Obj::const_iterator it = X.cbegin();
+                     it != X.cend();
+                     ++it) {
+                    ASSERTV(N, count, count + 1 == it->second);
+                    ++count;
+                }
+                ASSERTV(N, count, N == count);
+
+                count = N;
+                for (Obj::reverse_iterator it = mX.rbegin();
+                     it != mX.rend();
+                     ++it) {
+                    --count;
+                    ASSERTV(N, count, count / 3 == it->first);
+                    it->second = -count;
+                }
+                ASSERTV(N, count, 0 == count);
+
+                count = N;
+                for (Obj::const_reverse_iterator it = X.crbegin();
+                     it != X.crend();
+                     ++it) {
+                    --count;
+                    ASSERTV(N, count, -count == it->second);
+                }
+                ASSERTV(N, count, 0 == count);
+            }
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+
+        if (verbose) printf("\nTesting the stability of elements.\n");
+        {
+            const int N = 3 * TWO_LEVELS;
+
+            const bsltf::AllocTestType *addresses[N];
+
+            // The element inserted 'i'th holds the value 'i'.
+
+            AllocObj mX(&oa);  const AllocObj& X = mX;
+            for (int i = 0; i < N; ++i) {
+                const int KEY = (i * 7919) % N / 4;
+
+                const AllocObj::iterator R =
+                    mX.insert(AllocObj::value_type(
+                                             KEY,
+                                             bsltf::AllocTestType(i, &sa)));
+                addresses[i] = &R->second;
+            }
+
+            for (AllocObj::const_iterator it = X.begin();
+                 it != X.end();
+                 ++it) {
+                const int I = it->second.data();
+                ASSERTV(I, addresses[I] == &it->second);
+                ASSERTV(I, &oa == it->second.allocator());
+            }
+
+            for (AllocObj::iterator it = mX.begin(); it != mX.end(); ) {
+                if (it->second.data() % 2) {
+                    it = mX.erase(it);
+                }
+                else {
+                    ++it;
+                }
+            }
+            ASSERT(N / 2 == static_cast<int>(X.size()));
+
+            for (AllocObj::const_iterator it = X.begin();
+                 it != X.end();
+                 ++it) {
+                const int I = it->second.data();
+                ASSERTV(I, 0 == I % 2);
+                ASSERTV(I, addresses[I] == &it->second);
+            }
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+        ASSERT(0 == defaultAllocator.numBlocksInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // 'insert' AND NODE SPLITS
+        //
+        // Concerns:
+        //: 1 'insert' inserts the value after every element having an
+        //:   equivalent key, and returns an iterator referring to the new
+        //:   element.
+        //:
+        //: 2 Inserting into a full node splits the node, and the returned
+        //:   iterator refers to the inserted element, whether the element is
+        //:   prepended to, appended to, or inserted in the middle of the
+        //:   node, and whether or not an element of the node has an
+        //:   equivalent key.
+        //:
+        //: 3 A node split by appending (or prepending) an element remains
+        //:   full, so that appending (or prepending) a sequence of elements,
+        //:   including elements having the same key, allocates a new leaf
+        //:   only when the last (or first) leaf is full.
+        //:
+        //: 4 Splitting a node whose parent is full splits the parent, up to
+        //:   and including the root, which adds a level to the tree.
+        //:
+        //: 5 Elements having equivalent keys remain in insertion order when
+        //:   the nodes holding them are split.
+        //:
+        //: 6 No memory is leaked, and the default allocator is not used.
+        //
+        // Plan:
+        //: 1 Append 'TWO_LEVELS + 1' elements in increasing key order to an
+        //:   empty object, verifying after each insertion the returned
+        //:   iterator, the predecessor of the inserted element, and the number
+        //:   of nodes allocated, as computed by 'numNewNodes'.  Repeat,
+        //:   prepending elements in decreasing key order, and appending
+        //:   elements all having the same key.  (C-1, 3..5)
+        //:
+        //: 2 Using a table of positions, insert an element having the key of
+        //:   the element before the position into an object holding one full
+        //:   node of even keys, and verify that two nodes are allocated, the
+        //:   returned iterator, and the keys of the object.  Then insert
+        //:   another element having each key, and verify the elements again.
+        //:   (C-1..2, 5)
+        //:
+        //: 3 Insert '3 * TWO_LEVELS' elements having a few keys, in a
+        //:   pseudo-random order, so that each key has a run of elements
+        //:   spanning many nodes, verifying that each returned iterator refers
+        //:   to the last element having its key, and then the keys and order
+        //:   of the elements.  (C-1..2, 4..5)
+        //:
+        //: 4 Verify that no memory is in use by the object allocator at the
+        //:   end of the test, and that no memory was allocated by the default
+        //:   allocator.  (C-6)
+        //
+        // Testing:
+        //   iterator insert(const value_type& value);
+        //   CONCERN: Splitting a full node when appending, prepending, or not
+        //   CONCERN: Equivalent keys are kept in insertion order
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\n'insert' AND NODE SPLITS"
+                            "\n========================\n");
+
+        bslma::TestAllocator oa("object",  veryVeryVerbose);
+        bslma::TestAllocator sa("scratch", veryVeryVerbose);
+
+        if (verbose) printf("\nAppending and prepending elements.\n");
+
+        // Insert the keys '0', '1', '2', ..., then '0', '-1', '-2', ..., and
+        // then '0', '0', '0', ....
+
+        const int STEPS[] = { 1, -1, 0 };
+        const int NUM_STEPS = sizeof STEPS / sizeof *STEPS;
+
+        for (int ti = 0; ti < NUM_STEPS; ++ti) {
+            const int STEP = STEPS[ti];
+
+            Obj mX(&oa);  const Obj& X = mX;
+
+            for (int i = 0; i <= TWO_LEVELS; ++i) {
+                const int                KEY    = STEP * i;
+                const bsls::Types::Int64 BLOCKS = oa.numBlocksInUse();
+
+                const Obj::iterator R = mX.insert(Obj::value_type(KEY, i));
+                ASSERTV(STEP, i, KEY == R->first);
+                ASSERTV(STEP, i, i   == R->second);
+                ASSERTV(STEP, i, i + 1 == static_cast<int>(X.size()));
+                ASSERTV(STEP, i, numNewNodes(i),
+                        oa.numBlocksInUse() - BLOCKS,
+                        numNewNodes(i) == oa.numBlocksInUse() - BLOCKS);
+
+                Obj::const_iterator it = R;
+                if (0 <= STEP && 0 < i) {
+                    --it;
+                    ASSERTV(STEP, i, KEY - STEP == it->first);
+                    ASSERTV(STEP, i, i - 1      == it->second);
+                }
+                if (0 > STEP && 0 < i) {
+                    ++it;
+                    ASSERTV(STEP, i, KEY + 1 == it->first);
+                    ASSERTV(STEP, i, i - 1   == it->second);
+                }
+            }
+
+            Keys keys(&sa);
+            if (0 < STEP) {
+                appendKeys(&keys, 0, TWO_LEVELS + 1);
+            }
+            else if (0 > STEP) {
+                appendKeys(&keys, -TWO_LEVELS, 1);
+            }
+            else {
+                appendKeys(&keys, 0, 1, TWO_LEVELS + 1);
+            }
+            ASSERTV(STEP, hasKeys(X, keys));
+            ASSERTV(STEP, isInInsertionOrder(X));
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+
+        if (verbose) printf("\nSplitting a full node.\n");
+        {
+            const struct {
+                int d_line;      // source line number
+                int d_position;  // number of elements before the new one
+            } DATA[] = {
+                //LINE  POSITION
+                //----  --------------------
+                { L_,   1                    },
+                { L_,   2                    },
+                { L_,   MAX_VALUES / 2 - 1   },
+                { L_,   MAX_VALUES / 2       },
+                { L_,   MAX_VALUES / 2 + 1   },
+                { L_,   MAX_VALUES - 1       },
+                { L_,   MAX_VALUES           },
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int LINE     = DATA[ti].d_line;
+                const int POSITION = DATA[ti].d_position;
+                const int KEY      = 2 * (POSITION - 1);
+
+                if (veryVerbose) { T_ P_(LINE) P(POSITION) }
+
+                Obj mX(&oa);  const Obj& X = mX;
+
+                Keys keys(&sa);
+                for (int i = 0; i < MAX_VALUES; ++i) {
+                    mX.insert(Obj::value_type(2 * i, i));
+                    keys.push_back(2 * i);
+                }
+                ASSERTV(LINE, 1 == oa.numBlocksInUse());
+
+                // The new element follows the one having the same key.
+
+                const Obj::iterator R = mX.insert(Obj::value_type(KEY,
+                                                                  MAX_VALUES));
+                ASSERTV(LINE, KEY        == R->first);
+                ASSERTV(LINE, MAX_VALUES == R->second);
+                ASSERTV(LINE, 3          == oa.numBlocksInUse());
+
+                Obj::const_iterator it = R;
+                if (POSITION < MAX_VALUES) {
+                    ++it;
+                    ASSERTV(LINE, KEY + 2 == it->first);
+                }
+                it = R;
+                --it;
+                ASSERTV(LINE, KEY          == it->first);
+                ASSERTV(LINE, POSITION - 1 == it->second);
+
+                keys.insert(keys.begin() + POSITION, KEY);
+                ASSERTV(LINE, hasKeys(X, keys));
+                ASSERTV(LINE, isInInsertionOrder(X));
+
+                for (int i = 0; i < MAX_VALUES; ++i) {
+                    const int VALUE = MAX_VALUES + 1 + i;
+
+                    Obj::iterator S = mX.insert(Obj::value_type(2 * i, VALUE));
+                    ASSERTV(LINE, i, X.upper_bound(2 * i) == ++S);
+                }
+
+                keys.clear();
+                for (int i = 0; i < MAX_VALUES; ++i) {
+                    keys.insert(keys.end(), KEY == 2 * i ? 3 : 2, 2 * i);
+                }
+                ASSERTV(LINE, hasKeys(X, keys));
+                ASSERTV(LINE, isInInsertionOrder(X));
+            }
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+
+        if (verbose) printf("\nInserting runs of equivalent keys.\n");
+        {
+            const int N        = 3 * TWO_LEVELS;
+            const int NUM_KEYS = 7;
+
+            Obj mX(&oa);  const Obj& X = mX;
+
+            Keys keys(&sa);
+            for (int i = 0; i < N; ++i) {
+                const int KEY = (i * 7919) % NUM_KEYS;
+
+                Obj::iterator R = mX.insert(Obj::value_type(KEY, i));
+                ASSERTV(i, KEY == R->first);
+                ASSERTV(i, i   == R->second);
+                ASSERTV(i, X.upper_bound(KEY) == ++R);
+
+                keys.push_back(KEY);
+            }
+
+            native_std::sort(keys.begin(), keys.end());
+            ASSERT(hasKeys(X, keys));
+            ASSERT(isInInsertionOrder(X));
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create an object, insert enough elements, several per key, to
+        //:   fill several nodes, look them up, and iterate over them.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        //   explicit btree_multimap(const COMPARATOR&, const ALLOCATOR&);
+        //   explicit btree_multimap(const ALLOCATOR& basicAllocator);
+        //   ~btree_multimap();
+        //   iterator begin();
+        //   iterator end();
+        //   iterator find(const key_type& key);
+        //   const_iterator begin() const;
+        //   const_iterator end() const;
+        //   bool empty() const;
+        //   size_type size() const;
+        //   key_compare key_comp() const;
+        //   value_compare value_comp() const;
+        //   const_iterator find(const key_type& key) const;
+        //   size_type count(const key_type& key) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        bslma::TestAllocator oa("object", veryVeryVerbose);
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+            ASSERT(X.empty());
+            ASSERT(0 == X.size());
+            ASSERT(X.begin() == X.end());
+            ASSERT(X.end() == X.find(0));
+            ASSERT(0 == oa.numBlocksTotal());
+
+            for (int i = 0; i < 1000; ++i) {
+                const int key = (i * 7919) % 100;
+                ASSERT(key == mX.insert(Obj::value_type(key, i))->first);
+            }
+            ASSERT(1000 == X.size());
+            ASSERT(!X.empty());
+
+            int count = 0;
+            int last  = -1;
+            for (Obj::iterator it = mX.begin(); it != mX.end(); ++it) {
+                ASSERT(count / 10 == it->first);
+                ASSERT(10 == X.count(it->first));
+                if (count % 10) {
+                    ASSERT(last < it->second);  // insertion order
+                }
+                last = it->second;
+                ++count;
+            }
+            ASSERT(1000 == count);
+
+            Obj::iterator it = mX.find(25);
+            ASSERT(mX.begin() != it);
+            ASSERT(25 == it->first);
+            ASSERT(24 == (--it)->first);
+            ASSERT(X.end() == X.find(100));
+            ASSERT(0 == X.count(100));
+            ASSERT(X.key_comp()(1, 2));
+            ASSERT(X.value_comp()(Obj::value_type(1, 9),
+                                  Obj::value_type(2, 0)));
+
+            const Obj Y(std::less<int>(), &oa);
+            ASSERT(Y.empty());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
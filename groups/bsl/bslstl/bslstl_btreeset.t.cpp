@@ -0,0 +1,1511 @@
+// bslstl_btreeset.t.cpp                                              -*-C++-*-
+
+#include <bslstl_btreeset.h>
+
+#include <bslstl_btree.h>
+#include <bslstl_vector.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatormonitor.h>
+#include <bsls_bsltestutil.h>
+#include <bsls_nativestd.h>
+#include <bsls_types.h>
+
+#include <bsltf_alloctesttype.h>
+
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+
+using namespace BloombergLP;
+using namespace std;
+
+//=============================================================================
+//                             TEST PLAN
+//-----------------------------------------------------------------------------
+//                             Overview
+//                             --------
+// The component under test is a value-semantic container that forwards most
+// of its work to 'bslstl::BTree', which is tested in its own test driver.
+// Here we test each method of the standard 'set' interface in turn, paying
+// particular attention to the operations that restructure the tree: an
+// insertion into a full node splits the node (and possibly its ancestors),
+// and an erasure leaving a node less than half full merges the node with, or
+// borrows elements from, a sibling.  Since the elements of a 'btree_set<int>'
+// are held in the nodes, each node is one allocation, and we observe splits
+// and merges through the number of blocks in use by a test allocator, with
+// the node capacity taken from 'bslstl::BTree_NodeUtil'.  We use
+// 'bsltf::AllocTestType', which is not bitwise-moveable (so that the elements
+// are held out of line), to verify the propagation of the allocator of the
+// container to its elements, and that references to such elements remain
+// valid when nodes are split or merged.
+//-----------------------------------------------------------------------------
+// CREATORS
+// [ 1] explicit btree_set(const COMPARATOR&, const ALLOCATOR&);
+// [ 1] explicit btree_set(const ALLOCATOR& basicAllocator);
+// [ 8] btree_set(const btree_set& original);
+// [ 8] btree_set(const btree_set& original, basicAllocator);
+// [ 7] btree_set(INPUT_ITERATOR first, INPUT_ITERATOR last, ...);
+// [ 1] ~btree_set();
+//
+// MANIPULATORS
+// [ 8] btree_set& operator=(const btree_set& rhs);
+// [ 2] pair<iterator, bool> insert(const value_type& value);
+// [ 7] iterator insert(const_iterator hint, const value_type& value);
+// [ 7] void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+// [ 5] iterator erase(const_iterator position);
+// [ 5] size_type erase(const key_type& key);
+// [ 6] iterator erase(const_iterator first, const_iterator last);
+// [ 8] void swap(btree_set& other);
+// [ 6] void clear();
+//
+// ACCESSORS
+// [ 8] allocator_type get_allocator() const;
+// [ 3] const_iterator begin() const;
+// [ 3] const_iterator cbegin() const;
+// [ 3] const_iterator end() const;
+// [ 3] const_iterator cend() const;
+// [ 3] const_reverse_iterator rbegin() const;
+// [ 3] const_reverse_iterator crbegin() const;
+// [ 3] const_reverse_iterator rend() const;
+// [ 3] const_reverse_iterator crend() const;
+// [ 1] bool empty() const;
+// [ 1] size_type size() const;
+// [ 1] key_compare key_comp() const;
+// [ 1] value_compare value_comp() const;
+// [ 4] const_iterator find(const key_type& key) const;
+// [ 4] size_type count(const key_type& key) const;
+// [ 4] const_iterator lower_bound(const key_type& key) const;
+// [ 4] const_iterator upper_bound(const key_type& key) const;
+// [ 4] pair<const_iterator, const_iterator> equal_range(key) const;
+//
+// FREE OPERATORS
+// [ 8] bool operator==(const btree_set& lhs, const btree_set& rhs);
+// [ 8] bool operator!=(const btree_set& lhs, const btree_set& rhs);
+// [ 8] bool operator<(const btree_set& lhs, const btree_set& rhs);
+// [ 8] bool operator>(const btree_set& lhs, const btree_set& rhs);
+// [ 8] bool operator<=(const btree_set& lhs, const btree_set& rhs);
+// [ 8] bool operator>=(const btree_set& lhs, const btree_set& rhs);
+// [ 8] void swap(btree_set& a, btree_set& b);
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 2] CONCERN: Splitting a full node when appending, prepending, or not
+// [ 2] CONCERN: Splitting a full root adds a level to the tree
+// [ 3] CONCERN: Out-of-line elements are not moved by a split or merge
+// [ 5] CONCERN: Erasing merges a node with, or borrows from, a sibling
+// [ 9] USAGE EXAMPLE
+//-----------------------------------------------------------------------------
+
+//=============================================================================
+//                  STANDARD BDE ASSERT TEST MACRO
+//-----------------------------------------------------------------------------
+static int testStatus = 0;
+
+static void aSsErT(bool b, const char *s, int i) {
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+//=============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+struct AllocTestTypeLess {
+    // This 'struct' defines a comparator ordering 'bsltf::AllocTestType'
+    // objects by their values.
+
+    bool operator()(const bsltf::AllocTestType& lhs,
+                    const bsltf::AllocTestType& rhs) const
+        // Return 'true' if the value of the specified 'lhs' is less than that
+        // of the specified 'rhs', and 'false' otherwise.
+    {
+        return lhs.data() < rhs.data();
+    }
+};
+
+typedef bsl::btree_set<int>                                       Obj;
+typedef bsl::btree_set<int, std::greater<int> >                   GreaterObj;
+typedef bsl::btree_set<bsltf::AllocTestType, AllocTestTypeLess>   AllocObj;
+typedef bsl::vector<int>                                          Keys;
+
+const int MAX_VALUES = bslstl::BTree_NodeUtil<int>::k_MAX_VALUES;
+    // maximum number of elements in a node of an 'Obj'
+
+const int MIN_VALUES = bslstl::BTree_NodeUtil<int>::k_MIN_VALUES;
+    // fewest elements left in a non-root node of an 'Obj' by an erasure that
+    // does not rebalance the node
+
+const int TWO_LEVELS = MAX_VALUES * (MAX_VALUES + 1);
+    // number of elements of an 'Obj' built by appending elements in key
+    // order, above which the root of the tree is split for the second time
+
+namespace {
+
+int numNewNodes(int size)
+    // Return the number of nodes allocated by appending an element to an
+    // 'Obj' built by appending the specified 'size' elements in key order
+    // (see {'bslstl_btree'|Sequential Insertion}), or by prepending an
+    // element to an 'Obj' built by prepending 'size' elements in reverse key
+    // order.  The behavior is undefined unless 'size <= TWO_LEVELS'.
+{
+    return 0 == size               ? 1
+         : 0 != size % MAX_VALUES  ? 0
+         : MAX_VALUES == size      ? 2   // a new leaf and a new root
+         : TWO_LEVELS == size      ? 3   // and the root is split again
+         :                           1;  // a new leaf
+}
+
+template <class OBJ>
+bool hasKeys(const OBJ& object, const Keys& keys)
+    // Return 'true' if the keys of the elements of the specified 'object' are
+    // the specified 'keys', in order, both when iterating forward from
+    // 'begin' and backward from 'end', and 'false' otherwise.
+{
+    if (object.size() != keys.size()) {
+        return false;                                                 // RETURN
+    }
+    typename OBJ::const_iterator it = object.begin();
+    for (Keys::size_type i = 0; i < keys.size(); ++i, ++it) {
+        if (object.end() == it || keys[i] != *it) {
+            return false;                                             // RETURN
+        }
+    }
+    if (object.end() != it) {
+        return false;                                                 // RETURN
+    }
+    for (Keys::size_type i = keys.size(); 0 < i; --i) {
+        if (keys[i - 1] != *--it) {
+            return false;                                             // RETURN
+        }
+    }
+    return object.begin() == it;
+}
+
+void appendKeys(Keys *keys, int first, int last, int stride = 1)
+    // Append to the specified 'keys' the integers from the specified 'first'
+    // up to, but not including, the specified 'last', in increments of the
+    // optionally specified 'stride'.
+{
+    for (int key = first; key < last; key += stride) {
+        keys->push_back(key);
+    }
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+    bool verbose = argc > 2;
+    bool veryVerbose = argc > 3;
+    bool veryVeryVerbose = argc > 4;
+
+    (void)veryVerbose;
+    (void)veryVeryVerbose;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVerbose);
+    bslma::DefaultAllocatorGuard defaultAllocatorGuard(&defaultAllocator);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 9: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+///Usage
+///-----
+// This section illustrates intended usage of this component.
+//
+///Example 1: Screening Identifiers Against a Block List
+///- - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we must reject requests from any of a large, rarely changing, set of
+// blocked account identifiers.  Every request is screened, so lookups vastly
+// outnumber updates, and a 'btree_set' of 'int' keys is searched with few
+// cache misses and SIMD comparisons.
+//
+// First, we build the set of blocked accounts from a sorted list, which takes
+// linear time:
+//..
+    const int BLOCKED[] = { 1002, 1017, 2044, 3100, 3101, 5077, 9001 };
+    const int NUM_BLOCKED = sizeof BLOCKED / sizeof *BLOCKED;
+
+    bsl::btree_set<int> blocked(BLOCKED, BLOCKED + NUM_BLOCKED);
+    ASSERT(7 == blocked.size());
+//..
+// Then, we screen some requests:
+//..
+    ASSERT( blocked.count(2044));
+    ASSERT(!blocked.count(2045));
+    ASSERT(blocked.end() == blocked.find(1));
+//..
+// Next, we unblock an account, and block a new one:
+//..
+    ASSERT(1 == blocked.erase(3100));
+    ASSERT(blocked.insert(4000).second);
+    ASSERT(!blocked.count(3100));
+//..
+// Finally, we list the blocked accounts in a range, in order:
+//..
+    bsl::btree_set<int>::const_iterator it = blocked.lower_bound(3000);
+    ASSERT(3101 == *it);
+    ASSERT(4000 == *++it);
+    ASSERT(5077 == *++it);
+//..
+      } break;
+      case 8: {
+        // --------------------------------------------------------------------
+        // COPY, ASSIGNMENT, SWAP, AND COMPARISON
+        //
+        // Concerns:
+        //: 1 A copy compares equal to the original, and it and its elements
+        //:   use the supplied allocator, or the default allocator if none is
+        //:   supplied.
+        //:
+        //: 2 Assignment gives the target the value of the source, and retains
+        //:   the allocator of the target.
+        //:
+        //: 3 Member and free 'swap' exchange the values of two sets having
+        //:   the same allocator without allocating memory.
+        //:
+        //: 4 The relational operators order sets lexicographically.
+        //
+        // Plan:
+        //: 1 Using test allocators, create sets of 'bsltf::AllocTestType'
+        //:   having sizes at the boundaries of one, two, and three levels of
+        //:   nodes, copy, assign, and swap them, and verify the values,
+        //:   allocators, and allocations of the results.  (C-1..3)
+        //:
+        //: 2 Compare sets of integers that differ in their last element, or
+        //:   in their length, using each relational operator.  (C-4)
+        //
+        // Testing:
+        //   btree_set(const btree_set& original);
+        //   btree_set(const btree_set& original, basicAllocator);
+        //   btree_set& operator=(const btree_set& rhs);
+        //   void swap(btree_set& other);
+        //   allocator_type get_allocator() const;
+        //   bool operator==(const btree_set& lhs, const btree_set& rhs);
+        //   bool operator!=(const btree_set& lhs, const btree_set& rhs);
+        //   bool operator<(const btree_set& lhs, const btree_set& rhs);
+        //   bool operator>(const btree_set& lhs, const btree_set& rhs);
+        //   bool operator<=(const btree_set& lhs, const btree_set& rhs);
+        //   bool operator>=(const btree_set& lhs, const btree_set& rhs);
+        //   void swap(btree_set& a, btree_set& b);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCOPY, ASSIGNMENT, SWAP, AND COMPARISON"
+                            "\n======================================\n");
+
+        bslma::TestAllocator oa("object",  veryVeryVerbose);
+        bslma::TestAllocator za("other",   veryVeryVerbose);
+        bslma::TestAllocator sa("scratch", veryVeryVerbose);
+
+        const int SIZES[] = { 0, 1, 2, MAX_VALUES, MAX_VALUES + 1,
+                              TWO_LEVELS, TWO_LEVELS + 1 };
+        const int NUM_SIZES = sizeof SIZES / sizeof *SIZES;
+
+        for (int ti = 0; ti < NUM_SIZES; ++ti) {
+            const int N = SIZES[ti];
+
+            AllocObj mX(&oa);  const AllocObj& X = mX;
+            for (int i = 0; i < N; ++i) {
+                mX.insert(bsltf::AllocTestType(i, &sa));
+            }
+
+            {
+                AllocObj mY(X);  const AllocObj& Y = mY;
+                ASSERTV(N, X == Y);
+                ASSERTV(N, &defaultAllocator ==
+                                              Y.get_allocator().mechanism());
+            }
+            ASSERT(0 == defaultAllocator.numBlocksInUse());
+            {
+                AllocObj mY(X, &za);  const AllocObj& Y = mY;
+                ASSERTV(N, X == Y);
+                ASSERTV(N, &za == Y.get_allocator().mechanism());
+                for (AllocObj::const_iterator it = Y.begin();
+                     it != Y.end();
+                     ++it) {
+                    ASSERTV(N, &za == it->allocator());
+                }
+
+                if (N) {
+                    mY.erase(--Y.end());
+                    ASSERTV(N, X != Y);
+                }
+            }
+            {
+                AllocObj mY(&za);  const AllocObj& Y = mY;
+                mY.insert(bsltf::AllocTestType(N, &sa));
+                mY = X;
+                ASSERTV(N, X == Y);
+                ASSERTV(N, &za == Y.get_allocator().mechanism());
+            }
+            {
+                AllocObj mY(&oa);  const AllocObj& Y = mY;
+                mY.insert(bsltf::AllocTestType(N, &sa));
+                const AllocObj XX(X, &za);
+                const AllocObj YY(Y, &za);
+
+                bslma::TestAllocatorMonitor oam(&oa);
+                mY.swap(mX);
+                ASSERTV(N, XX == Y);
+                ASSERTV(N, YY == X);
+
+                swap(mX, mY);
+                ASSERTV(N, XX == X);
+                ASSERTV(N, YY == Y);
+                ASSERTV(N, oam.isTotalSame());
+            }
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+        ASSERT(0 == za.numBlocksInUse());
+        ASSERT(0 == defaultAllocator.numBlocksInUse());
+
+        if (verbose) printf("\nTesting relational operators.\n");
+        {
+            Obj mA(&oa);  const Obj& A = mA;
+            Obj mB(&oa);  const Obj& B = mB;
+            for (int i = 0; i < TWO_LEVELS; ++i) {
+                mA.insert(i);
+                mB.insert(i);
+            }
+            ASSERT(  A == B);
+            ASSERT(!(A <  B));
+            ASSERT(  A <= B);
+            ASSERT(!(A >  B));
+            ASSERT(  A >= B);
+
+            mB.erase(TWO_LEVELS - 1);
+            mB.insert(TWO_LEVELS);
+            ASSERT(  A != B);
+            ASSERT(  A <  B);
+            ASSERT(  A <= B);
+            ASSERT(!(A >  B));
+            ASSERT(!(A >= B));
+            ASSERT(  B >  A);
+
+            mB.insert(TWO_LEVELS - 1);
+            ASSERT(  A <  B);
+            ASSERT(  B >= A);
+        }
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // 'insert' WITH HINT, RANGE 'insert', AND RANGE CONSTRUCTOR
+        //
+        // Concerns:
+        //: 1 'insert' with a hint inserts an element if and only if no element
+        //:   having its key is present, and returns an iterator referring to
+        //:   the element having the key, whether the hint is correct or not.
+        //:
+        //: 2 Range 'insert' inserts each value that is not present, including
+        //:   values that are out of order or repeated in the range.
+        //:
+        //: 3 The range constructor creates a set holding the same elements as
+        //:   range 'insert', ordered by the supplied comparator, and using the
+        //:   supplied allocator.
+        //:
+        //: 4 No memory is leaked, and the default allocator is not used.
+        //
+        // Plan:
+        //: 1 Insert odd and even keys into an object holding even keys, with
+        //:   hints referring to the beginning, the end, the correct position,
+        //:   and an unrelated element, and verify the returned iterator, the
+        //:   size of the object, and its keys.  (C-1)
+        //:
+        //: 2 Insert an unsorted range of values having duplicates, and
+        //:   spanning many nodes, into an object holding some of the values,
+        //:   and verify the keys of the object.  (C-2)
+        //:
+        //: 3 Construct an 'Obj' and a 'GreaterObj' from the range of P-2, and
+        //:   verify their elements and allocator.  (C-3)
+        //:
+        //: 4 Verify that no memory is in use by the object allocator at the
+        //:   end of the test, and that no memory was allocated by the default
+        //:   allocator.  (C-4)
+        //
+        // Testing:
+        //   iterator insert(const_iterator hint, const value_type& value);
+        //   void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        //   btree_set(INPUT_ITERATOR first, INPUT_ITERATOR last, ...);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\n'insert' WITH HINT, RANGE 'insert', AND RANGE"
+                            " CONSTRUCTOR"
+                            "\n=============================================="
+                            "============\n");
+
+        bslma::TestAllocator oa("object",  veryVeryVerbose);
+        bslma::TestAllocator sa("scratch", veryVeryVerbose);
+
+        if (verbose) printf("\nTesting 'insert' with a hint.\n");
+        {
+            const int N = TWO_LEVELS;
+
+            Obj mX(&oa);  const Obj& X = mX;
+            for (int i = 0; i < N; ++i) {
+                mX.insert(2 * i);
+            }
+
+            for (int i = 0; i < 2 * N; ++i) {
+                const int KEY = (i * 7919) % (2 * N);
+
+                Obj::const_iterator hint;
+                switch (i % 4) {
+                  case 0: hint = X.begin();                          break;
+                  case 1: hint = X.end();                            break;
+                  case 2: hint = X.lower_bound(KEY);                 break;
+                  case 3: hint = X.find((KEY + N) / 2 / 2 * 2);      break;
+                }
+
+                const Obj::size_type SIZE = X.size();
+
+                const Obj::iterator R = mX.insert(hint, KEY);
+                ASSERTV(KEY, KEY == *R);
+                ASSERTV(KEY, R == X.find(KEY));
+                ASSERTV(KEY, SIZE + KEY % 2 == X.size());
+            }
+
+            Keys keys(&sa);
+            appendKeys(&keys, 0, 2 * N);
+            ASSERT(hasKeys(X, keys));
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+
+        if (verbose) printf("\nTesting range 'insert'.\n");
+
+        const int NUM_KEYS   = 2 * TWO_LEVELS;
+        const int NUM_VALUES = 3 * NUM_KEYS;
+
+        bsl::vector<int> values(&sa);
+        for (int i = 0; i < NUM_VALUES; ++i) {
+            values.push_back((i * 7919) % NUM_KEYS);
+        }
+
+        Keys keys(&sa);
+        appendKeys(&keys, 0, NUM_KEYS);
+
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+            for (int key = 0; key < NUM_KEYS; key += 3) {
+                mX.insert(key);
+            }
+
+            mX.insert(values.begin(), values.end());
+            ASSERT(hasKeys(X, keys));
+
+            const Obj::size_type SIZE = X.size();
+            mX.insert(values.begin(), values.begin());
+            ASSERT(SIZE == X.size());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+
+        if (verbose) printf("\nTesting the range constructor.\n");
+        {
+            const Obj X(values.begin(), values.end(), std::less<int>(), &oa);
+            ASSERT(hasKeys(X, keys));
+            ASSERT(&oa == X.get_allocator().mechanism());
+
+            const GreaterObj Y(values.begin(),
+                               values.end(),
+                               std::greater<int>(),
+                               &oa);
+            ASSERT(X.size() == Y.size());
+            ASSERT(&oa == Y.get_allocator().mechanism());
+
+            GreaterObj::const_reverse_iterator jt = Y.rbegin();
+            for (Obj::const_iterator it = X.begin(); it != X.end(); ++it) {
+                ASSERTV(*it, *it == *jt);
+                ++jt;
+            }
+            ASSERT(Y.rend() == jt);
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // RANGE 'erase' AND 'clear'
+        //
+        // Concerns:
+        //: 1 Range 'erase' removes exactly the elements in the range, and
+        //:   returns an iterator referring to the element that 'last' referred
+        //:   to, for empty ranges, and ranges within a node, spanning several
+        //:   nodes, or holding every element.
+        //:
+        //: 2 Range 'erase' does not allocate memory.
+        //:
+        //: 3 'clear' removes every element and frees every node, and the
+        //:   object can be used afterwards.
+        //
+        // Plan:
+        //: 1 Using a table of index ranges, erase each range from an object
+        //:   having three levels, and verify the returned iterator, the
+        //:   remaining keys, and that no memory is allocated.  (C-1..2)
+        //:
+        //: 2 Clear objects of several sizes, verify that they are empty and
+        //:   that no memory is in use, and insert elements again.  (C-3)
+        //
+        // Testing:
+        //   iterator erase(const_iterator first, const_iterator last);
+        //   void clear();
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nRANGE 'erase' AND 'clear'"
+                            "\n=========================\n");
+
+        bslma::TestAllocator oa("object",  veryVeryVerbose);
+        bslma::TestAllocator sa("scratch", veryVeryVerbose);
+
+        const int N = TWO_LEVELS + 1;
+
+        if (verbose) printf("\nTesting range 'erase'.\n");
+        {
+            const struct {
+                int d_line;   // source line number
+                int d_first;  // index of the first erased element
+                int d_last;   // index of the element after the range
+            } DATA[] = {
+                //LINE  FIRST                LAST
+                //----  -------------------  ------------------------
+                { L_,   0,                   0                        },
+                { L_,   0,                   1                        },
+                { L_,   1,                   MIN_VALUES               },
+                { L_,   0,                   MAX_VALUES - 1           },
+                { L_,   MAX_VALUES - 2,      MAX_VALUES + 1           },
+                { L_,   MAX_VALUES,          2 * MAX_VALUES           },
+                { L_,   MIN_VALUES,          N - MIN_VALUES           },
+                { L_,   1,                   N - 1                    },
+                { L_,   0,                   N - 1                    },
+                { L_,   N - 1,               N                        },
+                { L_,   TWO_LEVELS / 2,      N                        },
+                { L_,   0,                   N                        },
+                { L_,   N,                   N                        },
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int LINE  = DATA[ti].d_line;
+                const int FIRST = DATA[ti].d_first;
+                const int LAST  = DATA[ti].d_last;
+
+                if (veryVerbose) { T_ P_(LINE) P_(FIRST) P(LAST) }
+
+                Obj mX(&oa);  const Obj& X = mX;
+                for (int i = 0; i < N; ++i) {
+                    mX.insert(i);
+                }
+
+                Obj::const_iterator first = X.begin();
+                for (int i = 0; i < FIRST; ++i) {
+                    ++first;
+                }
+                Obj::const_iterator last = first;
+                for (int i = FIRST; i < LAST; ++i) {
+                    ++last;
+                }
+
+                bslma::TestAllocatorMonitor oam(&oa);
+
+                const Obj::iterator R = mX.erase(first, last);
+                ASSERTV(LINE, oam.isTotalSame());
+                if (N == LAST) {
+                    ASSERTV(LINE, X.end() == R);
+                }
+                else {
+                    ASSERTV(LINE, LAST == *R);
+                }
+
+                Keys keys(&sa);
+                appendKeys(&keys, 0, FIRST);
+                appendKeys(&keys, LAST, N);
+                ASSERTV(LINE, hasKeys(X, keys));
+                if (FIRST == LAST) {
+                    ASSERTV(LINE, oam.isInUseSame());
+                }
+            }
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+
+        if (verbose) printf("\nTesting 'clear'.\n");
+        {
+            const int SIZES[] = { 0, 1, MAX_VALUES, MAX_VALUES + 1, N };
+            const int NUM_SIZES = sizeof SIZES / sizeof *SIZES;
+
+            for (int ti = 0; ti < NUM_SIZES; ++ti) {
+                const int SIZE = SIZES[ti];
+
+                Obj mX(&oa);  const Obj& X = mX;
+                for (int i = 0; i < SIZE; ++i) {
+                    mX.insert(i);
+                }
+
+                mX.clear();
+                ASSERTV(SIZE, X.empty());
+                ASSERTV(SIZE, X.begin() == X.end());
+                ASSERTV(SIZE, 0 == oa.numBlocksInUse());
+
+                mX.clear();
+                ASSERTV(SIZE, X.empty());
+
+                for (int i = 0; i < SIZE; ++i) {
+                    mX.insert(SIZE - i);
+                }
+                ASSERTV(SIZE, SIZE == static_cast<int>(X.size()));
+                if (SIZE) {
+                    ASSERTV(SIZE, 1 == *X.begin());
+                }
+            }
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // 'erase' AND NODE MERGES
+        //
+        // Concerns:
+        //: 1 'erase' with a key removes the element having the key, if any,
+        //:   and returns the number of removed elements.
+        //:
+        //: 2 'erase' with an iterator removes the element at the position, and
+        //:   returns an iterator referring to the following element, if any,
+        //:   and to the past-the-end position otherwise.
+        //:
+        //: 3 An erasure leaving a leaf holding fewer than 'MIN_VALUES'
+        //:   elements merges the leaf with a sibling, freeing a node, if they
+        //:   fit in one node, and otherwise moves elements from the sibling
+        //:   into the leaf, freeing no node; the returned iterator refers to
+        //:   the following element in either case.
+        //:
+        //: 4 A merge leaving an internal node holding too few elements merges
+        //:   that node in turn, and a root left without elements is freed,
+        //:   which removes a level from the tree.
+        //:
+        //: 5 Erasing an element held by an internal node removes only that
+        //:   element.
+        //:
+        //: 6 Erasing every element of a tree having three levels, in any
+        //:   order, frees every node, and 'erase' never allocates memory.
+        //
+        // Plan:
+        //: 1 From an object built by appending 'MAX_VALUES + 1' elements,
+        //:   having a root and two leaves, the second of which holds one
+        //:   element, repeatedly erase the first element, and verify the
+        //:   returned iterator, the keys, and that the three nodes remain in
+        //:   use until the first leaf holds fewer than 'MIN_VALUES' elements,
+        //:   whereupon the leaves are merged into one node.  (C-2..3)
+        //:
+        //: 2 From an object built by appending 'MAX_VALUES + 2' elements, the
+        //:   second leaf of which holds two elements, erase the last key,
+        //:   leaving the second leaf with too few elements to merge, and
+        //:   verify that no node is freed.  Erase the new last key, and
+        //:   verify that the leaves are merged.  (C-1, 3)
+        //:
+        //: 3 Repeat P-2 with an object built by prepending elements, erasing
+        //:   the first element using an iterator.  (C-2..3)
+        //:
+        //: 4 From an object built by appending 'TWO_LEVELS + 1' elements,
+        //:   having three levels, erase the last element, and verify that a
+        //:   leaf, an internal node, and the root are freed.  (C-4)
+        //:
+        //: 5 Erase the element held by the root of an object having two
+        //:   levels, and verify the returned iterator and the keys.  (C-5)
+        //:
+        //: 6 Insert '3 * TWO_LEVELS' keys in a pseudo-random order, and
+        //:   erase them in another order, alternating between the two
+        //:   overloads, verifying the returned values, periodically verifying
+        //:   the keys, and monitoring the object allocator.  (C-1..2, 6)
+        //
+        // Testing:
+        //   iterator erase(const_iterator position);
+        //   size_type erase(const key_type& key);
+        //   CONCERN: Erasing merges a node with, or borrows from, a sibling
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\n'erase' AND NODE MERGES"
+                            "\n=======================\n");
+
+        bslma::TestAllocator oa("object",  veryVeryVerbose);
+        bslma::TestAllocator sa("scratch", veryVeryVerbose);
+
+        if (verbose) printf("\nMerging leaves.\n");
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+            for (int i = 0; i <= MAX_VALUES; ++i) {
+                mX.insert(i);
+            }
+            ASSERT(3 == oa.numBlocksInUse());
+
+            for (int i = 0; i <= MAX_VALUES; ++i) {
+                const Obj::iterator R = mX.erase(X.begin());
+                if (MAX_VALUES == i) {
+                    ASSERTV(i, X.end() == R);
+                }
+                else {
+                    ASSERTV(i, i + 1 == *R);
+                    ASSERTV(i, X.begin() == R);
+                }
+
+                // After 'i + 1' erasures, the first leaf holds
+                // 'MAX_VALUES - 2 - i' elements.
+
+                const int EXP_NODES = MAX_VALUES == i                   ? 0
+                                    : MAX_VALUES - 2 - i >= MIN_VALUES  ? 3
+                                    :                                     1;
+                ASSERTV(i, EXP_NODES, oa.numBlocksInUse(),
+                        EXP_NODES == oa.numBlocksInUse());
+
+                Keys keys(&sa);
+                appendKeys(&keys, i + 1, MAX_VALUES + 1);
+                ASSERTV(i, hasKeys(X, keys));
+            }
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+
+        if (verbose) printf("\nBorrowing from the left sibling.\n");
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+            for (int i = 0; i <= MAX_VALUES + 1; ++i) {
+                mX.insert(i);
+            }
+            ASSERT(3 == oa.numBlocksInUse());
+
+            ASSERT(1 == mX.erase(MAX_VALUES + 1));
+            ASSERT(0 == mX.erase(MAX_VALUES + 1));
+            ASSERT(3 == oa.numBlocksInUse());
+
+            Keys keys(&sa);
+            appendKeys(&keys, 0, MAX_VALUES + 1);
+            ASSERT(hasKeys(X, keys));
+
+            ASSERT(1 == mX.erase(MAX_VALUES));
+            ASSERT(1 == oa.numBlocksInUse());
+
+            keys.pop_back();
+            ASSERT(hasKeys(X, keys));
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+
+        if (verbose) printf("\nBorrowing from the right sibling.\n");
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+            for (int i = 0; i <= MAX_VALUES + 1; ++i) {
+                mX.insert(-i);
+            }
+            ASSERT(3 == oa.numBlocksInUse());
+
+            Obj::iterator R = mX.erase(X.begin());
+            ASSERT(X.begin() == R);
+            ASSERT(-MAX_VALUES == *R);
+            ASSERT(3 == oa.numBlocksInUse());
+
+            Keys keys(&sa);
+            appendKeys(&keys, -MAX_VALUES, 1);
+            ASSERT(hasKeys(X, keys));
+
+            R = mX.erase(R);
+            ASSERT(X.begin() == R);
+            ASSERT(1 - MAX_VALUES == *R);
+            ASSERT(1 == oa.numBlocksInUse());
+
+            keys.erase(keys.begin());
+            ASSERT(hasKeys(X, keys));
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+
+        if (verbose) printf("\nMerging internal nodes.\n");
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+            for (int i = 0; i < TWO_LEVELS; ++i) {
+                mX.insert(i);
+            }
+            const bsls::Types::Int64 BLOCKS = oa.numBlocksInUse();
+
+            mX.insert(TWO_LEVELS);
+            ASSERT(BLOCKS + 3 == oa.numBlocksInUse());
+
+            ASSERT(X.end() == mX.erase(X.find(TWO_LEVELS)));
+            ASSERT(BLOCKS == oa.numBlocksInUse());
+
+            Keys keys(&sa);
+            appendKeys(&keys, 0, TWO_LEVELS);
+            ASSERT(hasKeys(X, keys));
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+
+        if (verbose) printf("\nErasing an element of the root.\n");
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+            for (int i = 0; i <= MAX_VALUES; ++i) {
+                mX.insert(i);
+            }
+
+            // The root holds the last element of the full first leaf.
+
+            const Obj::iterator R = mX.erase(X.find(MAX_VALUES - 1));
+            ASSERT(MAX_VALUES == *R);
+
+            Keys keys(&sa);
+            appendKeys(&keys, 0, MAX_VALUES - 1);
+            keys.push_back(MAX_VALUES);
+            ASSERT(hasKeys(X, keys));
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+
+        if (verbose) printf("\nErasing every element.\n");
+        {
+            const int N = 3 * TWO_LEVELS;
+
+            Obj mX(&oa);  const Obj& X = mX;
+            for (int i = 0; i < N; ++i) {
+                mX.insert((i * 7919) % N);
+            }
+
+            Keys keys(&sa);
+            appendKeys(&keys, 0, N);
+
+            bslma::TestAllocatorMonitor oam(&oa);
+
+            for (int i = 0; i < N; ++i) {
+                const int KEY = (i * 4799) % N;
+
+                const Keys::iterator position =
+                                 native_std::lower_bound(keys.begin(),
+                                                         keys.end(),
+                                                         KEY);
+                const Keys::iterator next = keys.erase(position);
+
+                if (i % 2) {
+                    ASSERTV(KEY, 1 == mX.erase(KEY));
+                }
+                else {
+                    const Obj::iterator R = mX.erase(X.find(KEY));
+                    if (keys.end() == next) {
+                        ASSERTV(KEY, X.end() == R);
+                    }
+                    else {
+                        ASSERTV(KEY, *next == *R);
+                    }
+                }
+                ASSERTV(KEY, 0 == mX.erase(KEY));
+                ASSERTV(KEY, X.end() == X.find(KEY));
+                ASSERTV(KEY, keys.size() == X.size());
+
+                if (0 == i % 97) {
+                    ASSERTV(KEY, hasKeys(X, keys));
+                }
+            }
+            ASSERT(X.empty());
+            ASSERT(oam.isTotalSame());
+            ASSERT(0 == oa.numBlocksInUse());
+        }
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // LOOKUP
+        //
+        // Concerns:
+        //: 1 'find' returns an iterator referring to the element equal to the
+        //:   key, and 'count' returns 1, if there is one, and 'find' returns
+        //:   the past-the-end iterator, and 'count' 0, otherwise.
+        //:
+        //: 2 'lower_bound' returns the first element not ordered before the
+        //:   key, 'upper_bound' returns the first element ordered after the
+        //:   key, and 'equal_range' returns both, for keys before, between,
+        //:   at, and after the elements, including keys at node boundaries.
+        //:
+        //: 3 The concerns hold for a comparator other than 'std::less', for
+        //:   which the elements of a node are searched by binary search rather
+        //:   than by comparing several elements at once.
+        //
+        // Plan:
+        //: 1 In an empty object, and in objects holding the even keys in
+        //:   '[0 .. 2 * N)', for values of 'N' producing one, two, and three
+        //:   levels, look up each key in '[-2 .. 2 * N]' using each method,
+        //:   and verify the results.  (C-1..2)
+        //:
+        //: 2 Repeat P-1 for a 'GreaterObj'.  (C-3)
+        //
+        // Testing:
+        //   const_iterator find(const key_type& key) const;
+        //   size_type count(const key_type& key) const;
+        //   const_iterator lower_bound(const key_type& key) const;
+        //   const_iterator upper_bound(const key_type& key) const;
+        //   pair<const_iterator, const_iterator> equal_range(key) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nLOOKUP"
+                            "\n======\n");
+
+        bslma::TestAllocator oa("object", veryVeryVerbose);
+
+        const int SIZES[] = { 0, 1, MAX_VALUES, MAX_VALUES + 1,
+                              TWO_LEVELS, TWO_LEVELS + 1 };
+        const int NUM_SIZES = sizeof SIZES / sizeof *SIZES;
+
+        for (int ti = 0; ti < NUM_SIZES; ++ti) {
+            const int N    = SIZES[ti];
+            const int LAST = 2 * N - 2;  // largest key
+
+            if (veryVerbose) { T_ P(N) }
+
+            Obj        mX(&oa);  const Obj&        X = mX;
+            GreaterObj mY(&oa);  const GreaterObj& Y = mY;
+            for (int i = 0; i < N; ++i) {
+                mX.insert(2 * i);
+                mY.insert(2 * i);
+            }
+
+            for (int key = -2; key <= 2 * N; ++key) {
+                const bool FOUND = 0 == key % 2 && 0 <= key && key <= LAST;
+
+                ASSERTV(N, key, (FOUND ? 1u : 0u) == X.count(key));
+                ASSERTV(N, key, (FOUND ? 1u : 0u) == Y.count(key));
+
+                const Obj::const_iterator        F = X.find(key);
+                const GreaterObj::const_iterator G = Y.find(key);
+                if (FOUND) {
+                    ASSERTV(N, key, key == *F);
+                    ASSERTV(N, key, key == *G);
+                }
+                else {
+                    ASSERTV(N, key, X.end() == F);
+                    ASSERTV(N, key, Y.end() == G);
+                }
+
+                // Compute the expected bounds, in 'X' and then in 'Y', where a
+                // key outside '[0 .. LAST]' denotes 'end()'.
+
+                const int XLB = key < 0 ? 0 : key + key % 2;
+                const int XUB = key < 0 ? 0 : key + 2 - key % 2;
+                const int YLB = key > LAST ? LAST : key - (key + 2) % 2;
+                const int YUB = key > LAST ? LAST : key - 2 + (key + 2) % 2;
+
+                const Obj::const_iterator XL = XLB > LAST ? X.end()
+                                                          : X.find(XLB);
+                const Obj::const_iterator XU = XUB > LAST ? X.end()
+                                                          : X.find(XUB);
+                const GreaterObj::const_iterator YL = YLB < 0 ? Y.end()
+                                                              : Y.find(YLB);
+                const GreaterObj::const_iterator YU = YUB < 0 ? Y.end()
+                                                              : Y.find(YUB);
+
+                ASSERTV(N, key, XL == X.lower_bound(key));
+                ASSERTV(N, key, XU == X.upper_bound(key));
+                ASSERTV(N, key, YL == Y.lower_bound(key));
+                ASSERTV(N, key, YU == Y.upper_bound(key));
+
+                const bsl::pair<Obj::const_iterator, Obj::const_iterator> XR =
+                                                          X.equal_range(key);
+                ASSERTV(N, key, XL == XR.first && XU == XR.second);
+
+                const bsl::pair<GreaterObj::const_iterator,
+                                GreaterObj::const_iterator>
+                                                      YR = Y.equal_range(key);
+                ASSERTV(N, key, YL == YR.first && YU == YR.second);
+            }
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // ITERATORS
+        //
+        // Concerns:
+        //: 1 Iterating from 'begin' to 'end', and from 'rbegin' to 'rend',
+        //:   visits every element once, in key order and in reverse key order,
+        //:   respectively, crossing the boundaries between nodes at every
+        //:   level of the tree.
+        //:
+        //: 2 'cbegin', 'cend', 'crbegin', and 'crend' return the same
+        //:   positions as 'begin', 'end', 'rbegin', and 'rend'.
+        //:
+        //: 3 Elements that are not bitwise-moveable, and are therefore held
+        //:   out of line, are not moved by inserting or erasing other
+        //:   elements, whether or not nodes are split or merged.
+        //
+        // Plan:
+        //: 1 For objects of sizes at the boundaries of one, two, and three
+        //:   levels of nodes, iterate forward and backward using each pair of
+        //:   accessors, verifying each element and the number of elements
+        //:   visited.  (C-1..2)
+        //:
+        //: 2 Insert '3 * TWO_LEVELS' elements in a pseudo-random order into an
+        //:   'AllocObj', recording the address of each element.  Verify that
+        //:   the address and allocator of each element are unchanged after
+        //:   all the insertions, and again after erasing every other element.
+        //:   (C-3)
+        //
+        // Testing:
+        //   const_iterator begin() const;
+        //   const_iterator cbegin() const;
+        //   const_iterator end() const;
+        //   const_iterator cend() const;
+        //   const_reverse_iterator rbegin() const;
+        //   const_reverse_iterator crbegin() const;
+        //   const_reverse_iterator rend() const;
+        //   const_reverse_iterator crend() const;
+        //   CONCERN: Out-of-line elements are not moved by a split or merge
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nITERATORS"
+                            "\n=========\n");
+
+        bslma::TestAllocator oa("object",  veryVeryVerbose);
+        bslma::TestAllocator sa("scratch", veryVeryVerbose);
+
+        if (verbose) printf("\nTraversing objects.\n");
+        {
+            const int SIZES[] = { 0, 1, 2, MAX_VALUES, MAX_VALUES + 1,
+                                  2 * MAX_VALUES + 1, TWO_LEVELS,
+                                  TWO_LEVELS + 1, 3 * TWO_LEVELS };
+            const int NUM_SIZES = sizeof SIZES / sizeof *SIZES;
+
+            for (int ti = 0; ti < NUM_SIZES; ++ti) {
+                const int N = SIZES[ti];
+
+                if (veryVerbose) { T_ P(N) }
+
+                Obj mX(&oa);  const Obj& X = mX;
+                for (int i = 0; i < N; ++i) {
+                    mX.insert((i * 7919) % N);
+                }
+
+                ASSERTV(N, X.begin()  == X.cbegin());
+                ASSERTV(N, X.end()    == X.cend());
+                ASSERTV(N, X.rbegin() == X.crbegin());
+                ASSERTV(N, X.rend()   == X.crend());
+                ASSERTV(N, (0 == N) == (X.begin() == X.end()));
+
+                int count = 0;
+                for (Obj::const_iterator it = X.begin(); it != X.end(); ++it) {
+                    ASSERTV(N, count, count == *it);
+                    ASSERTV(N, count, it == X.find(count));
+                    ++count;
+                }
+                ASSERTV(N, count, N == count);
+
+                count = 0;
+                for (Obj::const_iterator it = X.cbegin();
+                     it != X.cend();
+                     ++it) {
+                    ASSERTV(N, count, count == *it);
+                    ++count;
+                }
+                ASSERTV(N, count, N == count);
+
+                count = N;
+                for (Obj::const_reverse_iterator it = X.rbegin();
+                     it != X.rend();
+                     ++it) {
+                    --count;
+                    ASSERTV(N, count, count == *it);
+                }
+                ASSERTV(N, count, 0 == count);
+
+                count = N;
+                for (Obj::const_reverse_iterator it = X.crbegin();
+                     it != X.crend();
+                     ++it) {
+                    --count;
+                    ASSERTV(N, count, count == *it);
+                }
+                ASSERTV(N, count, 0 == count);
+            }
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+
+        if (verbose) printf("\nTesting the stability of elements.\n");
+        {
+            const int N = 3 * TWO_LEVELS;
+
+            const bsltf::AllocTestType *addresses[N];
+
+            AllocObj mX(&oa);  const AllocObj& X = mX;
+            for (int i = 0; i < N; ++i) {
+                const int KEY = (i * 7919) % N;
+
+                const bsltf::AllocTestType VALUE(KEY, &sa);
+
+                const bsl::pair<AllocObj::iterator, bool> R = mX.insert(VALUE);
+                ASSERTV(KEY, R.second);
+                addresses[KEY] = &*R.first;
+            }
+
+            for (int key = 0; key < N; ++key) {
+                const AllocObj::const_iterator it =
+                                       X.find(bsltf::AllocTestType(key, &sa));
+                ASSERTV(key, addresses[key] == &*it);
+                ASSERTV(key, key == it->data());
+                ASSERTV(key, &oa == it->allocator());
+            }
+
+            for (int i = 0; i < N; ++i) {
+                const int KEY = (i * 4799) % N;
+                if (KEY % 2) {
+                    ASSERTV(KEY,
+                            1 == mX.erase(bsltf::AllocTestType(KEY, &sa)));
+                }
+            }
+            ASSERT(N / 2 == static_cast<int>(X.size()));
+
+            for (int key = 0; key < N; key += 2) {
+                const AllocObj::const_iterator it =
+                                       X.find(bsltf::AllocTestType(key, &sa));
+                ASSERTV(key, addresses[key] == &*it);
+                ASSERTV(key, key == it->data());
+            }
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // 'insert' AND NODE SPLITS
+        //
+        // Concerns:
+        //: 1 'insert' inserts an element if and only if no equal element is
+        //:   present, and returns an iterator referring to the element equal
+        //:   to the value, and whether an element was inserted.
+        //:
+        //: 2 Inserting into a full node splits the node, and the returned
+        //:   iterator refers to the inserted element, whether the element is
+        //:   prepended to, appended to, or inserted in the middle of the
+        //:   node.
+        //:
+        //: 3 A node split by appending (or prepending) an element remains
+        //:   full, so that appending (or prepending) a sequence of elements
+        //:   allocates a new leaf only when the last (or first) leaf is full.
+        //:
+        //: 4 Splitting a node whose parent is full splits the parent, up to
+        //:   and including the root, which adds a level to the tree.
+        //:
+        //: 5 Inserting a key that is present allocates no memory.
+        //:
+        //: 6 No memory is leaked, and the default allocator is not used.
+        //
+        // Plan:
+        //: 1 Append 'TWO_LEVELS + 1' elements in increasing key order to an
+        //:   empty object, verifying after each insertion the returned value,
+        //:   the predecessor of the inserted element, and the number of
+        //:   nodes allocated, as computed by 'numNewNodes'.  Then insert each
+        //:   key again, and verify that nothing is inserted or allocated.
+        //:   (C-1, 3..5)
+        //:
+        //: 2 Repeat P-1 prepending elements in decreasing key order.
+        //:   (C-1, 3..5)
+        //:
+        //: 3 Using a table of positions, insert an odd key at each position
+        //:   into an object holding one full node of even keys, and verify
+        //:   that two nodes are allocated, the returned iterator, and the
+        //:   keys of the object.  Then insert the remaining odd keys, and
+        //:   verify the keys again.  (C-1..2)
+        //:
+        //: 4 Insert '3 * TWO_LEVELS' keys in a pseudo-random order, verifying
+        //:   the returned iterator, and then the keys of the object.
+        //:   (C-1..2, 4)
+        //:
+        //: 5 Verify that no memory is in use by the object allocator at the
+        //:   end of the test, and that no memory was allocated by the default
+        //:   allocator.  (C-6)
+        //
+        // Testing:
+        //   pair<iterator, bool> insert(const value_type& value);
+        //   CONCERN: Splitting a full node when appending, prepending, or not
+        //   CONCERN: Splitting a full root adds a level to the tree
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\n'insert' AND NODE SPLITS"
+                            "\n========================\n");
+
+        bslma::TestAllocator oa("object",  veryVeryVerbose);
+        bslma::TestAllocator sa("scratch", veryVeryVerbose);
+
+        if (verbose) printf("\nAppending and prepending elements.\n");
+
+        for (int direction = 1; direction >= -1; direction -= 2) {
+            Obj mX(&oa);  const Obj& X = mX;
+
+            for (int i = 0; i <= TWO_LEVELS; ++i) {
+                const int                KEY    = direction * i;
+                const bsls::Types::Int64 BLOCKS = oa.numBlocksInUse();
+
+                const bsl::pair<Obj::iterator, bool> R = mX.insert(KEY);
+                ASSERTV(direction, i, R.second);
+                ASSERTV(direction, i, KEY == *R.first);
+                ASSERTV(direction, i, i + 1 == static_cast<int>(X.size()));
+                ASSERTV(direction, i, numNewNodes(i),
+                        oa.numBlocksInUse() - BLOCKS,
+                        numNewNodes(i) == oa.numBlocksInUse() - BLOCKS);
+
+                Obj::const_iterator it = R.first;
+                if (0 < direction && 0 < i) {
+                    ASSERTV(i, KEY - 1 == *--it);
+                }
+                if (0 > direction && 0 < i) {
+                    ASSERTV(i, KEY + 1 == *++it);
+                }
+            }
+
+            Keys keys(&sa);
+            if (0 < direction) {
+                appendKeys(&keys, 0, TWO_LEVELS + 1);
+            }
+            else {
+                appendKeys(&keys, -TWO_LEVELS, 1);
+            }
+            ASSERTV(direction, hasKeys(X, keys));
+
+            bslma::TestAllocatorMonitor oam(&oa);
+
+            for (int i = 0; i <= TWO_LEVELS; ++i) {
+                const int KEY = direction * i;
+
+                const bsl::pair<Obj::iterator, bool> R = mX.insert(KEY);
+                ASSERTV(direction, i, !R.second);
+                ASSERTV(direction, i, KEY == *R.first);
+            }
+            ASSERTV(direction, oam.isTotalSame());
+            ASSERTV(direction, hasKeys(X, keys));
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+
+        if (verbose) printf("\nSplitting a full node.\n");
+        {
+            const struct {
+                int d_line;      // source line number
+                int d_position;  // number of elements before the new one
+            } DATA[] = {
+                //LINE  POSITION
+                //----  --------------------
+                { L_,   0                    },
+                { L_,   1                    },
+                { L_,   MAX_VALUES / 2 - 1   },
+                { L_,   MAX_VALUES / 2       },
+                { L_,   MAX_VALUES / 2 + 1   },
+                { L_,   MAX_VALUES - 1       },
+                { L_,   MAX_VALUES           },
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int LINE     = DATA[ti].d_line;
+                const int POSITION = DATA[ti].d_position;
+                const int KEY      = 2 * POSITION - 1;
+
+                if (veryVerbose) { T_ P_(LINE) P(POSITION) }
+
+                Obj mX(&oa);  const Obj& X = mX;
+
+                Keys keys(&sa);
+                for (int i = 0; i < MAX_VALUES; ++i) {
+                    mX.insert(2 * i);
+                    keys.push_back(2 * i);
+                }
+                ASSERTV(LINE, 1 == oa.numBlocksInUse());
+
+                const bsl::pair<Obj::iterator, bool> R = mX.insert(KEY);
+                ASSERTV(LINE, R.second);
+                ASSERTV(LINE, KEY == *R.first);
+                ASSERTV(LINE, 3   == oa.numBlocksInUse());
+
+                Obj::const_iterator it = R.first;
+                if (POSITION < MAX_VALUES) {
+                    ASSERTV(LINE, KEY + 1 == *++it);
+                }
+                it = R.first;
+                if (0 < POSITION) {
+                    ASSERTV(LINE, KEY - 1 == *--it);
+                }
+
+                keys.insert(keys.begin() + POSITION, KEY);
+                ASSERTV(LINE, hasKeys(X, keys));
+
+                for (int key = -1; key < 2 * MAX_VALUES; key += 2) {
+                    const bsl::pair<Obj::iterator, bool> S = mX.insert(key);
+                    ASSERTV(LINE, key, (KEY != key) == S.second);
+                    ASSERTV(LINE, key, key == *S.first);
+                }
+
+                keys.clear();
+                appendKeys(&keys, -1, 2 * MAX_VALUES);
+                ASSERTV(LINE, hasKeys(X, keys));
+            }
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+
+        if (verbose) printf("\nInserting in a pseudo-random order.\n");
+        {
+            const int N = 3 * TWO_LEVELS;
+
+            Obj mX(&oa);  const Obj& X = mX;
+            for (int i = 0; i < N; ++i) {
+                const int KEY = (i * 7919) % N;
+
+                const bsl::pair<Obj::iterator, bool> R = mX.insert(KEY);
+                ASSERTV(KEY, R.second);
+                ASSERTV(KEY, KEY == *R.first);
+                ASSERTV(KEY, R.first == X.find(KEY));
+            }
+
+            Keys keys(&sa);
+            appendKeys(&keys, 0, N);
+            ASSERT(hasKeys(X, keys));
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create an object, insert enough elements to fill several nodes,
+        //:   look them up, and iterate over them.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        //   explicit btree_set(const COMPARATOR&, const ALLOCATOR&);
+        //   explicit btree_set(const ALLOCATOR& basicAllocator);
+        //   ~btree_set();
+        //   pair<iterator, bool> insert(const value_type& value);
+        //   const_iterator begin() const;
+        //   const_iterator end() const;
+        //   bool empty() const;
+        //   size_type size() const;
+        //   key_compare key_comp() const;
+        //   value_compare value_comp() const;
+        //   const_iterator find(const key_type& key) const;
+        //   size_type count(const key_type& key) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        bslma::TestAllocator oa("object", veryVeryVerbose);
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+            ASSERT(X.empty());
+            ASSERT(0 == X.size());
+            ASSERT(X.begin() == X.end());
+            ASSERT(X.end() == X.find(0));
+            ASSERT(0 == oa.numBlocksTotal());
+
+            for (int i = 0; i < 1000; ++i) {
+                const int key = (i * 7919) % 1000;
+                ASSERT( mX.insert(key).second);
+                ASSERT(!mX.insert(key).second);
+            }
+            ASSERT(1000 == X.size());
+            ASSERT(!X.empty());
+
+            int count = 0;
+            for (Obj::const_iterator it = X.begin(); it != X.end(); ++it) {
+                ASSERT(count == *it);
+                ASSERT(1 == X.count(*it));
+                ++count;
+            }
+            ASSERT(1000 == count);
+
+            ASSERT(250 == *X.find(250));
+            ASSERT(0   == X.count(1000));
+            ASSERT(X.key_comp()(1, 2));
+            ASSERT(X.value_comp()(1, 2));
+
+            const Obj Y(std::less<int>(), &oa);
+            ASSERT(Y.empty());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,202 @@
+// bslstl_cacheshashcodes.h                                           -*-C++-*-
+#ifndef INCLUDED_BSLSTL_CACHESHASHCODES
+#define INCLUDED_BSLSTL_CACHESHASHCODES
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a trait selecting hash tables that store hash codes.
+//
+//@CLASSES:
+//  bslstl::CachesHashCodes<HASHER>: trait detection metafunction
+//
+//@SEE_ALSO: bslstl_hashtable, bslalg_bidirectionalhashednode
+//
+//@DESCRIPTION: This component defines a meta-function,
+// 'bslstl::CachesHashCodes', that may be used to associate a hash functor type
+// with the cached-hash-code trait, and also to detect whether a hash functor
+// type has been associated with that trait.
+//
+// By default, 'bslstl::HashTable' (and so each of the unordered containers
+// implemented in terms of it) stores only the value of each element, and
+// calls its hasher again whenever it needs the hash code of an element that
+// is already in the table: for every element when the bucket array grows, and
+// for the element being erased on every 'erase'.  A hash table whose 'HASHER'
+// is associated with the 'CachesHashCodes' trait instead allocates each
+// element in a 'bslalg::BidirectionalHashedNode', which records the hash code
+// computed when the element was inserted.  Such a table:
+//
+//: o never calls the hasher when rehashing, or when removing or copying an
+//:   element, and
+//:
+//: o compares the stored hash code of each element in a bucket with the hash
+//:   code of the key being sought before calling the comparator, so that the
+//:   comparator is called (almost) only for an element that matches.
+//
+// The trait is worthwhile for keys that are expensive to hash or to compare
+// (e.g., long strings hashed with a cryptographic-strength algorithm), and
+// costs one additional 'native_std::size_t' per element.
+//
+// Like 'bslstl::UsesPowerOfTwoBuckets', this trait is a property of the
+// hasher, so that the choice of node type is made at compile time, and the
+// trait is not associated with any type by default, and never with a function
+// or reference type.
+//
+///Usage
+///-----
+// This section illustrates intended usage of this component.
+//
+///Example 1: Storing the Hash Codes of String Keys
+/// - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we maintain a large table keyed by long strings, and we find that
+// growing the table spends most of its time rehashing the keys.
+//
+// First, we define a hash functor for the keys, and associate it with the
+// 'CachesHashCodes' trait using the 'BSLMF_NESTED_TRAIT_DECLARATION' macro:
+//..
+//  struct CachingStringHash {
+//      // This 'struct' provides a hash functor for strings that requests that
+//      // hash tables store the hash code of each element.
+//
+//      // TRAITS
+//      BSLMF_NESTED_TRAIT_DECLARATION(CachingStringHash,
+//                                     bslstl::CachesHashCodes);
+//
+//      // ACCESSORS
+//      native_std::size_t operator()(const char *value) const
+//          // Return a hash code for the specified null-terminated 'value'.
+//      {
+//          native_std::size_t result = 0;
+//          while (*value) {
+//              result = result * 31 + static_cast<unsigned char>(*value++);
+//          }
+//          return result;
+//      }
+//  };
+//..
+// Then, we verify that the trait is detected for 'CachingStringHash', but not
+// for the default 'bsl::hash<int>':
+//..
+//  assert(true  == bslstl::CachesHashCodes<CachingStringHash>::value);
+//  assert(false == bslstl::CachesHashCodes<bsl::hash<int> >::value);
+//..
+// Finally, we note that a
+// 'bsl::unordered_map<const char *, int, CachingStringHash>' will now call
+// 'CachingStringHash' only once for each inserted element (and once for each
+// key looked up), however often the map is rehashed.
+
+#ifndef INCLUDED_BSLSCM_VERSION
+#include <bslscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_DETECTNESTEDTRAIT
+#include <bslmf_detectnestedtrait.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_INTEGRALCONSTANT
+#include <bslmf_integralconstant.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_ISFUNCTION
+#include <bslmf_isfunction.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_ISREFERENCE
+#include <bslmf_isreference.h>
+#endif
+
+namespace BloombergLP {
+
+namespace bslstl {
+
+                          // =====================
+                          // class CachesHashCodes
+                          // =====================
+
+template <class HASHER>
+struct CachesHashCodes;
+
+template <class HASHER, bool CANNOT_NEST_TRAITS>
+struct CachesHashCodes_Imp {
+    // This 'struct' provides the trait value for the specified 'HASHER' type
+    // if the specified 'CANNOT_NEST_TRAITS' is 'true', i.e., for function and
+    // reference types, which cannot declare nested traits.
+
+    typedef bsl::false_type Type;
+};
+
+template <class HASHER>
+struct CachesHashCodes_Imp<HASHER, false> {
+    // This partial specialization provides the trait value for the specified
+    // 'HASHER' type if it may declare nested traits.
+
+    typedef typename bslmf::DetectNestedTrait<HASHER, CachesHashCodes>::type
+                                                                          Type;
+};
+
+template <class HASHER>
+struct CachesHashCodes
+    : CachesHashCodes_Imp<HASHER,
+                          bsl::is_function<HASHER>::value
+                       || bsl::is_reference<HASHER>::value>::Type
+{
+    // This metafunction is derived from 'true_type' if hash tables using the
+    // specified 'HASHER' functor should store the hash code of each element
+    // alongside that element, and from 'false_type' otherwise.  Note that
+    // this trait must be explicitly associated with a type, either using the
+    // 'BSLMF_NESTED_TRAIT_DECLARATION' macro or by specializing this template.
+};
+
+template <class HASHER>
+struct CachesHashCodes<const HASHER>
+    : CachesHashCodes<HASHER>::type
+{
+    // Specialization that associates the same trait with 'const HASHER' as
+    // with unqualified 'HASHER'.
+};
+
+template <class HASHER>
+struct CachesHashCodes<volatile HASHER>
+    : CachesHashCodes<HASHER>::type
+{
+    // Specialization that associates the same trait with 'volatile HASHER' as
+    // with unqualified 'HASHER'.
+};
+
+template <class HASHER>
+struct CachesHashCodes<const volatile HASHER>
+    : CachesHashCodes<HASHER>::type
+{
+    // Specialization that associates the same trait with
+    // 'const volatile HASHER' as with unqualified 'HASHER'.
+};
+
+}  // close package namespace
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,280 @@
+// bslstl_cacheshashcodes.t.cpp                                       -*-C++-*-
+
+#include <bslstl_cacheshashcodes.h>
+
+#include <bslstl_hash.h>
+
+#include <bslmf_assert.h>
+#include <bslmf_nestedtraitdeclaration.h>
+#include <bsls_bsltestutil.h>
+#include <bsls_nativestd.h>
+
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+
+using namespace BloombergLP;
+using namespace std;
+
+//=============================================================================
+//                             TEST PLAN
+//-----------------------------------------------------------------------------
+//                             Overview
+//                             --------
+// The component provides a meta-function for associating the cached-hash-code
+// trait with a hash functor type, and for detecting whether that trait is
+// associated with a type.  We verify that the trait is detected for types
+// declaring it as a nested trait and for types specializing the template, is
+// propagated through cv-qualification, and is not detected for unrelated
+// types, including function and reference types (which cannot declare nested
+// traits).
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 2] USAGE EXAMPLE
+//-----------------------------------------------------------------------------
+
+//=============================================================================
+//                  STANDARD BDE ASSERT TEST MACRO
+//-----------------------------------------------------------------------------
+static int testStatus = 0;
+
+static void aSsErT(bool b, const char *s, int i) {
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+//=============================================================================
+//                              USAGE EXAMPLE
+//-----------------------------------------------------------------------------
+
+///Usage
+///-----
+// This section illustrates intended usage of this component.
+//
+///Example 1: Storing the Hash Codes of String Keys
+/// - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we maintain a large table keyed by long strings, and we find that
+// growing the table spends most of its time rehashing the keys.
+//
+// First, we define a hash functor for the keys, and associate it with the
+// 'CachesHashCodes' trait using the 'BSLMF_NESTED_TRAIT_DECLARATION' macro:
+//..
+    struct CachingStringHash {
+        // This 'struct' provides a hash functor for strings that requests that
+        // hash tables store the hash code of each element.
+
+        // TRAITS
+        BSLMF_NESTED_TRAIT_DECLARATION(CachingStringHash,
+                                       bslstl::CachesHashCodes);
+
+        // ACCESSORS
+        native_std::size_t operator()(const char *value) const
+            // Return a hash code for the specified null-terminated 'value'.
+        {
+            native_std::size_t result = 0;
+            while (*value) {
+                result = result * 31 + static_cast<unsigned char>(*value++);
+            }
+            return result;
+        }
+    };
+//..
+
+//=============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+namespace {
+
+struct PlainHash {
+    // Hash functor that is not associated with the trait.
+
+    native_std::size_t operator()(int value) const
+        // Return the specified 'value' as a hash code.
+    {
+        return value;
+    }
+};
+
+struct SpecializedHash {
+    // Hash functor that is associated with the trait by specialization.
+
+    native_std::size_t operator()(int value) const
+        // Return the specified 'value' as a hash code.
+    {
+        return value;
+    }
+};
+
+struct ConvertibleToAny {
+    // Type that can be converted to any type.  'DetectNestedTrait' shouldn't
+    // assign it any traits.
+
+    template <class TYPE>
+    operator TYPE() const { return TYPE(); }
+        // Return a default constructed object of 'TYPE'.
+};
+
+typedef native_std::size_t HashFunction(int);
+
+}  // close unnamed namespace
+
+namespace BloombergLP {
+namespace bslstl {
+
+template <>
+struct CachesHashCodes<SpecializedHash> : bsl::true_type {};
+
+}  // close package namespace
+}  // close enterprise namespace
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+    bool verbose = argc > 2;
+    bool veryVerbose = argc > 3;
+    bool veryVeryVerbose = argc > 4;
+
+    (void)veryVerbose;
+    (void)veryVeryVerbose;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 2: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   The usage example provided in the component header file must
+        //   compile, link, and run on all platforms as shown.
+        //
+        // Plan:
+        //   Incorporate usage example from header into driver, remove leading
+        //   comment characters, and replace 'assert' with 'ASSERT'.
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+// Then, we verify that the trait is detected for 'CachingStringHash', but not
+// for the default 'bsl::hash<int>':
+//..
+    ASSERT(true  == bslstl::CachesHashCodes<CachingStringHash>::value);
+    ASSERT(false == bslstl::CachesHashCodes<bsl::hash<int> >::value);
+//..
+// Finally, we note that a
+// 'bsl::unordered_map<const char *, int, CachingStringHash>' will now call
+// 'CachingStringHash' only once for each inserted element (and once for each
+// key looked up), however often the map is rehashed.
+
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //
+        // Concerns:
+        //: 1 The trait is detected for types declaring it as a nested trait,
+        //:   and for types specializing 'CachesHashCodes'.
+        //:
+        //: 2 The trait is detected for cv-qualified versions of such types.
+        //:
+        //: 3 The trait is not detected for other types, including function,
+        //:   pointer-to-function, and reference types.
+        //:
+        //: 4 The trait can be tested at compile-time.
+        //
+        // Plan:
+        //: 1 Test the trait for a representative set of types.  (C-1..4)
+        //
+        // Testing:
+        //  BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        BSLMF_ASSERT( bslstl::CachesHashCodes<CachingStringHash>::value);
+        BSLMF_ASSERT(!bslstl::CachesHashCodes<PlainHash>::value);
+
+        ASSERT( bslstl::CachesHashCodes<CachingStringHash>::value);
+        ASSERT( bslstl::CachesHashCodes<const CachingStringHash>::value);
+        ASSERT( bslstl::CachesHashCodes<volatile CachingStringHash>::value);
+        ASSERT( bslstl::CachesHashCodes<
+                                    const volatile CachingStringHash>::value);
+
+        ASSERT( bslstl::CachesHashCodes<SpecializedHash>::value);
+        ASSERT( bslstl::CachesHashCodes<const SpecializedHash>::value);
+
+        ASSERT(!bslstl::CachesHashCodes<PlainHash>::value);
+        ASSERT(!bslstl::CachesHashCodes<const PlainHash>::value);
+        ASSERT(!bslstl::CachesHashCodes<ConvertibleToAny>::value);
+        ASSERT(!bslstl::CachesHashCodes<int>::value);
+
+        ASSERT(!bslstl::CachesHashCodes<HashFunction>::value);
+        ASSERT(!bslstl::CachesHashCodes<HashFunction *>::value);
+        ASSERT(!bslstl::CachesHashCodes<HashFunction&>::value);
+        ASSERT(!bslstl::CachesHashCodes<CachingStringHash&>::value);
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
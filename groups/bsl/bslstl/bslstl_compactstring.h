@@ -0,0 +1,1024 @@
+// bslstl_compactstring.h                                             -*-C++-*-
+#ifndef INCLUDED_BSLSTL_COMPACTSTRING
+#define INCLUDED_BSLSTL_COMPACTSTRING
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a compact string with a configurable inline capacity.
+//
+//@CLASSES:
+//  bslstl::CompactString: 'char' string storing short values in its footprint
+//
+//@SEE_ALSO: bslstl_string
+//
+//@DESCRIPTION: This component provides a class template,
+// 'bslstl::CompactString', implementing a string of 'char' that is optimized
+// for the short values (identifiers, symbols, codes) that dominate the keys
+// of many associative containers.  'CompactString' offers the subset of the
+// 'bsl::string' interface needed to build and compare such values, and is
+// parameterized by the number of characters, 'INLINE_CAPACITY', that it can
+// hold without allocating memory.
+//
+///Layout
+///------
+// 'bsl::string' keeps a short-string buffer, a length, and a capacity side by
+// side, so that (on 64-bit platforms) a 'bsl::string' occupies 48 bytes
+// including its allocator, of which only 23 may hold characters.
+// 'CompactString' instead overlays the two representations of a string in a
+// single region of '3 * sizeof(void *)' bytes (or more, as required by
+// 'INLINE_CAPACITY'):
+//..
+//  long:  [ data pointer | length     | capacity       (tag bit set) ]
+//  short: [ characters ...                     ... | remaining (tag clear) ]
+//..
+// The last byte of the region distinguishes the two.  In the long
+// representation, the high bit of that byte (which is part of the capacity) is
+// set.  In the short representation, that byte holds the number of unused
+// characters, 'INLINE_CAPACITY - length()', which is 0 -- and so doubles as
+// the null terminator -- when the short string is full.  Every byte of the
+// region is therefore available to a short string: on 64-bit platforms,
+// 'CompactString<>' holds up to 23 characters inline in an object of 32 bytes
+// (including the allocator), and 'CompactString<31>' holds up to 31
+// characters in 40 bytes.
+//
+// The value of 'INLINE_CAPACITY' is rounded up so that the region is a whole
+// number of words; the actual inline capacity is reported by the 'capacity'
+// of an empty string.  The behavior is undefined unless the rounded inline
+// capacity is less than 128.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Storing Security Identifiers
+///- - - - - - - - - - - - - - - - - - - -
+// Suppose we store security identifiers, most of which are shorter than 32
+// characters, and want to avoid allocating memory for each of them.
+//
+// First, we create a default 'CompactString', whose identifier fits inline:
+//..
+//  bslma::TestAllocator ta;
+//
+//  bslstl::CompactString<> ticker("IBM US Equity", &ta);
+//
+//  assert(13 == ticker.length());
+//  assert(ticker.isInline());
+//  assert(0  == ta.numBlocksTotal());
+//..
+// Then, we observe that a longer identifier does not fit, and is stored in
+// allocated memory:
+//..
+//  bslstl::CompactString<> option("AAPL US 01/17/25 C150 Equity", &ta);
+//
+//  assert(28 == option.length());
+//  assert(!option.isInline());
+//  assert(1  == ta.numBlocksTotal());
+//..
+// Next, we choose a larger inline capacity suited to our identifiers:
+//..
+//  bslstl::CompactString<31> wideOption("AAPL US 01/17/25 C150 Equity", &ta);
+//
+//  assert(wideOption.isInline());
+//  assert(1 == ta.numBlocksTotal());
+//..
+// Finally, we verify that the two strings have the same value:
+//..
+//  assert(0 == native_std::strcmp(option.c_str(), wideOption.c_str()));
+//..
+
+// Prevent 'bslstl' headers from being included directly in 'BSL_OVERRIDES_STD'
+// mode.  Doing so is unsupported, and is likely to cause compilation errors.
+#if defined(BSL_OVERRIDES_STD) && !defined(BSL_STDHDRS_PROLOGUE_IN_EFFECT)
+#error "include <bsl_string.h> instead of <bslstl_compactstring.h> in \
+BSL_OVERRIDES_STD mode"
+#endif
+
+#ifndef INCLUDED_BSLSCM_VERSION
+#include <bslscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_STDEXCEPTUTIL
+#include <bslstl_stdexceptutil.h>
+#endif
+
+#ifndef INCLUDED_BSLH_HASH
+#include <bslh_hash.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_ALLOCATOR
+#include <bslma_allocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_DEFAULT
+#include <bslma_default.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_USESBSLMAALLOCATOR
+#include <bslma_usesbslmaallocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_ASSERT
+#include <bslmf_assert.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_ISBITWISEMOVEABLE
+#include <bslmf_isbitwisemoveable.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_NESTEDTRAITDECLARATION
+#include <bslmf_nestedtraitdeclaration.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_BSLS_NATIVESTD
+#include <bsls_nativestd.h>
+#endif
+
+#ifndef INCLUDED_BSLS_PLATFORM
+#include <bsls_platform.h>
+#endif
+
+#ifndef INCLUDED_CSTDDEF
+#include <cstddef>
+#define INCLUDED_CSTDDEF
+#endif
+
+#ifndef INCLUDED_CSTRING
+#include <cstring>
+#define INCLUDED_CSTRING
+#endif
+
+namespace BloombergLP {
+
+namespace bslstl {
+
+                        // ===================
+                        // class CompactString
+                        // ===================
+
+template <int INLINE_CAPACITY = 3 * sizeof(void *) - 1>
+class CompactString {
+    // This class template implements a value-semantic string of 'char' that
+    // stores strings of up to (at least) 'INLINE_CAPACITY' characters within
+    // its footprint, and longer strings in memory obtained from the allocator
+    // supplied at construction.  The stored string is always null-terminated.
+
+  public:
+    // TYPES
+    typedef char                value_type;
+    typedef native_std::size_t  size_type;
+    typedef char               *iterator;
+    typedef const char         *const_iterator;
+
+  private:
+    // PRIVATE TYPES
+    enum {
+        k_WORD_BYTES     = sizeof(size_type),
+
+        k_MIN_REP_BYTES  = 3 * k_WORD_BYTES,
+                                    // pointer, length, and capacity
+
+        k_NEED_BYTES     = (INLINE_CAPACITY + k_WORD_BYTES)
+                                                     & ~(k_WORD_BYTES - 1),
+                                    // 'INLINE_CAPACITY + 1' rounded up to a
+                                    // whole number of words
+
+        k_REP_BYTES      = k_NEED_BYTES < k_MIN_REP_BYTES
+                         ? k_MIN_REP_BYTES
+                         : k_NEED_BYTES,
+
+        k_REP_WORDS      = k_REP_BYTES / k_WORD_BYTES,
+
+        k_SHORT_CAPACITY = k_REP_BYTES - 1,
+                                    // characters that fit inline (the last
+                                    // byte holds the unused count)
+
+        k_LONG_TAG       = 0x80     // bit of the last byte set in the long
+                                    // representation
+    };
+
+    BSLMF_ASSERT(0 <= INLINE_CAPACITY);
+    BSLMF_ASSERT(k_SHORT_CAPACITY < k_LONG_TAG);
+    BSLMF_ASSERT(sizeof(char *) == sizeof(size_type));
+
+    struct Long {
+        // This 'struct' describes the leading words of the long
+        // representation; the capacity occupies the last word of the region.
+
+        char      *d_data_p;  // allocated buffer (owned)
+        size_type  d_length;  // length of the string
+    };
+
+    union Rep {
+        // This 'union' overlays the long and short representations of a
+        // string.
+
+        Long      d_long;                // long representation
+        size_type d_words[k_REP_WORDS];  // word access (and alignment)
+        char      d_bytes[k_REP_BYTES];  // short representation
+    };
+
+    // DATA
+    Rep               d_rep;          // representation of the string
+    bslma::Allocator *d_allocator_p;  // memory allocator (held, not owned)
+
+    // PRIVATE CLASS METHODS
+    static size_type encodeCapacity(size_type capacity);
+        // Return the value of the last word of the long representation of a
+        // string having the specified 'capacity'.
+
+    static size_type decodeCapacity(size_type word);
+        // Return the capacity of a string whose long representation has the
+        // specified 'word' as its last word.
+
+    // PRIVATE MANIPULATORS
+    char *allocateBuffer(size_type capacity);
+        // Return the address of a newly allocated buffer able to hold a
+        // string of the specified 'capacity' and its null terminator.
+
+    char *initialize(size_type length);
+        // Set this uninitialized object to represent a string of the
+        // specified 'length', allocating memory only if 'length' exceeds the
+        // inline capacity, and return the address of its first character.
+        // The characters of the string are uninitialized, except for the null
+        // terminator.  Throw 'std::length_error' if 'length > max_size()'.
+
+    void setLength(size_type length);
+        // Set the length of this string to the specified 'length', and write
+        // the null terminator.  The behavior is undefined unless
+        // 'length <= capacity()'.
+
+    void setLongRep(char *buffer, size_type length, size_type capacity);
+        // Set this object to the long representation of a string having the
+        // specified 'length' and 'capacity' stored in the specified 'buffer',
+        // and write the null terminator.  Note that the previous buffer, if
+        // any, is not released.
+
+    void reallocate(size_type newCapacity,
+                    const char *suffix,
+                    size_type   suffixLength);
+        // Move this string to a newly allocated buffer of the specified
+        // 'newCapacity', appending the specified 'suffixLength' characters at
+        // the specified 'suffix'.  'suffix' may refer to this string.  The
+        // behavior is undefined unless
+        // 'length() + suffixLength <= newCapacity'.
+
+    // PRIVATE ACCESSORS
+    size_type grownCapacity(size_type newLength) const;
+        // Return the capacity to allocate for a string growing to the
+        // specified 'newLength' characters, which exceeds 'capacity()'.  The
+        // capacity grows geometrically so that repeated appending takes
+        // amortized constant time per character.  Throw 'std::length_error'
+        // if 'newLength > max_size()'.
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(CompactString,
+                                   bslma::UsesBslmaAllocator);
+    BSLMF_NESTED_TRAIT_DECLARATION(CompactString,
+                                   bslmf::IsBitwiseMoveable);
+        // The short representation holds no address of the object itself, so
+        // 'CompactString' is bitwise-moveable.
+
+    // CREATORS
+    explicit CompactString(bslma::Allocator *basicAllocator = 0);
+        // Create an empty string.  Optionally specify a 'basicAllocator' used
+        // to supply memory.  If 'basicAllocator' is 0, the currently
+        // installed default allocator is used.
+
+    CompactString(const char       *string,
+                  bslma::Allocator *basicAllocator = 0);         // IMPLICIT
+        // Create a string having the value of the specified null-terminated
+        // 'string'.  Optionally specify a 'basicAllocator' used to supply
+        // memory.  If 'basicAllocator' is 0, the currently installed default
+        // allocator is used.
+
+    CompactString(const char       *string,
+                  size_type         length,
+                  bslma::Allocator *basicAllocator = 0);
+        // Create a string having the value of the specified 'length'
+        // characters at the specified 'string'.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.  Throw
+        // 'std::length_error' if 'length > max_size()'.
+
+    CompactString(const CompactString&  original,
+                  bslma::Allocator     *basicAllocator = 0);
+        // Create a string having the value of the specified 'original'
+        // string.  Optionally specify a 'basicAllocator' used to supply
+        // memory.  If 'basicAllocator' is 0, the currently installed default
+        // allocator is used.  Note that the capacity of the new string is the
+        // larger of its length and the inline capacity.
+
+    ~CompactString();
+        // Destroy this object.
+
+    // MANIPULATORS
+    CompactString& operator=(const CompactString& rhs);
+        // Assign to this object the value of the specified 'rhs' string, and
+        // return a reference providing modifiable access to this object.
+
+    CompactString& operator=(const char *rhs);
+        // Assign to this object the value of the specified null-terminated
+        // 'rhs' string, and return a reference providing modifiable access to
+        // this object.
+
+    CompactString& assign(const char *string, size_type length);
+        // Assign to this object the value of the specified 'length'
+        // characters at the specified 'string', and return a reference
+        // providing modifiable access to this object.  'string' may refer to
+        // this object.  Throw 'std::length_error' if 'length > max_size()'.
+
+    CompactString& append(const char *string, size_type length);
+        // Append the specified 'length' characters at the specified 'string'
+        // to this string, and return a reference providing modifiable access
+        // to this object.  'string' may refer to this object.  Throw
+        // 'std::length_error' if 'length() + length > max_size()'.
+
+    void push_back(char character);
+        // Append the specified 'character' to this string.
+
+    void clear();
+        // Set the length of this string to 0.  Note that the capacity is not
+        // reduced.
+
+    void reserve(size_type newCapacity);
+        // Ensure that this string can hold at least the specified
+        // 'newCapacity' characters without reallocating.  Throw
+        // 'std::length_error' if 'newCapacity > max_size()'.
+
+    void resize(size_type newLength, char character = char());
+        // Set the length of this string to the specified 'newLength',
+        // truncating the string or appending copies of the optionally
+        // specified 'character' as needed.  Throw 'std::length_error' if
+        // 'newLength > max_size()'.
+
+    void swap(CompactString& other);
+        // Efficiently exchange the value of this object with the value of the
+        // specified 'other' object.  This method provides the no-throw
+        // exception-safety guarantee.  The behavior is undefined unless this
+        // object was created with the same allocator as 'other'.
+
+    char& operator[](size_type position);
+        // Return a reference providing modifiable access to the character at
+        // the specified 'position' in this string.  The behavior is undefined
+        // unless 'position < length()'.
+
+    iterator begin();
+        // Return an iterator referring to the first character of this string.
+
+    iterator end();
+        // Return an iterator referring one past the last character of this
+        // string.
+
+    char *data();
+        // Return the address of the modifiable, null-terminated characters of
+        // this string.  The behavior is undefined if the null terminator is
+        // modified.
+
+    // ACCESSORS
+    const char& operator[](size_type position) const;
+        // Return a reference providing non-modifiable access to the character
+        // at the specified 'position' in this string.  The behavior is
+        // undefined unless 'position <= length()'.
+
+    const_iterator begin() const;
+        // Return an iterator referring to the first character of this string.
+
+    const_iterator end() const;
+        // Return an iterator referring one past the last character of this
+        // string.
+
+    const char *c_str() const;
+    const char *data() const;
+        // Return the address of the non-modifiable, null-terminated characters
+        // of this string.
+
+    size_type length() const;
+    size_type size() const;
+        // Return the number of characters in this string.
+
+    bool empty() const;
+        // Return 'true' if this string has length 0, and 'false' otherwise.
+
+    size_type capacity() const;
+        // Return the number of characters this string can hold without
+        // reallocating.
+
+    size_type max_size() const;
+        // Return the maximum length of a string of this type.
+
+    bool isInline() const;
+        // Return 'true' if the characters of this string are stored within
+        // the footprint of this object, and 'false' if they are stored in
+        // allocated memory.
+
+    bslma::Allocator *allocator() const;
+        // Return the allocator used by this object to supply memory.
+};
+
+// FREE OPERATORS
+template <int INLINE_CAPACITY>
+bool operator==(const CompactString<INLINE_CAPACITY>& lhs,
+                const CompactString<INLINE_CAPACITY>& rhs);
+template <int INLINE_CAPACITY>
+bool operator==(const CompactString<INLINE_CAPACITY>& lhs, const char *rhs);
+template <int INLINE_CAPACITY>
+bool operator==(const char *lhs, const CompactString<INLINE_CAPACITY>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' strings have the same
+    // value, and 'false' otherwise.  Two strings have the same value if they
+    // have the same length and the same character at each position.
+
+template <int INLINE_CAPACITY>
+bool operator!=(const CompactString<INLINE_CAPACITY>& lhs,
+                const CompactString<INLINE_CAPACITY>& rhs);
+template <int INLINE_CAPACITY>
+bool operator!=(const CompactString<INLINE_CAPACITY>& lhs, const char *rhs);
+template <int INLINE_CAPACITY>
+bool operator!=(const char *lhs, const CompactString<INLINE_CAPACITY>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' strings do not have the
+    // same value, and 'false' otherwise.
+
+template <int INLINE_CAPACITY>
+bool operator<(const CompactString<INLINE_CAPACITY>& lhs,
+               const CompactString<INLINE_CAPACITY>& rhs);
+    // Return 'true' if the specified 'lhs' string lexicographically precedes
+    // the specified 'rhs' string, comparing characters as 'unsigned char'
+    // (as does 'char_traits<char>::compare'), and 'false' otherwise.
+
+// FREE FUNCTIONS
+template <int INLINE_CAPACITY>
+void swap(CompactString<INLINE_CAPACITY>& a,
+          CompactString<INLINE_CAPACITY>& b);
+    // Exchange the values of the specified 'a' and 'b' strings.  The behavior
+    // is undefined unless 'a' and 'b' were created with the same allocator.
+
+template <class HASHALG, int INLINE_CAPACITY>
+void hashAppend(HASHALG&                              hashAlg,
+                const CompactString<INLINE_CAPACITY>& input);
+    // Pass the specified 'input' string to the specified 'hashAlg' exactly
+    // as 'hashAppend' passes a 'bsl::string' having the same value, so that
+    // 'bslh::Hash<>' yields the same hash value for both.
+
+// ============================================================================
+//                  INLINE AND TEMPLATE FUNCTION DEFINITIONS
+// ============================================================================
+
+                        // -------------------
+                        // class CompactString
+                        // -------------------
+
+// PRIVATE CLASS METHODS
+template <int INLINE_CAPACITY>
+inline
+typename CompactString<INLINE_CAPACITY>::size_type
+CompactString<INLINE_CAPACITY>::encodeCapacity(size_type capacity)
+{
+#if defined(BSLS_PLATFORM_IS_LITTLE_ENDIAN)
+    // The last byte of the region is the most significant byte of the word.
+
+    return capacity | (static_cast<size_type>(k_LONG_TAG)
+                                               << 8 * (k_WORD_BYTES - 1));
+#else
+    // The last byte of the region is the least significant byte of the word.
+
+    return capacity << 8 | k_LONG_TAG;
+#endif
+}
+
+template <int INLINE_CAPACITY>
+inline
+typename CompactString<INLINE_CAPACITY>::size_type
+CompactString<INLINE_CAPACITY>::decodeCapacity(size_type word)
+{
+#if defined(BSLS_PLATFORM_IS_LITTLE_ENDIAN)
+    return word & ~(static_cast<size_type>(k_LONG_TAG)
+                                               << 8 * (k_WORD_BYTES - 1));
+#else
+    return word >> 8;
+#endif
+}
+
+// PRIVATE MANIPULATORS
+template <int INLINE_CAPACITY>
+inline
+char *CompactString<INLINE_CAPACITY>::allocateBuffer(size_type capacity)
+{
+    return static_cast<char *>(d_allocator_p->allocate(capacity + 1));
+}
+
+template <int INLINE_CAPACITY>
+char *CompactString<INLINE_CAPACITY>::initialize(size_type length)
+{
+    if (length <= k_SHORT_CAPACITY) {
+        d_rep.d_bytes[k_SHORT_CAPACITY] =
+                                static_cast<char>(k_SHORT_CAPACITY - length);
+        d_rep.d_bytes[length] = 0;
+        return d_rep.d_bytes;                                         // RETURN
+    }
+    if (length > max_size()) {
+        StdExceptUtil::throwLengthError("CompactString: length > max_size");
+    }
+    setLongRep(allocateBuffer(length), length, length);
+    return d_rep.d_long.d_data_p;
+}
+
+template <int INLINE_CAPACITY>
+inline
+void CompactString<INLINE_CAPACITY>::setLength(size_type length)
+{
+    BSLS_ASSERT_SAFE(length <= capacity());
+
+    if (isInline()) {
+        d_rep.d_bytes[k_SHORT_CAPACITY] =
+                                static_cast<char>(k_SHORT_CAPACITY - length);
+        d_rep.d_bytes[length] = 0;
+    }
+    else {
+        d_rep.d_long.d_length           = length;
+        d_rep.d_long.d_data_p[length]   = 0;
+    }
+}
+
+template <int INLINE_CAPACITY>
+inline
+void CompactString<INLINE_CAPACITY>::setLongRep(char      *buffer,
+                                                size_type  length,
+                                                size_type  capacity)
+{
+    d_rep.d_long.d_data_p           = buffer;
+    d_rep.d_long.d_length           = length;
+    d_rep.d_words[k_REP_WORDS - 1]  = encodeCapacity(capacity);
+    buffer[length]                  = 0;
+}
+
+template <int INLINE_CAPACITY>
+void CompactString<INLINE_CAPACITY>::reallocate(size_type   newCapacity,
+                                                const char *suffix,
+                                                size_type   suffixLength)
+{
+    const size_type oldLength = length();
+
+    BSLS_ASSERT_SAFE(oldLength + suffixLength <= newCapacity);
+
+    char *buffer = allocateBuffer(newCapacity);
+    native_std::memcpy(buffer, data(), oldLength);
+    native_std::memcpy(buffer + oldLength, suffix, suffixLength);
+
+    // The old buffer is released only now, as 'suffix' may refer to it.
+
+    if (!isInline()) {
+        d_allocator_p->deallocate(d_rep.d_long.d_data_p);
+    }
+    setLongRep(buffer, oldLength + suffixLength, newCapacity);
+}
+
+// PRIVATE ACCESSORS
+template <int INLINE_CAPACITY>
+typename CompactString<INLINE_CAPACITY>::size_type
+CompactString<INLINE_CAPACITY>::grownCapacity(size_type newLength) const
+{
+    const size_type oldCapacity = capacity();
+
+    BSLS_ASSERT_SAFE(newLength > oldCapacity);
+
+    if (newLength > max_size()) {
+        StdExceptUtil::throwLengthError("CompactString: length > max_size");
+    }
+
+    size_type newCapacity = oldCapacity + (oldCapacity >> 1);
+    if (newCapacity < newLength) {
+        newCapacity = newLength;
+    }
+    if (newCapacity > max_size()) {
+        newCapacity = max_size();
+    }
+    return newCapacity;
+}
+
+// CREATORS
+template <int INLINE_CAPACITY>
+inline
+CompactString<INLINE_CAPACITY>::CompactString(
+                                              bslma::Allocator *basicAllocator)
+: d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    initialize(0);
+}
+
+template <int INLINE_CAPACITY>
+CompactString<INLINE_CAPACITY>::CompactString(
+                                              const char       *string,
+                                              bslma::Allocator *basicAllocator)
+: d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT_SAFE(string);
+
+    const size_type length = native_std::strlen(string);
+    native_std::memcpy(initialize(length), string, length);
+}
+
+template <int INLINE_CAPACITY>
+CompactString<INLINE_CAPACITY>::CompactString(
+                                              const char       *string,
+                                              size_type         length,
+                                              bslma::Allocator *basicAllocator)
+: d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT_SAFE(string || 0 == length);
+
+    native_std::memcpy(initialize(length), string, length);
+}
+
+template <int INLINE_CAPACITY>
+CompactString<INLINE_CAPACITY>::CompactString(
+                                          const CompactString&  original,
+                                          bslma::Allocator     *basicAllocator)
+: d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    if (original.isInline()) {
+        d_rep = original.d_rep;
+    }
+    else {
+        native_std::memcpy(initialize(original.length()),
+                           original.data(),
+                           original.length());
+    }
+}
+
+template <int INLINE_CAPACITY>
+inline
+CompactString<INLINE_CAPACITY>::~CompactString()
+{
+    if (!isInline()) {
+        d_allocator_p->deallocate(d_rep.d_long.d_data_p);
+    }
+}
+
+// MANIPULATORS
+template <int INLINE_CAPACITY>
+inline
+CompactString<INLINE_CAPACITY>&
+CompactString<INLINE_CAPACITY>::operator=(const CompactString& rhs)
+{
+    return assign(rhs.data(), rhs.length());
+}
+
+template <int INLINE_CAPACITY>
+inline
+CompactString<INLINE_CAPACITY>&
+CompactString<INLINE_CAPACITY>::operator=(const char *rhs)
+{
+    BSLS_ASSERT_SAFE(rhs);
+
+    return assign(rhs, native_std::strlen(rhs));
+}
+
+template <int INLINE_CAPACITY>
+CompactString<INLINE_CAPACITY>&
+CompactString<INLINE_CAPACITY>::assign(const char *string, size_type length)
+{
+    BSLS_ASSERT_SAFE(string || 0 == length);
+
+    if (length <= capacity()) {
+        native_std::memmove(data(), string, length);
+        setLength(length);
+    }
+    else {
+        const size_type newCapacity = grownCapacity(length);
+        clear();
+        reallocate(newCapacity, string, length);
+    }
+    return *this;
+}
+
+template <int INLINE_CAPACITY>
+CompactString<INLINE_CAPACITY>&
+CompactString<INLINE_CAPACITY>::append(const char *string, size_type length)
+{
+    BSLS_ASSERT_SAFE(string || 0 == length);
+
+    const size_type oldLength = this->length();
+
+    if (length > max_size() - oldLength) {
+        StdExceptUtil::throwLengthError("CompactString: length > max_size");
+    }
+
+    const size_type newLength = oldLength + length;
+    if (newLength <= capacity()) {
+        native_std::memmove(data() + oldLength, string, length);
+        setLength(newLength);
+    }
+    else {
+        reallocate(grownCapacity(newLength), string, length);
+    }
+    return *this;
+}
+
+template <int INLINE_CAPACITY>
+inline
+void CompactString<INLINE_CAPACITY>::push_back(char character)
+{
+    append(&character, 1);
+}
+
+template <int INLINE_CAPACITY>
+inline
+void CompactString<INLINE_CAPACITY>::clear()
+{
+    setLength(0);
+}
+
+template <int INLINE_CAPACITY>
+void CompactString<INLINE_CAPACITY>::reserve(size_type newCapacity)
+{
+    if (newCapacity > capacity()) {
+        if (newCapacity > max_size()) {
+            StdExceptUtil::throwLengthError(
+                                "CompactString: capacity > max_size");
+        }
+        reallocate(newCapacity, 0, 0);
+    }
+}
+
+template <int INLINE_CAPACITY>
+void CompactString<INLINE_CAPACITY>::resize(size_type newLength,
+                                            char      character)
+{
+    const size_type oldLength = length();
+
+    if (newLength > capacity()) {
+        reallocate(grownCapacity(newLength), 0, 0);
+    }
+    if (newLength > oldLength) {
+        native_std::memset(data() + oldLength,
+                           character,
+                           newLength - oldLength);
+    }
+    setLength(newLength);
+}
+
+template <int INLINE_CAPACITY>
+inline
+void CompactString<INLINE_CAPACITY>::swap(CompactString& other)
+{
+    BSLS_ASSERT_SAFE(d_allocator_p == other.d_allocator_p);
+
+    const Rep rep = d_rep;
+    d_rep         = other.d_rep;
+    other.d_rep   = rep;
+}
+
+template <int INLINE_CAPACITY>
+inline
+char& CompactString<INLINE_CAPACITY>::operator[](size_type position)
+{
+    BSLS_ASSERT_SAFE(position < length());
+
+    return data()[position];
+}
+
+template <int INLINE_CAPACITY>
+inline
+typename CompactString<INLINE_CAPACITY>::iterator
+CompactString<INLINE_CAPACITY>::begin()
+{
+    return data();
+}
+
+template <int INLINE_CAPACITY>
+inline
+typename CompactString<INLINE_CAPACITY>::iterator
+CompactString<INLINE_CAPACITY>::end()
+{
+    return data() + length();
+}
+
+template <int INLINE_CAPACITY>
+inline
+char *CompactString<INLINE_CAPACITY>::data()
+{
+    return isInline() ? d_rep.d_bytes : d_rep.d_long.d_data_p;
+}
+
+// ACCESSORS
+template <int INLINE_CAPACITY>
+inline
+const char&
+CompactString<INLINE_CAPACITY>::operator[](size_type position) const
+{
+    BSLS_ASSERT_SAFE(position <= length());
+
+    return data()[position];
+}
+
+template <int INLINE_CAPACITY>
+inline
+typename CompactString<INLINE_CAPACITY>::const_iterator
+CompactString<INLINE_CAPACITY>::begin() const
+{
+    return data();
+}
+
+template <int INLINE_CAPACITY>
+inline
+typename CompactString<INLINE_CAPACITY>::const_iterator
+CompactString<INLINE_CAPACITY>::end() const
+{
+    return data() + length();
+}
+
+template <int INLINE_CAPACITY>
+inline
+const char *CompactString<INLINE_CAPACITY>::c_str() const
+{
+    return data();
+}
+
+template <int INLINE_CAPACITY>
+inline
+const char *CompactString<INLINE_CAPACITY>::data() const
+{
+    return isInline() ? d_rep.d_bytes : d_rep.d_long.d_data_p;
+}
+
+template <int INLINE_CAPACITY>
+inline
+typename CompactString<INLINE_CAPACITY>::size_type
+CompactString<INLINE_CAPACITY>::length() const
+{
+    return isInline()
+           ? k_SHORT_CAPACITY
+                       - static_cast<unsigned char>(
+                                               d_rep.d_bytes[k_SHORT_CAPACITY])
+           : d_rep.d_long.d_length;
+}
+
+template <int INLINE_CAPACITY>
+inline
+typename CompactString<INLINE_CAPACITY>::size_type
+CompactString<INLINE_CAPACITY>::size() const
+{
+    return length();
+}
+
+template <int INLINE_CAPACITY>
+inline
+bool CompactString<INLINE_CAPACITY>::empty() const
+{
+    return 0 == length();
+}
+
+template <int INLINE_CAPACITY>
+inline
+typename CompactString<INLINE_CAPACITY>::size_type
+CompactString<INLINE_CAPACITY>::capacity() const
+{
+    return isInline()
+           ? static_cast<size_type>(k_SHORT_CAPACITY)
+           : decodeCapacity(d_rep.d_words[k_REP_WORDS - 1]);
+}
+
+template <int INLINE_CAPACITY>
+inline
+typename CompactString<INLINE_CAPACITY>::size_type
+CompactString<INLINE_CAPACITY>::max_size() const
+{
+    // The capacity must leave room for the tag and the null terminator.
+
+    return (~static_cast<size_type>(0) >> 8) - 1;
+}
+
+template <int INLINE_CAPACITY>
+inline
+bool CompactString<INLINE_CAPACITY>::isInline() const
+{
+    return 0 == (static_cast<unsigned char>(d_rep.d_bytes[k_SHORT_CAPACITY])
+                                                                & k_LONG_TAG);
+}
+
+template <int INLINE_CAPACITY>
+inline
+bslma::Allocator *CompactString<INLINE_CAPACITY>::allocator() const
+{
+    return d_allocator_p;
+}
+
+}  // close package namespace
+
+// FREE OPERATORS
+template <int INLINE_CAPACITY>
+inline
+bool bslstl::operator==(const CompactString<INLINE_CAPACITY>& lhs,
+                        const CompactString<INLINE_CAPACITY>& rhs)
+{
+    return lhs.length() == rhs.length()
+        && 0 == native_std::memcmp(lhs.data(), rhs.data(), lhs.length());
+}
+
+template <int INLINE_CAPACITY>
+inline
+bool bslstl::operator==(const CompactString<INLINE_CAPACITY>&  lhs,
+                        const char                            *rhs)
+{
+    BSLS_ASSERT_SAFE(rhs);
+
+    const native_std::size_t length = native_std::strlen(rhs);
+    return lhs.length() == length
+        && 0 == native_std::memcmp(lhs.data(), rhs, length);
+}
+
+template <int INLINE_CAPACITY>
+inline
+bool bslstl::operator==(const char                            *lhs,
+                        const CompactString<INLINE_CAPACITY>&  rhs)
+{
+    return rhs == lhs;
+}
+
+template <int INLINE_CAPACITY>
+inline
+bool bslstl::operator!=(const CompactString<INLINE_CAPACITY>& lhs,
+                        const CompactString<INLINE_CAPACITY>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+template <int INLINE_CAPACITY>
+inline
+bool bslstl::operator!=(const CompactString<INLINE_CAPACITY>&  lhs,
+                        const char                            *rhs)
+{
+    return !(lhs == rhs);
+}
+
+template <int INLINE_CAPACITY>
+inline
+bool bslstl::operator!=(const char                            *lhs,
+                        const CompactString<INLINE_CAPACITY>&  rhs)
+{
+    return !(rhs == lhs);
+}
+
+template <int INLINE_CAPACITY>
+bool bslstl::operator<(const CompactString<INLINE_CAPACITY>& lhs,
+                       const CompactString<INLINE_CAPACITY>& rhs)
+{
+    const native_std::size_t minLength = lhs.length() < rhs.length()
+                                       ? lhs.length()
+                                       : rhs.length();
+
+    const int result = native_std::memcmp(lhs.data(), rhs.data(), minLength);
+    return result < 0 || (0 == result && lhs.length() < rhs.length());
+}
+
+// FREE FUNCTIONS
+template <int INLINE_CAPACITY>
+inline
+void bslstl::swap(CompactString<INLINE_CAPACITY>& a,
+                  CompactString<INLINE_CAPACITY>& b)
+{
+    a.swap(b);
+}
+
+template <class HASHALG, int INLINE_CAPACITY>
+inline
+void bslstl::hashAppend(HASHALG&                              hashAlg,
+                        const CompactString<INLINE_CAPACITY>& input)
+{
+    using ::BloombergLP::bslh::hashAppend;
+    hashAlg(input.data(), input.length());
+    hashAppend(hashAlg, input.length());
+}
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,997 @@
+// bslstl_compactstring.t.cpp                                         -*-C++-*-
+
+#include <bslstl_compactstring.h>
+
+#include <bslstl_string.h>
+#include <bslstl_vector.h>
+
+#include <bslh_hash.h>
+#include <bslma_default.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatormonitor.h>
+#include <bslmf_isbitwisemoveable.h>
+#include <bsls_bsltestutil.h>
+#include <bsls_nativestd.h>
+#include <bsls_stopwatch.h>
+
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+using namespace BloombergLP;
+using namespace std;
+
+//=============================================================================
+//                             TEST PLAN
+//-----------------------------------------------------------------------------
+//                             Overview
+//                             --------
+// The component under test is a value-semantic string whose value is stored
+// either within the object ("short") or in allocated memory ("long"), the two
+// being distinguished by a tag bit.  We verify the layout of several
+// instantiations, that each manipulator yields the expected value from every
+// length up to and beyond the inline capacity (and so crosses between the
+// two representations in both directions), and that memory is allocated
+// exactly when the value does not fit inline.
+//-----------------------------------------------------------------------------
+// CREATORS
+// [ 3] explicit CompactString(bslma::Allocator *basicAllocator = 0);
+// [ 3] CompactString(const char *string, bslma::Allocator *ba = 0);
+// [ 3] CompactString(const char *string, size_type length, *ba = 0);
+// [ 3] CompactString(const CompactString& original, *ba = 0);
+// [ 3] ~CompactString();
+//
+// MANIPULATORS
+// [ 4] CompactString& operator=(const CompactString& rhs);
+// [ 4] CompactString& operator=(const char *rhs);
+// [ 4] CompactString& assign(const char *string, size_type length);
+// [ 4] CompactString& append(const char *string, size_type length);
+// [ 4] void push_back(char character);
+// [ 5] void clear();
+// [ 5] void reserve(size_type newCapacity);
+// [ 5] void resize(size_type newLength, char character = char());
+// [ 5] void swap(CompactString& other);
+// [ 2] char& operator[](size_type position);
+// [ 2] iterator begin();
+// [ 2] iterator end();
+// [ 2] char *data();
+//
+// ACCESSORS
+// [ 2] const char& operator[](size_type position) const;
+// [ 2] const_iterator begin() const;
+// [ 2] const_iterator end() const;
+// [ 2] const char *c_str() const;
+// [ 2] const char *data() const;
+// [ 2] size_type length() const;
+// [ 2] size_type size() const;
+// [ 2] bool empty() const;
+// [ 2] size_type capacity() const;
+// [ 2] size_type max_size() const;
+// [ 2] bool isInline() const;
+// [ 3] bslma::Allocator *allocator() const;
+//
+// FREE OPERATORS
+// [ 6] bool operator==(const CompactString& lhs, const CompactString& rhs);
+// [ 6] bool operator==(const CompactString& lhs, const char *rhs);
+// [ 6] bool operator==(const char *lhs, const CompactString& rhs);
+// [ 6] bool operator!=(const CompactString& lhs, const CompactString& rhs);
+// [ 6] bool operator!=(const CompactString& lhs, const char *rhs);
+// [ 6] bool operator!=(const char *lhs, const CompactString& rhs);
+// [ 6] bool operator<(const CompactString& lhs, const CompactString& rhs);
+//
+// FREE FUNCTIONS
+// [ 5] void swap(CompactString& a, CompactString& b);
+// [ 6] void hashAppend(HASHALG& hashAlg, const CompactString& input);
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 7] USAGE EXAMPLE
+// [-1] PERFORMANCE TEST
+
+//=============================================================================
+//                  STANDARD BDE ASSERT TEST MACRO
+//-----------------------------------------------------------------------------
+static int testStatus = 0;
+
+static void aSsErT(bool b, const char *s, int i) {
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+//=============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef bslstl::CompactString<>   Obj;
+typedef bslstl::CompactString<31> WideObj;
+
+static const int MAX_LENGTH = 100;  // longest value tested; several times the
+                                    // inline capacity of 'WideObj'
+
+static const char ALPHABET[] = "abcdefghijklmnopqrstuvwxyz"
+                               "ABCDEFGHIJKLMNOPQRSTUVWXYZ"
+                               "0123456789"
+                               "abcdefghijklmnopqrstuvwxyz"
+                               "ABCDEFGHIJKLMNOPQRSTUVWXYZ"
+                               "0123456789";
+                                    // source of the characters of values
+
+namespace {
+
+template <class STRING>
+bool hasValue(const STRING& object, const char *value, size_t length)
+    // Return 'true' if the specified 'object' has the value of the specified
+    // 'length' characters at the specified 'value' (and is null-terminated),
+    // and 'false' otherwise.
+{
+    return length == object.length()
+        && length == object.size()
+        && (0 == length) == object.empty()
+        && length <= object.capacity()
+        && 0 == memcmp(object.data(), value, length)
+        && 0 == object.c_str()[length]
+        && object.begin() == object.data()
+        && object.end() == object.data() + length;
+}
+
+template <class STRING>
+void testLayout()
+    // Verify the representation of every length of a 'STRING' up to
+    // 'MAX_LENGTH', and that memory is allocated exactly when the length
+    // exceeds the inline capacity.
+{
+    bslma::TestAllocator ta("layout");
+
+    const size_t INLINE = STRING(&ta).capacity();
+
+    for (size_t len = 0; len <= MAX_LENGTH; ++len) {
+        bslma::TestAllocatorMonitor tam(&ta);
+
+        STRING mX(ALPHABET, len, &ta);  const STRING& X = mX;
+
+        ASSERTV(INLINE, len, hasValue(X, ALPHABET, len));
+        ASSERTV(INLINE, len, (len <= INLINE) == X.isInline());
+        ASSERTV(INLINE, len, (len <= INLINE) == tam.isTotalSame());
+        ASSERTV(INLINE, len, X.isInline() || len == X.capacity());
+
+        if (len <= INLINE) {
+            // The characters are within the footprint of the object.
+
+            const char *addr = reinterpret_cast<const char *>(&X);
+            ASSERTV(len, addr <= X.data() && X.data() < addr + sizeof X);
+        }
+
+        for (size_t i = 0; i < len; ++i) {
+            ASSERTV(len, i, ALPHABET[i] == X[i]);
+            mX[i] = 'x';
+            ASSERTV(len, i, 'x' == X[i]);
+        }
+        ASSERTV(len, 0 == X[len]);
+        ASSERTV(len, len <= X.max_size());
+    }
+    ASSERT(0 == ta.numBlocksInUse());
+}
+
+template <class STRING>
+void testAssignAppend()
+    // Verify assignment and appending between every pair of lengths up to
+    // 'MAX_LENGTH', including from a value that refers to the target.
+{
+    bslma::TestAllocator ta("assign");
+
+    for (size_t ti = 0; ti <= MAX_LENGTH; ++ti) {
+        for (size_t tj = 0; tj <= MAX_LENGTH; tj += 3) {
+            {
+                STRING mX(ALPHABET, ti, &ta);  const STRING& X = mX;
+                mX.assign(ALPHABET + 1, tj);
+                ASSERTV(ti, tj, hasValue(X, ALPHABET + 1, tj));
+
+                STRING mY(ALPHABET + 2, tj, &ta);  const STRING& Y = mY;
+                mX = Y;
+                ASSERTV(ti, tj, hasValue(X, ALPHABET + 2, tj));
+
+                const char *const SUFFIX = ALPHABET + sizeof ALPHABET - 1 - tj;
+                mX = SUFFIX;
+                ASSERTV(ti, tj, hasValue(X, SUFFIX, tj));
+            }
+            {
+                STRING mX(ALPHABET, ti, &ta);  const STRING& X = mX;
+                mX.append(ALPHABET + ti, tj);
+                ASSERTV(ti, tj, hasValue(X, ALPHABET, ti + tj));
+            }
+            if (tj <= ti) {
+                // Assign and append a part of the string itself.
+
+                STRING mX(ALPHABET, ti, &ta);  const STRING& X = mX;
+                mX.assign(X.data() + ti - tj, tj);
+                ASSERTV(ti, tj, hasValue(X, ALPHABET + ti - tj, tj));
+
+                STRING mY(ALPHABET, ti, &ta);  const STRING& Y = mY;
+                mY.append(Y.data(), tj);
+
+                char expected[2 * MAX_LENGTH];
+                memcpy(expected, ALPHABET, ti);
+                memcpy(expected + ti, ALPHABET, tj);
+                ASSERTV(ti, tj, hasValue(Y, expected, ti + tj));
+            }
+        }
+    }
+
+    // 'push_back' grows geometrically.
+
+    {
+        STRING mX(&ta);  const STRING& X = mX;
+        const bsls::Types::Int64 before = ta.numBlocksTotal();
+        for (size_t len = 0; len < 10 * MAX_LENGTH; ++len) {
+            mX.push_back(ALPHABET[len % MAX_LENGTH]);
+            ASSERTV(len, X.length() == len + 1);
+            ASSERTV(len, ALPHABET[len % MAX_LENGTH] == X[len]);
+        }
+        ASSERTV(ta.numBlocksTotal() - before,
+                ta.numBlocksTotal() - before < 20);
+    }
+    ASSERT(0 == ta.numBlocksInUse());
+}
+
+template <class STRING>
+void testCapacity()
+    // Verify 'clear', 'reserve', 'resize', and 'swap' for every length up to
+    // 'MAX_LENGTH'.
+{
+    bslma::TestAllocator ta("capacity");
+
+    const size_t INLINE = STRING(&ta).capacity();
+
+    for (size_t ti = 0; ti <= MAX_LENGTH; ++ti) {
+        {
+            STRING mX(ALPHABET, ti, &ta);  const STRING& X = mX;
+            const size_t CAPACITY = X.capacity();
+            mX.clear();
+            ASSERTV(ti, hasValue(X, "", 0));
+            ASSERTV(ti, CAPACITY == X.capacity());
+        }
+        for (size_t tj = 0; tj <= MAX_LENGTH; tj += 7) {
+            {
+                STRING mX(ALPHABET, ti, &ta);  const STRING& X = mX;
+                const size_t CAPACITY = X.capacity();
+                mX.reserve(tj);
+                ASSERTV(ti, tj, hasValue(X, ALPHABET, ti));
+                ASSERTV(ti, tj, tj <= X.capacity());
+                ASSERTV(ti, tj, tj > CAPACITY || CAPACITY == X.capacity());
+            }
+            {
+                STRING mX(ALPHABET, ti, &ta);  const STRING& X = mX;
+                mX.resize(tj, '#');
+
+                char expected[MAX_LENGTH];
+                memcpy(expected, ALPHABET, ti < tj ? ti : tj);
+                if (tj > ti) {
+                    memset(expected + ti, '#', tj - ti);
+                }
+                ASSERTV(ti, tj, hasValue(X, expected, tj));
+
+                mX.resize(ti);
+                if (tj < ti) {
+                    memset(expected + tj, 0, ti - tj);
+                }
+                ASSERTV(ti, tj, hasValue(X, expected, ti));
+            }
+            {
+                STRING mX(ALPHABET, ti, &ta);  const STRING& X = mX;
+                STRING mY(ALPHABET + 1, tj, &ta);  const STRING& Y = mY;
+
+                mX.swap(mY);
+                ASSERTV(ti, tj, hasValue(X, ALPHABET + 1, tj));
+                ASSERTV(ti, tj, hasValue(Y, ALPHABET, ti));
+
+                bslma::TestAllocatorMonitor tam(&ta);
+                swap(mX, mY);
+                ASSERTV(ti, tj, hasValue(X, ALPHABET, ti));
+                ASSERTV(ti, tj, hasValue(Y, ALPHABET + 1, tj));
+                ASSERTV(ti, tj, tam.isTotalSame());
+            }
+        }
+    }
+    ASSERT(0 == ta.numBlocksInUse());
+
+    // A string that has moved to allocated memory remains there when
+    // shortened, and so does not allocate again when lengthened.
+
+    STRING mX(ALPHABET, INLINE + 1, &ta);  const STRING& X = mX;
+    mX.resize(0);
+    ASSERT(!X.isInline());
+
+    bslma::TestAllocatorMonitor tam(&ta);
+    mX.assign(ALPHABET, INLINE + 1);
+    ASSERT(tam.isTotalSame());
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+    bool     veryVeryVerbose = argc > 4;
+    bool veryVeryVeryVerbose = argc > 5;
+
+    (void) veryVerbose;
+    (void) veryVeryVerbose;
+    (void) veryVeryVeryVerbose;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    // CONCERN: No memory is obtained from the default allocator.
+
+    bslma::TestAllocator da("default", veryVeryVeryVerbose);
+    bslma::Default::setDefaultAllocatorRaw(&da);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 7: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Storing Security Identifiers
+///- - - - - - - - - - - - - - - - - - - -
+// Suppose we store security identifiers, most of which are shorter than 32
+// characters, and want to avoid allocating memory for each of them.
+//
+// First, we create a default 'CompactString', whose identifier fits inline:
+//..
+    bslma::TestAllocator ta;
+
+    bslstl::CompactString<> ticker("IBM US Equity", &ta);
+
+    ASSERT(13 == ticker.length());
+    ASSERT(ticker.isInline());
+    ASSERT(0  == ta.numBlocksTotal());
+//..
+// Then, we observe that a longer identifier does not fit, and is stored in
+// allocated memory:
+//..
+    bslstl::CompactString<> option("AAPL US 01/17/25 C150 Equity", &ta);
+
+    ASSERT(28 == option.length());
+    ASSERT(!option.isInline());
+    ASSERT(1  == ta.numBlocksTotal());
+//..
+// Next, we choose a larger inline capacity suited to our identifiers:
+//..
+    bslstl::CompactString<31> wideOption("AAPL US 01/17/25 C150 Equity", &ta);
+
+    ASSERT(wideOption.isInline());
+    ASSERT(1 == ta.numBlocksTotal());
+//..
+// Finally, we verify that the two strings have the same value:
+//..
+    ASSERT(0 == native_std::strcmp(option.c_str(), wideOption.c_str()));
+//..
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // COMPARISON AND HASHING
+        //
+        // Concerns:
+        //: 1 Two strings compare equal if and only if they have the same
+        //:   length and characters, regardless of their representation.
+        //:
+        //: 2 'operator<' orders strings as does 'bsl::string', treating
+        //:   characters as 'unsigned char'.
+        //:
+        //: 3 'bslh::Hash<>' yields the same value for a 'CompactString' as
+        //:   for a 'bsl::string' having the same value.
+        //
+        // Plan:
+        //: 1 For a set of values of various lengths (including some having
+        //:   characters with the high bit set) compare every pair of objects
+        //:   against the corresponding comparisons of 'bsl::string'.
+        //:   (C-1..2)
+        //:
+        //: 2 Compare the hash of every value with the hash of the equal
+        //:   'bsl::string'.  (C-3)
+        //
+        // Testing:
+        //   bool operator==(const CompactString& lhs, const CompactString&);
+        //   bool operator==(const CompactString& lhs, const char *rhs);
+        //   bool operator==(const char *lhs, const CompactString& rhs);
+        //   bool operator!=(const CompactString& lhs, const CompactString&);
+        //   bool operator!=(const CompactString& lhs, const char *rhs);
+        //   bool operator!=(const char *lhs, const CompactString& rhs);
+        //   bool operator<(const CompactString& lhs, const CompactString&);
+        //   void hashAppend(HASHALG& hashAlg, const CompactString& input);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCOMPARISON AND HASHING"
+                            "\n======================\n");
+
+        static const char *DATA[] = {
+            "",
+            "A",
+            "AB",
+            "B",
+            "\xe9",
+            "IBM",
+            "IBM US Equity",
+            "IBM US Equity\xe9",
+            "ABCDEFGHIJKLMNOPQRSTUVW",
+            "ABCDEFGHIJKLMNOPQRSTUVWX",
+            "ABCDEFGHIJKLMNOPQRSTUVWXYZ012345",
+            "AAPL US 01/17/25 C150 Equity",
+            "AAPL US 01/17/25 C150 Equity and a long description",
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        bslma::TestAllocator ta("object", veryVeryVeryVerbose);
+
+        const bslh::Hash<> hasher = bslh::Hash<>();
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const Obj         X(DATA[ti], &ta);
+            const WideObj     WX(DATA[ti], &ta);
+            const bsl::string SX(DATA[ti], &ta);
+
+            ASSERTV(ti, hasher(SX) == hasher(X));
+            ASSERTV(ti, hasher(SX) == hasher(WX));
+
+            for (int tj = 0; tj < NUM_DATA; ++tj) {
+                const Obj         Y(DATA[tj], &ta);
+                const bsl::string SY(DATA[tj], &ta);
+
+                const bool EQ = SX == SY;
+                const bool LT = SX <  SY;
+
+                ASSERTV(ti, tj, EQ ==  (X == Y));
+                ASSERTV(ti, tj, EQ == !(X != Y));
+                ASSERTV(ti, tj, EQ ==  (X == DATA[tj]));
+                ASSERTV(ti, tj, EQ == !(X != DATA[tj]));
+                ASSERTV(ti, tj, EQ ==  (DATA[ti] == Y));
+                ASSERTV(ti, tj, EQ == !(DATA[ti] != Y));
+                ASSERTV(ti, tj, LT ==  (X <  Y));
+            }
+        }
+        ASSERT(0 == da.numBlocksTotal());
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // CLEAR, RESERVE, RESIZE, AND SWAP
+        //
+        // Concerns:
+        //: 1 'clear' empties the string without reducing its capacity.
+        //:
+        //: 2 'reserve' increases the capacity to at least the requested value,
+        //:   preserving the value, and does nothing if the capacity suffices.
+        //:
+        //: 3 'resize' truncates or pads the string with the supplied
+        //:   character, and may cross from the short representation to the
+        //:   long one.
+        //:
+        //: 4 'swap' (member and free) exchanges values of any lengths without
+        //:   allocating memory.
+        //:
+        //: 5 A string in the long representation keeps its buffer when it is
+        //:   shortened.
+        //
+        // Plan:
+        //: 1 For every pair of lengths up to a value several times the inline
+        //:   capacity, apply each manipulator and verify the value, capacity,
+        //:   and allocation, for several instantiations.  (C-1..5)
+        //
+        // Testing:
+        //   void clear();
+        //   void reserve(size_type newCapacity);
+        //   void resize(size_type newLength, char character = char());
+        //   void swap(CompactString& other);
+        //   void swap(CompactString& a, CompactString& b);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCLEAR, RESERVE, RESIZE, AND SWAP"
+                            "\n================================\n");
+
+        testCapacity<bslstl::CompactString<0> >();
+        testCapacity<Obj>();
+        testCapacity<WideObj>();
+        testCapacity<bslstl::CompactString<100> >();
+
+        ASSERT(0 == da.numBlocksTotal());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // ASSIGN AND APPEND
+        //
+        // Concerns:
+        //: 1 Assignment and appending yield the expected value for every
+        //:   combination of source and target lengths, crossing between the
+        //:   short and long representations.
+        //:
+        //: 2 The source may refer to the characters of the target.
+        //:
+        //: 3 Repeated 'push_back' allocates a logarithmic number of times.
+        //:
+        //: 4 No memory is leaked.
+        //
+        // Plan:
+        //: 1 For every pair of lengths, assign and append from an independent
+        //:   source and from the target itself, and verify the value.
+        //:   (C-1..2)
+        //:
+        //: 2 Append characters one at a time and count the allocations.  (C-3)
+        //:
+        //: 3 Verify that no memory is in use at the end.  (C-4)
+        //
+        // Testing:
+        //   CompactString& operator=(const CompactString& rhs);
+        //   CompactString& operator=(const char *rhs);
+        //   CompactString& assign(const char *string, size_type length);
+        //   CompactString& append(const char *string, size_type length);
+        //   void push_back(char character);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nASSIGN AND APPEND"
+                            "\n=================\n");
+
+        testAssignAppend<bslstl::CompactString<0> >();
+        testAssignAppend<Obj>();
+        testAssignAppend<WideObj>();
+        testAssignAppend<bslstl::CompactString<100> >();
+
+        ASSERT(0 == da.numBlocksTotal());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // CREATORS
+        //
+        // Concerns:
+        //: 1 Each constructor creates a string having the expected value.
+        //:
+        //: 2 Memory is obtained from the supplied allocator, or from the
+        //:   default allocator if none is supplied, only if the value does not
+        //:   fit inline.
+        //:
+        //: 3 A copy uses the allocator supplied to it, not that of the
+        //:   original, and its capacity is no larger than needed.
+        //:
+        //: 4 The destructor releases all memory.
+        //
+        // Plan:
+        //: 1 Create strings of every length with each constructor, with and
+        //:   without an allocator, and verify the value, the allocator, and
+        //:   the memory in use.  (C-1..4)
+        //
+        // Testing:
+        //   explicit CompactString(bslma::Allocator *basicAllocator = 0);
+        //   CompactString(const char *string, bslma::Allocator *ba = 0);
+        //   CompactString(const char *string, size_type length, *ba = 0);
+        //   CompactString(const CompactString& original, *ba = 0);
+        //   ~CompactString();
+        //   bslma::Allocator *allocator() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCREATORS"
+                            "\n========\n");
+
+        bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+        bslma::TestAllocator oa("other",    veryVeryVeryVerbose);
+
+        {
+            const Obj X;
+            ASSERT(&da == X.allocator());
+            ASSERT(hasValue(X, "", 0));
+
+            const Obj Y(&sa);
+            ASSERT(&sa == Y.allocator());
+            ASSERT(hasValue(Y, "", 0));
+        }
+
+        char buffer[MAX_LENGTH + 1];
+
+        for (size_t len = 0; len <= MAX_LENGTH; ++len) {
+            memcpy(buffer, ALPHABET, len);
+            buffer[len] = 0;
+
+            const bool INLINE = len <= Obj(&sa).capacity();
+
+            {
+                const Obj X(buffer);
+                ASSERTV(len, hasValue(X, buffer, len));
+                ASSERTV(len, &da == X.allocator());
+                ASSERTV(len, INLINE == (0 == da.numBlocksInUse()));
+            }
+            ASSERTV(len, 0 == da.numBlocksInUse());
+            {
+                const Obj X(buffer, &sa);
+                ASSERTV(len, hasValue(X, buffer, len));
+                ASSERTV(len, &sa == X.allocator());
+                ASSERTV(len, INLINE == (0 == sa.numBlocksInUse()));
+
+                const Obj Y(buffer, len, &sa);
+                ASSERTV(len, hasValue(Y, buffer, len));
+
+                const Obj Z(X, &oa);
+                ASSERTV(len, hasValue(Z, buffer, len));
+                ASSERTV(len, &oa == Z.allocator());
+                ASSERTV(len, INLINE == (0 == oa.numBlocksInUse()));
+                ASSERTV(len, INLINE || len == Z.capacity());
+
+                const Obj W(X);
+                ASSERTV(len, hasValue(W, buffer, len));
+                ASSERTV(len, &da == W.allocator());
+            }
+            ASSERTV(len, 0 == sa.numBlocksInUse());
+            ASSERTV(len, 0 == oa.numBlocksInUse());
+            ASSERTV(len, 0 == da.numBlocksInUse());
+        }
+
+        if (verbose) printf("\nA long string copied with spare capacity.\n");
+        {
+            Obj mX(ALPHABET, MAX_LENGTH, &sa);
+            mX.resize(1);
+
+            bslma::TestAllocatorMonitor oam(&oa);
+
+            const Obj Y(mX, &oa);
+            ASSERT(hasValue(Y, ALPHABET, 1));
+            ASSERT(Y.isInline());
+            ASSERT(oam.isTotalSame());
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // LAYOUT AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 The footprint of 'CompactString<N>' is the smallest whole number
+        //:   of words, at least three, holding 'N + 1' bytes, plus a pointer.
+        //:
+        //: 2 The inline capacity is one less than the size of that region, and
+        //:   is at least 'N'.
+        //:
+        //: 3 Strings whose length does not exceed the inline capacity are
+        //:   stored within the object without allocating memory; longer
+        //:   strings are stored in allocated memory.
+        //:
+        //: 4 The accessors and element access report the value correctly in
+        //:   both representations.
+        //:
+        //: 5 'CompactString' is bitwise-moveable and uses 'bslma' allocators.
+        //
+        // Plan:
+        //: 1 Verify 'sizeof' and the inline capacity of several
+        //:   instantiations.  (C-1..2)
+        //:
+        //: 2 For every length up to a value several times the inline
+        //:   capacity, create a string, verify its accessors and the memory
+        //:   allocated, and modify it through 'operator[]'.  (C-3..4)
+        //:
+        //: 3 Verify the traits.  (C-5)
+        //
+        // Testing:
+        //   char& operator[](size_type position);
+        //   iterator begin();
+        //   iterator end();
+        //   char *data();
+        //   const char& operator[](size_type position) const;
+        //   const_iterator begin() const;
+        //   const_iterator end() const;
+        //   const char *c_str() const;
+        //   const char *data() const;
+        //   size_type length() const;
+        //   size_type size() const;
+        //   bool empty() const;
+        //   size_type capacity() const;
+        //   size_type max_size() const;
+        //   bool isInline() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nLAYOUT AND BASIC ACCESSORS"
+                            "\n==========================\n");
+
+        const size_t W = sizeof(void *);
+
+        ASSERTV(sizeof(Obj), 4 * W == sizeof(Obj));
+        ASSERTV(Obj().capacity(), 3 * W - 1 == Obj().capacity());
+
+        typedef bslstl::CompactString<0> MinObj;
+        ASSERTV(sizeof(MinObj), 4 * W == sizeof(MinObj));
+        ASSERTV(MinObj().capacity(), 3 * W - 1 == MinObj().capacity());
+
+        typedef bslstl::CompactString<3 * sizeof(void *)> NextObj;
+        ASSERTV(sizeof(NextObj), 5 * W == sizeof(NextObj));
+        ASSERTV(NextObj().capacity(), 4 * W - 1 == NextObj().capacity());
+
+        ASSERTV(sizeof(WideObj), 32 + W == sizeof(WideObj));
+        ASSERTV(WideObj().capacity(), 31 == WideObj().capacity());
+
+        if (8 == W) {
+            ASSERTV(sizeof(bsl::string), sizeof(Obj) < sizeof(bsl::string));
+            ASSERTV(bsl::string().capacity(),
+                    bsl::string().capacity() <= Obj().capacity());
+        }
+
+        ASSERT(bslma::UsesBslmaAllocator<Obj>::value);
+        ASSERT(bslmf::IsBitwiseMoveable<Obj>::value);
+        ASSERT(bslmf::IsBitwiseMoveable<WideObj>::value);
+
+        testLayout<MinObj>();
+        testLayout<Obj>();
+        testLayout<NextObj>();
+        testLayout<WideObj>();
+        testLayout<bslstl::CompactString<100> >();
+
+        ASSERT(0 == da.numBlocksTotal());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create strings, grow them past the inline capacity, and shrink
+        //:   them again, verifying the value at each step.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        bslma::TestAllocator ta("object", veryVeryVeryVerbose);
+
+        Obj mX(&ta);  const Obj& X = mX;
+        ASSERT(X.empty());
+        ASSERT(X.isInline());
+        ASSERT(0 == strcmp(X.c_str(), ""));
+
+        mX = "IBM";
+        ASSERT(X == "IBM");
+        ASSERT(X.isInline());
+
+        mX.append(" US Equity", 10);
+        ASSERT(X == "IBM US Equity");
+        ASSERT(X.isInline());
+        ASSERT(0 == ta.numBlocksTotal());
+
+        mX.append(" and a longer description", 25);
+        ASSERT(X == "IBM US Equity and a longer description");
+        ASSERT(!X.isInline());
+        ASSERT(1 == ta.numBlocksInUse());
+
+        Obj mY(X, &ta);  const Obj& Y = mY;
+        ASSERT(X == Y);
+        ASSERT(2 == ta.numBlocksInUse());
+
+        mY = "IBM";
+        ASSERT(Y == "IBM");
+        ASSERT(X != Y);
+        ASSERT(Y < X);
+
+        mX.swap(mY);
+        ASSERT(X == "IBM");
+        ASSERT(Y == "IBM US Equity and a longer description");
+
+        mY.clear();
+        ASSERT(Y.empty());
+        ASSERT(!Y.isInline());
+
+        const Obj Z(X, &ta);
+        ASSERT(Z.isInline());
+        ASSERT(2 == ta.numBlocksInUse());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST
+        //
+        // Concerns:
+        //: 1 Storing a realistic mix of identifiers in 'CompactString' takes
+        //:   fewer allocations and less memory than in 'bsl::string', and is
+        //:   no slower to build and to scan.
+        //
+        // Plan:
+        //: 1 Build a table of identifiers whose lengths follow a mix of
+        //:   tickers, exchange codes, ISINs and FIGIs, Bloomberg tickers,
+        //:   option symbols, and occasional free-text descriptions.
+        //:
+        //: 2 For 'bsl::string' and two instantiations of 'CompactString',
+        //:   copy the identifiers into an array of strings, then compare
+        //:   every string with its neighbor repeatedly, and report the size of
+        //:   the object, the number of allocations, the total footprint, and
+        //:   the time taken.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nPERFORMANCE TEST"
+                            "\n================\n");
+
+        const int NUM_KEYS = 200000;
+        const int NUM_SCAN = 20;
+
+        static const char *const SHAPES[] = {
+            "IBM",                                // ticker
+            "MSFT",
+            "F",
+            "XNYS",                               // exchange code
+            "US4592001014",                       // ISIN
+            "BBG000BLNNH6",                       // FIGI
+            "IBM US Equity",                      // Bloomberg ticker
+            "VOD LN Equity",
+            "SPX Index",
+            "AAPL  250117C00150000",              // OCC option symbol
+            "AAPL US 01/17/25 C150 Equity",       // Bloomberg option ticker
+            "INTERNATIONAL BUSINESS MACHINES CORP COMMON STOCK",
+        };
+        static const int WEIGHTS[] = { 12, 12, 4, 6, 10, 6, 20, 10, 4, 8, 6,
+                                       2 };
+                                    // relative frequencies, in percent
+
+        bsl::vector<bsl::string> keys;
+        keys.reserve(NUM_KEYS);
+        {
+            unsigned int state = 12345;
+            char         buffer[64];
+            for (int i = 0; i < NUM_KEYS; ++i) {
+                state = state * 1103515245u + 12345u;
+                int pick = (state >> 8) % 100;
+                int shape = 0;
+                while (pick >= WEIGHTS[shape]) {
+                    pick -= WEIGHTS[shape];
+                    ++shape;
+                }
+
+                // Vary the leading characters so that the keys are distinct.
+
+                const size_t len = strlen(SHAPES[shape]);
+                memcpy(buffer, SHAPES[shape], len);
+                buffer[0] = static_cast<char>('A' + i % 26);
+                if (len > 1) {
+                    buffer[1] = static_cast<char>('A' + i / 26 % 26);
+                }
+                keys.push_back(bsl::string(buffer, len));
+            }
+        }
+
+        printf("%d keys; object size: bsl::string %d, CompactString<> %d, "
+               "CompactString<31> %d\n",
+               NUM_KEYS,
+               static_cast<int>(sizeof(bsl::string)),
+               static_cast<int>(sizeof(Obj)),
+               static_cast<int>(sizeof(WideObj)));
+
+        printf("%-18s %10s %12s %12s %9s %9s\n",
+               "type", "allocs", "heap bytes", "total bytes", "build(s)",
+               "scan(s)");
+
+#define BSLSTL_COMPACTSTRING_BENCHMARK(TYPE)                                  \
+        {                                                                     \
+            bslma::TestAllocator sa;                                          \
+            bsls::Stopwatch      timer;                                       \
+            int                  matches = 0;                                 \
+            double               buildTime;                                   \
+            {                                                                 \
+                bsl::vector<TYPE> table(&sa);                                 \
+                table.reserve(NUM_KEYS);                                      \
+                const bsls::Types::Int64 base  = sa.numBlocksTotal();         \
+                const bsls::Types::Int64 bytes = sa.numBytesInUse();          \
+                                                                              \
+                timer.start();                                                \
+                for (int i = 0; i < NUM_KEYS; ++i) {                          \
+                    table.push_back(TYPE(keys[i].data(), keys[i].size()));    \
+                }                                                             \
+                timer.stop();                                                 \
+                buildTime = timer.accumulatedWallTime();                      \
+                                                                              \
+                const bsls::Types::Int64 heap = sa.numBytesInUse() - bytes;   \
+                timer.reset();                                                \
+                timer.start();                                                \
+                for (int j = 0; j < NUM_SCAN; ++j) {                          \
+                    for (int i = 1; i < NUM_KEYS; ++i) {                      \
+                        matches += table[i - 1] == table[i];                  \
+                    }                                                         \
+                }                                                             \
+                timer.stop();                                                 \
+                printf("%-18s %10lld %12lld %12lld %9.4f %9.4f\n",            \
+                       #TYPE,                                                 \
+                       sa.numBlocksTotal() - base,                            \
+                       heap,                                                  \
+                       heap + static_cast<bsls::Types::Int64>(sizeof(TYPE))   \
+                                                                 * NUM_KEYS,  \
+                       buildTime,                                             \
+                       timer.accumulatedWallTime());                          \
+            }                                                                 \
+            ASSERT(0 == matches);                                             \
+        }
+
+        BSLSTL_COMPACTSTRING_BENCHMARK(bsl::string);
+        BSLSTL_COMPACTSTRING_BENCHMARK(Obj);
+        BSLSTL_COMPACTSTRING_BENCHMARK(WideObj);
+
+#undef BSLSTL_COMPACTSTRING_BENCHMARK
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
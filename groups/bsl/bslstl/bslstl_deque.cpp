@@ -115,6 +115,7 @@ struct Deque_Imp {
     std::size_t    d_blocksLength;  // length of d_blocks array
     IteratorImp    d_start;         // iterator to first element
     IteratorImp    d_finish;        // iterator to one past last element
+    void          *d_spareBlocks;   // list of retained empty blocks
 };
 
 // MANIPULATORS
@@ -130,8 +131,10 @@ void Deque_Util::move(void *dst, void *src)
     dstDeque.d_blocksLength = srcDeque.d_blocksLength;
     dstDeque.d_start        = srcDeque.d_start;
     dstDeque.d_finish       = srcDeque.d_finish;
+    dstDeque.d_spareBlocks  = srcDeque.d_spareBlocks;
 
     srcDeque.d_blocks       = 0;  // put back in a raw state
+    srcDeque.d_spareBlocks  = 0;
 }
 
 void Deque_Util::swap(void *a, void *b)
@@ -147,16 +150,19 @@ void Deque_Util::swap(void *a, void *b)
     temp.d_blocksLength   = bDeque.d_blocksLength;
     temp.d_start          = bDeque.d_start;
     temp.d_finish         = bDeque.d_finish;
+    temp.d_spareBlocks    = bDeque.d_spareBlocks;
 
     bDeque.d_blocks       = aDeque.d_blocks;
     bDeque.d_blocksLength = aDeque.d_blocksLength;
     bDeque.d_start        = aDeque.d_start;
     bDeque.d_finish       = aDeque.d_finish;
+    bDeque.d_spareBlocks  = aDeque.d_spareBlocks;
 
     aDeque.d_blocks       = temp.d_blocks;
     aDeque.d_blocksLength = temp.d_blocksLength;
     aDeque.d_start        = temp.d_start;
     aDeque.d_finish       = temp.d_finish;
+    aDeque.d_spareBlocks  = temp.d_spareBlocks;
 }
 
 }  // close namespace bsl
@@ -11,6 +11,7 @@ BSLS_IDENT("$Id: $")
 //
 //@CLASSES:
 //  bslstl_Deque: standard-compliant 'bsl::deque' implementation
+//  bslstl::DequeBlockPolicy: customization point for deque block management
 //
 //@SEE_ALSO: bslstl_vector, bsl+stlhdrs
 //
@@ -36,6 +37,47 @@ BSLS_IDENT("$Id: $")
 //:   establish a full standard compliance for this component when used as
 //:   'bsl::deque' in the BSL STL.
 //
+///Block Management
+///----------------
+// A 'deque' stores its elements in fixed-size blocks, whose length (in
+// elements) is a compile-time property of the element type that is also
+// encoded in the deque's iterator type.  The nominal number of bytes per block
+// is obtained from the 'bslstl::DequeBlockPolicy' class template, which
+// clients may specialize for their element type (the length of a block is
+// never less than 16 elements).
+//
+// A deque also retains a bounded number of blocks that become empty (e.g.,
+// when the last element of a block is popped), and reuses them the next time
+// a block is needed at either end of the sequence, rather than returning them
+// to the allocator at once.  The maximum number of such spare blocks is also
+// obtained from 'bslstl::DequeBlockPolicy' (the default is one, which is
+// sufficient to make a 'deque' used as a FIFO queue of bounded length free of
+// allocations once it has reached its steady state), and all spare blocks are
+// returned to the allocator when the deque is destroyed.  For example, a queue
+// of market-data ticks may use larger blocks and retain more of them:
+//..
+//  struct Tick {
+//      double d_price;
+//      int    d_quantity;
+//  };
+//
+//  namespace BloombergLP {
+//  namespace bslstl {
+//
+//  template <>
+//  struct DequeBlockPolicy<Tick> {
+//      enum {
+//          BLOCK_SIZE       = 4096,  // nominal number of bytes per block
+//          MAX_SPARE_BLOCKS = 4      // maximum number of spare blocks
+//      };
+//  };
+//
+//  }  // close package namespace
+//  }  // close enterprise namespace
+//..
+// Note that such a specialization must be visible before 'bsl::deque' is
+// instantiated for the element type.
+//
 ///Usage
 ///-----
 // In this section we show intended usage of this component.
@@ -256,6 +298,31 @@ BSL_OVERRIDES_STD mode"
 
 #endif
 
+namespace BloombergLP {
+namespace bslstl {
+
+                     // ===============================
+                     // struct bslstl::DequeBlockPolicy
+                     // ===============================
+
+template <class VALUE_TYPE>
+struct DequeBlockPolicy {
+    // This 'struct' describes how a 'bsl::deque' of the parameterized
+    // 'VALUE_TYPE' manages its blocks: 'BLOCK_SIZE' is the nominal number of
+    // bytes per block, and 'MAX_SPARE_BLOCKS' is the maximum number of empty
+    // blocks a deque retains for reuse.  Clients may specialize this template
+    // for their own 'VALUE_TYPE'.
+
+    // TYPES
+    enum {
+        BLOCK_SIZE       = 200,  // nominal number of bytes per block
+        MAX_SPARE_BLOCKS = 1     // maximum number of retained empty blocks
+    };
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+
 namespace bsl {
 
 template <class VALUE_TYPE, class ALLOCATOR>
@@ -272,12 +339,15 @@ class Deque_Guard;
 template <class VALUE_TYPE>
 struct Deque_BlockLengthCalcUtil {
     // This 'struct' provides a namespace for the calculation of block length
-    // (the number of elements per block within a 'deque').  This ensures that
-    // each block in the deque can hold at least 16 elements.
+    // (the number of elements per block within a 'deque') from the block
+    // size given by 'bslstl::DequeBlockPolicy'.  This ensures that each block
+    // in the deque can hold at least 16 elements.
 
     // TYPES
     enum {
-        DEFAULT_BLOCK_SIZE = 200,  // number of bytes per block
+        DEFAULT_BLOCK_SIZE = BloombergLP::bslstl::DequeBlockPolicy<
+                                                      VALUE_TYPE>::BLOCK_SIZE,
+                                   // number of bytes per block
         BLOCK_LENGTH       = (16 * sizeof(VALUE_TYPE) >= DEFAULT_BLOCK_SIZE)
                              ? 16
                              : (DEFAULT_BLOCK_SIZE / sizeof(VALUE_TYPE))
@@ -361,6 +431,8 @@ class Deque_Base {
     std::size_t  d_blocksLength; // length of d_blocks array
     IteratorImp  d_start;        // iterator to first element
     IteratorImp  d_finish;       // iterator to one past last element
+    Block       *d_spareBlocks;  // singly-linked list of empty blocks
+                                 // retained for reuse (owned)
 
   public:
     // MANIPULATORS
@@ -535,6 +607,11 @@ class deque : public  Deque_Base<VALUE_TYPE>
     typedef BloombergLP::bslalg::DequePrimitives<VALUE_TYPE,
                                                 BLOCK_LENGTH>  DequePrimitives;
 
+    enum {
+        MAX_SPARE_BLOCKS = BloombergLP::bslstl::DequeBlockPolicy<
+                                                VALUE_TYPE>::MAX_SPARE_BLOCKS
+    };
+
     enum RawInit { RAW_INIT  = 0 };
         // Special type (and value) used to create a "raw" deque, which has 0
         // block length, and null start and finish pointers.
@@ -573,12 +650,28 @@ class deque : public  Deque_Base<VALUE_TYPE>
     deque(RawInit, const allocator_type& alloc);
         // Constructs a "raw" deque.  This deque obeys the raw deque invariants
         // and is destructible.  Postcondition: 'd_blocks == 0'
-        // 'd_blocksLength == 0', 'd_start' and 'd_finish' are singular
-        // iterators (have null internal pointers).  The constructed deque
+        // 'd_blocksLength == 0', 'd_spareBlocks == 0', 'd_start' and
+        // 'd_finish' are singular iterators (have null internal pointers).
+        // The constructed deque
         // contains no allocated storage.  The purpose of a raw deque is to
         // provide an exception-safe repository for intermediate calculations.
 
     // PRIVATE MANIPULATORS
+    Block *allocateBlock();
+        // Return the address of an uninitialized block, reusing a spare block
+        // retained by this deque if there is one, and allocating it from the
+        // allocator of this deque otherwise.
+
+    void deallocateBlock(Block *block);
+        // Retain the specified empty 'block' as a spare block of this deque if
+        // fewer than 'MAX_SPARE_BLOCKS' are currently retained, and return it
+        // to the allocator of this deque otherwise.  The behavior is undefined
+        // unless 'block' was obtained from 'allocateBlock' and no element is
+        // constructed in it.
+
+    void releaseSpareBlocks();
+        // Return all spare blocks retained by this deque to its allocator.
+
     template <class INPUT_ITER>
     size_type privateAppend(INPUT_ITER                     first,
                             INPUT_ITER                     last,
@@ -1370,10 +1463,59 @@ deque<VALUE_TYPE, ALLOCATOR>::deque(RawInit, const ALLOCATOR& basicAllocator)
 : Deque_Base<VALUE_TYPE>()
 , ContainerBase(basicAllocator)
 {
-    this->d_blocks = 0;
+    this->d_blocks      = 0;
+    this->d_spareBlocks = 0;
 }
 
 // PRIVATE MANIPULATORS
+template <class VALUE_TYPE, class ALLOCATOR>
+inline
+typename deque<VALUE_TYPE,ALLOCATOR>::Block *
+deque<VALUE_TYPE,ALLOCATOR>::allocateBlock()
+{
+    Block *block = this->d_spareBlocks;
+    if (block) {
+        // The link to the next spare block is stored in the first bytes of
+        // the (empty) block itself.
+
+        std::memcpy(&this->d_spareBlocks, block, sizeof(Block *));
+        return block;                                                 // RETURN
+    }
+    return this->allocateN((Block *) 0, 1);
+}
+
+template <class VALUE_TYPE, class ALLOCATOR>
+void deque<VALUE_TYPE,ALLOCATOR>::deallocateBlock(Block *block)
+{
+    BSLS_ASSERT_SAFE(block);
+    BSLMF_ASSERT(sizeof(Block) >= sizeof(Block *));
+
+    int    numSpares = 0;
+    Block *spare     = this->d_spareBlocks;
+    while (spare && numSpares < MAX_SPARE_BLOCKS) {
+        std::memcpy(&spare, spare, sizeof(Block *));
+        ++numSpares;
+    }
+
+    if (numSpares >= MAX_SPARE_BLOCKS) {
+        this->deallocateN(block, 1);
+        return;                                                       // RETURN
+    }
+
+    std::memcpy(block, &this->d_spareBlocks, sizeof(Block *));
+    this->d_spareBlocks = block;
+}
+
+template <class VALUE_TYPE, class ALLOCATOR>
+void deque<VALUE_TYPE,ALLOCATOR>::releaseSpareBlocks()
+{
+    while (this->d_spareBlocks) {
+        Block *block = this->d_spareBlocks;
+        std::memcpy(&this->d_spareBlocks, block, sizeof(Block *));
+        this->deallocateN(block, 1);
+    }
+}
+
 template <class VALUE_TYPE, class ALLOCATOR>
 template <class INPUT_ITER>
 typename deque<VALUE_TYPE,ALLOCATOR>::size_type
@@ -1499,7 +1641,7 @@ void deque<VALUE_TYPE,ALLOCATOR>::privateInit(size_type numElements)
     // little room at the front and back of the array for growth.
 
     BlockPtr *firstBlockPtr = &this->d_blocks[Imp::BLOCK_ARRAY_PADDING];
-    *firstBlockPtr = this->allocateN((Block*) 0, 1);
+    *firstBlockPtr = allocateBlock();
 
     // Calculate the offset into the first block such that 'n' elements will
     // leave equal space at the front of the first block and at the end of the
@@ -1674,7 +1816,7 @@ void deque<VALUE_TYPE,ALLOCATOR>::privateSplit(
 
     // Good time to allocate block for exception safety.
 
-    Block *newBlock = this->allocateN((Block*) 0, 1);
+    Block *newBlock = allocateBlock();
 
     // The following chunk of code will never throw an exception.  Move unsplit
     // blocks from 'this' to 'other', then adjust the iterators.
@@ -2090,7 +2232,10 @@ deque<VALUE_TYPE,ALLOCATOR>::~deque()
         this->deallocateN(*this->d_start.blockPtr(), 1);
     }
 
-    // Deallocate the array of block pointers.
+    // Deallocate the spare blocks (including those retained by 'clear') and
+    // the array of block pointers.
+
+    releaseSpareBlocks();
 
     this->deallocateN(this->d_blocks, this->d_blocksLength);
 }
@@ -2483,7 +2628,7 @@ void deque<VALUE_TYPE,ALLOCATOR>::pop_front()
                                                      this->d_start.valuePtr());
 
     if (1 == this->d_start.remainingInBlock()) {
-        this->deallocateN(*this->d_start.blockPtr(), 1);
+        deallocateBlock(*this->d_start.blockPtr());
         this->d_start.nextBlock();
         return;                                                       // RETURN
     }
@@ -2500,7 +2645,7 @@ void deque<VALUE_TYPE,ALLOCATOR>::pop_back()
         --this->d_finish;
         BloombergLP::bslalg::ScalarDestructionPrimitives::destroy(
                                                     this->d_finish.valuePtr());
-        this->deallocateN(this->d_finish.blockPtr()[1], 1);
+        deallocateBlock(this->d_finish.blockPtr()[1]);
         return;                                                       // RETURN
     }
 
@@ -2535,11 +2680,11 @@ deque<VALUE_TYPE,ALLOCATOR>::erase(const_iterator first,
 
     for ( ; oldStart.imp().blockPtr() != this->d_start.blockPtr();
                                                   oldStart.imp().nextBlock()) {
-        this->deallocateN(oldStart.imp().blockPtr()[0], 1);
+        deallocateBlock(oldStart.imp().blockPtr()[0]);
     }
     for ( ; oldFinish.imp().blockPtr() != this->d_finish.blockPtr();
                                              oldFinish.imp().previousBlock()) {
-        this->deallocateN(oldFinish.imp().blockPtr()[0], 1);
+        deallocateBlock(oldFinish.imp().blockPtr()[0]);
     }
     return result;
 }
@@ -2595,7 +2740,7 @@ void deque<VALUE_TYPE,ALLOCATOR>::clear()
     BlockPtr *startBlock = this->d_start.blockPtr();
     BlockPtr *finishBlock = this->d_finish.blockPtr();
     for ( ; startBlock != finishBlock; ++startBlock) {
-        this->deallocateN(*startBlock, 1);
+        deallocateBlock(*startBlock);
     }
 
     // Reposition in the middle.
@@ -2739,7 +2884,7 @@ Deque_BlockCreator<VALUE_TYPE, ALLOCATOR>::~Deque_BlockCreator()
         for (; delFirst != delLast; ++delFirst) {
             // Deallocate the block that '*d_start' points to.
 
-            d_deque_p->deallocateN(*delFirst, 1);
+            d_deque_p->deallocateBlock(*delFirst);
         }
     }
 }
@@ -2750,7 +2895,7 @@ void Deque_BlockCreator<VALUE_TYPE, ALLOCATOR>::insertAtFront(size_type n)
 {
     d_boundary = reserveBlockSlots(n, true);
     for ( ; n > 0; --n) {
-        d_boundary[-1] = d_deque_p->allocateN((Block*) 0, 1);
+        d_boundary[-1] = d_deque_p->allocateBlock();
         --d_boundary;
     }
 }
@@ -2760,7 +2905,7 @@ void Deque_BlockCreator<VALUE_TYPE, ALLOCATOR>::insertAtBack(size_type n)
 {
     d_boundary = reserveBlockSlots(n, false);
     for ( ; n > 0; --n) {
-        *d_boundary = d_deque_p->allocateN((Block*) 0, 1);
+        *d_boundary = d_deque_p->allocateBlock();
         ++d_boundary;
     }
 }
@@ -2817,7 +2962,17 @@ Deque_BlockCreator<VALUE_TYPE, ALLOCATOR>::reserveBlockSlots(
 
             newBlocksLength *= 2;
         }
-        newBlocks = d_deque_p->allocateN((BlockPtr*)0, newBlocksLength);
+        if (blocks && d_deque_p->tryExpandN(blocks,
+                                            blocksLength,
+                                            newBlocksLength)) {
+            // The blocks array was extended in place; the block pointers are
+            // re-centered within it below.
+
+            d_deque_p->d_blocksLength = newBlocksLength;
+        }
+        else {
+            newBlocks = d_deque_p->allocateN((BlockPtr*)0, newBlocksLength);
+        }
     }
 
     // Center block pointers within new blocks array.
@@ -145,8 +145,9 @@ using namespace bsl;
 //-----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
 // [11] ALLOCATOR-RELATED CONCERNS
-// [18] USAGE EXAMPLE
+// [27] USAGE EXAMPLE
 // [22] CONCERN: 'std::length_error' is used properly
+// [25] CONCERN: Empty blocks are recycled
 //
 // TEST APPARATUS: GENERATOR FUNCTIONS
 // [ 3] int ggg(deque<T,A> *object, const char *spec, int vF = 1);
@@ -288,6 +289,77 @@ const int NUM_PADDING = 2;
 const int NUM_INTERNAL_STATE_TEST = 10;
     // Number of different internal states to check.
 
+//=============================================================================
+//                      CUSTOMIZED BLOCK POLICY FOR TESTING
+//-----------------------------------------------------------------------------
+
+struct TickData {
+    // This 'struct' provides an element type for which the block policy of
+    // 'bsl::deque' is customized below.
+
+    int d_price;
+    int d_quantity;
+};
+
+namespace BloombergLP {
+namespace bslstl {
+
+template <>
+struct DequeBlockPolicy<TickData> {
+    enum {
+        BLOCK_SIZE       = 1024,
+        MAX_SPARE_BLOCKS = 3
+    };
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+
+template <class TYPE>
+Int64 numQueueAllocations(int                   queueLength,
+                          int                   numOperations,
+                          bslma::TestAllocator *testAllocator)
+    // Use a 'bsl::deque<TYPE>' supplied by the specified 'testAllocator' as a
+    // FIFO queue of the specified 'queueLength' and, once a steady state is
+    // reached, perform the specified 'numOperations' pairs of 'push_back' and
+    // 'pop_front' followed by as many pairs of 'push_front' and 'pop_back'.
+    // Return the number of allocations made during these operations.
+{
+    typedef bsl::deque<TYPE> Deque;
+
+    const int BLOCK_LENGTH = bsl::Deque_BlockLengthCalcUtil<TYPE>::
+                                                                  BLOCK_LENGTH;
+
+    Deque mX(testAllocator);  const Deque& X = mX;
+    const TYPE VALUE = TYPE();
+
+    for (int i = 0; i < queueLength; ++i) {
+        mX.push_back(VALUE);
+    }
+    for (int i = 0; i < 4 * BLOCK_LENGTH; ++i) {
+        mX.push_back(VALUE);
+        mX.pop_front();
+    }
+    for (int i = 0; i < 4 * BLOCK_LENGTH; ++i) {
+        mX.push_front(VALUE);
+        mX.pop_back();
+    }
+
+    const Int64 NUM_ALLOCATIONS = testAllocator->numAllocations();
+
+    for (int i = 0; i < numOperations; ++i) {
+        mX.push_back(VALUE);
+        mX.pop_front();
+    }
+    for (int i = 0; i < numOperations; ++i) {
+        mX.push_front(VALUE);
+        mX.pop_back();
+    }
+    ASSERT(queueLength == static_cast<int>(X.size()));
+
+    return testAllocator->numAllocations() - NUM_ALLOCATIONS;
+}
+
 //=============================================================================
 //                      GLOBAL HELPER FUNCTIONS FOR TESTING
 //-----------------------------------------------------------------------------
@@ -7916,7 +7988,7 @@ int main(int argc, char *argv[])
     printf("TEST " __FILE__ " CASE %d\n", test);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 26: {
+      case 27: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE 2
         //
@@ -8122,7 +8194,7 @@ int main(int argc, char *argv[])
         }
 //..
       } break;
-      case 25: {
+      case 26: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE 1
         //
@@ -8189,6 +8261,149 @@ int main(int argc, char *argv[])
         // Next: Wally Walters
         // Next: Fred Flintstone
       } break;
+      case 25: {
+        // --------------------------------------------------------------------
+        // CONCERN: Empty blocks are recycled
+        //
+        // Concerns:
+        //: 1 The length of a block is computed from the block size given by
+        //:   'bslstl::DequeBlockPolicy', which can be specialized for an
+        //:   element type.
+        //:
+        //: 2 Using a deque as a queue of bounded length, at either end, does
+        //:   not allocate memory once a steady state is reached.
+        //:
+        //: 3 At most 'MAX_SPARE_BLOCKS' empty blocks are retained, they are
+        //:   reused before any block is allocated, and all of them are
+        //:   returned to the allocator when the deque is destroyed.
+        //
+        // Plan:
+        //: 1 Verify the block length of deques of 'char' and 'TickData', for
+        //:   which the block policy is specialized.  (C-1)
+        //:
+        //: 2 For a set of queue lengths, perform 'push_back'/'pop_front' and
+        //:   'push_front'/'pop_back' pairs on a warmed-up deque and verify
+        //:   that no memory is allocated.  (C-2)
+        //:
+        //: 3 Fill a deque with many blocks, 'clear' it, and verify the number
+        //:   of blocks in use.  Then refill at most 'MAX_SPARE_BLOCKS' blocks
+        //:   and verify that no memory is allocated.  Finally, destroy the
+        //:   deque and verify that no memory is in use.  (C-3)
+        //
+        // Testing:
+        //   CONCERN: Empty blocks are recycled
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCONCERN: Empty blocks are recycled"
+                            "\n==================================\n");
+
+        typedef bslstl::DequeBlockPolicy<char>     CharPolicy;
+        typedef bslstl::DequeBlockPolicy<TickData> TickPolicy;
+
+        const int CHAR_BLOCK_LENGTH =
+                            bsl::Deque_BlockLengthCalcUtil<char>::BLOCK_LENGTH;
+        const int TICK_BLOCK_LENGTH =
+                        bsl::Deque_BlockLengthCalcUtil<TickData>::BLOCK_LENGTH;
+
+        if (verbose) printf("\tBlock length.\n");
+        {
+            ASSERT(200 == CharPolicy::BLOCK_SIZE);
+            ASSERT(1   == CharPolicy::MAX_SPARE_BLOCKS);
+            ASSERT(200 == CHAR_BLOCK_LENGTH);
+
+            ASSERT(1024 / sizeof(TickData) == TICK_BLOCK_LENGTH);
+            ASSERT(3 == TickPolicy::MAX_SPARE_BLOCKS);
+
+            ASSERT(16 == bsl::Deque_BlockLengthCalcUtil<L>::BLOCK_LENGTH);
+        }
+
+        if (verbose) printf("\tSteady-state queue.\n");
+        {
+            static const struct {
+                int d_lineNum;  // source line number
+                int d_length;   // queue length, in number of blocks
+                int d_extra;    // additional queue length
+            } DATA[] = {
+                //line  blocks  extra
+                //----  ------  -----
+                { L_,        0,     0 },
+                { L_,        0,     1 },
+                { L_,        0,    15 },
+                { L_,        1,    -1 },
+                { L_,        1,     0 },
+                { L_,        1,     1 },
+                { L_,        3,     7 },
+                { L_,       10,     0 },
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int LINE   = DATA[ti].d_lineNum;
+                const int BLOCKS = DATA[ti].d_length;
+                const int EXTRA  = DATA[ti].d_extra;
+
+                bslma::TestAllocator testAllocator(veryVeryVerbose);
+
+                const int CHAR_LENGTH = BLOCKS * CHAR_BLOCK_LENGTH + EXTRA;
+                const int TICK_LENGTH = BLOCKS * TICK_BLOCK_LENGTH + EXTRA;
+
+                if (veryVerbose) { T_; P_(LINE); P_(CHAR_LENGTH);
+                                                             P(TICK_LENGTH); }
+
+                LOOP_ASSERT(LINE, 0 == numQueueAllocations<char>(
+                                                       CHAR_LENGTH,
+                                                       10 * CHAR_BLOCK_LENGTH,
+                                                       &testAllocator));
+                LOOP_ASSERT(LINE, 0 == numQueueAllocations<TickData>(
+                                                       TICK_LENGTH,
+                                                       10 * TICK_BLOCK_LENGTH,
+                                                       &testAllocator));
+                LOOP_ASSERT(LINE, 0 == testAllocator.numBlocksInUse());
+            }
+        }
+
+        if (verbose) printf("\tBounded number of spare blocks.\n");
+        {
+            bslma::TestAllocator testAllocator(veryVeryVerbose);
+            {
+                bsl::deque<TickData> mX(&testAllocator);
+                const bsl::deque<TickData>& X = mX;
+
+                const TickData VALUE = { 1, 2 };
+                for (int i = 0; i < 10 * TICK_BLOCK_LENGTH; ++i) {
+                    mX.push_back(VALUE);
+                }
+                ASSERT(10 < testAllocator.numBlocksInUse());
+
+                mX.clear();
+
+                // The array of block pointers, the current block, and the
+                // spare blocks.
+
+                const Int64 NUM_BLOCKS = 2 + TickPolicy::MAX_SPARE_BLOCKS;
+
+                LOOP_ASSERT(testAllocator.numBlocksInUse(),
+                            NUM_BLOCKS == testAllocator.numBlocksInUse());
+
+                // Refill fewer elements than the spare blocks can hold (the
+                // current block is partially used after 'clear').
+
+                const Int64 NUM_ALLOCATIONS = testAllocator.numAllocations();
+                const int   LENGTH          =
+                        (TickPolicy::MAX_SPARE_BLOCKS - 1) * TICK_BLOCK_LENGTH;
+
+                for (int i = 0; i < LENGTH; ++i) {
+                    mX.push_back(VALUE);
+                }
+                LOOP_ASSERT(testAllocator.numAllocations(),
+                            NUM_ALLOCATIONS == testAllocator.numAllocations());
+                LOOP_ASSERT(testAllocator.numBlocksInUse(),
+                            NUM_BLOCKS == testAllocator.numBlocksInUse());
+                ASSERT(LENGTH == static_cast<int>(X.size()));
+            }
+            ASSERT(0 == testAllocator.numBlocksInUse());
+        }
+      } break;
       case 24: {
         // --------------------------------------------------------------------
         // TESTING EXCEPTIONS
@@ -11,6 +11,7 @@ BSLS_IDENT("$Id: $")
 //
 //@CLASSES:
 //  equal_to: C++11-compliant binary functor applying 'operator=='
+//  equal_to<void>: C++14-compliant transparent binary functor
 //
 //@SEE_ALSO: bslstl_unorderedmap, bslstl_unorderedset
 //
@@ -22,6 +23,14 @@ BSLS_IDENT("$Id: $")
 // 'bsl::unordered_map' and 'bsl::unordered_set'.  Also note that this class is
 // an empty POD type.
 //
+// The specialization 'bsl::equal_to<void>' (which may also be named
+// 'bsl::equal_to<>') applies 'operator==' to arguments of any two types, and
+// declares the nested type 'is_transparent', as specified by the C++14
+// standard.  An unordered container whose hasher and comparator are both
+// transparent provides lookup operations that accept any key type that can be
+// hashed by its hasher and compared to its keys, without converting the
+// supplied key to the key type of the container (see 'bslstl_unorderedmap').
+//
 ///Usage
 ///-----
 // This section illustrates intended usage of this component.
@@ -270,7 +279,7 @@ namespace bsl
                        // struct equal_to
                        // ===============
 
-template<class VALUE_TYPE>
+template<class VALUE_TYPE = void>
 struct equal_to {
     // This 'struct' defines a binary comparison functor applying 'operator=='
     // to two 'VALUE_TYPE' objects.  This class conforms to the C++11 standard
@@ -306,6 +315,46 @@ struct equal_to {
         // 'rhs' using the equality-comparison operator, 'lhs == rhs'.
 };
 
+                       // =====================
+                       // struct equal_to<void>
+                       // =====================
+
+template<>
+struct equal_to<void> {
+    // This 'struct' defines a binary comparison functor applying 'operator=='
+    // to two objects of (possibly different) types deduced from the arguments
+    // of each call.  This class conforms to the C++14 standard specification
+    // of 'std::equal_to<void>'.  Note that this class is an empty POD type.
+
+    // PUBLIC TYPES
+    typedef void is_transparent;
+        // Indicate to containers that this functor may compare keys of types
+        // other than their key type.
+
+    //! equal_to() = default;
+        // Create a 'equal_to' object.
+
+    //! equal_to(const equal_to& original) = default;
+        // Create a 'equal_to' object.  Note that as 'equal_to' is an empty
+        // (stateless) type, this operation will have no observable effect.
+
+    //! ~equal_to() = default;
+        // Destroy this object.
+
+    // MANIPULATORS
+    //! equal_to& operator=(const equal_to&) = default;
+        // Assign to this object the value of the specified 'rhs' object, and
+        // a return a reference providing modifiable access to this object.
+        // Note that as 'equal_to' is an empty (stateless) type, this operation
+        // will have no observable effect.
+
+    // ACCESSORS
+    template <class TYPE1, class TYPE2>
+    bool operator()(const TYPE1& lhs, const TYPE2& rhs) const;
+        // Return 'true' if the specified 'lhs' compares equal to the specified
+        // 'rhs' using the equality-comparison operator, 'lhs == rhs'.
+};
+
 }  // close namespace bsl
 
 namespace bsl {
@@ -327,6 +376,18 @@ bool equal_to<VALUE_TYPE>::operator()(const VALUE_TYPE& lhs,
     return lhs == rhs;
 }
 
+                       // --------------------------
+                       // struct bsl::equal_to<void>
+                       // --------------------------
+
+// ACCESSORS
+template <class TYPE1, class TYPE2>
+inline
+bool equal_to<void>::operator()(const TYPE1& lhs, const TYPE2& rhs) const
+{
+    return lhs == rhs;
+}
+
 }  // close namespace bsl
 
 // ============================================================================
@@ -30,13 +30,14 @@ using namespace bsl;
 //-----------------------------------------------------------------------------
 //-----------------------------------------------------------------------------
 // [ 3] operator()(const VALUE_TYPE&, const VALUE_TYPE&) const
+// [ 7] bool equal_to<void>::operator()(const T1&, const T2&) const
 // [ 2] equal_to()
 // [ 2] equal_to(const equal_to)
 // [ 2] ~equal_to()
 // [ 2] equal_to& operator=(const equal_to&)
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [ 7] USAGE EXAMPLE
+// [ 8] USAGE EXAMPLE
 // [ 4] Standard typedefs
 // [ 5] Bitwise-movable trait
 // [ 5] IsPod trait
@@ -92,6 +93,43 @@ void aSsErT(bool b, const char *s, int i)
 #define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
 #define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
 
+//=============================================================================
+//                  GLOBAL TYPES FOR TESTING
+//-----------------------------------------------------------------------------
+
+namespace {
+
+class IntHolder {
+    // This class holds an 'int' value, and is comparable with, but neither
+    // convertible to nor from, 'int'.
+
+    // DATA
+    int d_value;
+
+  public:
+    // CREATORS
+    explicit IntHolder(int value) : d_value(value) {}
+        // Create an object holding the specified 'value'.
+
+    // ACCESSORS
+    int value() const { return d_value; }
+        // Return the value held by this object.
+};
+
+bool operator==(const IntHolder& lhs, int rhs)
+    // Return 'true' if the specified 'lhs' holds the specified 'rhs'.
+{
+    return lhs.value() == rhs;
+}
+
+bool operator==(int lhs, const IntHolder& rhs)
+    // Return 'true' if the specified 'rhs' holds the specified 'lhs'.
+{
+    return lhs == rhs.value();
+}
+
+}  // close unnamed namespace
+
 //=============================================================================
 //                             USAGE EXAMPLE
 //-----------------------------------------------------------------------------
@@ -275,7 +313,7 @@ int main(int argc, char *argv[])
     bslma::Default::setGlobalAllocator(&globalAllocator);
 
     switch (test) { case 0:
-      case 8: {
+      case 9: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE 2
         //   Extracted from component header file.
@@ -329,7 +367,7 @@ int main(int argc, char *argv[])
         strcpy(buffer, "bite");
         ASSERT(0 == lsst.count(buffer));
       } break;
-      case 7: {
+      case 8: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE 1
         //   Extracted from component header file.
@@ -378,6 +416,68 @@ int main(int argc, char *argv[])
         ASSERT(0 == lsi.count(33));
         ASSERT(1 == lsi.count(32));
       } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // TRANSPARENT SPECIALIZATION
+        //
+        // Concerns:
+        //: 1 'equal_to<void>' can be named as 'equal_to<>'.
+        //:
+        //: 2 'equal_to<void>' declares the nested type 'is_transparent'.
+        //:
+        //: 3 The function call operator applies 'operator==' to arguments of
+        //:   the same or different types, without converting either argument
+        //:   to the type of the other.
+        //:
+        //: 4 'equal_to<void>' is an empty POD type.
+        //
+        // Plan:
+        //: 1 Verify that 'equal_to<>' and 'equal_to<void>' are the same type.
+        //:   (C-1)
+        //:
+        //: 2 Form the type 'equal_to<void>::is_transparent'.  (C-2)
+        //:
+        //: 3 Compare values of a type that compares equal to 'int' without
+        //:   being convertible to or from 'int', and verify the results.
+        //:   (C-3)
+        //:
+        //: 4 Verify the traits and size of 'equal_to<void>'.  (C-4)
+        //
+        // Testing:
+        //   bool equal_to<void>::operator()(const T1&, const T2&) const
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTRANSPARENT SPECIALIZATION"
+                            "\n==========================\n");
+
+        ASSERT((bsl::is_same<equal_to<>, equal_to<void> >::value));
+
+        typedef equal_to<>::is_transparent IsTransparent;
+        ASSERT((bsl::is_same<void, IsTransparent>::value));
+
+        const equal_to<> COMPARE = equal_to<>();
+
+        ASSERT( COMPARE(3, 3));
+        ASSERT(!COMPARE(3, 4));
+        ASSERT( COMPARE(3, 3L));
+        ASSERT( COMPARE('a', 97));
+
+        const char A1[] = "abc";
+        const char A2[] = "abc";
+        ASSERT( COMPARE(&A1[0], &A1[0]));
+        ASSERT(!COMPARE(&A1[0], &A2[0]));  // compares addresses
+
+        const IntHolder H3(3);
+        const IntHolder H4(4);
+        ASSERT( COMPARE(H3, 3));
+        ASSERT( COMPARE(3, H3));
+        ASSERT(!COMPARE(H4, 3));
+        ASSERT(!COMPARE(3, H4));
+
+        ASSERT(bsl::is_trivially_copyable<equal_to<> >::value);
+        ASSERT(bsl::is_trivially_default_constructible<equal_to<> >::value);
+        ASSERT(1 == sizeof(equal_to<>));
+      } break;
       case 6: {
         // --------------------------------------------------------------------
         // QoI: Is an empty type
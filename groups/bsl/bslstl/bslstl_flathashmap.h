@@ -0,0 +1,1097 @@
+// bslstl_flathashmap.h                                               -*-C++-*-
+#ifndef INCLUDED_BSLSTL_FLATHASHMAP
+#define INCLUDED_BSLSTL_FLATHASHMAP
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an open-addressing unordered map with inline storage.
+//
+//@CLASSES:
+//   bsl::flat_hash_map : open-addressing unordered map of unique keys
+//
+//@SEE_ALSO: bslstl_flathashset, bslstl_flathashtable, bslstl_unorderedmap
+//
+//@DESCRIPTION: This component defines a single class template,
+// 'flat_hash_map', implementing an unordered container holding a collection
+// of unique keys, each mapped to an associated value, having an interface
+// closely modeled on the standard 'unordered_map' [unord.map].
+//
+// A 'bsl::unordered_map' allocates a separate node for every key-value pair
+// and threads all of the nodes through a single doubly-linked list, so that a
+// lookup typically follows two or three dependent pointers, and each element
+// carries two links of overhead.  A 'flat_hash_map' instead stores its
+// key-value pairs directly in a contiguous slot array addressed by open
+// addressing (see 'bslstl_flathashtable'): a lookup examines a group of 16
+// one-byte control codes (using SSE2 where available) and then, usually, a
+// single slot.  The price of this layout is weaker stability guarantees, and
+// the absence of the bucket interface:
+//
+//: o Any insertion (including by 'operator[]'), and any call to 'rehash' or
+//:   'reserve', may invalidate all iterators, pointers, and references to the
+//:   elements of the map.
+//:
+//: o Erasing an element invalidates only iterators, pointers, and references
+//:   to the erased element.
+//:
+//: o 'bucket', 'bucket_count', 'bucket_size', 'max_bucket_count', and the
+//:   local iterators are not provided; 'capacity' reports the number of
+//:   slots, and 'max_load_factor' is fixed at 0.875.
+//
+// An instantiation of 'flat_hash_map' is an allocator-aware, value-semantic
+// type whose salient attributes are its size (number of keys) and the set of
+// key-value pairs it contains, without regard to their order.  Elements are
+// created using 'bsl::allocator_traits' of the (template parameter)
+// 'ALLOCATOR', so that, when the default 'bsl::allocator' is used, the key and
+// value of each element are supplied with the allocator of the map if their
+// types use 'bslma' allocators.  Allocators are propagated on copy
+// construction, copy assignment, and swap following the same rules as
+// 'bsl::unordered_map'.
+//
+// The default hash functor is 'bslh::Hash<>', which hashes any type that
+// provides a 'hashAppend' overload (see 'bslh_hash'), including the
+// fundamental types and 'bsl::string'.
+//
+///Requirements on 'KEY' and 'VALUE'
+///---------------------------------
+// A 'flat_hash_map' is a fully "Value-Semantic Type" (see {'bsldoc_glossary'})
+// only if the supplied 'KEY' and 'VALUE' template parameters are fully
+// value-semantic.  In addition, 'KEY' and 'VALUE' must be "copy-constructible"
+// to insert an element, 'VALUE' must be "default-constructible" to use
+// 'operator[]', and both must be "equality-comparable" for two
+// 'flat_hash_map' objects to be compared using 'operator=='.  Note that if
+// 'bsl::pair<const KEY, VALUE>' is bitwise-moveable (see
+// 'bslmf_isbitwisemoveable'), the elements are relocated with 'memcpy' when
+// the map grows, rather than being copied.
+//
+///Usage
+///-----
+// This section illustrates intended usage of this component.
+//
+///Example 1: Counting Words
+///- - - - - - - - - - - - -
+// Suppose we want to count the occurrences of each word in a document.  A map
+// from word to count is probed once per word, so the lookup performance of
+// the map dominates.
+//
+// First, we define the words of the document:
+//..
+//  const char *WORDS[] = { "the", "cat", "sat", "on", "the", "mat",
+//                          "the", "end" };
+//  const int NUM_WORDS = sizeof WORDS / sizeof *WORDS;
+//..
+// Then, we create a 'flat_hash_map' from 'bsl::string' to 'int', which (by
+// default) hashes its keys with 'bslh::Hash<>':
+//..
+//  bsl::flat_hash_map<bsl::string, int> counts;
+//..
+// Next, we count each word, using 'operator[]' to insert a zero count the
+// first time a word is seen:
+//..
+//  for (int i = 0; i < NUM_WORDS; ++i) {
+//      ++counts[WORDS[i]];
+//  }
+//..
+// Finally, we verify the counts:
+//..
+//  assert(6 == counts.size());
+//  assert(3 == counts["the"]);
+//  assert(1 == counts.at("cat"));
+//  assert(counts.end() == counts.find("dog"));
+//..
+
+#ifndef INCLUDED_BSLSCM_VERSION
+#include <bslscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_ALLOCATOR
+#include <bslstl_allocator.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_ALLOCATORTRAITS
+#include <bslstl_allocatortraits.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_EQUALTO
+#include <bslstl_equalto.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_FLATHASHTABLE
+#include <bslstl_flathashtable.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_ITERATORUTIL
+#include <bslstl_iteratorutil.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_PAIR
+#include <bslstl_pair.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_STDEXCEPTUTIL
+#include <bslstl_stdexceptutil.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_UNORDEREDMAPKEYCONFIGURATION
+#include <bslstl_unorderedmapkeyconfiguration.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_TYPETRAITHASSTLITERATORS
+#include <bslalg_typetraithasstliterators.h>
+#endif
+
+#ifndef INCLUDED_BSLH_HASH
+#include <bslh_hash.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_USESBSLMAALLOCATOR
+#include <bslma_usesbslmaallocator.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_CSTDDEF
+#include <cstddef>  // for 'std::size_t'
+#define INCLUDED_CSTDDEF
+#endif
+
+namespace bsl {
+
+                        // ===================
+                        // class flat_hash_map
+                        // ===================
+
+template <class KEY,
+          class VALUE,
+          class HASH  = ::BloombergLP::bslh::Hash<>,
+          class EQUAL = bsl::equal_to<KEY>,
+          class ALLOCATOR = bsl::allocator<bsl::pair<const KEY, VALUE> > >
+class flat_hash_map
+{
+    // This class template implements a value-semantic container type holding
+    // an unordered set of unique keys (of template parameter type 'KEY'),
+    // each mapped to an associated value (of template parameter type
+    // 'VALUE'), stored in an open-addressing hash table.
+    //
+    // This class:
+    //: o supports a complete set of *value-semantic* operations
+    //:   o except for 'bdex' serialization
+    //: o is *exception-neutral* (agnostic except for the 'at' method)
+    //: o is *alias-safe*
+    //: o is 'const' *thread-safe*
+    // For terminology see {'bsldoc_glossary'}.
+
+  private:
+
+    // PRIVATE TYPES
+    typedef bsl::allocator_traits<ALLOCATOR> AllocatorTraits;
+        // This typedef is an alias for the allocator traits type associated
+        // with this container.
+
+    typedef bsl::pair<const KEY, VALUE>  ValueType;
+        // This typedef is an alias for the type of key-value pair objects
+        // maintained by this map.
+
+    typedef ::BloombergLP::bslstl::UnorderedMapKeyConfiguration<ValueType>
+                                                             ListConfiguration;
+        // This typedef is an alias for the policy used internally by this
+        // container to extract the 'KEY' value from the key-value pair
+        // objects maintained by this map.
+
+    typedef ::BloombergLP::bslstl::FlatHashTable<ListConfiguration,
+                                                 HASH,
+                                                 EQUAL,
+                                                 ALLOCATOR> Table;
+        // This typedef is an alias for the template instantiation of the
+        // underlying 'bslstl::FlatHashTable' used to implement this map.
+
+    // FRIEND
+    template <class KEY2,
+              class VALUE2,
+              class HASH2,
+              class EQUAL2,
+              class ALLOCATOR2>
+    friend bool operator==(
+                const flat_hash_map<KEY2, VALUE2, HASH2, EQUAL2, ALLOCATOR2>&,
+                const flat_hash_map<KEY2, VALUE2, HASH2, EQUAL2, ALLOCATOR2>&);
+
+  public:
+    // PUBLIC TYPES
+    typedef KEY                                        key_type;
+    typedef VALUE                                      mapped_type;
+    typedef bsl::pair<const KEY, VALUE>                value_type;
+    typedef HASH                                       hasher;
+    typedef EQUAL                                      key_equal;
+    typedef ALLOCATOR                                  allocator_type;
+
+    typedef typename allocator_type::reference         reference;
+    typedef typename allocator_type::const_reference   const_reference;
+
+    typedef typename AllocatorTraits::size_type        size_type;
+    typedef typename AllocatorTraits::difference_type  difference_type;
+    typedef typename AllocatorTraits::pointer          pointer;
+    typedef typename AllocatorTraits::const_pointer    const_pointer;
+
+    typedef ::BloombergLP::bslstl::FlatHashTableIterator<
+                                         value_type, difference_type> iterator;
+    typedef ::BloombergLP::bslstl::FlatHashTableIterator<
+                             const value_type, difference_type> const_iterator;
+
+  private:
+    // DATA
+    Table  d_impl;
+
+  private:
+    // PRIVATE ACCESSORS
+    iterator iteratorAt(size_type index) const;
+        // Return an iterator referring to the slot at the specified 'index' of
+        // the underlying table, or the past-the-end iterator if 'index' is
+        // the capacity of the table.
+
+  public:
+    // CREATORS
+    explicit flat_hash_map(
+                      size_type             initialNumElements = 0,
+                      const hasher&         hashFunction = hasher(),
+                      const key_equal&      keyEqual = key_equal(),
+                      const allocator_type& basicAllocator = allocator_type());
+        // Construct an empty map.  Optionally specify an 'initialNumElements'
+        // indicating the number of elements the map can hold without
+        // rehashing.  If 'initialNumElements' is not supplied, or is 0, no
+        // memory is allocated.  Optionally specify a 'hashFunction' used to
+        // generate the hash values of keys.  If 'hashFunction' is not
+        // supplied, a default-constructed object of type 'hasher' is used.
+        // Optionally specify a key-equality functor 'keyEqual' used to verify
+        // that two key values are the same.  If 'keyEqual' is not supplied, a
+        // default-constructed object of type 'key_equal' is used.  Optionally
+        // specify the 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is not supplied, a default-constructed object of
+        // the (template parameter) type 'allocator_type' is used.  If the
+        // 'allocator_type' is 'bsl::allocator' (the default), then
+        // 'basicAllocator' shall be convertible to 'bslma::Allocator *', and,
+        // if 'basicAllocator' is not supplied, the currently installed default
+        // allocator will be used to supply memory.
+
+    explicit flat_hash_map(const allocator_type& basicAllocator);
+        // Construct an empty map that uses the specified 'basicAllocator' to
+        // supply memory.  Use default-constructed objects of type 'hasher' and
+        // 'key_equal' to hash and compare keys.  If the 'allocator_type' is
+        // 'bsl::allocator' (the default), then 'basicAllocator' shall be
+        // convertible to 'bslma::Allocator *'.
+
+    flat_hash_map(const flat_hash_map& original);
+    flat_hash_map(const flat_hash_map&  original,
+                  const allocator_type& basicAllocator);
+        // Construct a map having the same value, hasher, and key-equality
+        // functor as the specified 'original'.  Optionally specify the
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is not
+        // supplied, the allocator is obtained by calling
+        // 'bsl::allocator_traits<ALLOCATOR>::
+        // select_on_container_copy_construction' on the allocator of
+        // 'original'.  If the 'allocator_type' is 'bsl::allocator' (the
+        // default), then 'basicAllocator' shall be convertible to
+        // 'bslma::Allocator *'.
+
+    template <class INPUT_ITERATOR>
+    flat_hash_map(INPUT_ITERATOR        first,
+                  INPUT_ITERATOR        last,
+                  size_type             initialNumElements = 0,
+                  const hasher&         hashFunction = hasher(),
+                  const key_equal&      keyEqual = key_equal(),
+                  const allocator_type& basicAllocator = allocator_type());
+        // Construct a map and insert each 'value_type' object in the sequence
+        // starting at the specified 'first' element, and ending immediately
+        // before the specified 'last' element, ignoring those pairs having a
+        // key that appears earlier in the sequence.  Optionally specify
+        // 'initialNumElements', 'hashFunction', 'keyEqual', and
+        // 'basicAllocator' having the same meaning as for the default
+        // constructor.  The (template parameter) type 'INPUT_ITERATOR' shall
+        // meet the requirements of an input iterator defined in the C++11
+        // standard [24.2.3] providing access to values of a type convertible
+        // to 'value_type'.  The behavior is undefined unless 'first' and
+        // 'last' refer to a sequence of valid values where 'first' is at a
+        // position at or before 'last'.
+
+    ~flat_hash_map();
+        // Destroy this object.
+
+    // MANIPULATORS
+    flat_hash_map& operator=(const flat_hash_map& rhs);
+        // Assign to this object the value, hasher, and key-equality functor of
+        // the specified 'rhs' object, propagate to this object the allocator
+        // of 'rhs' if the 'ALLOCATOR' type has trait
+        // 'propagate_on_container_copy_assignment', and return a reference
+        // providing modifiable access to this object.
+
+    mapped_type& operator[](const key_type& key);
+        // Return a reference providing modifiable access to the mapped-value
+        // associated with the specified 'key' in this map; if this map does
+        // not already contain a 'value_type' object with 'key', first insert a
+        // new 'value_type' object having 'key' and a default-constructed
+        // 'VALUE' object.  This method requires that the (template parameter)
+        // type 'KEY' is "copy-constructible" and the (template parameter)
+        // 'VALUE' is "default-constructible" (see {Requirements on 'KEY' and
+        // 'VALUE'}).
+
+    mapped_type& at(const key_type& key);
+        // Return a reference providing modifiable access to the mapped-value
+        // associated with the specified 'key', if such an entry exists;
+        // otherwise throw a 'std::out_of_range' exception.  Note that this
+        // method is not exception agnostic.
+
+    iterator begin();
+        // Return an iterator providing modifiable access to the first
+        // 'value_type' object (in the sequence of 'value_type' objects)
+        // maintained by this map, or the 'end' iterator if this map is empty.
+
+    iterator end();
+        // Return an iterator providing modifiable access to the past-the-end
+        // element in the sequence of 'value_type' objects maintained by this
+        // map.
+
+    void clear();
+        // Remove all entries from this map.  Note that the container is empty
+        // after this call, but allocated memory is retained for future use.
+
+    pair<iterator, iterator> equal_range(const key_type& key);
+        // Return a pair of iterators providing modifiable access to the
+        // sequence of 'value_type' objects in this map having the specified
+        // 'key', where the first iterator is positioned at the start of the
+        // sequence, and the second is positioned one past the end of the
+        // sequence.  If this map contains no 'value_type' objects having
+        // 'key', then the two returned iterators will have the same value.
+        // Note that since a map maintains unique keys, the range will contain
+        // at most one element.
+
+    size_type erase(const key_type& key);
+        // Remove from this map the 'value_type' object having the specified
+        // 'key', if it exists, and return 1; otherwise, if there is no
+        // 'value_type' object having 'key', return 0 with no other effect.
+
+    iterator erase(const_iterator position);
+        // Remove from this map the 'value_type' object at the specified
+        // 'position', and return an iterator referring to the element
+        // immediately following the removed element, or to the past-the-end
+        // position if the removed element was the last element in the
+        // sequence of elements maintained by this map.  The behavior is
+        // undefined unless 'position' refers to a 'value_type' object in this
+        // map.
+
+    iterator erase(const_iterator first, const_iterator last);
+        // Remove from this map the 'value_type' objects starting at the
+        // specified 'first' position up to, but not including the specified
+        // 'last' position, and return 'last'.  The behavior is undefined
+        // unless 'first' and 'last' either refer to elements in this map or
+        // are the 'end' iterator, and the 'first' position is at or before the
+        // 'last' position in the sequence provided by this container.
+
+    iterator find(const key_type& key);
+        // Return an iterator providing modifiable access to the 'value_type'
+        // object in this map having the specified 'key', if such an entry
+        // exists, and the past-the-end ('end') iterator otherwise.
+
+    pair<iterator, bool> insert(const value_type& value);
+        // Insert the specified 'value' into this map if the key (the 'first'
+        // element) of 'value' does not already exist in this map; otherwise,
+        // this method has no effect.  Return a pair whose 'first' member is an
+        // iterator referring to the (possibly newly inserted) 'value_type'
+        // object in this map whose key is the same as that of 'value', and
+        // whose 'second' member is 'true' if a new value was inserted, and
+        // 'false' if the key was already present.  This method requires that
+        // the (template parameter) types 'KEY' and 'VALUE' both be
+        // "copy-constructible" (see {Requirements on 'KEY' and 'VALUE'}).
+
+    iterator insert(const_iterator hint, const value_type& value);
+        // Insert the specified 'value' into this map if the key (the 'first'
+        // element) of 'value' does not already exist in this map, and return
+        // an iterator referring to the (possibly newly inserted) 'value_type'
+        // object in this map whose key is the same as that of 'value'.  The
+        // specified 'hint' is ignored.  This method requires that the
+        // (template parameter) types 'KEY' and 'VALUE' both be
+        // "copy-constructible" (see {Requirements on 'KEY' and 'VALUE'}).
+
+    template <class INPUT_ITERATOR>
+    void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        // Insert into this map the value of each 'value_type' object in the
+        // range starting at the specified 'first' iterator and ending
+        // immediately before the specified 'last' iterator, whose key is not
+        // already contained in this map.  The (template parameter) type
+        // 'INPUT_ITERATOR' shall meet the requirements of an input iterator
+        // defined in the C++11 standard [24.2.3] providing access to values of
+        // a type convertible to 'value_type'.  This method requires that the
+        // (template parameter) types 'KEY' and 'VALUE' both be
+        // "copy-constructible" (see {Requirements on 'KEY' and 'VALUE'}).
+
+    void rehash(size_type numSlots);
+        // Change the capacity of this map to at least the specified
+        // 'numSlots', and sufficient to hold 'size()' elements without
+        // exceeding the maximum load factor, and redistribute all the
+        // contained elements into the new slot array.  If both 'numSlots' and
+        // 'size()' are 0, release all memory held by this map.
+
+    void reserve(size_type numElements);
+        // Increase the capacity of this map, if needed, so that it can hold
+        // the specified 'numElements' without rehashing.  Note that this
+        // operation has no effect if 'numElements <= size()'.
+
+    void swap(flat_hash_map& other);
+        // Exchange the value of this object as well as its hasher and
+        // key-equality functor with those of the specified 'other' object.
+        // Additionally, if
+        // 'bsl::allocator_traits<ALLOCATOR>::propagate_on_container_swap' is
+        // 'true', then exchange the allocator of this object with that of the
+        // 'other' object, and do not modify either allocator otherwise.  This
+        // method provides the no-throw exception-safety guarantee and
+        // guarantees O[1] complexity.  The behavior is undefined unless either
+        // this object was created with the same allocator as 'other' or
+        // 'propagate_on_container_swap' is 'true'.
+
+    // ACCESSORS
+    const mapped_type& at(const key_type& key) const;
+        // Return a reference providing non-modifiable access to the
+        // mapped-value associated with the specified 'key', if such an entry
+        // exists; otherwise throw a 'std::out_of_range' exception.  Note that
+        // this method is not exception agnostic.
+
+    const_iterator begin() const;
+    const_iterator cbegin() const;
+        // Return an iterator providing non-modifiable access to the first
+        // 'value_type' object (in the sequence of 'value_type' objects)
+        // maintained by this map, or the 'end' iterator if this map is empty.
+
+    const_iterator end() const;
+    const_iterator cend() const;
+        // Return an iterator providing non-modifiable access to the
+        // past-the-end element (in the sequence of 'value_type' objects)
+        // maintained by this map.
+
+    size_type capacity() const;
+        // Return the number of slots in the slot array of this map.
+
+    size_type count(const key_type& key) const;
+        // Return the number of 'value_type' objects within this map having the
+        // specified 'key'.  Note that since a map maintains unique keys, the
+        // returned value will be either 0 or 1.
+
+    bool empty() const;
+        // Return 'true' if this map contains no elements, and 'false'
+        // otherwise.
+
+    pair<const_iterator, const_iterator> equal_range(
+                                                    const key_type& key) const;
+        // Return a pair of iterators providing non-modifiable access to the
+        // sequence of 'value_type' objects in this map having the specified
+        // 'key', where the first iterator is positioned at the start of the
+        // sequence and the second iterator is positioned one past the end of
+        // the sequence.  If this map contains no 'value_type' objects having
+        // 'key' then the two returned iterators will have the same value.
+
+    const_iterator find(const key_type& key) const;
+        // Return an iterator providing non-modifiable access to the
+        // 'value_type' object in this map having the specified 'key', if such
+        // an entry exists, and the past-the-end ('end') iterator otherwise.
+
+    allocator_type get_allocator() const;
+        // Return (a copy of) the allocator used for memory allocation by this
+        // map.
+
+    hasher hash_function() const;
+        // Return (a copy of) the hash unary functor used by this map to
+        // generate a hash value (of type 'size_t') for a 'key_type' object.
+
+    key_equal key_eq() const;
+        // Return (a copy of) the key-equality binary functor that returns
+        // 'true' if the value of two 'key_type' objects is the same, and
+        // 'false' otherwise.
+
+    float load_factor() const;
+        // Return the current ratio between the 'size' of this container and
+        // its 'capacity', or 0 if the capacity is 0.
+
+    float max_load_factor() const;
+        // Return the maximum load factor allowed for this container.  Note
+        // that the maximum load factor of a 'flat_hash_map' is fixed at
+        // 0.875.
+
+    size_type max_size() const;
+        // Return a theoretical upper bound on the largest number of elements
+        // that this map could possibly hold.  Note that there is no guarantee
+        // that the map can successfully grow to the returned size, or even
+        // close to that size without running out of resources.
+
+    size_type size() const;
+        // Return the number of elements in this map.
+};
+
+// FREE FUNCTIONS
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+bool operator==(const flat_hash_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>& lhs,
+                const flat_hash_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects have the same
+    // value, and 'false' otherwise.  Two 'flat_hash_map' objects have the same
+    // value if they have the same number of key-value pairs, and for each
+    // key-value pair that is contained in 'lhs' there is a key-value pair
+    // contained in 'rhs' having the same value, and vice-versa.  This method
+    // requires that the (template parameter) types 'KEY' and 'VALUE' both be
+    // "equality-comparable" (see {Requirements on 'KEY' and 'VALUE'}).
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+bool operator!=(const flat_hash_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>& lhs,
+                const flat_hash_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects do not have the
+    // same value, and 'false' otherwise.  Two 'flat_hash_map' objects do not
+    // have the same value if they do not have the same number of key-value
+    // pairs, or that for some key-value pair contained in 'lhs' there is not
+    // a key-value pair in 'rhs' having the same value, and vice-versa.  This
+    // method requires that the (template parameter) types 'KEY' and 'VALUE'
+    // both be "equality-comparable" (see {Requirements on 'KEY' and
+    // 'VALUE'}).
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+void swap(flat_hash_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>& x,
+          flat_hash_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>& y);
+    // Exchange the value, hasher, and key-equality functor of the specified
+    // 'x' object with those of the specified 'y' object.  Additionally, if
+    // 'bsl::allocator_traits<ALLOCATOR>::propagate_on_container_swap' is
+    // 'true', then exchange the allocator of 'x' with that of 'y', and do not
+    // modify either allocator otherwise.  This method provides the no-throw
+    // exception-safety guarantee and guarantees O[1] complexity.  The behavior
+    // is undefined unless either 'x' was created with the same allocator as
+    // 'y' or 'propagate_on_container_swap' is 'true'.
+
+// ============================================================================
+//                  TEMPLATE AND INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+                        //--------------------
+                        // class flat_hash_map
+                        //--------------------
+
+// PRIVATE ACCESSORS
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+inline
+typename flat_hash_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::iterator
+flat_hash_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::iteratorAt(
+                                                         size_type index) const
+{
+    return iterator(d_impl.controlAddress(index),
+                    const_cast<ValueType *>(d_impl.elementAddress(index)));
+}
+
+// CREATORS
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+inline
+flat_hash_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::flat_hash_map(
+                                      size_type             initialNumElements,
+                                      const hasher&         hashFunction,
+                                      const key_equal&      keyEqual,
+                                      const allocator_type& basicAllocator)
+: d_impl(hashFunction, keyEqual, initialNumElements, basicAllocator)
+{
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+inline
+flat_hash_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::flat_hash_map(
+                                          const allocator_type& basicAllocator)
+: d_impl(basicAllocator)
+{
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+inline
+flat_hash_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::flat_hash_map(
+                                                 const flat_hash_map& original)
+: d_impl(original.d_impl,
+         AllocatorTraits::select_on_container_copy_construction(
+                                                     original.get_allocator()))
+{
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+inline
+flat_hash_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::flat_hash_map(
+                                          const flat_hash_map&  original,
+                                          const allocator_type& basicAllocator)
+: d_impl(original.d_impl, basicAllocator)
+{
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+inline
+flat_hash_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::flat_hash_map(
+                                      INPUT_ITERATOR        first,
+                                      INPUT_ITERATOR        last,
+                                      size_type             initialNumElements,
+                                      const hasher&         hashFunction,
+                                      const key_equal&      keyEqual,
+                                      const allocator_type& basicAllocator)
+: d_impl(hashFunction, keyEqual, initialNumElements, basicAllocator)
+{
+    this->insert(first, last);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+inline
+flat_hash_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::~flat_hash_map()
+{
+    // All memory management is handled by the base 'd_impl' member.
+}
+
+// MANIPULATORS
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+inline
+flat_hash_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>&
+flat_hash_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::operator=(
+                                                      const flat_hash_map& rhs)
+{
+    d_impl = rhs.d_impl;
+    return *this;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+inline
+typename flat_hash_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::mapped_type&
+flat_hash_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::operator[](
+                                                           const key_type& key)
+{
+    return d_impl.elementAddress(d_impl.insertIfMissing(key))->second;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+inline
+typename flat_hash_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::mapped_type&
+flat_hash_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::at(const key_type& key)
+{
+    const size_type index = d_impl.find(key);
+
+    if (index == d_impl.capacity()) {
+        BloombergLP::bslstl::StdExceptUtil::throwOutOfRange(
+                        "flat_hash_map<...>::at(key_type): invalid key value");
+    }
+
+    return d_impl.elementAddress(index)->second;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+inline
+typename flat_hash_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::iterator
+flat_hash_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::begin()
+{
+    return iteratorAt(d_impl.firstIndex());
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+inline
+typename flat_hash_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::iterator
+flat_hash_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::end()
+{
+    return iteratorAt(d_impl.capacity());
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+inline
+void
+flat_hash_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::clear()
+{
+    d_impl.removeAll();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+inline
+bsl::pair<typename flat_hash_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::iterator,
+          typename flat_hash_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::iterator>
+flat_hash_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::equal_range(
+                                                           const key_type& key)
+{
+    typedef bsl::pair<iterator, iterator> ResultType;
+
+    iterator first = this->find(key);
+    if (first == this->end()) {
+        return ResultType(first, first);                              // RETURN
+    }
+    else {
+        iterator next = first;
+        return ResultType(first, ++next);                             // RETURN
+    }
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+inline
+typename flat_hash_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::size_type
+flat_hash_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::erase(const key_type& key)
+{
+    const size_type index = d_impl.find(key);
+    if (index != d_impl.capacity()) {
+        d_impl.remove(index);
+        return 1;                                                     // RETURN
+    }
+    else {
+        return 0;                                                     // RETURN
+    }
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+inline
+typename flat_hash_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::iterator
+flat_hash_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::erase(
+                                                       const_iterator position)
+{
+    BSLS_ASSERT(position != this->end());
+
+    const size_type index = position.slot() - d_impl.elementAddress(0);
+    d_impl.remove(index);
+    return iteratorAt(d_impl.nextIndex(index));
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+inline
+typename flat_hash_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::iterator
+flat_hash_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::erase(const_iterator first,
+                                                  const_iterator last)
+{
+    while (first != last) {
+        first = this->erase(first);
+    }
+
+    return iterator(first.control(), first.slot());  // convert from
+                                                      // 'const_iterator'
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+inline
+typename flat_hash_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::iterator
+flat_hash_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::find(const key_type& key)
+{
+    return iteratorAt(d_impl.find(key));
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+inline
+bsl::pair<typename flat_hash_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::iterator,
+          bool>
+flat_hash_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::insert(
+                                                       const value_type& value)
+{
+    typedef bsl::pair<iterator, bool> ResultType;
+
+    bool isInsertedFlag = false;
+
+    const size_type index = d_impl.insertIfMissing(&isInsertedFlag, value);
+
+    return ResultType(iteratorAt(index), isInsertedFlag);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+inline
+typename flat_hash_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::iterator
+flat_hash_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::insert(const_iterator,
+                                                   const value_type& value)
+{
+    // The slot of an element depends only on the hash code of its key, so
+    // there is no use for the hint.
+
+    return this->insert(value).first;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+inline
+void flat_hash_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::insert(
+                                                          INPUT_ITERATOR first,
+                                                           INPUT_ITERATOR last)
+{
+    if (size_type maxInsertions =
+            ::BloombergLP::bslstl::IteratorUtil::insertDistance(first, last)) {
+        this->reserve(this->size() + maxInsertions);
+    }
+
+    bool isInsertedFlag;  // value is not used
+
+    while (first != last) {
+        d_impl.insertIfMissing(&isInsertedFlag, *first);
+        ++first;
+    }
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+inline
+void
+flat_hash_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::rehash(size_type numSlots)
+{
+    d_impl.rehash(numSlots);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+inline
+void
+flat_hash_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::reserve(
+                                                         size_type numElements)
+{
+    d_impl.reserveForNumElements(numElements);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+inline
+void
+flat_hash_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::swap(flat_hash_map& other)
+{
+    d_impl.swap(other.d_impl);
+}
+
+// ACCESSORS
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+inline
+const typename
+flat_hash_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::mapped_type&
+flat_hash_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::at(
+                                                     const key_type& key) const
+{
+    const size_type index = d_impl.find(key);
+
+    if (index == d_impl.capacity()) {
+        BloombergLP::bslstl::StdExceptUtil::throwOutOfRange(
+                  "flat_hash_map<...>::at(key_type) const: invalid key value");
+    }
+
+    return d_impl.elementAddress(index)->second;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+inline
+typename flat_hash_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::const_iterator
+flat_hash_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::begin() const
+{
+    return iteratorAt(d_impl.firstIndex());
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+inline
+typename flat_hash_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::const_iterator
+flat_hash_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::end() const
+{
+    return iteratorAt(d_impl.capacity());
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+inline
+typename flat_hash_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::const_iterator
+flat_hash_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::cbegin() const
+{
+    return iteratorAt(d_impl.firstIndex());
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+inline
+typename flat_hash_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::const_iterator
+flat_hash_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::cend() const
+{
+    return iteratorAt(d_impl.capacity());
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+inline
+typename flat_hash_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::size_type
+flat_hash_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::capacity() const
+{
+    return d_impl.capacity();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+inline
+typename flat_hash_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::size_type
+flat_hash_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::count(
+                                                     const key_type& key) const
+{
+    return d_impl.find(key) != d_impl.capacity();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+inline
+bool
+flat_hash_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::empty() const
+{
+    return 0 == d_impl.size();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+inline
+bsl::pair<typename flat_hash_map<KEY,
+                                 VALUE,
+                                 HASH,
+                                 EQUAL,
+                                 ALLOCATOR>::const_iterator,
+          typename flat_hash_map<KEY,
+                                 VALUE,
+                                 HASH,
+                                 EQUAL,
+                                 ALLOCATOR>::const_iterator>
+flat_hash_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::equal_range(
+                                                     const key_type& key) const
+{
+    typedef bsl::pair<const_iterator, const_iterator> ResultType;
+
+    const_iterator first = this->find(key);
+    if (first == this->end()) {
+        return ResultType(first, first);                              // RETURN
+    }
+    else {
+        const_iterator next = first;
+        return ResultType(first, ++next);                             // RETURN
+    }
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+inline
+typename flat_hash_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::const_iterator
+flat_hash_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::find(
+                                                     const key_type& key) const
+{
+    return iteratorAt(d_impl.find(key));
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+inline
+ALLOCATOR
+flat_hash_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::get_allocator() const
+{
+    return d_impl.allocator();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+inline
+typename flat_hash_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::hasher
+flat_hash_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::hash_function() const
+{
+    return d_impl.hasher();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+inline
+typename flat_hash_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::key_equal
+flat_hash_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::key_eq() const
+{
+    return d_impl.comparator();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+inline
+float
+flat_hash_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::load_factor() const
+{
+    return d_impl.loadFactor();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+inline
+float
+flat_hash_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::max_load_factor() const
+{
+    return d_impl.maxLoadFactor();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+inline
+typename flat_hash_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::size_type
+flat_hash_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::max_size() const
+{
+    return d_impl.maxSize();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+inline
+typename flat_hash_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::size_type
+flat_hash_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::size() const
+{
+    return d_impl.size();
+}
+
+}  // close namespace bsl
+
+// FREE FUNCTIONS
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+inline
+bool bsl::operator==(
+             const bsl::flat_hash_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>& lhs,
+             const bsl::flat_hash_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>& rhs)
+{
+    return lhs.d_impl == rhs.d_impl;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+inline
+bool bsl::operator!=(
+             const bsl::flat_hash_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>& lhs,
+             const bsl::flat_hash_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+inline
+void bsl::swap(bsl::flat_hash_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>& x,
+               bsl::flat_hash_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>& y)
+{
+    x.swap(y);
+}
+
+// ============================================================================
+//                                TYPE TRAITS
+// ============================================================================
+
+// Type traits for flat unordered containers:
+//: o A flat unordered container defines STL iterators.
+//: o A flat unordered container uses 'bslma' allocators if the parameterized
+//:      'ALLOCATOR' is convertible from 'bslma::Allocator*'.
+
+namespace BloombergLP {
+
+namespace bslalg {
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+struct HasStlIterators<bsl::flat_hash_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR> >
+     : bsl::true_type
+{};
+
+}  // close package namespace
+
+namespace bslma {
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+struct UsesBslmaAllocator<
+                  bsl::flat_hash_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR> >
+     : bsl::is_convertible<Allocator*, ALLOCATOR>::type
+{};
+
+}  // close package namespace
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
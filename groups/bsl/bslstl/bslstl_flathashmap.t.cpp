@@ -0,0 +1,648 @@
+// bslstl_flathashmap.t.cpp                                           -*-C++-*-
+
+#include <bslstl_flathashmap.h>
+
+#include <bslstl_string.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatormonitor.h>
+#include <bsls_bsltestutil.h>
+#include <bsls_nativestd.h>
+
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <stdexcept>
+
+using namespace BloombergLP;
+using namespace std;
+
+//=============================================================================
+//                             TEST PLAN
+//-----------------------------------------------------------------------------
+//                             Overview
+//                             --------
+// The component under test is a value-semantic container that forwards most
+// of its work to 'bslstl::FlatHashTable', which is tested in its own test
+// driver.  Here we concentrate on the parts of the interface specific to a
+// map: the mapped-value accessors 'operator[]' and 'at', mutation of mapped
+// values through iterators, and the propagation of the container's allocator
+// to keys and mapped values that themselves allocate memory (we use
+// 'bsl::string' for both), including when elements are relocated as the map
+// grows.
+//-----------------------------------------------------------------------------
+// CREATORS
+// [ 1] explicit flat_hash_map(const allocator_type& basicAllocator);
+// [ 3] flat_hash_map(const flat_hash_map& original);
+// [ 3] flat_hash_map(const flat_hash_map& original, basicAllocator);
+// [ 2] flat_hash_map(INPUT_ITERATOR first, INPUT_ITERATOR last, ...);
+// [ 1] ~flat_hash_map();
+//
+// MANIPULATORS
+// [ 3] flat_hash_map& operator=(const flat_hash_map& rhs);
+// [ 4] mapped_type& operator[](const key_type& key);
+// [ 4] mapped_type& at(const key_type& key);
+// [ 1] iterator begin();
+// [ 1] iterator end();
+// [ 2] void clear();
+// [ 2] pair<iterator, iterator> equal_range(const key_type& key);
+// [ 2] size_type erase(const key_type& key);
+// [ 2] iterator erase(const_iterator position);
+// [ 2] iterator erase(const_iterator first, const_iterator last);
+// [ 1] iterator find(const key_type& key);
+// [ 1] pair<iterator, bool> insert(const value_type& value);
+// [ 2] iterator insert(const_iterator hint, const value_type& value);
+// [ 2] void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+// [ 2] void rehash(size_type numSlots);
+// [ 2] void reserve(size_type numElements);
+// [ 3] void swap(flat_hash_map& other);
+//
+// ACCESSORS
+// [ 4] const mapped_type& at(const key_type& key) const;
+// [ 1] const_iterator begin() const;
+// [ 1] const_iterator end() const;
+// [ 1] size_type count(const key_type& key) const;
+// [ 1] bool empty() const;
+// [ 1] const_iterator find(const key_type& key) const;
+// [ 3] allocator_type get_allocator() const;
+// [ 1] size_type size() const;
+//
+// FREE OPERATORS
+// [ 3] bool operator==(const flat_hash_map& lhs, const flat_hash_map& rhs);
+// [ 3] bool operator!=(const flat_hash_map& lhs, const flat_hash_map& rhs);
+// [ 3] void swap(flat_hash_map& a, flat_hash_map& b);
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 5] USAGE EXAMPLE
+//-----------------------------------------------------------------------------
+
+//=============================================================================
+//                  STANDARD BDE ASSERT TEST MACRO
+//-----------------------------------------------------------------------------
+static int testStatus = 0;
+
+static void aSsErT(bool b, const char *s, int i) {
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+//=============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef bsl::flat_hash_map<int, int>                 Obj;
+typedef bsl::flat_hash_map<bsl::string, bsl::string> StringMap;
+
+namespace {
+
+const char *const LONG_STRING = "This string is long enough to allocate.";
+
+bsl::string makeKey(int value, bslma::Allocator *basicAllocator)
+    // Return a string, longer than the short-string buffer of 'bsl::string'
+    // and using the specified 'basicAllocator' to supply memory, that is
+    // unique to the specified 'value'.
+{
+    bsl::string result(LONG_STRING, basicAllocator);
+    result.push_back(static_cast<char>('A' + value % 26));
+    result.push_back(static_cast<char>('A' + value / 26 % 26));
+    result.push_back(static_cast<char>('A' + value / 676 % 26));
+    return result;
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+    bool verbose = argc > 2;
+    bool veryVerbose = argc > 3;
+    bool veryVeryVerbose = argc > 4;
+
+    (void)veryVerbose;
+    (void)veryVeryVerbose;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVerbose);
+    bslma::DefaultAllocatorGuard defaultAllocatorGuard(&defaultAllocator);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 5: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+///Usage
+///-----
+// This section illustrates intended usage of this component.
+//
+///Example 1: Counting Words
+///- - - - - - - - - - - - -
+// Suppose we want to count the occurrences of each word in a document.  A map
+// from word to count is probed once per word, so the lookup performance of
+// the map dominates.
+//
+// First, we define the words of the document:
+//..
+    const char *WORDS[] = { "the", "cat", "sat", "on", "the", "mat",
+                            "the", "end" };
+    const int NUM_WORDS = sizeof WORDS / sizeof *WORDS;
+//..
+// Then, we create a 'flat_hash_map' from 'bsl::string' to 'int', which (by
+// default) hashes its keys with 'bslh::Hash<>':
+//..
+    bsl::flat_hash_map<bsl::string, int> counts;
+//..
+// Next, we count each word, using 'operator[]' to insert a zero count the
+// first time a word is seen:
+//..
+    for (int i = 0; i < NUM_WORDS; ++i) {
+        ++counts[WORDS[i]];
+    }
+//..
+// Finally, we verify the counts:
+//..
+    ASSERT(6 == counts.size());
+    ASSERT(3 == counts["the"]);
+    ASSERT(1 == counts.at("cat"));
+    ASSERT(counts.end() == counts.find("dog"));
+//..
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // MAPPED-VALUE ACCESS
+        //
+        // Concerns:
+        //: 1 'operator[]' returns a reference to the mapped value of an
+        //:   existing element, and otherwise inserts an element having a
+        //:   value-initialized mapped value.
+        //:
+        //: 2 'at' returns a reference to the mapped value of an existing
+        //:   element, and otherwise throws 'std::out_of_range' without
+        //:   modifying the map.
+        //:
+        //: 3 A mapped value may be modified through an 'iterator'.
+        //:
+        //: 4 A mapped value inserted by 'operator[]' uses the allocator of the
+        //:   map.
+        //
+        // Plan:
+        //: 1 Use 'operator[]' and 'at' to create and modify mapped values, and
+        //:   verify the results using 'find'.  (C-1..3)
+        //:
+        //: 2 When exceptions are enabled, call 'at' with a missing key and
+        //:   verify that 'std::out_of_range' is thrown.  (C-2)
+        //:
+        //: 3 Use 'operator[]' on a map of strings using a test allocator, and
+        //:   verify that the default allocator is not used.  (C-4)
+        //
+        // Testing:
+        //   mapped_type& operator[](const key_type& key);
+        //   mapped_type& at(const key_type& key);
+        //   const mapped_type& at(const key_type& key) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nMAPPED-VALUE ACCESS"
+                            "\n===================\n");
+
+        bslma::TestAllocator oa("object", veryVeryVerbose);
+
+        if (verbose) printf("\nTesting 'operator[]' and 'at'.\n");
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+
+            ASSERT(0 == mX[1]);
+            ASSERT(1 == X.size());
+
+            mX[1] = 10;
+            mX[2] = 20;
+            ASSERT(10 == X.at(1));
+            ASSERT(20 == mX.at(2));
+            ASSERT(2  == X.size());
+
+            mX.at(2) = 21;
+            ASSERT(21 == X.find(2)->second);
+
+            for (Obj::iterator it = mX.begin(); it != mX.end(); ++it) {
+                it->second *= 2;
+            }
+            ASSERT(20 == X.at(1));
+            ASSERT(42 == X.at(2));
+
+#ifdef BDE_BUILD_TARGET_EXC
+            bool threw = false;
+            try {
+                mX.at(3);
+            }
+            catch (const native_std::out_of_range&) {
+                threw = true;
+            }
+            ASSERT(threw);
+
+            threw = false;
+            try {
+                X.at(3);
+            }
+            catch (const native_std::out_of_range&) {
+                threw = true;
+            }
+            ASSERT(threw);
+            ASSERT(2 == X.size());
+#endif
+        }
+
+        if (verbose) printf("\nTesting allocator-aware mapped values.\n");
+        {
+            StringMap mX(&oa);  const StringMap& X = mX;
+
+            for (int i = 0; i < 100; ++i) {
+                const bsl::string KEY = makeKey(i, &oa);
+                mX[KEY] = LONG_STRING;
+                LOOP_ASSERT(i, &oa == X.at(KEY).get_allocator().mechanism());
+            }
+            ASSERT(100 == X.size());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // COPY, ASSIGNMENT, SWAP, AND EQUALITY
+        //
+        // Concerns:
+        //: 1 A copy compares equal to the original, and it and its elements
+        //:   use the supplied allocator, or the default allocator if none is
+        //:   supplied.
+        //:
+        //: 2 Assignment gives the target the value of the source, and retains
+        //:   the allocator of the target.
+        //:
+        //: 3 Member and free 'swap' exchange the values of two maps having
+        //:   the same allocator without allocating memory.
+        //:
+        //: 4 Maps compare unequal if an element has a different mapped value.
+        //
+        // Plan:
+        //: 1 Using test allocators, create maps of strings of various sizes,
+        //:   copy, assign, and swap them, and verify the values, allocators,
+        //:   and allocations of the results.  (C-1..4)
+        //
+        // Testing:
+        //   flat_hash_map(const flat_hash_map& original);
+        //   flat_hash_map(const flat_hash_map& original, basicAllocator);
+        //   flat_hash_map& operator=(const flat_hash_map& rhs);
+        //   void swap(flat_hash_map& other);
+        //   allocator_type get_allocator() const;
+        //   bool operator==(const flat_hash_map& lhs, const flat_hash_map&);
+        //   bool operator!=(const flat_hash_map& lhs, const flat_hash_map&);
+        //   void swap(flat_hash_map& a, flat_hash_map& b);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCOPY, ASSIGNMENT, SWAP, AND EQUALITY"
+                            "\n====================================\n");
+
+        bslma::TestAllocator oa("object",  veryVeryVerbose);
+        bslma::TestAllocator za("other",   veryVeryVerbose);
+        bslma::TestAllocator sa("scratch", veryVeryVerbose);
+
+        for (int n = 0; n < 60; n += 11) {
+            StringMap mX(&oa);  const StringMap& X = mX;
+            for (int i = 0; i < n; ++i) {
+                mX[makeKey(i, &sa)] = makeKey(i + 1, &sa);
+            }
+
+            {
+                StringMap mY(X);  const StringMap& Y = mY;
+                LOOP_ASSERT(n, X == Y);
+                LOOP_ASSERT(n, &defaultAllocator ==
+                                        Y.get_allocator().mechanism());
+            }
+            ASSERT(0 == defaultAllocator.numBlocksInUse());
+            {
+                StringMap mY(X, &za);  const StringMap& Y = mY;
+                LOOP_ASSERT(n, X == Y);
+                LOOP_ASSERT(n, &za == Y.get_allocator().mechanism());
+                for (StringMap::const_iterator it = Y.begin();
+                     it != Y.end();
+                     ++it) {
+                    LOOP_ASSERT(n, &za ==
+                                       it->first.get_allocator().mechanism());
+                    LOOP_ASSERT(n, &za ==
+                                      it->second.get_allocator().mechanism());
+                }
+
+                if (n) {
+                    mY.begin()->second = "different";
+                    LOOP_ASSERT(n, X != Y);
+                }
+            }
+            {
+                StringMap mY(&za);  const StringMap& Y = mY;
+                mY[makeKey(1000, &sa)] = LONG_STRING;
+                mY = X;
+                LOOP_ASSERT(n, X == Y);
+                LOOP_ASSERT(n, &za == Y.get_allocator().mechanism());
+            }
+            {
+                StringMap mY(&oa);  const StringMap& Y = mY;
+                mY[makeKey(1000, &sa)] = LONG_STRING;
+                const StringMap XX(X, &za);
+                const StringMap YY(Y, &za);
+
+                bslma::TestAllocatorMonitor oam(&oa);
+                mY.swap(mX);
+                LOOP_ASSERT(n, XX == Y);
+                LOOP_ASSERT(n, YY == X);
+
+                swap(mX, mY);
+                LOOP_ASSERT(n, XX == X);
+                LOOP_ASSERT(n, YY == Y);
+                LOOP_ASSERT(n, oam.isTotalSame());
+            }
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+        ASSERT(0 == za.numBlocksInUse());
+        ASSERT(0 == defaultAllocator.numBlocksInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // MANIPULATORS
+        //
+        // Concerns:
+        //: 1 Each 'insert' overload inserts an element if and only if no
+        //:   element having its key is present, and does not modify the
+        //:   mapped value of an existing element.
+        //:
+        //: 2 Each 'erase' overload removes exactly the indicated elements and
+        //:   returns the documented result.
+        //:
+        //: 3 Elements that allocate memory retain their values and allocator
+        //:   when the map grows, and all memory is returned when they are
+        //:   erased or the map is cleared.
+        //:
+        //: 4 'reserve' prevents growth up to the reserved number of elements.
+        //
+        // Plan:
+        //: 1 Exercise each manipulator on maps of integers and of strings
+        //:   using a test allocator, and verify the results using the basic
+        //:   accessors.  (C-1..4)
+        //
+        // Testing:
+        //   flat_hash_map(INPUT_ITERATOR first, INPUT_ITERATOR last, ...);
+        //   void clear();
+        //   pair<iterator, iterator> equal_range(const key_type& key);
+        //   size_type erase(const key_type& key);
+        //   iterator erase(const_iterator position);
+        //   iterator erase(const_iterator first, const_iterator last);
+        //   iterator insert(const_iterator hint, const value_type& value);
+        //   void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        //   void rehash(size_type numSlots);
+        //   void reserve(size_type numElements);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nMANIPULATORS"
+                            "\n============\n");
+
+        bslma::TestAllocator oa("object", veryVeryVerbose);
+
+        if (verbose) printf("\nTesting 'insert' and 'erase'.\n");
+        {
+            typedef Obj::value_type Value;
+
+            const Value DATA[] = {
+                Value(1, 10), Value(2, 20), Value(1, 11), Value(3, 30),
+                Value(4, 40), Value(2, 21), Value(5, 50)
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            Obj mX(DATA, DATA + NUM_DATA, 0, Obj::hasher(), Obj::key_equal(),
+                   &oa);
+            const Obj& X = mX;
+            ASSERT(5  == X.size());
+            ASSERT(10 == X.at(1));
+            ASSERT(20 == X.at(2));
+
+            Obj mY(&oa);  const Obj& Y = mY;
+            mY.insert(DATA, DATA + NUM_DATA);
+            ASSERT(X == Y);
+
+            Obj::iterator it = mY.insert(Y.begin(), Value(6, 60));
+            ASSERT(6  == it->first);
+            ASSERT(it == mY.insert(Y.end(), Value(6, 61)));
+            ASSERT(60 == Y.at(6));
+
+            bsl::pair<Obj::iterator, Obj::iterator> range =
+                                                          mY.equal_range(6);
+            ASSERT(it           == range.first);
+            ASSERT(range.second == ++Obj::iterator(it));
+
+            ASSERT(1 == mY.erase(6));
+            ASSERT(0 == mY.erase(6));
+            ASSERT(X == Y);
+
+            for (it = mY.begin(); it != mY.end(); ) {
+                if (it->first % 2) {
+                    it = mY.erase(it);
+                }
+                else {
+                    ++it;
+                }
+            }
+            ASSERT(2 == Y.size());
+            ASSERT(20 == Y.at(2));
+            ASSERT(40 == Y.at(4));
+
+            ASSERT(mY.end() == mY.erase(Y.begin(), Y.end()));
+            ASSERT(Y.empty());
+        }
+
+        if (verbose) printf("\nTesting allocator-aware elements.\n");
+        {
+            bslma::TestAllocator sa("scratch", veryVeryVerbose);
+
+            StringMap mX(&oa);  const StringMap& X = mX;
+            for (int i = 0; i < 300; ++i) {
+                const StringMap::value_type VALUE(makeKey(i, &sa),
+                                                  makeKey(i + 7, &sa),
+                                                  &sa);
+                ASSERT(mX.insert(VALUE).second);
+            }
+            ASSERT(300 == X.size());
+
+            for (int i = 0; i < 300; ++i) {
+                StringMap::const_iterator it = X.find(makeKey(i, &sa));
+                LOOP_ASSERT(i, X.end() != it);
+                LOOP_ASSERT(i, makeKey(i + 7, &sa) == it->second);
+                LOOP_ASSERT(i, &oa == it->first.get_allocator().mechanism());
+                LOOP_ASSERT(i, &oa == it->second.get_allocator().mechanism());
+            }
+
+            for (int i = 0; i < 300; i += 2) {
+                LOOP_ASSERT(i, 1 == mX.erase(makeKey(i, &sa)));
+            }
+            ASSERT(150 == X.size());
+
+            mX.rehash(0);
+            ASSERT(150 == X.size());
+            for (int i = 1; i < 300; i += 2) {
+                LOOP_ASSERT(i, 1 == X.count(makeKey(i, &sa)));
+            }
+
+            mX.clear();
+            ASSERT(1 == oa.numBlocksInUse());
+
+            mX.rehash(0);
+            ASSERT(0 == oa.numBlocksInUse());
+        }
+
+        if (verbose) printf("\nTesting 'reserve'.\n");
+        {
+            for (int n = 0; n < 200; n += 13) {
+                Obj mX(&oa);  const Obj& X = mX;
+                mX.reserve(n);
+                const native_std::size_t CAPACITY = X.capacity();
+                for (int i = 0; i < n; ++i) {
+                    mX[i] = i;
+                }
+                LOOP_ASSERT(n, CAPACITY == X.capacity());
+            }
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create a map, insert, find, and erase a few elements, and verify
+        //:   the results.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        bslma::TestAllocator oa("object", veryVeryVerbose);
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+            ASSERT(X.empty());
+            ASSERT(X.begin() == X.end());
+            ASSERT(X.end()   == X.find(1));
+            ASSERT(0 == oa.numBlocksTotal());
+
+            bsl::pair<Obj::iterator, bool> result =
+                                           mX.insert(Obj::value_type(1, 2));
+            ASSERT(result.second);
+            ASSERT(1 == result.first->first);
+            ASSERT(2 == result.first->second);
+            ASSERT(result.first == mX.find(1));
+            ASSERT(result.first == mX.begin());
+
+            result = mX.insert(Obj::value_type(1, 3));
+            ASSERT(!result.second);
+            ASSERT(2 == result.first->second);
+            ASSERT(1 == X.size());
+
+            for (int i = 2; i <= 100; ++i) {
+                ASSERT(mX.insert(Obj::value_type(i, i * 2)).second);
+            }
+            ASSERT(100 == X.size());
+
+            int count = 0;
+            for (Obj::const_iterator it = X.begin(); it != X.end(); ++it) {
+                ASSERT(it->first * 2 == it->second);
+                ASSERT(1 == X.count(it->first));
+                ++count;
+            }
+            ASSERT(100 == count);
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
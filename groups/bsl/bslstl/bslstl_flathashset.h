@@ -0,0 +1,993 @@
+// bslstl_flathashset.h                                               -*-C++-*-
+#ifndef INCLUDED_BSLSTL_FLATHASHSET
+#define INCLUDED_BSLSTL_FLATHASHSET
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an open-addressing unordered set with inline storage.
+//
+//@CLASSES:
+//   bsl::flat_hash_set : open-addressing unordered set of unique keys
+//
+//@SEE_ALSO: bslstl_flathashmap, bslstl_flathashtable, bslstl_unorderedset
+//
+//@DESCRIPTION: This component defines a single class template,
+// 'flat_hash_set', implementing an unordered container holding a collection
+// of unique keys, having an interface closely modeled on the standard
+// 'unordered_set' [unord.set].
+//
+// Unlike 'bsl::unordered_set', which allocates a separate node for each key
+// and links every node into a single list, a 'flat_hash_set' stores its keys
+// directly in a contiguous, open-addressed slot array (see
+// 'bslstl_flathashtable'), which it probes 16 slots at a time.  Lookups
+// therefore incur fewer dependent cache misses, and no per-element link
+// overhead is paid.  In exchange, 'flat_hash_set' provides weaker iterator
+// and reference stability than 'unordered_set', and does not provide the
+// bucket interface:
+//
+//: o Any insertion, and any call to 'rehash' or 'reserve', may invalidate
+//:   all iterators, pointers, and references to the elements of the set.
+//:
+//: o Erasing an element invalidates only iterators, pointers, and references
+//:   to the erased element.
+//:
+//: o 'bucket', 'bucket_count', 'bucket_size', 'max_bucket_count', and the
+//:   local iterators are not provided; 'capacity' reports the number of
+//:   slots, and 'max_load_factor' is fixed at 0.875.
+//
+// An instantiation of 'flat_hash_set' is an allocator-aware, value-semantic
+// type whose salient attributes are its size (number of keys) and the set of
+// keys it contains, without regard to their order.  Keys are created using
+// 'bsl::allocator_traits' of the (template parameter) 'ALLOCATOR', so that,
+// when the default 'bsl::allocator' is used, each key whose type uses
+// 'bslma' allocators is supplied with the allocator of the set.  Allocators
+// are propagated on copy construction, copy assignment, and swap following
+// the same rules as 'bsl::unordered_set'.
+//
+// The default hash functor is 'bslh::Hash<>', which hashes any type that
+// provides a 'hashAppend' overload (see 'bslh_hash').
+//
+///Requirements on 'KEY'
+///---------------------
+// A 'flat_hash_set' is a fully "Value-Semantic Type" (see {'bsldoc_glossary'})
+// only if the supplied 'KEY' template parameter is fully value-semantic.  In
+// addition, 'KEY' must be "copy-constructible" to be inserted into a
+// 'flat_hash_set', and "equality-comparable" for two 'flat_hash_set' objects
+// to be compared using 'operator=='.  Note that if 'KEY' is bitwise-moveable
+// (see 'bslmf_isbitwisemoveable'), the keys are relocated with 'memcpy' when
+// the set grows, rather than being copied.
+//
+///Usage
+///-----
+// This section illustrates intended usage of this component.
+//
+///Example 1: Tracking Unique Visitors
+///- - - - - - - - - - - - - - - - - -
+// Suppose we want to count the distinct user identifiers appearing in a large
+// log of page views.  Each view is checked against the set of users seen so
+// far, so the lookup performance of the set dominates.
+//
+// First, we define the log of page views:
+//..
+//  const int VIEWS[]   = { 1001, 2002, 1001, 3003, 2002, 1001, 4004 };
+//  const int NUM_VIEWS = sizeof VIEWS / sizeof *VIEWS;
+//..
+// Then, we create a 'flat_hash_set', reserving space for the expected number
+// of users so that the set is not rehashed while we populate it:
+//..
+//  bsl::flat_hash_set<int> visitors;
+//  visitors.reserve(NUM_VIEWS);
+//  const native_std::size_t capacity = visitors.capacity();
+//..
+// Next, we insert each user identifier, and count the views from returning
+// users:
+//..
+//  int numRepeatViews = 0;
+//  for (int i = 0; i < NUM_VIEWS; ++i) {
+//      if (!visitors.insert(VIEWS[i]).second) {
+//          ++numRepeatViews;
+//      }
+//  }
+//..
+// Finally, we verify the results, and that the set was not rehashed:
+//..
+//  assert(4        == visitors.size());
+//  assert(3        == numRepeatViews);
+//  assert(1        == visitors.count(3003));
+//  assert(0        == visitors.count(5005));
+//  assert(capacity == visitors.capacity());
+//..
+
+#ifndef INCLUDED_BSLSCM_VERSION
+#include <bslscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_ALLOCATOR
+#include <bslstl_allocator.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_ALLOCATORTRAITS
+#include <bslstl_allocatortraits.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_EQUALTO
+#include <bslstl_equalto.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_FLATHASHTABLE
+#include <bslstl_flathashtable.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_ITERATORUTIL
+#include <bslstl_iteratorutil.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_PAIR
+#include <bslstl_pair.h>  // result type of 'equal_range' method
+#endif
+
+#ifndef INCLUDED_BSLSTL_UNORDEREDSETKEYCONFIGURATION
+#include <bslstl_unorderedsetkeyconfiguration.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_TYPETRAITHASSTLITERATORS
+#include <bslalg_typetraithasstliterators.h>
+#endif
+
+#ifndef INCLUDED_BSLH_HASH
+#include <bslh_hash.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_USESBSLMAALLOCATOR
+#include <bslma_usesbslmaallocator.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_CSTDDEF
+#include <cstddef>  // for 'std::size_t'
+#define INCLUDED_CSTDDEF
+#endif
+
+namespace bsl {
+
+                        // ===================
+                        // class flat_hash_set
+                        // ===================
+
+template <class KEY,
+          class HASH  = ::BloombergLP::bslh::Hash<>,
+          class EQUAL = bsl::equal_to<KEY>,
+          class ALLOCATOR = bsl::allocator<KEY> >
+class flat_hash_set
+{
+    // This class template implements a value-semantic container type holding
+    // an unordered set of unique values (of template parameter type 'KEY'),
+    // stored in an open-addressing hash table.
+    //
+    // This class:
+    //: o supports a complete set of *value-semantic* operations
+    //:   o except for 'bdex' serialization
+    //: o is *exception-neutral*
+    //: o is *alias-safe*
+    //: o is 'const' *thread-safe*
+    // For terminology see {'bsldoc_glossary'}.
+
+  private:
+
+    // PRIVATE TYPES
+    typedef bsl::allocator_traits<ALLOCATOR> AllocatorTraits;
+        // This typedef is an alias for the allocator traits type associated
+        // with this container.
+
+    typedef KEY ValueType;
+        // This typedef is an alias for the type of values maintained by this
+        // set.
+
+    typedef ::BloombergLP::bslstl::UnorderedSetKeyConfiguration<ValueType>
+                                                             ListConfiguration;
+        // This typedef is an alias for the policy used internally by this
+        // container to extract the 'KEY' value from the values maintained by
+        // this set.
+
+    typedef ::BloombergLP::bslstl::FlatHashTable<ListConfiguration,
+                                                 HASH,
+                                                 EQUAL,
+                                                 ALLOCATOR> Table;
+        // This typedef is an alias for the template instantiation of the
+        // underlying 'bslstl::FlatHashTable' used to implement this set.
+
+    // FRIEND
+    template <class KEY2,
+              class HASH2,
+              class EQUAL2,
+              class ALLOCATOR2>
+    friend bool operator==(
+                const flat_hash_set<KEY2, HASH2, EQUAL2, ALLOCATOR2>&,
+                const flat_hash_set<KEY2, HASH2, EQUAL2, ALLOCATOR2>&);
+
+  public:
+    // PUBLIC TYPES
+    typedef KEY                                        key_type;
+    typedef KEY                                        value_type;
+    typedef HASH                                       hasher;
+    typedef EQUAL                                      key_equal;
+    typedef ALLOCATOR                                  allocator_type;
+
+    typedef typename allocator_type::reference         reference;
+    typedef typename allocator_type::const_reference   const_reference;
+
+    typedef typename AllocatorTraits::size_type        size_type;
+    typedef typename AllocatorTraits::difference_type  difference_type;
+    typedef typename AllocatorTraits::pointer          pointer;
+    typedef typename AllocatorTraits::const_pointer    const_pointer;
+
+    typedef ::BloombergLP::bslstl::FlatHashTableIterator<
+                                   const value_type, difference_type> iterator;
+    typedef iterator                                            const_iterator;
+
+  private:
+    // DATA
+    Table  d_impl;
+
+  private:
+    // PRIVATE ACCESSORS
+    iterator iteratorAt(size_type index) const;
+        // Return an iterator referring to the slot at the specified 'index' of
+        // the underlying table, or the past-the-end iterator if 'index' is
+        // the capacity of the table.
+
+  public:
+    // CREATORS
+    explicit flat_hash_set(
+                      size_type             initialNumElements = 0,
+                      const hasher&         hashFunction = hasher(),
+                      const key_equal&      keyEqual = key_equal(),
+                      const allocator_type& basicAllocator = allocator_type());
+        // Construct an empty set.  Optionally specify an 'initialNumElements'
+        // indicating the number of elements the set can hold without
+        // rehashing.  If 'initialNumElements' is not supplied, or is 0, no
+        // memory is allocated.  Optionally specify a 'hashFunction' used to
+        // generate the hash values of keys.  If 'hashFunction' is not
+        // supplied, a default-constructed object of type 'hasher' is used.
+        // Optionally specify a key-equality functor 'keyEqual' used to verify
+        // that two key values are the same.  If 'keyEqual' is not supplied, a
+        // default-constructed object of type 'key_equal' is used.  Optionally
+        // specify the 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is not supplied, a default-constructed object of
+        // the (template parameter) type 'allocator_type' is used.  If the
+        // 'allocator_type' is 'bsl::allocator' (the default), then
+        // 'basicAllocator' shall be convertible to 'bslma::Allocator *', and,
+        // if 'basicAllocator' is not supplied, the currently installed default
+        // allocator will be used to supply memory.
+
+    explicit flat_hash_set(const allocator_type& basicAllocator);
+        // Construct an empty set that uses the specified 'basicAllocator' to
+        // supply memory.  Use default-constructed objects of type 'hasher' and
+        // 'key_equal' to hash and compare keys.  If the 'allocator_type' is
+        // 'bsl::allocator' (the default), then 'basicAllocator' shall be
+        // convertible to 'bslma::Allocator *'.
+
+    flat_hash_set(const flat_hash_set& original);
+    flat_hash_set(const flat_hash_set&  original,
+                  const allocator_type& basicAllocator);
+        // Construct a set having the same value, hasher, and key-equality
+        // functor as the specified 'original'.  Optionally specify the
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is not
+        // supplied, the allocator is obtained by calling
+        // 'bsl::allocator_traits<ALLOCATOR>::
+        // select_on_container_copy_construction' on the allocator of
+        // 'original'.  If the 'allocator_type' is 'bsl::allocator' (the
+        // default), then 'basicAllocator' shall be convertible to
+        // 'bslma::Allocator *'.
+
+    template <class INPUT_ITERATOR>
+    flat_hash_set(INPUT_ITERATOR        first,
+                  INPUT_ITERATOR        last,
+                  size_type             initialNumElements = 0,
+                  const hasher&         hashFunction = hasher(),
+                  const key_equal&      keyEqual = key_equal(),
+                  const allocator_type& basicAllocator = allocator_type());
+        // Construct a set and insert each 'value_type' object in the sequence
+        // starting at the specified 'first' element, and ending immediately
+        // before the specified 'last' element, ignoring those values that
+        // appear earlier in the sequence.  Optionally specify
+        // 'initialNumElements', 'hashFunction', 'keyEqual', and
+        // 'basicAllocator' having the same meaning as for the default
+        // constructor.  The (template parameter) type 'INPUT_ITERATOR' shall
+        // meet the requirements of an input iterator defined in the C++11
+        // standard [24.2.3] providing access to values of a type convertible
+        // to 'value_type'.  The behavior is undefined unless 'first' and
+        // 'last' refer to a sequence of valid values where 'first' is at a
+        // position at or before 'last'.
+
+    ~flat_hash_set();
+        // Destroy this object.
+
+    // MANIPULATORS
+    flat_hash_set& operator=(const flat_hash_set& rhs);
+        // Assign to this object the value, hasher, and key-equality functor of
+        // the specified 'rhs' object, propagate to this object the allocator
+        // of 'rhs' if the 'ALLOCATOR' type has trait
+        // 'propagate_on_container_copy_assignment', and return a reference
+        // providing modifiable access to this object.
+
+    iterator begin();
+        // Return an iterator providing access to the first 'value_type'
+        // object (in the sequence of 'value_type' objects) maintained by this
+        // set, or the 'end' iterator if this set is empty.
+
+    iterator end();
+        // Return an iterator providing access to the past-the-end element in
+        // the sequence of 'value_type' objects maintained by this set.
+
+    void clear();
+        // Remove all entries from this set.  Note that the container is empty
+        // after this call, but allocated memory is retained for future use.
+
+    pair<iterator, iterator> equal_range(const key_type& key);
+        // Return a pair of iterators to the sequence of 'value_type' objects
+        // in this set having the specified 'key', where the first iterator is
+        // positioned at the start of the sequence, and the second is
+        // positioned one past the end of the sequence.  If this set contains
+        // no 'value_type' objects having 'key', then the two returned
+        // iterators will have the same value.  Note that since a set maintains
+        // unique keys, the range will contain at most one element.
+
+    size_type erase(const key_type& key);
+        // Remove from this set the 'value_type' object having the specified
+        // 'key', if it exists, and return 1; otherwise, if there is no
+        // 'value_type' object having 'key', return 0 with no other effect.
+
+    iterator erase(const_iterator position);
+        // Remove from this set the 'value_type' object at the specified
+        // 'position', and return an iterator referring to the element
+        // immediately following the removed element, or to the past-the-end
+        // position if the removed element was the last element in the
+        // sequence of elements maintained by this set.  The behavior is
+        // undefined unless 'position' refers to a 'value_type' object in this
+        // set.
+
+    iterator erase(const_iterator first, const_iterator last);
+        // Remove from this set the 'value_type' objects starting at the
+        // specified 'first' position up to, but not including the specified
+        // 'last' position, and return 'last'.  The behavior is undefined
+        // unless 'first' and 'last' either refer to elements in this set or
+        // are the 'end' iterator, and the 'first' position is at or before the
+        // 'last' position in the sequence provided by this container.
+
+    iterator find(const key_type& key);
+        // Return an iterator to the 'value_type' object in this set having the
+        // specified 'key', if such an entry exists, and the past-the-end
+        // ('end') iterator otherwise.
+
+    pair<iterator, bool> insert(const value_type& value);
+        // Insert the specified 'value' into this set if an equivalent key does
+        // not already exist in this set; otherwise, this method has no effect.
+        // Return a pair whose 'first' member is an iterator referring to the
+        // (possibly newly inserted) 'value_type' object in this set that is
+        // equivalent to 'value', and whose 'second' member is 'true' if a new
+        // value was inserted, and 'false' otherwise.  This method requires
+        // that the (template parameter) type 'KEY' be "copy-constructible"
+        // (see {Requirements on 'KEY'}).
+
+    iterator insert(const_iterator hint, const value_type& value);
+        // Insert the specified 'value' into this set if an equivalent key does
+        // not already exist in this set, and return an iterator referring to
+        // the (possibly newly inserted) 'value_type' object in this set that
+        // is equivalent to 'value'.  The specified 'hint' is ignored.  This
+        // method requires that the (template parameter) type 'KEY' be
+        // "copy-constructible" (see {Requirements on 'KEY'}).
+
+    template <class INPUT_ITERATOR>
+    void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        // Insert into this set the value of each 'value_type' object in the
+        // range starting at the specified 'first' iterator and ending
+        // immediately before the specified 'last' iterator, whose key is not
+        // already contained in this set.  The (template parameter) type
+        // 'INPUT_ITERATOR' shall meet the requirements of an input iterator
+        // defined in the C++11 standard [24.2.3] providing access to values of
+        // a type convertible to 'value_type'.  This method requires that the
+        // (template parameter) type 'KEY' be "copy-constructible" (see
+        // {Requirements on 'KEY'}).
+
+    void rehash(size_type numSlots);
+        // Change the capacity of this set to at least the specified
+        // 'numSlots', and sufficient to hold 'size()' elements without
+        // exceeding the maximum load factor, and redistribute all the
+        // contained elements into the new slot array.  If both 'numSlots' and
+        // 'size()' are 0, release all memory held by this set.
+
+    void reserve(size_type numElements);
+        // Increase the capacity of this set, if needed, so that it can hold
+        // the specified 'numElements' without rehashing.  Note that this
+        // operation has no effect if 'numElements <= size()'.
+
+    void swap(flat_hash_set& other);
+        // Exchange the value of this object as well as its hasher and
+        // key-equality functor with those of the specified 'other' object.
+        // Additionally, if
+        // 'bsl::allocator_traits<ALLOCATOR>::propagate_on_container_swap' is
+        // 'true', then exchange the allocator of this object with that of the
+        // 'other' object, and do not modify either allocator otherwise.  This
+        // method provides the no-throw exception-safety guarantee and
+        // guarantees O[1] complexity.  The behavior is undefined unless either
+        // this object was created with the same allocator as 'other' or
+        // 'propagate_on_container_swap' is 'true'.
+
+    // ACCESSORS
+    const_iterator begin() const;
+    const_iterator cbegin() const;
+        // Return an iterator providing non-modifiable access to the first
+        // 'value_type' object (in the sequence of 'value_type' objects)
+        // maintained by this set, or the 'end' iterator if this set is empty.
+
+    const_iterator end() const;
+    const_iterator cend() const;
+        // Return an iterator providing non-modifiable access to the
+        // past-the-end element (in the sequence of 'value_type' objects)
+        // maintained by this set.
+
+    size_type capacity() const;
+        // Return the number of slots in the slot array of this set.
+
+    size_type count(const key_type& key) const;
+        // Return the number of 'value_type' objects within this set having the
+        // specified 'key'.  Note that since a set maintains unique keys, the
+        // returned value will be either 0 or 1.
+
+    bool empty() const;
+        // Return 'true' if this set contains no elements, and 'false'
+        // otherwise.
+
+    pair<const_iterator, const_iterator> equal_range(
+                                                    const key_type& key) const;
+        // Return a pair of iterators providing non-modifiable access to the
+        // sequence of 'value_type' objects in this set having the specified
+        // 'key', where the first iterator is positioned at the start of the
+        // sequence and the second iterator is positioned one past the end of
+        // the sequence.  If this set contains no 'value_type' objects having
+        // 'key' then the two returned iterators will have the same value.
+
+    const_iterator find(const key_type& key) const;
+        // Return an iterator providing non-modifiable access to the
+        // 'value_type' object in this set having the specified 'key', if such
+        // an entry exists, and the past-the-end ('end') iterator otherwise.
+
+    allocator_type get_allocator() const;
+        // Return (a copy of) the allocator used for memory allocation by this
+        // set.
+
+    hasher hash_function() const;
+        // Return (a copy of) the hash unary functor used by this set to
+        // generate a hash value (of type 'size_t') for a 'key_type' object.
+
+    key_equal key_eq() const;
+        // Return (a copy of) the key-equality binary functor that returns
+        // 'true' if the value of two 'key_type' objects is the same, and
+        // 'false' otherwise.
+
+    float load_factor() const;
+        // Return the current ratio between the 'size' of this container and
+        // its 'capacity', or 0 if the capacity is 0.
+
+    float max_load_factor() const;
+        // Return the maximum load factor allowed for this container.  Note
+        // that the maximum load factor of a 'flat_hash_set' is fixed at
+        // 0.875.
+
+    size_type max_size() const;
+        // Return a theoretical upper bound on the largest number of elements
+        // that this set could possibly hold.  Note that there is no guarantee
+        // that the set can successfully grow to the returned size, or even
+        // close to that size without running out of resources.
+
+    size_type size() const;
+        // Return the number of elements in this set.
+};
+
+// FREE FUNCTIONS
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+bool operator==(const flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>& lhs,
+                const flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects have the same
+    // value, and 'false' otherwise.  Two 'flat_hash_set' objects have the same
+    // value if they have the same number of value-elements, and for each
+    // value-element that is contained in 'lhs' there is a value-element
+    // contained in 'rhs' having the same value, and vice-versa.  This method
+    // requires that the (template parameter) type 'KEY' be
+    // "equality-comparable" (see {Requirements on 'KEY'}).
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+bool operator!=(const flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>& lhs,
+                const flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects do not have the
+    // same value, and 'false' otherwise.  Two 'flat_hash_set' objects do not
+    // have the same value if they do not have the same number of
+    // value-elements, or that for some value-element contained in 'lhs' there
+    // is not a value-element in 'rhs' having the same value, and vice-versa.
+    // This method requires that the (template parameter) type 'KEY' be
+    // "equality-comparable" (see {Requirements on 'KEY'}).
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+void swap(flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>& x,
+          flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>& y);
+    // Exchange the value, hasher, and key-equality functor of the specified
+    // 'x' object with those of the specified 'y' object.  Additionally, if
+    // 'bsl::allocator_traits<ALLOCATOR>::propagate_on_container_swap' is
+    // 'true', then exchange the allocator of 'x' with that of 'y', and do not
+    // modify either allocator otherwise.  This method provides the no-throw
+    // exception-safety guarantee and guarantees O[1] complexity.  The behavior
+    // is undefined unless either 'x' was created with the same allocator as
+    // 'y' or 'propagate_on_container_swap' is 'true'.
+
+// ============================================================================
+//                  TEMPLATE AND INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+                        //--------------------
+                        // class flat_hash_set
+                        //--------------------
+
+// PRIVATE ACCESSORS
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+typename flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::iterator
+flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::iteratorAt(size_type index) const
+{
+    return iterator(d_impl.controlAddress(index),
+                    const_cast<ValueType *>(d_impl.elementAddress(index)));
+}
+
+// CREATORS
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::flat_hash_set(
+                                      size_type             initialNumElements,
+                                      const hasher&         hashFunction,
+                                      const key_equal&      keyEqual,
+                                      const allocator_type& basicAllocator)
+: d_impl(hashFunction, keyEqual, initialNumElements, basicAllocator)
+{
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::flat_hash_set(
+                                          const allocator_type& basicAllocator)
+: d_impl(basicAllocator)
+{
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::flat_hash_set(
+                                                 const flat_hash_set& original)
+: d_impl(original.d_impl,
+         AllocatorTraits::select_on_container_copy_construction(
+                                                     original.get_allocator()))
+{
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::flat_hash_set(
+                                          const flat_hash_set&  original,
+                                          const allocator_type& basicAllocator)
+: d_impl(original.d_impl, basicAllocator)
+{
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+inline
+flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::flat_hash_set(
+                                      INPUT_ITERATOR        first,
+                                      INPUT_ITERATOR        last,
+                                      size_type             initialNumElements,
+                                      const hasher&         hashFunction,
+                                      const key_equal&      keyEqual,
+                                      const allocator_type& basicAllocator)
+: d_impl(hashFunction, keyEqual, initialNumElements, basicAllocator)
+{
+    this->insert(first, last);
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::~flat_hash_set()
+{
+    // All memory management is handled by the base 'd_impl' member.
+}
+
+// MANIPULATORS
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>&
+flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::operator=(const flat_hash_set& rhs)
+{
+    d_impl = rhs.d_impl;
+    return *this;
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+typename flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::iterator
+flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::begin()
+{
+    return iteratorAt(d_impl.firstIndex());
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+typename flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::iterator
+flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::end()
+{
+    return iteratorAt(d_impl.capacity());
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+void flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::clear()
+{
+    d_impl.removeAll();
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+bsl::pair<typename flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::iterator,
+          typename flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::iterator>
+flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::equal_range(const key_type& key)
+{
+    typedef bsl::pair<iterator, iterator> ResultType;
+
+    iterator first = this->find(key);
+    if (first == this->end()) {
+        return ResultType(first, first);                              // RETURN
+    }
+    else {
+        iterator next = first;
+        return ResultType(first, ++next);                             // RETURN
+    }
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+typename flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::size_type
+flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::erase(const key_type& key)
+{
+    const size_type index = d_impl.find(key);
+    if (index != d_impl.capacity()) {
+        d_impl.remove(index);
+        return 1;                                                     // RETURN
+    }
+    else {
+        return 0;                                                     // RETURN
+    }
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+typename flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::iterator
+flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::erase(const_iterator position)
+{
+    BSLS_ASSERT(position != this->end());
+
+    const size_type index = position.slot() - d_impl.elementAddress(0);
+    d_impl.remove(index);
+    return iteratorAt(d_impl.nextIndex(index));
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+typename flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::iterator
+flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::erase(const_iterator first,
+                                                  const_iterator last)
+{
+    while (first != last) {
+        first = this->erase(first);
+    }
+
+    return iterator(first.control(), first.slot());  // convert from
+                                                      // 'const_iterator'
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+typename flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::iterator
+flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::find(const key_type& key)
+{
+    return iteratorAt(d_impl.find(key));
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+bsl::pair<typename flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::iterator, bool>
+flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::insert(const value_type& value)
+{
+    typedef bsl::pair<iterator, bool> ResultType;
+
+    bool isInsertedFlag = false;
+
+    const size_type index = d_impl.insertIfMissing(&isInsertedFlag, value);
+
+    return ResultType(iteratorAt(index), isInsertedFlag);
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+typename flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::iterator
+flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::insert(const_iterator,
+                                                   const value_type& value)
+{
+    // A hint carries no useful information for an open-addressing table: the
+    // position of an element is determined entirely by its hash code.
+
+    return this->insert(value).first;
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+inline
+void flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::insert(INPUT_ITERATOR first,
+                                                        INPUT_ITERATOR last)
+{
+    if (size_type maxInsertions =
+            ::BloombergLP::bslstl::IteratorUtil::insertDistance(first, last)) {
+        this->reserve(this->size() + maxInsertions);
+    }
+
+    bool isInsertedFlag;  // value is not used
+
+    while (first != last) {
+        d_impl.insertIfMissing(&isInsertedFlag, *first);
+        ++first;
+    }
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+void flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::rehash(size_type numSlots)
+{
+    d_impl.rehash(numSlots);
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+void
+flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::reserve(size_type numElements)
+{
+    d_impl.reserveForNumElements(numElements);
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+void flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::swap(flat_hash_set& other)
+{
+    d_impl.swap(other.d_impl);
+}
+
+// ACCESSORS
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+typename flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::const_iterator
+flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::begin() const
+{
+    return iteratorAt(d_impl.firstIndex());
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+typename flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::const_iterator
+flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::end() const
+{
+    return iteratorAt(d_impl.capacity());
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+typename flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::const_iterator
+flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::cbegin() const
+{
+    return iteratorAt(d_impl.firstIndex());
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+typename flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::const_iterator
+flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::cend() const
+{
+    return iteratorAt(d_impl.capacity());
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+typename flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::size_type
+flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::capacity() const
+{
+    return d_impl.capacity();
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+typename flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::size_type
+flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::count(const key_type& key) const
+{
+    return d_impl.find(key) != d_impl.capacity();
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+bool flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::empty() const
+{
+    return 0 == d_impl.size();
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+bsl::pair<typename flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::const_iterator,
+          typename flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::const_iterator>
+flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::equal_range(
+                                                     const key_type& key) const
+{
+    typedef bsl::pair<const_iterator, const_iterator> ResultType;
+
+    const_iterator first = this->find(key);
+    if (first == this->end()) {
+        return ResultType(first, first);                              // RETURN
+    }
+    else {
+        const_iterator next = first;
+        return ResultType(first, ++next);                             // RETURN
+    }
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+typename flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::const_iterator
+flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::find(const key_type& key) const
+{
+    return iteratorAt(d_impl.find(key));
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+ALLOCATOR flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::get_allocator() const
+{
+    return d_impl.allocator();
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+typename flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::hasher
+flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::hash_function() const
+{
+    return d_impl.hasher();
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+typename flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::key_equal
+flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::key_eq() const
+{
+    return d_impl.comparator();
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+float flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::load_factor() const
+{
+    return d_impl.loadFactor();
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+float flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::max_load_factor() const
+{
+    return d_impl.maxLoadFactor();
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+typename flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::size_type
+flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::max_size() const
+{
+    return d_impl.maxSize();
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+typename flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::size_type
+flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::size() const
+{
+    return d_impl.size();
+}
+
+}  // close namespace bsl
+
+// FREE FUNCTIONS
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+bool bsl::operator==(
+                    const bsl::flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>& lhs,
+                    const bsl::flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>& rhs)
+{
+    return lhs.d_impl == rhs.d_impl;
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+bool bsl::operator!=(
+                    const bsl::flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>& lhs,
+                    const bsl::flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+void bsl::swap(bsl::flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>& x,
+               bsl::flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>& y)
+{
+    x.swap(y);
+}
+
+// ============================================================================
+//                                TYPE TRAITS
+// ============================================================================
+
+// Type traits for flat unordered containers:
+//: o A flat unordered container defines STL iterators.
+//: o A flat unordered container uses 'bslma' allocators if the parameterized
+//:      'ALLOCATOR' is convertible from 'bslma::Allocator*'.
+
+namespace BloombergLP {
+
+namespace bslalg {
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+struct HasStlIterators<bsl::flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR> >
+     : bsl::true_type
+{};
+
+}  // close package namespace
+
+namespace bslma {
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+struct UsesBslmaAllocator<bsl::flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR> >
+     : bsl::is_convertible<Allocator*, ALLOCATOR>::type
+{};
+
+}  // close package namespace
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,545 @@
+// bslstl_flathashset.t.cpp                                           -*-C++-*-
+
+#include <bslstl_flathashset.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatormonitor.h>
+#include <bsls_bsltestutil.h>
+#include <bsls_nativestd.h>
+
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+
+using namespace BloombergLP;
+using namespace std;
+
+//=============================================================================
+//                             TEST PLAN
+//-----------------------------------------------------------------------------
+//                             Overview
+//                             --------
+// The component under test is a value-semantic container that forwards most
+// of its work to 'bslstl::FlatHashTable', which is tested thoroughly in its
+// own test driver.  Here we concentrate on the container interface: that the
+// iterators visit every element exactly once, that the insertion and erasure
+// overloads report their results as the standard specifies, that capacity is
+// managed as documented, and that the copy operations produce equal objects
+// using the intended allocators.
+//-----------------------------------------------------------------------------
+// CREATORS
+// [ 2] explicit flat_hash_set(size_type, hash, equal, basicAllocator);
+// [ 1] explicit flat_hash_set(const allocator_type& basicAllocator);
+// [ 3] flat_hash_set(const flat_hash_set& original);
+// [ 3] flat_hash_set(const flat_hash_set& original, basicAllocator);
+// [ 2] flat_hash_set(INPUT_ITERATOR first, INPUT_ITERATOR last, ...);
+// [ 1] ~flat_hash_set();
+//
+// MANIPULATORS
+// [ 3] flat_hash_set& operator=(const flat_hash_set& rhs);
+// [ 1] iterator begin();
+// [ 1] iterator end();
+// [ 2] void clear();
+// [ 2] pair<iterator, iterator> equal_range(const key_type& key);
+// [ 2] size_type erase(const key_type& key);
+// [ 2] iterator erase(const_iterator position);
+// [ 2] iterator erase(const_iterator first, const_iterator last);
+// [ 1] iterator find(const key_type& key);
+// [ 1] pair<iterator, bool> insert(const value_type& value);
+// [ 2] iterator insert(const_iterator hint, const value_type& value);
+// [ 2] void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+// [ 2] void rehash(size_type numSlots);
+// [ 2] void reserve(size_type numElements);
+// [ 3] void swap(flat_hash_set& other);
+//
+// ACCESSORS
+// [ 1] const_iterator begin() const;
+// [ 1] const_iterator end() const;
+// [ 2] size_type capacity() const;
+// [ 1] size_type count(const key_type& key) const;
+// [ 1] bool empty() const;
+// [ 3] allocator_type get_allocator() const;
+// [ 2] float load_factor() const;
+// [ 2] float max_load_factor() const;
+// [ 1] size_type size() const;
+//
+// FREE OPERATORS
+// [ 3] bool operator==(const flat_hash_set& lhs, const flat_hash_set& rhs);
+// [ 3] bool operator!=(const flat_hash_set& lhs, const flat_hash_set& rhs);
+// [ 3] void swap(flat_hash_set& a, flat_hash_set& b);
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] USAGE EXAMPLE
+//-----------------------------------------------------------------------------
+
+//=============================================================================
+//                  STANDARD BDE ASSERT TEST MACRO
+//-----------------------------------------------------------------------------
+static int testStatus = 0;
+
+static void aSsErT(bool b, const char *s, int i) {
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+//=============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef bsl::flat_hash_set<int> Obj;
+
+namespace {
+
+template <class CONTAINER>
+int countByIteration(const CONTAINER& container)
+    // Return the number of elements visited by iterating over the specified
+    // 'container', and verify that each visited element is found by 'count'.
+{
+    int result = 0;
+    for (typename CONTAINER::const_iterator it = container.begin();
+         it != container.end();
+         ++it) {
+        ASSERT(1 == container.count(*it));
+        ++result;
+    }
+    return result;
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+    bool verbose = argc > 2;
+    bool veryVerbose = argc > 3;
+    bool veryVeryVerbose = argc > 4;
+
+    (void)veryVerbose;
+    (void)veryVeryVerbose;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVerbose);
+    bslma::DefaultAllocatorGuard defaultAllocatorGuard(&defaultAllocator);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 4: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+///Usage
+///-----
+// This section illustrates intended usage of this component.
+//
+///Example 1: Tracking Unique Visitors
+///- - - - - - - - - - - - - - - - - -
+// Suppose we want to count the distinct user identifiers appearing in a large
+// log of page views.  Each view is checked against the set of users seen so
+// far, so the lookup performance of the set dominates.
+//
+// First, we define the log of page views:
+//..
+    const int VIEWS[]   = { 1001, 2002, 1001, 3003, 2002, 1001, 4004 };
+    const int NUM_VIEWS = sizeof VIEWS / sizeof *VIEWS;
+//..
+// Then, we create a 'flat_hash_set', reserving space for the expected number
+// of users so that the set is not rehashed while we populate it:
+//..
+    bsl::flat_hash_set<int> visitors;
+    visitors.reserve(NUM_VIEWS);
+    const native_std::size_t capacity = visitors.capacity();
+//..
+// Next, we insert each user identifier, and count the views from returning
+// users:
+//..
+    int numRepeatViews = 0;
+    for (int i = 0; i < NUM_VIEWS; ++i) {
+        if (!visitors.insert(VIEWS[i]).second) {
+            ++numRepeatViews;
+        }
+    }
+//..
+// Finally, we verify the results, and that the set was not rehashed:
+//..
+    ASSERT(4        == visitors.size());
+    ASSERT(3        == numRepeatViews);
+    ASSERT(1        == visitors.count(3003));
+    ASSERT(0        == visitors.count(5005));
+    ASSERT(capacity == visitors.capacity());
+//..
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // COPY, ASSIGNMENT, SWAP, AND EQUALITY
+        //
+        // Concerns:
+        //: 1 A copy compares equal to the original, and uses the supplied
+        //:   allocator, or the default allocator if none is supplied.
+        //:
+        //: 2 Assignment gives the target the value of the source, retains the
+        //:   allocator of the target, and supports aliasing.
+        //:
+        //: 3 Member and free 'swap' exchange the values of two sets having
+        //:   the same allocator without allocating memory.
+        //:
+        //: 4 Sets having the same elements compare equal regardless of their
+        //:   capacities, and sets differing in one element compare unequal.
+        //
+        // Plan:
+        //: 1 Using test allocators, create sets of various sizes, copy,
+        //:   assign, and swap them, and verify the values, allocators, and
+        //:   allocations of the results.  (C-1..4)
+        //
+        // Testing:
+        //   flat_hash_set(const flat_hash_set& original);
+        //   flat_hash_set(const flat_hash_set& original, basicAllocator);
+        //   flat_hash_set& operator=(const flat_hash_set& rhs);
+        //   void swap(flat_hash_set& other);
+        //   allocator_type get_allocator() const;
+        //   bool operator==(const flat_hash_set& lhs, const flat_hash_set&);
+        //   bool operator!=(const flat_hash_set& lhs, const flat_hash_set&);
+        //   void swap(flat_hash_set& a, flat_hash_set& b);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCOPY, ASSIGNMENT, SWAP, AND EQUALITY"
+                            "\n====================================\n");
+
+        bslma::TestAllocator oa("object", veryVeryVerbose);
+        bslma::TestAllocator za("other",  veryVeryVerbose);
+
+        for (int n = 0; n < 60; n += 7) {
+            Obj mX(&oa);  const Obj& X = mX;
+            for (int i = 0; i < n; ++i) {
+                mX.insert(i * 3);
+            }
+
+            {
+                Obj mY(X);  const Obj& Y = mY;
+                LOOP_ASSERT(n, X == Y);
+                LOOP_ASSERT(n, !(X != Y));
+                LOOP_ASSERT(n, &defaultAllocator ==
+                                        Y.get_allocator().mechanism());
+            }
+            {
+                Obj mY(X, &za);  const Obj& Y = mY;
+                LOOP_ASSERT(n, X == Y);
+                LOOP_ASSERT(n, &za == Y.get_allocator().mechanism());
+
+                mY.insert(-1);
+                LOOP_ASSERT(n, X != Y);
+
+                Obj mZ(&za);  const Obj& Z = mZ;
+                mZ.reserve(200);
+                for (int i = n - 1; i >= 0; --i) {
+                    mZ.insert(i * 3);
+                }
+                LOOP_ASSERT(n, X == Z);
+                LOOP_ASSERT(n, X.capacity() != Z.capacity() || 0 == n);
+            }
+            {
+                Obj mY(&za);  const Obj& Y = mY;
+                mY.insert(-1);
+                mY = X;
+                LOOP_ASSERT(n, X == Y);
+                LOOP_ASSERT(n, &za == Y.get_allocator().mechanism());
+
+                mY = Y;
+                LOOP_ASSERT(n, X == Y);
+            }
+            {
+                Obj mY(&oa);  const Obj& Y = mY;
+                mY.insert(-1);
+                const Obj XX(X, &za);
+                const Obj YY(Y, &za);
+
+                bslma::TestAllocatorMonitor oam(&oa);
+                mY.swap(mX);
+                LOOP_ASSERT(n, XX == Y);
+                LOOP_ASSERT(n, YY == X);
+
+                swap(mX, mY);
+                LOOP_ASSERT(n, XX == X);
+                LOOP_ASSERT(n, YY == Y);
+                LOOP_ASSERT(n, oam.isTotalSame());
+            }
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+        ASSERT(0 == za.numBlocksInUse());
+        ASSERT(0 == defaultAllocator.numBlocksInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // MANIPULATORS
+        //
+        // Concerns:
+        //: 1 Each 'insert' overload inserts a value if and only if it is not
+        //:   already present, and the range overload reserves space for its
+        //:   input when the input iterators are forward iterators.
+        //:
+        //: 2 Each 'erase' overload removes exactly the indicated elements and
+        //:   returns the documented result, so that a set can be pruned while
+        //:   it is being iterated.
+        //:
+        //: 3 'equal_range' returns a range holding the element having the
+        //:   key, or an empty range.
+        //:
+        //: 4 'reserve' prevents growth up to the reserved number of elements,
+        //:   and the load factor never exceeds the maximum load factor.
+        //:
+        //: 5 'clear' retains capacity, and 'rehash(0)' on an empty set
+        //:   releases all memory.
+        //
+        // Plan:
+        //: 1 Exercise each manipulator on sets of various sizes, and verify
+        //:   the results using the basic accessors.  (C-1..5)
+        //
+        // Testing:
+        //   explicit flat_hash_set(size_type, hash, equal, basicAllocator);
+        //   flat_hash_set(INPUT_ITERATOR first, INPUT_ITERATOR last, ...);
+        //   void clear();
+        //   pair<iterator, iterator> equal_range(const key_type& key);
+        //   size_type erase(const key_type& key);
+        //   iterator erase(const_iterator position);
+        //   iterator erase(const_iterator first, const_iterator last);
+        //   iterator insert(const_iterator hint, const value_type& value);
+        //   void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        //   void rehash(size_type numSlots);
+        //   void reserve(size_type numElements);
+        //   size_type capacity() const;
+        //   float load_factor() const;
+        //   float max_load_factor() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nMANIPULATORS"
+                            "\n============\n");
+
+        bslma::TestAllocator oa("object", veryVeryVerbose);
+
+        const int DATA[]   = { 5, 3, 9, 3, 1, 5, 7, 2, 8, 9, 0, 4, 6 };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        if (verbose) printf("\nTesting range 'insert' and creator.\n");
+        {
+            Obj mX(DATA, DATA + NUM_DATA, 0, Obj::hasher(), Obj::key_equal(),
+                   &oa);
+            const Obj& X = mX;
+            ASSERT(10 == X.size());
+            ASSERT(10 == countByIteration(X));
+
+            Obj mY(&oa);  const Obj& Y = mY;
+            mY.insert(DATA, DATA + NUM_DATA);
+            ASSERT(X == Y);
+
+            mY.insert(DATA, DATA + NUM_DATA);
+            ASSERT(10 == Y.size());
+            ASSERT(X == Y);
+
+            Obj mZ(&oa);  const Obj& Z = mZ;
+            mZ.insert(DATA, DATA + NUM_DATA);
+            const Obj W(NUM_DATA, Obj::hasher(), Obj::key_equal(), &oa);
+            ASSERT(W.capacity() == Z.capacity());
+
+            Obj::iterator it = mY.insert(Y.begin(), 11);
+            ASSERT(11 == *it);
+            ASSERT(it == mY.insert(Y.end(), 11));
+            ASSERT(11 == Y.size());
+        }
+
+        if (verbose) printf("\nTesting 'erase' and 'equal_range'.\n");
+        {
+            Obj mX(DATA, DATA + NUM_DATA, 0, Obj::hasher(), Obj::key_equal(),
+                   &oa);
+            const Obj& X = mX;
+
+            ASSERT(1 == mX.erase(5));
+            ASSERT(0 == mX.erase(5));
+            ASSERT(9 == X.size());
+
+            bsl::pair<Obj::iterator, Obj::iterator> range =
+                                                          mX.equal_range(3);
+            ASSERT(3 == *range.first);
+            ASSERT(range.second == ++Obj::iterator(range.first));
+
+            range = mX.equal_range(5);
+            ASSERT(range.first  == mX.end());
+            ASSERT(range.second == mX.end());
+
+            // Erase the even values while iterating.
+
+            for (Obj::iterator it = mX.begin(); it != mX.end(); ) {
+                if (0 == *it % 2) {
+                    it = mX.erase(it);
+                }
+                else {
+                    ++it;
+                }
+            }
+            ASSERT(4 == X.size());
+            ASSERT(4 == countByIteration(X));
+            ASSERT(1 == X.count(1) && 1 == X.count(3) && 1 == X.count(7)
+                                                          && 1 == X.count(9));
+
+            ASSERT(X.end() == mX.erase(X.begin(), X.end()));
+            ASSERT(X.empty());
+        }
+
+        if (verbose) printf("\nTesting 'reserve', 'clear', 'rehash'.\n");
+        {
+            for (int n = 0; n < 200; n += 9) {
+                Obj mX(n, Obj::hasher(), Obj::key_equal(), &oa);
+                const Obj& X = mX;
+                const native_std::size_t CAPACITY = X.capacity();
+                LOOP_ASSERT(n, (0 == n) == (0 == CAPACITY));
+
+                for (int i = 0; i < n; ++i) {
+                    mX.insert(i);
+                    LOOP_ASSERT(n, X.load_factor() <= X.max_load_factor());
+                }
+                LOOP_ASSERT(n, CAPACITY == X.capacity());
+
+                Obj mY(&oa);  const Obj& Y = mY;
+                mY.reserve(n);
+                const native_std::size_t Y_CAPACITY = Y.capacity();
+                mY.insert(X.begin(), X.end());
+                LOOP_ASSERT(n, Y_CAPACITY == Y.capacity());
+                LOOP_ASSERT(n, X == Y);
+
+                mY.clear();
+                LOOP_ASSERT(n, Y.empty());
+                LOOP_ASSERT(n, Y_CAPACITY == Y.capacity());
+
+                mY.rehash(0);
+                LOOP_ASSERT(n, 0 == Y.capacity());
+            }
+            ASSERT(0 == oa.numBlocksInUse());
+        }
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create a set, insert, find, and erase a few values, and verify
+        //:   the results.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        bslma::TestAllocator oa("object", veryVeryVerbose);
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+            ASSERT(X.empty());
+            ASSERT(X.begin() == X.end());
+            ASSERT(X.end()   == mX.find(1));
+            ASSERT(0 == oa.numBlocksTotal());
+
+            bsl::pair<Obj::iterator, bool> result = mX.insert(1);
+            ASSERT(result.second);
+            ASSERT(1 == *result.first);
+            ASSERT(result.first == mX.find(1));
+            ASSERT(result.first == mX.begin());
+
+            result = mX.insert(1);
+            ASSERT(!result.second);
+            ASSERT(1 == X.size());
+
+            for (int i = 2; i <= 100; ++i) {
+                ASSERT(mX.insert(i).second);
+            }
+            ASSERT(100 == X.size());
+            ASSERT(100 == countByIteration(X));
+            ASSERT(0   == X.count(0));
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
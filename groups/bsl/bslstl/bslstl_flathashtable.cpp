@@ -0,0 +1,55 @@
+// bslstl_flathashtable.cpp                                           -*-C++-*-
+
+#include <bslstl_flathashtable.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id$ $CSID$")
+
+namespace BloombergLP {
+
+namespace bslstl {
+
+                        // ----------------------------
+                        // struct FlatHashTable_ImpUtil
+                        // ----------------------------
+
+// CLASS METHODS
+signed char *FlatHashTable_ImpUtil::emptyGroup()
+{
+    // The returned array is never modified: a table having zero capacity
+    // always rehashes before an element is inserted.
+
+    static signed char s_emptyGroup[k_GROUP_WIDTH] = {
+        k_SENTINEL, k_EMPTY, k_EMPTY, k_EMPTY, k_EMPTY, k_EMPTY, k_EMPTY,
+        k_EMPTY,    k_EMPTY, k_EMPTY, k_EMPTY, k_EMPTY, k_EMPTY, k_EMPTY,
+        k_EMPTY,    k_EMPTY
+    };
+
+    return s_emptyGroup;
+}
+
+}  // close package namespace
+
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
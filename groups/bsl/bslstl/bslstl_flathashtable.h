@@ -0,0 +1,1811 @@
+// bslstl_flathashtable.h                                             -*-C++-*-
+#ifndef INCLUDED_BSLSTL_FLATHASHTABLE
+#define INCLUDED_BSLSTL_FLATHASHTABLE
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an open-addressing hash table with inline element storage.
+//
+//@CLASSES:
+//  bslstl::FlatHashTable: open-addressing hash table for flat containers
+//  bslstl::FlatHashTable_ImpUtil: control-byte and capacity utilities
+//  bslstl::FlatHashTableIterator: forward iterator over a 'FlatHashTable'
+//
+//@SEE_ALSO: bslstl_flathashmap, bslstl_flathashset, bslstl_hashtable
+//
+//@DESCRIPTION: This component provides a class template,
+// 'bslstl::FlatHashTable', implementing the common machinery of the flat
+// (open-addressing) unordered containers, 'bsl::flat_hash_map' and
+// 'bsl::flat_hash_set'.  Unlike 'bslstl::HashTable', which allocates a
+// separate node for each element and threads every node through a single
+// doubly-linked list, a 'FlatHashTable' stores its elements directly in a
+// contiguous array of *slots*, so that a successful lookup usually touches
+// only two cache lines (one of control bytes, and one holding the element),
+// and no per-element link overhead is paid.
+//
+///Table Layout
+///------------
+// A 'FlatHashTable' having a non-zero capacity 'N' (always one less than a
+// power of two, and never less than 15) owns a single block of memory,
+// obtained from the allocator supplied at construction, holding an array of
+// 'N' slots followed by an array of 'N + 16' *control* bytes.  The control
+// byte at index 'i' (for 'i < N') describes the slot at index 'i', and is one
+// of:
+//..
+//  Control Byte        Meaning
+//  ------------        -------
+//  0 .. 127            slot is full; the value is 7 bits of the element's hash
+//  'k_EMPTY'           slot has never been used since the last rehash
+//  'k_DELETED'         slot held an element that has since been erased
+//..
+// The control byte at index 'N' is a *sentinel* marking the end of the table
+// (used to terminate iteration), and the remaining 15 control bytes replicate
+// the first 15, so that any 16 consecutive control bytes starting at an index
+// in the range '[0 .. N]' may be loaded without wrapping.
+//
+///Probing
+///-------
+// The hash code of a key is split into two parts: the low-order 7 bits,
+// 'H2', are stored in the control byte of a full slot, and the remaining bits,
+// 'H1', select the index of the first *group* of 16 control bytes to examine.
+// A group is examined in a handful of instructions: on platforms supporting
+// SSE2, the 16 control bytes are compared to 'H2' in parallel, yielding a bit
+// mask of candidate slots, and only those candidates are compared to the key
+// using the equality comparator; a group containing an empty slot terminates
+// an unsuccessful search.  Successive groups are visited using quadratic
+// (triangular) probing, which is guaranteed to visit every group of a table.
+// On platforms without SSE2 an equivalent (portable) byte-wise implementation
+// is used.
+//
+// Since only 7 bits of the hash code are used to filter candidates, and the
+// remaining bits select the starting group, the table mixes every hash code
+// returned by the hasher before use, so that hash functors returning poorly
+// distributed values (e.g., an identity hash of integers) do not degrade
+// performance.
+//
+///Load Factor
+///-----------
+// The maximum load factor of a 'FlatHashTable' is fixed at 7/8.  Note that
+// erasing an element may leave a 'k_DELETED' control byte (a *tombstone*) in
+// its slot, which continues to count against the load factor until the table
+// is next rehashed.  When an insertion would exceed the maximum load factor,
+// a table whose elements occupy at most 25/32 of its capacity (so that
+// tombstones occupy at least about 3/32 of it) is rehashed in place (i.e.,
+// without growing); otherwise its capacity is doubled.
+//
+///Iterator and Reference Invalidation
+///-----------------------------------
+// Because elements are stored inline, any operation that may rehash the table
+// (i.e., inserting an element, 'reserveForNumElements', and 'rehash')
+// invalidates all iterators, pointers, and references to the elements of the
+// table.  Erasing an element invalidates only iterators, pointers, and
+// references to the erased element.
+//
+///Requirements on the 'ValueType'
+///-------------------------------
+// The 'ValueType' (defined by the 'KEY_CONFIG' policy) must be
+// copy-constructible.  If the 'ValueType' is bitwise-moveable (see
+// 'bslmf_isbitwisemoveable'), elements are relocated with 'memcpy' when the
+// table grows; otherwise, elements are copied into the new slot array, and the
+// originals destroyed.
+//
+///Usage
+///-----
+// This component is an implementation detail of 'bsl::flat_hash_map' and
+// 'bsl::flat_hash_set', and is not intended for direct use by clients.  See
+// 'bslstl_flathashmap' and 'bslstl_flathashset' for usage examples.
+
+#ifndef INCLUDED_BSLSCM_VERSION
+#include <bslscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_ALLOCATORTRAITS
+#include <bslstl_allocatortraits.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_ITERATOR
+#include <bslstl_iterator.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_STDEXCEPTUTIL
+#include <bslstl_stdexceptutil.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_SWAPUTIL
+#include <bslalg_swaputil.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_ISBITWISEMOVEABLE
+#include <bslmf_isbitwisemoveable.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_REMOVECVQ
+#include <bslmf_removecvq.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ALIGNMENTUTIL
+#include <bsls_alignmentutil.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_BSLS_NATIVESTD
+#include <bsls_nativestd.h>
+#endif
+
+#ifndef INCLUDED_BSLS_PERFORMANCEHINT
+#include <bsls_performancehint.h>
+#endif
+
+#ifndef INCLUDED_BSLS_PLATFORM
+#include <bsls_platform.h>
+#endif
+
+#ifndef INCLUDED_BSLS_UTIL
+#include <bsls_util.h>
+#endif
+
+#ifndef INCLUDED_CSTDDEF
+#include <cstddef>
+#define INCLUDED_CSTDDEF
+#endif
+
+#ifndef INCLUDED_CSTRING
+#include <cstring>
+#define INCLUDED_CSTRING
+#endif
+
+#if defined(BSLS_PLATFORM_CPU_X86_64)                                         \
+ || defined(__SSE2__)                                                         \
+ || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define BSLSTL_FLATHASHTABLE_USE_SSE2 1
+#endif
+
+#ifdef BSLSTL_FLATHASHTABLE_USE_SSE2
+#ifndef INCLUDED_EMMINTRIN
+#include <emmintrin.h>
+#define INCLUDED_EMMINTRIN
+#endif
+#endif
+
+namespace BloombergLP {
+
+namespace bslstl {
+
+                        // ============================
+                        // struct FlatHashTable_ImpUtil
+                        // ============================
+
+struct FlatHashTable_ImpUtil {
+    // This 'struct' provides a namespace for the constants and utility
+    // functions, independent of the element type, that are used to implement
+    // 'FlatHashTable': the control byte encoding, the matching of a group of
+    // control bytes against a value, and the arithmetic relating the capacity
+    // of a table to the number of elements it may hold.
+
+    // TYPES
+    enum {
+        k_GROUP_WIDTH = 16  // number of control bytes examined in one probe
+    };
+
+    enum {
+        k_EMPTY    = -128,  // control byte of a never-used slot
+        k_DELETED  = -2,    // control byte of a slot whose element was erased
+        k_SENTINEL = -1     // control byte marking the end of the table
+    };
+
+    // CLASS METHODS
+    static signed char *emptyGroup();
+        // Return the address of a statically allocated array of
+        // 'k_GROUP_WIDTH' control bytes, the first being 'k_SENTINEL' and the
+        // remainder 'k_EMPTY', used as the control array of every table
+        // having zero capacity.  The behavior is undefined if the returned
+        // array is modified.
+
+    static bool isFull(signed char control);
+        // Return 'true' if the specified 'control' byte describes a slot
+        // holding an element, and 'false' otherwise.
+
+    static unsigned int matchByte(const signed char *group, signed char value);
+        // Return a bit mask in which bit 'i' is set if the control byte at
+        // index 'i' of the specified 'group' of 'k_GROUP_WIDTH' control bytes
+        // has the specified 'value', and is clear otherwise.
+
+    static unsigned int matchEmpty(const signed char *group);
+        // Return a bit mask in which bit 'i' is set if the control byte at
+        // index 'i' of the specified 'group' of 'k_GROUP_WIDTH' control bytes
+        // is 'k_EMPTY', and is clear otherwise.
+
+    static unsigned int matchEmptyOrDeleted(const signed char *group);
+        // Return a bit mask in which bit 'i' is set if the control byte at
+        // index 'i' of the specified 'group' of 'k_GROUP_WIDTH' control bytes
+        // is either 'k_EMPTY' or 'k_DELETED', and is clear otherwise.
+
+    static int countTrailingZeros(unsigned int mask);
+        // Return the index of the least-significant set bit in the specified
+        // 'mask'.  The behavior is undefined unless '0 != mask'.
+
+    static int countLeadingZeros(unsigned int mask);
+        // Return the number of clear bits preceding the most-significant set
+        // bit of the specified 'mask' when viewed as a 'k_GROUP_WIDTH'-bit
+        // integer, or 'k_GROUP_WIDTH' if '0 == mask'.  The behavior is
+        // undefined unless 'mask < (1 << k_GROUP_WIDTH)'.
+
+    static native_std::size_t mixHashCode(native_std::size_t hashCode);
+        // Return a value derived from the specified 'hashCode' in which every
+        // bit depends on the high- and low-order bits of 'hashCode'.
+
+    static native_std::size_t normalizeCapacity(native_std::size_t capacity);
+        // Return the smallest valid table capacity (i.e., one less than a
+        // power of two, and not less than 'k_GROUP_WIDTH - 1') that is not
+        // less than the specified 'capacity'.  The behavior is undefined if
+        // the result cannot be represented as a 'native_std::size_t'.
+
+    static native_std::size_t capacityToGrowth(native_std::size_t capacity);
+        // Return the maximum number of elements that may be held by a table
+        // having the specified 'capacity' without exceeding the maximum load
+        // factor.  The behavior is undefined unless 'capacity' is a valid
+        // table capacity or 0.
+
+    static native_std::size_t growthToLowerboundCapacity(
+                                                   native_std::size_t growth);
+        // Return a lower bound on the capacity of a table that can hold the
+        // specified 'growth' number of elements without exceeding the maximum
+        // load factor.  Note that the result is not necessarily a valid table
+        // capacity, and should be passed to 'normalizeCapacity'.
+};
+
+                        // ===========================
+                        // class FlatHashTableIterator
+                        // ===========================
+
+#ifdef BSLS_PLATFORM_OS_SOLARIS
+// On Solaris just to keep studio12-v4 happy, since algorithms take only
+// iterators inheriting from 'std::iterator'.
+
+template <class VALUE_TYPE, class DIFFERENCE_TYPE>
+class FlatHashTableIterator
+: public native_std::iterator<native_std::forward_iterator_tag, VALUE_TYPE> {
+#else
+template <class VALUE_TYPE, class DIFFERENCE_TYPE>
+class FlatHashTableIterator {
+#endif
+    // This class template implements an in-core value semantic type that is a
+    // standard-conforming forward iterator (see section 24.2.5
+    // [forward.iterators] of the C++11 standard) over the elements of a
+    // 'FlatHashTable'.  An iterator refers to a slot of a table by holding the
+    // address of the slot, and the address of the slot's control byte; the
+    // past-the-end iterator refers to the sentinel control byte of the table.
+    // The (template parameter) 'DIFFERENCE_TYPE' determines the standard
+    // mandated 'difference_type' of the iterator.
+
+    // PRIVATE TYPES
+    typedef typename bslmf::RemoveCvq<VALUE_TYPE>::Type    NcType;
+    typedef FlatHashTableIterator<NcType, DIFFERENCE_TYPE> NcIter;
+
+  public:
+    // PUBLIC TYPES
+    typedef NcType                      value_type;
+    typedef DIFFERENCE_TYPE             difference_type;
+    typedef VALUE_TYPE                 *pointer;
+    typedef VALUE_TYPE&                 reference;
+    typedef bsl::forward_iterator_tag   iterator_category;
+        // Standard iterator defined types [24.4.2].
+
+  private:
+    // DATA
+    const signed char *d_control_p;  // address of the control byte of the
+                                     // slot referred to by this iterator
+
+    NcType            *d_slot_p;     // address of the slot referred to by
+                                     // this iterator
+
+  private:
+    // PRIVATE MANIPULATORS
+    void skipEmptySlots();
+        // Move this iterator forward until it refers to either a full slot or
+        // the sentinel control byte.
+
+  public:
+    // CREATORS
+    FlatHashTableIterator();
+        // Create a default-constructed iterator.  All default-constructed
+        // iterators are non-dereferenceable and compare equal to one another.
+
+    FlatHashTableIterator(const signed char *control, NcType *slot);
+        // Create an iterator referring to the slot having the specified
+        // 'control' byte and the specified 'slot' address, or, if 'control'
+        // is the address of the sentinel control byte of a table, the
+        // past-the-end iterator of that table.  Note that this constructor is
+        // an implementation detail and is not part of the C++ standard.
+
+    FlatHashTableIterator(const NcIter& original);                  // IMPLICIT
+        // Create an iterator at the same position as the specified 'original'
+        // iterator.  Note that this constructor enables converting from
+        // modifiable to 'const' iterator types.
+
+    //! FlatHashTableIterator(const FlatHashTableIterator& original) = default;
+        // Create an iterator having the same value as the specified
+        // 'original'.
+
+    //! ~FlatHashTableIterator() = default;
+        // Destroy this object.
+
+    // MANIPULATORS
+    //! FlatHashTableIterator& operator=(
+    //!                           const FlatHashTableIterator& rhs) = default;
+        // Assign to this object the value of the specified 'rhs' object, and
+        // a return a reference providing modifiable access to this object.
+
+    FlatHashTableIterator& operator++();
+        // Move this iterator to the next element in the table and return a
+        // reference providing modifiable access to this iterator.  The
+        // behavior is undefined unless this iterator refers to an element (not
+        // yet erased) of a table that has not been rehashed since this
+        // iterator was obtained.
+
+    // ACCESSORS
+    reference operator*() const;
+        // Return a reference to the element at which this iterator is
+        // positioned.  The behavior is undefined unless this iterator refers
+        // to a valid (not yet erased) element.
+
+    pointer operator->() const;
+        // Return the address of the element at which this iterator is
+        // positioned.  The behavior is undefined unless this iterator refers
+        // to a valid (not yet erased) element.
+
+    const signed char *control() const;
+        // Return the address of the control byte of the slot at which this
+        // iterator is positioned.  Note that this method is an implementation
+        // detail and is not part of the C++ standard.
+
+    NcType *slot() const;
+        // Return the address of the slot at which this iterator is
+        // positioned.  Note that this method is an implementation detail and
+        // is not part of the C++ standard.
+};
+
+// FREE OPERATORS
+template <class VALUE_TYPE, class DIFFERENCE_TYPE>
+bool operator==(
+              const FlatHashTableIterator<VALUE_TYPE, DIFFERENCE_TYPE>& lhs,
+              const FlatHashTableIterator<VALUE_TYPE, DIFFERENCE_TYPE>& rhs);
+template <class VALUE_TYPE, class DIFFERENCE_TYPE>
+bool operator==(
+        const FlatHashTableIterator<VALUE_TYPE, DIFFERENCE_TYPE>&       lhs,
+        const FlatHashTableIterator<const VALUE_TYPE, DIFFERENCE_TYPE>& rhs);
+template <class VALUE_TYPE, class DIFFERENCE_TYPE>
+bool operator==(
+        const FlatHashTableIterator<const VALUE_TYPE, DIFFERENCE_TYPE>& lhs,
+        const FlatHashTableIterator<VALUE_TYPE, DIFFERENCE_TYPE>&       rhs);
+    // Return 'true' if the specified 'lhs' and the specified 'rhs' iterators
+    // have the same value and 'false' otherwise.  Two iterators have the same
+    // value if they refer to the same slot of the same table, or if both are
+    // default-constructed.
+
+template <class VALUE_TYPE, class DIFFERENCE_TYPE>
+bool operator!=(
+              const FlatHashTableIterator<VALUE_TYPE, DIFFERENCE_TYPE>& lhs,
+              const FlatHashTableIterator<VALUE_TYPE, DIFFERENCE_TYPE>& rhs);
+template <class VALUE_TYPE, class DIFFERENCE_TYPE>
+bool operator!=(
+        const FlatHashTableIterator<VALUE_TYPE, DIFFERENCE_TYPE>&       lhs,
+        const FlatHashTableIterator<const VALUE_TYPE, DIFFERENCE_TYPE>& rhs);
+template <class VALUE_TYPE, class DIFFERENCE_TYPE>
+bool operator!=(
+        const FlatHashTableIterator<const VALUE_TYPE, DIFFERENCE_TYPE>& lhs,
+        const FlatHashTableIterator<VALUE_TYPE, DIFFERENCE_TYPE>&       rhs);
+    // Return 'true' if the specified 'lhs' and the specified 'rhs' iterators
+    // do not have the same value and 'false' otherwise.  Two iterators do not
+    // have the same value if they refer to different slots.
+
+template <class VALUE_TYPE, class DIFFERENCE_TYPE>
+FlatHashTableIterator<VALUE_TYPE, DIFFERENCE_TYPE>
+operator++(FlatHashTableIterator<VALUE_TYPE, DIFFERENCE_TYPE>& iter, int);
+    // Move the specified 'iter' to the next element in the table and return
+    // value of 'iter' prior to this call.  The behavior is undefined unless
+    // 'iter' refers to a valid (not yet erased) element.
+
+                        // ============================
+                        // class FlatHashTable_Proctor
+                        // ============================
+
+template <class FLAT_HASH_TABLE>
+class FlatHashTable_Proctor {
+    // This class implements a proctor that, unless its 'release' method is
+    // called, destroys every element of a 'FLAT_HASH_TABLE' object and
+    // returns its memory to the table's allocator on destruction.  This
+    // proctor is used to provide the basic exception-safety guarantee while
+    // populating a table under construction.
+
+    // DATA
+    FLAT_HASH_TABLE *d_table_p;  // table to clean up, or 0 if released
+
+  private:
+    // NOT IMPLEMENTED
+    FlatHashTable_Proctor(const FlatHashTable_Proctor&);
+    FlatHashTable_Proctor& operator=(const FlatHashTable_Proctor&);
+
+  public:
+    // CREATORS
+    explicit FlatHashTable_Proctor(FLAT_HASH_TABLE *table);
+        // Create a proctor to manage the specified 'table'.
+
+    ~FlatHashTable_Proctor();
+        // Destroy this proctor, and, unless 'release' has been called, every
+        // element of the managed table, then deallocate the table's memory.
+
+    // MANIPULATORS
+    void release();
+        // Release from management the table currently managed by this
+        // proctor.
+};
+
+                        // ===================
+                        // class FlatHashTable
+                        // ===================
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+class FlatHashTable {
+    // This class template implements an open-addressing hash table holding
+    // elements of the 'ValueType' defined by the (template parameter)
+    // 'KEY_CONFIG' inline in an array of slots, where each element has a
+    // unique key (as determined by the (template parameter) 'COMPARATOR').
+    // The 'KEY_CONFIG' type must provide 'KeyType' and 'ValueType' typedefs,
+    // and a static 'extractKey' function returning a reference to the key of
+    // a 'ValueType' object.  Elements are created and destroyed through
+    // 'bsl::allocator_traits' of the (template parameter) 'ALLOCATOR', so that
+    // elements using 'bslma' allocators are supplied with the allocator of
+    // the table.  Elements are identified by their *index* within the slot
+    // array; the index of the past-the-end position is 'capacity()'.
+
+  public:
+    // TYPES
+    typedef ALLOCATOR                              AllocatorType;
+    typedef ::bsl::allocator_traits<ALLOCATOR>     AllocatorTraits;
+    typedef typename KEY_CONFIG::KeyType           KeyType;
+    typedef typename KEY_CONFIG::ValueType         ValueType;
+    typedef typename AllocatorTraits::size_type    SizeType;
+
+  private:
+    // PRIVATE TYPES
+    typedef FlatHashTable_ImpUtil                   ImpUtil;
+    typedef bsls::AlignmentUtil::MaxAlignedType     BlockType;
+    typedef typename AllocatorTraits::template
+                                   rebind_traits<BlockType> BlockAllocTraits;
+    typedef typename BlockAllocTraits::allocator_type       BlockAllocator;
+
+    // DATA
+    signed char        *d_control_p;   // control bytes (see {Table Layout})
+    ValueType          *d_slots_p;     // array of 'd_capacity' slots
+    SizeType            d_size;        // number of elements
+    SizeType            d_capacity;    // number of slots
+    SizeType            d_growthLeft;  // number of 'k_EMPTY' slots that may
+                                       // be filled before a rehash
+    HASHER              d_hasher;      // hash functor
+    COMPARATOR          d_comparator;  // key-equality functor
+    ALLOCATOR           d_allocator;   // allocator for elements and memory
+
+    // FRIENDS
+    friend class FlatHashTable_Proctor<FlatHashTable>;
+
+  private:
+    // PRIVATE CLASS METHODS
+    static native_std::size_t numBlocks(SizeType capacity);
+        // Return the number of 'BlockType' objects required to hold the slot
+        // and control arrays of a table having the specified 'capacity'.
+
+    // PRIVATE MANIPULATORS
+    void allocateTable(SizeType capacity);
+        // Allocate, from the allocator of this table, memory for a slot array
+        // and control array having the specified 'capacity', and set this
+        // table to refer to that memory, with every slot empty.  The behavior
+        // is undefined unless this table owns no memory and holds no elements,
+        // and 'capacity' is a valid table capacity.
+
+    void removeAllAndDeallocate();
+        // Destroy every element of this table, return its memory to the
+        // allocator, and reset this table to zero capacity.
+
+    void setControl(SizeType index, signed char control);
+        // Set the control byte of the slot at the specified 'index' to the
+        // specified 'control', updating the replicated control bytes at the
+        // end of the control array as needed.
+
+    SizeType findFirstNonFull(native_std::size_t hashCode) const;
+        // Return the index of the first slot that is either empty or deleted
+        // in the probe sequence of the specified 'hashCode'.  The behavior is
+        // undefined unless this table has a non-zero capacity.
+
+    SizeType prepareInsert(native_std::size_t hashCode);
+        // Return the index of the slot into which an element having the
+        // specified 'hashCode' should be inserted, first rehashing this table
+        // if no slot may be filled without exceeding the maximum load factor.
+
+    void finishInsert(SizeType index, native_std::size_t hashCode);
+        // Mark the slot at the specified 'index', which must hold a newly
+        // constructed element having the specified 'hashCode', as full, and
+        // update the element count.
+
+    void resize(SizeType newCapacity);
+        // Move every element of this table into a newly allocated slot array
+        // having the specified 'newCapacity', and release the old memory.  If
+        // an exception is thrown, this table is unchanged.  The behavior is
+        // undefined unless 'newCapacity' is a valid table capacity that can
+        // hold 'size()' elements without exceeding the maximum load factor.
+
+    void quickSwapRetainAllocators(FlatHashTable *other);
+        // Exchange the value, hasher, and comparator of this object with those
+        // of the specified 'other' object, without exchanging allocators.
+        // This method provides the no-throw exception-safety guarantee unless
+        // the hasher or comparator throw on swap.  The behavior is undefined
+        // unless the allocators of this object and 'other' compare equal.
+
+    void insertUnique(const ValueType& value);
+        // Insert a copy of the specified 'value' into this table without
+        // checking whether an element having the same key is already
+        // present.  The behavior is undefined unless no element having the
+        // key of 'value' is present, and inserting one element would not
+        // exceed the maximum load factor.
+
+    // PRIVATE ACCESSORS
+    native_std::size_t hashCodeForKey(const KeyType& key) const;
+        // Return the (mixed) hash code for the specified 'key'.
+
+    SizeType find(const KeyType& key, native_std::size_t hashCode) const;
+        // Return the index of the element in this table having the specified
+        // 'key', whose hash code is the specified 'hashCode', or 'capacity()'
+        // if there is no such element.
+
+  public:
+    // CREATORS
+    explicit FlatHashTable(const ALLOCATOR& basicAllocator = ALLOCATOR());
+        // Create an empty table having zero capacity.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is not
+        // supplied, a default-constructed object of the (template parameter)
+        // type 'ALLOCATOR' is used.  Use default-constructed objects of the
+        // (template parameter) types 'HASHER' and 'COMPARATOR' to hash and
+        // compare keys.  No memory is allocated.
+
+    FlatHashTable(const HASHER&     hash,
+                  const COMPARATOR& compare,
+                  SizeType          initialNumElements,
+                  const ALLOCATOR&  basicAllocator);
+        // Create an empty table using the specified 'hash' and 'compare'
+        // functors, able to hold at least the specified 'initialNumElements'
+        // without rehashing, and using the specified 'basicAllocator' to
+        // supply memory.  No memory is allocated if '0 == initialNumElements'.
+
+    FlatHashTable(const FlatHashTable& original,
+                  const ALLOCATOR&     basicAllocator);
+        // Create a table having the same value, hasher, and comparator as the
+        // specified 'original', and using the specified 'basicAllocator' to
+        // supply memory.  Note that the capacity of the new table may be less
+        // than that of 'original'.
+
+    ~FlatHashTable();
+        // Destroy this object.
+
+    // MANIPULATORS
+    FlatHashTable& operator=(const FlatHashTable& rhs);
+        // Assign to this object the value, hasher, and comparator of the
+        // specified 'rhs' object, propagate to this object the allocator of
+        // 'rhs' if the 'ALLOCATOR' type has trait
+        // 'propagate_on_container_copy_assignment', and return a reference
+        // providing modifiable access to this object.  If an exception is
+        // thrown, this object is unchanged.
+
+    SizeType insertIfMissing(bool *isInsertedFlag, const ValueType& value);
+        // Insert a copy of the specified 'value' into this table if no element
+        // having the same key is present.  Return the index of the (possibly
+        // newly inserted) element having the key of 'value', and load into the
+        // specified 'isInsertedFlag' 'true' if an element was inserted, and
+        // 'false' otherwise.  If an exception is thrown, this table is
+        // unchanged.
+
+    SizeType insertIfMissing(const KeyType& key);
+        // Insert into this table an element having the specified 'key' and a
+        // value-initialized mapped value, if no element having 'key' is
+        // present.  Return the index of the (possibly newly inserted) element
+        // having 'key'.  If an exception is thrown, this table is unchanged.
+        // The behavior is undefined unless 'ValueType' is a 'pair' whose
+        // 'first' member has the type 'KeyType'.
+
+    void remove(SizeType index);
+        // Destroy the element at the specified 'index' of this table and mark
+        // its slot as available.  The behavior is undefined unless 'index'
+        // refers to a full slot.
+
+    void removeAll();
+        // Destroy every element of this table, retaining its capacity.
+
+    void rehash(SizeType numSlots);
+        // Rehash this table into a slot array having at least the specified
+        // 'numSlots', and large enough to hold 'size()' elements without
+        // exceeding the maximum load factor.  If both 'numSlots' and 'size()'
+        // are 0, release all memory held by this table.  If an exception is
+        // thrown, this table is unchanged.
+
+    void reserveForNumElements(SizeType numElements);
+        // Ensure that this table can hold at least the specified
+        // 'numElements' without rehashing.  If an exception is thrown, this
+        // table is unchanged.
+
+    void swap(FlatHashTable& other);
+        // Exchange the value, hasher, and comparator of this object with those
+        // of the specified 'other' object.  Additionally, if
+        // 'bsl::allocator_traits<ALLOCATOR>::propagate_on_container_swap' is
+        // 'true', then exchange the allocator of this object with that of the
+        // 'other' object, and do not modify either allocator otherwise.  This
+        // method provides the no-throw exception-safety guarantee unless the
+        // hasher or comparator throw on swap.  The behavior is undefined
+        // unless either this object has an allocator that compares equal to
+        // the allocator of 'other', or the trait
+        // 'propagate_on_container_swap' is 'true'.
+
+    ValueType *elementAddress(SizeType index);
+        // Return the address of the slot at the specified 'index' of this
+        // table.  The behavior is undefined unless 'index <= capacity()'.
+        // Note that the returned address may be used to form an iterator, but
+        // is dereferenceable only if the slot is full.
+
+    signed char *controlAddress(SizeType index);
+        // Return the address of the control byte of the slot at the specified
+        // 'index' of this table.  The behavior is undefined unless
+        // 'index <= capacity()'.
+
+    // ACCESSORS
+    ALLOCATOR allocator() const;
+        // Return (a copy of) the allocator used by this table.
+
+    SizeType capacity() const;
+        // Return the number of slots in this table.
+
+    const COMPARATOR& comparator() const;
+        // Return a reference providing non-modifiable access to the
+        // key-equality functor of this table.
+
+    const ValueType *elementAddress(SizeType index) const;
+        // Return the address of the slot at the specified 'index' of this
+        // table.  The behavior is undefined unless 'index <= capacity()'.
+
+    const signed char *controlAddress(SizeType index) const;
+        // Return the address of the control byte of the slot at the specified
+        // 'index' of this table.  The behavior is undefined unless
+        // 'index <= capacity()'.
+
+    SizeType find(const KeyType& key) const;
+        // Return the index of the element in this table having the specified
+        // 'key', or 'capacity()' if there is no such element.
+
+    SizeType firstIndex() const;
+        // Return the index of the first full slot of this table, or
+        // 'capacity()' if this table is empty.
+
+    const HASHER& hasher() const;
+        // Return a reference providing non-modifiable access to the hash
+        // functor of this table.
+
+    SizeType nextIndex(SizeType index) const;
+        // Return the index of the first full slot of this table following the
+        // slot at the specified 'index', or 'capacity()' if there is no such
+        // slot.  The behavior is undefined unless 'index < capacity()'.
+
+    float loadFactor() const;
+        // Return the ratio of 'size()' to 'capacity()', or 0 if this table
+        // has zero capacity.
+
+    float maxLoadFactor() const;
+        // Return the (fixed) maximum load factor of this table.
+
+    SizeType maxSize() const;
+        // Return a theoretical upper bound on the number of elements this
+        // table could hold.
+
+    SizeType size() const;
+        // Return the number of elements in this table.
+};
+
+// FREE OPERATORS
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+bool operator==(
+         const FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>& lhs,
+         const FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects have the same
+    // value, and 'false' otherwise.  Two 'FlatHashTable' objects have the same
+    // value if they have the same number of elements, and for each element of
+    // 'lhs' there is an element of 'rhs' having the same key (as determined
+    // by the comparator of 'rhs') that compares equal using 'operator=='.
+
+// ============================================================================
+//                  TEMPLATE AND INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+                        // ----------------------------
+                        // struct FlatHashTable_ImpUtil
+                        // ----------------------------
+
+// CLASS METHODS
+inline
+bool FlatHashTable_ImpUtil::isFull(signed char control)
+{
+    return control >= 0;
+}
+
+#ifdef BSLSTL_FLATHASHTABLE_USE_SSE2
+
+inline
+unsigned int FlatHashTable_ImpUtil::matchByte(const signed char *group,
+                                              signed char        value)
+{
+    const __m128i ctrl = _mm_loadu_si128(
+                                   reinterpret_cast<const __m128i *>(group));
+    return static_cast<unsigned int>(
+                   _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(value),
+                                                    ctrl)));
+}
+
+inline
+unsigned int FlatHashTable_ImpUtil::matchEmpty(const signed char *group)
+{
+    return matchByte(group, static_cast<signed char>(k_EMPTY));
+}
+
+inline
+unsigned int FlatHashTable_ImpUtil::matchEmptyOrDeleted(
+                                                     const signed char *group)
+{
+    // Both 'k_EMPTY' and 'k_DELETED' are less than 'k_SENTINEL', and all
+    // other control bytes are not.
+
+    const __m128i ctrl = _mm_loadu_si128(
+                                   reinterpret_cast<const __m128i *>(group));
+    return static_cast<unsigned int>(
+               _mm_movemask_epi8(_mm_cmpgt_epi8(_mm_set1_epi8(k_SENTINEL),
+                                                ctrl)));
+}
+
+#else
+
+inline
+unsigned int FlatHashTable_ImpUtil::matchByte(const signed char *group,
+                                              signed char        value)
+{
+    unsigned int result = 0;
+    for (int i = 0; i < k_GROUP_WIDTH; ++i) {
+        result |= static_cast<unsigned int>(group[i] == value) << i;
+    }
+    return result;
+}
+
+inline
+unsigned int FlatHashTable_ImpUtil::matchEmpty(const signed char *group)
+{
+    return matchByte(group, static_cast<signed char>(k_EMPTY));
+}
+
+inline
+unsigned int FlatHashTable_ImpUtil::matchEmptyOrDeleted(
+                                                     const signed char *group)
+{
+    unsigned int result = 0;
+    for (int i = 0; i < k_GROUP_WIDTH; ++i) {
+        result |= static_cast<unsigned int>(group[i] < k_SENTINEL) << i;
+    }
+    return result;
+}
+
+#endif
+
+inline
+int FlatHashTable_ImpUtil::countTrailingZeros(unsigned int mask)
+{
+    BSLS_ASSERT_SAFE(0 != mask);
+
+#if defined(BSLS_PLATFORM_CMP_GNU) || defined(BSLS_PLATFORM_CMP_CLANG)
+    return __builtin_ctz(mask);
+#else
+    int result = 0;
+    while (0 == (mask & 1)) {
+        mask >>= 1;
+        ++result;
+    }
+    return result;
+#endif
+}
+
+inline
+int FlatHashTable_ImpUtil::countLeadingZeros(unsigned int mask)
+{
+    BSLS_ASSERT_SAFE(mask < (1u << k_GROUP_WIDTH));
+
+    int result = k_GROUP_WIDTH;
+    while (mask) {
+        mask >>= 1;
+        --result;
+    }
+    return result;
+}
+
+inline
+native_std::size_t FlatHashTable_ImpUtil::mixHashCode(
+                                                 native_std::size_t hashCode)
+{
+#if defined(BSLS_PLATFORM_CPU_64_BIT)
+    hashCode *= 0x9E3779B97F4A7C15ULL;
+    return hashCode ^ (hashCode >> 32);
+#else
+    hashCode *= 0x9E3779B9U;
+    return hashCode ^ (hashCode >> 16);
+#endif
+}
+
+inline
+native_std::size_t FlatHashTable_ImpUtil::normalizeCapacity(
+                                                 native_std::size_t capacity)
+{
+    native_std::size_t result = k_GROUP_WIDTH - 1;
+    while (result < capacity) {
+        result = result * 2 + 1;
+    }
+    return result;
+}
+
+inline
+native_std::size_t FlatHashTable_ImpUtil::capacityToGrowth(
+                                                 native_std::size_t capacity)
+{
+    return capacity - (capacity + 1) / 8;
+}
+
+inline
+native_std::size_t FlatHashTable_ImpUtil::growthToLowerboundCapacity(
+                                                   native_std::size_t growth)
+{
+    return growth + (growth + 7) / 7;
+}
+
+                        // ---------------------------
+                        // class FlatHashTableIterator
+                        // ---------------------------
+
+// PRIVATE MANIPULATORS
+template <class VALUE_TYPE, class DIFFERENCE_TYPE>
+inline
+void FlatHashTableIterator<VALUE_TYPE, DIFFERENCE_TYPE>::skipEmptySlots()
+{
+    while (*d_control_p < FlatHashTable_ImpUtil::k_SENTINEL) {
+        ++d_control_p;
+        ++d_slot_p;
+    }
+}
+
+// CREATORS
+template <class VALUE_TYPE, class DIFFERENCE_TYPE>
+inline
+FlatHashTableIterator<VALUE_TYPE, DIFFERENCE_TYPE>::FlatHashTableIterator()
+: d_control_p(0)
+, d_slot_p(0)
+{
+}
+
+template <class VALUE_TYPE, class DIFFERENCE_TYPE>
+inline
+FlatHashTableIterator<VALUE_TYPE, DIFFERENCE_TYPE>::FlatHashTableIterator(
+                                                  const signed char *control,
+                                                  NcType            *slot)
+: d_control_p(control)
+, d_slot_p(slot)
+{
+    BSLS_ASSERT_SAFE(control);
+}
+
+template <class VALUE_TYPE, class DIFFERENCE_TYPE>
+inline
+FlatHashTableIterator<VALUE_TYPE, DIFFERENCE_TYPE>::FlatHashTableIterator(
+                                                       const NcIter& original)
+: d_control_p(original.control())
+, d_slot_p(original.slot())
+{
+}
+
+// MANIPULATORS
+template <class VALUE_TYPE, class DIFFERENCE_TYPE>
+inline
+FlatHashTableIterator<VALUE_TYPE, DIFFERENCE_TYPE>&
+FlatHashTableIterator<VALUE_TYPE, DIFFERENCE_TYPE>::operator++()
+{
+    BSLS_ASSERT_SAFE(d_control_p);
+    BSLS_ASSERT_SAFE(FlatHashTable_ImpUtil::isFull(*d_control_p));
+
+    ++d_control_p;
+    ++d_slot_p;
+    skipEmptySlots();
+    return *this;
+}
+
+// ACCESSORS
+template <class VALUE_TYPE, class DIFFERENCE_TYPE>
+inline
+typename FlatHashTableIterator<VALUE_TYPE, DIFFERENCE_TYPE>::reference
+FlatHashTableIterator<VALUE_TYPE, DIFFERENCE_TYPE>::operator*() const
+{
+    BSLS_ASSERT_SAFE(d_control_p);
+    BSLS_ASSERT_SAFE(FlatHashTable_ImpUtil::isFull(*d_control_p));
+
+    return *d_slot_p;
+}
+
+template <class VALUE_TYPE, class DIFFERENCE_TYPE>
+inline
+typename FlatHashTableIterator<VALUE_TYPE, DIFFERENCE_TYPE>::pointer
+FlatHashTableIterator<VALUE_TYPE, DIFFERENCE_TYPE>::operator->() const
+{
+    BSLS_ASSERT_SAFE(d_control_p);
+    BSLS_ASSERT_SAFE(FlatHashTable_ImpUtil::isFull(*d_control_p));
+
+    return d_slot_p;
+}
+
+template <class VALUE_TYPE, class DIFFERENCE_TYPE>
+inline
+const signed char *
+FlatHashTableIterator<VALUE_TYPE, DIFFERENCE_TYPE>::control() const
+{
+    return d_control_p;
+}
+
+template <class VALUE_TYPE, class DIFFERENCE_TYPE>
+inline
+typename FlatHashTableIterator<VALUE_TYPE, DIFFERENCE_TYPE>::NcType *
+FlatHashTableIterator<VALUE_TYPE, DIFFERENCE_TYPE>::slot() const
+{
+    return d_slot_p;
+}
+
+// FREE OPERATORS
+template <class VALUE_TYPE, class DIFFERENCE_TYPE>
+inline
+bool operator==(
+               const FlatHashTableIterator<VALUE_TYPE, DIFFERENCE_TYPE>& lhs,
+               const FlatHashTableIterator<VALUE_TYPE, DIFFERENCE_TYPE>& rhs)
+{
+    return lhs.control() == rhs.control();
+}
+
+template <class VALUE_TYPE, class DIFFERENCE_TYPE>
+inline
+bool operator==(
+         const FlatHashTableIterator<VALUE_TYPE, DIFFERENCE_TYPE>&       lhs,
+         const FlatHashTableIterator<const VALUE_TYPE, DIFFERENCE_TYPE>& rhs)
+{
+    return lhs.control() == rhs.control();
+}
+
+template <class VALUE_TYPE, class DIFFERENCE_TYPE>
+inline
+bool operator==(
+         const FlatHashTableIterator<const VALUE_TYPE, DIFFERENCE_TYPE>& lhs,
+         const FlatHashTableIterator<VALUE_TYPE, DIFFERENCE_TYPE>&       rhs)
+{
+    return lhs.control() == rhs.control();
+}
+
+template <class VALUE_TYPE, class DIFFERENCE_TYPE>
+inline
+bool operator!=(
+               const FlatHashTableIterator<VALUE_TYPE, DIFFERENCE_TYPE>& lhs,
+               const FlatHashTableIterator<VALUE_TYPE, DIFFERENCE_TYPE>& rhs)
+{
+    return lhs.control() != rhs.control();
+}
+
+template <class VALUE_TYPE, class DIFFERENCE_TYPE>
+inline
+bool operator!=(
+         const FlatHashTableIterator<VALUE_TYPE, DIFFERENCE_TYPE>&       lhs,
+         const FlatHashTableIterator<const VALUE_TYPE, DIFFERENCE_TYPE>& rhs)
+{
+    return lhs.control() != rhs.control();
+}
+
+template <class VALUE_TYPE, class DIFFERENCE_TYPE>
+inline
+bool operator!=(
+         const FlatHashTableIterator<const VALUE_TYPE, DIFFERENCE_TYPE>& lhs,
+         const FlatHashTableIterator<VALUE_TYPE, DIFFERENCE_TYPE>&       rhs)
+{
+    return lhs.control() != rhs.control();
+}
+
+template <class VALUE_TYPE, class DIFFERENCE_TYPE>
+inline
+FlatHashTableIterator<VALUE_TYPE, DIFFERENCE_TYPE>
+operator++(FlatHashTableIterator<VALUE_TYPE, DIFFERENCE_TYPE>& iter, int)
+{
+    FlatHashTableIterator<VALUE_TYPE, DIFFERENCE_TYPE> temp(iter);
+    ++iter;
+    return temp;
+}
+
+                        // ----------------------------
+                        // class FlatHashTable_Proctor
+                        // ----------------------------
+
+// CREATORS
+template <class FLAT_HASH_TABLE>
+inline
+FlatHashTable_Proctor<FLAT_HASH_TABLE>::FlatHashTable_Proctor(
+                                                       FLAT_HASH_TABLE *table)
+: d_table_p(table)
+{
+    BSLS_ASSERT_SAFE(table);
+}
+
+template <class FLAT_HASH_TABLE>
+inline
+FlatHashTable_Proctor<FLAT_HASH_TABLE>::~FlatHashTable_Proctor()
+{
+    if (d_table_p) {
+        d_table_p->removeAllAndDeallocate();
+    }
+}
+
+// MANIPULATORS
+template <class FLAT_HASH_TABLE>
+inline
+void FlatHashTable_Proctor<FLAT_HASH_TABLE>::release()
+{
+    d_table_p = 0;
+}
+
+                        // -------------------
+                        // class FlatHashTable
+                        // -------------------
+
+// PRIVATE CLASS METHODS
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+inline
+native_std::size_t
+FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::numBlocks(
+                                                            SizeType capacity)
+{
+    const native_std::size_t numBytes = capacity * sizeof(ValueType)
+                                      + capacity
+                                      + ImpUtil::k_GROUP_WIDTH;
+    return (numBytes + sizeof(BlockType) - 1) / sizeof(BlockType);
+}
+
+// PRIVATE MANIPULATORS
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+void FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::allocateTable(
+                                                            SizeType capacity)
+{
+    BSLS_ASSERT_SAFE(0 == d_capacity);
+    BSLS_ASSERT_SAFE(0 == d_size);
+    BSLS_ASSERT_SAFE(0 == ((capacity + 1) & capacity));
+
+    const native_std::size_t maxCapacity =
+                    (~native_std::size_t(0) - ImpUtil::k_GROUP_WIDTH
+                                            - sizeof(BlockType))
+                  / (sizeof(ValueType) + 1);
+    if (capacity > maxCapacity) {
+        StdExceptUtil::throwLengthError(
+                             "FlatHashTable capacity overflows 'size_t'.");
+    }
+
+    BlockAllocator blockAllocator(d_allocator);
+    BlockType *block = BlockAllocTraits::allocate(blockAllocator,
+                                                  numBlocks(capacity));
+
+    d_slots_p   = reinterpret_cast<ValueType *>(block);
+    d_control_p = reinterpret_cast<signed char *>(d_slots_p + capacity);
+    native_std::memset(d_control_p,
+                       ImpUtil::k_EMPTY,
+                       capacity + ImpUtil::k_GROUP_WIDTH);
+    d_control_p[capacity] = ImpUtil::k_SENTINEL;
+
+    d_capacity   = capacity;
+    d_growthLeft = ImpUtil::capacityToGrowth(capacity);
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+void FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::
+                                                      removeAllAndDeallocate()
+{
+    if (0 == d_capacity) {
+        return;                                                       // RETURN
+    }
+
+    removeAll();
+
+    BlockAllocator blockAllocator(d_allocator);
+    BlockAllocTraits::deallocate(blockAllocator,
+                                 reinterpret_cast<BlockType *>(d_slots_p),
+                                 numBlocks(d_capacity));
+
+    d_control_p  = ImpUtil::emptyGroup();
+    d_slots_p    = 0;
+    d_capacity   = 0;
+    d_growthLeft = 0;
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+inline
+void FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::setControl(
+                                                       SizeType    index,
+                                                       signed char control)
+{
+    BSLS_ASSERT_SAFE(index < d_capacity);
+
+    // The control bytes at indices '[0 .. k_GROUP_WIDTH - 2]' are replicated
+    // after the sentinel.  For any other 'index', the expression below
+    // evaluates to 'index' itself.
+
+    d_control_p[index] = control;
+    d_control_p[((index - (ImpUtil::k_GROUP_WIDTH - 1)) & d_capacity)
+                           + (ImpUtil::k_GROUP_WIDTH - 1)] = control;
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+typename FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::SizeType
+FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::findFirstNonFull(
+                                           native_std::size_t hashCode) const
+{
+    BSLS_ASSERT_SAFE(0 != d_capacity);
+
+    SizeType offset = (hashCode >> 7) & d_capacity;
+    SizeType stride = 0;
+    while (true) {
+        const unsigned int mask =
+                        ImpUtil::matchEmptyOrDeleted(d_control_p + offset);
+        if (mask) {
+            return (offset + ImpUtil::countTrailingZeros(mask))
+                                                               & d_capacity;
+                                                                      // RETURN
+        }
+        stride += ImpUtil::k_GROUP_WIDTH;
+        offset  = (offset + stride) & d_capacity;
+    }
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+typename FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::SizeType
+FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::prepareInsert(
+                                                 native_std::size_t hashCode)
+{
+    if (0 != d_capacity) {
+        SizeType index = findFirstNonFull(hashCode);
+        if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(
+                  0 != d_growthLeft
+               || ImpUtil::k_DELETED == d_control_p[index])) {
+            return index;                                             // RETURN
+        }
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+    }
+
+    // No slot can be filled without exceeding the maximum load factor.  If the
+    // elements occupy at most 25/32 of the capacity (i.e., tombstones occupy
+    // at least about 3/32 of it, the maximum load factor being 7/8), rehash
+    // without growing to reclaim the tombstones; otherwise, double the
+    // capacity.
+
+    if (0 == d_capacity) {
+        resize(ImpUtil::k_GROUP_WIDTH - 1);
+    }
+    else if (d_size * 32 <= d_capacity * 25) {
+        resize(d_capacity);
+    }
+    else {
+        resize(d_capacity * 2 + 1);
+    }
+    return findFirstNonFull(hashCode);
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+inline
+void FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::finishInsert(
+                                                 SizeType           index,
+                                                 native_std::size_t hashCode)
+{
+    BSLS_ASSERT_SAFE(!ImpUtil::isFull(d_control_p[index]));
+
+    if (ImpUtil::k_EMPTY == d_control_p[index]) {
+        --d_growthLeft;
+    }
+    setControl(index, static_cast<signed char>(hashCode & 0x7F));
+    ++d_size;
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+void FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::resize(
+                                                         SizeType newCapacity)
+{
+    BSLS_ASSERT_SAFE(ImpUtil::capacityToGrowth(newCapacity) >= d_size);
+
+    FlatHashTable other(d_hasher, d_comparator, 0, d_allocator);
+    FlatHashTable_Proctor<FlatHashTable> proctor(&other);
+    other.allocateTable(newCapacity);
+
+    // Elements relocated bitwise are still owned by this table until the
+    // loop completes, so 'other.d_size' is not updated for them: should the
+    // hasher throw, the proctor then releases the memory of 'other' without
+    // destroying any element.
+
+    const bool isBitwise = bslmf::IsBitwiseMoveable<ValueType>::value;
+
+    for (SizeType i = 0; i < d_capacity; ++i) {
+        if (!ImpUtil::isFull(d_control_p[i])) {
+            continue;                                               // CONTINUE
+        }
+        const native_std::size_t hashCode =
+                       hashCodeForKey(KEY_CONFIG::extractKey(d_slots_p[i]));
+        const SizeType target = other.findFirstNonFull(hashCode);
+        if (isBitwise) {
+            native_std::memcpy(static_cast<void *>(other.d_slots_p + target),
+                               d_slots_p + i,
+                               sizeof(ValueType));
+            other.setControl(target,
+                             static_cast<signed char>(hashCode & 0x7F));
+            --other.d_growthLeft;
+        }
+        else {
+            AllocatorTraits::construct(other.d_allocator,
+                                       other.d_slots_p + target,
+                                       d_slots_p[i]);
+            other.finishInsert(target, hashCode);
+        }
+    }
+    proctor.release();
+
+    // Every element now lives in 'other'.  Destroy the originals (unless they
+    // were relocated bitwise), and exchange the tables.
+
+    if (isBitwise) {
+        other.d_size = d_size;
+        d_size       = 0;
+    }
+    removeAllAndDeallocate();
+    quickSwapRetainAllocators(&other);
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+void FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::
+                              quickSwapRetainAllocators(FlatHashTable *other)
+{
+    BSLS_ASSERT_SAFE(other);
+
+    bslalg::SwapUtil::swap(&d_hasher,     &other->d_hasher);
+    bslalg::SwapUtil::swap(&d_comparator, &other->d_comparator);
+    bslalg::SwapUtil::swap(&d_control_p,  &other->d_control_p);
+    bslalg::SwapUtil::swap(&d_slots_p,    &other->d_slots_p);
+    bslalg::SwapUtil::swap(&d_size,       &other->d_size);
+    bslalg::SwapUtil::swap(&d_capacity,   &other->d_capacity);
+    bslalg::SwapUtil::swap(&d_growthLeft, &other->d_growthLeft);
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+inline
+void FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::insertUnique(
+                                                      const ValueType& value)
+{
+    BSLS_ASSERT_SAFE(0 != d_growthLeft);
+
+    const native_std::size_t hashCode =
+                               hashCodeForKey(KEY_CONFIG::extractKey(value));
+    const SizeType index = findFirstNonFull(hashCode);
+    AllocatorTraits::construct(d_allocator, d_slots_p + index, value);
+    finishInsert(index, hashCode);
+}
+
+// PRIVATE ACCESSORS
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+inline
+native_std::size_t
+FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::hashCodeForKey(
+                                                     const KeyType& key) const
+{
+    return ImpUtil::mixHashCode(d_hasher(key));
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+typename FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::SizeType
+FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::find(
+                                          const KeyType&     key,
+                                          native_std::size_t hashCode) const
+{
+    // A table having zero capacity uses the (static) empty group as its
+    // control array, for which the loop below terminates on the first
+    // iteration, returning 0.
+
+    const signed char h2     = static_cast<signed char>(hashCode & 0x7F);
+    SizeType          offset = (hashCode >> 7) & d_capacity;
+    SizeType          stride = 0;
+    while (true) {
+        const signed char *group = d_control_p + offset;
+        for (unsigned int mask = ImpUtil::matchByte(group, h2);
+             mask;
+             mask &= mask - 1) {
+            const SizeType index =
+                     (offset + ImpUtil::countTrailingZeros(mask)) & d_capacity;
+            if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(d_comparator(
+                                key,
+                                KEY_CONFIG::extractKey(d_slots_p[index])))) {
+                return index;                                         // RETURN
+            }
+        }
+        if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(ImpUtil::matchEmpty(group))) {
+            return d_capacity;                                        // RETURN
+        }
+        stride += ImpUtil::k_GROUP_WIDTH;
+        offset  = (offset + stride) & d_capacity;
+    }
+}
+
+// CREATORS
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+inline
+FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::FlatHashTable(
+                                              const ALLOCATOR& basicAllocator)
+: d_control_p(ImpUtil::emptyGroup())
+, d_slots_p(0)
+, d_size(0)
+, d_capacity(0)
+, d_growthLeft(0)
+, d_hasher()
+, d_comparator()
+, d_allocator(basicAllocator)
+{
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::FlatHashTable(
+                                         const HASHER&     hash,
+                                         const COMPARATOR& compare,
+                                         SizeType          initialNumElements,
+                                         const ALLOCATOR&  basicAllocator)
+: d_control_p(ImpUtil::emptyGroup())
+, d_slots_p(0)
+, d_size(0)
+, d_capacity(0)
+, d_growthLeft(0)
+, d_hasher(hash)
+, d_comparator(compare)
+, d_allocator(basicAllocator)
+{
+    if (0 != initialNumElements) {
+        allocateTable(ImpUtil::normalizeCapacity(
+                     ImpUtil::growthToLowerboundCapacity(initialNumElements)));
+    }
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::FlatHashTable(
+                                         const FlatHashTable& original,
+                                         const ALLOCATOR&     basicAllocator)
+: d_control_p(ImpUtil::emptyGroup())
+, d_slots_p(0)
+, d_size(0)
+, d_capacity(0)
+, d_growthLeft(0)
+, d_hasher(original.d_hasher)
+, d_comparator(original.d_comparator)
+, d_allocator(basicAllocator)
+{
+    if (0 == original.d_size) {
+        return;                                                       // RETURN
+    }
+
+    // Elements are re-inserted (rather than copied slot-for-slot) so that the
+    // copy is free of tombstones, and sized for the number of elements.
+
+    FlatHashTable_Proctor<FlatHashTable> proctor(this);
+    allocateTable(ImpUtil::normalizeCapacity(
+                    ImpUtil::growthToLowerboundCapacity(original.d_size)));
+    for (SizeType i = 0; i < original.d_capacity; ++i) {
+        if (ImpUtil::isFull(original.d_control_p[i])) {
+            insertUnique(original.d_slots_p[i]);
+        }
+    }
+    proctor.release();
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+inline
+FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::~FlatHashTable()
+{
+    removeAllAndDeallocate();
+}
+
+// MANIPULATORS
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>&
+FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::operator=(
+                                                      const FlatHashTable& rhs)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(this != &rhs)) {
+
+        if (AllocatorTraits::propagate_on_container_copy_assignment::VALUE) {
+            FlatHashTable other(rhs, rhs.d_allocator);
+            bslalg::SwapUtil::swap(&d_allocator, &other.d_allocator);
+            quickSwapRetainAllocators(&other);
+        }
+        else {
+            FlatHashTable other(rhs, d_allocator);
+            quickSwapRetainAllocators(&other);
+        }
+    }
+    return *this;
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+typename FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::SizeType
+FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::insertIfMissing(
+                                             bool             *isInsertedFlag,
+                                             const ValueType&  value)
+{
+    BSLS_ASSERT_SAFE(isInsertedFlag);
+
+    const KeyType&           key      = KEY_CONFIG::extractKey(value);
+    const native_std::size_t hashCode = hashCodeForKey(key);
+
+    SizeType index = find(key, hashCode);
+    if (index != d_capacity) {
+        *isInsertedFlag = false;
+        return index;                                                 // RETURN
+    }
+
+    // 'value' cannot refer to an element of this table (otherwise it would
+    // have been found), so it remains valid if 'prepareInsert' rehashes.
+
+    index = prepareInsert(hashCode);
+    AllocatorTraits::construct(d_allocator, d_slots_p + index, value);
+    finishInsert(index, hashCode);
+
+    *isInsertedFlag = true;
+    return index;
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+typename FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::SizeType
+FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::insertIfMissing(
+                                                           const KeyType& key)
+{
+    typedef typename ValueType::second_type MappedType;
+
+    const native_std::size_t hashCode = hashCodeForKey(key);
+
+    SizeType index = find(key, hashCode);
+    if (index != d_capacity) {
+        return index;                                                 // RETURN
+    }
+
+    index = prepareInsert(hashCode);
+    AllocatorTraits::construct(d_allocator,
+                               d_slots_p + index,
+                               key,
+                               MappedType());
+    finishInsert(index, hashCode);
+    return index;
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+void FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::remove(
+                                                               SizeType index)
+{
+    BSLS_ASSERT_SAFE(index < d_capacity);
+    BSLS_ASSERT_SAFE(ImpUtil::isFull(d_control_p[index]));
+
+    AllocatorTraits::destroy(d_allocator, d_slots_p + index);
+    --d_size;
+
+    // If the slot is not part of a run of 'k_GROUP_WIDTH' full or deleted
+    // slots, no probe sequence can have passed over it while searching for an
+    // element stored beyond it, and it may be marked 'k_EMPTY'; otherwise, a
+    // tombstone is required so that such searches continue past it.
+
+    const SizeType     indexBefore = (index - ImpUtil::k_GROUP_WIDTH)
+                                                                & d_capacity;
+    const unsigned int emptyAfter  = ImpUtil::matchEmpty(d_control_p + index);
+    const unsigned int emptyBefore = ImpUtil::matchEmpty(d_control_p
+                                                                + indexBefore);
+    const bool wasNeverFull = emptyBefore
+                           && emptyAfter
+                           && ImpUtil::countTrailingZeros(emptyAfter)
+                            + ImpUtil::countLeadingZeros(emptyBefore)
+                                                     < ImpUtil::k_GROUP_WIDTH;
+
+    if (wasNeverFull) {
+        setControl(index, ImpUtil::k_EMPTY);
+        ++d_growthLeft;
+    }
+    else {
+        setControl(index, ImpUtil::k_DELETED);
+    }
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+void FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::removeAll()
+{
+    if (0 == d_capacity) {
+        return;                                                       // RETURN
+    }
+
+    for (SizeType i = 0; d_size && i < d_capacity; ++i) {
+        if (ImpUtil::isFull(d_control_p[i])) {
+            AllocatorTraits::destroy(d_allocator, d_slots_p + i);
+            --d_size;
+        }
+    }
+    d_size = 0;
+
+    native_std::memset(d_control_p,
+                       ImpUtil::k_EMPTY,
+                       d_capacity + ImpUtil::k_GROUP_WIDTH);
+    d_control_p[d_capacity] = ImpUtil::k_SENTINEL;
+    d_growthLeft = ImpUtil::capacityToGrowth(d_capacity);
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+void FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::rehash(
+                                                             SizeType numSlots)
+{
+    if (0 == numSlots && 0 == d_size) {
+        removeAllAndDeallocate();
+        return;                                                       // RETURN
+    }
+
+    SizeType newCapacity = ImpUtil::normalizeCapacity(
+                                ImpUtil::growthToLowerboundCapacity(d_size));
+    if (newCapacity < numSlots) {
+        newCapacity = ImpUtil::normalizeCapacity(numSlots);
+    }
+    if (0 == d_capacity) {
+        allocateTable(newCapacity);
+    }
+    else if (newCapacity != d_capacity) {
+        resize(newCapacity);
+    }
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+void FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::
+                                   reserveForNumElements(SizeType numElements)
+{
+    if (numElements <= d_size + d_growthLeft) {
+        return;                                                       // RETURN
+    }
+
+    const SizeType newCapacity = ImpUtil::normalizeCapacity(
+                           ImpUtil::growthToLowerboundCapacity(numElements));
+    if (0 == d_capacity) {
+        allocateTable(newCapacity);
+    }
+    else {
+        resize(newCapacity);
+    }
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+void FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::swap(
+                                                         FlatHashTable& other)
+{
+    // This trait should perform 'if' at compile-time.
+
+    if (AllocatorTraits::propagate_on_container_swap::VALUE) {
+        bslalg::SwapUtil::swap(&d_allocator, &other.d_allocator);
+    }
+    else {
+        BSLS_ASSERT(d_allocator == other.d_allocator);
+    }
+    quickSwapRetainAllocators(&other);
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+inline
+typename FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::ValueType *
+FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::elementAddress(
+                                                               SizeType index)
+{
+    BSLS_ASSERT_SAFE(index <= d_capacity);
+
+    return d_slots_p + index;
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+inline
+signed char *
+FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::controlAddress(
+                                                               SizeType index)
+{
+    BSLS_ASSERT_SAFE(index <= d_capacity);
+
+    return d_control_p + index;
+}
+
+// ACCESSORS
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+inline
+ALLOCATOR
+FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::allocator() const
+{
+    return d_allocator;
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+inline
+typename FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::SizeType
+FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::capacity() const
+{
+    return d_capacity;
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+inline
+const COMPARATOR&
+FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::comparator() const
+{
+    return d_comparator;
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+inline
+const typename FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::
+                                                                   ValueType *
+FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::elementAddress(
+                                                         SizeType index) const
+{
+    BSLS_ASSERT_SAFE(index <= d_capacity);
+
+    return d_slots_p + index;
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+inline
+const signed char *
+FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::controlAddress(
+                                                         SizeType index) const
+{
+    BSLS_ASSERT_SAFE(index <= d_capacity);
+
+    return d_control_p + index;
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+inline
+typename FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::SizeType
+FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::find(
+                                                     const KeyType& key) const
+{
+    return find(key, hashCodeForKey(key));
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+inline
+typename FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::SizeType
+FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::firstIndex() const
+{
+    SizeType index = 0;
+    while (d_control_p[index] < ImpUtil::k_SENTINEL) {
+        ++index;
+    }
+    return index;
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+inline
+const HASHER&
+FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::hasher() const
+{
+    return d_hasher;
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+inline
+typename FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::SizeType
+FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::nextIndex(
+                                                         SizeType index) const
+{
+    BSLS_ASSERT_SAFE(index < d_capacity);
+
+    do {
+        ++index;
+    } while (d_control_p[index] < ImpUtil::k_SENTINEL);
+    return index;
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+inline
+float FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::loadFactor()
+                                                                         const
+{
+    return d_capacity
+           ? static_cast<float>(static_cast<double>(d_size)
+                                         / static_cast<double>(d_capacity))
+           : 0.0f;
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+inline
+float
+FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::maxLoadFactor() const
+{
+    return 0.875f;
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+inline
+typename FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::SizeType
+FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::maxSize() const
+{
+    return AllocatorTraits::max_size(d_allocator) / (sizeof(ValueType) + 1);
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+inline
+typename FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::SizeType
+FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::size() const
+{
+    return d_size;
+}
+
+// FREE OPERATORS
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+bool operator==(
+          const FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>& lhs,
+          const FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>& rhs)
+{
+    typedef FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR> Table;
+    typedef typename Table::SizeType                                 SizeType;
+
+    if (lhs.size() != rhs.size()) {
+        return false;                                                 // RETURN
+    }
+
+    for (SizeType i = 0; i < lhs.capacity(); ++i) {
+        if (!FlatHashTable_ImpUtil::isFull(*lhs.controlAddress(i))) {
+            continue;                                               // CONTINUE
+        }
+        const typename Table::ValueType& value = *lhs.elementAddress(i);
+        const SizeType index = rhs.find(KEY_CONFIG::extractKey(value));
+        if (index == rhs.capacity()
+         || !(value == *rhs.elementAddress(index))) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+}  // close package namespace
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,775 @@
+// bslstl_flathashtable.t.cpp                                         -*-C++-*-
+
+#include <bslstl_flathashtable.h>
+
+#include <bslstl_allocator.h>
+#include <bslstl_equalto.h>
+#include <bslstl_hash.h>
+#include <bslstl_unorderedsetkeyconfiguration.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatormonitor.h>
+#include <bsltf_stdstatefulallocator.h>
+#include <bsls_bsltestutil.h>
+#include <bsls_nativestd.h>
+
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+
+using namespace BloombergLP;
+using namespace std;
+
+//=============================================================================
+//                             TEST PLAN
+//-----------------------------------------------------------------------------
+//                             Overview
+//                             --------
+// The component under test is an open-addressing hash table that is an
+// implementation detail of 'bsl::flat_hash_map' and 'bsl::flat_hash_set'.  We
+// first verify the control-byte utilities of 'FlatHashTable_ImpUtil' against
+// a brute-force computation, so that the (platform-dependent) SSE2 and
+// portable implementations are both checked against the same oracle.  We
+// then drive the table with a pseudo-random sequence of insertions and
+// removals, comparing it after every operation with a simple reference
+// array, and using a hash functor that forces long probe sequences through
+// tombstones.  Finally, we verify that copy construction, assignment, and
+// swap propagate allocators as directed by 'bsl::allocator_traits'.
+//-----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 2] bool isFull(signed char control);
+// [ 2] unsigned int matchByte(const signed char *group, signed char value);
+// [ 2] unsigned int matchEmpty(const signed char *group);
+// [ 2] unsigned int matchEmptyOrDeleted(const signed char *group);
+// [ 2] int countTrailingZeros(unsigned int mask);
+// [ 2] int countLeadingZeros(unsigned int mask);
+// [ 2] size_t normalizeCapacity(size_t capacity);
+// [ 2] size_t capacityToGrowth(size_t capacity);
+// [ 2] size_t growthToLowerboundCapacity(size_t growth);
+//
+// CREATORS
+// [ 1] FlatHashTable(const ALLOCATOR& basicAllocator);
+// [ 3] FlatHashTable(hash, compare, initialNumElements, basicAllocator);
+// [ 4] FlatHashTable(const FlatHashTable& original, basicAllocator);
+// [ 1] ~FlatHashTable();
+//
+// MANIPULATORS
+// [ 4] FlatHashTable& operator=(const FlatHashTable& rhs);
+// [ 3] SizeType insertIfMissing(bool *isInsertedFlag, const ValueType&);
+// [ 3] void remove(SizeType index);
+// [ 3] void removeAll();
+// [ 3] void rehash(SizeType numSlots);
+// [ 3] void reserveForNumElements(SizeType numElements);
+// [ 4] void swap(FlatHashTable& other);
+//
+// ACCESSORS
+// [ 4] ALLOCATOR allocator() const;
+// [ 3] SizeType capacity() const;
+// [ 3] SizeType find(const KeyType& key) const;
+// [ 3] SizeType firstIndex() const;
+// [ 3] SizeType nextIndex(SizeType index) const;
+// [ 3] float loadFactor() const;
+// [ 3] SizeType size() const;
+//
+// FREE OPERATORS
+// [ 4] bool operator==(const FlatHashTable& lhs, const FlatHashTable& rhs);
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+//-----------------------------------------------------------------------------
+
+//=============================================================================
+//                  STANDARD BDE ASSERT TEST MACRO
+//-----------------------------------------------------------------------------
+static int testStatus = 0;
+
+static void aSsErT(bool b, const char *s, int i) {
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+//=============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef bslstl::FlatHashTable_ImpUtil                 ImpUtil;
+typedef bslstl::UnorderedSetKeyConfiguration<int>     IntConfig;
+
+typedef bslstl::FlatHashTable<IntConfig,
+                              bsl::hash<int>,
+                              bsl::equal_to<int>,
+                              bsl::allocator<int> >   Obj;
+
+namespace {
+
+struct CollidingHash {
+    // This hash functor maps every integer onto one of only four hash codes,
+    // so that a table using it has long probe sequences.
+
+    native_std::size_t operator()(int value) const
+        // Return a hash code for the specified 'value'.
+    {
+        return static_cast<native_std::size_t>(value & 3);
+    }
+};
+
+class Random {
+    // This class provides a deterministic linear congruential generator.
+
+    // DATA
+    unsigned int d_state;
+
+  public:
+    // CREATORS
+    explicit Random(unsigned int seed) : d_state(seed) {}
+        // Create a generator having the specified 'seed'.
+
+    // MANIPULATORS
+    int operator()(int range)
+        // Return a pseudo-random integer in the range '[0, range)'.
+    {
+        d_state = d_state * 1103515245u + 12345u;
+        return static_cast<int>((d_state >> 8) % range);
+    }
+};
+
+template <class TABLE>
+int countElements(const TABLE& table)
+    // Return the number of full slots visited by iterating over the specified
+    // 'table' using 'firstIndex' and 'nextIndex'.
+{
+    int result = 0;
+    for (typename TABLE::SizeType i = table.firstIndex();
+         i != table.capacity();
+         i = table.nextIndex(i)) {
+        ++result;
+    }
+    return result;
+}
+
+template <class ALLOCATOR>
+void testAllocatorPropagation()
+    // Verify that copy construction, copy assignment, and swap of a
+    // 'FlatHashTable' using the (template parameter) 'ALLOCATOR' type
+    // propagate the allocator as directed by 'bsl::allocator_traits'.
+{
+    typedef bsl::allocator_traits<ALLOCATOR>             Traits;
+    typedef typename Traits::propagate_on_container_copy_assignment Pocca;
+    typedef typename Traits::propagate_on_container_swap            Pocs;
+
+    const bool propagateOnCopyAssignment = Pocca::value;
+    const bool propagateOnSwap           = Pocs::value;
+
+    typedef bslstl::FlatHashTable<IntConfig,
+                                  bsl::hash<int>,
+                                  bsl::equal_to<int>,
+                                  ALLOCATOR> Table;
+
+    bslma::TestAllocator sa("source", false);
+    bslma::TestAllocator ta("target", false);
+
+    const ALLOCATOR SA(&sa);
+    const ALLOCATOR TA(&ta);
+
+    {
+        Table mX(SA);  const Table& X = mX;
+        bool  isInserted;
+        for (int i = 0; i < 100; ++i) {
+            mX.insertIfMissing(&isInserted, i);
+        }
+
+        Table mY(X, TA);  const Table& Y = mY;
+        ASSERT(X  == Y);
+        ASSERT(TA == Y.allocator());
+        ASSERT(0  <  ta.numBlocksInUse());
+
+        Table mZ(TA);  const Table& Z = mZ;
+        mZ.insertIfMissing(&isInserted, -1);
+        mZ = X;
+        ASSERT(X == Z);
+        if (propagateOnCopyAssignment) {
+            ASSERT(SA == Z.allocator());
+        }
+        else {
+            ASSERT(TA == Z.allocator());
+        }
+
+        if (propagateOnSwap) {
+            Table mW(TA);  const Table& W = mW;
+            mW.insertIfMissing(&isInserted, -1);
+            mW.swap(mX);
+            ASSERT(SA  == W.allocator());
+            ASSERT(TA  == X.allocator());
+            ASSERT(100 == W.size());
+            ASSERT(1   == X.size());
+        }
+        else {
+            Table mW(SA);  const Table& W = mW;
+            mW.insertIfMissing(&isInserted, -1);
+            mW.swap(mX);
+            ASSERT(SA  == W.allocator());
+            ASSERT(SA  == X.allocator());
+            ASSERT(100 == W.size());
+            ASSERT(1   == X.size());
+        }
+    }
+    ASSERT(0 == sa.numBlocksInUse());
+    ASSERT(0 == ta.numBlocksInUse());
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+    bool verbose = argc > 2;
+    bool veryVerbose = argc > 3;
+    bool veryVeryVerbose = argc > 4;
+
+    (void)veryVerbose;
+    (void)veryVeryVerbose;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVerbose);
+    bslma::DefaultAllocatorGuard defaultAllocatorGuard(&defaultAllocator);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 4: {
+        // --------------------------------------------------------------------
+        // COPY, ASSIGNMENT, AND SWAP
+        //
+        // Concerns:
+        //: 1 A copy has the same value as the original, and uses the supplied
+        //:   allocator.
+        //:
+        //: 2 Copy assignment propagates the allocator of the source if and
+        //:   only if the allocator has the
+        //:   'propagate_on_container_copy_assignment' trait.
+        //:
+        //: 3 Swap exchanges allocators if and only if the allocator has the
+        //:   'propagate_on_container_swap' trait.
+        //:
+        //: 4 Two tables having the same elements compare equal regardless of
+        //:   the order in which their elements were inserted.
+        //:
+        //: 5 No memory is leaked.
+        //
+        // Plan:
+        //: 1 Using 'bsl::allocator' and 'bsltf::StdStatefulAllocator'
+        //:   instantiated with each combination of the propagation traits,
+        //:   copy, assign, and swap tables, and verify the value and
+        //:   allocator of each result against the traits reported by
+        //:   'bsl::allocator_traits'.  (C-1..3, 5)
+        //:
+        //: 2 Insert the same values into two tables in opposite orders, and
+        //:   verify that they compare equal, and that they compare unequal
+        //:   after one value is removed.  (C-4)
+        //
+        // Testing:
+        //   FlatHashTable(const FlatHashTable& original, basicAllocator);
+        //   FlatHashTable& operator=(const FlatHashTable& rhs);
+        //   void swap(FlatHashTable& other);
+        //   ALLOCATOR allocator() const;
+        //   bool operator==(const FlatHashTable& lhs, const FlatHashTable&);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCOPY, ASSIGNMENT, AND SWAP"
+                            "\n==========================\n");
+
+        if (verbose) printf("\nTesting allocator propagation.\n");
+        {
+            testAllocatorPropagation<
+                      bsltf::StdStatefulAllocator<int, true, true,  true > >();
+            testAllocatorPropagation<
+                      bsltf::StdStatefulAllocator<int, true, false, true > >();
+            testAllocatorPropagation<
+                      bsltf::StdStatefulAllocator<int, true, true,  false> >();
+            testAllocatorPropagation<
+                      bsltf::StdStatefulAllocator<int, true, false, false> >();
+            testAllocatorPropagation<bsl::allocator<int> >();
+        }
+
+        if (verbose) printf("\nTesting equality.\n");
+        {
+            bslma::TestAllocator oa("object", veryVeryVerbose);
+
+            Obj mX(&oa);  const Obj& X = mX;
+            Obj mY(&oa);  const Obj& Y = mY;
+            bool isInserted;
+
+            for (int i = 0; i < 50; ++i) {
+                mX.insertIfMissing(&isInserted, i);
+                mY.insertIfMissing(&isInserted, 49 - i);
+            }
+            ASSERT(  X == Y);
+
+            mY.remove(Y.find(17));
+            ASSERT(!(X == Y));
+
+            mY.insertIfMissing(&isInserted, 117);
+            ASSERT(X.size() == Y.size());
+            ASSERT(!(X == Y));
+        }
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // INSERTION, LOOKUP, AND REMOVAL
+        //
+        // Concerns:
+        //: 1 'insertIfMissing' inserts a value if and only if no element
+        //:   having an equal key is present, and reports which occurred.
+        //:
+        //: 2 'find' locates every element, including elements whose probe
+        //:   sequence passes through slots of removed elements, and does not
+        //:   locate removed elements.
+        //:
+        //: 3 Iterating with 'firstIndex' and 'nextIndex' visits exactly
+        //:   'size()' slots.
+        //:
+        //: 4 The load factor never exceeds the maximum load factor.
+        //:
+        //: 5 'reserveForNumElements' and the creator taking
+        //:   'initialNumElements' prevent subsequent growth of the table.
+        //:
+        //: 6 'removeAll' retains capacity, and 'rehash(0)' on an empty table
+        //:   releases all memory.
+        //:
+        //: 7 All memory is supplied by the object allocator.
+        //
+        // Plan:
+        //: 1 For a well-distributed and a badly colliding hash functor, apply
+        //:   a pseudo-random sequence of insertions and removals to a table
+        //:   and to a reference array of flags, and compare the two after
+        //:   each operation.  (C-1..4)
+        //:
+        //: 2 Reserve capacity, insert up to the reserved number of elements,
+        //:   and verify that the capacity did not change.  (C-5)
+        //:
+        //: 3 Use test allocators to verify 'removeAll', 'rehash', and that the
+        //:   default allocator is unused.  (C-6..7)
+        //
+        // Testing:
+        //   FlatHashTable(hash, compare, initialNumElements, basicAllocator);
+        //   SizeType insertIfMissing(bool *isInsertedFlag, const ValueType&);
+        //   void remove(SizeType index);
+        //   void removeAll();
+        //   void rehash(SizeType numSlots);
+        //   void reserveForNumElements(SizeType numElements);
+        //   SizeType capacity() const;
+        //   SizeType find(const KeyType& key) const;
+        //   SizeType firstIndex() const;
+        //   SizeType nextIndex(SizeType index) const;
+        //   float loadFactor() const;
+        //   SizeType size() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nINSERTION, LOOKUP, AND REMOVAL"
+                            "\n==============================\n");
+
+        enum { k_RANGE = 512, k_NUM_OPS = 20000 };
+
+        if (verbose) printf("\nComparing with a reference (good hash).\n");
+        {
+            bslma::TestAllocator oa("object", veryVeryVerbose);
+
+            Obj mX(&oa);  const Obj& X = mX;
+
+            bool present[k_RANGE] = { false };
+            int  size             = 0;
+            Random random(1);
+
+            for (int op = 0; op < k_NUM_OPS; ++op) {
+                const int value = random(k_RANGE);
+                if (random(3)) {
+                    bool isInserted;
+                    Obj::SizeType index = mX.insertIfMissing(&isInserted,
+                                                             value);
+                    LOOP_ASSERT(op, isInserted == !present[value]);
+                    LOOP_ASSERT(op, value == *X.elementAddress(index));
+                    if (isInserted) {
+                        present[value] = true;
+                        ++size;
+                    }
+                }
+                else {
+                    Obj::SizeType index = X.find(value);
+                    LOOP_ASSERT(op, (index != X.capacity()) == present[value]);
+                    if (index != X.capacity()) {
+                        mX.remove(index);
+                        present[value] = false;
+                        --size;
+                    }
+                }
+                LOOP_ASSERT(op, size == static_cast<int>(X.size()));
+                LOOP_ASSERT(op, X.loadFactor() <= X.maxLoadFactor());
+            }
+
+            for (int i = 0; i < k_RANGE; ++i) {
+                LOOP_ASSERT(i, (X.find(i) != X.capacity()) == present[i]);
+            }
+            ASSERT(size == countElements(X));
+        }
+
+        if (verbose) printf("\nComparing with a reference (bad hash).\n");
+        {
+            typedef bslstl::FlatHashTable<IntConfig,
+                                          CollidingHash,
+                                          bsl::equal_to<int>,
+                                          bsl::allocator<int> > Table;
+
+            bslma::TestAllocator oa("object", veryVeryVerbose);
+
+            Table mX(&oa);  const Table& X = mX;
+
+            bool present[k_RANGE] = { false };
+            int  size             = 0;
+            Random random(7);
+
+            for (int op = 0; op < k_NUM_OPS / 4; ++op) {
+                const int value = random(k_RANGE);
+                if (random(2)) {
+                    bool isInserted;
+                    mX.insertIfMissing(&isInserted, value);
+                    LOOP_ASSERT(op, isInserted == !present[value]);
+                    if (isInserted) {
+                        present[value] = true;
+                        ++size;
+                    }
+                }
+                else {
+                    Table::SizeType index = X.find(value);
+                    LOOP_ASSERT(op, (index != X.capacity()) == present[value]);
+                    if (index != X.capacity()) {
+                        mX.remove(index);
+                        present[value] = false;
+                        --size;
+                    }
+                }
+                LOOP_ASSERT(op, size == static_cast<int>(X.size()));
+            }
+
+            for (int i = 0; i < k_RANGE; ++i) {
+                LOOP_ASSERT(i, (X.find(i) != X.capacity()) == present[i]);
+            }
+            ASSERT(size == countElements(X));
+        }
+
+        if (verbose) printf("\nTesting reservation.\n");
+        {
+            bslma::TestAllocator oa("object", veryVeryVerbose);
+
+            for (int n = 1; n < 300; n += 7) {
+                Obj mX(bsl::hash<int>(), bsl::equal_to<int>(), n, &oa);
+                const Obj& X = mX;
+
+                const Obj::SizeType CAPACITY = X.capacity();
+                LOOP_ASSERT(n, 0 == ((CAPACITY + 1) & CAPACITY));
+
+                bool isInserted;
+                for (int i = 0; i < n; ++i) {
+                    mX.insertIfMissing(&isInserted, i);
+                }
+                LOOP_ASSERT(n, CAPACITY == X.capacity());
+
+                Obj mY(&oa);  const Obj& Y = mY;
+                mY.reserveForNumElements(n);
+                const Obj::SizeType Y_CAPACITY = Y.capacity();
+                for (int i = 0; i < n; ++i) {
+                    mY.insertIfMissing(&isInserted, i);
+                }
+                LOOP_ASSERT(n, Y_CAPACITY == Y.capacity());
+                LOOP_ASSERT(n, X == Y);
+            }
+            ASSERT(0 == oa.numBlocksInUse());
+        }
+
+        if (verbose) printf("\nTesting 'removeAll' and 'rehash'.\n");
+        {
+            bslma::TestAllocator oa("object", veryVeryVerbose);
+
+            Obj mX(&oa);  const Obj& X = mX;
+            ASSERT(0 == X.capacity());
+            ASSERT(X.capacity() == X.firstIndex());
+            ASSERT(0 == oa.numBlocksTotal());
+
+            bool isInserted;
+            for (int i = 0; i < 40; ++i) {
+                mX.insertIfMissing(&isInserted, i);
+            }
+            const Obj::SizeType CAPACITY = X.capacity();
+
+            mX.removeAll();
+            ASSERT(0        == X.size());
+            ASSERT(CAPACITY == X.capacity());
+            ASSERT(X.capacity() == X.firstIndex());
+            ASSERT(1        == oa.numBlocksInUse());
+
+            mX.rehash(1000);
+            ASSERT(1000 <= X.capacity());
+
+            mX.rehash(0);
+            ASSERT(0 == X.capacity());
+            ASSERT(0 == oa.numBlocksInUse());
+
+            mX.insertIfMissing(&isInserted, 3);
+            mX.rehash(0);
+            ASSERT(1 == X.size());
+            ASSERT(0 != X.capacity());
+            ASSERT(X.find(3) != X.capacity());
+        }
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CONTROL-BYTE UTILITIES
+        //
+        // Concerns:
+        //: 1 Each 'match' function sets exactly the bits of those control
+        //:   bytes in a group that satisfy its predicate.
+        //:
+        //: 2 'countTrailingZeros' and 'countLeadingZeros' are correct for
+        //:   every 16-bit mask.
+        //:
+        //: 3 'normalizeCapacity' returns the smallest value of the form
+        //:   '2^k - 1' that is at least the supplied capacity and at least
+        //:   'k_GROUP_WIDTH - 1'.
+        //:
+        //: 4 'growthToLowerboundCapacity' returns a capacity whose growth is
+        //:   at least the supplied number of elements.
+        //
+        // Plan:
+        //: 1 For a set of groups containing each kind of control byte at
+        //:   every position, compare the result of each 'match' function
+        //:   with a brute-force computation.  (C-1)
+        //:
+        //: 2 Compare the bit-counting functions with a brute-force
+        //:   computation for every non-zero 16-bit mask.  (C-2)
+        //:
+        //: 3 Verify the capacity functions over a range of inputs.  (C-3..4)
+        //
+        // Testing:
+        //   bool isFull(signed char control);
+        //   unsigned int matchByte(const signed char *group, signed char);
+        //   unsigned int matchEmpty(const signed char *group);
+        //   unsigned int matchEmptyOrDeleted(const signed char *group);
+        //   int countTrailingZeros(unsigned int mask);
+        //   int countLeadingZeros(unsigned int mask);
+        //   size_t normalizeCapacity(size_t capacity);
+        //   size_t capacityToGrowth(size_t capacity);
+        //   size_t growthToLowerboundCapacity(size_t growth);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCONTROL-BYTE UTILITIES"
+                            "\n======================\n");
+
+        const signed char VALUES[] = {
+            ImpUtil::k_EMPTY, ImpUtil::k_DELETED, ImpUtil::k_SENTINEL,
+            0, 1, 0x35, 0x7F
+        };
+        const int NUM_VALUES = sizeof VALUES / sizeof *VALUES;
+
+        if (verbose) printf("\nTesting 'isFull'.\n");
+        {
+            for (int i = 0; i < NUM_VALUES; ++i) {
+                LOOP_ASSERT(i, ImpUtil::isFull(VALUES[i]) == (VALUES[i] >= 0));
+            }
+        }
+
+        if (verbose) printf("\nTesting 'match' functions.\n");
+        {
+            Random random(3);
+            for (int trial = 0; trial < 1000; ++trial) {
+                signed char group[ImpUtil::k_GROUP_WIDTH];
+                for (int i = 0; i < ImpUtil::k_GROUP_WIDTH; ++i) {
+                    group[i] = VALUES[random(NUM_VALUES)];
+                }
+
+                for (int v = 0; v < NUM_VALUES; ++v) {
+                    unsigned int expByte  = 0;
+                    unsigned int expEmpty = 0;
+                    unsigned int expAvail = 0;
+                    for (int i = 0; i < ImpUtil::k_GROUP_WIDTH; ++i) {
+                        if (group[i] == VALUES[v]) {
+                            expByte |= 1u << i;
+                        }
+                        if (ImpUtil::k_EMPTY == group[i]) {
+                            expEmpty |= 1u << i;
+                        }
+                        if (group[i] < ImpUtil::k_SENTINEL) {
+                            expAvail |= 1u << i;
+                        }
+                    }
+                    LOOP2_ASSERT(trial, v,
+                                 expByte ==
+                                        ImpUtil::matchByte(group, VALUES[v]));
+                    LOOP_ASSERT(trial, expEmpty == ImpUtil::matchEmpty(group));
+                    LOOP_ASSERT(trial,
+                                expAvail ==
+                                         ImpUtil::matchEmptyOrDeleted(group));
+                }
+            }
+
+            const signed char *EMPTY = ImpUtil::emptyGroup();
+            ASSERT(ImpUtil::k_SENTINEL == EMPTY[0]);
+            ASSERT(0xFFFEu == ImpUtil::matchEmpty(EMPTY));
+        }
+
+        if (verbose) printf("\nTesting bit-counting functions.\n");
+        {
+            for (unsigned int mask = 1; mask < (1u << 16); ++mask) {
+                int trailing = 0;
+                while (0 == (mask & (1u << trailing))) {
+                    ++trailing;
+                }
+                int leading = 0;
+                while (0 == (mask & (1u << (15 - leading)))) {
+                    ++leading;
+                }
+                LOOP_ASSERT(mask,
+                            trailing == ImpUtil::countTrailingZeros(mask));
+                LOOP_ASSERT(mask,
+                            leading  == ImpUtil::countLeadingZeros(mask));
+            }
+            ASSERT(16 == ImpUtil::countLeadingZeros(0));
+        }
+
+        if (verbose) printf("\nTesting capacity functions.\n");
+        {
+            for (native_std::size_t n = 0; n < 5000; ++n) {
+                const native_std::size_t CAPACITY =
+                                              ImpUtil::normalizeCapacity(n);
+                LOOP_ASSERT(n, CAPACITY >= n);
+                LOOP_ASSERT(n, CAPACITY >= 15);
+                LOOP_ASSERT(n, 0 == ((CAPACITY + 1) & CAPACITY));
+                LOOP_ASSERT(n, CAPACITY == 15 || CAPACITY / 2 < n);
+
+                const native_std::size_t LOWER =
+                                   ImpUtil::growthToLowerboundCapacity(n);
+                LOOP_ASSERT(n,
+                            ImpUtil::capacityToGrowth(
+                                    ImpUtil::normalizeCapacity(LOWER)) >= n);
+            }
+            ASSERT(13 == ImpUtil::capacityToGrowth(15));
+            ASSERT(27 == ImpUtil::capacityToGrowth(31));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create a table, insert, find, and remove a few values, and
+        //:   verify the results.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        bslma::TestAllocator oa("object", veryVeryVerbose);
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+            ASSERT(0 == X.size());
+            ASSERT(0 == X.capacity());
+            ASSERT(0 == oa.numBlocksTotal());
+            ASSERT(X.capacity() == X.find(1));
+
+            bool isInserted;
+            Obj::SizeType index = mX.insertIfMissing(&isInserted, 1);
+            ASSERT(isInserted);
+            ASSERT(1 == X.size());
+            ASSERT(1 == *X.elementAddress(index));
+            ASSERT(index == X.find(1));
+            ASSERT(index == X.firstIndex());
+            ASSERT(X.capacity() == X.nextIndex(index));
+
+            ASSERT(index == mX.insertIfMissing(&isInserted, 1));
+            ASSERT(!isInserted);
+            ASSERT(1 == X.size());
+
+            for (int i = 2; i <= 100; ++i) {
+                mX.insertIfMissing(&isInserted, i);
+                ASSERT(isInserted);
+            }
+            ASSERT(100 == X.size());
+            ASSERT(100 == countElements(X));
+
+            mX.remove(X.find(50));
+            ASSERT(99 == X.size());
+            ASSERT(X.capacity() == X.find(50));
+            ASSERT(X.capacity() != X.find(51));
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1933 @@
+// bslstl_flatmap.t.cpp                                               -*-C++-*-
+
+#include <bslstl_flatmap.h>
+
+#include <bslstl_map.h>
+#include <bslstl_string.h>
+#include <bslstl_vector.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatormonitor.h>
+#include <bsls_bsltestutil.h>
+#include <bsls_nativestd.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <bsltf_alloctesttype.h>
+
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <stdexcept>
+
+using namespace BloombergLP;
+using namespace std;
+
+//=============================================================================
+//                             TEST PLAN
+//-----------------------------------------------------------------------------
+//                             Overview
+//                             --------
+// The component under test is a value-semantic container that forwards most
+// of its work to 'bslstl::FlatTree', which is tested in its own test driver.
+// Here we test each method of the standard 'map' interface in turn, paying
+// particular attention to the positions at which elements are inserted and
+// erased (the front, the middle, and the back of the sorted vector holding
+// them), and to the insertion of ranges: a range may hold keys that are
+// already present, or that appear more than once in the range (the first
+// element having a given key is kept), and a sorted range is merged into the
+// map without being sorted.  We observe the memory used for sorting and
+// merging through the number of blocks allocated by a test allocator.  We
+// use 'bsltf::AllocTestType' as the mapped type, which is not
+// bitwise-moveable, to exercise the element-wise merge of a range, and to
+// verify the propagation of the allocator of the container to its elements.
+//-----------------------------------------------------------------------------
+// CREATORS
+// [ 1] explicit flat_map(const COMPARATOR&, const ALLOCATOR&);
+// [ 1] explicit flat_map(const ALLOCATOR& basicAllocator);
+// [ 8] flat_map(const flat_map& original);
+// [ 8] flat_map(const flat_map& original, basicAllocator);
+// [ 6] flat_map(INPUT_ITERATOR first, INPUT_ITERATOR last, ...);
+// [ 1] ~flat_map();
+//
+// MANIPULATORS
+// [ 8] flat_map& operator=(const flat_map& rhs);
+// [ 9] mapped_type& operator[](const key_type& key);
+// [ 9] mapped_type& at(const key_type& key);
+// [ 3] iterator begin();
+// [ 3] iterator end();
+// [ 3] reverse_iterator rbegin();
+// [ 3] reverse_iterator rend();
+// [ 2] pair<iterator, bool> insert(const value_type& value);
+// [ 2] iterator insert(const_iterator hint, const value_type& value);
+// [ 6] void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+// [ 5] iterator erase(const_iterator position);
+// [ 5] size_type erase(const key_type& key);
+// [ 5] iterator erase(const_iterator first, const_iterator last);
+// [ 8] void swap(flat_map& other);
+// [ 5] void clear();
+// [10] void reserve(size_type numElements);
+// [10] void shrink_to_fit();
+// [ 4] iterator find(const key_type& key);
+// [ 4] iterator lower_bound(const key_type& key);
+// [ 4] iterator upper_bound(const key_type& key);
+// [ 4] pair<iterator, iterator> equal_range(const key_type& key);
+//
+// ACCESSORS
+// [ 8] allocator_type get_allocator() const;
+// [ 9] const mapped_type& at(const key_type& key) const;
+// [ 3] const_iterator begin() const;
+// [ 3] const_iterator cbegin() const;
+// [ 3] const_iterator end() const;
+// [ 3] const_iterator cend() const;
+// [ 3] const_reverse_iterator rbegin() const;
+// [ 3] const_reverse_iterator crbegin() const;
+// [ 3] const_reverse_iterator rend() const;
+// [ 3] const_reverse_iterator crend() const;
+// [ 1] bool empty() const;
+// [ 1] size_type size() const;
+// [10] size_type capacity() const;
+// [ 1] key_compare key_comp() const;
+// [ 1] value_compare value_comp() const;
+// [ 4] const_iterator find(const key_type& key) const;
+// [ 4] size_type count(const key_type& key) const;
+// [ 4] const_iterator lower_bound(const key_type& key) const;
+// [ 4] const_iterator upper_bound(const key_type& key) const;
+// [ 4] pair<const_iterator, const_iterator> equal_range(key) const;
+//
+// FREE OPERATORS
+// [ 8] bool operator==(const flat_map& lhs, const flat_map& rhs);
+// [ 8] bool operator!=(const flat_map& lhs, const flat_map& rhs);
+// [ 8] bool operator<(const flat_map& lhs, const flat_map& rhs);
+// [ 8] bool operator>(const flat_map& lhs, const flat_map& rhs);
+// [ 8] bool operator<=(const flat_map& lhs, const flat_map& rhs);
+// [ 8] bool operator>=(const flat_map& lhs, const flat_map& rhs);
+// [ 8] void swap(flat_map& a, flat_map& b);
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 2] CONCERN: Inserting at the front, in the middle, or at the back
+// [ 3] CONCERN: Inserting or erasing does not move the preceding elements
+// [ 6] CONCERN: Range insertion keeps the first element having each key
+// [ 7] CONCERN: Merging a sorted range into the map
+// [ 7] CONCERN: A sorted range is inserted without a sort buffer
+// [ 7] CONCERN: Exception safety of range insertion
+// [11] USAGE EXAMPLE
+// [-1] PERFORMANCE TEST
+//-----------------------------------------------------------------------------
+
+//=============================================================================
+//                  STANDARD BDE ASSERT TEST MACRO
+//-----------------------------------------------------------------------------
+static int testStatus = 0;
+
+static void aSsErT(bool b, const char *s, int i) {
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+//=============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef bsl::flat_map<int, int>                       Obj;
+typedef bsl::flat_map<int, int, std::greater<int> >   GreaterObj;
+typedef bsl::flat_map<int, bsltf::AllocTestType>      AllocObj;
+typedef bsl::flat_map<bsl::string, bsl::string>       StringMap;
+typedef bsl::vector<int>                              Keys;
+
+const int RUN_LENGTH = 16;
+    // length of the runs sorted by insertion sort in 'bslstl::FlatTree',
+    // above which an unsorted range is merge sorted using a temporary buffer
+
+const int INITIAL_VALUE = 100;
+    // mapped value of the first element of the initial value of an object in
+    // a table-driven test, the mapped values of the elements of an inserted
+    // range being their positions in the range
+
+namespace {
+
+const char *const LONG_STRING = "This string is long enough to allocate.";
+
+bsl::string makeKey(int value, bslma::Allocator *basicAllocator)
+    // Return a string, longer than the short-string buffer of 'bsl::string'
+    // and using the specified 'basicAllocator' to supply memory, whose order
+    // among the strings returned by this function matches the order of the
+    // specified 'value', for non-negative 'value' less than 17576.
+{
+    bsl::string result(LONG_STRING, basicAllocator);
+    result.push_back(static_cast<char>('A' + value / 676 % 26));
+    result.push_back(static_cast<char>('A' + value / 26 % 26));
+    result.push_back(static_cast<char>('A' + value % 26));
+    return result;
+}
+
+int mappedValue(int value)
+    // Return the specified 'value'.
+{
+    return value;
+}
+
+int mappedValue(const bsltf::AllocTestType& value)
+    // Return the integer held by the specified 'value'.
+{
+    return value.data();
+}
+
+void appendValues(bsl::vector<Obj::value_type> *values,
+                  const char                   *keys,
+                  int                           firstValue)
+    // Append to the specified 'values' an element for each character of the
+    // specified 'keys', in order, having that character as its key, and
+    // having mapped values increasing by one from the specified
+    // 'firstValue'.
+{
+    for (int i = 0; keys[i]; ++i) {
+        values->push_back(Obj::value_type(keys[i], firstValue + i));
+    }
+}
+
+void loadEvenKeys(AllocObj *object, int numElements)
+    // Insert into the specified 'object', using 'operator[]', an element for
+    // each even key less than twice the specified 'numElements', having half
+    // of its key as its mapped value.
+{
+    for (int i = 0; i < numElements; ++i) {
+        (*object)[2 * i].setData(i);
+    }
+}
+
+template <class OBJ>
+bool hasKeys(const OBJ& object, const Keys& keys)
+    // Return 'true' if the keys of the elements of the specified 'object' are
+    // the specified 'keys', in order, and 'false' otherwise.
+{
+    if (object.size() != keys.size()) {
+        return false;                                                 // RETURN
+    }
+    typename OBJ::const_iterator it = object.begin();
+    for (Keys::size_type i = 0; i < keys.size(); ++i, ++it) {
+        if (keys[i] != it->first) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+template <class OBJ>
+bool isValue(const OBJ& object, const char *spec)
+    // Return 'true' if the elements of the specified 'object' are, in order,
+    // those described by the specified 'spec', and 'false' otherwise.  The
+    // 'spec' holds two characters for each element: its key, and the origin
+    // of its mapped value, which is either a digit, giving the position of
+    // the element in an inserted range, or a lowercase letter, giving the
+    // position of the element in the initial value of the object ('a' for
+    // the mapped value 'INITIAL_VALUE').
+{
+    const native_std::size_t length = native_std::strlen(spec);
+
+    if (2 * object.size() != length) {
+        return false;                                                 // RETURN
+    }
+    typename OBJ::const_iterator it = object.begin();
+    for (native_std::size_t i = 0; i < length; i += 2, ++it) {
+        const char origin = spec[i + 1];
+        const int  value  = 'a' <= origin
+                          ? INITIAL_VALUE + (origin - 'a')
+                          : origin - '0';
+        if (spec[i] != it->first || value != mappedValue(it->second)) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+template <class OBJ>
+bool hasMappedValues(const OBJ& object, const bsl::vector<int>& mapped)
+    // Return 'true' if the specified 'object' holds, in increasing key order,
+    // one element for each non-negative value in the specified 'mapped',
+    // having the index of that value as its key and that value as its mapped
+    // value, and no other elements, and 'false' otherwise.
+{
+    typename OBJ::const_iterator it = object.begin();
+    for (int key = 0; key < static_cast<int>(mapped.size()); ++key) {
+        if (0 > mapped[key]) {
+            continue;                                               // CONTINUE
+        }
+        if (object.end() == it
+         || key != it->first
+         || mapped[key] != mappedValue(it->second)) {
+            return false;                                             // RETURN
+        }
+        ++it;
+    }
+    return object.end() == it;
+}
+
+template <class OBJ>
+void testLookup(OBJ *object, int key, int numBefore, bool isPresent)
+    // Verify that the lookup methods of the specified 'object', called both
+    // as manipulators and as accessors, place the specified 'key' after the
+    // specified 'numBefore' elements ordered before 'key', and find an
+    // element having 'key' if and only if the specified 'isPresent' is
+    // 'true'.
+{
+    typedef typename OBJ::iterator       Iterator;
+    typedef typename OBJ::const_iterator ConstIterator;
+
+    OBJ& mX = *object;  const OBJ& X = mX;
+
+    const ConstIterator LOWER = X.begin() + numBefore;
+    const ConstIterator UPPER = LOWER + isPresent;
+
+    ASSERTV(X.size(), key, (isPresent ? LOWER : X.end()) == mX.find(key));
+    ASSERTV(X.size(), key, (isPresent ? LOWER : X.end()) ==  X.find(key));
+    ASSERTV(X.size(), key, static_cast<int>(isPresent) ==
+                                             static_cast<int>(X.count(key)));
+
+    ASSERTV(X.size(), key, LOWER == mX.lower_bound(key));
+    ASSERTV(X.size(), key, LOWER ==  X.lower_bound(key));
+    ASSERTV(X.size(), key, UPPER == mX.upper_bound(key));
+    ASSERTV(X.size(), key, UPPER ==  X.upper_bound(key));
+
+    const bsl::pair<Iterator, Iterator>           R = mX.equal_range(key);
+    const bsl::pair<ConstIterator, ConstIterator> S =  X.equal_range(key);
+    ASSERTV(X.size(), key, LOWER == R.first);
+    ASSERTV(X.size(), key, UPPER == R.second);
+    ASSERTV(X.size(), key, LOWER == S.first);
+    ASSERTV(X.size(), key, UPPER == S.second);
+}
+
+template <class MAP>
+void runBenchmark(const char             *name,
+                  const bsl::vector<int>&  keys,
+                  const bsl::vector<int>&  probes)
+    // Build an object of the (template parameter) type 'MAP' by inserting the
+    // specified (unsorted) 'keys' as a single range, look up each of the
+    // specified 'probes', and print the specified 'name' together with the
+    // number of allocations, the memory in use, and the time taken by each
+    // phase.
+{
+    typedef bsl::pair<int, int> Value;
+
+    bsl::vector<Value> values;
+    values.reserve(keys.size());
+    for (native_std::size_t i = 0; i < keys.size(); ++i) {
+        values.push_back(Value(keys[i], static_cast<int>(i)));
+    }
+
+    bslma::TestAllocator sa;
+    bsls::Stopwatch      timer;
+    int                  found = 0;
+    {
+        MAP mX(&sa);  const MAP& X = mX;
+
+        timer.start();
+        mX.insert(values.begin(), values.end());
+        timer.stop();
+        const double buildTime = timer.accumulatedWallTime();
+
+        timer.reset();
+        timer.start();
+        for (native_std::size_t i = 0; i < probes.size(); ++i) {
+            found += X.end() != X.find(probes[i]);
+        }
+        timer.stop();
+
+        printf("%-28s %10lld %12lld %9.4f %9.4f\n",
+               name,
+               sa.numBlocksTotal(),
+               sa.numBytesInUse(),
+               buildTime,
+               timer.accumulatedWallTime());
+    }
+    ASSERT(0 < found);
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                                USAGE EXAMPLE
+//-----------------------------------------------------------------------------
+
+namespace UsageExample {
+
+///Usage
+///-----
+// This section illustrates intended usage of this component.
+//
+///Example 1: Loading Reference Data
+///- - - - - - - - - - - - - - - - -
+// Suppose we maintain a table of instrument definitions, keyed by an
+// instrument identifier, that is reloaded once a day and then consulted for
+// every incoming order.  Since the table is built in bulk and then only
+// searched, we store it in a 'flat_map', which occupies a single block of
+// memory and is searched without chasing pointers.
+//
+// First, we define a type describing an instrument:
+//..
+struct Instrument {
+    int    d_lotSize;
+    double d_tickSize;
+};
+//..
+
+}  // close namespace UsageExample
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+    bool verbose = argc > 2;
+    bool veryVerbose = argc > 3;
+    bool veryVeryVerbose = argc > 4;
+
+    (void)veryVerbose;
+    (void)veryVeryVerbose;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVerbose);
+    bslma::DefaultAllocatorGuard defaultAllocatorGuard(&defaultAllocator);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 11: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+        using namespace UsageExample;
+
+// Then, we define the definitions delivered by the daily load, which arrive
+// in no particular order:
+//..
+    typedef bsl::pair<int, Instrument> Definition;
+
+    const Definition DEFINITIONS[] = {
+        Definition(1042, Instrument()), Definition(  17, Instrument()),
+        Definition( 511, Instrument()), Definition(  96, Instrument()),
+        Definition(2001, Instrument())
+    };
+    const int NUM_DEFINITIONS = sizeof DEFINITIONS / sizeof *DEFINITIONS;
+//..
+// Next, we build the table, which sorts the definitions once:
+//..
+    bsl::flat_map<int, Instrument> table(DEFINITIONS,
+                                         DEFINITIONS + NUM_DEFINITIONS);
+    ASSERT(5    == table.size());
+    ASSERT(17   == table.begin()->first);
+    ASSERT(2001 == table.rbegin()->first);
+//..
+// Then, we look up the instruments referred to by incoming orders:
+//..
+    ASSERT(table.end() != table.find(511));
+    ASSERT(table.end() == table.find(512));
+//..
+// Now, suppose an intraday update delivers a (sorted) batch of new
+// instruments.  We merge the batch into the table in a single pass over the
+// existing definitions:
+//..
+    const Definition UPDATES[] = {
+        Definition(  20, Instrument()), Definition( 600, Instrument()),
+        Definition(1042, Instrument()), Definition(3000, Instrument())
+    };
+    const int NUM_UPDATES = sizeof UPDATES / sizeof *UPDATES;
+
+    table.insert(UPDATES, UPDATES + NUM_UPDATES);
+//..
+// Finally, we observe that the new instruments were added, and that the
+// definition of instrument 1042, which was already present, was not
+// duplicated:
+//..
+    ASSERT(8 == table.size());
+    ASSERT(1 == table.count(20));
+    ASSERT(1 == table.count(1042));
+    ASSERT(3000 == table.rbegin()->first);
+//..
+      } break;
+      case 10: {
+        // --------------------------------------------------------------------
+        // CAPACITY
+        //
+        // Concerns:
+        //: 1 'reserve' provides capacity for at least the requested number of
+        //:   elements, so that inserting that many elements does not
+        //:   allocate memory.
+        //:
+        //: 2 'shrink_to_fit' reduces the capacity to the size.
+        //:
+        //: 3 Erasing elements, and 'clear', do not change the capacity.
+        //
+        // Plan:
+        //: 1 Reserve capacity in a map, insert that many elements one at a
+        //:   time and verify, using a test allocator monitor, that no memory
+        //:   is allocated; then call 'erase', 'shrink_to_fit', and 'clear' and
+        //:   verify 'capacity'.  (C-1..3)
+        //
+        // Testing:
+        //   void reserve(size_type numElements);
+        //   void shrink_to_fit();
+        //   size_type capacity() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCAPACITY"
+                            "\n========\n");
+
+        bslma::TestAllocator oa("object", veryVeryVerbose);
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+            ASSERT(0 == X.capacity());
+
+            mX.reserve(100);
+            ASSERT(100 <= X.capacity());
+
+            bslma::TestAllocatorMonitor oam(&oa);
+            for (int i = 0; i < 100; ++i) {
+                mX[(i * 37) % 100] = i;
+            }
+            ASSERT(100 == X.size());
+            ASSERT(oam.isTotalSame());
+
+            mX.erase(X.begin(), X.find(60));
+            ASSERT(40  == X.size());
+            ASSERT(100 <= X.capacity());
+
+            mX.shrink_to_fit();
+            ASSERT(40 == X.capacity());
+            ASSERT(60 == X.begin()->first);
+
+            mX.clear();
+            ASSERT(X.empty());
+            ASSERT(40 == X.capacity());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 9: {
+        // --------------------------------------------------------------------
+        // MAPPED-VALUE ACCESS
+        //
+        // Concerns:
+        //: 1 'operator[]' returns a reference to the mapped value of an
+        //:   existing element, and otherwise inserts an element having a
+        //:   value-initialized mapped value.
+        //:
+        //: 2 'at' returns a reference to the mapped value of an existing
+        //:   element, and otherwise throws 'std::out_of_range' without
+        //:   modifying the map.
+        //:
+        //: 3 A mapped value may be modified through an 'iterator'.
+        //:
+        //: 4 A mapped value inserted by 'operator[]' uses the allocator of the
+        //:   map, including after the element is shifted, or the vector
+        //:   holding it is reallocated, by later insertions.
+        //
+        // Plan:
+        //: 1 Use 'operator[]' and 'at' to create and modify mapped values, and
+        //:   verify the results using 'find'.  (C-1..3)
+        //:
+        //: 2 When exceptions are enabled, call 'at' with a missing key and
+        //:   verify that 'std::out_of_range' is thrown.  (C-2)
+        //:
+        //: 3 Use 'operator[]' on a map of strings using a test allocator,
+        //:   inserting keys in an order that shifts existing elements and
+        //:   grows the vector several times, and verify that the default
+        //:   allocator is not used.  (C-4)
+        //
+        // Testing:
+        //   mapped_type& operator[](const key_type& key);
+        //   mapped_type& at(const key_type& key);
+        //   const mapped_type& at(const key_type& key) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nMAPPED-VALUE ACCESS"
+                            "\n===================\n");
+
+        bslma::TestAllocator oa("object", veryVeryVerbose);
+
+        if (verbose) printf("\nTesting 'operator[]' and 'at'.\n");
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+
+            ASSERT(0 == mX[1]);
+            ASSERT(1 == X.size());
+
+            mX[1] = 10;
+            mX[2] = 20;
+            ASSERT(10 == X.at(1));
+            ASSERT(20 == mX.at(2));
+            ASSERT(2  == X.size());
+
+            mX.at(2) = 21;
+            ASSERT(21 == X.find(2)->second);
+
+            for (Obj::iterator it = mX.begin(); it != mX.end(); ++it) {
+                it->second *= 2;
+            }
+            ASSERT(20 == X.at(1));
+            ASSERT(42 == X.at(2));
+
+#ifdef BDE_BUILD_TARGET_EXC
+            bool threw = false;
+            try {
+                mX.at(3);
+            }
+            catch (const native_std::out_of_range&) {
+                threw = true;
+            }
+            ASSERT(threw);
+
+            threw = false;
+            try {
+                X.at(3);
+            }
+            catch (const native_std::out_of_range&) {
+                threw = true;
+            }
+            ASSERT(threw);
+            ASSERT(2 == X.size());
+#endif
+        }
+
+        if (verbose) printf("\nTesting allocator-aware mapped values.\n");
+        {
+            StringMap mX(&oa);  const StringMap& X = mX;
+
+            for (int i = 0; i < 500; ++i) {
+                const bsl::string KEY = makeKey((i * 7919) % 500, &oa);
+                mX[KEY] = LONG_STRING;
+                LOOP_ASSERT(i, &oa == X.at(KEY).get_allocator().mechanism());
+            }
+            ASSERT(500 == X.size());
+
+            for (StringMap::const_iterator it = X.begin();
+                 it != X.end();
+                 ++it) {
+                ASSERT(&oa == it->first.get_allocator().mechanism());
+                ASSERT(&oa == it->second.get_allocator().mechanism());
+            }
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 8: {
+        // --------------------------------------------------------------------
+        // COPY, ASSIGNMENT, SWAP, AND COMPARISON
+        //
+        // Concerns:
+        //: 1 A copy compares equal to the original, and it and its elements
+        //:   use the supplied allocator, or the default allocator if none is
+        //:   supplied.
+        //:
+        //: 2 Assignment gives the target the value of the source, and retains
+        //:   the allocator of the target.
+        //:
+        //: 3 Member and free 'swap' exchange the values of two maps having
+        //:   the same allocator without allocating memory.
+        //:
+        //: 4 Maps compare unequal if an element has a different mapped value.
+        //:
+        //: 5 The relational operators order maps lexicographically.
+        //
+        // Plan:
+        //: 1 Using test allocators, create maps of strings of various sizes,
+        //:   copy, assign, and swap them, and verify the values, allocators,
+        //:   and allocations of the results.  (C-1..4)
+        //:
+        //: 2 Compare maps of integers that differ in their last element, or
+        //:   in their length, using each relational operator.  (C-5)
+        //
+        // Testing:
+        //   flat_map(const flat_map& original);
+        //   flat_map(const flat_map& original, basicAllocator);
+        //   flat_map& operator=(const flat_map& rhs);
+        //   void swap(flat_map& other);
+        //   allocator_type get_allocator() const;
+        //   bool operator==(const flat_map& lhs, const flat_map& rhs);
+        //   bool operator!=(const flat_map& lhs, const flat_map& rhs);
+        //   bool operator<(const flat_map& lhs, const flat_map& rhs);
+        //   bool operator>(const flat_map& lhs, const flat_map& rhs);
+        //   bool operator<=(const flat_map& lhs, const flat_map& rhs);
+        //   bool operator>=(const flat_map& lhs, const flat_map& rhs);
+        //   void swap(flat_map& a, flat_map& b);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCOPY, ASSIGNMENT, SWAP, AND COMPARISON"
+                            "\n======================================\n");
+
+        bslma::TestAllocator oa("object",  veryVeryVerbose);
+        bslma::TestAllocator za("other",   veryVeryVerbose);
+        bslma::TestAllocator sa("scratch", veryVeryVerbose);
+
+        static const int SIZES[] = { 0, 1, 2, 13, 60, 61, 250, 1000 };
+        const int NUM_SIZES = sizeof SIZES / sizeof *SIZES;
+
+        for (int ti = 0; ti < NUM_SIZES; ++ti) {
+            const int n = SIZES[ti];
+
+            StringMap mX(&oa);  const StringMap& X = mX;
+            for (int i = 0; i < n; ++i) {
+                mX[makeKey(i, &sa)] = makeKey(i + 1, &sa);
+            }
+
+            {
+                StringMap mY(X);  const StringMap& Y = mY;
+                LOOP_ASSERT(n, X == Y);
+                LOOP_ASSERT(n, &defaultAllocator ==
+                                        Y.get_allocator().mechanism());
+            }
+            ASSERT(0 == defaultAllocator.numBlocksInUse());
+            {
+                StringMap mY(X, &za);  const StringMap& Y = mY;
+                LOOP_ASSERT(n, X == Y);
+                LOOP_ASSERT(n, &za == Y.get_allocator().mechanism());
+                for (StringMap::const_iterator it = Y.begin();
+                     it != Y.end();
+                     ++it) {
+                    LOOP_ASSERT(n, &za ==
+                                       it->first.get_allocator().mechanism());
+                    LOOP_ASSERT(n, &za ==
+                                      it->second.get_allocator().mechanism());
+                }
+
+                if (n) {
+                    mY.rbegin()->second = "different";
+                    LOOP_ASSERT(n, X != Y);
+                }
+            }
+            {
+                StringMap mY(&za);  const StringMap& Y = mY;
+                mY[makeKey(1000, &sa)] = LONG_STRING;
+                mY = X;
+                LOOP_ASSERT(n, X == Y);
+                LOOP_ASSERT(n, &za == Y.get_allocator().mechanism());
+            }
+            {
+                StringMap mY(&oa);  const StringMap& Y = mY;
+                mY[makeKey(1000, &sa)] = LONG_STRING;
+                const StringMap XX(X, &za);
+                const StringMap YY(Y, &za);
+
+                bslma::TestAllocatorMonitor oam(&oa);
+                mY.swap(mX);
+                LOOP_ASSERT(n, XX == Y);
+                LOOP_ASSERT(n, YY == X);
+
+                swap(mX, mY);
+                LOOP_ASSERT(n, XX == X);
+                LOOP_ASSERT(n, YY == Y);
+                LOOP_ASSERT(n, oam.isTotalSame());
+            }
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+        ASSERT(0 == za.numBlocksInUse());
+        ASSERT(0 == defaultAllocator.numBlocksInUse());
+
+        if (verbose) printf("\nTesting relational operators.\n");
+        {
+            Obj mA(&oa);  const Obj& A = mA;
+            Obj mB(&oa);  const Obj& B = mB;
+            for (int i = 0; i < 200; ++i) {
+                mA[i] = i;
+                mB[i] = i;
+            }
+            ASSERT(  A == B);
+            ASSERT(!(A <  B));
+            ASSERT(  A <= B);
+            ASSERT(!(A >  B));
+            ASSERT(  A >= B);
+
+            mB[199] = 200;
+            ASSERT(  A != B);
+            ASSERT(  A <  B);
+            ASSERT(  A <= B);
+            ASSERT(!(A >  B));
+            ASSERT(!(A >= B));
+            ASSERT(  B >  A);
+
+            mB[199] = 199;
+            mB[200] = 0;
+            ASSERT(  A <  B);
+            ASSERT(  B >= A);
+        }
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // BULK MERGE-INSERTION
+        //
+        // Concerns:
+        //: 1 Inserting a range whose keys precede, follow, interleave with,
+        //:   or overlap the keys of the map inserts each element of the range
+        //:   whose key is not already present, and leaves the existing
+        //:   elements unchanged, whether the range is sorted or reverse
+        //:   sorted.
+        //:
+        //: 2 A sorted range is not sorted again: inserting a sorted range
+        //:   into a map having sufficient capacity allocates no memory if its
+        //:   keys follow those of the map, and otherwise allocates exactly one
+        //:   block (the sort buffer) fewer than inserting the reversed range,
+        //:   if the range is longer than 'RUN_LENGTH', and as many blocks
+        //:   otherwise.
+        //:
+        //: 3 Building a map from a sorted range, even one having duplicate
+        //:   keys, allocates only the vector holding the elements.
+        //:
+        //: 4 The concerns hold for elements that are not bitwise-moveable,
+        //:   which are merged by assignment, and the inserted mapped values
+        //:   use the allocator of the map.
+        //:
+        //: 5 If an exception is thrown while inserting a range, a map of
+        //:   bitwise-moveable elements retains its original value, a map of
+        //:   other elements either retains its original value or is left
+        //:   empty, and no memory is leaked.
+        //:
+        //: 6 The default allocator is not used.
+        //
+        // Plan:
+        //: 1 For each of a table of initial maps, whose keys are the even
+        //:   numbers from 100, and inserted ranges, whose keys are in
+        //:   arithmetic progression, reserve capacity for the range in a copy
+        //:   of the initial map, insert the range, and verify the elements of
+        //:   the map, which are computed by marking the keys of the initial
+        //:   map and then the unmarked keys of the range.  Repeat for the
+        //:   reversed range, and compare the number of blocks allocated by
+        //:   the two insertions.  (C-1..2)
+        //:
+        //: 2 Repeat P-1 for an 'AllocObj', and verify the allocator of each
+        //:   mapped value.  (C-4)
+        //:
+        //: 3 Repeat P-1 and P-2, without reserving capacity, having the object
+        //:   allocator throw on each successive allocation, and verify the
+        //:   value of the map after each exception.  (C-5)
+        //:
+        //: 4 Build maps from sorted ranges of several lengths, having unique
+        //:   or duplicate keys, and from the reversed ranges, and verify the
+        //:   number of blocks allocated.  (C-3)
+        //:
+        //: 5 Verify that no memory is in use by the object allocator after
+        //:   each test, and that the default allocator is not used.  (C-6)
+        //
+        // Testing:
+        //   CONCERN: Merging a sorted range into the map
+        //   CONCERN: A sorted range is inserted without a sort buffer
+        //   CONCERN: Exception safety of range insertion
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBULK MERGE-INSERTION"
+                            "\n====================\n");
+
+        typedef Obj::value_type      Value;
+        typedef AllocObj::value_type AllocValue;
+
+        bslma::TestAllocator oa("object",  veryVeryVerbose);
+        bslma::TestAllocator sa("scratch", veryVeryVerbose);
+
+        if (verbose) printf("\nMerging ranges into a map.\n");
+
+        static const struct {
+            int d_line;        // source line number
+            int d_numInitial;  // number of keys initially in the map
+            int d_numRange;    // number of elements in the inserted range
+            int d_first;       // key of the first element of the range
+            int d_step;        // difference between successive keys of the
+                               // range
+        } DATA[] = {
+            //LINE  INITIAL  RANGE  FIRST  STEP
+            //----  -------  -----  -----  ----
+            { L_,         0,     1,     5,    1 },
+            { L_,         0,    40,     0,    1 },
+            { L_,         0,    40,     7,    0 },
+            { L_,        30,    16,    80,    1 },
+            { L_,        30,    17,    80,    1 },
+            { L_,        30,    20,   200,    1 },
+            { L_,        30,    20,   158,    1 },
+            { L_,        30,    30,   101,    2 },
+            { L_,        30,    30,   100,    2 },
+            { L_,        30,    60,    90,    1 },
+            { L_,        30,     5,   131,    1 },
+            { L_,        30,    40,   131,    0 },
+            { L_,       100,   100,    50,    3 },
+            { L_,         5,   300,     0,    1 },
+            { L_,       300,     5,   299,   50 },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        const int MAX_KEY = 1000;  // keys in 'DATA' are less than 'MAX_KEY'
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int LINE    = DATA[ti].d_line;
+            const int INITIAL = DATA[ti].d_numInitial;
+            const int RANGE   = DATA[ti].d_numRange;
+            const int FIRST   = DATA[ti].d_first;
+            const int STEP    = DATA[ti].d_step;
+
+            if (veryVerbose) { T_ P_(LINE) P_(INITIAL) P_(RANGE) P(STEP) }
+
+            const bool IS_APPEND = 0 == INITIAL
+                                || 100 + 2 * (INITIAL - 1) <= FIRST;
+                // whether the keys of the range follow those of the map
+
+            const int NUM_SORT_BLOCKS = RUN_LENGTH < RANGE && 0 != STEP;
+                // number of blocks allocated to sort the reversed range
+
+            bsl::vector<int> expected(MAX_KEY, -1, &sa);
+            Obj              mW(&sa);  const Obj&      W = mW;
+            AllocObj         mZ(&sa);  const AllocObj& Z = mZ;
+            for (int i = 0; i < INITIAL; ++i) {
+                const int                  KEY = 100 + 2 * i;
+                const bsltf::AllocTestType VALUE(INITIAL_VALUE + i, &sa);
+
+                expected[KEY] = INITIAL_VALUE + i;
+                mW.insert(Value(KEY, INITIAL_VALUE + i));
+                mZ.insert(AllocValue(KEY, VALUE, &sa));
+            }
+
+            bsl::vector<int>        reverseExpected(expected, &sa);
+            bsl::vector<Value>      range(&sa);
+            bsl::vector<AllocValue> allocRange(&sa);
+            for (int i = 0; i < RANGE; ++i) {
+                const int                  KEY = FIRST + i * STEP;
+                const bsltf::AllocTestType VALUE(i, &sa);
+
+                if (0 > expected[KEY]) {
+                    expected[KEY] = i;
+                }
+                range.push_back(Value(KEY, i));
+                allocRange.push_back(AllocValue(KEY, VALUE, &sa));
+            }
+            for (int i = RANGE; 0 < i--; ) {
+                if (0 > reverseExpected[range[i].first]) {
+                    reverseExpected[range[i].first] = i;
+                }
+            }
+
+            bsls::Types::Int64 numBlocks[2];  // allocated by each insertion
+
+            for (int reverse = 0; reverse < 2; ++reverse) {
+                Obj mX(W, &oa);  const Obj& X = mX;
+                mX.reserve(INITIAL + RANGE);
+
+                const bsls::Types::Int64 BLOCKS = oa.numBlocksTotal();
+                if (reverse) {
+                    mX.insert(range.rbegin(), range.rend());
+                }
+                else {
+                    mX.insert(range.begin(), range.end());
+                }
+                numBlocks[reverse] = oa.numBlocksTotal() - BLOCKS;
+
+                ASSERTV(LINE, reverse, hasMappedValues(X, reverse
+                                                          ? reverseExpected
+                                                          : expected));
+                ASSERTV(LINE, reverse, 1 == oa.numBlocksInUse());
+            }
+            ASSERTV(LINE, numBlocks[0], !IS_APPEND || 0 == numBlocks[0]);
+            ASSERTV(LINE, numBlocks[0], numBlocks[1],
+                    numBlocks[0] + NUM_SORT_BLOCKS == numBlocks[1]);
+
+            for (int reverse = 0; reverse < 2; ++reverse) {
+                AllocObj mX(Z, &oa);  const AllocObj& X = mX;
+                mX.reserve(INITIAL + RANGE);
+
+                if (reverse) {
+                    mX.insert(allocRange.rbegin(), allocRange.rend());
+                }
+                else {
+                    mX.insert(allocRange.begin(), allocRange.end());
+                }
+                ASSERTV(LINE, reverse, hasMappedValues(X, reverse
+                                                          ? reverseExpected
+                                                          : expected));
+
+                for (AllocObj::const_iterator it = X.begin();
+                     it != X.end();
+                     ++it) {
+                    ASSERTV(LINE, reverse, &oa == it->second.allocator());
+                }
+                ASSERTV(LINE, reverse, 1 + X.size() == oa.numBlocksInUse());
+            }
+            ASSERTV(LINE, 0 == oa.numBlocksInUse());
+
+#ifdef BDE_BUILD_TARGET_EXC
+            for (int limit = 0; ; ++limit) {
+                Obj mX(W, &oa);  const Obj& X = mX;
+
+                oa.setAllocationLimit(limit);
+                try {
+                    mX.insert(range.rbegin(), range.rend());
+                }
+                catch (const bslma::TestAllocatorException&) {
+                    oa.setAllocationLimit(-1);
+                    ASSERTV(LINE, limit, W == X);
+                    continue;
+                }
+                oa.setAllocationLimit(-1);
+                ASSERTV(LINE, limit, hasMappedValues(X, reverseExpected));
+                break;
+            }
+            ASSERTV(LINE, 0 == oa.numBlocksInUse());
+
+            for (int limit = 0; ; ++limit) {
+                AllocObj mX(Z, &oa);  const AllocObj& X = mX;
+
+                oa.setAllocationLimit(limit);
+                try {
+                    mX.insert(allocRange.rbegin(), allocRange.rend());
+                }
+                catch (const bslma::TestAllocatorException&) {
+                    oa.setAllocationLimit(-1);
+                    ASSERTV(LINE, limit, Z == X || X.empty());
+                    continue;
+                }
+                oa.setAllocationLimit(-1);
+                ASSERTV(LINE, limit, hasMappedValues(X, reverseExpected));
+                break;
+            }
+            ASSERTV(LINE, 0 == oa.numBlocksInUse());
+#endif
+        }
+
+        if (verbose) printf("\nBuilding a map from a sorted range.\n");
+        {
+            static const int LENGTHS[] = { 1, 2, RUN_LENGTH, RUN_LENGTH + 1,
+                                           100 };
+            const int NUM_LENGTHS = sizeof LENGTHS / sizeof *LENGTHS;
+
+            for (int ti = 0; ti < NUM_LENGTHS; ++ti) {
+                const int LENGTH = LENGTHS[ti];
+
+                for (int numCopies = 1; numCopies <= 2; ++numCopies) {
+                    bsl::vector<Value> range(&sa);
+                    for (int i = 0; i < LENGTH; ++i) {
+                        range.push_back(Value(i / numCopies, i));
+                    }
+                    const int NUM_KEYS = (LENGTH + numCopies - 1) / numCopies;
+
+                    bsls::Types::Int64 BLOCKS = oa.numBlocksTotal();
+                    {
+                        const Obj X(range.begin(),
+                                    range.end(),
+                                    std::less<int>(),
+                                    &oa);
+                        ASSERTV(LENGTH, numCopies,
+                                NUM_KEYS == static_cast<int>(X.size()));
+                        ASSERTV(LENGTH, numCopies,
+                                1 == oa.numBlocksTotal() - BLOCKS);
+                    }
+
+                    BLOCKS = oa.numBlocksTotal();
+                    {
+                        const Obj X(range.rbegin(),
+                                    range.rend(),
+                                    std::less<int>(),
+                                    &oa);
+                        ASSERTV(LENGTH, numCopies,
+                                NUM_KEYS == static_cast<int>(X.size()));
+                        ASSERTV(LENGTH, numCopies,
+                                1 + (RUN_LENGTH < LENGTH) ==
+                                              oa.numBlocksTotal() - BLOCKS);
+                    }
+                }
+            }
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // RANGE INSERTION AND RANGE CONSTRUCTOR
+        //
+        // Concerns:
+        //: 1 Inserting a range inserts each element of the range whose key is
+        //:   neither present in the map nor that of an earlier element of the
+        //:   range, and does not modify the existing elements.
+        //:
+        //: 2 Of several elements of the range having the same key, whether
+        //:   adjacent or not, the first is inserted, whatever the order of
+        //:   the range.
+        //:
+        //: 3 Inserting an empty range has no effect.
+        //:
+        //: 4 The range constructor inserts the elements of the range into an
+        //:   empty map ordered by the supplied comparator, and uses the
+        //:   supplied allocator.
+        //
+        // Plan:
+        //: 1 Using a table of initial values, inserted ranges, and expected
+        //:   values, each described by a string (see 'isValue'), create a map
+        //:   having the initial value, insert the range, and verify the value
+        //:   of the map.  (C-1..3)
+        //:
+        //: 2 For each entry in the table having an empty initial value, build
+        //:   a map from the range using the range constructor, and verify its
+        //:   value and allocator.  Then build a 'GreaterObj' from the range,
+        //:   and verify that its elements are those of the map, in reverse
+        //:   order.  (C-4)
+        //
+        // Testing:
+        //   flat_map(INPUT_ITERATOR first, INPUT_ITERATOR last, ...);
+        //   void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        //   CONCERN: Range insertion keeps the first element having each key
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nRANGE INSERTION AND RANGE CONSTRUCTOR"
+                            "\n=====================================\n");
+
+        typedef Obj::value_type Value;
+
+        bslma::TestAllocator oa("object",  veryVeryVerbose);
+        bslma::TestAllocator sa("scratch", veryVeryVerbose);
+
+        static const struct {
+            int         d_line;      // source line number
+            const char *d_initial;   // keys initially in the map
+            const char *d_range;     // keys of the inserted range
+            const char *d_expected;  // expected value (see 'isValue')
+        } DATA[] = {
+            //LINE  INITIAL  RANGE     EXPECTED
+            //----  -------  --------  --------------
+            { L_,   "",      "",       ""             },
+            { L_,   "",      "A",      "A0"           },
+            { L_,   "",      "ABC",    "A0B1C2"       },
+            { L_,   "",      "CBA",    "A2B1C0"       },
+            { L_,   "",      "BCA",    "A2B0C1"       },
+            { L_,   "",      "AA",     "A0"           },
+            { L_,   "",      "AAB",    "A0B2"         },
+            { L_,   "",      "ABA",    "A0B1"         },
+            { L_,   "",      "BAAB",   "A1B0"         },
+            { L_,   "",      "CBABC",  "A2B1C0"       },
+            { L_,   "B",     "",       "Ba"           },
+            { L_,   "B",     "A",      "A0Ba"         },
+            { L_,   "B",     "C",      "BaC0"         },
+            { L_,   "B",     "B",      "Ba"           },
+            { L_,   "B",     "BAB",    "A1Ba"         },
+            { L_,   "BD",    "ABCDE",  "A0BaC2DbE4"   },
+            { L_,   "BD",    "EDCBA",  "A4BaC2DbE0"   },
+            { L_,   "BD",    "CDC",    "BaC0Db"       },
+            { L_,   "ACE",   "BDF",    "AaB0CbD1EcF2" },
+            { L_,   "ACE",   "FDBB",   "AaB2CbD1EcF0" },
+            { L_,   "ACE",   "ECA",    "AaCbEc"       },
+            { L_,   "ACE",   "GECA",   "AaCbEcG0"     },
+            { L_,   "ACE",   "ABCDEF", "AaB1CbD3EcF5" },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE     = DATA[ti].d_line;
+            const char *const INITIAL  = DATA[ti].d_initial;
+            const char *const RANGE    = DATA[ti].d_range;
+            const char *const EXPECTED = DATA[ti].d_expected;
+
+            if (veryVerbose) { T_ P_(LINE) P_(INITIAL) P_(RANGE) P(EXPECTED) }
+
+            bsl::vector<Value> initial(&sa);
+            bsl::vector<Value> range(&sa);
+            appendValues(&initial, INITIAL, INITIAL_VALUE);
+            appendValues(&range,   RANGE,   0);
+
+            {
+                Obj mX(&oa);  const Obj& X = mX;
+                for (native_std::size_t i = 0; i < initial.size(); ++i) {
+                    mX.insert(initial[i]);
+                }
+
+                mX.insert(range.begin(), range.end());
+                ASSERTV(LINE, isValue(X, EXPECTED));
+            }
+
+            if ('\0' == *INITIAL) {
+                const Obj X(range.begin(), range.end(), std::less<int>(), &oa);
+                ASSERTV(LINE, isValue(X, EXPECTED));
+                ASSERTV(LINE, &oa == X.get_allocator().mechanism());
+
+                const GreaterObj Y(range.begin(),
+                                   range.end(),
+                                   std::greater<int>(),
+                                   &oa);
+                ASSERTV(LINE, X.size() == Y.size());
+
+                GreaterObj::const_reverse_iterator it = Y.rbegin();
+                for (Obj::const_iterator jt = X.begin();
+                     jt != X.end();
+                     ++jt, ++it) {
+                    ASSERTV(LINE, jt->first  == it->first);
+                    ASSERTV(LINE, jt->second == it->second);
+                }
+            }
+            ASSERTV(LINE, 0 == oa.numBlocksInUse());
+        }
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // 'erase' AND 'clear'
+        //
+        // Concerns:
+        //: 1 Erasing at a position removes the element at the position, and
+        //:   returns an iterator referring to the element that followed it,
+        //:   whether the position is at the front, in the middle, or at the
+        //:   back of the map.
+        //:
+        //: 2 Erasing a key removes the element having the key and returns 1,
+        //:   or, if no element has the key, returns 0 and has no effect.
+        //:
+        //: 3 Erasing a range removes the elements in the range, and returns
+        //:   an iterator referring to the element that followed the range;
+        //:   erasing an empty range has no effect.
+        //:
+        //: 4 'clear' removes every element.
+        //:
+        //: 5 Erasing destroys the removed elements, does not change the
+        //:   capacity of the map, and leaves the remaining elements having
+        //:   their mapped values.
+        //
+        // Plan:
+        //: 1 Using a table of positions, erase the element at each position
+        //:   of an 'AllocObj' holding 'N' elements, and verify the returned
+        //:   iterator, the keys and mapped values of the object, and that
+        //:   exactly the block held by the erased mapped value is released.
+        //:   (C-1, 5)
+        //:
+        //: 2 Erase each key from one less than the first key to one more than
+        //:   the last key, and verify the returned value, the value of the
+        //:   object, and the blocks released.  (C-2, 5)
+        //:
+        //: 3 Using a table of ranges, erase each range, and verify the
+        //:   returned iterator, the value of the object, and the blocks
+        //:   released.  (C-3, 5)
+        //:
+        //: 4 Call 'clear', and verify the value of the object, the blocks
+        //:   released, and the capacity.  (C-4..5)
+        //
+        // Testing:
+        //   iterator erase(const_iterator position);
+        //   size_type erase(const key_type& key);
+        //   iterator erase(const_iterator first, const_iterator last);
+        //   void clear();
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\n'erase' AND 'clear'"
+                            "\n===================\n");
+
+        bslma::TestAllocator oa("object",  veryVeryVerbose);
+        bslma::TestAllocator sa("scratch", veryVeryVerbose);
+
+        const int N = 8;  // number of elements initially in the object
+
+        if (verbose) printf("\nErasing at a position.\n");
+        {
+            static const int POSITIONS[] = { 0, 1, N / 2, N - 1 };
+            const int NUM_POSITIONS = sizeof POSITIONS / sizeof *POSITIONS;
+
+            for (int ti = 0; ti < NUM_POSITIONS; ++ti) {
+                const int POSITION = POSITIONS[ti];
+
+                AllocObj mX(&oa);  const AllocObj& X = mX;
+                loadEvenKeys(&mX, N);
+
+                const AllocObj::size_type CAPACITY = X.capacity();
+                const bsls::Types::Int64  BLOCKS   = oa.numBlocksInUse();
+
+                const AllocObj::iterator it = mX.erase(X.begin() + POSITION);
+                ASSERTV(POSITION, X.begin() + POSITION == it);
+                ASSERTV(POSITION, BLOCKS - 1 == oa.numBlocksInUse());
+                ASSERTV(POSITION, CAPACITY == X.capacity());
+
+                Keys keys(&sa);
+                for (int i = 0; i < N; ++i) {
+                    if (POSITION != i) {
+                        keys.push_back(2 * i);
+                    }
+                }
+                ASSERTV(POSITION, hasKeys(X, keys));
+
+                for (AllocObj::const_iterator jt = X.begin();
+                     jt != X.end();
+                     ++jt) {
+                    ASSERTV(POSITION, jt->first == 2 * jt->second.data());
+                }
+            }
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+
+        if (verbose) printf("\nErasing a key.\n");
+        {
+            AllocObj mX(&oa);  const AllocObj& X = mX;
+            loadEvenKeys(&mX, N);
+
+            const AllocObj::size_type CAPACITY = X.capacity();
+
+            for (int key = -1; key <= 2 * N; ++key) {
+                const bool IS_PRESENT = 0 <= key
+                                     && key < 2 * N
+                                     && 0 == key % 2;
+                const AllocObj::size_type SIZE   = X.size();
+                const bsls::Types::Int64  BLOCKS = oa.numBlocksInUse();
+
+                ASSERTV(key, IS_PRESENT == mX.erase(key));
+                ASSERTV(key, SIZE - IS_PRESENT == X.size());
+                ASSERTV(key, BLOCKS - IS_PRESENT == oa.numBlocksInUse());
+                ASSERTV(key, X.end() == X.find(key));
+                ASSERTV(key, X.empty() || key < X.begin()->first);
+            }
+            ASSERT(X.empty());
+            ASSERT(CAPACITY == X.capacity());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+
+        if (verbose) printf("\nErasing a range.\n");
+        {
+            static const struct {
+                int d_line;   // source line number
+                int d_first;  // position of the first erased element
+                int d_last;   // position following the last erased element
+            } DATA[] = {
+                //LINE  FIRST  LAST
+                //----  -----  -----
+                { L_,       0,     0 },
+                { L_,   N / 2, N / 2 },
+                { L_,       N,     N },
+                { L_,       0,     1 },
+                { L_,       0, N / 2 },
+                { L_,       1, N - 1 },
+                { L_,   N / 2,     N },
+                { L_,   N - 1,     N },
+                { L_,       0,     N },
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int LINE  = DATA[ti].d_line;
+                const int FIRST = DATA[ti].d_first;
+                const int LAST  = DATA[ti].d_last;
+
+                if (veryVerbose) { T_ P_(LINE) P_(FIRST) P(LAST) }
+
+                AllocObj mX(&oa);  const AllocObj& X = mX;
+                loadEvenKeys(&mX, N);
+
+                const AllocObj::size_type CAPACITY = X.capacity();
+                const bsls::Types::Int64  BLOCKS   = oa.numBlocksInUse();
+
+                const AllocObj::iterator it = mX.erase(X.begin() + FIRST,
+                                                       X.begin() + LAST);
+                ASSERTV(LINE, X.begin() + FIRST == it);
+                ASSERTV(LINE, it == X.end() || LAST == it->second.data());
+                ASSERTV(LINE, BLOCKS - (LAST - FIRST) == oa.numBlocksInUse());
+                ASSERTV(LINE, CAPACITY == X.capacity());
+
+                Keys keys(&sa);
+                for (int i = 0; i < N; ++i) {
+                    if (i < FIRST || LAST <= i) {
+                        keys.push_back(2 * i);
+                    }
+                }
+                ASSERTV(LINE, hasKeys(X, keys));
+            }
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+
+        if (verbose) printf("\nTesting 'clear'.\n");
+        {
+            AllocObj mX(&oa);  const AllocObj& X = mX;
+            mX.clear();
+            ASSERT(X.empty());
+            ASSERT(0 == X.capacity());
+
+            loadEvenKeys(&mX, N);
+
+            const AllocObj::size_type   CAPACITY = X.capacity();
+            bslma::TestAllocatorMonitor oam(&oa);
+
+            mX.clear();
+            ASSERT(X.empty());
+            ASSERT(X.begin() == X.end());
+            ASSERT(1 == oa.numBlocksInUse());
+            ASSERT(oam.isTotalSame());
+            ASSERT(CAPACITY == X.capacity());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+        ASSERT(0 == defaultAllocator.numBlocksInUse());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // LOOKUP
+        //
+        // Concerns:
+        //: 1 'find' returns an iterator referring to the element having the
+        //:   key if there is one, and 'end' otherwise, and 'count' returns 1
+        //:   or 0 accordingly.
+        //:
+        //: 2 'lower_bound', 'upper_bound', and 'equal_range' return the
+        //:   positions of the first element not ordered before the key, and
+        //:   of the first element ordered after the key.
+        //:
+        //: 3 The concerns hold for keys ordered before the first key, after
+        //:   the last key, and between two keys, for maps of every size around
+        //:   a power of two (at which the number of steps taken by a search
+        //:   changes), and for the manipulator and accessor overloads.
+        //:
+        //: 4 The concerns hold for a user-supplied comparator.
+        //
+        // Plan:
+        //: 1 For maps of several sizes, holding the keys 10, 20, and so on,
+        //:   look up every multiple of 5 from 0 to 15 more than the last key,
+        //:   and verify the results of each lookup method using 'testLookup',
+        //:   given the number of keys ordered before the looked-up key.
+        //:   (C-1..3)
+        //:
+        //: 2 Repeat P-1 for a 'GreaterObj'.  (C-4)
+        //
+        // Testing:
+        //   iterator find(const key_type& key);
+        //   iterator lower_bound(const key_type& key);
+        //   iterator upper_bound(const key_type& key);
+        //   pair<iterator, iterator> equal_range(const key_type& key);
+        //   const_iterator find(const key_type& key) const;
+        //   size_type count(const key_type& key) const;
+        //   const_iterator lower_bound(const key_type& key) const;
+        //   const_iterator upper_bound(const key_type& key) const;
+        //   pair<const_iterator, const_iterator> equal_range(key) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nLOOKUP"
+                            "\n======\n");
+
+        bslma::TestAllocator oa("object", veryVeryVerbose);
+
+        static const int SIZES[] = { 0, 1, 2, 3, 7, 8, 9, 16, 17, 100 };
+        const int NUM_SIZES = sizeof SIZES / sizeof *SIZES;
+
+        for (int ti = 0; ti < NUM_SIZES; ++ti) {
+            const int SIZE = SIZES[ti];
+
+            Obj        mX(&oa);
+            GreaterObj mY(&oa);
+            for (int i = 1; i <= SIZE; ++i) {
+                mX.insert(Obj::value_type(10 * i, i));
+                mY.insert(GreaterObj::value_type(10 * i, i));
+            }
+
+            for (int key = 0; key <= 10 * SIZE + 15; key += 5) {
+                const bool IS_PRESENT = 0 < key
+                                     && key <= 10 * SIZE
+                                     && 0 == key % 10;
+                const int  NUM_LESS   = native_std::min(SIZE, (key - 1) / 10);
+
+                testLookup(&mX, key, NUM_LESS, IS_PRESENT);
+                testLookup(&mY, key, SIZE - NUM_LESS - IS_PRESENT, IS_PRESENT);
+
+                if (IS_PRESENT) {
+                    ASSERTV(SIZE, key, key / 10 == mX.find(key)->second);
+                    ASSERTV(SIZE, key, key / 10 == mY.find(key)->second);
+                }
+            }
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // ITERATORS
+        //
+        // Concerns:
+        //: 1 Each pair of iterator accessors delimits the elements of the map,
+        //:   in increasing key order for the forward iterators, and in
+        //:   decreasing key order for the reverse iterators, and the 'c'
+        //:   accessors return the same iterators as the others.
+        //:
+        //: 2 The iterators are random-access, and the distance from the
+        //:   beginning to the end of the map is its size.
+        //:
+        //: 3 A mapped value may be modified through an 'iterator' or a
+        //:   'reverse_iterator'.
+        //:
+        //: 4 Inserting or erasing an element does not move the elements
+        //:   preceding it, provided that the capacity of the map does not
+        //:   change.
+        //
+        // Plan:
+        //: 1 For maps of several sizes, built by inserting keys in decreasing
+        //:   order, iterate over the elements with each kind of iterator,
+        //:   verifying the keys, and modifying the mapped values through the
+        //:   modifiable iterators.  (C-1..3)
+        //:
+        //: 2 In an 'AllocObj' having sufficient capacity, record the
+        //:   addresses of the elements, insert and erase elements following
+        //:   (and then at) a position, and verify the addresses and values of
+        //:   the preceding elements.  (C-4)
+        //
+        // Testing:
+        //   iterator begin();
+        //   iterator end();
+        //   reverse_iterator rbegin();
+        //   reverse_iterator rend();
+        //   const_iterator begin() const;
+        //   const_iterator cbegin() const;
+        //   const_iterator end() const;
+        //   const_iterator cend() const;
+        //   const_reverse_iterator rbegin() const;
+        //   const_reverse_iterator crbegin() const;
+        //   const_reverse_iterator rend() const;
+        //   const_reverse_iterator crend() const;
+        //   CONCERN: Inserting or erasing does not move the preceding elements
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nITERATORS"
+                            "\n=========\n");
+
+        bslma::TestAllocator oa("object", veryVeryVerbose);
+
+        if (verbose) printf("\nIterating over maps of several sizes.\n");
+
+        static const int SIZES[] = { 0, 1, 2, 15, 16, 17, 100 };
+        const int NUM_SIZES = sizeof SIZES / sizeof *SIZES;
+
+        for (int ti = 0; ti < NUM_SIZES; ++ti) {
+            const int SIZE = SIZES[ti];
+
+            Obj mX(&oa);  const Obj& X = mX;
+            for (int i = SIZE; 0 < i--; ) {
+                mX.insert(Obj::value_type(i, -1));
+            }
+
+            ASSERTV(SIZE, SIZE == mX.end() - mX.begin());
+            ASSERTV(SIZE, SIZE == X.end() - X.begin());
+            ASSERTV(SIZE, SIZE == mX.rend() - mX.rbegin());
+            ASSERTV(SIZE, SIZE == X.rend() - X.rbegin());
+            ASSERTV(SIZE, X.begin()  == X.cbegin());
+            ASSERTV(SIZE, X.end()    == X.cend());
+            ASSERTV(SIZE, X.rbegin() == X.crbegin());
+            ASSERTV(SIZE, X.rend()   == X.crend());
+            ASSERTV(SIZE, X.begin()  == mX.begin());
+            ASSERTV(SIZE, X.end()    == mX.end());
+
+            int i = 0;
+            for (Obj::iterator it = mX.begin(); it != mX.end(); ++it, ++i) {
+                ASSERTV(SIZE, i, i == it->first);
+                it->second = i;
+            }
+            ASSERTV(SIZE, SIZE == i);
+
+            for (Obj::reverse_iterator it = mX.rbegin(); it != mX.rend();
+                                                                        ++it) {
+                --i;
+                ASSERTV(SIZE, i, i == it->first);
+                ASSERTV(SIZE, i, i == it->second);
+                it->second *= 2;
+            }
+            ASSERTV(SIZE, 0 == i);
+
+            for (Obj::const_iterator it = X.cbegin(); it != X.cend();
+                                                                   ++it, ++i) {
+                ASSERTV(SIZE, i, i     == it->first);
+                ASSERTV(SIZE, i, 2 * i == it->second);
+            }
+            ASSERTV(SIZE, SIZE == i);
+
+            for (Obj::const_reverse_iterator it = X.crbegin();
+                 it != X.crend();
+                 ++it) {
+                --i;
+                ASSERTV(SIZE, i, i == it->first);
+            }
+            ASSERTV(SIZE, 0 == i);
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+
+        if (verbose) printf("\nTesting the addresses of elements.\n");
+        {
+            const int N = 8;  // number of elements initially in the object
+
+            AllocObj mX(&oa);  const AllocObj& X = mX;
+            mX.reserve(2 * N);
+            loadEvenKeys(&mX, N);
+
+            const AllocObj::value_type *ADDRESSES[N];
+            for (int i = 0; i < N; ++i) {
+                ADDRESSES[i] = &X.begin()[i];
+            }
+
+            // Insert and erase elements after, and then at, the middle.
+
+            mX[2 * N + 1];
+            mX[N + 1];
+            ASSERT(1 == mX.erase(2 * N - 2));
+            mX.erase(X.begin() + N / 2);
+            mX[N - 1];
+
+            for (int i = 0; i < N / 2; ++i) {
+                ASSERTV(i, ADDRESSES[i] == &X.begin()[i]);
+                ASSERTV(i, 2 * i == ADDRESSES[i]->first);
+                ASSERTV(i, i     == ADDRESSES[i]->second.data());
+            }
+            ASSERT(2 * N == X.capacity());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+        ASSERT(0 == defaultAllocator.numBlocksInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // 'insert'
+        //
+        // Concerns:
+        //: 1 'insert' inserts an element if and only if no element having the
+        //:   key of the value is present, and returns an iterator referring
+        //:   to the element having the key, and whether an element was
+        //:   inserted; the mapped value of an existing element is unchanged.
+        //:
+        //: 2 An element is inserted in key order at the front, in the middle,
+        //:   or at the back of the map.
+        //:
+        //: 3 Inserting an element into a map whose size is less than its
+        //:   capacity allocates no memory, and inserting a key that is present
+        //:   allocates no memory.
+        //:
+        //: 4 The hint passed to 'insert' affects only performance: the element
+        //:   is inserted in key order whether or not the hint is correct.
+        //:
+        //: 5 The mapped values of an inserted element, and of the elements it
+        //:   shifts, use the allocator of the map.
+        //:
+        //: 6 No memory is leaked, and the default allocator is not used.
+        //
+        // Plan:
+        //: 1 Using a table of positions, insert an odd key at each position
+        //:   into an object holding 'N' even keys and having capacity for one
+        //:   more, and verify the returned value, the keys of the object, and
+        //:   that no memory is allocated.  Then insert each even key again
+        //:   with a different mapped value, and verify that nothing is
+        //:   inserted, modified, or allocated.  (C-1..3)
+        //:
+        //: 2 Repeat P-1 using 'insert' with a hint of 'begin', of 'end', and
+        //:   of the correct position.  (C-4)
+        //:
+        //: 3 Insert elements into an 'AllocObj' in decreasing key order, so
+        //:   that each insertion shifts every existing element, and verify
+        //:   the key, mapped value, and allocator of every element.  (C-5)
+        //:
+        //: 4 Verify that no memory is in use by the object allocator at the
+        //:   end of the test, and that the default allocator is not used.
+        //:   (C-6)
+        //
+        // Testing:
+        //   pair<iterator, bool> insert(const value_type& value);
+        //   iterator insert(const_iterator hint, const value_type& value);
+        //   CONCERN: Inserting at the front, in the middle, or at the back
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\n'insert'"
+                            "\n========\n");
+
+        bslma::TestAllocator oa("object",  veryVeryVerbose);
+        bslma::TestAllocator sa("scratch", veryVeryVerbose);
+
+        const int N = 8;  // number of elements initially in the object
+
+        enum { e_NO_HINT, e_HINT_BEGIN, e_HINT_END, e_HINT_POSITION };
+
+        static const int POSITIONS[] = { 0, 1, N / 2, N - 1, N };
+        const int NUM_POSITIONS = sizeof POSITIONS / sizeof *POSITIONS;
+
+        for (int hint = e_NO_HINT; hint <= e_HINT_POSITION; ++hint) {
+            for (int ti = 0; ti < NUM_POSITIONS; ++ti) {
+                const int POSITION = POSITIONS[ti];
+                const int KEY      = 2 * POSITION - 1;
+
+                if (veryVerbose) { T_ P_(hint) P(POSITION) }
+
+                Obj mX(&oa);  const Obj& X = mX;
+                mX.reserve(N + 1);
+
+                Keys keys(&sa);
+                for (int i = 0; i < N; ++i) {
+                    mX.insert(Obj::value_type(2 * i, i));
+                    keys.push_back(2 * i);
+                }
+
+                bslma::TestAllocatorMonitor oam(&oa);
+
+                const Obj::value_type VALUE(KEY, -1);
+                Obj::iterator         it;
+                switch (hint) {
+                  case e_NO_HINT: {
+                    const bsl::pair<Obj::iterator, bool> R = mX.insert(VALUE);
+                    ASSERTV(POSITION, R.second);
+                    it = R.first;
+                  } break;
+                  case e_HINT_BEGIN: {
+                    it = mX.insert(X.begin(), VALUE);
+                  } break;
+                  case e_HINT_END: {
+                    it = mX.insert(X.end(), VALUE);
+                  } break;
+                  default: {
+                    it = mX.insert(X.begin() + POSITION, VALUE);
+                  }
+                }
+                ASSERTV(hint, POSITION, X.begin() + POSITION == it);
+                ASSERTV(hint, POSITION, KEY == it->first);
+                ASSERTV(hint, POSITION, -1  == it->second);
+
+                keys.insert(keys.begin() + POSITION, KEY);
+                ASSERTV(hint, POSITION, hasKeys(X, keys));
+
+                for (int i = 0; i < N; ++i) {
+                    const Obj::value_type EXISTING(2 * i, -2);
+
+                    const bsl::pair<Obj::iterator, bool> R =
+                                                         mX.insert(EXISTING);
+                    ASSERTV(hint, POSITION, i, !R.second);
+                    ASSERTV(hint, POSITION, i, 2 * i == R.first->first);
+                    ASSERTV(hint, POSITION, i, i     == R.first->second);
+                    ASSERTV(hint, POSITION, i,
+                            R.first == mX.insert(X.begin(), EXISTING));
+                    ASSERTV(hint, POSITION, i,
+                            R.first == mX.insert(X.end(), EXISTING));
+                }
+                ASSERTV(hint, POSITION, oam.isTotalSame());
+                ASSERTV(hint, POSITION, hasKeys(X, keys));
+            }
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+
+        if (verbose) printf("\nInserting out-of-line elements.\n");
+        {
+            const int NUM_ELEMENTS = 100;
+
+            AllocObj mX(&oa);  const AllocObj& X = mX;
+            for (int i = NUM_ELEMENTS; 0 < i--; ) {
+                const bsltf::AllocTestType VALUE(i, &sa);
+                const AllocObj::value_type ELEMENT(i, VALUE, &sa);
+
+                const bsl::pair<AllocObj::iterator, bool> R =
+                                                           mX.insert(ELEMENT);
+                ASSERTV(i, R.second);
+                ASSERTV(i, X.begin() == R.first);
+            }
+            ASSERT(NUM_ELEMENTS == X.size());
+
+            int i = 0;
+            for (AllocObj::const_iterator it = X.begin();
+                 it != X.end();
+                 ++it, ++i) {
+                ASSERTV(i, i   == it->first);
+                ASSERTV(i, i   == it->second.data());
+                ASSERTV(i, &oa == it->second.allocator());
+            }
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+        ASSERT(0 == defaultAllocator.numBlocksInUse());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create an object, insert elements in an order that shifts the
+        //:   elements already present, look them up, and iterate over them.
+        //:   (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        //   explicit flat_map(const COMPARATOR&, const ALLOCATOR&);
+        //   explicit flat_map(const ALLOCATOR& basicAllocator);
+        //   ~flat_map();
+        //   iterator begin();
+        //   iterator end();
+        //   pair<iterator, bool> insert(const value_type& value);
+        //   iterator find(const key_type& key);
+        //   const_iterator begin() const;
+        //   const_iterator end() const;
+        //   bool empty() const;
+        //   size_type size() const;
+        //   key_compare key_comp() const;
+        //   value_compare value_comp() const;
+        //   const_iterator find(const key_type& key) const;
+        //   size_type count(const key_type& key) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        bslma::TestAllocator oa("object", veryVeryVerbose);
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+            ASSERT(X.empty());
+            ASSERT(0 == X.size());
+            ASSERT(X.begin() == X.end());
+            ASSERT(X.end() == X.find(0));
+            ASSERT(0 == oa.numBlocksTotal());
+
+            for (int i = 0; i < 1000; ++i) {
+                const int key = (i * 7919) % 1000;
+                ASSERT(mX.insert(Obj::value_type(key, key * 2)).second);
+                ASSERT(!mX.insert(Obj::value_type(key, 0)).second);
+            }
+            ASSERT(1000 == X.size());
+            ASSERT(!X.empty());
+
+            int count = 0;
+            for (Obj::const_iterator it = X.begin(); it != X.end(); ++it) {
+                ASSERT(count     == it->first);
+                ASSERT(count * 2 == it->second);
+                ASSERT(1 == X.count(it->first));
+                ++count;
+            }
+            ASSERT(1000 == count);
+
+            ASSERT(500 == mX.find(250)->second);
+            ASSERT(0   == X.count(1000));
+            ASSERT(X.key_comp()(1, 2));
+            ASSERT(X.value_comp()(Obj::value_type(1, 9),
+                                  Obj::value_type(2, 0)));
+
+            const Obj Y(std::less<int>(), &oa);
+            ASSERT(Y.empty());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST
+        //
+        // Concerns:
+        //: 1 Building a 'flat_map' from unsorted keys, and looking up keys in
+        //:   it, is faster and takes fewer allocations and less memory than
+        //:   with 'bsl::map'.
+        //
+        // Plan:
+        //: 1 For several sizes, build a 'flat_map' and a 'bsl::map' by
+        //:   inserting the same shuffled range of keys, then look up a
+        //:   pseudo-random sequence of keys, half of which are present, and
+        //:   report the number of allocations, the memory in use, and the time
+        //:   taken by each phase.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nPERFORMANCE TEST"
+                            "\n================\n");
+
+        static const int SIZES[] = { 1000, 100000, 2000000 };
+        const int NUM_SIZES = sizeof SIZES / sizeof *SIZES;
+        const int NUM_PROBES = 1000000;
+
+        for (int ti = 0; ti < NUM_SIZES; ++ti) {
+            const int SIZE = SIZES[ti];
+
+            bsl::vector<int> keys;
+            keys.reserve(SIZE);
+            for (int i = 0; i < SIZE; ++i) {
+                keys.push_back(2 * i);
+            }
+
+            unsigned int state = 12345;
+            for (int i = SIZE - 1; 0 < i; --i) {
+                state = state * 1103515245u + 12345u;
+                native_std::swap(keys[i], keys[(state >> 4) % (i + 1)]);
+            }
+
+            bsl::vector<int> probes;
+            probes.reserve(NUM_PROBES);
+            for (int i = 0; i < NUM_PROBES; ++i) {
+                state = state * 1103515245u + 12345u;
+                probes.push_back(static_cast<int>((state >> 4) % (2 * SIZE)));
+            }
+
+            printf("\n%d keys, %d lookups\n", SIZE, NUM_PROBES);
+            printf("%-28s %10s %12s %9s %9s\n",
+                   "type", "allocs", "bytes", "build(s)", "find(s)");
+
+            runBenchmark<bsl::map<int, int> >("bsl::map<int, int>",
+                                              keys,
+                                              probes);
+            runBenchmark<Obj>("bsl::flat_map<int, int>", keys, probes);
+        }
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1307 @@
+// bslstl_flatmultimap.h                                              -*-C++-*-
+#ifndef INCLUDED_BSLSTL_FLATMULTIMAP
+#define INCLUDED_BSLSTL_FLATMULTIMAP
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an ordered map of non-unique keys in a sorted vector.
+//
+//@CLASSES:
+//   bsl::flat_multimap: ordered map of non-unique keys, stored contiguously
+//
+//@SEE_ALSO: bslstl_flattree, bslstl_flatmap, bslstl_flatset, bslstl_multimap
+//
+//@DESCRIPTION: This component defines a single class template,
+// 'flat_multimap', implementing an ordered container holding a collection of
+// (possibly equivalent) keys, each mapped to an associated value, having an
+// interface closely modeled on the standard 'multimap' [multimap].
+//
+// A 'flat_multimap' stores its key-value pairs, sorted by key, in a single
+// 'bsl::vector' (see 'bslstl_flattree'), and locates a key with a
+// branch-free binary search over that vector, whereas a 'bsl::multimap'
+// allocates a separate red-black tree node for every element, and follows
+// one dependent pointer per level of the tree.  Key-value pairs having
+// equivalent keys are kept in the order in which they were inserted.  A
+// 'flat_multimap' is intended for *read-mostly* data, built (or rebuilt) in
+// bulk and then searched many times; the price of its layout is that
+// inserting or erasing a single key-value pair takes time linear in the size
+// of the multimap:
+//
+//: o Any insertion and any erasure invalidates all iterators, pointers, and
+//:   references to the elements at or after the point of insertion or
+//:   erasure, and an insertion that grows the capacity of the multimap (see
+//:   'reserve') invalidates all of them.
+//:
+//: o The 'value_type' of a 'flat_multimap' is 'bsl::pair<KEY, VALUE>'
+//:   (rather than 'bsl::pair<const KEY, VALUE>'), since the pairs are
+//:   assigned as they are shifted within the vector.  The behavior is
+//:   undefined if the key of an element is modified through an iterator.
+//
+// Inserting a range of key-value pairs (including by the range constructor)
+// appends the pairs to the vector, stably sorts them (once) if they are not
+// already sorted, and merges them with the existing pairs in a single pass
+// (see {'bslstl_flattree'|Bulk Insertion}).  Consequently, building a
+// 'flat_multimap' from a range sorted by key takes linear time, and merging a
+// sorted range into a 'flat_multimap' takes time linear in the combined size.
+//
+// An instantiation of 'flat_multimap' is an allocator-aware, value-semantic
+// type whose salient attributes are its size (number of key-value pairs) and
+// the ordered sequence of key-value pairs the multimap contains.  If
+// 'flat_multimap' is instantiated with a key type or mapped-value type that
+// is not itself value-semantic, then it will not retain all of its
+// value-semantic qualities.  In particular, if the key or value type cannot
+// be tested for equality, then a 'flat_multimap' containing that type cannot
+// be tested for equality.
+//
+///Requirements on 'KEY' and 'VALUE'
+///---------------------------------
+// A 'flat_multimap' is a fully "Value-Semantic Type" (see
+// {'bsldoc_glossary'}) only if the supplied 'KEY' and 'VALUE' template
+// parameters are fully value-semantic.  In addition, 'KEY' and 'VALUE' must
+// be "copy-constructible" and "assignable" to insert an element, both must be
+// "equality-comparable" for two 'flat_multimap' objects to be compared using
+// 'operator==', and must be "less-than-comparable" for two 'flat_multimap'
+// objects to be compared using 'operator<'.
+//
+///Memory Allocation
+///-----------------
+// The type supplied as a 'flat_multimap''s 'ALLOCATOR' template parameter
+// determines how that multimap will allocate memory.  The 'flat_multimap'
+// template supports allocators meeting the requirements of the C++11 standard
+// [17.6.3.5].  In addition, it supports scoped-allocators derived from the
+// 'bslma::Allocator' memory allocation protocol.  Clients intending to use
+// 'bslma' style allocators should use the template's default 'ALLOCATOR'
+// type: The default type for the 'ALLOCATOR' template parameter,
+// 'bsl::allocator', provides a C++11 standard-compatible adapter for a
+// 'bslma::Allocator' object.  Note that the temporary buffers used to sort
+// and merge a range of inserted elements are also obtained from the
+// allocator of the multimap.
+//
+///'bslma'-Style Allocators
+/// - - - - - - - - - - - -
+// If the (template parameter) type 'ALLOCATOR' of a 'flat_multimap'
+// instantiation is 'bsl::allocator', then objects of that multimap type will
+// conform to the standard behavior of a 'bslma'-allocator-enabled type.  Such
+// a multimap accepts an optional 'bslma::Allocator' argument at construction.
+// If the address of a 'bslma::Allocator' object is explicitly supplied at
+// construction, it will be used to supply memory for the multimap throughout
+// its lifetime; otherwise, the multimap will use the default allocator
+// installed at the time of the multimap's construction (see 'bslma_default').
+// In addition to directly allocating memory from the indicated
+// 'bslma::Allocator', a multimap supplies that allocator's address to the
+// constructors of contained objects of the (template parameter) type 'KEY'
+// and 'VALUE', if respectively, the types define the
+// 'bslma::UsesBslmaAllocator' trait.
+//
+///Operations
+///----------
+// This section describes the run-time complexity of operations on instances
+// of 'flat_multimap':
+//..
+//  Legend
+//  ------
+//  'K'             - (template parameter) type 'KEY' of the multimap
+//  'V'             - (template parameter) type 'VALUE' of the multimap
+//  'a', 'b'        - two distinct objects of type 'flat_multimap<K, V>'
+//  'n', 'm'        - number of elements in 'a' and 'b' respectively
+//  'c'             - comparator providing an ordering for objects of type 'K'
+//  'al'            - an STL-style memory allocator
+//  'i1', 'i2'      - two iterators defining a sequence of 'value_type' objects
+//  'k'             - an object of type 'K'
+//  'v'             - an object of type 'V'
+//  'p1', 'p2'      - two iterators belonging to 'a'
+//  distance(i1,i2) - the number of elements in the range [i1, i2)
+//
+//  +----------------------------------------------------+--------------------+
+//  | Operation                                          | Complexity         |
+//  +====================================================+====================+
+//  | flat_multimap<K, V> a;    (default construction)   | O[1]               |
+//  | flat_multimap<K, V> a(al);                         |                    |
+//  | flat_multimap<K, V> a(c, al);                      |                    |
+//  +----------------------------------------------------+--------------------+
+//  | flat_multimap<K, V> a(b); (copy construction)      | O[n]               |
+//  | flat_multimap<K, V> a(b, al);                      |                    |
+//  +----------------------------------------------------+--------------------+
+//  | flat_multimap<K, V> a(i1, i2);                     | O[N] if [i1, i2)   |
+//  | flat_multimap<K, V> a(i1, i2, al);                 | is sorted with     |
+//  | flat_multimap<K, V> a(i1, i2, c, al);              | 'a.value_comp()',  |
+//  |                                                    | O[N * log(N)]      |
+//  |                                                    | otherwise, where N |
+//  |                                                    | is distance(i1,i2) |
+//  +----------------------------------------------------+--------------------+
+//  | a.~flat_multimap<K, V>(); (destruction)            | O[n]               |
+//  +----------------------------------------------------+--------------------+
+//  | a = b;          (assignment)                       | O[n + m]           |
+//  +----------------------------------------------------+--------------------+
+//  | a.begin(), a.end(), a.cbegin(), a.cend(),          | O[1]               |
+//  | a.rbegin(), a.rend(), a.crbegin(), a.crend()       |                    |
+//  +----------------------------------------------------+--------------------+
+//  | a == b, a != b                                     | O[n]               |
+//  +----------------------------------------------------+--------------------+
+//  | a < b, a <= b, a > b, a >= b                       | O[n]               |
+//  +----------------------------------------------------+--------------------+
+//  | a.swap(b), swap(a,b)                               | O[1]               |
+//  +----------------------------------------------------+--------------------+
+//  | a.size(), a.max_size(), a.empty(), get_allocator(),| O[1]               |
+//  | a.capacity()                                       |                    |
+//  +----------------------------------------------------+--------------------+
+//  | a.reserve(n), a.shrink_to_fit()                    | O[n]               |
+//  +----------------------------------------------------+--------------------+
+//  | a.insert(value_type(k, v))                         | O[log(n)] if k is  |
+//  | a.insert(p1, value_type(k, v))                     | not ordered before |
+//  |                                                    | the last key in    |
+//  |                                                    | 'a', O[n]          |
+//  |                                                    | otherwise          |
+//  +----------------------------------------------------+--------------------+
+//  | a.insert(i1, i2)                                   | O[n + N] if        |
+//  |                                                    | [i1, i2) is sorted |
+//  |                                                    | O[n + N * log(N)]  |
+//  |                                                    | otherwise, where N |
+//  |                                                    | is distance(i1,i2) |
+//  +----------------------------------------------------+--------------------+
+//  | a.erase(p1), a.erase(k), a.erase(p1, p2)           | O[n]               |
+//  +----------------------------------------------------+--------------------+
+//  | a.clear()                                          | O[n]               |
+//  +----------------------------------------------------+--------------------+
+//  | a.key_comp(), a.value_comp()                       | O[1]               |
+//  +----------------------------------------------------+--------------------+
+//  | a.find(k), a.count(k), a.lower_bound(k),           | O[log(n)]          |
+//  | a.upper_bound(k), a.equal_range(k)                 |                    |
+//  +----------------------------------------------------+--------------------+
+//..
+//
+///Usage
+///-----
+// This section illustrates intended usage of this component.
+//
+///Example 1: Indexing Trades by Instrument
+///- - - - - - - - - - - - - - - - - - - -
+// Suppose that, at the end of each day, we receive the day's trades, in order
+// of execution, and must report the trades of each instrument in the order in
+// which they were executed.
+//
+// First, we define the trades, each mapping an instrument identifier to a
+// trade identifier:
+//..
+//  typedef bsl::flat_multimap<int, int> TradeIndex;
+//  typedef TradeIndex::value_type       Trade;
+//
+//  const Trade TRADES[] = {
+//      Trade(7, 100), Trade(3, 101), Trade(7, 102), Trade(5, 103),
+//      Trade(3, 104), Trade(7, 105)
+//  };
+//  const int NUM_TRADES = sizeof TRADES / sizeof *TRADES;
+//..
+// Then, we build the index, which stably sorts the trades once, so that the
+// trades of each instrument remain in order of execution:
+//..
+//  TradeIndex index(TRADES, TRADES + NUM_TRADES);
+//  assert(6 == index.size());
+//  assert(3 == index.count(7));
+//..
+// Next, we visit the trades of instrument 7:
+//..
+//  bsl::pair<TradeIndex::iterator, TradeIndex::iterator> trades =
+//                                                       index.equal_range(7);
+//  assert(100 == trades.first->second);
+//  assert(102 == (++trades.first)->second);
+//  assert(105 == (++trades.first)->second);
+//..
+// Finally, we merge in a late batch of trades, which are placed after the
+// trades already indexed for the same instrument:
+//..
+//  const Trade LATE[] = { Trade(3, 106), Trade(9, 107) };
+//  index.insert(LATE, LATE + 2);
+//
+//  assert(8   == index.size());
+//  assert(106 == (index.upper_bound(3) - 1)->second);
+//  assert(9   == index.rbegin()->first);
+//..
+
+#ifndef INCLUDED_BSLSCM_VERSION
+#include <bslscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_ALLOCATOR
+#include <bslstl_allocator.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_ALLOCATORTRAITS
+#include <bslstl_allocatortraits.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_FLATTREE
+#include <bslstl_flattree.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_ITERATOR
+#include <bslstl_iterator.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_PAIR
+#include <bslstl_pair.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_UNORDEREDMAPKEYCONFIGURATION
+#include <bslstl_unorderedmapkeyconfiguration.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_RANGECOMPARE
+#include <bslalg_rangecompare.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_TYPETRAITHASSTLITERATORS
+#include <bslalg_typetraithasstliterators.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_USESBSLMAALLOCATOR
+#include <bslma_usesbslmaallocator.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_FUNCTIONAL
+#include <functional>
+#define INCLUDED_FUNCTIONAL
+#endif
+
+namespace bsl {
+
+                           // ====================
+                           // class flat_multimap
+                           // ====================
+
+template <class KEY,
+          class VALUE,
+          class COMPARATOR = std::less<KEY>,
+          class ALLOCATOR  = bsl::allocator<bsl::pair<KEY, VALUE> > >
+class flat_multimap {
+    // This class template implements a value-semantic container type holding
+    // an ordered sequence of (possibly equivalent) keys (of template
+    // parameter type 'KEY'), each mapped to an associated value (of template
+    // parameter type 'VALUE'), stored in a sorted vector.
+    //
+    // This class:
+    //: o supports a complete set of *value-semantic* operations
+    //:   o except for 'bdex' serialization
+    //: o is *exception-neutral*
+    //: o is *alias-safe*
+    //: o is 'const' *thread-safe*
+    // For terminology see {'bsldoc_glossary'}.
+
+    // PRIVATE TYPES
+    typedef bsl::allocator_traits<ALLOCATOR> AllocatorTraits;
+        // This typedef is an alias for the allocator traits type associated
+        // with this container.
+
+    typedef bsl::pair<KEY, VALUE>  ValueType;
+        // This typedef is an alias for the type of key-value pair objects
+        // maintained by this multimap.
+
+    typedef ::BloombergLP::bslstl::UnorderedMapKeyConfiguration<ValueType>
+                                                             KeyConfiguration;
+        // This typedef is an alias for the policy used internally by this
+        // container to extract the 'KEY' value from the key-value pair
+        // objects maintained by this multimap.
+
+    typedef ::BloombergLP::bslstl::FlatTree<KeyConfiguration,
+                                            COMPARATOR,
+                                            ALLOCATOR> Tree;
+        // This typedef is an alias for the template instantiation of the
+        // underlying 'bslstl::FlatTree' used to implement this multimap.
+
+    typedef typename Tree::SizeType TreeIndex;
+        // This typedef is an alias for the type of the indices identifying
+        // positions in the underlying tree.
+
+  public:
+    // PUBLIC TYPES
+    typedef KEY                                        key_type;
+    typedef VALUE                                      mapped_type;
+    typedef bsl::pair<KEY, VALUE>                      value_type;
+    typedef COMPARATOR                                 key_compare;
+    typedef ALLOCATOR                                  allocator_type;
+    typedef value_type&                                reference;
+    typedef const value_type&                          const_reference;
+
+    typedef typename AllocatorTraits::size_type        size_type;
+    typedef typename AllocatorTraits::difference_type  difference_type;
+    typedef typename AllocatorTraits::pointer          pointer;
+    typedef typename AllocatorTraits::const_pointer    const_pointer;
+
+    typedef typename Tree::Iterator                    iterator;
+    typedef typename Tree::ConstIterator               const_iterator;
+    typedef bsl::reverse_iterator<iterator>            reverse_iterator;
+    typedef bsl::reverse_iterator<const_iterator>      const_reverse_iterator;
+
+    class value_compare {
+        // This nested class defines a mechanism for comparing two objects of
+        // 'value_type' using the (template parameter) type 'COMPARATOR'.
+        // Note that this class exactly matches the definition of
+        // 'multimap::value_compare' in the C++11 standard [23.4.5.1].
+
+        // FRIENDS
+        friend class flat_multimap;
+
+      protected:
+        COMPARATOR comp;  // we would not have elected to make this data
+                          // member protected ourselves
+
+        value_compare(COMPARATOR comparator) : comp(comparator) {}
+            // Create a 'value_compare' object that will delegate to the
+            // specified 'comparator' for comparisons.
+
+      public:
+        typedef bool result_type;
+            // This 'typedef' is an alias for the result type of a call to the
+            // overload of 'operator()' (the comparison function) provided by
+            // a 'flat_multimap::value_compare' object.
+
+        typedef value_type first_argument_type;
+            // This 'typedef' is an alias for the type of the first parameter
+            // of the overload of 'operator()' (the comparison function)
+            // provided by a 'flat_multimap::value_compare' object.
+
+        typedef value_type second_argument_type;
+            // This 'typedef' is an alias for the type of the second parameter
+            // of the overload of 'operator()' (the comparison function)
+            // provided by a 'flat_multimap::value_compare' object.
+
+        bool operator()(const value_type& x, const value_type& y) const
+            // Return 'true' if the specified 'x' object is ordered before the
+            // specified 'y' object, as determined by the comparator supplied
+            // at construction.
+        {
+            return comp(x.first, y.first);
+        }
+    };
+
+  private:
+    // DATA
+    Tree  d_tree;  // sorted vector holding the key-value pairs of this
+                   // multimap
+
+  public:
+    // CREATORS
+    explicit flat_multimap(const COMPARATOR& comparator     = COMPARATOR(),
+                           const ALLOCATOR&  basicAllocator = ALLOCATOR());
+        // Create an empty multimap.  Optionally specify a 'comparator' used
+        // to order keys contained in this object.  If 'comparator' is not
+        // supplied, a default-constructed object of the (template parameter)
+        // type 'COMPARATOR' is used.  Optionally specify the 'basicAllocator'
+        // used to supply memory.  If 'basicAllocator' is not supplied, a
+        // default-constructed object of the (template parameter) type
+        // 'ALLOCATOR' is used.  If the 'ALLOCATOR' is 'bsl::allocator' (the
+        // default), then 'basicAllocator' shall be convertible to
+        // 'bslma::Allocator *', and, if 'basicAllocator' is not supplied, the
+        // currently installed default allocator will be used to supply
+        // memory.  No memory is allocated.
+
+    explicit flat_multimap(const ALLOCATOR& basicAllocator);
+        // Create an empty multimap that uses the specified 'basicAllocator'
+        // to supply memory.  Use a default-constructed object of the
+        // (template parameter) type 'COMPARATOR' to order the keys contained
+        // in this multimap.  If the 'ALLOCATOR' is 'bsl::allocator' (the
+        // default), then 'basicAllocator' shall be convertible to
+        // 'bslma::Allocator *'.
+
+    flat_multimap(const flat_multimap& original);
+    flat_multimap(const flat_multimap& original,
+                  const ALLOCATOR&      basicAllocator);
+        // Create a multimap having the same value and comparator as the
+        // specified 'original'.  Optionally specify the 'basicAllocator' used
+        // to supply memory.  If 'basicAllocator' is not supplied, the
+        // allocator is obtained by calling
+        // 'bsl::allocator_traits<ALLOCATOR>::
+        // select_on_container_copy_construction' on the allocator of
+        // 'original'.  If the 'ALLOCATOR' is 'bsl::allocator' (the default),
+        // then 'basicAllocator' shall be convertible to
+        // 'bslma::Allocator *'.
+
+    template <class INPUT_ITERATOR>
+    flat_multimap(INPUT_ITERATOR    first,
+                  INPUT_ITERATOR    last,
+                  const COMPARATOR& comparator     = COMPARATOR(),
+                  const ALLOCATOR&  basicAllocator = ALLOCATOR());
+        // Create a multimap, and insert each 'value_type' object in the
+        // sequence starting at the specified 'first' element, and ending
+        // immediately before the specified 'last' element.  Optionally
+        // specify a 'comparator' and 'basicAllocator' having the same meaning
+        // as for the default constructor.  If the sequence is sorted by key,
+        // this operation has O[N] complexity, and O[N * log(N)] complexity
+        // otherwise, where N is the number of elements between 'first' and
+        // 'last'.  The (template parameter) type 'INPUT_ITERATOR' shall meet
+        // the requirements of an input iterator defined in the C++11 standard
+        // [24.2.3] providing access to values of a type convertible to
+        // 'value_type'.  The behavior is undefined unless 'first' and 'last'
+        // refer to a sequence of valid values where 'first' is at a position
+        // at or before 'last'.
+
+    ~flat_multimap();
+        // Destroy this object.
+
+    // MANIPULATORS
+    flat_multimap& operator=(const flat_multimap& rhs);
+        // Assign to this object the value and comparator of the specified
+        // 'rhs' object, propagate to this object the allocator of 'rhs' if
+        // the 'ALLOCATOR' type has trait
+        // 'propagate_on_container_copy_assignment', and return a reference
+        // providing modifiable access to this object.
+
+    iterator begin();
+        // Return an iterator providing modifiable access to the first
+        // 'value_type' object in the ordered sequence of 'value_type' objects
+        // maintained by this multimap, or the 'end' iterator if this multimap
+        // is empty.
+
+    iterator end();
+        // Return an iterator providing modifiable access to the past-the-end
+        // element in the ordered sequence of 'value_type' objects maintained
+        // by this multimap.
+
+    reverse_iterator rbegin();
+        // Return a reverse iterator providing modifiable access to the last
+        // 'value_type' object in the ordered sequence of 'value_type' objects
+        // maintained by this multimap, or 'rend' if this multimap is empty.
+
+    reverse_iterator rend();
+        // Return a reverse iterator providing modifiable access to the
+        // prior-to-the-beginning element in the ordered sequence of
+        // 'value_type' objects maintained by this multimap.
+
+    iterator insert(const value_type& value);
+        // Insert the specified 'value' into this multimap, after every
+        // element having an equivalent key, and return an iterator referring
+        // to the newly inserted 'value_type' object.  This method requires
+        // that the (template parameter) types 'KEY' and 'VALUE' both be
+        // "copy-constructible" and "assignable" (see {Requirements on 'KEY'
+        // and 'VALUE'}).
+
+    iterator insert(const_iterator hint, const value_type& value);
+        // Insert the specified 'value' into this multimap, after every
+        // element having an equivalent key, and return an iterator referring
+        // to the newly inserted 'value_type' object.  The specified 'hint' is
+        // ignored, since the binary search it would save is dwarfed by the
+        // cost of shifting the elements that follow the insertion point.
+        // This method requires that the (template parameter) types 'KEY' and
+        // 'VALUE' both be "copy-constructible" and "assignable" (see
+        // {Requirements on 'KEY' and 'VALUE'}).
+
+    template <class INPUT_ITERATOR>
+    void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        // Insert into this multimap the value of each 'value_type' object in
+        // the range starting at the specified 'first' iterator and ending
+        // immediately before the specified 'last' iterator, after every
+        // element of this multimap having an equivalent key, and preserving
+        // the relative order of the elements of the range having equivalent
+        // keys.  The elements of the range are stably sorted (if they are not
+        // already sorted) and merged with the elements of this multimap in a
+        // single pass, so that this operation has O[n + N] complexity if the
+        // range is sorted by key, and O[n + N * log(N)] complexity otherwise,
+        // where n is the size of this multimap and N is the number of
+        // elements in the range.  The (template parameter) type
+        // 'INPUT_ITERATOR' shall meet the requirements of an input iterator
+        // defined in the C++11 standard [24.2.3] providing access to values
+        // of a type convertible to 'value_type'.  This method requires that
+        // the (template parameter) types 'KEY' and 'VALUE' both be
+        // "copy-constructible" and "assignable" (see {Requirements on 'KEY'
+        // and 'VALUE'}).  See {'bslstl_flattree'|Exception Safety} for the
+        // guarantee provided if an exception is thrown.
+
+    iterator erase(const_iterator position);
+        // Remove from this multimap the 'value_type' object at the specified
+        // 'position', and return an iterator referring to the element
+        // immediately following the removed element, or to the past-the-end
+        // position if the removed element was the last element in the
+        // sequence of elements maintained by this multimap.  The behavior is
+        // undefined unless 'position' refers to a 'value_type' object in this
+        // multimap.
+
+    size_type erase(const key_type& key);
+        // Remove from this multimap all 'value_type' objects having the
+        // specified 'key', if they exist, and return the number of erased
+        // objects; otherwise, if there are no 'value_type' objects having
+        // 'key', return 0 with no other effect.
+
+    iterator erase(const_iterator first, const_iterator last);
+        // Remove from this multimap the 'value_type' objects starting at the
+        // specified 'first' position up to, but not including the specified
+        // 'last' position, and return an iterator referring to the element
+        // that 'last' referred to (or the past-the-end iterator).  The
+        // behavior is undefined unless 'first' and 'last' either refer to
+        // elements in this multimap or are the 'end' iterator, and the
+        // 'first' position is at or before the 'last' position in the ordered
+        // sequence provided by this container.
+
+    void swap(flat_multimap& other);
+        // Exchange the value and comparator of this object with those of the
+        // specified 'other' object.  Additionally, if
+        // 'bsl::allocator_traits<ALLOCATOR>::propagate_on_container_swap' is
+        // 'true', then exchange the allocator of this object with that of the
+        // 'other' object, and do not modify either allocator otherwise.  This
+        // method provides the no-throw exception-safety guarantee and
+        // guarantees O[1] complexity.  The behavior is undefined unless either
+        // this object was created with the same allocator as 'other' or
+        // 'propagate_on_container_swap' is 'true'.
+
+    void clear();
+        // Remove all entries from this multimap.  Note that the capacity of
+        // this multimap is unchanged.
+
+    void reserve(size_type numElements);
+        // Change the capacity of this multimap such that it can hold at least
+        // the specified 'numElements' without reallocating.  Note that
+        // inserting into a multimap whose capacity is sufficient does not
+        // invalidate iterators, pointers, or references to the elements
+        // before the point of insertion.
+
+    void shrink_to_fit();
+        // Reduce the capacity of this multimap, if possible, to its size.
+        // Note that a multimap built in bulk may thereby release the memory
+        // left over from the growth of its storage.
+
+    iterator find(const key_type& key);
+        // Return an iterator providing modifiable access to the first
+        // 'value_type' object in this multimap having the specified 'key', if
+        // such an entry exists, and the past-the-end ('end') iterator
+        // otherwise.
+
+    iterator lower_bound(const key_type& key);
+        // Return an iterator providing modifiable access to the first (i.e.,
+        // ordered least) 'value_type' object in this multimap whose key is
+        // greater-than or equal-to the specified 'key', and the past-the-end
+        // iterator if this multimap does not contain a 'value_type' object
+        // whose key is greater-than or equal-to 'key'.
+
+    iterator upper_bound(const key_type& key);
+        // Return an iterator providing modifiable access to the first (i.e.,
+        // ordered least) 'value_type' object in this multimap whose key is
+        // greater than the specified 'key', and the past-the-end iterator if
+        // this multimap does not contain a 'value_type' object whose key is
+        // greater-than 'key'.
+
+    pair<iterator, iterator> equal_range(const key_type& key);
+        // Return a pair of iterators providing modifiable access to the
+        // sequence of 'value_type' objects in this multimap having the
+        // specified 'key', where the first iterator is positioned at the
+        // start of the sequence, and the second is positioned one past the
+        // end of the sequence.  If this multimap contains no 'value_type'
+        // objects having 'key', then the two returned iterators will have the
+        // same value.
+
+    // ACCESSORS
+    allocator_type get_allocator() const;
+        // Return (a copy of) the allocator used for memory allocation by this
+        // multimap.
+
+    const_iterator begin() const;
+    const_iterator cbegin() const;
+        // Return an iterator providing non-modifiable access to the first
+        // 'value_type' object in the ordered sequence of 'value_type' objects
+        // maintained by this multimap, or the 'end' iterator if this multimap
+        // is empty.
+
+    const_iterator end() const;
+    const_iterator cend() const;
+        // Return an iterator providing non-modifiable access to the
+        // past-the-end element in the ordered sequence of 'value_type'
+        // objects maintained by this multimap.
+
+    const_reverse_iterator rbegin() const;
+    const_reverse_iterator crbegin() const;
+        // Return a reverse iterator providing non-modifiable access to the
+        // last 'value_type' object in the ordered sequence of 'value_type'
+        // objects maintained by this multimap, or 'rend' if this multimap is
+        // empty.
+
+    const_reverse_iterator rend() const;
+    const_reverse_iterator crend() const;
+        // Return a reverse iterator providing non-modifiable access to the
+        // prior-to-the-beginning element in the ordered sequence of
+        // 'value_type' objects maintained by this multimap.
+
+    bool empty() const;
+        // Return 'true' if this multimap contains no elements, and 'false'
+        // otherwise.
+
+    size_type size() const;
+        // Return the number of elements in this multimap.
+
+    size_type max_size() const;
+        // Return a theoretical upper bound on the largest number of elements
+        // that this multimap could possibly hold.  Note that there is no
+        // guarantee that the multimap can successfully grow to the returned
+        // size, or even close to that size without running out of resources.
+
+    size_type capacity() const;
+        // Return the number of elements this multimap can hold without
+        // reallocating.
+
+    key_compare key_comp() const;
+        // Return the key-comparison functor (or function pointer) used by
+        // this multimap; if a comparator was supplied at construction, return
+        // its value, otherwise return a default constructed 'key_compare'
+        // object.
+
+    value_compare value_comp() const;
+        // Return a functor for comparing two 'value_type' objects by
+        // comparing their respective keys using 'key_comp()'.
+
+    const_iterator find(const key_type& key) const;
+        // Return an iterator providing non-modifiable access to the first
+        // 'value_type' object in this multimap having the specified 'key', if
+        // such an entry exists, and the past-the-end ('end') iterator
+        // otherwise.
+
+    size_type count(const key_type& key) const;
+        // Return the number of 'value_type' objects within this multimap
+        // having the specified 'key'.
+
+    const_iterator lower_bound(const key_type& key) const;
+        // Return an iterator providing non-modifiable access to the first
+        // (i.e., ordered least) 'value_type' object in this multimap whose key
+        // is greater-than or equal-to the specified 'key', and the
+        // past-the-end iterator if this multimap does not contain a
+        // 'value_type' object whose key is greater-than or equal-to 'key'.
+
+    const_iterator upper_bound(const key_type& key) const;
+        // Return an iterator providing non-modifiable access to the first
+        // (i.e., ordered least) 'value_type' object in this multimap whose key
+        // is greater than the specified 'key', and the past-the-end iterator
+        // if this multimap does not contain a 'value_type' object whose key is
+        // greater-than 'key'.
+
+    pair<const_iterator, const_iterator> equal_range(
+                                                    const key_type& key) const;
+        // Return a pair of iterators providing non-modifiable access to the
+        // sequence of 'value_type' objects in this multimap having the
+        // specified 'key', where the first iterator is positioned at the
+        // start of the sequence and the second iterator is positioned one
+        // past the end of the sequence.  If this multimap contains no
+        // 'value_type' objects having 'key' then the two returned iterators
+        // will have the same value.
+};
+
+// FREE OPERATORS
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+bool operator==(const flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+                const flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects have the same
+    // value, and 'false' otherwise.  Two 'flat_multimap' objects have the
+    // same value if they have the same number of key-value pairs, and each
+    // element in the ordered sequence of key-value pairs of one object has
+    // the same value as the corresponding element of the other object.  This
+    // method requires that the (template parameter) types 'KEY' and 'VALUE'
+    // both be "equality-comparable" (see {Requirements on 'KEY' and
+    // 'VALUE'}).
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+bool operator!=(const flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+                const flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects do not have the
+    // same value, and 'false' otherwise.  Two 'flat_multimap' objects do not
+    // have the same value if they do not have the same number of key-value
+    // pairs, or some element in the ordered sequence of key-value pairs of
+    // one object does not have the same value as the corresponding element
+    // of the other object.  This method requires that the (template
+    // parameter) types 'KEY' and 'VALUE' both be "equality-comparable" (see
+    // {Requirements on 'KEY' and 'VALUE'}).
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+bool operator<(const flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+               const flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the value of the specified 'lhs' multimap is
+    // lexicographically less than that of the specified 'rhs' multimap, and
+    // 'false' otherwise.  Given iterators 'i' and 'j' over the respective
+    // sequences '[lhs.begin() .. lhs.end())' and '[rhs.begin() .. rhs.end())',
+    // the value of multimap 'lhs' is lexicographically less than that of
+    // multimap 'rhs' if 'true == *i < *j' for the first pair of
+    // corresponding iterator positions where '*i' and '*j' differ, or if
+    // 'rhs.size() > lhs.size()' and '*i == *j' for every position of 'i' in
+    // '[lhs.begin() .. lhs.end())'.  This method requires that 'operator<',
+    // inducing a total order, be defined for 'value_type'.
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+bool operator>(const flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+               const flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the value of the specified 'lhs' multimap is
+    // lexicographically greater than that of the specified 'rhs' multimap, and
+    // 'false' otherwise.  This method requires that 'operator<', inducing a
+    // total order, be defined for 'value_type'.
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+bool operator<=(const flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+                const flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the value of the specified 'lhs' multimap is
+    // lexicographically less than or equal to that of the specified 'rhs'
+    // multimap, and 'false' otherwise.  This method requires that 'operator<',
+    // inducing a total order, be defined for 'value_type'.
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+bool operator>=(const flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+                const flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the value of the specified 'lhs' multimap is
+    // lexicographically greater than or equal to that of the specified 'rhs'
+    // multimap, and 'false' otherwise.  This method requires that 'operator<',
+    // inducing a total order, be defined for 'value_type'.
+
+// FREE FUNCTIONS
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+void swap(flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& a,
+          flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& b);
+    // Exchange the value and comparator of the specified 'a' object with
+    // those of the specified 'b' object.  Additionally, if
+    // 'bsl::allocator_traits<ALLOCATOR>::propagate_on_container_swap' is
+    // 'true', then exchange the allocator of 'a' with that of 'b', and do not
+    // modify either allocator otherwise.  This method provides the no-throw
+    // exception-safety guarantee and guarantees O[1] complexity.  The
+    // behavior is undefined unless either 'a' was created with the same
+    // allocator as 'b' or 'propagate_on_container_swap' is 'true'.
+
+// ============================================================================
+//                  TEMPLATE AND INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+                           // --------------------
+                           // class flat_multimap
+                           // --------------------
+
+// CREATORS
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::flat_multimap(
+                                             const COMPARATOR& comparator,
+                                             const ALLOCATOR&  basicAllocator)
+: d_tree(comparator, basicAllocator)
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::flat_multimap(
+                                               const ALLOCATOR& basicAllocator)
+: d_tree(COMPARATOR(), basicAllocator)
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::flat_multimap(
+                                                const flat_multimap& original)
+: d_tree(original.d_tree,
+         AllocatorTraits::select_on_container_copy_construction(
+                                                     original.get_allocator()))
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::flat_multimap(
+                                         const flat_multimap& original,
+                                         const ALLOCATOR&      basicAllocator)
+: d_tree(original.d_tree, basicAllocator)
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+inline
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::flat_multimap(
+                                             INPUT_ITERATOR    first,
+                                             INPUT_ITERATOR    last,
+                                             const COMPARATOR& comparator,
+                                             const ALLOCATOR&  basicAllocator)
+: d_tree(comparator, basicAllocator)
+{
+    this->insert(first, last);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::~flat_multimap()
+{
+    // All memory management is handled by the 'd_tree' member.
+}
+
+// MANIPULATORS
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>&
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::operator=(
+                                                     const flat_multimap& rhs)
+{
+    d_tree = rhs.d_tree;
+    return *this;
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::begin()
+{
+    return d_tree.begin();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::end()
+{
+    return d_tree.end();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::reverse_iterator
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::rbegin()
+{
+    return reverse_iterator(end());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::reverse_iterator
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::rend()
+{
+    return reverse_iterator(begin());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::insert(
+                                                       const value_type& value)
+{
+    const TreeIndex index = d_tree.insertMulti(value);
+    return d_tree.begin() + index;
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::insert(const_iterator,
+                                                       const value_type& value)
+{
+    const TreeIndex index = d_tree.insertMulti(value);
+    return d_tree.begin() + index;
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+void flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::insert(
+                                                          INPUT_ITERATOR first,
+                                                          INPUT_ITERATOR last)
+{
+    d_tree.insertMulti(first, last);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::erase(
+                                                       const_iterator position)
+{
+    BSLS_ASSERT(position != this->end());
+
+    const TreeIndex index = position - d_tree.begin();
+    d_tree.remove(index);
+    return d_tree.begin() + index;
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::size_type
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::erase(const key_type& key)
+{
+    const TreeIndex first = d_tree.lowerBound(key);
+    const TreeIndex last  = d_tree.upperBound(key);
+
+    d_tree.remove(first, last);
+    return last - first;
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::erase(const_iterator first,
+                                                       const_iterator last)
+{
+    const TreeIndex index = first - d_tree.begin();
+    d_tree.remove(index, last - d_tree.begin());
+    return d_tree.begin() + index;
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+void flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::swap(
+                                                         flat_multimap& other)
+{
+    d_tree.swap(other.d_tree);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+void flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::clear()
+{
+    d_tree.removeAll();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+void flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::reserve(
+                                                         size_type numElements)
+{
+    d_tree.reserve(numElements);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+void flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::shrink_to_fit()
+{
+    d_tree.shrinkToFit();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::find(const key_type& key)
+{
+    return d_tree.begin() + d_tree.find(key);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::lower_bound(
+                                                           const key_type& key)
+{
+    return d_tree.begin() + d_tree.lowerBound(key);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::upper_bound(
+                                                           const key_type& key)
+{
+    return d_tree.begin() + d_tree.upperBound(key);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bsl::pair<typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator,
+          typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator>
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::equal_range(
+                                                           const key_type& key)
+{
+    return bsl::pair<iterator, iterator>(lower_bound(key), upper_bound(key));
+}
+
+// ACCESSORS
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+ALLOCATOR
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::get_allocator() const
+{
+    return d_tree.allocator();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_iterator
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::begin() const
+{
+    return d_tree.begin();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_iterator
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::end() const
+{
+    return d_tree.end();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_reverse_iterator
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::rbegin() const
+{
+    return const_reverse_iterator(end());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_reverse_iterator
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::rend() const
+{
+    return const_reverse_iterator(begin());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_iterator
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::cbegin() const
+{
+    return begin();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_iterator
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::cend() const
+{
+    return end();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_reverse_iterator
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::crbegin() const
+{
+    return const_reverse_iterator(end());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_reverse_iterator
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::crend() const
+{
+    return const_reverse_iterator(begin());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bool flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::empty() const
+{
+    return 0 == d_tree.size();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::size_type
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::size() const
+{
+    return d_tree.size();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::size_type
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::max_size() const
+{
+    return d_tree.maxSize();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::size_type
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::capacity() const
+{
+    return d_tree.capacity();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::key_compare
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::key_comp() const
+{
+    return d_tree.comparator();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::value_compare
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::value_comp() const
+{
+    return value_compare(key_comp());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_iterator
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::find(
+                                                     const key_type& key) const
+{
+    return const_cast<flat_multimap *>(this)->find(key);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::size_type
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::count(
+                                                     const key_type& key) const
+{
+    return d_tree.upperBound(key) - d_tree.lowerBound(key);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_iterator
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::lower_bound(
+                                                     const key_type& key) const
+{
+    return d_tree.begin() + d_tree.lowerBound(key);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_iterator
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::upper_bound(
+                                                     const key_type& key) const
+{
+    return d_tree.begin() + d_tree.upperBound(key);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bsl::pair<typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::
+                                                               const_iterator,
+          typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::
+                                                               const_iterator>
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::equal_range(
+                                                     const key_type& key) const
+{
+    return bsl::pair<const_iterator, const_iterator>(lower_bound(key),
+                                                     upper_bound(key));
+}
+
+}  // close namespace bsl
+
+// FREE OPERATORS
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator==(
+           const bsl::flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+           const bsl::flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return BloombergLP::bslalg::RangeCompare::equal(lhs.begin(),
+                                                    lhs.end(),
+                                                    lhs.size(),
+                                                    rhs.begin(),
+                                                    rhs.end(),
+                                                    rhs.size());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator!=(
+           const bsl::flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+           const bsl::flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator<(
+           const bsl::flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+           const bsl::flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return 0 > BloombergLP::bslalg::RangeCompare::lexicographical(lhs.begin(),
+                                                                  lhs.end(),
+                                                                  lhs.size(),
+                                                                  rhs.begin(),
+                                                                  rhs.end(),
+                                                                  rhs.size());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator>(
+           const bsl::flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+           const bsl::flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return rhs < lhs;
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator<=(
+           const bsl::flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+           const bsl::flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return !(rhs < lhs);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator>=(
+           const bsl::flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+           const bsl::flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return !(lhs < rhs);
+}
+
+// FREE FUNCTIONS
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+void bsl::swap(bsl::flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& a,
+               bsl::flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& b)
+{
+    a.swap(b);
+}
+
+// ============================================================================
+//                                TYPE TRAITS
+// ============================================================================
+
+// Type traits for flat containers:
+//: o A flat container defines STL iterators.
+//: o A flat container uses 'bslma' allocators if the parameterized
+//:      'ALLOCATOR' is convertible from 'bslma::Allocator*'.
+
+namespace BloombergLP {
+
+namespace bslalg {
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+struct HasStlIterators<
+                     bsl::flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR> >
+     : bsl::true_type
+{};
+
+}  // close package namespace
+
+namespace bslma {
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+struct UsesBslmaAllocator<
+                     bsl::flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR> >
+     : bsl::is_convertible<Allocator*, ALLOCATOR>::type
+{};
+
+}  // close package namespace
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1731 @@
+// bslstl_flatmultimap.t.cpp                                         -*-C++-*-
+
+#include <bslstl_flatmultimap.h>
+
+#include <bslstl_string.h>
+#include <bslstl_vector.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatormonitor.h>
+#include <bsls_bsltestutil.h>
+#include <bsls_nativestd.h>
+#include <bsls_types.h>
+
+#include <bsltf_alloctesttype.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+
+using namespace BloombergLP;
+using namespace std;
+
+//=============================================================================
+//                             TEST PLAN
+//-----------------------------------------------------------------------------
+//                             Overview
+//                             --------
+// The component under test is a value-semantic container that forwards most
+// of its work to 'bslstl::FlatTree', which is tested in its own test driver.
+// Here we test each method of the standard 'multimap' interface in turn,
+// paying particular attention to the relative order of elements having
+// equivalent keys: an element is inserted after every element having an
+// equivalent key, whatever the hint, and the elements of an inserted range
+// having equivalent keys keep their order in the range, whether or not the
+// range must be sorted.  We identify each element by its mapped value, and
+// compute the expected value of a multimap by a stable sort of its elements
+// in insertion order.  We observe the memory used for sorting and merging
+// through the number of blocks allocated by a test allocator, and we use
+// 'bsltf::AllocTestType' as the mapped type, which is not bitwise-moveable,
+// to exercise the element-wise merge of a range, and to verify the
+// propagation of the allocator of the container to its elements.
+//-----------------------------------------------------------------------------
+// CREATORS
+// [ 1] explicit flat_multimap(const COMPARATOR&, const ALLOCATOR&);
+// [ 1] explicit flat_multimap(const ALLOCATOR& basicAllocator);
+// [ 8] flat_multimap(const flat_multimap& original);
+// [ 8] flat_multimap(const flat_multimap& original, basicAllocator);
+// [ 6] flat_multimap(INPUT_ITERATOR first, INPUT_ITERATOR last, ...);
+// [ 1] ~flat_multimap();
+//
+// MANIPULATORS
+// [ 8] flat_multimap& operator=(const flat_multimap& rhs);
+// [ 3] iterator begin();
+// [ 3] iterator end();
+// [ 3] reverse_iterator rbegin();
+// [ 3] reverse_iterator rend();
+// [ 2] iterator insert(const value_type& value);
+// [ 2] iterator insert(const_iterator hint, const value_type& value);
+// [ 6] void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+// [ 5] iterator erase(const_iterator position);
+// [ 5] size_type erase(const key_type& key);
+// [ 5] iterator erase(const_iterator first, const_iterator last);
+// [ 8] void swap(flat_multimap& other);
+// [ 5] void clear();
+// [ 9] void reserve(size_type numElements);
+// [ 9] void shrink_to_fit();
+// [ 4] iterator find(const key_type& key);
+// [ 4] iterator lower_bound(const key_type& key);
+// [ 4] iterator upper_bound(const key_type& key);
+// [ 4] pair<iterator, iterator> equal_range(const key_type& key);
+//
+// ACCESSORS
+// [ 8] allocator_type get_allocator() const;
+// [ 3] const_iterator begin() const;
+// [ 3] const_iterator cbegin() const;
+// [ 3] const_iterator end() const;
+// [ 3] const_iterator cend() const;
+// [ 3] const_reverse_iterator rbegin() const;
+// [ 3] const_reverse_iterator crbegin() const;
+// [ 3] const_reverse_iterator rend() const;
+// [ 3] const_reverse_iterator crend() const;
+// [ 1] bool empty() const;
+// [ 1] size_type size() const;
+// [ 9] size_type capacity() const;
+// [ 1] key_compare key_comp() const;
+// [ 1] value_compare value_comp() const;
+// [ 4] const_iterator find(const key_type& key) const;
+// [ 4] size_type count(const key_type& key) const;
+// [ 4] const_iterator lower_bound(const key_type& key) const;
+// [ 4] const_iterator upper_bound(const key_type& key) const;
+// [ 4] pair<const_iterator, const_iterator> equal_range(key) const;
+//
+// FREE OPERATORS
+// [ 8] bool operator==(const flat_multimap& lhs, const flat_multimap&);
+// [ 8] bool operator!=(const flat_multimap& lhs, const flat_multimap&);
+// [ 8] bool operator<(const flat_multimap& lhs, const flat_multimap&);
+// [ 8] bool operator>(const flat_multimap& lhs, const flat_multimap&);
+// [ 8] bool operator<=(const flat_multimap& lhs, const flat_multimap&);
+// [ 8] bool operator>=(const flat_multimap& lhs, const flat_multimap&);
+// [ 8] void swap(flat_multimap& a, flat_multimap& b);
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 2] CONCERN: An element is inserted after its equivalents
+// [ 3] CONCERN: Inserting or erasing does not move the preceding elements
+// [ 6] CONCERN: Range insertion keeps equivalent elements in order
+// [ 7] CONCERN: Merging a sorted range into the multimap
+// [ 7] CONCERN: A sorted range is inserted without a sort buffer
+// [ 7] CONCERN: Exception safety of range insertion
+// [10] USAGE EXAMPLE
+//-----------------------------------------------------------------------------
+
+//=============================================================================
+//                  STANDARD BDE ASSERT TEST MACRO
+//-----------------------------------------------------------------------------
+static int testStatus = 0;
+
+static void aSsErT(bool b, const char *s, int i) {
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+//=============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef bsl::flat_multimap<int, int>                       Obj;
+typedef bsl::flat_multimap<int, int, std::greater<int> >   GreaterObj;
+typedef bsl::flat_multimap<int, bsltf::AllocTestType>      AllocObj;
+typedef bsl::flat_multimap<bsl::string, bsl::string>       StringMultimap;
+typedef bsl::vector<Obj::value_type>                       Values;
+
+const int RUN_LENGTH = 16;
+    // length of the runs sorted by insertion sort in 'bslstl::FlatTree',
+    // above which an unsorted range is merge sorted using a temporary buffer
+
+const int INITIAL_VALUE = 100;
+    // mapped value of the first element of the initial value of an object in
+    // a table-driven test, the mapped values of the elements of an inserted
+    // range being their positions in the range
+
+namespace {
+
+const char *const LONG_STRING = "This string is long enough to allocate.";
+
+bsl::string makeKey(int value, bslma::Allocator *basicAllocator)
+    // Return a string, longer than the short-string buffer of 'bsl::string'
+    // and using the specified 'basicAllocator' to supply memory, whose order
+    // among the strings returned by this function matches the order of the
+    // specified 'value', for non-negative 'value' less than 17576.
+{
+    bsl::string result(LONG_STRING, basicAllocator);
+    result.push_back(static_cast<char>('A' + value / 676 % 26));
+    result.push_back(static_cast<char>('A' + value / 26 % 26));
+    result.push_back(static_cast<char>('A' + value % 26));
+    return result;
+}
+
+int mappedValue(int value)
+    // Return the specified 'value'.
+{
+    return value;
+}
+
+int mappedValue(const bsltf::AllocTestType& value)
+    // Return the integer held by the specified 'value'.
+{
+    return value.data();
+}
+
+template <class COMPARATOR>
+struct KeyCompare {
+    // This 'struct' defines a comparator ordering 'Obj::value_type' objects
+    // by their keys, using the (template parameter) 'COMPARATOR'.
+
+    bool operator()(const Obj::value_type& lhs,
+                    const Obj::value_type& rhs) const
+        // Return 'true' if the key of the specified 'lhs' is ordered before
+        // that of the specified 'rhs', and 'false' otherwise.
+    {
+        return COMPARATOR()(lhs.first, rhs.first);
+    }
+};
+
+template <class COMPARATOR>
+void sortStably(Values *values)
+    // Sort the specified 'values' by key, ordered by the (template parameter)
+    // 'COMPARATOR', keeping elements having equivalent keys in their relative
+    // order.  The result is the expected value of a multimap into which
+    // 'values' were inserted, in their original order.
+{
+    native_std::stable_sort(values->begin(),
+                            values->end(),
+                            KeyCompare<COMPARATOR>());
+}
+
+void appendValues(Values *values, const char *keys, int firstValue)
+    // Append to the specified 'values' an element for each character of the
+    // specified 'keys', in order, having that character as its key, and
+    // having mapped values increasing by one from the specified
+    // 'firstValue'.
+{
+    for (int i = 0; keys[i]; ++i) {
+        values->push_back(Obj::value_type(keys[i], firstValue + i));
+    }
+}
+
+void loadValues(AllocObj *object, const Values& values)
+    // Insert into the specified 'object', one at a time, an element having
+    // the key and mapped value of each of the specified 'values'.
+{
+    for (Values::size_type i = 0; i < values.size(); ++i) {
+        const bsltf::AllocTestType VALUE(values[i].second);
+
+        object->insert(AllocObj::value_type(values[i].first, VALUE));
+    }
+}
+
+template <class OBJ>
+bool hasValues(const OBJ& object, const Values& values)
+    // Return 'true' if the keys and mapped values of the elements of the
+    // specified 'object' are those of the specified 'values', in order, and
+    // 'false' otherwise.
+{
+    if (object.size() != values.size()) {
+        return false;                                                 // RETURN
+    }
+    typename OBJ::const_iterator it = object.begin();
+    for (Values::size_type i = 0; i < values.size(); ++i, ++it) {
+        if (values[i].first  != it->first
+         || values[i].second != mappedValue(it->second)) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+template <class OBJ>
+bool isValue(const OBJ& object, const char *spec)
+    // Return 'true' if the elements of the specified 'object' are, in order,
+    // those described by the specified 'spec', and 'false' otherwise.  The
+    // 'spec' holds two characters for each element: its key, and the origin
+    // of its mapped value, which is either a digit, giving the position of
+    // the element in an inserted range, or a lowercase letter, giving the
+    // position of the element in the initial value of the object ('a' for
+    // the mapped value 'INITIAL_VALUE').
+{
+    const native_std::size_t length = native_std::strlen(spec);
+
+    if (2 * object.size() != length) {
+        return false;                                                 // RETURN
+    }
+    typename OBJ::const_iterator it = object.begin();
+    for (native_std::size_t i = 0; i < length; i += 2, ++it) {
+        const char origin = spec[i + 1];
+        const int  value  = 'a' <= origin
+                          ? INITIAL_VALUE + (origin - 'a')
+                          : origin - '0';
+        if (spec[i] != it->first || value != mappedValue(it->second)) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+template <class OBJ>
+void testLookup(OBJ *object, int key, int numBefore, int numEqual)
+    // Verify that the lookup methods of the specified 'object', called both
+    // as manipulators and as accessors, place the specified 'key' after the
+    // specified 'numBefore' elements ordered before 'key', and find the
+    // specified 'numEqual' elements having 'key'.
+{
+    typedef typename OBJ::iterator       Iterator;
+    typedef typename OBJ::const_iterator ConstIterator;
+
+    OBJ& mX = *object;  const OBJ& X = mX;
+
+    const ConstIterator LOWER = X.begin() + numBefore;
+    const ConstIterator UPPER = LOWER + numEqual;
+    const ConstIterator FOUND = numEqual ? LOWER : X.end();
+
+    ASSERTV(X.size(), key, FOUND == mX.find(key));
+    ASSERTV(X.size(), key, FOUND ==  X.find(key));
+    ASSERTV(X.size(), key, numEqual == static_cast<int>(X.count(key)));
+
+    ASSERTV(X.size(), key, LOWER == mX.lower_bound(key));
+    ASSERTV(X.size(), key, LOWER ==  X.lower_bound(key));
+    ASSERTV(X.size(), key, UPPER == mX.upper_bound(key));
+    ASSERTV(X.size(), key, UPPER ==  X.upper_bound(key));
+
+    const bsl::pair<Iterator, Iterator>           R = mX.equal_range(key);
+    const bsl::pair<ConstIterator, ConstIterator> S =  X.equal_range(key);
+    ASSERTV(X.size(), key, LOWER == R.first);
+    ASSERTV(X.size(), key, UPPER == R.second);
+    ASSERTV(X.size(), key, LOWER == S.first);
+    ASSERTV(X.size(), key, UPPER == S.second);
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+    bool verbose = argc > 2;
+    bool veryVerbose = argc > 3;
+    bool veryVeryVerbose = argc > 4;
+
+    (void)veryVerbose;
+    (void)veryVeryVerbose;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVerbose);
+    bslma::DefaultAllocatorGuard defaultAllocatorGuard(&defaultAllocator);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 10: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+///Usage
+///-----
+// This section illustrates intended usage of this component.
+//
+///Example 1: Indexing Trades by Instrument
+///- - - - - - - - - - - - - - - - - - - -
+// Suppose that, at the end of each day, we receive the day's trades, in order
+// of execution, and must report the trades of each instrument in the order in
+// which they were executed.
+//
+// First, we define the trades, each mapping an instrument identifier to a
+// trade identifier:
+//..
+    typedef bsl::flat_multimap<int, int> TradeIndex;
+    typedef TradeIndex::value_type       Trade;
+
+    const Trade TRADES[] = {
+        Trade(7, 100), Trade(3, 101), Trade(7, 102), Trade(5, 103),
+        Trade(3, 104), Trade(7, 105)
+    };
+    const int NUM_TRADES = sizeof TRADES / sizeof *TRADES;
+//..
+// Then, we build the index, which stably sorts the trades once, so that the
+// trades of each instrument remain in order of execution:
+//..
+    TradeIndex index(TRADES, TRADES + NUM_TRADES);
+    ASSERT(6 == index.size());
+    ASSERT(3 == index.count(7));
+//..
+// Next, we visit the trades of instrument 7:
+//..
+    bsl::pair<TradeIndex::iterator, TradeIndex::iterator> trades =
+                                                         index.equal_range(7);
+    ASSERT(100 == trades.first->second);
+    ASSERT(102 == (++trades.first)->second);
+    ASSERT(105 == (++trades.first)->second);
+//..
+// Finally, we merge in a late batch of trades, which are placed after the
+// trades already indexed for the same instrument:
+//..
+    const Trade LATE[] = { Trade(3, 106), Trade(9, 107) };
+    index.insert(LATE, LATE + 2);
+
+    ASSERT(8   == index.size());
+    ASSERT(106 == (index.upper_bound(3) - 1)->second);
+    ASSERT(9   == index.rbegin()->first);
+//..
+      } break;
+      case 9: {
+        // --------------------------------------------------------------------
+        // CAPACITY
+        //
+        // Concerns:
+        //: 1 'reserve' provides capacity for at least the requested number of
+        //:   elements, so that inserting that many elements does not
+        //:   allocate memory.
+        //:
+        //: 2 'shrink_to_fit' reduces the capacity to the size.
+        //:
+        //: 3 Erasing elements, and 'clear', do not change the capacity.
+        //
+        // Plan:
+        //: 1 Reserve capacity in a multimap, insert that many elements one at
+        //:   a time and verify, using a test allocator monitor, that no memory
+        //:   is allocated; then call 'erase', 'shrink_to_fit', and 'clear' and
+        //:   verify 'capacity'.  (C-1..3)
+        //
+        // Testing:
+        //   void reserve(size_type numElements);
+        //   void shrink_to_fit();
+        //   size_type capacity() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCAPACITY"
+                            "\n========\n");
+
+        bslma::TestAllocator oa("object", veryVeryVerbose);
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+            ASSERT(0 == X.capacity());
+
+            mX.reserve(100);
+            ASSERT(100 <= X.capacity());
+
+            bslma::TestAllocatorMonitor oam(&oa);
+            for (int i = 0; i < 100; ++i) {
+                mX.insert(Obj::value_type(i % 25, i));
+            }
+            ASSERT(100 == X.size());
+            ASSERT(oam.isTotalSame());
+
+            mX.erase(X.begin(), X.find(15));
+            ASSERT(40  == X.size());
+            ASSERT(100 <= X.capacity());
+
+            mX.shrink_to_fit();
+            ASSERT(40 == X.capacity());
+            ASSERT(15 == X.begin()->first);
+            ASSERT(15 == X.begin()->second);
+
+            mX.clear();
+            ASSERT(X.empty());
+            ASSERT(40 == X.capacity());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 8: {
+        // --------------------------------------------------------------------
+        // COPY, ASSIGNMENT, SWAP, AND COMPARISON
+        //
+        // Concerns:
+        //: 1 A copy compares equal to the original, and it and its elements
+        //:   use the supplied allocator, or the default allocator if none is
+        //:   supplied.
+        //:
+        //: 2 Assignment gives the target the value of the source, and retains
+        //:   the allocator of the target.
+        //:
+        //: 3 Member and free 'swap' exchange the values of two multimaps
+        //:   having the same allocator without allocating memory.
+        //:
+        //: 4 Multimaps compare unequal if an element has a different mapped
+        //:   value.
+        //:
+        //: 5 The relational operators order multimaps lexicographically.
+        //
+        // Plan:
+        //: 1 Using test allocators, create multimaps of strings of various
+        //:   sizes, having several elements per key, copy, assign, and swap
+        //:   them, and verify the values, allocators, and allocations of the
+        //:   results.  (C-1..4)
+        //:
+        //: 2 Compare multimaps of integers that differ in their last element,
+        //:   or in their length, using each relational operator.  (C-5)
+        //
+        // Testing:
+        //   flat_multimap(const flat_multimap& original);
+        //   flat_multimap(const flat_multimap& original, basicAllocator);
+        //   flat_multimap& operator=(const flat_multimap& rhs);
+        //   void swap(flat_multimap& other);
+        //   allocator_type get_allocator() const;
+        //   bool operator==(const flat_multimap& lhs, const flat_multimap&);
+        //   bool operator!=(const flat_multimap& lhs, const flat_multimap&);
+        //   bool operator<(const flat_multimap& lhs, const flat_multimap&);
+        //   bool operator>(const flat_multimap& lhs, const flat_multimap&);
+        //   bool operator<=(const flat_multimap& lhs, const flat_multimap&);
+        //   bool operator>=(const flat_multimap& lhs, const flat_multimap&);
+        //   void swap(flat_multimap& a, flat_multimap& b);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCOPY, ASSIGNMENT, SWAP, AND COMPARISON"
+                            "\n======================================\n");
+
+        bslma::TestAllocator oa("object",  veryVeryVerbose);
+        bslma::TestAllocator za("other",   veryVeryVerbose);
+        bslma::TestAllocator sa("scratch", veryVeryVerbose);
+
+        static const int SIZES[] = { 0, 1, 2, 13, 60, 61, 250, 1000 };
+        const int NUM_SIZES = sizeof SIZES / sizeof *SIZES;
+
+        for (int ti = 0; ti < NUM_SIZES; ++ti) {
+            const int n = SIZES[ti];
+
+            StringMultimap mX(&oa);  const StringMultimap& X = mX;
+            for (int i = 0; i < n; ++i) {
+                mX.insert(StringMultimap::value_type(makeKey(i / 3, &sa),
+                                                     makeKey(i, &sa)));
+            }
+
+            {
+                StringMultimap mY(X);  const StringMultimap& Y = mY;
+                LOOP_ASSERT(n, X == Y);
+                LOOP_ASSERT(n, &defaultAllocator ==
+                                        Y.get_allocator().mechanism());
+            }
+            ASSERT(0 == defaultAllocator.numBlocksInUse());
+            {
+                StringMultimap mY(X, &za);  const StringMultimap& Y = mY;
+                LOOP_ASSERT(n, X == Y);
+                LOOP_ASSERT(n, &za == Y.get_allocator().mechanism());
+                for (StringMultimap::const_iterator it = Y.begin();
+                     it != Y.end();
+                     ++it) {
+                    LOOP_ASSERT(n, &za ==
+                                       it->first.get_allocator().mechanism());
+                    LOOP_ASSERT(n, &za ==
+                                      it->second.get_allocator().mechanism());
+                }
+
+                if (n) {
+                    mY.rbegin()->second = "different";
+                    LOOP_ASSERT(n, X != Y);
+                }
+            }
+            {
+                StringMultimap mY(&za);  const StringMultimap& Y = mY;
+                mY.insert(StringMultimap::value_type(makeKey(1000, &sa),
+                                                     LONG_STRING));
+                mY = X;
+                LOOP_ASSERT(n, X == Y);
+                LOOP_ASSERT(n, &za == Y.get_allocator().mechanism());
+            }
+            {
+                StringMultimap mY(&oa);  const StringMultimap& Y = mY;
+                mY.insert(StringMultimap::value_type(makeKey(1000, &sa),
+                                                     LONG_STRING));
+                const StringMultimap XX(X, &za);
+                const StringMultimap YY(Y, &za);
+
+                bslma::TestAllocatorMonitor oam(&oa);
+                mY.swap(mX);
+                LOOP_ASSERT(n, XX == Y);
+                LOOP_ASSERT(n, YY == X);
+
+                swap(mX, mY);
+                LOOP_ASSERT(n, XX == X);
+                LOOP_ASSERT(n, YY == Y);
+                LOOP_ASSERT(n, oam.isTotalSame());
+            }
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+        ASSERT(0 == za.numBlocksInUse());
+        ASSERT(0 == defaultAllocator.numBlocksInUse());
+
+        if (verbose) printf("\nTesting relational operators.\n");
+        {
+            Obj mA(&oa);  const Obj& A = mA;
+            Obj mB(&oa);  const Obj& B = mB;
+            for (int i = 0; i < 200; ++i) {
+                mA.insert(Obj::value_type(i / 2, i));
+                mB.insert(Obj::value_type(i / 2, i));
+            }
+            ASSERT(  A == B);
+            ASSERT(!(A <  B));
+            ASSERT(  A <= B);
+            ASSERT(!(A >  B));
+            ASSERT(  A >= B);
+
+            mB.rbegin()->second = 200;
+            ASSERT(  A != B);
+            ASSERT(  A <  B);
+            ASSERT(  A <= B);
+            ASSERT(!(A >  B));
+            ASSERT(!(A >= B));
+            ASSERT(  B >  A);
+
+            mB.rbegin()->second = 199;
+            mB.insert(Obj::value_type(99, 0));
+            ASSERT(  A <  B);
+            ASSERT(  B >= A);
+        }
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // BULK MERGE-INSERTION
+        //
+        // Concerns:
+        //: 1 Inserting a range whose keys precede, follow, interleave with,
+        //:   or equal the keys of the multimap inserts every element of the
+        //:   range, after the existing elements having equivalent keys, and
+        //:   keeps the elements of the range having equivalent keys in their
+        //:   order in the range, whether the range is sorted or reverse
+        //:   sorted.
+        //:
+        //: 2 A sorted range is not sorted again: inserting a sorted range
+        //:   into a multimap having sufficient capacity allocates no memory if
+        //:   its keys follow (or equal the last of) those of the multimap, and
+        //:   otherwise allocates exactly one block (the sort buffer) fewer
+        //:   than inserting the reversed range, if the range is longer than
+        //:   'RUN_LENGTH' and has distinct keys, and as many blocks otherwise.
+        //:
+        //: 3 Building a multimap from a sorted range, even one having
+        //:   duplicate keys, allocates only the vector holding the elements.
+        //:
+        //: 4 The concerns hold for elements that are not bitwise-moveable,
+        //:   which are merged by assignment, and the inserted mapped values
+        //:   use the allocator of the multimap.
+        //:
+        //: 5 If an exception is thrown while inserting a range, a multimap of
+        //:   bitwise-moveable elements retains its original value, a multimap
+        //:   of other elements either retains its original value or is left
+        //:   empty, and no memory is leaked.
+        //:
+        //: 6 The default allocator is not used.
+        //
+        // Plan:
+        //: 1 For each of a table of initial multimaps, whose keys are the even
+        //:   numbers from 100, each appearing twice, and inserted ranges,
+        //:   whose keys are in arithmetic progression, each appearing a given
+        //:   number of times, reserve capacity for the range in a copy of the
+        //:   initial multimap, insert the range, and verify the elements of
+        //:   the multimap, which are computed by a stable sort of the initial
+        //:   elements followed by those of the range, each element having its
+        //:   position in that sequence as its mapped value.  Repeat for the
+        //:   reversed range, and compare the number of blocks allocated by
+        //:   the two insertions.  (C-1..2)
+        //:
+        //: 2 Repeat P-1 for an 'AllocObj', and verify the allocator of each
+        //:   mapped value.  (C-4)
+        //:
+        //: 3 Repeat P-1 and P-2, without reserving capacity, having the object
+        //:   allocator throw on each successive allocation, and verify the
+        //:   value of the multimap after each exception.  (C-5)
+        //:
+        //: 4 Build multimaps from sorted ranges of several lengths, having
+        //:   unique or duplicate keys, and from the reversed ranges, and
+        //:   verify the elements and the number of blocks allocated.  (C-3)
+        //:
+        //: 5 Verify that no memory is in use by the object allocator after
+        //:   each test, and that the default allocator is not used.  (C-6)
+        //
+        // Testing:
+        //   CONCERN: Merging a sorted range into the multimap
+        //   CONCERN: A sorted range is inserted without a sort buffer
+        //   CONCERN: Exception safety of range insertion
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBULK MERGE-INSERTION"
+                            "\n====================\n");
+
+        typedef Obj::value_type      Value;
+        typedef AllocObj::value_type AllocValue;
+
+        bslma::TestAllocator oa("object",  veryVeryVerbose);
+        bslma::TestAllocator sa("scratch", veryVeryVerbose);
+
+        if (verbose) printf("\nMerging ranges into a multimap.\n");
+
+        static const struct {
+            int d_line;        // source line number
+            int d_numInitial;  // number of elements initially in the multimap
+            int d_numRange;    // number of elements in the inserted range
+            int d_first;       // key of the first element of the range
+            int d_step;        // difference between successive keys of the
+                               // range
+            int d_numCopies;   // number of consecutive elements of the range
+                               // having each key
+        } DATA[] = {
+            //LINE  INITIAL  RANGE  FIRST  STEP  COPIES
+            //----  -------  -----  -----  ----  ------
+            { L_,         0,     1,     5,    1,      1 },
+            { L_,         0,    40,     0,    1,      3 },
+            { L_,         0,    40,     7,    0,      1 },
+            { L_,        30,    16,    80,    1,      2 },
+            { L_,        30,    17,    80,    1,      2 },
+            { L_,        30,    20,   200,    1,      1 },
+            { L_,        30,    20,   128,    1,      2 },
+            { L_,        30,    30,   101,    2,      1 },
+            { L_,        30,    30,   100,    2,      2 },
+            { L_,        30,    60,    90,    1,      3 },
+            { L_,        30,     5,   131,    1,      1 },
+            { L_,        30,    40,   114,    0,      1 },
+            { L_,       100,   100,    50,    3,      2 },
+            { L_,         5,   300,     0,    1,      3 },
+            { L_,       300,     5,   299,   50,      1 },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int LINE    = DATA[ti].d_line;
+            const int INITIAL = DATA[ti].d_numInitial;
+            const int RANGE   = DATA[ti].d_numRange;
+            const int FIRST   = DATA[ti].d_first;
+            const int STEP    = DATA[ti].d_step;
+            const int COPIES  = DATA[ti].d_numCopies;
+
+            if (veryVerbose) {
+                T_ P_(LINE) P_(INITIAL) P_(RANGE) P_(STEP) P(COPIES)
+            }
+
+            const bool IS_APPEND = 0 == INITIAL
+                                || 100 + 2 * ((INITIAL - 1) / 2) <= FIRST;
+                // whether the keys of the range follow those of the multimap
+
+            const int NUM_SORT_BLOCKS = RUN_LENGTH < RANGE && 0 != STEP;
+                // number of blocks allocated to sort the reversed range
+
+            Values   initial(&sa);
+            Obj      mW(&sa);  const Obj&      W = mW;
+            AllocObj mZ(&sa);  const AllocObj& Z = mZ;
+            for (int i = 0; i < INITIAL; ++i) {
+                const int KEY = 100 + 2 * (i / 2);
+
+                initial.push_back(Value(KEY, i));
+                mW.insert(Value(KEY, i));
+                mZ.insert(AllocValue(KEY, bsltf::AllocTestType(i, &sa), &sa));
+            }
+
+            Values                  range(&sa);
+            bsl::vector<AllocValue> allocRange(&sa);
+            for (int i = 0; i < RANGE; ++i) {
+                const int KEY   = FIRST + i / COPIES * STEP;
+                const int VALUE = INITIAL + i;
+
+                range.push_back(Value(KEY, VALUE));
+                allocRange.push_back(
+                     AllocValue(KEY, bsltf::AllocTestType(VALUE, &sa), &sa));
+            }
+
+            Values expected(initial, &sa);
+            expected.insert(expected.end(), range.begin(), range.end());
+            sortStably<std::less<int> >(&expected);
+
+            Values reverseExpected(initial, &sa);
+            reverseExpected.insert(reverseExpected.end(),
+                                   range.rbegin(),
+                                   range.rend());
+            sortStably<std::less<int> >(&reverseExpected);
+
+            bsls::Types::Int64 numBlocks[2];  // allocated by each insertion
+
+            for (int reverse = 0; reverse < 2; ++reverse) {
+                Obj mX(W, &oa);  const Obj& X = mX;
+                mX.reserve(INITIAL + RANGE);
+
+                const bsls::Types::Int64 BLOCKS = oa.numBlocksTotal();
+                if (reverse) {
+                    mX.insert(range.rbegin(), range.rend());
+                }
+                else {
+                    mX.insert(range.begin(), range.end());
+                }
+                numBlocks[reverse] = oa.numBlocksTotal() - BLOCKS;
+
+                ASSERTV(LINE, reverse,
+                        hasValues(X, reverse ? reverseExpected : expected));
+                ASSERTV(LINE, reverse, 1 == oa.numBlocksInUse());
+            }
+            ASSERTV(LINE, numBlocks[0], !IS_APPEND || 0 == numBlocks[0]);
+            ASSERTV(LINE, numBlocks[0], numBlocks[1],
+                    numBlocks[0] + NUM_SORT_BLOCKS == numBlocks[1]);
+
+            for (int reverse = 0; reverse < 2; ++reverse) {
+                AllocObj mX(Z, &oa);  const AllocObj& X = mX;
+                mX.reserve(INITIAL + RANGE);
+
+                if (reverse) {
+                    mX.insert(allocRange.rbegin(), allocRange.rend());
+                }
+                else {
+                    mX.insert(allocRange.begin(), allocRange.end());
+                }
+                ASSERTV(LINE, reverse,
+                        hasValues(X, reverse ? reverseExpected : expected));
+
+                for (AllocObj::const_iterator it = X.begin();
+                     it != X.end();
+                     ++it) {
+                    ASSERTV(LINE, reverse, &oa == it->second.allocator());
+                }
+                ASSERTV(LINE, reverse, 1 + X.size() == oa.numBlocksInUse());
+            }
+            ASSERTV(LINE, 0 == oa.numBlocksInUse());
+
+#ifdef BDE_BUILD_TARGET_EXC
+            for (int limit = 0; ; ++limit) {
+                Obj mX(W, &oa);  const Obj& X = mX;
+
+                oa.setAllocationLimit(limit);
+                try {
+                    mX.insert(range.rbegin(), range.rend());
+                }
+                catch (const bslma::TestAllocatorException&) {
+                    oa.setAllocationLimit(-1);
+                    ASSERTV(LINE, limit, W == X);
+                    continue;
+                }
+                oa.setAllocationLimit(-1);
+                ASSERTV(LINE, limit, hasValues(X, reverseExpected));
+                break;
+            }
+            ASSERTV(LINE, 0 == oa.numBlocksInUse());
+
+            for (int limit = 0; ; ++limit) {
+                AllocObj mX(Z, &oa);  const AllocObj& X = mX;
+
+                oa.setAllocationLimit(limit);
+                try {
+                    mX.insert(allocRange.rbegin(), allocRange.rend());
+                }
+                catch (const bslma::TestAllocatorException&) {
+                    oa.setAllocationLimit(-1);
+                    ASSERTV(LINE, limit, Z == X || X.empty());
+                    continue;
+                }
+                oa.setAllocationLimit(-1);
+                ASSERTV(LINE, limit, hasValues(X, reverseExpected));
+                break;
+            }
+            ASSERTV(LINE, 0 == oa.numBlocksInUse());
+#endif
+        }
+
+        if (verbose) printf("\nBuilding a multimap from a sorted range.\n");
+        {
+            static const int LENGTHS[] = { 1, 2, RUN_LENGTH, RUN_LENGTH + 1,
+                                           100 };
+            const int NUM_LENGTHS = sizeof LENGTHS / sizeof *LENGTHS;
+
+            for (int ti = 0; ti < NUM_LENGTHS; ++ti) {
+                const int LENGTH = LENGTHS[ti];
+
+                for (int numCopies = 1; numCopies <= 2; ++numCopies) {
+                    Values range(&sa);
+                    for (int i = 0; i < LENGTH; ++i) {
+                        range.push_back(Value(i / numCopies, i));
+                    }
+
+                    Values reversed(range.rbegin(), range.rend(), &sa);
+                    sortStably<std::less<int> >(&reversed);
+
+                    bsls::Types::Int64 BLOCKS = oa.numBlocksTotal();
+                    {
+                        const Obj X(range.begin(),
+                                    range.end(),
+                                    std::less<int>(),
+                                    &oa);
+                        ASSERTV(LENGTH, numCopies, hasValues(X, range));
+                        ASSERTV(LENGTH, numCopies,
+                                1 == oa.numBlocksTotal() - BLOCKS);
+                    }
+
+                    BLOCKS = oa.numBlocksTotal();
+                    {
+                        const Obj X(range.rbegin(),
+                                    range.rend(),
+                                    std::less<int>(),
+                                    &oa);
+                        ASSERTV(LENGTH, numCopies, hasValues(X, reversed));
+                        ASSERTV(LENGTH, numCopies,
+                                1 + (RUN_LENGTH < LENGTH) ==
+                                              oa.numBlocksTotal() - BLOCKS);
+                    }
+                }
+            }
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // RANGE INSERTION AND RANGE CONSTRUCTOR
+        //
+        // Concerns:
+        //: 1 Inserting a range inserts every element of the range, after the
+        //:   existing elements having equivalent keys, and keeps the elements
+        //:   of the range having equivalent keys in their order in the range,
+        //:   whether those elements are adjacent or not, and whatever the
+        //:   order of the range.
+        //:
+        //: 2 Inserting an empty range has no effect.
+        //:
+        //: 3 The range constructor inserts the elements of the range into an
+        //:   empty multimap ordered by the supplied comparator, keeping the
+        //:   elements having equivalent keys in their order in the range, and
+        //:   uses the supplied allocator.
+        //
+        // Plan:
+        //: 1 Using a table of initial values, inserted ranges, and expected
+        //:   values, each described by a string of keys, the expected values
+        //:   also identifying the origin of the mapped value of each element,
+        //:   create a multimap having the initial value, insert the range, and
+        //:   verify the value of the multimap.  (C-1..2)
+        //:
+        //: 2 For each entry in the table having an empty initial value, build
+        //:   a multimap from the range using the range constructor, and verify
+        //:   its value and allocator.  Then build a 'GreaterObj' from the
+        //:   range, and verify its value against a stable sort of the range in
+        //:   decreasing key order.  (C-3)
+        //
+        // Testing:
+        //   flat_multimap(INPUT_ITERATOR first, INPUT_ITERATOR last, ...);
+        //   void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        //   CONCERN: Range insertion keeps equivalent elements in order
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nRANGE INSERTION AND RANGE CONSTRUCTOR"
+                            "\n=====================================\n");
+
+        bslma::TestAllocator oa("object",  veryVeryVerbose);
+        bslma::TestAllocator sa("scratch", veryVeryVerbose);
+
+        static const struct {
+            int         d_line;      // source line number
+            const char *d_initial;   // keys initially in the multimap
+            const char *d_range;     // keys of the inserted range
+            const char *d_expected;  // expected value of the multimap
+        } DATA[] = {
+            //LINE  INITIAL  RANGE     EXPECTED
+            //----  -------  --------  ------------------
+            { L_,   "",      "",       ""                 },
+            { L_,   "",      "A",      "A0"               },
+            { L_,   "",      "BA",     "A1B0"             },
+            { L_,   "",      "AA",     "A0A1"             },
+            { L_,   "",      "AAA",    "A0A1A2"           },
+            { L_,   "",      "BAB",    "A1B0B2"           },
+            { L_,   "",      "BABA",   "A1A3B0B2"         },
+            { L_,   "",      "CBACBA", "A2A5B1B4C0C3"     },
+            { L_,   "A",     "",       "Aa"               },
+            { L_,   "A",     "A",      "AaA0"             },
+            { L_,   "A",     "AA",     "AaA0A1"           },
+            { L_,   "AA",    "A",      "AaAbA0"           },
+            { L_,   "B",     "ABC",    "A0BaB1C2"         },
+            { L_,   "B",     "CBA",    "A2BaB1C0"         },
+            { L_,   "BB",    "BAB",    "A1BaBbB0B2"       },
+            { L_,   "ACE",   "ECA",    "AaA2CbC1EcE0"     },
+            { L_,   "ACE",   "FDBB",   "AaB2B3CbD1EcF0"   },
+            { L_,   "AACC",  "CBCA",   "AaAbA3B1CcCdC0C2" },
+            { L_,   "ABC",   "CC",     "AaBbCcC0C1"       },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE     = DATA[ti].d_line;
+            const char *const INITIAL  = DATA[ti].d_initial;
+            const char *const RANGE    = DATA[ti].d_range;
+            const char *const EXPECTED = DATA[ti].d_expected;
+
+            if (veryVerbose) { T_ P_(LINE) P_(INITIAL) P_(RANGE) P(EXPECTED) }
+
+            Values initial(&sa);
+            appendValues(&initial, INITIAL, INITIAL_VALUE);
+
+            Values range(&sa);
+            appendValues(&range, RANGE, 0);
+
+            {
+                Obj mX(&oa);  const Obj& X = mX;
+                for (Values::size_type i = 0; i < initial.size(); ++i) {
+                    mX.insert(initial[i]);
+                }
+
+                mX.insert(range.begin(), range.end());
+                ASSERTV(LINE, isValue(X, EXPECTED));
+            }
+
+            if ('\0' == *INITIAL) {
+                const Obj X(range.begin(), range.end(), std::less<int>(), &oa);
+                ASSERTV(LINE, isValue(X, EXPECTED));
+                ASSERTV(LINE, &oa == X.get_allocator().mechanism());
+
+                Values expected(range, &sa);
+                sortStably<std::greater<int> >(&expected);
+
+                const GreaterObj Y(range.begin(),
+                                   range.end(),
+                                   std::greater<int>(),
+                                   &oa);
+                ASSERTV(LINE, hasValues(Y, expected));
+            }
+            ASSERTV(LINE, 0 == oa.numBlocksInUse());
+        }
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // 'erase' AND 'clear'
+        //
+        // Concerns:
+        //: 1 Erasing at a position removes the element at the position, and
+        //:   returns an iterator referring to the element that followed it,
+        //:   whether the position is at the front, in the middle, or at the
+        //:   back of the multimap, or at the front, in the middle, or at the
+        //:   back of a run of elements having equivalent keys.
+        //:
+        //: 2 Erasing a key removes every element having the key and returns
+        //:   their number, or, if no element has the key, returns 0 and has
+        //:   no effect.
+        //:
+        //: 3 Erasing a range removes the elements in the range, and returns
+        //:   an iterator referring to the element that followed the range;
+        //:   erasing an empty range has no effect.
+        //:
+        //: 4 Erasing keeps the remaining elements having equivalent keys in
+        //:   their order.
+        //:
+        //: 5 'clear' removes every element.
+        //:
+        //: 6 Erasing destroys the removed elements, and does not change the
+        //:   capacity of the multimap.
+        //
+        // Plan:
+        //: 1 Using a table of positions, erase the element at each position
+        //:   of an 'AllocObj' holding 'N' elements, in runs of three having
+        //:   equivalent keys, and verify the returned iterator, the value of
+        //:   the object, and that exactly the block held by the erased mapped
+        //:   value is released.  (C-1, 4, 6)
+        //:
+        //: 2 Erase each key from one less than the first key to one more than
+        //:   the last key, and verify the returned value, the value of the
+        //:   object, and the blocks released.  (C-2, 4, 6)
+        //:
+        //: 3 Using a table of ranges, erase each range, and verify the
+        //:   returned iterator, the value of the object, and the blocks
+        //:   released.  (C-3..4, 6)
+        //:
+        //: 4 Call 'clear', and verify the value of the object, the blocks
+        //:   released, and the capacity.  (C-5..6)
+        //
+        // Testing:
+        //   iterator erase(const_iterator position);
+        //   size_type erase(const key_type& key);
+        //   iterator erase(const_iterator first, const_iterator last);
+        //   void clear();
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\n'erase' AND 'clear'"
+                            "\n===================\n");
+
+        bslma::TestAllocator oa("object",  veryVeryVerbose);
+        bslma::TestAllocator sa("scratch", veryVeryVerbose);
+
+        const int N = 12;  // number of elements initially in the object
+
+        Values initial(&sa);
+        for (int i = 0; i < N; ++i) {
+            initial.push_back(Obj::value_type(2 * (i / 3), i));
+        }
+
+        if (verbose) printf("\nErasing at a position.\n");
+        {
+            static const int POSITIONS[] = { 0, 1, 2, 3, N / 2 + 1, N - 1 };
+            const int NUM_POSITIONS = sizeof POSITIONS / sizeof *POSITIONS;
+
+            for (int ti = 0; ti < NUM_POSITIONS; ++ti) {
+                const int POSITION = POSITIONS[ti];
+
+                AllocObj mX(&oa);  const AllocObj& X = mX;
+                loadValues(&mX, initial);
+
+                const AllocObj::size_type CAPACITY = X.capacity();
+                const bsls::Types::Int64  BLOCKS   = oa.numBlocksInUse();
+
+                const AllocObj::iterator it = mX.erase(X.begin() + POSITION);
+                ASSERTV(POSITION, X.begin() + POSITION == it);
+                ASSERTV(POSITION, BLOCKS - 1 == oa.numBlocksInUse());
+                ASSERTV(POSITION, CAPACITY == X.capacity());
+
+                Values expected(initial, &sa);
+                expected.erase(expected.begin() + POSITION);
+                ASSERTV(POSITION, hasValues(X, expected));
+            }
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+
+        if (verbose) printf("\nErasing a key.\n");
+        {
+            AllocObj mX(&oa);  const AllocObj& X = mX;
+            loadValues(&mX, initial);
+
+            const AllocObj::size_type CAPACITY = X.capacity();
+
+            Values expected(initial, &sa);
+
+            for (int key = -1; key <= 2 * (N / 3); ++key) {
+                const int NUM_ERASED = 0 <= key
+                                    && key < 2 * (N / 3)
+                                    && 0 == key % 2 ? 3 : 0;
+
+                const AllocObj::size_type SIZE   = X.size();
+                const bsls::Types::Int64  BLOCKS = oa.numBlocksInUse();
+
+                ASSERTV(key, NUM_ERASED == static_cast<int>(mX.erase(key)));
+                ASSERTV(key, SIZE - NUM_ERASED == X.size());
+                ASSERTV(key, BLOCKS - NUM_ERASED == oa.numBlocksInUse());
+                ASSERTV(key, X.end() == X.find(key));
+
+                expected.erase(expected.begin(),
+                               expected.begin() + NUM_ERASED);
+                ASSERTV(key, hasValues(X, expected));
+            }
+            ASSERT(X.empty());
+            ASSERT(CAPACITY == X.capacity());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+
+        if (verbose) printf("\nErasing a range.\n");
+        {
+            static const struct {
+                int d_line;   // source line number
+                int d_first;  // position of the first erased element
+                int d_last;   // position following the last erased element
+            } DATA[] = {
+                //LINE  FIRST  LAST
+                //----  -----  -----
+                { L_,       0,     0 },
+                { L_,   N / 2, N / 2 },
+                { L_,       N,     N },
+                { L_,       0,     1 },
+                { L_,       1,     2 },
+                { L_,       0,     3 },
+                { L_,       2,     4 },
+                { L_,       0, N / 2 },
+                { L_,       1, N - 1 },
+                { L_,   N / 2,     N },
+                { L_,   N - 1,     N },
+                { L_,       0,     N },
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int LINE  = DATA[ti].d_line;
+                const int FIRST = DATA[ti].d_first;
+                const int LAST  = DATA[ti].d_last;
+
+                if (veryVerbose) { T_ P_(LINE) P_(FIRST) P(LAST) }
+
+                AllocObj mX(&oa);  const AllocObj& X = mX;
+                loadValues(&mX, initial);
+
+                const AllocObj::size_type CAPACITY = X.capacity();
+                const bsls::Types::Int64  BLOCKS   = oa.numBlocksInUse();
+
+                const AllocObj::iterator it = mX.erase(X.begin() + FIRST,
+                                                       X.begin() + LAST);
+                ASSERTV(LINE, X.begin() + FIRST == it);
+                ASSERTV(LINE, it == X.end() || LAST == it->second.data());
+                ASSERTV(LINE, BLOCKS - (LAST - FIRST) == oa.numBlocksInUse());
+                ASSERTV(LINE, CAPACITY == X.capacity());
+
+                Values expected(initial, &sa);
+                expected.erase(expected.begin() + FIRST,
+                               expected.begin() + LAST);
+                ASSERTV(LINE, hasValues(X, expected));
+            }
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+
+        if (verbose) printf("\nTesting 'clear'.\n");
+        {
+            AllocObj mX(&oa);  const AllocObj& X = mX;
+            mX.clear();
+            ASSERT(X.empty());
+            ASSERT(0 == X.capacity());
+
+            loadValues(&mX, initial);
+
+            const AllocObj::size_type   CAPACITY = X.capacity();
+            bslma::TestAllocatorMonitor oam(&oa);
+
+            mX.clear();
+            ASSERT(X.empty());
+            ASSERT(X.begin() == X.end());
+            ASSERT(1 == oa.numBlocksInUse());
+            ASSERT(oam.isTotalSame());
+            ASSERT(CAPACITY == X.capacity());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+        ASSERT(0 == defaultAllocator.numBlocksInUse());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // LOOKUP
+        //
+        // Concerns:
+        //: 1 'find' returns an iterator referring to the first element having
+        //:   the key if there is one, and 'end' otherwise, and 'count'
+        //:   returns the number of elements having the key.
+        //:
+        //: 2 'lower_bound', 'upper_bound', and 'equal_range' return the
+        //:   positions of the first element not ordered before the key, and
+        //:   of the first element ordered after the key, and so delimit the
+        //:   run of elements having the key.
+        //:
+        //: 3 The concerns hold for keys ordered before the first key, after
+        //:   the last key, and between two keys, for runs of one or more
+        //:   elements having equivalent keys, and for multimaps of every size
+        //:   around a power of two (at which the number of steps taken by a
+        //:   search changes).
+        //:
+        //: 4 The concerns hold for a user-supplied comparator.
+        //:
+        //: 5 The manipulator and accessor overloads return the same positions.
+        //
+        // Plan:
+        //: 1 For multimaps of several sizes, holding one, two, or three
+        //:   elements having each of the keys 10, 20, and so on, look up every
+        //:   multiple of 5 from 0 to 15 more than the last key, and verify the
+        //:   results of each lookup method using 'testLookup', given the
+        //:   number of elements ordered before the looked-up key, and the
+        //:   number having the key.  (C-1..3, 5)
+        //:
+        //: 2 Repeat P-1 for a 'GreaterObj'.  (C-4)
+        //
+        // Testing:
+        //   iterator find(const key_type& key);
+        //   iterator lower_bound(const key_type& key);
+        //   iterator upper_bound(const key_type& key);
+        //   pair<iterator, iterator> equal_range(const key_type& key);
+        //   const_iterator find(const key_type& key) const;
+        //   size_type count(const key_type& key) const;
+        //   const_iterator lower_bound(const key_type& key) const;
+        //   const_iterator upper_bound(const key_type& key) const;
+        //   pair<const_iterator, const_iterator> equal_range(key) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nLOOKUP"
+                            "\n======\n");
+
+        bslma::TestAllocator oa("object", veryVeryVerbose);
+
+        static const int SIZES[] = { 0, 1, 2, 3, 7, 8, 9, 16, 17, 100 };
+        const int NUM_SIZES = sizeof SIZES / sizeof *SIZES;
+
+        for (int ti = 0; ti < NUM_SIZES; ++ti) {
+            const int SIZE = SIZES[ti];  // number of distinct keys
+
+            for (int numCopies = 1; numCopies <= 3; ++numCopies) {
+                Obj        mX(&oa);
+                GreaterObj mY(&oa);
+                for (int i = 1; i <= SIZE; ++i) {
+                    for (int j = 0; j < numCopies; ++j) {
+                        mX.insert(Obj::value_type(10 * i, j));
+                        mY.insert(GreaterObj::value_type(10 * i, j));
+                    }
+                }
+
+                for (int key = 0; key <= 10 * SIZE + 15; key += 5) {
+                    const bool IS_PRESENT = 0 < key
+                                         && key <= 10 * SIZE
+                                         && 0 == key % 10;
+                    const int  NUM_EQUAL  = IS_PRESENT ? numCopies : 0;
+                    const int  NUM_LESS   =
+                           numCopies * native_std::min(SIZE, (key - 1) / 10);
+                    const int  NUM_MORE   = numCopies * SIZE
+                                          - NUM_LESS
+                                          - NUM_EQUAL;
+
+                    testLookup(&mX, key, NUM_LESS, NUM_EQUAL);
+                    testLookup(&mY, key, NUM_MORE, NUM_EQUAL);
+                }
+            }
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // ITERATORS
+        //
+        // Concerns:
+        //: 1 Each pair of iterator accessors delimits the elements of the
+        //:   multimap, in increasing key order for the forward iterators, and
+        //:   in decreasing key order for the reverse iterators, and the 'c'
+        //:   accessors return the same iterators as the others.
+        //:
+        //: 2 The iterators are random-access, and the distance from the
+        //:   beginning to the end of the multimap is its size.
+        //:
+        //: 3 The mapped values are modifiable through the non-'const'
+        //:   iterators.
+        //:
+        //: 4 Inserting or erasing an element does not move the elements
+        //:   preceding it, provided that the capacity of the multimap does not
+        //:   change.
+        //
+        // Plan:
+        //: 1 For multimaps of several sizes, built by inserting pairs of
+        //:   elements having equivalent keys in decreasing key order, iterate
+        //:   over the elements with each kind of iterator, verifying the
+        //:   elements against a stable sort of the inserted elements.
+        //:   (C-1..2)
+        //:
+        //: 2 Using the non-'const' iterators, modify the mapped values, and
+        //:   verify them.  (C-3)
+        //:
+        //: 3 In an 'AllocObj' having sufficient capacity, record the
+        //:   addresses of the elements, insert and erase elements following
+        //:   (and then at) a position, and verify the addresses and values of
+        //:   the preceding elements.  (C-4)
+        //
+        // Testing:
+        //   iterator begin();
+        //   iterator end();
+        //   reverse_iterator rbegin();
+        //   reverse_iterator rend();
+        //   const_iterator begin() const;
+        //   const_iterator cbegin() const;
+        //   const_iterator end() const;
+        //   const_iterator cend() const;
+        //   const_reverse_iterator rbegin() const;
+        //   const_reverse_iterator crbegin() const;
+        //   const_reverse_iterator rend() const;
+        //   const_reverse_iterator crend() const;
+        //   CONCERN: Inserting or erasing does not move the preceding elements
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nITERATORS"
+                            "\n=========\n");
+
+        bslma::TestAllocator oa("object",  veryVeryVerbose);
+        bslma::TestAllocator sa("scratch", veryVeryVerbose);
+
+        if (verbose) printf("\nIterating over multimaps of several sizes.\n");
+
+        static const int SIZES[] = { 0, 1, 2, 15, 16, 17, 100 };
+        const int NUM_SIZES = sizeof SIZES / sizeof *SIZES;
+
+        for (int ti = 0; ti < NUM_SIZES; ++ti) {
+            const int SIZE = SIZES[ti];
+
+            Values values(&sa);
+            for (int i = SIZE; 0 < i--; ) {
+                values.push_back(Obj::value_type(i / 2, i));
+            }
+
+            Obj mX(&oa);  const Obj& X = mX;
+            for (int i = 0; i < SIZE; ++i) {
+                mX.insert(values[i]);
+            }
+            sortStably<std::less<int> >(&values);
+
+            ASSERTV(SIZE, SIZE == X.end() - X.begin());
+            ASSERTV(SIZE, SIZE == X.rend() - X.rbegin());
+            ASSERTV(SIZE, X.begin()  == mX.begin());
+            ASSERTV(SIZE, X.end()    == mX.end());
+            ASSERTV(SIZE, X.begin()  == X.cbegin());
+            ASSERTV(SIZE, X.end()    == X.cend());
+            ASSERTV(SIZE, X.rbegin() == X.crbegin());
+            ASSERTV(SIZE, X.rend()   == X.crend());
+
+            int i = 0;
+            for (Obj::const_iterator it = X.begin(); it != X.end(); ++it) {
+                ASSERTV(SIZE, i, values[i] == *it);
+                ++i;
+            }
+            ASSERTV(SIZE, SIZE == i);
+
+            for (Obj::const_reverse_iterator it = X.rbegin(); it != X.rend();
+                                                                        ++it) {
+                --i;
+                ASSERTV(SIZE, i, values[i] == *it);
+            }
+            ASSERTV(SIZE, 0 == i);
+
+            for (Obj::const_iterator it = X.cbegin(); it != X.cend(); ++it) {
+                ASSERTV(SIZE, i, values[i] == *it);
+                ++i;
+            }
+            ASSERTV(SIZE, SIZE == i);
+
+            for (Obj::const_reverse_iterator it = X.crbegin();
+                 it != X.crend();
+                 ++it) {
+                --i;
+                ASSERTV(SIZE, i, values[i] == *it);
+            }
+            ASSERTV(SIZE, 0 == i);
+
+            for (Obj::iterator it = mX.begin(); it != mX.end(); ++it) {
+                it->second = i++;
+            }
+            for (Obj::reverse_iterator it = mX.rbegin(); it != mX.rend();
+                                                                        ++it) {
+                --i;
+                ASSERTV(SIZE, i, values[i].first == it->first);
+                ASSERTV(SIZE, i, i == it->second);
+            }
+            ASSERTV(SIZE, 0 == i);
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+
+        if (verbose) printf("\nTesting the addresses of elements.\n");
+        {
+            const int N = 8;  // number of elements initially in the object
+
+            Values initial(&sa);
+            for (int i = 0; i < N; ++i) {
+                initial.push_back(Obj::value_type(2 * (i / 2), i));
+            }
+
+            AllocObj mX(&oa);  const AllocObj& X = mX;
+            mX.reserve(2 * N);
+            loadValues(&mX, initial);
+
+            const AllocObj::value_type *ADDRESSES[N];
+            for (int i = 0; i < N; ++i) {
+                ADDRESSES[i] = &X.begin()[i];
+            }
+
+            // Insert and erase elements after, and then at, the middle.  An
+            // element having the key of the element preceding the middle is
+            // inserted after it.
+
+            const bsltf::AllocTestType VALUE(N, &sa);
+
+            mX.insert(AllocObj::value_type(2 * N, VALUE, &sa));
+            mX.insert(AllocObj::value_type(N - 2, VALUE, &sa));
+            ASSERT(3 == mX.erase(N - 2));
+            mX.erase(X.begin() + N / 2);
+            mX.insert(X.begin(), AllocObj::value_type(N / 2 - 2, VALUE, &sa));
+
+            for (int i = 0; i < N / 2; ++i) {
+                ASSERTV(i, ADDRESSES[i] == &X.begin()[i]);
+                ASSERTV(i, i == ADDRESSES[i]->second.data());
+            }
+            ASSERT(2 * N == X.capacity());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+        ASSERT(0 == defaultAllocator.numBlocksInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // 'insert'
+        //
+        // Concerns:
+        //: 1 'insert' inserts an element after every element having an
+        //:   equivalent key, and returns an iterator referring to it.
+        //:
+        //: 2 An element is inserted in order at the front, in the middle, or
+        //:   at the back of the multimap, and at the back of a run of elements
+        //:   having an equivalent key.
+        //:
+        //: 3 The hint passed to 'insert' affects only performance: the element
+        //:   is inserted after its equivalents even if the hint is the
+        //:   beginning of their run, or any other position.
+        //:
+        //: 4 Inserting an element into a multimap whose size is less than its
+        //:   capacity allocates no memory.
+        //:
+        //: 5 An inserted mapped value, and the mapped values it shifts, use
+        //:   the allocator of the multimap.
+        //:
+        //: 6 No memory is leaked, and the default allocator is not used.
+        //
+        // Plan:
+        //: 1 For each key from one less than the first key to one more than
+        //:   the last key of an object holding 'N' elements, two having each
+        //:   even key, and having capacity for one more, insert an element
+        //:   having the key, and verify the returned iterator, the value of
+        //:   the object against a stable sort of the inserted elements, and
+        //:   that no memory is allocated.  (C-1..2, 4)
+        //:
+        //: 2 Repeat P-1 using 'insert' with a hint of 'begin', of 'end', of
+        //:   the lower bound of the key, and of its upper bound.  (C-3)
+        //:
+        //: 3 Insert elements into an 'AllocObj', in decreasing order of their
+        //:   positions in the result, so that most insertions shift every
+        //:   existing element, and verify the value and allocator of every
+        //:   element.  (C-5)
+        //:
+        //: 4 Verify that no memory is in use by the object allocator at the
+        //:   end of the test, and that the default allocator is not used.
+        //:   (C-6)
+        //
+        // Testing:
+        //   iterator insert(const value_type& value);
+        //   iterator insert(const_iterator hint, const value_type& value);
+        //   CONCERN: An element is inserted after its equivalents
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\n'insert'"
+                            "\n========\n");
+
+        bslma::TestAllocator oa("object",  veryVeryVerbose);
+        bslma::TestAllocator sa("scratch", veryVeryVerbose);
+
+        const int N = 8;  // number of elements initially in the object
+
+        enum {
+            e_NO_HINT,
+            e_HINT_BEGIN,
+            e_HINT_END,
+            e_HINT_LOWER_BOUND,
+            e_HINT_UPPER_BOUND
+        };
+
+        for (int hint = e_NO_HINT; hint <= e_HINT_UPPER_BOUND; ++hint) {
+            for (int key = -1; key <= N; ++key) {
+                const Obj::value_type VALUE(key, N);
+
+                if (veryVerbose) { T_ P_(hint) P(key) }
+
+                Obj mX(&oa);  const Obj& X = mX;
+                mX.reserve(N + 1);
+
+                Values expected(&sa);
+                for (int i = 0; i < N; ++i) {
+                    const Obj::value_type ELEMENT(2 * (i / 2), i);
+
+                    mX.insert(ELEMENT);
+                    expected.push_back(ELEMENT);
+                }
+                expected.push_back(VALUE);
+                sortStably<std::less<int> >(&expected);
+
+                const int POSITION = static_cast<int>(
+                                        X.upper_bound(key) - X.begin());
+
+                bslma::TestAllocatorMonitor oam(&oa);
+
+                Obj::iterator it;
+                switch (hint) {
+                  case e_NO_HINT: {
+                    it = mX.insert(VALUE);
+                  } break;
+                  case e_HINT_BEGIN: {
+                    it = mX.insert(X.begin(), VALUE);
+                  } break;
+                  case e_HINT_END: {
+                    it = mX.insert(X.end(), VALUE);
+                  } break;
+                  case e_HINT_LOWER_BOUND: {
+                    it = mX.insert(X.lower_bound(key), VALUE);
+                  } break;
+                  default: {
+                    it = mX.insert(X.upper_bound(key), VALUE);
+                  }
+                }
+                ASSERTV(hint, key, X.begin() + POSITION == it);
+                ASSERTV(hint, key, VALUE == *it);
+                ASSERTV(hint, key, hasValues(X, expected));
+                ASSERTV(hint, key, oam.isTotalSame());
+            }
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+
+        if (verbose) printf("\nInserting out-of-line elements.\n");
+        {
+            const int NUM_ELEMENTS = 100;
+            const int NUM_KEYS     = 10;
+
+            Values expected(&sa);
+
+            AllocObj mX(&oa);  const AllocObj& X = mX;
+            for (int i = 0; i < NUM_ELEMENTS; ++i) {
+                const int                  KEY = NUM_KEYS - 1 - i % NUM_KEYS;
+                const bsltf::AllocTestType VALUE(i, &sa);
+                const AllocObj::value_type ELEMENT(KEY, VALUE, &sa);
+
+                const AllocObj::iterator it = mX.insert(ELEMENT);
+                ASSERTV(i, X.end() == it + 1 || KEY < (it + 1)->first);
+                ASSERTV(i, i == it->second.data());
+
+                expected.push_back(Obj::value_type(KEY, i));
+            }
+            sortStably<std::less<int> >(&expected);
+            ASSERT(hasValues(X, expected));
+
+            for (AllocObj::const_iterator it = X.begin();
+                 it != X.end();
+                 ++it) {
+                ASSERTV(it->first, &oa == it->second.allocator());
+            }
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+        ASSERT(0 == defaultAllocator.numBlocksInUse());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create an object, insert elements, several per key, in an order
+        //:   that shifts the elements already present, look them up, and
+        //:   iterate over them.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        //   explicit flat_multimap(const COMPARATOR&, const ALLOCATOR&);
+        //   explicit flat_multimap(const ALLOCATOR& basicAllocator);
+        //   ~flat_multimap();
+        //   iterator begin();
+        //   iterator end();
+        //   iterator find(const key_type& key);
+        //   const_iterator begin() const;
+        //   const_iterator end() const;
+        //   bool empty() const;
+        //   size_type size() const;
+        //   key_compare key_comp() const;
+        //   value_compare value_comp() const;
+        //   const_iterator find(const key_type& key) const;
+        //   size_type count(const key_type& key) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        bslma::TestAllocator oa("object", veryVeryVerbose);
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+            ASSERT(X.empty());
+            ASSERT(0 == X.size());
+            ASSERT(X.begin() == X.end());
+            ASSERT(X.end() == X.find(0));
+            ASSERT(0 == oa.numBlocksTotal());
+
+            for (int i = 0; i < 1000; ++i) {
+                const int key = (i * 7919) % 100;
+                ASSERT(key == mX.insert(Obj::value_type(key, i))->first);
+            }
+            ASSERT(1000 == X.size());
+            ASSERT(!X.empty());
+
+            int count = 0;
+            int last  = -1;
+            for (Obj::iterator it = mX.begin(); it != mX.end(); ++it) {
+                ASSERT(count / 10 == it->first);
+                ASSERT(10 == X.count(it->first));
+                if (count % 10) {
+                    ASSERT(last < it->second);  // insertion order
+                }
+                last = it->second;
+                ++count;
+            }
+            ASSERT(1000 == count);
+
+            Obj::iterator it = mX.find(25);
+            ASSERT(mX.begin() != it);
+            ASSERT(25 == it->first);
+            ASSERT(24 == (--it)->first);
+            ASSERT(X.end() == X.find(100));
+            ASSERT(0 == X.count(100));
+            ASSERT(X.key_comp()(1, 2));
+            ASSERT(X.value_comp()(Obj::value_type(1, 9),
+                                  Obj::value_type(2, 0)));
+
+            const Obj Y(std::less<int>(), &oa);
+            ASSERT(Y.empty());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
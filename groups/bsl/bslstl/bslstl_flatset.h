@@ -0,0 +1,1108 @@
+// bslstl_flatset.h                                                   -*-C++-*-
+#ifndef INCLUDED_BSLSTL_FLATSET
+#define INCLUDED_BSLSTL_FLATSET
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an ordered set of unique keys stored in a sorted vector.
+//
+//@CLASSES:
+//   bsl::flat_set: ordered set of unique keys, stored contiguously
+//
+//@SEE_ALSO: bslstl_flattree, bslstl_flatmap, bslstl_flatmultimap, bslstl_set
+//
+//@DESCRIPTION: This component defines a single class template, 'flat_set',
+// implementing an ordered container holding a collection of unique keys,
+// having an interface closely modeled on the standard 'set' [set].
+//
+// A 'bsl::set' is a red-black tree that allocates a separate node for every
+// key, so that, besides the memory spent on node links and allocator
+// overhead, a lookup follows one dependent pointer (and, typically, incurs
+// one cache miss) per level of the tree.  A 'flat_set' instead stores its
+// keys, in order, in a single 'bsl::vector' (see 'bslstl_flattree'), and
+// locates a key with a branch-free binary search over that vector.  A
+// 'flat_set' is intended for *read-mostly* data, built (or rebuilt) in bulk
+// and then searched many times; the price of its layout is that inserting or
+// erasing a single key takes time linear in the size of the set, and that
+// any insertion or erasure invalidates all iterators, pointers, and
+// references to the elements at or after the point of insertion or erasure
+// (and an insertion that grows the capacity of the set, see 'reserve',
+// invalidates all of them).
+//
+// Inserting a range of keys (including by the range constructor) appends the
+// keys to the vector, sorts them (once) if they are not already sorted, and
+// merges them with the existing keys in a single pass (see
+// {'bslstl_flattree'|Bulk Insertion}).  Consequently, building a 'flat_set'
+// from a sorted range takes linear time, and merging a sorted range into a
+// 'flat_set' takes time linear in the combined size.
+//
+// An instantiation of 'flat_set' is an allocator-aware, value-semantic type
+// whose salient attributes are its size (number of keys) and the sorted
+// sequence of keys the set contains.  If 'flat_set' is instantiated with a
+// key type that is not itself value-semantic, then it will not retain all of
+// its value-semantic qualities.  In particular, if the key type cannot be
+// tested for equality, then a 'flat_set' containing that type cannot be
+// tested for equality.
+//
+///Requirements on 'KEY'
+///---------------------
+// A 'flat_set' is a fully "Value-Semantic Type" (see {'bsldoc_glossary'})
+// only if the supplied 'KEY' template parameter is fully value-semantic.  In
+// addition, 'KEY' must be "copy-constructible" and "assignable" to insert an
+// element, must be "equality-comparable" for two 'flat_set' objects to be
+// compared using 'operator==', and must be "less-than-comparable" for two
+// 'flat_set' objects to be compared using 'operator<'.
+//
+///Memory Allocation
+///-----------------
+// The type supplied as a 'flat_set''s 'ALLOCATOR' template parameter
+// determines how that set will allocate memory.  The 'flat_set' template
+// supports allocators meeting the requirements of the C++11 standard
+// [17.6.3.5].  In addition, it supports scoped-allocators derived from the
+// 'bslma::Allocator' memory allocation protocol.  Clients intending to use
+// 'bslma' style allocators should use the template's default 'ALLOCATOR'
+// type: The default type for the 'ALLOCATOR' template parameter,
+// 'bsl::allocator', provides a C++11 standard-compatible adapter for a
+// 'bslma::Allocator' object.  Note that the temporary buffers used to sort
+// and merge a range of inserted keys are also obtained from the allocator of
+// the set.
+//
+///'bslma'-Style Allocators
+/// - - - - - - - - - - - -
+// If the (template parameter) type 'ALLOCATOR' of a 'flat_set' instantiation
+// is 'bsl::allocator', then objects of that set type will conform to the
+// standard behavior of a 'bslma'-allocator-enabled type.  Such a set accepts
+// an optional 'bslma::Allocator' argument at construction.  If the address of
+// a 'bslma::Allocator' object is explicitly supplied at construction, it will
+// be used to supply memory for the set throughout its lifetime; otherwise,
+// the set will use the default allocator installed at the time of the set's
+// construction (see 'bslma_default').  In addition to directly allocating
+// memory from the indicated 'bslma::Allocator', a set supplies that
+// allocator's address to the constructors of contained objects of the
+// (template parameter) type 'KEY', if it defines the
+// 'bslma::UsesBslmaAllocator' trait.
+//
+///Operations
+///----------
+// This section describes the run-time complexity of operations on instances
+// of 'flat_set':
+//..
+//  Legend
+//  ------
+//  'K'             - (template parameter) type 'KEY' of the set
+//  'a', 'b'        - two distinct objects of type 'flat_set<K>'
+//  'n', 'm'        - number of elements in 'a' and 'b' respectively
+//  'c'             - comparator providing an ordering for objects of type 'K'
+//  'al'            - an STL-style memory allocator
+//  'i1', 'i2'      - two iterators defining a sequence of 'K' objects
+//  'k'             - an object of type 'K'
+//  'p1', 'p2'      - two iterators belonging to 'a'
+//  distance(i1,i2) - the number of elements in the range [i1, i2)
+//
+//  +----------------------------------------------------+--------------------+
+//  | Operation                                          | Complexity         |
+//  +====================================================+====================+
+//  | flat_set<K> a;    (default construction)           | O[1]               |
+//  | flat_set<K> a(al);                                 |                    |
+//  | flat_set<K> a(c, al);                              |                    |
+//  +----------------------------------------------------+--------------------+
+//  | flat_set<K> a(b); (copy construction)              | O[n]               |
+//  | flat_set<K> a(b, al);                              |                    |
+//  +----------------------------------------------------+--------------------+
+//  | flat_set<K> a(i1, i2);                             | O[N] if [i1, i2)   |
+//  | flat_set<K> a(i1, i2, al);                         | is sorted with     |
+//  | flat_set<K> a(i1, i2, c, al);                      | 'a.value_comp()',  |
+//  |                                                    | O[N * log(N)]      |
+//  |                                                    | otherwise, where N |
+//  |                                                    | is distance(i1,i2) |
+//  +----------------------------------------------------+--------------------+
+//  | a.~flat_set<K>(); (destruction)                    | O[n]               |
+//  +----------------------------------------------------+--------------------+
+//  | a = b;          (assignment)                       | O[n + m]           |
+//  +----------------------------------------------------+--------------------+
+//  | a.begin(), a.end(), a.cbegin(), a.cend(),          | O[1]               |
+//  | a.rbegin(), a.rend(), a.crbegin(), a.crend()       |                    |
+//  +----------------------------------------------------+--------------------+
+//  | a == b, a != b                                     | O[n]               |
+//  +----------------------------------------------------+--------------------+
+//  | a < b, a <= b, a > b, a >= b                       | O[n]               |
+//  +----------------------------------------------------+--------------------+
+//  | a.swap(b), swap(a,b)                               | O[1]               |
+//  +----------------------------------------------------+--------------------+
+//  | a.size(), a.max_size(), a.empty(), get_allocator(),| O[1]               |
+//  | a.capacity()                                       |                    |
+//  +----------------------------------------------------+--------------------+
+//  | a.reserve(n), a.shrink_to_fit()                    | O[n]               |
+//  +----------------------------------------------------+--------------------+
+//  | a.insert(k)                                        | O[log(n)] if k is  |
+//  | a.insert(p1, k)                                    | present or ordered |
+//  |                                                    | after every key in |
+//  |                                                    | 'a', O[n]          |
+//  |                                                    | otherwise          |
+//  +----------------------------------------------------+--------------------+
+//  | a.insert(i1, i2)                                   | O[n + N] if        |
+//  |                                                    | [i1, i2) is sorted |
+//  |                                                    | O[n + N * log(N)]  |
+//  |                                                    | otherwise, where N |
+//  |                                                    | is distance(i1,i2) |
+//  +----------------------------------------------------+--------------------+
+//  | a.erase(p1), a.erase(k), a.erase(p1, p2)           | O[n]               |
+//  +----------------------------------------------------+--------------------+
+//  | a.clear()                                          | O[n]               |
+//  +----------------------------------------------------+--------------------+
+//  | a.key_comp(), a.value_comp()                       | O[1]               |
+//  +----------------------------------------------------+--------------------+
+//  | a.find(k), a.count(k), a.lower_bound(k),           | O[log(n)]          |
+//  | a.upper_bound(k), a.equal_range(k)                 |                    |
+//  +----------------------------------------------------+--------------------+
+//..
+//
+///Usage
+///-----
+// This section illustrates intended usage of this component.
+//
+///Example 1: Screening Identifiers Against a Daily Block List
+///- - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we must reject requests from any of a large set of blocked account
+// identifiers, which is delivered (unsorted) once a day, and amended only
+// occasionally.  Every request is screened, so lookups vastly outnumber
+// updates, and we store the identifiers in a 'flat_set'.
+//
+// First, we build the set of blocked accounts from the daily delivery, which
+// sorts the identifiers once, discarding duplicates:
+//..
+//  const int BLOCKED[] = { 3100, 1017, 9001, 2044, 1002, 3101, 5077, 1017 };
+//  const int NUM_BLOCKED = sizeof BLOCKED / sizeof *BLOCKED;
+//
+//  bsl::flat_set<int> blocked(BLOCKED, BLOCKED + NUM_BLOCKED);
+//  assert(7 == blocked.size());
+//..
+// Then, we screen some requests:
+//..
+//  assert( blocked.count(2044));
+//  assert(!blocked.count(2045));
+//  assert(blocked.end() == blocked.find(1));
+//..
+// Next, we release the memory left over from the growth of the set, and
+// merge in a (sorted) batch of additional identifiers:
+//..
+//  blocked.shrink_to_fit();
+//  assert(7 == blocked.capacity());
+//
+//  const int EXTRA[] = { 1500, 3101, 4000 };
+//  blocked.insert(EXTRA, EXTRA + 3);
+//  assert(9 == blocked.size());
+//..
+// Finally, we list the blocked accounts in a range, in order:
+//..
+//  bsl::flat_set<int>::const_iterator it = blocked.lower_bound(3000);
+//  assert(3100 == *it);
+//  assert(3101 == *++it);
+//  assert(4000 == *++it);
+//  assert(5077 == *++it);
+//..
+
+#ifndef INCLUDED_BSLSCM_VERSION
+#include <bslscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_ALLOCATOR
+#include <bslstl_allocator.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_ALLOCATORTRAITS
+#include <bslstl_allocatortraits.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_FLATTREE
+#include <bslstl_flattree.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_ITERATOR
+#include <bslstl_iterator.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_PAIR
+#include <bslstl_pair.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_UNORDEREDSETKEYCONFIGURATION
+#include <bslstl_unorderedsetkeyconfiguration.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_RANGECOMPARE
+#include <bslalg_rangecompare.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_TYPETRAITHASSTLITERATORS
+#include <bslalg_typetraithasstliterators.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_USESBSLMAALLOCATOR
+#include <bslma_usesbslmaallocator.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_FUNCTIONAL
+#include <functional>
+#define INCLUDED_FUNCTIONAL
+#endif
+
+namespace bsl {
+
+                             // ===============
+                             // class flat_set
+                             // ===============
+
+template <class KEY,
+          class COMPARATOR = std::less<KEY>,
+          class ALLOCATOR  = bsl::allocator<KEY> >
+class flat_set {
+    // This class template implements a value-semantic container type holding
+    // an ordered sequence of unique keys (of template parameter type 'KEY'),
+    // stored in a sorted vector.
+    //
+    // This class:
+    //: o supports a complete set of *value-semantic* operations
+    //:   o except for 'bdex' serialization
+    //: o is *exception-neutral*
+    //: o is *alias-safe*
+    //: o is 'const' *thread-safe*
+    // For terminology see {'bsldoc_glossary'}.
+
+    // PRIVATE TYPES
+    typedef bsl::allocator_traits<ALLOCATOR> AllocatorTraits;
+        // This typedef is an alias for the allocator traits type associated
+        // with this container.
+
+    typedef ::BloombergLP::bslstl::UnorderedSetKeyConfiguration<KEY>
+                                                             KeyConfiguration;
+        // This typedef is an alias for the policy used internally by this
+        // container to extract the 'KEY' value from the objects maintained by
+        // this set.
+
+    typedef ::BloombergLP::bslstl::FlatTree<KeyConfiguration,
+                                            COMPARATOR,
+                                            ALLOCATOR> Tree;
+        // This typedef is an alias for the template instantiation of the
+        // underlying 'bslstl::FlatTree' used to implement this set.
+
+    typedef typename Tree::SizeType TreeIndex;
+        // This typedef is an alias for the type of the indices identifying
+        // positions in the underlying tree.
+
+  public:
+    // PUBLIC TYPES
+    typedef KEY                                        key_type;
+    typedef KEY                                        value_type;
+    typedef COMPARATOR                                 key_compare;
+    typedef COMPARATOR                                 value_compare;
+    typedef ALLOCATOR                                  allocator_type;
+    typedef value_type&                                reference;
+    typedef const value_type&                          const_reference;
+
+    typedef typename AllocatorTraits::size_type        size_type;
+    typedef typename AllocatorTraits::difference_type  difference_type;
+    typedef typename AllocatorTraits::pointer          pointer;
+    typedef typename AllocatorTraits::const_pointer    const_pointer;
+
+    typedef typename Tree::ConstIterator               iterator;
+    typedef typename Tree::ConstIterator               const_iterator;
+    typedef bsl::reverse_iterator<iterator>            reverse_iterator;
+    typedef bsl::reverse_iterator<const_iterator>      const_reverse_iterator;
+
+  private:
+    // DATA
+    Tree  d_tree;  // sorted vector holding the keys of this set
+
+  public:
+    // CREATORS
+    explicit flat_set(const COMPARATOR& comparator     = COMPARATOR(),
+                      const ALLOCATOR&  basicAllocator = ALLOCATOR());
+        // Create an empty set.  Optionally specify a 'comparator' used to
+        // order keys contained in this object.  If 'comparator' is not
+        // supplied, a default-constructed object of the (template parameter)
+        // type 'COMPARATOR' is used.  Optionally specify the 'basicAllocator'
+        // used to supply memory.  If 'basicAllocator' is not supplied, a
+        // default-constructed object of the (template parameter) type
+        // 'ALLOCATOR' is used.  If the 'ALLOCATOR' is 'bsl::allocator' (the
+        // default), then 'basicAllocator' shall be convertible to
+        // 'bslma::Allocator *', and, if 'basicAllocator' is not supplied, the
+        // currently installed default allocator will be used to supply
+        // memory.  No memory is allocated.
+
+    explicit flat_set(const ALLOCATOR& basicAllocator);
+        // Create an empty set that uses the specified 'basicAllocator' to
+        // supply memory.  Use a default-constructed object of the (template
+        // parameter) type 'COMPARATOR' to order the keys contained in this
+        // set.  If the 'ALLOCATOR' is 'bsl::allocator' (the default), then
+        // 'basicAllocator' shall be convertible to 'bslma::Allocator *'.
+
+    flat_set(const flat_set& original);
+    flat_set(const flat_set& original, const ALLOCATOR& basicAllocator);
+        // Create a set having the same value and comparator as the specified
+        // 'original'.  Optionally specify the 'basicAllocator' used to supply
+        // memory.  If 'basicAllocator' is not supplied, the allocator is
+        // obtained by calling 'bsl::allocator_traits<ALLOCATOR>::
+        // select_on_container_copy_construction' on the allocator of
+        // 'original'.  If the 'ALLOCATOR' is 'bsl::allocator' (the default),
+        // then 'basicAllocator' shall be convertible to
+        // 'bslma::Allocator *'.
+
+    template <class INPUT_ITERATOR>
+    flat_set(INPUT_ITERATOR    first,
+             INPUT_ITERATOR    last,
+             const COMPARATOR& comparator     = COMPARATOR(),
+             const ALLOCATOR&  basicAllocator = ALLOCATOR());
+        // Create a set, and insert each 'value_type' object in the sequence
+        // starting at the specified 'first' element, and ending immediately
+        // before the specified 'last' element, ignoring those keys that
+        // appear earlier in the sequence.  Optionally specify a 'comparator'
+        // and 'basicAllocator' having the same meaning as for the default
+        // constructor.  If the sequence is sorted, this operation has O[N]
+        // complexity, and O[N * log(N)] complexity otherwise, where N is the
+        // number of elements between 'first' and 'last'.  The (template
+        // parameter) type 'INPUT_ITERATOR' shall meet the requirements of an
+        // input iterator defined in the C++11 standard [24.2.3] providing
+        // access to values of a type convertible to 'value_type'.  The
+        // behavior is undefined unless 'first' and 'last' refer to a sequence
+        // of valid values where 'first' is at a position at or before 'last'.
+
+    ~flat_set();
+        // Destroy this object.
+
+    // MANIPULATORS
+    flat_set& operator=(const flat_set& rhs);
+        // Assign to this object the value and comparator of the specified
+        // 'rhs' object, propagate to this object the allocator of 'rhs' if
+        // the 'ALLOCATOR' type has trait
+        // 'propagate_on_container_copy_assignment', and return a reference
+        // providing modifiable access to this object.
+
+    pair<iterator, bool> insert(const value_type& value);
+        // Insert the specified 'value' into this set if a key equivalent to
+        // 'value' does not already exist in this set; otherwise, this method
+        // has no effect.  Return a pair whose 'first' member is an iterator
+        // referring to the (possibly newly inserted) key in this set
+        // equivalent to 'value', and whose 'second' member is 'true' if a new
+        // key was inserted, and 'false' if the key was already present.  This
+        // method requires that the (template parameter) type 'KEY' be
+        // "copy-constructible" and "assignable" (see {Requirements on
+        // 'KEY'}).
+
+    iterator insert(const_iterator hint, const value_type& value);
+        // Insert the specified 'value' into this set if a key equivalent to
+        // 'value' does not already exist in this set, and return an iterator
+        // referring to the (possibly newly inserted) key in this set
+        // equivalent to 'value'.  The specified 'hint' is ignored, since the
+        // binary search it would save is dwarfed by the cost of shifting the
+        // elements that follow the insertion point.  This method requires
+        // that the (template parameter) type 'KEY' be "copy-constructible"
+        // and "assignable" (see {Requirements on 'KEY'}).
+
+    template <class INPUT_ITERATOR>
+    void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        // Insert into this set the value of each 'value_type' object in the
+        // range starting at the specified 'first' iterator and ending
+        // immediately before the specified 'last' iterator, if a key
+        // equivalent to the object is not already contained in this set, or
+        // in an earlier element of the range.  The elements of the range are
+        // sorted (if they are not already sorted) and merged with the keys of
+        // this set in a single pass, so that this operation has O[n + N]
+        // complexity if the range is sorted, and O[n + N * log(N)] complexity
+        // otherwise, where n is the size of this set and N is the number of
+        // elements in the range.  The (template parameter) type
+        // 'INPUT_ITERATOR' shall meet the requirements of an input iterator
+        // defined in the C++11 standard [24.2.3] providing access to values of
+        // a type convertible to 'value_type'.  This method requires that the
+        // (template parameter) type 'KEY' be "copy-constructible" and
+        // "assignable" (see {Requirements on 'KEY'}).  See
+        // {'bslstl_flattree'|Exception Safety} for the guarantee provided if
+        // an exception is thrown.
+
+    iterator erase(const_iterator position);
+        // Remove from this set the key at the specified 'position', and
+        // return an iterator referring to the element immediately following
+        // the removed element, or to the past-the-end position if the removed
+        // element was the last element in the sequence of elements maintained
+        // by this set.  The behavior is undefined unless 'position' refers to
+        // a key in this set.
+
+    size_type erase(const key_type& key);
+        // Remove from this set the key equivalent to the specified 'key', if
+        // it exists, and return 1; otherwise, if there is no such key, return
+        // 0 with no other effect.
+
+    iterator erase(const_iterator first, const_iterator last);
+        // Remove from this set the keys starting at the specified 'first'
+        // position up to, but not including the specified 'last' position,
+        // and return an iterator referring to the element that 'last'
+        // referred to (or the past-the-end iterator).  The behavior is
+        // undefined unless 'first' and 'last' either refer to elements in
+        // this set or are the 'end' iterator, and the 'first' position is at
+        // or before the 'last' position in the ordered sequence provided by
+        // this container.
+
+    void swap(flat_set& other);
+        // Exchange the value and comparator of this object with those of the
+        // specified 'other' object.  Additionally, if
+        // 'bsl::allocator_traits<ALLOCATOR>::propagate_on_container_swap' is
+        // 'true', then exchange the allocator of this object with that of the
+        // 'other' object, and do not modify either allocator otherwise.  This
+        // method provides the no-throw exception-safety guarantee and
+        // guarantees O[1] complexity.  The behavior is undefined unless either
+        // this object was created with the same allocator as 'other' or
+        // 'propagate_on_container_swap' is 'true'.
+
+    void clear();
+        // Remove all keys from this set.  Note that the capacity of this set
+        // is unchanged.
+
+    void reserve(size_type numElements);
+        // Change the capacity of this set such that it can hold at least the
+        // specified 'numElements' without reallocating.  Note that inserting
+        // into a set whose capacity is sufficient does not invalidate
+        // iterators, pointers, or references to the elements before the point
+        // of insertion.
+
+    void shrink_to_fit();
+        // Reduce the capacity of this set, if possible, to its size.  Note
+        // that a set built in bulk may thereby release the memory left over
+        // from the growth of its storage.
+
+    // ACCESSORS
+    allocator_type get_allocator() const;
+        // Return (a copy of) the allocator used for memory allocation by this
+        // set.
+
+    const_iterator begin() const;
+    const_iterator cbegin() const;
+        // Return an iterator providing non-modifiable access to the first key
+        // in the ordered sequence of keys maintained by this set, or the
+        // 'end' iterator if this set is empty.
+
+    const_iterator end() const;
+    const_iterator cend() const;
+        // Return an iterator providing non-modifiable access to the
+        // past-the-end element in the ordered sequence of keys maintained by
+        // this set.
+
+    const_reverse_iterator rbegin() const;
+    const_reverse_iterator crbegin() const;
+        // Return a reverse iterator providing non-modifiable access to the
+        // last key in the ordered sequence of keys maintained by this set, or
+        // 'rend' if this set is empty.
+
+    const_reverse_iterator rend() const;
+    const_reverse_iterator crend() const;
+        // Return a reverse iterator providing non-modifiable access to the
+        // prior-to-the-beginning element in the ordered sequence of keys
+        // maintained by this set.
+
+    bool empty() const;
+        // Return 'true' if this set contains no elements, and 'false'
+        // otherwise.
+
+    size_type size() const;
+        // Return the number of elements in this set.
+
+    size_type max_size() const;
+        // Return a theoretical upper bound on the largest number of elements
+        // that this set could possibly hold.  Note that there is no guarantee
+        // that the set can successfully grow to the returned size, or even
+        // close to that size without running out of resources.
+
+    size_type capacity() const;
+        // Return the number of elements this set can hold without
+        // reallocating.
+
+    key_compare key_comp() const;
+        // Return the key-comparison functor (or function pointer) used by
+        // this set; if a comparator was supplied at construction, return its
+        // value, otherwise return a default constructed 'key_compare' object.
+
+    value_compare value_comp() const;
+        // Return the key-comparison functor (or function pointer) used by
+        // this set.  Note that 'value_compare' and 'key_compare' are the same
+        // type.
+
+    const_iterator find(const key_type& key) const;
+        // Return an iterator providing non-modifiable access to the key in
+        // this set equivalent to the specified 'key', if such a key exists,
+        // and the past-the-end ('end') iterator otherwise.
+
+    size_type count(const key_type& key) const;
+        // Return the number of keys within this set equivalent to the
+        // specified 'key'.  Note that since a set maintains unique keys, the
+        // returned value will be either 0 or 1.
+
+    const_iterator lower_bound(const key_type& key) const;
+        // Return an iterator providing non-modifiable access to the first
+        // (i.e., ordered least) key in this set that is greater-than or
+        // equal-to the specified 'key', and the past-the-end iterator if this
+        // set does not contain such a key.
+
+    const_iterator upper_bound(const key_type& key) const;
+        // Return an iterator providing non-modifiable access to the first
+        // (i.e., ordered least) key in this set that is greater than the
+        // specified 'key', and the past-the-end iterator if this set does not
+        // contain such a key.
+
+    pair<const_iterator, const_iterator> equal_range(
+                                                    const key_type& key) const;
+        // Return a pair of iterators providing non-modifiable access to the
+        // sequence of keys in this set equivalent to the specified 'key',
+        // where the first iterator is positioned at the start of the sequence
+        // and the second iterator is positioned one past the end of the
+        // sequence.  If this set contains no such key then the two returned
+        // iterators will have the same value.  Note that since a set
+        // maintains unique keys, the range will contain at most one element.
+};
+
+// FREE OPERATORS
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+bool operator==(const flat_set<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                const flat_set<KEY, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects have the same
+    // value, and 'false' otherwise.  Two 'flat_set' objects have the same
+    // value if they have the same number of keys, and each key that is
+    // contained in one of the objects is also contained in the other object.
+    // This method requires that the (template parameter) type 'KEY' be
+    // "equality-comparable" (see {Requirements on 'KEY'}).
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+bool operator!=(const flat_set<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                const flat_set<KEY, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects do not have the
+    // same value, and 'false' otherwise.  Two 'flat_set' objects do not have
+    // the same value if they do not have the same number of keys, or some key
+    // that is contained in one of the objects is not also contained in the
+    // other object.  This method requires that the (template parameter) type
+    // 'KEY' be "equality-comparable" (see {Requirements on 'KEY'}).
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+bool operator<(const flat_set<KEY, COMPARATOR, ALLOCATOR>& lhs,
+               const flat_set<KEY, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the value of the specified 'lhs' set is
+    // lexicographically less than that of the specified 'rhs' set, and
+    // 'false' otherwise.  Given iterators 'i' and 'j' over the respective
+    // sequences '[lhs.begin() .. lhs.end())' and '[rhs.begin() .. rhs.end())',
+    // the value of set 'lhs' is lexicographically less than that of set 'rhs'
+    // if 'true == *i < *j' for the first pair of corresponding iterator
+    // positions where '*i' and '*j' differ, or if 'rhs.size() > lhs.size()'
+    // and '*i == *j' for every position of 'i' in
+    // '[lhs.begin() .. lhs.end())'.  This method requires that 'operator<',
+    // inducing a total order, be defined for 'value_type'.
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+bool operator>(const flat_set<KEY, COMPARATOR, ALLOCATOR>& lhs,
+               const flat_set<KEY, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the value of the specified 'lhs' set is
+    // lexicographically greater than that of the specified 'rhs' set, and
+    // 'false' otherwise.  This method requires that 'operator<', inducing a
+    // total order, be defined for 'value_type'.
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+bool operator<=(const flat_set<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                const flat_set<KEY, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the value of the specified 'lhs' set is
+    // lexicographically less than or equal to that of the specified 'rhs'
+    // set, and 'false' otherwise.  This method requires that 'operator<',
+    // inducing a total order, be defined for 'value_type'.
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+bool operator>=(const flat_set<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                const flat_set<KEY, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the value of the specified 'lhs' set is
+    // lexicographically greater than or equal to that of the specified 'rhs'
+    // set, and 'false' otherwise.  This method requires that 'operator<',
+    // inducing a total order, be defined for 'value_type'.
+
+// FREE FUNCTIONS
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+void swap(flat_set<KEY, COMPARATOR, ALLOCATOR>& a,
+          flat_set<KEY, COMPARATOR, ALLOCATOR>& b);
+    // Exchange the value and comparator of the specified 'a' object with
+    // those of the specified 'b' object.  Additionally, if
+    // 'bsl::allocator_traits<ALLOCATOR>::propagate_on_container_swap' is
+    // 'true', then exchange the allocator of 'a' with that of 'b', and do not
+    // modify either allocator otherwise.  This method provides the no-throw
+    // exception-safety guarantee and guarantees O[1] complexity.  The
+    // behavior is undefined unless either 'a' was created with the same
+    // allocator as 'b' or 'propagate_on_container_swap' is 'true'.
+
+// ============================================================================
+//                  TEMPLATE AND INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+                             // ---------------
+                             // class flat_set
+                             // ---------------
+
+// CREATORS
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+flat_set<KEY, COMPARATOR, ALLOCATOR>::flat_set(
+                                          const COMPARATOR& comparator,
+                                          const ALLOCATOR&  basicAllocator)
+: d_tree(comparator, basicAllocator)
+{
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+flat_set<KEY, COMPARATOR, ALLOCATOR>::flat_set(
+                                               const ALLOCATOR& basicAllocator)
+: d_tree(COMPARATOR(), basicAllocator)
+{
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+flat_set<KEY, COMPARATOR, ALLOCATOR>::flat_set(
+                                                     const flat_set& original)
+: d_tree(original.d_tree,
+         AllocatorTraits::select_on_container_copy_construction(
+                                                     original.get_allocator()))
+{
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+flat_set<KEY, COMPARATOR, ALLOCATOR>::flat_set(
+                                              const flat_set& original,
+                                              const ALLOCATOR& basicAllocator)
+: d_tree(original.d_tree, basicAllocator)
+{
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+inline
+flat_set<KEY, COMPARATOR, ALLOCATOR>::flat_set(
+                                          INPUT_ITERATOR    first,
+                                          INPUT_ITERATOR    last,
+                                          const COMPARATOR& comparator,
+                                          const ALLOCATOR&  basicAllocator)
+: d_tree(comparator, basicAllocator)
+{
+    this->insert(first, last);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+flat_set<KEY, COMPARATOR, ALLOCATOR>::~flat_set()
+{
+    // All memory management is handled by the 'd_tree' member.
+}
+
+// MANIPULATORS
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+flat_set<KEY, COMPARATOR, ALLOCATOR>&
+flat_set<KEY, COMPARATOR, ALLOCATOR>::operator=(const flat_set& rhs)
+{
+    d_tree = rhs.d_tree;
+    return *this;
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+bsl::pair<typename flat_set<KEY, COMPARATOR, ALLOCATOR>::iterator, bool>
+flat_set<KEY, COMPARATOR, ALLOCATOR>::insert(const value_type& value)
+{
+    const bsl::pair<TreeIndex, bool> result = d_tree.insertUnique(value);
+    return bsl::pair<iterator, bool>(d_tree.begin() + result.first,
+                                     result.second);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::iterator
+flat_set<KEY, COMPARATOR, ALLOCATOR>::insert(const_iterator,
+                                             const value_type& value)
+{
+    const TreeIndex index = d_tree.insertUnique(value).first;
+    return d_tree.begin() + index;
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+inline
+void flat_set<KEY, COMPARATOR, ALLOCATOR>::insert(INPUT_ITERATOR first,
+                                                  INPUT_ITERATOR last)
+{
+    d_tree.insertUnique(first, last);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::iterator
+flat_set<KEY, COMPARATOR, ALLOCATOR>::erase(const_iterator position)
+{
+    BSLS_ASSERT(position != this->end());
+
+    const TreeIndex index = position - d_tree.begin();
+    d_tree.remove(index);
+    return d_tree.begin() + index;
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::size_type
+flat_set<KEY, COMPARATOR, ALLOCATOR>::erase(const key_type& key)
+{
+    const TreeIndex index = d_tree.find(key);
+    if (index != d_tree.size()) {
+        d_tree.remove(index);
+        return 1;                                                     // RETURN
+    }
+    return 0;
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::iterator
+flat_set<KEY, COMPARATOR, ALLOCATOR>::erase(const_iterator first,
+                                            const_iterator last)
+{
+    const TreeIndex index = first - d_tree.begin();
+    d_tree.remove(index, last - d_tree.begin());
+    return d_tree.begin() + index;
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+void flat_set<KEY, COMPARATOR, ALLOCATOR>::swap(flat_set& other)
+{
+    d_tree.swap(other.d_tree);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+void flat_set<KEY, COMPARATOR, ALLOCATOR>::clear()
+{
+    d_tree.removeAll();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+void flat_set<KEY, COMPARATOR, ALLOCATOR>::reserve(size_type numElements)
+{
+    d_tree.reserve(numElements);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+void flat_set<KEY, COMPARATOR, ALLOCATOR>::shrink_to_fit()
+{
+    d_tree.shrinkToFit();
+}
+
+// ACCESSORS
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+ALLOCATOR flat_set<KEY, COMPARATOR, ALLOCATOR>::get_allocator() const
+{
+    return d_tree.allocator();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::const_iterator
+flat_set<KEY, COMPARATOR, ALLOCATOR>::begin() const
+{
+    return d_tree.begin();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::const_iterator
+flat_set<KEY, COMPARATOR, ALLOCATOR>::cbegin() const
+{
+    return d_tree.begin();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::const_iterator
+flat_set<KEY, COMPARATOR, ALLOCATOR>::end() const
+{
+    return d_tree.end();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::const_iterator
+flat_set<KEY, COMPARATOR, ALLOCATOR>::cend() const
+{
+    return d_tree.end();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::const_reverse_iterator
+flat_set<KEY, COMPARATOR, ALLOCATOR>::rbegin() const
+{
+    return const_reverse_iterator(end());
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::const_reverse_iterator
+flat_set<KEY, COMPARATOR, ALLOCATOR>::crbegin() const
+{
+    return const_reverse_iterator(end());
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::const_reverse_iterator
+flat_set<KEY, COMPARATOR, ALLOCATOR>::rend() const
+{
+    return const_reverse_iterator(begin());
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::const_reverse_iterator
+flat_set<KEY, COMPARATOR, ALLOCATOR>::crend() const
+{
+    return const_reverse_iterator(begin());
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+bool flat_set<KEY, COMPARATOR, ALLOCATOR>::empty() const
+{
+    return 0 == d_tree.size();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::size_type
+flat_set<KEY, COMPARATOR, ALLOCATOR>::size() const
+{
+    return d_tree.size();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::size_type
+flat_set<KEY, COMPARATOR, ALLOCATOR>::max_size() const
+{
+    return d_tree.maxSize();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::size_type
+flat_set<KEY, COMPARATOR, ALLOCATOR>::capacity() const
+{
+    return d_tree.capacity();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::key_compare
+flat_set<KEY, COMPARATOR, ALLOCATOR>::key_comp() const
+{
+    return d_tree.comparator();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::value_compare
+flat_set<KEY, COMPARATOR, ALLOCATOR>::value_comp() const
+{
+    return d_tree.comparator();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::const_iterator
+flat_set<KEY, COMPARATOR, ALLOCATOR>::find(const key_type& key) const
+{
+    return d_tree.begin() + d_tree.find(key);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::size_type
+flat_set<KEY, COMPARATOR, ALLOCATOR>::count(const key_type& key) const
+{
+    return d_tree.find(key) != d_tree.size();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::const_iterator
+flat_set<KEY, COMPARATOR, ALLOCATOR>::lower_bound(
+                                                     const key_type& key) const
+{
+    return d_tree.begin() + d_tree.lowerBound(key);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::const_iterator
+flat_set<KEY, COMPARATOR, ALLOCATOR>::upper_bound(
+                                                     const key_type& key) const
+{
+    return d_tree.begin() + d_tree.upperBound(key);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+bsl::pair<
+    typename flat_set<KEY, COMPARATOR, ALLOCATOR>::const_iterator,
+    typename flat_set<KEY, COMPARATOR, ALLOCATOR>::const_iterator>
+flat_set<KEY, COMPARATOR, ALLOCATOR>::equal_range(
+                                                     const key_type& key) const
+{
+    typedef bsl::pair<const_iterator, const_iterator> ResultType;
+
+    const_iterator first = this->find(key);
+    if (first == this->end()) {
+        first = this->lower_bound(key);
+        return ResultType(first, first);                              // RETURN
+    }
+    const_iterator next = first;
+    return ResultType(first, ++next);
+}
+
+}  // close namespace bsl
+
+// FREE OPERATORS
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator==(
+                const bsl::flat_set<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                const bsl::flat_set<KEY, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return BloombergLP::bslalg::RangeCompare::equal(lhs.begin(),
+                                                    lhs.end(),
+                                                    lhs.size(),
+                                                    rhs.begin(),
+                                                    rhs.end(),
+                                                    rhs.size());
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator!=(
+                const bsl::flat_set<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                const bsl::flat_set<KEY, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator<(
+                const bsl::flat_set<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                const bsl::flat_set<KEY, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return 0 > BloombergLP::bslalg::RangeCompare::lexicographical(lhs.begin(),
+                                                                  lhs.end(),
+                                                                  lhs.size(),
+                                                                  rhs.begin(),
+                                                                  rhs.end(),
+                                                                  rhs.size());
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator>(
+                const bsl::flat_set<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                const bsl::flat_set<KEY, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return rhs < lhs;
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator<=(
+                const bsl::flat_set<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                const bsl::flat_set<KEY, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return !(rhs < lhs);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator>=(
+                const bsl::flat_set<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                const bsl::flat_set<KEY, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return !(lhs < rhs);
+}
+
+// FREE FUNCTIONS
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+void bsl::swap(bsl::flat_set<KEY, COMPARATOR, ALLOCATOR>& a,
+               bsl::flat_set<KEY, COMPARATOR, ALLOCATOR>& b)
+{
+    a.swap(b);
+}
+
+// ============================================================================
+//                                TYPE TRAITS
+// ============================================================================
+
+// Type traits for flat containers:
+//: o A flat container defines STL iterators.
+//: o A flat container uses 'bslma' allocators if the parameterized
+//:      'ALLOCATOR' is convertible from 'bslma::Allocator*'.
+
+namespace BloombergLP {
+
+namespace bslalg {
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+struct HasStlIterators<bsl::flat_set<KEY, COMPARATOR, ALLOCATOR> >
+     : bsl::true_type
+{};
+
+}  // close package namespace
+
+namespace bslma {
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+struct UsesBslmaAllocator<bsl::flat_set<KEY, COMPARATOR, ALLOCATOR> >
+     : bsl::is_convertible<Allocator*, ALLOCATOR>::type
+{};
+
+}  // close package namespace
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
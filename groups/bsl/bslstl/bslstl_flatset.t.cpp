@@ -0,0 +1,1553 @@
+// bslstl_flatset.t.cpp                                              -*-C++-*-
+
+#include <bslstl_flatset.h>
+
+#include <bslstl_string.h>
+#include <bslstl_vector.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatormonitor.h>
+#include <bsls_bsltestutil.h>
+#include <bsls_nativestd.h>
+#include <bsls_types.h>
+
+#include <bsltf_alloctesttype.h>
+
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+
+using namespace BloombergLP;
+using namespace std;
+
+//=============================================================================
+//                             TEST PLAN
+//-----------------------------------------------------------------------------
+//                             Overview
+//                             --------
+// The component under test is a value-semantic container that forwards most
+// of its work to 'bslstl::FlatTree', which is tested in its own test driver.
+// Here we test each method of the standard 'set' interface in turn, paying
+// particular attention to the positions at which elements are inserted and
+// erased (the front, the middle, and the back of the sorted vector holding
+// them), and to the insertion of ranges: a range may hold keys that are
+// already present, or that appear more than once in the range, and a sorted
+// range is merged into the set without being sorted.  We observe the memory
+// used for sorting and merging through the number of blocks allocated by a
+// test allocator.  We use 'bsltf::AllocTestType' as the key type, which is
+// not bitwise-moveable, to exercise the element-wise merge of a range, and to
+// verify the propagation of the allocator of the container to its elements.
+//-----------------------------------------------------------------------------
+// CREATORS
+// [ 1] explicit flat_set(const COMPARATOR&, const ALLOCATOR&);
+// [ 1] explicit flat_set(const ALLOCATOR& basicAllocator);
+// [ 8] flat_set(const flat_set& original);
+// [ 8] flat_set(const flat_set& original, basicAllocator);
+// [ 6] flat_set(INPUT_ITERATOR first, INPUT_ITERATOR last, ...);
+// [ 1] ~flat_set();
+//
+// MANIPULATORS
+// [ 8] flat_set& operator=(const flat_set& rhs);
+// [ 2] pair<iterator, bool> insert(const value_type& value);
+// [ 2] iterator insert(const_iterator hint, const value_type& value);
+// [ 6] void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+// [ 5] iterator erase(const_iterator position);
+// [ 5] size_type erase(const key_type& key);
+// [ 5] iterator erase(const_iterator first, const_iterator last);
+// [ 8] void swap(flat_set& other);
+// [ 5] void clear();
+// [ 9] void reserve(size_type numElements);
+// [ 9] void shrink_to_fit();
+//
+// ACCESSORS
+// [ 8] allocator_type get_allocator() const;
+// [ 3] const_iterator begin() const;
+// [ 3] const_iterator cbegin() const;
+// [ 3] const_iterator end() const;
+// [ 3] const_iterator cend() const;
+// [ 3] const_reverse_iterator rbegin() const;
+// [ 3] const_reverse_iterator crbegin() const;
+// [ 3] const_reverse_iterator rend() const;
+// [ 3] const_reverse_iterator crend() const;
+// [ 1] bool empty() const;
+// [ 1] size_type size() const;
+// [ 9] size_type capacity() const;
+// [ 1] key_compare key_comp() const;
+// [ 1] value_compare value_comp() const;
+// [ 4] const_iterator find(const key_type& key) const;
+// [ 4] size_type count(const key_type& key) const;
+// [ 4] const_iterator lower_bound(const key_type& key) const;
+// [ 4] const_iterator upper_bound(const key_type& key) const;
+// [ 4] pair<const_iterator, const_iterator> equal_range(key) const;
+//
+// FREE OPERATORS
+// [ 8] bool operator==(const flat_set& lhs, const flat_set& rhs);
+// [ 8] bool operator!=(const flat_set& lhs, const flat_set& rhs);
+// [ 8] bool operator<(const flat_set& lhs, const flat_set& rhs);
+// [ 8] bool operator>(const flat_set& lhs, const flat_set& rhs);
+// [ 8] bool operator<=(const flat_set& lhs, const flat_set& rhs);
+// [ 8] bool operator>=(const flat_set& lhs, const flat_set& rhs);
+// [ 8] void swap(flat_set& a, flat_set& b);
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 2] CONCERN: Inserting at the front, in the middle, or at the back
+// [ 3] CONCERN: Inserting or erasing does not move the preceding elements
+// [ 6] CONCERN: Range insertion discards keys already present or repeated
+// [ 7] CONCERN: Merging a sorted range into the set
+// [ 7] CONCERN: A sorted range is inserted without a sort buffer
+// [ 7] CONCERN: Exception safety of range insertion
+// [10] USAGE EXAMPLE
+//-----------------------------------------------------------------------------
+
+//=============================================================================
+//                  STANDARD BDE ASSERT TEST MACRO
+//-----------------------------------------------------------------------------
+static int testStatus = 0;
+
+static void aSsErT(bool b, const char *s, int i) {
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+//=============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+struct AllocTestTypeLess {
+    // This 'struct' defines a comparator ordering 'bsltf::AllocTestType'
+    // objects by their values.
+
+    bool operator()(const bsltf::AllocTestType& lhs,
+                    const bsltf::AllocTestType& rhs) const
+        // Return 'true' if the value of the specified 'lhs' is less than that
+        // of the specified 'rhs', and 'false' otherwise.
+    {
+        return lhs.data() < rhs.data();
+    }
+};
+
+typedef bsl::flat_set<int>                                       Obj;
+typedef bsl::flat_set<int, std::greater<int> >                   GreaterObj;
+typedef bsl::flat_set<bsltf::AllocTestType, AllocTestTypeLess>   AllocObj;
+typedef bsl::flat_set<bsl::string>                               StringSet;
+typedef bsl::vector<int>                                         Keys;
+
+const int RUN_LENGTH = 16;
+    // length of the runs sorted by insertion sort in 'bslstl::FlatTree',
+    // above which an unsorted range is merge sorted using a temporary buffer
+
+namespace {
+
+const char *const LONG_STRING = "This string is long enough to allocate.";
+
+bsl::string makeKey(int value, bslma::Allocator *basicAllocator)
+    // Return a string, longer than the short-string buffer of 'bsl::string'
+    // and using the specified 'basicAllocator' to supply memory, whose order
+    // among the strings returned by this function matches the order of the
+    // specified 'value', for non-negative 'value' less than 17576.
+{
+    bsl::string result(LONG_STRING, basicAllocator);
+    result.push_back(static_cast<char>('A' + value / 676 % 26));
+    result.push_back(static_cast<char>('A' + value / 26 % 26));
+    result.push_back(static_cast<char>('A' + value % 26));
+    return result;
+}
+
+int keyValue(int key)
+    // Return the specified 'key'.
+{
+    return key;
+}
+
+int keyValue(const bsltf::AllocTestType& key)
+    // Return the integer held by the specified 'key'.
+{
+    return key.data();
+}
+
+void loadEvenKeys(AllocObj *object, int numElements)
+    // Insert into the specified 'object' the even keys less than twice the
+    // specified 'numElements'.
+{
+    for (int i = 0; i < numElements; ++i) {
+        object->insert(bsltf::AllocTestType(2 * i));
+    }
+}
+
+template <class OBJ>
+bool hasKeys(const OBJ& object, const Keys& keys)
+    // Return 'true' if the keys of the elements of the specified 'object' are
+    // the specified 'keys', in order, and 'false' otherwise.
+{
+    if (object.size() != keys.size()) {
+        return false;                                                 // RETURN
+    }
+    typename OBJ::const_iterator it = object.begin();
+    for (Keys::size_type i = 0; i < keys.size(); ++i, ++it) {
+        if (keys[i] != keyValue(*it)) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+template <class OBJ>
+bool isValue(const OBJ& object, const char *spec)
+    // Return 'true' if the keys of the elements of the specified 'object'
+    // are, in order, the characters of the specified 'spec', and 'false'
+    // otherwise.
+{
+    const native_std::size_t length = native_std::strlen(spec);
+
+    if (object.size() != length) {
+        return false;                                                 // RETURN
+    }
+    typename OBJ::const_iterator it = object.begin();
+    for (native_std::size_t i = 0; i < length; ++i, ++it) {
+        if (spec[i] != *it) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+template <class OBJ>
+void testLookup(const OBJ& object, int key, int numBefore, bool isPresent)
+    // Verify that the lookup methods of the specified 'object' place the
+    // specified 'key' after the specified 'numBefore' elements ordered before
+    // 'key', and find an element having 'key' if and only if the specified
+    // 'isPresent' is 'true'.
+{
+    typedef typename OBJ::const_iterator ConstIterator;
+
+    const OBJ& X = object;
+
+    const ConstIterator LOWER = X.begin() + numBefore;
+    const ConstIterator UPPER = LOWER + isPresent;
+
+    ASSERTV(X.size(), key, (isPresent ? LOWER : X.end()) == X.find(key));
+    ASSERTV(X.size(), key, static_cast<int>(isPresent) ==
+                                             static_cast<int>(X.count(key)));
+
+    ASSERTV(X.size(), key, LOWER == X.lower_bound(key));
+    ASSERTV(X.size(), key, UPPER == X.upper_bound(key));
+
+    const bsl::pair<ConstIterator, ConstIterator> R = X.equal_range(key);
+    ASSERTV(X.size(), key, LOWER == R.first);
+    ASSERTV(X.size(), key, UPPER == R.second);
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+    bool verbose = argc > 2;
+    bool veryVerbose = argc > 3;
+    bool veryVeryVerbose = argc > 4;
+
+    (void)veryVerbose;
+    (void)veryVeryVerbose;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVerbose);
+    bslma::DefaultAllocatorGuard defaultAllocatorGuard(&defaultAllocator);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 10: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+///Usage
+///-----
+// This section illustrates intended usage of this component.
+//
+///Example 1: Screening Identifiers Against a Daily Block List
+///- - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we must reject requests from any of a large set of blocked account
+// identifiers, which is delivered (unsorted) once a day, and amended only
+// occasionally.  Every request is screened, so lookups vastly outnumber
+// updates, and we store the identifiers in a 'flat_set'.
+//
+// First, we build the set of blocked accounts from the daily delivery, which
+// sorts the identifiers once, discarding duplicates:
+//..
+    const int BLOCKED[] = { 3100, 1017, 9001, 2044, 1002, 3101, 5077, 1017 };
+    const int NUM_BLOCKED = sizeof BLOCKED / sizeof *BLOCKED;
+
+    bsl::flat_set<int> blocked(BLOCKED, BLOCKED + NUM_BLOCKED);
+    ASSERT(7 == blocked.size());
+//..
+// Then, we screen some requests:
+//..
+    ASSERT( blocked.count(2044));
+    ASSERT(!blocked.count(2045));
+    ASSERT(blocked.end() == blocked.find(1));
+//..
+// Next, we release the memory left over from the growth of the set, and
+// merge in a (sorted) batch of additional identifiers:
+//..
+    blocked.shrink_to_fit();
+    ASSERT(7 == blocked.capacity());
+
+    const int EXTRA[] = { 1500, 3101, 4000 };
+    blocked.insert(EXTRA, EXTRA + 3);
+    ASSERT(9 == blocked.size());
+//..
+// Finally, we list the blocked accounts in a range, in order:
+//..
+    bsl::flat_set<int>::const_iterator it = blocked.lower_bound(3000);
+    ASSERT(3100 == *it);
+    ASSERT(3101 == *++it);
+    ASSERT(4000 == *++it);
+    ASSERT(5077 == *++it);
+//..
+      } break;
+      case 9: {
+        // --------------------------------------------------------------------
+        // CAPACITY
+        //
+        // Concerns:
+        //: 1 'reserve' provides capacity for at least the requested number of
+        //:   elements, so that inserting that many elements does not
+        //:   allocate memory.
+        //:
+        //: 2 'shrink_to_fit' reduces the capacity to the size.
+        //:
+        //: 3 Erasing elements, and 'clear', do not change the capacity.
+        //
+        // Plan:
+        //: 1 Reserve capacity in a set, insert that many keys one at a time
+        //:   and verify, using a test allocator monitor, that no memory is
+        //:   allocated; then call 'erase', 'shrink_to_fit', and 'clear' and
+        //:   verify 'capacity'.  (C-1..3)
+        //
+        // Testing:
+        //   void reserve(size_type numElements);
+        //   void shrink_to_fit();
+        //   size_type capacity() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCAPACITY"
+                            "\n========\n");
+
+        bslma::TestAllocator oa("object", veryVeryVerbose);
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+            ASSERT(0 == X.capacity());
+
+            mX.reserve(100);
+            ASSERT(100 <= X.capacity());
+
+            bslma::TestAllocatorMonitor oam(&oa);
+            for (int i = 0; i < 100; ++i) {
+                ASSERT(mX.insert((i * 37) % 100).second);
+            }
+            ASSERT(100 == X.size());
+            ASSERT(oam.isTotalSame());
+
+            mX.erase(X.begin(), X.find(60));
+            ASSERT(40  == X.size());
+            ASSERT(100 <= X.capacity());
+
+            mX.shrink_to_fit();
+            ASSERT(40 == X.capacity());
+            ASSERT(60 == *X.begin());
+
+            mX.clear();
+            ASSERT(X.empty());
+            ASSERT(40 == X.capacity());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 8: {
+        // --------------------------------------------------------------------
+        // COPY, ASSIGNMENT, SWAP, AND COMPARISON
+        //
+        // Concerns:
+        //: 1 A copy compares equal to the original, and it and its elements
+        //:   use the supplied allocator, or the default allocator if none is
+        //:   supplied.
+        //:
+        //: 2 Assignment gives the target the value of the source, and retains
+        //:   the allocator of the target.
+        //:
+        //: 3 Member and free 'swap' exchange the values of two sets having
+        //:   the same allocator without allocating memory.
+        //:
+        //: 4 The relational operators order sets lexicographically.
+        //
+        // Plan:
+        //: 1 Using test allocators, create sets of strings of various sizes,
+        //:   copy, assign, and swap them, and verify the values, allocators,
+        //:   and allocations of the results.  (C-1..3)
+        //:
+        //: 2 Compare sets of integers that differ in their last element, or
+        //:   in their length, using each relational operator.  (C-4)
+        //
+        // Testing:
+        //   flat_set(const flat_set& original);
+        //   flat_set(const flat_set& original, basicAllocator);
+        //   flat_set& operator=(const flat_set& rhs);
+        //   void swap(flat_set& other);
+        //   allocator_type get_allocator() const;
+        //   bool operator==(const flat_set& lhs, const flat_set& rhs);
+        //   bool operator!=(const flat_set& lhs, const flat_set& rhs);
+        //   bool operator<(const flat_set& lhs, const flat_set& rhs);
+        //   bool operator>(const flat_set& lhs, const flat_set& rhs);
+        //   bool operator<=(const flat_set& lhs, const flat_set& rhs);
+        //   bool operator>=(const flat_set& lhs, const flat_set& rhs);
+        //   void swap(flat_set& a, flat_set& b);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCOPY, ASSIGNMENT, SWAP, AND COMPARISON"
+                            "\n======================================\n");
+
+        bslma::TestAllocator oa("object",  veryVeryVerbose);
+        bslma::TestAllocator za("other",   veryVeryVerbose);
+        bslma::TestAllocator sa("scratch", veryVeryVerbose);
+
+        static const int SIZES[] = { 0, 1, 2, 13, 60, 61, 250, 1000 };
+        const int NUM_SIZES = sizeof SIZES / sizeof *SIZES;
+
+        for (int ti = 0; ti < NUM_SIZES; ++ti) {
+            const int n = SIZES[ti];
+
+            StringSet mX(&oa);  const StringSet& X = mX;
+            for (int i = 0; i < n; ++i) {
+                mX.insert(makeKey(i, &sa));
+            }
+
+            {
+                StringSet mY(X);  const StringSet& Y = mY;
+                LOOP_ASSERT(n, X == Y);
+                LOOP_ASSERT(n, &defaultAllocator ==
+                                        Y.get_allocator().mechanism());
+            }
+            ASSERT(0 == defaultAllocator.numBlocksInUse());
+            {
+                StringSet mY(X, &za);  const StringSet& Y = mY;
+                LOOP_ASSERT(n, X == Y);
+                LOOP_ASSERT(n, &za == Y.get_allocator().mechanism());
+                for (StringSet::const_iterator it = Y.begin();
+                     it != Y.end();
+                     ++it) {
+                    LOOP_ASSERT(n, &za == it->get_allocator().mechanism());
+                }
+
+                if (n) {
+                    mY.erase(Y.end() - 1);
+                    LOOP_ASSERT(n, X != Y);
+                }
+            }
+            {
+                StringSet mY(&za);  const StringSet& Y = mY;
+                mY.insert(makeKey(1000, &sa));
+                mY = X;
+                LOOP_ASSERT(n, X == Y);
+                LOOP_ASSERT(n, &za == Y.get_allocator().mechanism());
+            }
+            {
+                StringSet mY(&oa);  const StringSet& Y = mY;
+                mY.insert(makeKey(1000, &sa));
+                const StringSet XX(X, &za);
+                const StringSet YY(Y, &za);
+
+                bslma::TestAllocatorMonitor oam(&oa);
+                mY.swap(mX);
+                LOOP_ASSERT(n, XX == Y);
+                LOOP_ASSERT(n, YY == X);
+
+                swap(mX, mY);
+                LOOP_ASSERT(n, XX == X);
+                LOOP_ASSERT(n, YY == Y);
+                LOOP_ASSERT(n, oam.isTotalSame());
+            }
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+        ASSERT(0 == za.numBlocksInUse());
+        ASSERT(0 == defaultAllocator.numBlocksInUse());
+
+        if (verbose) printf("\nTesting relational operators.\n");
+        {
+            Obj mA(&oa);  const Obj& A = mA;
+            Obj mB(&oa);  const Obj& B = mB;
+            for (int i = 0; i < 200; ++i) {
+                mA.insert(i);
+                mB.insert(i);
+            }
+            ASSERT(  A == B);
+            ASSERT(!(A <  B));
+            ASSERT(  A <= B);
+            ASSERT(!(A >  B));
+            ASSERT(  A >= B);
+
+            mB.erase(199);
+            mB.insert(200);
+            ASSERT(  A != B);
+            ASSERT(  A <  B);
+            ASSERT(  A <= B);
+            ASSERT(!(A >  B));
+            ASSERT(!(A >= B));
+            ASSERT(  B >  A);
+
+            mB.erase(200);
+            mB.insert(199);
+            mB.insert(200);
+            ASSERT(  A <  B);
+            ASSERT(  B >= A);
+        }
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // BULK MERGE-INSERTION
+        //
+        // Concerns:
+        //: 1 Inserting a range whose keys precede, follow, interleave with,
+        //:   or overlap the keys of the set inserts each key of the range that
+        //:   is not already present, whether the range is sorted or reverse
+        //:   sorted.
+        //:
+        //: 2 A sorted range is not sorted again: inserting a sorted range
+        //:   into a set having sufficient capacity allocates no memory if its
+        //:   keys follow those of the set, and otherwise allocates exactly one
+        //:   block (the sort buffer) fewer than inserting the reversed range,
+        //:   if the range is longer than 'RUN_LENGTH', and as many blocks
+        //:   otherwise.
+        //:
+        //: 3 Building a set from a sorted range, even one having duplicate
+        //:   keys, allocates only the vector holding the elements.
+        //:
+        //: 4 The concerns hold for elements that are not bitwise-moveable,
+        //:   which are merged by assignment, and the inserted keys use the
+        //:   allocator of the set.
+        //:
+        //: 5 If an exception is thrown while inserting a range, a set of
+        //:   bitwise-moveable elements retains its original value, a set of
+        //:   other elements either retains its original value or is left
+        //:   empty, and no memory is leaked.
+        //:
+        //: 6 The default allocator is not used.
+        //
+        // Plan:
+        //: 1 For each of a table of initial sets, whose keys are the even
+        //:   numbers from 100, and inserted ranges, whose keys are in
+        //:   arithmetic progression, reserve capacity for the range in a copy
+        //:   of the initial set, insert the range, and verify the keys of the
+        //:   set, which are computed by marking the keys of the initial set
+        //:   and of the range.  Repeat for the reversed range, and compare the
+        //:   number of blocks allocated by the two insertions.  (C-1..2)
+        //:
+        //: 2 Repeat P-1 for an 'AllocObj', and verify the allocator of each
+        //:   key.  (C-4)
+        //:
+        //: 3 Repeat P-1 and P-2, without reserving capacity, having the object
+        //:   allocator throw on each successive allocation, and verify the
+        //:   value of the set after each exception.  (C-5)
+        //:
+        //: 4 Build sets from sorted ranges of several lengths, having unique
+        //:   or duplicate keys, and from the reversed ranges, and verify the
+        //:   number of blocks allocated.  (C-3)
+        //:
+        //: 5 Verify that no memory is in use by the object allocator after
+        //:   each test, and that the default allocator is not used.  (C-6)
+        //
+        // Testing:
+        //   CONCERN: Merging a sorted range into the set
+        //   CONCERN: A sorted range is inserted without a sort buffer
+        //   CONCERN: Exception safety of range insertion
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBULK MERGE-INSERTION"
+                            "\n====================\n");
+
+        bslma::TestAllocator oa("object",  veryVeryVerbose);
+        bslma::TestAllocator sa("scratch", veryVeryVerbose);
+
+        if (verbose) printf("\nMerging ranges into a set.\n");
+
+        static const struct {
+            int d_line;        // source line number
+            int d_numInitial;  // number of keys initially in the set
+            int d_numRange;    // number of elements in the inserted range
+            int d_first;       // first key of the range
+            int d_step;        // difference between successive keys of the
+                               // range
+        } DATA[] = {
+            //LINE  INITIAL  RANGE  FIRST  STEP
+            //----  -------  -----  -----  ----
+            { L_,         0,     1,     5,    1 },
+            { L_,         0,    40,     0,    1 },
+            { L_,         0,    40,     7,    0 },
+            { L_,        30,    16,    80,    1 },
+            { L_,        30,    17,    80,    1 },
+            { L_,        30,    20,   200,    1 },
+            { L_,        30,    20,   158,    1 },
+            { L_,        30,    30,   101,    2 },
+            { L_,        30,    30,   100,    2 },
+            { L_,        30,    60,    90,    1 },
+            { L_,        30,     5,   131,    1 },
+            { L_,        30,    40,   131,    0 },
+            { L_,       100,   100,    50,    3 },
+            { L_,         5,   300,     0,    1 },
+            { L_,       300,     5,   299,   50 },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        const int MAX_KEY = 1000;  // keys in 'DATA' are less than 'MAX_KEY'
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int LINE    = DATA[ti].d_line;
+            const int INITIAL = DATA[ti].d_numInitial;
+            const int RANGE   = DATA[ti].d_numRange;
+            const int FIRST   = DATA[ti].d_first;
+            const int STEP    = DATA[ti].d_step;
+
+            if (veryVerbose) { T_ P_(LINE) P_(INITIAL) P_(RANGE) P(STEP) }
+
+            const bool IS_APPEND = 0 == INITIAL
+                                || 100 + 2 * (INITIAL - 1) <= FIRST;
+                // whether the keys of the range follow those of the set
+
+            const int NUM_SORT_BLOCKS = RUN_LENGTH < RANGE && 0 != STEP;
+                // number of blocks allocated to sort the reversed range
+
+            bsl::vector<int> isMarked(MAX_KEY, 0, &sa);
+            Obj              mW(&sa);  const Obj&      W = mW;
+            AllocObj         mZ(&sa);  const AllocObj& Z = mZ;
+            for (int i = 0; i < INITIAL; ++i) {
+                const int KEY = 100 + 2 * i;
+
+                isMarked[KEY] = 1;
+                mW.insert(KEY);
+                mZ.insert(bsltf::AllocTestType(KEY, &sa));
+            }
+
+            Keys                              range(&sa);
+            bsl::vector<bsltf::AllocTestType> allocRange(&sa);
+            for (int i = 0; i < RANGE; ++i) {
+                const int KEY = FIRST + i * STEP;
+
+                isMarked[KEY] = 1;
+                range.push_back(KEY);
+                allocRange.push_back(bsltf::AllocTestType(KEY, &sa));
+            }
+
+            Keys expected(&sa);
+            for (int key = 0; key < MAX_KEY; ++key) {
+                if (isMarked[key]) {
+                    expected.push_back(key);
+                }
+            }
+
+            bsls::Types::Int64 numBlocks[2];  // allocated by each insertion
+
+            for (int reverse = 0; reverse < 2; ++reverse) {
+                Obj mX(W, &oa);  const Obj& X = mX;
+                mX.reserve(INITIAL + RANGE);
+
+                const bsls::Types::Int64 BLOCKS = oa.numBlocksTotal();
+                if (reverse) {
+                    mX.insert(range.rbegin(), range.rend());
+                }
+                else {
+                    mX.insert(range.begin(), range.end());
+                }
+                numBlocks[reverse] = oa.numBlocksTotal() - BLOCKS;
+
+                ASSERTV(LINE, reverse, hasKeys(X, expected));
+                ASSERTV(LINE, reverse, 1 == oa.numBlocksInUse());
+            }
+            ASSERTV(LINE, numBlocks[0], !IS_APPEND || 0 == numBlocks[0]);
+            ASSERTV(LINE, numBlocks[0], numBlocks[1],
+                    numBlocks[0] + NUM_SORT_BLOCKS == numBlocks[1]);
+
+            for (int reverse = 0; reverse < 2; ++reverse) {
+                AllocObj mX(Z, &oa);  const AllocObj& X = mX;
+                mX.reserve(INITIAL + RANGE);
+
+                if (reverse) {
+                    mX.insert(allocRange.rbegin(), allocRange.rend());
+                }
+                else {
+                    mX.insert(allocRange.begin(), allocRange.end());
+                }
+                ASSERTV(LINE, reverse, hasKeys(X, expected));
+
+                for (AllocObj::const_iterator it = X.begin();
+                     it != X.end();
+                     ++it) {
+                    ASSERTV(LINE, reverse, &oa == it->allocator());
+                }
+                ASSERTV(LINE, reverse, 1 + X.size() == oa.numBlocksInUse());
+            }
+            ASSERTV(LINE, 0 == oa.numBlocksInUse());
+
+#ifdef BDE_BUILD_TARGET_EXC
+            for (int limit = 0; ; ++limit) {
+                Obj mX(W, &oa);  const Obj& X = mX;
+
+                oa.setAllocationLimit(limit);
+                try {
+                    mX.insert(range.rbegin(), range.rend());
+                }
+                catch (const bslma::TestAllocatorException&) {
+                    oa.setAllocationLimit(-1);
+                    ASSERTV(LINE, limit, W == X);
+                    continue;
+                }
+                oa.setAllocationLimit(-1);
+                ASSERTV(LINE, limit, hasKeys(X, expected));
+                break;
+            }
+            ASSERTV(LINE, 0 == oa.numBlocksInUse());
+
+            for (int limit = 0; ; ++limit) {
+                AllocObj mX(Z, &oa);  const AllocObj& X = mX;
+
+                oa.setAllocationLimit(limit);
+                try {
+                    mX.insert(allocRange.rbegin(), allocRange.rend());
+                }
+                catch (const bslma::TestAllocatorException&) {
+                    oa.setAllocationLimit(-1);
+                    ASSERTV(LINE, limit, Z == X || X.empty());
+                    continue;
+                }
+                oa.setAllocationLimit(-1);
+                ASSERTV(LINE, limit, hasKeys(X, expected));
+                break;
+            }
+            ASSERTV(LINE, 0 == oa.numBlocksInUse());
+#endif
+        }
+
+        if (verbose) printf("\nBuilding a set from a sorted range.\n");
+        {
+            static const int LENGTHS[] = { 1, 2, RUN_LENGTH, RUN_LENGTH + 1,
+                                           100 };
+            const int NUM_LENGTHS = sizeof LENGTHS / sizeof *LENGTHS;
+
+            for (int ti = 0; ti < NUM_LENGTHS; ++ti) {
+                const int LENGTH = LENGTHS[ti];
+
+                for (int numCopies = 1; numCopies <= 2; ++numCopies) {
+                    Keys range(&sa);
+                    for (int i = 0; i < LENGTH; ++i) {
+                        range.push_back(i / numCopies);
+                    }
+                    const int NUM_KEYS = (LENGTH + numCopies - 1) / numCopies;
+
+                    bsls::Types::Int64 BLOCKS = oa.numBlocksTotal();
+                    {
+                        const Obj X(range.begin(),
+                                    range.end(),
+                                    std::less<int>(),
+                                    &oa);
+                        ASSERTV(LENGTH, numCopies,
+                                NUM_KEYS == static_cast<int>(X.size()));
+                        ASSERTV(LENGTH, numCopies,
+                                1 == oa.numBlocksTotal() - BLOCKS);
+                    }
+
+                    BLOCKS = oa.numBlocksTotal();
+                    {
+                        const Obj X(range.rbegin(),
+                                    range.rend(),
+                                    std::less<int>(),
+                                    &oa);
+                        ASSERTV(LENGTH, numCopies,
+                                NUM_KEYS == static_cast<int>(X.size()));
+                        ASSERTV(LENGTH, numCopies,
+                                1 + (RUN_LENGTH < LENGTH) ==
+                                              oa.numBlocksTotal() - BLOCKS);
+                    }
+                }
+            }
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // RANGE INSERTION AND RANGE CONSTRUCTOR
+        //
+        // Concerns:
+        //: 1 Inserting a range inserts each key of the range that is neither
+        //:   present in the set nor that of an earlier element of the range,
+        //:   whether the repeated keys are adjacent or not, and whatever the
+        //:   order of the range.
+        //:
+        //: 2 Inserting an empty range has no effect.
+        //:
+        //: 3 The range constructor inserts the keys of the range into an
+        //:   empty set ordered by the supplied comparator, and uses the
+        //:   supplied allocator.
+        //
+        // Plan:
+        //: 1 Using a table of initial values, inserted ranges, and expected
+        //:   values, each described by a string of keys, create a set having
+        //:   the initial value, insert the range, and verify the value of the
+        //:   set.  (C-1..2)
+        //:
+        //: 2 For each entry in the table having an empty initial value, build
+        //:   a set from the range using the range constructor, and verify its
+        //:   value and allocator.  Then build a 'GreaterObj' from the range,
+        //:   and verify that its keys are those of the set, in reverse
+        //:   order.  (C-3)
+        //
+        // Testing:
+        //   flat_set(INPUT_ITERATOR first, INPUT_ITERATOR last, ...);
+        //   void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        //   CONCERN: Range insertion discards keys already present or repeated
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nRANGE INSERTION AND RANGE CONSTRUCTOR"
+                            "\n=====================================\n");
+
+        bslma::TestAllocator oa("object", veryVeryVerbose);
+
+        static const struct {
+            int         d_line;      // source line number
+            const char *d_initial;   // keys initially in the set
+            const char *d_range;     // keys of the inserted range
+            const char *d_expected;  // expected keys of the set
+        } DATA[] = {
+            //LINE  INITIAL  RANGE     EXPECTED
+            //----  -------  --------  --------
+            { L_,   "",      "",       ""       },
+            { L_,   "",      "A",      "A"      },
+            { L_,   "",      "ABC",    "ABC"    },
+            { L_,   "",      "CBA",    "ABC"    },
+            { L_,   "",      "BCA",    "ABC"    },
+            { L_,   "",      "AA",     "A"      },
+            { L_,   "",      "AAB",    "AB"     },
+            { L_,   "",      "ABA",    "AB"     },
+            { L_,   "",      "BAAB",   "AB"     },
+            { L_,   "",      "CBABC",  "ABC"    },
+            { L_,   "B",     "",       "B"      },
+            { L_,   "B",     "A",      "AB"     },
+            { L_,   "B",     "C",      "BC"     },
+            { L_,   "B",     "B",      "B"      },
+            { L_,   "B",     "BAB",    "AB"     },
+            { L_,   "BD",    "ABCDE",  "ABCDE"  },
+            { L_,   "BD",    "EDCBA",  "ABCDE"  },
+            { L_,   "BD",    "CDC",    "BCD"    },
+            { L_,   "ACE",   "BDF",    "ABCDEF" },
+            { L_,   "ACE",   "FDBB",   "ABCDEF" },
+            { L_,   "ACE",   "ECA",    "ACE"    },
+            { L_,   "ACE",   "GECA",   "ACEG"   },
+            { L_,   "ACE",   "ABCDEF", "ABCDEF" },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE     = DATA[ti].d_line;
+            const char *const INITIAL  = DATA[ti].d_initial;
+            const char *const RANGE    = DATA[ti].d_range;
+            const char *const EXPECTED = DATA[ti].d_expected;
+            const char *const END      = RANGE + native_std::strlen(RANGE);
+
+            if (veryVerbose) { T_ P_(LINE) P_(INITIAL) P_(RANGE) P(EXPECTED) }
+
+            {
+                Obj mX(&oa);  const Obj& X = mX;
+                for (int i = 0; INITIAL[i]; ++i) {
+                    mX.insert(INITIAL[i]);
+                }
+
+                mX.insert(RANGE, END);
+                ASSERTV(LINE, isValue(X, EXPECTED));
+            }
+
+            if ('\0' == *INITIAL) {
+                const Obj X(RANGE, END, std::less<int>(), &oa);
+                ASSERTV(LINE, isValue(X, EXPECTED));
+                ASSERTV(LINE, &oa == X.get_allocator().mechanism());
+
+                const GreaterObj Y(RANGE, END, std::greater<int>(), &oa);
+                ASSERTV(LINE, X.size() == Y.size());
+
+                GreaterObj::const_reverse_iterator it = Y.rbegin();
+                for (Obj::const_iterator jt = X.begin();
+                     jt != X.end();
+                     ++jt, ++it) {
+                    ASSERTV(LINE, *jt == *it);
+                }
+            }
+            ASSERTV(LINE, 0 == oa.numBlocksInUse());
+        }
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // 'erase' AND 'clear'
+        //
+        // Concerns:
+        //: 1 Erasing at a position removes the element at the position, and
+        //:   returns an iterator referring to the element that followed it,
+        //:   whether the position is at the front, in the middle, or at the
+        //:   back of the set.
+        //:
+        //: 2 Erasing a key removes the element having the key and returns 1,
+        //:   or, if no element has the key, returns 0 and has no effect.
+        //:
+        //: 3 Erasing a range removes the elements in the range, and returns
+        //:   an iterator referring to the element that followed the range;
+        //:   erasing an empty range has no effect.
+        //:
+        //: 4 'clear' removes every element.
+        //:
+        //: 5 Erasing destroys the removed elements, and does not change the
+        //:   capacity of the set.
+        //
+        // Plan:
+        //: 1 Using a table of positions, erase the element at each position
+        //:   of an 'AllocObj' holding 'N' elements, and verify the returned
+        //:   iterator, the keys of the object, and that exactly the block held
+        //:   by the erased key is released.  (C-1, 5)
+        //:
+        //: 2 Erase each key from one less than the first key to one more than
+        //:   the last key, and verify the returned value, the value of the
+        //:   object, and the blocks released.  (C-2, 5)
+        //:
+        //: 3 Using a table of ranges, erase each range, and verify the
+        //:   returned iterator, the value of the object, and the blocks
+        //:   released.  (C-3, 5)
+        //:
+        //: 4 Call 'clear', and verify the value of the object, the blocks
+        //:   released, and the capacity.  (C-4..5)
+        //
+        // Testing:
+        //   iterator erase(const_iterator position);
+        //   size_type erase(const key_type& key);
+        //   iterator erase(const_iterator first, const_iterator last);
+        //   void clear();
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\n'erase' AND 'clear'"
+                            "\n===================\n");
+
+        bslma::TestAllocator oa("object",  veryVeryVerbose);
+        bslma::TestAllocator sa("scratch", veryVeryVerbose);
+
+        const int N = 8;  // number of elements initially in the object
+
+        if (verbose) printf("\nErasing at a position.\n");
+        {
+            static const int POSITIONS[] = { 0, 1, N / 2, N - 1 };
+            const int NUM_POSITIONS = sizeof POSITIONS / sizeof *POSITIONS;
+
+            for (int ti = 0; ti < NUM_POSITIONS; ++ti) {
+                const int POSITION = POSITIONS[ti];
+
+                AllocObj mX(&oa);  const AllocObj& X = mX;
+                loadEvenKeys(&mX, N);
+
+                const AllocObj::size_type CAPACITY = X.capacity();
+                const bsls::Types::Int64  BLOCKS   = oa.numBlocksInUse();
+
+                const AllocObj::iterator it = mX.erase(X.begin() + POSITION);
+                ASSERTV(POSITION, X.begin() + POSITION == it);
+                ASSERTV(POSITION, BLOCKS - 1 == oa.numBlocksInUse());
+                ASSERTV(POSITION, CAPACITY == X.capacity());
+
+                Keys keys(&sa);
+                for (int i = 0; i < N; ++i) {
+                    if (POSITION != i) {
+                        keys.push_back(2 * i);
+                    }
+                }
+                ASSERTV(POSITION, hasKeys(X, keys));
+            }
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+
+        if (verbose) printf("\nErasing a key.\n");
+        {
+            AllocObj mX(&oa);  const AllocObj& X = mX;
+            loadEvenKeys(&mX, N);
+
+            const AllocObj::size_type CAPACITY = X.capacity();
+
+            for (int key = -1; key <= 2 * N; ++key) {
+                const bsltf::AllocTestType KEY(key, &sa);
+
+                const bool IS_PRESENT = 0 <= key
+                                     && key < 2 * N
+                                     && 0 == key % 2;
+                const AllocObj::size_type SIZE   = X.size();
+                const bsls::Types::Int64  BLOCKS = oa.numBlocksInUse();
+
+                ASSERTV(key, IS_PRESENT == mX.erase(KEY));
+                ASSERTV(key, SIZE - IS_PRESENT == X.size());
+                ASSERTV(key, BLOCKS - IS_PRESENT == oa.numBlocksInUse());
+                ASSERTV(key, X.end() == X.find(KEY));
+                ASSERTV(key, X.empty() || key < X.begin()->data());
+            }
+            ASSERT(X.empty());
+            ASSERT(CAPACITY == X.capacity());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+
+        if (verbose) printf("\nErasing a range.\n");
+        {
+            static const struct {
+                int d_line;   // source line number
+                int d_first;  // position of the first erased element
+                int d_last;   // position following the last erased element
+            } DATA[] = {
+                //LINE  FIRST  LAST
+                //----  -----  -----
+                { L_,       0,     0 },
+                { L_,   N / 2, N / 2 },
+                { L_,       N,     N },
+                { L_,       0,     1 },
+                { L_,       0, N / 2 },
+                { L_,       1, N - 1 },
+                { L_,   N / 2,     N },
+                { L_,   N - 1,     N },
+                { L_,       0,     N },
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int LINE  = DATA[ti].d_line;
+                const int FIRST = DATA[ti].d_first;
+                const int LAST  = DATA[ti].d_last;
+
+                if (veryVerbose) { T_ P_(LINE) P_(FIRST) P(LAST) }
+
+                AllocObj mX(&oa);  const AllocObj& X = mX;
+                loadEvenKeys(&mX, N);
+
+                const AllocObj::size_type CAPACITY = X.capacity();
+                const bsls::Types::Int64  BLOCKS   = oa.numBlocksInUse();
+
+                const AllocObj::iterator it = mX.erase(X.begin() + FIRST,
+                                                       X.begin() + LAST);
+                ASSERTV(LINE, X.begin() + FIRST == it);
+                ASSERTV(LINE, it == X.end() || 2 * LAST == it->data());
+                ASSERTV(LINE, BLOCKS - (LAST - FIRST) == oa.numBlocksInUse());
+                ASSERTV(LINE, CAPACITY == X.capacity());
+
+                Keys keys(&sa);
+                for (int i = 0; i < N; ++i) {
+                    if (i < FIRST || LAST <= i) {
+                        keys.push_back(2 * i);
+                    }
+                }
+                ASSERTV(LINE, hasKeys(X, keys));
+            }
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+
+        if (verbose) printf("\nTesting 'clear'.\n");
+        {
+            AllocObj mX(&oa);  const AllocObj& X = mX;
+            mX.clear();
+            ASSERT(X.empty());
+            ASSERT(0 == X.capacity());
+
+            loadEvenKeys(&mX, N);
+
+            const AllocObj::size_type   CAPACITY = X.capacity();
+            bslma::TestAllocatorMonitor oam(&oa);
+
+            mX.clear();
+            ASSERT(X.empty());
+            ASSERT(X.begin() == X.end());
+            ASSERT(1 == oa.numBlocksInUse());
+            ASSERT(oam.isTotalSame());
+            ASSERT(CAPACITY == X.capacity());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+        ASSERT(0 == defaultAllocator.numBlocksInUse());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // LOOKUP
+        //
+        // Concerns:
+        //: 1 'find' returns an iterator referring to the element having the
+        //:   key if there is one, and 'end' otherwise, and 'count' returns 1
+        //:   or 0 accordingly.
+        //:
+        //: 2 'lower_bound', 'upper_bound', and 'equal_range' return the
+        //:   positions of the first element not ordered before the key, and
+        //:   of the first element ordered after the key.
+        //:
+        //: 3 The concerns hold for keys ordered before the first key, after
+        //:   the last key, and between two keys, and for sets of every size
+        //:   around a power of two (at which the number of steps taken by a
+        //:   search changes).
+        //:
+        //: 4 The concerns hold for a user-supplied comparator.
+        //
+        // Plan:
+        //: 1 For sets of several sizes, holding the keys 10, 20, and so on,
+        //:   look up every multiple of 5 from 0 to 15 more than the last key,
+        //:   and verify the results of each lookup method using 'testLookup',
+        //:   given the number of keys ordered before the looked-up key.
+        //:   (C-1..3)
+        //:
+        //: 2 Repeat P-1 for a 'GreaterObj'.  (C-4)
+        //
+        // Testing:
+        //   const_iterator find(const key_type& key) const;
+        //   size_type count(const key_type& key) const;
+        //   const_iterator lower_bound(const key_type& key) const;
+        //   const_iterator upper_bound(const key_type& key) const;
+        //   pair<const_iterator, const_iterator> equal_range(key) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nLOOKUP"
+                            "\n======\n");
+
+        bslma::TestAllocator oa("object", veryVeryVerbose);
+
+        static const int SIZES[] = { 0, 1, 2, 3, 7, 8, 9, 16, 17, 100 };
+        const int NUM_SIZES = sizeof SIZES / sizeof *SIZES;
+
+        for (int ti = 0; ti < NUM_SIZES; ++ti) {
+            const int SIZE = SIZES[ti];
+
+            Obj        mX(&oa);  const Obj&        X = mX;
+            GreaterObj mY(&oa);  const GreaterObj& Y = mY;
+            for (int i = 1; i <= SIZE; ++i) {
+                mX.insert(10 * i);
+                mY.insert(10 * i);
+            }
+
+            for (int key = 0; key <= 10 * SIZE + 15; key += 5) {
+                const bool IS_PRESENT = 0 < key
+                                     && key <= 10 * SIZE
+                                     && 0 == key % 10;
+                const int  NUM_LESS   = native_std::min(SIZE, (key - 1) / 10);
+
+                testLookup(X, key, NUM_LESS, IS_PRESENT);
+                testLookup(Y, key, SIZE - NUM_LESS - IS_PRESENT, IS_PRESENT);
+            }
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // ITERATORS
+        //
+        // Concerns:
+        //: 1 Each pair of iterator accessors delimits the elements of the set,
+        //:   in increasing key order for the forward iterators, and in
+        //:   decreasing key order for the reverse iterators, and the 'c'
+        //:   accessors return the same iterators as the others.
+        //:
+        //: 2 The iterators are random-access, and the distance from the
+        //:   beginning to the end of the set is its size.
+        //:
+        //: 3 Inserting or erasing an element does not move the elements
+        //:   preceding it, provided that the capacity of the set does not
+        //:   change.
+        //
+        // Plan:
+        //: 1 For sets of several sizes, built by inserting keys in decreasing
+        //:   order, iterate over the elements with each kind of iterator,
+        //:   verifying the keys.  (C-1..2)
+        //:
+        //: 2 In an 'AllocObj' having sufficient capacity, record the
+        //:   addresses of the elements, insert and erase elements following
+        //:   (and then at) a position, and verify the addresses and values of
+        //:   the preceding elements.  (C-3)
+        //
+        // Testing:
+        //   const_iterator begin() const;
+        //   const_iterator cbegin() const;
+        //   const_iterator end() const;
+        //   const_iterator cend() const;
+        //   const_reverse_iterator rbegin() const;
+        //   const_reverse_iterator crbegin() const;
+        //   const_reverse_iterator rend() const;
+        //   const_reverse_iterator crend() const;
+        //   CONCERN: Inserting or erasing does not move the preceding elements
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nITERATORS"
+                            "\n=========\n");
+
+        bslma::TestAllocator oa("object", veryVeryVerbose);
+
+        if (verbose) printf("\nIterating over sets of several sizes.\n");
+
+        static const int SIZES[] = { 0, 1, 2, 15, 16, 17, 100 };
+        const int NUM_SIZES = sizeof SIZES / sizeof *SIZES;
+
+        for (int ti = 0; ti < NUM_SIZES; ++ti) {
+            const int SIZE = SIZES[ti];
+
+            Obj mX(&oa);  const Obj& X = mX;
+            for (int i = SIZE; 0 < i--; ) {
+                mX.insert(i);
+            }
+
+            ASSERTV(SIZE, SIZE == X.end() - X.begin());
+            ASSERTV(SIZE, SIZE == X.rend() - X.rbegin());
+            ASSERTV(SIZE, X.begin()  == X.cbegin());
+            ASSERTV(SIZE, X.end()    == X.cend());
+            ASSERTV(SIZE, X.rbegin() == X.crbegin());
+            ASSERTV(SIZE, X.rend()   == X.crend());
+
+            int i = 0;
+            for (Obj::const_iterator it = X.begin(); it != X.end(); ++it) {
+                ASSERTV(SIZE, i, i == *it);
+                ++i;
+            }
+            ASSERTV(SIZE, SIZE == i);
+
+            for (Obj::const_reverse_iterator it = X.rbegin(); it != X.rend();
+                                                                        ++it) {
+                --i;
+                ASSERTV(SIZE, i, i == *it);
+            }
+            ASSERTV(SIZE, 0 == i);
+
+            for (Obj::const_iterator it = X.cbegin(); it != X.cend(); ++it) {
+                ASSERTV(SIZE, i, i == *it);
+                ++i;
+            }
+            ASSERTV(SIZE, SIZE == i);
+
+            for (Obj::const_reverse_iterator it = X.crbegin();
+                 it != X.crend();
+                 ++it) {
+                --i;
+                ASSERTV(SIZE, i, i == *it);
+            }
+            ASSERTV(SIZE, 0 == i);
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+
+        if (verbose) printf("\nTesting the addresses of elements.\n");
+        {
+            const int N = 8;  // number of elements initially in the object
+
+            AllocObj mX(&oa);  const AllocObj& X = mX;
+            mX.reserve(2 * N);
+            loadEvenKeys(&mX, N);
+
+            const AllocObj::value_type *ADDRESSES[N];
+            for (int i = 0; i < N; ++i) {
+                ADDRESSES[i] = &X.begin()[i];
+            }
+
+            // Insert and erase elements after, and then at, the middle.
+
+            mX.insert(bsltf::AllocTestType(2 * N + 1));
+            mX.insert(bsltf::AllocTestType(N + 1));
+            ASSERT(1 == mX.erase(bsltf::AllocTestType(2 * N - 2)));
+            mX.erase(X.begin() + N / 2);
+            mX.insert(bsltf::AllocTestType(N - 1));
+
+            for (int i = 0; i < N / 2; ++i) {
+                ASSERTV(i, ADDRESSES[i] == &X.begin()[i]);
+                ASSERTV(i, 2 * i == ADDRESSES[i]->data());
+            }
+            ASSERT(2 * N == X.capacity());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+        ASSERT(0 == defaultAllocator.numBlocksInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // 'insert'
+        //
+        // Concerns:
+        //: 1 'insert' inserts a key if and only if it is not present, and
+        //:   returns an iterator referring to the element having the key, and
+        //:   whether an element was inserted.
+        //:
+        //: 2 A key is inserted in order at the front, in the middle, or at the
+        //:   back of the set.
+        //:
+        //: 3 Inserting a key into a set whose size is less than its capacity
+        //:   allocates no memory, and inserting a key that is present
+        //:   allocates no memory.
+        //:
+        //: 4 The hint passed to 'insert' affects only performance: the key is
+        //:   inserted in order whether or not the hint is correct.
+        //:
+        //: 5 An inserted key, and the keys it shifts, use the allocator of the
+        //:   set.
+        //:
+        //: 6 No memory is leaked, and the default allocator is not used.
+        //
+        // Plan:
+        //: 1 Using a table of positions, insert an odd key at each position
+        //:   into an object holding 'N' even keys and having capacity for one
+        //:   more, and verify the returned value, the keys of the object, and
+        //:   that no memory is allocated.  Then insert each even key again,
+        //:   and verify that nothing is inserted or allocated.  (C-1..3)
+        //:
+        //: 2 Repeat P-1 using 'insert' with a hint of 'begin', of 'end', and
+        //:   of the correct position.  (C-4)
+        //:
+        //: 3 Insert keys into an 'AllocObj' in decreasing order, so that each
+        //:   insertion shifts every existing element, and verify the value and
+        //:   allocator of every key.  (C-5)
+        //:
+        //: 4 Verify that no memory is in use by the object allocator at the
+        //:   end of the test, and that the default allocator is not used.
+        //:   (C-6)
+        //
+        // Testing:
+        //   pair<iterator, bool> insert(const value_type& value);
+        //   iterator insert(const_iterator hint, const value_type& value);
+        //   CONCERN: Inserting at the front, in the middle, or at the back
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\n'insert'"
+                            "\n========\n");
+
+        bslma::TestAllocator oa("object",  veryVeryVerbose);
+        bslma::TestAllocator sa("scratch", veryVeryVerbose);
+
+        const int N = 8;  // number of elements initially in the object
+
+        enum { e_NO_HINT, e_HINT_BEGIN, e_HINT_END, e_HINT_POSITION };
+
+        static const int POSITIONS[] = { 0, 1, N / 2, N - 1, N };
+        const int NUM_POSITIONS = sizeof POSITIONS / sizeof *POSITIONS;
+
+        for (int hint = e_NO_HINT; hint <= e_HINT_POSITION; ++hint) {
+            for (int ti = 0; ti < NUM_POSITIONS; ++ti) {
+                const int POSITION = POSITIONS[ti];
+                const int KEY      = 2 * POSITION - 1;
+
+                if (veryVerbose) { T_ P_(hint) P(POSITION) }
+
+                Obj mX(&oa);  const Obj& X = mX;
+                mX.reserve(N + 1);
+
+                Keys keys(&sa);
+                for (int i = 0; i < N; ++i) {
+                    mX.insert(2 * i);
+                    keys.push_back(2 * i);
+                }
+
+                bslma::TestAllocatorMonitor oam(&oa);
+
+                Obj::iterator it;
+                switch (hint) {
+                  case e_NO_HINT: {
+                    const bsl::pair<Obj::iterator, bool> R = mX.insert(KEY);
+                    ASSERTV(POSITION, R.second);
+                    it = R.first;
+                  } break;
+                  case e_HINT_BEGIN: {
+                    it = mX.insert(X.begin(), KEY);
+                  } break;
+                  case e_HINT_END: {
+                    it = mX.insert(X.end(), KEY);
+                  } break;
+                  default: {
+                    it = mX.insert(X.begin() + POSITION, KEY);
+                  }
+                }
+                ASSERTV(hint, POSITION, X.begin() + POSITION == it);
+                ASSERTV(hint, POSITION, KEY == *it);
+
+                keys.insert(keys.begin() + POSITION, KEY);
+                ASSERTV(hint, POSITION, hasKeys(X, keys));
+
+                for (int i = 0; i < N; ++i) {
+                    const bsl::pair<Obj::iterator, bool> R = mX.insert(2 * i);
+                    ASSERTV(hint, POSITION, i, !R.second);
+                    ASSERTV(hint, POSITION, i, X.find(2 * i) == R.first);
+                    ASSERTV(hint, POSITION, i,
+                            R.first == mX.insert(X.begin(), 2 * i));
+                    ASSERTV(hint, POSITION, i,
+                            R.first == mX.insert(X.end(), 2 * i));
+                }
+                ASSERTV(hint, POSITION, oam.isTotalSame());
+                ASSERTV(hint, POSITION, hasKeys(X, keys));
+            }
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+
+        if (verbose) printf("\nInserting out-of-line elements.\n");
+        {
+            const int NUM_ELEMENTS = 100;
+
+            AllocObj mX(&oa);  const AllocObj& X = mX;
+            for (int i = NUM_ELEMENTS; 0 < i--; ) {
+                const bsltf::AllocTestType KEY(i, &sa);
+
+                const bsl::pair<AllocObj::iterator, bool> R = mX.insert(KEY);
+                ASSERTV(i, R.second);
+                ASSERTV(i, X.begin() == R.first);
+            }
+            ASSERT(NUM_ELEMENTS == X.size());
+
+            int i = 0;
+            for (AllocObj::const_iterator it = X.begin();
+                 it != X.end();
+                 ++it, ++i) {
+                ASSERTV(i, i   == it->data());
+                ASSERTV(i, &oa == it->allocator());
+            }
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+        ASSERT(0 == defaultAllocator.numBlocksInUse());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create an object, insert elements in an order that shifts the
+        //:   elements already present, look them up, and iterate over them.
+        //:   (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        //   explicit flat_set(const COMPARATOR&, const ALLOCATOR&);
+        //   explicit flat_set(const ALLOCATOR& basicAllocator);
+        //   ~flat_set();
+        //   pair<iterator, bool> insert(const value_type& value);
+        //   const_iterator begin() const;
+        //   const_iterator end() const;
+        //   bool empty() const;
+        //   size_type size() const;
+        //   key_compare key_comp() const;
+        //   value_compare value_comp() const;
+        //   const_iterator find(const key_type& key) const;
+        //   size_type count(const key_type& key) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        bslma::TestAllocator oa("object", veryVeryVerbose);
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+            ASSERT(X.empty());
+            ASSERT(0 == X.size());
+            ASSERT(X.begin() == X.end());
+            ASSERT(X.end() == X.find(0));
+            ASSERT(0 == oa.numBlocksTotal());
+
+            for (int i = 0; i < 1000; ++i) {
+                const int key = (i * 7919) % 1000;
+                ASSERT( mX.insert(key).second);
+                ASSERT(!mX.insert(key).second);
+            }
+            ASSERT(1000 == X.size());
+            ASSERT(!X.empty());
+
+            int count = 0;
+            for (Obj::const_iterator it = X.begin(); it != X.end(); ++it) {
+                ASSERT(count == *it);
+                ASSERT(1 == X.count(*it));
+                ++count;
+            }
+            ASSERT(1000 == count);
+
+            ASSERT(250 == *X.find(250));
+            ASSERT(0   == X.count(1000));
+            ASSERT(X.key_comp()(1, 2));
+            ASSERT(X.value_comp()(1, 2));
+
+            const Obj Y(std::less<int>(), &oa);
+            ASSERT(Y.empty());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
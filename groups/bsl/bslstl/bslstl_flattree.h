@@ -0,0 +1,1150 @@
+// bslstl_flattree.h                                                  -*-C++-*-
+#ifndef INCLUDED_BSLSTL_FLATTREE
+#define INCLUDED_BSLSTL_FLATTREE
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a sorted vector implementing the 'flat' ordered containers.
+//
+//@CLASSES:
+//  bslstl::FlatTree: sorted vector implementing the 'flat' containers
+//  bslstl::FlatTree_Proctor: proctor truncating a vector on failure
+//
+//@SEE_ALSO: bslstl_flatmap, bslstl_flatset, bslstl_flatmultimap
+//
+//@DESCRIPTION: This component provides a class template, 'bslstl::FlatTree',
+// implementing the common machinery of the sorted-vector based ordered
+// containers, 'bsl::flat_map', 'bsl::flat_set', and 'bsl::flat_multimap'.
+// A 'FlatTree' holds its elements, sorted by key, in a single contiguous
+// 'bsl::vector', so that (unlike the red-black tree used by 'bsl::map', see
+// 'bslalg_rbtreeutil') no memory is spent on per-element nodes or links, the
+// whole container occupies a single allocated block, and a lookup touches
+// only the cache lines visited by a binary search.  The price of this layout
+// is that inserting or erasing a single element shifts every element that
+// follows it, and so takes time linear in the size of the container.  A
+// 'FlatTree' is therefore intended for *read-mostly* data, such as reference
+// data loaded (or reloaded) in bulk and then searched many times.
+//
+///Element Storage
+///---------------
+// Elements are held by a 'bsl::vector' using the allocator of the tree, so
+// elements are created, copied, and shifted by 'bslalg::ArrayPrimitives'.  In
+// particular, if the 'ValueType' (defined by the 'KEY_CONFIG' policy) is
+// bitwise-moveable (see 'bslmf_isbitwisemoveable'), elements are shifted
+// with 'memmove' when a single element is inserted or erased; otherwise they
+// are shifted by assignment.  Since elements are assigned, the 'ValueType'
+// must be assignable; in particular, 'bsl::flat_map' stores
+// 'bsl::pair<KEY, VALUE>' (rather than 'bsl::pair<const KEY, VALUE>').
+//
+///Search
+///------
+// A key is located by a *branch-free* binary search: the range under
+// consideration is halved on every step by a conditional (rather than a
+// branch) selecting the half that may hold the result, so that the sequence
+// of instructions executed depends only on the size of the range, and no
+// branch mispredictions are incurred.  A search for a key in a tree of 'n'
+// elements performs exactly 'floor(log2(n)) + 1' comparisons.
+//
+///Bulk Insertion
+///--------------
+// Inserting a range of elements ('insertUnique' and 'insertMulti' taking a
+// pair of iterators) does not insert the elements one at a time.  Instead,
+// the new elements are appended to the vector, and then:
+//
+//: 1 If the appended elements are not already sorted, they are sorted by a
+//:   (stable) merge sort, whose temporary buffer is obtained from the
+//:   allocator of the tree.
+//:
+//: 2 For unique keys, appended elements having a key equivalent to that of
+//:   an earlier appended element, or to that of an existing element, are
+//:   discarded.  Existing elements are searched by a galloping (exponential)
+//:   search resuming from the position found for the previous appended
+//:   element, so that the search costs 'O[k * log(n / k)]' comparisons for 'k'
+//:   elements appended to a tree of 'n' elements.
+//:
+//: 3 Appended elements ordered before the last existing element are merged,
+//:   in a single backward pass, into the existing elements, so that each
+//:   existing element is moved at most once.  If the 'ValueType' is
+//:   bitwise-moveable, each run of existing elements is moved with a single
+//:   'memmove'.
+//
+// Consequently, building a tree from an unsorted range of 'k' elements takes
+// 'O[k * log(k)]' time, building it from a sorted range, or appending a
+// sorted range ordered after every existing element, takes 'O[k]' time, and
+// merging a sorted range into a tree of 'n' elements takes 'O[n + k]' time.
+// Note that inserting a range into a tree holding equivalent keys (using
+// 'insertMulti') places the new elements after any existing equivalent
+// elements, and preserves the relative order of equivalent new elements.
+//
+///Exception Safety
+///----------------
+// Inserting a single element provides the strong exception-safety guarantee
+// (inherited from 'bsl::vector').  Inserting a range of elements provides the
+// strong guarantee if the 'ValueType' is bitwise-moveable; otherwise, if an
+// assignment throws while the new elements are merged into the existing
+// elements (step 3 above), the tree is left empty, and the strong guarantee
+// is provided if no assignment throws.  Note that an exception thrown by the
+// comparator leaves the tree in a valid, but unspecified, state.
+//
+///Iterator and Reference Invalidation
+///-----------------------------------
+// Since the elements of a 'FlatTree' are held by a 'bsl::vector', *any*
+// insertion or removal invalidates all iterators, pointers, and references to
+// the elements at or after the point of insertion (or removal), and any
+// insertion that grows the capacity of the vector (as may any range
+// insertion) invalidates all of them.
+//
+///Usage
+///-----
+// This component is an implementation detail of 'bsl::flat_map',
+// 'bsl::flat_set', and 'bsl::flat_multimap', and is not intended for direct
+// use by clients.  See 'bslstl_flatmap', 'bslstl_flatset', and
+// 'bslstl_flatmultimap' for usage examples.
+
+#ifndef INCLUDED_BSLSCM_VERSION
+#include <bslscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_ALLOCATORTRAITS
+#include <bslstl_allocatortraits.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_PAIR
+#include <bslstl_pair.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_VECTOR
+#include <bslstl_vector.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_ARRAYPRIMITIVES
+#include <bslalg_arrayprimitives.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_SWAPUTIL
+#include <bslalg_swaputil.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_DESTRUCTORGUARD
+#include <bslma_destructorguard.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_ISBITWISEMOVEABLE
+#include <bslmf_isbitwisemoveable.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_METAINT
+#include <bslmf_metaint.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_BSLS_NATIVESTD
+#include <bsls_nativestd.h>
+#endif
+
+#ifndef INCLUDED_BSLS_OBJECTBUFFER
+#include <bsls_objectbuffer.h>
+#endif
+
+#ifndef INCLUDED_BSLS_PERFORMANCEHINT
+#include <bsls_performancehint.h>
+#endif
+
+#ifndef INCLUDED_ALGORITHM
+#include <algorithm>
+#define INCLUDED_ALGORITHM
+#endif
+
+#ifndef INCLUDED_CSTRING
+#include <cstring>
+#define INCLUDED_CSTRING
+#endif
+
+namespace BloombergLP {
+namespace bslstl {
+
+                        // ======================
+                        // class FlatTree_Proctor
+                        // ======================
+
+template <class VECTOR>
+class FlatTree_Proctor {
+    // This class implements a proctor that, unless its 'release' method is
+    // called, erases from a 'VECTOR' object every element at or after a
+    // given index on destruction.  This proctor is used to remove the
+    // elements appended to the vector of a 'FlatTree' during a range
+    // insertion (or, with an index of 0, every element) should an exception
+    // be thrown before the appended elements have been merged.
+
+    // DATA
+    VECTOR                     *d_vector_p;  // managed vector, or 0 if
+                                             // released
+
+    typename VECTOR::size_type  d_size;      // number of elements to keep
+
+  private:
+    // NOT IMPLEMENTED
+    FlatTree_Proctor(const FlatTree_Proctor&);
+    FlatTree_Proctor& operator=(const FlatTree_Proctor&);
+
+  public:
+    // CREATORS
+    FlatTree_Proctor(VECTOR *vector, typename VECTOR::size_type size);
+        // Create a proctor to manage the elements of the specified 'vector'
+        // at or after the specified 'size' index.
+
+    ~FlatTree_Proctor();
+        // Destroy this proctor, and, unless 'release' has been called, erase
+        // every element of the managed vector at or after the managed index,
+        // if any.
+
+    // MANIPULATORS
+    void release();
+        // Release from management the vector currently managed by this
+        // proctor.
+};
+
+                        // ==============
+                        // class FlatTree
+                        // ==============
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+class FlatTree {
+    // This class template implements a sorted vector holding elements of the
+    // 'ValueType' defined by the (template parameter) 'KEY_CONFIG', ordered
+    // by their keys using the (template parameter) 'COMPARATOR', in a
+    // 'bsl::vector' using the (template parameter) 'ALLOCATOR' (see {Element
+    // Storage}).  The 'KEY_CONFIG' type must provide 'KeyType' and
+    // 'ValueType' typedefs, and a static 'extractKey' function returning a
+    // reference to the key of a 'ValueType' object.  A tree may hold either
+    // unique keys (using 'insertUnique') or equivalent keys (using
+    // 'insertMulti'), but clients should use only one of the two on a given
+    // tree.  Positions in the tree are identified by the index of an element
+    // (or by the size of the tree, for the past-the-end position).
+
+  public:
+    // TYPES
+    typedef ALLOCATOR                                   AllocatorType;
+    typedef COMPARATOR                                  ComparatorType;
+    typedef ::bsl::allocator_traits<ALLOCATOR>          AllocatorTraits;
+    typedef typename KEY_CONFIG::KeyType                KeyType;
+    typedef typename KEY_CONFIG::ValueType              ValueType;
+    typedef ::bsl::vector<ValueType, ALLOCATOR>         VectorType;
+    typedef typename VectorType::size_type              SizeType;
+    typedef typename VectorType::iterator               Iterator;
+    typedef typename VectorType::const_iterator         ConstIterator;
+
+  private:
+    // PRIVATE TYPES
+    typedef typename ALLOCATOR::template rebind<SizeType>::other
+                                                        SizeAllocator;
+    typedef ::bsl::vector<SizeType, SizeAllocator>      PositionVector;
+    typedef FlatTree_Proctor<VectorType>                Proctor;
+
+    enum {
+        k_INSERTION_SORT_LENGTH = 16,  // length of the runs sorted by
+                                       // insertion sort before merging
+
+        k_IS_BITWISE_MOVEABLE = bslmf::IsBitwiseMoveable<ValueType>::value
+    };
+
+    // DATA
+    VectorType  d_data;        // elements, sorted by key
+    COMPARATOR  d_comparator;  // key-ordering functor
+
+  private:
+    // PRIVATE MANIPULATORS
+    void insertionSort(ValueType *first, ValueType *last);
+        // Sort the elements in the range starting at the specified 'first'
+        // address and ending immediately before the specified 'last' address
+        // by key, preserving the relative order of elements having
+        // equivalent keys.
+
+    void mergeRuns(ValueType *to,
+                   ValueType *from,
+                   SizeType   begin,
+                   SizeType   middle,
+                   SizeType   end);
+        // Assign to the elements of the specified 'to' array, at the indices
+        // in the range '[begin .. end)', the stable merge of the sorted
+        // ranges at the indices '[begin .. middle)' and '[middle .. end)' of
+        // the specified 'from' array.
+
+    void sortTail(SizeType first);
+        // Stably sort by key the elements of this tree at or after the
+        // specified 'first' index, using a temporary buffer obtained from the
+        // allocator of this tree if there are more than
+        // 'k_INSERTION_SORT_LENGTH' such elements that are not already
+        // sorted.
+
+    void mergeTail(SizeType first, bool isUnique);
+        // Restore the ordering of this tree after elements have been appended
+        // to its vector, where the specified 'first' is the number of
+        // elements prior to the append, and, if the specified 'isUnique' is
+        // 'true', discard every appended element whose key is equivalent to
+        // that of an existing element or of an earlier appended element (see
+        // {Bulk Insertion}).
+
+    void shiftTail(SizeType              first,
+                   const PositionVector& positions,
+                   bslmf::MetaInt<1>    *);
+    void shiftTail(SizeType              first,
+                   const PositionVector& positions,
+                   bslmf::MetaInt<0>    *);
+        // Merge the leading 'positions.size()' elements at or after the
+        // specified 'first' index of this tree into the sorted elements
+        // before 'first', such that the element at 'first + j' is moved
+        // before the element at the index 'positions[j]' (and after any
+        // appended elements preceding it).  The first overload shifts the
+        // (bitwise-moveable) elements with 'memmove', and never throws; the
+        // second shifts the elements by assignment, and leaves this tree
+        // empty should an assignment throw.  The behavior is undefined
+        // unless 'positions' is non-decreasing, and each of its values is
+        // less than 'first'.
+
+    // PRIVATE ACCESSORS
+    SizeType gallopUpperBound(const KeyType& key,
+                              SizeType       begin,
+                              SizeType       end) const;
+        // Return the index of the first element in the range of indices
+        // '[begin .. end)' of this tree whose key is ordered after the
+        // specified 'key', or 'end' if there is no such element, searching
+        // exponentially from 'begin'.  The behavior is undefined unless no
+        // element before 'begin' has a key ordered after 'key'.
+
+    SizeType lowerBound(const KeyType& key,
+                        SizeType       begin,
+                        SizeType       end) const;
+        // Return the index of the first element in the range of indices
+        // '[begin .. end)' of this tree whose key is not ordered before the
+        // specified 'key', or 'end' if there is no such element.
+
+    SizeType upperBound(const KeyType& key,
+                        SizeType       begin,
+                        SizeType       end) const;
+        // Return the index of the first element in the range of indices
+        // '[begin .. end)' of this tree whose key is ordered after the
+        // specified 'key', or 'end' if there is no such element.
+
+  public:
+    // CREATORS
+    explicit FlatTree(const COMPARATOR& comparator     = COMPARATOR(),
+                      const ALLOCATOR&  basicAllocator = ALLOCATOR());
+        // Create an empty tree.  Optionally specify a 'comparator' used to
+        // order keys.  If 'comparator' is not supplied, a default-constructed
+        // object of the (template parameter) type 'COMPARATOR' is used.
+        // Optionally specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is not supplied, a default-constructed object of
+        // the (template parameter) type 'ALLOCATOR' is used.  No memory is
+        // allocated.
+
+    FlatTree(const FlatTree& original, const ALLOCATOR& basicAllocator);
+        // Create a tree having the same value and comparator as the specified
+        // 'original', and using the specified 'basicAllocator' to supply
+        // memory.
+
+    // ~FlatTree() = default;
+        // Destroy this object.
+
+    // MANIPULATORS
+    FlatTree& operator=(const FlatTree& rhs);
+        // Assign to this object the value and comparator of the specified
+        // 'rhs' object, and return a reference providing modifiable access to
+        // this object.  If an exception is thrown, this object is unchanged.
+
+    Iterator begin();
+        // Return an iterator referring to the first element of this tree, or
+        // 'end()' if this tree is empty.
+
+    Iterator end();
+        // Return the past-the-end iterator of this tree.
+
+    bsl::pair<SizeType, bool> insertUnique(const ValueType& value);
+        // Insert a copy of the specified 'value' into this tree if no element
+        // having an equivalent key is present.  Return a pair whose 'first'
+        // member is the index of the (possibly newly inserted) element having
+        // a key equivalent to that of 'value', and whose 'second' member is
+        // 'true' if an element was inserted, and 'false' otherwise.  If an
+        // exception is thrown, this tree is unchanged.
+
+    template <class INPUT_ITERATOR>
+    void insertUnique(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        // Insert into this tree a copy of each element in the range starting
+        // at the specified 'first' element, and ending immediately before
+        // the specified 'last' element, whose key is not equivalent to that
+        // of an element of this tree, or of an earlier element of the range
+        // (see {Bulk Insertion}).  See {Exception Safety} for the guarantee
+        // provided if an exception is thrown.
+
+    SizeType insertMulti(const ValueType& value);
+        // Insert a copy of the specified 'value' into this tree, after every
+        // element having an equivalent key, and return the index of the new
+        // element.  If an exception is thrown, this tree is unchanged.  Note
+        // that 'value' may refer to an element of this tree.
+
+    template <class INPUT_ITERATOR>
+    void insertMulti(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        // Insert into this tree a copy of each element in the range starting
+        // at the specified 'first' element, and ending immediately before
+        // the specified 'last' element, after every existing element having
+        // an equivalent key, and preserving the relative order of the
+        // inserted elements having equivalent keys (see {Bulk Insertion}).
+        // See {Exception Safety} for the guarantee provided if an exception
+        // is thrown.
+
+    SizeType insertIfMissing(const KeyType& key);
+        // Insert into this tree an element having the specified 'key' and a
+        // value-initialized mapped value, if no element having an equivalent
+        // key is present.  Return the index of the (possibly newly inserted)
+        // element having a key equivalent to 'key'.  If an exception is
+        // thrown, this tree is unchanged.  The behavior is undefined unless
+        // 'ValueType' is a 'pair' whose 'first' member has the type
+        // 'KeyType'.
+
+    void remove(SizeType index);
+        // Destroy the element at the specified 'index' of this tree.  The
+        // behavior is undefined unless 'index < size()'.
+
+    void remove(SizeType first, SizeType last);
+        // Destroy the elements of this tree at the indices in the range
+        // '[first .. last)'.  The behavior is undefined unless
+        // 'first <= last <= size()'.
+
+    void removeAll();
+        // Destroy every element of this tree, retaining the capacity of its
+        // vector.
+
+    void reserve(SizeType numElements);
+        // Change the capacity of this tree such that it can hold at least the
+        // specified 'numElements' without reallocating.
+
+    void shrinkToFit();
+        // Reduce the capacity of this tree, if possible, to its size.
+
+    void swap(FlatTree& other);
+        // Exchange the value and comparator of this object with those of the
+        // specified 'other' object.  This method provides the no-throw
+        // exception-safety guarantee unless the comparator throws on swap.
+        // The behavior is undefined unless this object has an allocator that
+        // compares equal to the allocator of 'other'.
+
+    // ACCESSORS
+    ALLOCATOR allocator() const;
+        // Return (a copy of) the allocator used by this tree.
+
+    ConstIterator begin() const;
+        // Return an iterator referring to the first element of this tree, or
+        // 'end()' if this tree is empty.
+
+    SizeType capacity() const;
+        // Return the number of elements this tree can hold without
+        // reallocating.
+
+    const COMPARATOR& comparator() const;
+        // Return a reference providing non-modifiable access to the
+        // key-ordering functor of this tree.
+
+    ConstIterator end() const;
+        // Return the past-the-end iterator of this tree.
+
+    SizeType find(const KeyType& key) const;
+        // Return the index of the first element of this tree having a key
+        // equivalent to the specified 'key', or 'size()' if there is no such
+        // element.
+
+    SizeType lowerBound(const KeyType& key) const;
+        // Return the index of the first element of this tree whose key is not
+        // ordered before the specified 'key', or 'size()' if there is no such
+        // element.
+
+    SizeType maxSize() const;
+        // Return a theoretical upper bound on the largest number of elements
+        // that this tree could possibly hold.
+
+    SizeType size() const;
+        // Return the number of elements in this tree.
+
+    SizeType upperBound(const KeyType& key) const;
+        // Return the index of the first element of this tree whose key is
+        // ordered after the specified 'key', or 'size()' if there is no such
+        // element.
+};
+
+// ============================================================================
+//                  TEMPLATE AND INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+                        // ----------------------
+                        // class FlatTree_Proctor
+                        // ----------------------
+
+// CREATORS
+template <class VECTOR>
+inline
+FlatTree_Proctor<VECTOR>::FlatTree_Proctor(VECTOR                     *vector,
+                                           typename VECTOR::size_type  size)
+: d_vector_p(vector)
+, d_size(size)
+{
+    BSLS_ASSERT_SAFE(vector);
+}
+
+template <class VECTOR>
+inline
+FlatTree_Proctor<VECTOR>::~FlatTree_Proctor()
+{
+    // A nested proctor may already have erased more elements than this one
+    // manages.
+
+    if (d_vector_p && d_size < d_vector_p->size()) {
+        d_vector_p->erase(d_vector_p->begin() + d_size, d_vector_p->end());
+    }
+}
+
+// MANIPULATORS
+template <class VECTOR>
+inline
+void FlatTree_Proctor<VECTOR>::release()
+{
+    d_vector_p = 0;
+}
+
+                        // --------------
+                        // class FlatTree
+                        // --------------
+
+// PRIVATE MANIPULATORS
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+void FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::insertionSort(
+                                                          ValueType *first,
+                                                          ValueType *last)
+{
+    for (ValueType *it = first + 1; it < last; ++it) {
+        const KeyType& key = KEY_CONFIG::extractKey(*it);
+        if (d_comparator(key, KEY_CONFIG::extractKey(it[-1]))) {
+            ValueType *position = first;
+            SizeType   length   = it - 1 - first;
+            while (0 < length) {
+                const SizeType half = length / 2;
+                if (d_comparator(key, KEY_CONFIG::extractKey(position[half])))
+                {
+                    length = half;
+                }
+                else {
+                    position += half + 1;
+                    length   -= half + 1;
+                }
+            }
+            if (k_IS_BITWISE_MOVEABLE) {
+                bslalg::ArrayPrimitives::rotate(position, it, it + 1);
+            }
+            else {
+                // 'rotate' would copy '*it' into a temporary using the
+                // default allocator, so make the copy using the allocator of
+                // this tree instead.
+
+                AllocatorType allocator(d_data.get_allocator());
+
+                bsls::ObjectBuffer<ValueType> buffer;
+                AllocatorTraits::construct(allocator, &buffer.object(), *it);
+                bslma::DestructorGuard<ValueType> guard(&buffer.object());
+
+                native_std::copy_backward(position, it, it + 1);
+                *position = buffer.object();
+            }
+        }
+    }
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+void FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::mergeRuns(
+                                                           ValueType *to,
+                                                           ValueType *from,
+                                                           SizeType   begin,
+                                                           SizeType   middle,
+                                                           SizeType   end)
+{
+    SizeType i = begin;
+    SizeType j = middle;
+    SizeType k = begin;
+
+    while (i < middle && j < end) {
+        if (d_comparator(KEY_CONFIG::extractKey(from[j]),
+                         KEY_CONFIG::extractKey(from[i]))) {
+            to[k++] = from[j++];
+        }
+        else {
+            to[k++] = from[i++];
+        }
+    }
+    for (; i < middle; ++i) {
+        to[k++] = from[i];
+    }
+    for (; j < end; ++j) {
+        to[k++] = from[j];
+    }
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+void FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::sortTail(SizeType first)
+{
+    ValueType      *base   = d_data.data() + first;
+    const SizeType  length = d_data.size() - first;
+
+    SizeType sorted = 1;
+    while (sorted < length
+        && !d_comparator(KEY_CONFIG::extractKey(base[sorted]),
+                         KEY_CONFIG::extractKey(base[sorted - 1]))) {
+        ++sorted;
+    }
+    if (sorted >= length) {
+        return;                                                       // RETURN
+    }
+
+    for (SizeType begin = 0; begin < length;
+                                         begin += k_INSERTION_SORT_LENGTH) {
+        const SizeType end = native_std::min<SizeType>(
+                                          begin + k_INSERTION_SORT_LENGTH,
+                                          length);
+        insertionSort(base + begin, base + end);
+    }
+    if (length <= k_INSERTION_SORT_LENGTH) {
+        return;                                                       // RETURN
+    }
+
+    // Merge adjacent runs, alternating between the tail of the vector and a
+    // buffer of equal length, and copy the result back if it ends up in the
+    // buffer.
+
+    VectorType  buffer(base, base + length, d_data.get_allocator());
+    ValueType  *from = base;
+    ValueType  *to   = buffer.data();
+
+    for (SizeType width = k_INSERTION_SORT_LENGTH; width < length;
+                                                                 width *= 2) {
+        for (SizeType begin = 0; begin < length; begin += 2 * width) {
+            const SizeType middle = native_std::min(begin + width, length);
+            const SizeType end    = native_std::min(middle + width, length);
+            mergeRuns(to, from, begin, middle, end);
+        }
+        native_std::swap(from, to);
+    }
+    if (from != base) {
+        native_std::copy(from, from + length, base);
+    }
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+void FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::mergeTail(SizeType first,
+                                                            bool     isUnique)
+{
+    if (first == d_data.size()) {
+        return;                                                       // RETURN
+    }
+
+    sortTail(first);
+
+    // Find, for each appended element, the position before which it belongs
+    // among the existing elements, discarding (for unique keys) duplicates,
+    // and compacting the remaining appended elements.  Since the appended
+    // elements are sorted, the positions are non-decreasing, and only a
+    // prefix of the appended elements (those ordered before the last
+    // existing element) need be moved.
+
+    ValueType      *base   = d_data.data();
+    const SizeType  length = d_data.size();
+
+    PositionVector positions(SizeAllocator(d_data.get_allocator()));
+
+    SizeType position = 0;
+    SizeType target   = first;
+    for (SizeType i = first; i < length; ++i) {
+        const KeyType& key = KEY_CONFIG::extractKey(base[i]);
+
+        if (isUnique && first < target
+         && !d_comparator(KEY_CONFIG::extractKey(base[target - 1]), key)) {
+            continue;                                               // CONTINUE
+        }
+
+        if (position < first) {
+            position = gallopUpperBound(key, position, first);
+        }
+
+        if (isUnique && 0 < position
+         && !d_comparator(KEY_CONFIG::extractKey(base[position - 1]), key)) {
+            continue;                                               // CONTINUE
+        }
+
+        if (position < first) {
+            positions.push_back(position);
+        }
+        else if (!isUnique) {
+            break;
+        }
+
+        if (target != i) {
+            base[target] = base[i];
+        }
+        ++target;
+    }
+
+    if (!isUnique) {
+        target = length;
+    }
+    d_data.erase(d_data.begin() + target, d_data.end());
+
+    if (!positions.empty()) {
+        shiftTail(first,
+                  positions,
+                  (bslmf::MetaInt<k_IS_BITWISE_MOVEABLE> *)0);
+    }
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+void FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::shiftTail(
+                                              SizeType              first,
+                                              const PositionVector& positions,
+                                              bslmf::MetaInt<1>    *)
+{
+    const SizeType numMoved = positions.size();
+
+    ALLOCATOR  allocator = d_data.get_allocator();
+    ValueType *buffer    = AllocatorTraits::allocate(allocator, numMoved);
+    ValueType *base      = d_data.data();
+
+    // Once the moved elements are in 'buffer', nothing can throw: each run of
+    // existing elements is shifted up, from the last run to the first, by
+    // the number of moved elements ordered before it.
+
+    native_std::memcpy(buffer, base + first, numMoved * sizeof(ValueType));
+
+    SizeType end = first;
+    for (SizeType j = numMoved; 0 < j--; ) {
+        const SizeType position = positions[j];
+        native_std::memmove(base + position + j + 1,
+                            base + position,
+                            (end - position) * sizeof(ValueType));
+        native_std::memcpy(base + position + j,
+                           buffer + j,
+                           sizeof(ValueType));
+        end = position;
+    }
+
+    AllocatorTraits::deallocate(allocator, buffer, numMoved);
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+void FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::shiftTail(
+                                              SizeType              first,
+                                              const PositionVector& positions,
+                                              bslmf::MetaInt<0>    *)
+{
+    const SizeType numMoved = positions.size();
+
+    ValueType        *base = d_data.data();
+    const VectorType  buffer(base + first,
+                             base + first + numMoved,
+                             d_data.get_allocator());
+
+    Proctor proctor(&d_data, 0);
+
+    SizeType end = first;
+    for (SizeType j = numMoved; 0 < j--; ) {
+        const SizeType position = positions[j];
+        native_std::copy_backward(base + position,
+                                  base + end,
+                                  base + end + j + 1);
+        base[position + j] = buffer[j];
+        end = position;
+    }
+
+    proctor.release();
+}
+
+// PRIVATE ACCESSORS
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+typename FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::SizeType
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::gallopUpperBound(
+                                                   const KeyType& key,
+                                                   SizeType       begin,
+                                                   SizeType       end) const
+{
+    const ValueType *base = d_data.data();
+
+    SizeType step  = 1;
+    SizeType probe = begin;
+    while (probe < end
+        && !d_comparator(key, KEY_CONFIG::extractKey(base[probe]))) {
+        begin  = probe + 1;
+        probe += step;
+        step  *= 2;
+    }
+    return upperBound(key, begin, native_std::min(probe, end));
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+typename FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::SizeType
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::lowerBound(
+                                                   const KeyType& key,
+                                                   SizeType       begin,
+                                                   SizeType       end) const
+{
+    if (begin == end) {
+        return begin;                                                 // RETURN
+    }
+
+    // Each step keeps 'base' at the last element known (or assumed, for the
+    // first element) to be ordered before 'key', selecting the next 'base'
+    // by a conditional move rather than a branch.
+
+    const ValueType *base   = d_data.data() + begin;
+    SizeType         length = end - begin;
+    while (1 < length) {
+        const SizeType half = length / 2;
+        base = d_comparator(KEY_CONFIG::extractKey(base[half]), key)
+               ? base + half
+               : base;
+        length -= half;
+    }
+    return (base - d_data.data())
+         + d_comparator(KEY_CONFIG::extractKey(*base), key);
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+typename FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::SizeType
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::upperBound(
+                                                   const KeyType& key,
+                                                   SizeType       begin,
+                                                   SizeType       end) const
+{
+    if (begin == end) {
+        return begin;                                                 // RETURN
+    }
+
+    const ValueType *base   = d_data.data() + begin;
+    SizeType         length = end - begin;
+    while (1 < length) {
+        const SizeType half = length / 2;
+        base = !d_comparator(key, KEY_CONFIG::extractKey(base[half]))
+               ? base + half
+               : base;
+        length -= half;
+    }
+    return (base - d_data.data())
+         + !d_comparator(key, KEY_CONFIG::extractKey(*base));
+}
+
+// CREATORS
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::FlatTree(
+                                            const COMPARATOR& comparator,
+                                            const ALLOCATOR&  basicAllocator)
+: d_data(basicAllocator)
+, d_comparator(comparator)
+{
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::FlatTree(
+                                              const FlatTree&  original,
+                                              const ALLOCATOR& basicAllocator)
+: d_data(original.d_data, basicAllocator)
+, d_comparator(original.d_comparator)
+{
+}
+
+// MANIPULATORS
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>&
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::operator=(const FlatTree& rhs)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(this != &rhs)) {
+        FlatTree other(rhs, d_data.get_allocator());
+        swap(other);
+    }
+    return *this;
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+typename FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::Iterator
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::begin()
+{
+    return d_data.begin();
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+typename FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::Iterator
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::end()
+{
+    return d_data.end();
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+bsl::pair<typename FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::SizeType,
+          bool>
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::insertUnique(
+                                                       const ValueType& value)
+{
+    typedef bsl::pair<SizeType, bool> ResultType;
+
+    const KeyType& key   = KEY_CONFIG::extractKey(value);
+    const SizeType index = lowerBound(key, 0, d_data.size());
+
+    if (index < d_data.size()
+     && !d_comparator(key, KEY_CONFIG::extractKey(d_data[index]))) {
+        return ResultType(index, false);                              // RETURN
+    }
+    d_data.insert(d_data.begin() + index, value);
+    return ResultType(index, true);
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+void FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::insertUnique(
+                                                        INPUT_ITERATOR first,
+                                                        INPUT_ITERATOR last)
+{
+    const SizeType size = d_data.size();
+
+    Proctor proctor(&d_data, size);
+    d_data.insert(d_data.end(), first, last);
+    mergeTail(size, true);
+    proctor.release();
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+typename FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::SizeType
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::insertMulti(
+                                                       const ValueType& value)
+{
+    // 'vector::insert' supports 'value' referring to an element of the
+    // vector, and the index is computed before anything is moved.
+
+    const SizeType index = upperBound(KEY_CONFIG::extractKey(value),
+                                      0,
+                                      d_data.size());
+    d_data.insert(d_data.begin() + index, value);
+    return index;
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+void FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::insertMulti(
+                                                        INPUT_ITERATOR first,
+                                                        INPUT_ITERATOR last)
+{
+    const SizeType size = d_data.size();
+
+    Proctor proctor(&d_data, size);
+    d_data.insert(d_data.end(), first, last);
+    mergeTail(size, false);
+    proctor.release();
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+typename FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::SizeType
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::insertIfMissing(
+                                                            const KeyType& key)
+{
+    typedef typename ValueType::second_type MappedType;
+
+    const SizeType index = lowerBound(key, 0, d_data.size());
+
+    if (index == d_data.size()
+     || d_comparator(key, KEY_CONFIG::extractKey(d_data[index]))) {
+        // Create the new element using the allocator of this tree, so that
+        // the default allocator is not used for the temporary.
+
+        AllocatorType                 allocator(d_data.get_allocator());
+        bsls::ObjectBuffer<ValueType> buffer;
+        AllocatorTraits::construct(allocator,
+                                   &buffer.object(),
+                                   key,
+                                   MappedType());
+        bslma::DestructorGuard<ValueType> guard(&buffer.object());
+
+        d_data.insert(d_data.begin() + index, buffer.object());
+    }
+    return index;
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+void FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::remove(SizeType index)
+{
+    BSLS_ASSERT_SAFE(index < d_data.size());
+
+    d_data.erase(d_data.begin() + index);
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+void FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::remove(SizeType first,
+                                                         SizeType last)
+{
+    BSLS_ASSERT_SAFE(first <= last);
+    BSLS_ASSERT_SAFE(last  <= d_data.size());
+
+    d_data.erase(d_data.begin() + first, d_data.begin() + last);
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+void FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::removeAll()
+{
+    d_data.clear();
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+void FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::reserve(
+                                                          SizeType numElements)
+{
+    d_data.reserve(numElements);
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+void FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::shrinkToFit()
+{
+    d_data.shrink_to_fit();
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+void FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::swap(FlatTree& other)
+{
+    // C++11 behavior: undefined for unequal allocators
+
+    BSLS_ASSERT(d_data.get_allocator() == other.d_data.get_allocator());
+
+    bslalg::SwapUtil::swap(&d_comparator, &other.d_comparator);
+    d_data.swap(other.d_data);
+}
+
+// ACCESSORS
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+ALLOCATOR FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::allocator() const
+{
+    return d_data.get_allocator();
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+typename FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::ConstIterator
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::begin() const
+{
+    return d_data.begin();
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+typename FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::SizeType
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::capacity() const
+{
+    return d_data.capacity();
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+const COMPARATOR&
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::comparator() const
+{
+    return d_comparator;
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+typename FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::ConstIterator
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::end() const
+{
+    return d_data.end();
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+typename FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::SizeType
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::find(const KeyType& key) const
+{
+    const SizeType index = lowerBound(key, 0, d_data.size());
+
+    return index < d_data.size()
+        && !d_comparator(key, KEY_CONFIG::extractKey(d_data[index]))
+           ? index
+           : d_data.size();
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+typename FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::SizeType
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::lowerBound(
+                                                     const KeyType& key) const
+{
+    return lowerBound(key, 0, d_data.size());
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+typename FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::SizeType
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::maxSize() const
+{
+    return d_data.max_size();
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+typename FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::SizeType
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::size() const
+{
+    return d_data.size();
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+typename FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::SizeType
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::upperBound(
+                                                     const KeyType& key) const
+{
+    return upperBound(key, 0, d_data.size());
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
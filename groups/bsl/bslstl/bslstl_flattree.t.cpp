@@ -0,0 +1,1319 @@
+// bslstl_flattree.t.cpp                                              -*-C++-*-
+
+#include <bslstl_flattree.h>
+
+#include <bslstl_allocator.h>
+#include <bslstl_map.h>
+#include <bslstl_pair.h>
+#include <bslstl_string.h>
+#include <bslstl_unorderedmapkeyconfiguration.h>
+#include <bslstl_unorderedsetkeyconfiguration.h>
+#include <bslstl_vector.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatorexception.h>
+#include <bslma_testallocatormonitor.h>
+#include <bslma_usesbslmaallocator.h>
+#include <bslmf_isbitwisemoveable.h>
+#include <bslmf_nestedtraitdeclaration.h>
+#include <bsls_bsltestutil.h>
+#include <bsls_nativestd.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+
+using namespace BloombergLP;
+using namespace std;
+
+//=============================================================================
+//                             TEST PLAN
+//-----------------------------------------------------------------------------
+//                             Overview
+//                             --------
+// The component under test is a sorted vector that is an implementation
+// detail of 'bsl::flat_map', 'bsl::flat_set', and 'bsl::flat_multimap'.  We
+// first verify the proctor used to truncate the vector on failure.  We then
+// drive trees with a pseudo-random sequence of single-element insertions and
+// removals, comparing the contents of the tree, and the results of its
+// searches, with a reference array after every operation.  The heart of this
+// test driver is the verification of bulk insertion, whose sort and merge
+// are hand-written: we insert ranges of every shape (empty, shorter and
+// longer than the runs sorted by insertion sort, sorted, reverse sorted,
+// unsorted, with and without equivalent keys, and preceding, following, or
+// interleaving with the existing elements) into trees holding elements of
+// each kind the implementation distinguishes (bitwise-moveable pairs,
+// integers, pointers, which select the 'bsl::vector' specialization for
+// pointers, and a type that is neither bitwise-moveable nor allocation-free),
+// and compare the result with a reference computed by the (stable) insertion
+// of one element at a time.  Finally we verify the exception-safety
+// guarantees of bulk insertion, and copy construction, assignment, swap, and
+// the capacity manipulators.
+//-----------------------------------------------------------------------------
+// FlatTree_Proctor
+// [ 2] FlatTree_Proctor(VECTOR *vector, size_type size);
+// [ 2] ~FlatTree_Proctor();
+// [ 2] void release();
+//
+// CREATORS
+// [ 1] explicit FlatTree(const COMPARATOR&, const ALLOCATOR&);
+// [ 6] FlatTree(const FlatTree& original, const ALLOCATOR& allocator);
+// [ 1] ~FlatTree();
+//
+// MANIPULATORS
+// [ 6] FlatTree& operator=(const FlatTree& rhs);
+// [ 1] Iterator begin();
+// [ 1] Iterator end();
+// [ 3] pair<SizeType, bool> insertUnique(const ValueType& value);
+// [ 4] void insertUnique(INPUT_ITERATOR first, INPUT_ITERATOR last);
+// [ 3] SizeType insertMulti(const ValueType& value);
+// [ 4] void insertMulti(INPUT_ITERATOR first, INPUT_ITERATOR last);
+// [ 3] SizeType insertIfMissing(const KeyType& key);
+// [ 3] void remove(SizeType index);
+// [ 3] void remove(SizeType first, SizeType last);
+// [ 3] void removeAll();
+// [ 6] void reserve(SizeType numElements);
+// [ 6] void shrinkToFit();
+// [ 6] void swap(FlatTree& other);
+//
+// ACCESSORS
+// [ 6] ALLOCATOR allocator() const;
+// [ 1] ConstIterator begin() const;
+// [ 6] SizeType capacity() const;
+// [ 1] const COMPARATOR& comparator() const;
+// [ 1] ConstIterator end() const;
+// [ 3] SizeType find(const KeyType& key) const;
+// [ 3] SizeType lowerBound(const KeyType& key) const;
+// [ 1] SizeType maxSize() const;
+// [ 1] SizeType size() const;
+// [ 3] SizeType upperBound(const KeyType& key) const;
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 5] CONCERN: Bulk insertion is exception safe
+//-----------------------------------------------------------------------------
+
+//=============================================================================
+//                  STANDARD BDE ASSERT TEST MACRO
+//-----------------------------------------------------------------------------
+static int testStatus = 0;
+
+static void aSsErT(bool b, const char *s, int i) {
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+//=============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef bsl::pair<int, int>                                 IntPair;
+    // A key (the 'first' member) and a sequence number (the 'second'
+    // member) identifying the insertion that created an element.
+
+typedef bslstl::UnorderedMapKeyConfiguration<IntPair>       PairConfig;
+typedef bslstl::UnorderedSetKeyConfiguration<int>           IntConfig;
+typedef bslstl::UnorderedSetKeyConfiguration<const int *>   PointerConfig;
+
+typedef bslstl::FlatTree<PairConfig,
+                         native_std::less<int>,
+                         bsl::allocator<IntPair> >          Obj;
+
+typedef bslstl::FlatTree<PairConfig,
+                         native_std::greater<int>,
+                         bsl::allocator<IntPair> >          GreaterObj;
+
+typedef bslstl::FlatTree<IntConfig,
+                         native_std::less<int>,
+                         bsl::allocator<int> >              IntObj;
+
+typedef bslstl::FlatTree<PointerConfig,
+                         native_std::less<const int *>,
+                         bsl::allocator<const int *> >      PointerObj;
+
+namespace {
+
+const int MAX_KEY = 2048;  // keys are in the range '[0 .. MAX_KEY)'
+
+int POINTS[MAX_KEY];       // the elements of a 'PointerObj' point into this
+                           // array, and are ordered by address
+
+class Payload {
+    // This class holds a key and a sequence number, and a string that
+    // allocates memory, and counts the number of live objects.  It is neither
+    // bitwise-moveable nor allocation-free, so its elements are shifted by
+    // assignment, and copying one may throw.
+
+    // DATA
+    int         d_key;
+    int         d_sequence;
+    bsl::string d_text;
+
+  public:
+    // CLASS DATA
+    static int s_numLive;
+
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(Payload, bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    Payload(int key, int sequence, bslma::Allocator *basicAllocator = 0)
+        // Create an object having the specified 'key' and 'sequence' number.
+        // Optionally specify a 'basicAllocator' used to supply memory.
+    : d_key(key)
+    , d_sequence(sequence)
+    , d_text("This string is long enough to allocate.", basicAllocator)
+    {
+        ++s_numLive;
+    }
+
+    Payload(const Payload& original, bslma::Allocator *basicAllocator = 0)
+        // Create an object having the value of the specified 'original'.
+        // Optionally specify a 'basicAllocator' used to supply memory.
+    : d_key(original.d_key)
+    , d_sequence(original.d_sequence)
+    , d_text(original.d_text, basicAllocator)
+    {
+        ++s_numLive;
+    }
+
+    ~Payload()
+        // Destroy this object.
+    {
+        --s_numLive;
+    }
+
+    // MANIPULATORS
+    Payload& operator=(const Payload& rhs)
+        // Assign to this object the value of the specified 'rhs', and return
+        // a reference providing modifiable access to this object.
+    {
+        d_text     = rhs.d_text;
+        d_key      = rhs.d_key;
+        d_sequence = rhs.d_sequence;
+        return *this;
+    }
+
+    // ACCESSORS
+    int key() const
+        // Return the key of this object.
+    {
+        return d_key;
+    }
+
+    int sequence() const
+        // Return the sequence number of this object.
+    {
+        return d_sequence;
+    }
+};
+
+int Payload::s_numLive = 0;
+
+struct PayloadLess {
+    // This 'struct' orders 'Payload' objects by key.
+
+    bool operator()(const Payload& lhs, const Payload& rhs) const
+        // Return 'true' if the key of the specified 'lhs' is less than that
+        // of the specified 'rhs', and 'false' otherwise.
+    {
+        return lhs.key() < rhs.key();
+    }
+};
+
+typedef bslstl::UnorderedSetKeyConfiguration<Payload>       PayloadConfig;
+
+typedef bslstl::FlatTree<PayloadConfig,
+                         PayloadLess,
+                         bsl::allocator<Payload> >          PayloadObj;
+
+int keyOf(const IntPair& value)
+    // Return the key of the specified 'value'.
+{
+    return value.first;
+}
+
+int keyOf(int value)
+    // Return the specified 'value'.
+{
+    return value;
+}
+
+int keyOf(const int *value)
+    // Return the index in 'POINTS' of the element at the specified 'value'.
+{
+    return static_cast<int>(value - POINTS);
+}
+
+int keyOf(const Payload& value)
+    // Return the key of the specified 'value'.
+{
+    return value.key();
+}
+
+int sequenceOf(const IntPair& value)
+    // Return the sequence number of the specified 'value'.
+{
+    return value.second;
+}
+
+int sequenceOf(int)
+    // Return -1, indicating that an 'int' has no sequence number.
+{
+    return -1;
+}
+
+int sequenceOf(const int *)
+    // Return -1, indicating that a pointer has no sequence number.
+{
+    return -1;
+}
+
+int sequenceOf(const Payload& value)
+    // Return the sequence number of the specified 'value'.
+{
+    return value.sequence();
+}
+
+template <class VALUE_TYPE>
+struct MakeValue;
+    // This 'struct' provides a function creating an element having a given
+    // key and sequence number.
+
+template <>
+struct MakeValue<IntPair> {
+    static IntPair make(int key, int sequence)
+        // Return a pair having the specified 'key' and 'sequence' number.
+    {
+        return IntPair(key, sequence);
+    }
+};
+
+template <>
+struct MakeValue<int> {
+    static int make(int key, int)
+        // Return the specified 'key'.
+    {
+        return key;
+    }
+};
+
+template <>
+struct MakeValue<const int *> {
+    static const int *make(int key, int)
+        // Return the address of the element of 'POINTS' at the specified
+        // 'key'.
+    {
+        return POINTS + key;
+    }
+};
+
+template <>
+struct MakeValue<Payload> {
+    static Payload make(int key, int sequence)
+        // Return an object having the specified 'key' and 'sequence' number.
+    {
+        return Payload(key, sequence);
+    }
+};
+
+class Random {
+    // This class provides a deterministic linear congruential generator.
+
+    // DATA
+    unsigned int d_state;
+
+  public:
+    // CREATORS
+    explicit Random(unsigned int seed) : d_state(seed) {}
+        // Create a generator having the specified 'seed'.
+
+    // MANIPULATORS
+    int operator()(int range)
+        // Return a pseudo-random integer in the range '[0, range)'.
+    {
+        d_state = d_state * 1103515245u + 12345u;
+        return static_cast<int>((d_state >> 8) % range);
+    }
+};
+
+template <class TREE>
+struct ReferenceUtil {
+    // This 'struct' provides a namespace for functions maintaining a
+    // reference array of (key, sequence number) pairs modeling a 'TREE'.
+
+    typedef typename TREE::ValueType ValueType;
+    typedef typename TREE::KeyType   KeyType;
+
+    static KeyType key(int key)
+        // Return the key of 'TREE' corresponding to the specified 'key'.
+    {
+        return MakeValue<KeyType>::make(key, 0);
+    }
+
+    static bool less(int lhs, int rhs)
+        // Return 'true' if the specified 'lhs' key is ordered before the
+        // specified 'rhs' key by the comparator of 'TREE', and 'false'
+        // otherwise.
+    {
+        return typename TREE::ComparatorType()(key(lhs), key(rhs));
+    }
+
+    static void insert(bsl::vector<IntPair> *reference,
+                       int                   key,
+                       int                   sequence,
+                       bool                  isMulti)
+        // Insert into the specified 'reference' the specified 'key' and
+        // 'sequence' number, after every element having an equivalent key if
+        // the specified 'isMulti' is 'true', and only if no element has an
+        // equivalent key otherwise.
+    {
+        native_std::size_t index = 0;
+        while (index < reference->size()
+            && !less(key, (*reference)[index].first)) {
+            ++index;
+        }
+        if (!isMulti
+         && 0 < index
+         && !less((*reference)[index - 1].first, key)) {
+            return;                                                   // RETURN
+        }
+        reference->insert(reference->begin() + index,
+                          IntPair(key, sequence));
+    }
+
+    static bool isSame(const TREE& tree, const bsl::vector<IntPair>& reference)
+        // Return 'true' if the elements of the specified 'tree' have the keys
+        // and (if the elements have sequence numbers) the sequence numbers of
+        // the elements of the specified 'reference', in order, and 'false'
+        // otherwise.
+    {
+        if (tree.size() != reference.size()) {
+            return false;                                             // RETURN
+        }
+        for (native_std::size_t i = 0; i < reference.size(); ++i) {
+            const ValueType& value = tree.begin()[i];
+            if (keyOf(value) != reference[i].first
+             || (0 <= sequenceOf(value)
+              && sequenceOf(value) != reference[i].second)) {
+                return false;                                         // RETURN
+            }
+        }
+        return true;
+    }
+};
+
+template <class TREE>
+void testRandom(unsigned int seed, int range, int numOperations, bool isMulti)
+    // Apply the specified 'numOperations' pseudo-random single-element
+    // insertions (using 'insertMulti' if the specified 'isMulti' is 'true',
+    // and 'insertUnique' otherwise) and removals of keys in the range
+    // '[0, range)', generated from the specified 'seed', to a 'TREE', and
+    // verify the contents of the tree, and the results of its searches,
+    // against a reference array after each operation.
+{
+    typedef typename TREE::KeyType   KeyType;
+    typedef typename TREE::ValueType ValueType;
+    typedef typename TREE::SizeType  SizeType;
+    typedef ReferenceUtil<TREE>      Util;
+
+    bslma::TestAllocator oa("object", false);
+
+    Random               random(seed);
+    bsl::vector<IntPair> reference;
+    {
+        TREE mX((typename TREE::ComparatorType()),
+                typename TREE::AllocatorType(&oa));
+        const TREE& X = mX;
+
+        for (int op = 0; op < numOperations; ++op) {
+            // Grow the tree over the first half of the operations, and shrink
+            // it over the second half.
+
+            const int     key       = random(range);
+            const KeyType searchKey = Util::key(key);
+            const int     percent   = op < numOperations / 2 ? 70 : 30;
+            const int     kind      = random(100);
+
+            if (kind < percent) {
+                if (isMulti) {
+                    const SizeType index = mX.insertMulti(
+                                            MakeValue<ValueType>::make(key,
+                                                                       op));
+                    ASSERTV(op, key == keyOf(X.begin()[index]));
+                    ASSERTV(op, index + 1 == X.upperBound(searchKey));
+                }
+                else {
+                    const SizeType  size   = X.size();
+                    const bsl::pair<SizeType, bool> result =
+                                      mX.insertUnique(
+                                            MakeValue<ValueType>::make(key,
+                                                                       op));
+                    ASSERTV(op, key == keyOf(X.begin()[result.first]));
+                    ASSERTV(op, result.second == (size < X.size()));
+                }
+                Util::insert(&reference, key, op, isMulti);
+            }
+            else if (kind < percent + 10) {
+                // Remove every element having 'key'.
+
+                const SizeType first = X.lowerBound(searchKey);
+                const SizeType last  = X.upperBound(searchKey);
+                mX.remove(first, last);
+                reference.erase(reference.begin() + first,
+                                reference.begin() + last);
+            }
+            else {
+                // Remove the element returned by 'find', which is the first
+                // element having 'key', if any.
+
+                const SizeType index = X.find(searchKey);
+                ASSERTV(op, index == X.size()
+                         || (index == X.lowerBound(searchKey)
+                          && key == keyOf(X.begin()[index])));
+                if (index != X.size()) {
+                    mX.remove(index);
+                    reference.erase(reference.begin() + index);
+                }
+            }
+            ASSERTV(op, Util::isSame(X, reference));
+
+            // Verify the searches against the reference for a few keys.
+
+            for (int j = 0; j < 3; ++j) {
+                const int probe = random(range + 1);
+                SizeType  less  = 0;
+                SizeType  equal = 0;
+                for (native_std::size_t k = 0; k < reference.size(); ++k) {
+                    less  += Util::less(reference[k].first, probe);
+                    equal += !Util::less(reference[k].first, probe)
+                          && !Util::less(probe, reference[k].first);
+                }
+                const KeyType probeKey = Util::key(probe);
+                ASSERTV(op, probe, less == X.lowerBound(probeKey));
+                ASSERTV(op, probe, less + equal == X.upperBound(probeKey));
+                ASSERTV(op, probe,
+                        (0 == equal ? X.size() : less) == X.find(probeKey));
+            }
+        }
+
+        mX.removeAll();
+        ASSERT(0 == X.size());
+        ASSERT(X.begin() == X.end());
+    }
+    ASSERT(0 == oa.numBlocksInUse());
+}
+
+void makeKeys(bsl::vector<int> *result,
+              int               count,
+              int               first,
+              int               step,
+              int               spread,
+              unsigned int      seed)
+    // Load into the specified 'result' the specified 'count' keys, the
+    // 'i'th of which is the specified 'first' plus 'i' times the specified
+    // 'step', plus (if the specified 'spread' is not 0) a pseudo-random
+    // offset in '[0 .. spread)' generated from the specified 'seed'.
+{
+    Random random(seed);
+
+    result->clear();
+    for (int i = 0; i < count; ++i) {
+        result->push_back(first + i * step + (spread ? random(spread) : 0));
+    }
+}
+
+template <class TREE>
+void testBulkInsertion(int                     line,
+                       const bsl::vector<int>& initial,
+                       const bsl::vector<int>& range,
+                       bool                    isMulti)
+    // Create a 'TREE' holding the specified 'initial' keys, inserted one at
+    // a time (using 'insertMulti' if the specified 'isMulti' is 'true', and
+    // 'insertUnique' otherwise), insert the specified 'range' of keys as a
+    // single range, and verify the result against a reference array built by
+    // inserting the keys of the range one at a time, using the specified
+    // 'line' to identify the test.  Verify also that the range insertion
+    // allocates memory only from the allocator of the tree, and that no
+    // memory is leaked.
+{
+    typedef typename TREE::ValueType ValueType;
+    typedef ReferenceUtil<TREE>      Util;
+
+    bslma::TestAllocator oa("object",  false);
+    bslma::TestAllocator sa("scratch", false);
+
+    bsl::vector<IntPair> reference;
+
+    const int NUM_LIVE = Payload::s_numLive;
+    {
+        TREE mX((typename TREE::ComparatorType()),
+                typename TREE::AllocatorType(&oa));
+        const TREE& X = mX;
+
+        for (native_std::size_t i = 0; i < initial.size(); ++i) {
+            const int SEQUENCE = static_cast<int>(i);
+            if (isMulti) {
+                mX.insertMulti(MakeValue<ValueType>::make(initial[i],
+                                                          SEQUENCE));
+            }
+            else {
+                mX.insertUnique(MakeValue<ValueType>::make(initial[i],
+                                                           SEQUENCE));
+            }
+            Util::insert(&reference, initial[i], SEQUENCE, isMulti);
+        }
+        LOOP_ASSERT(line, Util::isSame(X, reference));
+
+        bsl::vector<ValueType> values(&sa);
+        for (native_std::size_t i = 0; i < range.size(); ++i) {
+            const int SEQUENCE = 10000 + static_cast<int>(i);
+            values.push_back(MakeValue<ValueType>::make(range[i], SEQUENCE));
+            Util::insert(&reference, range[i], SEQUENCE, isMulti);
+        }
+
+        bslma::TestAllocator *da = dynamic_cast<bslma::TestAllocator *>(
+                                                 bslma::Default::allocator());
+        bslma::TestAllocatorMonitor dam(da);
+
+        if (isMulti) {
+            mX.insertMulti(values.begin(), values.end());
+        }
+        else {
+            mX.insertUnique(values.begin(), values.end());
+        }
+        LOOP_ASSERT(line, dam.isTotalSame());
+        LOOP_ASSERT(line, Util::isSame(X, reference));
+    }
+    LOOP_ASSERT(line, 0 == oa.numBlocksInUse());
+    LOOP_ASSERT(line, NUM_LIVE == Payload::s_numLive);
+}
+
+template <class TREE>
+void testExceptionSafety(int                     line,
+                         const bsl::vector<int>& initial,
+                         const bsl::vector<int>& range,
+                         bool                    isMulti)
+    // Create a 'TREE' holding the specified 'initial' keys, and insert the
+    // specified 'range' of keys as a single range (using 'insertMulti' if the
+    // specified 'isMulti' is 'true', and 'insertUnique' otherwise), having
+    // the allocator of the tree throw on each successive allocation, and
+    // verify that, after each exception, the tree has its original value or,
+    // if the 'ValueType' of 'TREE' is not bitwise-moveable, is empty, and
+    // that no memory or element is leaked, using the specified 'line' to
+    // identify the test.
+{
+    typedef typename TREE::ValueType ValueType;
+
+    const bool IS_BITWISE_MOVEABLE =
+                                  bslmf::IsBitwiseMoveable<ValueType>::value;
+
+    bslma::TestAllocator oa("object",  false);
+    bslma::TestAllocator sa("scratch", false);
+
+    const int NUM_LIVE = Payload::s_numLive;
+    {
+        TREE mZ((typename TREE::ComparatorType()),
+                typename TREE::AllocatorType(&sa));
+        const TREE& Z = mZ;
+        for (native_std::size_t i = 0; i < initial.size(); ++i) {
+            const int SEQUENCE = static_cast<int>(i);
+            if (isMulti) {
+                mZ.insertMulti(MakeValue<ValueType>::make(initial[i],
+                                                          SEQUENCE));
+            }
+            else {
+                mZ.insertUnique(MakeValue<ValueType>::make(initial[i],
+                                                           SEQUENCE));
+            }
+        }
+
+        bsl::vector<IntPair> original(&sa);
+        for (typename TREE::ConstIterator it = Z.begin(); it != Z.end();
+                                                                       ++it) {
+            original.push_back(IntPair(keyOf(*it), sequenceOf(*it)));
+        }
+
+        bsl::vector<ValueType> values(&sa);
+        for (native_std::size_t i = 0; i < range.size(); ++i) {
+            values.push_back(MakeValue<ValueType>::make(
+                                           range[i],
+                                           10000 + static_cast<int>(i)));
+        }
+
+        int numThrows = 0;
+        for (int limit = 0; ; ++limit) {
+            TREE mX(Z, typename TREE::AllocatorType(&oa));  const TREE& X = mX;
+
+            oa.setAllocationLimit(limit);
+            try {
+                if (isMulti) {
+                    mX.insertMulti(values.begin(), values.end());
+                }
+                else {
+                    mX.insertUnique(values.begin(), values.end());
+                }
+            }
+            catch (const bslma::TestAllocatorException&) {
+                oa.setAllocationLimit(-1);
+                ++numThrows;
+                LOOP2_ASSERT(line, limit,
+                             ReferenceUtil<TREE>::isSame(X, original)
+                          || (!IS_BITWISE_MOVEABLE && 0 == X.size()));
+                continue;
+            }
+            oa.setAllocationLimit(-1);
+            break;
+        }
+        LOOP_ASSERT(line, range.empty() || 0 < numThrows);
+    }
+    LOOP_ASSERT(line, 0 == oa.numBlocksInUse());
+    LOOP_ASSERT(line, NUM_LIVE == Payload::s_numLive);
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+    bool verbose = argc > 2;
+    bool veryVerbose = argc > 3;
+    bool veryVeryVerbose = argc > 4;
+
+    (void)veryVerbose;
+    (void)veryVeryVerbose;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVerbose);
+    bslma::DefaultAllocatorGuard defaultAllocatorGuard(&defaultAllocator);
+
+    // The ranges of keys, in '[0 .. MAX_KEY)', inserted by the bulk-insertion
+    // tests (see 'makeKeys').
+
+    static const struct {
+        int d_line;         // source line number
+        int d_numInitial;   // number of keys initially inserted
+        int d_initFirst;    // first initial key
+        int d_initStep;     // step between initial keys
+        int d_initSpread;   // spread of pseudo-random offsets, or 0
+        int d_numRange;     // number of keys inserted as a range
+        int d_first;        // first key of the range
+        int d_step;         // step between the keys of the range
+        int d_spread;       // spread of pseudo-random offsets, or 0
+    } DATA[] = {
+        //          INITIAL                     RANGE
+        //    --------------------  ---------------------------
+        //LINE  N  FIRST STEP SPREAD     N  FIRST  STEP  SPREAD
+        //---- --  ----- ---- ------  ----  -----  ----  ------
+        { L_,   0,    0,   0,     0,     0,     0,    0,      0 },
+        { L_,   0,    0,   0,     0,     1,     5,    0,      0 },
+        { L_,   0,    0,   0,     0,    15,     0,    1,      0 },
+        { L_,   0,    0,   0,     0,    16,   200,   -1,      0 },
+        { L_,   0,    0,   0,     0,    17,   200,   -1,      0 },
+        { L_,   0,    0,   0,     0,    33,     0,    0,     40 },
+        { L_,   0,    0,   0,     0,   100,     7,    0,      1 },
+        { L_,   0,    0,   0,     0,   100,     0,    0,      3 },
+        { L_,   0,    0,   0,     0,  1000,     0,    1,      0 },
+        { L_,   0,    0,   0,     0,  1000,  1000,   -1,      0 },
+        { L_,   0,    0,   0,     0,  1000,     0,    0,    500 },
+        { L_,  50,  100,   2,     0,     0,     0,    0,      0 },
+        { L_,  50,  100,   2,     0,    20,     0,    1,      0 },
+        { L_,  50,  100,   2,     0,    20,   300,    1,      0 },
+        { L_,  50,  100,   2,     0,    50,   101,    2,      0 },
+        { L_,  50,  100,   2,     0,    50,   100,    2,      0 },
+        { L_,  50,  100,   2,     0,   100,   150,    1,      0 },
+        { L_,  50,  100,   2,     0,   100,   249,   -1,      0 },
+        { L_,  50,  100,   2,     0,   300,     0,    0,    400 },
+        { L_, 200,    0,   0,   100,   200,     0,    0,    100 },
+        { L_, 200,    0,   0,    20,   200,     0,    0,     20 },
+        { L_,1000,    0,   1,     0,     5,     0,    0,   1000 },
+        { L_,   5,    0,   0,  1000,  1000,     0,    0,   1000 },
+    };
+    const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 6: {
+        // --------------------------------------------------------------------
+        // COPY, ASSIGNMENT, SWAP, AND CAPACITY
+        //
+        // Concerns:
+        //: 1 A copy has the same value as the original, and uses the supplied
+        //:   allocator.
+        //:
+        //: 2 Assignment gives the target the value of the source, and retains
+        //:   the allocator of the target.
+        //:
+        //: 3 Swap exchanges the values and comparators of two trees having
+        //:   equal allocators without allocating memory.
+        //:
+        //: 4 'reserve' provides capacity for at least the requested number of
+        //:   elements, so that inserting that many elements does not
+        //:   allocate memory, and 'shrinkToFit' reduces the capacity to the
+        //:   size.
+        //:
+        //: 5 'removeAll' does not change the capacity.
+        //:
+        //: 6 No memory is leaked.
+        //
+        // Plan:
+        //: 1 Copy, assign, and swap trees of several sizes, holding
+        //:   'Payload' elements that allocate memory, using test allocators,
+        //:   and verify the value, allocator, and allocations of each
+        //:   result.  (C-1..3, 6)
+        //:
+        //: 2 Reserve capacity in a tree, insert that many elements one at a
+        //:   time and verify, using a test allocator monitor, that no memory
+        //:   is allocated; then call 'remove', 'shrinkToFit', and
+        //:   'removeAll' and verify 'capacity'.  (C-4..6)
+        //
+        // Testing:
+        //   FlatTree(const FlatTree& original, const ALLOCATOR& allocator);
+        //   FlatTree& operator=(const FlatTree& rhs);
+        //   void reserve(SizeType numElements);
+        //   void shrinkToFit();
+        //   void swap(FlatTree& other);
+        //   ALLOCATOR allocator() const;
+        //   SizeType capacity() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCOPY, ASSIGNMENT, SWAP, AND CAPACITY"
+                            "\n====================================\n");
+
+        typedef ReferenceUtil<PayloadObj> Util;
+
+        bslma::TestAllocator oa("object", veryVeryVerbose);
+        bslma::TestAllocator za("other",  veryVeryVerbose);
+
+        if (verbose) printf("\nTesting copy, assignment, and swap.\n");
+
+        static const int SIZES[] = { 0, 1, 2, 15, 16, 17, 100 };
+        const int NUM_SIZES = sizeof SIZES / sizeof *SIZES;
+
+        for (int ti = 0; ti < NUM_SIZES; ++ti) {
+            const int N = SIZES[ti];
+
+            bsl::vector<IntPair> reference;
+            {
+                PayloadObj mX(PayloadLess(), &oa);  const PayloadObj& X = mX;
+                for (int i = 0; i < N; ++i) {
+                    mX.insertMulti(Payload((i * 7) % 10, i));
+                    Util::insert(&reference, (i * 7) % 10, i, true);
+                }
+                LOOP_ASSERT(N, Util::isSame(X, reference));
+
+                {
+                    PayloadObj mY(X, &za);  const PayloadObj& Y = mY;
+                    LOOP_ASSERT(N, Util::isSame(Y, reference));
+                    LOOP_ASSERT(N, &za == Y.allocator().mechanism());
+                    LOOP_ASSERT(N, 0 == N || 0 < za.numBlocksInUse());
+                }
+                {
+                    PayloadObj mY(PayloadLess(), &za);
+                    const PayloadObj& Y = mY;
+                    mY.insertUnique(Payload(-1, -1));
+
+                    mY = X;
+                    LOOP_ASSERT(N, Util::isSame(Y, reference));
+                    LOOP_ASSERT(N, &za == Y.allocator().mechanism());
+
+                    mY = Y;
+                    LOOP_ASSERT(N, Util::isSame(Y, reference));
+                }
+                {
+                    PayloadObj mY(PayloadLess(), &oa);
+                    const PayloadObj& Y = mY;
+                    mY.insertUnique(Payload(-1, -1));
+
+                    bslma::TestAllocatorMonitor oam(&oa);
+                    mY.swap(mX);
+                    LOOP_ASSERT(N, Util::isSame(Y, reference));
+                    LOOP_ASSERT(N, 1  == X.size());
+                    LOOP_ASSERT(N, -1 == X.begin()->key());
+
+                    mX.swap(mY);
+                    LOOP_ASSERT(N, Util::isSame(X, reference));
+                    LOOP_ASSERT(N, oam.isTotalSame());
+                }
+            }
+            LOOP_ASSERT(N, 0 == oa.numBlocksInUse());
+            LOOP_ASSERT(N, 0 == za.numBlocksInUse());
+        }
+        ASSERT(0 == Payload::s_numLive);
+
+        if (verbose) printf("\nTesting 'reserve' and 'shrinkToFit'.\n");
+        {
+            IntObj mX(native_std::less<int>(), &oa);  const IntObj& X = mX;
+            ASSERT(0 == X.capacity());
+
+            mX.reserve(100);
+            ASSERT(100 <= X.capacity());
+
+            bslma::TestAllocatorMonitor oam(&oa);
+            for (int i = 0; i < 100; ++i) {
+                ASSERT(mX.insertUnique((i * 37) % 100).second);
+            }
+            ASSERT(100 == X.size());
+            ASSERT(oam.isTotalSame());
+
+            mX.remove(0, X.find(60));
+            ASSERT(40  == X.size());
+            ASSERT(100 <= X.capacity());
+
+            mX.shrinkToFit();
+            ASSERT(40 == X.capacity());
+            ASSERT(60 == *X.begin());
+
+            mX.removeAll();
+            ASSERT(0  == X.size());
+            ASSERT(40 == X.capacity());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // CONCERN: Bulk insertion is exception safe
+        //
+        // Concerns:
+        //: 1 If an exception is thrown while inserting a range into a tree
+        //:   whose 'ValueType' is bitwise-moveable, the tree is unchanged.
+        //:
+        //: 2 If an exception is thrown while inserting a range into a tree
+        //:   whose 'ValueType' is not bitwise-moveable, the tree is either
+        //:   unchanged or empty.
+        //:
+        //: 3 No memory is leaked, and no element is leaked or destroyed
+        //:   twice.
+        //
+        // Plan:
+        //: 1 For each row of the table of ranges, insert the range into a
+        //:   copy of a tree, holding 'IntPair' or 'Payload' elements, having
+        //:   the allocator of the copy throw on each successive allocation,
+        //:   and verify the value of the copy after each exception, and that
+        //:   no memory or 'Payload' object is leaked.  (C-1..3)
+        //
+        // Testing:
+        //   CONCERN: Bulk insertion is exception safe
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCONCERN: BULK INSERTION IS EXCEPTION SAFE"
+                            "\n=========================================\n");
+
+#ifdef BDE_BUILD_TARGET_EXC
+        bsl::vector<int> initial;
+        bsl::vector<int> range;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int LINE = DATA[ti].d_line;
+
+            if (DATA[ti].d_numInitial + DATA[ti].d_numRange > 300) {
+                continue;
+            }
+
+            makeKeys(&initial,
+                     DATA[ti].d_numInitial,
+                     DATA[ti].d_initFirst,
+                     DATA[ti].d_initStep,
+                     DATA[ti].d_initSpread,
+                     LINE);
+            makeKeys(&range,
+                     DATA[ti].d_numRange,
+                     DATA[ti].d_first,
+                     DATA[ti].d_step,
+                     DATA[ti].d_spread,
+                     LINE + 1);
+
+            if (veryVerbose) { T_ P_(LINE) P_(initial.size()) P(range.size()) }
+
+            testExceptionSafety<Obj>(LINE, initial, range, false);
+            testExceptionSafety<Obj>(LINE, initial, range, true);
+            testExceptionSafety<PayloadObj>(LINE, initial, range, false);
+            testExceptionSafety<PayloadObj>(LINE, initial, range, true);
+        }
+        ASSERT(0 == Payload::s_numLive);
+#endif
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // BULK INSERTION
+        //
+        // Concerns:
+        //: 1 'insertUnique' taking a range inserts each element of the range
+        //:   whose key is not equivalent to that of an existing element, or
+        //:   of an earlier element of the range, in order.
+        //:
+        //: 2 'insertMulti' taking a range inserts every element of the range,
+        //:   after the existing elements having an equivalent key, and
+        //:   preserving the relative order of the elements of the range
+        //:   having equivalent keys.
+        //:
+        //: 3 The concerns hold whether the range is empty, shorter or longer
+        //:   than the runs sorted by insertion sort, sorted, reverse sorted,
+        //:   or unsorted, with or without (many) equivalent keys, and whether
+        //:   its keys precede, follow, or interleave with the keys of the
+        //:   tree.
+        //:
+        //: 4 The concerns hold for bitwise-moveable and other elements, for
+        //:   pointer elements, and for a user-supplied comparator.
+        //:
+        //: 5 Bulk insertion allocates memory only from the allocator of the
+        //:   tree, and no memory is leaked.
+        //
+        // Plan:
+        //: 1 For each row of a table describing the initial keys of a tree
+        //:   and the keys of a range, create trees holding 'IntPair' (with
+        //:   'std::less' and 'std::greater'), 'int', 'const int *', and
+        //:   'Payload' elements, insert the range using both 'insertUnique'
+        //:   and 'insertMulti', and verify the result against a reference
+        //:   built by inserting the elements of the range one at a time,
+        //:   checking the sequence numbers of 'IntPair' and 'Payload'
+        //:   elements to verify the stability of the insertion.  Verify,
+        //:   using test allocators, that the default allocator is not used by
+        //:   the insertion, and that no memory is leaked.  (C-1..5)
+        //
+        // Testing:
+        //   void insertUnique(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        //   void insertMulti(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBULK INSERTION"
+                            "\n==============\n");
+
+        bsl::vector<int> initial;
+        bsl::vector<int> range;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int LINE = DATA[ti].d_line;
+
+            makeKeys(&initial,
+                     DATA[ti].d_numInitial,
+                     DATA[ti].d_initFirst,
+                     DATA[ti].d_initStep,
+                     DATA[ti].d_initSpread,
+                     LINE);
+            makeKeys(&range,
+                     DATA[ti].d_numRange,
+                     DATA[ti].d_first,
+                     DATA[ti].d_step,
+                     DATA[ti].d_spread,
+                     LINE + 1);
+
+            if (veryVerbose) { T_ P_(LINE) P_(initial.size()) P(range.size()) }
+
+            for (int isMulti = 0; isMulti < 2; ++isMulti) {
+                testBulkInsertion<Obj>(LINE, initial, range, isMulti);
+                testBulkInsertion<GreaterObj>(LINE, initial, range, isMulti);
+                testBulkInsertion<IntObj>(LINE, initial, range, isMulti);
+                testBulkInsertion<PointerObj>(LINE, initial, range, isMulti);
+                testBulkInsertion<PayloadObj>(LINE, initial, range, isMulti);
+            }
+        }
+        ASSERT(0 == Payload::s_numLive);
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // SINGLE-ELEMENT MANIPULATORS AND SEARCHES
+        //
+        // Concerns:
+        //: 1 'insertUnique' inserts an element if and only if no element
+        //:   having an equivalent key is present, and returns the index of
+        //:   the element having the key.
+        //:
+        //: 2 'insertMulti' inserts an element after every element having an
+        //:   equivalent key, and returns its index.
+        //:
+        //: 3 'insertIfMissing' inserts an element, having a
+        //:   value-initialized mapped value, if and only if no element having
+        //:   the key is present, and returns the index of the element having
+        //:   the key.
+        //:
+        //: 4 'remove' removes exactly the designated elements, and
+        //:   'removeAll' removes every element.
+        //:
+        //: 5 'find', 'lowerBound', and 'upperBound' return the index of the
+        //:   first element having the key, the first element not ordered
+        //:   before the key, and the first element ordered after the key,
+        //:   respectively, or the size of the tree if there is no such
+        //:   element.
+        //
+        // Plan:
+        //: 1 Apply pseudo-random sequences of insertions and removals to
+        //:   trees of 'IntPair', 'int', 'const int *', and 'Payload'
+        //:   elements, for several key ranges, and verify the contents of the
+        //:   tree, and the searches for several keys, against a reference
+        //:   array after every operation.  (C-1..2, 4..5)
+        //:
+        //: 2 Use 'insertIfMissing' on a tree of 'IntPair' elements, and
+        //:   verify the returned index and the resulting elements.  (C-3)
+        //
+        // Testing:
+        //   pair<SizeType, bool> insertUnique(const ValueType& value);
+        //   SizeType insertMulti(const ValueType& value);
+        //   SizeType insertIfMissing(const KeyType& key);
+        //   void remove(SizeType index);
+        //   void remove(SizeType first, SizeType last);
+        //   void removeAll();
+        //   SizeType find(const KeyType& key) const;
+        //   SizeType lowerBound(const KeyType& key) const;
+        //   SizeType upperBound(const KeyType& key) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nSINGLE-ELEMENT MANIPULATORS AND SEARCHES"
+                            "\n========================================\n");
+
+        static const struct {
+            int d_line;    // source line number
+            int d_range;   // keys are in '[0 .. d_range)'
+            int d_numOps;  // number of operations to apply
+        } OPS[] = {
+            //LINE  RANGE  NUM_OPS
+            //----  -----  -------
+            { L_,       1,     100 },
+            { L_,       4,     200 },
+            { L_,      50,    1000 },
+            { L_,    2000,    3000 },
+        };
+        const int NUM_OPS = sizeof OPS / sizeof *OPS;
+
+        for (int ti = 0; ti < NUM_OPS; ++ti) {
+            const int LINE    = OPS[ti].d_line;
+            const int RANGE   = OPS[ti].d_range;
+            const int NUM     = OPS[ti].d_numOps;
+
+            if (veryVerbose) { T_ P_(LINE) P_(RANGE) P(NUM) }
+
+            for (int isMulti = 0; isMulti < 2; ++isMulti) {
+                testRandom<Obj>(LINE, RANGE, NUM, isMulti);
+                testRandom<GreaterObj>(LINE, RANGE, NUM, isMulti);
+                testRandom<IntObj>(LINE, RANGE, NUM, isMulti);
+                testRandom<PointerObj>(LINE, RANGE, NUM, isMulti);
+                testRandom<PayloadObj>(LINE, RANGE, NUM, isMulti);
+            }
+        }
+        ASSERT(0 == Payload::s_numLive);
+
+        if (verbose) printf("\nTesting 'insertIfMissing'.\n");
+        {
+            bslma::TestAllocator oa("object", veryVeryVerbose);
+
+            Obj mX(native_std::less<int>(), &oa);  const Obj& X = mX;
+
+            ASSERT(0 == mX.insertIfMissing(5));
+            ASSERT(0 == mX.insertIfMissing(1));
+            ASSERT(2 == mX.insertIfMissing(9));
+            ASSERT(3 == X.size());
+
+            mX.begin()[1].second = 50;
+            ASSERT(1 == mX.insertIfMissing(5));
+            ASSERT(3 == X.size());
+
+            ASSERT(1  == X.begin()[0].first);
+            ASSERT(0  == X.begin()[0].second);
+            ASSERT(5  == X.begin()[1].first);
+            ASSERT(50 == X.begin()[1].second);
+            ASSERT(9  == X.begin()[2].first);
+            ASSERT(0  == X.begin()[2].second);
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // FLATTREE_PROCTOR
+        //
+        // Concerns:
+        //: 1 On destruction, the proctor erases every element of the managed
+        //:   vector at or after the managed index.
+        //:
+        //: 2 The proctor does nothing if the vector has no element at or
+        //:   after the managed index.
+        //:
+        //: 3 The proctor does nothing once released.
+        //
+        // Plan:
+        //: 1 Create proctors managing vectors of 'Payload' objects, append
+        //:   elements to the vectors, and verify the size of the vector, and
+        //:   the number of live 'Payload' objects, after the destruction of
+        //:   the proctor.  (C-1..3)
+        //
+        // Testing:
+        //   FlatTree_Proctor(VECTOR *vector, size_type size);
+        //   ~FlatTree_Proctor();
+        //   void release();
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nFLATTREE_PROCTOR"
+                            "\n================\n");
+
+        typedef bsl::vector<Payload>               Vector;
+        typedef bslstl::FlatTree_Proctor<Vector>   Proctor;
+
+        bslma::TestAllocator oa("object", veryVeryVerbose);
+        {
+            Vector mV(&oa);  const Vector& V = mV;
+            for (int i = 0; i < 3; ++i) {
+                mV.push_back(Payload(i, i));
+            }
+            {
+                Proctor proctor(&mV, 3);
+                mV.push_back(Payload(3, 3));
+                mV.push_back(Payload(4, 4));
+                ASSERT(5 == Payload::s_numLive);
+            }
+            ASSERT(3 == V.size());
+            ASSERT(3 == Payload::s_numLive);
+            {
+                Proctor proctor(&mV, 3);
+            }
+            ASSERT(3 == V.size());
+            {
+                Proctor proctor(&mV, 3);
+                mV.push_back(Payload(3, 3));
+                proctor.release();
+            }
+            ASSERT(4 == V.size());
+            ASSERT(3 == V.back().key());
+            {
+                Proctor proctor(&mV, 0);
+            }
+            ASSERT(0 == V.size());
+            ASSERT(0 == Payload::s_numLive);
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create a tree, insert elements one at a time and as a range,
+        //:   look them up, and remove some of them.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        //   explicit FlatTree(const COMPARATOR&, const ALLOCATOR&);
+        //   ~FlatTree();
+        //   Iterator begin();
+        //   Iterator end();
+        //   ConstIterator begin() const;
+        //   const COMPARATOR& comparator() const;
+        //   ConstIterator end() const;
+        //   SizeType maxSize() const;
+        //   SizeType size() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        bslma::TestAllocator oa("object", veryVeryVerbose);
+        {
+            IntObj mX(native_std::less<int>(), &oa);  const IntObj& X = mX;
+            ASSERT(0 == X.size());
+            ASSERT(X.begin() == X.end());
+            ASSERT(mX.begin() == mX.end());
+            ASSERT(0 == X.find(0));
+            ASSERT(0 == X.lowerBound(0));
+            ASSERT(0 < X.maxSize());
+            ASSERT(X.comparator()(1, 2));
+            ASSERT(0 == oa.numBlocksTotal());
+
+            for (int i = 0; i < 100; ++i) {
+                const int key = (i * 37) % 100;
+                ASSERT(mX.insertUnique(key).second);
+                ASSERT(!mX.insertUnique(key).second);
+            }
+            ASSERT(100 == X.size());
+            for (int i = 0; i < 100; ++i) {
+                ASSERT(i == X.begin()[i]);
+                ASSERT(static_cast<IntObj::SizeType>(i) == X.find(i));
+            }
+            ASSERT(100 == X.find(100));
+            ASSERT(100 == X.lowerBound(100));
+            ASSERT(0   == X.upperBound(-1));
+
+            const int VALUES[] = { 250, 120, 99, 120, -3 };
+            mX.insertUnique(VALUES, VALUES + 5);
+            ASSERT(103 == X.size());
+            ASSERT(-3  == *X.begin());
+            ASSERT(250 == X.end()[-1]);
+
+            mX.insertMulti(VALUES, VALUES + 5);
+            ASSERT(108 == X.size());
+            ASSERT(3   == X.upperBound(120) - X.lowerBound(120));
+
+            mX.remove(X.lowerBound(120), X.upperBound(120));
+            mX.remove(0);
+            ASSERT(104 == X.size());
+            ASSERT(-3  == *X.begin());
+            ASSERT(X.size() == X.find(120));
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -42,10 +42,12 @@ bslalg::HashTableBucket *HashTable_ImpDetails::defaultBucketAddress()
     return &s_bucket;
 }
 
-size_t HashTable_ImpDetails::growBucketsForLoadFactor(size_t *capacity,
-                                                      size_t  minElements,
-                                                      size_t  requestedBuckets,
-                                                      double  maxLoadFactor)
+size_t HashTable_ImpDetails::growBucketsForLoadFactor(
+                                                size_t       *capacity,
+                                                size_t        minElements,
+                                                size_t        requestedBuckets,
+                                                double        maxLoadFactor,
+                                                BucketPolicy  policy)
 {
     BSLS_ASSERT_SAFE(  0 != capacity);
     BSLS_ASSERT_SAFE(  0  < minElements);
@@ -105,12 +107,20 @@ size_t HashTable_ImpDetails::growBucketsForLoadFactor(size_t *capacity,
        requestedBuckets,
        Impl::throwIfOverMax(static_cast<double>(minElements) / maxLoadFactor));
 
-    result = nextPrime(result);  // throws if too large
+    size_t (*nextSize)(size_t) = e_POWER_OF_TWO_BUCKETS == policy
+                               ? &nextPowerOfTwo
+                               : &nextPrime;
+
+    result = nextSize(result);  // throws if too large
 
     double newCapacity = static_cast<double>(result) * maxLoadFactor;
 
     while (minElements > newCapacity ) {
-        result  = nextPrime(2 * result);  // throws if too large
+        if (result > MAX_SIZE_T / 2) {
+            StdExceptUtil::throwLengthError(
+                                           "The number of buckets overflows.");
+        }
+        result  = nextSize(2 * result);  // throws if too large
         newCapacity = static_cast<double>(result) * maxLoadFactor;
     }
 
@@ -134,18 +144,32 @@ bslma::Allocator *HashTable_ImpDetails::incidentalAllocator()
 
 size_t HashTable_ImpDetails::nextPrime(size_t n)
 {
-    // An abbreviated list of prime numbers in the domain of 32-bit unsigned
-    // integers.  Essentially, a subset where each successive element is the
-    // next prime after doubling.  Note that at least one of these numbers was
+    // An abbreviated list of prime numbers in the domain of 'size_t'.
+    // Essentially, a subset where each successive element is the next prime
+    // after doubling.  Note that at least one of these numbers was
     // mis-computed and undershoots, messing up the doubling pattern, not
-    // critical while the code remains proof-of-concept code.
+    // critical while the code remains proof-of-concept code.  On 64-bit
+    // platforms the sequence continues beyond the 32-bit range, so that very
+    // large tables are not limited to fewer than 2^32 buckets.
 
     static const size_t s_primes[] = { 2, 5, 13, 29, 61,
         127, 257, 521, 1049, 2099, 4201, 8419, 16843, 33703, 67409, 134837,
         269513, 539039, 1078081, 2156171, 5312353, 10624709, 21249443,
         42498893, 84997793, 169995589, 339991181, 679982363, 1359964751,
         2719929503u
-
+#if defined(BSLS_PLATFORM_CPU_64_BIT)
+      , 5439859027ULL, 10879718107ULL, 21759436217ULL, 43518872483ULL,
+        87037744973ULL, 174075489989ULL, 348150979999ULL, 696301960009ULL,
+        1392603920023ULL, 2785207840073ULL, 5570415680153ULL,
+        11140831360313ULL, 22281662720633ULL, 44563325441281ULL,
+        89126650882567ULL, 178253301765137ULL, 356506603530331ULL,
+        713013207060677ULL, 1426026414121399ULL, 2852052828242809ULL,
+        5704105656485669ULL, 11408211312971371ULL, 22816422625942801ULL,
+        45632845251885739ULL, 91265690503771493ULL, 182531381007543049ULL,
+        365062762015086103ULL, 730125524030172211ULL,
+        1460251048060344439ULL, 2920502096120688941ULL,
+        5841004192241377919ULL, 11682008384482755919ULL
+#endif
     };
     static const size_t s_nPrimes = sizeof(s_primes)/sizeof(s_primes[0]);
     static const size_t *const s_beginPrimes = s_primes;
@@ -161,6 +185,23 @@ size_t HashTable_ImpDetails::nextPrime(size_t n)
     return *result;
 }
 
+size_t HashTable_ImpDetails::nextPowerOfTwo(size_t n)
+{
+    static const size_t MAX_POWER =
+                        (native_std::numeric_limits<size_t>::max() >> 1) + 1;
+
+    if (n > MAX_POWER) {
+        StdExceptUtil::throwLengthError(
+                                      "HashTable ran out of powers of two.");
+    }
+
+    size_t result = 1;
+    while (result < n) {
+        result <<= 1;
+    }
+    return result;
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 // ----------------------------------------------------------------------------
@@ -11,6 +11,7 @@ BSLS_IDENT("$Id: $")
 //
 //@CLASSES:
 //   bslstl::HashTable : hashed-table container for user-supplied object types
+//   bslstl::HashTableStatistics : bucket occupancy and memory use of a table
 //
 //@SEE_ALSO: bsl+stdhdrs
 //
@@ -124,6 +125,75 @@ BSLS_IDENT("$Id: $")
 // basic exception guarantee.  There are similar concerns for the 'COMPARATOR'
 // predicate.
 //
+///Cached Hash Codes
+///-----------------
+// By default the hashed value of an element is not cached, and is recomputed
+// by the hasher whenever the element is rehashed into a larger bucket array or
+// removed from the table.  If 'HASHER' is associated with the
+// 'bslstl::CachesHashCodes' trait, each element is instead stored in a
+// 'bslalg::BidirectionalHashedNode' that records the (adjusted) hash value
+// computed when the element was inserted.  Such a table never calls the
+// hasher to rehash or remove an element, and, when searching a bucket, calls
+// the comparator only for elements whose stored hash value matches that of
+// the key being sought.  Each element then occupies an additional
+// 'sizeof(size_t)' bytes.  Note that a rehash of such a table calls no
+// user-supplied code, and so cannot fail due to an exception thrown by the
+// hasher.
+//
+///Bucket Array Sizes
+///------------------
+// By default, the number of buckets is chosen from an increasing sequence of
+// prime numbers (see 'HashTable_ImpDetails::nextPrime'), and a hash value is
+// mapped to a bucket index using an integer modulo operation.  If 'HASHER' is
+// associated with the 'bslstl::UsesPowerOfTwoBuckets' trait, the number of
+// buckets is instead always a power of two, a bucket index is computed by
+// masking the low-order bits of the hash value (avoiding a division on every
+// lookup), and each hash value returned by the hasher is first mixed (see
+// 'HashTable_ImpDetails::adjustHashCode') so that weak hash functions do not
+// cluster elements into a small subset of the buckets.
+//
+///Incremental Rehash
+///------------------
+// By default, an insertion that would exceed the maximum load factor
+// allocates a larger bucket array and re-indexes every element into it before
+// returning, so that the cost of that one insertion is linear in the size of
+// the table.  Calling 'setIncrementalRehash(true)' amortizes that cost: such
+// an insertion allocates the larger array and makes it current, but leaves
+// the existing elements indexed by the previous array.  Each later insertion
+// first drains the bucket of the previous array that holds its key (if not
+// already drained), and then a fixed number of further buckets, in order,
+// until the previous array is empty and is released.  'isRehashInProgress'
+// and 'numBucketsPendingRehash' report the progress of a rehash, and
+// 'completeRehash' finishes it immediately.  Should a further growth of the
+// bucket array be required before a rehash finishes, the outstanding rehash
+// is completed first.
+//
+// All the elements remain in the single list of elements throughout a
+// rehash, so iteration over the list visits every element exactly once, and
+// lookup searches both bucket arrays.  Removing an element never moves any
+// other element, so iterators remain valid and in order while elements are
+// erased.  Note that the bucket-level accessors ('bucketAtIndex',
+// 'countElementsInBucket') describe only the current bucket array, and so do
+// not account for elements yet to be moved.
+//
+///Statistics
+///----------
+// The 'statistics' accessor returns a 'bslstl::HashTableStatistics' object
+// describing how well the hasher distributes the elements of a table: a
+// histogram of the number of elements per bucket, the longest and the mean
+// length of the non-empty buckets, and the proportion of empty buckets.  It
+// also reports the number of bytes occupied by the nodes and bucket arrays of
+// the table, and the number of times the bucket array has been replaced since
+// the table was created.  The occupancy figures are gathered by a scan of the
+// bucket array, and so have a cost linear in the number of buckets and
+// elements; only the number of rehashes is maintained as elements are
+// inserted.  The count belongs to the contents of a table rather than to the
+// object: swapping two tables exchanges their counts, and a copy of a table
+// starts with a count of 0.  Counting can be disabled by building with
+// 'BSLSTL_HASHTABLE_DISABLE_STATISTICS' defined, in which case the number of
+// rehashes is always reported as 0.  The setting does not affect the layout
+// of 'HashTable', which always holds the counter.
+//
 ///Usage
 ///-----
 // This section illustrates intended use of this component.  The
@@ -1470,6 +1540,30 @@ BSLS_IDENT("$Id: $")
 #include <bslstl_bidirectionalnodepool.h>
 #endif
 
+#ifndef INCLUDED_BSLSTL_CACHESHASHCODES
+#include <bslstl_cacheshashcodes.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_ITERATOR
+#include <bslstl_iterator.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_NODEHANDLE
+#include <bslstl_nodehandle.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_STDEXCEPTUTIL
+#include <bslstl_stdexceptutil.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_USESPOWEROFTWOBUCKETS
+#include <bslstl_usespoweroftwobuckets.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_BIDIRECTIONALHASHEDNODE
+#include <bslalg_bidirectionalhashednode.h>
+#endif
+
 #ifndef INCLUDED_BSLALG_BIDIRECTIONALLINK
 #include <bslalg_bidirectionallink.h>
 #endif
@@ -1510,10 +1604,18 @@ BSLS_IDENT("$Id: $")
 #include <bslmf_conditional.h>
 #endif
 
+#ifndef INCLUDED_BSLMF_INTEGRALCONSTANT
+#include <bslmf_integralconstant.h>
+#endif
+
 #ifndef INCLUDED_BSLMF_ISBITWISEMOVEABLE
 #include <bslmf_isbitwisemoveable.h>
 #endif
 
+#ifndef INCLUDED_BSLMF_ISCONVERTIBLE
+#include <bslmf_isconvertible.h>
+#endif
+
 #ifndef INCLUDED_BSLMF_ISFUNCTION
 #include <bslmf_isfunction.h>
 #endif
@@ -1522,6 +1624,10 @@ BSLS_IDENT("$Id: $")
 #include <bslmf_ispointer.h>
 #endif
 
+#ifndef INCLUDED_BSLMF_ISSAME
+#include <bslmf_issame.h>
+#endif
+
 #ifndef INCLUDED_BSLS_ASSERT
 #include <bsls_assert.h>
 #endif
@@ -1530,6 +1636,10 @@ BSLS_IDENT("$Id: $")
 #include <bsls_bslexceptionutil.h>
 #endif
 
+#ifndef INCLUDED_BSLS_COMPILERFEATURES
+#include <bsls_compilerfeatures.h>
+#endif
+
 #ifndef INCLUDED_BSLS_NATIVESTD
 #include <bsls_nativestd.h>
 #endif
@@ -1542,6 +1652,10 @@ BSLS_IDENT("$Id: $")
 #include <bsls_platform.h>
 #endif
 
+#ifndef INCLUDED_BSLS_UTIL
+#include <bsls_util.h>
+#endif
+
 #ifndef INCLUDED_ALGORITHM
 #include <algorithm>  // for fill_n, max
 #define INCLUDED_ALGORITHM
@@ -1576,6 +1690,9 @@ class HashTable_ArrayProctor;
 template <class FACTORY>
 class HashTable_NodeProctor;
 
+template <class FACTORY>
+class HashTable_NodeBatchProctor;
+
 template <class FUNCTOR>
 class HashTable_ComparatorWrapper;
 
@@ -1597,6 +1714,70 @@ class HashTable_HashWrapper<FUNCTOR &>;
 struct HashTable_ImpDetails;
 struct HashTable_Util;
 
+template <class VALUE_TYPE, class HASHER>
+struct HashTable_NodeType;
+
+template <class KEY_CONFIG, bool STORES_HASH_CODES>
+struct HashTable_NodeUtil;
+
+                       // ==========================
+                       // struct HashTableStatistics
+                       // ==========================
+
+struct HashTableStatistics {
+    // This 'struct' describes the distribution of the elements of a
+    // 'HashTable' among its buckets, and the memory used by its internal data
+    // structure, at the time 'HashTable::statistics' was called.  Following
+    // the convention for 'struct's, its data members are public.
+
+    // PUBLIC CONSTANTS
+    enum { k_NUM_HISTOGRAM_BINS = 8 };
+        // Number of elements in 'd_occupancyHistogram'.
+
+    // PUBLIC DATA
+    native_std::size_t d_numElements;      // number of elements in the table
+
+    native_std::size_t d_numBuckets;       // size of the current bucket array
+
+    native_std::size_t d_numEmptyBuckets;  // number of buckets holding no
+                                           // element
+
+    native_std::size_t d_occupancyHistogram[k_NUM_HISTOGRAM_BINS];
+                                           // element 'i' is the number of
+                                           // buckets holding exactly 'i'
+                                           // elements, except for the last,
+                                           // which counts the buckets holding
+                                           // 'k_NUM_HISTOGRAM_BINS - 1' or
+                                           // more elements
+
+    native_std::size_t d_maxChainLength;   // number of elements in the
+                                           // fullest bucket
+
+    double             d_meanChainLength;  // mean number of elements in the
+                                           // non-empty buckets (0 if every
+                                           // bucket is empty)
+
+    double             d_emptyBucketRatio; // 'd_numEmptyBuckets' divided by
+                                           // 'd_numBuckets'
+
+    native_std::size_t d_nodeBytes;        // bytes occupied by the nodes
+                                           // holding the elements
+
+    native_std::size_t d_bucketArrayBytes; // bytes occupied by the bucket
+                                           // arrays (including an array being
+                                           // drained by an incremental rehash)
+
+    native_std::size_t d_numRehashes;      // number of times the bucket array
+                                           // has been replaced since the table
+                                           // was created (0 if statistics are
+                                           // disabled)
+
+    // CREATORS
+    HashTableStatistics();
+        // Create a 'HashTableStatistics' object having the value 0 for every
+        // data member.
+};
+
                        // ======================
                        // class CallableVariable
                        // ======================
@@ -1655,8 +1836,9 @@ class HashTable_HashWrapper {
     template <class ARG_TYPE>
     native_std::size_t operator()(ARG_TYPE& arg) const;
         // Call the wrapped 'functor' with the specified 'arg' and return the
-        // result.  Note that 'ARG_TYPE' will typically be deduced as a 'const'
-        // type.
+        // result, mixed by 'HashTable_ImpDetails::adjustHashCode' if 'FUNCTOR'
+        // is associated with the 'UsesPowerOfTwoBuckets' trait.  Note that
+        // 'ARG_TYPE' will typically be deduced as a 'const' type.
 
     const FUNCTOR& functor() const;
         // Return a reference providing non-modifiable access to the hash
@@ -1691,8 +1873,9 @@ class HashTable_HashWrapper<const FUNCTOR> {
     template <class ARG_TYPE>
     native_std::size_t operator()(ARG_TYPE& arg) const;
         // Call the wrapped 'functor' with the specified 'arg' and return the
-        // result.  Note that 'ARG_TYPE' will typically be deduced as a 'const'
-        // type.
+        // result, mixed by 'HashTable_ImpDetails::adjustHashCode' if 'FUNCTOR'
+        // is associated with the 'UsesPowerOfTwoBuckets' trait.  Note that
+        // 'ARG_TYPE' will typically be deduced as a 'const' type.
 
     const FUNCTOR& functor() const;
         // Return a reference providing non-modifiable access to the hash
@@ -1723,8 +1906,9 @@ class HashTable_HashWrapper<FUNCTOR &> {
     template <class ARG_TYPE>
     native_std::size_t operator()(ARG_TYPE& arg) const;
         // Call the wrapped 'functor' with the specified 'arg' and return the
-        // result.  Note that 'ARG_TYPE' will typically be deduced as a 'const'
-        // type.
+        // result, mixed by 'HashTable_ImpDetails::adjustHashCode' if 'FUNCTOR'
+        // is associated with the 'UsesPowerOfTwoBuckets' trait.  Note that
+        // 'ARG_TYPE' will typically be deduced as a 'const' type.
 
     FUNCTOR& functor() const;
         // Return a reference providing non-modifiable access to the hash
@@ -1854,6 +2038,77 @@ void swap(HashTable_ComparatorWrapper<FUNCTOR> &lhs,
     // Swap the functor wrapped by the specified 'lhs' object with the functor
     // wrapped by the specified 'rhs' object.
 
+                    // ==========================
+                    // class HashTable_ImpDetails
+                    // ==========================
+
+struct HashTable_ImpDetails {
+    // This utility 'struct' provides a namespace for functions that are useful
+    // when implementing a hash table.
+
+    // TYPES
+    enum BucketPolicy {
+        // Enumerate the sequences from which the size of a bucket array may be
+        // chosen.
+
+        e_PRIME_BUCKETS,         // sizes are chosen by 'nextPrime'
+        e_POWER_OF_TWO_BUCKETS   // sizes are chosen by 'nextPowerOfTwo'
+    };
+
+    // CLASS METHODS
+    static size_t adjustHashCode(size_t hashCode, bool mix);
+        // Return the specified 'hashCode' if the specified 'mix' is 'false',
+        // and a value computed by mixing the bits of 'hashCode' otherwise.
+        // The mixed value is suitable for selecting a bucket in a power of two
+        // sized bucket array by masking its low-order bits, even if only the
+        // high-order bits of 'hashCode' vary across the hashed keys.
+
+    static bslalg::HashTableBucket *defaultBucketAddress();
+        // Return the address of a statically initialized empty bucket that can
+        // be shared as the (un-owned) bucket array by all empty hash tables.
+
+    static size_t growBucketsForLoadFactor(
+                                 size_t       *capacity,
+                                 size_t        minElements,
+                                 size_t        requestedBuckets,
+                                 double        maxLoadFactor,
+                                 BucketPolicy  policy = e_PRIME_BUCKETS);
+        // Return the suggested number of buckets to index a linked list that
+        // can hold as many as the specified 'minElements' without exceeding
+        // the specified 'maxLoadFactor', and supporting at least the specified
+        // number of 'requestedBuckets'.  Optionally specify a 'policy'
+        // determining the sequence from which the number of buckets is chosen;
+        // if 'policy' is not specified, a prime number of buckets is returned.
+        // Set the specified '*capacity' to the maximum length of linked list
+        // that the returned number of buckets could index without exceeding
+        // the 'maxLoadFactor'.  The behavior is undefined unless
+        // '0 < maxLoadFactor', '0 < minElements' and '0 < requestedBuckets'.
+
+    static bslma::Allocator *incidentalAllocator();
+        // Return that address of an allocator that can be used to allocate
+        // temporary storage, but that is neither the default nor global
+        // allocator.  Note that this function is intended to support detailed
+        // checks in 'SAFE_2' builds, that may need additional storage for the
+        // evaluation of a validity check on a large data structure, but that
+        // should not change the expected values computed for regular allocator
+        // usage of the component as validated by the test driver.
+
+    static size_t nextPrime(size_t n);
+        // Return the next prime number greater-than or equal to the specified
+        // 'n' in the increasing sequence of primes chosen to disperse hash
+        // codes across buckets as uniformly as possible.  Throw a
+        // 'std::length_error' exception if 'n' is greater than the last prime
+        // number in the sequence.  Note that, typically, prime numbers in the
+        // sequence have increasing values that reflect a growth factor (e.g.,
+        // each value in the sequence may be, approximately, two times the
+        // preceding value).
+
+    static size_t nextPowerOfTwo(size_t n);
+        // Return the smallest power of two greater-than or equal to the
+        // specified 'n'.  Throw a 'std::length_error' exception if 'n' is
+        // greater than the largest power of two representable by 'size_t'.
+};
+
                            // ===============
                            // class HashTable
                            // ===============
@@ -1913,8 +2168,11 @@ class HashTable {
     typedef ::bsl::allocator_traits<AllocatorType> AllocatorTraits;
     typedef typename KEY_CONFIG::KeyType           KeyType;
     typedef typename KEY_CONFIG::ValueType         ValueType;
-    typedef bslalg::BidirectionalNode<ValueType>   NodeType;
+    typedef typename HashTable_NodeType<ValueType, HASHER>::Type
+                                                   NodeType;
     typedef typename AllocatorTraits::size_type    SizeType;
+    typedef NodeHandle<ValueType, NodeType, ALLOCATOR>
+                                                   NodeHandleType;
 
   private:
     // PRIVATE TYPES
@@ -1922,6 +2180,37 @@ class HashTable {
     HashTable_ImplParameters<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>
                                                                 ImplParameters;
 
+    typedef HashTable_NodeUtil<KEY_CONFIG, CachesHashCodes<HASHER>::value>
+                                                                      NodeUtil;
+        // Operations whose implementation depends on whether 'NodeType'
+        // stores the hash code of its element, as determined by the
+        // 'CachesHashCodes' trait of 'HASHER'.
+
+    typedef bslalg::HashTableImpUtil_BucketIndex<
+                                          UsesPowerOfTwoBuckets<HASHER>::value>
+                                                                   BucketIndex;
+        // Tag passed to the 'bslalg::HashTableImpUtil' functions that locate
+        // a bucket, so that power-of-two bucket arrays (see 'k_BUCKET_POLICY')
+        // compute bucket indices by masking rather than dividing; selected at
+        // compile time, so that other tables pay no per-operation cost.
+
+    // PRIVATE CONSTANTS
+    static const HashTable_ImpDetails::BucketPolicy k_BUCKET_POLICY =
+                                 UsesPowerOfTwoBuckets<HASHER>::value
+                                 ? HashTable_ImpDetails::e_POWER_OF_TWO_BUCKETS
+                                 : HashTable_ImpDetails::e_PRIME_BUCKETS;
+        // Sequence from which the size of the bucket array is chosen, as
+        // determined by the 'UsesPowerOfTwoBuckets' trait of 'HASHER'.
+
+    enum { k_BATCH_SIZE = 16 };
+        // Maximum number of keys whose buckets are prefetched together by the
+        // batched lookup and insertion methods.
+
+    enum { k_REHASH_BUCKETS_PER_INSERTION = 4 };
+        // Number of buckets of the previous bucket array drained by each
+        // insertion while an incremental rehash is in progress, in addition
+        // to the bucket holding the key being inserted.
+
   private:
     // DATA
     ImplParameters      d_parameters;    // policies governing table behavior
@@ -1932,9 +2221,39 @@ class HashTable {
                                          // rehash is required (computed from
                                          // 'd_maxLoadFactor')
     float               d_maxLoadFactor; // maximum permitted load factor
+    bslalg::HashTableAnchor
+                        d_oldAnchor;     // bucket array being drained by an
+                                         // incremental rehash (the default
+                                         // bucket array if none)
+    SizeType            d_rehashIndex;   // index of the next bucket of
+                                         // 'd_oldAnchor' to be drained
+    bool                d_incrementalRehash;
+                                         // 'true' if the bucket array grows
+                                         // incrementally, and 'false'
+                                         // otherwise
+    native_std::size_t  d_numRehashes;   // number of times the bucket array
+                                         // has been replaced (see
+                                         // {Statistics})
 
   private:
+    // PRIVATE CLASS METHODS
+    static native_std::size_t adjustHashCode(native_std::size_t hashCode);
+        // Return the hash code under which a hash table of this type indexes
+        // a key for which the 'hasher' returns the specified 'hashCode' (see
+        // 'HashTable_ImpDetails::adjustHashCode').
+
     // PRIVATE MANIPULATORS
+    void advanceRehash(native_std::size_t hashCode);
+        // If an incremental rehash is in progress, move into the current
+        // bucket array the elements in the bucket of the previous bucket array
+        // corresponding to the specified 'hashCode', followed by those in up
+        // to 'k_REHASH_BUCKETS_PER_INSERTION' further buckets, and end the
+        // rehash if no buckets remain to be drained.  Otherwise, this method
+        // has no effect.  If the 'hasher' throws an exception, this hash table
+        // is left in a valid state with the rehash still in progress.  Note
+        // that this method must be called before a node with a key having
+        // 'hashCode' is linked into the current bucket array.
+
     void copyDataStructure(bslalg::BidirectionalLink *cursor);
         // Copy the sequence of elements from the list starting at the
         // specified 'cursor' and having 'size' elements.  Allocate a bucket
@@ -1946,6 +2265,72 @@ class HashTable {
         // for the 'size' and other attributes that may not be consistent with
         // the class invariants until after this method is called.
 
+    void drainBucket(SizeType index);
+        // Move each element in the bucket at the specified 'index' in the
+        // previous bucket array of an incremental rehash into the bucket
+        // corresponding to its hash code in the current bucket array,
+        // preserving the relative order of elements having the same key.  If
+        // the 'hasher' throws an exception, the elements not yet moved remain
+        // in the previous bucket array.  The behavior is undefined unless an
+        // incremental rehash is in progress and
+        // 'index < d_oldAnchor.bucketArraySize()'.
+
+    void endRehash();
+        // Destroy the previous bucket array of an incremental rehash, if any,
+        // and reset 'd_oldAnchor' to refer to the default bucket array.  The
+        // behavior is undefined unless the previous bucket array holds no
+        // elements, or no element of this hash table is accessed before the
+        // bucket arrays are re-indexed or cleared.
+
+    void growBucketArray();
+        // Grow the bucket array of this hash table so that it has at least
+        // twice the current number of buckets and can accommodate at least
+        // one more element without exceeding the 'maxLoadFactor'.  If
+        // 'incrementalRehash()' is 'true' and this hash table is not empty,
+        // complete any rehash already in progress and then begin an
+        // incremental rehash into the new bucket array, moving no elements;
+        // otherwise re-index every element immediately (as if by
+        // 'rehashForNumBuckets').  If this function tries to allocate a
+        // number of buckets larger than can be represented by this hash
+        // table's 'SizeType', a 'std::length_error' exception will be thrown.
+
+    template <class INPUT_ITERATOR>
+    void insertIfMissingBatchImp(INPUT_ITERATOR  first,
+                                 INPUT_ITERATOR  last,
+                                 bsl::true_type);
+        // Insert into this hash table a newly created element for each value
+        // in the range starting at the specified 'first' iterator and ending
+        // immediately before the specified 'last' iterator whose key is not
+        // already present, as described for 'insertIfMissingBatch'.  The keys
+        // of each batch are hashed, and their buckets prefetched, directly
+        // from the range, and a node is created only for a value whose key is
+        // not found.  The behavior is undefined unless 'INPUT_ITERATOR' is a
+        // forward iterator whose value type is 'ValueType'.
+
+    template <class INPUT_ITERATOR>
+    void insertIfMissingBatchImp(INPUT_ITERATOR  first,
+                                 INPUT_ITERATOR  last,
+                                 bsl::false_type);
+        // Insert into this hash table a newly created element for each value
+        // in the range starting at the specified 'first' iterator and ending
+        // immediately before the specified 'last' iterator whose key is not
+        // already present, as described for 'insertIfMissingBatch'.  A node
+        // is created for each value of a batch (so that no temporary
+        // 'ValueType' is created from an object of the iterator's value type)
+        // before its key is looked up, and destroyed if the key is found.
+
+    void mergeImp(HashTable *source, bool skipEquivalentKeys);
+        // Relocate into this hash table each element of the specified
+        // 'source' hash table, unless the specified 'skipEquivalentKeys' is
+        // 'true' and this hash table already holds an element having a key
+        // that compares equal to that of the element, in which case the
+        // element remains in 'source'.  Each element is linked into this hash
+        // table as if by 'insert' (or 'insertIfMissing' if
+        // 'skipEquivalentKeys'), and its node in 'source' is returned to the
+        // node pool of 'source'.  If an exception is thrown, both hash tables
+        // are left in a valid state, each element being held by exactly one
+        // of them.  The behavior is undefined if 'source' is this hash table.
+
     void quickSwapExchangeAllocators(HashTable *other);
         // Efficiently exchange the value, functors, and allocator of this
         // object with those of the specified 'other' object.  This method
@@ -1974,12 +2359,24 @@ class HashTable {
 
     void removeAllAndDeallocate();
         // Erase all the nodes in this hash-table, and deallocate their memory
-        // via the supplied node-factory.  Destroy the array of buckets owned
+        // via the supplied node-factory.  Destroy the arrays of buckets owned
         // by this hash-table.  If 'd_anchor.bucketAddress()' is the default
         // bucket address ('HashTable_ImpDetails::defaultBucketAddress') then
         // this hash-table does not own its array of buckets, and it will not
         // be destroyed.
 
+    bslalg::BidirectionalLink *insertIfMissingImp(
+                                        bool               *isInsertedFlag,
+                                        const ValueType&    value,
+                                        native_std::size_t  hashCode);
+        // Return the address of an element in this hash table having a key
+        // that compares equal to the key of the specified 'value', and, if no
+        // such element exists, insert 'value' and return the address of the
+        // new node.  Load 'true' into the specified 'isInsertedFlag' if
+        // insertion is performed, and 'false' otherwise.  The behavior is
+        // undefined unless the specified 'hashCode' is the hash code under
+        // which this hash table indexes the key of 'value'.
+
     void removeAllImp();
         // Erase all the nodes in this table and deallocate their memory via
         // the node factory, without performing the necessary bookkeeping to
@@ -1989,6 +2386,15 @@ class HashTable {
         // with a new value, or when the hash table is going out of scope and
         // the extra bookkeeping is not necessary.
 
+    void unlinkNode(bslalg::BidirectionalLink *node,
+                    native_std::size_t         hashCode);
+        // Remove the specified 'node', whose element has the specified
+        // 'hashCode', from the list and from the bucket array (or, during an
+        // incremental rehash, the previous bucket array) indexing it, and
+        // decrement the size of this hash table, without destroying or
+        // deallocating 'node'.  The behavior is undefined unless 'node'
+        // refers to a node in this hash table.
+
     // PRIVATE ACCESSORS
     template <class DEDUCED_KEY>
     bslalg::BidirectionalLink *find(DEDUCED_KEY&       key,
@@ -2000,7 +2406,9 @@ class HashTable {
         // functor of this hash table.  Note that this function's
         // implementation relies on the supplied 'hashValue' rather than
         // recomputing it, eliminating some redundant computation for the
-        // public methods.
+        // public methods.  Also note that, while an incremental rehash is in
+        // progress, both the current and the previous bucket arrays are
+        // searched.
 
     bslalg::HashTableBucket *getBucketAddress(SizeType bucketIndex) const;
         // Return the address of the bucket at the specified 'bucketIndex' in
@@ -2013,6 +2421,16 @@ class HashTable {
         // behavior is undefined unless 'node' points to a list-node of type
         // 'bslalg::BidirectionalNode<KEY_CONFIG::ValueType>'.
 
+    void prefetchBuckets(const native_std::size_t *hashCodes,
+                         native_std::size_t        numHashCodes) const;
+        // Issue a prefetch for the bucket of this hash table corresponding to
+        // each of the specified 'numHashCodes' hash codes in the array at the
+        // specified 'hashCodes' address, and then for the first node in each
+        // of those buckets.  The behavior is undefined unless
+        // 'numHashCodes <= k_BATCH_SIZE'.  Note that this method has no
+        // observable effect: it serves only to overlap the cache misses
+        // incurred by a batch of subsequent lookups.
+
   public:
     // CREATORS
     explicit HashTable(const ALLOCATOR& basicAllocator = ALLOCATOR());
@@ -2097,6 +2515,29 @@ class HashTable {
         // requirements might simplify in the future, if the standard is
         // updated.
 
+    void completeRehash();
+        // Move every element remaining in the previous bucket array of an
+        // incremental rehash into the current bucket array, and end the
+        // rehash.  This method has no effect unless 'isRehashInProgress()'.
+        // If the 'hasher' throws an exception, this hash table is left in a
+        // valid state with the rehash still in progress.  Note that this
+        // method does not invalidate any iterator, but may change the order
+        // in which elements are visited by iterating over the list of
+        // elements, as any rehash does.
+
+    void extractNode(NodeHandleType            *result,
+                     bslalg::BidirectionalLink *node);
+        // Remove the specified 'node' from this hash table, relocate its
+        // element into a detached node owned by the specified 'result' handle
+        // (destroying the element previously held by 'result', if any), and
+        // return the memory of 'node' to the node pool of this hash table for
+        // reuse.  If an exception is thrown, this hash table and 'result' are
+        // unchanged.  The behavior is undefined unless 'node' refers to a node
+        // in this hash table.  Note that the element is relocated without
+        // being copied if its type is bitwise moveable, and that the detached
+        // node remains valid after this hash table is destroyed (see
+        // {'bslstl_nodehandle'|Node Ownership}).
+
     template <class SOURCE_TYPE>
     bslalg::BidirectionalLink *insert(const SOURCE_TYPE& value);
         // Insert the specified 'value' into this hash-table, and return the
@@ -2124,6 +2565,25 @@ class HashTable {
         // The behavior is undefined unless 'hint' points to a node in this
         // hash table.
 
+    template <class INPUT_ITERATOR>
+    void insertBatch(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        // Insert into this hash table a newly created element for each value
+        // in the range starting at the specified 'first' iterator and ending
+        // immediately before the specified 'last' iterator, as if by calling
+        // 'insert' on each value in turn.  Additional buckets will be
+        // allocated, as needed, to preserve the invariant
+        // 'loadFactor <= maxLoadFactor'.  If this function tries to allocate a
+        // number of buckets larger than can be represented by this hash
+        // table's 'SizeType', a 'std::length_error' exception will be thrown.
+        // The (template parameter) type 'INPUT_ITERATOR' shall meet the
+        // requirements of an input iterator providing access to values from
+        // which a 'ValueType' can be constructed.  Note that the values are
+        // processed in batches: the hash codes of all the elements in a batch
+        // are computed, and the corresponding buckets prefetched, before any
+        // element of the batch is linked into the table.  Also note that the
+        // caller should reserve capacity for the whole range (e.g., using
+        // 'reserveForNumElements') when its length is known in advance.
+
     template <class SOURCE_TYPE>
     bslalg::BidirectionalLink *insertIfMissing(
                                             bool               *isInsertedFlag,
@@ -2159,6 +2619,105 @@ class HashTable {
         // number of buckets larger than can be represented by this hash
         // table's 'SizeType', a 'std::length_error' exception will be thrown.
 
+    bslalg::BidirectionalLink *insertIfMissingWithHashCode(
+                                        bool               *isInsertedFlag,
+                                        const ValueType&    value,
+                                        native_std::size_t  hashCode);
+        // Return the address of an element in this hash table having a key
+        // that compares equal to the key of the specified 'value' using the
+        // 'comparator' functor of this hash-table, and, if no such element
+        // exists, insert 'value' and return the address of the new node, as
+        // if by calling 'insertIfMissing(isInsertedFlag, value)', but without
+        // invoking the 'hasher' on the key of 'value'.  Load 'true' into the
+        // specified 'isInsertedFlag' if insertion is performed, and 'false'
+        // otherwise.  The behavior is undefined unless the specified
+        // 'hashCode' is the value that 'hasher()' returns for the key of
+        // 'value'.  Note that this method allows a client that has already
+        // hashed a key (e.g., to select one of several hash tables) to avoid
+        // hashing it again.
+
+    template <class INPUT_ITERATOR>
+    void insertIfMissingBatch(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        // Insert into this hash table a newly created element for each value
+        // in the range starting at the specified 'first' iterator and ending
+        // immediately before the specified 'last' iterator whose key does not
+        // compare equal (according to this hash-table's 'comparator') to the
+        // key of an element already in this hash table (including an element
+        // inserted from an earlier value in the range), as if by calling
+        // 'insertIfMissing' on each value in turn.  Additional buckets will be
+        // allocated, as needed, to preserve the invariant
+        // 'loadFactor <= maxLoadFactor'.  If this function tries to allocate a
+        // number of buckets larger than can be represented by this hash
+        // table's 'SizeType', a 'std::length_error' exception will be thrown.
+        // The (template parameter) type 'INPUT_ITERATOR' shall meet the
+        // requirements of an input iterator providing access to values from
+        // which a 'ValueType' can be constructed.  Note that the values are
+        // processed in batches: the hash codes of the keys in a batch are
+        // computed, and the corresponding buckets prefetched, before any key
+        // of the batch is looked up.  If 'INPUT_ITERATOR' is a forward
+        // iterator whose value type is 'ValueType', the keys are taken
+        // directly from the range, and a node is created only for a value
+        // whose key is not found; otherwise, a node is created for each value
+        // before its key is looked up, and destroyed if the key is found.  In
+        // either case, the bucket array grows only to accommodate a value that
+        // is actually inserted.
+
+    bslalg::BidirectionalLink *insertNode(
+                                       NodeHandleType            *handle,
+                                       bslalg::BidirectionalLink *hint = 0);
+        // Insert the node held by the specified 'handle' into this hash table,
+        // make 'handle' empty, and return the address of the node holding the
+        // element.  If the optionally specified 'hint' is not null and refers
+        // to an element having the same key as that element (according to this
+        // hash-table's 'comparator'), insert the node immediately before
+        // 'hint'; otherwise, if this hash-table already contains an element
+        // having the same key, insert the node immediately before the first
+        // element having the same key.  Additional buckets will be allocated,
+        // as needed, to preserve the invariant 'loadFactor <= maxLoadFactor'.
+        // If an exception is thrown, 'handle' is unchanged.  The behavior is
+        // undefined if 'handle' is empty.  Note that the node held by 'handle'
+        // is linked into this hash table if 'handle->get_allocator() ==
+        // allocator()' and the node pool of this hash table has no free node,
+        // and that the element is otherwise relocated into a node of this hash
+        // table (see {'bslstl_nodehandle'|Node Ownership}).
+
+    bslalg::BidirectionalLink *insertNodeIfMissing(
+                                                bool           *isInsertedFlag,
+                                                NodeHandleType *handle);
+        // Return the address of an element in this hash table having a key
+        // that compares equal to the key of the element held by the specified
+        // 'handle' using the 'comparator' functor of this hash-table.  If no
+        // such element exists, insert the node held by 'handle' into this
+        // hash table (as described for 'insertNode'), make 'handle' empty, and
+        // return the address of the node holding the element.  Load 'true'
+        // into the specified 'isInsertedFlag' if insertion is performed, and
+        // 'false' (leaving 'handle' unchanged) if an existing element having a
+        // matching key was found.  Additional buckets will be allocated, as
+        // needed, to preserve the invariant 'loadFactor <= maxLoadFactor'.  If
+        // an exception is thrown, 'handle' is unchanged.  The behavior is
+        // undefined if 'handle' is empty.
+
+    void merge(HashTable *source);
+        // Relocate each element of the specified 'source' hash table into
+        // this hash table, as if by extracting it from 'source' and calling
+        // 'insertNode', leaving 'source' empty.  This method has no effect if
+        // 'source' is this hash table.  If an exception is thrown, both hash
+        // tables are left in a valid state, each element being held by
+        // exactly one of them.  Note that no memory is allocated for the
+        // elements, and no memory is deallocated, if the element type is
+        // bitwise moveable and 'source->allocator() == allocator()' (unless
+        // the node pool of this hash table must grow).
+
+    void mergeIfMissing(HashTable *source);
+        // Relocate each element of the specified 'source' hash table whose key
+        // does not compare equal (according to this hash-table's
+        // 'comparator') to the key of an element of this hash table into this
+        // hash table, as if by extracting it from 'source' and calling
+        // 'insertNodeIfMissing'.  Elements whose key is already present remain
+        // in 'source'.  This method has no effect if 'source' is this hash
+        // table.  If an exception is thrown, both hash tables are left in a
+        // valid state, each element being held by exactly one of them.
+
     void rehashForNumBuckets(SizeType newNumBuckets);
         // Re-organize this hash-table to have at least the specified
         // 'newNumBuckets', preserving the invariant
@@ -2180,6 +2739,16 @@ class HashTable {
         // in the table.  The behavior is undefined unless 'node' refers to a
         // node in this hash-table.
 
+    bslalg::BidirectionalLink *removeWithHashCode(
+                                       bslalg::BidirectionalLink *node,
+                                       native_std::size_t         hashCode);
+        // Remove the specified 'node' from this hash-table, and return the
+        // address of the node immediately after 'node', as if by calling
+        // 'remove(node)', but without invoking the 'hasher' on the key of
+        // 'node'.  The behavior is undefined unless 'node' refers to a node in
+        // this hash-table, and the specified 'hashCode' is the value that
+        // 'hasher()' returns for the key of 'node'.
+
     void removeAll();
         // Remove all the elements from this hash-table.  Note that this
         // hash-table is empty after this call, but allocated memory may be
@@ -2199,6 +2768,16 @@ class HashTable {
         // guarantee, leaving the hash-table in a valid, but otherwise
         // unspecified (and potentially empty), state.
 
+    void setIncrementalRehash(bool incremental);
+        // Set whether this hash table grows its bucket array incrementally to
+        // the specified 'incremental'.  If 'incremental' is 'true', an
+        // insertion that would exceed the 'maxLoadFactor' allocates the larger
+        // bucket array but moves no elements into it; instead, each
+        // subsequent insertion moves the elements of a bounded number of
+        // buckets from the previous bucket array (see {Incremental Rehash}).
+        // If 'incremental' is 'false' and an incremental rehash is in
+        // progress, complete that rehash (see 'completeRehash').
+
     void setMaxLoadFactor(float newMaxLoadFactor);
         // Set the maximum load factor permitted by this hash table to the
         // specified 'newMaxLoadFactor', where load factor is the statistical
@@ -2225,6 +2804,52 @@ class HashTable {
         // 'bslstl::AllocatorTraits<ALLOCATOR>::propagate_on_container_swap' is
         // 'true'.
 
+    bslalg::BidirectionalLink *tryEmplace(
+                                                bool           *isInsertedFlag,
+                                                const KeyType&  key);
+
+    template <class ARG_1>
+    bslalg::BidirectionalLink *tryEmplace(
+                      bool                                     *isInsertedFlag,
+                      const KeyType&                            key,
+                      BSLS_COMPILERFEATURES_FORWARD_REF(ARG_1)  arg1);
+
+    template <class ARG_1, class ARG_2>
+    bslalg::BidirectionalLink *tryEmplace(
+                      bool                                     *isInsertedFlag,
+                      const KeyType&                            key,
+                      BSLS_COMPILERFEATURES_FORWARD_REF(ARG_1)  arg1,
+                      BSLS_COMPILERFEATURES_FORWARD_REF(ARG_2)  arg2);
+
+    template <class ARG_1, class ARG_2, class ARG_3>
+    bslalg::BidirectionalLink *tryEmplace(
+                      bool                                     *isInsertedFlag,
+                      const KeyType&                            key,
+                      BSLS_COMPILERFEATURES_FORWARD_REF(ARG_1)  arg1,
+                      BSLS_COMPILERFEATURES_FORWARD_REF(ARG_2)  arg2,
+                      BSLS_COMPILERFEATURES_FORWARD_REF(ARG_3)  arg3);
+        // Return the address of an element in this hash table having a key
+        // that compares equal to the specified 'key' using the 'comparator'
+        // functor of this hash table.  If no such element exists, insert a
+        // newly created element whose key is copy-constructed from 'key' and
+        // whose mapped value is constructed from the optionally specified
+        // 'arg1', 'arg2', and 'arg3' (or value-initialized if no such
+        // arguments are supplied), and return the address of that node.  Load
+        // 'true' into the specified 'isInsertedFlag' if insertion is
+        // performed, and 'false' if an existing element having a matching key
+        // was found.  If this hash table contains more than one element with
+        // a matching key, return the first such element (from the contiguous
+        // sequence of elements having a matching key).  Additional buckets
+        // will be allocated, as needed, to preserve the invariant
+        // 'loadFactor <= maxLoadFactor'.  If this function tries to allocate a
+        // number of buckets larger than can be represented by this hash
+        // table's 'SizeType', a 'std::length_error' exception will be thrown.
+        // The behavior is undefined unless 'ValueType' is a 'bsl::pair' (or
+        // has compatible 'first' and 'second' members) whose 'first' member
+        // is the key.  Note that, if an element having a matching key is
+        // found, neither a key nor a mapped value is constructed, and no
+        // memory is allocated.
+
     // ACCESSORS
     ALLOCATOR allocator() const;
         // Return a copy of the allocator used to construct this hash table.
@@ -2236,7 +2861,10 @@ class HashTable {
     const bslalg::HashTableBucket& bucketAtIndex(SizeType index) const;
         // Return a non-modifiable reference to the 'HashTableBucket' at the
         // specified 'index' position in the array of buckets of this table.
-        // The behavior is undefined unless 'index < numBuckets()'.
+        // The behavior is undefined unless 'index < numBuckets()'.  Note that
+        // the bucket does not include elements that an incremental rehash in
+        // progress has yet to move into the current bucket array (see
+        // 'completeRehash').
 
     SizeType bucketIndexForKey(const KeyType& key) const;
         // Return the index of the bucket that would contain all the elements
@@ -2249,7 +2877,9 @@ class HashTable {
     SizeType countElementsInBucket(SizeType index) const;
         // Return the number elements contained in the bucket at the specified
         // 'index'.  Note that this operation has linear run-time complexity
-        // with respect to the number of elements in the indexed bucket.
+        // with respect to the number of elements in the indexed bucket.  Also
+        // note that elements that an incremental rehash in progress has yet to
+        // move into the current bucket array are not counted.
 
     bslalg::BidirectionalLink *elementListRoot() const;
         // Return the address of the first element in this hash table, or a
@@ -2263,6 +2893,29 @@ class HashTable {
         // first such element (from the contiguous sequence of elements having
         // the same key).
 
+    bslalg::BidirectionalLink *findWithHashCode(
+                                     const KeyType&     key,
+                                     native_std::size_t hashCode) const;
+        // Return the address of a link whose key has the same value as the
+        // specified 'key', as if by calling 'find(key)', but without invoking
+        // the 'hasher' on 'key'.  The behavior is undefined unless the
+        // specified 'hashCode' is the value that 'hasher()' returns for
+        // 'key'.
+
+    void findBatch(bslalg::BidirectionalLink **results,
+                   const KeyType              *keys,
+                   SizeType                    numKeys) const;
+        // Load into each of the specified 'numKeys' elements of the specified
+        // 'results' array the value that 'find' would return for the
+        // corresponding element of the specified 'keys' array.  The behavior
+        // is undefined unless 'results' and 'keys' each refer to an array of
+        // at least 'numKeys' elements.  Note that the keys are processed in
+        // batches: the hash codes of all the keys in a batch are computed, and
+        // the corresponding buckets (and the first node in each) prefetched,
+        // before any key of the batch is compared with the elements of this
+        // hash table, so that the cache misses for the keys in a batch
+        // overlap rather than occur one after another.
+
     bslalg::BidirectionalLink *findEndOfRange(
                                        bslalg::BidirectionalLink *first) const;
         // Return the address of the first node after any nodes holding a value
@@ -2287,6 +2940,34 @@ class HashTable {
         // the element following the range).  Also note that this hash-table
         // ensures all elements having the same key form a contiguous sequence.
 
+    template <class LOOKUP_KEY>
+    bslalg::BidirectionalLink *findTransparent(const LOOKUP_KEY& key) const;
+        // Return the address of a link whose key is equivalent to the
+        // specified 'key' (according to this hash-table's 'comparator'), and a
+        // null pointer value if no such link exists.  If this hash-table
+        // contains more than one element having a key equivalent to 'key',
+        // return the first such element (from the contiguous sequence of
+        // elements having the same key).  'key' is passed, without conversion
+        // to 'KeyType', to both the 'hasher' and the 'comparator' of this
+        // hash-table.  The behavior is undefined unless the 'hasher' returns
+        // the same hash code for 'key' as for every 'KeyType' value that the
+        // 'comparator' considers equivalent to 'key'.  Note that this method
+        // is intended to support containers whose hasher and comparator are
+        // both transparent (i.e., declare the nested type 'is_transparent').
+
+    template <class LOOKUP_KEY>
+    void findRangeTransparent(bslalg::BidirectionalLink **first,
+                              bslalg::BidirectionalLink **last,
+                              const LOOKUP_KEY&           key) const;
+        // Load into the specified 'first' and 'last' pointers the respective
+        // addresses of the first and last link (in the list of elements owned
+        // by this hash table) where the contained elements have a key that is
+        // equivalent to the specified 'key' using the 'comparator' of this
+        // hash-table, and null pointers values if there are no elements
+        // matching 'key'.  The behavior is undefined unless the requirements
+        // described for 'findTransparent' are satisfied.  Note that the
+        // output values form a range as described for 'findRange'.
+
     bool hasSameValue(const HashTable& other) const;
         // Return 'true' if the specified 'other' has the same value as this
         // object, and 'false' otherwise.  Two 'HashTable' objects have the
@@ -2307,6 +2988,15 @@ class HashTable {
         // Return a reference providing non-modifiable access to the hash
         // functor used by this hash-table.
 
+    bool incrementalRehash() const;
+        // Return 'true' if this hash table grows its bucket array
+        // incrementally, and 'false' otherwise (see 'setIncrementalRehash').
+
+    bool isRehashInProgress() const;
+        // Return 'true' if some elements of this hash table are yet to be
+        // moved from the previous bucket array of an incremental rehash, and
+        // 'false' otherwise.
+
     float loadFactor() const;
         // Return the current load factor for this table.  The load factor is
         // the statical mean number of elements per bucket.
@@ -2335,7 +3025,15 @@ class HashTable {
         // size, or even close to that size without running out of resources.
 
     SizeType numBuckets() const;
-        // Return the number of buckets contained in this hash table.
+        // Return the number of buckets contained in this hash table.  Note
+        // that this is the size of the current bucket array if an incremental
+        // rehash is in progress.
+
+    SizeType numBucketsPendingRehash() const;
+        // Return the number of buckets of the previous bucket array that an
+        // incremental rehash has yet to visit, and 0 if no rehash is in
+        // progress.  Note that some of these buckets may already be empty,
+        // having been drained on insertion of a key that they held.
 
     SizeType rehashThreshold() const;
         // Return the number of elements this hash table can hold without
@@ -2344,6 +3042,16 @@ class HashTable {
 
     SizeType size() const;
         // Return the number of elements in this hash table.
+
+    HashTableStatistics statistics() const;
+        // Return a description of the distribution of the elements of this
+        // hash table among the buckets of its current bucket array, and of
+        // the memory used by its nodes and bucket arrays (see {Statistics}).
+        // Note that this operation has linear run-time complexity with
+        // respect to the number of buckets and elements.  Also note that, if
+        // an incremental rehash is in progress, the elements yet to be moved
+        // into the current bucket array are not included in the occupancy
+        // figures.
 };
 
 template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
@@ -2483,50 +3191,62 @@ class HashTable_NodeProctor {
         // If no object is currently being managed, this method has no effect.
 };
 
-                    // ==========================
-                    // class HashTable_ImpDetails
-                    // ==========================
+                    // ================================
+                    // class HashTable_NodeBatchProctor
+                    // ================================
 
-struct HashTable_ImpDetails {
-    // This utility 'struct' provides a namespace for functions that are useful
-    // when implementing a hash table.
+template <class FACTORY>
+class HashTable_NodeBatchProctor {
+    // This class implements a proctor that, unless its 'release' method has
+    // previously been invoked, automatically deallocates each node in a
+    // managed array of nodes upon destruction by invoking the 'deleteNode'
+    // method of a supplied factory.  Null elements of the managed array are
+    // ignored, so that a client may relinquish management of an individual
+    // node by overwriting its array element with 0.  The (template parameter)
+    // type 'FACTORY' shall provide a member function that can be called as if
+    // it had the following signature:
+    //..
+    //  void deleteNode(bslalg::BidirectionalLink *node);
+    //..
 
-    // CLASS METHODS
-    static bslalg::HashTableBucket *defaultBucketAddress();
-        // Return the address of a statically initialized empty bucket that can
-        // be shared as the (un-owned) bucket array by all empty hash tables.
+  private:
+    // DATA
+    FACTORY                    *d_factory;   // factory to delete nodes
+    bslalg::BidirectionalLink **d_nodes;     // managed array (held, not
+                                             // owned)
+    native_std::size_t          d_numNodes;  // length of managed array
 
-    static size_t growBucketsForLoadFactor(size_t *capacity,
-                                           size_t  minElements,
-                                           size_t  requestedBuckets,
-                                           double  maxLoadFactor);
-        // Return the suggested number of buckets to index a linked list that
-        // can hold as many as the specified 'minElements' without exceeding
-        // the specified 'maxLoadFactor', and supporting at least the specified
-        // number of 'requestedBuckets'.  Set the specified '*capacity' to the
-        // maximum length of linked list that the returned number of buckets
-        // could index without exceeding the 'maxLoadFactor'.  The behavior is
-        // undefined unless '0 < maxLoadFactor', '0 < minElements' and
-        // '0 < requestedBuckets'.
+  private:
+    // NOT IMPLEMENTED
+    HashTable_NodeBatchProctor(const HashTable_NodeBatchProctor&);
+    HashTable_NodeBatchProctor& operator=(const HashTable_NodeBatchProctor&);
 
-    static bslma::Allocator *incidentalAllocator();
-        // Return that address of an allocator that can be used to allocate
-        // temporary storage, but that is neither the default nor global
-        // allocator.  Note that this function is intended to support detailed
-        // checks in 'SAFE_2' builds, that may need additional storage for the
-        // evaluation of a validity check on a large data structure, but that
-        // should not change the expected values computed for regular allocator
-        // usage of the component as validated by the test driver.
+  public:
+    // CREATORS
+    HashTable_NodeBatchProctor(FACTORY                    *factory,
+                               bslalg::BidirectionalLink **nodes);
+        // Create a new node-batch-proctor that manages an initially empty
+        // array of nodes starting at the specified 'nodes' address, and that
+        // uses the specified 'factory' to destroy the (non-null) nodes in
+        // that array (unless released) upon its destruction.  The behavior is
+        // undefined unless every node subsequently placed under management
+        // was created by the 'factory'.
+
+    ~HashTable_NodeBatchProctor();
+        // Destroy this node-batch-proctor, and delete each non-null node in
+        // the array that it manages by invoking the 'deleteNode' method of
+        // the factory supplied at construction.
 
-    static size_t nextPrime(size_t n);
-        // Return the next prime number greater-than or equal to the specified
-        // 'n' in the increasing sequence of primes chosen to disperse hash
-        // codes across buckets as uniformly as possible.  Throw a
-        // 'std::length_error' exception if 'n' is greater than the last prime
-        // number in the sequence.  Note that, typically, prime numbers in the
-        // sequence have increasing values that reflect a growth factor (e.g.,
-        // each value in the sequence may be, approximately, two times the
-        // preceding value).
+    // MANIPULATORS
+    void manage(native_std::size_t numNodes);
+        // Manage the first specified 'numNodes' elements of the array
+        // supplied at construction, each of which must be either a null
+        // pointer value or the address of a node created by the factory.
+
+    void release();
+        // Release from management all of the nodes currently managed by this
+        // proctor.  If no object is currently being managed, this method has
+        // no effect.
 };
 
                     // ====================
@@ -2559,7 +3279,9 @@ struct HashTable_Util {
                            const ALLOCATOR&         allocator);
         // Load into the specified 'anchor' a (contiguous) array of buckets of
         // the specified 'bucketArraySize' using memory supplied by the
-        // specified 'allocator'.  The behavior is undefined unless
+        // specified 'allocator'.  Throw a 'std::length_error' exception if
+        // 'bucketArraySize' cannot be represented by the 'size_type' of
+        // 'allocator'.  The behavior is undefined unless
         // '0 < bucketArraySize' and '0 == anchor->bucketArraySize()'.  Note
         // that this operation has no effect on 'anchor->listRootAddress()'.
 
@@ -2571,6 +3293,165 @@ struct HashTable_Util {
         // 'bucketArraySize', that was allocated by the specified 'allocator'.
 };
 
+                         // ========================
+                         // class HashTable_NodeType
+                         // ========================
+
+template <class VALUE_TYPE, class HASHER>
+struct HashTable_NodeType {
+    // This metafunction provides a 'Type' alias for the node type in which a
+    // hash table using the specified 'HASHER' stores elements of the specified
+    // 'VALUE_TYPE': 'bslalg::BidirectionalHashedNode<VALUE_TYPE>' if 'HASHER'
+    // is associated with the 'CachesHashCodes' trait, and
+    // 'bslalg::BidirectionalNode<VALUE_TYPE>' otherwise.
+
+    typedef typename bsl::conditional<
+                               CachesHashCodes<HASHER>::value,
+                               bslalg::BidirectionalHashedNode<VALUE_TYPE>,
+                               bslalg::BidirectionalNode<VALUE_TYPE> >::type
+                                                                          Type;
+};
+
+                         // ========================
+                         // class HashTable_NodeUtil
+                         // ========================
+
+template <class KEY_CONFIG, bool STORES_HASH_CODES>
+struct HashTable_NodeUtil {
+    // This utility 'struct' provides a namespace for the operations of a hash
+    // table that depend on whether its nodes store their hash codes.  This
+    // primary template handles nodes of type
+    // 'bslalg::BidirectionalNode<KEY_CONFIG::ValueType>', which do not.
+
+    // TYPES
+    typedef typename
+           bslalg::HashTableImpUtil_ExtractKeyResult<KEY_CONFIG>::Type KeyRef;
+        // Type of a reference to the key of an element.
+
+    // CLASS METHODS
+    static void setHashCode(bslalg::BidirectionalLink *node,
+                            native_std::size_t         hashCode);
+        // Do nothing: the specified 'node' has no storage for the specified
+        // 'hashCode'.
+
+    template <class HASHER>
+    static native_std::size_t hashCode(bslalg::BidirectionalLink *node,
+                                       const HASHER&              hasher);
+        // Return the value of the specified 'hasher' for the key of the
+        // element held by the specified 'node'.
+
+    template <class KEY_EQUAL, class BUCKET_INDEX>
+    static bslalg::BidirectionalLink *find(
+                                  const bslalg::HashTableAnchor&  anchor,
+                                  KeyRef                          key,
+                                  const KEY_EQUAL&                comparator,
+                                  native_std::size_t              hashCode,
+                                  BUCKET_INDEX                    bucketIndex);
+        // Return the address of the first node in the specified 'anchor'
+        // having a key that the specified 'comparator' reports as equivalent
+        // to the specified 'key', whose hash code is the specified 'hashCode',
+        // and 0 if there is no such node.  Locate the bucket of 'hashCode' as
+        // selected by the specified 'bucketIndex', a
+        // 'bslalg::HashTableImpUtil_BucketIndex' tag.
+
+    template <class LOOKUP_KEY, class KEY_EQUAL, class BUCKET_INDEX>
+    static bslalg::BidirectionalLink *findTransparent(
+                                  const bslalg::HashTableAnchor&  anchor,
+                                  const LOOKUP_KEY&               key,
+                                  const KEY_EQUAL&                comparator,
+                                  native_std::size_t              hashCode,
+                                  BUCKET_INDEX                    bucketIndex);
+        // Return the address of the first node in the specified 'anchor'
+        // having a key that the specified 'comparator' reports as equivalent
+        // to the specified 'key' (of a type other than 'KeyType'), whose hash
+        // code is the specified 'hashCode', and 0 if there is no such node.
+        // Locate the bucket of 'hashCode' as selected by the specified
+        // 'bucketIndex', a 'bslalg::HashTableImpUtil_BucketIndex' tag.
+
+    template <class HASHER, class BUCKET_INDEX>
+    static void rehash(bslalg::HashTableAnchor   *newAnchor,
+                       bslalg::BidirectionalLink *elementList,
+                       const HASHER&              hasher,
+                       BUCKET_INDEX               bucketIndex);
+        // Populate the specified 'newAnchor' with all the nodes in the
+        // specified 'elementList', using the specified 'hasher', and the
+        // specified 'bucketIndex' (a 'bslalg::HashTableImpUtil_BucketIndex'
+        // tag), to determine the bucket of each node.  If 'hasher' throws an
+        // exception, the nodes are left in a valid list rooted at 'newAnchor'
+        // (see 'bslalg::HashTableImpUtil::rehash').
+};
+
+template <class KEY_CONFIG>
+struct HashTable_NodeUtil<KEY_CONFIG, true> {
+    // This partial specialization handles nodes of type
+    // 'bslalg::BidirectionalHashedNode<KEY_CONFIG::ValueType>', which store
+    // the hash code of their element, so that no operation of this 'struct'
+    // calls a hash functor.
+
+    // TYPES
+    typedef bslalg::BidirectionalHashedNode<typename KEY_CONFIG::ValueType>
+                                                                      NodeType;
+        // Type of the nodes in the table.
+
+    typedef typename
+           bslalg::HashTableImpUtil_ExtractKeyResult<KEY_CONFIG>::Type KeyRef;
+        // Type of a reference to the key of an element.
+
+    // CLASS METHODS
+    static void setHashCode(bslalg::BidirectionalLink *node,
+                            native_std::size_t         hashCode);
+        // Store the specified 'hashCode' in the specified 'node'.
+
+    template <class HASHER>
+    static native_std::size_t hashCode(bslalg::BidirectionalLink *node,
+                                       const HASHER&              hasher);
+        // Return the hash code stored in the specified 'node'.  Note that the
+        // specified 'hasher' is not called.
+
+    template <class KEY_EQUAL, class BUCKET_INDEX>
+    static bslalg::BidirectionalLink *find(
+                                  const bslalg::HashTableAnchor&  anchor,
+                                  KeyRef                          key,
+                                  const KEY_EQUAL&                comparator,
+                                  native_std::size_t              hashCode,
+                                  BUCKET_INDEX                    bucketIndex);
+        // Return the address of the first node in the specified 'anchor'
+        // having a key that the specified 'comparator' reports as equivalent
+        // to the specified 'key', whose hash code is the specified 'hashCode',
+        // and 0 if there is no such node.  Locate the bucket of 'hashCode' as
+        // selected by the specified 'bucketIndex', a
+        // 'bslalg::HashTableImpUtil_BucketIndex' tag.  'comparator' is called
+        // only for nodes whose stored hash code is 'hashCode'.
+
+    template <class LOOKUP_KEY, class KEY_EQUAL, class BUCKET_INDEX>
+    static bslalg::BidirectionalLink *findTransparent(
+                                  const bslalg::HashTableAnchor&  anchor,
+                                  const LOOKUP_KEY&               key,
+                                  const KEY_EQUAL&                comparator,
+                                  native_std::size_t              hashCode,
+                                  BUCKET_INDEX                    bucketIndex);
+        // Return the address of the first node in the specified 'anchor'
+        // having a key that the specified 'comparator' reports as equivalent
+        // to the specified 'key' (of a type other than 'KeyType'), whose hash
+        // code is the specified 'hashCode', and 0 if there is no such node.
+        // Locate the bucket of 'hashCode' as selected by the specified
+        // 'bucketIndex', a 'bslalg::HashTableImpUtil_BucketIndex' tag.
+        // 'comparator' is called only for nodes whose stored hash code is
+        // 'hashCode'.
+
+    template <class HASHER, class BUCKET_INDEX>
+    static void rehash(bslalg::HashTableAnchor   *newAnchor,
+                       bslalg::BidirectionalLink *elementList,
+                       const HASHER&              hasher,
+                       BUCKET_INDEX               bucketIndex);
+        // Populate the specified 'newAnchor' with all the nodes in the
+        // specified 'elementList', using the hash code stored in each node,
+        // and the specified 'bucketIndex' (a
+        // 'bslalg::HashTableImpUtil_BucketIndex' tag), to determine its
+        // bucket.  Note that the specified 'hasher' is not called, so this
+        // operation cannot throw.
+};
+
                    // ==============================
                    // class HashTable_ImplParameters
                    // ==============================
@@ -2614,7 +3495,8 @@ class HashTable_ImplParameters
     typedef ALLOCATOR                              AllocatorType;
     typedef ::bsl::allocator_traits<AllocatorType> AllocatorTraits;
     typedef typename KEY_CONFIG::ValueType         ValueType;
-    typedef bslalg::BidirectionalNode<ValueType>   NodeType;
+    typedef typename HashTable_NodeType<ValueType, HASHER>::Type
+                                                   NodeType;
 
   public:
     // PUBLIC TYPES
@@ -2623,9 +3505,9 @@ class HashTable_ImplParameters
                                 template rebind_traits<NodeType> ReboundTraits;
     typedef typename ReboundTraits::allocator_type               NodeAllocator;
 
-    typedef
-    BidirectionalNodePool<typename HashTableType::ValueType, NodeAllocator>
-                                                                   NodeFactory;
+    typedef BidirectionalNodePool<typename HashTableType::ValueType,
+                                  NodeAllocator,
+                                  NodeType>                        NodeFactory;
 
   private:
     // DATA
@@ -2755,7 +3637,9 @@ inline
 native_std::size_t
 HashTable_HashWrapper<FUNCTOR>::operator()(ARG_TYPE& arg) const
 {
-    return d_functor(arg);
+    return HashTable_ImpDetails::adjustHashCode(
+                                       d_functor(arg),
+                                       UsesPowerOfTwoBuckets<FUNCTOR>::value);
 }
 
 template <class FUNCTOR>
@@ -2796,7 +3680,9 @@ inline
 native_std::size_t
 HashTable_HashWrapper<const FUNCTOR>::operator()(ARG_TYPE& arg) const
 {
-    return d_functor(arg);
+    return HashTable_ImpDetails::adjustHashCode(
+                                       d_functor(arg),
+                                       UsesPowerOfTwoBuckets<FUNCTOR>::value);
 }
 
 template <class FUNCTOR>
@@ -2821,7 +3707,9 @@ inline
 native_std::size_t
 HashTable_HashWrapper<FUNCTOR &>::operator()(ARG_TYPE& arg) const
 {
-    return d_functor(arg);
+    return HashTable_ImpDetails::adjustHashCode(
+                                       d_functor(arg),
+                                       UsesPowerOfTwoBuckets<FUNCTOR>::value);
 }
 
 template <class FUNCTOR>
@@ -2970,6 +3858,50 @@ void HashTable_NodeProctor<FACTORY>::release()
     d_node = 0;
 }
 
+                    // --------------------------------
+                    // class HashTable_NodeBatchProctor
+                    // --------------------------------
+
+// CREATORS
+template <class FACTORY>
+inline
+HashTable_NodeBatchProctor<FACTORY>::HashTable_NodeBatchProctor(
+                                           FACTORY                    *factory,
+                                           bslalg::BidirectionalLink **nodes)
+: d_factory(factory)
+, d_nodes(nodes)
+, d_numNodes(0)
+{
+    BSLS_ASSERT_SAFE(factory);
+    BSLS_ASSERT_SAFE(nodes);
+}
+
+template <class FACTORY>
+inline
+HashTable_NodeBatchProctor<FACTORY>::~HashTable_NodeBatchProctor()
+{
+    for (native_std::size_t i = 0; i != d_numNodes; ++i) {
+        if (d_nodes[i]) {
+            d_factory->deleteNode(d_nodes[i]);
+        }
+    }
+}
+
+// MANIPULATORS
+template <class FACTORY>
+inline
+void HashTable_NodeBatchProctor<FACTORY>::manage(native_std::size_t numNodes)
+{
+    d_numNodes = numNodes;
+}
+
+template <class FACTORY>
+inline
+void HashTable_NodeBatchProctor<FACTORY>::release()
+{
+    d_numNodes = 0;
+}
+
                     // ----------------------------
                     // class HashTable_ArrayProctor
                     // ----------------------------
@@ -3013,6 +3945,31 @@ void HashTable_ArrayProctor<FACTORY>::release()
     d_anchor = 0;
 }
 
+                    // --------------------------
+                    // class HashTable_ImpDetails
+                    // --------------------------
+
+// CLASS METHODS
+inline
+size_t HashTable_ImpDetails::adjustHashCode(size_t hashCode, bool mix)
+{
+    if (!mix) {
+        return hashCode;                                              // RETURN
+    }
+
+    // Multiply by an odd constant derived from the golden ratio, so that every
+    // bit of 'hashCode' contributes to the high-order half of the product,
+    // then fold that half into the low-order bits used to index the buckets.
+
+#if defined(BSLS_PLATFORM_CPU_64_BIT)
+    hashCode *= 0x9E3779B97F4A7C15ULL;
+    return hashCode ^ (hashCode >> 32);
+#else
+    hashCode *= 0x9E3779B9U;
+    return hashCode ^ (hashCode >> 16);
+#endif
+}
+
                     // --------------------
                     // class HashTable_Util
                     // --------------------
@@ -3055,8 +4012,12 @@ void HashTable_Util::initAnchor(bslalg::HashTableAnchor *anchor,
     typedef ::bsl::allocator_traits<ArrayAllocator>       ArrayAllocatorTraits;
     typedef typename ArrayAllocatorTraits::size_type         SizeType;
 
-    BSLS_ASSERT_SAFE(
-               bucketArraySize <= native_std::numeric_limits<SizeType>::max());
+    // The number of buckets is chosen from a sequence (of primes or powers of
+    // two) that may extend beyond the range of a narrow 'SizeType'.
+
+    if (bucketArraySize > native_std::numeric_limits<SizeType>::max()) {
+        StdExceptUtil::throwLengthError("The number of buckets overflows.");
+    }
 
     ArrayAllocator reboundAllocator(allocator);
 
@@ -3119,24 +4080,176 @@ void HashTable_Util::destroyBucketArray(
     }
 }
 
-                //-------------------------------
-                // class HashTable_ImplParameters
-                //-------------------------------
+                         //-------------------------
+                         // class HashTable_NodeUtil
+                         //-------------------------
 
-    // CREATORS
-template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+// CLASS METHODS
+template <class KEY_CONFIG, bool STORES_HASH_CODES>
 inline
-HashTable_ImplParameters<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::
-HashTable_ImplParameters(const ALLOCATOR& allocator)
-: BaseHasher()
-, BaseComparator()
-, d_nodeFactory(allocator)
+void HashTable_NodeUtil<KEY_CONFIG, STORES_HASH_CODES>::setHashCode(
+                                                 bslalg::BidirectionalLink *,
+                                                 native_std::size_t         )
 {
 }
 
-template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+template <class KEY_CONFIG, bool STORES_HASH_CODES>
+template <class HASHER>
 inline
-HashTable_ImplParameters<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::
+native_std::size_t
+HashTable_NodeUtil<KEY_CONFIG, STORES_HASH_CODES>::hashCode(
+                                             bslalg::BidirectionalLink *node,
+                                             const HASHER&              hasher)
+{
+    BSLS_ASSERT_SAFE(node);
+
+    return hasher(bslalg::HashTableImpUtil::extractKey<KEY_CONFIG>(node));
+}
+
+template <class KEY_CONFIG, bool STORES_HASH_CODES>
+template <class KEY_EQUAL, class BUCKET_INDEX>
+inline
+bslalg::BidirectionalLink *
+HashTable_NodeUtil<KEY_CONFIG, STORES_HASH_CODES>::find(
+                                   const bslalg::HashTableAnchor&  anchor,
+                                   KeyRef                          key,
+                                   const KEY_EQUAL&                comparator,
+                                   native_std::size_t              hashCode,
+                                   BUCKET_INDEX                    bucketIndex)
+{
+    return bslalg::HashTableImpUtil::find<KEY_CONFIG>(anchor,
+                                                      key,
+                                                      comparator,
+                                                      hashCode,
+                                                      bucketIndex);
+}
+
+template <class KEY_CONFIG, bool STORES_HASH_CODES>
+template <class LOOKUP_KEY, class KEY_EQUAL, class BUCKET_INDEX>
+inline
+bslalg::BidirectionalLink *
+HashTable_NodeUtil<KEY_CONFIG, STORES_HASH_CODES>::findTransparent(
+                                   const bslalg::HashTableAnchor&  anchor,
+                                   const LOOKUP_KEY&               key,
+                                   const KEY_EQUAL&                comparator,
+                                   native_std::size_t              hashCode,
+                                   BUCKET_INDEX                    bucketIndex)
+{
+    return bslalg::HashTableImpUtil::findTransparent<KEY_CONFIG>(anchor,
+                                                                 key,
+                                                                 comparator,
+                                                                 hashCode,
+                                                                 bucketIndex);
+}
+
+template <class KEY_CONFIG, bool STORES_HASH_CODES>
+template <class HASHER, class BUCKET_INDEX>
+inline
+void HashTable_NodeUtil<KEY_CONFIG, STORES_HASH_CODES>::rehash(
+                                        bslalg::HashTableAnchor   *newAnchor,
+                                        bslalg::BidirectionalLink *elementList,
+                                        const HASHER&              hasher,
+                                        BUCKET_INDEX               bucketIndex)
+{
+    bslalg::HashTableImpUtil::rehash<KEY_CONFIG>(newAnchor,
+                                                 elementList,
+                                                 hasher,
+                                                 bucketIndex);
+}
+
+template <class KEY_CONFIG>
+inline
+void HashTable_NodeUtil<KEY_CONFIG, true>::setHashCode(
+                                           bslalg::BidirectionalLink *node,
+                                           native_std::size_t         hashCode)
+{
+    BSLS_ASSERT_SAFE(node);
+
+    static_cast<NodeType *>(node)->setHashCode(hashCode);
+}
+
+template <class KEY_CONFIG>
+template <class HASHER>
+inline
+native_std::size_t HashTable_NodeUtil<KEY_CONFIG, true>::hashCode(
+                                             bslalg::BidirectionalLink *node,
+                                             const HASHER&              )
+{
+    BSLS_ASSERT_SAFE(node);
+
+    return static_cast<NodeType *>(node)->hashCode();
+}
+
+template <class KEY_CONFIG>
+template <class KEY_EQUAL, class BUCKET_INDEX>
+inline
+bslalg::BidirectionalLink *HashTable_NodeUtil<KEY_CONFIG, true>::find(
+                                   const bslalg::HashTableAnchor&  anchor,
+                                   KeyRef                          key,
+                                   const KEY_EQUAL&                comparator,
+                                   native_std::size_t              hashCode,
+                                   BUCKET_INDEX                    bucketIndex)
+{
+    return bslalg::HashTableImpUtil::findUsingStoredHashCodes<KEY_CONFIG>(
+                                                                  anchor,
+                                                                  key,
+                                                                  comparator,
+                                                                  hashCode,
+                                                                  bucketIndex);
+}
+
+template <class KEY_CONFIG>
+template <class LOOKUP_KEY, class KEY_EQUAL, class BUCKET_INDEX>
+inline
+bslalg::BidirectionalLink *
+HashTable_NodeUtil<KEY_CONFIG, true>::findTransparent(
+                                   const bslalg::HashTableAnchor&  anchor,
+                                   const LOOKUP_KEY&               key,
+                                   const KEY_EQUAL&                comparator,
+                                   native_std::size_t              hashCode,
+                                   BUCKET_INDEX                    bucketIndex)
+{
+    return bslalg::HashTableImpUtil::findUsingStoredHashCodes<KEY_CONFIG>(
+                                                                  anchor,
+                                                                  key,
+                                                                  comparator,
+                                                                  hashCode,
+                                                                  bucketIndex);
+}
+
+template <class KEY_CONFIG>
+template <class HASHER, class BUCKET_INDEX>
+inline
+void HashTable_NodeUtil<KEY_CONFIG, true>::rehash(
+                                        bslalg::HashTableAnchor   *newAnchor,
+                                        bslalg::BidirectionalLink *elementList,
+                                        const HASHER&              ,
+                                        BUCKET_INDEX               bucketIndex)
+{
+    bslalg::HashTableImpUtil::rehashUsingStoredHashCodes<KEY_CONFIG>(
+                                                                  newAnchor,
+                                                                  elementList,
+                                                                  bucketIndex);
+}
+
+                //-------------------------------
+                // class HashTable_ImplParameters
+                //-------------------------------
+
+    // CREATORS
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+inline
+HashTable_ImplParameters<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::
+HashTable_ImplParameters(const ALLOCATOR& allocator)
+: BaseHasher()
+, BaseComparator()
+, d_nodeFactory(allocator)
+{
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+inline
+HashTable_ImplParameters<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::
 HashTable_ImplParameters(const HASHER&     hash,
                          const COMPARATOR& compare,
                          const ALLOCATOR&  allocator)
@@ -3274,10 +4387,49 @@ const HASHER& HashTable_ImplParameters<KEY_CONFIG,
     return static_cast<const BaseHasher *>(this)->functor();
 }
 
+                        //--------------------------
+                        // struct HashTableStatistics
+                        //--------------------------
+
+// CREATORS
+inline
+HashTableStatistics::HashTableStatistics()
+: d_numElements(0)
+, d_numBuckets(0)
+, d_numEmptyBuckets(0)
+, d_maxChainLength(0)
+, d_meanChainLength(0.0)
+, d_emptyBucketRatio(0.0)
+, d_nodeBytes(0)
+, d_bucketArrayBytes(0)
+, d_numRehashes(0)
+{
+    for (int i = 0; i != k_NUM_HISTOGRAM_BINS; ++i) {
+        d_occupancyHistogram[i] = 0;
+    }
+}
+
                         //----------------
                         // class HashTable
                         //----------------
 
+// PRIVATE CONSTANTS
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+const HashTable_ImpDetails::BucketPolicy
+HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::k_BUCKET_POLICY;
+
+// PRIVATE CLASS METHODS
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+inline
+native_std::size_t
+HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::adjustHashCode(
+                                                   native_std::size_t hashCode)
+{
+    return HashTable_ImpDetails::adjustHashCode(
+                                        hashCode,
+                                        UsesPowerOfTwoBuckets<HASHER>::value);
+}
+
 // CREATORS
 template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
 inline
@@ -3288,6 +4440,10 @@ HashTable(const ALLOCATOR& basicAllocator)
 , d_size()
 , d_capacity()
 , d_maxLoadFactor(1.0)
+, d_oldAnchor(HashTable_ImpDetails::defaultBucketAddress(), 1, 0)
+, d_rehashIndex(1)
+, d_incrementalRehash(false)
+, d_numRehashes(0)
 {
     BSLMF_ASSERT(!bsl::is_pointer<HASHER>::value &&
                  !bsl::is_pointer<COMPARATOR>::value);
@@ -3306,6 +4462,10 @@ HashTable(const HASHER&     hash,
 , d_size()
 , d_capacity(0)
 , d_maxLoadFactor(initialMaxLoadFactor)
+, d_oldAnchor(HashTable_ImpDetails::defaultBucketAddress(), 1, 0)
+, d_rehashIndex(1)
+, d_incrementalRehash(false)
+, d_numRehashes(0)
 {
     BSLS_ASSERT(0.0f < initialMaxLoadFactor);
 
@@ -3322,7 +4482,8 @@ HashTable(const HASHER&     hash,
                                         &capacity,
                                         1,
                                         static_cast<size_t>(initialNumBuckets),
-                                        d_maxLoadFactor);
+                                        d_maxLoadFactor,
+                                        k_BUCKET_POLICY);
         HashTable_Util::initAnchor(&d_anchor, numBuckets, basicAllocator);
         d_capacity = static_cast<SizeType>(capacity);
     }
@@ -3339,6 +4500,10 @@ HashTable(const HashTable& original)
 , d_size(original.d_size)
 , d_capacity(0)
 , d_maxLoadFactor(original.d_maxLoadFactor)
+, d_oldAnchor(HashTable_ImpDetails::defaultBucketAddress(), 1, 0)
+, d_rehashIndex(1)
+, d_incrementalRehash(original.d_incrementalRehash)
+, d_numRehashes(0)
 {
     if (0 < d_size) {
         d_parameters.nodeFactory().reserveNodes(original.d_size);
@@ -3355,6 +4520,10 @@ HashTable(const HashTable& original, const ALLOCATOR& allocator)
 , d_size(original.d_size)
 , d_capacity(0)
 , d_maxLoadFactor(original.d_maxLoadFactor)
+, d_oldAnchor(HashTable_ImpDetails::defaultBucketAddress(), 1, 0)
+, d_rehashIndex(1)
+, d_incrementalRehash(original.d_incrementalRehash)
+, d_numRehashes(0)
 {
     if (0 < d_size) {
         d_parameters.nodeFactory().reserveNodes(original.d_size);
@@ -3377,7 +4546,11 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::~HashTable()
     // kind of catastrophic failure we are concerned with handling in an
     // invariant check that runs only in SAFE_2 builds from a destructor.
 
-    BSLS_ASSERT_SAFE(bslalg::HashTableImpUtil::isWellFormed<KEY_CONFIG>(
+    // Note that the elements yet to be moved by an incremental rehash are
+    // not indexed by 'd_anchor', which is then not well-formed.
+
+    BSLS_ASSERT_SAFE(this->isRehashInProgress()
+                  || bslalg::HashTableImpUtil::isWellFormed<KEY_CONFIG>(
                                  this->d_anchor,
                                  this->d_parameters.hasher(),
                                  HashTable_ImpDetails::incidentalAllocator()));
@@ -3387,6 +4560,39 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::~HashTable()
 }
 
 // PRIVATE MANIPULATORS
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+void
+HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::advanceRehash(
+                                                   native_std::size_t hashCode)
+{
+    if (!this->isRehashInProgress()) {
+        return;                                                       // RETURN
+    }
+
+    const SizeType numOldBuckets =
+                          static_cast<SizeType>(d_oldAnchor.bucketArraySize());
+
+    // Drain the bucket holding 'hashCode' first, so that the caller may link
+    // a node having that hash code into the current bucket array.
+
+    this->drainBucket(static_cast<SizeType>(
+                                  bslalg::HashTableImpUtil::computeBucketIndex(
+                                                            hashCode,
+                                                            numOldBuckets,
+                                                            BucketIndex())));
+
+    for (int i = 0;
+         i != k_REHASH_BUCKETS_PER_INSERTION && d_rehashIndex != numOldBuckets;
+         ++i) {
+        this->drainBucket(d_rehashIndex);
+        ++d_rehashIndex;
+    }
+
+    if (d_rehashIndex == numOldBuckets) {
+        this->endRehash();
+    }
+}
+
 template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
 void
 HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::copyDataStructure(
@@ -3406,7 +4612,8 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::copyDataStructure(
                                                    &capacity,
                                                    static_cast<size_t>(d_size),
                                                    2,
-                                                   d_maxLoadFactor);
+                                                   d_maxLoadFactor,
+                                                   k_BUCKET_POLICY);
 
     d_anchor.setListRootAddress(0);
     HashTable_Util::initAnchor(&d_anchor, numBuckets, this->allocator());
@@ -3427,10 +4634,12 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::copyDataStructure(
         size_t hashCode = this->hashCodeForNode(cursor);
         bslalg::BidirectionalLink *newNode =
                                  d_parameters.nodeFactory().cloneNode(*cursor);
+        NodeUtil::setHashCode(newNode, hashCode);
 
         bslalg::HashTableImpUtil::insertAtBackOfBucket(&d_anchor,
                                                        newNode,
-                                                       hashCode);
+                                                       hashCode,
+                                                       BucketIndex());
     }
     while ((cursor = cursor->nextLink()));
 
@@ -3439,6 +4648,260 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::copyDataStructure(
     arrayProctor.release();
 }
 
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+void
+HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::drainBucket(
+                                                                SizeType index)
+{
+    BSLS_ASSERT_SAFE(this->isRehashInProgress());
+    BSLS_ASSERT_SAFE(index < d_oldAnchor.bucketArraySize());
+
+    typedef bslalg::HashTableImpUtil ImpUtil;
+
+    bslalg::HashTableBucket *bucket = d_oldAnchor.bucketArrayAddress() + index;
+
+    // The current and previous bucket arrays index disjoint subsets of the one
+    // list of elements, whose root is held by 'd_anchor'.  The root is copied
+    // into 'd_oldAnchor' so that 'ImpUtil::remove' can maintain it.
+
+    while (bslalg::BidirectionalLink *node = bucket->first()) {
+        native_std::size_t hashCode = this->hashCodeForNode(node);
+
+        d_oldAnchor.setListRootAddress(d_anchor.listRootAddress());
+        ImpUtil::remove(&d_oldAnchor, node, hashCode, BucketIndex());
+        d_anchor.setListRootAddress(d_oldAnchor.listRootAddress());
+
+        ImpUtil::insertAtBackOfBucket(&d_anchor,
+                                      node,
+                                      hashCode,
+                                      BucketIndex());
+    }
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+void HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::endRehash()
+{
+    HashTable_Util::destroyBucketArray(d_oldAnchor.bucketArrayAddress(),
+                                       d_oldAnchor.bucketArraySize(),
+                                       this->allocator());
+
+    d_oldAnchor.setBucketArrayAddressAndSize(
+                                  HashTable_ImpDetails::defaultBucketAddress(),
+                                  1);
+    d_oldAnchor.setListRootAddress(0);
+    d_rehashIndex = 1;
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+void HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::growBucketArray()
+{
+    if (!d_incrementalRehash || 0 == d_size) {
+        this->rehashForNumBuckets(numBuckets() * 2);
+        return;                                                       // RETURN
+    }
+
+    this->completeRehash();
+
+    size_t capacity;
+    SizeType numBuckets = static_cast<SizeType>(
+                              HashTable_ImpDetails::growBucketsForLoadFactor(
+                                      &capacity,
+                                      d_size + 1u,
+                                      static_cast<size_t>(this->numBuckets())
+                                                                           * 2,
+                                      d_maxLoadFactor,
+                                      k_BUCKET_POLICY));
+
+    bslalg::HashTableAnchor newAnchor(0, 0, 0);
+    HashTable_Util::initAnchor(&newAnchor,
+                               static_cast<size_t>(numBuckets),
+                               this->allocator());
+
+    // No operation below can throw.  The elements stay indexed by the previous
+    // bucket array, now held by 'd_oldAnchor', until drained.
+
+    newAnchor.setListRootAddress(d_anchor.listRootAddress());
+    d_oldAnchor.swap(d_anchor);
+    d_anchor.swap(newAnchor);
+    d_rehashIndex = 0;
+    d_capacity    = static_cast<SizeType>(capacity);
+#ifndef BSLSTL_HASHTABLE_DISABLE_STATISTICS
+    ++d_numRehashes;
+#endif
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+void
+HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::insertIfMissingBatchImp(
+                                                         INPUT_ITERATOR first,
+                                                         INPUT_ITERATOR last,
+                                                         bsl::true_type)
+{
+    INPUT_ITERATOR     values[k_BATCH_SIZE];
+    native_std::size_t hashCodes[k_BATCH_SIZE];
+
+    while (first != last) {
+        native_std::size_t numValues = 0;
+        for (; numValues != k_BATCH_SIZE && first != last; ++first) {
+            values[numValues] = first;
+            hashCodes[numValues] = d_parameters.hashCodeForKey(
+                                              KEY_CONFIG::extractKey(*first));
+            ++numValues;
+        }
+
+        prefetchBuckets(hashCodes, numValues);
+
+        // Resolve the keys in order, so that a key repeated within the batch
+        // finds the element inserted for its first occurrence.
+
+        for (native_std::size_t i = 0; i != numValues; ++i) {
+            if (!this->find(KEY_CONFIG::extractKey(*values[i]),
+                            hashCodes[i])) {
+                if (d_size >= d_capacity) {
+                    this->growBucketArray();
+                }
+
+                this->advanceRehash(hashCodes[i]);
+                bslalg::BidirectionalLink *newNode =
+                             d_parameters.nodeFactory().createNode(*values[i]);
+                NodeUtil::setHashCode(newNode, hashCodes[i]);
+                bslalg::HashTableImpUtil::insertAtFrontOfBucket(
+                                                                &d_anchor,
+                                                                newNode,
+                                                                hashCodes[i],
+                                                                BucketIndex());
+                ++d_size;
+            }
+        }
+    }
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+void
+HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::insertIfMissingBatchImp(
+                                                         INPUT_ITERATOR first,
+                                                         INPUT_ITERATOR last,
+                                                         bsl::false_type)
+{
+    typedef bslalg::HashTableImpUtil ImpUtil;
+
+    bslalg::BidirectionalLink *nodes[k_BATCH_SIZE];
+    native_std::size_t         hashCodes[k_BATCH_SIZE];
+
+    while (first != last) {
+        HashTable_NodeBatchProctor<typename ImplParameters::NodeFactory>
+                                 proctor(&d_parameters.nodeFactory(), nodes);
+
+        native_std::size_t numNodes = 0;
+        for (; numNodes != k_BATCH_SIZE && first != last; ++first) {
+            nodes[numNodes] = d_parameters.nodeFactory().createNode(*first);
+            proctor.manage(++numNodes);
+        }
+
+        for (native_std::size_t i = 0; i != numNodes; ++i) {
+            hashCodes[i] = d_parameters.hashCodeForKey(
+                                    ImpUtil::extractKey<KEY_CONFIG>(nodes[i]));
+            NodeUtil::setHashCode(nodes[i], hashCodes[i]);
+        }
+
+        prefetchBuckets(hashCodes, numNodes);
+
+        // Resolve the keys in order, so that a key repeated within the batch
+        // finds the element inserted for its first occurrence.
+
+        for (native_std::size_t i = 0; i != numNodes; ++i) {
+            if (!this->find(ImpUtil::extractKey<KEY_CONFIG>(nodes[i]),
+                            hashCodes[i])) {
+                if (d_size >= d_capacity) {
+                    this->growBucketArray();
+                }
+
+                this->advanceRehash(hashCodes[i]);
+                ImpUtil::insertAtFrontOfBucket(&d_anchor,
+                                               nodes[i],
+                                               hashCodes[i],
+                                               BucketIndex());
+                nodes[i] = 0;
+                ++d_size;
+            }
+        }
+
+        // The proctor now deletes the nodes holding duplicate keys.
+    }
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+void
+HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::mergeImp(
+                                                HashTable *source,
+                                                bool       skipEquivalentKeys)
+{
+    BSLS_ASSERT_SAFE(source);
+    BSLS_ASSERT_SAFE(this != source);
+
+    typedef bslalg::HashTableImpUtil ImpUtil;
+
+    const bool isSameAllocator = source->allocator() == this->allocator();
+
+    bslalg::BidirectionalLink *cursor = source->d_anchor.listRootAddress();
+    while (cursor) {
+        bslalg::BidirectionalLink *next = cursor->nextLink();
+
+        // Every user-supplied functor is called, and the bucket array grown,
+        // before the element is relocated, so that the element stays in
+        // 'source' if an exception is thrown.
+
+        const KeyType& key = ImpUtil::extractKey<KEY_CONFIG>(cursor);
+        size_t hashCode = this->d_parameters.hashCodeForKey(key);
+
+        if (skipEquivalentKeys && this->find(key, hashCode)) {
+            cursor = next;
+            continue;
+        }
+
+        size_t sourceHashCode = source->hashCodeForNode(cursor);
+
+        if (d_size >= d_capacity) {
+            this->growBucketArray();
+        }
+        this->advanceRehash(hashCode);
+        bslalg::BidirectionalLink *position = skipEquivalentKeys
+                                            ? 0
+                                            : this->find(key, hashCode);
+
+        bslalg::BidirectionalLink *newNode =
+                     d_parameters.nodeFactory().createNodeByRelocation(
+                         bsls::Util::addressOf(
+                                     static_cast<NodeType *>(cursor)->value()),
+                         isSameAllocator);
+
+        // No operation below can throw.
+
+        source->unlinkNode(cursor, sourceHashCode);
+        source->d_parameters.nodeFactory().deallocateNode(cursor);
+
+        NodeUtil::setHashCode(newNode, hashCode);
+        if (!position) {
+            ImpUtil::insertAtFrontOfBucket(&d_anchor,
+                                           newNode,
+                                           hashCode,
+                                           BucketIndex());
+        }
+        else {
+            ImpUtil::insertAtPosition(&d_anchor,
+                                      newNode,
+                                      hashCode,
+                                      position,
+                                      BucketIndex());
+        }
+        ++d_size;
+
+        cursor = next;
+    }
+}
+
 template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
 void
 HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::
@@ -3448,10 +4911,14 @@ quickSwapExchangeAllocators(HashTable *other)
 
     d_parameters.quickSwapExchangeAllocators(&other->d_parameters);
 
-    bslalg::SwapUtil::swap(&d_anchor,        &other->d_anchor);
-    bslalg::SwapUtil::swap(&d_size,          &other->d_size);
-    bslalg::SwapUtil::swap(&d_capacity,      &other->d_capacity);
-    bslalg::SwapUtil::swap(&d_maxLoadFactor, &other->d_maxLoadFactor);
+    bslalg::SwapUtil::swap(&d_anchor,            &other->d_anchor);
+    bslalg::SwapUtil::swap(&d_size,              &other->d_size);
+    bslalg::SwapUtil::swap(&d_capacity,          &other->d_capacity);
+    bslalg::SwapUtil::swap(&d_maxLoadFactor,     &other->d_maxLoadFactor);
+    bslalg::SwapUtil::swap(&d_oldAnchor,         &other->d_oldAnchor);
+    bslalg::SwapUtil::swap(&d_rehashIndex,       &other->d_rehashIndex);
+    bslalg::SwapUtil::swap(&d_incrementalRehash, &other->d_incrementalRehash);
+    bslalg::SwapUtil::swap(&d_numRehashes,       &other->d_numRehashes);
 }
 
 template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
@@ -3464,10 +4931,14 @@ quickSwapRetainAllocators(HashTable *other)
 
     d_parameters.quickSwapRetainAllocators(&other->d_parameters);
 
-    bslalg::SwapUtil::swap(&d_anchor,        &other->d_anchor);
-    bslalg::SwapUtil::swap(&d_size,          &other->d_size);
-    bslalg::SwapUtil::swap(&d_capacity,      &other->d_capacity);
-    bslalg::SwapUtil::swap(&d_maxLoadFactor, &other->d_maxLoadFactor);
+    bslalg::SwapUtil::swap(&d_anchor,            &other->d_anchor);
+    bslalg::SwapUtil::swap(&d_size,              &other->d_size);
+    bslalg::SwapUtil::swap(&d_capacity,          &other->d_capacity);
+    bslalg::SwapUtil::swap(&d_maxLoadFactor,     &other->d_maxLoadFactor);
+    bslalg::SwapUtil::swap(&d_oldAnchor,         &other->d_oldAnchor);
+    bslalg::SwapUtil::swap(&d_rehashIndex,       &other->d_rehashIndex);
+    bslalg::SwapUtil::swap(&d_incrementalRehash, &other->d_incrementalRehash);
+    bslalg::SwapUtil::swap(&d_numRehashes,       &other->d_numRehashes);
 }
 
 template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
@@ -3554,16 +5025,23 @@ rehashIntoExactlyNumBuckets(SizeType newNumBuckets, SizeType capacity)
     Proctor cleanUpIfUserHashThrows(this, &d_anchor, &newAnchor);
 
     if (d_anchor.listRootAddress()) {
-        bslalg::HashTableImpUtil::rehash<KEY_CONFIG>(
-                                          &newAnchor,
-                                          this->d_anchor.listRootAddress(),
-                                          this->d_parameters.hasher());
+        NodeUtil::rehash(&newAnchor,
+                         this->d_anchor.listRootAddress(),
+                         this->d_parameters.hasher(),
+                         BucketIndex());
     }
 
     cleanUpIfUserHashThrows.dismiss();
 
+    // The whole list of elements has been re-indexed, including any elements
+    // yet to be moved by an incremental rehash, which is therefore complete.
+
     d_anchor.swap(newAnchor);
     d_capacity = capacity;
+    this->endRehash();
+#ifndef BSLSTL_HASHTABLE_DISABLE_STATISTICS
+    ++d_numRehashes;
+#endif
 }
 
 template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
@@ -3575,6 +5053,42 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::removeAllAndDeallocate()
     HashTable_Util::destroyBucketArray(d_anchor.bucketArrayAddress(),
                                        d_anchor.bucketArraySize(),
                                        this->allocator());
+    HashTable_Util::destroyBucketArray(d_oldAnchor.bucketArrayAddress(),
+                                       d_oldAnchor.bucketArraySize(),
+                                       this->allocator());
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+bslalg::BidirectionalLink *
+HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::insertIfMissingImp(
+                                          bool               *isInsertedFlag,
+                                          const ValueType&    value,
+                                          native_std::size_t  hashCode)
+{
+    BSLS_ASSERT_SAFE(isInsertedFlag);
+
+    bslalg::BidirectionalLink *position = this->find(
+                                                 KEY_CONFIG::extractKey(value),
+                                                 hashCode);
+
+    *isInsertedFlag = (!position);
+
+    if(!position) {
+        if (d_size >= d_capacity) {
+            this->growBucketArray();
+        }
+
+        this->advanceRehash(hashCode);
+        position = d_parameters.nodeFactory().createNode(value);
+        NodeUtil::setHashCode(position, hashCode);
+        bslalg::HashTableImpUtil::insertAtFrontOfBucket(&d_anchor,
+                                                        position,
+                                                        hashCode,
+                                                        BucketIndex());
+        ++d_size;
+    }
+
+    return position;
 }
 
 template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
@@ -3598,6 +5112,39 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::removeAllImp()
     }
 }
 
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+void HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::unlinkNode(
+                                      bslalg::BidirectionalLink *node,
+                                      native_std::size_t         hashCode)
+{
+    BSLS_ASSERT_SAFE(node);
+    BSLS_ASSERT_SAFE(node->previousLink()
+                  || d_anchor.listRootAddress() == node);
+
+    typedef bslalg::HashTableImpUtil ImpUtil;
+
+    // While an incremental rehash is in progress, 'node' is still indexed by
+    // the previous bucket array if its bucket there has not been drained (as
+    // a bucket is drained before any node is added to it).  No other node is
+    // moved, so that the iteration order of the remaining elements is
+    // preserved.
+
+    if (this->isRehashInProgress()
+     && d_oldAnchor.bucketArrayAddress()[
+                  ImpUtil::computeBucketIndex(hashCode,
+                                              d_oldAnchor.bucketArraySize(),
+                                              BucketIndex())]
+                                                                    .first()) {
+        d_oldAnchor.setListRootAddress(d_anchor.listRootAddress());
+        ImpUtil::remove(&d_oldAnchor, node, hashCode, BucketIndex());
+        d_anchor.setListRootAddress(d_oldAnchor.listRootAddress());
+    }
+    else {
+        ImpUtil::remove(&d_anchor, node, hashCode, BucketIndex());
+    }
+    --d_size;
+}
+
 // PRIVATE ACCESSORS
 template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
 template <class DEDUCED_KEY>
@@ -3607,11 +5154,20 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::find(
                                             DEDUCED_KEY&       key,
                                             native_std::size_t hashValue) const
 {
-    return bslalg::HashTableImpUtil::find<KEY_CONFIG>(
+    bslalg::BidirectionalLink *result = NodeUtil::find(
                                                      d_anchor,
                                                      key,
                                                      d_parameters.comparator(),
-                                                     hashValue);
+                                                     hashValue,
+                                                     BucketIndex());
+    if (!result && this->isRehashInProgress()) {
+        result = NodeUtil::find(d_oldAnchor,
+                                key,
+                                d_parameters.comparator(),
+                                hashValue,
+                                BucketIndex());
+    }
+    return result;
 }
 
 template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
@@ -3633,8 +5189,37 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::hashCodeForNode(
 {
     BSLS_ASSERT_SAFE(node);
 
-    return d_parameters.hashCodeForKey(
-                       bslalg::HashTableImpUtil::extractKey<KEY_CONFIG>(node));
+    return NodeUtil::hashCode(node, d_parameters.hasher());
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+void
+HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::prefetchBuckets(
+                           const native_std::size_t *hashCodes,
+                           native_std::size_t        numHashCodes) const
+{
+    BSLS_ASSERT_SAFE(hashCodes || !numHashCodes);
+    BSLS_ASSERT_SAFE(numHashCodes <= k_BATCH_SIZE);
+
+    typedef bslalg::HashTableImpUtil ImpUtil;
+
+    // First touch every bucket, then every chain head: each stage issues all
+    // of its loads before any of them is needed.
+
+    const bslalg::HashTableBucket *buckets[k_BATCH_SIZE];
+    for (native_std::size_t i = 0; i != numHashCodes; ++i) {
+        buckets[i] = getBucketAddress(ImpUtil::computeBucketIndex(
+                                                   hashCodes[i],
+                                                   d_anchor.bucketArraySize(),
+                                                   BucketIndex()));
+        bsls::PerformanceHint::prefetchForReading(buckets[i]);
+    }
+
+    for (native_std::size_t i = 0; i != numHashCodes; ++i) {
+        if (const bslalg::BidirectionalLink *head = buckets[i]->first()) {
+            bsls::PerformanceHint::prefetchForReading(head);
+        }
+    }
 }
 
 // MANIPULATORS
@@ -3658,6 +5243,40 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::operator=(
     return *this;
 }
 
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+void HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::completeRehash()
+{
+    const SizeType numOldBuckets =
+                          static_cast<SizeType>(d_oldAnchor.bucketArraySize());
+    while (d_rehashIndex != numOldBuckets) {
+        this->drainBucket(d_rehashIndex);
+        ++d_rehashIndex;
+    }
+    this->endRehash();
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+void HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::extractNode(
+                                         NodeHandleType            *result,
+                                         bslalg::BidirectionalLink *node)
+{
+    BSLS_ASSERT_SAFE(result);
+    BSLS_ASSERT_SAFE(node);
+
+    // Compute the hash code, and relocate the element, before modifying this
+    // hash table, as either may throw.
+
+    native_std::size_t hashCode = hashCodeForNode(node);
+
+    bslalg::BidirectionalLink *detachedNode =
+                          d_parameters.nodeFactory().createDetachedNode(node);
+
+    this->unlinkNode(node, hashCode);
+    d_parameters.nodeFactory().deallocateNode(node);
+    result->adoptNode(static_cast<NodeType *>(detachedNode),
+                      this->allocator());
+}
+
 template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
 template <class SOURCE_TYPE>
 bslalg::BidirectionalLink *
@@ -3670,7 +5289,7 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::insert(
     // potentially improve the 'find' time.
 
     if (d_size >= d_capacity) {
-        this->rehashForNumBuckets(numBuckets() * 2);
+        this->growBucketArray();
     }
 
     // Create a node having the new 'value' we want to insert into the table.
@@ -3691,15 +5310,24 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::insert(
 
     size_t hashCode = this->d_parameters.hashCodeForKey(
                                      ImpUtil::extractKey<KEY_CONFIG>(newNode));
+    this->advanceRehash(hashCode);
     bslalg::BidirectionalLink *position = this->find(
                                       ImpUtil::extractKey<KEY_CONFIG>(newNode),
                                       hashCode);
 
+    NodeUtil::setHashCode(newNode, hashCode);
     if (!position) {
-        ImpUtil::insertAtFrontOfBucket(&d_anchor, newNode, hashCode);
+        ImpUtil::insertAtFrontOfBucket(&d_anchor,
+                                       newNode,
+                                       hashCode,
+                                       BucketIndex());
     }
     else {
-        ImpUtil::insertAtPosition(&d_anchor, newNode, hashCode, position);
+        ImpUtil::insertAtPosition(&d_anchor,
+                                  newNode,
+                                  hashCode,
+                                  position,
+                                  BucketIndex());
     }
     nodeProctor.release();
 
@@ -3723,7 +5351,7 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::insert(
     // potentially improve the potential 'find' time later.
 
     if (d_size >= d_capacity) {
-        this->rehashForNumBuckets(numBuckets() * 2);
+        this->growBucketArray();
     }
 
     // Next we must create the node, to avoid making a temporary of 'ValueType'
@@ -3742,16 +5370,25 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::insert(
 
     size_t hashCode = this->d_parameters.hashCodeForKey(
                                      ImpUtil::extractKey<KEY_CONFIG>(newNode));
+    this->advanceRehash(hashCode);
     if (!d_parameters.comparator()(ImpUtil::extractKey<KEY_CONFIG>(newNode),
                                    ImpUtil::extractKey<KEY_CONFIG>(hint))) {
         hint = this->find(ImpUtil::extractKey<KEY_CONFIG>(newNode), hashCode);
     }
 
+    NodeUtil::setHashCode(newNode, hashCode);
     if (!hint) {
-        ImpUtil::insertAtFrontOfBucket(&d_anchor, newNode, hashCode);
+        ImpUtil::insertAtFrontOfBucket(&d_anchor,
+                                       newNode,
+                                       hashCode,
+                                       BucketIndex());
     }
     else {
-        ImpUtil::insertAtPosition(&d_anchor, newNode, hashCode, hint);
+        ImpUtil::insertAtPosition(&d_anchor,
+                                  newNode,
+                                  hashCode,
+                                  hint,
+                                  BucketIndex());
     }
     nodeProctor.release();
 
@@ -3761,6 +5398,71 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::insert(
 }
 
 template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+void
+HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::insertBatch(
+                                                          INPUT_ITERATOR first,
+                                                          INPUT_ITERATOR last)
+{
+    typedef bslalg::HashTableImpUtil ImpUtil;
+
+    bslalg::BidirectionalLink *nodes[k_BATCH_SIZE];
+    native_std::size_t         hashCodes[k_BATCH_SIZE];
+
+    while (first != last) {
+        // Create the nodes for the next batch first, so that no temporary
+        // 'ValueType' is created from an object of the iterator's value type.
+
+        HashTable_NodeBatchProctor<typename ImplParameters::NodeFactory>
+                                 proctor(&d_parameters.nodeFactory(), nodes);
+
+        native_std::size_t numNodes = 0;
+        for (; numNodes != k_BATCH_SIZE && first != last; ++first) {
+            nodes[numNodes] = d_parameters.nodeFactory().createNode(*first);
+            proctor.manage(++numNodes);
+        }
+
+        // Grow the bucket array before hashing, so that the buckets
+        // prefetched below remain valid while the batch is linked in.
+
+        while (d_size + numNodes > d_capacity) {
+            this->growBucketArray();
+        }
+
+        for (native_std::size_t i = 0; i != numNodes; ++i) {
+            hashCodes[i] = d_parameters.hashCodeForKey(
+                                    ImpUtil::extractKey<KEY_CONFIG>(nodes[i]));
+            NodeUtil::setHashCode(nodes[i], hashCodes[i]);
+        }
+
+        prefetchBuckets(hashCodes, numNodes);
+
+        for (native_std::size_t i = 0; i != numNodes; ++i) {
+            this->advanceRehash(hashCodes[i]);
+            bslalg::BidirectionalLink *position = this->find(
+                                     ImpUtil::extractKey<KEY_CONFIG>(nodes[i]),
+                                     hashCodes[i]);
+            if (!position) {
+                ImpUtil::insertAtFrontOfBucket(&d_anchor,
+                                               nodes[i],
+                                               hashCodes[i],
+                                               BucketIndex());
+            }
+            else {
+                ImpUtil::insertAtPosition(&d_anchor,
+                                          nodes[i],
+                                          hashCodes[i],
+                                          position,
+                                          BucketIndex());
+            }
+            nodes[i] = 0;
+            ++d_size;
+        }
+    }
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+inline
 bslalg::BidirectionalLink *
 HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::insertIfMissing(
                                               bool             *isInsertedFlag,
@@ -3768,27 +5470,25 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::insertIfMissing(
 {
     BSLS_ASSERT(isInsertedFlag);
 
-    size_t hashCode = this->d_parameters.hashCodeForKey(
-                                                KEY_CONFIG::extractKey(value));
-    bslalg::BidirectionalLink *position = this->find(
-                                                 KEY_CONFIG::extractKey(value),
-                                                 hashCode);
-
-    *isInsertedFlag = (!position);
-
-    if(!position) {
-        if (d_size >= d_capacity) {
-            this->rehashForNumBuckets(numBuckets() * 2);
-        }
+    return this->insertIfMissingImp(
+                isInsertedFlag,
+                value,
+                d_parameters.hashCodeForKey(KEY_CONFIG::extractKey(value)));
+}
 
-        position = d_parameters.nodeFactory().createNode(value);
-        bslalg::HashTableImpUtil::insertAtFrontOfBucket(&d_anchor,
-                                                        position,
-                                                        hashCode);
-        ++d_size;
-    }
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+inline
+bslalg::BidirectionalLink *
+HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::
+insertIfMissingWithHashCode(bool               *isInsertedFlag,
+                            const ValueType&    value,
+                            native_std::size_t  hashCode)
+{
+    BSLS_ASSERT(isInsertedFlag);
 
-    return position;
+    return this->insertIfMissingImp(isInsertedFlag,
+                                    value,
+                                    adjustHashCode(hashCode));
 }
 
 template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
@@ -3806,7 +5506,7 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::insertIfMissing(
     // potentially improve the potential 'find' time later.
 
     if (d_size >= d_capacity) {
-        this->rehashForNumBuckets(numBuckets() * 2);
+        this->growBucketArray();
     }
 
     // Next we must create the node, to avoid making a temporary of 'ValueType'
@@ -3833,10 +5533,15 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::insertIfMissing(
 
     if(!position) {
         if (d_size >= d_capacity) {
-            this->rehashForNumBuckets(numBuckets() * 2);
+            this->growBucketArray();
         }
 
-        ImpUtil::insertAtFrontOfBucket(&d_anchor, newNode, hashCode);
+        this->advanceRehash(hashCode);
+        NodeUtil::setHashCode(newNode, hashCode);
+        ImpUtil::insertAtFrontOfBucket(&d_anchor,
+                                       newNode,
+                                       hashCode,
+                                       BucketIndex());
         nodeProctor.release();
 
         ++d_size;
@@ -3851,25 +5556,144 @@ bslalg::BidirectionalLink *
 HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::insertIfMissing(
                                                             const KeyType& key)
 {
+    bool isInsertedFlag;  // not used
+
+    return tryEmplace(&isInsertedFlag, key);
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+inline
+void
+HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::insertIfMissingBatch(
+                                                          INPUT_ITERATOR first,
+                                                          INPUT_ITERATOR last)
+{
+    typedef bsl::iterator_traits<INPUT_ITERATOR> IterTraits;
+
+    // The keys can be hashed before the nodes are created only if the range
+    // can be traversed again and holds 'ValueType' objects.
+
+    typedef bsl::integral_constant<bool,
+           bsl::is_convertible<typename IterTraits::iterator_category,
+                               native_std::forward_iterator_tag>::value
+        && bsl::is_same<typename IterTraits::value_type, ValueType>::value>
+                                                                 HashFromRange;
+
+    insertIfMissingBatchImp(first, last, HashFromRange());
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+bslalg::BidirectionalLink *
+HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::insertNode(
+                                       NodeHandleType            *handle,
+                                       bslalg::BidirectionalLink *hint)
+{
+    BSLS_ASSERT(handle);
+    BSLS_ASSERT(!handle->empty());
+
+    typedef bslalg::HashTableImpUtil ImpUtil;
+
+    if (d_size >= d_capacity) {
+        this->growBucketArray();
+    }
+
+    const KeyType& key = KEY_CONFIG::extractKey(handle->value());
+
+    size_t hashCode = this->d_parameters.hashCodeForKey(key);
+    this->advanceRehash(hashCode);
+    bslalg::BidirectionalLink *position =
+               hint && d_parameters.comparator()(
+                                        key,
+                                        ImpUtil::extractKey<KEY_CONFIG>(hint))
+               ? hint
+               : this->find(key, hashCode);
+
+    bslalg::BidirectionalLink *newNode = d_parameters.nodeFactory().takeNode(
+                                 handle,
+                                 handle->get_allocator() == this->allocator());
+
+    NodeUtil::setHashCode(newNode, hashCode);
+    if (!position) {
+        ImpUtil::insertAtFrontOfBucket(&d_anchor,
+                                       newNode,
+                                       hashCode,
+                                       BucketIndex());
+    }
+    else {
+        ImpUtil::insertAtPosition(&d_anchor,
+                                  newNode,
+                                  hashCode,
+                                  position,
+                                  BucketIndex());
+    }
+    ++d_size;
+
+    return newNode;
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+bslalg::BidirectionalLink *
+HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::insertNodeIfMissing(
+                                                bool           *isInsertedFlag,
+                                                NodeHandleType *handle)
+{
+    BSLS_ASSERT(isInsertedFlag);
+    BSLS_ASSERT(handle);
+    BSLS_ASSERT(!handle->empty());
+
+    const KeyType& key = KEY_CONFIG::extractKey(handle->value());
+
     size_t hashCode = this->d_parameters.hashCodeForKey(key);
     bslalg::BidirectionalLink *position = this->find(key, hashCode);
+
+    *isInsertedFlag = (!position);
+
     if (!position) {
         if (d_size >= d_capacity) {
-            this->rehashForNumBuckets(numBuckets() * 2);
+            this->growBucketArray();
         }
 
-        position = d_parameters.nodeFactory().createNode(
-                                            key,
-                                            typename ValueType::second_type());
+        this->advanceRehash(hashCode);
+        position = d_parameters.nodeFactory().takeNode(
+                                 handle,
+                                 handle->get_allocator() == this->allocator());
 
+        NodeUtil::setHashCode(position, hashCode);
         bslalg::HashTableImpUtil::insertAtFrontOfBucket(&d_anchor,
                                                         position,
-                                                        hashCode);
+                                                        hashCode,
+                                                        BucketIndex());
         ++d_size;
     }
+
     return position;
 }
 
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+inline
+void HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::merge(
+                                                             HashTable *source)
+{
+    BSLS_ASSERT(source);
+
+    if (this != source) {
+        this->mergeImp(source, false);
+    }
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+inline
+void HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::mergeIfMissing(
+                                                             HashTable *source)
+{
+    BSLS_ASSERT(source);
+
+    if (this != source) {
+        this->mergeImp(source, true);
+    }
+}
+
 template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
 void
 HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::rehashForNumBuckets(
@@ -3877,7 +5701,8 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::rehashForNumBuckets(
 {
     if (newNumBuckets > this->numBuckets()) {
         // Compute a "good" number of buckets, e.g., pick a prime number from a
-        // sorted array of exponentially increasing primes.
+        // sorted array of exponentially increasing primes, or a power of two,
+        // as determined by 'k_BUCKET_POLICY'.
 
         size_t capacity;
         SizeType numBuckets = static_cast<SizeType>(
@@ -3885,7 +5710,8 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::rehashForNumBuckets(
                                             &capacity,
                                             d_size + 1u,
                                             static_cast<size_t>(newNumBuckets),
-                                            d_maxLoadFactor));
+                                            d_maxLoadFactor,
+                                            k_BUCKET_POLICY));
 
         this->rehashIntoExactlyNumBuckets(numBuckets,
                                           static_cast<SizeType>(capacity));
@@ -3898,15 +5724,27 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::remove(
                                                bslalg::BidirectionalLink *node)
 {
     BSLS_ASSERT_SAFE(node);
-    BSLS_ASSERT_SAFE(node->previousLink()
-                  || d_anchor.listRootAddress() == node);
 
     bslalg::BidirectionalLink *result = node->nextLink();
 
-    bslalg::HashTableImpUtil::remove(&d_anchor,
-                                     node,
-                                     hashCodeForNode(node));
-    --d_size;
+    this->unlinkNode(node, hashCodeForNode(node));
+
+    d_parameters.nodeFactory().deleteNode(static_cast<NodeType *>(node));
+
+    return result;
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+bslalg::BidirectionalLink *
+HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::removeWithHashCode(
+                                          bslalg::BidirectionalLink *node,
+                                          native_std::size_t         hashCode)
+{
+    BSLS_ASSERT_SAFE(node);
+
+    bslalg::BidirectionalLink *result = node->nextLink();
+
+    this->unlinkNode(node, adjustHashCode(hashCode));
 
     d_parameters.nodeFactory().deleteNode(static_cast<NodeType *>(node));
 
@@ -3925,6 +5763,8 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::removeAll()
 
     d_anchor.setListRootAddress(0);
     d_size = 0;
+
+    this->endRehash();
 }
 
 template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
@@ -3940,7 +5780,8 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::reserveForNumElements(
     d_parameters.nodeFactory().reserveNodes(numElements);
     if (numElements > d_capacity) {
         // Compute a "good" number of buckets, e.g., pick a prime number from a
-        // sorted array of exponentially increasing primes.
+        // sorted array of exponentially increasing primes, or a power of two,
+        // as determined by 'k_BUCKET_POLICY'.
 
         size_t capacity;
         SizeType numBuckets = static_cast<SizeType>(
@@ -3948,13 +5789,26 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::reserveForNumElements(
                                        &capacity,
                                        numElements,
                                        static_cast<size_t>(this->numBuckets()),
-                                       d_maxLoadFactor));
+                                       d_maxLoadFactor,
+                                       k_BUCKET_POLICY));
 
         this->rehashIntoExactlyNumBuckets(numBuckets,
                                           static_cast<SizeType>(capacity));
     }
 }
 
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+inline
+void
+HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::setIncrementalRehash(
+                                                              bool incremental)
+{
+    if (!incremental) {
+        this->completeRehash();
+    }
+    d_incrementalRehash = incremental;
+}
+
 template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
 inline
 void HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::setMaxLoadFactor(
@@ -3968,7 +5822,8 @@ void HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::setMaxLoadFactor(
                                        &capacity,
                                        native_std::max<SizeType>(d_size, 1u),
                                        static_cast<size_t>(this->numBuckets()),
-                                       newMaxLoadFactor));
+                                       newMaxLoadFactor,
+                                       k_BUCKET_POLICY));
 
     this->rehashIntoExactlyNumBuckets(numBuckets,
                                       static_cast<SizeType>(capacity));
@@ -3997,6 +5852,148 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::swap(HashTable& other)
     }
 }
 
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+bslalg::BidirectionalLink *
+HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::tryEmplace(
+                                                bool           *isInsertedFlag,
+                                                const KeyType&  key)
+{
+    BSLS_ASSERT(isInsertedFlag);
+
+    size_t hashCode = this->d_parameters.hashCodeForKey(key);
+    bslalg::BidirectionalLink *position = this->find(key, hashCode);
+
+    *isInsertedFlag = (!position);
+
+    if (!position) {
+        if (d_size >= d_capacity) {
+            this->growBucketArray();
+        }
+
+        this->advanceRehash(hashCode);
+        position = d_parameters.nodeFactory().createNodePiecewise(key);
+        NodeUtil::setHashCode(position, hashCode);
+        bslalg::HashTableImpUtil::insertAtFrontOfBucket(&d_anchor,
+                                                        position,
+                                                        hashCode,
+                                                        BucketIndex());
+        ++d_size;
+    }
+
+    return position;
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+template <class ARG_1>
+bslalg::BidirectionalLink *
+HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::tryEmplace(
+                      bool                                     *isInsertedFlag,
+                      const KeyType&                            key,
+                      BSLS_COMPILERFEATURES_FORWARD_REF(ARG_1)  arg1)
+{
+    BSLS_ASSERT(isInsertedFlag);
+
+    size_t hashCode = this->d_parameters.hashCodeForKey(key);
+    bslalg::BidirectionalLink *position = this->find(key, hashCode);
+
+    *isInsertedFlag = (!position);
+
+    if (!position) {
+        if (d_size >= d_capacity) {
+            this->growBucketArray();
+        }
+
+        this->advanceRehash(hashCode);
+        position = d_parameters.nodeFactory().createNodePiecewise(
+                                   key,
+                                   BSLS_COMPILERFEATURES_FORWARD(ARG_1, arg1));
+        NodeUtil::setHashCode(position, hashCode);
+        bslalg::HashTableImpUtil::insertAtFrontOfBucket(&d_anchor,
+                                                        position,
+                                                        hashCode,
+                                                        BucketIndex());
+        ++d_size;
+    }
+
+    return position;
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+template <class ARG_1, class ARG_2>
+bslalg::BidirectionalLink *
+HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::tryEmplace(
+                      bool                                     *isInsertedFlag,
+                      const KeyType&                            key,
+                      BSLS_COMPILERFEATURES_FORWARD_REF(ARG_1)  arg1,
+                      BSLS_COMPILERFEATURES_FORWARD_REF(ARG_2)  arg2)
+{
+    BSLS_ASSERT(isInsertedFlag);
+
+    size_t hashCode = this->d_parameters.hashCodeForKey(key);
+    bslalg::BidirectionalLink *position = this->find(key, hashCode);
+
+    *isInsertedFlag = (!position);
+
+    if (!position) {
+        if (d_size >= d_capacity) {
+            this->growBucketArray();
+        }
+
+        this->advanceRehash(hashCode);
+        position = d_parameters.nodeFactory().createNodePiecewise(
+                                   key,
+                                   BSLS_COMPILERFEATURES_FORWARD(ARG_1, arg1),
+                                   BSLS_COMPILERFEATURES_FORWARD(ARG_2, arg2));
+        NodeUtil::setHashCode(position, hashCode);
+        bslalg::HashTableImpUtil::insertAtFrontOfBucket(&d_anchor,
+                                                        position,
+                                                        hashCode,
+                                                        BucketIndex());
+        ++d_size;
+    }
+
+    return position;
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+template <class ARG_1, class ARG_2, class ARG_3>
+bslalg::BidirectionalLink *
+HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::tryEmplace(
+                      bool                                     *isInsertedFlag,
+                      const KeyType&                            key,
+                      BSLS_COMPILERFEATURES_FORWARD_REF(ARG_1)  arg1,
+                      BSLS_COMPILERFEATURES_FORWARD_REF(ARG_2)  arg2,
+                      BSLS_COMPILERFEATURES_FORWARD_REF(ARG_3)  arg3)
+{
+    BSLS_ASSERT(isInsertedFlag);
+
+    size_t hashCode = this->d_parameters.hashCodeForKey(key);
+    bslalg::BidirectionalLink *position = this->find(key, hashCode);
+
+    *isInsertedFlag = (!position);
+
+    if (!position) {
+        if (d_size >= d_capacity) {
+            this->growBucketArray();
+        }
+
+        this->advanceRehash(hashCode);
+        position = d_parameters.nodeFactory().createNodePiecewise(
+                                   key,
+                                   BSLS_COMPILERFEATURES_FORWARD(ARG_1, arg1),
+                                   BSLS_COMPILERFEATURES_FORWARD(ARG_2, arg2),
+                                   BSLS_COMPILERFEATURES_FORWARD(ARG_3, arg3));
+        NodeUtil::setHashCode(position, hashCode);
+        bslalg::HashTableImpUtil::insertAtFrontOfBucket(&d_anchor,
+                                                        position,
+                                                        hashCode,
+                                                        BucketIndex());
+        ++d_size;
+    }
+
+    return position;
+}
+
 // ACCESSORS
 template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
 inline
@@ -4035,8 +6032,9 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::bucketIndexForKey(
 
     size_t hashCode = this->d_parameters.hashCodeForKey(key);
     return static_cast<SizeType>(bslalg::HashTableImpUtil::computeBucketIndex(
-                                                  hashCode,
-                                                  d_anchor.bucketArraySize()));
+                                                   hashCode,
+                                                   d_anchor.bucketArraySize(),
+                                                   BucketIndex()));
 }
 
 template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
@@ -4072,11 +6070,51 @@ bslalg::BidirectionalLink *
 HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::find(
                                                       const KeyType& key) const
 {
-    return bslalg::HashTableImpUtil::find<KEY_CONFIG>(
-                                             d_anchor,
-                                             key,
-                                             d_parameters.comparator(),
-                                             d_parameters.hashCodeForKey(key));
+    return this->find(key, d_parameters.hashCodeForKey(key));
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+inline
+bslalg::BidirectionalLink *
+HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::findWithHashCode(
+                                             const KeyType&     key,
+                                             native_std::size_t hashCode) const
+{
+    return this->find(key, adjustHashCode(hashCode));
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+void
+HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::findBatch(
+                                   bslalg::BidirectionalLink **results,
+                                   const KeyType              *keys,
+                                   SizeType                    numKeys) const
+{
+    BSLS_ASSERT_SAFE(results || !numKeys);
+    BSLS_ASSERT_SAFE(keys    || !numKeys);
+
+    native_std::size_t hashCodes[k_BATCH_SIZE];
+
+    while (numKeys) {
+        const native_std::size_t batchSize =
+                              numKeys < static_cast<SizeType>(k_BATCH_SIZE)
+                              ? numKeys
+                              : static_cast<SizeType>(k_BATCH_SIZE);
+
+        for (native_std::size_t i = 0; i != batchSize; ++i) {
+            hashCodes[i] = d_parameters.hashCodeForKey(keys[i]);
+        }
+
+        prefetchBuckets(hashCodes, batchSize);
+
+        for (native_std::size_t i = 0; i != batchSize; ++i) {
+            results[i] = this->find(keys[i], hashCodes[i]);
+        }
+
+        results += batchSize;
+        keys    += batchSize;
+        numKeys -= batchSize;
+    }
 }
 
 template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
@@ -4122,6 +6160,49 @@ HashTable< KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::findRange(
            : 0;
 }
 
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+template <class LOOKUP_KEY>
+inline
+bslalg::BidirectionalLink *
+HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::findTransparent(
+                                                  const LOOKUP_KEY& key) const
+{
+    const native_std::size_t hashCode = d_parameters.hashCodeForKey(key);
+
+    bslalg::BidirectionalLink *result = NodeUtil::findTransparent(
+                                                     d_anchor,
+                                                     key,
+                                                     d_parameters.comparator(),
+                                                     hashCode,
+                                                     BucketIndex());
+    if (!result && this->isRehashInProgress()) {
+        result = NodeUtil::findTransparent(d_oldAnchor,
+                                           key,
+                                           d_parameters.comparator(),
+                                           hashCode,
+                                           BucketIndex());
+    }
+    return result;
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+template <class LOOKUP_KEY>
+inline
+void
+HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::findRangeTransparent(
+                                         bslalg::BidirectionalLink **first,
+                                         bslalg::BidirectionalLink **last,
+                                         const LOOKUP_KEY&           key) const
+{
+    BSLS_ASSERT_SAFE(first);
+    BSLS_ASSERT_SAFE(last);
+
+    *first = this->findTransparent(key);
+    *last  = *first
+           ? this->findEndOfRange(*first)
+           : 0;
+}
+
 template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
 bool
 HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::hasSameValue(
@@ -4156,10 +6237,8 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::hasSameValue(
 
     while (cursor) {
         bslalg::BidirectionalLink *rhsFirst =
-             ImpUtil::find<KEY_CONFIG>(other.d_anchor,
-                                       ImpUtil::extractKey<KEY_CONFIG>(cursor),
-                                       other.d_parameters.comparator(),
-                                       other.d_parameters.hashCodeForKey(
+             other.find(ImpUtil::extractKey<KEY_CONFIG>(cursor),
+                        other.d_parameters.hashCodeForKey(
                                      ImpUtil::extractKey<KEY_CONFIG>(cursor)));
         if (!rhsFirst) {
             return false;  // no matching key                         // RETURN
@@ -4281,6 +6360,23 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::hasher() const
     return d_parameters.originalHasher();
 }
 
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+inline
+bool
+HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::incrementalRehash() const
+{
+    return d_incrementalRehash;
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+inline
+bool
+HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::isRehashInProgress()
+                                                                          const
+{
+    return d_rehashIndex != d_oldAnchor.bucketArraySize();
+}
+
 template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
 inline
 float HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::loadFactor() const
@@ -4331,6 +6427,16 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::numBuckets() const
     return static_cast<SizeType>(d_anchor.bucketArraySize());
 }
 
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+inline
+typename HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::SizeType
+HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::numBucketsPendingRehash()
+                                                                          const
+{
+    return static_cast<SizeType>(d_oldAnchor.bucketArraySize())
+                                                               - d_rehashIndex;
+}
+
 template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
 inline
 typename HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::SizeType
@@ -4347,6 +6453,64 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::size() const
     return d_size;
 }
 
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+HashTableStatistics
+HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::statistics() const
+{
+    HashTableStatistics result;
+
+    const native_std::size_t numBuckets = d_anchor.bucketArraySize();
+    const bslalg::HashTableBucket *buckets = d_anchor.bucketArrayAddress();
+
+    native_std::size_t numIndexed = 0;
+    for (native_std::size_t i = 0; i != numBuckets; ++i) {
+        const native_std::size_t length = buckets[i].countElements();
+
+        numIndexed += length;
+        if (result.d_maxChainLength < length) {
+            result.d_maxChainLength = length;
+        }
+        ++result.d_occupancyHistogram[
+                 length < HashTableStatistics::k_NUM_HISTOGRAM_BINS
+                 ? length
+                 : HashTableStatistics::k_NUM_HISTOGRAM_BINS - 1];
+    }
+
+    result.d_numElements     = d_size;
+    result.d_numBuckets      = numBuckets;
+    result.d_numEmptyBuckets = result.d_occupancyHistogram[0];
+
+    const native_std::size_t numOccupied = numBuckets
+                                         - result.d_numEmptyBuckets;
+    if (0 != numOccupied) {
+        result.d_meanChainLength = static_cast<double>(numIndexed)
+                                 / static_cast<double>(numOccupied);
+    }
+    result.d_emptyBucketRatio =
+                             static_cast<double>(result.d_numEmptyBuckets)
+                           / static_cast<double>(numBuckets);
+
+    result.d_nodeBytes = static_cast<native_std::size_t>(d_size)
+                                                          * sizeof(NodeType);
+
+    // The default bucket array is shared by every empty table, and so is not
+    // counted.
+
+    if (HashTable_ImpDetails::defaultBucketAddress() != buckets) {
+        result.d_bucketArrayBytes += numBuckets
+                                          * sizeof(bslalg::HashTableBucket);
+    }
+    if (HashTable_ImpDetails::defaultBucketAddress()
+                                         != d_oldAnchor.bucketArrayAddress()) {
+        result.d_bucketArrayBytes += d_oldAnchor.bucketArraySize()
+                                          * sizeof(bslalg::HashTableBucket);
+    }
+
+    result.d_numRehashes = d_numRehashes;
+
+    return result;
+}
+
 }  // close package namespace
 
 //-----------------------------------------------------------------------------
@@ -1,11 +1,14 @@
 // bslstl_hashtable.t.cpp                                             -*-C++-*-
 #include <bslstl_hashtable.h>
 
+#include <bslstl_cacheshashcodes.h>
 #include <bslstl_equalto.h>
 #include <bslstl_hash.h>
 #include <bslstl_hashtableiterator.h>  // usage example
 #include <bslstl_iterator.h>           // 'distance', in usage example
+#include <bslstl_usespoweroftwobuckets.h>
 
+#include <bslalg_bidirectionalhashednode.h>
 #include <bslalg_bidirectionallink.h>
 #include <bslalg_bidirectionallinklistutil.h>
 #include <bslalg_swaputil.h>
@@ -20,8 +23,10 @@
 
 #include <bslmf_conditional.h>
 #include <bslmf_isfunction.h>
+#include <bslmf_issame.h>
 #include <bslmf_istriviallycopyable.h>
 #include <bslmf_istriviallydefaultconstructible.h>
+#include <bslmf_nestedtraitdeclaration.h>
 #include <bslmf_removeconst.h>
 
 #include <bsls_asserttest.h>
@@ -196,7 +201,7 @@ using bslstl::CallableVariable;
 //*[19] typedef ::bsl::allocator_traits<AllocatorType> AllocatorTraits;
 //*[19] typedef typename KEY_CONFIG::KeyType           KeyType;
 //*[19] typedef typename KEY_CONFIG::ValueType         ValueType;
-//*[19] typedef bslalg::BidirectionalNode<ValueType>   NodeType;
+// [19] typedef HashTable_NodeType<ValueType, HASHER>::Type NodeType;
 //*[19] typedef typename AllocatorTraits::size_type    SizeType;
 //
 // CREATORS
@@ -213,10 +218,22 @@ using bslstl::CallableVariable;
 //*[15] insertIfMissing(bool *isInsertedFlag, const SOURCE_TYPE& obj);
 //*[15] insertIfMissing(bool *isInsertedFlag, const ValueType& obj);
 //*[16] insertIfMissing(const KeyType& key);
+// [  ] tryEmplace(bool *isInsertedFlag, const KeyType& key, ARGS&&...);
+// [18] insertBatch(INPUT_ITERATOR first, INPUT_ITERATOR last);
+// [18] insertIfMissingBatch(INPUT_ITERATOR first, INPUT_ITERATOR last);
+// [22] void extractNode(NodeHandleType *result, BidirectionalLink *node);
+// [22] BidirectionalLink *insertNode(NodeHandleType *, BidirectionalLink *);
+// [22] BidirectionalLink *insertNodeIfMissing(bool *, NodeHandleType *);
+// [22] void merge(HashTable *source);
+// [22] void mergeIfMissing(HashTable *source);
 // [  ] remove(bslalg::BidirectionalLink *node);
+// [23] BidirectionalLink *insertIfMissingWithHashCode(bool *, VALUE, size_t);
+// [23] BidirectionalLink *removeWithHashCode(BidirectionalLink *, size_t);
 // [ 2] removeAll();
+// [20] void completeRehash();
 //*[11] rehashForNumBuckets(SizeType newNumBuckets);
 //*[11] reserveForNumElements(SizeType numElements);
+// [20] void setIncrementalRehash(bool incremental);
 //*[13] setMaxLoadFactor(float loadFactor);
 // [ 8] swap(HashTable& other);
 //
@@ -224,9 +241,12 @@ using bslstl::CallableVariable;
 // [ 4] allocator() const;
 // [ 4] comparator() const;
 // [ 4] hasher() const;
+// [20] bool incrementalRehash() const;
+// [20] bool isRehashInProgress() const;
 // [ 4] size() const;
 //*[18] maxSize() const;
 // [ 4] numBuckets() const;
+// [20] SizeType numBucketsPendingRehash() const;
 //*[18] maxNumBuckets() const;
 //*[13] loadFactor() const;
 // [ 4] maxLoadFactor() const;
@@ -234,10 +254,15 @@ using bslstl::CallableVariable;
 // [ 4] elementListRoot() const;
 //*[17] find(const KeyType& key) const;
 //*[17] findRange(BLink **first, BLink **last, const KeyType& k) const;
+// [17] findTransparent(const LOOKUP_KEY& key) const;
+// [17] findRangeTransparent(BLink **, BLink **, const LOOKUP_KEY&) const;
+// [18] findBatch(BLink **results, const KeyType *keys, SizeType n) const;
+// [23] BidirectionalLink *findWithHashCode(const KeyType&, size_t) const;
 //*[ 6] findEndOfRange(bslalg::BidirectionalLink *first) const;
 // [ 4] bucketAtIndex(SizeType index) const;
 // [ 4] bucketIndexForKey(const KeyType& key) const;
 // [ 4] countElementsInBucket(SizeType index) const;
+// [21] HashTableStatistics statistics() const;
 //
 // [ 6] bool operator==(const HashTable& lhs, const HashTable& rhs);
 // [ 6] bool operator!=(const HashTable& lhs, const HashTable& rhs);
@@ -247,13 +272,15 @@ using bslstl::CallableVariable;
 //
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [  ] USAGE EXAMPLE
+// [24] USAGE EXAMPLE
 //
 // class HashTable_ImpDetails
+// [16] size_t adjustHashCode(size_t hashCode, bool mix);
 // [  ] bslalg::HashTableBucket *defaultBucketAddress();
-// [  ] size_t growBucketsForLoadFactor(size_t *, size_t, size_t, double);
+// [16] size_t growBucketsForLoadFactor(size_t *, size_t, size_t, double, P);
 // [  ] bslma::Allocator *incidentalAllocator();
 // [  ] size_t nextPrime(size_t n);
+// [16] size_t nextPowerOfTwo(size_t n);
 //
 // class HashTable_Util
 // [  ] initAnchor<ALLOC>(bslalg::HashTableAnchor *, size_t, const ALLOC&)
@@ -279,6 +306,8 @@ using bslstl::CallableVariable;
 // [  ] bool expectPoolToAllocate(size_t n)
 // [  ] size_t predictNumBuckets(size_t length, float maxLoadFactor)
 //
+// [16] CONCERN: 'UsesPowerOfTwoBuckets' hashers use power-of-two buckets.
+// [19] CONCERN: 'CachesHashCodes' hashers store hash codes in nodes.
 // [  ] CONCERN: The type employs the expected size optimizations.
 // [  ] CONCERN: The type has the necessary type traits.
 
@@ -2074,6 +2103,207 @@ void debugprint(const MostEvilTestType& value);
     // Note that this representation is intended only to support error reports
     // and not as a portable format.
 
+                       // ====================
+                       // class PowerOfTwoHash
+                       // ====================
+
+struct PowerOfTwoHash {
+    // This hash functor is associated with the 'UsesPowerOfTwoBuckets' trait,
+    // and returns a multiple of 64 for each 'int' key, emulating a weak
+    // (identity) hash of aligned addresses, whose low-order bits are always
+    // zero.
+
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(PowerOfTwoHash,
+                                   bslstl::UsesPowerOfTwoBuckets);
+
+    // ACCESSORS
+    size_t operator()(int value) const
+        // Return the hash code of the specified 'value'.
+    {
+        return static_cast<size_t>(value) << 6;
+    }
+};
+
+                       // =================
+                       // class DecimalHash
+                       // =================
+
+struct DecimalHash {
+    // This transparent hash functor hashes an 'int' key, or a null-terminated
+    // string holding the decimal representation of an 'int', such that a key
+    // and its representation have the same hash code.
+
+    // PUBLIC TYPES
+    typedef void is_transparent;
+
+    // ACCESSORS
+    size_t operator()(int value) const
+        // Return the hash code of the specified 'value'.
+    {
+        return bsl::hash<int>()(value);
+    }
+
+    size_t operator()(const char *decimal) const
+        // Return the hash code of the 'int' represented by the specified
+        // 'decimal' string.
+    {
+        return (*this)(static_cast<int>(strtol(decimal, 0, 10)));
+    }
+};
+
+                       // ==================
+                       // class DecimalEqual
+                       // ==================
+
+struct DecimalEqual {
+    // This transparent comparator compares an 'int' key with either another
+    // 'int', or a null-terminated string holding the decimal representation
+    // of an 'int'.
+
+    // PUBLIC TYPES
+    typedef void is_transparent;
+
+    // ACCESSORS
+    bool operator()(int lhs, int rhs) const
+        // Return 'true' if the specified 'lhs' and 'rhs' have the same value,
+        // and 'false' otherwise.
+    {
+        return lhs == rhs;
+    }
+
+    bool operator()(const char *lhs, int rhs) const
+        // Return 'true' if the specified 'lhs' string is the decimal
+        // representation of the specified 'rhs', and 'false' otherwise.
+    {
+        return static_cast<int>(strtol(lhs, 0, 10)) == rhs;
+    }
+};
+
+                       // =================
+                       // class CachingHash
+                       // =================
+
+struct CachingHash {
+    // This hash functor is associated with the 'CachesHashCodes' trait, and
+    // counts the number of times it is called (by any object of this type).
+
+    // CLASS DATA
+    static int s_numCalls;  // number of calls to 'operator()'
+
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(CachingHash, bslstl::CachesHashCodes);
+
+    // ACCESSORS
+    size_t operator()(int value) const
+        // Return the hash code of the specified 'value'.
+    {
+        ++s_numCalls;
+        return bsl::hash<int>()(value);
+    }
+};
+
+int CachingHash::s_numCalls = 0;
+
+                       // ===================
+                       // class CountingEqual
+                       // ===================
+
+struct CountingEqual {
+    // This comparator compares two 'int' keys for equality, and counts the
+    // number of times it is called (by any object of this type).
+
+    // CLASS DATA
+    static int s_numCalls;  // number of calls to 'operator()'
+
+    // ACCESSORS
+    bool operator()(int lhs, int rhs) const
+        // Return 'true' if the specified 'lhs' and 'rhs' have the same value,
+        // and 'false' otherwise.
+    {
+        ++s_numCalls;
+        return lhs == rhs;
+    }
+};
+
+int CountingEqual::s_numCalls = 0;
+
+                       // ==================
+                       // class ConstantHash
+                       // ==================
+
+struct ConstantHash {
+    // This hash functor returns the same hash code for every 'int' key, so
+    // that every element of a table using it is held in a single bucket.
+
+    // ACCESSORS
+    size_t operator()(int) const
+        // Return 0.
+    {
+        return 0;
+    }
+};
+
+                       // ====================
+                       // class CopyCountedInt
+                       // ====================
+
+class CopyCountedInt {
+    // This class holds an 'int' value, and counts the number of copies made
+    // of any object of this type, so that a test can observe the number of
+    // nodes a hash table creates.
+
+    // DATA
+    int d_value;
+
+  public:
+    // CLASS DATA
+    static int s_numCopies;  // number of calls to the copy constructor
+
+    // CREATORS
+    CopyCountedInt(int value = 0)                                   // IMPLICIT
+        // Create an object holding the optionally specified 'value', or 0 if
+        // 'value' is not specified.
+    : d_value(value)
+    {
+    }
+
+    CopyCountedInt(const CopyCountedInt& original)
+        // Create an object holding the value of the specified 'original'
+        // object, and increment 's_numCopies'.
+    : d_value(original.d_value)
+    {
+        ++s_numCopies;
+    }
+
+    // ACCESSORS
+    int value() const
+        // Return the value held by this object.
+    {
+        return d_value;
+    }
+};
+
+int CopyCountedInt::s_numCopies = 0;
+
+bool operator==(const CopyCountedInt& lhs, const CopyCountedInt& rhs)
+    // Return 'true' if the specified 'lhs' and 'rhs' hold the same value, and
+    // 'false' otherwise.
+{
+    return lhs.value() == rhs.value();
+}
+
+struct CopyCountedIntHash {
+    // This hash functor hashes the value held by a 'CopyCountedInt'.
+
+    // ACCESSORS
+    size_t operator()(const CopyCountedInt& key) const
+        // Return the hash code of the value held by the specified 'key'.
+    {
+        return bsl::hash<int>()(key.value());
+    }
+};
+
 }  // close namespace TestTypes
 
 //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
@@ -11049,6 +11279,1721 @@ void mainTestCase15()
     TestDriver_AwkwardMaplike::testCase15();
 }
 
+static
+void mainTestCase16()
+    // --------------------------------------------------------------------
+    // TESTING POWER-OF-TWO BUCKET ARRAYS
+    //
+    // Concerns:
+    //: 1 'nextPowerOfTwo' returns the smallest power of two not less than its
+    //:   argument, and throws 'std::length_error' if there is no such value.
+    //:
+    //: 2 'growBucketsForLoadFactor' returns a power of two satisfying the
+    //:   load factor when the power-of-two policy is requested, and a value
+    //:   from the prime sequence otherwise.
+    //:
+    //: 3 'adjustHashCode' returns its argument unchanged unless mixing is
+    //:   requested, and mixing spreads hash codes that differ only in their
+    //:   high-order bits across the low-order bits.
+    //:
+    //: 4 A 'HashTable' whose hasher is associated with the
+    //:   'UsesPowerOfTwoBuckets' trait always has a power of two buckets, and
+    //:   every element remains reachable through 'find' as the table grows.
+    //:
+    //: 5 A weak hasher (producing codes with all low-order bits zero) still
+    //:   populates a large fraction of the buckets.
+    //:
+    //: 6 'hasher' returns the supplied functor, which is not affected by the
+    //:   mixing of hash codes.
+    //:
+    //: 7 A 'HashTable' whose hasher is not associated with the trait still
+    //:   chooses its number of buckets from the prime sequence.
+    //
+    // Plan:
+    //: 1 Use a table of representative arguments to verify 'nextPowerOfTwo'
+    //:   and 'growBucketsForLoadFactor'.  (C-1..2)
+    //:
+    //: 2 Hash a sequence of multiples of 64 with and without mixing, and
+    //:   count the distinct bucket indices that result.  (C-3)
+    //:
+    //: 3 Insert a sequence of keys into a table using 'PowerOfTwoHash',
+    //:   verifying after each insertion that the number of buckets is a power
+    //:   of two, and finally that every key is found in the bucket reported
+    //:   by 'bucketIndexForKey', and that the elements span many buckets.
+    //:   (C-4..6)
+    //:
+    //: 4 Reserve space in a table using 'bsl::hash', and compare the number
+    //:   of buckets with 'nextPrime'.  (C-7)
+    //
+    // Testing:
+    //   size_t adjustHashCode(size_t hashCode, bool mix);
+    //   size_t growBucketsForLoadFactor(size_t *, size_t, size_t, double, P);
+    //   size_t nextPowerOfTwo(size_t n);
+    //   CONCERN: 'UsesPowerOfTwoBuckets' hashers use power-of-two buckets.
+    // --------------------------------------------------------------------
+{
+    if (verbose) printf("\nTESTING POWER-OF-TWO BUCKET ARRAYS"
+                        "\n==================================\n");
+
+    typedef bslstl::HashTable_ImpDetails ImpDetails;
+
+    if (verbose) printf("\nTesting 'nextPowerOfTwo'.\n");
+    {
+        static const struct {
+            int    d_line;
+            size_t d_n;
+            size_t d_expected;
+        } DATA[] = {
+            //LINE     N  EXPECTED
+            //----  ----  --------
+            { L_,      0,        1 },
+            { L_,      1,        1 },
+            { L_,      2,        2 },
+            { L_,      3,        4 },
+            { L_,      4,        4 },
+            { L_,      5,        8 },
+            { L_,   1000,     1024 },
+            { L_,   1024,     1024 },
+            { L_,   1025,     2048 },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int ti = 0; ti != NUM_DATA; ++ti) {
+            const int    LINE     = DATA[ti].d_line;
+            const size_t N        = DATA[ti].d_n;
+            const size_t EXPECTED = DATA[ti].d_expected;
+
+            ASSERTV(LINE, N, EXPECTED == ImpDetails::nextPowerOfTwo(N));
+        }
+
+        const size_t MAX_POWER =
+                        (native_std::numeric_limits<size_t>::max() >> 1) + 1;
+        ASSERT(MAX_POWER == ImpDetails::nextPowerOfTwo(MAX_POWER));
+
+#if defined(BDE_BUILD_TARGET_EXC)
+        try {
+            ImpDetails::nextPowerOfTwo(MAX_POWER + 1);
+            ASSERT(false);
+        }
+        catch(const native_std::length_error&) {
+            // This is the expected code path
+        }
+        catch(...) {
+            ASSERT(!"The wrong exception type was thrown.");
+        }
+#endif
+    }
+
+    if (verbose) printf("\nTesting 'growBucketsForLoadFactor'.\n");
+    {
+        static const struct {
+            int    d_line;
+            size_t d_minElements;
+            size_t d_requestedBuckets;
+            double d_maxLoadFactor;
+        } DATA[] = {
+            //LINE  MIN_ELEMENTS  REQUESTED  MAX_LOAD_FACTOR
+            //----  ------------  ---------  ---------------
+            { L_,              1,         1,             1.0 },
+            { L_,              1,         2,             1.0 },
+            { L_,              1,        100,            1.0 },
+            { L_,            100,         1,             1.0 },
+            { L_,            100,         1,             0.3 },
+            { L_,            100,         1,             5.0 },
+            { L_,           1000,       700,             0.75 },
+            { L_,          12345,         1,             1.0 },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int ti = 0; ti != NUM_DATA; ++ti) {
+            const int    LINE      = DATA[ti].d_line;
+            const size_t MIN_ELEMS = DATA[ti].d_minElements;
+            const size_t REQUESTED = DATA[ti].d_requestedBuckets;
+            const double MAX_LF    = DATA[ti].d_maxLoadFactor;
+
+            size_t capacity = 0;
+            const size_t POW2 = ImpDetails::growBucketsForLoadFactor(
+                                           &capacity,
+                                           MIN_ELEMS,
+                                           REQUESTED,
+                                           MAX_LF,
+                                           ImpDetails::e_POWER_OF_TWO_BUCKETS);
+
+            ASSERTV(LINE, POW2, 0 == (POW2 & (POW2 - 1)));
+            ASSERTV(LINE, POW2, REQUESTED <= POW2);
+            ASSERTV(LINE, capacity, MIN_ELEMS <= capacity);
+
+            const size_t PRIME = ImpDetails::growBucketsForLoadFactor(
+                                                                   &capacity,
+                                                                   MIN_ELEMS,
+                                                                   REQUESTED,
+                                                                   MAX_LF);
+            ASSERTV(LINE, PRIME, PRIME == ImpDetails::nextPrime(PRIME));
+            ASSERTV(LINE, capacity, MIN_ELEMS <= capacity);
+        }
+    }
+
+    if (verbose) printf("\nTesting 'adjustHashCode'.\n");
+    {
+        const size_t NUM_BUCKETS = 256;
+
+        bool usedMixed[NUM_BUCKETS]   = { false };
+        bool usedUnmixed[NUM_BUCKETS] = { false };
+        size_t numMixed   = 0;
+        size_t numUnmixed = 0;
+
+        for (size_t i = 0; i != NUM_BUCKETS; ++i) {
+            const size_t HASH = i << 8;
+
+            ASSERTV(i, HASH == ImpDetails::adjustHashCode(HASH, false));
+
+            const size_t MIXED = ImpDetails::adjustHashCode(HASH, true)
+                               & (NUM_BUCKETS - 1);
+            const size_t UNMIXED = HASH & (NUM_BUCKETS - 1);
+
+            if (!usedMixed[MIXED]) {
+                usedMixed[MIXED] = true;
+                ++numMixed;
+            }
+            if (!usedUnmixed[UNMIXED]) {
+                usedUnmixed[UNMIXED] = true;
+                ++numUnmixed;
+            }
+        }
+
+        ASSERTV(numUnmixed, 1 == numUnmixed);
+        ASSERTV(numMixed, NUM_BUCKETS / 2 < numMixed);
+    }
+
+    if (verbose) printf("\nTesting power-of-two 'HashTable'.\n");
+    {
+        typedef bslstl::HashTable<BasicKeyConfig<int>,
+                                  TestTypes::PowerOfTwoHash,
+                                  bsl::equal_to<int>,
+                                  bsl::allocator<int> > Obj;
+
+        bslma::TestAllocator         oa("object", veryVeryVeryVerbose);
+        bslma::TestAllocator         da("default", veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        const int NUM_KEYS = 2000;
+
+        Obj mX(TestTypes::PowerOfTwoHash(),
+               bsl::equal_to<int>(),
+               0,
+               1.0f,
+               &oa);
+        const Obj& X = mX;
+
+        for (int i = 0; i != NUM_KEYS; ++i) {
+            mX.insert(i);
+
+            const size_t NUM_BUCKETS = X.numBuckets();
+            ASSERTV(i, NUM_BUCKETS, 0 == (NUM_BUCKETS & (NUM_BUCKETS - 1)));
+            ASSERTV(i, X.size() <= X.rehashThreshold());
+        }
+
+        ASSERT(NUM_KEYS == static_cast<int>(X.size()));
+        ASSERT((static_cast<size_t>(7) << 6) == X.hasher()(7));
+
+        size_t numPopulated = 0;
+        size_t numCounted   = 0;
+        for (size_t b = 0; b != X.numBuckets(); ++b) {
+            const size_t COUNT = X.countElementsInBucket(b);
+            numCounted += COUNT;
+            if (COUNT) {
+                ++numPopulated;
+            }
+        }
+        ASSERTV(numCounted, X.size() == numCounted);
+        ASSERTV(numPopulated, X.numBuckets(),
+                X.numBuckets() / 4 < numPopulated);
+
+        for (int i = 0; i != NUM_KEYS; ++i) {
+            bslalg::BidirectionalLink *link = X.find(i);
+            ASSERTV(i, 0 != link);
+            if (!link) {
+                continue;                                           // CONTINUE
+            }
+
+            ASSERTV(i, i == ImpUtil::extractKey<BasicKeyConfig<int> >(link));
+
+            const size_t BUCKET = X.bucketIndexForKey(i);
+            ASSERTV(i, BUCKET < X.numBuckets());
+
+            const bslalg::HashTableBucket& bucket = X.bucketAtIndex(BUCKET);
+            bool found = false;
+            for (bslalg::BidirectionalLink *cursor = bucket.first();
+                 !found;
+                 cursor = cursor->nextLink()) {
+                found = cursor == link;
+                if (cursor == bucket.last()) {
+                    break;
+                }
+            }
+            ASSERTV(i, found);
+        }
+        ASSERT(!X.find(NUM_KEYS));
+
+        mX.rehashForNumBuckets(100000);
+        ASSERTV(X.numBuckets(), 131072 == X.numBuckets());
+
+        for (int i = 0; i != NUM_KEYS; ++i) {
+            ASSERTV(i, X.find(i));
+        }
+
+        ASSERTV(da.numBlocksTotal(), 0 == da.numBlocksTotal());
+    }
+
+    if (verbose) printf("\nTesting prime 'HashTable'.\n");
+    {
+        typedef bslstl::HashTable<BasicKeyConfig<int>,
+                                  bsl::hash<int>,
+                                  bsl::equal_to<int>,
+                                  bsl::allocator<int> > Obj;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        Obj mX(bsl::hash<int>(), bsl::equal_to<int>(), 0, 1.0f, &oa);
+        const Obj& X = mX;
+
+        mX.reserveForNumElements(1000);
+        ASSERTV(X.numBuckets(),
+                X.numBuckets() == ImpDetails::nextPrime(1000));
+    }
+}
+
+static
+void mainTestCase17()
+    // --------------------------------------------------------------------
+    // TESTING TRANSPARENT LOOKUP
+    //
+    // Concerns:
+    //: 1 'findTransparent' locates an element using a key of a type other
+    //:   than 'KeyType', passing that key unconverted to the hasher and
+    //:   comparator.
+    //:
+    //: 2 'findTransparent' returns a null pointer value if no element has an
+    //:   equivalent key.
+    //:
+    //: 3 'findRangeTransparent' returns the same range as 'findRange' for the
+    //:   equivalent 'KeyType' value, including for keys with duplicates.
+    //:
+    //: 4 Neither method allocates memory.
+    //
+    // Plan:
+    //: 1 Insert a sequence of 'int' keys, several of them more than once,
+    //:   into a table using the transparent 'DecimalHash' and 'DecimalEqual'
+    //:   functors.  For each key, and some absent keys, compare the results
+    //:   of the transparent methods given the decimal representation of the
+    //:   key with those of 'find' and 'findRange' given the key.  Verify that
+    //:   no memory is allocated during the lookups.  (C-1..4)
+    //
+    // Testing:
+    //   findTransparent(const LOOKUP_KEY& key) const;
+    //   findRangeTransparent(BLink **, BLink **, const LOOKUP_KEY&) const;
+    // --------------------------------------------------------------------
+{
+    if (verbose) printf("\nTESTING TRANSPARENT LOOKUP"
+                        "\n==========================\n");
+
+    typedef bslstl::HashTable<BasicKeyConfig<int>,
+                              TestTypes::DecimalHash,
+                              TestTypes::DecimalEqual,
+                              bsl::allocator<int> > Obj;
+
+    bslma::TestAllocator         oa("object", veryVeryVeryVerbose);
+    bslma::TestAllocator         da("default", veryVeryVeryVerbose);
+    bslma::DefaultAllocatorGuard dag(&da);
+
+    const int NUM_KEYS = 100;
+
+    Obj mX(TestTypes::DecimalHash(), TestTypes::DecimalEqual(), 0, 1.0f, &oa);
+    const Obj& X = mX;
+
+    for (int i = 0; i != NUM_KEYS; ++i) {
+        mX.insert(i);
+        if (0 == i % 3) {
+            mX.insert(i);    // duplicate every third key
+        }
+    }
+
+    bslma::TestAllocatorMonitor oam(&oa);
+
+    for (int i = -1; i <= NUM_KEYS; ++i) {
+        char decimal[16];
+        sprintf(decimal, "%d", i);
+
+        bslalg::BidirectionalLink *link = X.findTransparent(decimal);
+        ASSERTV(i, X.find(i) == link);
+        ASSERTV(i, (0 <= i && i < NUM_KEYS) == (0 != link));
+
+        bslalg::BidirectionalLink *expFirst, *expLast;
+        X.findRange(&expFirst, &expLast, i);
+
+        bslalg::BidirectionalLink *first, *last;
+        X.findRangeTransparent(&first, &last, decimal);
+        ASSERTV(i, expFirst == first);
+        ASSERTV(i, expLast  == last);
+        ASSERTV(i, link     == first);
+    }
+
+    ASSERT(oam.isTotalSame());
+    ASSERTV(da.numBlocksTotal(), 0 == da.numBlocksTotal());
+}
+
+static
+void mainTestCase18()
+    // --------------------------------------------------------------------
+    // TESTING BATCHED LOOKUP AND INSERTION
+    //
+    // Concerns:
+    //: 1 'findBatch' loads, for each key, the same link that 'find' returns,
+    //:   for batches both shorter and longer than the internal batch size.
+    //:
+    //: 2 'findBatch' does not allocate memory.
+    //:
+    //: 3 'insertBatch' inserts every value in the range, including
+    //:   duplicates, and grows the bucket array as needed to preserve the
+    //:   maximum load factor.
+    //:
+    //: 4 'insertIfMissingBatch' inserts a value only if no element in the
+    //:   table, including one inserted earlier from the same range, has an
+    //:   equivalent key.
+    //:
+    //: 5 The batched insertion methods leave the table in the same state as
+    //:   the equivalent sequence of single-element insertions.
+    //:
+    //: 6 Any memory allocated for nodes that are not linked into the table
+    //:   is released.
+    //:
+    //: 7 'insertIfMissingBatch' grows the bucket array only to accommodate
+    //:   values that are inserted, whether or not the range holds objects of
+    //:   the table's value type.
+    //:
+    //: 8 When given a forward-iterator range of objects of the table's value
+    //:   type, 'insertIfMissingBatch' creates a node only for a value whose
+    //:   key is not already present.
+    //
+    // Plan:
+    //: 1 Insert a range of keys containing duplicates into a table with a
+    //:   small initial bucket count using 'insertBatch', and into a second
+    //:   table one key at a time using 'insert'.  Verify that the tables
+    //:   have the same size and compare equal, and that the load factor does
+    //:   not exceed the maximum.  (C-3, 5)
+    //:
+    //: 2 Repeat P-1 using 'insertIfMissingBatch' and 'insertIfMissing', and
+    //:   verify that each key is present exactly once.  Verify that the
+    //:   object allocator has no outstanding blocks other than those owned by
+    //:   the table.  (C-4..6)
+    //:
+    //: 4 Repeat 'insertIfMissingBatch' on a table already holding every key
+    //:   of the range, using both a range of 'int' and a range of 'short',
+    //:   and verify that neither the size nor the number of buckets changes.
+    //:   (C-7)
+    //:
+    //: 5 Insert a range of 'CopyCountedInt' values, containing duplicates and
+    //:   a key already present, using 'insertIfMissingBatch', and verify that
+    //:   the number of copies made equals the number of new keys.  (C-8)
+    //:
+    //: 3 For several batch lengths, and keys both present and absent, compare
+    //:   the results of 'findBatch' with those of 'find', verifying that no
+    //:   memory is allocated.  (C-1..2)
+    //
+    // Testing:
+    //   insertBatch(INPUT_ITERATOR first, INPUT_ITERATOR last);
+    //   insertIfMissingBatch(INPUT_ITERATOR first, INPUT_ITERATOR last);
+    //   findBatch(BLink **results, const KeyType *keys, SizeType n) const;
+    // --------------------------------------------------------------------
+{
+    if (verbose) printf("\nTESTING BATCHED LOOKUP AND INSERTION"
+                        "\n====================================\n");
+
+    typedef bslstl::HashTable<BasicKeyConfig<int>,
+                              bsl::hash<int>,
+                              bsl::equal_to<int>,
+                              bsl::allocator<int> > Obj;
+
+    bslma::TestAllocator         oa("object", veryVeryVeryVerbose);
+    bslma::TestAllocator         da("default", veryVeryVeryVerbose);
+    bslma::DefaultAllocatorGuard dag(&da);
+
+    const int NUM_VALUES = 100;
+
+    int values[NUM_VALUES];
+    for (int i = 0; i != NUM_VALUES; ++i) {
+        values[i] = (i * 7) % (NUM_VALUES / 2);    // each key twice
+    }
+
+    if (veryVerbose) printf("\tTesting 'insertBatch'.\n");
+    {
+        Obj mX(bsl::hash<int>(), bsl::equal_to<int>(), 1, 1.0f, &oa);
+        const Obj& X = mX;
+
+        Obj mY(bsl::hash<int>(), bsl::equal_to<int>(), 1, 1.0f, &oa);
+        const Obj& Y = mY;
+
+        mX.insertBatch(values + 0, values + NUM_VALUES);
+        for (int i = 0; i != NUM_VALUES; ++i) {
+            mY.insert(values[i]);
+        }
+
+        ASSERTV(X.size(), NUM_VALUES == X.size());
+        ASSERTV(X.loadFactor(), X.loadFactor() <= X.maxLoadFactor());
+        ASSERT(Y == X);
+    }
+    ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+
+    if (veryVerbose) printf("\tTesting 'insertIfMissingBatch'.\n");
+    {
+        Obj mX(bsl::hash<int>(), bsl::equal_to<int>(), 1, 1.0f, &oa);
+        const Obj& X = mX;
+
+        Obj mY(bsl::hash<int>(), bsl::equal_to<int>(), 1, 1.0f, &oa);
+        const Obj& Y = mY;
+
+        bool isInserted;
+        mX.insertIfMissing(&isInserted, values[3]);    // present before batch
+        mY.insertIfMissing(&isInserted, values[3]);
+
+        mX.insertIfMissingBatch(values + 0, values + NUM_VALUES);
+        for (int i = 0; i != NUM_VALUES; ++i) {
+            mY.insertIfMissing(&isInserted, values[i]);
+        }
+
+        ASSERTV(X.size(), NUM_VALUES / 2 == X.size());
+        ASSERTV(X.loadFactor(), X.loadFactor() <= X.maxLoadFactor());
+        ASSERT(Y == X);
+
+        for (int i = 0; i != NUM_VALUES / 2; ++i) {
+            bslalg::BidirectionalLink *first, *last;
+            X.findRange(&first, &last, i);
+            ASSERTV(i, 0 != first);
+            ASSERTV(i, first && first->nextLink() == last);
+        }
+
+        if (veryVerbose) printf("\tTesting no growth for present keys.\n");
+
+        short shortValues[NUM_VALUES];
+        for (int i = 0; i != NUM_VALUES; ++i) {
+            shortValues[i] = static_cast<short>(values[i]);
+        }
+
+        const size_t NUM_BUCKETS = X.numBuckets();
+
+        mX.insertIfMissingBatch(values + 0, values + NUM_VALUES);
+        ASSERTV(X.size(), NUM_VALUES / 2 == X.size());
+        ASSERTV(NUM_BUCKETS, X.numBuckets(), NUM_BUCKETS == X.numBuckets());
+
+        mX.insertIfMissingBatch(shortValues + 0, shortValues + NUM_VALUES);
+        ASSERTV(X.size(), NUM_VALUES / 2 == X.size());
+        ASSERTV(NUM_BUCKETS, X.numBuckets(), NUM_BUCKETS == X.numBuckets());
+        ASSERT(Y == X);
+
+        Obj mZ(bsl::hash<int>(), bsl::equal_to<int>(), 1, 1.0f, &oa);
+        const Obj& Z = mZ;
+
+        mZ.insertIfMissingBatch(shortValues + 0, shortValues + NUM_VALUES);
+        ASSERTV(Z.loadFactor(), Z.loadFactor() <= Z.maxLoadFactor());
+        ASSERT(Y == Z);
+    }
+    ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+
+    if (veryVerbose) printf("\tTesting nodes created only for new keys.\n");
+    {
+        using TestTypes::CopyCountedInt;
+
+        typedef bslstl::HashTable<BasicKeyConfig<CopyCountedInt>,
+                                  TestTypes::CopyCountedIntHash,
+                                  bsl::equal_to<CopyCountedInt>,
+                                  bsl::allocator<CopyCountedInt> > CountedObj;
+
+        CopyCountedInt countedValues[NUM_VALUES];
+        for (int i = 0; i != NUM_VALUES; ++i) {
+            countedValues[i] = values[i];
+        }
+
+        CountedObj mX(TestTypes::CopyCountedIntHash(),
+                      bsl::equal_to<CopyCountedInt>(),
+                      1,
+                      1.0f,
+                      &oa);
+        const CountedObj& X = mX;
+
+        bool isInserted;
+        mX.insertIfMissing(&isInserted, countedValues[3]);
+
+        CopyCountedInt::s_numCopies = 0;
+
+        mX.insertIfMissingBatch(countedValues + 0,
+                                countedValues + NUM_VALUES);
+
+        ASSERTV(X.size(), NUM_VALUES / 2 == X.size());
+        ASSERTV(CopyCountedInt::s_numCopies,
+                NUM_VALUES / 2 - 1 == CopyCountedInt::s_numCopies);
+    }
+    ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+
+    if (veryVerbose) printf("\tTesting 'findBatch'.\n");
+    {
+        Obj mX(bsl::hash<int>(), bsl::equal_to<int>(), 0, 1.0f, &oa);
+        const Obj& X = mX;
+
+        mX.insertBatch(values + 0, values + NUM_VALUES);
+
+        int keys[NUM_VALUES];
+        for (int i = 0; i != NUM_VALUES; ++i) {
+            keys[i] = NUM_VALUES - 2 * i;    // some present, some absent
+        }
+
+        bslma::TestAllocatorMonitor oam(&oa);
+
+        static const int LENGTHS[] = { 0, 1, 15, 16, 17, 33, NUM_VALUES };
+        const int NUM_LENGTHS = sizeof LENGTHS / sizeof *LENGTHS;
+
+        for (int ti = 0; ti != NUM_LENGTHS; ++ti) {
+            const int LENGTH = LENGTHS[ti];
+
+            bslalg::BidirectionalLink *results[NUM_VALUES + 1];
+            results[LENGTH] = reinterpret_cast<bslalg::BidirectionalLink *>(
+                                                                      results);
+
+            X.findBatch(results, keys, LENGTH);
+
+            for (int i = 0; i != LENGTH; ++i) {
+                ASSERTV(LENGTH, i, X.find(keys[i]) == results[i]);
+            }
+            ASSERTV(LENGTH,
+                    reinterpret_cast<bslalg::BidirectionalLink *>(results)
+                                                          == results[LENGTH]);
+        }
+
+        ASSERT(oam.isTotalSame());
+    }
+    ASSERTV(da.numBlocksTotal(), 0 == da.numBlocksTotal());
+}
+
+static
+void mainTestCase19()
+    // --------------------------------------------------------------------
+    // TESTING CACHED HASH CODES
+    //
+    // Concerns:
+    //: 1 A table whose hasher has the 'CachesHashCodes' trait allocates its
+    //:   elements as 'bslalg::BidirectionalHashedNode' objects.
+    //:
+    //: 2 The hasher is called exactly once for each element inserted, and
+    //:   for each key sought, and not when the bucket array grows or an
+    //:   element is removed.
+    //:
+    //: 3 Copying a table does not call the hasher.
+    //:
+    //: 4 The comparator is called, while searching a bucket, only for
+    //:   elements whose hash code matches that of the key sought.
+    //:
+    //: 5 The table otherwise has the same value as a table whose hasher does
+    //:   not have the trait.
+    //
+    // Plan:
+    //: 1 Verify the 'NodeType' of tables with and without the trait.  (C-1)
+    //:
+    //: 2 Using a hasher with the trait that counts its calls, insert a
+    //:   sequence of keys into a table having a single bucket, and verify
+    //:   that the number of calls equals the number of keys although the
+    //:   bucket array has grown.  Copy the table, then remove each element,
+    //:   verifying the hasher is not called.  (C-2..3)
+    //:
+    //: 3 Using a comparator that counts its calls, and a large maximum load
+    //:   factor so that buckets hold many elements, verify that 'find' calls
+    //:   the comparator once for a key that is present and never for a key
+    //:   that is absent.  (C-4)
+    //:
+    //: 4 Compare (using 'find') the contents of a table with the trait to
+    //:   those of a table without it after the same insertions.  (C-5)
+    //
+    // Testing:
+    //   CONCERN: 'CachesHashCodes' hashers store hash codes in nodes.
+    // --------------------------------------------------------------------
+{
+    if (verbose) printf("\nTESTING CACHED HASH CODES"
+                        "\n=========================\n");
+
+    typedef bslstl::HashTable<BasicKeyConfig<int>,
+                              TestTypes::CachingHash,
+                              TestTypes::CountingEqual,
+                              bsl::allocator<int> > Obj;
+
+    typedef bslstl::HashTable<BasicKeyConfig<int>,
+                              bsl::hash<int>,
+                              TestTypes::CountingEqual,
+                              bsl::allocator<int> > ObjNoCache;
+
+    bslma::TestAllocator         oa("object", veryVeryVeryVerbose);
+    bslma::TestAllocator         da("default", veryVeryVeryVerbose);
+    bslma::DefaultAllocatorGuard dag(&da);
+
+    if (veryVerbose) printf("\tTesting node types.\n");
+    {
+        ASSERT((bsl::is_same<bslalg::BidirectionalHashedNode<int>,
+                             Obj::NodeType>::value));
+        ASSERT((bsl::is_same<bslalg::BidirectionalNode<int>,
+                             ObjNoCache::NodeType>::value));
+    }
+
+    const int NUM_VALUES = 200;
+
+    if (veryVerbose) printf("\tTesting calls to the hasher.\n");
+    {
+        Obj mX(TestTypes::CachingHash(),
+               TestTypes::CountingEqual(),
+               1,
+               1.0f,
+               &oa);
+        const Obj& X = mX;
+
+        const size_t INITIAL_NUM_BUCKETS = X.numBuckets();
+
+        TestTypes::CachingHash::s_numCalls = 0;
+        for (int i = 0; i != NUM_VALUES; ++i) {
+            mX.insert(i);
+        }
+        ASSERTV(X.numBuckets(), INITIAL_NUM_BUCKETS < X.numBuckets());
+        ASSERTV(TestTypes::CachingHash::s_numCalls,
+                NUM_VALUES == TestTypes::CachingHash::s_numCalls);
+
+        TestTypes::CachingHash::s_numCalls = 0;
+        mX.rehashForNumBuckets(X.numBuckets() * 4);
+        ASSERTV(TestTypes::CachingHash::s_numCalls,
+                0 == TestTypes::CachingHash::s_numCalls);
+
+        Obj mY(X, &oa);  const Obj& Y = mY;
+        ASSERTV(TestTypes::CachingHash::s_numCalls,
+                0 == TestTypes::CachingHash::s_numCalls);
+        ASSERT(X == Y);
+
+        TestTypes::CachingHash::s_numCalls = 0;
+        for (int i = 0; i != NUM_VALUES; ++i) {
+            bslalg::BidirectionalLink *link = X.find(i);
+            ASSERTV(i, link);
+            ASSERTV(i, static_cast<Obj::NodeType *>(link)->hashCode()
+                                       == bsl::hash<int>()(i));
+            mX.remove(link);
+        }
+        ASSERTV(TestTypes::CachingHash::s_numCalls,
+                NUM_VALUES == TestTypes::CachingHash::s_numCalls);
+        ASSERTV(X.size(), 0 == X.size());
+        ASSERTV(Y.size(), NUM_VALUES == Y.size());
+    }
+    ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+
+    if (veryVerbose) printf("\tTesting calls to the comparator.\n");
+    {
+        Obj mX(TestTypes::CachingHash(),
+               TestTypes::CountingEqual(),
+               1,
+               1000.0f,
+               &oa);
+        const Obj& X = mX;
+
+        ObjNoCache mY(bsl::hash<int>(),
+                      TestTypes::CountingEqual(),
+                      1,
+                      1000.0f,
+                      &oa);
+        const ObjNoCache& Y = mY;
+
+        for (int i = 0; i != NUM_VALUES; ++i) {
+            mX.insert(i);
+            mY.insert(i);
+        }
+        ASSERTV(X.numBuckets(), X.numBuckets() < X.size());
+
+        for (int i = 0; i != 2 * NUM_VALUES; ++i) {
+            const bool PRESENT = i < NUM_VALUES;
+
+            TestTypes::CountingEqual::s_numCalls = 0;
+            bslalg::BidirectionalLink *link = X.find(i);
+            ASSERTV(i, PRESENT == (0 != link));
+            ASSERTV(i, TestTypes::CountingEqual::s_numCalls,
+                    (PRESENT ? 1 : 0) == TestTypes::CountingEqual::s_numCalls);
+
+            bslalg::BidirectionalLink *expected = Y.find(i);
+            ASSERTV(i, PRESENT == (0 != expected));
+            if (link && expected) {
+                ASSERTV(i, bslalg::HashTableImpUtil::extractKey<
+                                            BasicKeyConfig<int> >(link) ==
+                           bslalg::HashTableImpUtil::extractKey<
+                                            BasicKeyConfig<int> >(expected));
+            }
+        }
+    }
+    ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+    ASSERTV(da.numBlocksTotal(), 0 == da.numBlocksTotal());
+}
+
+static
+void mainTestCase20()
+    // --------------------------------------------------------------------
+    // TESTING INCREMENTAL REHASH
+    //
+    // Concerns:
+    //: 1 Incremental rehash is disabled by default, and is enabled and
+    //:   disabled by 'setIncrementalRehash'.
+    //:
+    //: 2 An insertion exceeding the 'rehashThreshold' of a non-empty table
+    //:   that uses incremental rehash allocates the larger bucket array, and
+    //:   starts a rehash that every subsequent insertion advances by a
+    //:   bounded number of buckets, until the rehash ends.
+    //:
+    //: 3 While a rehash is in progress, every element can be found, and
+    //:   iterating over the list of elements visits each element exactly
+    //:   once.
+    //:
+    //: 4 Removing elements while a rehash is in progress does not change
+    //:   the iteration order of the remaining elements.
+    //:
+    //: 5 Elements having equivalent keys remain contiguous.
+    //:
+    //: 6 'completeRehash', 'setIncrementalRehash(false)', and
+    //:   'rehashForNumBuckets' end a rehash in progress, after which every
+    //:   element is indexed by the current bucket array.
+    //:
+    //: 7 Copying, swapping, and clearing a table during a rehash is
+    //:   supported, and no memory is leaked.
+    //
+    // Plan:
+    //: 1 Verify the initial value of 'incrementalRehash', and that the
+    //:   manipulator changes it.  (C-1)
+    //:
+    //: 2 Insert a sequence of keys into a table using incremental rehash.
+    //:   After each insertion, verify the progress of any rehash, that each
+    //:   key inserted is found, and that iterating over the list visits
+    //:   'size()' distinct elements.  (C-2..3)
+    //:
+    //: 3 During a rehash, erase every other element while iterating, and
+    //:   verify that the elements visited are those expected.  (C-4)
+    //:
+    //: 4 Insert a second copy of each key during a rehash, and verify that
+    //:   'findRange' yields two elements for each key.  (C-5)
+    //:
+    //: 5 End a rehash in each of the ways listed, and verify that the bucket
+    //:   element counts sum to 'size()'.  (C-6)
+    //:
+    //: 6 Copy, swap, and clear tables during a rehash, and verify their
+    //:   values and that the object allocator has no outstanding blocks once
+    //:   the tables are destroyed.  (C-7)
+    //
+    // Testing:
+    //   void completeRehash();
+    //   void setIncrementalRehash(bool incremental);
+    //   bool incrementalRehash() const;
+    //   bool isRehashInProgress() const;
+    //   SizeType numBucketsPendingRehash() const;
+    // --------------------------------------------------------------------
+{
+    if (verbose) printf("\nTESTING INCREMENTAL REHASH"
+                        "\n==========================\n");
+
+    typedef bslstl::HashTable<BasicKeyConfig<int>,
+                              bsl::hash<int>,
+                              bsl::equal_to<int>,
+                              bsl::allocator<int> > Obj;
+
+    typedef bslalg::BidirectionalLink Link;
+
+    bslma::TestAllocator         oa("object", veryVeryVeryVerbose);
+    bslma::TestAllocator         da("default", veryVeryVeryVerbose);
+    bslma::DefaultAllocatorGuard dag(&da);
+
+    const int NUM_VALUES = 300;
+
+    struct Local {
+        static Obj::SizeType sumOfBuckets(const Obj& table)
+            // Return the total number of elements in the buckets of the
+            // specified 'table'.
+        {
+            Obj::SizeType result = 0;
+            for (Obj::SizeType i = 0; i != table.numBuckets(); ++i) {
+                result += table.countElementsInBucket(i);
+            }
+            return result;
+        }
+
+        static Obj::SizeType listLength(const Obj& table)
+            // Return the number of elements in the list of the specified
+            // 'table'.
+        {
+            Obj::SizeType result = 0;
+            for (Link *cursor = table.elementListRoot();
+                 cursor;
+                 cursor = cursor->nextLink()) {
+                ++result;
+            }
+            return result;
+        }
+
+        static void startRehash(Obj *table)
+            // Insert the next unused key values into the specified 'table'
+            // until an incremental rehash is in progress.
+        {
+            int key = static_cast<int>(table->size());
+            while (!table->isRehashInProgress()) {
+                table->insert(key++);
+            }
+        }
+    };
+
+    if (veryVerbose) printf("\tTesting 'setIncrementalRehash'.\n");
+    {
+        Obj mX(&oa);  const Obj& X = mX;
+
+        ASSERT(false == X.incrementalRehash());
+        ASSERT(false == X.isRehashInProgress());
+        ASSERTV(X.numBucketsPendingRehash(), 0 == X.numBucketsPendingRehash());
+
+        mX.setIncrementalRehash(true);
+        ASSERT(true  == X.incrementalRehash());
+
+        mX.setIncrementalRehash(false);
+        ASSERT(false == X.incrementalRehash());
+
+        for (int i = 0; i != NUM_VALUES; ++i) {
+            mX.insert(i);
+            ASSERTV(i, false == X.isRehashInProgress());
+        }
+    }
+    ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+
+    if (veryVerbose) printf("\tTesting insertion during a rehash.\n");
+    {
+        Obj mX(bsl::hash<int>(), bsl::equal_to<int>(), 1, 1.0f, &oa);
+        const Obj& X = mX;
+        mX.setIncrementalRehash(true);
+
+        int numRehashes = 0;
+        for (int i = 0; i != NUM_VALUES; ++i) {
+            const bool          WAS_IN_PROGRESS = X.isRehashInProgress();
+            const Obj::SizeType PENDING         = X.numBucketsPendingRehash();
+            const Obj::SizeType NUM_BUCKETS     = X.numBuckets();
+
+            mX.insert(i);
+
+            if (X.numBuckets() != NUM_BUCKETS) {
+                // The bucket array grew, completing any rehash in progress
+                // and starting a new one, which this insertion advanced.
+
+                ++numRehashes;
+                ASSERTV(i, X.numBuckets() >= 2 * NUM_BUCKETS);
+                if (4 < NUM_BUCKETS) {
+                    ASSERTV(i, X.isRehashInProgress());
+                    ASSERTV(i, NUM_BUCKETS >= X.numBucketsPendingRehash());
+                    ASSERTV(i,
+                           NUM_BUCKETS - X.numBucketsPendingRehash() <= 4);
+                }
+            }
+            else if (WAS_IN_PROGRESS) {
+                ASSERTV(i, PENDING > X.numBucketsPendingRehash());
+                ASSERTV(i, PENDING - X.numBucketsPendingRehash() <= 4);
+            }
+
+            ASSERTV(i, X.isRehashInProgress() ==
+                                           (0 < X.numBucketsPendingRehash()));
+            ASSERTV(i, X.size() == Local::listLength(X));
+            for (int j = 0; j <= i; ++j) {
+                ASSERTV(i, j, X.find(j));
+            }
+            ASSERTV(i, !X.find(i + 1));
+        }
+        ASSERTV(numRehashes, 3 < numRehashes);
+    }
+    ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+
+    if (veryVerbose) printf("\tTesting removal during a rehash.\n");
+    {
+        Obj mX(&oa);  const Obj& X = mX;
+        mX.setIncrementalRehash(true);
+        Local::startRehash(&mX);
+
+        const Obj::SizeType SIZE = X.size();
+
+        int expected[NUM_VALUES];
+        int numExpected = 0;
+        int index       = 0;
+        for (Link *cursor = X.elementListRoot(); cursor; ++index) {
+            if (index % 2) {
+                expected[numExpected++] =
+                  bslalg::HashTableImpUtil::extractKey<BasicKeyConfig<int> >(
+                                                                       cursor);
+                cursor = cursor->nextLink();
+            }
+            else {
+                cursor = mX.remove(cursor);
+            }
+        }
+        ASSERTV(X.size(), SIZE / 2 == X.size());
+        ASSERT(X.isRehashInProgress());
+
+        index = 0;
+        for (Link *cursor = X.elementListRoot();
+             cursor;
+             cursor = cursor->nextLink(), ++index) {
+            ASSERTV(index, index < numExpected);
+            ASSERTV(index, expected[index] ==
+                  bslalg::HashTableImpUtil::extractKey<BasicKeyConfig<int> >(
+                                                                      cursor));
+            ASSERTV(index, cursor == X.find(expected[index]));
+        }
+        ASSERTV(index, numExpected == index);
+    }
+    ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+
+    if (veryVerbose) printf("\tTesting equivalent keys during a rehash.\n");
+    {
+        Obj mX(&oa);  const Obj& X = mX;
+        mX.setIncrementalRehash(true);
+        Local::startRehash(&mX);
+
+        const int NUM_KEYS = static_cast<int>(X.size());
+        for (int i = 0; i != NUM_KEYS; ++i) {
+            mX.insert(i);
+        }
+
+        for (int i = 0; i != NUM_KEYS; ++i) {
+            Link *first, *last;
+            X.findRange(&first, &last, i);
+            int count = 0;
+            for (Link *cursor = first;
+                 cursor != last;
+                 cursor = cursor->nextLink()) {
+                ++count;
+            }
+            ASSERTV(i, count, 2 == count);
+        }
+        mX.completeRehash();
+        ASSERTV(Local::sumOfBuckets(X), X.size() == Local::sumOfBuckets(X));
+    }
+    ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+
+    if (veryVerbose) printf("\tTesting ending a rehash.\n");
+    {
+        for (int ti = 0; ti != 3; ++ti) {
+            Obj mX(&oa);  const Obj& X = mX;
+            mX.setIncrementalRehash(true);
+            Local::startRehash(&mX);
+
+            ASSERTV(ti, Local::sumOfBuckets(X) < X.size());
+
+            switch (ti) {
+              case 0: mX.completeRehash();                      break;
+              case 1: mX.setIncrementalRehash(false);           break;
+              case 2: mX.rehashForNumBuckets(X.numBuckets() * 2); break;
+            }
+
+            ASSERTV(ti, false == X.isRehashInProgress());
+            ASSERTV(ti, 0 == X.numBucketsPendingRehash());
+            ASSERTV(ti, X.size() == Local::sumOfBuckets(X));
+
+            for (int i = 0; i != static_cast<int>(X.size()); ++i) {
+                ASSERTV(ti, i, X.find(i));
+            }
+        }
+    }
+    ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+
+    if (veryVerbose) printf("\tTesting with cached hash codes.\n");
+    {
+        typedef bslstl::HashTable<BasicKeyConfig<int>,
+                                  TestTypes::CachingHash,
+                                  bsl::equal_to<int>,
+                                  bsl::allocator<int> > CObj;
+
+        CObj mX(&oa);  const CObj& X = mX;
+        mX.setIncrementalRehash(true);
+
+        int key = 0;
+        while (!X.isRehashInProgress()) {
+            mX.insert(key++);
+        }
+
+        // Migrating an element uses its stored hash code.
+
+        TestTypes::CachingHash::s_numCalls = 0;
+        mX.completeRehash();
+        ASSERTV(TestTypes::CachingHash::s_numCalls,
+                0 == TestTypes::CachingHash::s_numCalls);
+
+        for (int i = 0; i != key; ++i) {
+            ASSERTV(i, X.find(i));
+        }
+    }
+    ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+
+    if (veryVerbose) printf("\tTesting copy, swap, and clear.\n");
+    {
+        Obj mX(&oa);  const Obj& X = mX;
+        mX.setIncrementalRehash(true);
+        Local::startRehash(&mX);
+
+        Obj mY(X, &oa);  const Obj& Y = mY;
+        ASSERT(X == Y);
+        ASSERT(true  == Y.incrementalRehash());
+        ASSERT(false == Y.isRehashInProgress());
+
+        Obj mZ(&oa);  const Obj& Z = mZ;
+        mZ.insert(-1);
+        mZ.swap(mX);
+        ASSERT(Z == Y);
+        ASSERT(true  == Z.isRehashInProgress());
+        ASSERT(false == X.isRehashInProgress());
+        ASSERT(1     == X.size());
+        ASSERT(X.find(-1));
+
+        mZ.removeAll();
+        ASSERT(false == Z.isRehashInProgress());
+        ASSERT(0     == Z.size());
+        ASSERT(0     == Z.elementListRoot());
+
+        for (int i = 0; i != NUM_VALUES; ++i) {
+            mZ.insert(i);
+        }
+        ASSERTV(Z.size(), NUM_VALUES == Z.size());
+
+        mY.insert(NUM_VALUES);
+        Local::startRehash(&mY);
+        ASSERT(Y.isRehashInProgress());
+    }
+    ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+    ASSERTV(da.numBlocksTotal(), 0 == da.numBlocksTotal());
+}
+
+static
+void mainTestCase21()
+    // --------------------------------------------------------------------
+    // TESTING 'statistics'
+    //
+    // Concerns:
+    //: 1 The statistics of an empty table describe the single default
+    //:   bucket, and report no memory in use.
+    //:
+    //: 2 The occupancy histogram, the maximum and mean chain lengths, and
+    //:   the number of empty buckets agree with the counts of elements in
+    //:   each bucket, for both a well-distributed and a degenerate hasher.
+    //:
+    //: 3 The number of bytes reported for nodes and bucket arrays is the
+    //:   size of a node times the number of elements, and the size of a
+    //:   bucket times the number of buckets (of both bucket arrays while an
+    //:   incremental rehash is in progress).
+    //:
+    //: 4 The number of rehashes is incremented each time the bucket array is
+    //:   replaced, whether by an insertion, by 'rehashForNumBuckets', or by
+    //:   the start of an incremental rehash, and is not incremented
+    //:   otherwise.  A copy of a table starts with no rehashes, and swapping
+    //:   two tables exchanges their numbers of rehashes.
+    //
+    // Plan:
+    //: 1 Verify the statistics of a default-constructed table.  (C-1)
+    //:
+    //: 2 Insert keys into a table using 'bsl::hash<int>', and into a table
+    //:   using a hasher returning the same value for every key, and after
+    //:   each insertion compare the statistics with values computed using
+    //:   'countElementsInBucket'.  (C-2..3)
+    //:
+    //: 3 Verify that the number of rehashes is incremented when, and only
+    //:   when, the number of buckets changes, and check its value for a
+    //:   copy, after swapping, and during an incremental rehash.  (C-3..4)
+    //
+    // Testing:
+    //   HashTableStatistics statistics() const;
+    // --------------------------------------------------------------------
+{
+    if (verbose) printf("\nTESTING 'statistics'"
+                        "\n====================\n");
+
+    typedef bslstl::HashTable<BasicKeyConfig<int>,
+                              bsl::hash<int>,
+                              bsl::equal_to<int>,
+                              bsl::allocator<int> > Obj;
+
+    typedef bslstl::HashTable<BasicKeyConfig<int>,
+                              TestTypes::ConstantHash,
+                              bsl::equal_to<int>,
+                              bsl::allocator<int> > ConstantObj;
+
+    typedef bslstl::HashTableStatistics Stats;
+
+    const int NUM_BINS   = Stats::k_NUM_HISTOGRAM_BINS;
+    const int NUM_VALUES = 100;
+
+#if defined(BSLSTL_HASHTABLE_DISABLE_STATISTICS)
+    const bool COUNTS_REHASHES = false;
+#else
+    const bool COUNTS_REHASHES = true;
+#endif
+
+    bslma::TestAllocator         oa("object", veryVeryVeryVerbose);
+    bslma::TestAllocator         da("default", veryVeryVeryVerbose);
+    bslma::DefaultAllocatorGuard dag(&da);
+
+    if (veryVerbose) printf("\tTesting an empty table.\n");
+    {
+        const Obj X(&oa);
+
+        const Stats S = X.statistics();
+        ASSERTV(S.d_numElements,      0   == S.d_numElements);
+        ASSERTV(S.d_numBuckets,       1   == S.d_numBuckets);
+        ASSERTV(S.d_numEmptyBuckets,  1   == S.d_numEmptyBuckets);
+        ASSERTV(S.d_maxChainLength,   0   == S.d_maxChainLength);
+        ASSERTV(S.d_meanChainLength,  0.0 == S.d_meanChainLength);
+        ASSERTV(S.d_emptyBucketRatio, 1.0 == S.d_emptyBucketRatio);
+        ASSERTV(S.d_nodeBytes,        0   == S.d_nodeBytes);
+        ASSERTV(S.d_bucketArrayBytes, 0   == S.d_bucketArrayBytes);
+        ASSERTV(S.d_numRehashes,      0   == S.d_numRehashes);
+
+        ASSERTV(S.d_occupancyHistogram[0], 1 == S.d_occupancyHistogram[0]);
+        for (int i = 1; i != NUM_BINS; ++i) {
+            ASSERTV(i, S.d_occupancyHistogram[i],
+                    0 == S.d_occupancyHistogram[i]);
+        }
+    }
+
+    if (veryVerbose) printf("\tTesting occupancy and memory use.\n");
+    for (int useConstantHash = 0; useConstantHash != 2; ++useConstantHash) {
+        Obj         mX(&oa);  const Obj&         X = mX;
+        ConstantObj mY(&oa);  const ConstantObj& Y = mY;
+
+        for (int key = 0; key != NUM_VALUES; ++key) {
+            size_t numBuckets;
+            Stats  S;
+            if (useConstantHash) {
+                mY.insert(key);
+                numBuckets = Y.numBuckets();
+                S = Y.statistics();
+            }
+            else {
+                mX.insert(key);
+                numBuckets = X.numBuckets();
+                S = X.statistics();
+            }
+
+            size_t histogram[NUM_BINS] = { 0 };
+            size_t numEmpty            = 0;
+            size_t maxLength           = 0;
+            size_t total               = 0;
+            for (size_t i = 0; i != numBuckets; ++i) {
+                const size_t length = useConstantHash
+                                    ? Y.countElementsInBucket(i)
+                                    : X.countElementsInBucket(i);
+                ++histogram[length < NUM_BINS ? length : NUM_BINS - 1];
+                numEmpty  += 0 == length;
+                maxLength  = length < maxLength ? maxLength : length;
+                total     += length;
+            }
+
+            const size_t SIZE = key + 1;
+            ASSERTV(key, S.d_numElements, SIZE == S.d_numElements);
+            ASSERTV(key, SIZE == total);
+            ASSERTV(key, S.d_numBuckets, numBuckets == S.d_numBuckets);
+            ASSERTV(key, S.d_numEmptyBuckets, numEmpty == S.d_numEmptyBuckets);
+            ASSERTV(key, S.d_maxChainLength, maxLength == S.d_maxChainLength);
+            ASSERTV(key, S.d_meanChainLength,
+                    static_cast<double>(SIZE) / (numBuckets - numEmpty)
+                                                       == S.d_meanChainLength);
+            ASSERTV(key, S.d_emptyBucketRatio,
+                    static_cast<double>(numEmpty) / numBuckets
+                                                      == S.d_emptyBucketRatio);
+            for (int i = 0; i != NUM_BINS; ++i) {
+                ASSERTV(key, i, S.d_occupancyHistogram[i],
+                        histogram[i] == S.d_occupancyHistogram[i]);
+            }
+
+            ASSERTV(key, S.d_nodeBytes,
+                    SIZE * sizeof(Obj::NodeType) == S.d_nodeBytes);
+            ASSERTV(key, S.d_bucketArrayBytes,
+                    numBuckets * sizeof(bslalg::HashTableBucket)
+                                                      == S.d_bucketArrayBytes);
+
+            if (useConstantHash) {
+                ASSERTV(key, S.d_maxChainLength, SIZE == S.d_maxChainLength);
+                ASSERTV(key, S.d_meanChainLength,
+                        static_cast<double>(SIZE) == S.d_meanChainLength);
+                ASSERTV(key, numEmpty, numBuckets - 1 == numEmpty);
+            }
+            else {
+                // 'bsl::hash<int>' is the identity, so each key has its own
+                // bucket until there are more keys than buckets.
+
+                ASSERTV(key, S.d_maxChainLength, 1 == S.d_maxChainLength);
+                ASSERTV(key, S.d_occupancyHistogram[1],
+                        SIZE == S.d_occupancyHistogram[1]);
+            }
+        }
+    }
+    ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+
+    if (veryVerbose) printf("\tTesting the number of rehashes.\n");
+    {
+        Obj mX(&oa);  const Obj& X = mX;
+
+        size_t numRehashes = 0;
+        for (int key = 0; key != NUM_VALUES; ++key) {
+            const Obj::SizeType numBuckets = X.numBuckets();
+            mX.insert(key);
+            if (numBuckets != X.numBuckets()) {
+                ++numRehashes;
+            }
+            ASSERTV(key, X.statistics().d_numRehashes,
+                    (COUNTS_REHASHES ? numRehashes : 0) ==
+                                                X.statistics().d_numRehashes);
+        }
+        ASSERT(0 < numRehashes);
+
+        mX.rehashForNumBuckets(X.numBuckets());
+        ASSERTV(X.statistics().d_numRehashes,
+                (COUNTS_REHASHES ? numRehashes : 0) ==
+                                                X.statistics().d_numRehashes);
+
+        mX.rehashForNumBuckets(X.numBuckets() * 4);
+        ++numRehashes;
+        ASSERTV(X.statistics().d_numRehashes,
+                (COUNTS_REHASHES ? numRehashes : 0) ==
+                                                X.statistics().d_numRehashes);
+
+        mX.removeAll();
+        ASSERTV(X.statistics().d_numRehashes,
+                (COUNTS_REHASHES ? numRehashes : 0) ==
+                                                X.statistics().d_numRehashes);
+
+        mX.insert(0);
+        Obj mY(X, &oa);  const Obj& Y = mY;
+        ASSERTV(Y.statistics().d_numRehashes,
+                0 == Y.statistics().d_numRehashes);
+
+        mX.swap(mY);
+        ASSERTV(X.statistics().d_numRehashes,
+                0 == X.statistics().d_numRehashes);
+        ASSERTV(Y.statistics().d_numRehashes,
+                (COUNTS_REHASHES ? numRehashes : 0) ==
+                                                Y.statistics().d_numRehashes);
+    }
+    ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+
+    if (veryVerbose) printf("\tTesting during an incremental rehash.\n");
+    {
+        Obj mX(&oa);  const Obj& X = mX;
+        mX.setIncrementalRehash(true);
+
+        // An incremental rehash of a small bucket array may be completed by
+        // the insertion that starts it, so count every change in the number
+        // of buckets.
+
+        int    key           = 0;
+        size_t numRehashes   = 0;
+        size_t numOldBuckets = X.numBuckets();
+        while (!X.isRehashInProgress()) {
+            numOldBuckets = X.numBuckets();
+            mX.insert(key++);
+            if (numOldBuckets != X.numBuckets()) {
+                ++numRehashes;
+            }
+        }
+
+        const Stats S = X.statistics();
+        ASSERTV(S.d_numElements, X.size() == S.d_numElements);
+        ASSERTV(S.d_numBuckets,  X.numBuckets() == S.d_numBuckets);
+        ASSERTV(S.d_bucketArrayBytes,
+                (X.numBuckets() + numOldBuckets)
+                       * sizeof(bslalg::HashTableBucket) ==
+                                                        S.d_bucketArrayBytes);
+        ASSERTV(S.d_numRehashes,
+                (COUNTS_REHASHES ? numRehashes : 0) == S.d_numRehashes);
+
+        mX.completeRehash();
+        ASSERTV(X.statistics().d_bucketArrayBytes,
+                X.numBuckets() * sizeof(bslalg::HashTableBucket) ==
+                                            X.statistics().d_bucketArrayBytes);
+        ASSERTV(X.statistics().d_numRehashes,
+                S.d_numRehashes == X.statistics().d_numRehashes);
+    }
+    ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+    ASSERTV(da.numBlocksTotal(), 0 == da.numBlocksTotal());
+}
+
+static
+void mainTestCase22()
+    // --------------------------------------------------------------------
+    // TESTING NODE HANDLES
+    //
+    // Concerns:
+    //: 1 'extractNode' moves the element of a node into a handle, and
+    //:   removes the node from the table, leaving the table consistent,
+    //:   including while an incremental rehash is in progress.
+    //:
+    //: 2 'insertNode' inserts the element held by a handle immediately
+    //:   before 'hint' if 'hint' has the same key, and before the first
+    //:   element having the same key otherwise, and empties the handle.
+    //:
+    //: 3 Re-inserting extracted elements into a table using the same
+    //:   allocator allocates no memory.
+    //:
+    //: 4 'insertNodeIfMissing' leaves the handle unchanged, and returns the
+    //:   existing element, if an element having the same key is present.
+    //:
+    //: 5 'mergeIfMissing' moves the elements whose key is not present, and
+    //:   'merge' moves every element, from a table using the same or
+    //:   another allocator; merging a table with itself has no effect.
+    //:
+    //: 6 No memory is leaked, and the default allocator is not used.
+    //
+    // Plan:
+    //: 1 For tables with and without incremental rehash, extract one of two
+    //:   elements having each key, verifying the size, the length of the
+    //:   list of elements, the node held by the handle, and that the other
+    //:   element is still found, and then re-insert each element with and
+    //:   without a hint, verifying the position of the inserted element,
+    //:   and monitoring the allocations of the object allocator.  (C-1..3)
+    //:
+    //: 2 Insert a handle into a table with 'insertNodeIfMissing' before and
+    //:   after the key is removed from the table.  (C-4)
+    //:
+    //: 3 Merge tables having overlapping keys, and verify the sizes of the
+    //:   tables and the number of elements having each key.  (C-5)
+    //:
+    //: 4 Verify that no memory is in use by the object allocators at the
+    //:   end of the test, and that no memory was allocated by the default
+    //:   allocator.  (C-6)
+    //
+    // Testing:
+    //   void extractNode(NodeHandleType *result, BidirectionalLink *node);
+    //   BidirectionalLink *insertNode(NodeHandleType *, BidirectionalLink *);
+    //   BidirectionalLink *insertNodeIfMissing(bool *, NodeHandleType *);
+    //   void merge(HashTable *source);
+    //   void mergeIfMissing(HashTable *source);
+    // --------------------------------------------------------------------
+{
+    if (verbose) printf("\nTESTING NODE HANDLES"
+                        "\n====================\n");
+
+    typedef bslstl::HashTable<BasicKeyConfig<int>,
+                              bsl::hash<int>,
+                              bsl::equal_to<int>,
+                              bsl::allocator<int> > Obj;
+
+    typedef Obj::NodeHandleType       Handle;
+    typedef bslalg::BidirectionalLink Link;
+
+    const int NUM_VALUES = 100;
+
+    bslma::TestAllocator         oa("object",  veryVeryVeryVerbose);
+    bslma::TestAllocator         za("other",   veryVeryVeryVerbose);
+    bslma::TestAllocator         da("default", veryVeryVeryVerbose);
+    bslma::DefaultAllocatorGuard dag(&da);
+
+    struct Local {
+        static int keyOf(const Link *node)
+            // Return the key of the element of the specified 'node'.
+        {
+            return static_cast<const Obj::NodeType *>(node)->value();
+        }
+
+        static Obj::SizeType listLength(const Obj& table)
+            // Return the number of elements in the list of the specified
+            // 'table'.
+        {
+            Obj::SizeType result = 0;
+            for (Link *cursor = table.elementListRoot();
+                 cursor;
+                 cursor = cursor->nextLink()) {
+                ++result;
+            }
+            return result;
+        }
+
+        static Obj::SizeType count(const Obj& table, int key)
+            // Return the number of elements having the specified 'key' in
+            // the specified 'table'.
+        {
+            Link *first;
+            Link *last;
+            table.findRange(&first, &last, key);
+
+            Obj::SizeType result = 0;
+            for (; first != last; first = first->nextLink()) {
+                ++result;
+            }
+            return result;
+        }
+    };
+
+    if (veryVerbose) printf("\tTesting 'extractNode' and 'insertNode'.\n");
+    for (int incremental = 0; incremental != 2; ++incremental) {
+        Obj mX(&oa);  const Obj& X = mX;
+        mX.setIncrementalRehash(incremental);
+
+        for (int key = 0; key != NUM_VALUES; ++key) {
+            mX.insert(key);
+            mX.insert(key);
+        }
+        int nextKey = NUM_VALUES;
+        while (incremental && !X.isRehashInProgress()) {
+            mX.insert(nextKey++);
+        }
+        const Obj::SizeType SIZE = X.size();
+
+        Handle handles[NUM_VALUES];
+        for (int key = 0; key != NUM_VALUES; ++key) {
+            mX.extractNode(&handles[key], X.find(key));
+            ASSERTV(incremental, key, !handles[key].empty());
+            ASSERTV(incremental, key, key == handles[key].value());
+            ASSERTV(incremental, key, X.size() == SIZE - key - 1);
+            ASSERTV(incremental, key,
+                    Local::listLength(X) == X.size());
+            ASSERTV(incremental, key, 1 == Local::count(X, key));
+        }
+
+        bslma::TestAllocatorMonitor oam(&oa);
+
+        for (int key = 0; key != NUM_VALUES; ++key) {
+            Link *hint   = key % 2 ? X.find(key) : 0;
+            Link *result = mX.insertNode(&handles[key], hint);
+            ASSERTV(incremental, key, handles[key].empty());
+            ASSERTV(incremental, key, key == Local::keyOf(result));
+            ASSERTV(incremental, key, 2 == Local::count(X, key));
+            if (hint) {
+                ASSERTV(incremental, key, hint == result->nextLink());
+            }
+            else {
+                ASSERTV(incremental, key, result == X.find(key));
+            }
+        }
+        ASSERTV(incremental, X.size(), SIZE == X.size());
+        ASSERTV(incremental, Local::listLength(X) == X.size());
+        ASSERTV(incremental, oam.isTotalSame());
+
+        Handle mE;
+        mX.extractNode(&mE, X.find(0));
+        mX.extractNode(&mE, X.find(0));
+        ASSERTV(incremental, 0 == mE.value());
+        ASSERTV(incremental, 0 == X.find(0));
+        ASSERTV(incremental, X.size(), SIZE - 2 == X.size());
+    }
+    ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+
+    if (veryVerbose) printf("\tTesting 'insertNodeIfMissing'.\n");
+    {
+        Obj mX(&oa);  const Obj& X = mX;
+        Obj mY(&oa);  const Obj& Y = mY;
+
+        for (int key = 0; key != NUM_VALUES; ++key) {
+            mX.insert(key);
+            mY.insert(key);
+        }
+
+        Handle mH;  const Handle& H = mH;
+        mX.extractNode(&mH, X.find(0));
+
+        bool  isInsertedFlag = true;
+        Link *result = mY.insertNodeIfMissing(&isInsertedFlag, &mH);
+        ASSERT(!isInsertedFlag);
+        ASSERT(result == Y.find(0));
+        ASSERT(!H.empty());
+        ASSERTV(Y.size(), NUM_VALUES == Y.size());
+
+        Handle mG;  const Handle& G = mG;
+        mY.extractNode(&mG, Y.find(0));
+
+        result = mY.insertNodeIfMissing(&isInsertedFlag, &mH);
+        ASSERT(isInsertedFlag);
+        ASSERT(result == Y.find(0));
+        ASSERT(H.empty());
+        ASSERT(!G.empty());
+        ASSERTV(Y.size(), NUM_VALUES == Y.size());
+    }
+    ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+
+    if (veryVerbose) printf("\tTesting 'merge' and 'mergeIfMissing'.\n");
+    for (int incremental = 0; incremental != 2; ++incremental) {
+        Obj mX(&oa);  const Obj& X = mX;
+        Obj mZ(&za);  const Obj& Z = mZ;
+        mX.setIncrementalRehash(incremental);
+
+        {
+            Obj mY(&oa);
+
+            for (int key = 0; key != NUM_VALUES; ++key) {
+                mY.insert(key);
+                mZ.insert(key + NUM_VALUES / 2);
+            }
+
+            mX.merge(&mY);
+            ASSERTV(incremental, 0 == mY.size());
+        }
+        ASSERTV(incremental, X.size(), NUM_VALUES == X.size());
+        ASSERTV(incremental, Local::listLength(X) == X.size());
+        for (int key = 0; key != NUM_VALUES; ++key) {
+            ASSERTV(incremental, key, 1 == Local::count(X, key));
+        }
+
+        mX.mergeIfMissing(&mX);
+        mX.merge(&mX);
+        ASSERTV(incremental, X.size(), NUM_VALUES == X.size());
+
+        mX.mergeIfMissing(&mZ);
+        ASSERTV(incremental, X.size(), NUM_VALUES * 3 / 2 == X.size());
+        ASSERTV(incremental, Z.size(), NUM_VALUES / 2 == Z.size());
+        ASSERTV(incremental, Local::listLength(X) == X.size());
+        ASSERTV(incremental, Local::listLength(Z) == Z.size());
+        for (int key = 0; key != NUM_VALUES * 3 / 2; ++key) {
+            ASSERTV(incremental, key, 1 == Local::count(X, key));
+            ASSERTV(incremental, key,
+                    (key >= NUM_VALUES / 2 && key < NUM_VALUES) ==
+                                                            !!Z.find(key));
+        }
+
+        mX.merge(&mZ);
+        ASSERTV(incremental, X.size(), NUM_VALUES * 2 == X.size());
+        ASSERTV(incremental, Z.size(), 0 == Z.size());
+        ASSERTV(incremental, 0 == Z.elementListRoot());
+        ASSERTV(incremental, Local::listLength(X) == X.size());
+        for (int key = 0; key != NUM_VALUES * 3 / 2; ++key) {
+            ASSERTV(incremental, key,
+                    (key >= NUM_VALUES / 2 && key < NUM_VALUES ? 2 : 1) ==
+                                                     Local::count(X, key));
+        }
+    }
+    ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+    ASSERTV(za.numBlocksInUse(), 0 == za.numBlocksInUse());
+    ASSERTV(da.numBlocksTotal(), 0 == da.numBlocksTotal());
+}
+
+static
+void mainTestCase23()
+    // --------------------------------------------------------------------
+    // TESTING PRECOMPUTED HASH CODES
+    //
+    // Concerns:
+    //: 1 'insertIfMissingWithHashCode', 'findWithHashCode', and
+    //:   'removeWithHashCode' behave as 'insertIfMissing', 'find', and
+    //:   'remove' respectively when supplied the value that 'hasher' returns
+    //:   for the key.
+    //:
+    //: 2 The supplied hash code is adjusted as the table adjusts the codes it
+    //:   computes itself, so that elements inserted by either method are
+    //:   found by both, including for a hasher associated with the
+    //:   'UsesPowerOfTwoBuckets' trait.
+    //:
+    //: 3 None of the methods invokes the 'hasher'.
+    //
+    // Plan:
+    //: 1 For a table using 'PowerOfTwoHash', insert a sequence of keys using
+    //:   'insertIfMissingWithHashCode', each twice, and verify the returned
+    //:   flags and nodes, and that 'find' and 'findWithHashCode' locate every
+    //:   key.  Remove half of the keys using 'removeWithHashCode', and verify
+    //:   the remaining contents of the table.  (C-1..2)
+    //:
+    //: 2 Repeat P-1 for a table using 'CachingHash' (whose nodes store hash
+    //:   codes, so that growing the table does not invoke the 'hasher'),
+    //:   verifying that the 'hasher' is not called.  (C-3)
+    //
+    // Testing:
+    //   BidirectionalLink *insertIfMissingWithHashCode(bool *, VALUE, size_t);
+    //   BidirectionalLink *removeWithHashCode(BidirectionalLink *, size_t);
+    //   BidirectionalLink *findWithHashCode(const KeyType&, size_t) const;
+    // --------------------------------------------------------------------
+{
+    if (verbose) printf("\nTESTING PRECOMPUTED HASH CODES"
+                        "\n==============================\n");
+
+    bslma::TestAllocator         oa("object", veryVeryVeryVerbose);
+    bslma::TestAllocator         da("default", veryVeryVeryVerbose);
+    bslma::DefaultAllocatorGuard dag(&da);
+
+    const int NUM_VALUES = 300;
+
+    if (veryVerbose) printf("\tTesting a power-of-two table.\n");
+    {
+        typedef bslstl::HashTable<BasicKeyConfig<int>,
+                                  TestTypes::PowerOfTwoHash,
+                                  bsl::equal_to<int>,
+                                  bsl::allocator<int> > Obj;
+
+        Obj mX(TestTypes::PowerOfTwoHash(), bsl::equal_to<int>(), 0, 1.0f,
+               &oa);
+        const Obj& X = mX;
+
+        for (int i = 0; i != NUM_VALUES; ++i) {
+            const size_t HASH = X.hasher()(i);
+
+            bool                       isInserted = false;
+            bslalg::BidirectionalLink *link =
+                                 mX.insertIfMissingWithHashCode(&isInserted,
+                                                                i,
+                                                                HASH);
+            ASSERTV(i, isInserted);
+            ASSERTV(i, link == X.find(i));
+
+            bslalg::BidirectionalLink *again =
+                                 mX.insertIfMissingWithHashCode(&isInserted,
+                                                                i,
+                                                                HASH);
+            ASSERTV(i, !isInserted);
+            ASSERTV(i, link == again);
+            ASSERTV(i, link == X.findWithHashCode(i, HASH));
+        }
+        ASSERTV(X.size(), NUM_VALUES == static_cast<int>(X.size()));
+        ASSERTV(X.numBuckets(), 0 == (X.numBuckets() & (X.numBuckets() - 1)));
+
+        for (int i = 0; i < NUM_VALUES; i += 2) {
+            const size_t HASH = X.hasher()(i);
+
+            bslalg::BidirectionalLink *link = X.findWithHashCode(i, HASH);
+            ASSERTV(i, link);
+            ASSERTV(i, link->nextLink() == mX.removeWithHashCode(link, HASH));
+        }
+        ASSERTV(X.size(), NUM_VALUES / 2 == static_cast<int>(X.size()));
+
+        for (int i = 0; i != NUM_VALUES; ++i) {
+            ASSERTV(i, (i % 2) == !!X.find(i));
+            ASSERTV(i, (i % 2) == !!X.findWithHashCode(i, X.hasher()(i)));
+        }
+    }
+    ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+
+    if (veryVerbose) printf("\tTesting calls to the hasher.\n");
+    {
+        typedef bslstl::HashTable<BasicKeyConfig<int>,
+                                  TestTypes::CachingHash,
+                                  bsl::equal_to<int>,
+                                  bsl::allocator<int> > Obj;
+
+        Obj mX(TestTypes::CachingHash(), bsl::equal_to<int>(), 0, 1.0f, &oa);
+        const Obj& X = mX;
+
+        TestTypes::CachingHash::s_numCalls = 0;
+        for (int i = 0; i != NUM_VALUES; ++i) {
+            const size_t HASH = bsl::hash<int>()(i);
+
+            bool isInserted = false;
+            mX.insertIfMissingWithHashCode(&isInserted, i, HASH);
+            ASSERTV(i, isInserted);
+            ASSERTV(i, X.findWithHashCode(i, HASH));
+        }
+        for (int i = 0; i < NUM_VALUES; i += 2) {
+            const size_t HASH = bsl::hash<int>()(i);
+
+            mX.removeWithHashCode(X.findWithHashCode(i, HASH), HASH);
+        }
+        ASSERTV(TestTypes::CachingHash::s_numCalls,
+                0 == TestTypes::CachingHash::s_numCalls);
+
+        ASSERTV(X.size(), NUM_VALUES / 2 == static_cast<int>(X.size()));
+        for (int i = 0; i != NUM_VALUES; ++i) {
+            ASSERTV(i, (i % 2) == !!X.find(i));
+        }
+    }
+    ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+    ASSERTV(da.numBlocksTotal(), 0 == da.numBlocksTotal());
+}
+
 #if 0  // Planned test cases, not yet implemented
 static
 void mainTestCase15()
@@ -11287,9 +13232,15 @@ int main(int argc, char *argv[])
 #pragma bde_verify -TP05  // Test doc is in delegated functions
 #pragma bde_verify -TP17  // No test-banners in a delegating switch statement
     switch (test) { case 0:
-      case 16: mainTestCaseUsageExample(); break;
-//      case 17: mainTestCase17(); break;
-//      case 16: mainTestCase16(); break;
+      case 24: mainTestCaseUsageExample(); break;
+      case 23: mainTestCase23(); break;
+      case 22: mainTestCase22(); break;
+      case 21: mainTestCase21(); break;
+      case 20: mainTestCase20(); break;
+      case 19: mainTestCase19(); break;
+      case 18: mainTestCase18(); break;
+      case 17: mainTestCase17(); break;
+      case 16: mainTestCase16(); break;
       case 15: mainTestCase15(); break;
       case 14: mainTestCase14(); break;
       case 13: mainTestCase13(); break;
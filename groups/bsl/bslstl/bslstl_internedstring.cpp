@@ -0,0 +1,161 @@
+// bslstl_internedstring.cpp                                          -*-C++-*-
+#include <bslstl_internedstring.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id$ $CSID$")
+
+#include <bslh_hash.h>
+#include <bslma_default.h>
+
+#include <cstring>
+#include <new>
+
+namespace BloombergLP {
+namespace bslstl {
+
+                        // ------------------------
+                        // class InternedStringPool
+                        // ------------------------
+
+// PRIVATE MANIPULATORS
+void InternedStringPool::remove(Rep *rep)
+{
+    BSLS_ASSERT(0 == rep->d_refCount.loadRelaxed());
+
+    {
+        bsls::BslLockGuard guard(&d_lock);
+
+        // Note that a new copy having the same value may have been added to
+        // the head of the chain since the reference count reached 0, so the
+        // chain is searched by address.
+
+        Rep **link = &d_buckets[rep->d_hash & (d_buckets.size() - 1)];
+        while (*link != rep) {
+            BSLS_ASSERT(*link);
+
+            link = &(*link)->d_next_p;
+        }
+        *link = rep->d_next_p;
+        --d_numStrings;
+    }
+
+    rep->~Rep();
+    d_allocator_p->deallocate(rep);
+}
+
+void InternedStringPool::rehash(native_std::size_t numBuckets)
+{
+    BSLS_ASSERT(0 == (numBuckets & (numBuckets - 1)));
+
+    bsl::vector<Rep *> buckets(numBuckets, 0, d_allocator_p);
+
+    for (native_std::size_t i = 0; i < d_buckets.size(); ++i) {
+        Rep *rep = d_buckets[i];
+        while (rep) {
+            Rep *next = rep->d_next_p;
+
+            Rep **head     = &buckets[rep->d_hash & (numBuckets - 1)];
+            rep->d_next_p  = *head;
+            *head          = rep;
+
+            rep = next;
+        }
+    }
+    d_buckets.swap(buckets);
+}
+
+// CREATORS
+InternedStringPool::InternedStringPool(bslma::Allocator *basicAllocator)
+: d_buckets(bslma::Default::allocator(basicAllocator))
+, d_numStrings(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+}
+
+InternedStringPool::~InternedStringPool()
+{
+    BSLS_ASSERT(0 == d_numStrings);
+}
+
+// MANIPULATORS
+InternedString InternedStringPool::intern(const StringRef& string)
+{
+    if (string.isEmpty()) {
+        return InternedString();                                      // RETURN
+    }
+
+    const native_std::size_t hash   = bslh::Hash<>()(string);
+    const native_std::size_t length = string.length();
+
+    bsls::BslLockGuard guard(&d_lock);
+
+    if (!d_buckets.empty()) {
+        for (Rep *rep = d_buckets[hash & (d_buckets.size() - 1)];
+             rep;
+             rep = rep->d_next_p) {
+            if (rep->d_hash   != hash
+             || rep->d_length != length
+             || 0 != native_std::memcmp(rep->d_data, string.data(), length)) {
+                continue;
+            }
+
+            // A copy whose reference count has reached 0 is being removed by
+            // the thread that released it, and must not be revived.
+
+            int count = rep->d_refCount.loadRelaxed();
+            while (0 < count) {
+                const int previous = rep->d_refCount.testAndSwap(count,
+                                                                 count + 1);
+                if (previous == count) {
+                    return InternedString(rep);                       // RETURN
+                }
+                count = previous;
+            }
+        }
+    }
+
+    if (d_numStrings >= d_buckets.size()) {
+        rehash(d_buckets.empty() ? 16 : 2 * d_buckets.size());
+    }
+
+    Rep *rep = new (d_allocator_p->allocate(sizeof(Rep) + length)) Rep;
+
+    rep->d_refCount.storeRelaxed(1);
+    rep->d_pool_p = this;
+    rep->d_hash   = hash;
+    rep->d_length = length;
+    native_std::memcpy(rep->d_data, string.data(), length);
+    rep->d_data[length] = 0;
+
+    Rep **head    = &d_buckets[hash & (d_buckets.size() - 1)];
+    rep->d_next_p = *head;
+    *head         = rep;
+    ++d_numStrings;
+
+    return InternedString(rep);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
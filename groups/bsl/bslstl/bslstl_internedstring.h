@@ -0,0 +1,599 @@
+// bslstl_internedstring.h                                            -*-C++-*-
+#ifndef INCLUDED_BSLSTL_INTERNEDSTRING
+#define INCLUDED_BSLSTL_INTERNEDSTRING
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a pointer-sized handle to a pooled, immutable string.
+//
+//@CLASSES:
+//  bslstl::InternedString: reference-counted handle to an interned string
+//  bslstl::InternedStringPool: thread-safe pool of unique interned strings
+//
+//@SEE_ALSO: bslstl_stringref, bslstl_string
+//
+//@DESCRIPTION: This component provides a mechanism,
+// 'bslstl::InternedStringPool', that stores a single, immutable copy of each
+// distinct string value given to it ("interning"), and a value-semantic
+// handle, 'bslstl::InternedString', through which such a copy is referred to.
+//
+// Programs that hold very many copies of strings drawn from a small
+// vocabulary (ticker symbols, exchange codes, field names) pay for an
+// allocation and a copy of the characters for each 'bsl::string', and for a
+// character-by-character comparison and a hash of every character whenever
+// such a string is looked up.  An 'InternedString' is the size of a pointer;
+// copying it increments a reference count instead of allocating, and, as two
+// handles obtained from the same pool have the same value if and only if they
+// refer to the same copy, equality comparison compares addresses.  The hash
+// value of the string is computed once, when it is interned, so that hashing
+// an 'InternedString' also takes constant time.
+//
+// The characters of an interned string are null-terminated, and are
+// available as a 'bslstl::StringRef' without copying.  The hash value
+// returned by 'InternedString::hash' (and by 'bsl::hash<InternedString>') is
+// the value 'bsl::hash<bsl::string>' returns for a string having the same
+// characters.
+//
+// A pooled copy is released when the last 'InternedString' referring to it
+// is destroyed, so that the memory used by a pool is proportional to the
+// number of distinct values in use.  The empty string is never pooled: a
+// default-constructed 'InternedString' represents it, and interning an empty
+// string returns such a handle without accessing the pool.
+//
+///Thread Safety
+///-------------
+// 'InternedStringPool' is fully thread-safe: any number of threads may
+// intern strings in, and release strings to, the same pool concurrently.
+// 'InternedString' has the thread safety of a built-in pointer: distinct
+// handles may be used concurrently (even if they refer to the same pooled
+// copy), and a single handle may be used concurrently only through 'const'
+// methods.  The reference count of a pooled copy is maintained with atomic
+// operations, and only the lookup and removal of copies take the lock of the
+// pool.
+//
+// The behavior is undefined unless every 'InternedString' obtained from a
+// pool is destroyed before the pool.  Handles obtained from different pools
+// compare unequal even if their values are the same.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Keying a Cache by Ticker
+///- - - - - - - - - - - - - - - - - -
+// Suppose we maintain a cache of prices keyed by ticker symbol, which is
+// updated and queried by many threads, for a small set of tickers.
+//
+// First, we create a pool of interned strings and a map keyed by
+// 'InternedString':
+//..
+//  bslma::TestAllocator ta;
+//
+//  bslstl::InternedStringPool pool(&ta);
+//
+//  bsl::unordered_map<bslstl::InternedString, double> prices(&ta);
+//..
+// Then, we record some prices.  Interning a ticker allocates memory only the
+// first time that value is seen:
+//..
+//  prices[pool.intern("IBM")]  = 155.2;
+//  prices[pool.intern("MSFT")] = 402.5;
+//
+//  assert(2 == pool.numStrings());
+//..
+// Next, we look up a price.  Interning the same value again returns a handle
+// to the existing copy, and neither hashing the key nor comparing it with the
+// keys of the map examines its characters, so the lookup allocates no memory:
+//..
+//  bslstl::InternedString ibm = pool.intern("IBM");
+//
+//  const bsls::Types::Int64 numAllocations = ta.numAllocations();
+//
+//  assert(155.2 == prices.find(ibm)->second);
+//  assert(numAllocations == ta.numAllocations());
+//..
+// Finally, we use the characters of the key through a 'bslstl::StringRef'
+// (or as a null-terminated string), without copying them:
+//..
+//  const bslstl::StringRef ticker = ibm;
+//
+//  assert(3 == ticker.length());
+//  assert(0 == native_std::strcmp("IBM", ibm.c_str()));
+//..
+
+// Prevent 'bslstl' headers from being included directly in 'BSL_OVERRIDES_STD'
+// mode.  Doing so is unsupported, and is likely to cause compilation errors.
+#if defined(BSL_OVERRIDES_STD) && !defined(BSL_STDHDRS_PROLOGUE_IN_EFFECT)
+#error "include <bsl_string.h> instead of <bslstl_internedstring.h> in \
+BSL_OVERRIDES_STD mode"
+#endif
+
+#ifndef INCLUDED_BSLSCM_VERSION
+#include <bslscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_HASH
+#include <bslstl_hash.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_STRINGREF
+#include <bslstl_stringref.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_VECTOR
+#include <bslstl_vector.h>
+#endif
+
+#ifndef INCLUDED_BSLH_HASH
+#include <bslh_hash.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_ALLOCATOR
+#include <bslma_allocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_USESBSLMAALLOCATOR
+#include <bslma_usesbslmaallocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_ISBITWISEMOVEABLE
+#include <bslmf_isbitwisemoveable.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_NESTEDTRAITDECLARATION
+#include <bslmf_nestedtraitdeclaration.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ATOMIC
+#include <bsls_atomic.h>
+#endif
+
+#ifndef INCLUDED_BSLS_BSLLOCK
+#include <bsls_bsllock.h>
+#endif
+
+#ifndef INCLUDED_BSLS_NATIVESTD
+#include <bsls_nativestd.h>
+#endif
+
+#ifndef INCLUDED_CSTDDEF
+#include <cstddef>
+#define INCLUDED_CSTDDEF
+#endif
+
+namespace BloombergLP {
+
+namespace bslstl {
+
+class InternedStringPool;
+
+                        // =========================
+                        // struct InternedString_Rep
+                        // =========================
+
+struct InternedString_Rep {
+    // This component-private 'struct' describes the pooled copy of an
+    // interned string, which is allocated together with its characters.
+
+    // DATA
+    bsls::AtomicInt     d_refCount;  // number of handles referring to this
+                                     // copy; 0 once the copy is being removed
+
+    InternedString_Rep *d_next_p;    // next copy in the same bucket of the
+                                     // pool
+
+    InternedStringPool *d_pool_p;    // pool holding this copy (held, not
+                                     // owned)
+
+    native_std::size_t  d_hash;      // 'bslh::Hash<>' of the characters
+
+    native_std::size_t  d_length;    // number of characters
+
+    char                d_data[1];   // first of 'd_length' characters and
+                                     // null terminator
+};
+
+                        // ====================
+                        // class InternedString
+                        // ====================
+
+class InternedString {
+    // This class provides a pointer-sized, reference-counted handle to an
+    // immutable string held by an 'InternedStringPool'.  Two handles obtained
+    // from the same pool have the same value if and only if they refer to the
+    // same pooled copy.
+
+    // DATA
+    InternedString_Rep *d_rep_p;  // pooled copy, or 0 for the empty string
+
+    // FRIENDS
+    friend class InternedStringPool;
+
+    // PRIVATE CREATORS
+    explicit InternedString(InternedString_Rep *rep);
+        // Create a handle adopting a reference, already counted, to the
+        // specified 'rep'.
+
+    // PRIVATE MANIPULATORS
+    void release();
+        // Release the reference held by this handle, removing the pooled copy
+        // from its pool if this was the last reference.
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(InternedString, bslmf::IsBitwiseMoveable);
+
+    // CREATORS
+    InternedString();
+        // Create a handle having the value of the empty string.  Note that
+        // this operation does not access any pool.
+
+    InternedString(const InternedString& original);
+        // Create a handle referring to the same string as the specified
+        // 'original' handle.
+
+    ~InternedString();
+        // Destroy this handle, releasing the pooled string it refers to if it
+        // is the last handle referring to it.
+
+    // MANIPULATORS
+    InternedString& operator=(const InternedString& rhs);
+        // Make this handle refer to the same string as the specified 'rhs'
+        // handle, and return a reference providing modifiable access to this
+        // handle.
+
+    void swap(InternedString& other);
+        // Efficiently exchange the value of this handle with the value of the
+        // specified 'other' handle.  This method provides the no-throw
+        // exception-safety guarantee.
+
+    // ACCESSORS
+    operator StringRef() const;
+        // Return a reference to the characters of this string.
+
+    const char *c_str() const;
+    const char *data() const;
+        // Return the address of the null-terminated characters of this
+        // string.
+
+    native_std::size_t length() const;
+        // Return the number of characters in this string.
+
+    bool empty() const;
+        // Return 'true' if this string has length 0, and 'false' otherwise.
+
+    native_std::size_t hash() const;
+        // Return the hash value of this string, which is the value returned
+        // by 'bslh::Hash<>' (and by 'bsl::hash<bsl::string>') for a string
+        // having the same characters.  Note that this operation takes
+        // constant time.
+
+    StringRef stringRef() const;
+        // Return a reference to the characters of this string.
+};
+
+// FREE OPERATORS
+bool operator==(const InternedString& lhs, const InternedString& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' handles refer to the
+    // same string, and 'false' otherwise.  The behavior is undefined unless
+    // 'lhs' and 'rhs' were obtained from the same pool (or are empty).  Note
+    // that this operation compares addresses, and so takes constant time.
+
+bool operator!=(const InternedString& lhs, const InternedString& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' handles do not refer to
+    // the same string, and 'false' otherwise.  The behavior is undefined
+    // unless 'lhs' and 'rhs' were obtained from the same pool (or are empty).
+
+// FREE FUNCTIONS
+void swap(InternedString& a, InternedString& b);
+    // Exchange the values of the specified 'a' and 'b' handles.
+
+template <class HASHALG>
+void hashAppend(HASHALG& hashAlg, const InternedString& input);
+    // Pass the hash value computed when the specified 'input' string was
+    // interned to the specified 'hashAlg' hashing algorithm.  Note that this
+    // operation takes constant time.
+
+                        // ========================
+                        // class InternedStringPool
+                        // ========================
+
+class InternedStringPool {
+    // This mechanism class provides a thread-safe pool holding one copy of
+    // each distinct string interned in it, for as long as an 'InternedString'
+    // refers to that copy.
+
+    // PRIVATE TYPES
+    typedef InternedString_Rep Rep;
+
+    // DATA
+    bsl::vector<Rep *>  d_buckets;     // chains of copies having the same
+                                       // low-order bits of their hash; empty
+                                       // or a power of two in size
+
+    native_std::size_t  d_numStrings;  // number of copies in 'd_buckets'
+
+    mutable bsls::BslLock
+                        d_lock;        // serialize access to 'd_buckets' and
+                                       // 'd_numStrings'
+
+    bslma::Allocator   *d_allocator_p; // memory allocator (held, not owned)
+
+    // FRIENDS
+    friend class InternedString;
+
+    // NOT IMPLEMENTED
+    InternedStringPool(const InternedStringPool&);
+    InternedStringPool& operator=(const InternedStringPool&);
+
+    // PRIVATE MANIPULATORS
+    void remove(Rep *rep);
+        // Remove the specified 'rep', whose reference count has dropped to 0,
+        // from this pool and release its memory.
+
+    void rehash(native_std::size_t numBuckets);
+        // Redistribute the copies held by this pool into the specified
+        // 'numBuckets' buckets.  The behavior is undefined unless
+        // 'numBuckets' is a power of two, and the lock of this pool is held.
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(InternedStringPool,
+                                   bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    explicit InternedStringPool(bslma::Allocator *basicAllocator = 0);
+        // Create an empty pool.  Optionally specify a 'basicAllocator' used
+        // to supply memory.  If 'basicAllocator' is 0, the currently
+        // installed default allocator is used.
+
+    ~InternedStringPool();
+        // Destroy this pool.  The behavior is undefined unless no
+        // 'InternedString' referring to a string held by this pool exists.
+
+    // MANIPULATORS
+    InternedString intern(const StringRef& string);
+        // Return a handle referring to the copy held by this pool of a string
+        // having the value of the specified 'string', adding such a copy to
+        // this pool if there is none.  Return a default-constructed handle if
+        // 'string' is empty.
+
+    // ACCESSORS
+    native_std::size_t numStrings() const;
+        // Return the number of distinct strings held by this pool.  Note that
+        // the value returned may be out of date by the time it is used if
+        // other threads intern or release strings concurrently.
+
+    bslma::Allocator *allocator() const;
+        // Return the allocator used by this pool to supply memory.
+};
+
+// ============================================================================
+//                      INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+                        // --------------------
+                        // class InternedString
+                        // --------------------
+
+// PRIVATE CREATORS
+inline
+InternedString::InternedString(InternedString_Rep *rep)
+: d_rep_p(rep)
+{
+}
+
+// PRIVATE MANIPULATORS
+inline
+void InternedString::release()
+{
+    if (d_rep_p && 0 == d_rep_p->d_refCount.addAcqRel(-1)) {
+        d_rep_p->d_pool_p->remove(d_rep_p);
+    }
+}
+
+// CREATORS
+inline
+InternedString::InternedString()
+: d_rep_p(0)
+{
+}
+
+inline
+InternedString::InternedString(const InternedString& original)
+: d_rep_p(original.d_rep_p)
+{
+    if (d_rep_p) {
+        d_rep_p->d_refCount.addRelaxed(1);
+    }
+}
+
+inline
+InternedString::~InternedString()
+{
+    release();
+}
+
+// MANIPULATORS
+inline
+InternedString& InternedString::operator=(const InternedString& rhs)
+{
+    // Acquire the new reference before releasing the old one, which may be
+    // the same.
+
+    if (rhs.d_rep_p) {
+        rhs.d_rep_p->d_refCount.addRelaxed(1);
+    }
+    release();
+    d_rep_p = rhs.d_rep_p;
+    return *this;
+}
+
+inline
+void InternedString::swap(InternedString& other)
+{
+    InternedString_Rep *rep = d_rep_p;
+    d_rep_p                 = other.d_rep_p;
+    other.d_rep_p           = rep;
+}
+
+// ACCESSORS
+inline
+InternedString::operator StringRef() const
+{
+    return stringRef();
+}
+
+inline
+const char *InternedString::c_str() const
+{
+    return d_rep_p ? d_rep_p->d_data : "";
+}
+
+inline
+const char *InternedString::data() const
+{
+    return c_str();
+}
+
+inline
+native_std::size_t InternedString::length() const
+{
+    return d_rep_p ? d_rep_p->d_length : 0;
+}
+
+inline
+bool InternedString::empty() const
+{
+    return 0 == d_rep_p;
+}
+
+inline
+native_std::size_t InternedString::hash() const
+{
+    return d_rep_p ? d_rep_p->d_hash : bslh::Hash<>()(stringRef());
+}
+
+inline
+StringRef InternedString::stringRef() const
+{
+    return StringRef(c_str(), static_cast<int>(length()));
+}
+
+                        // ------------------------
+                        // class InternedStringPool
+                        // ------------------------
+
+// ACCESSORS
+inline
+native_std::size_t InternedStringPool::numStrings() const
+{
+    bsls::BslLockGuard guard(&d_lock);
+
+    return d_numStrings;
+}
+
+inline
+bslma::Allocator *InternedStringPool::allocator() const
+{
+    return d_allocator_p;
+}
+
+}  // close package namespace
+
+// FREE OPERATORS
+inline
+bool bslstl::operator==(const InternedString& lhs, const InternedString& rhs)
+{
+    return lhs.data() == rhs.data();
+}
+
+inline
+bool bslstl::operator!=(const InternedString& lhs, const InternedString& rhs)
+{
+    return lhs.data() != rhs.data();
+}
+
+// FREE FUNCTIONS
+inline
+void bslstl::swap(InternedString& a, InternedString& b)
+{
+    a.swap(b);
+}
+
+template <class HASHALG>
+inline
+void bslstl::hashAppend(HASHALG& hashAlg, const InternedString& input)
+{
+    using ::BloombergLP::bslh::hashAppend;
+    hashAppend(hashAlg, input.hash());
+}
+
+}  // close enterprise namespace
+
+namespace bsl {
+
+                        // ===========================
+                        // struct hash<InternedString>
+                        // ===========================
+
+template <>
+struct hash<BloombergLP::bslstl::InternedString> {
+    // This specialization of 'hash' for 'bslstl::InternedString' returns the
+    // hash value computed when the string was interned.
+
+    // PUBLIC TYPES
+    typedef BloombergLP::bslstl::InternedString argument_type;
+    typedef std::size_t                         result_type;
+
+    // ACCESSORS
+    std::size_t operator()(const argument_type& input) const;
+        // Return the hash value of the specified 'input' string, which is the
+        // value 'hash<string>' returns for a string having the same
+        // characters.
+};
+
+                        // ---------------------------
+                        // struct hash<InternedString>
+                        // ---------------------------
+
+// ACCESSORS
+inline
+std::size_t hash<BloombergLP::bslstl::InternedString>::operator()(
+                                            const argument_type& input) const
+{
+    return input.hash();
+}
+
+}  // close namespace bsl
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
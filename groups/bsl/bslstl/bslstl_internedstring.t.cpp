@@ -0,0 +1,784 @@
+// bslstl_internedstring.t.cpp                                        -*-C++-*-
+
+#include <bslstl_internedstring.h>
+
+#include <bslstl_string.h>
+#include <bslstl_unorderedmap.h>
+
+#include <bslh_hash.h>
+#include <bslma_default.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatormonitor.h>
+#include <bslmf_isbitwisemoveable.h>
+#include <bsls_bsltestutil.h>
+#include <bsls_nativestd.h>
+#include <bsls_platform.h>
+
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+#include <windows.h>
+#else
+#include <pthread.h>
+#endif
+
+using namespace BloombergLP;
+using namespace std;
+
+//=============================================================================
+//                             TEST PLAN
+//-----------------------------------------------------------------------------
+//                             Overview
+//                             --------
+// The component under test provides a pool of unique strings and a
+// reference-counted handle to the strings it holds.  We verify that interning
+// equal values yields handles to the same copy, that the copy is released
+// exactly when the last handle to it is destroyed, that the hash value and
+// the characters are available in constant time without copying, and that
+// handles serve as keys of 'bsl::unordered_map' without allocating memory
+// per lookup.  Finally, we intern and release a small vocabulary from several
+// threads concurrently to verify the thread safety of the pool.
+//-----------------------------------------------------------------------------
+// InternedString
+// [ 3] InternedString();
+// [ 3] InternedString(const InternedString& original);
+// [ 3] ~InternedString();
+// [ 3] InternedString& operator=(const InternedString& rhs);
+// [ 3] void swap(InternedString& other);
+// [ 4] operator StringRef() const;
+// [ 2] const char *c_str() const;
+// [ 2] const char *data() const;
+// [ 2] size_t length() const;
+// [ 2] bool empty() const;
+// [ 4] size_t hash() const;
+// [ 4] StringRef stringRef() const;
+// [ 2] bool operator==(const InternedString&, const InternedString&);
+// [ 2] bool operator!=(const InternedString&, const InternedString&);
+// [ 3] void swap(InternedString& a, InternedString& b);
+// [ 4] void hashAppend(HASHALG& hashAlg, const InternedString& input);
+// [ 4] size_t hash<InternedString>::operator()(const InternedString&) const;
+//
+// InternedStringPool
+// [ 2] explicit InternedStringPool(bslma::Allocator *basicAllocator = 0);
+// [ 2] ~InternedStringPool();
+// [ 2] InternedString intern(const StringRef& string);
+// [ 2] size_t numStrings() const;
+// [ 2] bslma::Allocator *allocator() const;
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 5] CONCERN: The pool is thread-safe.
+// [ 6] USAGE EXAMPLE
+
+//=============================================================================
+//                  STANDARD BDE ASSERT TEST MACRO
+//-----------------------------------------------------------------------------
+static int testStatus = 0;
+
+static void aSsErT(bool b, const char *s, int i) {
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+//=============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef bslstl::InternedString     Obj;
+typedef bslstl::InternedStringPool Pool;
+
+static const char *const VOCABULARY[] = {
+    "IBM",
+    "MSFT",
+    "F",
+    "XNYS",
+    "XLON",
+    "US4592001014",
+    "IBM US Equity",
+    "AAPL US 01/17/25 C150 Equity",
+    "INTERNATIONAL BUSINESS MACHINES CORP COMMON STOCK",
+    "IBM\0US",                          // embedded null, compared as "IBM"
+    "ibm",
+    "IB",
+};
+static const int NUM_VOCABULARY = sizeof VOCABULARY / sizeof *VOCABULARY;
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+typedef HANDLE    ThreadId;
+#else
+typedef pthread_t ThreadId;
+#endif
+
+typedef void *(*ThreadFunction)(void *arg);
+
+//=============================================================================
+//                  HELPER CLASSES AND FUNCTIONS FOR TESTING
+//-----------------------------------------------------------------------------
+
+static
+ThreadId createThread(ThreadFunction func, void *arg)
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    return CreateThread(0, 0, (LPTHREAD_START_ROUTINE)func, arg, 0, 0);
+#else
+    ThreadId id;
+    pthread_create(&id, 0, func, arg);
+    return id;
+#endif
+}
+
+static
+void joinThread(ThreadId id)
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    WaitForSingleObject(id, INFINITE);
+    CloseHandle(id);
+#else
+    pthread_join(id, 0);
+#endif
+}
+
+namespace {
+
+struct ThreadInfo {
+    // This 'struct' describes the work of a thread in the concurrency test.
+
+    Pool *d_pool_p;       // pool to intern strings in
+    int   d_seed;         // distinguishes the sequence of each thread
+    int   d_iterations;   // number of strings to intern
+    int   d_numErrors;    // number of inconsistencies observed
+};
+
+extern "C" void *threadFunction(void *arg)
+    // Intern and release strings of the vocabulary in the pool described by
+    // the specified 'arg', verifying that each handle has the expected value
+    // and is equal to a handle to the same value held for longer.
+{
+    ThreadInfo *info = static_cast<ThreadInfo *>(arg);
+
+    Obj held[NUM_VOCABULARY];
+    for (int i = 0; i < info->d_iterations; ++i) {
+        const int   index = (i * 7 + info->d_seed) % NUM_VOCABULARY;
+        const char *value = VOCABULARY[index];
+
+        Obj handle = info->d_pool_p->intern(value);
+        if (0 != strcmp(value, handle.c_str())) {
+            ++info->d_numErrors;
+        }
+        if (!held[index].empty() && held[index] != handle) {
+            ++info->d_numErrors;
+        }
+
+        // Periodically drop the held handles so that copies are removed and
+        // recreated while other threads look them up.
+
+        if (0 == i % 5) {
+            held[index] = handle;
+        }
+        if (0 == i % 13) {
+            for (int j = 0; j < NUM_VOCABULARY; ++j) {
+                held[j] = Obj();
+            }
+        }
+    }
+    return 0;
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+    bool     veryVeryVerbose = argc > 4;
+    bool veryVeryVeryVerbose = argc > 5;
+
+    (void) veryVerbose;
+    (void) veryVeryVerbose;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    // CONCERN: No memory is obtained from the default allocator.
+
+    bslma::TestAllocator da("default", veryVeryVeryVerbose);
+    bslma::Default::setDefaultAllocatorRaw(&da);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Keying a Cache by Ticker
+///- - - - - - - - - - - - - - - - - -
+// Suppose we maintain a cache of prices keyed by ticker symbol, which is
+// updated and queried by many threads, for a small set of tickers.
+//
+// First, we create a pool of interned strings and a map keyed by
+// 'InternedString':
+//..
+    bslma::TestAllocator ta;
+
+    bslstl::InternedStringPool pool(&ta);
+
+    bsl::unordered_map<bslstl::InternedString, double> prices(&ta);
+//..
+// Then, we record some prices.  Interning a ticker allocates memory only the
+// first time that value is seen:
+//..
+    prices[pool.intern("IBM")]  = 155.2;
+    prices[pool.intern("MSFT")] = 402.5;
+
+    ASSERT(2 == pool.numStrings());
+//..
+// Next, we look up a price.  Interning the same value again returns a handle
+// to the existing copy, and neither hashing the key nor comparing it with the
+// keys of the map examines its characters, so the lookup allocates no memory:
+//..
+    bslstl::InternedString ibm = pool.intern("IBM");
+
+    const bsls::Types::Int64 numAllocations = ta.numAllocations();
+
+    ASSERT(155.2 == prices.find(ibm)->second);
+    ASSERT(numAllocations == ta.numAllocations());
+//..
+// Finally, we use the characters of the key through a 'bslstl::StringRef'
+// (or as a null-terminated string), without copying them:
+//..
+    const bslstl::StringRef ticker = ibm;
+
+    ASSERT(3 == ticker.length());
+    ASSERT(0 == native_std::strcmp("IBM", ibm.c_str()));
+//..
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // CONCERN: The pool is thread-safe.
+        //
+        // Concerns:
+        //: 1 Threads interning the same values concurrently obtain handles to
+        //:   a single copy of each value.
+        //:
+        //: 2 A copy released by one thread while another thread interns the
+        //:   same value is neither used after it is freed nor leaked.
+        //
+        // Plan:
+        //: 1 In several threads, repeatedly intern values of a small
+        //:   vocabulary, holding some of the handles for a while and releasing
+        //:   others at once, and verify the value of each handle and its
+        //:   equality with the handles held.  (C-1)
+        //:
+        //: 2 Verify that the pool is empty and that all memory has been
+        //:   released when the threads complete.  (C-2)
+        //
+        // Testing:
+        //   CONCERN: The pool is thread-safe.
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCONCERN: The pool is thread-safe."
+                            "\n=================================\n");
+
+        enum { k_NUM_THREADS = 4, k_NUM_ITERATIONS = 200000 };
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        {
+            Pool mX(&oa);  const Pool& X = mX;
+
+            ThreadInfo info[k_NUM_THREADS];
+            ThreadId   ids[k_NUM_THREADS];
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                info[i].d_pool_p     = &mX;
+                info[i].d_seed       = i;
+                info[i].d_iterations = k_NUM_ITERATIONS;
+                info[i].d_numErrors  = 0;
+                ids[i] = createThread(&threadFunction, &info[i]);
+            }
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                joinThread(ids[i]);
+                ASSERTV(i, info[i].d_numErrors, 0 == info[i].d_numErrors);
+            }
+            ASSERTV(X.numStrings(), 0 == X.numStrings());
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+        ASSERT(0 == da.numBlocksTotal());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // HASHING AND STRING REFERENCES
+        //
+        // Concerns:
+        //: 1 'hash' returns the value 'bsl::hash<bsl::string>' returns for a
+        //:   string having the same characters, as does
+        //:   'bsl::hash<InternedString>'.
+        //:
+        //: 2 'hashAppend' supplies the stored hash value to the hashing
+        //:   algorithm, so that 'bslh::Hash<>' is consistent with equality.
+        //:
+        //: 3 The 'StringRef' conversion refers to the pooled characters.
+        //:
+        //: 4 'InternedString' is a usable key of 'bsl::unordered_map', and a
+        //:   lookup with an interned key allocates no memory.
+        //
+        // Plan:
+        //: 1 For each value of a vocabulary, compare the hash values of the
+        //:   interned string with those of the equal 'bsl::string', and the
+        //:   'StringRef' with the characters.  (C-1..3)
+        //:
+        //: 2 Insert every value in an 'unordered_map' keyed by
+        //:   'InternedString', then look each up with a newly interned handle
+        //:   and verify that no memory is allocated.  (C-4)
+        //
+        // Testing:
+        //   size_t hash() const;
+        //   operator StringRef() const;
+        //   StringRef stringRef() const;
+        //   void hashAppend(HASHALG& hashAlg, const InternedString& input);
+        //   size_t hash<InternedString>::operator()(const InternedString&);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nHASHING AND STRING REFERENCES"
+                            "\n=============================\n");
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        {
+            Pool mX(&oa);
+
+            const bsl::hash<bsl::string> stringHasher;
+            const bsl::hash<Obj>         hasher;
+            const bslh::Hash<>           bslhHasher;
+
+            for (int ti = 0; ti <= NUM_VOCABULARY; ++ti) {
+                const char *VALUE = ti < NUM_VOCABULARY ? VOCABULARY[ti] : "";
+
+                const Obj         X = mX.intern(VALUE);
+                const bsl::string S(VALUE, &oa);
+
+                ASSERTV(ti, stringHasher(S) == X.hash());
+                ASSERTV(ti, stringHasher(S) == hasher(X));
+                ASSERTV(ti, bslhHasher(X) == bslhHasher(mX.intern(VALUE)));
+
+                const bslstl::StringRef R1 = X;
+                const bslstl::StringRef R2 = X.stringRef();
+                ASSERTV(ti, X.data() == R1.data());
+                ASSERTV(ti, X.data() == R2.data());
+                ASSERTV(ti, S.length() == R1.length());
+                ASSERTV(ti, S.length() == R2.length());
+            }
+
+            typedef bsl::unordered_map<Obj, int> Map;
+
+            Map map(&oa);
+            for (int ti = 0; ti < NUM_VOCABULARY; ++ti) {
+                map[mX.intern(VOCABULARY[ti])] = ti;
+            }
+
+            for (int ti = 0; ti < NUM_VOCABULARY; ++ti) {
+                const Obj KEY = mX.intern(VOCABULARY[ti]);
+
+                bslma::TestAllocatorMonitor oam(&oa);
+
+                Map::const_iterator it = map.find(KEY);
+                ASSERTV(ti, map.end() != it);
+                ASSERTV(ti, KEY == it->first);
+                ASSERTV(ti, strcmp(VOCABULARY[ti], VOCABULARY[it->second])
+                                                                        == 0);
+                ASSERTV(ti, oam.isTotalSame());
+            }
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+        ASSERT(0 == da.numBlocksTotal());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // HANDLE VALUE SEMANTICS AND REFERENCE COUNTING
+        //
+        // Concerns:
+        //: 1 A default-constructed handle represents the empty string.
+        //:
+        //: 2 Copying and assigning a handle refer to the same copy, and do not
+        //:   allocate memory.
+        //:
+        //: 3 A pooled copy is removed from the pool, and its memory released,
+        //:   exactly when the last handle referring to it is destroyed or
+        //:   assigned another value.
+        //:
+        //: 4 Self-assignment, and assignment of a handle to the same copy,
+        //:   preserve the copy.
+        //:
+        //: 5 'swap' (member and free) exchanges values without allocating.
+        //:
+        //: 6 'InternedString' is the size of a pointer, and is
+        //:   bitwise-moveable.
+        //
+        // Plan:
+        //: 1 Create, copy, assign, and destroy handles to several values,
+        //:   verifying the value of each handle, the number of strings in the
+        //:   pool, and the memory in use after each step.  (C-1..5)
+        //:
+        //: 2 Verify the size and traits.  (C-6)
+        //
+        // Testing:
+        //   InternedString();
+        //   InternedString(const InternedString& original);
+        //   ~InternedString();
+        //   InternedString& operator=(const InternedString& rhs);
+        //   void swap(InternedString& other);
+        //   void swap(InternedString& a, InternedString& b);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf(
+                        "\nHANDLE VALUE SEMANTICS AND REFERENCE COUNTING"
+                        "\n=============================================\n");
+
+        ASSERT(sizeof(void *) == sizeof(Obj));
+        ASSERT(bslmf::IsBitwiseMoveable<Obj>::value);
+
+        {
+            const Obj X;
+            ASSERT(X.empty());
+            ASSERT(0 == X.length());
+            ASSERT(0 == strcmp("", X.c_str()));
+        }
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        {
+            Pool mP(&oa);  const Pool& P = mP;
+
+            Obj mA = mP.intern("IBM");
+            ASSERT(1 == P.numStrings());
+            ASSERT(1 == oa.numBlocksInUse() - 1);  // one block for buckets
+
+            const bsls::Types::Int64 BLOCKS = oa.numBlocksInUse();
+
+            bslma::TestAllocatorMonitor oam(&oa);
+            {
+                Obj mB(mA);  const Obj& B = mB;
+                ASSERT(B == mA);
+                ASSERT(oam.isTotalSame());
+
+                Obj mC;  const Obj& C = mC;
+                mC = B;
+                ASSERT(C == mA);
+                ASSERT(oam.isTotalSame());
+
+                mC = C;
+                ASSERT(C == mA);
+                ASSERT(0 == strcmp("IBM", C.c_str()));
+            }
+            ASSERT(1 == P.numStrings());
+            ASSERT(BLOCKS == oa.numBlocksInUse());
+
+            // Releasing the last handle removes the copy.
+
+            mA = Obj();
+            ASSERT(mA.empty());
+            ASSERT(0 == P.numStrings());
+            ASSERT(BLOCKS - 1 == oa.numBlocksInUse());
+
+            // Assignment between handles to different values.
+
+            Obj mD = mP.intern("MSFT");  const Obj& D = mD;
+            Obj mE = mP.intern("XNYS");  const Obj& E = mE;
+            ASSERT(2 == P.numStrings());
+
+            const char *const DATA_E = E.data();
+
+            mD = E;
+            ASSERT(1 == P.numStrings());
+            ASSERT(D == E);
+            ASSERT(DATA_E == D.data());
+
+            mD = mP.intern("MSFT");
+            ASSERT(2 == P.numStrings());
+            ASSERT(D != E);
+            ASSERT(0 == strcmp("MSFT", D.c_str()));
+
+            // 'swap'
+
+            bslma::TestAllocatorMonitor oam2(&oa);
+
+            mD.swap(mE);
+            ASSERT(0 == strcmp("XNYS", D.c_str()));
+            ASSERT(0 == strcmp("MSFT", E.c_str()));
+
+            swap(mD, mE);
+            ASSERT(0 == strcmp("MSFT", D.c_str()));
+            ASSERT(0 == strcmp("XNYS", E.c_str()));
+
+            Obj mF;  const Obj& F = mF;
+            swap(mD, mF);
+            ASSERT(D.empty());
+            ASSERT(0 == strcmp("MSFT", F.c_str()));
+            ASSERT(oam2.isTotalSame());
+            ASSERT(2 == P.numStrings());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+        ASSERT(0 == da.numBlocksTotal());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // INTERNING
+        //
+        // Concerns:
+        //: 1 Interning a value yields a handle having that value, including
+        //:   embedded null characters, and a null terminator.
+        //:
+        //: 2 Interning an equal value yields a handle to the same copy,
+        //:   without allocating memory; interning a different value (even one
+        //:   having the same length or hash bucket) yields a different copy.
+        //:
+        //: 3 Interning the empty string yields a default-constructed handle,
+        //:   and does not add a copy to the pool.
+        //:
+        //: 4 Memory is obtained from the supplied allocator, or the default
+        //:   allocator if none is supplied.
+        //:
+        //: 5 The pool continues to find every value as it grows.
+        //
+        // Plan:
+        //: 1 Intern each value of a vocabulary twice, and verify the handles
+        //:   and the number of strings in the pool.  (C-1..3)
+        //:
+        //: 2 Create pools with and without an allocator.  (C-4)
+        //:
+        //: 3 Intern many distinct values, then verify that interning each
+        //:   again yields the same copy.  (C-5)
+        //
+        // Testing:
+        //   explicit InternedStringPool(bslma::Allocator *basicAllocator = 0);
+        //   ~InternedStringPool();
+        //   InternedString intern(const StringRef& string);
+        //   size_t numStrings() const;
+        //   bslma::Allocator *allocator() const;
+        //   const char *c_str() const;
+        //   const char *data() const;
+        //   size_t length() const;
+        //   bool empty() const;
+        //   bool operator==(const InternedString&, const InternedString&);
+        //   bool operator!=(const InternedString&, const InternedString&);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nINTERNING"
+                            "\n=========\n");
+
+        {
+            const Pool X;
+            ASSERT(&da == X.allocator());
+            ASSERT(0 == X.numStrings());
+        }
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        {
+            Pool mX(&oa);  const Pool& X = mX;
+            ASSERT(&oa == X.allocator());
+
+            const Obj EMPTY = mX.intern("");
+            ASSERT(EMPTY.empty());
+            ASSERT(EMPTY == Obj());
+            ASSERT(0 == X.numStrings());
+            ASSERT(0 == oa.numBlocksTotal());
+
+            bsl::vector<Obj> handles(&oa);
+            handles.reserve(NUM_VOCABULARY);
+
+            for (int ti = 0; ti < NUM_VOCABULARY; ++ti) {
+                const char   *VALUE  = VOCABULARY[ti];
+                const size_t  LENGTH = strlen(VALUE);
+
+                const size_t NUM_STRINGS = X.numStrings();
+
+                handles.push_back(mX.intern(VALUE));
+                const Obj& H = handles.back();
+
+                ASSERTV(ti, LENGTH == H.length());
+                ASSERTV(ti, 0 == strcmp(VALUE, H.c_str()));
+                ASSERTV(ti, H.data() == H.c_str());
+                ASSERTV(ti, !H.empty());
+                ASSERTV(ti, VALUE != H.data());
+
+                bslma::TestAllocatorMonitor oam(&oa);
+
+                const Obj H2 = mX.intern(bslstl::StringRef(VALUE,
+                                                   static_cast<int>(LENGTH)));
+                ASSERTV(ti, H == H2);
+                ASSERTV(ti, !(H != H2));
+                ASSERTV(ti, oam.isTotalSame());
+
+                const bool IS_NEW = strcmp(VALUE, "IBM") || 0 == ti;
+                ASSERTV(ti, NUM_STRINGS + (IS_NEW ? 1 : 0) == X.numStrings());
+            }
+
+            for (int ti = 0; ti < NUM_VOCABULARY; ++ti) {
+                for (int tj = 0; tj < NUM_VOCABULARY; ++tj) {
+                    const bool EQ = 0 == strcmp(VOCABULARY[ti],
+                                                VOCABULARY[tj]);
+                    ASSERTV(ti, tj, EQ == (handles[ti] == handles[tj]));
+                    ASSERTV(ti, tj, EQ != (handles[ti] != handles[tj]));
+                }
+            }
+
+            // A value with an embedded null character.
+
+            const Obj N = mX.intern(bslstl::StringRef("IBM\0US", 6));
+            ASSERT(6 == N.length());
+            ASSERT(0 == memcmp("IBM\0US", N.data(), 7));
+            ASSERT(N != handles[0]);
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+
+        if (verbose) printf("\nGrowing the pool.\n");
+        {
+            Pool mX(&oa);  const Pool& X = mX;
+
+            enum { k_NUM_VALUES = 5000 };
+
+            bsl::vector<Obj> handles(&oa);
+            char             buffer[32];
+            for (int i = 0; i < k_NUM_VALUES; ++i) {
+                sprintf(buffer, "KEY%d", i);
+                handles.push_back(mX.intern(buffer));
+            }
+            ASSERT(k_NUM_VALUES == X.numStrings());
+
+            bslma::TestAllocatorMonitor oam(&oa);
+            for (int i = 0; i < k_NUM_VALUES; ++i) {
+                sprintf(buffer, "KEY%d", i);
+                const Obj H = mX.intern(buffer);
+                ASSERTV(i, handles[i] == H);
+                ASSERTV(i, 0 == strcmp(buffer, H.c_str()));
+            }
+            ASSERT(oam.isTotalSame());
+
+            handles.clear();
+            ASSERT(0 == X.numStrings());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The classes are sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Intern a few values, compare the handles, and release them.
+        //:   (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        {
+            Pool mP(&oa);  const Pool& P = mP;
+
+            Obj mX = mP.intern("IBM");   const Obj& X = mX;
+            Obj mY = mP.intern("MSFT");  const Obj& Y = mY;
+            Obj mZ = mP.intern("IBM");   const Obj& Z = mZ;
+
+            ASSERT(2 == P.numStrings());
+            ASSERT(X == Z);
+            ASSERT(X != Y);
+            ASSERT(0 == strcmp("IBM", X.c_str()));
+            ASSERT(4 == Y.length());
+
+            mX = Obj();
+            ASSERT(2 == P.numStrings());
+            mZ = Obj();
+            ASSERT(1 == P.numStrings());
+            mY = Obj();
+            ASSERT(0 == P.numStrings());
+            ASSERT(X == Y);
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,204 @@
+// bslstl_maintainssubtreesizes.h                                     -*-C++-*-
+#ifndef INCLUDED_BSLSTL_MAINTAINSSUBTREESIZES
+#define INCLUDED_BSLSTL_MAINTAINSSUBTREESIZES
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a trait selecting trees that record subtree sizes.
+//
+//@CLASSES:
+//  bslstl::MaintainsSubtreeSizes<COMPARATOR>: trait detection metafunction
+//
+//@SEE_ALSO: bslstl_map, bslstl_set, bslalg_rbtreecountednode
+//
+//@DESCRIPTION: This component defines a meta-function,
+// 'bslstl::MaintainsSubtreeSizes', that may be used to associate a comparator
+// type with the subtree-size trait, and also to detect whether a comparator
+// type has been associated with that trait.
+//
+// By default, 'bsl::map' and 'bsl::set' store in each node of their
+// underlying red-black tree only the element and the links of the tree, so
+// finding the element at a given position in the sequence of elements (e.g.,
+// the median), or the position of a given element, takes time proportional to
+// that position.  A 'map' or 'set' whose 'COMPARATOR' is associated with the
+// 'MaintainsSubtreeSizes' trait instead allocates each element in a node
+// derived from 'bslalg::RbTreeCountedNode', which records the number of
+// elements in the subtree rooted at that node, and keeps those sizes accurate
+// as elements are inserted and erased.  Such a container provides:
+//
+//: o 'nth', which returns an iterator to the element at a given position, and
+//:
+//: o 'rank', which returns the number of elements ordered before a given key,
+//
+// each in O(log(N)) time, where N is the size of the container.
+//
+// The trait costs one additional 'int' per element, and a walk from each
+// inserted or erased node to the root of the tree.  Operations that
+// restructure a whole tree at once (e.g., copying a container, or the set
+// operations 'merge', 'intersect', and 'subtract') recompute the subtree
+// sizes in linear time afterwards.  Containers whose comparator is not
+// associated with the trait are unaffected, and do not provide 'nth' or
+// 'rank'.
+//
+// Like 'bslstl::CachesHashCodes', this trait is a property of the comparator,
+// so that the choice of node type is made at compile time, and the trait is
+// not associated with any type by default, and never with a function or
+// reference type.
+//
+///Usage
+///-----
+// This section illustrates intended usage of this component.
+//
+///Example 1: Requesting Subtree Sizes for a Set of Scores
+///- - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we maintain a set of scores, and frequently need to know the
+// percentile of a given score, or the score at a given percentile.
+//
+// First, we define a comparator for the scores, and associate it with the
+// 'MaintainsSubtreeSizes' trait using the 'BSLMF_NESTED_TRAIT_DECLARATION'
+// macro:
+//..
+//  struct RankedLess {
+//      // This 'struct' provides a less-than comparator for 'int' values that
+//      // requests that trees record the size of each subtree.
+//
+//      // TRAITS
+//      BSLMF_NESTED_TRAIT_DECLARATION(RankedLess,
+//                                     bslstl::MaintainsSubtreeSizes);
+//
+//      // ACCESSORS
+//      bool operator()(int lhs, int rhs) const
+//          // Return 'true' if the specified 'lhs' is less than the specified
+//          // 'rhs', and 'false' otherwise.
+//      {
+//          return lhs < rhs;
+//      }
+//  };
+//..
+// Then, we verify that the trait is detected for 'RankedLess', but not for
+// the default 'native_std::less<int>':
+//..
+//  typedef native_std::less<int> DefaultLess;
+//  assert(true  == bslstl::MaintainsSubtreeSizes<RankedLess>::value);
+//  assert(false == bslstl::MaintainsSubtreeSizes<DefaultLess>::value);
+//..
+// Finally, we note that a 'bsl::set<int, RankedLess>' will now provide the
+// 'nth' and 'rank' methods, each taking logarithmic time.
+
+#ifndef INCLUDED_BSLSCM_VERSION
+#include <bslscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_DETECTNESTEDTRAIT
+#include <bslmf_detectnestedtrait.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_INTEGRALCONSTANT
+#include <bslmf_integralconstant.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_ISFUNCTION
+#include <bslmf_isfunction.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_ISREFERENCE
+#include <bslmf_isreference.h>
+#endif
+
+namespace BloombergLP {
+
+namespace bslstl {
+
+                       // ===========================
+                       // class MaintainsSubtreeSizes
+                       // ===========================
+
+template <class COMPARATOR>
+struct MaintainsSubtreeSizes;
+
+template <class COMPARATOR, bool CANNOT_NEST_TRAITS>
+struct MaintainsSubtreeSizes_Imp {
+    // This 'struct' provides the trait value for the specified 'COMPARATOR'
+    // type if the specified 'CANNOT_NEST_TRAITS' is 'true', i.e., for function
+    // and reference types, which cannot declare nested traits.
+
+    typedef bsl::false_type Type;
+};
+
+template <class COMPARATOR>
+struct MaintainsSubtreeSizes_Imp<COMPARATOR, false> {
+    // This partial specialization provides the trait value for the specified
+    // 'COMPARATOR' type if it may declare nested traits.
+
+    typedef typename bslmf::DetectNestedTrait<COMPARATOR,
+                                              MaintainsSubtreeSizes>::type
+                                                                          Type;
+};
+
+template <class COMPARATOR>
+struct MaintainsSubtreeSizes
+    : MaintainsSubtreeSizes_Imp<COMPARATOR,
+                                bsl::is_function<COMPARATOR>::value
+                             || bsl::is_reference<COMPARATOR>::value>::Type
+{
+    // This metafunction is derived from 'true_type' if trees ordered by the
+    // specified 'COMPARATOR' functor should record the size of the subtree
+    // rooted at each node, and from 'false_type' otherwise.  Note that this
+    // trait must be explicitly associated with a type, either using the
+    // 'BSLMF_NESTED_TRAIT_DECLARATION' macro or by specializing this template.
+};
+
+template <class COMPARATOR>
+struct MaintainsSubtreeSizes<const COMPARATOR>
+    : MaintainsSubtreeSizes<COMPARATOR>::type
+{
+    // Specialization that associates the same trait with 'const COMPARATOR'
+    // as with unqualified 'COMPARATOR'.
+};
+
+template <class COMPARATOR>
+struct MaintainsSubtreeSizes<volatile COMPARATOR>
+    : MaintainsSubtreeSizes<COMPARATOR>::type
+{
+    // Specialization that associates the same trait with
+    // 'volatile COMPARATOR' as with unqualified 'COMPARATOR'.
+};
+
+template <class COMPARATOR>
+struct MaintainsSubtreeSizes<const volatile COMPARATOR>
+    : MaintainsSubtreeSizes<COMPARATOR>::type
+{
+    // Specialization that associates the same trait with
+    // 'const volatile COMPARATOR' as with unqualified 'COMPARATOR'.
+};
+
+}  // close package namespace
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
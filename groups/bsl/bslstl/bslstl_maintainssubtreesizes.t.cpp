@@ -0,0 +1,277 @@
+// bslstl_maintainssubtreesizes.t.cpp                                 -*-C++-*-
+
+#include <bslstl_maintainssubtreesizes.h>
+
+#include <bslmf_assert.h>
+#include <bslmf_nestedtraitdeclaration.h>
+#include <bsls_bsltestutil.h>
+#include <bsls_nativestd.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+
+using namespace BloombergLP;
+using namespace std;
+
+//=============================================================================
+//                             TEST PLAN
+//-----------------------------------------------------------------------------
+//                             Overview
+//                             --------
+// The component provides a meta-function for associating the subtree-size
+// trait with a comparator type, and for detecting whether that trait is
+// associated with a type.  We verify that the trait is detected for types
+// declaring it as a nested trait and for types specializing the template, is
+// propagated through cv-qualification, and is not detected for unrelated
+// types, including function and reference types (which cannot declare nested
+// traits).
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 2] USAGE EXAMPLE
+//-----------------------------------------------------------------------------
+
+//=============================================================================
+//                  STANDARD BDE ASSERT TEST MACRO
+//-----------------------------------------------------------------------------
+static int testStatus = 0;
+
+static void aSsErT(bool b, const char *s, int i) {
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+//=============================================================================
+//                              USAGE EXAMPLE
+//-----------------------------------------------------------------------------
+
+///Usage
+///-----
+// This section illustrates intended usage of this component.
+//
+///Example 1: Requesting Subtree Sizes for a Set of Scores
+///- - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we maintain a set of scores, and frequently need to know the
+// percentile of a given score, or the score at a given percentile.
+//
+// First, we define a comparator for the scores, and associate it with the
+// 'MaintainsSubtreeSizes' trait using the 'BSLMF_NESTED_TRAIT_DECLARATION'
+// macro:
+//..
+    struct RankedLess {
+        // This 'struct' provides a less-than comparator for 'int' values that
+        // requests that trees record the size of each subtree.
+
+        // TRAITS
+        BSLMF_NESTED_TRAIT_DECLARATION(RankedLess,
+                                       bslstl::MaintainsSubtreeSizes);
+
+        // ACCESSORS
+        bool operator()(int lhs, int rhs) const
+            // Return 'true' if the specified 'lhs' is less than the specified
+            // 'rhs', and 'false' otherwise.
+        {
+            return lhs < rhs;
+        }
+    };
+//..
+
+//=============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+namespace {
+
+struct PlainLess {
+    // Comparator that is not associated with the trait.
+
+    bool operator()(int lhs, int rhs) const
+        // Return 'true' if the specified 'lhs' is less than the specified
+        // 'rhs', and 'false' otherwise.
+    {
+        return lhs < rhs;
+    }
+};
+
+struct SpecializedLess {
+    // Comparator that is associated with the trait by specialization.
+
+    bool operator()(int lhs, int rhs) const
+        // Return 'true' if the specified 'lhs' is less than the specified
+        // 'rhs', and 'false' otherwise.
+    {
+        return lhs < rhs;
+    }
+};
+
+struct ConvertibleToAny {
+    // Type that can be converted to any type.  'DetectNestedTrait' shouldn't
+    // assign it any traits.
+
+    template <class TYPE>
+    operator TYPE() const { return TYPE(); }
+        // Return a default constructed object of 'TYPE'.
+};
+
+typedef bool CompareFunction(int, int);
+
+}  // close unnamed namespace
+
+namespace BloombergLP {
+namespace bslstl {
+
+template <>
+struct MaintainsSubtreeSizes<SpecializedLess> : bsl::true_type {};
+
+}  // close package namespace
+}  // close enterprise namespace
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+    bool verbose = argc > 2;
+    bool veryVerbose = argc > 3;
+    bool veryVeryVerbose = argc > 4;
+
+    (void)veryVerbose;
+    (void)veryVeryVerbose;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 2: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   The usage example provided in the component header file must
+        //   compile, link, and run on all platforms as shown.
+        //
+        // Plan:
+        //   Incorporate usage example from header into driver, remove leading
+        //   comment characters, and replace 'assert' with 'ASSERT'.
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+// Then, we verify that the trait is detected for 'RankedLess', but not for
+// the default 'native_std::less<int>':
+//..
+    typedef native_std::less<int> DefaultLess;
+    ASSERT(true  == bslstl::MaintainsSubtreeSizes<RankedLess>::value);
+    ASSERT(false == bslstl::MaintainsSubtreeSizes<DefaultLess>::value);
+//..
+// Finally, we note that a 'bsl::set<int, RankedLess>' will now provide the
+// 'nth' and 'rank' methods, each taking logarithmic time.
+
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //
+        // Concerns:
+        //: 1 The trait is detected for types declaring it as a nested trait,
+        //:   and for types specializing 'MaintainsSubtreeSizes'.
+        //:
+        //: 2 The trait is detected for cv-qualified versions of such types.
+        //:
+        //: 3 The trait is not detected for other types, including function,
+        //:   pointer-to-function, and reference types.
+        //:
+        //: 4 The trait can be tested at compile-time.
+        //
+        // Plan:
+        //: 1 Test the trait for a representative set of types.  (C-1..4)
+        //
+        // Testing:
+        //  BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        BSLMF_ASSERT( bslstl::MaintainsSubtreeSizes<RankedLess>::value);
+        BSLMF_ASSERT(!bslstl::MaintainsSubtreeSizes<PlainLess>::value);
+
+        ASSERT( bslstl::MaintainsSubtreeSizes<RankedLess>::value);
+        ASSERT( bslstl::MaintainsSubtreeSizes<const RankedLess>::value);
+        ASSERT( bslstl::MaintainsSubtreeSizes<volatile RankedLess>::value);
+        ASSERT( bslstl::MaintainsSubtreeSizes<
+                                           const volatile RankedLess>::value);
+
+        ASSERT( bslstl::MaintainsSubtreeSizes<SpecializedLess>::value);
+        ASSERT( bslstl::MaintainsSubtreeSizes<const SpecializedLess>::value);
+
+        ASSERT(!bslstl::MaintainsSubtreeSizes<PlainLess>::value);
+        ASSERT(!bslstl::MaintainsSubtreeSizes<const PlainLess>::value);
+        ASSERT(!bslstl::MaintainsSubtreeSizes<ConvertibleToAny>::value);
+        ASSERT(!bslstl::MaintainsSubtreeSizes<int>::value);
+
+        ASSERT(!bslstl::MaintainsSubtreeSizes<CompareFunction>::value);
+        ASSERT(!bslstl::MaintainsSubtreeSizes<CompareFunction *>::value);
+        ASSERT(!bslstl::MaintainsSubtreeSizes<CompareFunction&>::value);
+        ASSERT(!bslstl::MaintainsSubtreeSizes<RankedLess&>::value);
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
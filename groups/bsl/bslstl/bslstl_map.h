@@ -89,6 +89,24 @@ BSLS_IDENT("$Id: $")
 // (template parameter) type 'KEY' and 'VALUE', if respectively, the types
 // define the 'bslma::UsesBslmaAllocator' trait.
 //
+///Order Statistics
+///----------------
+// If the (template parameter) type 'COMPARATOR' is associated with the
+// 'bslstl::MaintainsSubtreeSizes' trait (see 'bslstl_maintainssubtreesizes'),
+// each node of a 'map' additionally records the number of elements in the
+// subtree rooted at that node, and the 'map' provides two additional methods:
+// 'nth', which returns an iterator to the element at a given position in the
+// ordered sequence of elements, and 'rank', which returns the number of
+// elements whose keys are ordered before a given key, each in logarithmic
+// time.  Inserting and erasing elements keeps the subtree sizes accurate at
+// the cost of a walk from the affected node to the root of the tree, and each
+// node is larger by the size of an 'int'.  Operations that restructure the
+// whole tree at once ('mergeUnion', 'intersect', 'subtract', copy
+// construction, and construction from a sorted range) recompute the subtree
+// sizes afterwards, in time linear in the size of the resulting map.  A 'map'
+// whose comparator is not associated with the trait is unaffected, and does
+// not provide 'nth' or 'rank'.
+//
 ///Operations
 ///----------
 // This section describes the run-time complexity of operations on instances
@@ -106,6 +124,7 @@ BSLS_IDENT("$Id: $")
 //  'i1', 'i2'      - two iterators defining a sequence of 'value_type' objects
 //  'k'             - an object of type 'K'
 //  'v'             - an object of type 'V'
+//  'i'             - an index in the range [0, n]
 //  'p1', 'p2'      - two iterators belonging to 'a'
 //  distance(i1,i2) - the number of elements in the range [i1, i2)
 //
@@ -197,6 +216,8 @@ BSLS_IDENT("$Id: $")
 //  +----------------------------------------------------+--------------------+
 //  | a.equal_range(k)                                   | O[log(n)]          |
 //  +----------------------------------------------------+--------------------+
+//  | a.nth(i), a.rank(k)  (see {Order Statistics})      | O[log(n)]          |
+//  +----------------------------------------------------+--------------------+
 //..
 //
 ///Usage
@@ -409,10 +430,22 @@ BSL_OVERRIDES_STD mode"
 #include <bslstl_allocator.h>
 #endif
 
+#ifndef INCLUDED_BSLSTL_ITERATORUTIL
+#include <bslstl_iteratorutil.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_MAINTAINSSUBTREESIZES
+#include <bslstl_maintainssubtreesizes.h>
+#endif
+
 #ifndef INCLUDED_BSLSTL_MAPCOMPARATOR
 #include <bslstl_mapcomparator.h>
 #endif
 
+#ifndef INCLUDED_BSLSTL_NODEHANDLE
+#include <bslstl_nodehandle.h>
+#endif
+
 #ifndef INCLUDED_BSLSTL_PAIR
 #include <bslstl_pair.h>
 #endif
@@ -441,6 +474,10 @@ BSL_OVERRIDES_STD mode"
 #include <bslalg_rbtreeanchor.h>
 #endif
 
+#ifndef INCLUDED_BSLALG_RBTREECOUNTEDNODE
+#include <bslalg_rbtreecountednode.h>
+#endif
+
 #ifndef INCLUDED_BSLALG_RBTREENODE
 #include <bslalg_rbtreenode.h>
 #endif
@@ -457,6 +494,18 @@ BSL_OVERRIDES_STD mode"
 #include <bslalg_typetraithasstliterators.h>
 #endif
 
+#ifndef INCLUDED_BSLMF_ASSERT
+#include <bslmf_assert.h>
+#endif
+
+#ifndef INCLUDED_BSLS_COMPILERFEATURES
+#include <bsls_compilerfeatures.h>
+#endif
+
+#ifndef INCLUDED_BSLS_UTIL
+#include <bsls_util.h>
+#endif
+
 #ifndef INCLUDED_FUNCTIONAL
 #include <functional>
 #define INCLUDED_FUNCTIONAL
@@ -464,6 +513,116 @@ BSL_OVERRIDES_STD mode"
 
 namespace bsl {
 
+                            // ===================
+                            // struct Map_TreeUtil
+                            // ===================
+
+template <bool MAINTAINS_SUBTREE_SIZES>
+struct Map_TreeUtil {
+    // This component-private utility 'struct' provides a namespace for the
+    // operations that modify the tree of a 'map' and that depend on whether
+    // its nodes record the sizes of their subtrees (see
+    // 'bslstl_maintainssubtreesizes').  This primary template handles nodes
+    // derived from 'bslalg::RbTreeNode', which do not.
+
+    // TYPES
+    typedef BloombergLP::bslalg::RbTreeNode NodeBase;
+        // This 'typedef' is an alias for the base class of the nodes of the
+        // tree.
+
+    // CLASS METHODS
+    static void insertAt(BloombergLP::bslalg::RbTreeAnchor *tree,
+                         BloombergLP::bslalg::RbTreeNode   *parentNode,
+                         bool                               leftChildFlag,
+                         BloombergLP::bslalg::RbTreeNode   *newNode);
+        // Insert the specified 'newNode' into the specified 'tree' as the left
+        // or right child of the specified 'parentNode', as indicated by the
+        // specified 'leftChildFlag' (see 'bslalg::RbTreeUtil::insertAt').
+
+    static void remove(BloombergLP::bslalg::RbTreeAnchor *tree,
+                       BloombergLP::bslalg::RbTreeNode   *node);
+        // Remove the specified 'node' from the specified 'tree' (see
+        // 'bslalg::RbTreeUtil::remove').
+
+    static void updateSubtreeSizes(BloombergLP::bslalg::RbTreeAnchor *tree);
+        // Do nothing: the nodes of the specified 'tree' do not record the
+        // sizes of their subtrees.
+};
+
+template <>
+struct Map_TreeUtil<true> {
+    // This specialization handles nodes derived from
+    // 'bslalg::RbTreeCountedNode', keeping the subtree size recorded by each
+    // node accurate.
+
+    // TYPES
+    typedef BloombergLP::bslalg::RbTreeCountedNode NodeBase;
+        // This 'typedef' is an alias for the base class of the nodes of the
+        // tree.
+
+    // CLASS METHODS
+    static void insertAt(BloombergLP::bslalg::RbTreeAnchor *tree,
+                         BloombergLP::bslalg::RbTreeNode   *parentNode,
+                         bool                               leftChildFlag,
+                         BloombergLP::bslalg::RbTreeNode   *newNode);
+        // Insert the specified 'newNode' into the specified 'tree' as the left
+        // or right child of the specified 'parentNode', as indicated by the
+        // specified 'leftChildFlag' (see
+        // 'bslalg::RbTreeUtil::insertAtCounted').
+
+    static void remove(BloombergLP::bslalg::RbTreeAnchor *tree,
+                       BloombergLP::bslalg::RbTreeNode   *node);
+        // Remove the specified 'node' from the specified 'tree' (see
+        // 'bslalg::RbTreeUtil::removeCounted').
+
+    static void updateSubtreeSizes(BloombergLP::bslalg::RbTreeAnchor *tree);
+        // Set the subtree size of each node of the specified 'tree' to the
+        // number of nodes in its subtree (see
+        // 'bslalg::RbTreeUtil::updateSubtreeSizes').
+};
+
+                        // ===========================
+                        // class Map_SubtreeSizesGuard
+                        // ===========================
+
+template <bool MAINTAINS_SUBTREE_SIZES>
+class Map_SubtreeSizesGuard {
+    // This component-private guard class template sets, on destruction, the
+    // subtree size of each node of a tree whose structure has been changed by
+    // operations that do not maintain them (e.g.,
+    // 'bslalg::RbTreeUtil::mergeUnion'), if 'MAINTAINS_SUBTREE_SIZES' is
+    // 'true'.  This primary template has no effect.
+
+  public:
+    // CREATORS
+    explicit Map_SubtreeSizesGuard(BloombergLP::bslalg::RbTreeAnchor *tree);
+        // Create a guard object for the specified 'tree' that has no effect.
+};
+
+template <>
+class Map_SubtreeSizesGuard<true> {
+    // This specialization sets the subtree size of each node of the guarded
+    // tree on destruction.
+
+    // DATA
+    BloombergLP::bslalg::RbTreeAnchor *d_tree_p;  // guarded tree
+
+  private:
+    // NOT IMPLEMENTED
+    Map_SubtreeSizesGuard(const Map_SubtreeSizesGuard&);
+    Map_SubtreeSizesGuard& operator=(const Map_SubtreeSizesGuard&);
+
+  public:
+    // CREATORS
+    explicit Map_SubtreeSizesGuard(BloombergLP::bslalg::RbTreeAnchor *tree);
+        // Create a guard object for the specified 'tree'.
+
+    ~Map_SubtreeSizesGuard();
+        // Destroy this object, setting the subtree size of each node of the
+        // guarded tree to the number of nodes in its subtree.  The behavior is
+        // undefined unless the guarded tree is well-formed.
+};
+
                              // =========
                              // class map
                              // =========
@@ -491,16 +650,32 @@ class map {
         // This typedef is an alias for the type of key-value pair objects
         // maintained by this map.
 
-    typedef BloombergLP::bslstl::MapComparator<KEY, VALUE, COMPARATOR>
+    typedef Map_TreeUtil<
+                BloombergLP::bslstl::MaintainsSubtreeSizes<COMPARATOR>::value>
+                                                                      TreeUtil;
+        // This typedef is an alias for the utility that inserts nodes into,
+        // and removes nodes from, the tree used to implement this map,
+        // maintaining the subtree sizes if 'COMPARATOR' is associated with the
+        // 'bslstl::MaintainsSubtreeSizes' trait.
+
+    typedef Map_SubtreeSizesGuard<
+                BloombergLP::bslstl::MaintainsSubtreeSizes<COMPARATOR>::value>
+                                                             SubtreeSizesGuard;
+        // This typedef is an alias for the guard that restores the subtree
+        // sizes of the tree used to implement this map, if they are
+        // maintained, after it is restructured.
+
+    typedef BloombergLP::bslstl::TreeNode<ValueType,
+                                          typename TreeUtil::NodeBase> Node;
+        // This typedef is an alias for the type of nodes held by the tree (of
+        // nodes) used to implement this map.
+
+    typedef BloombergLP::bslstl::MapComparator<KEY, VALUE, COMPARATOR, Node>
                                                                     Comparator;
         // This typedef is an alias for the comparator used internally by this
         // map.
 
-    typedef BloombergLP::bslstl::TreeNode<ValueType> Node;
-        // This typedef is an alias for the type of nodes held by the tree (of
-        // nodes) used to implement this map.
-
-    typedef BloombergLP::bslstl::TreeNodePool<ValueType, ALLOCATOR>
+    typedef BloombergLP::bslstl::TreeNodePool<ValueType, ALLOCATOR, Node>
                                                                    NodeFactory;
         // This typedef is an alias for the factory type used to create and
         // destroy 'Node' objects.
@@ -556,6 +731,9 @@ class map {
     typedef bsl::reverse_iterator<iterator>            reverse_iterator;
     typedef bsl::reverse_iterator<const_iterator>      const_reverse_iterator;
 
+    typedef BloombergLP::bslstl::NodeHandle<value_type, Node, ALLOCATOR>
+                                                                     node_type;
+
     class value_compare {
         // This nested class defines a mechanism for comparing two objects of
         // 'value_type' using the (template parameter) type 'COMPARATOR'.  Note
@@ -626,6 +804,19 @@ class map {
         // no-throw exception-safety guarantee.  The behavior is undefined
         // unless this object was created with the same allocator as 'other'.
 
+    void takeNodes(BloombergLP::bslalg::RbTreeAnchor *result, map& other);
+        // Move the 'value_type' objects of the specified 'other' map, in
+        // order, into nodes of this map forming the specified 'result' tree,
+        // leaving 'other' empty.  If 'other' uses the same allocator as this
+        // map, the node pool of 'other' is taken over by this map (see
+        // 'bslstl::TreeNodePool::adopt'), and no memory is allocated;
+        // otherwise each object is relocated into a new node.  If an exception
+        // is thrown, 'result' is a valid tree holding the objects already
+        // moved, and the other objects remain in 'other'.  The behavior is
+        // undefined unless 'result' is empty and 'other' is not this map.
+        // Note that the subtree sizes of the nodes of 'result', if maintained
+        // by this map, are not accurate.
+
     // PRIVATE ACCESSORS
     const NodeFactory& nodeFactory() const;
         // Return a reference providing non-modifiable access to the node
@@ -739,10 +930,11 @@ class map {
         // Return a reference providing modifiable access to the mapped-value
         // associated with the specified 'key'; if this 'map' does not already
         // contain a 'value_type' object with 'key', first insert a new
-        // 'value_type' object having 'key' and a default-constructed 'VALUE'
-        // object, and return a reference to the mapped value.  This method
-        // requires that the (template parameter) types 'KEY' and 'VALUE' both
-        // be "default-constructible" (see {Requirements on 'KEY' and
+        // 'value_type' object having 'key' and a value-initialized 'VALUE'
+        // object (constructed in place, as if by 'try_emplace(key)'), and
+        // return a reference to the mapped value.  This method requires that
+        // the (template parameter) type 'KEY' be "copy-constructible" and
+        // 'VALUE' be "default-constructible" (see {Requirements on 'KEY' and
         // 'VALUE'}).
 
     VALUE& at(const key_type& key);
@@ -810,7 +1002,205 @@ class map {
         // defined in the C++11 standard [24.2.3] providing access to values of
         // a type convertible to 'value_type'.  This method requires that the
         // (template parameter) types 'KEY' and 'VALUE' both be
-        // "copy-constructible" (see {Requirements on 'KEY' and 'VALUE'}).
+        // "copy-constructible" (see {Requirements on 'KEY' and 'VALUE'}).  If
+        // this map is empty, the longest prefix of the range whose keys are in
+        // strictly increasing order is inserted in O[M] time, where M is the
+        // length of that prefix, by linking its nodes into a balanced tree
+        // without rebalancing, and the remaining values, if any, are inserted
+        // one at a time.
+
+    pair<iterator, bool> insert(node_type& node);
+        // Insert the 'value_type' object held by the specified 'node' into
+        // this map, and make 'node' empty, if the key of that object does not
+        // already exist in this map; otherwise, leave 'node' unchanged.
+        // Return a 'pair' whose 'first' member is an iterator referring to the
+        // (possibly newly inserted) 'value_type' object in this map whose key
+        // is the same as that of the object held by 'node', and whose 'second'
+        // member is 'true' if the object was inserted, and 'false' otherwise.
+        // If 'node' is empty, return '(end(), false)' with no other effect.
+        // Note that the node held by 'node' is linked into this map if
+        // 'node.get_allocator() == get_allocator()' and this map has no free
+        // node, and that the object is otherwise relocated into a node of this
+        // map (see {'bslstl_nodehandle'|Node Ownership}).
+
+    iterator insert(const_iterator hint, node_type& node);
+        // Insert the 'value_type' object held by the specified 'node' into
+        // this map (in amortized constant time if the specified 'hint' is a
+        // valid immediate successor to the key of that object), and make
+        // 'node' empty, if the key of that object does not already exist in
+        // this map; otherwise, leave 'node' unchanged.  Return an iterator
+        // referring to the (possibly newly inserted) 'value_type' object in
+        // this map whose key is the same as that of the object held by 'node',
+        // or 'end()' if 'node' is empty.  The behavior is undefined unless
+        // 'hint' is a valid iterator into this map.
+
+    bsl::pair<iterator, bool> try_emplace(const key_type& key);
+
+    template <class ARG_1>
+    bsl::pair<iterator, bool> try_emplace(
+                                const key_type&                          key,
+                                BSLS_COMPILERFEATURES_FORWARD_REF(ARG_1) arg1);
+
+    template <class ARG_1, class ARG_2>
+    bsl::pair<iterator, bool> try_emplace(
+                                const key_type&                          key,
+                                BSLS_COMPILERFEATURES_FORWARD_REF(ARG_1) arg1,
+                                BSLS_COMPILERFEATURES_FORWARD_REF(ARG_2) arg2);
+
+    template <class ARG_1, class ARG_2, class ARG_3>
+    bsl::pair<iterator, bool> try_emplace(
+                                const key_type&                          key,
+                                BSLS_COMPILERFEATURES_FORWARD_REF(ARG_1) arg1,
+                                BSLS_COMPILERFEATURES_FORWARD_REF(ARG_2) arg2,
+                                BSLS_COMPILERFEATURES_FORWARD_REF(ARG_3) arg3);
+        // Insert into this map a newly created 'value_type' object whose key
+        // is a copy of the specified 'key' and whose mapped value is
+        // constructed in place from the optionally specified 'arg1', 'arg2',
+        // and 'arg3' (or value-initialized if no such arguments are supplied),
+        // if 'key' does not already exist in this map; otherwise, this method
+        // has no effect, and in particular constructs no mapped value and
+        // allocates no memory.  Return a pair whose 'first' member is an
+        // iterator referring to the (possibly newly inserted) 'value_type'
+        // object in this map whose key is the same as 'key', and whose
+        // 'second' member is 'true' if a new value was inserted, and 'false'
+        // if the key was already present.  Both the key and the mapped value
+        // are constructed using the allocator of this map (if they use one),
+        // and no temporary 'value_type' object is created.  This method
+        // requires that the (template parameter) type 'KEY' be
+        // "copy-constructible" (see {Requirements on 'KEY' and 'VALUE'}), and
+        // that 'VALUE' be constructible from the supplied arguments.
+
+    iterator try_emplace(const_iterator hint, const key_type& key);
+
+    template <class ARG_1>
+    iterator try_emplace(
+                                const_iterator                           hint,
+                                const key_type&                          key,
+                                BSLS_COMPILERFEATURES_FORWARD_REF(ARG_1) arg1);
+
+    template <class ARG_1, class ARG_2>
+    iterator try_emplace(
+                                const_iterator                           hint,
+                                const key_type&                          key,
+                                BSLS_COMPILERFEATURES_FORWARD_REF(ARG_1) arg1,
+                                BSLS_COMPILERFEATURES_FORWARD_REF(ARG_2) arg2);
+
+    template <class ARG_1, class ARG_2, class ARG_3>
+    iterator try_emplace(
+                                const_iterator                           hint,
+                                const key_type&                          key,
+                                BSLS_COMPILERFEATURES_FORWARD_REF(ARG_1) arg1,
+                                BSLS_COMPILERFEATURES_FORWARD_REF(ARG_2) arg2,
+                                BSLS_COMPILERFEATURES_FORWARD_REF(ARG_3) arg3);
+        // Insert into this map (in amortized constant time if the specified
+        // 'hint' is a valid immediate successor to the specified 'key') a
+        // newly created 'value_type' object whose key is a copy of 'key' and
+        // whose mapped value is constructed in place from the optionally
+        // specified 'arg1', 'arg2', and 'arg3' (or value-initialized if no
+        // such arguments are supplied), if 'key' does not already exist in
+        // this map; otherwise, this method has no effect, and in particular
+        // constructs no mapped value and allocates no memory.  Return an
+        // iterator referring to the (possibly newly inserted) 'value_type'
+        // object in this map whose key is the same as 'key'.  If 'hint' is not
+        // a valid immediate successor to 'key', this operation will have
+        // O[log(N)] complexity, where 'N' is the size of this map.  The
+        // behavior is undefined unless 'hint' is a valid iterator into this
+        // map.
+
+    template <class OBJECT>
+    bsl::pair<iterator, bool> insert_or_assign(
+                                const key_type&                           key,
+                                BSLS_COMPILERFEATURES_FORWARD_REF(OBJECT) obj);
+        // Assign the specified 'obj' to the mapped value of the 'value_type'
+        // object in this map having the specified 'key', if such an object
+        // exists; otherwise, insert a newly created 'value_type' object whose
+        // key is a copy of 'key' and whose mapped value is constructed in
+        // place from 'obj'.  Return a pair whose 'first' member is an iterator
+        // referring to the 'value_type' object in this map whose key is the
+        // same as 'key', and whose 'second' member is 'true' if a new value
+        // was inserted, and 'false' if an existing mapped value was assigned.
+        // No temporary 'value_type' object is created.  This method requires
+        // that 'VALUE' be both constructible and assignable from 'obj'.
+
+    template <class OBJECT>
+    iterator insert_or_assign(
+                                const_iterator                            hint,
+                                const key_type&                           key,
+                                BSLS_COMPILERFEATURES_FORWARD_REF(OBJECT) obj);
+        // Assign the specified 'obj' to the mapped value of the 'value_type'
+        // object in this map having the specified 'key', if such an object
+        // exists; otherwise, insert (in amortized constant time if the
+        // specified 'hint' is a valid immediate successor to 'key') a newly
+        // created 'value_type' object whose key is a copy of 'key' and whose
+        // mapped value is constructed in place from 'obj'.  Return an iterator
+        // referring to the 'value_type' object in this map whose key is the
+        // same as 'key'.  The behavior is undefined unless 'hint' is a valid
+        // iterator into this map.  This method requires that 'VALUE' be both
+        // constructible and assignable from 'obj'.
+
+    node_type extract(const_iterator position);
+        // Remove from this map the 'value_type' object at the specified
+        // 'position', and return a node handle holding that object (see
+        // {'bslstl_nodehandle'}).  The behavior is undefined unless 'position'
+        // refers to a 'value_type' object in this map.  If an exception is
+        // thrown, this map is unchanged.  Note that the object is relocated
+        // into a detached node owned by the node handle (see
+        // {'bslstl_nodehandle'|Node Ownership}), without being copied if
+        // 'value_type' is bitwise moveable, and that the node holding it in
+        // this map is kept for reuse.
+
+    node_type extract(const key_type& key);
+        // Remove from this map the 'value_type' object having the specified
+        // 'key', if it exists, and return a node handle holding that object;
+        // otherwise return an empty node handle with no other effect.
+
+    void merge(map& source);
+        // Relocate into this map each 'value_type' object of the specified
+        // 'source' map whose key does not already exist in this map; the
+        // objects whose keys already exist remain in 'source'.  This method
+        // has no effect if 'source' is this map.  If an exception is thrown,
+        // each object is held by exactly one of the two containers.  Note that
+        // no memory is allocated for the relocated objects (unless the node
+        // pool of this map must grow), and none is deallocated, if
+        // 'value_type' is bitwise moveable and 'source.get_allocator() ==
+        // get_allocator()'.
+
+    void mergeUnion(map& other);
+        // Move into this map each 'value_type' object of the specified 'other'
+        // map whose key does not already exist in this map, destroy the
+        // remaining objects of 'other', and leave 'other' empty.  This method
+        // has no effect if 'other' is this map.  The nodes of 'other' are
+        // taken over, without allocating memory or moving any object, if
+        // 'other.get_allocator() == get_allocator()'; otherwise each object of
+        // 'other' is relocated into this map.  The number of key comparisons
+        // is 'O[M * log(N / M + 1)]', where 'M' and 'N' are the sizes of the
+        // smaller and of the larger map, respectively, and is 'O[1]' if the
+        // keys of one map all precede those of the other (see
+        // {'bslalg_rbtreeutil'|Set Operations}).  If an exception is thrown,
+        // this map holds all of its original objects, and the objects of
+        // 'other' are either held by one of the two maps or destroyed.
+
+    void intersect(const map& other);
+        // Remove from this map each 'value_type' object whose key does not
+        // exist in the specified 'other' map.  This method has no effect if
+        // 'other' is this map.  The number of key comparisons is 'O[M * log(N
+        // / M + 1)]', where 'M' and 'N' are the sizes of the smaller and of
+        // the larger map, respectively.  If an exception is thrown, this map
+        // holds a subset of its original objects that includes each object
+        // whose key exists in 'other'.  The behavior is undefined unless the
+        // comparator of 'other' orders keys in the same way as the comparator
+        // of this map.
+
+    void subtract(const map& other);
+        // Remove from this map each 'value_type' object whose key exists in
+        // the specified 'other' map.  If 'other' is this map, remove all the
+        // objects of this map.  The number of key comparisons is 'O[M * log(N
+        // / M + 1)]', where 'M' and 'N' are the sizes of the smaller and of
+        // the larger map, respectively.  If an exception is thrown, this map
+        // holds a subset of its original objects that includes each object
+        // whose key does not exist in 'other'.  The behavior is undefined
+        // unless the comparator of 'other' orders keys in the same way as the
+        // comparator of this map.
 
     iterator erase(const_iterator position);
         // Remove from this map the 'value_type' object at the specified
@@ -884,6 +1274,16 @@ class map {
         // returned iterators will have the same value.  Note that since a map
         // maintains unique keys, the range will contain at most one element.
 
+    iterator nth(size_type index);
+        // Return an iterator providing modifiable access to the 'value_type'
+        // object at the specified 'index' position in the ordered sequence of
+        // 'value_type' objects maintained by this map (i.e., the object
+        // preceded by 'index' objects), or the past-the-end iterator if
+        // 'index == size()'.  This operation takes O[log(n)] time.  The
+        // behavior is undefined unless 'index <= size()'.  Note that this
+        // method is available only if 'COMPARATOR' is associated with the
+        // 'bslstl::MaintainsSubtreeSizes' trait (see {Order Statistics}).
+
     // ACCESSORS
     allocator_type get_allocator() const;
         // Return (a copy of) the allocator used for memory allocation by this
@@ -1005,6 +1405,25 @@ class map {
         // value.  Note that since a map maintains unique keys, the range will
         // contain at most one element.
 
+    const_iterator nth(size_type index) const;
+        // Return an iterator providing non-modifiable access to the
+        // 'value_type' object at the specified 'index' position in the
+        // ordered sequence of 'value_type' objects maintained by this map
+        // (i.e., the object preceded by 'index' objects), or the past-the-end
+        // iterator if 'index == size()'.  This operation takes O[log(n)] time.
+        // The behavior is undefined unless 'index <= size()'.  Note that this
+        // method is available only if 'COMPARATOR' is associated with the
+        // 'bslstl::MaintainsSubtreeSizes' trait (see {Order Statistics}).
+
+    size_type rank(const key_type& key) const;
+        // Return the number of 'value_type' objects in this map whose keys
+        // are ordered before the specified 'key' (i.e., the position of
+        // 'lower_bound(key)' in the ordered sequence of 'value_type' objects
+        // maintained by this map).  This operation takes O[log(n)] time.  Note
+        // that this method is available only if 'COMPARATOR' is associated
+        // with the 'bslstl::MaintainsSubtreeSizes' trait (see
+        // {Order Statistics}).
+
     // NOT IMPLEMENTED
         // The following methods are defined by the C++11 standard, but they
         // are not implemented as they require some level of C++11 compiler
@@ -1127,6 +1546,94 @@ void swap(map<KEY, VALUE, COMPARATOR, ALLOCATOR>& a,
 //                      INLINE FUNCTION DEFINITIONS
 // ============================================================================
 
+                            // -------------------
+                            // struct Map_TreeUtil
+                            // -------------------
+
+// CLASS METHODS
+template <bool MAINTAINS_SUBTREE_SIZES>
+inline
+void Map_TreeUtil<MAINTAINS_SUBTREE_SIZES>::insertAt(
+                             BloombergLP::bslalg::RbTreeAnchor *tree,
+                             BloombergLP::bslalg::RbTreeNode   *parentNode,
+                             bool                               leftChildFlag,
+                             BloombergLP::bslalg::RbTreeNode   *newNode)
+{
+    BloombergLP::bslalg::RbTreeUtil::insertAt(tree,
+                                              parentNode,
+                                              leftChildFlag,
+                                              newNode);
+}
+
+template <bool MAINTAINS_SUBTREE_SIZES>
+inline
+void Map_TreeUtil<MAINTAINS_SUBTREE_SIZES>::remove(
+                                 BloombergLP::bslalg::RbTreeAnchor *tree,
+                                 BloombergLP::bslalg::RbTreeNode   *node)
+{
+    BloombergLP::bslalg::RbTreeUtil::remove(tree, node);
+}
+
+template <bool MAINTAINS_SUBTREE_SIZES>
+inline
+void Map_TreeUtil<MAINTAINS_SUBTREE_SIZES>::updateSubtreeSizes(
+                                           BloombergLP::bslalg::RbTreeAnchor *)
+{
+}
+
+inline
+void Map_TreeUtil<true>::insertAt(
+                             BloombergLP::bslalg::RbTreeAnchor *tree,
+                             BloombergLP::bslalg::RbTreeNode   *parentNode,
+                             bool                               leftChildFlag,
+                             BloombergLP::bslalg::RbTreeNode   *newNode)
+{
+    BloombergLP::bslalg::RbTreeUtil::insertAtCounted(tree,
+                                                     parentNode,
+                                                     leftChildFlag,
+                                                     newNode);
+}
+
+inline
+void Map_TreeUtil<true>::remove(BloombergLP::bslalg::RbTreeAnchor *tree,
+                              BloombergLP::bslalg::RbTreeNode   *node)
+{
+    BloombergLP::bslalg::RbTreeUtil::removeCounted(tree, node);
+}
+
+inline
+void Map_TreeUtil<true>::updateSubtreeSizes(
+                                       BloombergLP::bslalg::RbTreeAnchor *tree)
+{
+    BloombergLP::bslalg::RbTreeUtil::updateSubtreeSizes(tree);
+}
+
+                        // ---------------------------
+                        // class Map_SubtreeSizesGuard
+                        // ---------------------------
+
+// CREATORS
+template <bool MAINTAINS_SUBTREE_SIZES>
+inline
+Map_SubtreeSizesGuard<MAINTAINS_SUBTREE_SIZES>::Map_SubtreeSizesGuard(
+                                           BloombergLP::bslalg::RbTreeAnchor *)
+{
+}
+
+inline
+Map_SubtreeSizesGuard<true>::Map_SubtreeSizesGuard(
+                                       BloombergLP::bslalg::RbTreeAnchor *tree)
+: d_tree_p(tree)
+{
+    BSLS_ASSERT_SAFE(tree);
+}
+
+inline
+Map_SubtreeSizesGuard<true>::~Map_SubtreeSizesGuard()
+{
+    BloombergLP::bslalg::RbTreeUtil::updateSubtreeSizes(d_tree_p);
+}
+
                              // -----------------
                              // class DataWrapper
                              // -----------------
@@ -1197,6 +1704,46 @@ void map<KEY, VALUE, COMPARATOR, ALLOCATOR>::quickSwap(map& other)
     }
 }
 
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+void map<KEY, VALUE, COMPARATOR, ALLOCATOR>::takeNodes(
+                                     BloombergLP::bslalg::RbTreeAnchor *result,
+                                     map&                               other)
+{
+    BSLS_ASSERT_SAFE(result);
+    BSLS_ASSERT_SAFE(0 == result->numNodes());
+    BSLS_ASSERT_SAFE(this != &other);
+
+    if (other.get_allocator() == this->get_allocator()) {
+        nodeFactory().adopt(other.nodeFactory());
+        BloombergLP::bslalg::RbTreeUtil::swap(result, &other.d_tree);
+        return;                                                       // RETURN
+    }
+
+    if (0 < other.size()) {
+        nodeFactory().reserveNodes(other.size());
+    }
+
+    // Relocate the objects in order, appending their new nodes to a chain
+    // that 'guard' balances, even if an exception is thrown.
+
+    BloombergLP::bslalg::RbTreeUtilChainGuard guard(result);
+
+    BloombergLP::bslalg::RbTreeNode *lastNode = result->sentinel();
+    while (0 < other.d_tree.numNodes()) {
+        BloombergLP::bslalg::RbTreeNode *node = other.d_tree.firstNode();
+        BloombergLP::bslalg::RbTreeNode *newNode =
+            nodeFactory().createNodeByRelocation(
+                       BSLS_UTIL_ADDRESSOF(static_cast<Node *>(node)->value()),
+                       false);
+        TreeUtil::remove(&other.d_tree, node);
+        other.nodeFactory().deallocateNode(node);
+        BloombergLP::bslalg::RbTreeUtil::appendToChain(result,
+                                                       lastNode,
+                                                       newNode);
+        lastNode = newNode;
+    }
+}
+
 // PRIVATE ACCESSORS
 template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
 inline
@@ -1236,6 +1783,7 @@ map<KEY, VALUE, COMPARATOR, ALLOCATOR>::map(const map& original)
         BloombergLP::bslalg::RbTreeUtil::copyTree(&d_tree,
                                                   original.d_tree,
                                                   &nodeFactory());
+        TreeUtil::updateSubtreeSizes(&d_tree);
     }
 }
 
@@ -1251,6 +1799,7 @@ map<KEY, VALUE, COMPARATOR, ALLOCATOR>::map(const map&       original,
         BloombergLP::bslalg::RbTreeUtil::copyTree(&d_tree,
                                                   original.d_tree,
                                                   &nodeFactory());
+        TreeUtil::updateSubtreeSizes(&d_tree);
     }
 }
 
@@ -1268,35 +1817,7 @@ map<KEY, VALUE, COMPARATOR, ALLOCATOR>::map(INPUT_ITERATOR    first,
         BloombergLP::bslalg::RbTreeUtilTreeProctor<NodeFactory> proctor(
                                                                &d_tree,
                                                                &nodeFactory());
-
-        // The following loop guarantees amortized linear time to insert an
-        // ordered sequence of values (as required by the standard).   If the
-        // values are in sorted order, we are guaranteed the next node can be
-        // inserted as the right child of the previous node, and can call
-        // 'insertAt' without 'findUniqueInsertLocation'.
-
-        insert(*first);
-        BloombergLP::bslalg::RbTreeNode *prevNode = d_tree.rootNode();
-        while (++first != last) {
-            // The values are not in order, so insert them normally.
-
-            const value_type& value = *first;
-            if (this->comparator()(value.first, *prevNode)) {
-                insert(value);
-                insert(++first, last);
-                break;
-            }
-
-            if (this->comparator()(*prevNode, value.first)) {
-                BloombergLP::bslalg::RbTreeNode *node =
-                                               nodeFactory().createNode(value);
-                BloombergLP::bslalg::RbTreeUtil::insertAt(&d_tree,
-                                                          prevNode,
-                                                          false,
-                                                          node);
-                prevNode = node;
-            }
-        }
+        insert(first, last);
         proctor.release();
     }
 }
@@ -1336,13 +1857,7 @@ template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
 inline
 VALUE& map<KEY, VALUE, COMPARATOR, ALLOCATOR>::operator[](const key_type& key)
 {
-    BloombergLP::bslalg::RbTreeNode *node =
-        BloombergLP::bslalg::RbTreeUtil::find(d_tree, this->comparator(), key);
-    if (d_tree.sentinel() == node) {
-        return insert(iterator(node), value_type(key, VALUE()))->second;
-                                                                      // RETURN
-    }
-    return toNode(node)->value().second;
+    return try_emplace(key).first->second;
 }
 
 template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
@@ -1406,19 +1921,70 @@ map<KEY, VALUE, COMPARATOR, ALLOCATOR>::insert(const value_type& value)
                                                                       // RETURN
     }
     BloombergLP::bslalg::RbTreeNode *node = nodeFactory().createNode(value);
-    BloombergLP::bslalg::RbTreeUtil::insertAt(&d_tree,
-                                              insertLocation,
-                                              comparisonResult < 0,
-                                              node);
+    TreeUtil::insertAt(&d_tree,
+                       insertLocation,
+                       comparisonResult < 0,
+                       node);
     return bsl::pair<iterator, bool>(iterator(node), true);
 }
 
 template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
 template <class INPUT_ITERATOR>
-inline
 void map<KEY, VALUE, COMPARATOR, ALLOCATOR>::insert(INPUT_ITERATOR first,
                                                     INPUT_ITERATOR last)
 {
+    if (first != last && 0 == d_tree.numNodes()) {
+        // Link the nodes for the longest prefix of the range whose keys are
+        // in strictly increasing order into a chain, which 'guard' turns
+        // into a balanced tree in linear time (see
+        // 'bslalg::RbTreeUtil::balanceChain'), even if an exception is
+        // thrown.  If the length of the range can be determined in advance,
+        // reserve nodes for the whole range, so that they are obtained in a
+        // single allocation.  Neither the chain nor its balancing maintain
+        // subtree sizes, so 'sizesGuard' (destroyed after 'guard') restores
+        // them, if they are maintained.
+
+        const difference_type numValues =
+              BloombergLP::bslstl::IteratorUtil::insertDistance(first, last);
+        if (0 < numValues) {
+            nodeFactory().reserveNodes(numValues);
+        }
+
+        SubtreeSizesGuard                         sizesGuard(&d_tree);
+        BloombergLP::bslalg::RbTreeUtilChainGuard guard(&d_tree);
+
+        BloombergLP::bslalg::RbTreeNode *lastNode =
+                                              nodeFactory().createNode(*first);
+        BloombergLP::bslalg::RbTreeUtil::appendToChain(&d_tree,
+                                                       d_tree.sentinel(),
+                                                       lastNode);
+        while (++first != last) {
+            const value_type& value = *first;
+            if (this->comparator()(value.first, *lastNode)) {
+                // The rest of the range is not ordered: balance the tree
+                // built so far, and insert 'value' (which cannot be obtained
+                // again from an input iterator) here, and the remaining
+                // values below, one at a time.
+
+                guard.balance();
+                TreeUtil::updateSubtreeSizes(&d_tree);
+                insert(value);
+                ++first;
+                break;
+            }
+            if (this->comparator()(*lastNode, value.first)) {
+                BloombergLP::bslalg::RbTreeNode *node =
+                                               nodeFactory().createNode(value);
+                BloombergLP::bslalg::RbTreeUtil::appendToChain(&d_tree,
+                                                               lastNode,
+                                                               node);
+                lastNode = node;
+            }
+        }
+    }
+
+    // Insert the remaining values, if any, one at a time.
+
     while (first != last) {
         insert(*first);
         ++first;
@@ -1446,13 +2012,527 @@ map<KEY, VALUE, COMPARATOR, ALLOCATOR>::insert(const_iterator    position,
     }
 
     BloombergLP::bslalg::RbTreeNode *node = nodeFactory().createNode(value);
-    BloombergLP::bslalg::RbTreeUtil::insertAt(&d_tree,
-                                              insertLocation,
-                                              comparisonResult < 0,
-                                              node);
+    TreeUtil::insertAt(&d_tree,
+                       insertLocation,
+                       comparisonResult < 0,
+                       node);
     return iterator(node);
 }
 
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bsl::pair<typename map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator, bool>
+map<KEY, VALUE, COMPARATOR, ALLOCATOR>::insert(node_type& node)
+{
+    typedef bsl::pair<iterator, bool> ResultType;
+
+    if (node.empty()) {
+        return ResultType(end(), false);                              // RETURN
+    }
+
+    int comparisonResult;
+    BloombergLP::bslalg::RbTreeNode *insertLocation =
+        BloombergLP::bslalg::RbTreeUtil::findUniqueInsertLocation(
+                                                           &comparisonResult,
+                                                           &d_tree,
+                                                           this->comparator(),
+                                                           node.value().first);
+    if (!comparisonResult) {
+        return ResultType(iterator(insertLocation), false);           // RETURN
+    }
+    BloombergLP::bslalg::RbTreeNode *newNode =
+        nodeFactory().takeNode(&node,
+                               node.get_allocator() == this->get_allocator());
+    TreeUtil::insertAt(&d_tree,
+                       insertLocation,
+                       comparisonResult < 0,
+                       newNode);
+    return ResultType(iterator(newNode), true);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+map<KEY, VALUE, COMPARATOR, ALLOCATOR>::insert(const_iterator hint,
+                                               node_type&     node)
+{
+    if (node.empty()) {
+        return end();                                                 // RETURN
+    }
+
+    BloombergLP::bslalg::RbTreeNode *hintNode =
+                const_cast<BloombergLP::bslalg::RbTreeNode *>(hint.node());
+    int comparisonResult;
+    BloombergLP::bslalg::RbTreeNode *insertLocation =
+        BloombergLP::bslalg::RbTreeUtil::findUniqueInsertLocation(
+                                                            &comparisonResult,
+                                                            &d_tree,
+                                                            this->comparator(),
+                                                            node.value().first,
+                                                            hintNode);
+    if (!comparisonResult) {
+        return iterator(insertLocation);                              // RETURN
+    }
+    BloombergLP::bslalg::RbTreeNode *newNode =
+        nodeFactory().takeNode(&node,
+                               node.get_allocator() == this->get_allocator());
+    TreeUtil::insertAt(&d_tree,
+                       insertLocation,
+                       comparisonResult < 0,
+                       newNode);
+    return iterator(newNode);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bsl::pair<typename map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator, bool>
+map<KEY, VALUE, COMPARATOR, ALLOCATOR>::try_emplace(const key_type& key)
+{
+    int comparisonResult;
+    BloombergLP::bslalg::RbTreeNode *insertLocation =
+        BloombergLP::bslalg::RbTreeUtil::findUniqueInsertLocation(
+                                                            &comparisonResult,
+                                                            &d_tree,
+                                                            this->comparator(),
+                                                            key);
+    if (!comparisonResult) {
+        return bsl::pair<iterator, bool>(iterator(insertLocation), false);
+                                                                      // RETURN
+    }
+    BloombergLP::bslalg::RbTreeNode *node =
+        nodeFactory().createNodePiecewise(key);
+    TreeUtil::insertAt(&d_tree,
+                       insertLocation,
+                       comparisonResult < 0,
+                       node);
+    return bsl::pair<iterator, bool>(iterator(node), true);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+template <class ARG_1>
+inline
+bsl::pair<typename map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator, bool>
+map<KEY, VALUE, COMPARATOR, ALLOCATOR>::try_emplace(
+                                 const key_type&                          key,
+                                 BSLS_COMPILERFEATURES_FORWARD_REF(ARG_1) arg1)
+{
+    int comparisonResult;
+    BloombergLP::bslalg::RbTreeNode *insertLocation =
+        BloombergLP::bslalg::RbTreeUtil::findUniqueInsertLocation(
+                                                            &comparisonResult,
+                                                            &d_tree,
+                                                            this->comparator(),
+                                                            key);
+    if (!comparisonResult) {
+        return bsl::pair<iterator, bool>(iterator(insertLocation), false);
+                                                                      // RETURN
+    }
+    BloombergLP::bslalg::RbTreeNode *node =
+        nodeFactory().createNodePiecewise(
+                                   key,
+                                   BSLS_COMPILERFEATURES_FORWARD(ARG_1, arg1));
+    TreeUtil::insertAt(&d_tree,
+                       insertLocation,
+                       comparisonResult < 0,
+                       node);
+    return bsl::pair<iterator, bool>(iterator(node), true);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+template <class ARG_1, class ARG_2>
+inline
+bsl::pair<typename map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator, bool>
+map<KEY, VALUE, COMPARATOR, ALLOCATOR>::try_emplace(
+                                 const key_type&                          key,
+                                 BSLS_COMPILERFEATURES_FORWARD_REF(ARG_1) arg1,
+                                 BSLS_COMPILERFEATURES_FORWARD_REF(ARG_2) arg2)
+{
+    int comparisonResult;
+    BloombergLP::bslalg::RbTreeNode *insertLocation =
+        BloombergLP::bslalg::RbTreeUtil::findUniqueInsertLocation(
+                                                            &comparisonResult,
+                                                            &d_tree,
+                                                            this->comparator(),
+                                                            key);
+    if (!comparisonResult) {
+        return bsl::pair<iterator, bool>(iterator(insertLocation), false);
+                                                                      // RETURN
+    }
+    BloombergLP::bslalg::RbTreeNode *node =
+        nodeFactory().createNodePiecewise(
+                                   key,
+                                   BSLS_COMPILERFEATURES_FORWARD(ARG_1, arg1),
+                                   BSLS_COMPILERFEATURES_FORWARD(ARG_2, arg2));
+    TreeUtil::insertAt(&d_tree,
+                       insertLocation,
+                       comparisonResult < 0,
+                       node);
+    return bsl::pair<iterator, bool>(iterator(node), true);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+template <class ARG_1, class ARG_2, class ARG_3>
+inline
+bsl::pair<typename map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator, bool>
+map<KEY, VALUE, COMPARATOR, ALLOCATOR>::try_emplace(
+                                 const key_type&                          key,
+                                 BSLS_COMPILERFEATURES_FORWARD_REF(ARG_1) arg1,
+                                 BSLS_COMPILERFEATURES_FORWARD_REF(ARG_2) arg2,
+                                 BSLS_COMPILERFEATURES_FORWARD_REF(ARG_3) arg3)
+{
+    int comparisonResult;
+    BloombergLP::bslalg::RbTreeNode *insertLocation =
+        BloombergLP::bslalg::RbTreeUtil::findUniqueInsertLocation(
+                                                            &comparisonResult,
+                                                            &d_tree,
+                                                            this->comparator(),
+                                                            key);
+    if (!comparisonResult) {
+        return bsl::pair<iterator, bool>(iterator(insertLocation), false);
+                                                                      // RETURN
+    }
+    BloombergLP::bslalg::RbTreeNode *node =
+        nodeFactory().createNodePiecewise(
+                                   key,
+                                   BSLS_COMPILERFEATURES_FORWARD(ARG_1, arg1),
+                                   BSLS_COMPILERFEATURES_FORWARD(ARG_2, arg2),
+                                   BSLS_COMPILERFEATURES_FORWARD(ARG_3, arg3));
+    TreeUtil::insertAt(&d_tree,
+                       insertLocation,
+                       comparisonResult < 0,
+                       node);
+    return bsl::pair<iterator, bool>(iterator(node), true);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+map<KEY, VALUE, COMPARATOR, ALLOCATOR>::try_emplace(
+                                                          const_iterator  hint,
+                                                          const key_type& key)
+{
+    BloombergLP::bslalg::RbTreeNode *hintNode =
+                const_cast<BloombergLP::bslalg::RbTreeNode *>(hint.node());
+    int comparisonResult;
+    BloombergLP::bslalg::RbTreeNode *insertLocation =
+        BloombergLP::bslalg::RbTreeUtil::findUniqueInsertLocation(
+                                                            &comparisonResult,
+                                                            &d_tree,
+                                                            this->comparator(),
+                                                            key,
+                                                            hintNode);
+    if (!comparisonResult) {
+        return iterator(insertLocation);                              // RETURN
+    }
+    BloombergLP::bslalg::RbTreeNode *node =
+        nodeFactory().createNodePiecewise(key);
+    TreeUtil::insertAt(&d_tree,
+                       insertLocation,
+                       comparisonResult < 0,
+                       node);
+    return iterator(node);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+template <class ARG_1>
+inline
+typename map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+map<KEY, VALUE, COMPARATOR, ALLOCATOR>::try_emplace(
+                                 const_iterator                           hint,
+                                 const key_type&                          key,
+                                 BSLS_COMPILERFEATURES_FORWARD_REF(ARG_1) arg1)
+{
+    BloombergLP::bslalg::RbTreeNode *hintNode =
+                const_cast<BloombergLP::bslalg::RbTreeNode *>(hint.node());
+    int comparisonResult;
+    BloombergLP::bslalg::RbTreeNode *insertLocation =
+        BloombergLP::bslalg::RbTreeUtil::findUniqueInsertLocation(
+                                                            &comparisonResult,
+                                                            &d_tree,
+                                                            this->comparator(),
+                                                            key,
+                                                            hintNode);
+    if (!comparisonResult) {
+        return iterator(insertLocation);                              // RETURN
+    }
+    BloombergLP::bslalg::RbTreeNode *node =
+        nodeFactory().createNodePiecewise(
+                                   key,
+                                   BSLS_COMPILERFEATURES_FORWARD(ARG_1, arg1));
+    TreeUtil::insertAt(&d_tree,
+                       insertLocation,
+                       comparisonResult < 0,
+                       node);
+    return iterator(node);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+template <class ARG_1, class ARG_2>
+inline
+typename map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+map<KEY, VALUE, COMPARATOR, ALLOCATOR>::try_emplace(
+                                 const_iterator                           hint,
+                                 const key_type&                          key,
+                                 BSLS_COMPILERFEATURES_FORWARD_REF(ARG_1) arg1,
+                                 BSLS_COMPILERFEATURES_FORWARD_REF(ARG_2) arg2)
+{
+    BloombergLP::bslalg::RbTreeNode *hintNode =
+                const_cast<BloombergLP::bslalg::RbTreeNode *>(hint.node());
+    int comparisonResult;
+    BloombergLP::bslalg::RbTreeNode *insertLocation =
+        BloombergLP::bslalg::RbTreeUtil::findUniqueInsertLocation(
+                                                            &comparisonResult,
+                                                            &d_tree,
+                                                            this->comparator(),
+                                                            key,
+                                                            hintNode);
+    if (!comparisonResult) {
+        return iterator(insertLocation);                              // RETURN
+    }
+    BloombergLP::bslalg::RbTreeNode *node =
+        nodeFactory().createNodePiecewise(
+                                   key,
+                                   BSLS_COMPILERFEATURES_FORWARD(ARG_1, arg1),
+                                   BSLS_COMPILERFEATURES_FORWARD(ARG_2, arg2));
+    TreeUtil::insertAt(&d_tree,
+                       insertLocation,
+                       comparisonResult < 0,
+                       node);
+    return iterator(node);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+template <class ARG_1, class ARG_2, class ARG_3>
+inline
+typename map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+map<KEY, VALUE, COMPARATOR, ALLOCATOR>::try_emplace(
+                                 const_iterator                           hint,
+                                 const key_type&                          key,
+                                 BSLS_COMPILERFEATURES_FORWARD_REF(ARG_1) arg1,
+                                 BSLS_COMPILERFEATURES_FORWARD_REF(ARG_2) arg2,
+                                 BSLS_COMPILERFEATURES_FORWARD_REF(ARG_3) arg3)
+{
+    BloombergLP::bslalg::RbTreeNode *hintNode =
+                const_cast<BloombergLP::bslalg::RbTreeNode *>(hint.node());
+    int comparisonResult;
+    BloombergLP::bslalg::RbTreeNode *insertLocation =
+        BloombergLP::bslalg::RbTreeUtil::findUniqueInsertLocation(
+                                                            &comparisonResult,
+                                                            &d_tree,
+                                                            this->comparator(),
+                                                            key,
+                                                            hintNode);
+    if (!comparisonResult) {
+        return iterator(insertLocation);                              // RETURN
+    }
+    BloombergLP::bslalg::RbTreeNode *node =
+        nodeFactory().createNodePiecewise(
+                                   key,
+                                   BSLS_COMPILERFEATURES_FORWARD(ARG_1, arg1),
+                                   BSLS_COMPILERFEATURES_FORWARD(ARG_2, arg2),
+                                   BSLS_COMPILERFEATURES_FORWARD(ARG_3, arg3));
+    TreeUtil::insertAt(&d_tree,
+                       insertLocation,
+                       comparisonResult < 0,
+                       node);
+    return iterator(node);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+template <class OBJECT>
+inline
+bsl::pair<typename map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator, bool>
+map<KEY, VALUE, COMPARATOR, ALLOCATOR>::insert_or_assign(
+                                 const key_type&                           key,
+                                 BSLS_COMPILERFEATURES_FORWARD_REF(OBJECT) obj)
+{
+    int comparisonResult;
+    BloombergLP::bslalg::RbTreeNode *insertLocation =
+        BloombergLP::bslalg::RbTreeUtil::findUniqueInsertLocation(
+                                                            &comparisonResult,
+                                                            &d_tree,
+                                                            this->comparator(),
+                                                            key);
+    if (!comparisonResult) {
+        toNode(insertLocation)->value().second =
+                                    BSLS_COMPILERFEATURES_FORWARD(OBJECT, obj);
+        return bsl::pair<iterator, bool>(iterator(insertLocation), false);
+                                                                      // RETURN
+    }
+    BloombergLP::bslalg::RbTreeNode *node =
+        nodeFactory().createNodePiecewise(
+                                   key,
+                                   BSLS_COMPILERFEATURES_FORWARD(OBJECT, obj));
+    TreeUtil::insertAt(&d_tree,
+                       insertLocation,
+                       comparisonResult < 0,
+                       node);
+    return bsl::pair<iterator, bool>(iterator(node), true);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+template <class OBJECT>
+inline
+typename map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+map<KEY, VALUE, COMPARATOR, ALLOCATOR>::insert_or_assign(
+                                const_iterator                            hint,
+                                const key_type&                           key,
+                                BSLS_COMPILERFEATURES_FORWARD_REF(OBJECT) obj)
+{
+    BloombergLP::bslalg::RbTreeNode *hintNode =
+                const_cast<BloombergLP::bslalg::RbTreeNode *>(hint.node());
+    int comparisonResult;
+    BloombergLP::bslalg::RbTreeNode *insertLocation =
+        BloombergLP::bslalg::RbTreeUtil::findUniqueInsertLocation(
+                                                            &comparisonResult,
+                                                            &d_tree,
+                                                            this->comparator(),
+                                                            key,
+                                                            hintNode);
+    if (!comparisonResult) {
+        toNode(insertLocation)->value().second =
+                                    BSLS_COMPILERFEATURES_FORWARD(OBJECT, obj);
+        return iterator(insertLocation);                              // RETURN
+    }
+    BloombergLP::bslalg::RbTreeNode *node =
+        nodeFactory().createNodePiecewise(
+                                   key,
+                                   BSLS_COMPILERFEATURES_FORWARD(OBJECT, obj));
+    TreeUtil::insertAt(&d_tree,
+                       insertLocation,
+                       comparisonResult < 0,
+                       node);
+    return iterator(node);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+typename map<KEY, VALUE, COMPARATOR, ALLOCATOR>::node_type
+map<KEY, VALUE, COMPARATOR, ALLOCATOR>::extract(const_iterator position)
+{
+    BSLS_ASSERT_SAFE(position != end());
+
+    BloombergLP::bslalg::RbTreeNode *node =
+                const_cast<BloombergLP::bslalg::RbTreeNode *>(position.node());
+
+    BloombergLP::bslalg::RbTreeNode *detachedNode =
+                                        nodeFactory().createDetachedNode(node);
+    TreeUtil::remove(&d_tree, node);
+    nodeFactory().deallocateNode(node);
+
+    node_type result;
+    result.adoptNode(toNode(detachedNode), this->get_allocator());
+    return result;
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename map<KEY, VALUE, COMPARATOR, ALLOCATOR>::node_type
+map<KEY, VALUE, COMPARATOR, ALLOCATOR>::extract(const key_type& key)
+{
+    const_iterator it = find(key);
+    if (it == end()) {
+        return node_type();                                           // RETURN
+    }
+    return extract(it);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+void map<KEY, VALUE, COMPARATOR, ALLOCATOR>::merge(map& source)
+{
+    if (this == &source) {
+        return;                                                       // RETURN
+    }
+
+    // Each element is located in this tree before it is relocated, so that
+    // an exception thrown by the comparator leaves it in 'source'.
+
+    const bool isSameAllocator =
+                               source.get_allocator() == this->get_allocator();
+
+    BloombergLP::bslalg::RbTreeNode *node = source.d_tree.firstNode();
+    while (source.d_tree.sentinel() != node) {
+        BloombergLP::bslalg::RbTreeNode *next =
+            BloombergLP::bslalg::RbTreeUtil::next(node);
+
+        int comparisonResult;
+        BloombergLP::bslalg::RbTreeNode *insertLocation =
+            BloombergLP::bslalg::RbTreeUtil::findUniqueInsertLocation(
+                                                  &comparisonResult,
+                                                  &d_tree,
+                                                  this->comparator(),
+                                                  toNode(node)->value().first);
+        if (comparisonResult) {
+            BloombergLP::bslalg::RbTreeNode *newNode =
+                nodeFactory().createNodeByRelocation(
+                                    BSLS_UTIL_ADDRESSOF(toNode(node)->value()),
+                                    isSameAllocator);
+            TreeUtil::remove(&source.d_tree, node);
+            source.nodeFactory().deallocateNode(node);
+            TreeUtil::insertAt(&d_tree,
+                               insertLocation,
+                               comparisonResult < 0,
+                               newNode);
+        }
+        node = next;
+    }
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+void map<KEY, VALUE, COMPARATOR, ALLOCATOR>::mergeUnion(map& other)
+{
+    if (this == &other || 0 == other.size()) {
+        return;                                                       // RETURN
+    }
+
+    // Move the objects of 'other' into 'source', a tree of nodes owned by
+    // this map, which 'proctor' deletes unless they are all merged into, or
+    // destroyed by, 'bslalg::RbTreeUtil::mergeUnion'.  The merge does not
+    // maintain subtree sizes, so 'sizesGuard' restores them, if they are
+    // maintained.
+
+    BloombergLP::bslalg::RbTreeAnchor                       source;
+    BloombergLP::bslalg::RbTreeUtilTreeProctor<NodeFactory> proctor(
+                                                               &source,
+                                                               &nodeFactory());
+    takeNodes(&source, other);
+
+    SubtreeSizesGuard sizesGuard(&d_tree);
+    BloombergLP::bslalg::RbTreeUtil::mergeUnion(&d_tree,
+                                                &source,
+                                                this->comparator(),
+                                                &nodeFactory());
+    proctor.release();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+void map<KEY, VALUE, COMPARATOR, ALLOCATOR>::intersect(const map& other)
+{
+    if (this == &other) {
+        return;                                                       // RETURN
+    }
+    SubtreeSizesGuard sizesGuard(&d_tree);
+    BloombergLP::bslalg::RbTreeUtil::intersect(&d_tree,
+                                               other.d_tree,
+                                               this->comparator(),
+                                               &nodeFactory());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+void map<KEY, VALUE, COMPARATOR, ALLOCATOR>::subtract(const map& other)
+{
+    if (this == &other) {
+        clear();
+        return;                                                       // RETURN
+    }
+    SubtreeSizesGuard sizesGuard(&d_tree);
+    BloombergLP::bslalg::RbTreeUtil::subtract(&d_tree,
+                                              other.d_tree,
+                                              this->comparator(),
+                                              &nodeFactory());
+}
+
 template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
 inline
 typename map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
@@ -1464,7 +2544,7 @@ map<KEY, VALUE, COMPARATOR, ALLOCATOR>::erase(const_iterator position)
                 const_cast<BloombergLP::bslalg::RbTreeNode *>(position.node());
     BloombergLP::bslalg::RbTreeNode *result =
                                    BloombergLP::bslalg::RbTreeUtil::next(node);
-    BloombergLP::bslalg::RbTreeUtil::remove(&d_tree, node);
+    TreeUtil::remove(&d_tree, node);
     nodeFactory().deleteNode(node);
     return iterator(result);
 }
@@ -1589,6 +2669,20 @@ map<KEY, VALUE, COMPARATOR, ALLOCATOR>::equal_range(const key_type& key)
     return bsl::pair<iterator, iterator>(startIt, endIt);
 }
 
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+map<KEY, VALUE, COMPARATOR, ALLOCATOR>::nth(size_type index)
+{
+    BSLMF_ASSERT(
+                BloombergLP::bslstl::MaintainsSubtreeSizes<COMPARATOR>::value);
+    BSLS_ASSERT_SAFE(index <= size());
+
+    return iterator(BloombergLP::bslalg::RbTreeUtil::nth(
+                                                    d_tree,
+                                                    static_cast<int>(index)));
+}
+
 // ACCESSORS
 template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
 inline
@@ -1771,6 +2865,36 @@ map<KEY, VALUE, COMPARATOR, ALLOCATOR>::equal_range(const key_type& key) const
     return bsl::pair<const_iterator, const_iterator>(startIt, endIt);
 }
 
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename map<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_iterator
+map<KEY, VALUE, COMPARATOR, ALLOCATOR>::nth(size_type index) const
+{
+    BSLMF_ASSERT(
+                BloombergLP::bslstl::MaintainsSubtreeSizes<COMPARATOR>::value);
+    BSLS_ASSERT_SAFE(index <= size());
+
+    return const_iterator(BloombergLP::bslalg::RbTreeUtil::nth(
+                                                    d_tree,
+                                                    static_cast<int>(index)));
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename map<KEY, VALUE, COMPARATOR, ALLOCATOR>::size_type
+map<KEY, VALUE, COMPARATOR, ALLOCATOR>::rank(const key_type& key) const
+{
+    BSLMF_ASSERT(
+                BloombergLP::bslstl::MaintainsSubtreeSizes<COMPARATOR>::value);
+
+    return BloombergLP::bslalg::RbTreeUtil::rank(
+                      d_tree,
+                      BloombergLP::bslalg::RbTreeUtil::lowerBound(
+                                                           d_tree,
+                                                           this->comparator(),
+                                                           key));
+}
+
 }  // close namespace bsl
 
 template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
@@ -14,6 +14,7 @@
 #include <bslma_usesbslmaallocator.h>
 
 #include <bslmf_haspointersemantics.h>
+#include <bslmf_nestedtraitdeclaration.h>
 #include <bslmf_issame.h>
 
 #include <bsls_alignmentutil.h>
@@ -163,9 +164,26 @@ using namespace bsl;
 //// specialized algorithms:
 // [ 8] void swap(map<K, V, C, A>& a, map<K, V, C, A>& b);
 //
+// [27] node_type extract(const_iterator position);
+// [27] node_type extract(const key_type& key);
+// [27] pair<iterator, bool> insert(node_type& node);
+// [27] iterator insert(const_iterator hint, node_type& node);
+// [27] void merge(map& source);
+// [30] void mergeUnion(map& other);
+// [30] void intersect(const map& other);
+// [30] void subtract(const map& other);
+//
+// [31] iterator nth(size_type index);
+// [31] const_iterator nth(size_type index) const;
+// [31] size_type rank(const key_type& key) const;
+//
+// [28] pair<iterator, bool> try_emplace(const key_type&, Args&&...);
+// [28] iterator try_emplace(const_iterator, const key_type&, Args&&...);
+// [28] pair<iterator, bool> insert_or_assign(const key_type&, OBJ&&);
+// [28] iterator insert_or_assign(const_iterator, const key_type&, OBJ&&);
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [26] USAGE EXAMPLE
+// [32] USAGE EXAMPLE
 //
 // TEST APPARATUS: GENERATOR FUNCTIONS
 // [ 3] int ggg(map<T,A> *object, const char *spec, int verbose = 1);
@@ -175,6 +193,7 @@ using namespace bsl;
 // [22] CONCERN: The type is compatible with STL allocator.
 // [23] CONCERN: The type has the necessary type traits.
 // [25] CONCERN: The type provides the full interface defined by the standard.
+// [29] CONCERN: Construction from an ordered range takes linear time.
 
 // ============================================================================
 //                      STANDARD BDE ASSERT TEST MACROS
@@ -309,6 +328,111 @@ static const int DEFAULT_NUM_DATA = sizeof DEFAULT_DATA / sizeof *DEFAULT_DATA;
 typedef bsltf::NonDefaultConstructibleTestType TestKeyType;
 typedef bsltf::NonTypicalOverloadsTestType     TestValueType;
 
+                            // ==================
+                            // class EmplacedType
+                            // ==================
+
+class EmplacedType {
+    // This allocator-aware test type records the number of 'int' arguments it
+    // was constructed from, the sum of those arguments, and the allocator it
+    // was supplied, and counts the objects created by copy construction.
+    // Constructing an object from a negative first argument throws that
+    // argument as an exception.
+
+    // CLASS DATA
+    static int        s_numCopies;    // number of copy-constructed objects
+
+    // DATA
+    int               d_numArgs;      // number of constructor arguments
+    int               d_sum;          // sum of constructor arguments
+    bslma::Allocator *d_allocator_p;  // allocator supplied (held)
+
+    // PRIVATE CLASS METHODS
+    static void throwIfNegative(int value)
+        // Throw the specified 'value' if it is negative and exceptions are
+        // enabled.
+    {
+#ifdef BDE_BUILD_TARGET_EXC
+        if (value < 0) {
+            throw value;
+        }
+#else
+        (void) value;
+#endif
+    }
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(EmplacedType, bslma::UsesBslmaAllocator);
+
+    // CLASS METHODS
+    static int numCopies()
+        // Return the number of 'EmplacedType' objects created by copy
+        // construction since the start of the program.
+    {
+        return s_numCopies;
+    }
+
+    // CREATORS
+    explicit EmplacedType(bslma::Allocator *basicAllocator = 0)
+    : d_numArgs(0)
+    , d_sum(0)
+    , d_allocator_p(bslma::Default::allocator(basicAllocator))
+    {
+    }
+
+    explicit EmplacedType(int a1, bslma::Allocator *basicAllocator = 0)
+    : d_numArgs(1)
+    , d_sum(a1)
+    , d_allocator_p(bslma::Default::allocator(basicAllocator))
+    {
+        throwIfNegative(a1);
+    }
+
+    EmplacedType(int a1, int a2, bslma::Allocator *basicAllocator = 0)
+    : d_numArgs(2)
+    , d_sum(a1 + a2)
+    , d_allocator_p(bslma::Default::allocator(basicAllocator))
+    {
+        throwIfNegative(a1);
+    }
+
+    EmplacedType(int               a1,
+                 int               a2,
+                 int               a3,
+                 bslma::Allocator *basicAllocator = 0)
+    : d_numArgs(3)
+    , d_sum(a1 + a2 + a3)
+    , d_allocator_p(bslma::Default::allocator(basicAllocator))
+    {
+        throwIfNegative(a1);
+    }
+
+    EmplacedType(const EmplacedType&  original,
+                 bslma::Allocator    *basicAllocator = 0)
+    : d_numArgs(original.d_numArgs)
+    , d_sum(original.d_sum)
+    , d_allocator_p(bslma::Default::allocator(basicAllocator))
+    {
+        ++s_numCopies;
+    }
+
+    // MANIPULATORS
+    EmplacedType& operator=(const EmplacedType& rhs)
+    {
+        d_numArgs = rhs.d_numArgs;
+        d_sum     = rhs.d_sum;
+        return *this;
+    }
+
+    // ACCESSORS
+    bslma::Allocator *allocator() const { return d_allocator_p; }
+    int numArgs() const                 { return d_numArgs; }
+    int sum() const                     { return d_sum; }
+};
+
+int EmplacedType::s_numCopies = 0;
+
 //=============================================================================
 //                  GLOBAL HELPER FUNCTIONS FOR TESTING
 //-----------------------------------------------------------------------------
@@ -843,6 +967,40 @@ bool lessThanFunction(const TYPE& lhs, const TYPE& rhs)
          < bsltf::TemplateTestFacility::getIdentifier<TYPE>(rhs);
 }
 
+struct RankedLess {
+    // This test 'struct' provides a less-than comparator for 'int' values
+    // that is associated with the 'bslstl::MaintainsSubtreeSizes' trait.
+
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(RankedLess, bslstl::MaintainsSubtreeSizes);
+
+    // ACCESSORS
+    bool operator()(int lhs, int rhs) const
+        // Return 'true' if the specified 'lhs' is less than the specified
+        // 'rhs', and 'false' otherwise.
+    {
+        return lhs < rhs;
+    }
+};
+
+template <class OBJ>
+void verifyOrderStatistics(int line, const OBJ& X)
+    // Verify, reporting failures with the specified 'line', that 'nth' and
+    // 'rank' of the specified map 'X' agree with a traversal of 'X'.
+{
+    typename OBJ::size_type index = 0;
+    for (typename OBJ::const_iterator it = X.begin(); it != X.end(); ++it) {
+        ASSERTV(line, index, it->first, it == X.nth(index));
+        ASSERTV(line, index, it->first, index     == X.rank(it->first));
+        ASSERTV(line, index, it->first, index + 1 == X.rank(it->first + 1));
+        ++index;
+    }
+    ASSERTV(line, X.size(), index, X.size() == index);
+    ASSERTV(line, X.size(), X.end() == X.nth(X.size()));
+    ASSERTV(line, X.size(), X.size() == X.rank(INT_MAX));
+    ASSERTV(line, X.size(), 0 == X.rank(INT_MIN));
+}
+
 }  // close unnamed namespace
 
 // ============================================================================
@@ -6579,7 +6737,7 @@ int main(int argc, char *argv[])
     bslma::Default::setGlobalAllocator(&globalAllocator);
 
     switch (test) { case 0:
-      case 27: {
+      case 32: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //
@@ -6622,6 +6780,1066 @@ int main(int argc, char *argv[])
             ASSERT(0 < objectAllocator.numBytesInUse());
         }
       } break;
+      case 31: {
+        // --------------------------------------------------------------------
+        // TESTING ORDER STATISTICS
+        //
+        // Concerns:
+        //: 1 A map whose comparator is associated with the
+        //:   'bslstl::MaintainsSubtreeSizes' trait provides 'nth' and 'rank',
+        //:   which agree with a traversal of the map.
+        //:
+        //: 2 The results remain accurate after inserting and erasing elements
+        //:   by each of the manipulators of the map.
+        //:
+        //: 3 The results are accurate for maps built by copying, by
+        //:   constructing from ordered and unordered ranges, and by 'merge',
+        //:   'mergeUnion', 'intersect', 'subtract', and 'swap'.
+        //:
+        //: 4 'nth' returns a modifiable iterator for a modifiable map.
+        //:
+        //: 5 A map with a comparator not associated with the trait is
+        //:   unaffected.
+        //:
+        //: 6 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Insert keys in a permuted order, using each of the insertion
+        //:   methods in turn, and verify 'nth' and 'rank' against a traversal
+        //:   of the map after each insertion.  (C-1..2)
+        //:
+        //: 2 Erase, and extract and reinsert, elements using each method, and
+        //:   verify 'nth' and 'rank' after each.  (C-2)
+        //:
+        //: 3 Build maps by each of the operations in C-3, and verify 'nth' and
+        //:   'rank' on the results.  (C-3)
+        //:
+        //: 4 Modify the mapped values of a map through the iterators returned
+        //:   by 'nth'.  (C-4)
+        //:
+        //: 5 Verify the trait for the default comparator, and exercise a map
+        //:   using it.  (C-5)
+        //:
+        //: 6 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for an index greater than the size (using the
+        //:   'BSLS_ASSERTTEST_*' macros).  (C-6)
+        //
+        // Testing:
+        //   iterator nth(size_type index);
+        //   const_iterator nth(size_type index) const;
+        //   size_type rank(const key_type& key) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING ORDER STATISTICS"
+                            "\n========================\n");
+
+        typedef bsl::map<int, int, RankedLess> Obj;
+        typedef Obj::value_type                IntPair;
+        typedef bsl::vector<IntPair>           Range;
+
+        ASSERT( bslstl::MaintainsSubtreeSizes<RankedLess>::value);
+        ASSERT(!bslstl::MaintainsSubtreeSizes<std::less<int> >::value);
+
+        const int NUM_VALUES = 97;  // prime, so that '(i * 31) % NUM_VALUES'
+                                    // is a permutation of '[0 .. NUM_VALUES)'
+
+        bslma::TestAllocator         da("default", veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+        bslma::TestAllocator za("other",   veryVeryVeryVerbose);
+        bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+
+        if (verbose) printf("Testing insertion.\n");
+
+        Obj mX(&oa);  const Obj& X = mX;
+        verifyOrderStatistics(L_, X);
+        for (int i = 0; i < NUM_VALUES; ++i) {
+            const int KEY = 2 * ((i * 31) % NUM_VALUES);
+
+            switch (i % 5) {
+              case 0: {
+                mX.insert(IntPair(KEY, i));
+              } break;
+              case 1: {
+                mX.insert(X.lower_bound(KEY), IntPair(KEY, i));
+              } break;
+              case 2: {
+                mX[KEY] = i;
+              } break;
+              case 3: {
+                mX.try_emplace(KEY, i);
+              } break;
+              case 4: {
+                mX.insert_or_assign(X.begin(), KEY, i);
+              } break;
+            }
+            verifyOrderStatistics(L_, X);
+        }
+        ASSERTV(X.size(), NUM_VALUES == static_cast<int>(X.size()));
+
+        if (verbose) printf("Testing modifiable access.\n");
+
+        for (int i = 0; i < NUM_VALUES; ++i) {
+            mX.nth(i)->second = i;
+        }
+        for (Obj::const_iterator it = X.begin(); it != X.end(); ++it) {
+            ASSERTV(it->first, it->second, it->first == 2 * it->second);
+        }
+
+        if (verbose) printf("Testing copying and swapping.\n");
+        {
+            const Obj Y(X, &sa);
+            verifyOrderStatistics(L_, Y);
+
+            Obj mZ(&sa);  const Obj& Z = mZ;
+            mZ = X;
+            verifyOrderStatistics(L_, Z);
+
+            mZ.erase(mZ.nth(NUM_VALUES / 2));
+            mZ.swap(mX);
+            verifyOrderStatistics(L_, X);
+            verifyOrderStatistics(L_, Z);
+            ASSERTV(X.size(), NUM_VALUES - 1 == static_cast<int>(X.size()));
+
+            mX = Y;
+            ASSERT(Y == X);
+        }
+
+        if (verbose) printf("Testing erasure and extraction.\n");
+        {
+            Obj mY(X, &oa);  const Obj& Y = mY;
+
+            for (int i = 0; i < NUM_VALUES; i += 3) {
+                const int KEY = 2 * ((i * 31) % NUM_VALUES);
+
+                switch (i % 4) {
+                  case 0: {
+                    ASSERTV(KEY, 1 == mY.erase(KEY));
+                  } break;
+                  case 1: {
+                    mY.erase(Y.find(KEY));
+                  } break;
+                  case 2: {
+                    Obj::node_type node = mY.extract(KEY);
+                    verifyOrderStatistics(L_, Y);
+                    mY.insert(node);
+                    verifyOrderStatistics(L_, Y);
+                    node = mY.extract(Y.find(KEY));
+                  } break;
+                  case 3: {
+                    Obj::node_type node = mY.extract(KEY);
+                    mY.insert(Y.end(), node);
+                    verifyOrderStatistics(L_, Y);
+                    mY.erase(Y.find(KEY));
+                  } break;
+                }
+                verifyOrderStatistics(L_, Y);
+            }
+
+            mY.erase(Y.nth(Y.size() / 4), Y.nth(Y.size() / 2));
+            verifyOrderStatistics(L_, Y);
+
+            mY.clear();
+            verifyOrderStatistics(L_, Y);
+        }
+
+        if (verbose) printf("Testing construction from ranges.\n");
+
+        for (int ordered = 0; ordered < 2; ++ordered) {
+            Range range(&sa);
+            for (int i = 0; i < NUM_VALUES; ++i) {
+                const int KEY = ordered ? i : (i * 31) % NUM_VALUES;
+                range.push_back(IntPair(KEY, i));
+            }
+
+            const Obj Y(range.begin(), range.end(), RankedLess(), &oa);
+            verifyOrderStatistics(L_, Y);
+
+            Obj mZ(&oa);  const Obj& Z = mZ;
+            mZ.insert(range.begin(), range.end());
+            verifyOrderStatistics(L_, Z);
+
+            mZ.insert(range.begin(), range.end());
+            verifyOrderStatistics(L_, Z);
+            ASSERT(Y == Z);
+        }
+
+        if (verbose) printf("Testing set operations.\n");
+
+        for (int step = 1; step <= 5; ++step) {
+            Obj mY(&oa);  const Obj& Y = mY;
+            for (int i = 0; i < NUM_VALUES; ++i) {
+                mY[3 * i * step % (2 * NUM_VALUES)] = i;
+            }
+            verifyOrderStatistics(L_, Y);
+
+            if (veryVerbose) { T_ P_(step) P(Y.size()) }
+
+            {
+                Obj mZ(X, &oa);  const Obj& Z = mZ;
+                Obj mW(Y, &za);  const Obj& W = mW;
+
+                mZ.merge(mW);
+                verifyOrderStatistics(L_, Z);
+                verifyOrderStatistics(L_, W);
+            }
+            for (int cfg = 0; cfg < 2; ++cfg) {
+                Obj mZ(X, &oa);                const Obj& Z = mZ;
+                Obj mW(Y, cfg ? &za : &oa);    const Obj& W = mW;
+
+                mZ.mergeUnion(mW);
+                verifyOrderStatistics(L_, Z);
+                verifyOrderStatistics(L_, W);
+            }
+            {
+                Obj mZ(X, &oa);  const Obj& Z = mZ;
+
+                mZ.intersect(Y);
+                verifyOrderStatistics(L_, Z);
+            }
+            {
+                Obj mZ(X, &oa);  const Obj& Z = mZ;
+
+                mZ.subtract(Y);
+                verifyOrderStatistics(L_, Z);
+            }
+        }
+
+        if (verbose) printf("Testing the default comparator.\n");
+        {
+            typedef bsl::map<int, int> IntMap;
+
+            IntMap mY(&oa);  const IntMap& Y = mY;
+            for (int i = 0; i < NUM_VALUES; ++i) {
+                mY[(i * 31) % NUM_VALUES] = i;
+            }
+            IntMap mZ(Y, &oa);  const IntMap& Z = mZ;
+            mZ.subtract(Y);
+            ASSERTV(Y.size(), NUM_VALUES == static_cast<int>(Y.size()));
+            ASSERT(Z.empty());
+        }
+
+        if (verbose) printf("Negative testing.\n");
+        {
+            bsls::AssertFailureHandlerGuard hG(
+                                             bsls::AssertTest::failTestDriver);
+
+            ASSERT_SAFE_PASS(X.nth(X.size()));
+            ASSERT_SAFE_FAIL(X.nth(X.size() + 1));
+            ASSERT_SAFE_PASS(mX.nth(0));
+            ASSERT_SAFE_FAIL(mX.nth(X.size() + 1));
+        }
+
+        ASSERTV(da.numBlocksTotal(), 0 == da.numBlocksTotal());
+      } break;
+      case 30: {
+        // --------------------------------------------------------------------
+        // TESTING SET OPERATIONS
+        //
+        // Concerns:
+        //: 1 'mergeUnion' leaves this map holding each key of either map, the
+        //:   objects of this map being kept for the keys held by both maps,
+        //:   and leaves the other map empty.
+        //:
+        //: 2 'intersect' and 'subtract' leave this map holding the objects
+        //:   whose keys are held, or are not held, respectively, by the other
+        //:   map, which is not modified.
+        //:
+        //: 3 If both maps use the same allocator, 'mergeUnion' allocates no
+        //:   memory, and the objects it moves keep their addresses.
+        //:
+        //: 4 If the allocators differ, the objects moved by 'mergeUnion' use
+        //:   the allocator of this map.
+        //:
+        //: 5 Applying 'mergeUnion' or 'intersect' to a map and itself has no
+        //:   effect, and applying 'subtract' empties the map.
+        //:
+        //: 6 If an exception is thrown by 'mergeUnion', this map is left
+        //:   unchanged, and no memory is leaked.
+        //
+        // Plan:
+        //: 1 For each pair of rows of a table of arithmetic sequences of keys,
+        //:   apply each operation to maps holding these keys, mapped to
+        //:   values identifying the map, using the same and different
+        //:   allocators, and compare the results with maps built by
+        //:   inserting the expected objects one at a time.  (C-1..2)
+        //:
+        //: 2 Using a test allocator monitor, apply 'mergeUnion' to maps using
+        //:   the same allocator and verify the addresses of the moved
+        //:   objects, then to maps using different allocators and verify the
+        //:   allocators of the moved objects.  (C-3..4)
+        //:
+        //: 3 Apply each operation to a map and itself.  (C-5)
+        //:
+        //: 4 Apply 'mergeUnion' to maps using different allocators in the
+        //:   presence of injected exceptions (using the
+        //:   'BSLMA_TESTALLOCATOR_EXCEPTION_TEST_*' macros), and verify this
+        //:   map after each exception.  (C-6)
+        //
+        // Testing:
+        //   void mergeUnion(map& other);
+        //   void intersect(const map& other);
+        //   void subtract(const map& other);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING SET OPERATIONS"
+                            "\n======================\n");
+
+        typedef bsl::map<int, int> IntMap;
+
+        static const struct {
+            int d_line;   // source line number
+            int d_first;  // first key
+            int d_step;   // difference between consecutive keys
+            int d_count;  // number of keys
+        } DATA[] = {
+            //line  first  step  count
+            //----  -----  ----  -----
+            { L_,       0,    1,     0 },
+            { L_,       0,    1,     1 },
+            { L_,       5,    1,     1 },
+            { L_,       0,    1,    10 },
+            { L_,       0,    2,    10 },
+            { L_,       1,    3,    10 },
+            { L_,      20,    1,    10 },
+            { L_,       0,    1,   300 },
+            { L_,     150,    7,   100 },
+            { L_,     300,    2,   200 },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        bslma::TestAllocator         da("default", veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        if (verbose) printf("Testing the resulting values.\n");
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int LINE1 = DATA[ti].d_line;
+
+            bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+
+            IntMap mL(&sa);  const IntMap& L = mL;
+            for (int i = 0; i < DATA[ti].d_count; ++i) {
+                mL[DATA[ti].d_first + i * DATA[ti].d_step] = 1;
+            }
+
+            for (int tj = 0; tj < NUM_DATA; ++tj) {
+                const int LINE2 = DATA[tj].d_line;
+
+                IntMap mR(&sa);  const IntMap& R = mR;
+                for (int i = 0; i < DATA[tj].d_count; ++i) {
+                    mR[DATA[tj].d_first + i * DATA[tj].d_step] = 2;
+                }
+
+                if (veryVerbose) { T_ P_(LINE1) P(LINE2) }
+
+                IntMap expUnion(L, &sa);
+                IntMap expIntersection(&sa);
+                IntMap expDifference(&sa);
+                expUnion.insert(R.begin(), R.end());
+                for (IntMap::const_iterator it = L.begin(); it != L.end();
+                                                                        ++it) {
+                    if (R.count(it->first)) {
+                        expIntersection.insert(*it);
+                    }
+                    else {
+                        expDifference.insert(*it);
+                    }
+                }
+
+                bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+                bslma::TestAllocator za("other",  veryVeryVeryVerbose);
+
+                for (int cfg = 0; cfg < 2; ++cfg) {
+                    IntMap mX(L, &oa);                const IntMap& X = mX;
+                    IntMap mY(R, cfg ? &za : &oa);    const IntMap& Y = mY;
+
+                    mX.mergeUnion(mY);
+                    ASSERTV(LINE1, LINE2, cfg, expUnion == X);
+                    ASSERTV(LINE1, LINE2, cfg, Y.empty());
+                }
+                {
+                    IntMap mX(L, &oa);  const IntMap& X = mX;
+                    const IntMap Y(R, &oa);
+
+                    mX.intersect(Y);
+                    ASSERTV(LINE1, LINE2, expIntersection == X);
+                    ASSERTV(LINE1, LINE2, R == Y);
+                }
+                {
+                    IntMap mX(L, &oa);  const IntMap& X = mX;
+                    const IntMap Y(R, &oa);
+
+                    mX.subtract(Y);
+                    ASSERTV(LINE1, LINE2, expDifference == X);
+                    ASSERTV(LINE1, LINE2, R == Y);
+                }
+                ASSERTV(LINE1, LINE2, oa.numBlocksInUse(),
+                        0 == oa.numBlocksInUse());
+                ASSERTV(LINE1, LINE2, za.numBlocksInUse(),
+                        0 == za.numBlocksInUse());
+            }
+        }
+
+        typedef bsltf::AllocBitwiseMoveableTestType Element;
+        typedef bsl::map<int, Element>              Obj;
+
+        const int NUM_VALUES = 16;
+
+        if (verbose) printf("Testing the reuse of nodes.\n");
+        {
+            bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+            bslma::TestAllocator za("other",   veryVeryVeryVerbose);
+            bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+            {
+                Obj mX(&oa);  const Obj& X = mX;
+                Obj mY(&oa);  const Obj& Y = mY;
+                Obj mZ(&za);  const Obj& Z = mZ;
+
+                IntMap expected(&sa);
+                for (int i = 0; i < NUM_VALUES; ++i) {
+                    mX.insert(Obj::value_type(2 * i, Element(1, &sa)));
+                    mY.insert(Obj::value_type(3 * i, Element(2, &sa)));
+                    mZ.insert(Obj::value_type(5 * i + 1, Element(3, &sa)));
+                    expected.insert(IntMap::value_type(2 * i, 1));
+                }
+                for (int i = 0; i < NUM_VALUES; ++i) {
+                    expected.insert(IntMap::value_type(3 * i, 2));
+                }
+
+                const Element *KEPT  = &X.find(0)->second;
+                const Element *MOVED = &Y.find(3)->second;
+
+                bslma::TestAllocatorMonitor oam(&oa);
+
+                mX.mergeUnion(mY);
+
+                ASSERT(oam.isTotalSame());
+                ASSERT(Y.empty());
+                ASSERTV(X.size(), expected.size() == X.size());
+                ASSERT(KEPT  == &X.find(0)->second);
+                ASSERT(MOVED == &X.find(3)->second);
+
+                for (int i = 0; i < NUM_VALUES; ++i) {
+                    expected.insert(IntMap::value_type(5 * i + 1, 3));
+                }
+
+                mX.mergeUnion(mZ);
+
+                ASSERT(Z.empty());
+                ASSERTV(X.size(), expected.size() == X.size());
+                for (Obj::const_iterator it = X.begin(); it != X.end(); ++it) {
+                    ASSERTV(it->first, expected.count(it->first));
+                    ASSERTV(it->first, expected[it->first] ==
+                                                         it->second.data());
+                    ASSERTV(it->first, &oa == it->second.allocator());
+                }
+
+                // 'Y', which is empty and has no nodes left, can be reused.
+
+                mY.insert(Obj::value_type(1, Element(1, &sa)));
+                ASSERTV(Y.size(), 1 == Y.size());
+            }
+            ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+            ASSERTV(za.numBlocksInUse(), 0 == za.numBlocksInUse());
+        }
+
+        if (verbose) printf("Testing aliasing.\n");
+        {
+            bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+            bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+
+            Obj mX(&oa);  const Obj& X = mX;
+            for (int i = 0; i < NUM_VALUES; ++i) {
+                mX.insert(Obj::value_type(i, Element(i, &sa)));
+            }
+            const Obj W(X, &sa);
+
+            mX.mergeUnion(mX);
+            ASSERT(W == X);
+
+            mX.intersect(X);
+            ASSERT(W == X);
+
+            mX.subtract(X);
+            ASSERT(X.empty());
+        }
+
+        if (verbose) printf("Testing exception safety.\n");
+        {
+            bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+            bslma::TestAllocator za("other",   veryVeryVeryVerbose);
+            bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+            {
+                Obj mX(&oa);  const Obj& X = mX;
+                for (int i = 0; i < NUM_VALUES; ++i) {
+                    mX.insert(Obj::value_type(2 * i, Element(1, &sa)));
+                }
+                const Obj W(X, &sa);
+
+                BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                    ASSERT(W == X);
+
+                    Obj mZ(&za);
+                    for (int i = 0; i < NUM_VALUES; ++i) {
+                        mZ.insert(Obj::value_type(3 * i, Element(2, &sa)));
+                    }
+
+                    mX.mergeUnion(mZ);
+                } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+                ASSERTV(X.size(), 2 * NUM_VALUES - 6 == X.size());
+            }
+            ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+            ASSERTV(za.numBlocksInUse(), 0 == za.numBlocksInUse());
+        }
+      } break;
+      case 29: {
+        // --------------------------------------------------------------------
+        // TESTING CONSTRUCTION FROM ORDERED RANGES
+        //
+        // Concerns:
+        //: 1 Constructing a map from a range, or inserting a range into an
+        //:   empty map, yields a map holding, for each distinct key in the
+        //:   range, the first value having that key, whether the keys of the
+        //:   range are increasing, non-decreasing, or ordered only up to some
+        //:   position.
+        //:
+        //: 2 Inserting a range into a non-empty map is unaffected.
+        //:
+        //: 3 When the length of the range can be determined in advance, the
+        //:   nodes for the range are obtained from the allocator in a single
+        //:   allocation.
+        //:
+        //: 4 If an exception is thrown, the map is left valid, holding a
+        //:   subset of the values in the range, and no memory is leaked.
+        //
+        // Plan:
+        //: 1 For each row of a table of ranges, generated from an increasing
+        //:   sequence of keys by repeating each key and by making the keys
+        //:   after some position decreasing, and smaller than the keys before
+        //:   that position, construct a map from the range, insert the range
+        //:   into an empty map and into a map holding other values, and
+        //:   compare the results with maps built by inserting the values one
+        //:   at a time.  (C-1..2)
+        //:
+        //: 2 Verify that constructing a map from a range allocates a single
+        //:   block.  (C-3)
+        //:
+        //: 3 Insert each range into an empty map in the presence of injected
+        //:   exceptions (using the 'BSLMA_TESTALLOCATOR_EXCEPTION_TEST_*'
+        //:   macros), and verify the map after each exception.  (C-4)
+        //
+        // Testing:
+        //   CONCERN: Construction from an ordered range takes linear time.
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING CONSTRUCTION FROM ORDERED RANGES"
+                            "\n========================================\n");
+
+        typedef bsl::map<int, int>   IntMap;
+        typedef IntMap::value_type   IntPair;
+        typedef bsl::vector<IntPair> Range;
+
+        static const struct {
+            int d_line;        // source line number
+            int d_length;      // number of values in the range
+            int d_repeat;      // number of consecutive values having each key
+            int d_orderedLen;  // length of the ordered prefix of the range
+        } DATA[] = {
+            //line  length  repeat  ordered
+            //----  ------  ------  -------
+            { L_,        0,      1,       0 },
+            { L_,        1,      1,       1 },
+            { L_,        2,      1,       2 },
+            { L_,        2,      1,       1 },
+            { L_,        2,      2,       2 },
+            { L_,        3,      1,       3 },
+            { L_,        7,      1,       7 },
+            { L_,        7,      3,       7 },
+            { L_,        7,      1,       4 },
+            { L_,        8,      1,       8 },
+            { L_,        8,      2,       5 },
+            { L_,      100,      1,     100 },
+            { L_,      100,      3,     100 },
+            { L_,      100,      1,      50 },
+            { L_,      100,      1,       1 },
+            { L_,     1000,      1,    1000 },
+            { L_,     1000,      4,     999 },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        bslma::TestAllocator         da("default", veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int LINE    = DATA[ti].d_line;
+            const int LENGTH  = DATA[ti].d_length;
+            const int REPEAT  = DATA[ti].d_repeat;
+            const int ORDERED = DATA[ti].d_orderedLen;
+
+            if (veryVerbose) { T_ P_(LINE) P_(LENGTH) P_(REPEAT) P(ORDERED) }
+
+            bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+
+            Range range(&sa);
+            for (int i = 0; i < LENGTH; ++i) {
+                const int position = i < ORDERED
+                                   ? LENGTH - ORDERED + i
+                                   : LENGTH - 1 - i;
+                range.push_back(IntPair(position / REPEAT, i));
+            }
+
+            IntMap expected(&sa);
+            for (int i = 0; i < LENGTH; ++i) {
+                expected.insert(range[i]);
+            }
+
+            {
+                bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+                const IntMap X(range.begin(), range.end(), std::less<int>(),
+                               &oa);
+
+                ASSERTV(LINE, expected == X);
+                ASSERTV(LINE, oa.numBlocksTotal(),
+                        (0 < LENGTH ? 1 : 0) == oa.numBlocksTotal());
+            }
+            {
+                bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+                IntMap mX(&oa);  const IntMap& X = mX;
+                mX.insert(range.begin(), range.end());
+
+                ASSERTV(LINE, expected == X);
+            }
+            {
+                bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+                IntMap mX(&oa);  const IntMap& X = mX;
+                mX[-1]     = -1;
+                mX[LENGTH] = -1;
+                mX.insert(range.begin(), range.end());
+
+                IntMap mY(expected, &sa);  const IntMap& Y = mY;
+                mY[-1]     = -1;
+                mY[LENGTH] = -1;
+
+                ASSERTV(LINE, Y == X);
+            }
+            {
+                bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+                IntMap mX(&oa);  const IntMap& X = mX;
+
+                BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                    ASSERTV(LINE, X.size() <= expected.size());
+                    for (IntMap::const_iterator it = X.begin();
+                                                       it != X.end(); ++it) {
+                        ASSERTV(LINE, 1 == expected.count(it->first));
+                    }
+                    mX.clear();
+
+                    mX.insert(range.begin(), range.end());
+                } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+                ASSERTV(LINE, expected == X);
+            }
+            ASSERTV(LINE, da.numBlocksTotal(), 0 == da.numBlocksTotal());
+        }
+      } break;
+      case 28: {
+        // --------------------------------------------------------------------
+        // TESTING 'try_emplace' AND 'insert_or_assign'
+        //
+        // Concerns:
+        //: 1 'try_emplace' inserts an element whose key is a copy of the
+        //:   supplied key and whose mapped value is constructed from the
+        //:   remaining arguments (or value-initialized if there are none),
+        //:   using the allocator of the map.
+        //:
+        //: 2 If the key is present, 'try_emplace' constructs no mapped value,
+        //:   allocates no memory, and leaves the element unchanged.
+        //:
+        //: 3 If constructing the mapped value throws, the map is
+        //:   unchanged and the node is returned to its pool.
+        //:
+        //: 4 'insert_or_assign' assigns the supplied object to the mapped
+        //:   value of an element having the supplied key, without allocating
+        //:   memory, and otherwise inserts an element whose mapped value is
+        //:   constructed from that object.
+        //:
+        //: 5 'operator[]' value-initializes the mapped value of a new element
+        //:   in place.
+        //:
+        //: 6 No temporary 'value_type' object is created, no memory is
+        //:   allocated from the default allocator, and no memory is leaked.
+        //
+        // Plan:
+        //: 1 Using a map whose mapped type, 'EmplacedType', records its
+        //:   constructor arguments and allocator and counts its copies, call
+        //:   'try_emplace' with and without a hint, with each number of
+        //:   mapped arguments, for missing and present keys, and verify the
+        //:   elements, the number of copies made, and (using a test allocator
+        //:   monitor) the memory allocated.  (C-1..2, 6)
+        //:
+        //: 2 Supply a negative mapped argument, so that the constructor of
+        //:   'EmplacedType' throws, twice, and verify that the map is
+        //:   unchanged and that the second attempt allocates no memory.  (C-3)
+        //:
+        //: 3 Call 'insert_or_assign', with and without a hint, for present
+        //:   and missing keys, and 'operator[]' for a missing key, and verify
+        //:   the elements and the memory allocated.  (C-4..6)
+        //
+        // Testing:
+        //   pair<iterator, bool> try_emplace(const key_type&, Args&&...);
+        //   iterator try_emplace(const_iterator, const key_type&, Args&&...);
+        //   pair<iterator, bool> insert_or_assign(const key_type&, OBJ&&);
+        //   iterator insert_or_assign(const_iterator, const key_type&, OBJ&&);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf(
+                           "\nTESTING 'try_emplace' AND 'insert_or_assign'"
+                           "\n============================================\n");
+
+        typedef bsl::map<int, EmplacedType> Obj;
+
+        const int NUM_VALUES = 8;
+
+        bslma::TestAllocator da("default", veryVeryVeryVerbose);
+        bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+
+        bslma::DefaultAllocatorGuard dag(&da);
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+
+            const int NUM_COPIES = EmplacedType::numCopies();
+
+            if (verbose) printf("Testing 'try_emplace'.\n");
+
+            for (int i = 0; i != NUM_VALUES; ++i) {
+                const int NUM_ARGS = i % 4;
+
+                bsl::pair<Obj::iterator, bool> result;
+                switch (NUM_ARGS) {
+                  case 0: result = mX.try_emplace(i);          break;
+                  case 1: result = mX.try_emplace(i, 1);       break;
+                  case 2: result = mX.try_emplace(i, 1, 2);    break;
+                  case 3: result = mX.try_emplace(i, 1, 2, 3); break;
+                }
+
+                const EmplacedType& V = result.first->second;
+
+                ASSERTV(i, result.second);
+                ASSERTV(i, i        == result.first->first);
+                ASSERTV(i, NUM_ARGS == V.numArgs());
+                ASSERTV(i, V.sum(), NUM_ARGS * (NUM_ARGS + 1) / 2 == V.sum());
+                ASSERTV(i, &oa      == V.allocator());
+            }
+            ASSERTV(X.size(), NUM_VALUES == X.size());
+
+            for (int i = 0; i != NUM_VALUES; ++i) {
+                const int NUM_ARGS = i % 4;
+
+                bslma::TestAllocatorMonitor oam(&oa);
+
+                bsl::pair<Obj::iterator, bool> result =
+                                                   mX.try_emplace(i, 5, 6, 7);
+                ASSERTV(i, !result.second);
+                ASSERTV(i, NUM_ARGS == result.first->second.numArgs());
+
+                Obj::iterator it = mX.try_emplace(X.begin(), i, 5);
+                ASSERTV(i, result.first == it);
+                ASSERTV(i, NUM_ARGS == it->second.numArgs());
+
+                it = mX.try_emplace(X.end(), i);
+                ASSERTV(i, result.first == it);
+                ASSERTV(i, NUM_ARGS == it->second.numArgs());
+
+                ASSERTV(i, oam.isTotalSame());
+            }
+            ASSERTV(X.size(), NUM_VALUES == X.size());
+
+            for (int i = NUM_VALUES; i != 2 * NUM_VALUES; ++i) {
+                Obj::iterator it = mX.try_emplace(X.end(), i, i);
+
+                ASSERTV(i, i    == it->first);
+                ASSERTV(i, 1    == it->second.numArgs());
+                ASSERTV(i, i    == it->second.sum());
+                ASSERTV(i, &oa  == it->second.allocator());
+            }
+            ASSERTV(X.size(), 2 * NUM_VALUES == X.size());
+            ASSERTV(EmplacedType::numCopies(),
+                    NUM_COPIES == EmplacedType::numCopies());
+
+#ifdef BDE_BUILD_TARGET_EXC
+            if (verbose) printf("Testing exceptions.\n");
+
+            for (int attempt = 0; attempt != 2; ++attempt) {
+                bslma::TestAllocatorMonitor oam(&oa);
+
+                bool caught = false;
+                try {
+                    mX.try_emplace(X.begin(), 2 * NUM_VALUES, -1, 2);
+                }
+                catch (int) {
+                    caught = true;
+                }
+                ASSERTV(attempt, caught);
+                ASSERTV(attempt, 2 * NUM_VALUES == X.size());
+                ASSERTV(attempt, X.end() == X.find(2 * NUM_VALUES));
+                if (attempt) {
+                    ASSERTV(attempt, oam.isTotalSame());
+                }
+            }
+#endif
+
+            if (verbose) printf("Testing 'insert_or_assign'.\n");
+
+            const EmplacedType V(4, 5, 6);
+            {
+                bslma::TestAllocatorMonitor oam(&oa);
+
+                bsl::pair<Obj::iterator, bool> result =
+                                                    mX.insert_or_assign(0, V);
+                ASSERT(!result.second);
+                ASSERTV(result.first->first, 0 == result.first->first);
+                ASSERTV(result.first->second.sum(),
+                        15 == result.first->second.sum());
+                ASSERT(&oa == result.first->second.allocator());
+
+                Obj::iterator it = mX.insert_or_assign(X.end(), 1, V);
+                ASSERTV(it->first,        1  == it->first);
+                ASSERTV(it->second.sum(), 15 == it->second.sum());
+                ASSERT(&oa == it->second.allocator());
+
+                ASSERT(oam.isTotalSame());
+                ASSERTV(EmplacedType::numCopies(),
+                        NUM_COPIES == EmplacedType::numCopies());
+            }
+
+            bsl::pair<Obj::iterator, bool> result =
+                                     mX.insert_or_assign(2 * NUM_VALUES, V);
+            ASSERT(result.second);
+            ASSERTV(result.first->second.sum(),
+                    15 == result.first->second.sum());
+            ASSERT(&oa == result.first->second.allocator());
+
+            Obj::iterator it = mX.insert_or_assign(X.begin(),
+                                                   2 * NUM_VALUES + 1,
+                                                   V);
+            ASSERTV(it->first, 2 * NUM_VALUES + 1 == it->first);
+            ASSERTV(it->second.sum(), 15 == it->second.sum());
+            ASSERT(&oa == it->second.allocator());
+
+            ASSERTV(X.size(), 2 * NUM_VALUES + 2 == X.size());
+            ASSERTV(EmplacedType::numCopies(),
+                    NUM_COPIES + 2 == EmplacedType::numCopies());
+
+            if (verbose) printf("Testing 'operator[]'.\n");
+
+            EmplacedType& v = mX[3 * NUM_VALUES];
+            ASSERTV(v.numArgs(), 0 == v.numArgs());
+            ASSERT(&oa == v.allocator());
+            ASSERT(&v  == &mX[3 * NUM_VALUES]);
+            ASSERTV(X.size(), 2 * NUM_VALUES + 3 == X.size());
+            ASSERTV(EmplacedType::numCopies(),
+                    NUM_COPIES + 2 == EmplacedType::numCopies());
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+        ASSERTV(da.numBlocksTotal(), 0 == da.numBlocksTotal());
+      } break;
+      case 27: {
+        // --------------------------------------------------------------------
+        // TESTING NODE HANDLES
+        //
+        // Concerns:
+        //: 1 'extract' removes the element at a position, or having a key,
+        //:   and returns a handle holding that element and the allocator of
+        //:   the container; extracting a missing key yields an empty handle.
+        //:
+        //: 2 'insert' inserts the element held by a handle, and empties the
+        //:   handle, unless an element having the same key is present, in
+        //:   which case the handle is left unchanged.  Inserting an empty
+        //:   handle has no effect.
+        //:
+        //: 3 An element held by a handle is inserted into a container using
+        //:   the same allocator without allocating memory, even if the
+        //:   container it was extracted from has been destroyed.
+        //:
+        //: 4 'merge' moves each element of the source whose key is not
+        //:   present in the target, including when the two containers use
+        //:   different allocators, and the moved elements then use the
+        //:   allocator of the target.
+        //:
+        //: 5 Merging a container with itself has no effect.
+        //:
+        //: 6 Repeatedly inserting into a container, and erasing, elements
+        //:   extracted from short-lived containers does not increase the
+        //:   memory used by that container.
+        //:
+        //: 7 No memory is leaked.
+        //
+        // Plan:
+        //: 1 Extract elements from a container, and insert them into the same
+        //:   and another container, verifying the sizes of the containers, the
+        //:   state of the handles, and (using a test allocator monitor) that
+        //:   no memory is allocated by 'insert'.  Repeat with a handle
+        //:   outliving the container it was extracted from.  (C-1..3)
+        //:
+        //: 2 Merge containers using the same and different allocators, and
+        //:   verify the sizes of the containers and the allocators of the
+        //:   moved elements.  (C-4..5)
+        //:
+        //: 3 Repeatedly extract an element from a temporary container, insert
+        //:   it into a container and erase it, and verify that the number of
+        //:   blocks in use does not change.  (C-6)
+        //:
+        //: 4 Verify that no memory is in use once the containers are
+        //:   destroyed.  (C-7)
+        //
+        // Testing:
+        //   node_type extract(const_iterator position);
+        //   node_type extract(const key_type& key);
+        //   bsl::pair<iterator, bool> insert(node_type& node);
+        //   iterator insert(const_iterator hint, node_type& node);
+        //   void merge(map& source);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING NODE HANDLES"
+                            "\n====================\n");
+
+        typedef bsltf::AllocBitwiseMoveableTestType Element;
+        typedef bsl::map<int, Element>              Obj;
+        typedef Obj::node_type                      Handle;
+
+        const int NUM_VALUES = 8;
+
+        bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+        bslma::TestAllocator za("other",   veryVeryVeryVerbose);
+        bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+            Obj mY(&oa);  const Obj& Y = mY;
+            Obj mZ(&za);  const Obj& Z = mZ;
+
+            for (int i = 0; i != NUM_VALUES; ++i) {
+                mX.insert(Obj::value_type(i, Element(i, &sa)));
+                if (i % 2) {
+                    mY.insert(Obj::value_type(i, Element(i, &sa)));
+                }
+                if (i >= NUM_VALUES - 2) {
+                    mZ.insert(Obj::value_type(i, Element(i, &sa)));
+                    mZ.insert(Obj::value_type(i + 2, Element(i + 2, &sa)));
+                }
+            }
+            ASSERTV(Z.size(), 4 == Z.size());
+
+            if (verbose) printf("Testing 'extract'.\n");
+
+            Handle mH = mX.extract(X.find(0));  const Handle& H = mH;
+            ASSERT(!H.empty());
+            ASSERTV(H.value().first, 0 == H.value().first);
+            ASSERT(X.get_allocator() == H.get_allocator());
+            ASSERTV(X.size(), NUM_VALUES - 1 == X.size());
+            ASSERT(X.end() == X.find(0));
+
+            Handle mG(mX.extract(1));  const Handle& G = mG;
+            ASSERT(!G.empty());
+            ASSERTV(G.value().first, 1 == G.value().first);
+            ASSERTV(X.size(), NUM_VALUES - 2 == X.size());
+
+            ASSERT(mX.extract(1).empty());
+            ASSERTV(X.size(), NUM_VALUES - 2 == X.size());
+
+            if (verbose) printf("Testing 'insert'.\n");
+
+            const Obj::size_type SIZE_Y = Y.size();
+
+            bsl::pair<Obj::iterator, bool> result = mY.insert(mG);
+            ASSERT(!result.second);
+            ASSERTV(result.first->first, 1 == result.first->first);
+            ASSERT(!G.empty());
+            ASSERTV(Y.size(), SIZE_Y == Y.size());
+
+            // 'X' uses the same allocator as 'H'.
+
+            bslma::TestAllocatorMonitor oam(&oa);
+
+            Obj::iterator hintResult = mX.insert(X.begin(), mH);
+            ASSERTV(hintResult->first, 0 == hintResult->first);
+            ASSERT(H.empty());
+            ASSERTV(X.size(), NUM_VALUES - 1 == X.size());
+
+
+            result = mX.insert(mG);
+            ASSERT(result.second);
+            ASSERTV(result.first->first, 1 == result.first->first);
+            ASSERT(G.empty());
+            ASSERTV(X.size(), NUM_VALUES == X.size());
+            ASSERT(oam.isTotalSame());
+
+            Handle mE;
+            result = mX.insert(mE);
+            ASSERT(!result.second);
+            ASSERT(X.end() == result.first);
+
+            ASSERT(X.end() == mX.insert(X.begin(), mE));
+
+            // A handle keeps its node after the container is destroyed.
+
+            {
+                Obj mW(&oa);
+                mW.insert(Obj::value_type(-1, Element(-1, &sa)));
+
+                mH = mW.extract(-1);
+            }
+            ASSERTV(H.value().first, -1 == H.value().first);
+
+            oam.reset();
+            result = mX.insert(mH);
+            ASSERT(result.second);
+            ASSERT(oam.isTotalSame());
+
+            mX.erase(-1);
+
+            const bsls::Types::Int64 BLOCKS = oa.numBlocksInUse();
+
+            for (int i = 0; i != NUM_VALUES * 4; ++i) {
+                {
+                    Obj mW(&oa);
+                    mW.insert(Obj::value_type(-1, Element(-1, &sa)));
+                    mH = mW.extract(-1);
+                }
+                result = mX.insert(mH);
+                ASSERTV(i, result.second);
+                mX.erase(result.first);
+            }
+            ASSERTV(BLOCKS, oa.numBlocksInUse(),
+                    BLOCKS == oa.numBlocksInUse());
+
+            if (verbose) printf("Testing 'merge'.\n");
+
+            const Obj::size_type SIZE_X = X.size();
+
+            mX.merge(mX);
+            ASSERTV(X.size(), SIZE_X == X.size());
+
+            mX.merge(mZ);
+            ASSERTV(X.size(), SIZE_X + 2 == X.size());
+            ASSERTV(Z.size(), 2 == Z.size());
+            ASSERTV(za.numBlocksInUse(), 0 < za.numBlocksInUse());
+            ASSERT(&oa == X.find(NUM_VALUES)->second.allocator());
+            ASSERT(&oa == X.find(NUM_VALUES + 1)->second.allocator());
+
+            mY.merge(mX);
+            ASSERTV(Y.size(), NUM_VALUES + 2 == Y.size());
+            ASSERTV(X.size(), NUM_VALUES / 2 == X.size());
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+        ASSERTV(za.numBlocksInUse(), 0 == za.numBlocksInUse());
+      } break;
       case 26: {
         // --------------------------------------------------------------------
         // TESTING STANDARD INTERFACE COVERAGE
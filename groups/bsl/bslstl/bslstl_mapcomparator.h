@@ -22,6 +22,11 @@ BSLS_IDENT("$Id: $")
 // 'bslalg::RbTreeUtil', primarily for the purpose of implementing a 'map'
 // container using the utilities defined in 'bslalg::RbTreeUtil'.
 //
+// The nodes are assumed to be of type 'TreeNode<bsl::pair<const KEY, VALUE> >'
+// unless a different 'TreeNode' type (e.g., one derived from
+// 'bslalg::RbTreeCountedNode') is supplied as the optional (template
+// parameter) type 'NODE'.
+//
 ///Usage
 ///-----
 ///Example 1: Create a Simple Tree of 'TreeNode' Objects
@@ -144,7 +149,10 @@ namespace bslstl {
                        // class MapComparator
                        // ===================
 
-template <class KEY, class VALUE, class COMPARATOR>
+template <class KEY,
+          class VALUE,
+          class COMPARATOR,
+          class NODE = TreeNode<bsl::pair<const KEY, VALUE> > >
 #ifdef BSLS_PLATFORM_CMP_MSVC
 // Visual studio compiler fails to resolve the conversion operator in
 // 'bslalg::FunctorAdapter_FunctionPointer' when using private inheritance.
@@ -158,7 +166,8 @@ class MapComparator : private bslalg::FunctorAdapter<COMPARATOR>::Type {
     // 'bslalg::RbTreeNode' object with a object of the parameterized 'KEY'
     // type, assuming the reference to 'bslalg::RbTreeNode' is a base of a
     // 'bslstl::TreeNode' holding a 'pair<KEY, VALUE>', using a functor of the
-    // parameterized 'COMPARATOR' type.
+    // parameterized 'COMPARATOR' type.  The (template parameter) type 'NODE'
+    // is the type of the 'bslstl::TreeNode' (see 'bslstl_treenode').
 
   private:
     // This class does not support assignment.
@@ -172,7 +181,7 @@ class MapComparator : private bslalg::FunctorAdapter<COMPARATOR>::Type {
         // This alias represents the type of the values held by nodes in an
         // 'bslalg::RbTree' object.
 
-    typedef TreeNode<ValueType> NodeType;
+    typedef NODE NodeType;
         // This alias represents the type of node holding a 'ValueType' object.
 
     // CREATORS
@@ -208,6 +217,14 @@ class MapComparator : private bslalg::FunctorAdapter<COMPARATOR>::Type {
         // otherwise.  The behavior is undefined unless 'rhs' can be safely
         // cast to 'NodeType'.
 
+    bool operator()(const bslalg::RbTreeNode& lhs,
+                    const bslalg::RbTreeNode& rhs);
+        // Return 'true' if 'value().first' of the specified 'lhs' is less
+        // than (ordered before, according to the comparator held by this
+        // object) 'value().first' of the specified 'rhs', both after being
+        // cast to 'NodeType', and 'false' otherwise.  The behavior is
+        // undefined unless 'lhs' and 'rhs' can be safely cast to 'NodeType'.
+
     void swap(MapComparator& other);
         // Efficiently exchange the value of this object with the value of the
         // specified 'other' object.  This method provides the no-throw
@@ -230,6 +247,14 @@ class MapComparator : private bslalg::FunctorAdapter<COMPARATOR>::Type {
         // otherwise.  The behavior is undefined unless 'rhs' can be safely
         // cast to 'NodeType'.
 
+    bool operator()(const bslalg::RbTreeNode& lhs,
+                    const bslalg::RbTreeNode& rhs) const;
+        // Return 'true' if 'value().first' of the specified 'lhs' is less
+        // than (ordered before, according to the comparator held by this
+        // object) 'value().first' of the specified 'rhs', both after being
+        // cast to 'NodeType', and 'false' otherwise.  The behavior is
+        // undefined unless 'lhs' and 'rhs' can be safely cast to 'NodeType'.
+
     COMPARATOR& keyComparator();
         // Return a reference providing modifiable access to the function
         // pointer or functor to which this comparator delegates comparison
@@ -243,9 +268,9 @@ class MapComparator : private bslalg::FunctorAdapter<COMPARATOR>::Type {
 
 // FREE FUNCTIONS
 
-template <class KEY,  class VALUE,  class COMPARATOR>
-void swap(MapComparator<KEY, VALUE, COMPARATOR>& a,
-          MapComparator<KEY, VALUE, COMPARATOR>& b);
+template <class KEY, class VALUE, class COMPARATOR, class NODE>
+void swap(MapComparator<KEY, VALUE, COMPARATOR, NODE>& a,
+          MapComparator<KEY, VALUE, COMPARATOR, NODE>& b);
     // Efficiently exchange the values of the specified 'a' and 'b' objects.
     // This function provides the no-throw exception-safety guarantee.
 
@@ -258,26 +283,26 @@ void swap(MapComparator<KEY, VALUE, COMPARATOR>& a,
                     // -------------------
 
 // CREATORS
-template <class KEY, class VALUE, class COMPARATOR>
+template <class KEY, class VALUE, class COMPARATOR, class NODE>
 inline
-MapComparator<KEY, VALUE, COMPARATOR>::MapComparator()
+MapComparator<KEY, VALUE, COMPARATOR, NODE>::MapComparator()
 : bslalg::FunctorAdapter<COMPARATOR>::Type()
 {
 }
 
-template <class KEY, class VALUE, class COMPARATOR>
+template <class KEY, class VALUE, class COMPARATOR, class NODE>
 inline
-MapComparator<KEY, VALUE, COMPARATOR>::
+MapComparator<KEY, VALUE, COMPARATOR, NODE>::
 MapComparator(const COMPARATOR& valueComparator)
 : bslalg::FunctorAdapter<COMPARATOR>::Type(valueComparator)
 {
 }
 
 // MANIPULATORS
-template <class KEY, class VALUE, class COMPARATOR>
+template <class KEY, class VALUE, class COMPARATOR, class NODE>
 inline
-void MapComparator<KEY, VALUE, COMPARATOR>::swap(
-                                  MapComparator<KEY, VALUE, COMPARATOR>& other)
+void MapComparator<KEY, VALUE, COMPARATOR, NODE>::swap(
+                            MapComparator<KEY, VALUE, COMPARATOR, NODE>& other)
 {
     bslalg::SwapUtil::swap(
       static_cast<typename bslalg::FunctorAdapter<COMPARATOR>::Type*>(this),
@@ -286,9 +311,9 @@ void MapComparator<KEY, VALUE, COMPARATOR>::swap(
 }
 
 // ACCESSOR
-template <class KEY, class VALUE, class COMPARATOR>
+template <class KEY, class VALUE, class COMPARATOR, class NODE>
 inline
-bool MapComparator<KEY, VALUE, COMPARATOR>::operator()(
+bool MapComparator<KEY, VALUE, COMPARATOR, NODE>::operator()(
                                                  const KEY&                lhs,
                                                  const bslalg::RbTreeNode& rhs)
 {
@@ -296,9 +321,9 @@ bool MapComparator<KEY, VALUE, COMPARATOR>::operator()(
                            static_cast<const NodeType&>(rhs).value().first);
 }
 
-template <class KEY, class VALUE, class COMPARATOR>
+template <class KEY, class VALUE, class COMPARATOR, class NODE>
 inline
-bool MapComparator<KEY, VALUE, COMPARATOR>::operator()(
+bool MapComparator<KEY, VALUE, COMPARATOR, NODE>::operator()(
                                            const KEY&                lhs,
                                            const bslalg::RbTreeNode& rhs) const
 {
@@ -306,9 +331,9 @@ bool MapComparator<KEY, VALUE, COMPARATOR>::operator()(
                            static_cast<const NodeType&>(rhs).value().first);
 }
 
-template <class KEY, class VALUE, class COMPARATOR>
+template <class KEY, class VALUE, class COMPARATOR, class NODE>
 inline
-bool MapComparator<KEY, VALUE, COMPARATOR>::operator()(
+bool MapComparator<KEY, VALUE, COMPARATOR, NODE>::operator()(
                                                  const bslalg::RbTreeNode& lhs,
                                                  const KEY&                rhs)
 {
@@ -316,9 +341,19 @@ bool MapComparator<KEY, VALUE, COMPARATOR>::operator()(
                            rhs);
 }
 
-template <class KEY, class VALUE, class COMPARATOR>
+template <class KEY, class VALUE, class COMPARATOR, class NODE>
 inline
-bool MapComparator<KEY, VALUE, COMPARATOR>::operator()(
+bool MapComparator<KEY, VALUE, COMPARATOR, NODE>::operator()(
+                                                 const bslalg::RbTreeNode& lhs,
+                                                 const bslalg::RbTreeNode& rhs)
+{
+    return keyComparator()(static_cast<const NodeType&>(lhs).value().first,
+                           static_cast<const NodeType&>(rhs).value().first);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class NODE>
+inline
+bool MapComparator<KEY, VALUE, COMPARATOR, NODE>::operator()(
                                            const bslalg::RbTreeNode& lhs,
                                            const KEY&                rhs) const
 {
@@ -326,27 +361,37 @@ bool MapComparator<KEY, VALUE, COMPARATOR>::operator()(
                            rhs);
 }
 
-template <class KEY, class VALUE, class COMPARATOR>
+template <class KEY, class VALUE, class COMPARATOR, class NODE>
+inline
+bool MapComparator<KEY, VALUE, COMPARATOR, NODE>::operator()(
+                                           const bslalg::RbTreeNode& lhs,
+                                           const bslalg::RbTreeNode& rhs) const
+{
+    return keyComparator()(static_cast<const NodeType&>(lhs).value().first,
+                           static_cast<const NodeType&>(rhs).value().first);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class NODE>
 inline
 COMPARATOR&
-MapComparator<KEY, VALUE, COMPARATOR>::keyComparator()
+MapComparator<KEY, VALUE, COMPARATOR, NODE>::keyComparator()
 {
     return *this;
 }
 
-template <class KEY, class VALUE, class COMPARATOR>
+template <class KEY, class VALUE, class COMPARATOR, class NODE>
 inline
 const COMPARATOR&
-MapComparator<KEY, VALUE, COMPARATOR>::keyComparator() const
+MapComparator<KEY, VALUE, COMPARATOR, NODE>::keyComparator() const
 {
     return *this;
 }
 
 
 // FREE FUNCTIONS
-template <class KEY,  class VALUE,  class COMPARATOR>
-void swap(MapComparator<KEY, VALUE, COMPARATOR>& a,
-          MapComparator<KEY, VALUE, COMPARATOR>& b)
+template <class KEY, class VALUE, class COMPARATOR, class NODE>
+void swap(MapComparator<KEY, VALUE, COMPARATOR, NODE>& a,
+          MapComparator<KEY, VALUE, COMPARATOR, NODE>& b)
 {
     a.swap(b);
 }
@@ -1,6 +1,8 @@
 // bslstl_multimap.t.cpp                                              -*-C++-*-
 #include <bslstl_multimap.h>
 
+#include <bslstl_vector.h>  // for testing only
+
 #include <bslalg_rangecompare.h>
 
 #include <bslma_allocator.h>
@@ -155,9 +157,17 @@ using namespace bsl;
 //// specialized algorithms:
 // [ 8] void swap(multimap<K, V, C, A>& a, multimap<K, V, C, A>& b);
 //
+// [26] node_type extract(const_iterator position);
+// [26] node_type extract(const key_type& key);
+// [26] iterator insert(node_type& node);
+// [26] iterator insert(const_iterator hint, node_type& node);
+// [26] void merge(multimap& source);
+// [28] void mergeUnion(multimap& other);
+// [28] void intersect(const multimap& other);
+// [28] void subtract(const multimap& other);
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [25] USAGE EXAMPLE
+// [29] USAGE EXAMPLE
 //
 // TEST APPARATUS: GENERATOR FUNCTIONS
 // [ 3] int ggg(multimap<T,A> *object, const char *spec, int verbose = 1);
@@ -167,6 +177,7 @@ using namespace bsl;
 // [22] CONCERN: The object is compatible with STL allocators.
 // [23] CONCERN: The object has the necessary type traits
 // [24] CONCERN: The type provides the full interface defined by the standard.
+// [27] CONCERN: Construction from an ordered range takes linear time.
 
 // ============================================================================
 //                      STANDARD BDE ASSERT TEST MACROS
@@ -6514,7 +6525,7 @@ int main(int argc, char *argv[])
     bslma::Default::setDefaultAllocator(&defaultAllocator);
 
     switch (test) { case 0:
-      case 26: {
+      case 29: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //
@@ -6589,6 +6600,582 @@ int main(int argc, char *argv[])
         }
 
       } break;
+      case 28: {
+        // --------------------------------------------------------------------
+        // TESTING SET OPERATIONS
+        //
+        // Concerns:
+        //: 1 'mergeUnion' moves each object of the other multimap into this
+        //:   multimap, after the objects of this multimap having equivalent
+        //:   keys, and leaves the other multimap empty.
+        //:
+        //: 2 'intersect' and 'subtract' leave this multimap holding the
+        //:   objects whose keys are held, or are not held, respectively, by
+        //:   the other multimap, which is not modified.
+        //:
+        //: 3 If both multimaps use the same allocator, 'mergeUnion' allocates
+        //:   no memory, and the objects it moves keep their addresses.
+        //:
+        //: 4 If the allocators differ, the objects moved by 'mergeUnion' use
+        //:   the allocator of this multimap.
+        //:
+        //: 5 Applying 'mergeUnion' or 'intersect' to a multimap and itself has
+        //:   no effect, and applying 'subtract' empties the multimap.
+        //:
+        //: 6 If an exception is thrown by 'mergeUnion', this multimap is left
+        //:   unchanged, and no memory is leaked.
+        //
+        // Plan:
+        //: 1 For each pair of rows of a table of arithmetic sequences of
+        //:   repeated keys, apply each operation to multimaps holding these
+        //:   keys, mapped to values identifying the multimap and the position
+        //:   of each object among those having the same key, using the same
+        //:   and different allocators, and compare the results with
+        //:   multimaps built by inserting the expected objects one at a time.
+        //:   (C-1..2)
+        //:
+        //: 2 Using a test allocator monitor, apply 'mergeUnion' to multimaps
+        //:   using the same allocator and verify the addresses of the moved
+        //:   objects, then to multimaps using different allocators and
+        //:   verify the allocators of the moved objects.  (C-1, 3..4)
+        //:
+        //: 3 Apply each operation to a multimap and itself.  (C-5)
+        //:
+        //: 4 Apply 'mergeUnion' to multimaps using different allocators in the
+        //:   presence of injected exceptions (using the
+        //:   'BSLMA_TESTALLOCATOR_EXCEPTION_TEST_*' macros), and verify this
+        //:   multimap after each exception.  (C-6)
+        //
+        // Testing:
+        //   void mergeUnion(multimap& other);
+        //   void intersect(const multimap& other);
+        //   void subtract(const multimap& other);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING SET OPERATIONS"
+                            "\n======================\n");
+
+        typedef bsl::multimap<int, int> IntMap;
+
+        static const struct {
+            int d_line;    // source line number
+            int d_first;   // first key
+            int d_step;    // difference between consecutive keys
+            int d_count;   // number of keys
+            int d_repeat;  // number of objects having each key
+        } DATA[] = {
+            //line  first  step  count  repeat
+            //----  -----  ----  -----  ------
+            { L_,       0,    1,     0,      1 },
+            { L_,       0,    1,     1,      1 },
+            { L_,       0,    1,     1,      3 },
+            { L_,       5,    1,     1,      2 },
+            { L_,       0,    1,    10,      1 },
+            { L_,       0,    2,    10,      2 },
+            { L_,       1,    3,    10,      3 },
+            { L_,      20,    1,    10,      2 },
+            { L_,       0,    1,   300,      1 },
+            { L_,     150,    7,   100,      2 },
+            { L_,     300,    2,   200,      3 },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        bslma::TestAllocator         da("default", veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        if (verbose) printf("Testing the resulting keys.\n");
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int LINE1 = DATA[ti].d_line;
+
+            bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+
+            IntMap mL(&sa);  const IntMap& L = mL;
+            for (int i = 0; i < DATA[ti].d_count; ++i) {
+                for (int j = 0; j < DATA[ti].d_repeat; ++j) {
+                    mL.insert(IntMap::value_type(
+                                        DATA[ti].d_first + i * DATA[ti].d_step,
+                                        100 + j));
+                }
+            }
+
+            for (int tj = 0; tj < NUM_DATA; ++tj) {
+                const int LINE2 = DATA[tj].d_line;
+
+                IntMap mR(&sa);  const IntMap& R = mR;
+                for (int i = 0; i < DATA[tj].d_count; ++i) {
+                    for (int j = 0; j < DATA[tj].d_repeat; ++j) {
+                        mR.insert(IntMap::value_type(
+                                        DATA[tj].d_first + i * DATA[tj].d_step,
+                                        200 + j));
+                    }
+                }
+
+                if (veryVerbose) { T_ P_(LINE1) P(LINE2) }
+
+                IntMap expUnion(L, &sa);
+                IntMap expIntersection(&sa);
+                IntMap expDifference(&sa);
+                for (IntMap::const_iterator it = R.begin(); it != R.end();
+                                                                        ++it) {
+                    expUnion.insert(*it);
+                }
+                for (IntMap::const_iterator it = L.begin(); it != L.end();
+                                                                        ++it) {
+                    if (R.count(it->first)) {
+                        expIntersection.insert(*it);
+                    }
+                    else {
+                        expDifference.insert(*it);
+                    }
+                }
+
+                bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+                bslma::TestAllocator za("other",  veryVeryVeryVerbose);
+
+                for (int cfg = 0; cfg < 2; ++cfg) {
+                    IntMap mX(L, &oa);                const IntMap& X = mX;
+                    IntMap mY(R, cfg ? &za : &oa);    const IntMap& Y = mY;
+
+                    mX.mergeUnion(mY);
+                    ASSERTV(LINE1, LINE2, cfg, expUnion == X);
+                    ASSERTV(LINE1, LINE2, cfg, Y.empty());
+                }
+                {
+                    IntMap mX(L, &oa);  const IntMap& X = mX;
+                    const IntMap Y(R, &oa);
+
+                    mX.intersect(Y);
+                    ASSERTV(LINE1, LINE2, expIntersection == X);
+                    ASSERTV(LINE1, LINE2, R == Y);
+                }
+                {
+                    IntMap mX(L, &oa);  const IntMap& X = mX;
+                    const IntMap Y(R, &oa);
+
+                    mX.subtract(Y);
+                    ASSERTV(LINE1, LINE2, expDifference == X);
+                    ASSERTV(LINE1, LINE2, R == Y);
+                }
+                ASSERTV(LINE1, LINE2, oa.numBlocksInUse(),
+                        0 == oa.numBlocksInUse());
+                ASSERTV(LINE1, LINE2, za.numBlocksInUse(),
+                        0 == za.numBlocksInUse());
+            }
+        }
+
+        typedef bsltf::AllocBitwiseMoveableTestType Element;
+        typedef bsl::multimap<int, Element>         Obj;
+
+        const int NUM_VALUES = 16;
+
+        if (verbose) printf("Testing the reuse of nodes.\n");
+        {
+            bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+            bslma::TestAllocator za("other",   veryVeryVeryVerbose);
+            bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+            {
+                Obj mX(&oa);  const Obj& X = mX;
+                Obj mY(&oa);  const Obj& Y = mY;
+                Obj mZ(&za);  const Obj& Z = mZ;
+
+                for (int i = 0; i < NUM_VALUES; ++i) {
+                    mX.insert(Obj::value_type(2 * i, Element(2 * i, &sa)));
+                    mY.insert(Obj::value_type(3 * i, Element(3 * i, &sa)));
+                    mZ.insert(Obj::value_type(5 * i + 1, Element(5 * i, &sa)));
+                }
+
+                const Element *KEPT  = &X.find(0)->second;
+                const Element *MOVED = &Y.find(0)->second;
+
+                bslma::TestAllocatorMonitor oam(&oa);
+
+                mX.mergeUnion(mY);
+
+                ASSERT(oam.isTotalSame());
+                ASSERT(Y.empty());
+                ASSERTV(X.size(), 2 * NUM_VALUES == X.size());
+                ASSERT(KEPT  == &X.find(0)->second);
+                ASSERT(MOVED == &(++X.find(0))->second);
+
+                mX.mergeUnion(mZ);
+
+                ASSERT(Z.empty());
+                ASSERTV(X.size(), 3 * NUM_VALUES == X.size());
+                for (Obj::const_iterator it = X.begin(); it != X.end(); ++it) {
+                    ASSERTV(it->first, &oa == it->second.allocator());
+                }
+
+                // 'Y', which is empty and has no nodes left, can be reused.
+
+                mY.insert(Obj::value_type(1, Element(1, &sa)));
+                ASSERTV(Y.size(), 1 == Y.size());
+            }
+            ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+            ASSERTV(za.numBlocksInUse(), 0 == za.numBlocksInUse());
+        }
+
+        if (verbose) printf("Testing aliasing.\n");
+        {
+            bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+            bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+
+            Obj mX(&oa);  const Obj& X = mX;
+            for (int i = 0; i < NUM_VALUES; ++i) {
+                mX.insert(Obj::value_type(i / 2, Element(i / 2, &sa)));
+            }
+            const Obj W(X, &sa);
+
+            mX.mergeUnion(mX);
+            ASSERT(W == X);
+
+            mX.intersect(X);
+            ASSERT(W == X);
+
+            mX.subtract(X);
+            ASSERT(X.empty());
+        }
+
+        if (verbose) printf("Testing exception safety.\n");
+        {
+            bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+            bslma::TestAllocator za("other",   veryVeryVeryVerbose);
+            bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+            {
+                Obj mX(&oa);  const Obj& X = mX;
+                for (int i = 0; i < NUM_VALUES; ++i) {
+                    mX.insert(Obj::value_type(2 * i, Element(2 * i, &sa)));
+                }
+                const Obj W(X, &sa);
+
+                BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                    ASSERT(W == X);
+
+                    Obj mZ(&za);
+                    for (int i = 0; i < NUM_VALUES; ++i) {
+                        mZ.insert(Obj::value_type(3 * i, Element(3 * i, &sa)));
+                    }
+
+                    mX.mergeUnion(mZ);
+                } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+                ASSERTV(X.size(), 2 * NUM_VALUES == X.size());
+            }
+            ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+            ASSERTV(za.numBlocksInUse(), 0 == za.numBlocksInUse());
+        }
+      } break;
+      case 27: {
+        // --------------------------------------------------------------------
+        // TESTING CONSTRUCTION FROM ORDERED RANGES
+        //
+        // Concerns:
+        //: 1 Constructing a multimap from a range, or inserting a range into
+        //:   an empty multimap, yields a multimap holding all the values in
+        //:   the range, values having equivalent keys being in the order of
+        //:   the range, whether the keys of the range are increasing,
+        //:   non-decreasing, or ordered only up to some position.
+        //:
+        //: 2 Inserting a range into a non-empty multimap is unaffected.
+        //:
+        //: 3 When the length of the range can be determined in advance, the
+        //:   nodes for the range are obtained from the allocator in a single
+        //:   allocation.
+        //:
+        //: 4 If an exception is thrown, the multimap is left valid, holding a
+        //:   subset of the values in the range, and no memory is leaked.
+        //
+        // Plan:
+        //: 1 For each row of a table of ranges, generated from an increasing
+        //:   sequence of keys by repeating each key and by making the keys
+        //:   after some position decreasing, and smaller than the keys before
+        //:   that position, construct a multimap from the range, insert the
+        //:   range into an empty multimap and into a multimap holding other
+        //:   values, and compare the results with multimaps built by inserting
+        //:   the values one at a time.  (C-1..2)
+        //:
+        //: 2 Verify that constructing a multimap from a range allocates a
+        //:   single block.  (C-3)
+        //:
+        //: 3 Insert each range into an empty multimap in the presence of
+        //:   injected exceptions (using the
+        //:   'BSLMA_TESTALLOCATOR_EXCEPTION_TEST_*' macros), and verify the
+        //:   multimap after each exception.  (C-4)
+        //
+        // Testing:
+        //   CONCERN: Construction from an ordered range takes linear time.
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING CONSTRUCTION FROM ORDERED RANGES"
+                            "\n========================================\n");
+
+        typedef bsl::multimap<int, int> IntMultimap;
+        typedef IntMultimap::value_type IntPair;
+        typedef bsl::vector<IntPair> Range;
+
+        static const struct {
+            int d_line;        // source line number
+            int d_length;      // number of values in the range
+            int d_repeat;      // number of consecutive values having each key
+            int d_orderedLen;  // length of the ordered prefix of the range
+        } DATA[] = {
+            //line  length  repeat  ordered
+            //----  ------  ------  -------
+            { L_,        0,      1,       0 },
+            { L_,        1,      1,       1 },
+            { L_,        2,      1,       2 },
+            { L_,        2,      1,       1 },
+            { L_,        2,      2,       2 },
+            { L_,        3,      1,       3 },
+            { L_,        7,      1,       7 },
+            { L_,        7,      3,       7 },
+            { L_,        7,      1,       4 },
+            { L_,        8,      1,       8 },
+            { L_,        8,      2,       5 },
+            { L_,      100,      1,     100 },
+            { L_,      100,      3,     100 },
+            { L_,      100,      1,      50 },
+            { L_,      100,      1,       1 },
+            { L_,     1000,      1,    1000 },
+            { L_,     1000,      4,     999 },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        bslma::TestAllocator         da("default", veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int LINE    = DATA[ti].d_line;
+            const int LENGTH  = DATA[ti].d_length;
+            const int REPEAT  = DATA[ti].d_repeat;
+            const int ORDERED = DATA[ti].d_orderedLen;
+
+            if (veryVerbose) { T_ P_(LINE) P_(LENGTH) P_(REPEAT) P(ORDERED) }
+
+            bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+
+            Range range(&sa);
+            for (int i = 0; i < LENGTH; ++i) {
+                const int position = i < ORDERED
+                                   ? LENGTH - ORDERED + i
+                                   : LENGTH - 1 - i;
+                range.push_back(IntPair(position / REPEAT, i));
+            }
+
+            IntMultimap expected(&sa);
+            for (int i = 0; i < LENGTH; ++i) {
+                expected.insert(range[i]);
+            }
+
+            {
+                bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+                const IntMultimap X(range.begin(),
+                                    range.end(),
+                                    std::less<int>(),
+                                    &oa);
+
+                ASSERTV(LINE, expected == X);
+                ASSERTV(LINE, oa.numBlocksTotal(),
+                        (0 < LENGTH ? 1 : 0) == oa.numBlocksTotal());
+            }
+            {
+                bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+                IntMultimap mX(&oa);  const IntMultimap& X = mX;
+                mX.insert(range.begin(), range.end());
+
+                ASSERTV(LINE, expected == X);
+            }
+            {
+                bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+                IntMultimap mX(&oa);  const IntMultimap& X = mX;
+                mX.insert(IntPair(-1, -1));
+                mX.insert(IntPair(LENGTH, -1));
+                mX.insert(range.begin(), range.end());
+
+                IntMultimap mY(expected, &sa);  const IntMultimap& Y = mY;
+                mY.insert(IntPair(-1, -1));
+                mY.insert(IntPair(LENGTH, -1));
+
+                ASSERTV(LINE, Y == X);
+            }
+            {
+                bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+                IntMultimap mX(&oa);  const IntMultimap& X = mX;
+
+                BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                    ASSERTV(LINE, X.size() <= expected.size());
+                    for (IntMultimap::const_iterator it = X.begin();
+                                                       it != X.end(); ++it) {
+                        ASSERTV(LINE, 0 < expected.count(it->first));
+                    }
+                    mX.clear();
+
+                    mX.insert(range.begin(), range.end());
+                } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+                ASSERTV(LINE, expected == X);
+            }
+            ASSERTV(LINE, da.numBlocksTotal(), 0 == da.numBlocksTotal());
+        }
+      } break;
+      case 26: {
+        // --------------------------------------------------------------------
+        // TESTING NODE HANDLES
+        //
+        // Concerns:
+        //: 1 'extract' removes the element at a position, or having a key,
+        //:   and returns a handle holding that element and the allocator of
+        //:   the container; extracting a missing key yields an empty handle.
+        //:
+        //: 2 'insert' inserts the element held by a handle, and empties the
+        //:   handle.  Inserting an empty handle has no effect.
+        //:
+        //: 3 An element held by a handle is inserted into a container using
+        //:   the same allocator without allocating memory, even if the
+        //:   container it was extracted from has been destroyed.
+        //:
+        //: 4 'merge' moves every element of the source, including when the
+        //:   two containers use different allocators, and the moved elements
+        //:   then use the allocator of the target.
+        //:
+        //: 5 Merging a container with itself has no effect.
+        //:
+        //: 6 No memory is leaked.
+        //
+        // Plan:
+        //: 1 Extract elements from a container, and insert them into the same
+        //:   and another container, verifying the sizes of the containers, the
+        //:   state of the handles, and (using a test allocator monitor) that
+        //:   no memory is allocated by 'insert'.  Repeat with a handle
+        //:   outliving the container it was extracted from.  (C-1..3)
+        //:
+        //: 2 Merge containers using the same and different allocators, and
+        //:   verify the sizes of the containers and the allocators of the
+        //:   moved elements.  (C-4..5)
+        //:
+        //: 3 Verify that no memory is in use once the containers are
+        //:   destroyed.  (C-6)
+        //
+        // Testing:
+        //   node_type extract(const_iterator position);
+        //   node_type extract(const key_type& key);
+        //   iterator insert(node_type& node);
+        //   iterator insert(const_iterator hint, node_type& node);
+        //   void merge(multimap& source);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING NODE HANDLES"
+                            "\n====================\n");
+
+        typedef bsltf::AllocBitwiseMoveableTestType Element;
+        typedef bsl::multimap<int, Element>         Obj;
+        typedef Obj::node_type                      Handle;
+
+        const int NUM_VALUES = 8;
+
+        bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+        bslma::TestAllocator za("other",   veryVeryVeryVerbose);
+        bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+            Obj mY(&oa);  const Obj& Y = mY;
+            Obj mZ(&za);  const Obj& Z = mZ;
+
+            for (int i = 0; i != NUM_VALUES; ++i) {
+                mX.insert(Obj::value_type(i, Element(i, &sa)));
+                if (i % 2) {
+                    mY.insert(Obj::value_type(i, Element(i, &sa)));
+                }
+                if (i >= NUM_VALUES - 2) {
+                    mZ.insert(Obj::value_type(i, Element(i, &sa)));
+                    mZ.insert(Obj::value_type(i + 2, Element(i + 2, &sa)));
+                }
+            }
+            ASSERTV(Z.size(), 4 == Z.size());
+
+            if (verbose) printf("Testing 'extract'.\n");
+
+            Handle mH = mX.extract(X.find(0));  const Handle& H = mH;
+            ASSERT(!H.empty());
+            ASSERTV(H.value().first, 0 == H.value().first);
+            ASSERT(X.get_allocator() == H.get_allocator());
+            ASSERTV(X.size(), NUM_VALUES - 1 == X.size());
+            ASSERT(X.end() == X.find(0));
+
+            Handle mG(mX.extract(1));  const Handle& G = mG;
+            ASSERT(!G.empty());
+            ASSERTV(G.value().first, 1 == G.value().first);
+            ASSERTV(X.size(), NUM_VALUES - 2 == X.size());
+
+            ASSERT(mX.extract(1).empty());
+            ASSERTV(X.size(), NUM_VALUES - 2 == X.size());
+
+            if (verbose) printf("Testing 'insert'.\n");
+
+            const Obj::size_type SIZE_Y = Y.size();
+
+            Obj::iterator it = mY.insert(mG);
+            ASSERTV(it->first, 1 == it->first);
+            ASSERT(G.empty());
+            ASSERTV(Y.size(), SIZE_Y + 1 == Y.size());
+            ASSERTV(Y.count(1), 2 == Y.count(1));
+
+            // 'X' uses the same allocator as 'H'.
+
+            bslma::TestAllocatorMonitor oam(&oa);
+
+            Obj::iterator hintResult = mX.insert(X.begin(), mH);
+            ASSERTV(hintResult->first, 0 == hintResult->first);
+            ASSERT(H.empty());
+            ASSERTV(X.size(), NUM_VALUES - 1 == X.size());
+
+            ASSERT(oam.isTotalSame());
+
+            Handle mE;
+            ASSERT(X.end() == mX.insert(mE));
+
+            ASSERT(X.end() == mX.insert(X.begin(), mE));
+
+            // A handle keeps its node after the container is destroyed.
+
+            {
+                Obj mW(&oa);
+                mW.insert(Obj::value_type(-1, Element(-1, &sa)));
+
+                mH = mW.extract(-1);
+            }
+            ASSERTV(H.value().first, -1 == H.value().first);
+
+            oam.reset();
+            it = mX.insert(mH);
+            ASSERT(oam.isTotalSame());
+
+            mX.erase(-1);
+
+            if (verbose) printf("Testing 'merge'.\n");
+
+            const Obj::size_type SIZE_X = X.size();
+
+            mX.merge(mX);
+            ASSERTV(X.size(), SIZE_X == X.size());
+
+            mX.merge(mZ);
+            ASSERTV(X.size(), SIZE_X + 4 == X.size());
+            ASSERTV(Z.size(), 0 == Z.size());
+            ASSERT(&oa == X.find(NUM_VALUES)->second.allocator());
+            ASSERT(&oa == X.find(NUM_VALUES + 1)->second.allocator());
+
+            mY.merge(mX);
+            ASSERTV(Y.size(), SIZE_Y + 1 + SIZE_X + 4 == Y.size());
+            ASSERTV(X.size(), 0 == X.size());
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+        ASSERTV(za.numBlocksInUse(), 0 == za.numBlocksInUse());
+      } break;
       case 25: {
         // --------------------------------------------------------------------
         // TESTING STANDARD INTERFACE COVERAGE
@@ -415,6 +415,14 @@ BSL_OVERRIDES_STD mode"
 #include <bslstl_allocator.h>
 #endif
 
+#ifndef INCLUDED_BSLSTL_ITERATORUTIL
+#include <bslstl_iteratorutil.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_NODEHANDLE
+#include <bslstl_nodehandle.h>
+#endif
+
 #ifndef INCLUDED_BSLSTL_PAIR
 #include <bslstl_pair.h>
 #endif
@@ -463,6 +471,10 @@ BSL_OVERRIDES_STD mode"
 #include <bslalg_typetraithasstliterators.h>
 #endif
 
+#ifndef INCLUDED_BSLS_UTIL
+#include <bsls_util.h>
+#endif
+
 #ifndef INCLUDED_FUNCTIONAL
 #include <functional>
 #define INCLUDED_FUNCTIONAL
@@ -560,6 +572,9 @@ class multiset {
     typedef bsl::reverse_iterator<iterator>            reverse_iterator;
     typedef bsl::reverse_iterator<const_iterator>      const_reverse_iterator;
 
+    typedef BloombergLP::bslstl::NodeHandle<value_type, Node, ALLOCATOR>
+                                                                     node_type;
+
   private:
     // PRIVATE MANIPULATORS
     NodeFactory& nodeFactory();
@@ -576,6 +591,18 @@ class multiset {
         // the no-throw exception-safety guarantee.  The behavior is undefined
         // unless this object was created with the same allocator as 'other'.
 
+    void takeNodes(BloombergLP::bslalg::RbTreeAnchor *result, multiset& other);
+        // Move the 'value_type' objects of the specified 'other' multiset, in
+        // order, into nodes of this multiset forming the specified 'result'
+        // tree, leaving 'other' empty.  If 'other' uses the same allocator as
+        // this multiset, the node pool of 'other' is taken over by this
+        // multiset (see 'bslstl::TreeNodePool::adopt'), and no memory is
+        // allocated; otherwise each object is relocated into a new node.  If
+        // an exception is thrown, 'result' is a valid tree holding the objects
+        // already moved, and the other objects remain in 'other'.  The
+        // behavior is undefined unless 'result' is empty and 'other' is not
+        // this multiset.
+
     // PRIVATE ACCESSORS
     const NodeFactory& nodeFactory() const;
         // Return a reference providing non-modifiable access to the
@@ -734,7 +761,101 @@ class multiset {
         // input iterator defined in the C++11 standard [24.2.3] providing
         // access to values of a type convertible to 'value_type'.  This method
         // requires that the (template parameter) type 'KEY' be
-        // "copy-constructible" (see {Requirements on 'KEY'}).
+        // "copy-constructible" (see {Requirements on 'KEY'}).  If this
+        // multiset is empty, the longest prefix of the range whose keys are in
+        // non-decreasing order is inserted in O[M] time, where M is the length
+        // of that prefix, by linking its nodes into a balanced tree without
+        // rebalancing, and the remaining values, if any, are inserted one at a
+        // time.
+
+    iterator insert(node_type& node);
+        // Insert the 'value_type' object held by the specified 'node' into
+        // this multiset (at the end of the range of objects having the same
+        // key, if any), make 'node' empty, and return an iterator referring to
+        // the newly inserted 'value_type' object, or 'end()' if 'node' is
+        // empty.  Note that the node held by 'node' is linked into this
+        // multiset if 'node.get_allocator() == get_allocator()' and this
+        // multiset has no free node, and that the object is otherwise
+        // relocated into a node of this multiset (see
+        // {'bslstl_nodehandle'|Node Ownership}).
+
+    iterator insert(const_iterator hint, node_type& node);
+        // Insert the 'value_type' object held by the specified 'node' into
+        // this multiset (in amortized constant time if the specified 'hint' is
+        // a valid immediate successor to the key of that object), make 'node'
+        // empty, and return an iterator referring to the newly inserted
+        // 'value_type' object, or 'end()' if 'node' is empty.  The behavior is
+        // undefined unless 'hint' is a valid iterator into this multiset.
+
+    node_type extract(const_iterator position);
+        // Remove from this multiset the 'value_type' object at the specified
+        // 'position', and return a node handle holding that object (see
+        // {'bslstl_nodehandle'}).  The behavior is undefined unless 'position'
+        // refers to a 'value_type' object in this multiset.  If an exception
+        // is thrown, this multiset is unchanged.  Note that the object is
+        // relocated into a detached node owned by the node handle (see
+        // {'bslstl_nodehandle'|Node Ownership}), without being copied if
+        // 'value_type' is bitwise moveable, and that the node holding it in
+        // this multiset is kept for reuse.
+
+    node_type extract(const key_type& key);
+        // Remove from this multiset the first 'value_type' object having the
+        // specified 'key', if it exists, and return a node handle holding that
+        // object; otherwise return an empty node handle with no other effect.
+
+    void merge(multiset& source);
+        // Relocate every 'value_type' object of the specified 'source'
+        // multiset into this multiset, leaving 'source' empty.  This method
+        // has no effect if 'source' is this multiset.  If an exception is
+        // thrown, each object is held by exactly one of the two containers.
+        // Note that no memory is allocated for the relocated objects (unless
+        // the node pool of this multiset must grow), and none is deallocated,
+        // if 'value_type' is bitwise moveable and 'source.get_allocator() ==
+        // get_allocator()'.
+
+    void mergeUnion(multiset& other);
+        // Move into this multiset each 'value_type' object of the specified
+        // 'other' multiset, after the objects having an equivalent key already
+        // held by this multiset, preserving the relative order of the objects
+        // of 'other' having equivalent keys, and leave 'other' empty.  This
+        // method has no effect if 'other' is this multiset.  The nodes of
+        // 'other' are taken over, without allocating memory or moving any
+        // object, if 'other.get_allocator() == get_allocator()'; otherwise
+        // each object of 'other' is relocated into this multiset.  The number
+        // of key comparisons is 'O[M * log(N / M + 1)]', where 'M' and 'N' are
+        // the sizes of the smaller and of the larger multiset, respectively,
+        // and is 'O[1]' if the keys of one multiset all precede those of the
+        // other (see {'bslalg_rbtreeutil'|Set Operations}).  If an exception
+        // is thrown, this multiset holds all of its original objects, and the
+        // objects of 'other' are either held by one of the two multisets or
+        // destroyed.  Note that, unlike 'merge', this method may destroy
+        // objects of 'other' if an exception is thrown.
+
+    void intersect(const multiset& other);
+        // Remove from this multiset each 'value_type' object whose key does
+        // not exist in the specified 'other' multiset.  This method has no
+        // effect if 'other' is this multiset.  The number of key comparisons
+        // is 'O[M * log(N / M + 1)]', where 'M' and 'N' are the sizes of the
+        // smaller and of the larger multiset, respectively.  If an exception
+        // is thrown, this multiset holds a subset of its original objects that
+        // includes each object whose key exists in 'other'.  The behavior is
+        // undefined unless the comparator of 'other' orders keys in the same
+        // way as the comparator of this multiset.  Note that all the objects
+        // having a key that exists in 'other' are kept, whatever the number of
+        // objects having that key in 'other'.
+
+    void subtract(const multiset& other);
+        // Remove from this multiset each 'value_type' object whose key exists
+        // in the specified 'other' multiset.  If 'other' is this multiset,
+        // remove all the objects of this multiset.  The number of key
+        // comparisons is 'O[M * log(N / M + 1)]', where 'M' and 'N' are the
+        // sizes of the smaller and of the larger multiset, respectively.  If
+        // an exception is thrown, this multiset holds a subset of its original
+        // objects that includes each object whose key does not exist in
+        // 'other'.  The behavior is undefined unless the comparator of 'other'
+        // orders keys in the same way as the comparator of this multiset.
+        // Note that all the objects having a key that exists in 'other' are
+        // removed, whatever the number of objects having that key in 'other'.
 
     iterator erase(const_iterator position);
         // Remove from this set the 'value_type' object at the specified
@@ -1087,6 +1208,46 @@ void multiset<KEY, COMPARATOR, ALLOCATOR>::quickSwap(multiset& other)
     }
 }
 
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+void multiset<KEY, COMPARATOR, ALLOCATOR>::takeNodes(
+                                     BloombergLP::bslalg::RbTreeAnchor *result,
+                                     multiset&                          other)
+{
+    BSLS_ASSERT_SAFE(result);
+    BSLS_ASSERT_SAFE(0 == result->numNodes());
+    BSLS_ASSERT_SAFE(this != &other);
+
+    if (other.get_allocator() == this->get_allocator()) {
+        nodeFactory().adopt(other.nodeFactory());
+        BloombergLP::bslalg::RbTreeUtil::swap(result, &other.d_tree);
+        return;                                                       // RETURN
+    }
+
+    if (0 < other.size()) {
+        nodeFactory().reserveNodes(other.size());
+    }
+
+    // Relocate the objects in order, appending their new nodes to a chain
+    // that 'guard' balances, even if an exception is thrown.
+
+    BloombergLP::bslalg::RbTreeUtilChainGuard guard(result);
+
+    BloombergLP::bslalg::RbTreeNode *lastNode = result->sentinel();
+    while (0 < other.d_tree.numNodes()) {
+        BloombergLP::bslalg::RbTreeNode *node = other.d_tree.firstNode();
+        BloombergLP::bslalg::RbTreeNode *newNode =
+            nodeFactory().createNodeByRelocation(
+                       BSLS_UTIL_ADDRESSOF(static_cast<Node *>(node)->value()),
+                       false);
+        BloombergLP::bslalg::RbTreeUtil::remove(&other.d_tree, node);
+        other.nodeFactory().deallocateNode(node);
+        BloombergLP::bslalg::RbTreeUtil::appendToChain(result,
+                                                       lastNode,
+                                                       newNode);
+        lastNode = newNode;
+    }
+}
+
 // PRIVATE ACCESSORS
 template <class KEY, class COMPARATOR, class ALLOCATOR>
 inline
@@ -1120,33 +1281,7 @@ multiset<KEY, COMPARATOR, ALLOCATOR>::multiset(
         BloombergLP::bslalg::RbTreeUtilTreeProctor<NodeFactory> proctor(
                                                                &d_tree,
                                                                &nodeFactory());
-
-        // The following loop guarantees amortized linear time to insert an
-        // ordered sequence of values (as required by the standard).   If the
-        // values are in sorted order, we are guaranteed the next node can be
-        // inserted as the right child of the previous node, and can call
-        // 'insertAt' without 'findUniqueInsertLocation'.
-
-        insert(*first);
-        BloombergLP::bslalg::RbTreeNode *prevNode = d_tree.rootNode();
-        while (++first != last) {
-            // The values are not in order, so insert them normally.
-
-            const value_type& value = *first;
-            if (this->comparator()(value, *prevNode)) {
-                insert(value);
-                insert(++first, last);
-                break;
-            }
-            BloombergLP::bslalg::RbTreeNode *node = nodeFactory().createNode(
-                                                                        value);
-            BloombergLP::bslalg::RbTreeUtil::insertAt(&d_tree,
-                                                      prevNode,
-                                                      false,
-                                                      node);
-            prevNode = node;
-        }
-
+        insert(first, last);
         proctor.release();
     }
 }
@@ -1300,16 +1435,217 @@ multiset<KEY, COMPARATOR, ALLOCATOR>::insert(const_iterator    hint,
 
 template <class KEY, class COMPARATOR, class ALLOCATOR>
 template <class INPUT_ITERATOR>
-inline
 void multiset<KEY, COMPARATOR, ALLOCATOR>::insert(INPUT_ITERATOR first,
                                                   INPUT_ITERATOR last)
 {
+    if (first != last && 0 == d_tree.numNodes()) {
+        // Link the nodes for the longest prefix of the range whose keys are
+        // in non-decreasing order into a chain, which 'guard' turns into a
+        // balanced tree in linear time (see
+        // 'bslalg::RbTreeUtil::balanceChain'), even if an exception is
+        // thrown.  If the length of the range can be determined in advance,
+        // reserve nodes for the whole range, so that they are obtained in a
+        // single allocation.
+
+        const difference_type numValues =
+              BloombergLP::bslstl::IteratorUtil::insertDistance(first, last);
+        if (0 < numValues) {
+            nodeFactory().reserveNodes(numValues);
+        }
+
+        BloombergLP::bslalg::RbTreeUtilChainGuard guard(&d_tree);
+
+        BloombergLP::bslalg::RbTreeNode *lastNode =
+                                              nodeFactory().createNode(*first);
+        BloombergLP::bslalg::RbTreeUtil::appendToChain(&d_tree,
+                                                       d_tree.sentinel(),
+                                                       lastNode);
+        while (++first != last) {
+            const value_type& value = *first;
+            if (this->comparator()(value, *lastNode)) {
+                // The rest of the range is not ordered: balance the tree
+                // built so far, and insert 'value' (which cannot be obtained
+                // again from an input iterator) here, and the remaining
+                // values below, one at a time.
+
+                guard.balance();
+                insert(value);
+                ++first;
+                break;
+            }
+            BloombergLP::bslalg::RbTreeNode *node =
+                                               nodeFactory().createNode(value);
+            BloombergLP::bslalg::RbTreeUtil::appendToChain(&d_tree,
+                                                           lastNode,
+                                                           node);
+            lastNode = node;
+        }
+    }
+
+    // Insert the remaining values, if any, one at a time.
+
     while (first != last) {
         insert(*first);
         ++first;
     }
 }
 
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename multiset<KEY, COMPARATOR, ALLOCATOR>::iterator
+multiset<KEY, COMPARATOR, ALLOCATOR>::insert(node_type& node)
+{
+    return insert(end(), node);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename multiset<KEY, COMPARATOR, ALLOCATOR>::iterator
+multiset<KEY, COMPARATOR, ALLOCATOR>::insert(const_iterator hint,
+                                             node_type&     node)
+{
+    if (node.empty()) {
+        return end();                                                 // RETURN
+    }
+
+    BloombergLP::bslalg::RbTreeNode *hintNode =
+                const_cast<BloombergLP::bslalg::RbTreeNode *>(hint.node());
+    bool leftChild;
+    BloombergLP::bslalg::RbTreeNode *insertLocation =
+        BloombergLP::bslalg::RbTreeUtil::findInsertLocation(&leftChild,
+                                                            &d_tree,
+                                                            this->comparator(),
+                                                            node.value(),
+                                                            hintNode);
+    BloombergLP::bslalg::RbTreeNode *newNode =
+        nodeFactory().takeNode(&node,
+                               node.get_allocator() == this->get_allocator());
+    BloombergLP::bslalg::RbTreeUtil::insertAt(&d_tree,
+                                              insertLocation,
+                                              leftChild,
+                                              newNode);
+    return iterator(newNode);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+typename multiset<KEY, COMPARATOR, ALLOCATOR>::node_type
+multiset<KEY, COMPARATOR, ALLOCATOR>::extract(const_iterator position)
+{
+    BSLS_ASSERT_SAFE(position != end());
+
+    BloombergLP::bslalg::RbTreeNode *node =
+                const_cast<BloombergLP::bslalg::RbTreeNode *>(position.node());
+
+    BloombergLP::bslalg::RbTreeNode *detachedNode =
+                                        nodeFactory().createDetachedNode(node);
+    BloombergLP::bslalg::RbTreeUtil::remove(&d_tree, node);
+    nodeFactory().deallocateNode(node);
+
+    node_type result;
+    result.adoptNode(static_cast<Node *>(detachedNode), this->get_allocator());
+    return result;
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename multiset<KEY, COMPARATOR, ALLOCATOR>::node_type
+multiset<KEY, COMPARATOR, ALLOCATOR>::extract(const key_type& key)
+{
+    const_iterator it = find(key);
+    if (it == end()) {
+        return node_type();                                           // RETURN
+    }
+    return extract(it);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+void multiset<KEY, COMPARATOR, ALLOCATOR>::merge(multiset& source)
+{
+    if (this == &source) {
+        return;                                                       // RETURN
+    }
+
+    // Each element is located in this tree before it is relocated, so that
+    // an exception thrown by the comparator leaves it in 'source'.
+
+    const bool isSameAllocator =
+                               source.get_allocator() == this->get_allocator();
+
+    BloombergLP::bslalg::RbTreeNode *node = source.d_tree.firstNode();
+    while (source.d_tree.sentinel() != node) {
+        BloombergLP::bslalg::RbTreeNode *next =
+            BloombergLP::bslalg::RbTreeUtil::next(node);
+
+        bool leftChild;
+        BloombergLP::bslalg::RbTreeNode *insertLocation =
+            BloombergLP::bslalg::RbTreeUtil::findInsertLocation(
+                                           &leftChild,
+                                           &d_tree,
+                                           this->comparator(),
+                                           static_cast<Node *>(node)->value());
+        BloombergLP::bslalg::RbTreeNode *newNode =
+            nodeFactory().createNodeByRelocation(
+                       BSLS_UTIL_ADDRESSOF(static_cast<Node *>(node)->value()),
+                       isSameAllocator);
+        BloombergLP::bslalg::RbTreeUtil::remove(&source.d_tree, node);
+        source.nodeFactory().deallocateNode(node);
+        BloombergLP::bslalg::RbTreeUtil::insertAt(&d_tree,
+                                                  insertLocation,
+                                                  leftChild,
+                                                  newNode);
+        node = next;
+    }
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+void multiset<KEY, COMPARATOR, ALLOCATOR>::mergeUnion(multiset& other)
+{
+    if (this == &other || 0 == other.size()) {
+        return;                                                       // RETURN
+    }
+
+    // Move the objects of 'other' into 'source', a tree of nodes owned by
+    // this multiset, which 'proctor' deletes unless they are all merged by
+    // 'bslalg::RbTreeUtil::merge'.
+
+    BloombergLP::bslalg::RbTreeAnchor                       source;
+    BloombergLP::bslalg::RbTreeUtilTreeProctor<NodeFactory> proctor(
+                                                               &source,
+                                                               &nodeFactory());
+    takeNodes(&source, other);
+    BloombergLP::bslalg::RbTreeUtil::merge(&d_tree,
+                                           &source,
+                                           this->comparator());
+    proctor.release();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+void multiset<KEY, COMPARATOR, ALLOCATOR>::intersect(const multiset& other)
+{
+    if (this == &other) {
+        return;                                                       // RETURN
+    }
+    BloombergLP::bslalg::RbTreeUtil::intersect(&d_tree,
+                                               other.d_tree,
+                                               this->comparator(),
+                                               &nodeFactory());
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+void multiset<KEY, COMPARATOR, ALLOCATOR>::subtract(const multiset& other)
+{
+    if (this == &other) {
+        clear();
+        return;                                                       // RETURN
+    }
+    BloombergLP::bslalg::RbTreeUtil::subtract(&d_tree,
+                                              other.d_tree,
+                                              this->comparator(),
+                                              &nodeFactory());
+}
+
 template <class KEY, class COMPARATOR, class ALLOCATOR>
 inline
 typename multiset<KEY, COMPARATOR, ALLOCATOR>::iterator
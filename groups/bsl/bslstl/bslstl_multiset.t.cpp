@@ -1,6 +1,8 @@
 // bslstl_multiset.t.cpp                                              -*-C++-*-
 #include <bslstl_multiset.h>
 
+#include <bslstl_vector.h>  // for testing only
+
 #include <bslalg_rangecompare.h>
 
 #include <bslma_default.h>
@@ -148,9 +150,17 @@ using namespace bsl;
 //// specialized algorithms:
 // [ 8] void swap(multiset<K, C, A>& a, multiset<K, C, A>& b);
 //
+// [26] node_type extract(const_iterator position);
+// [26] node_type extract(const key_type& key);
+// [26] iterator insert(node_type& node);
+// [26] iterator insert(const_iterator hint, node_type& node);
+// [26] void merge(multiset& source);
+// [28] void mergeUnion(multiset& other);
+// [28] void intersect(const multiset& other);
+// [28] void subtract(const multiset& other);
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [21] USAGE EXAMPLE
+// [29] USAGE EXAMPLE
 //
 // TEST APPARATUS: GENERATOR FUNCTIONS
 // [ 3] int ggg(multiset<T,A> *object, const char *spec, int verbose = 1);
@@ -160,6 +170,7 @@ using namespace bsl;
 // [22] CONCERN: The object is compatible with STL allocator.
 // [23] CONCERN: The object has the necessary type traits
 // [24] CONCERN: The type provides the full interface defined by the standard.
+// [27] CONCERN: Construction from an ordered range takes linear time.
 
 // ============================================================================
 //                      STANDARD BDE ASSERT TEST MACROS
@@ -302,6 +313,19 @@ const DefaultDataRow DEFAULT_DATA[] = {
 };
 static const int DEFAULT_NUM_DATA = sizeof DEFAULT_DATA / sizeof *DEFAULT_DATA;
 
+struct TestTypeDataLess {
+    // This 'struct' provides a comparator ordering objects of the 'bsltf'
+    // test types by the value of their 'data' attribute.
+
+    template <class TYPE>
+    bool operator()(const TYPE& lhs, const TYPE& rhs) const
+        // Return 'true' if the 'data' attribute of the specified 'lhs' is
+        // less than that of the specified 'rhs', and 'false' otherwise.
+    {
+        return lhs.data() < rhs.data();
+    }
+};
+
 //=============================================================================
 //                  GLOBAL HELPER FUNCTIONS FOR TESTING
 //-----------------------------------------------------------------------------
@@ -6406,7 +6430,7 @@ int main(int argc, char *argv[])
     bslma::Default::setDefaultAllocator(&defaultAllocator);
 
     switch (test) { case 0:
-      case 26: {
+      case 29: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //
@@ -6454,6 +6478,576 @@ int main(int argc, char *argv[])
         }
 
       } break;
+      case 28: {
+        // --------------------------------------------------------------------
+        // TESTING SET OPERATIONS
+        //
+        // Concerns:
+        //: 1 'mergeUnion' moves each object of the other multiset into this
+        //:   multiset, after the objects of this multiset having equivalent
+        //:   keys, and leaves the other multiset empty.
+        //:
+        //: 2 'intersect' and 'subtract' leave this multiset holding the
+        //:   objects whose keys are held, or are not held, respectively, by
+        //:   the other multiset, which is not modified.
+        //:
+        //: 3 If both multisets use the same allocator, 'mergeUnion' allocates
+        //:   no memory, and the objects it moves keep their addresses.
+        //:
+        //: 4 If the allocators differ, the objects moved by 'mergeUnion' use
+        //:   the allocator of this multiset.
+        //:
+        //: 5 Applying 'mergeUnion' or 'intersect' to a multiset and itself has
+        //:   no effect, and applying 'subtract' empties the multiset.
+        //:
+        //: 6 If an exception is thrown by 'mergeUnion', this multiset is left
+        //:   unchanged, and no memory is leaked.
+        //
+        // Plan:
+        //: 1 For each pair of rows of a table of arithmetic sequences of
+        //:   repeated keys, apply each operation to multisets holding these
+        //:   keys, using the same and different allocators, and compare the
+        //:   results with those of 'std::merge' and of filtering the keys of
+        //:   this multiset.  (C-1..2)
+        //:
+        //: 2 Using a test allocator monitor, apply 'mergeUnion' to multisets
+        //:   using the same allocator and verify the addresses of the moved
+        //:   objects, then to multisets using different allocators and verify
+        //:   the allocators of the moved objects.  (C-1, 3..4)
+        //:
+        //: 3 Apply each operation to a multiset and itself.  (C-5)
+        //:
+        //: 4 Apply 'mergeUnion' to multisets using different allocators in the
+        //:   presence of injected exceptions (using the
+        //:   'BSLMA_TESTALLOCATOR_EXCEPTION_TEST_*' macros), and verify this
+        //:   multiset after each exception.  (C-6)
+        //
+        // Testing:
+        //   void mergeUnion(multiset& other);
+        //   void intersect(const multiset& other);
+        //   void subtract(const multiset& other);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING SET OPERATIONS"
+                            "\n======================\n");
+
+        typedef bsl::multiset<int> IntSet;
+        typedef bsl::vector<int>   Keys;
+
+        static const struct {
+            int d_line;    // source line number
+            int d_first;   // first key
+            int d_step;    // difference between consecutive keys
+            int d_count;   // number of keys
+            int d_repeat;  // number of objects having each key
+        } DATA[] = {
+            //line  first  step  count  repeat
+            //----  -----  ----  -----  ------
+            { L_,       0,    1,     0,      1 },
+            { L_,       0,    1,     1,      1 },
+            { L_,       0,    1,     1,      3 },
+            { L_,       5,    1,     1,      2 },
+            { L_,       0,    1,    10,      1 },
+            { L_,       0,    2,    10,      2 },
+            { L_,       1,    3,    10,      3 },
+            { L_,      20,    1,    10,      2 },
+            { L_,       0,    1,   300,      1 },
+            { L_,     150,    7,   100,      2 },
+            { L_,     300,    2,   200,      3 },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        bslma::TestAllocator         da("default", veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        if (verbose) printf("Testing the resulting keys.\n");
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int LINE1 = DATA[ti].d_line;
+
+            bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+
+            IntSet mL(&sa);  const IntSet& L = mL;
+            for (int i = 0; i < DATA[ti].d_count; ++i) {
+                for (int j = 0; j < DATA[ti].d_repeat; ++j) {
+                    mL.insert(DATA[ti].d_first + i * DATA[ti].d_step);
+                }
+            }
+
+            for (int tj = 0; tj < NUM_DATA; ++tj) {
+                const int LINE2 = DATA[tj].d_line;
+
+                IntSet mR(&sa);  const IntSet& R = mR;
+                for (int i = 0; i < DATA[tj].d_count; ++i) {
+                    for (int j = 0; j < DATA[tj].d_repeat; ++j) {
+                        mR.insert(DATA[tj].d_first + i * DATA[tj].d_step);
+                    }
+                }
+
+                if (veryVerbose) { T_ P_(LINE1) P(LINE2) }
+
+                Keys expUnion(&sa);
+                Keys expIntersection(&sa);
+                Keys expDifference(&sa);
+                std::merge(L.begin(), L.end(), R.begin(), R.end(),
+                           std::back_inserter(expUnion));
+                for (IntSet::const_iterator it = L.begin(); it != L.end();
+                                                                        ++it) {
+                    if (R.count(*it)) {
+                        expIntersection.push_back(*it);
+                    }
+                    else {
+                        expDifference.push_back(*it);
+                    }
+                }
+
+                bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+                bslma::TestAllocator za("other",  veryVeryVeryVerbose);
+
+                for (int cfg = 0; cfg < 2; ++cfg) {
+                    IntSet mX(L, &oa);                const IntSet& X = mX;
+                    IntSet mY(R, cfg ? &za : &oa);    const IntSet& Y = mY;
+
+                    mX.mergeUnion(mY);
+                    ASSERTV(LINE1, LINE2, cfg,
+                            expUnion == Keys(X.begin(), X.end(), &sa));
+                    ASSERTV(LINE1, LINE2, cfg, Y.empty());
+                }
+                {
+                    IntSet mX(L, &oa);  const IntSet& X = mX;
+                    const IntSet Y(R, &oa);
+
+                    mX.intersect(Y);
+                    ASSERTV(LINE1, LINE2,
+                            expIntersection == Keys(X.begin(), X.end(), &sa));
+                    ASSERTV(LINE1, LINE2, R == Y);
+                }
+                {
+                    IntSet mX(L, &oa);  const IntSet& X = mX;
+                    const IntSet Y(R, &oa);
+
+                    mX.subtract(Y);
+                    ASSERTV(LINE1, LINE2,
+                            expDifference == Keys(X.begin(), X.end(), &sa));
+                    ASSERTV(LINE1, LINE2, R == Y);
+                }
+                ASSERTV(LINE1, LINE2, oa.numBlocksInUse(),
+                        0 == oa.numBlocksInUse());
+                ASSERTV(LINE1, LINE2, za.numBlocksInUse(),
+                        0 == za.numBlocksInUse());
+            }
+        }
+
+        typedef bsltf::AllocBitwiseMoveableTestType      Element;
+        typedef bsl::multiset<Element, TestTypeDataLess> Obj;
+
+        const int NUM_VALUES = 16;
+
+        if (verbose) printf("Testing the reuse of nodes.\n");
+        {
+            bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+            bslma::TestAllocator za("other",   veryVeryVeryVerbose);
+            bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+            {
+                Obj mX(&oa);  const Obj& X = mX;
+                Obj mY(&oa);  const Obj& Y = mY;
+                Obj mZ(&za);  const Obj& Z = mZ;
+
+                for (int i = 0; i < NUM_VALUES; ++i) {
+                    mX.insert(Element(2 * i, &sa));
+                    mY.insert(Element(3 * i, &sa));
+                    mZ.insert(Element(5 * i + 1, &sa));
+                }
+
+                const Element *KEPT  = &*X.find(Element(0, &sa));
+                const Element *MOVED = &*Y.find(Element(0, &sa));
+
+                bslma::TestAllocatorMonitor oam(&oa);
+
+                mX.mergeUnion(mY);
+
+                ASSERT(oam.isTotalSame());
+                ASSERT(Y.empty());
+                ASSERTV(X.size(), 2 * NUM_VALUES == X.size());
+                ASSERT(KEPT  == &*X.find(Element(0, &sa)));
+                ASSERT(MOVED == &*++X.find(Element(0, &sa)));
+
+                mX.mergeUnion(mZ);
+
+                ASSERT(Z.empty());
+                ASSERTV(X.size(), 3 * NUM_VALUES == X.size());
+                for (Obj::const_iterator it = X.begin(); it != X.end(); ++it) {
+                    ASSERTV(it->data(), &oa == it->allocator());
+                }
+
+                // 'Y', which is empty and has no nodes left, can be reused.
+
+                mY.insert(Element(1, &sa));
+                ASSERTV(Y.size(), 1 == Y.size());
+            }
+            ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+            ASSERTV(za.numBlocksInUse(), 0 == za.numBlocksInUse());
+        }
+
+        if (verbose) printf("Testing aliasing.\n");
+        {
+            bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+            bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+
+            Obj mX(&oa);  const Obj& X = mX;
+            for (int i = 0; i < NUM_VALUES; ++i) {
+                mX.insert(Element(i / 2, &sa));
+            }
+            const Obj W(X, &sa);
+
+            mX.mergeUnion(mX);
+            ASSERT(W == X);
+
+            mX.intersect(X);
+            ASSERT(W == X);
+
+            mX.subtract(X);
+            ASSERT(X.empty());
+        }
+
+        if (verbose) printf("Testing exception safety.\n");
+        {
+            bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+            bslma::TestAllocator za("other",   veryVeryVeryVerbose);
+            bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+            {
+                Obj mX(&oa);  const Obj& X = mX;
+                for (int i = 0; i < NUM_VALUES; ++i) {
+                    mX.insert(Element(2 * i, &sa));
+                }
+                const Obj W(X, &sa);
+
+                BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                    ASSERT(W == X);
+
+                    Obj mZ(&za);
+                    for (int i = 0; i < NUM_VALUES; ++i) {
+                        mZ.insert(Element(3 * i, &sa));
+                    }
+
+                    mX.mergeUnion(mZ);
+                } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+                ASSERTV(X.size(), 2 * NUM_VALUES == X.size());
+            }
+            ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+            ASSERTV(za.numBlocksInUse(), 0 == za.numBlocksInUse());
+        }
+      } break;
+      case 27: {
+        // --------------------------------------------------------------------
+        // TESTING CONSTRUCTION FROM ORDERED RANGES
+        //
+        // Concerns:
+        //: 1 Constructing a multiset from a range, or inserting a range into
+        //:   an empty multiset, yields a multiset holding all the values in
+        //:   the range, values having equivalent keys being in the order of
+        //:   the range, whether the keys of the range are increasing,
+        //:   non-decreasing, or ordered only up to some position.
+        //:
+        //: 2 Inserting a range into a non-empty multiset is unaffected.
+        //:
+        //: 3 When the length of the range can be determined in advance, the
+        //:   nodes for the range are obtained from the allocator in a single
+        //:   allocation.
+        //:
+        //: 4 If an exception is thrown, the multiset is left valid, holding a
+        //:   subset of the values in the range, and no memory is leaked.
+        //
+        // Plan:
+        //: 1 For each row of a table of ranges, generated from an increasing
+        //:   sequence of keys by repeating each key and by making the keys
+        //:   after some position decreasing, and smaller than the keys before
+        //:   that position, construct a multiset from the range, insert the
+        //:   range into an empty multiset and into a multiset holding other
+        //:   values, and compare the results with multisets built by inserting
+        //:   the values one at a time.  (C-1..2)
+        //:
+        //: 2 Verify that constructing a multiset from a range allocates a
+        //:   single block.  (C-3)
+        //:
+        //: 3 Insert each range into an empty multiset in the presence of
+        //:   injected exceptions (using the
+        //:   'BSLMA_TESTALLOCATOR_EXCEPTION_TEST_*' macros), and verify the
+        //:   multiset after each exception.  (C-4)
+        //
+        // Testing:
+        //   CONCERN: Construction from an ordered range takes linear time.
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING CONSTRUCTION FROM ORDERED RANGES"
+                            "\n========================================\n");
+
+        typedef bsl::multiset<int>  IntSet;
+        typedef bsl::vector<int> Range;
+
+        static const struct {
+            int d_line;        // source line number
+            int d_length;      // number of values in the range
+            int d_repeat;      // number of consecutive values having each key
+            int d_orderedLen;  // length of the ordered prefix of the range
+        } DATA[] = {
+            //line  length  repeat  ordered
+            //----  ------  ------  -------
+            { L_,        0,      1,       0 },
+            { L_,        1,      1,       1 },
+            { L_,        2,      1,       2 },
+            { L_,        2,      1,       1 },
+            { L_,        2,      2,       2 },
+            { L_,        3,      1,       3 },
+            { L_,        7,      1,       7 },
+            { L_,        7,      3,       7 },
+            { L_,        7,      1,       4 },
+            { L_,        8,      1,       8 },
+            { L_,        8,      2,       5 },
+            { L_,      100,      1,     100 },
+            { L_,      100,      3,     100 },
+            { L_,      100,      1,      50 },
+            { L_,      100,      1,       1 },
+            { L_,     1000,      1,    1000 },
+            { L_,     1000,      4,     999 },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        bslma::TestAllocator         da("default", veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int LINE    = DATA[ti].d_line;
+            const int LENGTH  = DATA[ti].d_length;
+            const int REPEAT  = DATA[ti].d_repeat;
+            const int ORDERED = DATA[ti].d_orderedLen;
+
+            if (veryVerbose) { T_ P_(LINE) P_(LENGTH) P_(REPEAT) P(ORDERED) }
+
+            bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+
+            Range range(&sa);
+            for (int i = 0; i < LENGTH; ++i) {
+                const int position = i < ORDERED
+                                   ? LENGTH - ORDERED + i
+                                   : LENGTH - 1 - i;
+                range.push_back(position / REPEAT);
+            }
+
+            IntSet expected(&sa);
+            for (int i = 0; i < LENGTH; ++i) {
+                expected.insert(range[i]);
+            }
+
+            {
+                bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+                const IntSet X(range.begin(), range.end(), std::less<int>(),
+                               &oa);
+
+                ASSERTV(LINE, expected == X);
+                ASSERTV(LINE, oa.numBlocksTotal(),
+                        (0 < LENGTH ? 1 : 0) == oa.numBlocksTotal());
+            }
+            {
+                bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+                IntSet mX(&oa);  const IntSet& X = mX;
+                mX.insert(range.begin(), range.end());
+
+                ASSERTV(LINE, expected == X);
+            }
+            {
+                bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+                IntSet mX(&oa);  const IntSet& X = mX;
+                mX.insert(-1);
+                mX.insert(LENGTH);
+                mX.insert(range.begin(), range.end());
+
+                IntSet mY(expected, &sa);  const IntSet& Y = mY;
+                mY.insert(-1);
+                mY.insert(LENGTH);
+
+                ASSERTV(LINE, Y == X);
+            }
+            {
+                bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+                IntSet mX(&oa);  const IntSet& X = mX;
+
+                BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                    ASSERTV(LINE, X.size() <= expected.size());
+                    for (IntSet::const_iterator it = X.begin();
+                                                       it != X.end(); ++it) {
+                        ASSERTV(LINE, 0 < expected.count(*it));
+                    }
+                    mX.clear();
+
+                    mX.insert(range.begin(), range.end());
+                } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+                ASSERTV(LINE, expected == X);
+            }
+            ASSERTV(LINE, da.numBlocksTotal(), 0 == da.numBlocksTotal());
+        }
+      } break;
+      case 26: {
+        // --------------------------------------------------------------------
+        // TESTING NODE HANDLES
+        //
+        // Concerns:
+        //: 1 'extract' removes the element at a position, or having a key,
+        //:   and returns a handle holding that element and the allocator of
+        //:   the container; extracting a missing key yields an empty handle.
+        //:
+        //: 2 'insert' inserts the element held by a handle, and empties the
+        //:   handle.  Inserting an empty handle has no effect.
+        //:
+        //: 3 An element held by a handle is inserted into a container using
+        //:   the same allocator without allocating memory, even if the
+        //:   container it was extracted from has been destroyed.
+        //:
+        //: 4 'merge' moves every element of the source, including when the
+        //:   two containers use different allocators, and the moved elements
+        //:   then use the allocator of the target.
+        //:
+        //: 5 Merging a container with itself has no effect.
+        //:
+        //: 6 No memory is leaked.
+        //
+        // Plan:
+        //: 1 Extract elements from a container, and insert them into the same
+        //:   and another container, verifying the sizes of the containers, the
+        //:   state of the handles, and (using a test allocator monitor) that
+        //:   no memory is allocated by 'insert'.  Repeat with a handle
+        //:   outliving the container it was extracted from.  (C-1..3)
+        //:
+        //: 2 Merge containers using the same and different allocators, and
+        //:   verify the sizes of the containers and the allocators of the
+        //:   moved elements.  (C-4..5)
+        //:
+        //: 3 Verify that no memory is in use once the containers are
+        //:   destroyed.  (C-6)
+        //
+        // Testing:
+        //   node_type extract(const_iterator position);
+        //   node_type extract(const key_type& key);
+        //   iterator insert(node_type& node);
+        //   iterator insert(const_iterator hint, node_type& node);
+        //   void merge(multiset& source);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING NODE HANDLES"
+                            "\n====================\n");
+
+        typedef bsltf::AllocBitwiseMoveableTestType      Element;
+        typedef bsl::multiset<Element, TestTypeDataLess> Obj;
+        typedef Obj::node_type                           Handle;
+
+        const int NUM_VALUES = 8;
+
+        bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+        bslma::TestAllocator za("other",   veryVeryVeryVerbose);
+        bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+            Obj mY(&oa);  const Obj& Y = mY;
+            Obj mZ(&za);  const Obj& Z = mZ;
+
+            for (int i = 0; i != NUM_VALUES; ++i) {
+                mX.insert(Element(i, &sa));
+                if (i % 2) {
+                    mY.insert(Element(i, &sa));
+                }
+                if (i >= NUM_VALUES - 2) {
+                    mZ.insert(Element(i, &sa));
+                    mZ.insert(Element(i + 2, &sa));
+                }
+            }
+            ASSERTV(Z.size(), 4 == Z.size());
+
+            if (verbose) printf("Testing 'extract'.\n");
+
+            Handle mH = mX.extract(X.find(Element(0, &sa)));
+            const Handle& H = mH;
+            ASSERT(!H.empty());
+            ASSERTV(H.value().data(), 0 == H.value().data());
+            ASSERT(X.get_allocator() == H.get_allocator());
+            ASSERTV(X.size(), NUM_VALUES - 1 == X.size());
+            ASSERT(X.end() == X.find(Element(0, &sa)));
+
+            Handle mG(mX.extract(Element(1, &sa)));  const Handle& G = mG;
+            ASSERT(!G.empty());
+            ASSERTV(G.value().data(), 1 == G.value().data());
+            ASSERTV(X.size(), NUM_VALUES - 2 == X.size());
+
+            ASSERT(mX.extract(Element(1, &sa)).empty());
+            ASSERTV(X.size(), NUM_VALUES - 2 == X.size());
+
+            if (verbose) printf("Testing 'insert'.\n");
+
+            const Obj::size_type SIZE_Y = Y.size();
+
+            Obj::iterator it = mY.insert(mG);
+            ASSERTV(it->data(), 1 == it->data());
+            ASSERT(G.empty());
+            ASSERTV(Y.size(), SIZE_Y + 1 == Y.size());
+            ASSERTV(Y.count(Element(1, &sa)), 2 == Y.count(Element(1, &sa)));
+
+            // 'X' uses the same allocator as 'H'.
+
+            bslma::TestAllocatorMonitor oam(&oa);
+
+            Obj::iterator hintResult = mX.insert(X.begin(), mH);
+            ASSERTV(hintResult->data(), 0 == hintResult->data());
+            ASSERT(H.empty());
+            ASSERTV(X.size(), NUM_VALUES - 1 == X.size());
+
+            ASSERT(oam.isTotalSame());
+
+            Handle mE;
+            ASSERT(X.end() == mX.insert(mE));
+
+            ASSERT(X.end() == mX.insert(X.begin(), mE));
+
+            // A handle keeps its node after the container is destroyed.
+
+            {
+                Obj mW(&oa);
+                mW.insert(Element(-1, &sa));
+
+                mH = mW.extract(Element(-1, &sa));
+            }
+            ASSERTV(H.value().data(), -1 == H.value().data());
+
+            oam.reset();
+            it = mX.insert(mH);
+            ASSERT(oam.isTotalSame());
+
+            mX.erase(Element(-1, &sa));
+
+            if (verbose) printf("Testing 'merge'.\n");
+
+            const Obj::size_type SIZE_X = X.size();
+
+            mX.merge(mX);
+            ASSERTV(X.size(), SIZE_X == X.size());
+
+            mX.merge(mZ);
+            ASSERTV(X.size(), SIZE_X + 4 == X.size());
+            ASSERTV(Z.size(), 0 == Z.size());
+            ASSERT(&oa == X.find(Element(NUM_VALUES, &sa))->allocator());
+            ASSERT(&oa == X.find(Element(NUM_VALUES + 1, &sa))->allocator());
+
+            mY.merge(mX);
+            ASSERTV(Y.size(), SIZE_Y + 1 + SIZE_X + 4 == Y.size());
+            ASSERTV(X.size(), 0 == X.size());
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+        ASSERTV(za.numBlocksInUse(), 0 == za.numBlocksInUse());
+      } break;
       case 25: {
         // --------------------------------------------------------------------
         // TESTING STANDARD INTERFACE COVERAGE
@@ -0,0 +1,667 @@
+// bslstl_nodehandle.h                                                -*-C++-*-
+#ifndef INCLUDED_BSLSTL_NODEHANDLE
+#define INCLUDED_BSLSTL_NODEHANDLE
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a handle owning a node extracted from a container.
+//
+//@CLASSES:
+//  bslstl::NodeHandle: owner of a node extracted from a node-based container
+//  bslstl::NodeHandleUtil: utility for relocating container elements
+//
+//@SEE_ALSO: bslstl_map, bslstl_set, bslstl_unorderedmap, bslstl_unorderedset
+//
+//@DESCRIPTION: This component provides a mechanism, 'bslstl::NodeHandle',
+// that owns (at most) one node holding an element removed from a node-based
+// container (e.g., 'bsl::map' or 'bsl::unordered_set') by the container's
+// 'extract' method, together with that element and a copy of the allocator of
+// that container.  The node can later be inserted into a container of the
+// same type by passing the handle to that container's 'insert' method,
+// without copying the element.  This component also provides a utility,
+// 'bslstl::NodeHandleUtil', that implements the relocation of an element from
+// one storage location to another, which the node pools use to move an
+// element out of a container, or into a container whose allocator differs
+// from that of the element.
+//
+///Node Ownership
+///--------------
+// The nodes of the 'bsl' node-based containers are obtained from a pool owned
+// by each container (see 'bslstl_simplepool'), whose memory is returned to
+// the allocator only when the container is destroyed, so that a node of a
+// container cannot be handed over as it is to an owner that may outlive the
+// container.  A container extracting an element therefore relocates it (see
+// 'NodeHandleUtil::relocate') into a *detached* node, a node allocated in
+// memory of its own that is not owned by any pool (see
+// {'bslstl_simplepool'|Detached Blocks}), which is owned by the returned
+// 'NodeHandle'.  The node that held the element in the container is returned
+// to the pool of the container for reuse.  Note that extracting an element
+// never keeps alive any other memory of the container.
+//
+// When a handle is passed to the 'insert' method of a container whose
+// allocator compares equal to that of the handle, and whose pool has no free
+// node, the pool of the container *adopts* the detached node, which is linked
+// into the container: no memory is allocated, and the element keeps the
+// address it has in the handle until it is erased.  The adopted node is later
+// reused by that container like any other of its nodes.  Otherwise, the
+// element is relocated into a node of the target container (reusing a free
+// node, if any), and the detached node is returned to the allocator of the
+// handle.  A pool therefore adopts a node only when it would otherwise have
+// to grow, so that the memory of a container is bounded by the maximum number
+// of elements it held at once, however many handles it is given.
+//
+// When a handle that holds a node is destroyed (or 'reset'), the element is
+// destroyed and the detached node is returned to the allocator of the handle.
+//
+// An element is relocated by copying its footprint (using 'memcpy') if its
+// type is bitwise moveable (see 'bslmf_isbitwisemoveable') and either the
+// source and the target of the relocation use allocators that compare equal
+// or the type does not use a 'bslma::Allocator'.  Otherwise, the element is
+// copy-constructed using the allocator of the target, and the original is
+// destroyed.
+//
+///Ownership Transfer
+///------------------
+// A 'NodeHandle' is movable but not copyable: like 'bslma::ManagedPtr', a
+// 'NodeHandle' that is copy-constructed or assigned *from* transfers its node
+// (and allocator) to the target, and is left empty.  As C++03 has no rvalue
+// references, the "copy" constructor and assignment operator take a
+// modifiable reference, and a 'NodeHandle' returned by value (e.g., from
+// 'extract') is transferred through an implicit conversion to the
+// 'bslstl::NodeHandle_Ref' proxy type.  Transferring a node between handles
+// only copies pointers, and never throws.  The 'insert' methods of the
+// containers take the handle by modifiable reference, so that a handle whose
+// node could not be inserted (because a unique container already holds an
+// element with an equivalent key) still owns that node after the call.
+//
+///Usage
+///-----
+// This section illustrates intended usage of this component.
+//
+///Example 1: Holding a Detached Node
+/// - - - - - - - - - - - - - - - - -
+// A 'NodeHandle' is normally obtained from the 'extract' method of a
+// container, and handed back to the 'insert' method of a container.  In this
+// example we play the role of the container ourselves.
+//
+// First, we define a simple node type holding an 'int', and a pool of such
+// nodes:
+//..
+//  struct MyNode {
+//      // This 'struct' is a node holding an 'int' element.
+//
+//      int d_value;
+//
+//      int& value() { return d_value; }
+//  };
+//
+//  typedef bsl::allocator<int>                           Allocator;
+//  typedef bslstl::SimplePool<MyNode, Allocator>         Pool;
+//  typedef bslstl::NodeHandle<int, MyNode, Allocator>    Handle;
+//
+//  bslma::TestAllocator ta;
+//  Allocator            allocator(&ta);
+//
+//  Pool *pool = new (ta) Pool(allocator);
+//..
+// Next, we create an element in a detached node allocated by the pool, as a
+// container does when it extracts an element, and pass the node to an empty
+// node handle:
+//..
+//  MyNode *node = pool->allocateDetached();
+//  node->d_value = 42;
+//
+//  Handle handle;
+//  assert(handle.empty());
+//
+//  handle.adoptNode(node, allocator);
+//  assert(!handle.empty());
+//  assert(42 == handle.value());
+//..
+// Then, we destroy the pool, as happens when the container is destroyed, and
+// observe that the node is still valid, as it is not owned by the pool:
+//..
+//  ta.deleteObject(pool);
+//  assert(1 == ta.numBlocksInUse());
+//
+//  assert(node == handle.node());
+//  assert(42   == handle.value());
+//..
+// Next, we transfer the node to another handle, leaving 'handle' empty:
+//..
+//  Handle other(handle);
+//  assert( handle.empty());
+//  assert(!other.empty());
+//  assert(node == other.node());
+//..
+// Finally, we note that the element is destroyed, and the memory of the node
+// returned to the allocator, when 'other' is destroyed, or 'reset':
+//..
+//  other.reset();
+//  assert(other.empty());
+//  assert(0 == ta.numBlocksInUse());
+//..
+
+#ifndef INCLUDED_BSLSCM_VERSION
+#include <bslscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_ALLOCATOR
+#include <bslstl_allocator.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_ALLOCATORTRAITS
+#include <bslstl_allocatortraits.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_SIMPLEPOOL
+#include <bslstl_simplepool.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_USESBSLMAALLOCATOR
+#include <bslma_usesbslmaallocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_ISBITWISEMOVEABLE
+#include <bslmf_isbitwisemoveable.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_BSLS_NATIVESTD
+#include <bsls_nativestd.h>
+#endif
+
+#ifndef INCLUDED_BSLS_UTIL
+#include <bsls_util.h>
+#endif
+
+#ifndef INCLUDED_ALGORITHM
+#include <algorithm>  // for 'swap'
+#define INCLUDED_ALGORITHM
+#endif
+
+#ifndef INCLUDED_CSTRING
+#include <cstring>    // for 'memcpy'
+#define INCLUDED_CSTRING
+#endif
+
+namespace BloombergLP {
+namespace bslstl {
+
+template <class VALUE, class NODE, class ALLOCATOR>
+class NodeHandle;
+
+                          // =====================
+                          // struct NodeHandleUtil
+                          // =====================
+
+struct NodeHandleUtil {
+    // This 'struct' provides a namespace for a function relocating an element
+    // of a node-based container between two storage locations.
+
+    // CLASS METHODS
+    template <class VALUE, class ALLOCATOR>
+    static void relocate(VALUE     *address,
+                         VALUE     *original,
+                         ALLOCATOR *allocator,
+                         bool       isSameAllocator);
+        // Move the object at the specified 'original' address to the
+        // uninitialized storage at the specified 'address', and end the
+        // lifetime of 'original', using the specified 'allocator' to supply
+        // memory to the object at 'address' if a copy is made.  The specified
+        // 'isSameAllocator' indicates whether the object at 'original' was
+        // created using an allocator that compares equal to '*allocator'.  If
+        // the (template parameter) type 'VALUE' is bitwise moveable and either
+        // 'isSameAllocator' is 'true' or 'VALUE' does not use a
+        // 'bslma::Allocator', copy the footprint of the object; otherwise
+        // copy-construct the object at 'address' and destroy the object at
+        // 'original'.  If an exception is thrown, 'address' is left
+        // uninitialized and the object at 'original' is unchanged.
+};
+
+                          // ====================
+                          // class NodeHandle_Ref
+                          // ====================
+
+template <class VALUE, class NODE, class ALLOCATOR>
+class NodeHandle_Ref {
+    // This class holds the address of a 'NodeHandle' whose node is being
+    // transferred from a temporary (see {Ownership Transfer}).  It should not
+    // be used directly by clients.
+
+    // DATA
+    NodeHandle<VALUE, NODE, ALLOCATOR> *d_handle_p;  // handle being
+                                                     // transferred from
+
+  public:
+    // CREATORS
+    explicit NodeHandle_Ref(NodeHandle<VALUE, NODE, ALLOCATOR> *handle);
+        // Create a proxy for the specified 'handle'.
+
+    // ACCESSORS
+    NodeHandle<VALUE, NODE, ALLOCATOR> *handle() const;
+        // Return the address of the handle referred to by this proxy.
+};
+
+                            // ================
+                            // class NodeHandle
+                            // ================
+
+template <class VALUE, class NODE, class ALLOCATOR>
+class NodeHandle {
+    // This class owns at most one node of the (template parameter) type
+    // 'NODE', holding an element of the (template parameter) type 'VALUE',
+    // that has been extracted from a node-based container having the
+    // (template parameter) type 'ALLOCATOR' as its 'allocator_type', together
+    // with a copy of the allocator of that container.  The node is a detached
+    // node allocated by a 'SimplePool<NODE, ALLOCATOR>' (see {Node
+    // Ownership}).  'NODE' must provide a 'value' method returning a
+    // reference to the element.  A 'NodeHandle' is movable but not copyable
+    // (see {Ownership Transfer}).
+
+    // PRIVATE TYPES
+    typedef bsl::allocator_traits<ALLOCATOR> AllocatorTraits;
+
+    typedef SimplePool<NODE, ALLOCATOR>      Pool;
+
+    // DATA
+    NODE      *d_node_p;     // detached node owned by this handle, or 0 if
+                             // empty
+
+    ALLOCATOR  d_allocator;  // allocator of the element and of the node
+
+    // PRIVATE MANIPULATORS
+    void deallocateNode();
+        // Return the memory of the node owned by this handle to the allocator
+        // of this handle, without destroying its element, and make this
+        // handle empty.  The behavior is undefined if this handle is empty.
+
+    void transferFrom(NodeHandle *original);
+        // Destroy the element held by this handle, if any, and then move the
+        // node and allocator of the specified 'original' handle to this
+        // handle, leaving 'original' empty.
+
+  public:
+    // CREATORS
+    NodeHandle();
+        // Create an empty node handle having a default-constructed allocator.
+
+    NodeHandle(NodeHandle& original);
+        // Create a node handle that owns the node and the allocator held by
+        // the specified 'original' handle, and make 'original' empty.
+
+    NodeHandle(NodeHandle_Ref<VALUE, NODE, ALLOCATOR> ref);
+        // Create a node handle that owns the node and the allocator held by
+        // the handle referred to by the specified 'ref', and make that handle
+        // empty.
+
+    ~NodeHandle();
+        // Destroy this object, and the element of the node it owns, if any.
+
+    // MANIPULATORS
+    NodeHandle& operator=(NodeHandle& rhs);
+        // Destroy the element held by this handle, if any, move the node and
+        // the allocator held by the specified 'rhs' to this handle, make
+        // 'rhs' empty, and return a reference providing modifiable access to
+        // this handle.  This method has no effect if 'rhs' is this handle.
+
+    NodeHandle& operator=(NodeHandle_Ref<VALUE, NODE, ALLOCATOR> ref);
+        // Destroy the element held by this handle, if any, move the node and
+        // the allocator held by the handle referred to by the specified 'ref'
+        // to this handle, make that handle empty, and return a reference
+        // providing modifiable access to this handle.
+
+    operator NodeHandle_Ref<VALUE, NODE, ALLOCATOR>();
+        // Return a proxy referring to this handle, allowing the node of a
+        // temporary handle to be transferred.
+
+    void adoptNode(NODE *node, const ALLOCATOR& allocator);
+        // Destroy the element held by this handle, if any, and take over the
+        // ownership of the specified detached 'node' (see {Node Ownership}),
+        // holding an element created using the specified 'allocator'.  Adopt
+        // 'allocator' as the allocator of this handle.  The behavior is
+        // undefined unless 'node' was allocated by the 'allocateDetached'
+        // method of a 'SimplePool' whose allocator compares equal to
+        // 'allocator', and is not owned by a pool.  Note that this method is
+        // intended for use by node-based containers.
+
+    NODE *releaseNode();
+        // Make this handle empty, and return the address of the node it
+        // owned, transferring the ownership of the node and of its element to
+        // the caller (e.g., to be adopted by a node pool).  The behavior is
+        // undefined if this handle is empty.  Note that this method is
+        // intended for use by node-based containers.
+
+    void releaseValue();
+        // Make this handle empty without destroying the element it holds,
+        // whose lifetime must have been ended by the caller (e.g., by
+        // relocating it into a container), and return the memory of its node
+        // to the allocator of this handle.  The behavior is undefined if this
+        // handle is empty.  Note that this method is intended for use by
+        // node-based containers.
+
+    void reset();
+        // Destroy the element held by this handle, if any, return the memory
+        // of its node to the allocator of this handle, and make this handle
+        // empty.
+
+    void swap(NodeHandle& other);
+        // Exchange the nodes and allocators held by this handle and the
+        // specified 'other' handle.  This method provides the no-throw
+        // exception-safety guarantee.
+
+    VALUE& value();
+        // Return a reference providing modifiable access to the element held
+        // by this handle.  The behavior is undefined if this handle is empty.
+
+    // ACCESSORS
+    bool empty() const;
+        // Return 'true' if this handle owns no node, and 'false' otherwise.
+
+    ALLOCATOR get_allocator() const;
+        // Return a copy of the allocator of the element held by this handle,
+        // or (if this handle has always been empty) of a default-constructed
+        // allocator.
+
+    NODE *node() const;
+        // Return the address of the node owned by this handle, or 0 if this
+        // handle is empty.
+
+    const VALUE& value() const;
+        // Return a reference providing non-modifiable access to the element
+        // held by this handle.  The behavior is undefined if this handle is
+        // empty.
+};
+
+// FREE FUNCTIONS
+template <class VALUE, class NODE, class ALLOCATOR>
+void swap(NodeHandle<VALUE, NODE, ALLOCATOR>& a,
+          NodeHandle<VALUE, NODE, ALLOCATOR>& b);
+    // Exchange the nodes and allocators held by the specified 'a' and 'b'
+    // handles.
+
+// ===========================================================================
+//                  TEMPLATE AND INLINE FUNCTION DEFINITIONS
+// ===========================================================================
+
+                          // ---------------------
+                          // struct NodeHandleUtil
+                          // ---------------------
+
+// CLASS METHODS
+template <class VALUE, class ALLOCATOR>
+inline
+void NodeHandleUtil::relocate(VALUE     *address,
+                              VALUE     *original,
+                              ALLOCATOR *allocator,
+                              bool       isSameAllocator)
+{
+    BSLS_ASSERT_SAFE(address);
+    BSLS_ASSERT_SAFE(original);
+    BSLS_ASSERT_SAFE(allocator);
+
+    if (bslmf::IsBitwiseMoveable<VALUE>::value
+     && (isSameAllocator || !bslma::UsesBslmaAllocator<VALUE>::value)) {
+        native_std::memcpy(static_cast<void *>(address),
+                           static_cast<const void *>(original),
+                           sizeof(VALUE));
+        return;                                                       // RETURN
+    }
+
+    typedef bsl::allocator_traits<ALLOCATOR> Traits;
+
+    Traits::construct(*allocator, address, *original);
+    Traits::destroy(*allocator, original);
+}
+
+                          // --------------------
+                          // class NodeHandle_Ref
+                          // --------------------
+
+// CREATORS
+template <class VALUE, class NODE, class ALLOCATOR>
+inline
+NodeHandle_Ref<VALUE, NODE, ALLOCATOR>::NodeHandle_Ref(
+                                    NodeHandle<VALUE, NODE, ALLOCATOR> *handle)
+: d_handle_p(handle)
+{
+    BSLS_ASSERT_SAFE(handle);
+}
+
+// ACCESSORS
+template <class VALUE, class NODE, class ALLOCATOR>
+inline
+NodeHandle<VALUE, NODE, ALLOCATOR> *
+NodeHandle_Ref<VALUE, NODE, ALLOCATOR>::handle() const
+{
+    return d_handle_p;
+}
+
+                            // ----------------
+                            // class NodeHandle
+                            // ----------------
+
+// PRIVATE MANIPULATORS
+template <class VALUE, class NODE, class ALLOCATOR>
+inline
+void NodeHandle<VALUE, NODE, ALLOCATOR>::deallocateNode()
+{
+    BSLS_ASSERT_SAFE(d_node_p);
+
+    NODE *node = d_node_p;
+    d_node_p   = 0;
+    Pool::deallocateDetached(node,
+                             typename Pool::AllocatorType(d_allocator));
+}
+
+template <class VALUE, class NODE, class ALLOCATOR>
+inline
+void NodeHandle<VALUE, NODE, ALLOCATOR>::transferFrom(NodeHandle *original)
+{
+    BSLS_ASSERT_SAFE(original);
+    BSLS_ASSERT_SAFE(this != original);
+
+    reset();
+    d_allocator        = original->d_allocator;
+    d_node_p           = original->d_node_p;
+    original->d_node_p = 0;
+}
+
+// CREATORS
+template <class VALUE, class NODE, class ALLOCATOR>
+inline
+NodeHandle<VALUE, NODE, ALLOCATOR>::NodeHandle()
+: d_node_p(0)
+, d_allocator()
+{
+}
+
+template <class VALUE, class NODE, class ALLOCATOR>
+inline
+NodeHandle<VALUE, NODE, ALLOCATOR>::NodeHandle(NodeHandle& original)
+: d_node_p(original.d_node_p)
+, d_allocator(original.d_allocator)
+{
+    original.d_node_p = 0;
+}
+
+template <class VALUE, class NODE, class ALLOCATOR>
+inline
+NodeHandle<VALUE, NODE, ALLOCATOR>::NodeHandle(
+                                    NodeHandle_Ref<VALUE, NODE, ALLOCATOR> ref)
+: d_node_p(ref.handle()->d_node_p)
+, d_allocator(ref.handle()->d_allocator)
+{
+    ref.handle()->d_node_p = 0;
+}
+
+template <class VALUE, class NODE, class ALLOCATOR>
+inline
+NodeHandle<VALUE, NODE, ALLOCATOR>::~NodeHandle()
+{
+    reset();
+}
+
+// MANIPULATORS
+template <class VALUE, class NODE, class ALLOCATOR>
+inline
+NodeHandle<VALUE, NODE, ALLOCATOR>&
+NodeHandle<VALUE, NODE, ALLOCATOR>::operator=(NodeHandle& rhs)
+{
+    if (this != &rhs) {
+        transferFrom(&rhs);
+    }
+    return *this;
+}
+
+template <class VALUE, class NODE, class ALLOCATOR>
+inline
+NodeHandle<VALUE, NODE, ALLOCATOR>&
+NodeHandle<VALUE, NODE, ALLOCATOR>::operator=(
+                                    NodeHandle_Ref<VALUE, NODE, ALLOCATOR> ref)
+{
+    return *this = *ref.handle();
+}
+
+template <class VALUE, class NODE, class ALLOCATOR>
+inline
+NodeHandle<VALUE, NODE, ALLOCATOR>::
+                              operator NodeHandle_Ref<VALUE, NODE, ALLOCATOR>()
+{
+    return NodeHandle_Ref<VALUE, NODE, ALLOCATOR>(this);
+}
+
+template <class VALUE, class NODE, class ALLOCATOR>
+inline
+void NodeHandle<VALUE, NODE, ALLOCATOR>::adoptNode(
+                                                   NODE             *node,
+                                                   const ALLOCATOR&  allocator)
+{
+    BSLS_ASSERT_SAFE(node);
+
+    reset();
+    d_allocator = allocator;
+    d_node_p    = node;
+}
+
+template <class VALUE, class NODE, class ALLOCATOR>
+inline
+NODE *NodeHandle<VALUE, NODE, ALLOCATOR>::releaseNode()
+{
+    BSLS_ASSERT_SAFE(d_node_p);
+
+    NODE *node = d_node_p;
+    d_node_p   = 0;
+    return node;
+}
+
+template <class VALUE, class NODE, class ALLOCATOR>
+inline
+void NodeHandle<VALUE, NODE, ALLOCATOR>::releaseValue()
+{
+    BSLS_ASSERT_SAFE(d_node_p);
+
+    deallocateNode();
+}
+
+template <class VALUE, class NODE, class ALLOCATOR>
+inline
+void NodeHandle<VALUE, NODE, ALLOCATOR>::reset()
+{
+    if (d_node_p) {
+        AllocatorTraits::destroy(d_allocator,
+                                 bsls::Util::addressOf(d_node_p->value()));
+        deallocateNode();
+    }
+}
+
+template <class VALUE, class NODE, class ALLOCATOR>
+inline
+void NodeHandle<VALUE, NODE, ALLOCATOR>::swap(NodeHandle& other)
+{
+    native_std::swap(d_node_p,    other.d_node_p);
+    native_std::swap(d_allocator, other.d_allocator);
+}
+
+template <class VALUE, class NODE, class ALLOCATOR>
+inline
+VALUE& NodeHandle<VALUE, NODE, ALLOCATOR>::value()
+{
+    BSLS_ASSERT_SAFE(d_node_p);
+
+    return d_node_p->value();
+}
+
+// ACCESSORS
+template <class VALUE, class NODE, class ALLOCATOR>
+inline
+bool NodeHandle<VALUE, NODE, ALLOCATOR>::empty() const
+{
+    return !d_node_p;
+}
+
+template <class VALUE, class NODE, class ALLOCATOR>
+inline
+ALLOCATOR NodeHandle<VALUE, NODE, ALLOCATOR>::get_allocator() const
+{
+    return d_allocator;
+}
+
+template <class VALUE, class NODE, class ALLOCATOR>
+inline
+NODE *NodeHandle<VALUE, NODE, ALLOCATOR>::node() const
+{
+    return d_node_p;
+}
+
+template <class VALUE, class NODE, class ALLOCATOR>
+inline
+const VALUE& NodeHandle<VALUE, NODE, ALLOCATOR>::value() const
+{
+    BSLS_ASSERT_SAFE(d_node_p);
+
+    return d_node_p->value();
+}
+
+}  // close package namespace
+
+// FREE FUNCTIONS
+template <class VALUE, class NODE, class ALLOCATOR>
+inline
+void bslstl::swap(NodeHandle<VALUE, NODE, ALLOCATOR>& a,
+                  NodeHandle<VALUE, NODE, ALLOCATOR>& b)
+{
+    a.swap(b);
+}
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
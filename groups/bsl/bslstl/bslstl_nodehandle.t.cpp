@@ -0,0 +1,672 @@
+// bslstl_nodehandle.t.cpp                                            -*-C++-*-
+
+#include <bslstl_nodehandle.h>
+
+#include <bslstl_allocator.h>
+#include <bslstl_simplepool.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatormonitor.h>
+#include <bsls_bsltestutil.h>
+#include <bsls_objectbuffer.h>
+
+#include <bsltf_allocbitwisemoveabletesttype.h>
+#include <bsltf_alloctesttype.h>
+#include <bsltf_simpletesttype.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+
+using namespace BloombergLP;
+using namespace std;
+
+//=============================================================================
+//                             TEST PLAN
+//-----------------------------------------------------------------------------
+//                             Overview
+//                             --------
+// The component provides a move-only handle owning at most one node, and a
+// utility relocating an element between two storage locations.  We verify
+// that 'NodeHandleUtil::relocate' copies the footprint of bitwise moveable
+// types exactly when allowed (observed through the number of allocations made
+// by allocating test types), and copy-constructs the element otherwise.  We
+// then verify, using detached nodes allocated by a 'bslstl::SimplePool', that
+// the transfer operations of 'NodeHandle' move the node (without moving the
+// element) and the allocator, leave the source empty, destroy the element
+// exactly once, keep the node valid after the pool is destroyed, and return
+// the memory of the node to the allocator of the handle, with no memory
+// leaked.
+// ----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 2] void relocate(VALUE *, VALUE *, ALLOCATOR *, bool);
+//
+// CREATORS
+// [ 3] NodeHandle();
+// [ 3] NodeHandle(NodeHandle& original);
+// [ 3] NodeHandle(NodeHandle_Ref<VALUE, NODE, ALLOCATOR> ref);
+// [ 3] ~NodeHandle();
+//
+// MANIPULATORS
+// [ 3] NodeHandle& operator=(NodeHandle& rhs);
+// [ 3] NodeHandle& operator=(NodeHandle_Ref<VALUE, NODE, ALLOCATOR> ref);
+// [ 3] operator NodeHandle_Ref<VALUE, NODE, ALLOCATOR>();
+// [ 3] void adoptNode(NODE *, const ALLOCATOR&);
+// [ 3] NODE *releaseNode();
+// [ 3] void releaseValue();
+// [ 3] void reset();
+// [ 3] void swap(NodeHandle& other);
+// [ 3] VALUE& value();
+//
+// ACCESSORS
+// [ 3] bool empty() const;
+// [ 3] ALLOCATOR get_allocator() const;
+// [ 3] NODE *node() const;
+// [ 3] const VALUE& value() const;
+//
+// FREE FUNCTIONS
+// [ 3] void swap(NodeHandle& a, NodeHandle& b);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] USAGE EXAMPLE
+//-----------------------------------------------------------------------------
+
+//=============================================================================
+//                  STANDARD BDE ASSERT TEST MACRO
+//-----------------------------------------------------------------------------
+static int testStatus = 0;
+
+static void aSsErT(bool b, const char *s, int i) {
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+//=============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+namespace {
+
+typedef bsltf::AllocTestType                AllocType;
+typedef bsltf::AllocBitwiseMoveableTestType MoveableType;
+
+template <class VALUE>
+struct TestNode {
+    // This 'struct' provides a node holding an element of the (template
+    // parameter) type 'VALUE', as held by a 'NodeHandle'.
+
+    // DATA
+    bsls::ObjectBuffer<VALUE> d_value;  // element held by this node
+
+    // MANIPULATORS
+    VALUE& value() { return d_value.object(); }
+        // Return a reference providing modifiable access to the element held
+        // by this node.
+
+    // ACCESSORS
+    const VALUE& value() const { return d_value.object(); }
+        // Return a reference providing non-modifiable access to the element
+        // held by this node.
+};
+
+template <class TYPE>
+class TestDriver {
+    // This class template provides a namespace for testing 'NodeHandle' with
+    // the (template parameter) 'TYPE', which must be one of the allocating
+    // 'bsltf' test types.
+
+    // PRIVATE TYPES
+    typedef bsl::allocator<TYPE>                         Allocator;
+    typedef TestNode<TYPE>                               Node;
+    typedef bslstl::SimplePool<Node, Allocator>          Pool;
+    typedef bslstl::NodeHandle<TYPE, Node, Allocator>    Obj;
+
+    static Obj makeHandle(int value, Pool *pool);
+        // Return by value a handle owning a detached node, allocated by the
+        // specified 'pool', holding an element having the specified 'value'
+        // and using the allocator of 'pool'.
+
+  public:
+    // CLASS METHODS
+    static void testCase3();
+        // Test transfer operations.
+};
+
+template <class TYPE>
+typename TestDriver<TYPE>::Obj
+TestDriver<TYPE>::makeHandle(int value, Pool *pool)
+{
+    Allocator  allocator(pool->allocator());
+    Node      *node = pool->allocateDetached();
+    new (node->d_value.buffer()) TYPE(value, allocator.mechanism());
+
+    Obj result;
+    result.adoptNode(node, allocator);
+    return result;
+}
+
+template <class TYPE>
+void TestDriver<TYPE>::testCase3()
+{
+    bslma::TestAllocator oa("object", false);
+    bslma::TestAllocator za("other",  false);
+    bslma::TestAllocator pa("pool",   false);
+
+    // Each handle holding an element in 'oa' or 'za' uses two blocks of that
+    // allocator: the detached node, and the memory of the element.
+
+    {
+        Allocator  zAllocator(&za);
+        Pool       zPool(zAllocator);
+        Pool      *pool = new (pa) Pool(Allocator(&oa));
+
+        Obj mX;  const Obj& X = mX;
+        ASSERT(X.empty());
+        ASSERT(0 == X.node());
+
+        Obj mY(makeHandle(1, pool));  const Obj& Y = mY;
+        ASSERT(!Y.empty());
+        ASSERT(0 != Y.node());
+        ASSERTV(Y.value().data(), 1 == Y.value().data());
+        ASSERT(&Y.node()->value() == &Y.value());
+        ASSERT(Allocator(&oa) == Y.get_allocator());
+        ASSERTV(oa.numBlocksInUse(), 2 == oa.numBlocksInUse());
+
+        // The node outlives the pool that allocated it.
+
+        pa.deleteObject(pool);
+        ASSERTV(pa.numBlocksInUse(), 0 == pa.numBlocksInUse());
+        ASSERTV(oa.numBlocksInUse(), 2 == oa.numBlocksInUse());
+        ASSERTV(Y.value().data(), 1 == Y.value().data());
+
+        pool = new (pa) Pool(Allocator(&oa));
+
+        Node *node = Y.node();
+
+        Obj mZ(mY);  const Obj& Z = mZ;
+        ASSERT( Y.empty());
+        ASSERT(!Z.empty());
+        ASSERT(node == Z.node());
+        ASSERTV(Z.value().data(), 1 == Z.value().data());
+        ASSERT(Allocator(&oa) == Z.get_allocator());
+
+        mX = mZ;
+        ASSERT( Z.empty());
+        ASSERT(!X.empty());
+        ASSERT(node == X.node());
+        ASSERTV(X.value().data(), 1 == X.value().data());
+
+        mX = mX;
+        ASSERT(!X.empty());
+        ASSERT(node == X.node());
+        ASSERTV(X.value().data(), 1 == X.value().data());
+
+        // Assigning from a temporary destroys the previous element, and
+        // returns its node to the allocator.
+
+        mX = makeHandle(2, &zPool);
+        ASSERTV(X.value().data(), 2 == X.value().data());
+        ASSERT(Allocator(&za) == X.get_allocator());
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+        ASSERTV(za.numBlocksInUse(), 2 == za.numBlocksInUse());
+
+        mX.value().setData(3);
+        ASSERTV(X.value().data(), 3 == X.value().data());
+
+        mY = makeHandle(4, pool);
+        node = Y.node();
+        swap(mX, mY);
+        ASSERT(node == X.node());
+        ASSERTV(X.value().data(), 4 == X.value().data());
+        ASSERTV(Y.value().data(), 3 == Y.value().data());
+        ASSERT(Allocator(&oa) == X.get_allocator());
+        ASSERT(Allocator(&za) == Y.get_allocator());
+
+        mX.swap(mZ);
+        ASSERT( X.empty());
+        ASSERT(node == Z.node());
+        ASSERTV(Z.value().data(), 4 == Z.value().data());
+
+        mY.reset();
+        ASSERT(Y.empty());
+        ASSERT(0 == Y.node());
+        ASSERTV(za.numBlocksInUse(), 0 == za.numBlocksInUse());
+        mY.reset();
+        ASSERT(Y.empty());
+
+        // 'releaseNode' leaves the node to the caller, and 'adoptNode' takes
+        // it back.
+
+        ASSERT(node == mZ.releaseNode());
+        ASSERT(Z.empty());
+        ASSERTV(node->value().data(), 4 == node->value().data());
+        ASSERTV(oa.numBlocksInUse(), 2 == oa.numBlocksInUse());
+
+        mZ.adoptNode(node, Allocator(&oa));
+        ASSERT(node == Z.node());
+        ASSERTV(Z.value().data(), 4 == Z.value().data());
+        ASSERTV(oa.numBlocksInUse(), 2 == oa.numBlocksInUse());
+
+        // 'releaseValue' leaves the element to the caller, and returns the
+        // node to the allocator.
+
+        bsls::ObjectBuffer<TYPE> buffer;
+        Allocator                allocator(Z.get_allocator());
+        bslstl::NodeHandleUtil::relocate(&buffer.object(),
+                                         &mZ.value(),
+                                         &allocator,
+                                         true);
+        mZ.releaseValue();
+        ASSERT(Z.empty());
+        ASSERTV(buffer.object().data(), 4 == buffer.object().data());
+        ASSERTV(oa.numBlocksInUse(), 1 == oa.numBlocksInUse());
+
+        buffer.object().~TYPE();
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+
+        pa.deleteObject(pool);
+    }
+    ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+    ASSERTV(za.numBlocksInUse(), 0 == za.numBlocksInUse());
+    ASSERTV(pa.numBlocksInUse(), 0 == pa.numBlocksInUse());
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                              USAGE EXAMPLE
+//-----------------------------------------------------------------------------
+
+namespace {
+
+struct MyNode {
+    // This 'struct' is a node holding an 'int' element.
+
+    int d_value;
+
+    int& value() { return d_value; }
+};
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+    bool verbose = argc > 2;
+    bool veryVerbose = argc > 3;
+    bool veryVeryVerbose = argc > 4;
+    bool veryVeryVeryVerbose = argc > 5;
+
+    (void)veryVerbose;
+    (void)veryVeryVerbose;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    bslma::TestAllocator da("default", veryVeryVeryVerbose);
+    bslma::DefaultAllocatorGuard dag(&da);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 4: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   The usage example provided in the component header file must
+        //   compile, link, and run on all platforms as shown.
+        //
+        // Plan:
+        //   Incorporate usage example from header into driver, remove leading
+        //   comment characters, and replace 'assert' with 'ASSERT'.
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+///Usage
+///-----
+// This section illustrates intended usage of this component.
+//
+///Example 1: Holding a Detached Node
+/// - - - - - - - - - - - - - - - - -
+// A 'NodeHandle' is normally obtained from the 'extract' method of a
+// container, and handed back to the 'insert' method of a container.  In this
+// example we play the role of the container ourselves.
+//
+// First, we define a simple node type holding an 'int' (see 'MyNode' above),
+// and a pool of such nodes:
+//..
+    typedef bsl::allocator<int>                           Allocator;
+    typedef bslstl::SimplePool<MyNode, Allocator>         Pool;
+    typedef bslstl::NodeHandle<int, MyNode, Allocator>    Handle;
+
+    bslma::TestAllocator ta;
+    Allocator            allocator(&ta);
+
+    Pool *pool = new (ta) Pool(allocator);
+//..
+// Next, we create an element in a detached node allocated by the pool, as a
+// container does when it extracts an element, and pass the node to an empty
+// node handle:
+//..
+    MyNode *node = pool->allocateDetached();
+    node->d_value = 42;
+
+    Handle handle;
+    ASSERT(handle.empty());
+
+    handle.adoptNode(node, allocator);
+    ASSERT(!handle.empty());
+    ASSERT(42 == handle.value());
+//..
+// Then, we destroy the pool, as happens when the container is destroyed, and
+// observe that the node is still valid, as it is not owned by the pool:
+//..
+    ta.deleteObject(pool);
+    ASSERT(1 == ta.numBlocksInUse());
+
+    ASSERT(node == handle.node());
+    ASSERT(42   == handle.value());
+//..
+// Next, we transfer the node to another handle, leaving 'handle' empty:
+//..
+    Handle other(handle);
+    ASSERT( handle.empty());
+    ASSERT(!other.empty());
+    ASSERT(node == other.node());
+//..
+// Finally, we note that the element is destroyed, and the memory of the node
+// returned to the allocator, when 'other' is destroyed, or 'reset':
+//..
+    other.reset();
+    ASSERT(other.empty());
+    ASSERT(0 == ta.numBlocksInUse());
+//..
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TRANSFER OPERATIONS
+        //
+        // Concerns:
+        //: 1 Constructing or assigning from a handle, or from a handle
+        //:   returned by value, transfers the node and the allocator, and
+        //:   leaves the source empty, without moving the element.
+        //:
+        //: 2 Assignment and 'reset' destroy the element previously held, and
+        //:   self-assignment has no effect.
+        //:
+        //: 3 'swap' (member and free) exchanges the nodes and allocators.
+        //:
+        //: 4 'releaseNode' empties the handle, leaving the node to the
+        //:   caller, and 'adoptNode' takes over a node and an allocator.
+        //:
+        //: 5 'releaseValue' empties the handle without destroying the
+        //:   element, and returns the node to the allocator.
+        //:
+        //: 6 The node held by a handle remains valid after the pool that
+        //:   allocated it is destroyed.
+        //:
+        //: 7 No memory is leaked, and every element is destroyed once.
+        //
+        // Plan:
+        //: 1 For a bitwise moveable and a non-bitwise moveable allocating
+        //:   test type, exercise each operation on handles owning detached
+        //:   nodes allocated by a 'bslstl::SimplePool', checking the held
+        //:   nodes and values, the allocators, and the number of blocks in use
+        //:   by the test allocators.  (C-1..5, 7)
+        //:
+        //: 2 Destroy the pool that allocated a node while a handle owns the
+        //:   node, and verify that the node is still in use, and that the
+        //:   element is still accessible.  (C-6)
+        //
+        // Testing:
+        //   NodeHandle();
+        //   NodeHandle(NodeHandle& original);
+        //   NodeHandle(NodeHandle_Ref<VALUE, NODE, ALLOCATOR> ref);
+        //   ~NodeHandle();
+        //   NodeHandle& operator=(NodeHandle& rhs);
+        //   NodeHandle& operator=(NodeHandle_Ref<VALUE, NODE, ALLOCATOR> ref);
+        //   operator NodeHandle_Ref<VALUE, NODE, ALLOCATOR>();
+        //   void adoptNode(NODE *, const ALLOCATOR&);
+        //   NODE *releaseNode();
+        //   void releaseValue();
+        //   void reset();
+        //   void swap(NodeHandle& other);
+        //   VALUE& value();
+        //   bool empty() const;
+        //   ALLOCATOR get_allocator() const;
+        //   NODE *node() const;
+        //   const VALUE& value() const;
+        //   void swap(NodeHandle& a, NodeHandle& b);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTRANSFER OPERATIONS"
+                            "\n===================\n");
+
+        TestDriver<AllocType>::testCase3();
+        TestDriver<MoveableType>::testCase3();
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // 'NodeHandleUtil::relocate'
+        //
+        // Concerns:
+        //: 1 An element of a bitwise moveable type is relocated without
+        //:   allocating memory if 'isSameAllocator' is 'true'.
+        //:
+        //: 2 An element of a type that uses a 'bslma::Allocator' is
+        //:   copy-constructed using the supplied allocator if the type is not
+        //:   bitwise moveable, or if 'isSameAllocator' is 'false', and the
+        //:   original is destroyed.
+        //:
+        //: 3 An element of a bitwise moveable type that does not use a
+        //:   'bslma::Allocator' is relocated whatever 'isSameAllocator'.
+        //
+        // Plan:
+        //: 1 Relocate objects of the allocating 'bsltf' test types between
+        //:   two buffers, and verify the value of the relocated object and the
+        //:   memory in use by each allocator.  (C-1..2)
+        //:
+        //: 2 Relocate a 'bsltf::SimpleTestType' with 'isSameAllocator' set to
+        //:   'false'.  (C-3)
+        //
+        // Testing:
+        //   void relocate(VALUE *, VALUE *, ALLOCATOR *, bool);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\n'NodeHandleUtil::relocate'"
+                            "\n==========================\n");
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        bslma::TestAllocator za("other",  veryVeryVeryVerbose);
+
+        if (verbose) printf("Bitwise moveable type, same allocator.\n");
+        {
+            bsl::allocator<MoveableType> allocator(&oa);
+
+            bsls::ObjectBuffer<MoveableType> from;
+            bsls::ObjectBuffer<MoveableType> to;
+            new (from.buffer()) MoveableType(7, &oa);
+
+            bslma::TestAllocatorMonitor oam(&oa);
+            bslstl::NodeHandleUtil::relocate(&to.object(),
+                                             &from.object(),
+                                             &allocator,
+                                             true);
+            ASSERT(oam.isTotalSame());
+            ASSERT(oam.isInUseSame());
+            ASSERTV(to.object().data(), 7 == to.object().data());
+
+            to.object().~MoveableType();
+            ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+        }
+
+        if (verbose) printf("Bitwise moveable type, other allocator.\n");
+        {
+            bsl::allocator<MoveableType> allocator(&za);
+
+            bsls::ObjectBuffer<MoveableType> from;
+            bsls::ObjectBuffer<MoveableType> to;
+            new (from.buffer()) MoveableType(8, &oa);
+
+            bslstl::NodeHandleUtil::relocate(&to.object(),
+                                             &from.object(),
+                                             &allocator,
+                                             false);
+            ASSERTV(to.object().data(), 8 == to.object().data());
+            ASSERT(&za == to.object().allocator());
+            ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+            ASSERTV(za.numBlocksInUse(), 1 == za.numBlocksInUse());
+
+            to.object().~MoveableType();
+            ASSERTV(za.numBlocksInUse(), 0 == za.numBlocksInUse());
+        }
+
+        if (verbose) printf("Non-bitwise moveable type.\n");
+        {
+            bsl::allocator<AllocType> allocator(&oa);
+
+            bsls::ObjectBuffer<AllocType> from;
+            bsls::ObjectBuffer<AllocType> to;
+            new (from.buffer()) AllocType(9, &oa);
+
+            bslma::TestAllocatorMonitor oam(&oa);
+            bslstl::NodeHandleUtil::relocate(&to.object(),
+                                             &from.object(),
+                                             &allocator,
+                                             true);
+            ASSERT(oam.isTotalUp());
+            ASSERT(oam.isInUseSame());
+            ASSERTV(to.object().data(), 9 == to.object().data());
+
+            to.object().~AllocType();
+            ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+        }
+
+        if (verbose) printf("Type not using an allocator.\n");
+        {
+            bsl::allocator<bsltf::SimpleTestType> allocator(&oa);
+
+            bsls::ObjectBuffer<bsltf::SimpleTestType> from;
+            bsls::ObjectBuffer<bsltf::SimpleTestType> to;
+            new (from.buffer()) bsltf::SimpleTestType(10);
+
+            bslma::TestAllocatorMonitor oam(&oa);
+            bslstl::NodeHandleUtil::relocate(&to.object(),
+                                             &from.object(),
+                                             &allocator,
+                                             false);
+            ASSERTV(to.object().data(), 10 == to.object().data());
+            ASSERT(oam.isTotalSame());
+        }
+        ASSERTV(da.numBlocksTotal(), 0 == da.numBlocksTotal());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Pass a detached node holding an element to a handle, transfer it
+        //:   to another handle, and destroy it.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        typedef bsl::allocator<AllocType>                       Allocator;
+        typedef TestNode<AllocType>                             Node;
+        typedef bslstl::SimplePool<Node, Allocator>             Pool;
+        typedef bslstl::NodeHandle<AllocType, Node, Allocator>  Obj;
+        {
+            Allocator  allocator(&oa);
+            Pool       pool(allocator);
+            Node      *node = pool.allocateDetached();
+            new (node->d_value.buffer()) AllocType(5, &oa);
+
+            Obj mX;  const Obj& X = mX;
+            ASSERT(X.empty());
+
+            mX.adoptNode(node, allocator);
+            ASSERT(!X.empty());
+            ASSERTV(X.value().data(), 5 == X.value().data());
+
+            Obj mY(mX);  const Obj& Y = mY;
+            ASSERT( X.empty());
+            ASSERTV(Y.value().data(), 5 == Y.value().data());
+            ASSERT(node == Y.node());
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -85,6 +85,24 @@ BSLS_IDENT("$Id: $")
 // allocator's address to the constructors of contained objects of the
 // (template parameter) type 'KEY' with the 'bslma::UsesBslmaAllocator' trait.
 //
+///Order Statistics
+///----------------
+// If the (template parameter) type 'COMPARATOR' is associated with the
+// 'bslstl::MaintainsSubtreeSizes' trait (see 'bslstl_maintainssubtreesizes'),
+// each node of a 'set' additionally records the number of elements in the
+// subtree rooted at that node, and the 'set' provides two additional methods:
+// 'nth', which returns an iterator to the element at a given position in the
+// ordered sequence of elements, and 'rank', which returns the number of
+// elements ordered before a given key, each in logarithmic time.  Inserting
+// and erasing elements keeps the subtree sizes accurate at the cost of a walk
+// from the affected node to the root of the tree, and each node is larger by
+// the size of an 'int'.  Operations that restructure the whole tree at once
+// ('mergeUnion', 'intersect', 'subtract', copy construction, and construction
+// from a sorted range) recompute the subtree sizes afterwards, in time linear
+// in the size of the resulting set.  A 'set' whose comparator is not
+// associated with the trait is unaffected, and does not provide 'nth' or
+// 'rank'.
+//
 ///Operations
 ///----------
 // This section describes the run-time complexity of operations on instances
@@ -99,6 +117,7 @@ BSLS_IDENT("$Id: $")
 //  'al             - an STL-style memory allocator
 //  'i1', 'i2'      - two iterators defining a sequence of 'value_type' objects
 //  'k'             - an object of type 'K'
+//  'i'             - an index in the range [0, n]
 //  'p1', 'p2'      - two iterators belonging to 'a'
 //  distance(i1,i2) - the number of elements in the range [i1, i2)
 //
@@ -186,6 +205,8 @@ BSLS_IDENT("$Id: $")
 //  +----------------------------------------------------+--------------------+
 //  | a.equal_range(k)                                   | O[log(n)]          |
 //  +----------------------------------------------------+--------------------+
+//  | a.nth(i), a.rank(k)  (see {Order Statistics})      | O[log(n)]          |
+//  +----------------------------------------------------+--------------------+
 //..
 ///Usage
 ///-----
@@ -469,6 +490,18 @@ BSL_OVERRIDES_STD mode"
 #include <bslstl_allocator.h>
 #endif
 
+#ifndef INCLUDED_BSLSTL_ITERATORUTIL
+#include <bslstl_iteratorutil.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_MAINTAINSSUBTREESIZES
+#include <bslstl_maintainssubtreesizes.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_NODEHANDLE
+#include <bslstl_nodehandle.h>
+#endif
+
 #ifndef INCLUDED_BSLSTL_PAIR
 #include <bslstl_pair.h>
 #endif
@@ -501,6 +534,10 @@ BSL_OVERRIDES_STD mode"
 #include <bslalg_rbtreeanchor.h>
 #endif
 
+#ifndef INCLUDED_BSLALG_RBTREECOUNTEDNODE
+#include <bslalg_rbtreecountednode.h>
+#endif
+
 #ifndef INCLUDED_BSLALG_RBTREENODE
 #include <bslalg_rbtreenode.h>
 #endif
@@ -517,12 +554,131 @@ BSL_OVERRIDES_STD mode"
 #include <bslalg_typetraithasstliterators.h>
 #endif
 
+#ifndef INCLUDED_BSLMF_ASSERT
+#include <bslmf_assert.h>
+#endif
+
+#ifndef INCLUDED_BSLS_UTIL
+#include <bsls_util.h>
+#endif
+
 #ifndef INCLUDED_FUNCTIONAL
 #include <functional>
 #define INCLUDED_FUNCTIONAL
 #endif
 
 namespace bsl {
+
+                            // ===================
+                            // struct Set_TreeUtil
+                            // ===================
+
+template <bool MAINTAINS_SUBTREE_SIZES>
+struct Set_TreeUtil {
+    // This component-private utility 'struct' provides a namespace for the
+    // operations that modify the tree of a 'set' and that depend on whether
+    // its nodes record the sizes of their subtrees (see
+    // 'bslstl_maintainssubtreesizes').  This primary template handles nodes
+    // derived from 'bslalg::RbTreeNode', which do not.
+
+    // TYPES
+    typedef BloombergLP::bslalg::RbTreeNode NodeBase;
+        // This 'typedef' is an alias for the base class of the nodes of the
+        // tree.
+
+    // CLASS METHODS
+    static void insertAt(BloombergLP::bslalg::RbTreeAnchor *tree,
+                         BloombergLP::bslalg::RbTreeNode   *parentNode,
+                         bool                               leftChildFlag,
+                         BloombergLP::bslalg::RbTreeNode   *newNode);
+        // Insert the specified 'newNode' into the specified 'tree' as the left
+        // or right child of the specified 'parentNode', as indicated by the
+        // specified 'leftChildFlag' (see 'bslalg::RbTreeUtil::insertAt').
+
+    static void remove(BloombergLP::bslalg::RbTreeAnchor *tree,
+                       BloombergLP::bslalg::RbTreeNode   *node);
+        // Remove the specified 'node' from the specified 'tree' (see
+        // 'bslalg::RbTreeUtil::remove').
+
+    static void updateSubtreeSizes(BloombergLP::bslalg::RbTreeAnchor *tree);
+        // Do nothing: the nodes of the specified 'tree' do not record the
+        // sizes of their subtrees.
+};
+
+template <>
+struct Set_TreeUtil<true> {
+    // This specialization handles nodes derived from
+    // 'bslalg::RbTreeCountedNode', keeping the subtree size recorded by each
+    // node accurate.
+
+    // TYPES
+    typedef BloombergLP::bslalg::RbTreeCountedNode NodeBase;
+        // This 'typedef' is an alias for the base class of the nodes of the
+        // tree.
+
+    // CLASS METHODS
+    static void insertAt(BloombergLP::bslalg::RbTreeAnchor *tree,
+                         BloombergLP::bslalg::RbTreeNode   *parentNode,
+                         bool                               leftChildFlag,
+                         BloombergLP::bslalg::RbTreeNode   *newNode);
+        // Insert the specified 'newNode' into the specified 'tree' as the left
+        // or right child of the specified 'parentNode', as indicated by the
+        // specified 'leftChildFlag' (see
+        // 'bslalg::RbTreeUtil::insertAtCounted').
+
+    static void remove(BloombergLP::bslalg::RbTreeAnchor *tree,
+                       BloombergLP::bslalg::RbTreeNode   *node);
+        // Remove the specified 'node' from the specified 'tree' (see
+        // 'bslalg::RbTreeUtil::removeCounted').
+
+    static void updateSubtreeSizes(BloombergLP::bslalg::RbTreeAnchor *tree);
+        // Set the subtree size of each node of the specified 'tree' to the
+        // number of nodes in its subtree (see
+        // 'bslalg::RbTreeUtil::updateSubtreeSizes').
+};
+
+                        // ===========================
+                        // class Set_SubtreeSizesGuard
+                        // ===========================
+
+template <bool MAINTAINS_SUBTREE_SIZES>
+class Set_SubtreeSizesGuard {
+    // This component-private guard class template sets, on destruction, the
+    // subtree size of each node of a tree whose structure has been changed by
+    // operations that do not maintain them (e.g.,
+    // 'bslalg::RbTreeUtil::mergeUnion'), if 'MAINTAINS_SUBTREE_SIZES' is
+    // 'true'.  This primary template has no effect.
+
+  public:
+    // CREATORS
+    explicit Set_SubtreeSizesGuard(BloombergLP::bslalg::RbTreeAnchor *tree);
+        // Create a guard object for the specified 'tree' that has no effect.
+};
+
+template <>
+class Set_SubtreeSizesGuard<true> {
+    // This specialization sets the subtree size of each node of the guarded
+    // tree on destruction.
+
+    // DATA
+    BloombergLP::bslalg::RbTreeAnchor *d_tree_p;  // guarded tree
+
+  private:
+    // NOT IMPLEMENTED
+    Set_SubtreeSizesGuard(const Set_SubtreeSizesGuard&);
+    Set_SubtreeSizesGuard& operator=(const Set_SubtreeSizesGuard&);
+
+  public:
+    // CREATORS
+    explicit Set_SubtreeSizesGuard(BloombergLP::bslalg::RbTreeAnchor *tree);
+        // Create a guard object for the specified 'tree'.
+
+    ~Set_SubtreeSizesGuard();
+        // Destroy this object, setting the subtree size of each node of the
+        // guarded tree to the number of nodes in its subtree.  The behavior is
+        // undefined unless the guarded tree is well-formed.
+};
+
                              // =========
                              // class set
                              // =========
@@ -548,15 +704,33 @@ class set {
         // This typedef is an alias for the type of key objects maintained by
         // this set.
 
-    typedef BloombergLP::bslstl::SetComparator<KEY, COMPARATOR> Comparator;
-        // This typedef is an alias for the comparator used internally by this
-        // set.
-
-    typedef BloombergLP::bslstl::TreeNode<KEY>                  Node;
+    typedef Set_TreeUtil<
+                BloombergLP::bslstl::MaintainsSubtreeSizes<COMPARATOR>::value>
+                                                                      TreeUtil;
+        // This typedef is an alias for the utility that inserts nodes into,
+        // and removes nodes from, the tree used to implement this set,
+        // maintaining the subtree sizes if 'COMPARATOR' is associated with the
+        // 'bslstl::MaintainsSubtreeSizes' trait.
+
+    typedef Set_SubtreeSizesGuard<
+                BloombergLP::bslstl::MaintainsSubtreeSizes<COMPARATOR>::value>
+                                                             SubtreeSizesGuard;
+        // This typedef is an alias for the guard that restores the subtree
+        // sizes of the tree used to implement this set, if they are
+        // maintained, after it is restructured.
+
+    typedef BloombergLP::bslstl::TreeNode<KEY, typename TreeUtil::NodeBase>
+                                                                          Node;
         // This typedef is an alias for the type of nodes held by the tree (of
         // nodes) used to implement this set.
 
-    typedef BloombergLP::bslstl::TreeNodePool<KEY, ALLOCATOR>   NodeFactory;
+    typedef BloombergLP::bslstl::SetComparator<KEY, COMPARATOR, Node>
+                                                                    Comparator;
+        // This typedef is an alias for the comparator used internally by this
+        // set.
+
+    typedef BloombergLP::bslstl::TreeNodePool<KEY, ALLOCATOR, Node>
+                                                                   NodeFactory;
         // This typedef is an alias for the factory type used to create and
         // destroy 'Node' objects.
 
@@ -613,6 +787,9 @@ class set {
     typedef bsl::reverse_iterator<iterator>            reverse_iterator;
     typedef bsl::reverse_iterator<const_iterator>      const_reverse_iterator;
 
+    typedef BloombergLP::bslstl::NodeHandle<value_type, Node, ALLOCATOR>
+                                                                     node_type;
+
   private:
     // PRIVATE MANIPULATORS
     NodeFactory& nodeFactory();
@@ -629,6 +806,19 @@ class set {
         // no-throw exception-safety guarantee.  The behavior is undefined
         // unless this object was created with the same allocator as 'other'.
 
+    void takeNodes(BloombergLP::bslalg::RbTreeAnchor *result, set& other);
+        // Move the 'value_type' objects of the specified 'other' set, in
+        // order, into nodes of this set forming the specified 'result' tree,
+        // leaving 'other' empty.  If 'other' uses the same allocator as this
+        // set, the node pool of 'other' is taken over by this set (see
+        // 'bslstl::TreeNodePool::adopt'), and no memory is allocated;
+        // otherwise each object is relocated into a new node.  If an
+        // exception is thrown, 'result' is a valid tree holding the objects
+        // already moved, and the other objects remain in 'other'.  The
+        // behavior is undefined unless 'result' is empty and 'other' is not
+        // this set.  Note that the subtree sizes of the nodes of 'result', if
+        // maintained by this set, are not accurate.
+
     // PRIVATE ACCESSORS
     const NodeFactory& nodeFactory() const;
         // Return a reference providing non-modifiable access to the
@@ -795,7 +985,100 @@ class set {
         // defined in the C++11 standard [24.2.3] providing access to values of
         // a type convertible to 'value_type'.  This method requires that the
         // (template parameter) type 'KEY' be "copy-constructible" (see
-        // {Requirements on 'KEY'}).
+        // {Requirements on 'KEY'}).  If this set is empty, the longest prefix
+        // of the range whose keys are in strictly increasing order is inserted
+        // in O[M] time, where M is the length of that prefix, by linking its
+        // nodes into a balanced tree without rebalancing, and the remaining
+        // values, if any, are inserted one at a time.
+
+    pair<iterator, bool> insert(node_type& node);
+        // Insert the 'value_type' object held by the specified 'node' into
+        // this set, and make 'node' empty, if the key of that object does not
+        // already exist in this set; otherwise, leave 'node' unchanged.
+        // Return a 'pair' whose 'first' member is an iterator referring to the
+        // (possibly newly inserted) 'value_type' object in this set whose key
+        // is the same as that of the object held by 'node', and whose 'second'
+        // member is 'true' if the object was inserted, and 'false' otherwise.
+        // If 'node' is empty, return '(end(), false)' with no other effect.
+        // Note that the node held by 'node' is linked into this set if
+        // 'node.get_allocator() == get_allocator()' and this set has no free
+        // node, and that the object is otherwise relocated into a node of this
+        // set (see {'bslstl_nodehandle'|Node Ownership}).
+
+    iterator insert(const_iterator hint, node_type& node);
+        // Insert the 'value_type' object held by the specified 'node' into
+        // this set (in amortized constant time if the specified 'hint' is a
+        // valid immediate successor to the key of that object), and make
+        // 'node' empty, if the key of that object does not already exist in
+        // this set; otherwise, leave 'node' unchanged.  Return an iterator
+        // referring to the (possibly newly inserted) 'value_type' object in
+        // this set whose key is the same as that of the object held by 'node',
+        // or 'end()' if 'node' is empty.  The behavior is undefined unless
+        // 'hint' is a valid iterator into this set.
+
+    node_type extract(const_iterator position);
+        // Remove from this set the 'value_type' object at the specified
+        // 'position', and return a node handle holding that object (see
+        // {'bslstl_nodehandle'}).  The behavior is undefined unless 'position'
+        // refers to a 'value_type' object in this set.  If an exception is
+        // thrown, this set is unchanged.  Note that the object is relocated
+        // into a detached node owned by the node handle (see
+        // {'bslstl_nodehandle'|Node Ownership}), without being copied if
+        // 'value_type' is bitwise moveable, and that the node holding it in
+        // this set is kept for reuse.
+
+    node_type extract(const key_type& key);
+        // Remove from this set the 'value_type' object having the specified
+        // 'key', if it exists, and return a node handle holding that object;
+        // otherwise return an empty node handle with no other effect.
+
+    void merge(set& source);
+        // Relocate into this set each 'value_type' object of the specified
+        // 'source' set whose key does not already exist in this set; the
+        // objects whose keys already exist remain in 'source'.  This method
+        // has no effect if 'source' is this set.  If an exception is thrown,
+        // each object is held by exactly one of the two containers.  Note that
+        // no memory is allocated for the relocated objects (unless the node
+        // pool of this set must grow), and none is deallocated, if
+        // 'value_type' is bitwise moveable and 'source.get_allocator() ==
+        // get_allocator()'.
+
+    void mergeUnion(set& other);
+        // Move into this set each 'value_type' object of the specified 'other'
+        // set whose key does not already exist in this set, destroy the
+        // remaining objects of 'other', and leave 'other' empty.  This method
+        // has no effect if 'other' is this set.  The nodes of 'other' are
+        // taken over, without allocating memory or moving any object, if
+        // 'other.get_allocator() == get_allocator()'; otherwise each object of
+        // 'other' is relocated into this set.  The number of key comparisons
+        // is 'O[M * log(N / M + 1)]', where 'M' and 'N' are the sizes of the
+        // smaller and of the larger set, respectively, and is 'O[1]' if the
+        // keys of one set all precede those of the other (see
+        // {'bslalg_rbtreeutil'|Set Operations}).  If an exception is thrown,
+        // this set holds all of its original objects, and the objects of
+        // 'other' are either held by one of the two sets or destroyed.
+
+    void intersect(const set& other);
+        // Remove from this set each 'value_type' object whose key does not
+        // exist in the specified 'other' set.  This method has no effect if
+        // 'other' is this set.  The number of key comparisons is
+        // 'O[M * log(N / M + 1)]', where 'M' and 'N' are the sizes of the
+        // smaller and of the larger set, respectively.  If an exception is
+        // thrown, this set holds a subset of its original objects that
+        // includes each object whose key exists in 'other'.  The behavior is
+        // undefined unless the comparator of 'other' orders keys in the same
+        // way as the comparator of this set.
+
+    void subtract(const set& other);
+        // Remove from this set each 'value_type' object whose key exists in
+        // the specified 'other' set.  If 'other' is this set, remove all the
+        // objects of this set.  The number of key comparisons is
+        // 'O[M * log(N / M + 1)]', where 'M' and 'N' are the sizes of the
+        // smaller and of the larger set, respectively.  If an exception is
+        // thrown, this set holds a subset of its original objects that
+        // includes each object whose key does not exist in 'other'.  The
+        // behavior is undefined unless the comparator of 'other' orders keys
+        // in the same way as the comparator of this set.
 
     iterator erase(const_iterator position);
         // Remove from this set the 'value_type' object at the specified
@@ -868,6 +1151,16 @@ class set {
         // same value.  Note that since a set maintains unique keys, the range
         // will contain at most one element.
 
+    iterator nth(size_type index);
+        // Return an iterator providing modifiable access to the 'value_type'
+        // object at the specified 'index' position in the ordered sequence of
+        // 'value_type' objects maintained by this set (i.e., the object
+        // preceded by 'index' objects), or the past-the-end iterator if
+        // 'index == size()'.  This operation takes O[log(n)] time.  The
+        // behavior is undefined unless 'index <= size()'.  Note that this
+        // method is available only if 'COMPARATOR' is associated with the
+        // 'bslstl::MaintainsSubtreeSizes' trait (see {Order Statistics}).
+
     // ACCESSORS
     allocator_type get_allocator() const;
         // Return (a copy of) the allocator used for memory allocation by this
@@ -980,6 +1273,24 @@ class set {
         // same value.  Note that since a set maintains unique keys, the range
         // will contain at most one element.
 
+    const_iterator nth(size_type index) const;
+        // Return an iterator providing non-modifiable access to the
+        // 'value_type' object at the specified 'index' position in the
+        // ordered sequence of 'value_type' objects maintained by this set
+        // (i.e., the object preceded by 'index' objects), or the past-the-end
+        // iterator if 'index == size()'.  This operation takes O[log(n)] time.
+        // The behavior is undefined unless 'index <= size()'.  Note that this
+        // method is available only if 'COMPARATOR' is associated with the
+        // 'bslstl::MaintainsSubtreeSizes' trait (see {Order Statistics}).
+
+    size_type rank(const key_type& key) const;
+        // Return the number of 'value_type' objects in this set ordered before
+        // the specified 'key' (i.e., the position of 'lower_bound(key)' in the
+        // ordered sequence of 'value_type' objects maintained by this set).
+        // This operation takes O[log(n)] time.  Note that this method is
+        // available only if 'COMPARATOR' is associated with the
+        // 'bslstl::MaintainsSubtreeSizes' trait (see {Order Statistics}).
+
     // NOT IMPLEMENTED
         // The following methods are defined by the C++11 standard, but they
         // are not implemented as they require some level of C++11 compiler
@@ -1094,6 +1405,94 @@ void swap(set<KEY, COMPARATOR, ALLOCATOR>& a,
 //                  TEMPLATE AND INLINE FUNCTION DEFINITIONS
 // ============================================================================
 
+                            // -------------------
+                            // struct Set_TreeUtil
+                            // -------------------
+
+// CLASS METHODS
+template <bool MAINTAINS_SUBTREE_SIZES>
+inline
+void Set_TreeUtil<MAINTAINS_SUBTREE_SIZES>::insertAt(
+                             BloombergLP::bslalg::RbTreeAnchor *tree,
+                             BloombergLP::bslalg::RbTreeNode   *parentNode,
+                             bool                               leftChildFlag,
+                             BloombergLP::bslalg::RbTreeNode   *newNode)
+{
+    BloombergLP::bslalg::RbTreeUtil::insertAt(tree,
+                                              parentNode,
+                                              leftChildFlag,
+                                              newNode);
+}
+
+template <bool MAINTAINS_SUBTREE_SIZES>
+inline
+void Set_TreeUtil<MAINTAINS_SUBTREE_SIZES>::remove(
+                                 BloombergLP::bslalg::RbTreeAnchor *tree,
+                                 BloombergLP::bslalg::RbTreeNode   *node)
+{
+    BloombergLP::bslalg::RbTreeUtil::remove(tree, node);
+}
+
+template <bool MAINTAINS_SUBTREE_SIZES>
+inline
+void Set_TreeUtil<MAINTAINS_SUBTREE_SIZES>::updateSubtreeSizes(
+                                           BloombergLP::bslalg::RbTreeAnchor *)
+{
+}
+
+inline
+void Set_TreeUtil<true>::insertAt(
+                             BloombergLP::bslalg::RbTreeAnchor *tree,
+                             BloombergLP::bslalg::RbTreeNode   *parentNode,
+                             bool                               leftChildFlag,
+                             BloombergLP::bslalg::RbTreeNode   *newNode)
+{
+    BloombergLP::bslalg::RbTreeUtil::insertAtCounted(tree,
+                                                     parentNode,
+                                                     leftChildFlag,
+                                                     newNode);
+}
+
+inline
+void Set_TreeUtil<true>::remove(BloombergLP::bslalg::RbTreeAnchor *tree,
+                              BloombergLP::bslalg::RbTreeNode   *node)
+{
+    BloombergLP::bslalg::RbTreeUtil::removeCounted(tree, node);
+}
+
+inline
+void Set_TreeUtil<true>::updateSubtreeSizes(
+                                       BloombergLP::bslalg::RbTreeAnchor *tree)
+{
+    BloombergLP::bslalg::RbTreeUtil::updateSubtreeSizes(tree);
+}
+
+                        // ---------------------------
+                        // class Set_SubtreeSizesGuard
+                        // ---------------------------
+
+// CREATORS
+template <bool MAINTAINS_SUBTREE_SIZES>
+inline
+Set_SubtreeSizesGuard<MAINTAINS_SUBTREE_SIZES>::Set_SubtreeSizesGuard(
+                                           BloombergLP::bslalg::RbTreeAnchor *)
+{
+}
+
+inline
+Set_SubtreeSizesGuard<true>::Set_SubtreeSizesGuard(
+                                       BloombergLP::bslalg::RbTreeAnchor *tree)
+: d_tree_p(tree)
+{
+    BSLS_ASSERT_SAFE(tree);
+}
+
+inline
+Set_SubtreeSizesGuard<true>::~Set_SubtreeSizesGuard()
+{
+    BloombergLP::bslalg::RbTreeUtil::updateSubtreeSizes(d_tree_p);
+}
+
                              // -----------------
                              // class DataWrapper
                              // -----------------
@@ -1145,6 +1544,46 @@ void set<KEY, COMPARATOR, ALLOCATOR>::quickSwap(set& other)
     }
 }
 
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+void set<KEY, COMPARATOR, ALLOCATOR>::takeNodes(
+                                     BloombergLP::bslalg::RbTreeAnchor *result,
+                                     set&                               other)
+{
+    BSLS_ASSERT_SAFE(result);
+    BSLS_ASSERT_SAFE(0 == result->numNodes());
+    BSLS_ASSERT_SAFE(this != &other);
+
+    if (other.get_allocator() == this->get_allocator()) {
+        nodeFactory().adopt(other.nodeFactory());
+        BloombergLP::bslalg::RbTreeUtil::swap(result, &other.d_tree);
+        return;                                                       // RETURN
+    }
+
+    if (0 < other.size()) {
+        nodeFactory().reserveNodes(other.size());
+    }
+
+    // Relocate the objects in order, appending their new nodes to a chain
+    // that 'guard' balances, even if an exception is thrown.
+
+    BloombergLP::bslalg::RbTreeUtilChainGuard guard(result);
+
+    BloombergLP::bslalg::RbTreeNode *lastNode = result->sentinel();
+    while (0 < other.d_tree.numNodes()) {
+        BloombergLP::bslalg::RbTreeNode *node = other.d_tree.firstNode();
+        BloombergLP::bslalg::RbTreeNode *newNode =
+            nodeFactory().createNodeByRelocation(
+                       BSLS_UTIL_ADDRESSOF(static_cast<Node *>(node)->value()),
+                       false);
+        TreeUtil::remove(&other.d_tree, node);
+        other.nodeFactory().deallocateNode(node);
+        BloombergLP::bslalg::RbTreeUtil::appendToChain(result,
+                                                       lastNode,
+                                                       newNode);
+        lastNode = newNode;
+    }
+}
+
 // PRIVATE ACCESSORS
 template <class KEY, class COMPARATOR, class ALLOCATOR>
 inline
@@ -1177,36 +1616,7 @@ set<KEY, COMPARATOR, ALLOCATOR>::set(INPUT_ITERATOR    first,
         BloombergLP::bslalg::RbTreeUtilTreeProctor<NodeFactory> proctor(
                                                                &d_tree,
                                                                &nodeFactory());
-
-        // The following loop guarantees amortized linear time to insert an
-        // ordered sequence of values (as required by the standard).   If the
-        // values are in sorted order, we are guaranteed the next node can be
-        // inserted as the right child of the previous node, and can call
-        // 'insertAt' without 'findUniqueInsertLocation'.
-
-        insert(*first);
-        BloombergLP::bslalg::RbTreeNode *prevNode = d_tree.rootNode();
-        while (++first != last) {
-            // The values are not in order, so insert them normally.
-
-            const value_type& value = *first;
-            if (this->comparator()(value, *prevNode)) {
-                insert(value);
-                insert(++first, last);
-                break;
-            }
-
-            if (this->comparator()(*prevNode, value)) {
-                BloombergLP::bslalg::RbTreeNode *node =
-                                               nodeFactory().createNode(value);
-                BloombergLP::bslalg::RbTreeUtil::insertAt(&d_tree,
-                                                          prevNode,
-                                                          false,
-                                                          node);
-                prevNode = node;
-            }
-        }
-
+        insert(first, last);
         proctor.release();
     }
 }
@@ -1225,6 +1635,7 @@ set<KEY, COMPARATOR, ALLOCATOR>::set(const set& original)
         BloombergLP::bslalg::RbTreeUtil::copyTree(&d_tree,
                                                   original.d_tree,
                                                   &nodeFactory());
+        TreeUtil::updateSubtreeSizes(&d_tree);
     }
 }
 
@@ -1248,6 +1659,7 @@ set<KEY, COMPARATOR, ALLOCATOR>::set(const set&       original,
         BloombergLP::bslalg::RbTreeUtil::copyTree(&d_tree,
                                                   original.d_tree,
                                                   &nodeFactory());
+        TreeUtil::updateSubtreeSizes(&d_tree);
     }
 }
 
@@ -1330,10 +1742,10 @@ set<KEY, COMPARATOR, ALLOCATOR>::insert(const value_type& value)
                                                                       // RETURN
     }
     BloombergLP::bslalg::RbTreeNode *node = nodeFactory().createNode(value);
-    BloombergLP::bslalg::RbTreeUtil::insertAt(&d_tree,
-                                              insertLocation,
-                                              comparisonResult < 0,
-                                              node);
+    TreeUtil::insertAt(&d_tree,
+                       insertLocation,
+                       comparisonResult < 0,
+                       node);
     return pair<iterator, bool>(iterator(node), true);
 }
 
@@ -1358,25 +1770,267 @@ set<KEY, COMPARATOR, ALLOCATOR>::insert(const_iterator   hint,
     }
 
     BloombergLP::bslalg::RbTreeNode *node = nodeFactory().createNode(value);
-    BloombergLP::bslalg::RbTreeUtil::insertAt(&d_tree,
-                                              insertLocation,
-                                              comparisonResult < 0,
-                                              node);
+    TreeUtil::insertAt(&d_tree,
+                       insertLocation,
+                       comparisonResult < 0,
+                       node);
     return iterator(node);
 }
 
 template <class KEY, class COMPARATOR, class ALLOCATOR>
 template <class INPUT_ITERATOR>
-inline
 void set<KEY, COMPARATOR, ALLOCATOR>::insert(INPUT_ITERATOR first,
                                              INPUT_ITERATOR last)
 {
+    if (first != last && 0 == d_tree.numNodes()) {
+        // Link the nodes for the longest prefix of the range whose keys are
+        // in strictly increasing order into a chain, which 'guard' turns
+        // into a balanced tree in linear time (see
+        // 'bslalg::RbTreeUtil::balanceChain'), even if an exception is
+        // thrown.  If the length of the range can be determined in advance,
+        // reserve nodes for the whole range, so that they are obtained in a
+        // single allocation.  Neither the chain nor its balancing maintain
+        // subtree sizes, so 'sizesGuard' (destroyed after 'guard') restores
+        // them, if they are maintained.
+
+        const difference_type numValues =
+              BloombergLP::bslstl::IteratorUtil::insertDistance(first, last);
+        if (0 < numValues) {
+            nodeFactory().reserveNodes(numValues);
+        }
+
+        SubtreeSizesGuard                         sizesGuard(&d_tree);
+        BloombergLP::bslalg::RbTreeUtilChainGuard guard(&d_tree);
+
+        BloombergLP::bslalg::RbTreeNode *lastNode =
+                                              nodeFactory().createNode(*first);
+        BloombergLP::bslalg::RbTreeUtil::appendToChain(&d_tree,
+                                                       d_tree.sentinel(),
+                                                       lastNode);
+        while (++first != last) {
+            const value_type& value = *first;
+            if (this->comparator()(value, *lastNode)) {
+                // The rest of the range is not ordered: balance the tree
+                // built so far, and insert 'value' (which cannot be obtained
+                // again from an input iterator) here, and the remaining
+                // values below, one at a time.
+
+                guard.balance();
+                TreeUtil::updateSubtreeSizes(&d_tree);
+                insert(value);
+                ++first;
+                break;
+            }
+            if (this->comparator()(*lastNode, value)) {
+                BloombergLP::bslalg::RbTreeNode *node =
+                                               nodeFactory().createNode(value);
+                BloombergLP::bslalg::RbTreeUtil::appendToChain(&d_tree,
+                                                               lastNode,
+                                                               node);
+                lastNode = node;
+            }
+        }
+    }
+
+    // Insert the remaining values, if any, one at a time.
+
     while (first != last) {
         insert(*first);
         ++first;
     }
 }
 
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+bsl::pair<typename set<KEY, COMPARATOR, ALLOCATOR>::iterator, bool>
+set<KEY, COMPARATOR, ALLOCATOR>::insert(node_type& node)
+{
+    typedef bsl::pair<iterator, bool> ResultType;
+
+    if (node.empty()) {
+        return ResultType(end(), false);                              // RETURN
+    }
+
+    int comparisonResult;
+    BloombergLP::bslalg::RbTreeNode *insertLocation =
+        BloombergLP::bslalg::RbTreeUtil::findUniqueInsertLocation(
+                                                            &comparisonResult,
+                                                            &d_tree,
+                                                            this->comparator(),
+                                                            node.value());
+    if (!comparisonResult) {
+        return ResultType(iterator(insertLocation), false);           // RETURN
+    }
+    BloombergLP::bslalg::RbTreeNode *newNode =
+        nodeFactory().takeNode(&node,
+                               node.get_allocator() == this->get_allocator());
+    TreeUtil::insertAt(&d_tree,
+                       insertLocation,
+                       comparisonResult < 0,
+                       newNode);
+    return ResultType(iterator(newNode), true);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename set<KEY, COMPARATOR, ALLOCATOR>::iterator
+set<KEY, COMPARATOR, ALLOCATOR>::insert(const_iterator hint, node_type& node)
+{
+    if (node.empty()) {
+        return end();                                                 // RETURN
+    }
+
+    BloombergLP::bslalg::RbTreeNode *hintNode =
+                const_cast<BloombergLP::bslalg::RbTreeNode *>(hint.node());
+    int comparisonResult;
+    BloombergLP::bslalg::RbTreeNode *insertLocation =
+        BloombergLP::bslalg::RbTreeUtil::findUniqueInsertLocation(
+                                                            &comparisonResult,
+                                                            &d_tree,
+                                                            this->comparator(),
+                                                            node.value(),
+                                                            hintNode);
+    if (!comparisonResult) {
+        return iterator(insertLocation);                              // RETURN
+    }
+    BloombergLP::bslalg::RbTreeNode *newNode =
+        nodeFactory().takeNode(&node,
+                               node.get_allocator() == this->get_allocator());
+    TreeUtil::insertAt(&d_tree,
+                       insertLocation,
+                       comparisonResult < 0,
+                       newNode);
+    return iterator(newNode);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+typename set<KEY, COMPARATOR, ALLOCATOR>::node_type
+set<KEY, COMPARATOR, ALLOCATOR>::extract(const_iterator position)
+{
+    BSLS_ASSERT_SAFE(position != end());
+
+    BloombergLP::bslalg::RbTreeNode *node =
+                const_cast<BloombergLP::bslalg::RbTreeNode *>(position.node());
+
+    BloombergLP::bslalg::RbTreeNode *detachedNode =
+                                        nodeFactory().createDetachedNode(node);
+    TreeUtil::remove(&d_tree, node);
+    nodeFactory().deallocateNode(node);
+
+    node_type result;
+    result.adoptNode(static_cast<Node *>(detachedNode), this->get_allocator());
+    return result;
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename set<KEY, COMPARATOR, ALLOCATOR>::node_type
+set<KEY, COMPARATOR, ALLOCATOR>::extract(const key_type& key)
+{
+    const_iterator it = find(key);
+    if (it == end()) {
+        return node_type();                                           // RETURN
+    }
+    return extract(it);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+void set<KEY, COMPARATOR, ALLOCATOR>::merge(set& source)
+{
+    if (this == &source) {
+        return;                                                       // RETURN
+    }
+
+    // Each element is located in this tree before it is relocated, so that
+    // an exception thrown by the comparator leaves it in 'source'.
+
+    const bool isSameAllocator =
+                               source.get_allocator() == this->get_allocator();
+
+    BloombergLP::bslalg::RbTreeNode *node = source.d_tree.firstNode();
+    while (source.d_tree.sentinel() != node) {
+        BloombergLP::bslalg::RbTreeNode *next =
+            BloombergLP::bslalg::RbTreeUtil::next(node);
+
+        int comparisonResult;
+        BloombergLP::bslalg::RbTreeNode *insertLocation =
+            BloombergLP::bslalg::RbTreeUtil::findUniqueInsertLocation(
+                                           &comparisonResult,
+                                           &d_tree,
+                                           this->comparator(),
+                                           static_cast<Node *>(node)->value());
+        if (comparisonResult) {
+            BloombergLP::bslalg::RbTreeNode *newNode =
+                nodeFactory().createNodeByRelocation(
+                       BSLS_UTIL_ADDRESSOF(static_cast<Node *>(node)->value()),
+                       isSameAllocator);
+            TreeUtil::remove(&source.d_tree, node);
+            source.nodeFactory().deallocateNode(node);
+            TreeUtil::insertAt(&d_tree,
+                               insertLocation,
+                               comparisonResult < 0,
+                               newNode);
+        }
+        node = next;
+    }
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+void set<KEY, COMPARATOR, ALLOCATOR>::mergeUnion(set& other)
+{
+    if (this == &other || 0 == other.size()) {
+        return;                                                       // RETURN
+    }
+
+    // Move the objects of 'other' into 'source', a tree of nodes owned by
+    // this set, which 'proctor' deletes unless they are all merged into, or
+    // destroyed by, 'bslalg::RbTreeUtil::mergeUnion'.  The merge does not
+    // maintain subtree sizes, so 'sizesGuard' restores them, if they are
+    // maintained.
+
+    BloombergLP::bslalg::RbTreeAnchor                       source;
+    BloombergLP::bslalg::RbTreeUtilTreeProctor<NodeFactory> proctor(
+                                                               &source,
+                                                               &nodeFactory());
+    takeNodes(&source, other);
+
+    SubtreeSizesGuard sizesGuard(&d_tree);
+    BloombergLP::bslalg::RbTreeUtil::mergeUnion(&d_tree,
+                                                &source,
+                                                this->comparator(),
+                                                &nodeFactory());
+    proctor.release();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+void set<KEY, COMPARATOR, ALLOCATOR>::intersect(const set& other)
+{
+    if (this == &other) {
+        return;                                                       // RETURN
+    }
+    SubtreeSizesGuard sizesGuard(&d_tree);
+    BloombergLP::bslalg::RbTreeUtil::intersect(&d_tree,
+                                               other.d_tree,
+                                               this->comparator(),
+                                               &nodeFactory());
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+void set<KEY, COMPARATOR, ALLOCATOR>::subtract(const set& other)
+{
+    if (this == &other) {
+        clear();
+        return;                                                       // RETURN
+    }
+    SubtreeSizesGuard sizesGuard(&d_tree);
+    BloombergLP::bslalg::RbTreeUtil::subtract(&d_tree,
+                                              other.d_tree,
+                                              this->comparator(),
+                                              &nodeFactory());
+}
+
 template <class KEY, class COMPARATOR, class ALLOCATOR>
 inline
 typename set<KEY, COMPARATOR, ALLOCATOR>::iterator
@@ -1388,7 +2042,7 @@ set<KEY, COMPARATOR, ALLOCATOR>::erase(const_iterator position)
                 const_cast<BloombergLP::bslalg::RbTreeNode *>(position.node());
     BloombergLP::bslalg::RbTreeNode *result =
                                    BloombergLP::bslalg::RbTreeUtil::next(node);
-    BloombergLP::bslalg::RbTreeUtil::remove(&d_tree, node);
+    TreeUtil::remove(&d_tree, node);
     nodeFactory().deleteNode(node);
     return iterator(result);
 }
@@ -1510,6 +2164,20 @@ set<KEY, COMPARATOR, ALLOCATOR>::equal_range(const key_type& key)
     return pair<iterator, iterator>(startIt, endIt);
 }
 
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename set<KEY, COMPARATOR, ALLOCATOR>::iterator
+set<KEY, COMPARATOR, ALLOCATOR>::nth(size_type index)
+{
+    BSLMF_ASSERT(
+                BloombergLP::bslstl::MaintainsSubtreeSizes<COMPARATOR>::value);
+    BSLS_ASSERT_SAFE(index <= size());
+
+    return iterator(BloombergLP::bslalg::RbTreeUtil::nth(
+                                                    d_tree,
+                                                    static_cast<int>(index)));
+}
+
 // ACCESSORS
 template <class KEY, class COMPARATOR, class ALLOCATOR>
 inline
@@ -1676,6 +2344,36 @@ set<KEY, COMPARATOR, ALLOCATOR>::equal_range(const key_type& key) const
     return pair<const_iterator, const_iterator>(startIt, endIt);
 }
 
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename set<KEY, COMPARATOR, ALLOCATOR>::const_iterator
+set<KEY, COMPARATOR, ALLOCATOR>::nth(size_type index) const
+{
+    BSLMF_ASSERT(
+                BloombergLP::bslstl::MaintainsSubtreeSizes<COMPARATOR>::value);
+    BSLS_ASSERT_SAFE(index <= size());
+
+    return const_iterator(BloombergLP::bslalg::RbTreeUtil::nth(
+                                                    d_tree,
+                                                    static_cast<int>(index)));
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename set<KEY, COMPARATOR, ALLOCATOR>::size_type
+set<KEY, COMPARATOR, ALLOCATOR>::rank(const key_type& key) const
+{
+    BSLMF_ASSERT(
+                BloombergLP::bslstl::MaintainsSubtreeSizes<COMPARATOR>::value);
+
+    return BloombergLP::bslalg::RbTreeUtil::rank(
+                      d_tree,
+                      BloombergLP::bslalg::RbTreeUtil::lowerBound(
+                                                           d_tree,
+                                                           this->comparator(),
+                                                           key));
+}
+
 }  // close namespace bsl
 
 template <class KEY, class COMPARATOR, class ALLOCATOR>
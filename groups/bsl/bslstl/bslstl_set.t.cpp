@@ -1,6 +1,8 @@
 // bslstl_set.t.cpp                                                   -*-C++-*-
 #include <bslstl_set.h>
 
+#include <bslstl_vector.h>  // for testing only
+
 #include <bslalg_rangecompare.h>
 
 #include <bslma_default.h>
@@ -12,6 +14,7 @@
 
 #include <bslmf_issame.h>
 #include <bslmf_haspointersemantics.h>
+#include <bslmf_nestedtraitdeclaration.h>
 
 #include <bsls_alignmentutil.h>
 #include <bsls_asserttest.h>
@@ -148,9 +151,21 @@ using namespace bsl;
 //// specialized algorithms:
 // [ 8] void swap(set<K, C, A>& a, set<K, C, A>& b);
 //
+// [26] node_type extract(const_iterator position);
+// [26] node_type extract(const key_type& key);
+// [26] pair<iterator, bool> insert(node_type& node);
+// [26] iterator insert(const_iterator hint, node_type& node);
+// [26] void merge(set& source);
+// [28] void mergeUnion(set& other);
+// [28] void intersect(const set& other);
+// [28] void subtract(const set& other);
+//
+// [29] iterator nth(size_type index);
+// [29] const_iterator nth(size_type index) const;
+// [29] size_type rank(const key_type& key) const;
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [25] USAGE EXAMPLE
+// [30] USAGE EXAMPLE
 //
 // TEST APPARATUS: GENERATOR FUNCTIONS
 // [ 3] int ggg(set<T,A> *object, const char *spec, int verbose = 1);
@@ -160,6 +175,7 @@ using namespace bsl;
 // [22] CONCERN: The object is compatible with STL allocators.
 // [23] CONCERN: The object has the necessary type traits
 // [24] CONCERN: The type provides the full interface defined by the standard.
+// [27] CONCERN: Construction from an ordered range takes linear time.
 
 // ============================================================================
 //                      STANDARD BDE ASSERT TEST MACROS
@@ -291,6 +307,19 @@ const DefaultDataRow DEFAULT_DATA[] = {
 };
 static const int DEFAULT_NUM_DATA = sizeof DEFAULT_DATA / sizeof *DEFAULT_DATA;
 
+struct TestTypeDataLess {
+    // This 'struct' provides a comparator ordering objects of the 'bsltf'
+    // test types by the value of their 'data' attribute.
+
+    template <class TYPE>
+    bool operator()(const TYPE& lhs, const TYPE& rhs) const
+        // Return 'true' if the 'data' attribute of the specified 'lhs' is
+        // less than that of the specified 'rhs', and 'false' otherwise.
+    {
+        return lhs.data() < rhs.data();
+    }
+};
+
 //=============================================================================
 //                  GLOBAL HELPER FUNCTIONS FOR TESTING
 //-----------------------------------------------------------------------------
@@ -765,6 +794,40 @@ bool lessThanFunction(const TYPE& lhs, const TYPE& rhs)
          < bsltf::TemplateTestFacility::getIdentifier<TYPE>(rhs);
 }
 
+struct RankedLess {
+    // This test 'struct' provides a less-than comparator for 'int' values
+    // that is associated with the 'bslstl::MaintainsSubtreeSizes' trait.
+
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(RankedLess, bslstl::MaintainsSubtreeSizes);
+
+    // ACCESSORS
+    bool operator()(int lhs, int rhs) const
+        // Return 'true' if the specified 'lhs' is less than the specified
+        // 'rhs', and 'false' otherwise.
+    {
+        return lhs < rhs;
+    }
+};
+
+template <class OBJ>
+void verifyOrderStatistics(int line, const OBJ& X)
+    // Verify, reporting failures with the specified 'line', that 'nth' and
+    // 'rank' of the specified set 'X' agree with a traversal of 'X'.
+{
+    typename OBJ::size_type index = 0;
+    for (typename OBJ::const_iterator it = X.begin(); it != X.end(); ++it) {
+        ASSERTV(line, index, *it, it == X.nth(index));
+        ASSERTV(line, index, *it, index     == X.rank(*it));
+        ASSERTV(line, index, *it, index + 1 == X.rank(*it + 1));
+        ++index;
+    }
+    ASSERTV(line, X.size(), index, X.size() == index);
+    ASSERTV(line, X.size(), X.end() == X.nth(X.size()));
+    ASSERTV(line, X.size(), X.size() == X.rank(INT_MAX));
+    ASSERTV(line, X.size(), 0 == X.rank(INT_MIN));
+}
+
 }  // close unnamed namespace
 
 // ============================================================================
@@ -6340,7 +6403,7 @@ int main(int argc, char *argv[])
     bslma::Default::setDefaultAllocator(&defaultAllocator);
 
     switch (test) { case 0:
-      case 26: {
+      case 30: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //
@@ -6391,6 +6454,827 @@ int main(int argc, char *argv[])
         }
 
       } break;
+      case 29: {
+        // --------------------------------------------------------------------
+        // TESTING ORDER STATISTICS
+        //
+        // Concerns:
+        //: 1 A set whose comparator is associated with the
+        //:   'bslstl::MaintainsSubtreeSizes' trait provides 'nth' and 'rank',
+        //:   which agree with a traversal of the set.
+        //:
+        //: 2 The results remain accurate after inserting and erasing elements
+        //:   by each of the manipulators of the set.
+        //:
+        //: 3 The results are accurate for sets built by copying, by
+        //:   constructing from ordered and unordered ranges, and by 'merge',
+        //:   'mergeUnion', 'intersect', 'subtract', and 'swap'.
+        //:
+        //: 4 The modifiable and non-modifiable overloads of 'nth' return
+        //:   iterators to the same element.
+        //:
+        //: 5 A set with a comparator not associated with the trait is
+        //:   unaffected.
+        //:
+        //: 6 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Insert keys in a permuted order, using each of the insertion
+        //:   methods in turn, and verify 'nth' and 'rank' against a traversal
+        //:   of the set after each insertion.  (C-1..2)
+        //:
+        //: 2 Erase, and extract and reinsert, elements using each method, and
+        //:   verify 'nth' and 'rank' after each.  (C-2)
+        //:
+        //: 3 Build sets by each of the operations in C-3, and verify 'nth' and
+        //:   'rank' on the results.  (C-3)
+        //:
+        //: 4 Compare the results of both overloads of 'nth' for each index.
+        //:   (C-4)
+        //:
+        //: 5 Verify the trait for the default comparator, and exercise a set
+        //:   using it.  (C-5)
+        //:
+        //: 6 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for an index greater than the size (using the
+        //:   'BSLS_ASSERTTEST_*' macros).  (C-6)
+        //
+        // Testing:
+        //   iterator nth(size_type index);
+        //   const_iterator nth(size_type index) const;
+        //   size_type rank(const key_type& key) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING ORDER STATISTICS"
+                            "\n========================\n");
+
+        typedef bsl::set<int, RankedLess> Obj;
+        typedef bsl::vector<int>          Range;
+
+        ASSERT( bslstl::MaintainsSubtreeSizes<RankedLess>::value);
+        ASSERT(!bslstl::MaintainsSubtreeSizes<std::less<int> >::value);
+
+        const int NUM_VALUES = 97;  // prime, so that '(i * 31) % NUM_VALUES'
+                                    // is a permutation of '[0 .. NUM_VALUES)'
+
+        bslma::TestAllocator         da("default", veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+        bslma::TestAllocator za("other",   veryVeryVeryVerbose);
+        bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+
+        if (verbose) printf("Testing insertion.\n");
+
+        Obj mX(&oa);  const Obj& X = mX;
+        verifyOrderStatistics(L_, X);
+        for (int i = 0; i < NUM_VALUES; ++i) {
+            const int KEY = 2 * ((i * 31) % NUM_VALUES);
+
+            switch (i % 3) {
+              case 0: {
+                mX.insert(KEY);
+              } break;
+              case 1: {
+                mX.insert(X.lower_bound(KEY), KEY);
+              } break;
+              case 2: {
+                mX.insert(X.begin(), KEY);
+              } break;
+            }
+            verifyOrderStatistics(L_, X);
+        }
+        ASSERTV(X.size(), NUM_VALUES == static_cast<int>(X.size()));
+
+        if (verbose) printf("Testing modifiable access.\n");
+
+        for (int i = 0; i <= NUM_VALUES; ++i) {
+            ASSERTV(i, X.nth(i) == mX.nth(i));
+        }
+
+        if (verbose) printf("Testing copying and swapping.\n");
+        {
+            const Obj Y(X, &sa);
+            verifyOrderStatistics(L_, Y);
+
+            Obj mZ(&sa);  const Obj& Z = mZ;
+            mZ = X;
+            verifyOrderStatistics(L_, Z);
+
+            mZ.erase(mZ.nth(NUM_VALUES / 2));
+            mZ.swap(mX);
+            verifyOrderStatistics(L_, X);
+            verifyOrderStatistics(L_, Z);
+            ASSERTV(X.size(), NUM_VALUES - 1 == static_cast<int>(X.size()));
+
+            mX = Y;
+            ASSERT(Y == X);
+        }
+
+        if (verbose) printf("Testing erasure and extraction.\n");
+        {
+            Obj mY(X, &oa);  const Obj& Y = mY;
+
+            for (int i = 0; i < NUM_VALUES; i += 3) {
+                const int KEY = 2 * ((i * 31) % NUM_VALUES);
+
+                switch (i % 4) {
+                  case 0: {
+                    ASSERTV(KEY, 1 == mY.erase(KEY));
+                  } break;
+                  case 1: {
+                    mY.erase(Y.find(KEY));
+                  } break;
+                  case 2: {
+                    Obj::node_type node = mY.extract(KEY);
+                    verifyOrderStatistics(L_, Y);
+                    mY.insert(node);
+                    verifyOrderStatistics(L_, Y);
+                    node = mY.extract(Y.find(KEY));
+                  } break;
+                  case 3: {
+                    Obj::node_type node = mY.extract(KEY);
+                    mY.insert(Y.end(), node);
+                    verifyOrderStatistics(L_, Y);
+                    mY.erase(Y.find(KEY));
+                  } break;
+                }
+                verifyOrderStatistics(L_, Y);
+            }
+
+            mY.erase(Y.nth(Y.size() / 4), Y.nth(Y.size() / 2));
+            verifyOrderStatistics(L_, Y);
+
+            mY.clear();
+            verifyOrderStatistics(L_, Y);
+        }
+
+        if (verbose) printf("Testing construction from ranges.\n");
+
+        for (int ordered = 0; ordered < 2; ++ordered) {
+            Range range(&sa);
+            for (int i = 0; i < NUM_VALUES; ++i) {
+                range.push_back(ordered ? i : (i * 31) % NUM_VALUES);
+            }
+
+            const Obj Y(range.begin(), range.end(), RankedLess(), &oa);
+            verifyOrderStatistics(L_, Y);
+
+            Obj mZ(&oa);  const Obj& Z = mZ;
+            mZ.insert(range.begin(), range.end());
+            verifyOrderStatistics(L_, Z);
+
+            mZ.insert(range.begin(), range.end());
+            verifyOrderStatistics(L_, Z);
+            ASSERT(Y == Z);
+        }
+
+        if (verbose) printf("Testing set operations.\n");
+
+        for (int step = 1; step <= 5; ++step) {
+            Obj mY(&oa);  const Obj& Y = mY;
+            for (int i = 0; i < NUM_VALUES; ++i) {
+                mY.insert(3 * i * step % (2 * NUM_VALUES));
+            }
+            verifyOrderStatistics(L_, Y);
+
+            if (veryVerbose) { T_ P_(step) P(Y.size()) }
+
+            {
+                Obj mZ(X, &oa);  const Obj& Z = mZ;
+                Obj mW(Y, &za);  const Obj& W = mW;
+
+                mZ.merge(mW);
+                verifyOrderStatistics(L_, Z);
+                verifyOrderStatistics(L_, W);
+            }
+            for (int cfg = 0; cfg < 2; ++cfg) {
+                Obj mZ(X, &oa);                const Obj& Z = mZ;
+                Obj mW(Y, cfg ? &za : &oa);    const Obj& W = mW;
+
+                mZ.mergeUnion(mW);
+                verifyOrderStatistics(L_, Z);
+                verifyOrderStatistics(L_, W);
+            }
+            {
+                Obj mZ(X, &oa);  const Obj& Z = mZ;
+
+                mZ.intersect(Y);
+                verifyOrderStatistics(L_, Z);
+            }
+            {
+                Obj mZ(X, &oa);  const Obj& Z = mZ;
+
+                mZ.subtract(Y);
+                verifyOrderStatistics(L_, Z);
+            }
+        }
+
+        if (verbose) printf("Testing the default comparator.\n");
+        {
+            typedef bsl::set<int> IntSet;
+
+            IntSet mY(&oa);  const IntSet& Y = mY;
+            for (int i = 0; i < NUM_VALUES; ++i) {
+                mY.insert((i * 31) % NUM_VALUES);
+            }
+            IntSet mZ(Y, &oa);  const IntSet& Z = mZ;
+            mZ.subtract(Y);
+            ASSERTV(Y.size(), NUM_VALUES == static_cast<int>(Y.size()));
+            ASSERT(Z.empty());
+        }
+
+        if (verbose) printf("Negative testing.\n");
+        {
+            bsls::AssertFailureHandlerGuard hG(
+                                             bsls::AssertTest::failTestDriver);
+
+            ASSERT_SAFE_PASS(X.nth(X.size()));
+            ASSERT_SAFE_FAIL(X.nth(X.size() + 1));
+            ASSERT_SAFE_PASS(mX.nth(0));
+            ASSERT_SAFE_FAIL(mX.nth(X.size() + 1));
+        }
+
+        ASSERTV(da.numBlocksTotal(), 0 == da.numBlocksTotal());
+      } break;
+      case 28: {
+        // --------------------------------------------------------------------
+        // TESTING SET OPERATIONS
+        //
+        // Concerns:
+        //: 1 'mergeUnion' leaves this set holding each key of either set, the
+        //:   objects of this set being kept for the keys held by both sets,
+        //:   and leaves the other set empty.
+        //:
+        //: 2 'intersect' and 'subtract' leave this set holding the objects
+        //:   whose keys are held, or are not held, respectively, by the other
+        //:   set, which is not modified.
+        //:
+        //: 3 If both sets use the same allocator, 'mergeUnion' allocates no
+        //:   memory, and the objects it moves keep their addresses.
+        //:
+        //: 4 If the allocators differ, the objects moved by 'mergeUnion' use
+        //:   the allocator of this set.
+        //:
+        //: 5 Applying 'mergeUnion' or 'intersect' to a set and itself has no
+        //:   effect, and applying 'subtract' empties the set.
+        //:
+        //: 6 If an exception is thrown by 'mergeUnion', this set is left
+        //:   unchanged, and no memory is leaked.
+        //
+        // Plan:
+        //: 1 For each pair of rows of a table of arithmetic sequences of keys,
+        //:   apply each operation to sets holding these keys, using the same
+        //:   and different allocators, and compare the results with those of
+        //:   'std::set_union', 'std::set_intersection', and
+        //:   'std::set_difference'.  (C-1..2)
+        //:
+        //: 2 Using a test allocator monitor, apply 'mergeUnion' to sets using
+        //:   the same allocator and verify the addresses of the moved
+        //:   objects, then to sets using different allocators and verify the
+        //:   allocators of the moved objects.  (C-3..4)
+        //:
+        //: 3 Apply each operation to a set and itself.  (C-5)
+        //:
+        //: 4 Apply 'mergeUnion' to sets using different allocators in the
+        //:   presence of injected exceptions (using the
+        //:   'BSLMA_TESTALLOCATOR_EXCEPTION_TEST_*' macros), and verify this
+        //:   set after each exception.  (C-6)
+        //
+        // Testing:
+        //   void mergeUnion(set& other);
+        //   void intersect(const set& other);
+        //   void subtract(const set& other);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING SET OPERATIONS"
+                            "\n======================\n");
+
+        typedef bsl::set<int>    IntSet;
+        typedef bsl::vector<int> Keys;
+
+        static const struct {
+            int d_line;   // source line number
+            int d_first;  // first key
+            int d_step;   // difference between consecutive keys
+            int d_count;  // number of keys
+        } DATA[] = {
+            //line  first  step  count
+            //----  -----  ----  -----
+            { L_,       0,    1,     0 },
+            { L_,       0,    1,     1 },
+            { L_,       5,    1,     1 },
+            { L_,       0,    1,    10 },
+            { L_,       0,    2,    10 },
+            { L_,       1,    3,    10 },
+            { L_,      20,    1,    10 },
+            { L_,       0,    1,   300 },
+            { L_,     150,    7,   100 },
+            { L_,     300,    2,   200 },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        bslma::TestAllocator         da("default", veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        if (verbose) printf("Testing the resulting keys.\n");
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int LINE1 = DATA[ti].d_line;
+
+            bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+
+            IntSet mL(&sa);  const IntSet& L = mL;
+            for (int i = 0; i < DATA[ti].d_count; ++i) {
+                mL.insert(DATA[ti].d_first + i * DATA[ti].d_step);
+            }
+
+            for (int tj = 0; tj < NUM_DATA; ++tj) {
+                const int LINE2 = DATA[tj].d_line;
+
+                IntSet mR(&sa);  const IntSet& R = mR;
+                for (int i = 0; i < DATA[tj].d_count; ++i) {
+                    mR.insert(DATA[tj].d_first + i * DATA[tj].d_step);
+                }
+
+                if (veryVerbose) { T_ P_(LINE1) P(LINE2) }
+
+                Keys expUnion(&sa);
+                Keys expIntersection(&sa);
+                Keys expDifference(&sa);
+                std::set_union(L.begin(), L.end(), R.begin(), R.end(),
+                               std::back_inserter(expUnion));
+                std::set_intersection(L.begin(), L.end(), R.begin(), R.end(),
+                                      std::back_inserter(expIntersection));
+                std::set_difference(L.begin(), L.end(), R.begin(), R.end(),
+                                    std::back_inserter(expDifference));
+
+                bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+                bslma::TestAllocator za("other",  veryVeryVeryVerbose);
+
+                for (int cfg = 0; cfg < 2; ++cfg) {
+                    IntSet mX(L, &oa);                const IntSet& X = mX;
+                    IntSet mY(R, cfg ? &za : &oa);    const IntSet& Y = mY;
+
+                    mX.mergeUnion(mY);
+                    ASSERTV(LINE1, LINE2, cfg,
+                            expUnion == Keys(X.begin(), X.end(), &sa));
+                    ASSERTV(LINE1, LINE2, cfg, Y.empty());
+                }
+                {
+                    IntSet mX(L, &oa);  const IntSet& X = mX;
+                    const IntSet Y(R, &oa);
+
+                    mX.intersect(Y);
+                    ASSERTV(LINE1, LINE2,
+                            expIntersection == Keys(X.begin(), X.end(), &sa));
+                    ASSERTV(LINE1, LINE2, R == Y);
+                }
+                {
+                    IntSet mX(L, &oa);  const IntSet& X = mX;
+                    const IntSet Y(R, &oa);
+
+                    mX.subtract(Y);
+                    ASSERTV(LINE1, LINE2,
+                            expDifference == Keys(X.begin(), X.end(), &sa));
+                    ASSERTV(LINE1, LINE2, R == Y);
+                }
+                ASSERTV(LINE1, LINE2, oa.numBlocksInUse(),
+                        0 == oa.numBlocksInUse());
+                ASSERTV(LINE1, LINE2, za.numBlocksInUse(),
+                        0 == za.numBlocksInUse());
+            }
+        }
+
+        typedef bsltf::AllocBitwiseMoveableTestType Element;
+        typedef bsl::set<Element, TestTypeDataLess> Obj;
+
+        const int NUM_VALUES = 16;
+
+        if (verbose) printf("Testing the reuse of nodes.\n");
+        {
+            bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+            bslma::TestAllocator za("other",   veryVeryVeryVerbose);
+            bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+            {
+                Obj mX(&oa);  const Obj& X = mX;
+                Obj mY(&oa);  const Obj& Y = mY;
+                Obj mZ(&za);  const Obj& Z = mZ;
+
+                IntSet expected(&sa);
+                for (int i = 0; i < NUM_VALUES; ++i) {
+                    mX.insert(Element(2 * i, &sa));
+                    mY.insert(Element(3 * i, &sa));
+                    mZ.insert(Element(5 * i + 1, &sa));
+                    expected.insert(2 * i);
+                    expected.insert(3 * i);
+                }
+
+                const Element *KEPT  = &*X.find(Element(0, &sa));
+                const Element *MOVED = &*Y.find(Element(3, &sa));
+
+                bslma::TestAllocatorMonitor oam(&oa);
+
+                mX.mergeUnion(mY);
+
+                ASSERT(oam.isTotalSame());
+                ASSERT(Y.empty());
+                ASSERTV(X.size(), expected.size() == X.size());
+                ASSERT(KEPT  == &*X.find(Element(0, &sa)));
+                ASSERT(MOVED == &*X.find(Element(3, &sa)));
+
+                for (int i = 0; i < NUM_VALUES; ++i) {
+                    expected.insert(5 * i + 1);
+                }
+
+                mX.mergeUnion(mZ);
+
+                ASSERT(Z.empty());
+                ASSERTV(X.size(), expected.size() == X.size());
+                for (Obj::const_iterator it = X.begin(); it != X.end(); ++it) {
+                    ASSERTV(it->data(), 1 == expected.count(it->data()));
+                    ASSERTV(it->data(), &oa == it->allocator());
+                }
+
+                // 'Y', which is empty and has no nodes left, can be reused.
+
+                mY.insert(Element(1, &sa));
+                ASSERTV(Y.size(), 1 == Y.size());
+            }
+            ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+            ASSERTV(za.numBlocksInUse(), 0 == za.numBlocksInUse());
+        }
+
+        if (verbose) printf("Testing aliasing.\n");
+        {
+            bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+            bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+
+            Obj mX(&oa);  const Obj& X = mX;
+            for (int i = 0; i < NUM_VALUES; ++i) {
+                mX.insert(Element(i, &sa));
+            }
+            const Obj W(X, &sa);
+
+            mX.mergeUnion(mX);
+            ASSERT(W == X);
+
+            mX.intersect(X);
+            ASSERT(W == X);
+
+            mX.subtract(X);
+            ASSERT(X.empty());
+        }
+
+        if (verbose) printf("Testing exception safety.\n");
+        {
+            bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+            bslma::TestAllocator za("other",   veryVeryVeryVerbose);
+            bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+            {
+                Obj mX(&oa);  const Obj& X = mX;
+                for (int i = 0; i < NUM_VALUES; ++i) {
+                    mX.insert(Element(2 * i, &sa));
+                }
+                const Obj W(X, &sa);
+
+                BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                    ASSERT(W == X);
+
+                    Obj mZ(&za);
+                    for (int i = 0; i < NUM_VALUES; ++i) {
+                        mZ.insert(Element(3 * i, &sa));
+                    }
+
+                    mX.mergeUnion(mZ);
+                } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+                ASSERTV(X.size(), 2 * NUM_VALUES - 6 == X.size());
+            }
+            ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+            ASSERTV(za.numBlocksInUse(), 0 == za.numBlocksInUse());
+        }
+      } break;
+      case 27: {
+        // --------------------------------------------------------------------
+        // TESTING CONSTRUCTION FROM ORDERED RANGES
+        //
+        // Concerns:
+        //: 1 Constructing a set from a range, or inserting a range into an
+        //:   empty set, yields a set holding each distinct value in the range,
+        //:   whether the values of the range are increasing, non-decreasing,
+        //:   or ordered only up to some position.
+        //:
+        //: 2 Inserting a range into a non-empty set is unaffected.
+        //:
+        //: 3 When the length of the range can be determined in advance, the
+        //:   nodes for the range are obtained from the allocator in a single
+        //:   allocation.
+        //:
+        //: 4 If an exception is thrown, the set is left valid, holding a
+        //:   subset of the values in the range, and no memory is leaked.
+        //
+        // Plan:
+        //: 1 For each row of a table of ranges, generated from an increasing
+        //:   sequence of keys by repeating each key and by making the keys
+        //:   after some position decreasing, and smaller than the keys before
+        //:   that position, construct a set from the range, insert the range
+        //:   into an empty set and into a set holding other values, and
+        //:   compare the results with sets built by inserting the values one
+        //:   at a time.  (C-1..2)
+        //:
+        //: 2 Verify that constructing a set from a range allocates a single
+        //:   block.  (C-3)
+        //:
+        //: 3 Insert each range into an empty set in the presence of injected
+        //:   exceptions (using the 'BSLMA_TESTALLOCATOR_EXCEPTION_TEST_*'
+        //:   macros), and verify the set after each exception.  (C-4)
+        //
+        // Testing:
+        //   CONCERN: Construction from an ordered range takes linear time.
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING CONSTRUCTION FROM ORDERED RANGES"
+                            "\n========================================\n");
+
+        typedef bsl::set<int>  IntSet;
+        typedef bsl::vector<int> Range;
+
+        static const struct {
+            int d_line;        // source line number
+            int d_length;      // number of values in the range
+            int d_repeat;      // number of consecutive values having each key
+            int d_orderedLen;  // length of the ordered prefix of the range
+        } DATA[] = {
+            //line  length  repeat  ordered
+            //----  ------  ------  -------
+            { L_,        0,      1,       0 },
+            { L_,        1,      1,       1 },
+            { L_,        2,      1,       2 },
+            { L_,        2,      1,       1 },
+            { L_,        2,      2,       2 },
+            { L_,        3,      1,       3 },
+            { L_,        7,      1,       7 },
+            { L_,        7,      3,       7 },
+            { L_,        7,      1,       4 },
+            { L_,        8,      1,       8 },
+            { L_,        8,      2,       5 },
+            { L_,      100,      1,     100 },
+            { L_,      100,      3,     100 },
+            { L_,      100,      1,      50 },
+            { L_,      100,      1,       1 },
+            { L_,     1000,      1,    1000 },
+            { L_,     1000,      4,     999 },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        bslma::TestAllocator         da("default", veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int LINE    = DATA[ti].d_line;
+            const int LENGTH  = DATA[ti].d_length;
+            const int REPEAT  = DATA[ti].d_repeat;
+            const int ORDERED = DATA[ti].d_orderedLen;
+
+            if (veryVerbose) { T_ P_(LINE) P_(LENGTH) P_(REPEAT) P(ORDERED) }
+
+            bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+
+            Range range(&sa);
+            for (int i = 0; i < LENGTH; ++i) {
+                const int position = i < ORDERED
+                                   ? LENGTH - ORDERED + i
+                                   : LENGTH - 1 - i;
+                range.push_back(position / REPEAT);
+            }
+
+            IntSet expected(&sa);
+            for (int i = 0; i < LENGTH; ++i) {
+                expected.insert(range[i]);
+            }
+
+            {
+                bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+                const IntSet X(range.begin(), range.end(), std::less<int>(),
+                               &oa);
+
+                ASSERTV(LINE, expected == X);
+                ASSERTV(LINE, oa.numBlocksTotal(),
+                        (0 < LENGTH ? 1 : 0) == oa.numBlocksTotal());
+            }
+            {
+                bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+                IntSet mX(&oa);  const IntSet& X = mX;
+                mX.insert(range.begin(), range.end());
+
+                ASSERTV(LINE, expected == X);
+            }
+            {
+                bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+                IntSet mX(&oa);  const IntSet& X = mX;
+                mX.insert(-1);
+                mX.insert(LENGTH);
+                mX.insert(range.begin(), range.end());
+
+                IntSet mY(expected, &sa);  const IntSet& Y = mY;
+                mY.insert(-1);
+                mY.insert(LENGTH);
+
+                ASSERTV(LINE, Y == X);
+            }
+            {
+                bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+                IntSet mX(&oa);  const IntSet& X = mX;
+
+                BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                    ASSERTV(LINE, X.size() <= expected.size());
+                    for (IntSet::const_iterator it = X.begin();
+                                                       it != X.end(); ++it) {
+                        ASSERTV(LINE, 1 == expected.count(*it));
+                    }
+                    mX.clear();
+
+                    mX.insert(range.begin(), range.end());
+                } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+                ASSERTV(LINE, expected == X);
+            }
+            ASSERTV(LINE, da.numBlocksTotal(), 0 == da.numBlocksTotal());
+        }
+      } break;
+      case 26: {
+        // --------------------------------------------------------------------
+        // TESTING NODE HANDLES
+        //
+        // Concerns:
+        //: 1 'extract' removes the element at a position, or having a key,
+        //:   and returns a handle holding that element and the allocator of
+        //:   the container; extracting a missing key yields an empty handle.
+        //:
+        //: 2 'insert' inserts the element held by a handle, and empties the
+        //:   handle, unless an element having the same key is present, in
+        //:   which case the handle is left unchanged.  Inserting an empty
+        //:   handle has no effect.
+        //:
+        //: 3 An element held by a handle is inserted into a container using
+        //:   the same allocator without allocating memory, even if the
+        //:   container it was extracted from has been destroyed.
+        //:
+        //: 4 'merge' moves each element of the source whose key is not
+        //:   present in the target, including when the two containers use
+        //:   different allocators, and the moved elements then use the
+        //:   allocator of the target.
+        //:
+        //: 5 Merging a container with itself has no effect.
+        //:
+        //: 6 No memory is leaked.
+        //
+        // Plan:
+        //: 1 Extract elements from a container, and insert them into the same
+        //:   and another container, verifying the sizes of the containers, the
+        //:   state of the handles, and (using a test allocator monitor) that
+        //:   no memory is allocated by 'insert'.  Repeat with a handle
+        //:   outliving the container it was extracted from.  (C-1..3)
+        //:
+        //: 2 Merge containers using the same and different allocators, and
+        //:   verify the sizes of the containers and the allocators of the
+        //:   moved elements.  (C-4..5)
+        //:
+        //: 3 Verify that no memory is in use once the containers are
+        //:   destroyed.  (C-6)
+        //
+        // Testing:
+        //   node_type extract(const_iterator position);
+        //   node_type extract(const key_type& key);
+        //   bsl::pair<iterator, bool> insert(node_type& node);
+        //   iterator insert(const_iterator hint, node_type& node);
+        //   void merge(set& source);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING NODE HANDLES"
+                            "\n====================\n");
+
+        typedef bsltf::AllocBitwiseMoveableTestType Element;
+        typedef bsl::set<Element, TestTypeDataLess> Obj;
+        typedef Obj::node_type                      Handle;
+
+        const int NUM_VALUES = 8;
+
+        bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+        bslma::TestAllocator za("other",   veryVeryVeryVerbose);
+        bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+            Obj mY(&oa);  const Obj& Y = mY;
+            Obj mZ(&za);  const Obj& Z = mZ;
+
+            for (int i = 0; i != NUM_VALUES; ++i) {
+                mX.insert(Element(i, &sa));
+                if (i % 2) {
+                    mY.insert(Element(i, &sa));
+                }
+                if (i >= NUM_VALUES - 2) {
+                    mZ.insert(Element(i, &sa));
+                    mZ.insert(Element(i + 2, &sa));
+                }
+            }
+            ASSERTV(Z.size(), 4 == Z.size());
+
+            if (verbose) printf("Testing 'extract'.\n");
+
+            Handle mH = mX.extract(X.find(Element(0, &sa)));
+            const Handle& H = mH;
+            ASSERT(!H.empty());
+            ASSERTV(H.value().data(), 0 == H.value().data());
+            ASSERT(X.get_allocator() == H.get_allocator());
+            ASSERTV(X.size(), NUM_VALUES - 1 == X.size());
+            ASSERT(X.end() == X.find(Element(0, &sa)));
+
+            Handle mG(mX.extract(Element(1, &sa)));  const Handle& G = mG;
+            ASSERT(!G.empty());
+            ASSERTV(G.value().data(), 1 == G.value().data());
+            ASSERTV(X.size(), NUM_VALUES - 2 == X.size());
+
+            ASSERT(mX.extract(Element(1, &sa)).empty());
+            ASSERTV(X.size(), NUM_VALUES - 2 == X.size());
+
+            if (verbose) printf("Testing 'insert'.\n");
+
+            const Obj::size_type SIZE_Y = Y.size();
+
+            bsl::pair<Obj::iterator, bool> result = mY.insert(mG);
+            ASSERT(!result.second);
+            ASSERTV(result.first->data(), 1 == result.first->data());
+            ASSERT(!G.empty());
+            ASSERTV(Y.size(), SIZE_Y == Y.size());
+
+            // 'X' uses the same allocator as 'H'.
+
+            bslma::TestAllocatorMonitor oam(&oa);
+
+            Obj::iterator hintResult = mX.insert(X.begin(), mH);
+            ASSERTV(hintResult->data(), 0 == hintResult->data());
+            ASSERT(H.empty());
+            ASSERTV(X.size(), NUM_VALUES - 1 == X.size());
+
+
+            result = mX.insert(mG);
+            ASSERT(result.second);
+            ASSERTV(result.first->data(), 1 == result.first->data());
+            ASSERT(G.empty());
+            ASSERTV(X.size(), NUM_VALUES == X.size());
+            ASSERT(oam.isTotalSame());
+
+            Handle mE;
+            result = mX.insert(mE);
+            ASSERT(!result.second);
+            ASSERT(X.end() == result.first);
+
+            ASSERT(X.end() == mX.insert(X.begin(), mE));
+
+            // A handle keeps its node after the container is destroyed.
+
+            {
+                Obj mW(&oa);
+                mW.insert(Element(-1, &sa));
+
+                mH = mW.extract(Element(-1, &sa));
+            }
+            ASSERTV(H.value().data(), -1 == H.value().data());
+
+            oam.reset();
+            result = mX.insert(mH);
+            ASSERT(result.second);
+            ASSERT(oam.isTotalSame());
+
+            mX.erase(Element(-1, &sa));
+
+            if (verbose) printf("Testing 'merge'.\n");
+
+            const Obj::size_type SIZE_X = X.size();
+
+            mX.merge(mX);
+            ASSERTV(X.size(), SIZE_X == X.size());
+
+            mX.merge(mZ);
+            ASSERTV(X.size(), SIZE_X + 2 == X.size());
+            ASSERTV(Z.size(), 2 == Z.size());
+            ASSERTV(za.numBlocksInUse(), 0 < za.numBlocksInUse());
+            ASSERT(&oa == X.find(Element(NUM_VALUES, &sa))->allocator());
+            ASSERT(&oa == X.find(Element(NUM_VALUES + 1, &sa))->allocator());
+
+            mY.merge(mX);
+            ASSERTV(Y.size(), NUM_VALUES + 2 == Y.size());
+            ASSERTV(X.size(), NUM_VALUES / 2 == X.size());
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+        ASSERTV(za.numBlocksInUse(), 0 == za.numBlocksInUse());
+      } break;
       case 25: {
         // --------------------------------------------------------------------
         // TESTING STANDARD INTERFACE COVERAGE
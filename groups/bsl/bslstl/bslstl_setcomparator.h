@@ -22,6 +22,10 @@ BSLS_IDENT("$Id: $")
 // 'bslalg::RbTreeUtil' primarily for the purpose of implementing a 'set'
 // container.
 //
+// The nodes are assumed to be of type 'TreeNode<KEY>' unless a different
+// 'TreeNode' type (e.g., one derived from 'bslalg::RbTreeCountedNode') is
+// supplied as the optional (template parameter) type 'NODE'.
+//
 ///Usage
 ///-----
 // This section illustrates intended use of this component.
@@ -144,7 +148,7 @@ namespace bslstl {
                        // class SetComparator
                        // ===================
 
-template <class KEY, class COMPARATOR>
+template <class KEY, class COMPARATOR, class NODE = TreeNode<KEY> >
 #ifdef BSLS_PLATFORM_CMP_MSVC
 // Visual studio compiler fails to resolve the conversion operator in
 // 'bslalg::FunctorAdapter_FunctionPointer' when using private inheritance.
@@ -158,7 +162,8 @@ class SetComparator : private bslalg::FunctorAdapter<COMPARATOR>::Type {
     // 'bslalg::RbTreeNode' object with a object of the parameterized 'KEY'
     // type, assuming the reference to 'bslalg::RbTreeNode' is a base of a
     // 'bslstl::TreeNode' holding an integer, using a functor of the
-    // parameterized 'COMPARATOR' type.
+    // parameterized 'COMPARATOR' type.  The (template parameter) type 'NODE'
+    // is the type of the 'bslstl::TreeNode' (see 'bslstl_treenode').
 
   private:
     // This class does not support assignment.
@@ -168,7 +173,7 @@ class SetComparator : private bslalg::FunctorAdapter<COMPARATOR>::Type {
 
   public:
     // TYPES
-    typedef TreeNode<KEY> NodeType;
+    typedef NODE NodeType;
         // This alias represents the type of node holding a 'KEY' object.
 
     // CREATORS
@@ -204,6 +209,14 @@ class SetComparator : private bslalg::FunctorAdapter<COMPARATOR>::Type {
         // otherwise.  The behavior is undefined unless 'rhs' can be safely
         // cast to 'NodeType'.
 
+    bool operator()(const bslalg::RbTreeNode& lhs,
+                    const bslalg::RbTreeNode& rhs);
+        // Return 'true' if 'value()' of the specified 'lhs' is less than
+        // (ordered before, according to the comparator held by this object)
+        // 'value()' of the specified 'rhs', both after being cast to
+        // 'NodeType', and 'false' otherwise.  The behavior is undefined
+        // unless 'lhs' and 'rhs' can be safely cast to 'NodeType'.
+
     void swap(SetComparator& other);
         // Efficiently exchange the value of this object with the value of the
         // specified 'other' object.  This method provides the no-throw
@@ -226,6 +239,14 @@ class SetComparator : private bslalg::FunctorAdapter<COMPARATOR>::Type {
         // otherwise.  The behavior is undefined unless 'rhs' can be safely
         // cast to 'NodeType'.
 
+    bool operator()(const bslalg::RbTreeNode& lhs,
+                    const bslalg::RbTreeNode& rhs) const;
+        // Return 'true' if 'value()' of the specified 'lhs' is less than
+        // (ordered before, according to the comparator held by this object)
+        // 'value()' of the specified 'rhs', both after being cast to
+        // 'NodeType', and 'false' otherwise.  The behavior is undefined
+        // unless 'lhs' and 'rhs' can be safely cast to 'NodeType'.
+
     COMPARATOR& keyComparator();
         // Return a reference providing modifiable access to the function
         // pointer or functor to which this comparator delegates comparison
@@ -239,9 +260,9 @@ class SetComparator : private bslalg::FunctorAdapter<COMPARATOR>::Type {
 
 
 // FREE FUNCTIONS
-template <class KEY,  class COMPARATOR>
-void swap(SetComparator<KEY, COMPARATOR>& a,
-          SetComparator<KEY, COMPARATOR>& b);
+template <class KEY, class COMPARATOR, class NODE>
+void swap(SetComparator<KEY, COMPARATOR, NODE>& a,
+          SetComparator<KEY, COMPARATOR, NODE>& b);
     // Efficiently exchange the values of the specified 'a' and 'b' objects.
     // This function provides the no-throw exception-safety guarantee.
 
@@ -254,34 +275,34 @@ void swap(SetComparator<KEY, COMPARATOR>& a,
                     // -------------------
 
 // CREATORS
-template <class KEY, class COMPARATOR>
+template <class KEY, class COMPARATOR, class NODE>
 inline
-SetComparator<KEY, COMPARATOR>::SetComparator()
+SetComparator<KEY, COMPARATOR, NODE>::SetComparator()
 : bslalg::FunctorAdapter<COMPARATOR>::Type()
 {
 }
 
-template <class KEY, class COMPARATOR>
+template <class KEY, class COMPARATOR, class NODE>
 inline
-SetComparator<KEY, COMPARATOR>::
+SetComparator<KEY, COMPARATOR, NODE>::
 SetComparator(const COMPARATOR& valueComparator)
 : bslalg::FunctorAdapter<COMPARATOR>::Type(valueComparator)
 {
 }
 
 // MANIPULATORS
-template <class KEY, class COMPARATOR>
+template <class KEY, class COMPARATOR, class NODE>
 inline
-bool SetComparator<KEY, COMPARATOR>::operator()(
+bool SetComparator<KEY, COMPARATOR, NODE>::operator()(
                                            const KEY&                lhs,
                                            const bslalg::RbTreeNode& rhs)
 {
     return keyComparator()(lhs, static_cast<const NodeType&>(rhs).value());
 }
 
-template <class KEY, class COMPARATOR>
+template <class KEY, class COMPARATOR, class NODE>
 inline
-bool SetComparator<KEY, COMPARATOR>::operator()(
+bool SetComparator<KEY, COMPARATOR, NODE>::operator()(
                                            const bslalg::RbTreeNode& lhs,
                                            const KEY&                rhs)
 
@@ -289,10 +310,20 @@ bool SetComparator<KEY, COMPARATOR>::operator()(
     return keyComparator()(static_cast<const NodeType&>(lhs).value(), rhs);
 }
 
-template <class KEY, class COMPARATOR>
+template <class KEY, class COMPARATOR, class NODE>
 inline
-void SetComparator<KEY, COMPARATOR>::swap(
-                                         SetComparator<KEY, COMPARATOR>& other)
+bool SetComparator<KEY, COMPARATOR, NODE>::operator()(
+                                           const bslalg::RbTreeNode& lhs,
+                                           const bslalg::RbTreeNode& rhs)
+{
+    return keyComparator()(static_cast<const NodeType&>(lhs).value(),
+                           static_cast<const NodeType&>(rhs).value());
+}
+
+template <class KEY, class COMPARATOR, class NODE>
+inline
+void SetComparator<KEY, COMPARATOR, NODE>::swap(
+                                   SetComparator<KEY, COMPARATOR, NODE>& other)
 {
     bslalg::SwapUtil::swap(
       static_cast<typename bslalg::FunctorAdapter<COMPARATOR>::Type*>(this),
@@ -301,18 +332,18 @@ void SetComparator<KEY, COMPARATOR>::swap(
 }
 
 // ACCESSORS
-template <class KEY, class COMPARATOR>
+template <class KEY, class COMPARATOR, class NODE>
 inline
-bool SetComparator<KEY, COMPARATOR>::operator()(
+bool SetComparator<KEY, COMPARATOR, NODE>::operator()(
                                            const KEY&                lhs,
                                            const bslalg::RbTreeNode& rhs) const
 {
     return keyComparator()(lhs, static_cast<const NodeType&>(rhs).value());
 }
 
-template <class KEY, class COMPARATOR>
+template <class KEY, class COMPARATOR, class NODE>
 inline
-bool SetComparator<KEY, COMPARATOR>::operator()(
+bool SetComparator<KEY, COMPARATOR, NODE>::operator()(
                                            const bslalg::RbTreeNode& lhs,
                                            const KEY&                rhs) const
 
@@ -320,25 +351,35 @@ bool SetComparator<KEY, COMPARATOR>::operator()(
     return keyComparator()(static_cast<const NodeType&>(lhs).value(), rhs);
 }
 
-template <class KEY, class COMPARATOR>
+template <class KEY, class COMPARATOR, class NODE>
+inline
+bool SetComparator<KEY, COMPARATOR, NODE>::operator()(
+                                           const bslalg::RbTreeNode& lhs,
+                                           const bslalg::RbTreeNode& rhs) const
+{
+    return keyComparator()(static_cast<const NodeType&>(lhs).value(),
+                           static_cast<const NodeType&>(rhs).value());
+}
+
+template <class KEY, class COMPARATOR, class NODE>
 inline
-COMPARATOR& SetComparator<KEY, COMPARATOR>::keyComparator()
+COMPARATOR& SetComparator<KEY, COMPARATOR, NODE>::keyComparator()
 {
     return *this;
 }
 
-template <class KEY, class COMPARATOR>
+template <class KEY, class COMPARATOR, class NODE>
 inline
-const COMPARATOR& SetComparator<KEY, COMPARATOR>::keyComparator() const
+const COMPARATOR& SetComparator<KEY, COMPARATOR, NODE>::keyComparator() const
 {
     return *this;
 }
 
 // FREE FUNCTIONS
-template <class KEY,  class COMPARATOR>
+template <class KEY, class COMPARATOR, class NODE>
 inline
-void swap(SetComparator<KEY, COMPARATOR>& a,
-          SetComparator<KEY, COMPARATOR>& b)
+void swap(SetComparator<KEY, COMPARATOR, NODE>& a,
+          SetComparator<KEY, COMPARATOR, NODE>& b)
 {
     a.swap(b);
 }
@@ -56,6 +56,7 @@
 // ACCESSORS
 // [ 3] bool operator()(const KEY& lhs, const bslalg::RbTreeNode& rhs) const;
 // [ 3] bool operator()(const bslalg::RbTreeNode& rhs, const KEY& lhs) const;
+// [ 3] bool operator()(const RbTreeNode& lhs, const RbTreeNode& rhs) const;
 // [ 2] COMPARATOR keyComparator() const;
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
@@ -442,8 +443,8 @@ void TestDriver<TYPE>::test3()
     // FUNCTION OPERATORS
     // Concerns:
     //: 1 An object supports comparing a const 'Key' object with a const
-    //:   'TreeNode' object and a const 'TreeNode' object with a const 'Key'
-    //:   object for any 'COMPARATOR' type.
+    //:   'TreeNode' object, a const 'TreeNode' object with a const 'Key'
+    //:   object, and two const 'TreeNode' objects for any 'COMPARATOR' type.
     //:
     //: 2 An object delegates its comparison operations to a default
     //:   constructed object of the parameterized 'COMPARATOR' type if
@@ -483,6 +484,7 @@ void TestDriver<TYPE>::test3()
     //   explicit SetComparator(const COMPARATOR& keyComparator);
     //   bool operator()(const KEY& lhs, const bslalg::RbTreeNode& rhs) const;
     //   bool operator()(const bslalg::RbTreeNode& rhs, const KEY& lhs) const;
+    //   bool operator()(const RbTreeNode& lhs, const RbTreeNode& rhs) const;
     // --------------------------------------------------------------------
 
     if (verbose)
@@ -527,6 +529,30 @@ void TestDriver<TYPE>::test3()
         ASSERTV(ncComp.keyComparator().numCalls(),
                 2 == ncComp.keyComparator().numCalls());
 
+        Node *n0Ptr = AllocTraits::allocate(allocator, 1);
+
+        Node& mN0 = *n0Ptr; const Node& N0 = mN0;
+        AllocTraits::construct(allocator, bsls::Util::addressOf(mN0.value()));
+
+        mN0.value() = bsltf::TemplateTestFacility::create<Key>(0);
+
+        ASSERTV(N0.value(), N1.value(), comp(N0, N1));
+        ASSERTV(comp.keyComparator().numCalls(),
+                3 == comp.keyComparator().numCalls());
+        ASSERTV(N1.value(), N0.value(), !comp(N1, N0));
+        ASSERTV(comp.keyComparator().numCalls(),
+                4 == comp.keyComparator().numCalls());
+        ASSERTV(N1.value(), !comp(N1, N1));
+
+        ASSERTV(N0.value(), N1.value(), ncComp(N0, N1));
+        ASSERTV(ncComp.keyComparator().numCalls(),
+                3 == ncComp.keyComparator().numCalls());
+        ASSERTV(N1.value(), N0.value(), !ncComp(N1, N0));
+        ASSERTV(ncComp.keyComparator().numCalls(),
+                4 == ncComp.keyComparator().numCalls());
+
+        AllocTraits::destroy(allocator, bsls::Util::addressOf(mN0.value()));
+        AllocTraits::deallocate(allocator, n0Ptr, 1);
         AllocTraits::destroy(allocator, bsls::Util::addressOf(mN1.value()));
         AllocTraits::deallocate(allocator, n1Ptr, 1);
     }
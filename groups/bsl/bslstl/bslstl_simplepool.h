@@ -11,6 +11,7 @@ BSLS_IDENT("$Id: $")
 //
 //@CLASSES:
 //  bslstl::SimplePool: memory manager that allocates memory blocks for a type
+//  bslstl::SimplePool_DetachedProctor: proctor for a detached memory block
 //
 //@SEE_ALSO: bslstl_treenodepool, bdema_pool
 //
@@ -42,6 +43,24 @@ BSLS_IDENT("$Id: $")
 // each time a chunk is allocated up to an implementation defined maximum
 // number of blocks.
 //
+///Detached Blocks
+///---------------
+// The memory of a pool is returned to the allocator only when the pool is
+// released (or destroyed), so a block allocated by 'allocate' cannot outlive
+// the pool.  A node-based container handing an element over to an owner that
+// may outlive the container (e.g., a node handle) therefore obtains a
+// *detached* block from 'allocateDetached': a block allocated in a chunk of
+// its own, which is not owned by the pool.  A detached block is returned to
+// the allocator by 'deallocateDetached', which needs only a copy of the
+// allocator of the pool (and not the pool itself).  Alternatively, a pool
+// whose allocator compares equal to the one that supplied a detached block
+// can take over the block by calling 'adoptDetached', which adds the chunk of
+// the block to the chunks of that pool without allocating memory, after which
+// the block is deallocated to that pool like any other block.  Note that a
+// detached block never keeps any other memory of a pool alive, and that a
+// pool adopting detached blocks only when it has no free blocks (see
+// 'hasFreeBlocks') never holds more blocks than it has had in use at once.
+//
 ///Comparison with 'bdema_Pool'
 ///----------------------------
 // There are a few differences between 'bslstl::SimplePool' and 'bdema_Pool':
@@ -327,6 +346,12 @@ class SimplePool : public SimplePool_Type<ALLOCATOR>::AllocatorType {
     SimplePool(const SimplePool&);
 
   private:
+    // PRIVATE CLASS METHODS
+    static size_type chunkLength(size_type size);
+        // Return the number of 'MaxAlignedType' objects needed for a chunk
+        // of memory having at least the specified 'size' number of usable
+        // bytes.
+
     // PRIVATE MANIPULATORS
     Block *allocateChunk(size_type size);
         // Allocate a chunk of memory with at least the specified 'size' number
@@ -339,6 +364,15 @@ class SimplePool : public SimplePool_Type<ALLOCATOR>::AllocatorType {
         // this pool.
 
   public:
+    // CLASS METHODS
+    static void deallocateDetached(void                 *address,
+                                   const AllocatorType&  allocator);
+        // Return the detached memory block at the specified 'address' (see
+        // {Detached Blocks}) to the specified 'allocator'.  The behavior is
+        // undefined unless 'address' was returned by 'allocateDetached' from a
+        // pool whose allocator compares equal to 'allocator', and has not been
+        // adopted or deallocated since.
+
     // CREATORS
     explicit SimplePool(const ALLOCATOR& allocator);
         // Create a memory pool that returns blocks of contiguous memory of the
@@ -361,6 +395,24 @@ class SimplePool : public SimplePool_Type<ALLOCATOR>::AllocatorType {
         // Return the address of a block of memory of at least the size of
         // 'VALUE'.  Note that the memory is *not* initialized.
 
+    VALUE *allocateDetached();
+        // Return the address of a block of memory of at least the size of
+        // 'VALUE', allocated from the allocator of this pool in a chunk of its
+        // own that is *not* owned by this pool (see {Detached Blocks}).  The
+        // block must be returned to the allocator by 'deallocateDetached', or
+        // taken over by a pool by 'adoptDetached'.  Note that the memory is
+        // *not* initialized.
+
+    void adoptDetached(void *address);
+        // Take over the ownership of the detached memory block at the
+        // specified 'address' (see {Detached Blocks}), so that the block is
+        // allocated from this pool, and may be deallocated to this pool.
+        // This method does not allocate memory, and provides the no-throw
+        // exception-safety guarantee.  The behavior is undefined unless
+        // 'address' was returned by 'allocateDetached' from a pool whose
+        // allocator compares equal to 'allocator()', and has not been adopted
+        // or deallocated since.
+
     void deallocate(void *address);
         // Relinquish the memory block at the specified 'address' back to this
         // pool object for reuse.  The behavior is undefined unless 'address'
@@ -376,6 +428,17 @@ class SimplePool : public SimplePool_Type<ALLOCATOR>::AllocatorType {
     void release();
         // Relinquish all memory currently allocated via this pool object.
 
+    void adopt(SimplePool& other);
+        // Take over the management of all the memory of the specified 'other'
+        // object, leaving 'other' with no memory, so that the blocks that
+        // were allocated from 'other' may be deallocated to this pool, and
+        // the free blocks of 'other' are available for allocation from this
+        // pool.  This method has no effect if 'other' is this object.  This
+        // operation takes time linear in the number of chunks and of free
+        // blocks of 'other', and provides the no-throw exception-safety
+        // guarantee.  The behavior is undefined unless
+        // 'allocator() == other.allocator()'.
+
     void swap(SimplePool& other);
         // Efficiently exchange the memory blocks of this object with those of
         // the specified 'other' object.  This method provides the no-throw
@@ -399,28 +462,79 @@ class SimplePool : public SimplePool_Type<ALLOCATOR>::AllocatorType {
         // allocator traits for the node-type.  Note that this operation
         // returns a base-class ('AllocatorType') reference to this object.
 
+    bool hasFreeBlocks() const;
+        // Return 'true' if this pool holds at least one free memory block, so
+        // that the next call to 'allocate' does not allocate memory from the
+        // allocator, and 'false' otherwise.
+
 
+};
+
+                     // ================================
+                     // class SimplePool_DetachedProctor
+                     // ================================
+
+template <class VALUE, class ALLOCATOR>
+class SimplePool_DetachedProctor {
+    // For use only by the node pools of 'bslstl'.  This class implements a
+    // proctor that, unless its 'release' method is called, returns a detached
+    // memory block (see {Detached Blocks}) allocated by a
+    // 'SimplePool<VALUE, ALLOCATOR>' to the allocator of that pool on
+    // destruction.
+
+    // DATA
+    void                         *d_address_p;  // detached block, or 0 if
+                                                // released
+
+    SimplePool<VALUE, ALLOCATOR> *d_pool_p;     // pool that allocated the
+                                                // block (held, not owned)
+
+  private:
+    // NOT IMPLEMENTED
+    SimplePool_DetachedProctor(const SimplePool_DetachedProctor&);
+    SimplePool_DetachedProctor& operator=(const SimplePool_DetachedProctor&);
+
+  public:
+    // CREATORS
+    SimplePool_DetachedProctor(void                         *address,
+                               SimplePool<VALUE, ALLOCATOR> *pool);
+        // Create a proctor for the detached memory block at the specified
+        // 'address', allocated by the specified 'pool'.
+
+    ~SimplePool_DetachedProctor();
+        // Return the block managed by this proctor, if any, to its allocator
+        // (see 'SimplePool::deallocateDetached'), and destroy this proctor.
+
+    // MANIPULATORS
+    void release();
+        // Release from management the block managed by this proctor, if any.
 };
 
 // ============================================================================
 //                  TEMPLATE AND INLINE FUNCTION DEFINITIONS
 // ============================================================================
 
-// PRIVATE MANIPULATORS
+// PRIVATE CLASS METHODS
 template <class VALUE, class ALLOCATOR>
-typename SimplePool<VALUE, ALLOCATOR>::Block *
-SimplePool<VALUE, ALLOCATOR>::allocateChunk(size_type size)
+inline
+typename SimplePool<VALUE, ALLOCATOR>::size_type
+SimplePool<VALUE, ALLOCATOR>::chunkLength(size_type size)
 {
     // Determine the number of bytes we want to allocate and compute the number
     // of 'MaxAlignedType' needed to contain those bytes.
 
     size_type numBytes = static_cast<size_type>(sizeof(Chunk)) + size;
-    size_type numMaxAlignedType =
-                       (numBytes + bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT - 1)
-                     / bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT;
+    return (numBytes + bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT - 1)
+                                     / bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT;
+}
 
+// PRIVATE MANIPULATORS
+template <class VALUE, class ALLOCATOR>
+typename SimplePool<VALUE, ALLOCATOR>::Block *
+SimplePool<VALUE, ALLOCATOR>::allocateChunk(size_type size)
+{
     Chunk *chunkPtr = reinterpret_cast<Chunk *>(
-                    AllocatorTraits::allocate(allocator(), numMaxAlignedType));
+                    AllocatorTraits::allocate(allocator(), chunkLength(size)));
 
     BSLS_ASSERT_SAFE(0 ==
              reinterpret_cast<bsls::Types::UintPtr>(chunkPtr) % sizeof(Chunk));
@@ -444,6 +558,23 @@ void SimplePool<VALUE, ALLOCATOR>::replenish()
     }
 }
 
+// CLASS METHODS
+template <class VALUE, class ALLOCATOR>
+inline
+void SimplePool<VALUE, ALLOCATOR>::deallocateDetached(
+                                               void                 *address,
+                                               const AllocatorType&  allocator)
+{
+    BSLS_ASSERT_SAFE(address);
+
+    AllocatorType chunkAllocator(allocator);
+    AllocatorTraits::deallocate(
+                      chunkAllocator,
+                      reinterpret_cast<typename AllocatorTraits::value_type *>(
+                                       reinterpret_cast<Chunk *>(address) - 1),
+                      chunkLength(static_cast<size_type>(sizeof(Block))));
+}
+
 // CREATORS
 template <class VALUE, class ALLOCATOR>
 inline
@@ -483,6 +614,32 @@ VALUE *SimplePool<VALUE, ALLOCATOR>::allocate()
     return block;
 }
 
+template <class VALUE, class ALLOCATOR>
+inline
+VALUE *SimplePool<VALUE, ALLOCATOR>::allocateDetached()
+{
+    size_type numMaxAlignedType =
+                           chunkLength(static_cast<size_type>(sizeof(Block)));
+
+    Chunk *chunkPtr = reinterpret_cast<Chunk *>(
+                    AllocatorTraits::allocate(allocator(), numMaxAlignedType));
+    chunkPtr->d_next_p = 0;
+
+    return reinterpret_cast<VALUE *>(chunkPtr + 1);
+}
+
+template <class VALUE, class ALLOCATOR>
+inline
+void SimplePool<VALUE, ALLOCATOR>::adoptDetached(void *address)
+{
+    BSLS_ASSERT_SAFE(address);
+
+    Chunk *chunkPtr = reinterpret_cast<Chunk *>(address) - 1;
+
+    chunkPtr->d_next_p = d_chunkList_p;
+    d_chunkList_p      = chunkPtr;
+}
+
 template <class VALUE, class ALLOCATOR>
 inline
 void SimplePool<VALUE, ALLOCATOR>::deallocate(void *address)
@@ -493,6 +650,42 @@ void SimplePool<VALUE, ALLOCATOR>::deallocate(void *address)
     d_freeList_p = reinterpret_cast<Block *>(address);
 }
 
+template <class VALUE, class ALLOCATOR>
+void SimplePool<VALUE, ALLOCATOR>::adopt(SimplePool<VALUE, ALLOCATOR>& other)
+{
+    BSLS_ASSERT_SAFE(allocator() == other.allocator());
+
+    if (this == &other || 0 == other.d_chunkList_p) {
+        return;                                                       // RETURN
+    }
+
+    // Splice the chunk list and the free list of 'other' in front of those of
+    // this pool.
+
+    Chunk *lastChunk = other.d_chunkList_p;
+    while (lastChunk->d_next_p) {
+        lastChunk = lastChunk->d_next_p;
+    }
+    lastChunk->d_next_p = d_chunkList_p;
+    d_chunkList_p       = other.d_chunkList_p;
+
+    if (other.d_freeList_p) {
+        Block *lastBlock = other.d_freeList_p;
+        while (lastBlock->d_next_p) {
+            lastBlock = lastBlock->d_next_p;
+        }
+        lastBlock->d_next_p = d_freeList_p;
+        d_freeList_p        = other.d_freeList_p;
+    }
+
+    if (d_blocksPerChunk < other.d_blocksPerChunk) {
+        d_blocksPerChunk = other.d_blocksPerChunk;
+    }
+
+    other.d_chunkList_p = 0;
+    other.d_freeList_p  = 0;
+}
+
 template <class VALUE, class ALLOCATOR>
 inline
 void SimplePool<VALUE, ALLOCATOR>::swap(SimplePool<VALUE, ALLOCATOR>& other)
@@ -548,6 +741,13 @@ SimplePool<VALUE, ALLOCATOR>::allocator() const
     return *this;
 }
 
+template <class VALUE, class ALLOCATOR>
+inline
+bool SimplePool<VALUE, ALLOCATOR>::hasFreeBlocks() const
+{
+    return 0 != d_freeList_p;
+}
+
 template <class VALUE, class ALLOCATOR>
 void SimplePool<VALUE, ALLOCATOR>::release()
 {
@@ -561,6 +761,42 @@ void SimplePool<VALUE, ALLOCATOR>::release()
     d_freeList_p = 0;
 }
 
+                     // --------------------------------
+                     // class SimplePool_DetachedProctor
+                     // --------------------------------
+
+// CREATORS
+template <class VALUE, class ALLOCATOR>
+inline
+SimplePool_DetachedProctor<VALUE, ALLOCATOR>::SimplePool_DetachedProctor(
+                                     void                         *address,
+                                     SimplePool<VALUE, ALLOCATOR> *pool)
+: d_address_p(address)
+, d_pool_p(pool)
+{
+    BSLS_ASSERT_SAFE(address);
+    BSLS_ASSERT_SAFE(pool);
+}
+
+template <class VALUE, class ALLOCATOR>
+inline
+SimplePool_DetachedProctor<VALUE, ALLOCATOR>::~SimplePool_DetachedProctor()
+{
+    if (d_address_p) {
+        SimplePool<VALUE, ALLOCATOR>::deallocateDetached(
+                                                        d_address_p,
+                                                        d_pool_p->allocator());
+    }
+}
+
+// MANIPULATORS
+template <class VALUE, class ALLOCATOR>
+inline
+void SimplePool_DetachedProctor<VALUE, ALLOCATOR>::release()
+{
+    d_address_p = 0;
+}
+
 }  // close namespace bslstl
 }  // close enterprise namespace
 
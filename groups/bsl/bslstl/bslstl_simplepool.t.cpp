@@ -42,20 +42,28 @@ using namespace bslstl;
 // [ 2] explicit SimplePool(const ALLOCATOR& allocator);
 // [ 2] ~SimplePool();
 
+// CLASS METHODS
+// [11] void deallocateDetached(void *, const AllocatorType&);
+//
 // MANIPULATORS
 // [ 4] AllocatorType& allocator();
 // [ 2] VALUE *allocate();
+// [11] VALUE *allocateDetached();
+// [11] void adoptDetached(void *address);
 // [ 5] void deallocate(void *address);
 // [ 6] void reserve(std::size_t numBlocks);
 // [ 7] void release();
 // [ 8] void swap(SimplePool<VALUE, ALLOCATOR>& other);
+// [10] void adopt(SimplePool<VALUE, ALLOCATOR>& other);
 //
 // ACCESSORS
 // [ 4] const AllocatorType& allocator() const;
+// [11] bool hasFreeBlocks() const;
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [10] USAGE EXAMPLE
+// [12] USAGE EXAMPLE
 // [ 9] CONCERN: Standard allocator can be used
+// [11] CONCERN: 'SimplePool_DetachedProctor' releases a detached block
 // [ 3] TEST APPARATUS
 
 //=============================================================================
@@ -258,9 +266,15 @@ class TestDriver {
 
   public:
     // TEST CASES
-    static void testCase10();
+    static void testCase12();
         // Test usage example.
 
+    static void testCase11();
+        // Test detached blocks.
+
+    static void testCase10();
+        // Test 'adopt' member.
+
     static void testCase9();
         // Test alignment concern.
 
@@ -343,6 +357,422 @@ void TestDriver<VALUE>::createFreeBlocks(Obj *result, int numBlocks)
     }
 }
 
+template<class VALUE>
+void TestDriver<VALUE>::testCase11()
+{
+    // ------------------------------------------------------------------------
+    // DETACHED BLOCKS
+    //
+    // Concerns:
+    //: 1 'allocateDetached' allocates exactly one chunk from the allocator,
+    //:   holding a correctly aligned block, and neither uses nor changes the
+    //:   free blocks of the pool.
+    //:
+    //: 2 A detached block remains valid after the pool that allocated it is
+    //:   destroyed, and 'deallocateDetached' returns its memory to the
+    //:   allocator.
+    //:
+    //: 3 'adoptDetached' does not allocate or deallocate memory, and the
+    //:   adopted block may then be deallocated to the adopting pool, which
+    //:   reuses it for its next allocation, and releases its memory when the
+    //:   pool is released.
+    //:
+    //: 4 'SimplePool_DetachedProctor' returns the block it manages to the
+    //:   allocator on destruction, unless 'release' has been called.
+    //:
+    //: 5 'hasFreeBlocks' returns 'true' exactly when the pool has a free
+    //:   block.
+    //:
+    //: 6 No memory is allocated from the default allocator.
+    //
+    // Plan:
+    //: 1 Using a table-based approach, for pools of which memory has been
+    //:   allocated and deallocated various number of times:
+    //:
+    //:   1 Allocate a detached block, verify its alignment and the memory
+    //:     allocated, and verify that the next blocks allocated from the pool
+    //:     are its free blocks, and the value of 'hasFreeBlocks' as each free
+    //:     block is allocated.  (C-1, 5)
+    //:
+    //:   2 Destroy the pool, write to the detached block, and return it with
+    //:     'deallocateDetached'.  Verify that no memory is in use.  (C-2)
+    //:
+    //:   3 Allocate a detached block from another pool, and make the pool
+    //:     adopt it.  Verify that no memory is allocated or deallocated,
+    //:     deallocate the block to the pool, and verify that it is the next
+    //:     block allocated.  Release the pool, and verify that no memory is in
+    //:     use.  (C-3)
+    //:
+    //: 2 Create a proctor for a detached block, and verify that the block is
+    //:   deallocated when the proctor is destroyed.  Repeat, calling
+    //:   'release', and verify that the block is not deallocated.  (C-4)
+    //:
+    //: 3 Verify that the default allocator was not used.  (C-6)
+    //
+    // Testing:
+    //   void deallocateDetached(void *, const AllocatorType&);
+    //   VALUE *allocateDetached();
+    //   void adoptDetached(void *address);
+    //   bool hasFreeBlocks() const;
+    //   CONCERN: 'SimplePool_DetachedProctor' releases a detached block
+    // ------------------------------------------------------------------------
+
+    typedef bslstl::SimplePool_DetachedProctor<VALUE, bsl::allocator<VALUE> >
+                                                                   Proctor;
+
+    bslma::TestAllocator         da("default", veryVeryVeryVerbose);
+    bslma::DefaultAllocatorGuard dag(&da);
+
+    struct {
+        int d_line;
+        int d_numAlloc;
+        int d_numDealloc;
+    } DATA[] = {
+
+    //LINE  ALLOC  DEALLOC
+    //----  -----  -------
+
+    { L_,       0,       0 },
+    { L_,       1,       0 },
+    { L_,       1,       1 },
+    { L_,       2,       1 },
+    { L_,       3,       2 },
+    { L_,       7,       3 },
+    { L_,      40,      20 }
+
+    };
+    int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+    for (int ti = 0; ti < NUM_DATA; ++ti) {
+        const int LINE     = DATA[ti].d_line;
+        const int ALLOCS   = DATA[ti].d_numAlloc;
+        const int DEALLOCS = DATA[ti].d_numDealloc;
+
+        if (veryVerbose) { T_ P_(LINE) P_(ALLOCS) P(DEALLOCS) }
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        VALUE *detached;
+        {
+            Stack usedX;
+            Stack freeX;
+            Obj mX(&oa);  const Obj& X = mX;
+            init(&mX, &usedX, &freeX, ALLOCS, DEALLOCS);
+
+            bslma::TestAllocatorMonitor oam(&oa);
+
+            detached = mX.allocateDetached();
+
+            ASSERTV(LINE, 1 == oam.numBlocksTotalChange());
+            ASSERTV(LINE, 1 == oam.numBlocksInUseChange());
+            ASSERTV(LINE, &oa == X.allocator());
+
+            std::size_t address = reinterpret_cast<std::size_t>(detached);
+            ASSERTV(LINE,
+                    0 == address % bsls::AlignmentFromType<VALUE>::VALUE);
+
+            // Verify the free blocks of the pool are still allocated first.
+
+            oam.reset();
+
+            while (!freeX.empty()) {
+                ASSERTV(LINE, X.hasFreeBlocks());
+
+                VALUE *ptr = mX.allocate();
+                ASSERTV(LINE, freeX.top() == ptr);
+                ASSERTV(LINE, detached    != ptr);
+                freeX.pop();
+            }
+            ASSERTV(LINE, oam.isTotalSame());
+
+            // 'ALLOCS' blocks are now in use, and the pool has no free block
+            // exactly if it would allocate a chunk for the next block.
+
+            ASSERTV(LINE, expectToAllocate(ALLOCS + 1) == !X.hasFreeBlocks());
+        }
+
+        // The pool is destroyed, and only the detached block is in use.
+
+        ASSERTV(LINE, oa.numBlocksInUse(), 1 == oa.numBlocksInUse());
+
+        memset(detached, 0xA5, sizeof(VALUE));
+
+        Obj::deallocateDetached(detached,
+                                typename Obj::AllocatorType(&oa));
+        ASSERTV(LINE, oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+
+        if (veryVerbose) printf("\t'adoptDetached'\n");
+        {
+            Stack usedX;
+            Stack freeX;
+            Obj mX(&oa);  const Obj& X = mX;
+            init(&mX, &usedX, &freeX, ALLOCS, DEALLOCS);
+
+            VALUE *block;
+            {
+                Obj mY(&oa);
+                block = mY.allocateDetached();
+            }
+
+            bslma::TestAllocatorMonitor oam(&oa);
+
+            mX.adoptDetached(block);
+
+            ASSERTV(LINE, oam.isTotalSame());
+            ASSERTV(LINE, oam.isInUseSame());
+
+            mX.deallocate(block);
+            ASSERTV(LINE, X.hasFreeBlocks());
+            ASSERTV(LINE, block == mX.allocate());
+            ASSERTV(LINE, oam.isTotalSame());
+
+            mX.release();
+            ASSERTV(LINE, oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+        }
+    }
+
+    if (verbose) printf("\n'SimplePool_DetachedProctor'\n");
+    {
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        Obj mX(&oa);
+        {
+            Proctor proctor(mX.allocateDetached(), &mX);
+            ASSERTV(oa.numBlocksInUse(), 1 == oa.numBlocksInUse());
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+
+        VALUE *detached = mX.allocateDetached();
+        {
+            Proctor proctor(detached, &mX);
+            proctor.release();
+        }
+        ASSERTV(oa.numBlocksInUse(), 1 == oa.numBlocksInUse());
+
+        Obj::deallocateDetached(detached, mX.allocator());
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+    }
+
+    // Verify no memory is allocated from the default allocator.
+
+    ASSERTV(da.numBlocksTotal(), 0 == da.numBlocksTotal());
+}
+
+template<class VALUE>
+void TestDriver<VALUE>::testCase10()
+{
+    // ------------------------------------------------------------------------
+    // MANIPULATOR 'adopt'
+    //
+    // Concerns:
+    //: 1 The free blocks of the adopted object are available for allocation
+    //:   from the adopting object, before its own free blocks.
+    //:
+    //: 2 The adopted object is left with no memory, so that it allocates a
+    //:   new chunk on its next allocation.
+    //:
+    //: 3 The blocks allocated from the adopted object may be deallocated to
+    //:   the adopting object, and their memory is not released when the
+    //:   adopted object is destroyed.
+    //:
+    //: 4 No memory is allocated or deallocated by 'adopt'.
+    //:
+    //: 5 All the memory of both objects is released when the adopting object
+    //:   is destroyed.
+    //:
+    //: 6 Adopting an object by itself has no effect (alias-safety).
+    //:
+    //: 7 QoI: Asserted precondition violations are detected when enabled.
+    //
+    // Plan:
+    //: 1 Using a table-based approach:
+    //:
+    //:   1 Create two objects of which memory has been allocated and
+    //:     deallocated various number of times.
+    //:
+    //:   2 Make the first object adopt the second one, and verify that no
+    //:     memory is allocated or deallocated.  (C-4)
+    //:
+    //:   3 Allocate from the first object and verify the addresses of the
+    //:     allocated blocks against the free blocks of both objects.  (C-1)
+    //:
+    //:   4 Verify that the next allocation from the second object allocates
+    //:     memory, destroy the second object, and verify that the memory of
+    //:     the blocks it had allocated before adoption is not released.
+    //:     Deallocate these blocks to the first object.  (C-2..3)
+    //:
+    //:   5 Destroy the first object, and verify that no memory is in use.
+    //:     (C-5)
+    //:
+    //:   6 Make an object adopt itself and verify the object is unchanged.
+    //:     (C-6)
+    //:
+    //: 2 Verify that, in appropriate build modes, defensive checks are
+    //:   triggered (using the 'BSLS_ASSERTTEST_*' macros).  (C-7)
+    //
+    // Testing:
+    //   void adopt(SimplePool<VALUE, ALLOCATOR>& other);
+    // ------------------------------------------------------------------------
+
+    bslma::TestAllocator         da("default", veryVeryVeryVerbose);
+    bslma::DefaultAllocatorGuard dag(&da);
+
+    struct {
+        int d_line;
+        int d_numAlloc;
+        int d_numDealloc;
+    } DATA[] = {
+
+    //LINE  ALLOC  DEALLOC
+    //----  -----  -------
+
+    { L_,       0,       0 },
+    { L_,       1,       0 },
+    { L_,       1,       1 },
+    { L_,       2,       1 },
+    { L_,       3,       0 },
+    { L_,       3,       2 },
+    { L_,       4,       4 },
+    { L_,       7,       3 },
+    { L_,      40,      20 }
+
+    };
+    int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+    for (int ti = 0; ti < NUM_DATA; ++ti) {
+        const int LINE1     = DATA[ti].d_line;
+        const int ALLOCS1   = DATA[ti].d_numAlloc;
+        const int DEALLOCS1 = DATA[ti].d_numDealloc;
+
+        for (int tj = 0; tj < NUM_DATA; ++tj) {
+            const int LINE2     = DATA[tj].d_line;
+            const int ALLOCS2   = DATA[tj].d_numAlloc;
+            const int DEALLOCS2 = DATA[tj].d_numDealloc;
+
+            if (veryVerbose) { T_ P_(LINE1) P(LINE2) }
+
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+            {
+                Stack usedX;
+                Stack freeX;
+                Obj mX(&oa);
+                const Obj& X = init(&mX, &usedX, &freeX, ALLOCS1, DEALLOCS1);
+
+                Stack usedY;
+                Stack freeY;
+                {
+                    Obj mY(&oa);
+                    init(&mY, &usedY, &freeY, ALLOCS2, DEALLOCS2);
+
+                    bslma::TestAllocatorMonitor oam(&oa);
+
+                    mX.adopt(mY);
+
+                    ASSERTV(LINE1, LINE2, &oa == X.allocator());
+                    ASSERTV(LINE1, LINE2, oam.isTotalSame());
+                    ASSERTV(LINE1, LINE2, oam.isInUseSame());
+
+                    // Verify the blocks deallocated to 'Y' are allocated
+                    // first from 'X', and that the free blocks of both
+                    // objects are available without allocating memory.
+
+                    while (!freeY.empty()) {
+                        VALUE *ptr = mX.allocate();
+                        ASSERTV(LINE1, LINE2, freeY.top() == ptr);
+                        freeY.pop();
+                        usedY.push(ptr);
+                    }
+
+                    while (!freeX.empty()) {
+                        usedX.push(mX.allocate());
+                        freeX.pop();
+                    }
+                    ASSERTV(LINE1, LINE2, oam.isTotalSame());
+
+                    // Verify 'Y' has no memory left.
+
+                    mY.allocate();
+                    ASSERTV(LINE1, LINE2, oam.isTotalUp());
+                }
+
+                // 'Y' is now destroyed, and only its newly allocated chunk
+                // should be deallocated.  Verify the blocks it allocated
+                // before being adopted are not scribbled, and return them to
+                // 'X'.
+
+                char SCRIBBLED_MEMORY[sizeof(VALUE)];
+                memset(SCRIBBLED_MEMORY, 0xA5, sizeof(VALUE));
+                while (!usedY.empty()) {
+                    char *ptr = (char *)usedY.top();
+                    ASSERTV(LINE1,
+                            LINE2,
+                            0 != strncmp(ptr,
+                                         SCRIBBLED_MEMORY,
+                                         sizeof(VALUE)));
+                    mX.deallocate(ptr);
+                    usedY.pop();
+                }
+            }
+
+            ASSERTV(LINE1, LINE2, oa.numBlocksInUse(),
+                    0 == oa.numBlocksInUse());
+        }
+
+        if (veryVerbose) printf("Test alias safety");
+        {
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+            Stack usedX;
+            Stack freeX;
+            Obj mZ(&oa);
+            init(&mZ, &usedX, &freeX, ALLOCS1, DEALLOCS1);
+            Obj& mX = mZ;  const Obj& X = mX;
+
+            if (veryVerbose) { T_ P(LINE1) }
+
+            bslma::TestAllocatorMonitor oam(&oa);
+
+            mX.adopt(mZ);
+
+            ASSERTV(LINE1, &oa == X.allocator());
+            ASSERTV(LINE1, oam.isTotalSame());
+            ASSERTV(LINE1, oam.isInUseSame());
+
+            // Verify the free list have not change
+
+            while(!freeX.empty()) {
+                VALUE *ptr = mX.allocate();
+                ASSERTV(LINE1, freeX.top() == ptr);
+                freeX.pop();
+                usedX.push(ptr);
+            }
+            ASSERTV(LINE1, oam.isTotalSame());
+        }
+    }
+
+    // Verify no memory is allocated from the default allocator.
+
+    ASSERTV(da.numBlocksTotal(), 0 == da.numBlocksTotal());
+
+    if (verbose) printf("\nNegative Testing.\n");
+    {
+        bsls::AssertFailureHandlerGuard hG(bsls::AssertTest::failTestDriver);
+
+        if (veryVerbose) printf("\t'adopt' member function\n");
+        {
+            bslma::TestAllocator oa1("object1", veryVeryVeryVerbose);
+            bslma::TestAllocator oa2("object2", veryVeryVeryVerbose);
+
+            Obj mA(&oa1);  Obj mB(&oa1);
+            Obj mZ(&oa2);
+
+            ASSERT_SAFE_PASS(mA.adopt(mB));
+            ASSERT_SAFE_FAIL(mA.adopt(mZ));
+        }
+    }
+}
+
 template<class VALUE>
 void TestDriver<VALUE>::testCase9()
 {
@@ -1266,7 +1696,7 @@ int main(int argc, char *argv[])
     printf("TEST " __FILE__ " CASE %d\n", test);
 
     switch (test) { case 0:
-      case 10: {
+      case 12: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -1312,6 +1742,12 @@ int main(int argc, char *argv[])
 //..
 
       } break;
+      case 11: {
+          RUN_EACH_TYPE(TestDriver, testCase11, TEST_TYPES);
+      } break;
+      case 10: {
+          RUN_EACH_TYPE(TestDriver, testCase10, TEST_TYPES);
+      } break;
       case 9: {
         // --------------------------------------------------------------------
         // ALIGNMENT TEST
@@ -0,0 +1,2538 @@
+// bslstl_smallvector.h                                               -*-C++-*-
+#ifndef INCLUDED_BSLSTL_SMALLVECTOR
+#define INCLUDED_BSLSTL_SMALLVECTOR
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a vector that stores a few elements without allocating.
+//
+//@CLASSES:
+//  bsl::small_vector: vector-like container having inline storage
+//
+//@SEE_ALSO: bslstl_vector, bslalg_arrayprimitives
+//
+//@DESCRIPTION: This component defines a single class template,
+// 'small_vector', implementing a sequential container holding a dynamic array
+// of values of a template parameter type, with the interface of 'bsl::vector'.
+// Unlike 'bsl::vector', a 'small_vector' has a buffer, within its footprint,
+// large enough to hold the number of elements specified by its
+// 'INLINE_CAPACITY' template parameter.  The elements are stored in that
+// buffer while they fit, and memory is obtained from the allocator only when
+// the size of the container first exceeds 'INLINE_CAPACITY'.  A container
+// that usually holds only a few elements (e.g., a field of a message object)
+// therefore never allocates, and is not subject to the cost of the allocator,
+// nor to the indirection from the footprint of the object to its elements.
+//
+// Once the elements have been moved to allocated memory, they stay there
+// (like those of a 'bsl::vector', the capacity of a 'small_vector' never
+// decreases) until 'shrink_to_fit' is called, which moves them back into the
+// inline buffer if they fit.  The 'is_inline' accessor reports where the
+// elements are currently stored.
+//
+// The elements are constructed, moved, and destroyed by the
+// 'bslalg::ArrayPrimitives' utilities that implement 'bsl::vector', so that
+// elements of a bitwise-moveable type are relocated using 'memcpy', and
+// elements of a type that uses 'bslma' allocators are supplied the allocator
+// of the container.
+//
+///Memory Allocation
+///-----------------
+// The type supplied as the 'ALLOCATOR' template parameter determines how a
+// 'small_vector' allocates memory once its elements do not fit in its inline
+// buffer, and the allocator is propagated exactly as for 'bsl::vector': a
+// 'small_vector' instantiated with the default 'bsl::allocator' accepts an
+// optional 'bslma::Allocator' at construction, which is used by the container
+// throughout its lifetime (or the default allocator, if none is supplied),
+// and which is supplied to the constructors of elements of a type that uses
+// 'bslma' allocators.  In particular, neither copy construction nor
+// assignment propagates the allocator of the source object, and 'swap'
+// exchanges the values, but not the allocators, of two containers.
+//
+///Differences From 'bsl::vector'
+///------------------------------
+// Because the elements of a 'small_vector' may be stored within its
+// footprint:
+//
+//: o 'small_vector' is *not* bitwise moveable, even if 'VALUE_TYPE' is.
+//:
+//: o The footprint of a 'small_vector' includes
+//:   'INLINE_CAPACITY * sizeof(VALUE_TYPE)' bytes of storage.
+//:
+//: o 'swap' is constant-time only if both containers use the same allocator
+//:   and neither stores its elements inline; otherwise, the elements stored
+//:   inline are moved (using 'memcpy' for bitwise-moveable elements).  If a
+//:   'VALUE_TYPE' copy constructor throws during such a move, the values of
+//:   both containers are valid but unspecified.
+//:
+//: o Iterators, pointers, and references to the elements are invalidated by
+//:   'swap' and by 'shrink_to_fit'.
+//
+///Operations
+///----------
+// The operations of 'small_vector' have the same complexity as those of
+// 'bsl::vector' (see 'bslstl_vector'), except that 'swap' is linear in the
+// number of elements stored inline.
+//
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: A Field That Rarely Holds More Than a Few Values
+///- - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that each message processed by our application carries a list of
+// routing hops, which almost never has more than four entries.
+//
+// First, we define the list as a 'small_vector' having an inline capacity of
+// 4:
+//..
+//  typedef bsl::small_vector<int, 4> HopList;
+//..
+// Then, we create a list and append four hops, observing that no memory is
+// obtained from the allocator:
+//..
+//  bslma::TestAllocator oa;
+//  HopList              hops(&oa);
+
+//  hops.push_back(101);
+//  hops.push_back(102);
+//  hops.push_back(103);
+//  hops.push_back(104);
+
+//  assert(4 == hops.size());
+//  assert(hops.is_inline());
+//  assert(0 == oa.numAllocations());
+//..
+// Next, we append a fifth hop, which causes the elements to be moved to memory
+// obtained from the allocator:
+//..
+//  hops.push_back(105);
+
+//  assert(5   == hops.size());
+//  assert(!hops.is_inline());
+//  assert(1   == oa.numAllocations());
+//  assert(101 == hops.front());
+//  assert(105 == hops.back());
+//..
+// Finally, we erase a hop and return the remaining ones to the inline buffer:
+//..
+//  hops.erase(hops.begin());
+//  hops.shrink_to_fit();
+
+//  assert(4 == hops.size());
+//  assert(hops.is_inline());
+//  assert(0 == oa.numBytesInUse());
+//..
+
+#ifndef INCLUDED_BSLSCM_VERSION
+#include <bslscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_ALLOCATOR
+#include <bslstl_allocator.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_ITERATOR
+#include <bslstl_iterator.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_STDEXCEPTUTIL
+#include <bslstl_stdexceptutil.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_VECTOR
+#include <bslstl_vector.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_ARRAYDESTRUCTIONPRIMITIVES
+#include <bslalg_arraydestructionprimitives.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_ARRAYPRIMITIVES
+#include <bslalg_arrayprimitives.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_AUTOARRAYDESTRUCTOR
+#include <bslalg_autoarraydestructor.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_CONTAINERBASE
+#include <bslalg_containerbase.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_RANGECOMPARE
+#include <bslalg_rangecompare.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_SCALARDESTRUCTIONPRIMITIVES
+#include <bslalg_scalardestructionprimitives.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_SCALARPRIMITIVES
+#include <bslalg_scalarprimitives.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_SWAPUTIL
+#include <bslalg_swaputil.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_TYPETRAITHASSTLITERATORS
+#include <bslalg_typetraithasstliterators.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_USESBSLMAALLOCATOR
+#include <bslma_usesbslmaallocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_ASSERT
+#include <bslmf_assert.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_ISCONVERTIBLE
+#include <bslmf_isconvertible.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_MATCHANYTYPE
+#include <bslmf_matchanytype.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_MATCHARITHMETICTYPE
+#include <bslmf_matcharithmetictype.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_NIL
+#include <bslmf_nil.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ALIGNEDBUFFER
+#include <bsls_alignedbuffer.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ALIGNMENTFROMTYPE
+#include <bsls_alignmentfromtype.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_BSLS_COMPILERFEATURES
+#include <bsls_compilerfeatures.h>
+#endif
+
+#ifndef INCLUDED_BSLS_PERFORMANCEHINT
+#include <bsls_performancehint.h>
+#endif
+
+#ifndef INCLUDED_CSTDDEF
+#include <cstddef>
+#define INCLUDED_CSTDDEF
+#endif
+
+namespace bsl {
+
+                            // ==================
+                            // class small_vector
+                            // ==================
+
+template <class VALUE_TYPE,
+          std::size_t INLINE_CAPACITY,
+          class ALLOCATOR = bsl::allocator<VALUE_TYPE> >
+class small_vector : private BloombergLP::bslalg::ContainerBase<ALLOCATOR> {
+    // This class template provides a container having the interface of
+    // 'bsl::vector' that stores up to 'INLINE_CAPACITY' elements within its
+    // footprint, obtaining memory from its allocator only for larger sizes.
+    // The exception-safety guarantees of the methods are those of the
+    // corresponding methods of 'bsl::vector', except as noted.  Note that
+    // *aliasing* (e.g., using all or part of an object as both source and
+    // destination) is supported for 'push_back' and for 'insert' of a single
+    // value, as for 'bsl::vector'.
+
+    BSLMF_ASSERT(0 < INLINE_CAPACITY);
+
+  public:
+    // PUBLIC TYPES
+    typedef typename ALLOCATOR::reference          reference;
+    typedef typename ALLOCATOR::const_reference    const_reference;
+    typedef VALUE_TYPE                            *iterator;
+    typedef VALUE_TYPE const                      *const_iterator;
+    typedef std::size_t                            size_type;
+    typedef std::ptrdiff_t                         difference_type;
+    typedef VALUE_TYPE                             value_type;
+    typedef ALLOCATOR                              allocator_type;
+    typedef typename ALLOCATOR::pointer            pointer;
+    typedef typename ALLOCATOR::const_pointer      const_pointer;
+    typedef bsl::reverse_iterator<iterator>        reverse_iterator;
+    typedef bsl::reverse_iterator<const_iterator>  const_reverse_iterator;
+
+  private:
+    // PRIVATE TYPES
+    typedef BloombergLP::bslalg::ContainerBase<ALLOCATOR> ContainerBase;
+        // Container base type, containing the allocator and applying empty
+        // base class optimization (EBO) whenever appropriate.
+
+    typedef BloombergLP::bsls::AlignedBuffer<
+                  static_cast<int>(sizeof(VALUE_TYPE) * INLINE_CAPACITY),
+                  BloombergLP::bsls::AlignmentFromType<VALUE_TYPE>::VALUE>
+                                                                  InlineBuffer;
+        // Storage for the elements held within the footprint.
+
+    class Guard {
+        // This class provides a proctor for deallocating an array of
+        // 'VALUE_TYPE' objects obtained from the allocator of a
+        // 'small_vector'.
+
+        // DATA
+        VALUE_TYPE    *d_data_p;       // array pointer
+        std::size_t    d_capacity;     // capacity of the array
+        ContainerBase *d_container_p;  // container base pointer
+
+      public:
+        // CREATORS
+        Guard(VALUE_TYPE    *data,
+              std::size_t    capacity,
+              ContainerBase *container);
+            // Create a proctor for the specified 'data' array of the specified
+            // 'capacity', using the 'deallocateN' method of the specified
+            // 'container' to return 'data' to its allocator upon destruction,
+            // unless this proctor's 'release' is called prior.
+
+        ~Guard();
+            // Destroy this proctor, deallocating any data under management.
+
+        // MANIPULATORS
+        void release();
+            // Release the data from management by this proctor.
+    };
+
+    class Proctor {
+        // This class provides a proctor for destroying the elements of, and
+        // deallocating the memory held by, a partially constructed
+        // 'small_vector', to be used in the 'small_vector' constructors.
+
+        // DATA
+        small_vector *d_object_p;  // managed object, or 0 if released
+
+      public:
+        // CREATORS
+        explicit Proctor(small_vector *object);
+            // Create a proctor managing the specified 'object'.
+
+        ~Proctor();
+            // Destroy this proctor, destroying the elements of the managed
+            // object and deallocating its memory, unless 'release' has been
+            // called.
+
+        // MANIPULATORS
+        void release();
+            // Release the object from management by this proctor.
+    };
+
+    // DATA
+    VALUE_TYPE   *d_dataBegin;  // first element, either in 'd_buffer' or in
+                                // memory obtained from the allocator
+
+    VALUE_TYPE   *d_dataEnd;    // one past the last element
+
+    std::size_t   d_capacity;   // 'INLINE_CAPACITY' if the elements are
+                                // stored in 'd_buffer', and the length of
+                                // the allocated array otherwise
+
+    InlineBuffer  d_buffer;     // inline storage
+
+    // PRIVATE MANIPULATORS
+    VALUE_TYPE *inlineData();
+        // Return the address of the inline buffer of this object.
+
+    void privateAdopt(VALUE_TYPE *data, size_type capacity);
+        // Deallocate the memory held by this object, if any, and store
+        // elements in the specified 'data' array, having the specified
+        // 'capacity', which was obtained from the allocator of this object.
+        // The behavior is undefined unless this object holds no elements.
+        // Note that 'd_dataEnd' is set to 'data'.
+
+    void privateDestroy();
+        // Destroy the elements of this object and deallocate its memory, if
+        // any, leaving this object in an invalid state.
+
+    template <class INPUT_ITER>
+    void privateInsertDispatch(
+                              const_iterator                          position,
+                              INPUT_ITER                              count,
+                              INPUT_ITER                              value,
+                              BloombergLP::bslmf::MatchArithmeticType ,
+                              BloombergLP::bslmf::Nil                 );
+        // Match integral type for 'INPUT_ITER'.
+
+    template <class INPUT_ITER>
+    void privateInsertDispatch(const_iterator              position,
+                               INPUT_ITER                  first,
+                               INPUT_ITER                  last,
+                               BloombergLP::bslmf::MatchAnyType ,
+                               BloombergLP::bslmf::MatchAnyType );
+        // Match non-integral type for 'INPUT_ITER'.
+
+    template <class INPUT_ITER>
+    void privateInsert(const_iterator position,
+                       INPUT_ITER     first,
+                       INPUT_ITER     last,
+                       const          std::input_iterator_tag&);
+        // Specialized insertion for input iterators.
+
+    template <class FWD_ITER>
+    void privateInsert(const_iterator position,
+                       FWD_ITER       first,
+                       FWD_ITER       last,
+                       const          std::forward_iterator_tag&);
+        // Specialized insertion for forward, bidirectional, and random-access
+        // iterators.
+
+    void privateMoveAround(VALUE_TYPE *data,
+                           size_type   capacity,
+                           size_type   index);
+        // Move the elements of this object into the specified 'data' array,
+        // having the specified 'capacity', which was obtained from the
+        // allocator of this object and holds an element at the specified
+        // 'index', placing the elements before and after 'index' around that
+        // element, and adopt 'data' as the storage of this object.  If an
+        // exception is thrown, the element at 'index' is destroyed, 'data' is
+        // not adopted, and this object holds the elements preceding 'index'.
+
+    void privateMoveFrom(small_vector *original);
+        // Move the elements of the specified 'original' object into this
+        // object, taking ownership of the memory of 'original' if it does
+        // not store its elements inline, and leave 'original' empty.  The
+        // behavior is undefined unless this object is empty, stores its
+        // elements inline, and uses the same allocator as 'original'.
+
+    size_type privateNewCapacity(size_type   numElements,
+                                 const char *message) const;
+        // Return the capacity to allocate for this object to hold the
+        // specified 'numElements' more elements than it does.  Throw
+        // 'std::length_error' with the specified 'message' if the resulting
+        // size would exceed 'max_size()'.
+
+  public:
+    // CREATORS
+    explicit
+    small_vector(const ALLOCATOR& basicAllocator = ALLOCATOR());
+        // Create an empty vector.  Optionally specify the 'basicAllocator'
+        // used to supply memory.  If 'basicAllocator' is not specified, a
+        // default-constructed allocator is used.  Note that no memory is
+        // allocated.
+
+    explicit
+    small_vector(size_type        initialSize,
+                 const ALLOCATOR& basicAllocator = ALLOCATOR());
+        // Create a vector of the specified 'initialSize' whose every element
+        // is default-constructed.  Optionally specify the 'basicAllocator'
+        // used to supply memory.  If 'basicAllocator' is not specified, a
+        // default-constructed allocator is used.  Throw 'std::length_error' if
+        // 'initialSize > max_size()'.
+
+    small_vector(size_type         initialSize,
+                 const VALUE_TYPE& value,
+                 const ALLOCATOR&  basicAllocator = ALLOCATOR());
+        // Create a vector of the specified 'initialSize' whose every element
+        // equals the specified 'value'.  Optionally specify the
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is not
+        // specified, a default-constructed allocator is used.  Throw
+        // 'std::length_error' if 'initialSize > max_size()'.
+
+    template <class INPUT_ITER>
+    small_vector(INPUT_ITER       first,
+                 INPUT_ITER       last,
+                 const ALLOCATOR& basicAllocator = ALLOCATOR());
+        // Create a vector initially containing copies of the values in the
+        // range starting at the specified 'first' and ending immediately
+        // before the specified 'last' iterators of the (template parameter)
+        // 'INPUT_ITER' type.  Optionally specify the 'basicAllocator' used to
+        // supply memory.  If 'basicAllocator' is not specified, a
+        // default-constructed allocator is used.
+
+    small_vector(const small_vector& original);
+    small_vector(const small_vector& original,
+                 const ALLOCATOR&    basicAllocator);
+        // Create a vector that has the same value as the specified 'original'
+        // vector.  Optionally specify the 'basicAllocator' used to supply
+        // memory.  If 'basicAllocator' is not specified, then if 'ALLOCATOR'
+        // is convertible from 'bslma::Allocator *', the currently installed
+        // default allocator is used, otherwise the 'original' allocator is
+        // used (as for 'bsl::vector').
+
+    ~small_vector();
+        // Destroy this vector.
+
+    // MANIPULATORS
+    small_vector& operator=(const small_vector& rhs);
+        // Assign to this vector the value of the specified 'rhs' vector and
+        // return a reference to this modifiable vector.  Note that the
+        // allocator of 'rhs' is not propagated.
+
+    template <class INPUT_ITER>
+    void assign(INPUT_ITER first, INPUT_ITER last);
+        // Assign to this vector the values in the range starting at the
+        // specified 'first' and ending immediately before the specified 'last'
+        // iterators of the (template parameter) 'INPUT_ITER' type.
+
+    void assign(size_type numElements, const VALUE_TYPE& value);
+        // Assign to this vector the specified 'numElements' copies of the
+        // specified 'value'.
+
+                             // *** iterators: ***
+
+    iterator begin();
+        // Return an iterator pointing the first element in this modifiable
+        // vector (or the past-the-end iterator if this vector is empty).
+
+    iterator end();
+        // Return the past-the-end iterator for this modifiable vector.
+
+    reverse_iterator rbegin();
+        // Return a reverse iterator pointing the last element in this
+        // modifiable vector (or the past-the-end reverse iterator if this
+        // vector is empty).
+
+    reverse_iterator rend();
+        // Return the past-the-end reverse iterator for this modifiable vector.
+
+                          // *** element access: ***
+
+    reference operator[](size_type position);
+        // Return a reference to the modifiable element at the specified
+        // 'position' in this vector.  The behavior is undefined unless
+        // 'position < size()'.
+
+    reference at(size_type position);
+        // Return a reference to the modifiable element at the specified
+        // 'position' in this vector.  Throw 'std::out_of_range' if
+        // 'position >= size()'.
+
+    reference front();
+        // Return a reference to the modifiable first element in this vector.
+        // The behavior is undefined if this vector is empty.
+
+    reference back();
+        // Return a reference to the modifiable last element in this vector.
+        // The behavior is undefined if this vector is empty.
+
+    VALUE_TYPE *data();
+        // Return the address of the modifiable first element in this vector,
+        // or a valid, but non-dereferenceable pointer value if this vector is
+        // empty.
+
+                             // *** capacity: ***
+
+    void resize(size_type newSize);
+    void resize(size_type newSize, const VALUE_TYPE& value);
+        // Change the size of this vector to the specified 'newSize', erasing
+        // elements at the end if 'newSize < size()' or appending the
+        // appropriate number of copies of the optionally specified 'value' at
+        // the end if 'size() < newSize'.  If 'value' is not specified,
+        // default-constructed elements are appended.  Throw
+        // 'std::length_error' if 'newSize > max_size()'.
+
+    void reserve(size_type newCapacity);
+        // Change the capacity of this vector to at least the specified
+        // 'newCapacity'.  Throw 'std::length_error' if
+        // 'newCapacity > max_size()'.  Note that memory is allocated only if
+        // 'capacity() < newCapacity'.
+
+    void shrink_to_fit();
+        // Reduce the capacity of this vector to the larger of its size and
+        // 'INLINE_CAPACITY', moving the elements back into the inline buffer
+        // if they fit.
+
+                             // *** modifiers: ***
+
+#if !BSLS_COMPILERFEATURES_SIMULATE_CPP11_FEATURES
+    template <class... Args> void emplace_back(Args&&... args);
+        // Append a new element to the end of this vector, constructed in
+        // place from the specified 'args'.  This method provides the strong
+        // exception safety guarantee.
+
+#elif BSLS_COMPILERFEATURES_SIMULATE_VARIADIC_TEMPLATES
+// {{{ BEGIN GENERATED CODE
+// The following section is automatically generated.  **DO NOT EDIT**
+// Generator command line: sim_cpp11_features.pl --var-args=5 bslstl_smallvector.h
+    void emplace_back();
+
+    template <class Args_1>
+    void emplace_back(
+                             BSLS_COMPILERFEATURES_FORWARD_REF(Args_1) args_1);
+
+    template <class Args_1,
+              class Args_2>
+    void emplace_back(
+                             BSLS_COMPILERFEATURES_FORWARD_REF(Args_1) args_1,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(Args_2) args_2);
+
+    template <class Args_1,
+              class Args_2,
+              class Args_3>
+    void emplace_back(
+                             BSLS_COMPILERFEATURES_FORWARD_REF(Args_1) args_1,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(Args_2) args_2,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(Args_3) args_3);
+
+    template <class Args_1,
+              class Args_2,
+              class Args_3,
+              class Args_4>
+    void emplace_back(
+                             BSLS_COMPILERFEATURES_FORWARD_REF(Args_1) args_1,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(Args_2) args_2,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(Args_3) args_3,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(Args_4) args_4);
+
+    template <class Args_1,
+              class Args_2,
+              class Args_3,
+              class Args_4,
+              class Args_5>
+    void emplace_back(
+                             BSLS_COMPILERFEATURES_FORWARD_REF(Args_1) args_1,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(Args_2) args_2,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(Args_3) args_3,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(Args_4) args_4,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(Args_5) args_5);
+
+#else
+    template <class... Args>
+    void emplace_back(BSLS_COMPILERFEATURES_FORWARD_REF(Args)... args);
+// }}} END GENERATED CODE
+#endif
+
+    void push_back(const VALUE_TYPE& value);
+        // Append a copy of the specified 'value' at the end of this vector.
+        // This method provides the strong exception safety guarantee.
+
+    void pop_back();
+        // Erase the last element from this vector.  The behavior is undefined
+        // if this vector is empty.
+
+#if !BSLS_COMPILERFEATURES_SIMULATE_CPP11_FEATURES
+    template <class... Args>
+    iterator emplace(const_iterator position, Args&&... args);
+        // Insert at the specified 'position' in this vector a new element,
+        // constructed in place from the specified 'args', and return an
+        // iterator pointing to the new element.  The behavior is undefined
+        // unless 'position' is an iterator in the range '[ begin(), end() ]'
+        // (both endpoints included), and, as for 'bsl::vector', unless no
+        // element of 'args' refers to an element of this vector.
+
+#elif BSLS_COMPILERFEATURES_SIMULATE_VARIADIC_TEMPLATES
+// {{{ BEGIN GENERATED CODE
+// The following section is automatically generated.  **DO NOT EDIT**
+// Generator command line: sim_cpp11_features.pl --var-args=5 bslstl_smallvector.h
+    iterator emplace(const_iterator position);
+
+    template <class Args_1>
+    iterator emplace(const_iterator position,
+                     BSLS_COMPILERFEATURES_FORWARD_REF(Args_1) args_1);
+
+    template <class Args_1,
+              class Args_2>
+    iterator emplace(const_iterator position,
+                     BSLS_COMPILERFEATURES_FORWARD_REF(Args_1) args_1,
+                     BSLS_COMPILERFEATURES_FORWARD_REF(Args_2) args_2);
+
+    template <class Args_1,
+              class Args_2,
+              class Args_3>
+    iterator emplace(const_iterator position,
+                     BSLS_COMPILERFEATURES_FORWARD_REF(Args_1) args_1,
+                     BSLS_COMPILERFEATURES_FORWARD_REF(Args_2) args_2,
+                     BSLS_COMPILERFEATURES_FORWARD_REF(Args_3) args_3);
+
+    template <class Args_1,
+              class Args_2,
+              class Args_3,
+              class Args_4>
+    iterator emplace(const_iterator position,
+                     BSLS_COMPILERFEATURES_FORWARD_REF(Args_1) args_1,
+                     BSLS_COMPILERFEATURES_FORWARD_REF(Args_2) args_2,
+                     BSLS_COMPILERFEATURES_FORWARD_REF(Args_3) args_3,
+                     BSLS_COMPILERFEATURES_FORWARD_REF(Args_4) args_4);
+
+    template <class Args_1,
+              class Args_2,
+              class Args_3,
+              class Args_4,
+              class Args_5>
+    iterator emplace(const_iterator position,
+                     BSLS_COMPILERFEATURES_FORWARD_REF(Args_1) args_1,
+                     BSLS_COMPILERFEATURES_FORWARD_REF(Args_2) args_2,
+                     BSLS_COMPILERFEATURES_FORWARD_REF(Args_3) args_3,
+                     BSLS_COMPILERFEATURES_FORWARD_REF(Args_4) args_4,
+                     BSLS_COMPILERFEATURES_FORWARD_REF(Args_5) args_5);
+
+#else
+    template <class... Args>
+    iterator emplace(const_iterator position,
+                     BSLS_COMPILERFEATURES_FORWARD_REF(Args)... args);
+// }}} END GENERATED CODE
+#endif
+
+    iterator insert(const_iterator position, const VALUE_TYPE& value);
+        // Insert at the specified 'position' in this vector a copy of the
+        // specified 'value', and return an iterator pointing to the newly
+        // inserted element.  The behavior is undefined unless 'position' is an
+        // iterator in the range '[ begin(), end() ]' (both endpoints
+        // included).
+
+    void insert(const_iterator    position,
+                size_type         numElements,
+                const VALUE_TYPE& value);
+        // Insert at the specified 'position' in this vector the specified
+        // 'numElements' copies of the specified 'value'.  The behavior is
+        // undefined unless 'position' is an iterator in the range
+        // '[ begin(), end() ]' (both endpoints included).
+
+    template <class INPUT_ITER>
+    void insert(const_iterator position, INPUT_ITER first, INPUT_ITER last);
+        // Insert at the specified 'position' in this vector the values in the
+        // range starting at the specified 'first' and ending immediately
+        // before the specified 'last' iterators of the (template parameter)
+        // 'INPUT_ITER' type.  The behavior is undefined unless 'position' is
+        // an iterator in the range '[ begin(), end() ]' (both endpoints
+        // included), and '[ first, last )' does not refer to elements of this
+        // vector.
+
+    iterator erase(const_iterator position);
+        // Remove from this vector the element at the specified 'position', and
+        // return an iterator pointing to the element immediately following the
+        // removed element (or 'end()').  The behavior is undefined unless
+        // 'position' is an iterator in the range '[ begin(), end() )'.
+
+    iterator erase(const_iterator first, const_iterator last);
+        // Remove from this vector the elements starting at the specified
+        // 'first' position that are before the specified 'last' position, and
+        // return an iterator pointing to the element immediately following the
+        // last removed element (or 'end()').  The behavior is undefined unless
+        // 'first' is an iterator in the range '[ begin(), end() ]' and 'last'
+        // is an iterator in the range '[ first, end() ]'.
+
+    void swap(small_vector& other);
+        // Exchange the value of this vector with that of the specified 'other'
+        // vector.  The allocators are not exchanged.  This method does not
+        // throw, and takes constant time, if the two vectors use the same
+        // allocator and neither stores its elements inline; otherwise, the
+        // elements stored inline are moved, and, if the allocators differ, all
+        // elements are copied.  Note that iterators are invalidated.
+
+    void clear();
+        // Remove all the elements from this vector.  Note that the capacity
+        // is not changed.
+
+    // ACCESSORS
+
+                             // *** iterators: ***
+
+    const_iterator begin() const;
+    const_iterator cbegin() const;
+        // Return an iterator pointing the first element in this non-modifiable
+        // vector (or the past-the-end iterator if this vector is empty).
+
+    const_iterator end() const;
+    const_iterator cend() const;
+        // Return the past-the-end iterator for this non-modifiable vector.
+
+    const_reverse_iterator rbegin() const;
+    const_reverse_iterator crbegin() const;
+        // Return a reverse iterator pointing the last element in this
+        // non-modifiable vector (or the past-the-end reverse iterator if this
+        // vector is empty).
+
+    const_reverse_iterator rend() const;
+    const_reverse_iterator crend() const;
+        // Return the past-the-end reverse iterator for this non-modifiable
+        // vector.
+
+                             // *** capacity: ***
+
+    size_type size() const;
+        // Return the number of elements in this vector.
+
+    size_type capacity() const;
+        // Return the capacity of this vector, i.e., the maximum number of
+        // elements for which resizing is guaranteed not to trigger a
+        // reallocation.  Note that the capacity is never less than
+        // 'INLINE_CAPACITY'.
+
+    bool empty() const;
+        // Return 'true' if this vector has size 0, and 'false' otherwise.
+
+    bool is_inline() const;
+        // Return 'true' if the elements of this vector are stored within its
+        // footprint, and 'false' if they are stored in memory obtained from
+        // its allocator.
+
+    size_type max_size() const;
+        // Return the maximum possible size for this vector.
+
+                          // *** element access: ***
+
+    const_reference operator[](size_type position) const;
+        // Return a reference to the non-modifiable element at the specified
+        // 'position' in this vector.  The behavior is undefined unless
+        // 'position < size()'.
+
+    const_reference at(size_type position) const;
+        // Return a reference to the non-modifiable element at the specified
+        // 'position'.  Throw 'std::out_of_range' if 'position >= size()'.
+
+    const_reference front() const;
+        // Return a reference to the non-modifiable first element in this
+        // vector.  The behavior is undefined if this vector is empty.
+
+    const_reference back() const;
+        // Return a reference to the non-modifiable last element in this
+        // vector.  The behavior is undefined if this vector is empty.
+
+    const VALUE_TYPE *data() const;
+        // Return the address of the non-modifiable first element in this
+        // vector, or a valid, but non-dereferenceable pointer value if this
+        // vector is empty.
+
+                             // *** allocator: ***
+
+    allocator_type get_allocator() const;
+        // Return the allocator used by this vector to supply memory.
+};
+
+// FREE OPERATORS
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+bool operator==(
+              const small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>& lhs,
+              const small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' vectors have the same
+    // value, and 'false' otherwise.  Two vectors have the same value if they
+    // have the same number of elements and the same element value at each
+    // index position.
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+bool operator!=(
+              const small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>& lhs,
+              const small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' vectors do not have the
+    // same value, and 'false' otherwise.
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+bool operator<(
+              const small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>& lhs,
+              const small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>& rhs);
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+bool operator>(
+              const small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>& lhs,
+              const small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>& rhs);
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+bool operator<=(
+              const small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>& lhs,
+              const small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>& rhs);
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+bool operator>=(
+              const small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>& lhs,
+              const small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>& rhs);
+    // Return the result of the corresponding lexicographical comparison of
+    // the elements of the specified 'lhs' and 'rhs' vectors.
+
+// FREE FUNCTIONS
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+void swap(small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>& a,
+          small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>& b);
+    // Exchange the values of the specified 'a' and 'b' vectors (see
+    // 'small_vector::swap').
+
+// ============================================================================
+//                  TEMPLATE AND INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+             // -------------------------------------------------
+             // class small_vector<VALUE_TYPE, N, ALLOCATOR>::Guard
+             // -------------------------------------------------
+
+// CREATORS
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::Guard::Guard(
+                                                VALUE_TYPE    *data,
+                                                std::size_t    capacity,
+                                                ContainerBase *container)
+: d_data_p(data)
+, d_capacity(capacity)
+, d_container_p(container)
+{
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::Guard::~Guard()
+{
+    if (d_data_p) {
+        d_container_p->deallocateN(d_data_p, d_capacity);
+    }
+}
+
+// MANIPULATORS
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+void small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::Guard::release()
+{
+    d_data_p = 0;
+}
+
+            // ---------------------------------------------------
+            // class small_vector<VALUE_TYPE, N, ALLOCATOR>::Proctor
+            // ---------------------------------------------------
+
+// CREATORS
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::Proctor::Proctor(
+                                                          small_vector *object)
+: d_object_p(object)
+{
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::Proctor::~Proctor()
+{
+    if (d_object_p) {
+        d_object_p->privateDestroy();
+    }
+}
+
+// MANIPULATORS
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+void small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::Proctor::release()
+{
+    d_object_p = 0;
+}
+
+                            // ------------------
+                            // class small_vector
+                            // ------------------
+
+// PRIVATE MANIPULATORS
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+VALUE_TYPE *small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::inlineData()
+{
+    return reinterpret_cast<VALUE_TYPE *>(d_buffer.buffer());
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+void small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::privateAdopt(
+                                                          VALUE_TYPE *data,
+                                                          size_type   capacity)
+{
+    BSLS_ASSERT_SAFE(d_dataBegin == d_dataEnd);
+
+    if (!is_inline()) {
+        this->deallocateN(d_dataBegin, d_capacity);
+    }
+    d_dataBegin = d_dataEnd = data;
+    d_capacity  = capacity;
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+void small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::privateDestroy()
+{
+    BloombergLP::bslalg::ArrayDestructionPrimitives::destroy(d_dataBegin,
+                                                             d_dataEnd);
+    if (!is_inline()) {
+        this->deallocateN(d_dataBegin, d_capacity);
+    }
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+template <class INPUT_ITER>
+inline
+void small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::
+                      privateInsertDispatch(
+                              const_iterator                          position,
+                              INPUT_ITER                              count,
+                              INPUT_ITER                              value,
+                              BloombergLP::bslmf::MatchArithmeticType ,
+                              BloombergLP::bslmf::Nil                 )
+{
+    // 'count' and 'value' are integral types that just happen to be the same.
+    // They are not iterators, so we call 'insert(position, count, value)'.
+
+    insert(position,
+           static_cast<size_type>(count),
+           static_cast<VALUE_TYPE>(value));
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+template <class INPUT_ITER>
+inline
+void small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::
+                      privateInsertDispatch(
+                                          const_iterator              position,
+                                          INPUT_ITER                  first,
+                                          INPUT_ITER                  last,
+                                          BloombergLP::bslmf::MatchAnyType ,
+                                          BloombergLP::bslmf::MatchAnyType )
+{
+    // Dispatch based on iterator category.
+
+    BSLS_ASSERT_SAFE(!Vector_RangeCheck::isInvalidRange(first, last));
+
+    typedef typename bsl::iterator_traits<INPUT_ITER>::iterator_category Tag;
+    privateInsert(position, first, last, Tag());
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+template <class INPUT_ITER>
+void small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::privateInsert(
+                                      const_iterator                  position,
+                                      INPUT_ITER                      first,
+                                      INPUT_ITER                      last,
+                                      const std::input_iterator_tag&)
+{
+    // The number of values cannot be computed in advance, so appending at the
+    // end is done one element at a time, and insertion elsewhere goes through
+    // a temporary vector, which also provides the strong guarantee if the
+    // allocator throws.
+
+    if (position == end()) {
+        while (first != last) {
+            push_back(*first);
+            ++first;
+        }
+        return;                                                       // RETURN
+    }
+
+    small_vector temp(get_allocator());
+    while (first != last) {
+        temp.push_back(*first);
+        ++first;
+    }
+    insert(position, temp.d_dataBegin, temp.d_dataEnd);
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+template <class FWD_ITER>
+void small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::privateInsert(
+                                    const_iterator                    position,
+                                    FWD_ITER                          first,
+                                    FWD_ITER                          last,
+                                    const std::forward_iterator_tag&)
+{
+    const iterator  pos = const_cast<iterator>(position);
+    const size_type n   = bsl::distance(first, last);
+
+    if (n > d_capacity - size()) {
+        const size_type newCapacity = privateNewCapacity(
+                       n,
+                       "small_vector<...>::insert(pos,first,last): too long");
+        const size_type newSize     = size() + n;
+
+        VALUE_TYPE *newData = this->allocateN((VALUE_TYPE *) 0, newCapacity);
+        Guard       guard(newData, newCapacity, this);
+
+        BloombergLP::bslalg::ArrayPrimitives::destructiveMoveAndInsert(
+                                                       newData,
+                                                       &d_dataEnd,
+                                                       d_dataBegin,
+                                                       pos,
+                                                       d_dataEnd,
+                                                       first,
+                                                       last,
+                                                       n,
+                                                       this->bslmaAllocator());
+        guard.release();
+
+        d_dataEnd = d_dataBegin;
+        privateAdopt(newData, newCapacity);
+        d_dataEnd = newData + newSize;
+    }
+    else {
+        BloombergLP::bslalg::ArrayPrimitives::insert(pos,
+                                                     d_dataEnd,
+                                                     first,
+                                                     last,
+                                                     n,
+                                                     this->bslmaAllocator());
+        d_dataEnd += n;
+    }
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+void small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::privateMoveAround(
+                                                          VALUE_TYPE *data,
+                                                          size_type   capacity,
+                                                          size_type   index)
+{
+    VALUE_TYPE *const pos = d_dataBegin + index;
+    const size_type   newSize = size() + 1;
+
+    BloombergLP::bslalg::AutoArrayDestructor<VALUE_TYPE> guard(
+                                                             data + index,
+                                                             data + index + 1);
+
+    // Move '[pos, d_dataEnd)' after the new element.
+
+    BloombergLP::bslalg::ArrayPrimitives::destructiveMove(
+                                                       data + index + 1,
+                                                       pos,
+                                                       d_dataEnd,
+                                                       this->bslmaAllocator());
+    guard.moveEnd(d_dataEnd - pos);
+    d_dataEnd = pos;
+
+    // Move '[d_dataBegin, pos)' before the new element.
+
+    BloombergLP::bslalg::ArrayPrimitives::destructiveMove(
+                                                       data,
+                                                       d_dataBegin,
+                                                       pos,
+                                                       this->bslmaAllocator());
+    guard.release();
+
+    d_dataEnd = d_dataBegin;
+    privateAdopt(data, capacity);
+    d_dataEnd = data + newSize;
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+void small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::privateMoveFrom(
+                                                        small_vector *original)
+{
+    BSLS_ASSERT_SAFE(empty());
+    BSLS_ASSERT_SAFE(is_inline());
+
+    if (!original->is_inline()) {
+        d_dataBegin = original->d_dataBegin;
+        d_dataEnd   = original->d_dataEnd;
+        d_capacity  = original->d_capacity;
+
+        original->d_dataBegin = original->d_dataEnd = original->inlineData();
+        original->d_capacity  = INLINE_CAPACITY;
+    }
+    else {
+        BloombergLP::bslalg::ArrayPrimitives::destructiveMove(
+                                                       d_dataBegin,
+                                                       original->d_dataBegin,
+                                                       original->d_dataEnd,
+                                                       this->bslmaAllocator());
+        d_dataEnd          += original->size();
+        original->d_dataEnd = original->d_dataBegin;
+    }
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+typename small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::size_type
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::privateNewCapacity(
+                                                 size_type   numElements,
+                                                 const char *message) const
+{
+    const size_type maxSize = max_size();
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+                                        numElements > maxSize - size())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        BloombergLP::bslstl::StdExceptUtil::throwLengthError(message);
+    }
+    return Vector_Util::computeNewCapacity(size() + numElements,
+                                           d_capacity,
+                                           maxSize);
+}
+
+// CREATORS
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::small_vector(
+                                               const ALLOCATOR& basicAllocator)
+: ContainerBase(basicAllocator)
+, d_dataBegin(inlineData())
+, d_dataEnd(d_dataBegin)
+, d_capacity(INLINE_CAPACITY)
+{
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::small_vector(
+                                               size_type        initialSize,
+                                               const ALLOCATOR& basicAllocator)
+: ContainerBase(basicAllocator)
+, d_dataBegin(inlineData())
+, d_dataEnd(d_dataBegin)
+, d_capacity(INLINE_CAPACITY)
+{
+    Proctor proctor(this);
+    resize(initialSize);
+    proctor.release();
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::small_vector(
+                                              size_type         initialSize,
+                                              const VALUE_TYPE& value,
+                                              const ALLOCATOR&  basicAllocator)
+: ContainerBase(basicAllocator)
+, d_dataBegin(inlineData())
+, d_dataEnd(d_dataBegin)
+, d_capacity(INLINE_CAPACITY)
+{
+    Proctor proctor(this);
+    insert(d_dataEnd, initialSize, value);
+    proctor.release();
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+template <class INPUT_ITER>
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::small_vector(
+                                               INPUT_ITER       first,
+                                               INPUT_ITER       last,
+                                               const ALLOCATOR& basicAllocator)
+: ContainerBase(basicAllocator)
+, d_dataBegin(inlineData())
+, d_dataEnd(d_dataBegin)
+, d_capacity(INLINE_CAPACITY)
+{
+    Proctor proctor(this);
+    insert(d_dataEnd, first, last);
+    proctor.release();
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::small_vector(
+                                                  const small_vector& original)
+: ContainerBase(original)
+, d_dataBegin(inlineData())
+, d_dataEnd(d_dataBegin)
+, d_capacity(INLINE_CAPACITY)
+{
+    Proctor proctor(this);
+    insert(d_dataEnd, original.d_dataBegin, original.d_dataEnd);
+    proctor.release();
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::small_vector(
+                                            const small_vector& original,
+                                            const ALLOCATOR&    basicAllocator)
+: ContainerBase(basicAllocator)
+, d_dataBegin(inlineData())
+, d_dataEnd(d_dataBegin)
+, d_capacity(INLINE_CAPACITY)
+{
+    Proctor proctor(this);
+    insert(d_dataEnd, original.d_dataBegin, original.d_dataEnd);
+    proctor.release();
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::~small_vector()
+{
+    privateDestroy();
+}
+
+// MANIPULATORS
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>&
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::operator=(
+                                                       const small_vector& rhs)
+{
+    if (this != &rhs) {
+        clear();
+        insert(d_dataEnd, rhs.d_dataBegin, rhs.d_dataEnd);
+    }
+    return *this;
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+template <class INPUT_ITER>
+inline
+void small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::assign(
+                                                              INPUT_ITER first,
+                                                              INPUT_ITER last)
+{
+    BSLS_ASSERT_SAFE(!Vector_RangeCheck::isInvalidRange(first, last));
+
+    clear();
+    insert(d_dataEnd, first, last);
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+void small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::assign(
+                                                 size_type         numElements,
+                                                 const VALUE_TYPE& value)
+{
+    clear();
+    insert(d_dataEnd, numElements, value);
+}
+
+                             // *** iterators: ***
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::iterator
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::begin()
+{
+    return d_dataBegin;
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::iterator
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::end()
+{
+    return d_dataEnd;
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::reverse_iterator
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::rbegin()
+{
+    return reverse_iterator(d_dataEnd);
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::reverse_iterator
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::rend()
+{
+    return reverse_iterator(d_dataBegin);
+}
+
+                          // *** element access: ***
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::reference
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::operator[](
+                                                            size_type position)
+{
+    BSLS_ASSERT_SAFE(position < size());
+
+    return d_dataBegin[position];
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+typename small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::reference
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::at(size_type position)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(position >= size())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        BloombergLP::bslstl::StdExceptUtil::throwOutOfRange(
+                                 "small_vector<...>::at(n): invalid position");
+    }
+    return d_dataBegin[position];
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::reference
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::front()
+{
+    BSLS_ASSERT_SAFE(!empty());
+
+    return *d_dataBegin;
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::reference
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::back()
+{
+    BSLS_ASSERT_SAFE(!empty());
+
+    return *(d_dataEnd - 1);
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+VALUE_TYPE *small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::data()
+{
+    return d_dataBegin;
+}
+
+                             // *** capacity: ***
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+void small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::resize(
+                                                             size_type newSize)
+{
+    if (newSize <= size()) {
+        BloombergLP::bslalg::ArrayDestructionPrimitives::destroy(
+                                                         d_dataBegin + newSize,
+                                                         d_dataEnd);
+        d_dataEnd = d_dataBegin + newSize;
+        return;                                                       // RETURN
+    }
+
+    const size_type n = newSize - size();
+    if (n > d_capacity - size()) {
+        reserve(privateNewCapacity(n,
+                                 "small_vector<...>::resize(n): too long"));
+    }
+    BloombergLP::bslalg::ArrayPrimitives::defaultConstruct(
+                                                       d_dataEnd,
+                                                       n,
+                                                       this->bslmaAllocator());
+    d_dataEnd += n;
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+void small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::resize(
+                                                     size_type         newSize,
+                                                     const VALUE_TYPE& value)
+{
+    if (newSize <= size()) {
+        BloombergLP::bslalg::ArrayDestructionPrimitives::destroy(
+                                                         d_dataBegin + newSize,
+                                                         d_dataEnd);
+        d_dataEnd = d_dataBegin + newSize;
+    }
+    else {
+        insert(d_dataEnd, newSize - size(), value);
+    }
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+void small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::reserve(
+                                                         size_type newCapacity)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(newCapacity > max_size())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        BloombergLP::bslstl::StdExceptUtil::throwLengthError(
+                   "small_vector<...>::reserve(newCapacity): vector too long");
+    }
+    if (newCapacity <= d_capacity) {
+        return;                                                       // RETURN
+    }
+
+    VALUE_TYPE *newData = this->allocateN((VALUE_TYPE *) 0, newCapacity);
+    Guard       guard(newData, newCapacity, this);
+
+    BloombergLP::bslalg::ArrayPrimitives::destructiveMove(
+                                                       newData,
+                                                       d_dataBegin,
+                                                       d_dataEnd,
+                                                       this->bslmaAllocator());
+    guard.release();
+
+    const size_type oldSize = size();
+    d_dataEnd = d_dataBegin;
+    privateAdopt(newData, newCapacity);
+    d_dataEnd = newData + oldSize;
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+void small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::shrink_to_fit()
+{
+    if (is_inline() || size() == d_capacity) {
+        return;                                                       // RETURN
+    }
+
+    const size_type oldSize = size();
+    if (oldSize <= INLINE_CAPACITY) {
+        BloombergLP::bslalg::ArrayPrimitives::destructiveMove(
+                                                       inlineData(),
+                                                       d_dataBegin,
+                                                       d_dataEnd,
+                                                       this->bslmaAllocator());
+        d_dataEnd = d_dataBegin;
+        privateAdopt(inlineData(), INLINE_CAPACITY);
+        d_dataEnd = d_dataBegin + oldSize;
+        return;                                                       // RETURN
+    }
+
+    VALUE_TYPE *newData = this->allocateN((VALUE_TYPE *) 0, oldSize);
+    Guard       guard(newData, oldSize, this);
+
+    BloombergLP::bslalg::ArrayPrimitives::destructiveMove(
+                                                       newData,
+                                                       d_dataBegin,
+                                                       d_dataEnd,
+                                                       this->bslmaAllocator());
+    guard.release();
+
+    d_dataEnd = d_dataBegin;
+    privateAdopt(newData, oldSize);
+    d_dataEnd = newData + oldSize;
+}
+
+                             // *** modifiers: ***
+
+#if !BSLS_COMPILERFEATURES_SIMULATE_CPP11_FEATURES
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+template <class... Args>
+inline
+void small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::emplace_back(
+                                                               Args&&... args)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(d_dataEnd
+                                                != d_dataBegin + d_capacity)) {
+        BloombergLP::bslalg::ScalarPrimitives::construct(
+                                                   d_dataEnd,
+                                                   std::forward<Args>(args)...,
+                                                   this->bslmaAllocator());
+        ++d_dataEnd;
+    }
+    else {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        emplace(d_dataEnd, std::forward<Args>(args)...);
+    }
+}
+#elif BSLS_COMPILERFEATURES_SIMULATE_VARIADIC_TEMPLATES
+// {{{ BEGIN GENERATED CODE
+// The following section is automatically generated.  **DO NOT EDIT**
+// Generator command line: sim_cpp11_features.pl --var-args=5 bslstl_smallvector.h
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+void small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::emplace_back()
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(d_dataEnd
+                                                != d_dataBegin + d_capacity)) {
+        BloombergLP::bslalg::ScalarPrimitives::construct(
+                                                   d_dataEnd,
+                                                   this->bslmaAllocator());
+        ++d_dataEnd;
+    }
+    else {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        emplace(d_dataEnd);
+    }
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+template <class Args_1>
+inline
+void small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::emplace_back(
+                             BSLS_COMPILERFEATURES_FORWARD_REF(Args_1) args_1)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(d_dataEnd
+                                                != d_dataBegin + d_capacity)) {
+        BloombergLP::bslalg::ScalarPrimitives::construct(
+                                                   d_dataEnd,
+                    BSLS_COMPILERFEATURES_FORWARD(Args_1, args_1),
+                                                   this->bslmaAllocator());
+        ++d_dataEnd;
+    }
+    else {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        emplace(d_dataEnd,
+                BSLS_COMPILERFEATURES_FORWARD(Args_1, args_1));
+    }
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+template <class Args_1,
+          class Args_2>
+inline
+void small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::emplace_back(
+                             BSLS_COMPILERFEATURES_FORWARD_REF(Args_1) args_1,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(Args_2) args_2)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(d_dataEnd
+                                                != d_dataBegin + d_capacity)) {
+        BloombergLP::bslalg::ScalarPrimitives::construct(
+                                                   d_dataEnd,
+                    BSLS_COMPILERFEATURES_FORWARD(Args_1, args_1),
+                    BSLS_COMPILERFEATURES_FORWARD(Args_2, args_2),
+                                                   this->bslmaAllocator());
+        ++d_dataEnd;
+    }
+    else {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        emplace(d_dataEnd,
+                BSLS_COMPILERFEATURES_FORWARD(Args_1, args_1),
+                BSLS_COMPILERFEATURES_FORWARD(Args_2, args_2));
+    }
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+template <class Args_1,
+          class Args_2,
+          class Args_3>
+inline
+void small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::emplace_back(
+                             BSLS_COMPILERFEATURES_FORWARD_REF(Args_1) args_1,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(Args_2) args_2,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(Args_3) args_3)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(d_dataEnd
+                                                != d_dataBegin + d_capacity)) {
+        BloombergLP::bslalg::ScalarPrimitives::construct(
+                                                   d_dataEnd,
+                    BSLS_COMPILERFEATURES_FORWARD(Args_1, args_1),
+                    BSLS_COMPILERFEATURES_FORWARD(Args_2, args_2),
+                    BSLS_COMPILERFEATURES_FORWARD(Args_3, args_3),
+                                                   this->bslmaAllocator());
+        ++d_dataEnd;
+    }
+    else {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        emplace(d_dataEnd,
+                BSLS_COMPILERFEATURES_FORWARD(Args_1, args_1),
+                BSLS_COMPILERFEATURES_FORWARD(Args_2, args_2),
+                BSLS_COMPILERFEATURES_FORWARD(Args_3, args_3));
+    }
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+template <class Args_1,
+          class Args_2,
+          class Args_3,
+          class Args_4>
+inline
+void small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::emplace_back(
+                             BSLS_COMPILERFEATURES_FORWARD_REF(Args_1) args_1,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(Args_2) args_2,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(Args_3) args_3,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(Args_4) args_4)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(d_dataEnd
+                                                != d_dataBegin + d_capacity)) {
+        BloombergLP::bslalg::ScalarPrimitives::construct(
+                                                   d_dataEnd,
+                    BSLS_COMPILERFEATURES_FORWARD(Args_1, args_1),
+                    BSLS_COMPILERFEATURES_FORWARD(Args_2, args_2),
+                    BSLS_COMPILERFEATURES_FORWARD(Args_3, args_3),
+                    BSLS_COMPILERFEATURES_FORWARD(Args_4, args_4),
+                                                   this->bslmaAllocator());
+        ++d_dataEnd;
+    }
+    else {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        emplace(d_dataEnd,
+                BSLS_COMPILERFEATURES_FORWARD(Args_1, args_1),
+                BSLS_COMPILERFEATURES_FORWARD(Args_2, args_2),
+                BSLS_COMPILERFEATURES_FORWARD(Args_3, args_3),
+                BSLS_COMPILERFEATURES_FORWARD(Args_4, args_4));
+    }
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+template <class Args_1,
+          class Args_2,
+          class Args_3,
+          class Args_4,
+          class Args_5>
+inline
+void small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::emplace_back(
+                             BSLS_COMPILERFEATURES_FORWARD_REF(Args_1) args_1,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(Args_2) args_2,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(Args_3) args_3,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(Args_4) args_4,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(Args_5) args_5)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(d_dataEnd
+                                                != d_dataBegin + d_capacity)) {
+        BloombergLP::bslalg::ScalarPrimitives::construct(
+                                                   d_dataEnd,
+                    BSLS_COMPILERFEATURES_FORWARD(Args_1, args_1),
+                    BSLS_COMPILERFEATURES_FORWARD(Args_2, args_2),
+                    BSLS_COMPILERFEATURES_FORWARD(Args_3, args_3),
+                    BSLS_COMPILERFEATURES_FORWARD(Args_4, args_4),
+                    BSLS_COMPILERFEATURES_FORWARD(Args_5, args_5),
+                                                   this->bslmaAllocator());
+        ++d_dataEnd;
+    }
+    else {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        emplace(d_dataEnd,
+                BSLS_COMPILERFEATURES_FORWARD(Args_1, args_1),
+                BSLS_COMPILERFEATURES_FORWARD(Args_2, args_2),
+                BSLS_COMPILERFEATURES_FORWARD(Args_3, args_3),
+                BSLS_COMPILERFEATURES_FORWARD(Args_4, args_4),
+                BSLS_COMPILERFEATURES_FORWARD(Args_5, args_5));
+    }
+}
+#else
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+template <class... Args>
+inline
+void small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::emplace_back(
+                             BSLS_COMPILERFEATURES_FORWARD_REF(Args)... args)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(d_dataEnd
+                                                != d_dataBegin + d_capacity)) {
+        BloombergLP::bslalg::ScalarPrimitives::construct(
+                                                   d_dataEnd,
+                    BSLS_COMPILERFEATURES_FORWARD(Args, args)...,
+                                                   this->bslmaAllocator());
+        ++d_dataEnd;
+    }
+    else {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        emplace(d_dataEnd,
+                BSLS_COMPILERFEATURES_FORWARD(Args, args)...);
+    }
+}
+// }}} END GENERATED CODE
+#endif
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+void small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::push_back(
+                                                       const VALUE_TYPE& value)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(d_dataEnd
+                                                != d_dataBegin + d_capacity)) {
+        BloombergLP::bslalg::ScalarPrimitives::copyConstruct(
+                                                       d_dataEnd,
+                                                       value,
+                                                       this->bslmaAllocator());
+        ++d_dataEnd;
+    }
+    else {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        insert(d_dataEnd, size_type(1), value);
+    }
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+void small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::pop_back()
+{
+    BSLS_ASSERT_SAFE(!empty());
+
+    BloombergLP::bslalg::ScalarDestructionPrimitives::destroy(--d_dataEnd);
+}
+
+#if !BSLS_COMPILERFEATURES_SIMULATE_CPP11_FEATURES
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+template <class... Args>
+typename small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::iterator
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::emplace(
+                                                       const_iterator position,
+                                                       Args&&...      args)
+{
+    BSLS_ASSERT_SAFE(d_dataBegin <= position);
+    BSLS_ASSERT_SAFE(position    <= d_dataEnd);
+
+    const size_type index = position - d_dataBegin;
+
+    if (d_dataEnd != d_dataBegin + d_capacity) {
+        BloombergLP::bslalg::ArrayPrimitives::emplace(
+                                                  d_dataBegin + index,
+                                                  d_dataEnd,
+                                                  1,
+                                                  this->bslmaAllocator(),
+                                                  std::forward<Args>(args)...);
+        ++d_dataEnd;
+    }
+    else {
+        // Construct the new element before moving the existing ones, which
+        // 'args' may refer to.
+
+        const size_type newCapacity = privateNewCapacity(
+                              1,
+                             "small_vector<...>::emplace(pos,args): too long");
+        VALUE_TYPE *newData = this->allocateN((VALUE_TYPE *) 0, newCapacity);
+        Guard       guard(newData, newCapacity, this);
+
+        BloombergLP::bslalg::ScalarPrimitives::construct(
+                                                   newData + index,
+                                                   std::forward<Args>(args)...,
+                                                   this->bslmaAllocator());
+        privateMoveAround(newData, newCapacity, index);
+        guard.release();
+    }
+    return d_dataBegin + index;
+}
+#elif BSLS_COMPILERFEATURES_SIMULATE_VARIADIC_TEMPLATES
+// {{{ BEGIN GENERATED CODE
+// The following section is automatically generated.  **DO NOT EDIT**
+// Generator command line: sim_cpp11_features.pl --var-args=5 bslstl_smallvector.h
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+typename small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::iterator
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::emplace(
+                             const_iterator position)
+{
+    BSLS_ASSERT_SAFE(d_dataBegin <= position);
+    BSLS_ASSERT_SAFE(position    <= d_dataEnd);
+
+    const size_type index = position - d_dataBegin;
+
+    if (d_dataEnd != d_dataBegin + d_capacity) {
+        BloombergLP::bslalg::ArrayPrimitives::emplace(
+                                                  d_dataBegin + index,
+                                                  d_dataEnd,
+                                                  1,
+                                                  this->bslmaAllocator());
+        ++d_dataEnd;
+    }
+    else {
+        // Construct the new element before moving the existing ones, which
+        // 'args' may refer to.
+
+        const size_type newCapacity = privateNewCapacity(
+                              1,
+                             "small_vector<...>::emplace(pos,args): too long");
+        VALUE_TYPE *newData = this->allocateN((VALUE_TYPE *) 0, newCapacity);
+        Guard       guard(newData, newCapacity, this);
+
+        BloombergLP::bslalg::ScalarPrimitives::construct(
+                                                   newData + index,
+                                                   this->bslmaAllocator());
+        privateMoveAround(newData, newCapacity, index);
+        guard.release();
+    }
+    return d_dataBegin + index;
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+template <class Args_1>
+typename small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::iterator
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::emplace(
+                             const_iterator position,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(Args_1) args_1)
+{
+    BSLS_ASSERT_SAFE(d_dataBegin <= position);
+    BSLS_ASSERT_SAFE(position    <= d_dataEnd);
+
+    const size_type index = position - d_dataBegin;
+
+    if (d_dataEnd != d_dataBegin + d_capacity) {
+        BloombergLP::bslalg::ArrayPrimitives::emplace(
+                                                  d_dataBegin + index,
+                                                  d_dataEnd,
+                                                  1,
+                                                  this->bslmaAllocator(),
+                    BSLS_COMPILERFEATURES_FORWARD(Args_1, args_1));
+        ++d_dataEnd;
+    }
+    else {
+        // Construct the new element before moving the existing ones, which
+        // 'args' may refer to.
+
+        const size_type newCapacity = privateNewCapacity(
+                              1,
+                             "small_vector<...>::emplace(pos,args): too long");
+        VALUE_TYPE *newData = this->allocateN((VALUE_TYPE *) 0, newCapacity);
+        Guard       guard(newData, newCapacity, this);
+
+        BloombergLP::bslalg::ScalarPrimitives::construct(
+                                                   newData + index,
+                    BSLS_COMPILERFEATURES_FORWARD(Args_1, args_1),
+                                                   this->bslmaAllocator());
+        privateMoveAround(newData, newCapacity, index);
+        guard.release();
+    }
+    return d_dataBegin + index;
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+template <class Args_1,
+          class Args_2>
+typename small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::iterator
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::emplace(
+                             const_iterator position,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(Args_1) args_1,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(Args_2) args_2)
+{
+    BSLS_ASSERT_SAFE(d_dataBegin <= position);
+    BSLS_ASSERT_SAFE(position    <= d_dataEnd);
+
+    const size_type index = position - d_dataBegin;
+
+    if (d_dataEnd != d_dataBegin + d_capacity) {
+        BloombergLP::bslalg::ArrayPrimitives::emplace(
+                                                  d_dataBegin + index,
+                                                  d_dataEnd,
+                                                  1,
+                                                  this->bslmaAllocator(),
+                    BSLS_COMPILERFEATURES_FORWARD(Args_1, args_1),
+                    BSLS_COMPILERFEATURES_FORWARD(Args_2, args_2));
+        ++d_dataEnd;
+    }
+    else {
+        // Construct the new element before moving the existing ones, which
+        // 'args' may refer to.
+
+        const size_type newCapacity = privateNewCapacity(
+                              1,
+                             "small_vector<...>::emplace(pos,args): too long");
+        VALUE_TYPE *newData = this->allocateN((VALUE_TYPE *) 0, newCapacity);
+        Guard       guard(newData, newCapacity, this);
+
+        BloombergLP::bslalg::ScalarPrimitives::construct(
+                                                   newData + index,
+                    BSLS_COMPILERFEATURES_FORWARD(Args_1, args_1),
+                    BSLS_COMPILERFEATURES_FORWARD(Args_2, args_2),
+                                                   this->bslmaAllocator());
+        privateMoveAround(newData, newCapacity, index);
+        guard.release();
+    }
+    return d_dataBegin + index;
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+template <class Args_1,
+          class Args_2,
+          class Args_3>
+typename small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::iterator
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::emplace(
+                             const_iterator position,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(Args_1) args_1,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(Args_2) args_2,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(Args_3) args_3)
+{
+    BSLS_ASSERT_SAFE(d_dataBegin <= position);
+    BSLS_ASSERT_SAFE(position    <= d_dataEnd);
+
+    const size_type index = position - d_dataBegin;
+
+    if (d_dataEnd != d_dataBegin + d_capacity) {
+        BloombergLP::bslalg::ArrayPrimitives::emplace(
+                                                  d_dataBegin + index,
+                                                  d_dataEnd,
+                                                  1,
+                                                  this->bslmaAllocator(),
+                    BSLS_COMPILERFEATURES_FORWARD(Args_1, args_1),
+                    BSLS_COMPILERFEATURES_FORWARD(Args_2, args_2),
+                    BSLS_COMPILERFEATURES_FORWARD(Args_3, args_3));
+        ++d_dataEnd;
+    }
+    else {
+        // Construct the new element before moving the existing ones, which
+        // 'args' may refer to.
+
+        const size_type newCapacity = privateNewCapacity(
+                              1,
+                             "small_vector<...>::emplace(pos,args): too long");
+        VALUE_TYPE *newData = this->allocateN((VALUE_TYPE *) 0, newCapacity);
+        Guard       guard(newData, newCapacity, this);
+
+        BloombergLP::bslalg::ScalarPrimitives::construct(
+                                                   newData + index,
+                    BSLS_COMPILERFEATURES_FORWARD(Args_1, args_1),
+                    BSLS_COMPILERFEATURES_FORWARD(Args_2, args_2),
+                    BSLS_COMPILERFEATURES_FORWARD(Args_3, args_3),
+                                                   this->bslmaAllocator());
+        privateMoveAround(newData, newCapacity, index);
+        guard.release();
+    }
+    return d_dataBegin + index;
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+template <class Args_1,
+          class Args_2,
+          class Args_3,
+          class Args_4>
+typename small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::iterator
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::emplace(
+                             const_iterator position,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(Args_1) args_1,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(Args_2) args_2,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(Args_3) args_3,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(Args_4) args_4)
+{
+    BSLS_ASSERT_SAFE(d_dataBegin <= position);
+    BSLS_ASSERT_SAFE(position    <= d_dataEnd);
+
+    const size_type index = position - d_dataBegin;
+
+    if (d_dataEnd != d_dataBegin + d_capacity) {
+        BloombergLP::bslalg::ArrayPrimitives::emplace(
+                                                  d_dataBegin + index,
+                                                  d_dataEnd,
+                                                  1,
+                                                  this->bslmaAllocator(),
+                    BSLS_COMPILERFEATURES_FORWARD(Args_1, args_1),
+                    BSLS_COMPILERFEATURES_FORWARD(Args_2, args_2),
+                    BSLS_COMPILERFEATURES_FORWARD(Args_3, args_3),
+                    BSLS_COMPILERFEATURES_FORWARD(Args_4, args_4));
+        ++d_dataEnd;
+    }
+    else {
+        // Construct the new element before moving the existing ones, which
+        // 'args' may refer to.
+
+        const size_type newCapacity = privateNewCapacity(
+                              1,
+                             "small_vector<...>::emplace(pos,args): too long");
+        VALUE_TYPE *newData = this->allocateN((VALUE_TYPE *) 0, newCapacity);
+        Guard       guard(newData, newCapacity, this);
+
+        BloombergLP::bslalg::ScalarPrimitives::construct(
+                                                   newData + index,
+                    BSLS_COMPILERFEATURES_FORWARD(Args_1, args_1),
+                    BSLS_COMPILERFEATURES_FORWARD(Args_2, args_2),
+                    BSLS_COMPILERFEATURES_FORWARD(Args_3, args_3),
+                    BSLS_COMPILERFEATURES_FORWARD(Args_4, args_4),
+                                                   this->bslmaAllocator());
+        privateMoveAround(newData, newCapacity, index);
+        guard.release();
+    }
+    return d_dataBegin + index;
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+template <class Args_1,
+          class Args_2,
+          class Args_3,
+          class Args_4,
+          class Args_5>
+typename small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::iterator
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::emplace(
+                             const_iterator position,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(Args_1) args_1,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(Args_2) args_2,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(Args_3) args_3,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(Args_4) args_4,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(Args_5) args_5)
+{
+    BSLS_ASSERT_SAFE(d_dataBegin <= position);
+    BSLS_ASSERT_SAFE(position    <= d_dataEnd);
+
+    const size_type index = position - d_dataBegin;
+
+    if (d_dataEnd != d_dataBegin + d_capacity) {
+        BloombergLP::bslalg::ArrayPrimitives::emplace(
+                                                  d_dataBegin + index,
+                                                  d_dataEnd,
+                                                  1,
+                                                  this->bslmaAllocator(),
+                    BSLS_COMPILERFEATURES_FORWARD(Args_1, args_1),
+                    BSLS_COMPILERFEATURES_FORWARD(Args_2, args_2),
+                    BSLS_COMPILERFEATURES_FORWARD(Args_3, args_3),
+                    BSLS_COMPILERFEATURES_FORWARD(Args_4, args_4),
+                    BSLS_COMPILERFEATURES_FORWARD(Args_5, args_5));
+        ++d_dataEnd;
+    }
+    else {
+        // Construct the new element before moving the existing ones, which
+        // 'args' may refer to.
+
+        const size_type newCapacity = privateNewCapacity(
+                              1,
+                             "small_vector<...>::emplace(pos,args): too long");
+        VALUE_TYPE *newData = this->allocateN((VALUE_TYPE *) 0, newCapacity);
+        Guard       guard(newData, newCapacity, this);
+
+        BloombergLP::bslalg::ScalarPrimitives::construct(
+                                                   newData + index,
+                    BSLS_COMPILERFEATURES_FORWARD(Args_1, args_1),
+                    BSLS_COMPILERFEATURES_FORWARD(Args_2, args_2),
+                    BSLS_COMPILERFEATURES_FORWARD(Args_3, args_3),
+                    BSLS_COMPILERFEATURES_FORWARD(Args_4, args_4),
+                    BSLS_COMPILERFEATURES_FORWARD(Args_5, args_5),
+                                                   this->bslmaAllocator());
+        privateMoveAround(newData, newCapacity, index);
+        guard.release();
+    }
+    return d_dataBegin + index;
+}
+#else
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+template <class... Args>
+typename small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::iterator
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::emplace(
+                             const_iterator position,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(Args)... args)
+{
+    BSLS_ASSERT_SAFE(d_dataBegin <= position);
+    BSLS_ASSERT_SAFE(position    <= d_dataEnd);
+
+    const size_type index = position - d_dataBegin;
+
+    if (d_dataEnd != d_dataBegin + d_capacity) {
+        BloombergLP::bslalg::ArrayPrimitives::emplace(
+                                                  d_dataBegin + index,
+                                                  d_dataEnd,
+                                                  1,
+                                                  this->bslmaAllocator(),
+                    BSLS_COMPILERFEATURES_FORWARD(Args, args)...);
+        ++d_dataEnd;
+    }
+    else {
+        // Construct the new element before moving the existing ones, which
+        // 'args' may refer to.
+
+        const size_type newCapacity = privateNewCapacity(
+                              1,
+                             "small_vector<...>::emplace(pos,args): too long");
+        VALUE_TYPE *newData = this->allocateN((VALUE_TYPE *) 0, newCapacity);
+        Guard       guard(newData, newCapacity, this);
+
+        BloombergLP::bslalg::ScalarPrimitives::construct(
+                                                   newData + index,
+                    BSLS_COMPILERFEATURES_FORWARD(Args, args)...,
+                                                   this->bslmaAllocator());
+        privateMoveAround(newData, newCapacity, index);
+        guard.release();
+    }
+    return d_dataBegin + index;
+}
+// }}} END GENERATED CODE
+#endif
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::iterator
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::insert(
+                                                    const_iterator    position,
+                                                    const VALUE_TYPE& value)
+{
+    BSLS_ASSERT_SAFE(d_dataBegin <= position);
+    BSLS_ASSERT_SAFE(position    <= d_dataEnd);
+
+    const size_type index = position - d_dataBegin;
+    insert(position, size_type(1), value);
+    return d_dataBegin + index;
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+void small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::insert(
+                                                 const_iterator    position,
+                                                 size_type         numElements,
+                                                 const VALUE_TYPE& value)
+{
+    BSLS_ASSERT_SAFE(d_dataBegin <= position);
+    BSLS_ASSERT_SAFE(position    <= d_dataEnd);
+
+    const iterator pos = const_cast<iterator>(position);
+
+    if (numElements > d_capacity - size()) {
+        const size_type newCapacity = privateNewCapacity(
+                               numElements,
+                               "small_vector<...>::insert(pos,n,v): too long");
+        const size_type newSize     = size() + numElements;
+
+        VALUE_TYPE *newData = this->allocateN((VALUE_TYPE *) 0, newCapacity);
+        Guard       guard(newData, newCapacity, this);
+
+        BloombergLP::bslalg::ArrayPrimitives::destructiveMoveAndInsert(
+                                                       newData,
+                                                       &d_dataEnd,
+                                                       d_dataBegin,
+                                                       pos,
+                                                       d_dataEnd,
+                                                       value,
+                                                       numElements,
+                                                       this->bslmaAllocator());
+        guard.release();
+
+        d_dataEnd = d_dataBegin;
+        privateAdopt(newData, newCapacity);
+        d_dataEnd = newData + newSize;
+    }
+    else {
+        BloombergLP::bslalg::ArrayPrimitives::insert(pos,
+                                                     d_dataEnd,
+                                                     value,
+                                                     numElements,
+                                                     this->bslmaAllocator());
+        d_dataEnd += numElements;
+    }
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+template <class INPUT_ITER>
+inline
+void small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::insert(
+                                                       const_iterator position,
+                                                       INPUT_ITER     first,
+                                                       INPUT_ITER     last)
+{
+    BSLS_ASSERT_SAFE(d_dataBegin <= position);
+    BSLS_ASSERT_SAFE(position    <= d_dataEnd);
+
+    // If 'first' and 'last' are integral, then they are not iterators (see
+    // 'bsl::vector::insert').
+
+    privateInsertDispatch(position,
+                          first,
+                          last,
+                          first,
+                          BloombergLP::bslmf::Nil());
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::iterator
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::erase(
+                                                       const_iterator position)
+{
+    BSLS_ASSERT_SAFE(d_dataBegin <= position);
+    BSLS_ASSERT_SAFE(position    <  d_dataEnd);
+
+    return erase(position, position + 1);
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::iterator
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::erase(
+                                                          const_iterator first,
+                                                          const_iterator last)
+{
+    BSLS_ASSERT_SAFE(d_dataBegin <= first);
+    BSLS_ASSERT_SAFE(first       <= last);
+    BSLS_ASSERT_SAFE(last        <= d_dataEnd);
+
+    const size_type n = last - first;
+    BloombergLP::bslalg::ArrayPrimitives::erase(
+                                               const_cast<VALUE_TYPE *>(first),
+                                               const_cast<VALUE_TYPE *>(last),
+                                               d_dataEnd,
+                                               this->bslmaAllocator());
+    d_dataEnd -= n;
+    return const_cast<VALUE_TYPE *>(first);
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+void small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::swap(
+                                                           small_vector& other)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+                                   get_allocator() != other.get_allocator())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        small_vector v1(other, get_allocator());
+        small_vector v2(*this, other.get_allocator());
+
+        swap(v1);
+        other.swap(v2);
+        return;                                                       // RETURN
+    }
+
+    if (!is_inline() && !other.is_inline()) {
+        BloombergLP::bslalg::SwapUtil::swap(&d_dataBegin, &other.d_dataBegin);
+        BloombergLP::bslalg::SwapUtil::swap(&d_dataEnd,   &other.d_dataEnd);
+        BloombergLP::bslalg::SwapUtil::swap(&d_capacity,  &other.d_capacity);
+        return;                                                       // RETURN
+    }
+
+    small_vector temp(get_allocator());
+    temp.privateMoveFrom(this);
+    privateMoveFrom(&other);
+    other.privateMoveFrom(&temp);
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+void small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::clear()
+{
+    BloombergLP::bslalg::ArrayDestructionPrimitives::destroy(d_dataBegin,
+                                                             d_dataEnd);
+    d_dataEnd = d_dataBegin;
+}
+
+// ACCESSORS
+
+                             // *** iterators: ***
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::const_iterator
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::begin() const
+{
+    return d_dataBegin;
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::const_iterator
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::cbegin() const
+{
+    return d_dataBegin;
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::const_iterator
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::end() const
+{
+    return d_dataEnd;
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::const_iterator
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::cend() const
+{
+    return d_dataEnd;
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::
+                                                         const_reverse_iterator
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::rbegin() const
+{
+    return const_reverse_iterator(d_dataEnd);
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::
+                                                         const_reverse_iterator
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::crbegin() const
+{
+    return const_reverse_iterator(d_dataEnd);
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::
+                                                         const_reverse_iterator
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::rend() const
+{
+    return const_reverse_iterator(d_dataBegin);
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::
+                                                         const_reverse_iterator
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::crend() const
+{
+    return const_reverse_iterator(d_dataBegin);
+}
+
+                             // *** capacity: ***
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::size_type
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::size() const
+{
+    return d_dataEnd - d_dataBegin;
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::size_type
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::capacity() const
+{
+    return d_capacity;
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+bool small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::empty() const
+{
+    return d_dataEnd == d_dataBegin;
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+bool small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::is_inline() const
+{
+    return d_dataBegin == reinterpret_cast<const VALUE_TYPE *>(
+                                                            d_buffer.buffer());
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::size_type
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::max_size() const
+{
+    return ContainerBase::allocator().max_size();
+}
+
+                          // *** element access: ***
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::const_reference
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::operator[](
+                                                      size_type position) const
+{
+    BSLS_ASSERT_SAFE(position < size());
+
+    return d_dataBegin[position];
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+typename small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::const_reference
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::at(
+                                                      size_type position) const
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(position >= size())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        BloombergLP::bslstl::StdExceptUtil::throwOutOfRange(
+                                 "small_vector<...>::at(n): invalid position");
+    }
+    return d_dataBegin[position];
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::const_reference
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::front() const
+{
+    BSLS_ASSERT_SAFE(!empty());
+
+    return *d_dataBegin;
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::const_reference
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::back() const
+{
+    BSLS_ASSERT_SAFE(!empty());
+
+    return *(d_dataEnd - 1);
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+const VALUE_TYPE *
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::data() const
+{
+    return d_dataBegin;
+}
+
+                             // *** allocator: ***
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::allocator_type
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::get_allocator() const
+{
+    return ContainerBase::allocator();
+}
+
+// FREE OPERATORS
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+bool operator==(
+               const small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>& lhs,
+               const small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>& rhs)
+{
+    return BloombergLP::bslalg::RangeCompare::equal(lhs.begin(),
+                                                    lhs.end(),
+                                                    lhs.size(),
+                                                    rhs.begin(),
+                                                    rhs.end(),
+                                                    rhs.size());
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+bool operator!=(
+               const small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>& lhs,
+               const small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+bool operator<(
+               const small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>& lhs,
+               const small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>& rhs)
+{
+    return 0 > BloombergLP::bslalg::RangeCompare::lexicographical(lhs.begin(),
+                                                                  lhs.end(),
+                                                                  lhs.size(),
+                                                                  rhs.begin(),
+                                                                  rhs.end(),
+                                                                  rhs.size());
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+bool operator>(
+               const small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>& lhs,
+               const small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>& rhs)
+{
+    return rhs < lhs;
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+bool operator<=(
+               const small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>& lhs,
+               const small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>& rhs)
+{
+    return !(rhs < lhs);
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+bool operator>=(
+               const small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>& lhs,
+               const small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>& rhs)
+{
+    return !(lhs < rhs);
+}
+
+// FREE FUNCTIONS
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+void swap(small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>& a,
+          small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>& b)
+{
+    a.swap(b);
+}
+
+}  // close namespace bsl
+
+// ============================================================================
+//                                TYPE TRAITS
+// ============================================================================
+
+// Type traits for STL *sequence* containers:
+//: o A sequence container defines STL iterators.
+//: o A sequence container uses 'bslma' allocators if the parameterized
+//:     'ALLOCATOR' is convertible from 'bslma::Allocator*'.
+// Note that 'small_vector' is not bitwise moveable, as it may hold the
+// address of its own inline buffer.
+
+namespace BloombergLP {
+
+namespace bslalg {
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+struct HasStlIterators<
+                    bsl::small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR> >
+    : bsl::true_type
+{};
+
+}  // close package namespace
+
+namespace bslma {
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+struct UsesBslmaAllocator<
+                    bsl::small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR> >
+    : bsl::is_convertible<Allocator*, ALLOCATOR>::type
+{};
+
+}  // close package namespace
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1479 @@
+// bslstl_smallvector.t.cpp                                           -*-C++-*-
+
+#include <bslstl_smallvector.h>
+
+#include <bslstl_allocator.h>
+#include <bslstl_vector.h>
+
+#include <bslma_default.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatorexception.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_isbitwisemoveable.h>
+
+#include <bsls_bsltestutil.h>
+#include <bsls_exceptionutil.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <bsltf_templatetestfacility.h>
+#include <bsltf_testvaluesarray.h>
+
+#include <iterator>
+#include <sstream>
+#include <stdexcept>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                             TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test is a container having the interface of
+// 'bsl::vector', whose elements are stored either in a buffer within its
+// footprint or in memory obtained from its allocator.  The primary concern is
+// that every operation is correct on both sides of, and across, the boundary
+// between the two storage modes, which is tested by comparing the container,
+// for every size, position, and number of elements up to a few times the
+// inline capacity, with an oracle 'bsl::vector' of element identifiers.  The
+// container is instantiated for the regular test types of 'bsltf', so that
+// the paths for bitwise-moveable types and for types that use 'bslma'
+// allocators are both exercised.  Operations that allocate are tested for
+// exception neutrality with 'bslma::TestAllocator', and the absence of
+// allocations while the elements fit inline is verified throughout.
+//-----------------------------------------------------------------------------
+// CREATORS
+// [ 2] small_vector(const ALLOCATOR& basicAllocator = ALLOCATOR());
+// [ 5] small_vector(size_type initialSize, const ALLOCATOR& = ALLOCATOR());
+// [ 5] small_vector(size_type, const VALUE_TYPE&, const ALLOCATOR& = A());
+// [ 7] small_vector(INPUT_ITER first, INPUT_ITER last, const A& = A());
+// [ 3] small_vector(const small_vector& original);
+// [ 3] small_vector(const small_vector& original, const ALLOCATOR& alloc);
+// [ 2] ~small_vector();
+//
+// MANIPULATORS
+// [ 3] small_vector& operator=(const small_vector& rhs);
+// [ 7] void assign(INPUT_ITER first, INPUT_ITER last);
+// [ 5] void assign(size_type numElements, const VALUE_TYPE& value);
+// [ 2] iterator begin();
+// [ 2] iterator end();
+// [ 2] reverse_iterator rbegin();
+// [ 2] reverse_iterator rend();
+// [ 2] reference operator[](size_type position);
+// [ 7] reference at(size_type position);
+// [ 2] reference front();
+// [ 2] reference back();
+// [ 2] VALUE_TYPE *data();
+// [ 5] void resize(size_type newSize);
+// [ 5] void resize(size_type newSize, const VALUE_TYPE& value);
+// [ 5] void reserve(size_type newCapacity);
+// [ 5] void shrink_to_fit();
+// [ 4] void emplace_back(Args&&... args);
+// [ 2] void push_back(const VALUE_TYPE& value);
+// [ 4] void pop_back();
+// [ 4] iterator emplace(const_iterator position, Args&&... args);
+// [ 4] iterator insert(const_iterator position, const VALUE_TYPE& value);
+// [ 4] void insert(const_iterator pos, size_type n, const VALUE_TYPE& v);
+// [ 4] void insert(const_iterator pos, INPUT_ITER first, INPUT_ITER last);
+// [ 4] iterator erase(const_iterator position);
+// [ 4] iterator erase(const_iterator first, const_iterator last);
+// [ 6] void swap(small_vector& other);
+// [ 2] void clear();
+//
+// ACCESSORS
+// [ 2] const_iterator begin() const;
+// [ 2] const_iterator end() const;
+// [ 2] size_type size() const;
+// [ 2] size_type capacity() const;
+// [ 2] bool empty() const;
+// [ 2] bool is_inline() const;
+// [ 7] size_type max_size() const;
+// [ 2] const_reference operator[](size_type position) const;
+// [ 7] const_reference at(size_type position) const;
+// [ 3] allocator_type get_allocator() const;
+//
+// FREE OPERATORS
+// [ 3] bool operator==(const small_vector& lhs, const small_vector& rhs);
+// [ 3] bool operator!=(const small_vector& lhs, const small_vector& rhs);
+// [ 7] bool operator<(const small_vector& lhs, const small_vector& rhs);
+// [ 7] bool operator>(const small_vector& lhs, const small_vector& rhs);
+// [ 7] bool operator<=(const small_vector& lhs, const small_vector& rhs);
+// [ 7] bool operator>=(const small_vector& lhs, const small_vector& rhs);
+// [ 6] void swap(small_vector& a, small_vector& b);
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 8] USAGE EXAMPLE
+// [-1] PERFORMANCE TEST
+
+//=============================================================================
+//                  STANDARD BDE ASSERT TEST MACRO
+//-----------------------------------------------------------------------------
+static int testStatus = 0;
+
+static void aSsErT(bool b, const char *s, int i) {
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+//=============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+#define RUN_EACH_TYPE BSLTF_TEMPLATETESTFACILITY_RUN_EACH_TYPE
+
+typedef bsltf::TemplateTestFacility TTF;
+
+static bool             verbose;
+static bool         veryVerbose;
+static bool     veryVeryVerbose;
+static bool veryVeryVeryVerbose;
+
+enum { k_INLINE_CAPACITY = 4 };
+
+static const int MAX_SIZE = 3 * k_INLINE_CAPACITY;  // largest size tested
+
+//=============================================================================
+//                  GLOBAL HELPER CLASSES FOR TESTING
+//-----------------------------------------------------------------------------
+
+                            // ================
+                            // class TestDriver
+                            // ================
+
+template <class TYPE>
+struct TestDriver {
+    // This templatized struct provides a namespace for testing the
+    // 'small_vector' container, instantiated with an inline capacity of
+    // 'k_INLINE_CAPACITY'.
+
+    // TYPES
+    typedef bsl::small_vector<TYPE, k_INLINE_CAPACITY> Obj;
+    typedef bsl::vector<int>                           Oracle;
+        // Identifiers of the expected elements.
+
+    typedef bsltf::TestValuesArray<TYPE>               TestValues;
+
+    // CLASS METHODS
+    static void fill(Obj *object, int size, const TestValues& values);
+        // Append to the specified 'object' the first of the specified
+        // 'values', up to the specified 'size' elements.
+
+    static void fill(Oracle *oracle, int size);
+        // Append to the specified 'oracle' the identifiers of the first
+        // 'TestValues' values, up to the specified 'size' elements.
+
+    static bool matches(const Obj& object, const Oracle& oracle);
+        // Return 'true' if the specified 'object' holds the elements whose
+        // identifiers are held by the specified 'oracle', and has a
+        // consistent capacity and storage mode, and 'false' otherwise.
+
+    static void testCase2();
+        // Test primary manipulators and basic accessors.
+
+    static void testCase3();
+        // Test copy construction, assignment, and equality.
+
+    static void testCase4();
+        // Test insertion and erasure.
+
+    static void testCase5();
+        // Test capacity and sizing operations.
+
+    static void testCase6();
+        // Test 'swap'.
+};
+
+template <class TYPE>
+void TestDriver<TYPE>::fill(Obj *object, int size, const TestValues& values)
+{
+    for (int i = 0; i < size; ++i) {
+        object->push_back(values[i]);
+    }
+}
+
+template <class TYPE>
+void TestDriver<TYPE>::fill(Oracle *oracle, int size)
+{
+    TestValues values;
+    for (int i = 0; i < size; ++i) {
+        oracle->push_back(TTF::getIdentifier(values[i]));
+    }
+}
+
+template <class TYPE>
+bool TestDriver<TYPE>::matches(const Obj& object, const Oracle& oracle)
+{
+    if (object.size() != oracle.size()
+     || object.capacity() < object.size()
+     || object.is_inline() != (k_INLINE_CAPACITY == object.capacity())
+     || object.empty() != oracle.empty()
+     || static_cast<size_t>(object.end() - object.begin())
+                                                            != oracle.size()) {
+        return false;                                                 // RETURN
+    }
+    for (size_t i = 0; i < oracle.size(); ++i) {
+        if (TTF::getIdentifier(object[i]) != oracle[i]) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+template <class TYPE>
+void TestDriver<TYPE>::testCase2()
+{
+    // ------------------------------------------------------------------------
+    // PRIMARY MANIPULATORS AND BASIC ACCESSORS
+    //
+    // Concerns:
+    //: 1 A default-constructed object is empty, stores its elements inline,
+    //:   has a capacity of 'INLINE_CAPACITY', and allocates no memory.
+    //:
+    //: 2 'push_back' appends a copy of its argument; no memory is allocated
+    //:   until the size exceeds 'INLINE_CAPACITY', after which the elements
+    //:   are stored in a single block obtained from the allocator.
+    //:
+    //: 3 Elements using 'bslma' allocators are supplied the allocator of the
+    //:   container, in either storage mode.
+    //:
+    //: 4 'push_back' provides the strong guarantee, in particular when the
+    //:   elements move out of the inline buffer, and is exception neutral.
+    //:
+    //: 5 'push_back' of an element of the container itself is supported.
+    //:
+    //: 6 'clear' destroys the elements, but retains the capacity and storage
+    //:   mode.
+    //:
+    //: 7 The iterators and element accessors refer to the elements, in
+    //:   order.
+    //:
+    //: 8 No memory is leaked, and the default allocator is not used.
+    //
+    // Plan:
+    //: 1 For each size up to 'MAX_SIZE', create an object and append values,
+    //:   verifying the state and the allocations after each append.  (C-1..3,
+    //:   7)
+    //:
+    //: 2 Repeat P-1 within the exception-test loop, verifying the value on
+    //:   exception with a guard.  (C-4)
+    //:
+    //: 3 Append the front element, then clear the object.  (C-5..6)
+    //:
+    //: 4 Verify the allocators on exit.  (C-8)
+    // ------------------------------------------------------------------------
+
+    bslma::TestAllocator da("default",   veryVeryVeryVerbose);
+    bslma::TestAllocator oa("object",    veryVeryVeryVerbose);
+    bslma::TestAllocator sa("scratch",   veryVeryVeryVerbose);
+    bslma::Default::setDefaultAllocatorRaw(&da);
+
+    const TestValues VALUES;
+
+    const bool USES_BSLMA = bslma::UsesBslmaAllocator<TYPE>::value;
+
+    for (int ti = 0; ti <= MAX_SIZE; ++ti) {
+        const int SIZE = ti;
+
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+
+            ASSERTV(SIZE, X.empty());
+            ASSERTV(SIZE, X.is_inline());
+            ASSERTV(SIZE, k_INLINE_CAPACITY == X.capacity());
+            ASSERTV(SIZE, 0 == oa.numBlocksInUse());
+
+            Oracle expected(&sa);
+            for (int i = 0; i < SIZE; ++i) {
+                mX.push_back(VALUES[i]);
+                expected.push_back(TTF::getIdentifier(VALUES[i]));
+
+                ASSERTV(SIZE, i, matches(X, expected));
+                ASSERTV(SIZE, i, (i < k_INLINE_CAPACITY) == X.is_inline());
+                if (!USES_BSLMA) {
+                    ASSERTV(SIZE, i, oa.numBlocksInUse(),
+                            (i < k_INLINE_CAPACITY ? 0 : 1) ==
+                                                         oa.numBlocksInUse());
+                }
+                else {
+                    ASSERTV(SIZE, i,
+                        i + 1 + (i < k_INLINE_CAPACITY ? 0 : 1) ==
+                                                         oa.numBlocksInUse());
+                }
+            }
+
+            // Iterators and accessors.
+
+            ASSERTV(SIZE, X.begin() == X.data());
+            ASSERTV(SIZE, X.cbegin() == X.begin());
+            ASSERTV(SIZE, X.cend() == X.end());
+            ASSERTV(SIZE, X.end() == mX.end());
+            ASSERTV(SIZE, SIZE == X.rend() - X.rbegin());
+            ASSERTV(SIZE, SIZE == mX.rend() - mX.rbegin());
+            ASSERTV(SIZE, SIZE == X.crend() - X.crbegin());
+            if (SIZE) {
+                ASSERTV(SIZE, TTF::getIdentifier(VALUES[0]) ==
+                                                TTF::getIdentifier(X.front()));
+                ASSERTV(SIZE, TTF::getIdentifier(VALUES[SIZE - 1]) ==
+                                                 TTF::getIdentifier(X.back()));
+                ASSERTV(SIZE, TTF::getIdentifier(VALUES[SIZE - 1]) ==
+                                              TTF::getIdentifier(*X.rbegin()));
+                ASSERTV(SIZE, TTF::getIdentifier(mX.front()) ==
+                                               TTF::getIdentifier(*mX.data()));
+                ASSERTV(SIZE, TTF::getIdentifier(mX.back()) ==
+                                             TTF::getIdentifier(*mX.rbegin()));
+            }
+
+            // Aliasing.
+
+            if (SIZE) {
+                mX.push_back(X[0]);
+                expected.push_back(expected[0]);
+                ASSERTV(SIZE, matches(X, expected));
+            }
+
+            // 'clear'
+
+            const size_t CAPACITY  = X.capacity();
+            const bool   IS_INLINE = X.is_inline();
+
+            mX.clear();
+
+            ASSERTV(SIZE, X.empty());
+            ASSERTV(SIZE, CAPACITY  == X.capacity());
+            ASSERTV(SIZE, IS_INLINE == X.is_inline());
+            ASSERTV(SIZE, (IS_INLINE ? 0 : 1) == oa.numBlocksInUse());
+        }
+        ASSERTV(SIZE, 0 == oa.numBlocksInUse());
+
+        // Exception safety.
+
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+
+            for (int i = 0; i < SIZE; ++i) {
+                Obj mY(X, &sa);  const Obj& Y = mY;
+
+                BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                    ASSERTV(SIZE, i, Y == X);
+
+                    mX.push_back(VALUES[i]);
+                } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+                ASSERTV(SIZE, i, X.size() == Y.size() + 1);
+                ASSERTV(SIZE, i, TTF::getIdentifier(VALUES[i]) ==
+                                                 TTF::getIdentifier(X.back()));
+            }
+        }
+        ASSERTV(SIZE, 0 == oa.numBlocksInUse());
+    }
+
+    ASSERT(0 == da.numBlocksTotal());
+}
+
+template <class TYPE>
+void TestDriver<TYPE>::testCase3()
+{
+    // ------------------------------------------------------------------------
+    // COPY CONSTRUCTION, ASSIGNMENT, AND EQUALITY
+    //
+    // Concerns:
+    //: 1 A copy has the value of the original, and the same storage mode for
+    //:   the same size.
+    //:
+    //: 2 A copy created without an allocator uses the default allocator (the
+    //:   allocator of the original is not propagated), and one created with
+    //:   an allocator uses that allocator.
+    //:
+    //: 3 Assignment gives the target the value of the source, for every
+    //:   combination of sizes and storage modes, without changing the
+    //:   allocator of the target, and self-assignment has no effect.
+    //:
+    //: 4 Equality compares the elements, and not the storage mode or the
+    //:   capacity.
+    //:
+    //: 5 Assignment is exception neutral.
+    //
+    // Plan:
+    //: 1 For each pair of sizes up to 'MAX_SIZE', create objects and verify
+    //:   copies, assignment, and equality against the oracle.  (C-1..4)
+    //:
+    //: 2 Perform the assignment within the exception-test loop.  (C-5)
+    // ------------------------------------------------------------------------
+
+    bslma::TestAllocator da("default",   veryVeryVeryVerbose);
+    bslma::TestAllocator oa("object",    veryVeryVeryVerbose);
+    bslma::TestAllocator za("other",     veryVeryVeryVerbose);
+    bslma::TestAllocator sa("scratch",   veryVeryVeryVerbose);
+    bslma::Default::setDefaultAllocatorRaw(&da);
+
+    const TestValues VALUES;
+
+    for (int ti = 0; ti <= MAX_SIZE; ++ti) {
+        const int SIZE_X = ti;
+
+        Oracle expected(&sa);
+        fill(&expected, SIZE_X);
+
+        Obj mX(&oa);  const Obj& X = mX;
+        fill(&mX, SIZE_X, VALUES);
+
+        {
+            const Obj Y(X);
+
+            ASSERTV(SIZE_X, matches(Y, expected));
+            ASSERTV(SIZE_X, X == Y);
+            ASSERTV(SIZE_X, !(X != Y));
+            ASSERTV(SIZE_X, &da == Y.get_allocator().mechanism());
+            ASSERTV(SIZE_X, X.is_inline() == Y.is_inline());
+
+            const Obj Z(X, &za);
+
+            ASSERTV(SIZE_X, matches(Z, expected));
+            ASSERTV(SIZE_X, X == Z);
+            ASSERTV(SIZE_X, &za == Z.get_allocator().mechanism());
+        }
+        ASSERTV(SIZE_X, 0 == da.numBlocksInUse());
+        ASSERTV(SIZE_X, 0 == za.numBlocksInUse());
+
+        // Self-assignment.
+
+        {
+            const bsls::Types::Int64 NUM_ALLOCATIONS = oa.numAllocations();
+
+            mX = X;
+
+            ASSERTV(SIZE_X, matches(X, expected));
+            ASSERTV(SIZE_X, NUM_ALLOCATIONS == oa.numAllocations());
+        }
+
+        for (int tj = 0; tj <= MAX_SIZE; ++tj) {
+            const int SIZE_Y = tj;
+
+            Obj mY(&za);  const Obj& Y = mY;
+            for (int i = 0; i < SIZE_Y; ++i) {
+                mY.push_back(VALUES[SIZE_Y - i]);
+            }
+
+            ASSERTV(SIZE_X, SIZE_Y, (X == Y) == (0 == SIZE_X && 0 == SIZE_Y));
+            ASSERTV(SIZE_X, SIZE_Y, (X != Y) == !(X == Y));
+
+            BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(za) {
+                Obj *mR = &(mY = X);
+                ASSERTV(SIZE_X, SIZE_Y, mR == &mY);
+            } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+            ASSERTV(SIZE_X, SIZE_Y, matches(Y, expected));
+            ASSERTV(SIZE_X, SIZE_Y, X == Y);
+            ASSERTV(SIZE_X, SIZE_Y, &za == Y.get_allocator().mechanism());
+        }
+        ASSERTV(SIZE_X, 0 == za.numBlocksInUse());
+    }
+    ASSERT(0 == oa.numBlocksInUse());
+}
+
+template <class TYPE>
+void TestDriver<TYPE>::testCase4()
+{
+    // ------------------------------------------------------------------------
+    // INSERTION AND ERASURE
+    //
+    // Concerns:
+    //: 1 'insert' of 'n' copies of a value, of a single value, and of a range
+    //:   of forward iterators, and 'emplace', insert the elements at the
+    //:   specified position, for every size, position, and number of
+    //:   elements, in particular when the elements move out of the inline
+    //:   buffer.
+    //:
+    //: 2 Inserting an element of the container itself is supported.
+    //:
+    //: 3 The returned iterators refer to the first inserted element.
+    //:
+    //: 4 'emplace_back' appends an element and 'pop_back' removes the last
+    //:   element.
+    //:
+    //: 5 'erase' removes the specified elements and returns an iterator to
+    //:   the element following them, without changing the capacity.
+    //:
+    //: 6 Insertion is exception neutral, and no memory is leaked.
+    //
+    // Plan:
+    //: 1 For each size up to 'MAX_SIZE', position, and number of elements to
+    //:   insert, perform each operation (within the exception-test loop) on
+    //:   an object, apply the same operation to an oracle, and compare the
+    //:   two.  (C-1..4, 6)
+    //:
+    //: 2 For each size and each range of positions, erase the range and
+    //:   compare with the oracle.  (C-5)
+    // ------------------------------------------------------------------------
+
+    bslma::TestAllocator da("default",   veryVeryVeryVerbose);
+    bslma::TestAllocator oa("object",    veryVeryVeryVerbose);
+    bslma::TestAllocator sa("scratch",   veryVeryVeryVerbose);
+    bslma::Default::setDefaultAllocatorRaw(&da);
+
+    const TestValues VALUES;
+
+    bsl::vector<TYPE> source(&sa);
+    for (int i = 0; i < MAX_SIZE; ++i) {
+        source.push_back(VALUES[MAX_SIZE + i]);
+    }
+
+    for (int ti = 0; ti <= MAX_SIZE; ++ti) {
+        const int SIZE = ti;
+
+        for (int pos = 0; pos <= SIZE; ++pos) {
+            for (int n = 0; n <= MAX_SIZE - SIZE; ++n) {
+                const int ID = TTF::getIdentifier(VALUES[MAX_SIZE]);
+
+                // 'insert(pos, n, value)'
+
+                {
+                    Oracle expected(&sa);
+                    fill(&expected, SIZE);
+                    expected.insert(expected.begin() + pos, n, ID);
+
+                    Obj mX(&oa);  const Obj& X = mX;
+
+                    BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                        mX.clear();
+                        fill(&mX, SIZE, VALUES);
+
+                        mX.insert(X.begin() + pos, n, VALUES[MAX_SIZE]);
+                    } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+                    ASSERTV(SIZE, pos, n, matches(X, expected));
+                }
+                ASSERTV(SIZE, pos, n, 0 == oa.numBlocksInUse());
+
+                // 'insert(pos, first, last)'
+
+                {
+                    Oracle expected(&sa);
+                    fill(&expected, SIZE);
+                    for (int i = 0; i < n; ++i) {
+                        expected.insert(expected.begin() + pos + i,
+                                        TTF::getIdentifier(source[i]));
+                    }
+
+                    Obj mX(&oa);  const Obj& X = mX;
+
+                    BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                        mX.clear();
+                        fill(&mX, SIZE, VALUES);
+
+                        mX.insert(X.begin() + pos,
+                                  source.begin(),
+                                  source.begin() + n);
+                    } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+                    ASSERTV(SIZE, pos, n, matches(X, expected));
+                }
+                ASSERTV(SIZE, pos, n, 0 == oa.numBlocksInUse());
+            }
+
+            // 'insert(pos, value)' and 'emplace(pos, value)', including of
+            // elements of the container itself
+
+            for (int alias = 0; alias < 2; ++alias) {
+                if (alias && 0 == SIZE) {
+                    continue;
+                }
+                const int ID = alias ? TTF::getIdentifier(VALUES[SIZE - 1])
+                                     : TTF::getIdentifier(VALUES[MAX_SIZE]);
+
+                Oracle expected(&sa);
+                fill(&expected, SIZE);
+                expected.insert(expected.begin() + pos, ID);
+
+                {
+                    Obj mX(&oa);  const Obj& X = mX;
+
+                    BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                        mX.clear();
+                        fill(&mX, SIZE, VALUES);
+
+                        typename Obj::iterator it =
+                                mX.insert(X.begin() + pos,
+                                          alias ? X.back() : VALUES[MAX_SIZE]);
+                        ASSERTV(SIZE, pos, alias, it == X.begin() + pos);
+                    } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+                    ASSERTV(SIZE, pos, alias, matches(X, expected));
+                }
+                if (!alias) {
+                    // As for 'bsl::vector', the arguments to 'emplace' must
+                    // not refer to elements of the container.
+
+                    Obj mX(&oa);  const Obj& X = mX;
+
+                    BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                        mX.clear();
+                        fill(&mX, SIZE, VALUES);
+
+                        typename Obj::iterator it =
+                                 mX.emplace(X.begin() + pos, VALUES[MAX_SIZE]);
+                        ASSERTV(SIZE, pos, alias, it == X.begin() + pos);
+                    } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+                    ASSERTV(SIZE, pos, alias, matches(X, expected));
+                }
+                ASSERTV(SIZE, pos, 0 == oa.numBlocksInUse());
+            }
+        }
+
+        // 'emplace_back' and 'pop_back'
+
+        {
+            Oracle expected(&sa);
+            fill(&expected, SIZE);
+            expected.push_back(TTF::getIdentifier(VALUES[MAX_SIZE]));
+
+            Obj mX(&oa);  const Obj& X = mX;
+            fill(&mX, SIZE, VALUES);
+
+            mX.emplace_back(VALUES[MAX_SIZE]);
+            ASSERTV(SIZE, matches(X, expected));
+
+            mX.pop_back();
+            expected.pop_back();
+            ASSERTV(SIZE, matches(X, expected));
+        }
+
+        // 'erase'
+
+        for (int first = 0; first <= SIZE; ++first) {
+            for (int last = first; last <= SIZE; ++last) {
+                Oracle expected(&sa);
+                fill(&expected, SIZE);
+                expected.erase(expected.begin() + first,
+                               expected.begin() + last);
+
+                Obj mX(&oa);  const Obj& X = mX;
+                fill(&mX, SIZE, VALUES);
+
+                const size_t CAPACITY = X.capacity();
+
+                typename Obj::iterator it = mX.erase(X.begin() + first,
+                                                     X.begin() + last);
+
+                ASSERTV(SIZE, first, last, it == X.begin() + first);
+                ASSERTV(SIZE, first, last, matches(X, expected));
+                ASSERTV(SIZE, first, last, CAPACITY == X.capacity());
+
+                if (first < static_cast<int>(X.size())) {
+                    expected.erase(expected.begin() + first);
+                    it = mX.erase(X.begin() + first);
+
+                    ASSERTV(SIZE, first, last, it == X.begin() + first);
+                    ASSERTV(SIZE, first, last, matches(X, expected));
+                }
+            }
+        }
+        ASSERTV(SIZE, 0 == oa.numBlocksInUse());
+    }
+
+    // 'emplace' within the capacity creates a temporary element (from the
+    // default allocator), as does that of 'bsl::vector'.
+
+    ASSERT(0 == da.numBlocksInUse());
+}
+
+template <class TYPE>
+void TestDriver<TYPE>::testCase5()
+{
+    // ------------------------------------------------------------------------
+    // CAPACITY AND SIZING
+    //
+    // Concerns:
+    //: 1 'reserve' allocates only to increase the capacity beyond its current
+    //:   value, and preserves the elements.
+    //:
+    //: 2 'resize' appends default-constructed elements or copies of a value,
+    //:   or erases elements at the end.
+    //:
+    //: 3 'shrink_to_fit' moves the elements back into the inline buffer if
+    //:   they fit, and otherwise reduces the capacity to the size.
+    //:
+    //: 4 The sizing constructors and 'assign' create the specified number of
+    //:   elements, inline if they fit.
+    //:
+    //: 5 The operations are exception neutral.
+    //
+    // Plan:
+    //: 1 For each pair of sizes up to 'MAX_SIZE', apply each operation and
+    //:   verify the value, capacity, storage mode, and allocations.
+    //:   (C-1..5)
+    // ------------------------------------------------------------------------
+
+    bslma::TestAllocator da("default",   veryVeryVeryVerbose);
+    bslma::TestAllocator oa("object",    veryVeryVeryVerbose);
+    bslma::TestAllocator sa("scratch",   veryVeryVeryVerbose);
+    bslma::Default::setDefaultAllocatorRaw(&da);
+
+    const TestValues VALUES;
+
+    const int ID = TTF::getIdentifier(VALUES[MAX_SIZE]);
+
+    for (int ti = 0; ti <= MAX_SIZE; ++ti) {
+        const int SIZE = ti;
+
+        Oracle expected(&sa);
+        fill(&expected, SIZE);
+
+        // Sizing constructors and 'assign'.
+
+        {
+            const Obj X(SIZE, VALUES[MAX_SIZE], &oa);
+
+            ASSERTV(SIZE, static_cast<size_t>(SIZE) == X.size());
+            ASSERTV(SIZE, (SIZE <= k_INLINE_CAPACITY) == X.is_inline());
+            for (int i = 0; i < SIZE; ++i) {
+                ASSERTV(SIZE, i, ID == TTF::getIdentifier(X[i]));
+            }
+
+            Obj mY(SIZE, &oa);  const Obj& Y = mY;
+
+            ASSERTV(SIZE, static_cast<size_t>(SIZE) == Y.size());
+            ASSERTV(SIZE, (SIZE <= k_INLINE_CAPACITY) == Y.is_inline());
+
+            mY.assign(SIZE + 1, VALUES[MAX_SIZE]);
+
+            ASSERTV(SIZE, static_cast<size_t>(SIZE + 1) == Y.size());
+            for (int i = 0; i <= SIZE; ++i) {
+                ASSERTV(SIZE, i, ID == TTF::getIdentifier(Y[i]));
+            }
+        }
+        ASSERTV(SIZE, 0 == oa.numBlocksInUse());
+
+        for (int tj = 0; tj <= MAX_SIZE; ++tj) {
+            const int NEW = tj;
+
+            // 'reserve'
+
+            {
+                Obj mX(&oa);  const Obj& X = mX;
+                fill(&mX, SIZE, VALUES);
+
+                const size_t             CAPACITY = X.capacity();
+                const bsls::Types::Int64 NUM_ALLOC = oa.numAllocations();
+
+                BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                    mX.reserve(NEW);
+                } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+                ASSERTV(SIZE, NEW, matches(X, expected));
+                if (static_cast<size_t>(NEW) <= CAPACITY) {
+                    ASSERTV(SIZE, NEW, CAPACITY  == X.capacity());
+                    ASSERTV(SIZE, NEW, NUM_ALLOC == oa.numAllocations());
+                }
+                else {
+                    ASSERTV(SIZE, NEW, static_cast<size_t>(NEW) <=
+                                                                 X.capacity());
+                    ASSERTV(SIZE, NEW, !X.is_inline());
+                }
+            }
+
+            // 'resize'
+
+            {
+                Oracle expectedResize(expected, &sa);
+                expectedResize.resize(NEW, ID);
+
+                Obj mX(&oa);  const Obj& X = mX;
+
+                BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                    mX.clear();
+                    fill(&mX, SIZE, VALUES);
+
+                    mX.resize(NEW, VALUES[MAX_SIZE]);
+                } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+                ASSERTV(SIZE, NEW, matches(X, expectedResize));
+
+                Obj mY(&oa);  const Obj& Y = mY;
+                fill(&mY, SIZE, VALUES);
+
+                mY.resize(NEW);
+
+                ASSERTV(SIZE, NEW, static_cast<size_t>(NEW) == Y.size());
+                for (int i = 0; i < SIZE && i < NEW; ++i) {
+                    ASSERTV(SIZE, NEW, i, expected[i] ==
+                                                   TTF::getIdentifier(Y[i]));
+                }
+            }
+        }
+
+        // 'shrink_to_fit'
+
+        for (int reserve = 0; reserve <= 2 * MAX_SIZE; reserve += 5) {
+            Obj mX(&oa);  const Obj& X = mX;
+
+            mX.reserve(reserve);
+            fill(&mX, SIZE, VALUES);
+
+            BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                mX.shrink_to_fit();
+            } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+            ASSERTV(SIZE, reserve, matches(X, expected));
+            if (SIZE <= k_INLINE_CAPACITY) {
+                ASSERTV(SIZE, reserve, X.is_inline());
+                ASSERTV(SIZE, reserve, k_INLINE_CAPACITY == X.capacity());
+            }
+            else {
+                ASSERTV(SIZE, reserve, static_cast<size_t>(SIZE) ==
+                                                                 X.capacity());
+            }
+        }
+        ASSERTV(SIZE, 0 == oa.numBlocksInUse());
+    }
+    ASSERT(0 == da.numBlocksTotal());
+}
+
+template <class TYPE>
+void TestDriver<TYPE>::testCase6()
+{
+    // ------------------------------------------------------------------------
+    // SWAP
+    //
+    // Concerns:
+    //: 1 'swap' (member and free) exchanges the values of the objects, for
+    //:   every combination of sizes and storage modes, but not their
+    //:   allocators.
+    //:
+    //: 2 If the allocators are the same and neither object stores its
+    //:   elements inline, no memory is allocated and the blocks are
+    //:   exchanged.
+    //:
+    //: 3 If the allocators differ, each object's elements are allocated from
+    //:   its own allocator, and no memory is leaked.
+    //
+    // Plan:
+    //: 1 For each pair of sizes up to 'MAX_SIZE', with the same and with
+    //:   different allocators, swap two objects and verify their values,
+    //:   allocators, and allocations.  (C-1..3)
+    // ------------------------------------------------------------------------
+
+    bslma::TestAllocator da("default",   veryVeryVeryVerbose);
+    bslma::TestAllocator oa("object",    veryVeryVeryVerbose);
+    bslma::TestAllocator za("other",     veryVeryVeryVerbose);
+    bslma::TestAllocator sa("scratch",   veryVeryVeryVerbose);
+    bslma::Default::setDefaultAllocatorRaw(&da);
+
+    const TestValues VALUES;
+
+    for (int ti = 0; ti <= MAX_SIZE; ++ti) {
+        const int SIZE_X = ti;
+
+        Oracle expectedX(&sa);
+        fill(&expectedX, SIZE_X);
+
+        for (int tj = 0; tj <= MAX_SIZE; ++tj) {
+            const int SIZE_Y = tj;
+
+            Oracle expectedY(&sa);
+            for (int i = 0; i < SIZE_Y; ++i) {
+                expectedY.push_back(TTF::getIdentifier(VALUES[SIZE_Y - i]));
+            }
+
+            for (int same = 0; same < 2; ++same) {
+                bslma::TestAllocator& ya = same ? oa : za;
+
+                Obj mX(&oa);  const Obj& X = mX;
+                fill(&mX, SIZE_X, VALUES);
+
+                Obj mY(&ya);  const Obj& Y = mY;
+                for (int i = 0; i < SIZE_Y; ++i) {
+                    mY.push_back(VALUES[SIZE_Y - i]);
+                }
+
+                const bool EXCHANGE = same
+                                   && !X.is_inline() && !Y.is_inline();
+                const TYPE *DATA_X = X.data();
+
+                const bsls::Types::Int64 NUM_ALLOC = oa.numAllocations();
+
+                mX.swap(mY);
+
+                ASSERTV(SIZE_X, SIZE_Y, same, matches(X, expectedY));
+                ASSERTV(SIZE_X, SIZE_Y, same, matches(Y, expectedX));
+                ASSERTV(SIZE_X, SIZE_Y, same,
+                                       &oa == X.get_allocator().mechanism());
+                ASSERTV(SIZE_X, SIZE_Y, same,
+                                       &ya == Y.get_allocator().mechanism());
+                if (EXCHANGE) {
+                    ASSERTV(SIZE_X, SIZE_Y, DATA_X == Y.data());
+                    ASSERTV(SIZE_X, SIZE_Y, NUM_ALLOC == oa.numAllocations());
+                }
+
+                swap(mX, mY);
+
+                ASSERTV(SIZE_X, SIZE_Y, same, matches(X, expectedX));
+                ASSERTV(SIZE_X, SIZE_Y, same, matches(Y, expectedY));
+            }
+            ASSERTV(SIZE_X, SIZE_Y, 0 == oa.numBlocksInUse());
+            ASSERTV(SIZE_X, SIZE_Y, 0 == za.numBlocksInUse());
+        }
+    }
+    ASSERT(0 == da.numBlocksTotal());
+}
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+
+                verbose = argc > 2;
+            veryVerbose = argc > 3;
+        veryVeryVerbose = argc > 4;
+    veryVeryVeryVerbose = argc > 5;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    bslma::TestAllocator globalDa("global default", veryVeryVeryVerbose);
+    bslma::Default::setDefaultAllocatorRaw(&globalDa);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 8: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: A Field That Rarely Holds More Than a Few Values
+///- - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that each message processed by our application carries a list of
+// routing hops, which almost never has more than four entries.
+//
+// First, we define the list as a 'small_vector' having an inline capacity of
+// 4:
+//..
+  typedef bsl::small_vector<int, 4> HopList;
+//..
+// Then, we create a list and append four hops, observing that no memory is
+// obtained from the allocator:
+//..
+  bslma::TestAllocator oa;
+  HopList              hops(&oa);
+
+  hops.push_back(101);
+  hops.push_back(102);
+  hops.push_back(103);
+  hops.push_back(104);
+
+  ASSERT(4 == hops.size());
+  ASSERT(hops.is_inline());
+  ASSERT(0 == oa.numAllocations());
+//..
+// Next, we append a fifth hop, which causes the elements to be moved to memory
+// obtained from the allocator:
+//..
+  hops.push_back(105);
+
+  ASSERT(5   == hops.size());
+  ASSERT(!hops.is_inline());
+  ASSERT(1   == oa.numAllocations());
+  ASSERT(101 == hops.front());
+  ASSERT(105 == hops.back());
+//..
+// Finally, we erase a hop and return the remaining ones to the inline buffer:
+//..
+  hops.erase(hops.begin());
+  hops.shrink_to_fit();
+
+  ASSERT(4 == hops.size());
+  ASSERT(hops.is_inline());
+  ASSERT(0 == oa.numBytesInUse());
+//..
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // INPUT ITERATORS, ELEMENT ACCESS, AND RELATIONAL OPERATORS
+        //
+        // Concerns:
+        //: 1 The range constructor, 'insert', and 'assign' accept input
+        //:   iterators, which can be traversed only once, inserting at any
+        //:   position.
+        //:
+        //: 2 Integral arguments to the range functions are interpreted as a
+        //:   number of elements and a value.
+        //:
+        //: 3 'at' throws 'std::out_of_range' for an invalid position.
+        //:
+        //: 4 Requests exceeding 'max_size' throw 'std::length_error'.
+        //:
+        //: 5 The relational operators compare the elements
+        //:   lexicographically.
+        //
+        // Plan:
+        //: 1 Read values from a 'std::istringstream' through
+        //:   'std::istream_iterator' and compare with the expected values.
+        //:   (C-1)
+        //:
+        //: 2 Call the range functions with 'int' arguments.  (C-2)
+        //:
+        //: 3 Call 'at' and 'reserve' with invalid arguments.  (C-3..4)
+        //:
+        //: 4 Compare pairs of objects of various values.  (C-5)
+        //
+        // Testing:
+        //   small_vector(INPUT_ITER first, INPUT_ITER last, const A& = A());
+        //   void assign(INPUT_ITER first, INPUT_ITER last);
+        //   reference at(size_type position);
+        //   const_reference at(size_type position) const;
+        //   size_type max_size() const;
+        //   bool operator<(const small_vector& lhs, const small_vector& rhs);
+        //   bool operator>(const small_vector& lhs, const small_vector& rhs);
+        //   bool operator<=(const small_vector& lhs, const small_vector& rhs);
+        //   bool operator>=(const small_vector& lhs, const small_vector& rhs);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nINPUT ITERATORS, ELEMENT ACCESS, AND RELATIONAL"
+                            " OPERATORS"
+                            "\n==============================================="
+                            "==========\n");
+
+        typedef bsl::small_vector<int, k_INLINE_CAPACITY> Obj;
+        typedef native_std::istream_iterator<int>         InputIterator;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        if (verbose) printf("\nInput iterators.\n");
+        {
+            native_std::istringstream in("1 2 3 4 5 6 7");
+
+            Obj mX(InputIterator(in), InputIterator(), &oa);
+            const Obj& X = mX;
+
+            ASSERT(7 == X.size());
+            for (int i = 0; i < 7; ++i) {
+                ASSERTV(i, i + 1 == X[i]);
+            }
+
+            native_std::istringstream in2("10 20");
+            mX.insert(X.begin() + 1, InputIterator(in2), InputIterator());
+
+            ASSERT(9  == X.size());
+            ASSERT(1  == X[0]);
+            ASSERT(10 == X[1]);
+            ASSERT(20 == X[2]);
+            ASSERT(2  == X[3]);
+
+            native_std::istringstream in3("8 9");
+            mX.assign(InputIterator(in3), InputIterator());
+
+            ASSERT(2 == X.size());
+            ASSERT(8 == X[0]);
+            ASSERT(9 == X[1]);
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+
+        if (verbose) printf("\nIntegral arguments.\n");
+        {
+            Obj mX(3, 7, &oa);  const Obj& X = mX;
+
+            ASSERT(3 == X.size());
+            ASSERT(7 == X[2]);
+
+            mX.insert(X.end(), 2, 9);
+            ASSERT(5 == X.size());
+            ASSERT(9 == X[4]);
+
+            mX.assign(6, 1);
+            ASSERT(6 == X.size());
+            ASSERT(1 == X[5]);
+        }
+
+        if (verbose) printf("\nExceptions.\n");
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+            mX.push_back(5);
+
+            ASSERT(5 == X.at(0));
+            ASSERT(5 == mX.at(0));
+
+            bool caught = false;
+            try {
+                X.at(1);
+            }
+            catch (const native_std::out_of_range&) {
+                caught = true;
+            }
+            ASSERT(caught);
+
+            caught = false;
+            try {
+                mX.at(1);
+            }
+            catch (const native_std::out_of_range&) {
+                caught = true;
+            }
+            ASSERT(caught);
+
+            caught = false;
+            try {
+                mX.reserve(X.max_size() + 1);
+            }
+            catch (const native_std::length_error&) {
+                caught = true;
+            }
+            ASSERT(caught);
+            ASSERT(1 == X.size());
+            ASSERT(X.is_inline());
+        }
+
+        if (verbose) printf("\nRelational operators.\n");
+        {
+            static const char *SPECS[] = {
+                "", "A", "AA", "AB", "ABCDE", "ABCDF", "B", "BA"
+            };
+            const int NUM_SPECS = sizeof SPECS / sizeof *SPECS;
+
+            for (int ti = 0; ti < NUM_SPECS; ++ti) {
+                Obj mX(&oa);  const Obj& X = mX;
+                for (const char *p = SPECS[ti]; *p; ++p) {
+                    mX.push_back(*p);
+                }
+                for (int tj = 0; tj < NUM_SPECS; ++tj) {
+                    Obj mY(&oa);  const Obj& Y = mY;
+                    for (const char *p = SPECS[tj]; *p; ++p) {
+                        mY.push_back(*p);
+                    }
+
+                    // 'SPECS' are sorted.
+
+                    ASSERTV(ti, tj, (ti <  tj) == (X <  Y));
+                    ASSERTV(ti, tj, (ti >  tj) == (X >  Y));
+                    ASSERTV(ti, tj, (ti <= tj) == (X <= Y));
+                    ASSERTV(ti, tj, (ti >= tj) == (X >= Y));
+                    ASSERTV(ti, tj, (ti == tj) == (X == Y));
+                }
+            }
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // SWAP
+        //
+        // Testing:
+        //   void swap(small_vector& other);
+        //   void swap(small_vector& a, small_vector& b);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nSWAP"
+                            "\n====\n");
+
+        RUN_EACH_TYPE(TestDriver,
+                      testCase6,
+                      BSLTF_TEMPLATETESTFACILITY_TEST_TYPES_REGULAR);
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // CAPACITY AND SIZING
+        //
+        // Testing:
+        //   small_vector(size_type initialSize, const ALLOCATOR& = A());
+        //   small_vector(size_type, const VALUE_TYPE&, const A& = A());
+        //   void assign(size_type numElements, const VALUE_TYPE& value);
+        //   void resize(size_type newSize);
+        //   void resize(size_type newSize, const VALUE_TYPE& value);
+        //   void reserve(size_type newCapacity);
+        //   void shrink_to_fit();
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCAPACITY AND SIZING"
+                            "\n===================\n");
+
+        RUN_EACH_TYPE(TestDriver,
+                      testCase5,
+                      BSLTF_TEMPLATETESTFACILITY_TEST_TYPES_REGULAR);
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // INSERTION AND ERASURE
+        //
+        // Testing:
+        //   void emplace_back(Args&&... args);
+        //   void pop_back();
+        //   iterator emplace(const_iterator position, Args&&... args);
+        //   iterator insert(const_iterator position, const VALUE_TYPE& value);
+        //   void insert(const_iterator pos, size_type n, const VALUE_TYPE& v);
+        //   void insert(const_iterator pos, INPUT_ITER f, INPUT_ITER l);
+        //   iterator erase(const_iterator position);
+        //   iterator erase(const_iterator first, const_iterator last);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nINSERTION AND ERASURE"
+                            "\n=====================\n");
+
+        RUN_EACH_TYPE(TestDriver,
+                      testCase4,
+                      BSLTF_TEMPLATETESTFACILITY_TEST_TYPES_REGULAR);
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // COPY CONSTRUCTION, ASSIGNMENT, AND EQUALITY
+        //
+        // Testing:
+        //   small_vector(const small_vector& original);
+        //   small_vector(const small_vector& original, const A& alloc);
+        //   small_vector& operator=(const small_vector& rhs);
+        //   allocator_type get_allocator() const;
+        //   bool operator==(const small_vector& lhs, const small_vector& rhs);
+        //   bool operator!=(const small_vector& lhs, const small_vector& rhs);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCOPY CONSTRUCTION, ASSIGNMENT, AND EQUALITY"
+                            "\n===========================================\n");
+
+        RUN_EACH_TYPE(TestDriver,
+                      testCase3,
+                      BSLTF_TEMPLATETESTFACILITY_TEST_TYPES_REGULAR);
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // PRIMARY MANIPULATORS AND BASIC ACCESSORS
+        //
+        // Testing:
+        //   small_vector(const ALLOCATOR& basicAllocator = ALLOCATOR());
+        //   ~small_vector();
+        //   void push_back(const VALUE_TYPE& value);
+        //   void clear();
+        //   iterator begin();
+        //   iterator end();
+        //   reverse_iterator rbegin();
+        //   reverse_iterator rend();
+        //   reference operator[](size_type position);
+        //   reference front();
+        //   reference back();
+        //   VALUE_TYPE *data();
+        //   const_iterator begin() const;
+        //   const_iterator end() const;
+        //   size_type size() const;
+        //   size_type capacity() const;
+        //   bool empty() const;
+        //   bool is_inline() const;
+        //   const_reference operator[](size_type position) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nPRIMARY MANIPULATORS AND BASIC ACCESSORS"
+                            "\n========================================\n");
+
+        RUN_EACH_TYPE(TestDriver,
+                      testCase2,
+                      BSLTF_TEMPLATETESTFACILITY_TEST_TYPES_REGULAR);
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Append elements across the inline capacity, copy, erase, and
+        //:   shrink an object, verifying its state and allocations.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        typedef bsl::small_vector<int, 2> Obj;
+
+        ASSERT(!bslmf::IsBitwiseMoveable<Obj>::value);
+        ASSERT( bslma::UsesBslmaAllocator<Obj>::value);
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+
+            ASSERT(X.empty());
+            ASSERT(X.is_inline());
+            ASSERT(2 == X.capacity());
+
+            mX.push_back(1);
+            mX.push_back(2);
+            ASSERT(X.is_inline());
+            ASSERT(0 == oa.numAllocations());
+
+            mX.push_back(3);
+            ASSERT(!X.is_inline());
+            ASSERT(1 == oa.numBlocksInUse());
+            ASSERT(3 == X.size());
+            ASSERT(1 == X[0]);  ASSERT(2 == X[1]);  ASSERT(3 == X[2]);
+
+            Obj mY(X, &oa);  const Obj& Y = mY;
+            ASSERT(X == Y);
+
+            mY.erase(mY.begin());
+            ASSERT(X != Y);
+            mY.shrink_to_fit();
+            ASSERT(Y.is_inline());
+            ASSERT(2 == Y[0]);  ASSERT(3 == Y[1]);
+
+            mX.swap(mY);
+            ASSERT(2 == X.size());
+            ASSERT(3 == Y.size());
+            ASSERT(X.is_inline());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST
+        //
+        // Concerns:
+        //: 1 Containers that usually hold a few elements perform fewer
+        //:   allocations, and are faster to fill and destroy, as
+        //:   'small_vector' than as 'bsl::vector'.
+        //
+        // Plan:
+        //: 1 Create many containers of 0 to 8 'int' elements, as would the
+        //:   fields of a stream of messages, using 'bsl::vector' and
+        //:   'small_vector' with an inline capacity of 8, and report the
+        //:   number of allocations and the time taken.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nPERFORMANCE TEST"
+                            "\n================\n");
+
+        const int NUM_MESSAGES = argc > 2 ? atoi(argv[2]) : 1000000;
+
+        bslma::TestAllocator ta("benchmark", veryVeryVeryVerbose);
+
+        bsls::Stopwatch timer;
+        int             sum = 0;
+
+        timer.start();
+        for (int i = 0; i < NUM_MESSAGES; ++i) {
+            bsl::vector<int> field(&ta);
+            for (int j = 0; j < i % 9; ++j) {
+                field.push_back(j);
+            }
+            sum += static_cast<int>(field.size());
+        }
+        timer.stop();
+
+        const bsls::Types::Int64 vectorAllocations = ta.numAllocations();
+        const double             vectorTime = timer.accumulatedWallTime();
+
+        timer.reset();
+        timer.start();
+        for (int i = 0; i < NUM_MESSAGES; ++i) {
+            bsl::small_vector<int, 8> field(&ta);
+            for (int j = 0; j < i % 9; ++j) {
+                field.push_back(j);
+            }
+            sum -= static_cast<int>(field.size());
+        }
+        timer.stop();
+
+        const bsls::Types::Int64 smallAllocations =
+                                       ta.numAllocations() - vectorAllocations;
+        const double             smallTime = timer.accumulatedWallTime();
+
+        ASSERT(0 == sum);
+
+        printf("%d fields of 0 to 8 elements:\n", NUM_MESSAGES);
+        printf("  bsl::vector:          %10lld allocations, %8.4f s\n",
+               vectorAllocations, vectorTime);
+        printf("  bsl::small_vector<8>: %10lld allocations, %8.4f s\n",
+               smallAllocations, smallTime);
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: The global default allocator is not used.
+
+    ASSERTV(globalDa.numBlocksTotal(), 0 == globalDa.numBlocksTotal());
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
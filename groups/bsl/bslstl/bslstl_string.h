@@ -589,6 +589,10 @@ BSL_OVERRIDES_STD mode"
 #include <bslstl_stringrefdata.h>
 #endif
 
+#ifndef INCLUDED_BSLSTL_STRINGSEARCHUTIL
+#include <bslstl_stringsearchutil.h>
+#endif
+
 #ifndef INCLUDED_BSLALG_CONTAINERBASE
 #include <bslalg_containerbase.h>
 #endif
@@ -775,6 +779,98 @@ String_Traits<native_std::char_traits<char> >::find(const char  *s,
 
 #endif
 
+                        // ====================
+                        // struct String_Search
+                        // ====================
+
+template <class CHAR_TYPE, class CHAR_TRAITS>
+struct String_Search {
+    // This component-private 'struct' provides a namespace for the algorithms
+    // used by the 'find', 'find_first_of', 'find_last_of',
+    // 'find_first_not_of', and 'find_last_not_of' methods of 'basic_string'
+    // to search a range of characters.  The searches are expressed in terms
+    // of 'CHAR_TRAITS::find' and 'CHAR_TRAITS::compare'.  A specialization
+    // for 'char' delegates to the vectorized kernels of
+    // 'bslstl::StringSearchUtil'.
+
+    // CLASS METHODS
+    static const CHAR_TYPE *find(const CHAR_TYPE    *string,
+                                 native_std::size_t  length,
+                                 const CHAR_TYPE    *substring,
+                                 native_std::size_t  substringLength);
+        // Return the address of the first occurrence of the specified
+        // 'substring' having the specified 'substringLength' in the specified
+        // 'string' having the specified 'length', or 0 if there is no such
+        // occurrence.  The behavior is undefined unless
+        // '0 < substringLength <= length'.
+
+    static const CHAR_TYPE *findFirstOf(const CHAR_TYPE    *string,
+                                        native_std::size_t  length,
+                                        const CHAR_TYPE    *characterSet,
+                                        native_std::size_t  setLength);
+        // Return the address of the first character in the specified 'string'
+        // having the specified 'length' that is one of the specified
+        // 'setLength' characters at the specified 'characterSet', or 0 if
+        // there is no such character.
+
+    static const CHAR_TYPE *findFirstNotOf(const CHAR_TYPE    *string,
+                                           native_std::size_t  length,
+                                           const CHAR_TYPE    *characterSet,
+                                           native_std::size_t  setLength);
+        // Return the address of the first character in the specified 'string'
+        // having the specified 'length' that is not one of the specified
+        // 'setLength' characters at the specified 'characterSet', or 0 if
+        // there is no such character.
+
+    static const CHAR_TYPE *findLastOf(const CHAR_TYPE    *string,
+                                       native_std::size_t  length,
+                                       const CHAR_TYPE    *characterSet,
+                                       native_std::size_t  setLength);
+        // Return the address of the last character in the specified 'string'
+        // having the specified 'length' that is one of the specified
+        // 'setLength' characters at the specified 'characterSet', or 0 if
+        // there is no such character.
+
+    static const CHAR_TYPE *findLastNotOf(const CHAR_TYPE    *string,
+                                          native_std::size_t  length,
+                                          const CHAR_TYPE    *characterSet,
+                                          native_std::size_t  setLength);
+        // Return the address of the last character in the specified 'string'
+        // having the specified 'length' that is not one of the specified
+        // 'setLength' characters at the specified 'characterSet', or 0 if
+        // there is no such character.
+};
+
+template <>
+struct String_Search<char, native_std::char_traits<char> > {
+    // This specialization of 'String_Search' for 'char' forwards each search
+    // to 'bslstl::StringSearchUtil'.
+
+    // CLASS METHODS
+    static const char *find(const char         *string,
+                            native_std::size_t  length,
+                            const char         *substring,
+                            native_std::size_t  substringLength);
+    static const char *findFirstOf(const char         *string,
+                                   native_std::size_t  length,
+                                   const char         *characterSet,
+                                   native_std::size_t  setLength);
+    static const char *findFirstNotOf(const char         *string,
+                                      native_std::size_t  length,
+                                      const char         *characterSet,
+                                      native_std::size_t  setLength);
+    static const char *findLastOf(const char         *string,
+                                  native_std::size_t  length,
+                                  const char         *characterSet,
+                                  native_std::size_t  setLength);
+    static const char *findLastNotOf(const char         *string,
+                                     native_std::size_t  length,
+                                     const char         *characterSet,
+                                     native_std::size_t  setLength);
+        // Search the specified 'string' having the specified 'length' as
+        // described by the corresponding methods of the primary template.
+};
+
                         // ================
                         // class String_Imp
                         // ================
@@ -1392,6 +1488,23 @@ class basic_string
         // the appropriate number of copies of the specified 'character' at the
         // end if 'length() < newLength'.
 
+    template <class OPERATION>
+    void resize_and_overwrite(size_type newLength, OPERATION operation);
+        // Ensure that the capacity of this string is at least the specified
+        // 'newLength', invoke the specified 'operation' as
+        // 'operation(p, newLength)', where 'p' is the address of the first
+        // character of this string, and set the length of this string to the
+        // value returned by 'operation'.  'operation' may write any of the
+        // 'newLength' characters at 'p' (the first 'length()' of which hold
+        // the current value of this string, and the rest of which are
+        // uninitialized) and must return the number of leading characters to
+        // keep.  Throw 'std::length_error' if 'newLength > max_size()'.  The
+        // behavior is undefined unless the value returned by 'operation' is
+        // at most 'newLength', or if 'operation' throws.  Note that, unlike
+        // 'resize', this method does not initialize the characters beyond the
+        // current length, so that a string may be filled directly (e.g., by a
+        // 'read' system call or a decoder) without first being zeroed.
+
     void reserve(size_type newCapacity = 0);
         // Change the capacity of this string to the specified 'newCapacity'.
         // Note that the capacity of a string is the maximum length it can
@@ -2377,11 +2490,219 @@ std::size_t hashBasicString(const string& str);
 std::size_t hashBasicString(const wstring& str);
     // Return a hash value for the specified 'str'.
 
+                        // =========================
+                        // struct hash<basic_string>
+                        // =========================
+
+template <class CHAR_TYPE, class CHAR_TRAITS, class ALLOCATOR>
+struct hash<basic_string<CHAR_TYPE, CHAR_TRAITS, ALLOCATOR> > {
+    // This partial specialization of 'hash' for 'basic_string' is a
+    // transparent hash functor: in addition to strings, it accepts
+    // null-terminated arrays of 'CHAR_TYPE' and string references (i.e.,
+    // objects of 'bslstl::StringRefData' or a class derived from it, such as
+    // 'bslstl::StringRef'), and returns the same value for each argument that
+    // refers to the same sequence of characters.  This value is the same as
+    // that computed by 'bslh::Hash<>' for a string.  Note that an unordered
+    // container using this hasher together with a transparent comparator
+    // (such as 'bsl::equal_to<>') can look up its string keys using a
+    // 'const char *' or a 'bslstl::StringRef' without creating a temporary
+    // string.
+
+    // PUBLIC TYPES
+    typedef basic_string<CHAR_TYPE, CHAR_TRAITS, ALLOCATOR> argument_type;
+    typedef std::size_t                                     result_type;
+    typedef void                                            is_transparent;
+
+    // ACCESSORS
+    std::size_t operator()(const argument_type& input) const;
+        // Return a hash value for the specified 'input' string.
+
+    std::size_t operator()(const CHAR_TYPE *input) const;
+        // Return a hash value for the null-terminated string at the specified
+        // 'input' address.  The behavior is undefined unless 'input' refers
+        // to a null-terminated array of 'CHAR_TYPE'.
+
+    std::size_t operator()(
+     const BloombergLP::bslstl::StringRefData<CHAR_TYPE>& input) const;
+        // Return a hash value for the sequence of characters referred to by
+        // the specified 'input'.
+};
+
 // ============================================================================
 //                       FUNCTION TEMPLATE DEFINITIONS
 // ============================================================================
 // See IMPLEMENTATION NOTES in the '.cpp' before modifying anything below.
 
+                        // --------------------
+                        // struct String_Search
+                        // --------------------
+
+// CLASS METHODS
+template <class CHAR_TYPE, class CHAR_TRAITS>
+const CHAR_TYPE *
+String_Search<CHAR_TYPE, CHAR_TRAITS>::find(
+                                           const CHAR_TYPE    *string,
+                                           native_std::size_t  length,
+                                           const CHAR_TYPE    *substring,
+                                           native_std::size_t  substringLength)
+{
+    BSLS_ASSERT_SAFE(0 < substringLength);
+    BSLS_ASSERT_SAFE(substringLength <= length);
+
+    native_std::size_t  remChars = length - (substringLength - 1);
+    const CHAR_TYPE    *nextString;
+    for (;
+         0 != (nextString = BSLSTL_CHAR_TRAITS::find(string,
+                                                     remChars,
+                                                     *substring));
+         remChars -= ++nextString - string, string = nextString)
+    {
+        if (0 == CHAR_TRAITS::compare(nextString,
+                                      substring,
+                                      substringLength)) {
+            return nextString;                                        // RETURN
+        }
+    }
+    return 0;
+}
+
+template <class CHAR_TYPE, class CHAR_TRAITS>
+const CHAR_TYPE *
+String_Search<CHAR_TYPE, CHAR_TRAITS>::findFirstOf(
+                                              const CHAR_TYPE    *string,
+                                              native_std::size_t  length,
+                                              const CHAR_TYPE    *characterSet,
+                                              native_std::size_t  setLength)
+{
+    for (const CHAR_TYPE *end = string + length; string != end; ++string) {
+        if (BSLSTL_CHAR_TRAITS::find(characterSet, setLength, *string)) {
+            return string;                                            // RETURN
+        }
+    }
+    return 0;
+}
+
+template <class CHAR_TYPE, class CHAR_TRAITS>
+const CHAR_TYPE *
+String_Search<CHAR_TYPE, CHAR_TRAITS>::findFirstNotOf(
+                                              const CHAR_TYPE    *string,
+                                              native_std::size_t  length,
+                                              const CHAR_TYPE    *characterSet,
+                                              native_std::size_t  setLength)
+{
+    for (const CHAR_TYPE *end = string + length; string != end; ++string) {
+        if (!BSLSTL_CHAR_TRAITS::find(characterSet, setLength, *string)) {
+            return string;                                            // RETURN
+        }
+    }
+    return 0;
+}
+
+template <class CHAR_TYPE, class CHAR_TRAITS>
+const CHAR_TYPE *
+String_Search<CHAR_TYPE, CHAR_TRAITS>::findLastOf(
+                                              const CHAR_TYPE    *string,
+                                              native_std::size_t  length,
+                                              const CHAR_TYPE    *characterSet,
+                                              native_std::size_t  setLength)
+{
+    for (const CHAR_TYPE *current = string + length; current != string; ) {
+        --current;
+        if (BSLSTL_CHAR_TRAITS::find(characterSet, setLength, *current)) {
+            return current;                                           // RETURN
+        }
+    }
+    return 0;
+}
+
+template <class CHAR_TYPE, class CHAR_TRAITS>
+const CHAR_TYPE *
+String_Search<CHAR_TYPE, CHAR_TRAITS>::findLastNotOf(
+                                              const CHAR_TYPE    *string,
+                                              native_std::size_t  length,
+                                              const CHAR_TYPE    *characterSet,
+                                              native_std::size_t  setLength)
+{
+    for (const CHAR_TYPE *current = string + length; current != string; ) {
+        --current;
+        if (!BSLSTL_CHAR_TRAITS::find(characterSet, setLength, *current)) {
+            return current;                                           // RETURN
+        }
+    }
+    return 0;
+}
+
+inline
+const char *
+String_Search<char, native_std::char_traits<char> >::find(
+                                           const char         *string,
+                                           native_std::size_t  length,
+                                           const char         *substring,
+                                           native_std::size_t  substringLength)
+{
+    return BloombergLP::bslstl::StringSearchUtil::findSubstring(
+                                                              string,
+                                                              length,
+                                                              substring,
+                                                              substringLength);
+}
+
+inline
+const char *
+String_Search<char, native_std::char_traits<char> >::findFirstOf(
+                                              const char         *string,
+                                              native_std::size_t  length,
+                                              const char         *characterSet,
+                                              native_std::size_t  setLength)
+{
+    return BloombergLP::bslstl::StringSearchUtil::findFirstOf(string,
+                                                              length,
+                                                              characterSet,
+                                                              setLength);
+}
+
+inline
+const char *
+String_Search<char, native_std::char_traits<char> >::findFirstNotOf(
+                                              const char         *string,
+                                              native_std::size_t  length,
+                                              const char         *characterSet,
+                                              native_std::size_t  setLength)
+{
+    return BloombergLP::bslstl::StringSearchUtil::findFirstNotOf(string,
+                                                                 length,
+                                                                 characterSet,
+                                                                 setLength);
+}
+
+inline
+const char *
+String_Search<char, native_std::char_traits<char> >::findLastOf(
+                                              const char         *string,
+                                              native_std::size_t  length,
+                                              const char         *characterSet,
+                                              native_std::size_t  setLength)
+{
+    return BloombergLP::bslstl::StringSearchUtil::findLastOf(string,
+                                                             length,
+                                                             characterSet,
+                                                             setLength);
+}
+
+inline
+const char *
+String_Search<char, native_std::char_traits<char> >::findLastNotOf(
+                                              const char         *string,
+                                              native_std::size_t  length,
+                                              const char         *characterSet,
+                                              native_std::size_t  setLength)
+{
+    return BloombergLP::bslstl::StringSearchUtil::findLastNotOf(string,
+                                                                length,
+                                                                characterSet,
+                                                                setLength);
+}
+
                           // ----------------
                           // class String_Imp
                           // ----------------
@@ -3161,11 +3482,21 @@ void basic_string<CHAR_TYPE,CHAR_TRAITS,ALLOCATOR>::privateReserveRaw(
         size_type newStorage = this->computeNewCapacity(newCapacity,
                                                         this->d_capacity,
                                                         max_size());
-        CHAR_TYPE *newBuffer = privateAllocate(newStorage);
+        CHAR_TYPE *newBuffer;
 
-        CHAR_TRAITS::copy(newBuffer, this->dataPtr(), this->d_length + 1);
+        if (this->isShortString()) {
+            newBuffer = privateAllocate(newStorage);
 
-        privateDeallocate();
+            CHAR_TRAITS::copy(newBuffer, this->dataPtr(), this->d_length + 1);
+        }
+        else {
+            // The allocator may relocate the characters without copying them
+            // (e.g., by extending the buffer in place, or with 'realloc').
+
+            newBuffer = this->reallocateN(this->d_start_p,
+                                          this->d_capacity + 1,
+                                          newStorage + 1);
+        }
 
         this->d_start_p  = newBuffer;
         this->d_capacity = newStorage;
@@ -3433,6 +3764,27 @@ void basic_string<CHAR_TYPE,CHAR_TRAITS,ALLOCATOR>::resize(size_type newLength)
     privateResizeRaw(newLength, CHAR_TYPE());
 }
 
+template <class CHAR_TYPE, class CHAR_TRAITS, class ALLOCATOR>
+template <class OPERATION>
+void basic_string<CHAR_TYPE,CHAR_TRAITS,ALLOCATOR>::resize_and_overwrite(
+                                                   size_type newLength,
+                                                   OPERATION operation)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(newLength > max_size())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        BloombergLP::bslstl::StdExceptUtil::throwLengthError(
+                   "string<...>::resize_and_overwrite(n,op): string too long");
+    }
+    privateReserveRaw(newLength);
+
+    const size_type length = operation(this->dataPtr(), newLength);
+
+    BSLS_ASSERT(length <= newLength);
+
+    this->d_length = length;
+    CHAR_TRAITS::assign(*(this->dataPtr() + this->d_length), CHAR_TYPE());
+}
+
 template <class CHAR_TYPE, class CHAR_TRAITS, class ALLOCATOR>
 void basic_string<CHAR_TYPE,CHAR_TRAITS,ALLOCATOR>::reserve(
                                                          size_type newCapacity)
@@ -4506,19 +4858,12 @@ basic_string<CHAR_TYPE,CHAR_TRAITS,ALLOCATOR>::find(
     if (0 == numChars) {
         return position;                                              // RETURN
     }
-    const CHAR_TYPE *thisString = this->dataPtr() + position;
-    const CHAR_TYPE *nextString;
-    for (remChars -= numChars - 1;
-         0 != (nextString = BSLSTL_CHAR_TRAITS::find(thisString,
-                                                     remChars,
-                                                     *substring));
-         remChars -= ++nextString - thisString, thisString = nextString)
-    {
-        if (0 == CHAR_TRAITS::compare(nextString, substring, numChars)) {
-            return nextString - this->dataPtr();                      // RETURN
-        }
-    }
-    return npos;
+    const CHAR_TYPE *result = String_Search<CHAR_TYPE, CHAR_TRAITS>::find(
+                                                   this->dataPtr() + position,
+                                                   remChars,
+                                                   substring,
+                                                   numChars);
+    return result ? result - this->dataPtr() : npos;
 }
 
 template <class CHAR_TYPE, class CHAR_TRAITS, class ALLOCATOR>
@@ -4626,14 +4971,14 @@ basic_string<CHAR_TYPE,CHAR_TRAITS,ALLOCATOR>::find_first_of(
     BSLS_ASSERT_SAFE(characterString || 0 == numChars);
 
     if (0 < numChars && position < length()) {
-        for (const CHAR_TYPE *current = this->dataPtr() + position;
-             current != this->dataPtr() + length();
-             ++current)
-        {
-            if (BSLSTL_CHAR_TRAITS::find(characterString, numChars, *current)
-                != 0) {
-                return current - this->dataPtr();                     // RETURN
-            }
+        const CHAR_TYPE *result =
+                         String_Search<CHAR_TYPE, CHAR_TRAITS>::findFirstOf(
+                                                   this->dataPtr() + position,
+                                                   length() - position,
+                                                   characterString,
+                                                   numChars);
+        if (result) {
+            return result - this->dataPtr();                          // RETURN
         }
     }
     return npos;
@@ -4683,17 +5028,14 @@ basic_string<CHAR_TYPE,CHAR_TRAITS,ALLOCATOR>::find_last_of(
 
     if (0 < numChars && 0 < length()) {
         size_type remChars = position < length() ? position : length() - 1;
-        for (const CHAR_TYPE *current = this->dataPtr() + remChars;
-             ;
-             --current)
-        {
-            if (BSLSTL_CHAR_TRAITS::find(
-                                        characterString, numChars, *current)) {
-                return current - this->dataPtr();                     // RETURN
-            }
-            if (current == this->dataPtr()) {
-                break;
-            }
+        const CHAR_TYPE *result =
+                          String_Search<CHAR_TYPE, CHAR_TRAITS>::findLastOf(
+                                                              this->dataPtr(),
+                                                              remChars + 1,
+                                                              characterString,
+                                                              numChars);
+        if (result) {
+            return result - this->dataPtr();                          // RETURN
         }
     }
     return npos;
@@ -4742,15 +5084,14 @@ basic_string<CHAR_TYPE,CHAR_TRAITS,ALLOCATOR>::find_first_not_of(
     BSLS_ASSERT_SAFE(characterString || 0 == numChars);
 
     if (position < length()) {
-        const CHAR_TYPE *last = this->dataPtr() + length();
-        for (const CHAR_TYPE *current = this->dataPtr() + position;
-             current != last;
-             ++current)
-        {
-            if (!BSLSTL_CHAR_TRAITS::find(
-                                        characterString, numChars, *current)) {
-                return current - this->dataPtr();                     // RETURN
-            }
+        const CHAR_TYPE *result =
+                      String_Search<CHAR_TYPE, CHAR_TRAITS>::findFirstNotOf(
+                                                   this->dataPtr() + position,
+                                                   length() - position,
+                                                   characterString,
+                                                   numChars);
+        if (result) {
+            return result - this->dataPtr();                          // RETURN
         }
     }
     return npos;
@@ -4800,14 +5141,14 @@ basic_string<CHAR_TYPE,CHAR_TRAITS,ALLOCATOR>::find_last_not_of (
 
     if (0 < length()) {
         size_type remChars = position < length() ? position : length() - 1;
-        for (const CHAR_TYPE *current = this->dataPtr() + remChars;
-             remChars != npos;
-             --current, --remChars)
-        {
-            if (!BSLSTL_CHAR_TRAITS::find(
-                                        characterString, numChars, *current)) {
-                return current - this->dataPtr();                     // RETURN
-            }
+        const CHAR_TYPE *result =
+                       String_Search<CHAR_TYPE, CHAR_TRAITS>::findLastNotOf(
+                                                              this->dataPtr(),
+                                                              remChars + 1,
+                                                              characterString,
+                                                              numChars);
+        if (result) {
+            return result - this->dataPtr();                          // RETURN
         }
     }
     return npos;
@@ -5544,6 +5885,49 @@ hashBasicString(const basic_string<CHAR_TYPE, CHAR_TRAITS, ALLOCATOR>& str)
     return ::BloombergLP::bslh::Hash<>()(str);
 }
 
+                        // -------------------------
+                        // struct hash<basic_string>
+                        // -------------------------
+
+// ACCESSORS
+template <class CHAR_TYPE, class CHAR_TRAITS, class ALLOCATOR>
+inline
+std::size_t hash<basic_string<CHAR_TYPE, CHAR_TRAITS, ALLOCATOR> >::
+                                 operator()(const argument_type& input) const
+{
+    return ::BloombergLP::bslh::Hash<>()(input);
+}
+
+template <class CHAR_TYPE, class CHAR_TRAITS, class ALLOCATOR>
+inline
+std::size_t hash<basic_string<CHAR_TYPE, CHAR_TRAITS, ALLOCATOR> >::
+                                     operator()(const CHAR_TYPE *input) const
+{
+    BSLS_ASSERT_SAFE(input);
+
+    return (*this)(BloombergLP::bslstl::StringRefData<CHAR_TYPE>(
+                                         input,
+                                         input + CHAR_TRAITS::length(input)));
+}
+
+template <class CHAR_TYPE, class CHAR_TRAITS, class ALLOCATOR>
+std::size_t hash<basic_string<CHAR_TYPE, CHAR_TRAITS, ALLOCATOR> >::operator()(
+          const BloombergLP::bslstl::StringRefData<CHAR_TYPE>& input) const
+{
+    // Replicate the sequence of calls made to the hash algorithm by
+    // 'hashAppend' for 'basic_string' (above), so that equal sequences of
+    // characters hash to the same value however they are supplied.
+
+    using ::BloombergLP::bslh::hashAppend;
+
+    const std::size_t length = input.end() - input.begin();
+
+    ::BloombergLP::bslh::DefaultHashAlgorithm hashAlg;
+    hashAlg(input.begin(), sizeof(CHAR_TYPE) * length);
+    hashAppend(hashAlg, length);
+    return static_cast<std::size_t>(hashAlg.computeHash());
+}
+
 }  // close namespace bsl
 
 // ============================================================================
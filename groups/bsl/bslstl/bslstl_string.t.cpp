@@ -129,6 +129,7 @@ using namespace std;
 // [16] reverse_iterator rend();
 // [14] void resize(size_type n);
 // [14] void resize(size_type n, C c);
+// [30] void resize_and_overwrite(size_type n, OPERATION operation);
 // [14] void reserve(size_type n);
 // [ 2] void clear();
 // [15] reference operator[](size_type pos);
@@ -249,6 +250,9 @@ using namespace std;
 // [ 5] basic_istream<C,CT>& operator>>(basic_istream<C,CT>& stream,
 //                                      const string& str);
 // [29] hashAppend(HASHALG& hashAlg, const basic_string&  input);
+// [29] size_t hash<basic_string>::operator()(const basic_string&) const;
+// [29] size_t hash<basic_string>::operator()(const CHAR_TYPE *) const;
+// [29] size_t hash<basic_string>::operator()(const StringRefData&) const;
 //-----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
 // [11] ALLOCATOR-RELATED CONCERNS
@@ -729,6 +733,63 @@ bool UserChar<size>::operator!=(const UserChar& rhs) const {
     return !(*this == rhs);
 }
 
+                           // ========================
+                           // class OverwriteOperation
+                           // ========================
+
+template <class TYPE>
+class OverwriteOperation {
+    // This class provides an operation for 'resize_and_overwrite' that
+    // records the arguments with which it is invoked, writes a fill character
+    // to the characters following a prefix of the supplied buffer, and
+    // returns a fixed length.
+
+    // DATA
+    size_t   d_prefixLength;  // number of leading characters to leave as is
+    TYPE     d_fill;          // character written after the prefix
+    size_t   d_result;        // value to return
+    TYPE   **d_buffer_p;      // address at which to record the buffer
+    size_t  *d_length_p;      // address at which to record the length
+    int     *d_numCalls_p;    // number of invocations (incremented)
+
+  public:
+    // CREATORS
+    OverwriteOperation(size_t   prefixLength,
+                       TYPE     fill,
+                       size_t   result,
+                       TYPE   **buffer,
+                       size_t  *length,
+                       int     *numCalls)
+        // Create an operation that writes the specified 'fill' character
+        // after the specified 'prefixLength' characters of the buffer it is
+        // given, and returns the specified 'result', recording its arguments
+        // at the specified 'buffer' and 'length' and incrementing the
+        // specified 'numCalls' when invoked.
+    : d_prefixLength(prefixLength)
+    , d_fill(fill)
+    , d_result(result)
+    , d_buffer_p(buffer)
+    , d_length_p(length)
+    , d_numCalls_p(numCalls)
+    {
+    }
+
+    // ACCESSORS
+    size_t operator()(TYPE *buffer, size_t length) const
+        // Fill the specified 'length' characters at the specified 'buffer'
+        // following the prefix, record 'buffer' and 'length', and return the
+        // result supplied at construction.
+    {
+        for (size_t i = d_prefixLength; i < length; ++i) {
+            buffer[i] = d_fill;
+        }
+        *d_buffer_p = buffer;
+        *d_length_p = length;
+        ++*d_numCalls_p;
+        return d_result;
+    }
+};
+
                               // ====================
                               // class LimitAllocator
                               // ====================
@@ -909,6 +970,9 @@ struct TestDriver {
         // specifications, and check that the specified 'result' agrees.
 
     // TEST CASES
+    static void testCase30();
+        // Test 'resize_and_overwrite'.
+
     static void testCase29();
         // Test the hash append specialization.
 
@@ -1194,6 +1258,156 @@ void TestDriver<TYPE,TRAITS,ALLOC>::checkCompare(const Obj& X,
                                  // ----------
                                  // TEST CASES
                                  // ----------
+template <class TYPE, class TRAITS, class ALLOC>
+void TestDriver<TYPE,TRAITS,ALLOC>::testCase30()
+{
+    // --------------------------------------------------------------------
+    // TESTING 'resize_and_overwrite'
+    //
+    // Concerns:
+    //: 1 The operation is invoked exactly once, with the address of the
+    //:   first character of the string and the requested length.
+    //:
+    //: 2 The buffer supplied to the operation begins with the current value
+    //:   of the string, and has room for the requested length.
+    //:
+    //: 3 The resulting length is the value returned by the operation, which
+    //:   may be smaller or larger than the original length, and the string
+    //:   is null-terminated.
+    //:
+    //: 4 Memory is allocated only if the requested length exceeds the
+    //:   capacity, and the capacity then grows as for the other
+    //:   manipulators.
+    //:
+    //: 5 A requested length exceeding 'max_size()' throws
+    //:   'std::length_error' without invoking the operation.
+    //
+    // Plan:
+    //: 1 For strings of various lengths and capacities, invoke
+    //:   'resize_and_overwrite' with various requested lengths and returned
+    //:   lengths, using an operation that records its arguments, verifies
+    //:   the prefix, and fills the remainder.  Verify the value, the
+    //:   capacity, and the memory allocated.  (C-1..4)
+    //:
+    //: 2 Request a length exceeding 'max_size()'.  (C-5)
+    //
+    // Testing:
+    //   void resize_and_overwrite(size_type n, OPERATION operation);
+    // --------------------------------------------------------------------
+
+    bslma::TestAllocator  testAllocator(veryVeryVerbose);
+    bslma::Allocator     *Z = &testAllocator;
+
+    const TYPE *values     = 0;
+    const int   NUM_VALUES = getValues(&values);
+    (void) NUM_VALUES;
+
+    const TYPE INIT_VALUE = values[0];
+    const TYPE FILL_VALUE = values[1];
+
+    static const size_t DATA[] = {
+        0, 1, 2, 3, 4, 5, 15, 16, 17, 22, 23, 24, 25, 46, 47, 48, 100
+    };
+    const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+    for (int ti = 0; ti < NUM_DATA; ++ti) {
+        const size_t INIT = DATA[ti];
+
+        for (int tj = 0; tj < NUM_DATA; ++tj) {
+            const size_t NEW_LENGTH = DATA[tj];
+
+            for (int tk = 0; tk <= tj; ++tk) {
+                const size_t RESULT = DATA[tk];
+
+                Obj mX(INIT, INIT_VALUE, Z);  const Obj& X = mX;
+
+                const size_t             CAP = X.capacity();
+                const bsls::Types::Int64 NA  = testAllocator.numAllocations();
+
+                TYPE   *buffer   = 0;
+                size_t  length   = 0;
+                int     numCalls = 0;
+
+                mX.resize_and_overwrite(NEW_LENGTH,
+                                        OverwriteOperation<TYPE>(INIT,
+                                                                 FILL_VALUE,
+                                                                 RESULT,
+                                                                 &buffer,
+                                                                 &length,
+                                                                 &numCalls));
+
+                LOOP3_ASSERT(ti, tj, tk, 1 == numCalls);
+                LOOP3_ASSERT(ti, tj, tk, NEW_LENGTH == length);
+                LOOP3_ASSERT(ti, tj, tk, X.data() == buffer);
+                LOOP3_ASSERT(ti, tj, tk, RESULT == X.length());
+                LOOP3_ASSERT(ti, tj, tk, NEW_LENGTH <= X.capacity());
+                LOOP3_ASSERT(ti, tj, tk,
+                             (NEW_LENGTH <= CAP) ==
+                                   (NA == testAllocator.numAllocations()));
+                LOOP3_ASSERT(ti, tj, tk, TYPE() == X[X.length()]);
+
+                for (size_t i = 0; i < RESULT; ++i) {
+                    const TYPE& EXP = i < INIT ? INIT_VALUE : FILL_VALUE;
+                    LOOP4_ASSERT(ti, tj, tk, i, EXP == X[i]);
+                }
+            }
+        }
+    }
+    ASSERT(0 == testAllocator.numBlocksInUse());
+
+    if (verbose) printf("\tTesting amortized growth.\n");
+    {
+        Obj mX(Z);  const Obj& X = mX;
+
+        TYPE   *buffer   = 0;
+        size_t  length   = 0;
+        int     numCalls = 0;
+
+        const bsls::Types::Int64 NA = testAllocator.numAllocations();
+        for (size_t i = 0; i < 1000; ++i) {
+            mX.resize_and_overwrite(i + 1,
+                                    OverwriteOperation<TYPE>(i,
+                                                             FILL_VALUE,
+                                                             i + 1,
+                                                             &buffer,
+                                                             &length,
+                                                             &numCalls));
+        }
+        LOOP_ASSERT(testAllocator.numAllocations() - NA,
+                    testAllocator.numAllocations() - NA <= 20);
+        ASSERT(1000 == X.length());
+        ASSERT(Obj(1000, FILL_VALUE) == X);
+    }
+
+#ifdef BDE_BUILD_TARGET_EXC
+    if (verbose) printf("\tTesting 'std::length_error'.\n");
+    {
+        Obj mX(Z);  const Obj& X = mX;
+
+        TYPE   *buffer   = 0;
+        size_t  length   = 0;
+        int     numCalls = 0;
+
+        bool exceptionCaught = false;
+        try {
+            mX.resize_and_overwrite(X.max_size() + 1,
+                                    OverwriteOperation<TYPE>(0,
+                                                             FILL_VALUE,
+                                                             0,
+                                                             &buffer,
+                                                             &length,
+                                                             &numCalls));
+        }
+        catch (const std::length_error&) {
+            exceptionCaught = true;
+        }
+        ASSERT(exceptionCaught);
+        ASSERT(0 == numCalls);
+        ASSERT(X.empty());
+    }
+#endif
+}
+
 template <class TYPE, class TRAITS, class ALLOC>
 void TestDriver<TYPE,TRAITS,ALLOC>::testCase29()
 {
@@ -1211,6 +1425,10 @@ void TestDriver<TYPE,TRAITS,ALLOC>::testCase29()
     //: 3 Empty strings can be hashed
     //:
     //: 4 Hash is not computed on data beyond the end of very short strings
+    //:
+    //: 5 'bsl::hash' for 'basic_string' is transparent, and returns the value
+    //:   computed by 'bslh::Hash' for a string, a null-terminated character
+    //:   array, or a string reference to the same sequence of characters.
     //
     // Plan:
     //: 1 Use 'bslh::Hash' to hash a few values of strings with each char type.
@@ -1220,9 +1438,20 @@ void TestDriver<TYPE,TRAITS,ALLOC>::testCase29()
     //:
     //: 3 Hash two very short strings with the same value and assert that they
     //:   produce equal hashes. (C-4)
+    //:
+    //: 4 Verify that 'bsl::hash<Obj>' declares 'is_transparent'.  For a
+    //:   sequence of strings of increasing length (including embedded null
+    //:   characters), compare the value returned by 'bsl::hash<Obj>' for the
+    //:   string and for a 'bslstl::StringRefData' referring to the string
+    //:   with that returned by 'bslh::Hash'; for strings without embedded
+    //:   null characters, also compare the value returned for 'c_str()'.
+    //:   (C-5)
     //
     // Testing:
     //   hashAppend(HASHALG& hashAlg, const basic_string&  input);
+    //   size_t hash<basic_string>::operator()(const basic_string&) const;
+    //   size_t hash<basic_string>::operator()(const CHAR_TYPE *) const;
+    //   size_t hash<basic_string>::operator()(const StringRefData&) const;
     // --------------------------------------------------------------------
     typedef ::BloombergLP::bslh::Hash<> Hasher;
     typedef typename Hasher::result_type HashType;
@@ -1296,6 +1525,36 @@ void TestDriver<TYPE,TRAITS,ALLOC>::testCase29()
         small2.push_back( TYPE('0') );
         ASSERT(hasher(small1) == hasher(small2));
     }
+
+    if (verbose) printf("Verify that 'bsl::hash<Obj>' is transparent and"
+                        " agrees with 'bslh::Hash'. (C-5)\n");
+    {
+        typedef bsl::hash<Obj>                           StringHash;
+        typedef BloombergLP::bslstl::StringRefData<TYPE> RefData;
+
+        ASSERT((bsl::is_same<void,
+                             typename StringHash::is_transparent>::value));
+        ASSERT((bsl::is_same<Obj,
+                             typename StringHash::argument_type>::value));
+
+        const StringHash stringHash;
+
+        Obj mX;  const Obj& X = mX;
+        for (int i = 0; i < 50; ++i) {
+            if (veryVerbose) { T_ P(i); }
+
+            const size_t EXP = hasher(X);
+
+            LOOP_ASSERT(i, EXP == stringHash(X));
+            LOOP_ASSERT(i, EXP == stringHash(RefData(X.data(),
+                                                     X.data() + X.length())));
+            if (X.length() == TRAITS::length(X.c_str())) {
+                LOOP_ASSERT(i, EXP == stringHash(X.c_str()));
+            }
+
+            mX.push_back(i % 7 ? TYPE('a' + i % 26) : TYPE('\0'));
+        }
+    }
 }
 
 
@@ -3123,6 +3382,13 @@ void TestDriver<TYPE,TRAITS,ALLOC>::testCase22()
             { L_,  "ABABABAB",  "ABABABAC",       (size_t)-1,   (size_t)-1,  },
             { L_,  "A",         "ABABA",          (size_t)-1,   (size_t)-1,  },
             { L_,  "AABAA",     "CDCDC",          (size_t)-1,   (size_t)-1,  },
+            { L_,  "AAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAB",
+                                "AAAB",           (size_t)44,   (size_t)44,  },
+            { L_,  "ABCDABCDABCDABCDABCDABCDABCDABCDABCDABCDE",
+                                "CDE",            (size_t)38,   (size_t)38,  },
+            { L_,  "EABCDABCDABCDABCDABCDABCDABCDABCD"
+                   "ABCDABCDABCDABCDABCDABCDABCDABCD",
+                                "EA",             (size_t) 0,   (size_t) 0,  },
 
             // Add further tests below, but note that test will fail if the
             // spec has the pattern in more than two occurrences.
@@ -3354,7 +3620,11 @@ void TestDriver<TYPE,TRAITS,ALLOC>::testCase22()
             { L_,  "AAAAAABBBB"               },
             { L_,  "ABCDABCD"                 },
             { L_,  "ABCDEABCDE"               },
-            { L_,  "AAAABBBBCCCCDDDDEEEE"     }
+            { L_,  "AAAABBBBCCCCDDDDEEEE"     },
+            { L_,  "AAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAB" },
+            { L_,  "ABCDABCDABCDABCDABCDABCDABCDABCDABCDABCDE" },
+            { L_,  "EBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBB"
+                   "BBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBC" }
         };
         const int NUM_DATA = sizeof DATA / sizeof *DATA;
 
@@ -14030,7 +14300,7 @@ int main(int argc, char *argv[])
     printf("TEST " __FILE__ " CASE %d\n", test);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 30: {
+      case 31: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //
@@ -14242,6 +14512,31 @@ int main(int argc, char *argv[])
             }
         }
       } break;
+      case 30: {
+        // --------------------------------------------------------------------
+        // TESTING 'resize_and_overwrite'
+        //
+        // Concerns:
+        //: 1 'resize_and_overwrite' lets the operation fill the string in
+        //:   place, and sets the length to the value it returns.
+        //
+        // Plan:
+        //: 1 Run the test for each character type.  (C-1)
+        //
+        // Testing:
+        //   void resize_and_overwrite(size_type n, OPERATION operation);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING 'resize_and_overwrite'"
+                            "\n==============================\n");
+
+        if (verbose) printf("\n... with 'char'.\n");
+        TestDriver<char>::testCase30();
+
+        if (verbose) printf("\n... with 'wchar_t'.\n");
+        TestDriver<wchar_t>::testCase30();
+
+      } break;
       case 29: {
         // --------------------------------------------------------------------
         // TESTING 'hashAppend'
@@ -0,0 +1,232 @@
+// bslstl_stringbuilder.cpp                                           -*-C++-*-
+#include <bslstl_stringbuilder.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id$ $CSID$")
+
+#include <bslma_default.h>
+
+#include <cstring>
+#include <ostream>
+
+namespace BloombergLP {
+namespace bslstl {
+
+                        // -------------------
+                        // class StringBuilder
+                        // -------------------
+
+// PRIVATE MANIPULATORS
+StringBuilder::Chunk *StringBuilder::addChunk(size_type minCapacity)
+{
+    const size_type capacity = minCapacity < d_nextChunkSize
+                             ? d_nextChunkSize
+                             : minCapacity;
+
+    d_chunks.reserve(d_chunks.size() + 1);
+
+    Chunk *chunk = static_cast<Chunk *>(
+                         d_allocator_p->allocate(sizeof(Chunk) + capacity));
+    chunk->d_length   = 0;
+    chunk->d_capacity = capacity;
+    d_chunks.push_back(chunk);
+
+    const size_type maxGrowth    = k_MAX_GROWTH_CHUNK_SIZE;
+    const size_type maxChunkSize = d_initialChunkSize < maxGrowth
+                                 ? maxGrowth
+                                 : d_initialChunkSize;
+    if (d_nextChunkSize < maxChunkSize) {
+        d_nextChunkSize = 2 * d_nextChunkSize < maxChunkSize
+                        ? 2 * d_nextChunkSize
+                        : maxChunkSize;
+    }
+    return chunk;
+}
+
+void StringBuilder::deallocateChunks(native_std::size_t begin)
+{
+    for (native_std::size_t i = begin; i < d_chunks.size(); ++i) {
+        d_allocator_p->deallocate(d_chunks[i]);
+    }
+    d_chunks.resize(begin);
+}
+
+// CREATORS
+StringBuilder::StringBuilder(bslma::Allocator *basicAllocator)
+: d_chunks(bslma::Default::allocator(basicAllocator))
+, d_length(0)
+, d_nextChunkSize(k_DEFAULT_INITIAL_CHUNK_SIZE)
+, d_initialChunkSize(k_DEFAULT_INITIAL_CHUNK_SIZE)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+}
+
+StringBuilder::StringBuilder(size_type         initialChunkSize,
+                             bslma::Allocator *basicAllocator)
+: d_chunks(bslma::Default::allocator(basicAllocator))
+, d_length(0)
+, d_nextChunkSize(initialChunkSize)
+, d_initialChunkSize(initialChunkSize)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(0 < initialChunkSize);
+}
+
+StringBuilder::~StringBuilder()
+{
+    deallocateChunks(0);
+}
+
+// MANIPULATORS
+StringBuilder& StringBuilder::append(const char *characters,
+                                     size_type   numCharacters)
+{
+    BSLS_ASSERT_SAFE(characters || 0 == numCharacters);
+
+    if (0 == numCharacters) {
+        return *this;                                                 // RETURN
+    }
+
+    Chunk     *last = d_chunks.empty() ? 0 : d_chunks.back();
+    size_type  room = last ? last->d_capacity - last->d_length : 0;
+
+    if (room < numCharacters) {
+        // Allocate first, so that this builder is unchanged if an exception
+        // is thrown.
+
+        Chunk *chunk = addChunk(numCharacters - room);
+
+        if (room) {
+            native_std::memcpy(last->d_data + last->d_length,
+                               characters,
+                               room);
+            last->d_length = last->d_capacity;
+        }
+        last            = chunk;
+        characters     += room;
+        d_length       += room;
+        numCharacters  -= room;
+    }
+
+    native_std::memcpy(last->d_data + last->d_length,
+                       characters,
+                       numCharacters);
+    last->d_length += numCharacters;
+    d_length       += numCharacters;
+    return *this;
+}
+
+StringBuilder& StringBuilder::append(size_type numCharacters, char character)
+{
+    if (0 == numCharacters) {
+        return *this;                                                 // RETURN
+    }
+
+    Chunk     *last = d_chunks.empty() ? 0 : d_chunks.back();
+    size_type  room = last ? last->d_capacity - last->d_length : 0;
+
+    if (room < numCharacters) {
+        Chunk *chunk = addChunk(numCharacters - room);
+
+        if (room) {
+            native_std::memset(last->d_data + last->d_length,
+                               character,
+                               room);
+            last->d_length = last->d_capacity;
+        }
+        last            = chunk;
+        d_length       += room;
+        numCharacters  -= room;
+    }
+
+    native_std::memset(last->d_data + last->d_length,
+                       character,
+                       numCharacters);
+    last->d_length += numCharacters;
+    d_length       += numCharacters;
+    return *this;
+}
+
+void StringBuilder::clear()
+{
+    if (!d_chunks.empty()) {
+        deallocateChunks(1);
+        d_chunks.front()->d_length = 0;
+    }
+    d_length        = 0;
+    d_nextChunkSize = d_initialChunkSize;
+}
+
+StringRef StringBuilder::flatten()
+{
+    if (d_chunks.size() > 1) {
+        Chunk *chunk = static_cast<Chunk *>(
+                         d_allocator_p->allocate(sizeof(Chunk) + d_length));
+        chunk->d_length   = d_length;
+        chunk->d_capacity = d_length;
+
+        char *end = chunk->d_data;
+        for (native_std::size_t i = 0; i < d_chunks.size(); ++i) {
+            native_std::memcpy(end,
+                               d_chunks[i]->d_data,
+                               d_chunks[i]->d_length);
+            end += d_chunks[i]->d_length;
+            d_allocator_p->deallocate(d_chunks[i]);
+        }
+        d_chunks.resize(1);
+        d_chunks.front() = chunk;
+    }
+
+    return d_chunks.empty()
+           ? StringRef()
+           : StringRef(d_chunks.front()->d_data, static_cast<int>(d_length));
+}
+
+// ACCESSORS
+void StringBuilder::toString(bsl::string *result) const
+{
+    BSLS_ASSERT(result);
+
+    result->clear();
+    result->reserve(d_length);
+    for (native_std::size_t i = 0; i < d_chunks.size(); ++i) {
+        result->append(d_chunks[i]->d_data, d_chunks[i]->d_length);
+    }
+}
+
+}  // close package namespace
+
+// FREE OPERATORS
+native_std::ostream& bslstl::operator<<(native_std::ostream&  stream,
+                                        const StringBuilder& builder)
+{
+    for (int i = 0; i < builder.numSegments(); ++i) {
+        const StringRef segment = builder.segment(i);
+        stream.write(segment.data(), segment.length());
+    }
+    return stream;
+}
+
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
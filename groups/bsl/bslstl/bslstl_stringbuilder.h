@@ -0,0 +1,384 @@
+// bslstl_stringbuilder.h                                             -*-C++-*-
+#ifndef INCLUDED_BSLSTL_STRINGBUILDER
+#define INCLUDED_BSLSTL_STRINGBUILDER
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a chunked string builder exposing its segments in place.
+//
+//@CLASSES:
+//  bslstl::StringBuilder: append-only string held in a sequence of chunks
+//
+//@SEE_ALSO: bslstl_string, bslstl_stringref
+//
+//@DESCRIPTION: This component provides a mechanism, 'bslstl::StringBuilder',
+// that accumulates a string by appending to it, holding the characters in a
+// sequence of separately allocated chunks (a simple "rope").  Appending never
+// moves the characters already appended: when the last chunk is full, a new
+// chunk is allocated for the remaining characters.  The content is available
+// as a sequence of 'bslstl::StringRef' segments, one per chunk, suitable for
+// gather-style output (e.g., 'writev', or successive writes to a stream or
+// 'bslx' output stream) without copying, and may be coalesced into a single
+// contiguous segment by 'flatten' when contiguous storage is really needed.
+//
+// Building a large message with 'bsl::string::append' copies the characters
+// already appended each time the capacity of the string is exceeded (by a
+// factor of about 1.5), and a further copy is usually made to write the
+// result.  A 'StringBuilder' copies each appended character exactly once
+// (twice if the content is flattened).
+//
+///Chunk Sizes and Memory Allocation
+///---------------------------------
+// The first chunk has the capacity specified at construction (256 bytes by
+// default).  Each subsequent chunk has twice the capacity of the previous
+// one, up to 64 kilobytes (or the initial capacity, if larger), unless a
+// single append requires a larger chunk, in which case the chunk is sized to
+// hold exactly the characters that do not fit in the previous chunk.  All
+// memory is obtained from the allocator supplied at construction; an
+// allocator that releases memory only on destruction, such as a sequential
+// allocator, is well suited to building a message that is discarded after it
+// is written.
+//
+// 'clear' retains the first chunk (which, after 'flatten', holds the whole
+// previous content) so that a builder may be reused without allocating.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Building and Writing a Message
+///- - - - - - - - - - - - - - - - - - - - -
+// Suppose we compose a large message from many small fields, and write it to
+// an output stream.
+//
+// First, we create a builder that allocates chunks of at least 64 bytes:
+//..
+//  bslma::TestAllocator ta;
+//
+//  bslstl::StringBuilder builder(64, &ta);
+//..
+// Then, we append the fields of the message.  The characters already
+// appended are never moved, so each is copied only once:
+//..
+//  for (int i = 0; i < 100; ++i) {
+//      builder.append("field=");
+//      builder.append(1, static_cast<char>('0' + i % 10));
+//      builder.push_back(';');
+//  }
+//  assert(800 == builder.length());
+//  assert(1    < builder.numSegments());
+//..
+// Next, we write the message, one segment at a time, without copying it:
+//..
+//  bsl::ostringstream out(&ta);
+//  for (int i = 0; i < builder.numSegments(); ++i) {
+//      const bslstl::StringRef segment = builder.segment(i);
+//      out.write(segment.data(), segment.length());
+//  }
+//  assert(800 == out.str().length());
+//  assert(0   == out.str().compare(0, 9, "field=0;f"));
+//..
+// Finally, we coalesce the content into a single contiguous segment, for an
+// interface that requires one:
+//..
+//  const bslstl::StringRef message = builder.flatten();
+//
+//  assert(1   == builder.numSegments());
+//  assert(800 == message.length());
+//  assert(out.str() == message);
+//..
+
+// Prevent 'bslstl' headers from being included directly in 'BSL_OVERRIDES_STD'
+// mode.  Doing so is unsupported, and is likely to cause compilation errors.
+#if defined(BSL_OVERRIDES_STD) && !defined(BSL_STDHDRS_PROLOGUE_IN_EFFECT)
+#error "include <bsl_string.h> instead of <bslstl_stringbuilder.h> in \
+BSL_OVERRIDES_STD mode"
+#endif
+
+#ifndef INCLUDED_BSLSCM_VERSION
+#include <bslscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_STRING
+#include <bslstl_string.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_STRINGREF
+#include <bslstl_stringref.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_VECTOR
+#include <bslstl_vector.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_ALLOCATOR
+#include <bslma_allocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_USESBSLMAALLOCATOR
+#include <bslma_usesbslmaallocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_NESTEDTRAITDECLARATION
+#include <bslmf_nestedtraitdeclaration.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_BSLS_NATIVESTD
+#include <bsls_nativestd.h>
+#endif
+
+#ifndef INCLUDED_CSTDDEF
+#include <cstddef>
+#define INCLUDED_CSTDDEF
+#endif
+
+#ifndef INCLUDED_IOSFWD
+#include <iosfwd>
+#define INCLUDED_IOSFWD
+#endif
+
+namespace BloombergLP {
+
+namespace bslstl {
+
+                        // ==========================
+                        // struct StringBuilder_Chunk
+                        // ==========================
+
+struct StringBuilder_Chunk {
+    // This component-private 'struct' describes a chunk of a
+    // 'StringBuilder', which is allocated together with its characters.
+
+    // DATA
+    native_std::size_t d_length;    // number of characters in use
+
+    native_std::size_t d_capacity;  // number of characters available
+
+    char               d_data[1];   // first of 'd_capacity' characters
+};
+
+                        // ===================
+                        // class StringBuilder
+                        // ===================
+
+class StringBuilder {
+    // This mechanism class provides an append-only string whose characters
+    // are held in a sequence of chunks, and are never moved by appending.
+
+    // PRIVATE TYPES
+    typedef StringBuilder_Chunk Chunk;
+
+  public:
+    // PUBLIC TYPES
+    typedef native_std::size_t size_type;
+
+    enum {
+        k_DEFAULT_INITIAL_CHUNK_SIZE = 256,       // capacity of the first
+                                                  // chunk, by default
+
+        k_MAX_GROWTH_CHUNK_SIZE      = 64 * 1024  // capacity beyond which
+                                                  // chunks stop doubling
+    };
+
+  private:
+    // DATA
+    bsl::vector<Chunk *>  d_chunks;         // chunks, in order; only the last
+                                            // may be partially filled
+
+    size_type             d_length;         // total number of characters
+
+    size_type             d_nextChunkSize;  // capacity of the next chunk
+
+    size_type             d_initialChunkSize;
+                                            // capacity of the first chunk
+
+    bslma::Allocator     *d_allocator_p;    // memory allocator (held, not
+                                            // owned)
+
+    // NOT IMPLEMENTED
+    StringBuilder(const StringBuilder&);
+    StringBuilder& operator=(const StringBuilder&);
+
+    // PRIVATE MANIPULATORS
+    Chunk *addChunk(size_type minCapacity);
+        // Append to this builder, and return, a new, empty chunk having a
+        // capacity of at least the specified 'minCapacity'.  If an exception
+        // is thrown, this builder is unchanged.
+
+    void deallocateChunks(native_std::size_t begin);
+        // Return the chunks of this builder at and after the specified
+        // 'begin' index to the allocator, and remove them from this builder.
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(StringBuilder, bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    explicit StringBuilder(bslma::Allocator *basicAllocator = 0);
+    explicit StringBuilder(size_type         initialChunkSize,
+                           bslma::Allocator *basicAllocator = 0);
+        // Create an empty builder.  Optionally specify an 'initialChunkSize'
+        // capacity of the first chunk allocated; if 'initialChunkSize' is not
+        // specified, 'k_DEFAULT_INITIAL_CHUNK_SIZE' is used.  Optionally
+        // specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.  No memory is allocated until characters are appended.  The
+        // behavior is undefined unless '0 < initialChunkSize'.
+
+    ~StringBuilder();
+        // Destroy this builder, releasing all of its chunks.
+
+    // MANIPULATORS
+    StringBuilder& append(const StringRef& string);
+        // Append the characters of the specified 'string' to this builder,
+        // and return a reference providing modifiable access to this builder.
+
+    StringBuilder& append(const char *characters, size_type numCharacters);
+        // Append the specified 'numCharacters' at the specified 'characters'
+        // address to this builder, and return a reference providing
+        // modifiable access to this builder.  The behavior is undefined
+        // unless 'characters' refers to at least 'numCharacters' characters,
+        // none of which is held by this builder.
+
+    StringBuilder& append(size_type numCharacters, char character);
+        // Append the specified 'numCharacters' copies of the specified
+        // 'character' to this builder, and return a reference providing
+        // modifiable access to this builder.
+
+    void push_back(char character);
+        // Append the specified 'character' to this builder.
+
+    void clear();
+        // Remove all characters from this builder, releasing all of its
+        // chunks except the first, which is retained for reuse.
+
+    StringRef flatten();
+        // Coalesce the characters of this builder into a single chunk (if
+        // they are held in more than one), and return a reference to them.
+        // The returned reference remains valid until this builder is
+        // modified other than by appending, or destroyed.  Note that the
+        // characters are not null-terminated.
+
+    // ACCESSORS
+    size_type length() const;
+        // Return the number of characters in this builder.
+
+    bool empty() const;
+        // Return 'true' if this builder has no characters, and 'false'
+        // otherwise.
+
+    int numSegments() const;
+        // Return the number of contiguous segments holding the characters of
+        // this builder, which is 0 if this builder is empty.
+
+    StringRef segment(int index) const;
+        // Return a reference to the characters held in the segment at the
+        // specified 'index'.  The segments, in order of increasing index,
+        // hold the characters of this builder in the order they were
+        // appended, and none is empty.  The behavior is undefined unless
+        // '0 <= index < numSegments()'.  Note that the reference remains
+        // valid until this builder is modified other than by appending, or
+        // destroyed.
+
+    void toString(bsl::string *result) const;
+        // Load into the specified 'result' the characters of this builder.
+
+    bslma::Allocator *allocator() const;
+        // Return the allocator used by this builder to supply memory.
+};
+
+// FREE OPERATORS
+native_std::ostream& operator<<(native_std::ostream&  stream,
+                                const StringBuilder& builder);
+    // Write the characters of the specified 'builder' to the specified output
+    // 'stream', one segment at a time, and return a reference to 'stream'.
+
+// ============================================================================
+//                      INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+                        // -------------------
+                        // class StringBuilder
+                        // -------------------
+
+// MANIPULATORS
+inline
+StringBuilder& StringBuilder::append(const StringRef& string)
+{
+    return append(string.data(), string.length());
+}
+
+inline
+void StringBuilder::push_back(char character)
+{
+    append(1, character);
+}
+
+// ACCESSORS
+inline
+StringBuilder::size_type StringBuilder::length() const
+{
+    return d_length;
+}
+
+inline
+bool StringBuilder::empty() const
+{
+    return 0 == d_length;
+}
+
+inline
+int StringBuilder::numSegments() const
+{
+    return d_length ? static_cast<int>(d_chunks.size()) : 0;
+}
+
+inline
+StringRef StringBuilder::segment(int index) const
+{
+    BSLS_ASSERT_SAFE(0 <= index);
+    BSLS_ASSERT_SAFE(index < numSegments());
+
+    const Chunk *chunk = d_chunks[index];
+    return StringRef(chunk->d_data, static_cast<int>(chunk->d_length));
+}
+
+inline
+bslma::Allocator *StringBuilder::allocator() const
+{
+    return d_allocator_p;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
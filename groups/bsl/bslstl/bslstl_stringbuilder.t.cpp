@@ -0,0 +1,884 @@
+// bslstl_stringbuilder.t.cpp                                         -*-C++-*-
+
+#include <bslstl_stringbuilder.h>
+
+#include <bslstl_ostringstream.h>
+#include <bslstl_string.h>
+#include <bslstl_stringref.h>
+
+#include <bslma_default.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatorexception.h>
+#include <bslma_testallocatormonitor.h>
+#include <bslma_usesbslmaallocator.h>
+#include <bsls_bsltestutil.h>
+#include <bsls_nativestd.h>
+#include <bsls_stopwatch.h>
+
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <sstream>
+
+using namespace BloombergLP;
+using namespace std;
+
+//=============================================================================
+//                             TEST PLAN
+//-----------------------------------------------------------------------------
+//                             Overview
+//                             --------
+// The component under test provides a mechanism that accumulates a string in
+// a sequence of chunks.  We verify that appending yields the expected
+// characters and segments, that characters already appended are never moved
+// by appending, that chunks grow as documented, that 'flatten' and 'clear'
+// leave the builder in the documented state, and that all memory comes from
+// the supplied allocator and is released, including when an allocation
+// throws.
+//-----------------------------------------------------------------------------
+// CREATORS
+// [ 2] explicit StringBuilder(bslma::Allocator *basicAllocator = 0);
+// [ 2] StringBuilder(size_type initialChunkSize, Allocator *ba = 0);
+// [ 2] ~StringBuilder();
+//
+// MANIPULATORS
+// [ 3] StringBuilder& append(const StringRef& string);
+// [ 2] StringBuilder& append(const char *characters, size_type n);
+// [ 3] StringBuilder& append(size_type numCharacters, char character);
+// [ 3] void push_back(char character);
+// [ 4] void clear();
+// [ 4] StringRef flatten();
+//
+// ACCESSORS
+// [ 2] size_type length() const;
+// [ 2] bool empty() const;
+// [ 2] int numSegments() const;
+// [ 2] StringRef segment(int index) const;
+// [ 3] void toString(bsl::string *result) const;
+// [ 2] bslma::Allocator *allocator() const;
+//
+// FREE OPERATORS
+// [ 3] ostream& operator<<(ostream& stream, const StringBuilder& builder);
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 5] USAGE EXAMPLE
+// [-1] PERFORMANCE TEST
+
+//=============================================================================
+//                  STANDARD BDE ASSERT TEST MACRO
+//-----------------------------------------------------------------------------
+static int testStatus = 0;
+
+static void aSsErT(bool b, const char *s, int i) {
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+//=============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef bslstl::StringBuilder Obj;
+
+//=============================================================================
+//                  HELPER CLASSES AND FUNCTIONS FOR TESTING
+//-----------------------------------------------------------------------------
+
+static
+bsl::string contents(const Obj& object, bslma::Allocator *basicAllocator)
+    // Return the concatenation of the segments of the specified 'object',
+    // having verified that none of them is empty, using the specified
+    // 'basicAllocator' to supply memory.
+{
+    bsl::string result(basicAllocator);
+    for (int i = 0; i < object.numSegments(); ++i) {
+        const bslstl::StringRef segment = object.segment(i);
+        ASSERTV(i, 0 < segment.length());
+        result.append(segment.data(), segment.length());
+    }
+    ASSERTV(result.length(), object.length(),
+            result.length() == object.length());
+    return result;
+}
+
+static
+char patternChar(size_t index)
+    // Return the character at the specified 'index' in the pattern of
+    // characters appended by the tests.
+{
+    return static_cast<char>('a' + index % 26);
+}
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+    bool     veryVeryVerbose = argc > 4;
+    bool veryVeryVeryVerbose = argc > 5;
+
+    (void) veryVeryVerbose;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    // CONCERN: No memory is obtained from the default allocator.
+
+    bslma::TestAllocator da("default", veryVeryVeryVerbose);
+    bslma::Default::setDefaultAllocatorRaw(&da);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 5: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Building and Writing a Message
+///- - - - - - - - - - - - - - - - - - - - -
+// Suppose we compose a large message from many small fields, and write it to
+// an output stream.
+//
+// First, we create a builder that allocates chunks of at least 64 bytes:
+//..
+    bslma::TestAllocator ta;
+
+    bslstl::StringBuilder builder(64, &ta);
+//..
+// Then, we append the fields of the message.  The characters already
+// appended are never moved, so each is copied only once:
+//..
+    for (int i = 0; i < 100; ++i) {
+        builder.append("field=");
+        builder.append(1, static_cast<char>('0' + i % 10));
+        builder.push_back(';');
+    }
+    ASSERT(800 == builder.length());
+    ASSERT(1    < builder.numSegments());
+//..
+// Next, we write the message, one segment at a time, without copying it:
+//..
+    bsl::ostringstream out(&ta);
+    for (int i = 0; i < builder.numSegments(); ++i) {
+        const bslstl::StringRef segment = builder.segment(i);
+        out.write(segment.data(), segment.length());
+    }
+    ASSERT(800 == out.str().length());
+    ASSERT(0   == out.str().compare(0, 9, "field=0;f"));
+//..
+// Finally, we coalesce the content into a single contiguous segment, for an
+// interface that requires one:
+//..
+    const bslstl::StringRef message = builder.flatten();
+
+    ASSERT(1   == builder.numSegments());
+    ASSERT(800 == message.length());
+    ASSERT(out.str() == message);
+//..
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // 'clear' AND 'flatten'
+        //
+        // Concerns:
+        //: 1 'flatten' yields a single segment holding all characters, in
+        //:   order, and releases the other chunks.
+        //:
+        //: 2 'flatten' does not allocate if there are fewer than two
+        //:   segments, and returns an empty reference for an empty builder.
+        //:
+        //: 3 Characters appended after 'flatten' go to new chunks, leaving
+        //:   the flattened characters in place.
+        //:
+        //: 4 'clear' removes all characters, retains the first chunk for
+        //:   reuse, releases the others, and restores the initial chunk size.
+        //:
+        //: 5 If 'flatten' throws, the builder is unchanged.
+        //
+        // Plan:
+        //: 1 For a series of lengths, append that many characters, in pieces
+        //:   of varying size, to a builder having a small initial chunk size,
+        //:   then flatten it and verify the segments, the characters, and the
+        //:   memory in use.  (C-1..3)
+        //:
+        //: 2 Clear the builder and verify its state, then append again and
+        //:   verify that the retained chunk is reused.  (C-4)
+        //:
+        //: 3 Flatten within the exception test macros.  (C-5)
+        //
+        // Testing:
+        //   void clear();
+        //   StringRef flatten();
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\n'clear' AND 'flatten'"
+                            "\n=====================\n");
+
+        bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+        bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+
+            bslma::TestAllocatorMonitor oam(&oa);
+
+            const bslstl::StringRef R = mX.flatten();
+            ASSERT(0 == R.length());
+            ASSERT(oam.isTotalSame());
+
+            mX.clear();
+            ASSERT(X.empty());
+            ASSERT(0 == X.numSegments());
+            ASSERT(oam.isTotalSame());
+
+            mX.append("abc", 3);
+            const char *const DATA = X.segment(0).data();
+
+            const bslstl::StringRef R2 = mX.flatten();
+            ASSERT(DATA == R2.data());
+            ASSERT(3    == R2.length());
+            ASSERT(oam.isInUseUp());
+            ASSERT(1    == oa.numBlocksInUse() - 1);  // one for 'd_chunks'
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+
+        static const size_t LENGTHS[] = { 1, 7, 8, 9, 23, 24, 25, 100, 1000,
+                                          5000 };
+        const int NUM_LENGTHS = sizeof LENGTHS / sizeof *LENGTHS;
+
+        for (int ti = 0; ti < NUM_LENGTHS; ++ti) {
+            const size_t LENGTH = LENGTHS[ti];
+
+            bsl::string expected(&sa);
+            for (size_t i = 0; i < LENGTH; ++i) {
+                expected.push_back(patternChar(i));
+            }
+
+            Obj mX(8, &oa);  const Obj& X = mX;
+
+            for (size_t i = 0, piece = 1; i < LENGTH; i += piece, ++piece) {
+                if (piece > LENGTH - i) {
+                    piece = LENGTH - i;
+                }
+                mX.append(expected.data() + i, piece);
+            }
+            ASSERTV(ti, expected == contents(X, &sa));
+
+            const int NUM_SEGMENTS = X.numSegments();
+
+            bslma::TestAllocatorMonitor oam(&oa);
+
+            const bslstl::StringRef R = mX.flatten();
+
+            ASSERTV(ti, 1 == X.numSegments());
+            ASSERTV(ti, LENGTH == X.length());
+            ASSERTV(ti, expected == R);
+            ASSERTV(ti, R.data() == X.segment(0).data());
+            if (1 < NUM_SEGMENTS) {
+                ASSERTV(ti, oam.isTotalUp());
+                ASSERTV(ti, oam.isInUseDown());
+            }
+            else {
+                ASSERTV(ti, oam.isTotalSame());
+            }
+
+            // Appending after 'flatten' leaves the flattened characters in
+            // place.
+
+            mX.append("XYZ", 3);
+            ASSERTV(ti, (1 == NUM_SEGMENTS && LENGTH + 3 <= 8 ? 1 : 2)
+                                                         == X.numSegments());
+            ASSERTV(ti, R.data() == X.segment(0).data());
+            bsl::string expectedXYZ(expected, &sa);
+            expectedXYZ += "XYZ";
+            ASSERTV(ti, expectedXYZ == contents(X, &sa));
+
+            // 'clear' retains the first chunk.
+
+            const char *const FIRST = X.segment(0).data();
+
+            mX.clear();
+            ASSERTV(ti, X.empty());
+            ASSERTV(ti, 0 == X.length());
+            ASSERTV(ti, 0 == X.numSegments());
+            ASSERTV(ti, 2 == oa.numBlocksInUse());  // chunk and 'd_chunks'
+
+            bslma::TestAllocatorMonitor oam2(&oa);
+
+            mX.append("12345678", 8);
+            ASSERTV(ti, 1 == X.numSegments());
+            ASSERTV(ti, FIRST == X.segment(0).data());
+            ASSERTV(ti, oam2.isTotalSame());
+
+            // The initial chunk size is restored by 'clear', so that the next
+            // chunk has 8 characters.
+
+            while (X.numSegments() < 3) {
+                mX.push_back('x');
+            }
+            ASSERTV(ti, 8 == X.segment(1).length());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+
+        if (verbose) printf("\nException safety of 'flatten'.\n");
+        {
+            Obj mX(4, &oa);  const Obj& X = mX;
+            mX.append("abcdefghij", 10);
+            mX.append("klmnopqrstuvwxyz", 16);
+
+            const int NUM_SEGMENTS = X.numSegments();
+            ASSERT(1 < NUM_SEGMENTS);
+
+            BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                ASSERT(NUM_SEGMENTS == X.numSegments());
+
+                const bslstl::StringRef R = mX.flatten();
+                ASSERT(R == "abcdefghijklmnopqrstuvwxyz");
+            } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+            ASSERT(1 == X.numSegments());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+        ASSERT(0 == da.numBlocksTotal());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // OTHER APPEND METHODS AND OUTPUT
+        //
+        // Concerns:
+        //: 1 'append' of a 'StringRef', 'append' of repeated characters, and
+        //:   'push_back' append the expected characters, using the room left
+        //:   in the last chunk before adding a chunk.
+        //:
+        //: 2 Appending zero characters has no effect, and does not allocate.
+        //:
+        //: 3 If an allocation throws, the builder is unchanged.
+        //:
+        //: 4 'toString' and 'operator<<' produce all characters, in order.
+        //
+        // Plan:
+        //: 1 Append, using each method in turn, to a builder having a small
+        //:   initial chunk size, verifying the characters after each append
+        //:   against a 'bsl::string' to which the same characters are
+        //:   appended.  (C-1..2)
+        //:
+        //: 2 Perform each append within the exception test macros.  (C-3)
+        //:
+        //: 3 Compare the result of 'toString' and of 'operator<<' with the
+        //:   expected characters.  (C-4)
+        //
+        // Testing:
+        //   StringBuilder& append(const StringRef& string);
+        //   StringBuilder& append(size_type numCharacters, char character);
+        //   void push_back(char character);
+        //   void toString(bsl::string *result) const;
+        //   ostream& operator<<(ostream& stream, const StringBuilder& b);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nOTHER APPEND METHODS AND OUTPUT"
+                            "\n===============================\n");
+
+        bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+        bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+        {
+            Obj mX(5, &oa);  const Obj& X = mX;
+
+            bsl::string expected(&sa);
+
+            for (int ti = 0; ti < 60; ++ti) {
+                const size_t N = ti % 11;
+                const char   C = patternChar(ti);
+
+                const int NUM_SEGMENTS = X.numSegments();
+
+                bslma::TestAllocatorMonitor oam(&oa);
+
+                switch (ti % 3) {
+                  case 0: {
+                    const bsl::string S(N, C, &sa);
+                    const bslstl::StringRef R(S.data(),
+                                              static_cast<int>(S.length()));
+
+                    BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                        ASSERTV(ti, expected.length() == X.length());
+
+                        Obj& RESULT = mX.append(R);
+                        ASSERTV(ti, &X == &RESULT);
+                    } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+                    expected += S;
+                  } break;
+                  case 1: {
+                    BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                        ASSERTV(ti, expected.length() == X.length());
+
+                        Obj& RESULT = mX.append(N, C);
+                        ASSERTV(ti, &X == &RESULT);
+                    } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+                    expected.append(N, C);
+                  } break;
+                  case 2: {
+                    BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                        ASSERTV(ti, expected.length() == X.length());
+
+                        mX.push_back(C);
+                    } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+                    expected.push_back(C);
+                  } break;
+                }
+
+                if (veryVerbose) {
+                    T_ P_(ti) P_(X.length()) P(X.numSegments())
+                }
+
+                ASSERTV(ti, expected == contents(X, &sa));
+                if (0 == N && 2 != ti % 3) {
+                    ASSERTV(ti, oam.isTotalSame());
+                    ASSERTV(ti, NUM_SEGMENTS == X.numSegments());
+                }
+            }
+
+            bsl::string result("garbage", &sa);
+            X.toString(&result);
+            ASSERT(expected == result);
+
+            // Use a native stream, whose 'str' does not use the default
+            // allocator.
+
+            native_std::ostringstream out;
+            out << X;
+            const native_std::string OUT = out.str();
+            ASSERT(expected == bslstl::StringRef(
+                                             OUT.data(),
+                                             static_cast<int>(OUT.size())));
+
+            Obj mY(&oa);  const Obj& Y = mY;
+            Y.toString(&result);
+            ASSERT(result.empty());
+
+            native_std::ostringstream out2;
+            out2 << Y;
+            ASSERT(out2.str().empty());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+        ASSERT(0 == da.numBlocksTotal());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // PRIMARY MANIPULATOR AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 A newly created builder is empty, has no segments, and does not
+        //:   allocate.
+        //:
+        //: 2 Memory is obtained from the supplied allocator, or the default
+        //:   allocator if none is supplied, and is released on destruction.
+        //:
+        //: 3 Appending yields segments that hold the characters appended, in
+        //:   order, none of which is empty.
+        //:
+        //: 4 Appending never moves the characters already appended.
+        //:
+        //: 5 The first chunk has the initial chunk size, and subsequent chunks
+        //:   double in size up to 'k_MAX_GROWTH_CHUNK_SIZE' (or the initial
+        //:   chunk size, if larger), except that a chunk holds at least the
+        //:   characters of an append that do not fit in the previous chunk.
+        //
+        // Plan:
+        //: 1 Create builders with and without an allocator and an initial
+        //:   chunk size, and verify their state.  (C-1..2)
+        //:
+        //: 2 Append single characters, recording the address of each segment,
+        //:   and verify the segment lengths and addresses as the builder
+        //:   grows.  (C-3..5)
+        //:
+        //: 3 Append a piece larger than the chunk size and verify that it is
+        //:   split between the room left in the last chunk and a new chunk.
+        //:   (C-5)
+        //
+        // Testing:
+        //   explicit StringBuilder(bslma::Allocator *basicAllocator = 0);
+        //   StringBuilder(size_type initialChunkSize, Allocator *ba = 0);
+        //   ~StringBuilder();
+        //   StringBuilder& append(const char *characters, size_type n);
+        //   size_type length() const;
+        //   bool empty() const;
+        //   int numSegments() const;
+        //   StringRef segment(int index) const;
+        //   bslma::Allocator *allocator() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nPRIMARY MANIPULATOR AND BASIC ACCESSORS"
+                            "\n=======================================\n");
+
+        ASSERT(bslma::UsesBslmaAllocator<Obj>::value);
+
+        {
+            const Obj X;
+            ASSERT(&da == X.allocator());
+            ASSERT(X.empty());
+            ASSERT(0 == X.length());
+            ASSERT(0 == X.numSegments());
+        }
+        ASSERT(0 == da.numBlocksTotal());
+
+        bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+        bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+
+        if (verbose) printf("\nGrowth of chunks.\n");
+        {
+            static const struct {
+                int    d_line;         // source line number
+                size_t d_initial;      // initial chunk size, or 0 for default
+                size_t d_length;       // number of characters to append
+                int    d_numSegments;  // expected number of segments
+                size_t d_lastLength;   // expected length of last segment
+            } DATA[] = {
+                //LINE  INITIAL   LENGTH   NUM  LAST
+                //----  -------  -------   ---  -----
+                { L_,         0,       1,    1,     1 },
+                { L_,         0,     256,    1,   256 },
+                { L_,         0,     257,    2,     1 },
+                { L_,         0,     768,    2,   512 },
+                { L_,         0,     769,    3,     1 },
+                { L_,         1,       1,    1,     1 },
+                { L_,         1,       2,    2,     1 },
+                { L_,         1,       3,    2,     2 },
+                { L_,         1,       4,    3,     1 },
+                { L_,     65536,  131072,    2, 65536 },
+                { L_,     65536,  131073,    3,     1 },
+                { L_,    100000,  200001,    3,     1 },
+                { L_,     32768,  229376,    4, 65536 },
+                { L_,     32768,  229377,    5,     1 },
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int    LINE    = DATA[ti].d_line;
+                const size_t INITIAL = DATA[ti].d_initial;
+                const size_t LENGTH  = DATA[ti].d_length;
+                const int    NUM     = DATA[ti].d_numSegments;
+                const size_t LAST    = DATA[ti].d_lastLength;
+
+                Obj  mD(&oa);
+                Obj  mI(INITIAL ? INITIAL : 1, &oa);
+                Obj& mX = INITIAL ? mI : mD;  const Obj& X = mX;
+
+                ASSERTV(LINE, &oa == X.allocator());
+
+                bsl::vector<const char *> addresses(&sa);
+                for (size_t i = 0; i < LENGTH; ++i) {
+                    const char C = patternChar(i);
+                    mX.append(&C, 1);
+
+                    if (addresses.size() < static_cast<size_t>(
+                                                          X.numSegments())) {
+                        addresses.push_back(X.segment(X.numSegments() - 1)
+                                                                    .data());
+                    }
+                }
+
+                ASSERTV(LINE, LENGTH == X.length());
+                ASSERTV(LINE, !X.empty());
+                ASSERTV(LINE, NUM, X.numSegments(), NUM == X.numSegments());
+                ASSERTV(LINE, LAST == X.segment(X.numSegments() - 1).length());
+
+                size_t offset = 0;
+                for (int i = 0; i < X.numSegments(); ++i) {
+                    const bslstl::StringRef SEGMENT = X.segment(i);
+                    ASSERTV(LINE, i, addresses[i] == SEGMENT.data());
+                    for (size_t j = 0; j < SEGMENT.length(); ++j) {
+                        if (patternChar(offset + j) != SEGMENT[j]) {
+                            ASSERTV(LINE, i, j, false);
+                            break;
+                        }
+                    }
+                    offset += SEGMENT.length();
+                }
+                ASSERTV(LINE, LENGTH == offset);
+            }
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+
+        if (verbose) printf("\nAppending pieces larger than a chunk.\n");
+        {
+            bsl::string piece(&sa);
+            for (size_t i = 0; i < 100; ++i) {
+                piece.push_back(patternChar(i));
+            }
+
+            Obj mX(16, &oa);  const Obj& X = mX;
+
+            bslma::TestAllocatorMonitor oam(&oa);
+
+            mX.append(piece.data(), 10);
+            ASSERT(1  == X.numSegments());
+            ASSERT(10 == X.segment(0).length());
+            ASSERT(oam.isTotalUp());
+
+            const char *const FIRST = X.segment(0).data();
+
+            // The room left in the first chunk is filled, and the remaining
+            // 94 characters get a chunk of their own, larger than the 32
+            // characters of the next chunk.
+
+            mX.append(piece.data(), 100);
+            ASSERT(2     == X.numSegments());
+            ASSERT(FIRST == X.segment(0).data());
+            ASSERT(16    == X.segment(0).length());
+            ASSERT(94    == X.segment(1).length());
+            ASSERT(110   == X.length());
+
+            bsl::string expected(piece.data(), 10, &sa);
+            expected += piece;
+            ASSERT(expected == contents(X, &sa));
+
+            // The large chunk took the place of the 32-character chunk, so
+            // the next chunk has 64 characters.
+
+            mX.append(piece.data(), 64);
+            mX.append(piece.data(), 1);
+            ASSERT(4  == X.numSegments());
+            ASSERT(64 == X.segment(2).length());
+            ASSERT(1  == X.segment(3).length());
+
+            // Appending nothing has no effect.
+
+            bslma::TestAllocatorMonitor oam2(&oa);
+
+            mX.append(piece.data(), 0);
+            mX.append(0, 'x');
+            ASSERT(4   == X.numSegments());
+            ASSERT(175 == X.length());
+            ASSERT(oam2.isTotalSame());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+        ASSERT(0 == da.numBlocksTotal());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Append to a builder, inspect its segments, and flatten it.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        {
+            Obj mX(4, &oa);  const Obj& X = mX;
+            ASSERT(X.empty());
+
+            mX.append("Hel");
+            mX.append("lo");
+            ASSERT(5 == X.length());
+            ASSERT(2 == X.numSegments());
+            ASSERT(X.segment(0) == "Hell");
+            ASSERT(X.segment(1) == "o");
+
+            mX.push_back(',');
+            mX.append(1, ' ').append("world");
+            ASSERT(12 == X.length());
+
+            const bslstl::StringRef R = mX.flatten();
+            ASSERT(1 == X.numSegments());
+            ASSERT(R == "Hello, world");
+
+            mX.clear();
+            ASSERT(X.empty());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST
+        //
+        // Concerns:
+        //: 1 Building a large message from many small fields with a
+        //:   'StringBuilder' copies fewer bytes, and is no slower, than with
+        //:   'bsl::string::append'.
+        //
+        // Plan:
+        //: 1 Build a message of about 16 megabytes from fields of a few bytes
+        //:   each, with 'bsl::string' and with 'StringBuilder', then write the
+        //:   message to a buffer, and report the number of allocations, the
+        //:   number of bytes allocated, and the time taken.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nPERFORMANCE TEST"
+                            "\n================\n");
+
+        const int NUM_FIELDS = 2 * 1000 * 1000;
+
+        static const char *const FIELDS[] = {
+            "35=D|", "49=SENDER|", "56=TARGET|", "55=IBM|", "54=1|",
+            "38=100|", "44=155.25|", "10=123|"
+        };
+        const int NUM_FIELD_VALUES = sizeof FIELDS / sizeof *FIELDS;
+
+        size_t lengths[NUM_FIELD_VALUES];
+        for (int i = 0; i < NUM_FIELD_VALUES; ++i) {
+            lengths[i] = strlen(FIELDS[i]);
+        }
+
+        bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+        bsl::vector<char>    buffer(&sa);
+
+        printf("%-22s %10s %12s %9s %9s\n",
+               "type", "allocs", "bytes", "build(s)", "write(s)");
+
+        {
+            bslma::TestAllocator ta;
+            bsls::Stopwatch      timer;
+            {
+                bsl::string message(&ta);
+
+                timer.start();
+                for (int i = 0; i < NUM_FIELDS; ++i) {
+                    const int f = i % NUM_FIELD_VALUES;
+                    message.append(FIELDS[f], lengths[f]);
+                }
+                timer.stop();
+                const double buildTime = timer.accumulatedWallTime();
+
+                timer.reset();
+                timer.start();
+                buffer.assign(message.begin(), message.end());
+                timer.stop();
+
+                printf("%-22s %10lld %12lld %9.4f %9.4f\n",
+                       "bsl::string",
+                       ta.numBlocksTotal(),
+                       ta.numBytesMax(),
+                       buildTime,
+                       timer.accumulatedWallTime());
+            }
+        }
+        const size_t LENGTH = buffer.size();
+
+        {
+            bslma::TestAllocator ta;
+            bsls::Stopwatch      timer;
+            {
+                Obj message(&ta);
+
+                timer.start();
+                for (int i = 0; i < NUM_FIELDS; ++i) {
+                    const int f = i % NUM_FIELD_VALUES;
+                    message.append(FIELDS[f], lengths[f]);
+                }
+                timer.stop();
+                const double buildTime = timer.accumulatedWallTime();
+
+                timer.reset();
+                timer.start();
+                buffer.clear();
+                for (int i = 0; i < message.numSegments(); ++i) {
+                    const bslstl::StringRef segment = message.segment(i);
+                    buffer.insert(buffer.end(), segment.begin(),
+                                                segment.end());
+                }
+                timer.stop();
+                ASSERT(LENGTH == buffer.size());
+
+                printf("%-22s %10lld %12lld %9.4f %9.4f\n",
+                       "bslstl::StringBuilder",
+                       ta.numBlocksTotal(),
+                       ta.numBytesMax(),
+                       buildTime,
+                       timer.accumulatedWallTime());
+            }
+        }
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
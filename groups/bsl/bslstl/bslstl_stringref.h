@@ -65,7 +65,11 @@ BSLS_IDENT("$Id: $")
 //
 // The 'bsl::hash' template class is specialized for 'bslstl::StringRef' to
 // enable the use of 'bslstl::StringRef' with STL hash containers (e.g.,
-// 'bsl::unordered_set' and 'bsl::unordered_map').
+// 'bsl::unordered_set' and 'bsl::unordered_map').  The specialization is
+// transparent (i.e., it declares the nested type 'is_transparent'), accepting
+// anything implicitly convertible to 'bslstl::StringRef', and returns the same
+// value as 'bsl::hash<bsl::string>' for a string reference, a 'bsl::string',
+// or a null-terminated 'const char *' referring to the same characters.
 //
 ///Efficiency and Usage Considerations
 ///-----------------------------------
@@ -256,6 +260,10 @@ BSLS_IDENT("$Id: $")
 #include <bsls_assert.h>
 #endif
 
+#ifndef INCLUDED_BSLSTL_HASH
+#include <bslstl_hash.h>
+#endif
+
 #ifndef INCLUDED_BSLSTL_STRING
 #include <bslstl_string.h>
 #endif
@@ -949,7 +957,10 @@ inline
 bool bslstl::operator==(const StringRefImp<CHAR_TYPE>& lhs,
                         const StringRefImp<CHAR_TYPE>& rhs)
 {
-    return lhs.compare(rhs) == 0;
+    // Strings of different lengths are unequal without examining their
+    // characters.
+
+    return lhs.length() == rhs.length() && lhs.compare(rhs) == 0;
 }
 
 template <typename CHAR_TYPE>
@@ -1397,6 +1408,44 @@ void bslstl::hashAppend(HASHALG& hashAlg,
 
 }  // close enterprise namespace
 
+namespace bsl {
+
+                        // =========================
+                        // struct hash<StringRefImp>
+                        // =========================
+
+template <class CHAR_TYPE>
+struct hash<BloombergLP::bslstl::StringRefImp<CHAR_TYPE> > {
+    // This partial specialization of 'hash' for 'bslstl::StringRefImp' is a
+    // transparent hash functor, accepting (by implicit conversion) strings
+    // and null-terminated character arrays as well as string references.
+
+    // PUBLIC TYPES
+    typedef BloombergLP::bslstl::StringRefImp<CHAR_TYPE> argument_type;
+    typedef std::size_t                                  result_type;
+    typedef void                                         is_transparent;
+
+    // ACCESSORS
+    std::size_t operator()(const argument_type& input) const;
+        // Return a hash value for the sequence of characters referred to by
+        // the specified 'input'.
+};
+
+                        // -------------------------
+                        // struct hash<StringRefImp>
+                        // -------------------------
+
+// ACCESSORS
+template <class CHAR_TYPE>
+inline
+std::size_t hash<BloombergLP::bslstl::StringRefImp<CHAR_TYPE> >::operator()(
+                                            const argument_type& input) const
+{
+    return ::BloombergLP::bslh::Hash<>()(input);
+}
+
+}  // close namespace bsl
+
 #endif
 
 // ----------------------------------------------------------------------------
@@ -2,6 +2,8 @@
 
 #include <bslstl_stringref.h>
 
+#include <bslmf_issame.h>
+
 #include <bsls_asserttest.h>
 #include <bsls_bsltestutil.h>
 #include <bsls_nativestd.h>
@@ -753,6 +755,11 @@ int main(int argc, char *argv[])
         //;   bslh:Hash. The whole string should be used in this hash.
         //:   'bsl::hash' specialization has been deleted, so calls to
         //:   'bsl::hash' should automatically forward to 'bslh::Hash'.
+        //:
+        //: 3 'bsl::hash<StringRef>' is transparent, and it and
+        //:   'bsl::hash<bsl::string>' return the same value for a string
+        //:   reference, a 'bsl::string', and a null-terminated 'const char *'
+        //:   referring to the same characters.
         //
         // Plan:
         //: 1 Hash a reasonably large number of strings, capturing the hash
@@ -775,6 +782,12 @@ int main(int argc, char *argv[])
         //:    string is being hashed. Also hash multiple copies of the same
         //:    string and ensure they produce the same hash to make sure
         //:    nothing beyond the end of the string is being hashed.
+        //:
+        //: 3 Verify that 'bsl::hash<StringRef>' declares 'is_transparent'.
+        //:   For each string hashed in P-1, compare the values returned by
+        //:   'bsl::hash<StringRef>' and 'bsl::hash<bsl::string>' for the
+        //:   'const char *', a 'bsl::string', and a 'StringRef' with the
+        //:   value returned by 'bslh::Hash<>' for the 'StringRef'.  (C-3)
         //
         // Testing:
         //   bsl::hash<BloombergLP::bslstl::StringRef>
@@ -1968,8 +1981,14 @@ int main(int argc, char *argv[])
         std::map<Obj, std::size_t> hash_results;
         std::map<std::size_t, int> hash_value_counts;
 
-        bsl::hash<Obj>        bsl_hash_function;
-        bslh::Hash<>          bslh_hash_function;
+        bsl::hash<Obj>         bsl_hash_function;
+        bslh::Hash<>           bslh_hash_function;
+        bsl::hash<bsl::string> bsl_string_hash_function;
+
+        ASSERT((bsl::is_same<void,
+                             bsl::hash<Obj>::is_transparent>::value));
+        ASSERT((bsl::is_same<void,
+                             bsl::hash<bsl::string>::is_transparent>::value));
 
         // Capture all the hash values.
         for (int ti = 0; ti < NUM_DATA; ++ti) {
@@ -1985,6 +2004,16 @@ int main(int argc, char *argv[])
             // Ensure bslh::Hash and bsl::hash produce the same value
             ASSERT(hash_value == bsl_hash_value);
 
+            // Ensure the transparent hash functors produce the same value
+            // however the characters are supplied.
+            const bsl::string s(STR);
+
+            LOOP_ASSERT(LINE, hash_value == bsl_hash_function(STR));
+            LOOP_ASSERT(LINE, hash_value == bsl_hash_function(s));
+            LOOP_ASSERT(LINE, hash_value == bsl_string_hash_function(STR));
+            LOOP_ASSERT(LINE, hash_value == bsl_string_hash_function(s));
+            LOOP_ASSERT(LINE, hash_value == bsl_string_hash_function(o));
+
             if (veryVerbose) {
                 printf("%4d: STR=%-20s, HASH=" ZU "\n",LINE, STR, hash_value);
             }
@@ -0,0 +1,500 @@
+// bslstl_stringrefutil.cpp                                           -*-C++-*-
+#include <bslstl_stringrefutil.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id$ $CSID$")
+
+#include <bsls_assert.h>
+#include <bsls_platform.h>
+
+#include <cstring>
+
+#if (defined(BSLS_PLATFORM_CPU_X86_64) || defined(BSLS_PLATFORM_CPU_X86))     \
+ && (defined(BSLS_PLATFORM_CMP_CLANG)                                         \
+  || (defined(BSLS_PLATFORM_CMP_GNU) && BSLS_PLATFORM_CMP_VERSION >= 40900))
+// These compilers accept the 'target' attribute, allowing functions using
+// instructions beyond the baseline of the build to be compiled, and provide
+// '__builtin_cpu_supports' to decide at run time whether they may be called.
+
+#define BSLSTL_STRINGREFUTIL_X86_DISPATCH 1
+#include <immintrin.h>
+#endif
+
+namespace BloombergLP {
+
+namespace {
+
+typedef bslstl::StringRefUtil Util;
+
+inline
+unsigned char toLowerChar(char character)
+    // Return the specified 'character', converted to lower case if it is an
+    // ASCII letter, as an 'unsigned char'.
+{
+    const unsigned char c = static_cast<unsigned char>(character);
+    return static_cast<unsigned char>(
+                          static_cast<unsigned char>(c - 'A') < 26 ? c | 0x20
+                                                                   : c);
+}
+
+                        // --------------
+                        // scalar kernels
+                        // --------------
+
+native_std::size_t scalarMismatch(const char         *lhs,
+                                  const char         *rhs,
+                                  native_std::size_t  length)
+    // Return the index of the first of the specified 'length' characters at
+    // the specified 'lhs' and 'rhs' addresses that differ, or 'length' if
+    // there is none.
+{
+    native_std::size_t i = 0;
+    while (i < length && lhs[i] == rhs[i]) {
+        ++i;
+    }
+    return i;
+}
+
+native_std::size_t scalarMismatchCaseless(const char         *lhs,
+                                          const char         *rhs,
+                                          native_std::size_t  length)
+    // Return the index of the first of the specified 'length' characters at
+    // the specified 'lhs' and 'rhs' addresses that differ after converting
+    // ASCII letters to lower case, or 'length' if there is none.
+{
+    native_std::size_t i = 0;
+    while (i < length && toLowerChar(lhs[i]) == toLowerChar(rhs[i])) {
+        ++i;
+    }
+    return i;
+}
+
+void scalarToLower(char               *result,
+                   const char         *string,
+                   native_std::size_t  length)
+    // Load into the specified 'result' the specified 'length' characters at
+    // the specified 'string' address, with ASCII letters converted to lower
+    // case.
+{
+    for (native_std::size_t i = 0; i < length; ++i) {
+        result[i] = static_cast<char>(toLowerChar(string[i]));
+    }
+}
+
+#ifdef BSLSTL_STRINGREFUTIL_X86_DISPATCH
+
+                        // ------------
+                        // SSE2 kernels
+                        // ------------
+
+__attribute__((target("sse2")))
+inline
+__m128i sse2Load(const char *block)
+    // Return the 16 characters at the specified 'block' address.
+{
+    return _mm_loadu_si128(reinterpret_cast<const __m128i *>(block));
+}
+
+__attribute__((target("sse2")))
+inline
+__m128i sse2ToLower(__m128i characters)
+    // Return the specified 'characters', with ASCII letters converted to
+    // lower case.
+{
+    // Rotate the range of 'char' so that 'A' becomes the smallest signed
+    // value, then set the 0x20 bit of the characters in the 26 smallest
+    // values.
+
+    const __m128i rotated = _mm_add_epi8(characters,
+                                         _mm_set1_epi8(0x80 - 'A'));
+    const __m128i isUpper = _mm_cmplt_epi8(rotated,
+                                           _mm_set1_epi8(-0x80 + 26));
+    return _mm_or_si128(characters,
+                        _mm_and_si128(isUpper, _mm_set1_epi8(0x20)));
+}
+
+__attribute__((target("sse2")))
+inline
+unsigned int sse2Differ(__m128i lhs, __m128i rhs)
+    // Return a mask having bit 'i' set if the character at index 'i' of the
+    // specified 'lhs' differs from that of the specified 'rhs'.
+{
+    return ~static_cast<unsigned int>(
+                      _mm_movemask_epi8(_mm_cmpeq_epi8(lhs, rhs))) & 0xFFFFu;
+}
+
+__attribute__((target("sse2")))
+native_std::size_t sse2Mismatch(const char         *lhs,
+                                const char         *rhs,
+                                native_std::size_t  length,
+                                bool                isCaseless)
+    // Return the index of the first of the specified 'length' characters at
+    // the specified 'lhs' and 'rhs' addresses that differ, after converting
+    // ASCII letters to lower case if the specified 'isCaseless' is 'true', or
+    // 'length' if there is none.
+{
+    if (length < 16) {
+        return isCaseless ? scalarMismatchCaseless(lhs, rhs, length)
+                          : scalarMismatch(lhs, rhs, length);         // RETURN
+    }
+
+    // The last block overlaps the previous one unless 'length' is a multiple
+    // of 16, so that no character beyond the strings is read.
+
+    for (native_std::size_t i = 0;; i += 16) {
+        if (i + 16 > length) {
+            i = length - 16;
+        }
+        __m128i l = sse2Load(lhs + i);
+        __m128i r = sse2Load(rhs + i);
+        if (isCaseless) {
+            l = sse2ToLower(l);
+            r = sse2ToLower(r);
+        }
+        const unsigned int mask = sse2Differ(l, r);
+        if (mask) {
+            return i + __builtin_ctz(mask);                           // RETURN
+        }
+        if (i + 16 == length) {
+            return length;                                            // RETURN
+        }
+    }
+}
+
+__attribute__((target("sse2")))
+void sse2ToLowerString(char               *result,
+                       const char         *string,
+                       native_std::size_t  length)
+    // Load into the specified 'result' the specified 'length' characters at
+    // the specified 'string' address, with ASCII letters converted to lower
+    // case.
+{
+    if (length < 16) {
+        scalarToLower(result, string, length);
+        return;                                                       // RETURN
+    }
+
+    // Converting the overlapping last block again is harmless, even if
+    // 'result == string', as the conversion is idempotent.
+
+    for (native_std::size_t i = 0;; i += 16) {
+        if (i + 16 > length) {
+            i = length - 16;
+        }
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(result + i),
+                         sse2ToLower(sse2Load(string + i)));
+        if (i + 16 == length) {
+            return;                                                   // RETURN
+        }
+    }
+}
+
+                        // ------------
+                        // AVX2 kernels
+                        // ------------
+
+__attribute__((target("avx2")))
+inline
+__m256i avx2Load(const char *block)
+    // Return the 32 characters at the specified 'block' address.
+{
+    return _mm256_loadu_si256(reinterpret_cast<const __m256i *>(block));
+}
+
+__attribute__((target("avx2")))
+inline
+__m256i avx2ToLower(__m256i characters)
+    // Return the specified 'characters', with ASCII letters converted to
+    // lower case.
+{
+    const __m256i rotated = _mm256_add_epi8(characters,
+                                            _mm256_set1_epi8(0x80 - 'A'));
+    const __m256i isUpper = _mm256_cmpgt_epi8(_mm256_set1_epi8(-0x80 + 26),
+                                              rotated);
+    return _mm256_or_si256(characters,
+                           _mm256_and_si256(isUpper, _mm256_set1_epi8(0x20)));
+}
+
+__attribute__((target("avx2")))
+native_std::size_t avx2Mismatch(const char         *lhs,
+                                const char         *rhs,
+                                native_std::size_t  length,
+                                bool                isCaseless)
+    // Return the index of the first of the specified 'length' characters at
+    // the specified 'lhs' and 'rhs' addresses that differ, after converting
+    // ASCII letters to lower case if the specified 'isCaseless' is 'true', or
+    // 'length' if there is none.
+{
+    if (length < 32) {
+        return sse2Mismatch(lhs, rhs, length, isCaseless);            // RETURN
+    }
+
+    for (native_std::size_t i = 0;; i += 32) {
+        if (i + 32 > length) {
+            i = length - 32;
+        }
+        __m256i l = avx2Load(lhs + i);
+        __m256i r = avx2Load(rhs + i);
+        if (isCaseless) {
+            l = avx2ToLower(l);
+            r = avx2ToLower(r);
+        }
+        const unsigned int mask = ~static_cast<unsigned int>(
+                              _mm256_movemask_epi8(_mm256_cmpeq_epi8(l, r)));
+        if (mask) {
+            return i + __builtin_ctz(mask);                           // RETURN
+        }
+        if (i + 32 == length) {
+            return length;                                            // RETURN
+        }
+    }
+}
+
+__attribute__((target("avx2")))
+void avx2ToLowerString(char               *result,
+                       const char         *string,
+                       native_std::size_t  length)
+    // Load into the specified 'result' the specified 'length' characters at
+    // the specified 'string' address, with ASCII letters converted to lower
+    // case.
+{
+    if (length < 32) {
+        sse2ToLowerString(result, string, length);
+        return;                                                       // RETURN
+    }
+
+    for (native_std::size_t i = 0;; i += 32) {
+        if (i + 32 > length) {
+            i = length - 32;
+        }
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(result + i),
+                            avx2ToLower(avx2Load(string + i)));
+        if (i + 32 == length) {
+            return;                                                   // RETURN
+        }
+    }
+}
+
+#endif  // BSLSTL_STRINGREFUTIL_X86_DISPATCH
+
+                        // -----------------
+                        // kernel dispatcher
+                        // -----------------
+
+native_std::size_t mismatch(const char         *lhs,
+                            const char         *rhs,
+                            native_std::size_t  length,
+                            bool                isCaseless,
+                            Util::Kernel        kernel)
+    // Return the index of the first of the specified 'length' characters at
+    // the specified 'lhs' and 'rhs' addresses that differ, after converting
+    // ASCII letters to lower case if the specified 'isCaseless' is 'true', or
+    // 'length' if there is none, using the specified 'kernel'.
+{
+    switch (kernel) {
+#ifdef BSLSTL_STRINGREFUTIL_X86_DISPATCH
+      case Util::e_AVX2: {
+        return avx2Mismatch(lhs, rhs, length, isCaseless);            // RETURN
+      } break;
+      case Util::e_SSE2: {
+        return sse2Mismatch(lhs, rhs, length, isCaseless);            // RETURN
+      } break;
+#endif
+      default: {
+        return isCaseless ? scalarMismatchCaseless(lhs, rhs, length)
+                          : scalarMismatch(lhs, rhs, length);         // RETURN
+      } break;
+    }
+}
+
+int compareLengths(native_std::size_t lhs, native_std::size_t rhs)
+    // Return a negative value, 0, or a positive value if the specified 'lhs'
+    // is less than, equal to, or greater than the specified 'rhs',
+    // respectively.
+{
+    return lhs < rhs ? -1 : rhs < lhs ? 1 : 0;
+}
+
+}  // close unnamed namespace
+
+namespace bslstl {
+
+                        // --------------------
+                        // struct StringRefUtil
+                        // --------------------
+
+// CLASS DATA
+bsls::AtomicOperations::AtomicTypes::Int StringRefUtil::s_kernel = {-1};
+
+// PRIVATE CLASS METHODS
+StringRefUtil::Kernel StringRefUtil::currentKernel()
+{
+    int kernel = bsls::AtomicOperations::getIntRelaxed(&s_kernel);
+    if (kernel < 0) {
+        // Concurrent first calls may each perform the selection; they store
+        // the same value.
+
+        kernel = isKernelSupported(e_AVX2) ? e_AVX2
+               : isKernelSupported(e_SSE2) ? e_SSE2
+               :                             e_SCALAR;
+        bsls::AtomicOperations::setIntRelaxed(&s_kernel, kernel);
+    }
+    return static_cast<Kernel>(kernel);
+}
+
+// CLASS METHODS
+bool StringRefUtil::areEqual(const StringRef& lhs, const StringRef& rhs)
+{
+    const native_std::size_t length = lhs.length();
+
+    if (length != rhs.length()) {
+        return false;                                                 // RETURN
+    }
+
+    const Kernel k = currentKernel();
+    if (e_SCALAR == k) {
+        return 0 == length
+            || 0 == native_std::memcmp(lhs.data(), rhs.data(), length);
+                                                                      // RETURN
+    }
+    return length == mismatch(lhs.data(), rhs.data(), length, false, k);
+}
+
+int StringRefUtil::compare(const StringRef& lhs, const StringRef& rhs)
+{
+    const native_std::size_t length = lhs.length() < rhs.length()
+                                    ? lhs.length()
+                                    : rhs.length();
+
+    const Kernel k = currentKernel();
+    if (e_SCALAR == k) {
+        const int result = length
+                         ? native_std::memcmp(lhs.data(), rhs.data(), length)
+                         : 0;
+        return result ? result : compareLengths(lhs.length(), rhs.length());
+                                                                      // RETURN
+    }
+
+    const native_std::size_t i = mismatch(lhs.data(),
+                                          rhs.data(),
+                                          length,
+                                          false,
+                                          k);
+    if (i < length) {
+        return static_cast<unsigned char>(lhs.data()[i])
+             - static_cast<unsigned char>(rhs.data()[i]);             // RETURN
+    }
+    return compareLengths(lhs.length(), rhs.length());
+}
+
+bool StringRefUtil::areEqualCaseless(const StringRef& lhs,
+                                     const StringRef& rhs)
+{
+    const native_std::size_t length = lhs.length();
+
+    return length == rhs.length()
+        && length == mismatch(lhs.data(),
+                              rhs.data(),
+                              length,
+                              true,
+                              currentKernel());
+}
+
+int StringRefUtil::compareCaseless(const StringRef& lhs, const StringRef& rhs)
+{
+    const native_std::size_t length = lhs.length() < rhs.length()
+                                    ? lhs.length()
+                                    : rhs.length();
+
+    const native_std::size_t i = mismatch(lhs.data(),
+                                          rhs.data(),
+                                          length,
+                                          true,
+                                          currentKernel());
+    if (i < length) {
+        return toLowerChar(lhs.data()[i]) - toLowerChar(rhs.data()[i]);
+                                                                      // RETURN
+    }
+    return compareLengths(lhs.length(), rhs.length());
+}
+
+void StringRefUtil::toLower(char               *result,
+                            const char         *string,
+                            native_std::size_t  length)
+{
+    BSLS_ASSERT_SAFE(result || 0 == length);
+    BSLS_ASSERT_SAFE(string || 0 == length);
+
+    switch (currentKernel()) {
+#ifdef BSLSTL_STRINGREFUTIL_X86_DISPATCH
+      case e_AVX2: {
+        avx2ToLowerString(result, string, length);
+      } break;
+      case e_SSE2: {
+        sse2ToLowerString(result, string, length);
+      } break;
+#endif
+      default: {
+        scalarToLower(result, string, length);
+      } break;
+    }
+}
+
+bool StringRefUtil::isKernelSupported(Kernel kernel)
+{
+    switch (kernel) {
+      case e_SCALAR: {
+        return true;                                                  // RETURN
+      } break;
+#ifdef BSLSTL_STRINGREFUTIL_X86_DISPATCH
+      case e_SSE2: {
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("sse2");                        // RETURN
+      } break;
+      case e_AVX2: {
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("avx2");                        // RETURN
+      } break;
+#endif
+      default: {
+        return false;                                                 // RETURN
+      } break;
+    }
+}
+
+StringRefUtil::Kernel StringRefUtil::kernel()
+{
+    return currentKernel();
+}
+
+void StringRefUtil::setKernel(Kernel kernel)
+{
+    BSLS_ASSERT(isKernelSupported(kernel));
+
+    bsls::AtomicOperations::setIntRelaxed(&s_kernel, kernel);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
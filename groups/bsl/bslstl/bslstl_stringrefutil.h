@@ -0,0 +1,403 @@
+// bslstl_stringrefutil.h                                             -*-C++-*-
+#ifndef INCLUDED_BSLSTL_STRINGREFUTIL
+#define INCLUDED_BSLSTL_STRINGREFUTIL
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide vectorized (and case-insensitive) string comparison.
+//
+//@CLASSES:
+//  bslstl::StringRefUtil: namespace for comparing and hashing 'char' strings
+//  bslstl::CaselessStringHash: transparent case-insensitive hash functor
+//  bslstl::CaselessStringEqualTo: transparent case-insensitive equality
+//  bslstl::CaselessStringLess: transparent case-insensitive ordering
+//
+//@SEE_ALSO: bslstl_stringref, bslstl_stringsearchutil, bslstl_unorderedmap
+//
+//@DESCRIPTION: This component provides a utility 'struct',
+// 'bslstl::StringRefUtil', supplying functions that compare strings of
+// 'char', both exactly ('areEqual' and 'compare') and ignoring the case of
+// ASCII letters ('areEqualCaseless' and 'compareCaseless'), that convert
+// ASCII letters to lower case ('toLower'), and that hash a string ignoring
+// case ('hashAppendCaseless' and 'hashCaseless') without first copying it
+// into a temporary string.
+//
+// This component also provides three functors, 'bslstl::CaselessStringHash',
+// 'bslstl::CaselessStringEqualTo', and 'bslstl::CaselessStringLess', that
+// apply these functions to anything convertible to 'bslstl::StringRef'
+// (e.g., 'bsl::string' and null-terminated 'const char *').  The functors
+// are transparent (i.e., they declare the nested type 'is_transparent'), so
+// that an unordered container using 'CaselessStringHash' and
+// 'CaselessStringEqualTo' can be searched for a 'const char *' or a
+// 'bslstl::StringRef' without creating a temporary key.
+//
+// Only the 26 ASCII letters are folded; all other values of 'char',
+// including those of non-ASCII encodings, must match exactly.  The case-less
+// hash of a string is the value 'bsl::hash<bsl::string>' (i.e.,
+// 'bslh::Hash<>') returns for the same string converted to lower case, so
+// that it is consistent with 'areEqualCaseless'.
+//
+///Kernels
+///-------
+// The functions of this component examine several characters at a time using
+// one of the following kernels, chosen at run time:
+//
+//: 'e_SCALAR': Portable C++.  Exact comparison uses 'memcmp'; case-less
+//:   operations fold one character at a time.
+//:
+//: 'e_SSE2': Examines 16 characters at a time using SSE2, folding the case of
+//:   each block of characters with a single range comparison, and locating
+//:   the first mismatch in a block from the mask of equal characters.
+//:
+//: 'e_AVX2': As 'e_SSE2', but examining 32 characters at a time.
+//
+// Each kernel reads only the characters of the supplied strings.  On first
+// use, the most capable kernel supported by both the compiler and the
+// processor is selected; the portable kernel is always used on platforms
+// other than x86 compiled by GCC or clang.  The selection may be inspected
+// with 'kernel' and overridden with 'setKernel', which is intended for
+// testing and benchmarking.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: A Case-Insensitive Dictionary
+/// - - - - - - - - - - - - - - - - - - - -
+// Suppose we map the names of HTTP header fields, which are case-insensitive,
+// to their values.
+//
+// First, we define a map using the case-less functors of this component:
+//..
+//  typedef bsl::unordered_map<bsl::string,
+//                             bsl::string,
+//                             bslstl::CaselessStringHash,
+//                             bslstl::CaselessStringEqualTo> HeaderMap;
+//
+//  bslma::TestAllocator ta;
+//  HeaderMap            headers(&ta);
+//
+//  headers["Content-Type"]   = "text/plain";
+//  headers["Content-Length"] = "42";
+//..
+// Then, we look up a field whose name is spelled using a different case.  As
+// the functors are transparent, the key is not converted to a 'bsl::string',
+// and no memory is allocated:
+//..
+//  const bsls::Types::Int64 numAllocations = ta.numAllocations();
+//
+//  HeaderMap::const_iterator it = headers.find("CONTENT-LENGTH");
+//
+//  assert(headers.end()  != it);
+//  assert("42"           == it->second);
+//  assert(numAllocations == ta.numAllocations());
+//..
+// Finally, we compare strings directly:
+//..
+//  assert( bslstl::StringRefUtil::areEqualCaseless("Accept", "ACCEPT"));
+//  assert(!bslstl::StringRefUtil::areEqual("Accept", "ACCEPT"));
+//  assert( bslstl::StringRefUtil::compareCaseless("accept", "Allow") < 0);
+//..
+
+// Prevent 'bslstl' headers from being included directly in 'BSL_OVERRIDES_STD'
+// mode.  Doing so is unsupported, and is likely to cause compilation errors.
+#if defined(BSL_OVERRIDES_STD) && !defined(BSL_STDHDRS_PROLOGUE_IN_EFFECT)
+#error "include <bsl_string.h> instead of <bslstl_stringrefutil.h> in \
+BSL_OVERRIDES_STD mode"
+#endif
+
+#ifndef INCLUDED_BSLSCM_VERSION
+#include <bslscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_STRINGREF
+#include <bslstl_stringref.h>
+#endif
+
+#ifndef INCLUDED_BSLH_DEFAULTHASHALGORITHM
+#include <bslh_defaulthashalgorithm.h>
+#endif
+
+#ifndef INCLUDED_BSLH_HASH
+#include <bslh_hash.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ATOMICOPERATIONS
+#include <bsls_atomicoperations.h>
+#endif
+
+#ifndef INCLUDED_BSLS_NATIVESTD
+#include <bsls_nativestd.h>
+#endif
+
+#ifndef INCLUDED_CSTDDEF
+#include <cstddef>
+#define INCLUDED_CSTDDEF
+#endif
+
+namespace BloombergLP {
+
+namespace bslstl {
+
+                        // ====================
+                        // struct StringRefUtil
+                        // ====================
+
+struct StringRefUtil {
+    // This 'struct' provides a namespace for functions that compare and hash
+    // strings of 'char', exactly or ignoring the case of ASCII letters, using
+    // the fastest implementation available on the executing processor.
+
+    // TYPES
+    enum Kernel {
+        // Enumerate the implementations of the functions of this 'struct'.
+
+        e_SCALAR = 0,  // portable implementation
+        e_SSE2   = 1,  // 16 characters at a time (SSE2)
+        e_AVX2   = 2   // 32 characters at a time (AVX2)
+    };
+
+    enum {
+        k_HASH_BUFFER_SIZE = 256  // number of characters converted to lower
+                                  // case at a time by 'hashAppendCaseless'
+    };
+
+  private:
+    // CLASS DATA
+    static bsls::AtomicOperations::AtomicTypes::Int s_kernel;
+                                    // selected 'Kernel', or -1 if no kernel
+                                    // has been selected yet
+
+    // PRIVATE CLASS METHODS
+    static Kernel currentKernel();
+        // Return the kernel to be used by the functions of this 'struct',
+        // selecting the most capable supported kernel if none has been
+        // selected yet.
+
+  public:
+    // CLASS METHODS
+    static bool areEqual(const StringRef& lhs, const StringRef& rhs);
+        // Return 'true' if the specified 'lhs' and 'rhs' strings have the
+        // same length and characters, and 'false' otherwise.
+
+    static int compare(const StringRef& lhs, const StringRef& rhs);
+        // Return a negative value if the specified 'lhs' string is
+        // lexicographically less than the specified 'rhs' string, 0 if they
+        // are equal, and a positive value otherwise.  Characters are compared
+        // as 'unsigned char' values, as by 'bslstl::StringRef::compare'.
+
+    static bool areEqualCaseless(const StringRef& lhs, const StringRef& rhs);
+        // Return 'true' if the specified 'lhs' and 'rhs' strings have the
+        // same length and the same characters after converting ASCII letters
+        // to lower case, and 'false' otherwise.
+
+    static int compareCaseless(const StringRef& lhs, const StringRef& rhs);
+        // Return a negative value if the specified 'lhs' string is
+        // lexicographically less than the specified 'rhs' string, 0 if they
+        // are equal, and a positive value otherwise, comparing, as 'unsigned
+        // char' values, the characters of each after converting ASCII letters
+        // to lower case.
+
+    template <class HASHALG>
+    static void hashAppendCaseless(HASHALG& hashAlg, const StringRef& string);
+        // Pass the specified 'string', with ASCII letters converted to lower
+        // case, to the specified 'hashAlg' hashing algorithm, exactly as
+        // 'hashAppend' passes a 'bslstl::StringRef' having the converted
+        // value.  Note that no memory is allocated.
+
+    static native_std::size_t hashCaseless(const StringRef& string);
+        // Return the hash value of the specified 'string' with ASCII letters
+        // converted to lower case, which is the value returned by
+        // 'bslh::Hash<>' (and by 'bsl::hash<bsl::string>') for the converted
+        // string.
+
+    static void toLower(char               *result,
+                        const char         *string,
+                        native_std::size_t  length);
+        // Load into the specified 'result' the specified 'length' characters
+        // at the specified 'string' address, with ASCII letters converted to
+        // lower case.  The behavior is undefined unless 'result' refers to at
+        // least 'length' characters, and 'result' is either equal to
+        // 'string' or does not overlap the characters it refers to.
+
+    static bool isKernelSupported(Kernel kernel);
+        // Return 'true' if the specified 'kernel' is supported by both the
+        // compiler used to build this component and the executing processor,
+        // and 'false' otherwise.  Note that 'e_SCALAR' is always supported.
+
+    static Kernel kernel();
+        // Return the kernel used by the functions of this component.
+
+    static void setKernel(Kernel kernel);
+        // Use the specified 'kernel' for all subsequent operations.  The
+        // behavior is undefined unless 'isKernelSupported(kernel)'.  Note that
+        // this function is intended for testing and benchmarking, and that
+        // the most capable supported kernel is used by default.
+};
+
+                        // =========================
+                        // struct CaselessStringHash
+                        // =========================
+
+struct CaselessStringHash {
+    // This transparent functor hashes a string ignoring the case of ASCII
+    // letters, consistently with 'CaselessStringEqualTo'.
+
+    // PUBLIC TYPES
+    typedef StringRef          argument_type;
+    typedef native_std::size_t result_type;
+    typedef void               is_transparent;
+
+    // ACCESSORS
+    native_std::size_t operator()(const StringRef& string) const;
+        // Return the hash value of the specified 'string' with ASCII letters
+        // converted to lower case.
+};
+
+                        // ============================
+                        // struct CaselessStringEqualTo
+                        // ============================
+
+struct CaselessStringEqualTo {
+    // This transparent functor compares strings for equality ignoring the
+    // case of ASCII letters.
+
+    // PUBLIC TYPES
+    typedef StringRef first_argument_type;
+    typedef StringRef second_argument_type;
+    typedef bool      result_type;
+    typedef void      is_transparent;
+
+    // ACCESSORS
+    bool operator()(const StringRef& lhs, const StringRef& rhs) const;
+        // Return 'true' if the specified 'lhs' and 'rhs' strings are equal
+        // ignoring the case of ASCII letters, and 'false' otherwise.
+};
+
+                        // =========================
+                        // struct CaselessStringLess
+                        // =========================
+
+struct CaselessStringLess {
+    // This transparent functor orders strings lexicographically ignoring the
+    // case of ASCII letters, consistently with 'CaselessStringEqualTo'.
+
+    // PUBLIC TYPES
+    typedef StringRef first_argument_type;
+    typedef StringRef second_argument_type;
+    typedef bool      result_type;
+    typedef void      is_transparent;
+
+    // ACCESSORS
+    bool operator()(const StringRef& lhs, const StringRef& rhs) const;
+        // Return 'true' if the specified 'lhs' string is less than the
+        // specified 'rhs' string ignoring the case of ASCII letters, and
+        // 'false' otherwise.
+};
+
+// ============================================================================
+//                      INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+                        // --------------------
+                        // struct StringRefUtil
+                        // --------------------
+
+// CLASS METHODS
+template <class HASHALG>
+void StringRefUtil::hashAppendCaseless(HASHALG&         hashAlg,
+                                       const StringRef& string)
+{
+    using ::BloombergLP::bslh::hashAppend;
+
+    char               buffer[k_HASH_BUFFER_SIZE];
+    const char        *characters = string.data();
+    native_std::size_t remaining  = string.length();
+
+    do {
+        const native_std::size_t numCharacters = remaining < sizeof buffer
+                                               ? remaining
+                                               : sizeof buffer;
+        toLower(buffer, characters, numCharacters);
+        hashAlg(buffer, numCharacters);
+
+        characters += numCharacters;
+        remaining  -= numCharacters;
+    } while (remaining);
+
+    hashAppend(hashAlg, string.length());
+}
+
+inline
+native_std::size_t StringRefUtil::hashCaseless(const StringRef& string)
+{
+    bslh::DefaultHashAlgorithm hashAlg;
+    hashAppendCaseless(hashAlg, string);
+    return static_cast<native_std::size_t>(hashAlg.computeHash());
+}
+
+                        // -------------------------
+                        // struct CaselessStringHash
+                        // -------------------------
+
+// ACCESSORS
+inline
+native_std::size_t
+CaselessStringHash::operator()(const StringRef& string) const
+{
+    return StringRefUtil::hashCaseless(string);
+}
+
+                        // ----------------------------
+                        // struct CaselessStringEqualTo
+                        // ----------------------------
+
+// ACCESSORS
+inline
+bool CaselessStringEqualTo::operator()(const StringRef& lhs,
+                                       const StringRef& rhs) const
+{
+    return StringRefUtil::areEqualCaseless(lhs, rhs);
+}
+
+                        // -------------------------
+                        // struct CaselessStringLess
+                        // -------------------------
+
+// ACCESSORS
+inline
+bool CaselessStringLess::operator()(const StringRef& lhs,
+                                    const StringRef& rhs) const
+{
+    return StringRefUtil::compareCaseless(lhs, rhs) < 0;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
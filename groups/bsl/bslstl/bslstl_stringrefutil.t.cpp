@@ -0,0 +1,942 @@
+// bslstl_stringrefutil.t.cpp                                         -*-C++-*-
+
+#include <bslstl_stringrefutil.h>
+
+#include <bslstl_map.h>
+#include <bslstl_string.h>
+#include <bslstl_stringref.h>
+#include <bslstl_unorderedmap.h>
+
+#include <bslh_hash.h>
+#include <bslma_default.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatormonitor.h>
+#include <bslmf_istransparentpredicate.h>
+#include <bsls_bsltestutil.h>
+#include <bsls_nativestd.h>
+#include <bsls_stopwatch.h>
+
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+using namespace BloombergLP;
+using namespace std;
+
+//=============================================================================
+//                             TEST PLAN
+//-----------------------------------------------------------------------------
+//                             Overview
+//                             --------
+// The component under test provides comparison, case-conversion, and hashing
+// functions having several implementations ("kernels"), one of which is
+// selected at run time, and functors built on those functions.  Every
+// function is verified, for every kernel supported on the executing
+// processor, against a simple oracle over all combinations of string length
+// and position of a difference within a range covering several vector
+// widths, and over every character value.  The strings are embedded in
+// buffers whose surrounding characters would change the result if they were
+// examined, so that a kernel reading outside of a string is detected.
+//-----------------------------------------------------------------------------
+// StringRefUtil
+// [ 3] bool areEqual(const StringRef& lhs, const StringRef& rhs);
+// [ 3] int compare(const StringRef& lhs, const StringRef& rhs);
+// [ 4] bool areEqualCaseless(const StringRef& lhs, const StringRef& rhs);
+// [ 4] int compareCaseless(const StringRef& lhs, const StringRef& rhs);
+// [ 5] void hashAppendCaseless(HASHALG& hashAlg, const StringRef& string);
+// [ 5] size_t hashCaseless(const StringRef& string);
+// [ 2] void toLower(char *result, const char *string, size_t length);
+// [ 6] bool isKernelSupported(Kernel kernel);
+// [ 6] Kernel kernel();
+// [ 6] void setKernel(Kernel kernel);
+//
+// CaselessStringHash
+// [ 5] size_t operator()(const StringRef& string) const;
+//
+// CaselessStringEqualTo
+// [ 5] bool operator()(const StringRef& lhs, const StringRef& rhs) const;
+//
+// CaselessStringLess
+// [ 5] bool operator()(const StringRef& lhs, const StringRef& rhs) const;
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 7] USAGE EXAMPLE
+// [-1] PERFORMANCE TEST
+
+//=============================================================================
+//                  STANDARD BDE ASSERT TEST MACRO
+//-----------------------------------------------------------------------------
+static int testStatus = 0;
+
+static void aSsErT(bool b, const char *s, int i) {
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+//=============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef bslstl::StringRefUtil Util;
+typedef bslstl::StringRef     Ref;
+
+static const Util::Kernel KERNELS[] = {
+    Util::e_SCALAR,
+    Util::e_SSE2,
+    Util::e_AVX2
+};
+static const int NUM_KERNELS = sizeof KERNELS / sizeof *KERNELS;
+
+static const int MAX_LENGTH = 100;  // longest string; spans several
+                                    // 32-character blocks
+
+static const int PADDING = 40;      // characters on either side of a string
+
+namespace {
+
+char oracleLower(char c)
+    // Return the specified 'c', converted to lower case if it is one of the
+    // 26 ASCII upper-case letters.
+{
+    return 'A' <= c && c <= 'Z' ? static_cast<char>(c - 'A' + 'a') : c;
+}
+
+int sign(int value)
+    // Return -1, 0, or 1 if the specified 'value' is negative, 0, or
+    // positive, respectively.
+{
+    return value < 0 ? -1 : value > 0 ? 1 : 0;
+}
+
+int oracleCompare(const char *lhs,
+                  size_t      lhsLength,
+                  const char *rhs,
+                  size_t      rhsLength,
+                  bool        isCaseless)
+    // Return -1, 0, or 1 if the specified 'lhs' string having the specified
+    // 'lhsLength' is lexicographically less than, equal to, or greater than
+    // the specified 'rhs' string having the specified 'rhsLength', comparing
+    // characters as 'unsigned char' values after converting ASCII letters to
+    // lower case if the specified 'isCaseless' is 'true'.
+{
+    for (size_t i = 0; i < lhsLength && i < rhsLength; ++i) {
+        const unsigned char l = static_cast<unsigned char>(
+                                   isCaseless ? oracleLower(lhs[i]) : lhs[i]);
+        const unsigned char r = static_cast<unsigned char>(
+                                   isCaseless ? oracleLower(rhs[i]) : rhs[i]);
+        if (l != r) {
+            return l < r ? -1 : 1;                                    // RETURN
+        }
+    }
+    return lhsLength < rhsLength ? -1 : rhsLength < lhsLength ? 1 : 0;
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+    bool     veryVeryVerbose = argc > 4;
+    bool veryVeryVeryVerbose = argc > 5;
+
+    (void) veryVeryVerbose;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    // CONCERN: No memory is obtained from the default allocator.
+
+    bslma::TestAllocator da("default", veryVeryVeryVerbose);
+    bslma::Default::setDefaultAllocatorRaw(&da);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 7: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: A Case-Insensitive Dictionary
+/// - - - - - - - - - - - - - - - - - - - -
+// Suppose we map the names of HTTP header fields, which are case-insensitive,
+// to their values.
+//
+// First, we define a map using the case-less functors of this component:
+//..
+    typedef bsl::unordered_map<bsl::string,
+                               bsl::string,
+                               bslstl::CaselessStringHash,
+                               bslstl::CaselessStringEqualTo> HeaderMap;
+
+    bslma::TestAllocator ta;
+    HeaderMap            headers(&ta);
+
+    headers["Content-Type"]   = "text/plain";
+    headers["Content-Length"] = "42";
+//..
+// Then, we look up a field whose name is spelled using a different case.  As
+// the functors are transparent, the key is not converted to a 'bsl::string',
+// and no memory is allocated:
+//..
+    const bsls::Types::Int64 numAllocations = ta.numAllocations();
+
+    HeaderMap::const_iterator it = headers.find("CONTENT-LENGTH");
+
+    ASSERT(headers.end()  != it);
+    ASSERT("42"           == it->second);
+    ASSERT(numAllocations == ta.numAllocations());
+//..
+// Finally, we compare strings directly:
+//..
+    ASSERT( bslstl::StringRefUtil::areEqualCaseless("Accept", "ACCEPT"));
+    ASSERT(!bslstl::StringRefUtil::areEqual("Accept", "ACCEPT"));
+    ASSERT( bslstl::StringRefUtil::compareCaseless("accept", "Allow") < 0);
+//..
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // KERNEL SELECTION
+        //
+        // Concerns:
+        //: 1 The portable kernel is always supported.
+        //:
+        //: 2 By default, the most capable supported kernel is selected.
+        //:
+        //: 3 'setKernel' selects the specified kernel, which is then reported
+        //:   by 'kernel'.
+        //
+        // Plan:
+        //: 1 Verify that 'e_SCALAR' is supported.  (C-1)
+        //:
+        //: 2 Verify that the kernel reported before any other call is the
+        //:   last supported kernel in the order of the enumeration.  (C-2)
+        //:
+        //: 3 Select each supported kernel in turn and verify the value of
+        //:   'kernel'.  (C-3)
+        //
+        // Testing:
+        //   bool isKernelSupported(Kernel kernel);
+        //   Kernel kernel();
+        //   void setKernel(Kernel kernel);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nKERNEL SELECTION"
+                            "\n================\n");
+
+        ASSERT(Util::isKernelSupported(Util::e_SCALAR));
+
+        Util::Kernel expected = Util::e_SCALAR;
+        for (int ti = 0; ti < NUM_KERNELS; ++ti) {
+            if (veryVerbose) {
+                T_ P_(KERNELS[ti]) P(Util::isKernelSupported(KERNELS[ti]));
+            }
+            if (Util::isKernelSupported(KERNELS[ti])) {
+                expected = KERNELS[ti];
+            }
+        }
+        ASSERTV(expected, Util::kernel(), expected == Util::kernel());
+
+        for (int ti = 0; ti < NUM_KERNELS; ++ti) {
+            if (!Util::isKernelSupported(KERNELS[ti])) {
+                continue;
+            }
+            Util::setKernel(KERNELS[ti]);
+            ASSERTV(ti, KERNELS[ti] == Util::kernel());
+        }
+        Util::setKernel(expected);
+        ASSERT(expected == Util::kernel());
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // CASE-LESS HASHING AND FUNCTORS
+        //
+        // Concerns:
+        //: 1 'hashCaseless' returns the value 'bsl::hash<bsl::string>' returns
+        //:   for the string converted to lower case, including for the empty
+        //:   string and for strings longer than the internal buffer.
+        //:
+        //: 2 'hashAppendCaseless' passes the same data to the hashing
+        //:   algorithm as 'hashAppend' of the converted string.
+        //:
+        //: 3 The functors apply the corresponding functions, are
+        //:   transparent, and accept 'bsl::string', 'const char *', and
+        //:   'StringRef' arguments.
+        //:
+        //: 4 An 'unordered_map' using the functors finds a key spelled with
+        //:   different case, without allocating memory.
+        //:
+        //: 5 Every supported kernel produces the same results.
+        //
+        // Plan:
+        //: 1 For each supported kernel, and for strings of mixed case of
+        //:   various lengths, compare 'hashCaseless', 'hashAppendCaseless'
+        //:   (with 'bslh::Hash<>'s algorithm), and 'CaselessStringHash' with
+        //:   the hash of the lowered string.  (C-1..2, 5)
+        //:
+        //: 2 Use the functors directly and as the policies of 'unordered_map'
+        //:   and 'map'.  (C-3..4)
+        //
+        // Testing:
+        //   void hashAppendCaseless(HASHALG& hashAlg, const StringRef& str);
+        //   size_t hashCaseless(const StringRef& string);
+        //   size_t CaselessStringHash::operator()(const StringRef&) const;
+        //   bool CaselessStringEqualTo::operator()(lhs, rhs) const;
+        //   bool CaselessStringLess::operator()(lhs, rhs) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCASE-LESS HASHING AND FUNCTORS"
+                            "\n==============================\n");
+
+        ASSERT((bslmf::IsTransparentPredicate<bslstl::CaselessStringHash,
+                                              int>::value));
+        ASSERT((bslmf::IsTransparentPredicate<bslstl::CaselessStringEqualTo,
+                                              int>::value));
+        ASSERT((bslmf::IsTransparentPredicate<bslstl::CaselessStringLess,
+                                              int>::value));
+
+        bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+
+        static const size_t LENGTHS[] = { 0, 1, 15, 16, 17, 31, 32, 33, 255,
+                                          256, 257, 600 };
+        const int NUM_LENGTHS = sizeof LENGTHS / sizeof *LENGTHS;
+
+        const Util::Kernel DEFAULT_KERNEL = Util::kernel();
+
+        for (int ti = 0; ti < NUM_KERNELS; ++ti) {
+            const Util::Kernel KERNEL = KERNELS[ti];
+            if (!Util::isKernelSupported(KERNEL)) {
+                continue;
+            }
+            Util::setKernel(KERNEL);
+
+            for (int tj = 0; tj < NUM_LENGTHS; ++tj) {
+                const size_t LENGTH = LENGTHS[tj];
+
+                bsl::string mixed(&sa);
+                bsl::string lower(&sa);
+                for (size_t i = 0; i < LENGTH; ++i) {
+                    const char c = static_cast<char>(
+                                            (i % 3 ? 'a' : 'A') + i * 7 % 26);
+                    mixed.push_back(c);
+                    lower.push_back(oracleLower(c));
+                }
+
+                const size_t EXP = bsl::hash<bsl::string>()(lower);
+
+                const Ref MIXED(mixed.data(), static_cast<int>(LENGTH));
+
+                ASSERTV(ti, tj, EXP == Util::hashCaseless(MIXED));
+                ASSERTV(ti, tj, EXP == bslstl::CaselessStringHash()(mixed));
+
+                bslh::Hash<>::result_type result;
+                {
+                    bslh::DefaultHashAlgorithm hashAlg;
+                    Util::hashAppendCaseless(hashAlg, MIXED);
+                    result = static_cast<size_t>(hashAlg.computeHash());
+                }
+                ASSERTV(ti, tj, EXP == result);
+
+                ASSERTV(ti, tj, bslstl::CaselessStringEqualTo()(mixed, lower));
+                ASSERTV(ti, tj, !bslstl::CaselessStringLess()(mixed, lower));
+                ASSERTV(ti, tj, !bslstl::CaselessStringLess()(lower, mixed));
+            }
+        }
+        Util::setKernel(DEFAULT_KERNEL);
+
+        ASSERT( bslstl::CaselessStringEqualTo()("IBM", Ref("ibm")));
+        ASSERT(!bslstl::CaselessStringEqualTo()("IBM", "IBMX"));
+        ASSERT( bslstl::CaselessStringLess()("ibm", "IBMX"));
+        ASSERT( bslstl::CaselessStringLess()("A", "b"));
+        ASSERT( bslstl::CaselessStringLess()("a", "B"));
+        ASSERT(!bslstl::CaselessStringLess()("b", "A"));
+
+        if (verbose) printf("\nUsing the functors as container policies.\n");
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        {
+            typedef bsl::unordered_map<bsl::string,
+                                       int,
+                                       bslstl::CaselessStringHash,
+                                       bslstl::CaselessStringEqualTo> Map;
+
+            Map mX(&oa);  const Map& X = mX;
+            mX["Content-Type"]   = 1;
+            mX["content-length"] = 2;
+            mX["CONTENT-TYPE"]   = 3;
+            ASSERT(2 == X.size());
+
+            bslma::TestAllocatorMonitor oam(&oa);
+
+            ASSERT(3     == X.find("content-type")->second);
+            ASSERT(2     == X.find(Ref("Content-Length"))->second);
+            ASSERT(X.end() == X.find("Content-Encoding"));
+            ASSERT(1     == X.count("CoNtEnT-tYpE"));
+            ASSERT(oam.isTotalSame());
+
+            typedef bsl::map<bsl::string,
+                             int,
+                             bslstl::CaselessStringLess> OrderedMap;
+
+            OrderedMap mY(&oa);  const OrderedMap& Y = mY;
+            mY["beta"]  = 2;
+            mY["ALPHA"] = 1;
+            mY["Gamma"] = 3;
+            mY["alpha"] = 4;
+            ASSERT(3 == Y.size());
+
+            OrderedMap::const_iterator it = Y.begin();
+            ASSERT("ALPHA" == it->first);  ASSERT(4 == it->second);  ++it;
+            ASSERT("beta"  == it->first);  ++it;
+            ASSERT("Gamma" == it->first);
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+        ASSERT(0 == da.numBlocksTotal());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // CASE-LESS COMPARISON
+        //
+        // Concerns:
+        //: 1 'areEqualCaseless' returns 'true' if and only if the strings have
+        //:   the same length and are equal after converting ASCII letters to
+        //:   lower case.
+        //:
+        //: 2 'compareCaseless' orders the converted strings lexicographically,
+        //:   comparing characters as 'unsigned char' values.
+        //:
+        //: 3 Only the 26 ASCII letters are folded: in particular, the
+        //:   characters adjacent to the ranges of letters ('@', '[', '`', and
+        //:   '{'), and characters having the high bit set, are compared
+        //:   exactly.
+        //:
+        //: 4 The results are correct for every length and every position of a
+        //:   difference, in particular across block boundaries, and no
+        //:   character outside of the strings is examined.
+        //:
+        //: 5 Every supported kernel produces the same results.
+        //
+        // Plan:
+        //: 1 For each supported kernel, for each length in
+        //:   '[0 .. MAX_LENGTH]', fill two buffers with the same letters in
+        //:   different case, surrounded by different characters, and verify
+        //:   the results against an oracle.  Then, for each position, place
+        //:   each of a set of pairs of characters at that position and verify
+        //:   again.  (C-1..2, 4..5)
+        //:
+        //: 2 For each supported kernel, compare every pair of character
+        //:   values, embedded at the end of strings of several lengths.
+        //:   (C-3, 5)
+        //
+        // Testing:
+        //   bool areEqualCaseless(const StringRef& lhs, const StringRef& rhs);
+        //   int compareCaseless(const StringRef& lhs, const StringRef& rhs);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCASE-LESS COMPARISON"
+                            "\n====================\n");
+
+        static const struct {
+            int  d_line;  // source line number
+            char d_lhs;   // character placed in the left-hand string
+            char d_rhs;   // character placed in the right-hand string
+        } DATA[] = {
+            //LINE  LHS     RHS
+            //----  ------  ------
+            { L_,    'a',    'A'   },
+            { L_,    'z',    'Z'   },
+            { L_,    'a',    'b'   },
+            { L_,    'B',    'a'   },
+            { L_,    '@',    '`'   },
+            { L_,    '[',    '{'   },
+            { L_,    '\0',   ' '   },
+            { L_,    '\xe1', '\xc1'},
+            { L_,    '\x7f', '\x80'},
+            { L_,    'Z',    '['   },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        char lhsBuffer[MAX_LENGTH + 2 * PADDING];
+        char rhsBuffer[MAX_LENGTH + 2 * PADDING];
+
+        for (int ti = 0; ti < NUM_KERNELS; ++ti) {
+            const Util::Kernel KERNEL = KERNELS[ti];
+            if (!Util::isKernelSupported(KERNEL)) {
+                continue;
+            }
+            Util::setKernel(KERNEL);
+
+            if (veryVerbose) { T_ P(KERNEL) }
+
+            for (int len = 0; len <= MAX_LENGTH; ++len) {
+                for (int tj = -1; tj < NUM_DATA; ++tj) {
+                    for (int pos = 0; pos < (tj < 0 ? 1 : len); ++pos) {
+                        // The characters surrounding the strings differ, so
+                        // that examining them would produce a mismatch.
+
+                        native_std::memset(lhsBuffer, 'x', sizeof lhsBuffer);
+                        native_std::memset(rhsBuffer, 'y', sizeof rhsBuffer);
+                        char *lhs = lhsBuffer + PADDING;
+                        char *rhs = rhsBuffer + PADDING;
+                        for (int i = 0; i < len; ++i) {
+                            lhs[i] = static_cast<char>('a' + i % 26);
+                            rhs[i] = static_cast<char>('A' + i % 26);
+                        }
+                        if (0 <= tj) {
+                            lhs[pos] = DATA[tj].d_lhs;
+                            rhs[pos] = DATA[tj].d_rhs;
+                        }
+
+                        const int LINE = 0 <= tj ? DATA[tj].d_line : L_;
+
+                        for (int dl = 0; dl <= 1; ++dl) {
+                            // Also compare with a one-longer left string.
+
+                            const int LLEN = len + (dl && 0 <= tj ? 1 : 0);
+                            if (dl && 0 > tj) {
+                                continue;
+                            }
+                            const Ref L(lhs, LLEN);
+                            const Ref R(rhs, len);
+
+                            const int EXP = oracleCompare(lhs, LLEN,
+                                                          rhs, len, true);
+
+                            ASSERTV(KERNEL, LINE, len, pos,
+                                    EXP == sign(Util::compareCaseless(L, R)));
+                            ASSERTV(KERNEL, LINE, len, pos,
+                                    -EXP == sign(Util::compareCaseless(R, L)));
+                            ASSERTV(KERNEL, LINE, len, pos,
+                                    (0 == EXP) ==
+                                                Util::areEqualCaseless(L, R));
+                        }
+                    }
+                }
+            }
+
+            if (verbose) printf("\tComparing every pair of characters.\n");
+
+            static const int TAIL_LENGTHS[] = { 1, 16, 33 };
+            for (int tl = 0; tl < 3; ++tl) {
+                const int LEN = TAIL_LENGTHS[tl];
+
+                char lhs[64];
+                char rhs[64];
+                native_std::memset(lhs, 'q', sizeof lhs);
+                native_std::memset(rhs, 'Q', sizeof rhs);
+
+                for (int c = 0; c < 256; ++c) {
+                    for (int d = 0; d < 256; ++d) {
+                        lhs[LEN - 1] = static_cast<char>(c);
+                        rhs[LEN - 1] = static_cast<char>(d);
+
+                        const Ref L(lhs, LEN);
+                        const Ref R(rhs, LEN);
+
+                        const int EXP = oracleCompare(lhs, LEN,
+                                                      rhs, LEN, true);
+                        if (EXP != sign(Util::compareCaseless(L, R))
+                         || (0 == EXP) != Util::areEqualCaseless(L, R)) {
+                            ASSERTV(KERNEL, LEN, c, d, false);
+                        }
+                    }
+                }
+            }
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // EXACT COMPARISON
+        //
+        // Concerns:
+        //: 1 'areEqual' returns 'true' if and only if the strings have the
+        //:   same length and characters.
+        //:
+        //: 2 'compare' orders strings lexicographically, comparing characters
+        //:   as 'unsigned char' values, consistently with
+        //:   'StringRef::compare'.
+        //:
+        //: 3 The results are correct for every length and every position of a
+        //:   difference, in particular across block boundaries, and no
+        //:   character outside of the strings is examined.
+        //:
+        //: 4 Every supported kernel produces the same results.
+        //:
+        //: 5 The equality operators of 'StringRef' are unaffected by
+        //:   comparing lengths first.
+        //
+        // Plan:
+        //: 1 For each supported kernel, for each length in
+        //:   '[0 .. MAX_LENGTH]', fill two buffers with the same characters,
+        //:   surrounded by different characters, and verify the results
+        //:   against an oracle and against 'StringRef'.  Then, for each
+        //:   position, place each of a set of pairs of characters at that
+        //:   position and verify again, also comparing strings of different
+        //:   lengths.  (C-1..5)
+        //
+        // Testing:
+        //   bool areEqual(const StringRef& lhs, const StringRef& rhs);
+        //   int compare(const StringRef& lhs, const StringRef& rhs);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nEXACT COMPARISON"
+                            "\n================\n");
+
+        static const struct {
+            int  d_line;  // source line number
+            char d_lhs;   // character placed in the left-hand string
+            char d_rhs;   // character placed in the right-hand string
+        } DATA[] = {
+            //LINE  LHS     RHS
+            //----  ------  ------
+            { L_,    'a',    'A'   },
+            { L_,    'a',    'b'   },
+            { L_,    '\0',   '\x01'},
+            { L_,    '\x7f', '\x80'},
+            { L_,    '\xff', '\0'  },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        char lhsBuffer[MAX_LENGTH + 2 * PADDING];
+        char rhsBuffer[MAX_LENGTH + 2 * PADDING];
+
+        for (int ti = 0; ti < NUM_KERNELS; ++ti) {
+            const Util::Kernel KERNEL = KERNELS[ti];
+            if (!Util::isKernelSupported(KERNEL)) {
+                continue;
+            }
+            Util::setKernel(KERNEL);
+
+            if (veryVerbose) { T_ P(KERNEL) }
+
+            for (int len = 0; len <= MAX_LENGTH; ++len) {
+                for (int tj = -1; tj < NUM_DATA; ++tj) {
+                    for (int pos = 0; pos < (tj < 0 ? 1 : len); ++pos) {
+                        native_std::memset(lhsBuffer, 'x', sizeof lhsBuffer);
+                        native_std::memset(rhsBuffer, 'y', sizeof rhsBuffer);
+                        char *lhs = lhsBuffer + PADDING;
+                        char *rhs = rhsBuffer + PADDING;
+                        for (int i = 0; i < len; ++i) {
+                            lhs[i] = rhs[i] = static_cast<char>(' ' + i % 90);
+                        }
+                        if (0 <= tj) {
+                            lhs[pos] = DATA[tj].d_lhs;
+                            rhs[pos] = DATA[tj].d_rhs;
+                        }
+
+                        const int LINE = 0 <= tj ? DATA[tj].d_line : L_;
+
+                        for (int llen = len - 1; llen <= len + 1; ++llen) {
+                            if (llen < 0) {
+                                continue;
+                            }
+                            const Ref L(lhs, llen);
+                            const Ref R(rhs, len);
+
+                            const int EXP = oracleCompare(lhs, llen,
+                                                          rhs, len, false);
+
+                            ASSERTV(KERNEL, LINE, len, pos,
+                                    EXP == sign(Util::compare(L, R)));
+                            ASSERTV(KERNEL, LINE, len, pos,
+                                    -EXP == sign(Util::compare(R, L)));
+                            ASSERTV(KERNEL, LINE, len, pos,
+                                    (0 == EXP) == Util::areEqual(L, R));
+                            ASSERTV(KERNEL, LINE, len, pos,
+                                    EXP == sign(L.compare(R)));
+                            ASSERTV(KERNEL, LINE, len, pos,
+                                    (0 == EXP) == (L == R));
+                            ASSERTV(KERNEL, LINE, len, pos,
+                                    (0 != EXP) == (L != R));
+                        }
+                    }
+                }
+            }
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // 'toLower'
+        //
+        // Concerns:
+        //: 1 Exactly the 26 ASCII upper-case letters are converted, to the
+        //:   corresponding lower-case letters.
+        //:
+        //: 2 Every length is supported, and no character outside of the
+        //:   result is written.
+        //:
+        //: 3 The conversion may be performed in place.
+        //:
+        //: 4 Every supported kernel produces the same results.
+        //
+        // Plan:
+        //: 1 For each supported kernel and each length in
+        //:   '[0 .. MAX_LENGTH]', convert a string holding a rotation of all
+        //:   256 character values into a buffer whose surrounding characters
+        //:   are verified to be unchanged, and in place, and compare with an
+        //:   oracle.  (C-1..4)
+        //
+        // Testing:
+        //   void toLower(char *result, const char *string, size_t length);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\n'toLower'"
+                            "\n=========\n");
+
+        char source[MAX_LENGTH];
+        char buffer[MAX_LENGTH + 2 * PADDING];
+
+        for (int ti = 0; ti < NUM_KERNELS; ++ti) {
+            const Util::Kernel KERNEL = KERNELS[ti];
+            if (!Util::isKernelSupported(KERNEL)) {
+                continue;
+            }
+            Util::setKernel(KERNEL);
+
+            if (veryVerbose) { T_ P(KERNEL) }
+
+            for (int start = 0; start < 256; start += 7) {
+                for (int len = 0; len <= MAX_LENGTH; ++len) {
+                    for (int i = 0; i < len; ++i) {
+                        source[i] = static_cast<char>(start + i * 3);
+                    }
+
+                    native_std::memset(buffer, 'Q', sizeof buffer);
+                    char *result = buffer + PADDING;
+
+                    Util::toLower(result, source, len);
+
+                    for (int i = 0; i < PADDING; ++i) {
+                        ASSERTV(KERNEL, len, i, 'Q' == buffer[i]);
+                        ASSERTV(KERNEL, len, i,
+                                'Q' == result[len + i]);
+                    }
+                    for (int i = 0; i < len; ++i) {
+                        ASSERTV(KERNEL, start, len, i,
+                                oracleLower(source[i]) == result[i]);
+                    }
+
+                    // In place.
+
+                    native_std::memcpy(result, source, len);
+                    Util::toLower(result, result, len);
+                    for (int i = 0; i < len; ++i) {
+                        ASSERTV(KERNEL, start, len, i,
+                                oracleLower(source[i]) == result[i]);
+                    }
+                }
+            }
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The functions are sufficiently functional to enable
+        //:   comprehensive testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Compare, convert, and hash a few strings.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        ASSERT( Util::areEqual("IBM", "IBM"));
+        ASSERT(!Util::areEqual("IBM", "ibm"));
+        ASSERT( Util::areEqualCaseless("IBM", "ibm"));
+        ASSERT(!Util::areEqualCaseless("IBM", "ibmx"));
+
+        ASSERT(0 >  Util::compare("IBM", "ibm"));
+        ASSERT(0 == Util::compareCaseless("IBM", "ibm"));
+        ASSERT(0 <  Util::compareCaseless("IBM", "IB"));
+
+        char buffer[] = "Hello, World!";
+        Util::toLower(buffer, buffer, sizeof buffer - 1);
+        ASSERT(0 == strcmp("hello, world!", buffer));
+
+        ASSERT(Util::hashCaseless("Hello, World!") ==
+                                              Util::hashCaseless(buffer));
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST
+        //
+        // Concerns:
+        //: 1 The vectorized kernels are faster than the portable kernel, and
+        //:   case-less lookup is faster than converting keys to lower case in
+        //:   a temporary string.
+        //
+        // Plan:
+        //: 1 For each supported kernel, time case-less equality comparison and
+        //:   hashing of keys of several lengths, and report the time taken
+        //:   by converting each key to a lower-case 'bsl::string' and hashing
+        //:   that instead.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nPERFORMANCE TEST"
+                            "\n================\n");
+
+        const int NUM_ITERATIONS = 2000000;
+
+        static const int LENGTHS[] = { 8, 24, 64, 256 };
+
+        char lhs[256];
+        char rhs[256];
+        for (int i = 0; i < 256; ++i) {
+            lhs[i] = static_cast<char>('a' + i % 26);
+            rhs[i] = static_cast<char>('A' + i % 26);
+        }
+
+        printf("%-8s %6s %12s %12s %12s %12s\n",
+               "kernel", "length", "equal(s)", "compare(s)", "hash(s)",
+               "lowered(s)");
+
+        bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+
+        for (int ti = 0; ti < NUM_KERNELS; ++ti) {
+            const Util::Kernel KERNEL = KERNELS[ti];
+            if (!Util::isKernelSupported(KERNEL)) {
+                continue;
+            }
+            Util::setKernel(KERNEL);
+
+            for (int tj = 0; tj < 4; ++tj) {
+                const int LEN = LENGTHS[tj];
+                const Ref L(lhs, LEN);
+                const Ref R(rhs, LEN);
+
+                bsls::Stopwatch timer;
+                size_t          sum = 0;
+
+                timer.start();
+                for (int i = 0; i < NUM_ITERATIONS; ++i) {
+                    sum += Util::areEqualCaseless(L, R);
+                }
+                timer.stop();
+                const double equalTime = timer.accumulatedWallTime();
+
+                timer.reset();
+                timer.start();
+                for (int i = 0; i < NUM_ITERATIONS; ++i) {
+                    sum += Util::compareCaseless(L, R);
+                }
+                timer.stop();
+                const double compareTime = timer.accumulatedWallTime();
+
+                timer.reset();
+                timer.start();
+                for (int i = 0; i < NUM_ITERATIONS; ++i) {
+                    sum += Util::hashCaseless(R);
+                }
+                timer.stop();
+                const double hashTime = timer.accumulatedWallTime();
+
+                timer.reset();
+                timer.start();
+                for (int i = 0; i < NUM_ITERATIONS; ++i) {
+                    bsl::string lowered(rhs, LEN, &sa);
+                    for (size_t j = 0; j < lowered.length(); ++j) {
+                        lowered[j] = oracleLower(lowered[j]);
+                    }
+                    sum += bsl::hash<bsl::string>()(lowered);
+                }
+                timer.stop();
+                const double loweredTime = timer.accumulatedWallTime();
+
+                printf("%-8d %6d %12.4f %12.4f %12.4f %12.4f\n",
+                       KERNEL, LEN, equalTime, compareTime, hashTime,
+                       loweredTime);
+                ASSERT(0 != sum);
+            }
+        }
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
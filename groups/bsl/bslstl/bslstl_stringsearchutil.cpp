@@ -0,0 +1,721 @@
+// bslstl_stringsearchutil.cpp                                        -*-C++-*-
+#include <bslstl_stringsearchutil.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id$ $CSID$")
+
+#include <bsls_assert.h>
+#include <bsls_platform.h>
+
+#include <cstring>
+
+#if (defined(BSLS_PLATFORM_CPU_X86_64) || defined(BSLS_PLATFORM_CPU_X86))     \
+ && (defined(BSLS_PLATFORM_CMP_CLANG)                                         \
+  || (defined(BSLS_PLATFORM_CMP_GNU) && BSLS_PLATFORM_CMP_VERSION >= 40900))
+// These compilers accept the 'target' attribute, allowing functions using
+// instructions beyond the baseline of the build to be compiled, and provide
+// '__builtin_cpu_supports' to decide at run time whether they may be called.
+
+#define BSLSTL_STRINGSEARCHUTIL_X86_DISPATCH 1
+#include <immintrin.h>
+#endif
+
+namespace BloombergLP {
+
+namespace {
+
+                        // ==================
+                        // class CharacterSet
+                        // ==================
+
+class CharacterSet {
+    // This class represents a set of 'char' values as a 256-bit bitmap.  The
+    // bitmap is laid out as two tables of 16 bytes, indexed by the low nibble
+    // of a character, whose bits are indexed by the high nibble, so that it
+    // also serves as the lookup tables of the 'pshufb'-based kernels: the
+    // membership of 'c' is bit '(c >> 4) & 7' of byte
+    // '(c & 0x80 ? 16 : 0) + (c & 0xF)'.
+
+    // DATA
+    unsigned char d_table[32];  // bitmap of the set
+
+  public:
+    // CREATORS
+    CharacterSet(const char *characterSet, native_std::size_t setLength);
+        // Create a set holding the specified 'setLength' characters at the
+        // specified 'characterSet'.
+
+    // ACCESSORS
+    bool contains(char character) const;
+        // Return 'true' if the specified 'character' is a member of this set,
+        // and 'false' otherwise.
+
+    const unsigned char *table() const;
+        // Return the address of the 32 bytes of the bitmap of this set.
+};
+
+                        // ------------------
+                        // class CharacterSet
+                        // ------------------
+
+// CREATORS
+CharacterSet::CharacterSet(const char         *characterSet,
+                           native_std::size_t  setLength)
+{
+    native_std::memset(d_table, 0, sizeof d_table);
+    for (native_std::size_t i = 0; i < setLength; ++i) {
+        const unsigned char c = static_cast<unsigned char>(characterSet[i]);
+        d_table[((c >> 3) & 0x10) | (c & 0xF)] |=
+                             static_cast<unsigned char>(1 << ((c >> 4) & 7));
+    }
+}
+
+// ACCESSORS
+inline
+bool CharacterSet::contains(char character) const
+{
+    const unsigned char c = static_cast<unsigned char>(character);
+    return (d_table[((c >> 3) & 0x10) | (c & 0xF)] >> ((c >> 4) & 7)) & 1;
+}
+
+inline
+const unsigned char *CharacterSet::table() const
+{
+    return d_table;
+}
+
+                        // --------------
+                        // scalar kernels
+                        // --------------
+
+const char *scalarFindSubstring(const char         *string,
+                                native_std::size_t  length,
+                                const char         *substring,
+                                native_std::size_t  substringLength)
+    // Return the address of the first occurrence of the specified 'substring'
+    // having the specified 'substringLength' in the specified 'string' having
+    // the specified 'length', or 0 if there is no such occurrence.  The
+    // behavior is undefined unless '2 <= substringLength <= length'.
+{
+    const native_std::size_t  lastOffset = substringLength - 1;
+    const char                first      = substring[0];
+    const char                last       = substring[lastOffset];
+    const char               *end        = string + (length - lastOffset);
+
+    for (const char *candidate = string;
+         0 != (candidate = static_cast<const char *>(
+                       native_std::memchr(candidate, first, end - candidate)));
+         ++candidate) {
+        if (candidate[lastOffset] == last
+         && 0 == native_std::memcmp(candidate + 1,
+                                    substring + 1,
+                                    substringLength - 2)) {
+            return candidate;                                         // RETURN
+        }
+    }
+    return 0;
+}
+
+const char *scalarFindFirst(const char          *string,
+                            native_std::size_t   length,
+                            const CharacterSet&  set,
+                            bool                 isMember)
+    // Return the address of the first character in the specified 'string'
+    // having the specified 'length' whose membership in the specified 'set'
+    // is the specified 'isMember', or 0 if there is no such character.
+{
+    for (const char *end = string + length; string != end; ++string) {
+        if (set.contains(*string) == isMember) {
+            return string;                                            // RETURN
+        }
+    }
+    return 0;
+}
+
+const char *scalarFindLast(const char          *string,
+                           native_std::size_t   length,
+                           const CharacterSet&  set,
+                           bool                 isMember)
+    // Return the address of the last character in the specified 'string'
+    // having the specified 'length' whose membership in the specified 'set'
+    // is the specified 'isMember', or 0 if there is no such character.
+{
+    for (const char *current = string + length; current != string; ) {
+        --current;
+        if (set.contains(*current) == isMember) {
+            return current;                                           // RETURN
+        }
+    }
+    return 0;
+}
+
+#ifdef BSLSTL_STRINGSEARCHUTIL_X86_DISPATCH
+
+                        // --------------
+                        // SSE4.2 kernels
+                        // --------------
+
+__attribute__((target("sse4.2")))
+inline
+unsigned int sse42Classify(const char *block, const CharacterSet& set)
+    // Return a mask having bit 'i' set if the character at the specified
+    // 'block[i]' is a member of the specified 'set', for 'i' in '[0 .. 16)'.
+{
+    const __m128i lowTable  = _mm_loadu_si128(
+                             reinterpret_cast<const __m128i *>(set.table()));
+    const __m128i highTable = _mm_loadu_si128(
+                        reinterpret_cast<const __m128i *>(set.table() + 16));
+    const __m128i bitTable  = _mm_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128,
+                                            1, 2, 4, 8, 16, 32, 64, -128);
+
+    const __m128i chars = _mm_loadu_si128(
+                                   reinterpret_cast<const __m128i *>(block));
+
+    // 'pshufb' yields 0 for an index having its high bit set, so each table
+    // answers only for the characters in its half of the range.
+
+    const __m128i index = _mm_and_si128(chars, _mm_set1_epi8(-0x71));
+    const __m128i row   = _mm_or_si128(
+           _mm_shuffle_epi8(lowTable, index),
+           _mm_shuffle_epi8(highTable,
+                            _mm_xor_si128(index, _mm_set1_epi8(-0x80))));
+    const __m128i bit   = _mm_shuffle_epi8(
+                            bitTable,
+                            _mm_and_si128(_mm_srli_epi16(chars, 4),
+                                          _mm_set1_epi8(0xF)));
+
+    return _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_and_si128(row, bit), bit));
+}
+
+__attribute__((target("sse4.2")))
+const char *sse42FindSubstring(const char         *string,
+                               native_std::size_t  length,
+                               const char         *substring,
+                               native_std::size_t  substringLength)
+    // Return the address of the first occurrence of the specified 'substring'
+    // having the specified 'substringLength' in the specified 'string' having
+    // the specified 'length', or 0 if there is no such occurrence.  The
+    // behavior is undefined unless '2 <= substringLength <= length'.
+{
+    const native_std::size_t lastOffset    = substringLength - 1;
+    const native_std::size_t numCandidates = length - lastOffset;
+    const __m128i            first         = _mm_set1_epi8(substring[0]);
+    const __m128i            last          = _mm_set1_epi8(
+                                                      substring[lastOffset]);
+
+    native_std::size_t i = 0;
+    for (; i + 16 <= numCandidates; i += 16) {
+        const __m128i firstBlock = _mm_loadu_si128(
+                                reinterpret_cast<const __m128i *>(string + i));
+        const __m128i lastBlock  = _mm_loadu_si128(
+                   reinterpret_cast<const __m128i *>(string + i + lastOffset));
+
+        unsigned int mask = _mm_movemask_epi8(
+                               _mm_and_si128(_mm_cmpeq_epi8(first, firstBlock),
+                                             _mm_cmpeq_epi8(last, lastBlock)));
+        while (mask) {
+            const char *candidate = string + i + __builtin_ctz(mask);
+            if (0 == native_std::memcmp(candidate + 1,
+                                        substring + 1,
+                                        substringLength - 2)) {
+                return candidate;                                     // RETURN
+            }
+            mask &= mask - 1;
+        }
+    }
+    return scalarFindSubstring(string + i,
+                               length - i,
+                               substring,
+                               substringLength);
+}
+
+__attribute__((target("sse4.2")))
+const char *sse42FindFirst(const char          *string,
+                           native_std::size_t   length,
+                           const CharacterSet&  set,
+                           bool                 isMember)
+    // Return the address of the first character in the specified 'string'
+    // having the specified 'length' whose membership in the specified 'set'
+    // is the specified 'isMember', or 0 if there is no such character.
+{
+    if (length < 16) {
+        return scalarFindFirst(string, length, set, isMember);        // RETURN
+    }
+
+    const unsigned int flip = isMember ? 0 : 0xFFFF;
+
+    native_std::size_t i = 0;
+    for (; i + 16 <= length; i += 16) {
+        const unsigned int mask = sse42Classify(string + i, set) ^ flip;
+        if (mask) {
+            return string + i + __builtin_ctz(mask);                  // RETURN
+        }
+    }
+    if (i < length) {
+        // Examine the final, partial block by reloading the last 16
+        // characters, ignoring those that have been examined already.
+
+        const unsigned int mask = (sse42Classify(string + length - 16, set)
+                                   ^ flip)
+                                & (0xFFFF << (16 - (length - i)));
+        if (mask) {
+            return string + length - 16 + __builtin_ctz(mask);        // RETURN
+        }
+    }
+    return 0;
+}
+
+__attribute__((target("sse4.2")))
+const char *sse42FindLast(const char          *string,
+                          native_std::size_t   length,
+                          const CharacterSet&  set,
+                          bool                 isMember)
+    // Return the address of the last character in the specified 'string'
+    // having the specified 'length' whose membership in the specified 'set'
+    // is the specified 'isMember', or 0 if there is no such character.
+{
+    if (length < 16) {
+        return scalarFindLast(string, length, set, isMember);         // RETURN
+    }
+
+    const unsigned int flip = isMember ? 0 : 0xFFFF;
+
+    native_std::size_t end = length;
+    for (; end >= 16; end -= 16) {
+        const unsigned int mask = sse42Classify(string + end - 16, set) ^ flip;
+        if (mask) {
+            return string + end - 16 + (31 - __builtin_clz(mask));    // RETURN
+        }
+    }
+    if (0 < end) {
+        const unsigned int mask = (sse42Classify(string, set) ^ flip)
+                                & ((1u << end) - 1);
+        if (mask) {
+            return string + (31 - __builtin_clz(mask));               // RETURN
+        }
+    }
+    return 0;
+}
+
+                        // ------------
+                        // AVX2 kernels
+                        // ------------
+
+__attribute__((target("avx2")))
+inline
+unsigned int avx2Classify(const char *block, const CharacterSet& set)
+    // Return a mask having bit 'i' set if the character at the specified
+    // 'block[i]' is a member of the specified 'set', for 'i' in '[0 .. 32)'.
+{
+    // 'vpshufb' looks up each 128-bit lane separately, so the tables are
+    // duplicated into both lanes.
+
+    const __m256i lowTable  = _mm256_broadcastsi128_si256(_mm_loadu_si128(
+                             reinterpret_cast<const __m128i *>(set.table())));
+    const __m256i highTable = _mm256_broadcastsi128_si256(_mm_loadu_si128(
+                        reinterpret_cast<const __m128i *>(set.table() + 16)));
+    const __m256i bitTable  = _mm256_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128,
+                                               1, 2, 4, 8, 16, 32, 64, -128,
+                                               1, 2, 4, 8, 16, 32, 64, -128,
+                                               1, 2, 4, 8, 16, 32, 64, -128);
+
+    const __m256i chars = _mm256_loadu_si256(
+                                   reinterpret_cast<const __m256i *>(block));
+
+    const __m256i index = _mm256_and_si256(chars, _mm256_set1_epi8(-0x71));
+    const __m256i row   = _mm256_or_si256(
+        _mm256_shuffle_epi8(lowTable, index),
+        _mm256_shuffle_epi8(highTable,
+                            _mm256_xor_si256(index, _mm256_set1_epi8(-0x80))));
+    const __m256i bit   = _mm256_shuffle_epi8(
+                            bitTable,
+                            _mm256_and_si256(_mm256_srli_epi16(chars, 4),
+                                             _mm256_set1_epi8(0xF)));
+
+    return _mm256_movemask_epi8(
+                         _mm256_cmpeq_epi8(_mm256_and_si256(row, bit), bit));
+}
+
+__attribute__((target("avx2")))
+const char *avx2FindSubstring(const char         *string,
+                              native_std::size_t  length,
+                              const char         *substring,
+                              native_std::size_t  substringLength)
+    // Return the address of the first occurrence of the specified 'substring'
+    // having the specified 'substringLength' in the specified 'string' having
+    // the specified 'length', or 0 if there is no such occurrence.  The
+    // behavior is undefined unless '2 <= substringLength <= length'.
+{
+    const native_std::size_t lastOffset    = substringLength - 1;
+    const native_std::size_t numCandidates = length - lastOffset;
+    const __m256i            first         = _mm256_set1_epi8(substring[0]);
+    const __m256i            last          = _mm256_set1_epi8(
+                                                      substring[lastOffset]);
+
+    native_std::size_t i = 0;
+    for (; i + 32 <= numCandidates; i += 32) {
+        const __m256i firstBlock = _mm256_loadu_si256(
+                                reinterpret_cast<const __m256i *>(string + i));
+        const __m256i lastBlock  = _mm256_loadu_si256(
+                   reinterpret_cast<const __m256i *>(string + i + lastOffset));
+
+        unsigned int mask = _mm256_movemask_epi8(
+                         _mm256_and_si256(_mm256_cmpeq_epi8(first, firstBlock),
+                                          _mm256_cmpeq_epi8(last, lastBlock)));
+        while (mask) {
+            const char *candidate = string + i + __builtin_ctz(mask);
+            if (0 == native_std::memcmp(candidate + 1,
+                                        substring + 1,
+                                        substringLength - 2)) {
+                return candidate;                                     // RETURN
+            }
+            mask &= mask - 1;
+        }
+    }
+    return sse42FindSubstring(string + i,
+                              length - i,
+                              substring,
+                              substringLength);
+}
+
+__attribute__((target("avx2")))
+const char *avx2FindFirst(const char          *string,
+                          native_std::size_t   length,
+                          const CharacterSet&  set,
+                          bool                 isMember)
+    // Return the address of the first character in the specified 'string'
+    // having the specified 'length' whose membership in the specified 'set'
+    // is the specified 'isMember', or 0 if there is no such character.
+{
+    if (length < 32) {
+        return sse42FindFirst(string, length, set, isMember);         // RETURN
+    }
+
+    const unsigned int flip = isMember ? 0 : 0xFFFFFFFF;
+
+    native_std::size_t i = 0;
+    for (; i + 32 <= length; i += 32) {
+        const unsigned int mask = avx2Classify(string + i, set) ^ flip;
+        if (mask) {
+            return string + i + __builtin_ctz(mask);                  // RETURN
+        }
+    }
+    if (i < length) {
+        const unsigned int mask = (avx2Classify(string + length - 32, set)
+                                   ^ flip)
+                                & (0xFFFFFFFF << (32 - (length - i)));
+        if (mask) {
+            return string + length - 32 + __builtin_ctz(mask);        // RETURN
+        }
+    }
+    return 0;
+}
+
+__attribute__((target("avx2")))
+const char *avx2FindLast(const char          *string,
+                         native_std::size_t   length,
+                         const CharacterSet&  set,
+                         bool                 isMember)
+    // Return the address of the last character in the specified 'string'
+    // having the specified 'length' whose membership in the specified 'set'
+    // is the specified 'isMember', or 0 if there is no such character.
+{
+    if (length < 32) {
+        return sse42FindLast(string, length, set, isMember);          // RETURN
+    }
+
+    const unsigned int flip = isMember ? 0 : 0xFFFFFFFF;
+
+    native_std::size_t end = length;
+    for (; end >= 32; end -= 32) {
+        const unsigned int mask = avx2Classify(string + end - 32, set) ^ flip;
+        if (mask) {
+            return string + end - 32 + (31 - __builtin_clz(mask));    // RETURN
+        }
+    }
+    if (0 < end) {
+        const unsigned int mask = (avx2Classify(string, set) ^ flip)
+                                & ((1u << end) - 1);
+        if (mask) {
+            return string + (31 - __builtin_clz(mask));               // RETURN
+        }
+    }
+    return 0;
+}
+
+#endif  // BSLSTL_STRINGSEARCHUTIL_X86_DISPATCH
+
+                        // -----------
+                        // dispatchers
+                        // -----------
+
+const char *findFirst(const char                         *string,
+                      native_std::size_t                  length,
+                      const char                         *characterSet,
+                      native_std::size_t                  setLength,
+                      bool                                isMember,
+                      bslstl::StringSearchUtil::Kernel    kernel)
+    // Return the address of the first character in the specified 'string'
+    // having the specified 'length' whose membership in the set of the
+    // specified 'setLength' characters at the specified 'characterSet' is the
+    // specified 'isMember', or 0 if there is no such character, using the
+    // specified 'kernel'.
+{
+    const CharacterSet set(characterSet, setLength);
+
+    switch (kernel) {
+#ifdef BSLSTL_STRINGSEARCHUTIL_X86_DISPATCH
+      case bslstl::StringSearchUtil::e_AVX2: {
+        return avx2FindFirst(string, length, set, isMember);          // RETURN
+      } break;
+      case bslstl::StringSearchUtil::e_SSE42: {
+        return sse42FindFirst(string, length, set, isMember);         // RETURN
+      } break;
+#endif
+      default: {
+        return scalarFindFirst(string, length, set, isMember);        // RETURN
+      } break;
+    }
+}
+
+const char *findLast(const char                         *string,
+                     native_std::size_t                  length,
+                     const char                         *characterSet,
+                     native_std::size_t                  setLength,
+                     bool                                isMember,
+                     bslstl::StringSearchUtil::Kernel    kernel)
+    // Return the address of the last character in the specified 'string'
+    // having the specified 'length' whose membership in the set of the
+    // specified 'setLength' characters at the specified 'characterSet' is the
+    // specified 'isMember', or 0 if there is no such character, using the
+    // specified 'kernel'.
+{
+    const CharacterSet set(characterSet, setLength);
+
+    switch (kernel) {
+#ifdef BSLSTL_STRINGSEARCHUTIL_X86_DISPATCH
+      case bslstl::StringSearchUtil::e_AVX2: {
+        return avx2FindLast(string, length, set, isMember);           // RETURN
+      } break;
+      case bslstl::StringSearchUtil::e_SSE42: {
+        return sse42FindLast(string, length, set, isMember);          // RETURN
+      } break;
+#endif
+      default: {
+        return scalarFindLast(string, length, set, isMember);         // RETURN
+      } break;
+    }
+}
+
+}  // close unnamed namespace
+
+namespace bslstl {
+
+                        // -----------------------
+                        // struct StringSearchUtil
+                        // -----------------------
+
+// CLASS DATA
+bsls::AtomicOperations::AtomicTypes::Int StringSearchUtil::s_kernel = {-1};
+
+// PRIVATE CLASS METHODS
+StringSearchUtil::Kernel StringSearchUtil::currentKernel()
+{
+    int kernel = bsls::AtomicOperations::getIntRelaxed(&s_kernel);
+    if (kernel < 0) {
+        // Concurrent first calls may each perform the selection; they store
+        // the same value.
+
+        kernel = isKernelSupported(e_AVX2)  ? e_AVX2
+               : isKernelSupported(e_SSE42) ? e_SSE42
+               :                              e_SCALAR;
+        bsls::AtomicOperations::setIntRelaxed(&s_kernel, kernel);
+    }
+    return static_cast<Kernel>(kernel);
+}
+
+// CLASS METHODS
+const char *StringSearchUtil::findSubstring(
+                                           const char         *string,
+                                           native_std::size_t  length,
+                                           const char         *substring,
+                                           native_std::size_t  substringLength)
+{
+    BSLS_ASSERT_SAFE(string    || 0 == length);
+    BSLS_ASSERT_SAFE(substring || 0 == substringLength);
+
+    if (substringLength > length) {
+        return 0;                                                     // RETURN
+    }
+    if (0 == substringLength) {
+        return string;                                                // RETURN
+    }
+    if (1 == substringLength) {
+        return static_cast<const char *>(
+                             native_std::memchr(string, *substring, length));
+                                                                      // RETURN
+    }
+
+    switch (currentKernel()) {
+#ifdef BSLSTL_STRINGSEARCHUTIL_X86_DISPATCH
+      case e_AVX2: {
+        return avx2FindSubstring(string,
+                                 length,
+                                 substring,
+                                 substringLength);                    // RETURN
+      } break;
+      case e_SSE42: {
+        return sse42FindSubstring(string,
+                                  length,
+                                  substring,
+                                  substringLength);                   // RETURN
+      } break;
+#endif
+      default: {
+        return scalarFindSubstring(string,
+                                   length,
+                                   substring,
+                                   substringLength);                  // RETURN
+      } break;
+    }
+}
+
+const char *StringSearchUtil::findFirstOf(const char         *string,
+                                          native_std::size_t  length,
+                                          const char         *characterSet,
+                                          native_std::size_t  setLength)
+{
+    BSLS_ASSERT_SAFE(string       || 0 == length);
+    BSLS_ASSERT_SAFE(characterSet || 0 == setLength);
+
+    if (0 == length || 0 == setLength) {
+        return 0;                                                     // RETURN
+    }
+    if (1 == setLength) {
+        return static_cast<const char *>(
+                          native_std::memchr(string, *characterSet, length));
+                                                                      // RETURN
+    }
+    return findFirst(string,
+                     length,
+                     characterSet,
+                     setLength,
+                     true,
+                     currentKernel());
+}
+
+const char *StringSearchUtil::findFirstNotOf(const char         *string,
+                                             native_std::size_t  length,
+                                             const char         *characterSet,
+                                             native_std::size_t  setLength)
+{
+    BSLS_ASSERT_SAFE(string       || 0 == length);
+    BSLS_ASSERT_SAFE(characterSet || 0 == setLength);
+
+    if (0 == length) {
+        return 0;                                                     // RETURN
+    }
+    return findFirst(string,
+                     length,
+                     characterSet,
+                     setLength,
+                     false,
+                     currentKernel());
+}
+
+const char *StringSearchUtil::findLastOf(const char         *string,
+                                         native_std::size_t  length,
+                                         const char         *characterSet,
+                                         native_std::size_t  setLength)
+{
+    BSLS_ASSERT_SAFE(string       || 0 == length);
+    BSLS_ASSERT_SAFE(characterSet || 0 == setLength);
+
+    if (0 == length || 0 == setLength) {
+        return 0;                                                     // RETURN
+    }
+    return findLast(string,
+                    length,
+                    characterSet,
+                    setLength,
+                    true,
+                    currentKernel());
+}
+
+const char *StringSearchUtil::findLastNotOf(const char         *string,
+                                            native_std::size_t  length,
+                                            const char         *characterSet,
+                                            native_std::size_t  setLength)
+{
+    BSLS_ASSERT_SAFE(string       || 0 == length);
+    BSLS_ASSERT_SAFE(characterSet || 0 == setLength);
+
+    if (0 == length) {
+        return 0;                                                     // RETURN
+    }
+    return findLast(string,
+                    length,
+                    characterSet,
+                    setLength,
+                    false,
+                    currentKernel());
+}
+
+bool StringSearchUtil::isKernelSupported(Kernel kernel)
+{
+    switch (kernel) {
+      case e_SCALAR: {
+        return true;                                                  // RETURN
+      } break;
+#ifdef BSLSTL_STRINGSEARCHUTIL_X86_DISPATCH
+      case e_SSE42: {
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("sse4.2");                      // RETURN
+      } break;
+      case e_AVX2: {
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("avx2");                        // RETURN
+      } break;
+#endif
+      default: {
+        return false;                                                 // RETURN
+      } break;
+    }
+}
+
+StringSearchUtil::Kernel StringSearchUtil::kernel()
+{
+    return currentKernel();
+}
+
+void StringSearchUtil::setKernel(Kernel kernel)
+{
+    BSLS_ASSERT(isKernelSupported(kernel));
+
+    bsls::AtomicOperations::setIntRelaxed(&s_kernel, kernel);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
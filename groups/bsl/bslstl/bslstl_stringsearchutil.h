@@ -0,0 +1,256 @@
+// bslstl_stringsearchutil.h                                          -*-C++-*-
+#ifndef INCLUDED_BSLSTL_STRINGSEARCHUTIL
+#define INCLUDED_BSLSTL_STRINGSEARCHUTIL
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide vectorized substring and character-set search on 'char'.
+//
+//@CLASSES:
+//  bslstl::StringSearchUtil: namespace for 'char' search functions
+//
+//@SEE_ALSO: bslstl_string
+//
+//@DESCRIPTION: This component provides a utility 'struct',
+// 'bslstl::StringSearchUtil', supplying functions that search a range of
+// 'char' for a substring ('findSubstring') or for the first or last character
+// that is (or is not) a member of a set of characters ('findFirstOf',
+// 'findLastOf', 'findFirstNotOf', and 'findLastNotOf').  These functions
+// implement the corresponding 'find' members of 'bsl::basic_string<char>'.
+//
+// The straightforward implementations of these operations locate each
+// occurrence of the first character of a substring and then compare the
+// remainder, and test every character of the searched range against every
+// character of the set, which is O(n * m).  The functions of this component
+// instead use one of several kernels, described below, chosen at run time.
+//
+///Kernels
+///-------
+// The following kernels are provided.  Each kernel reads only the characters
+// of the supplied ranges, so that a search never touches memory beyond the
+// end of a string:
+//
+//: 'e_SCALAR': Portable C++.  Substring search locates candidates for the
+//:   first character of the substring with 'memchr' and rejects most of them
+//:   by testing the last character before comparing the remainder.
+//:   Character-set search first builds a 256-bit bitmap of the set, making
+//:   the search O(n + m).
+//:
+//: 'e_SSE42': Examines 16 characters at a time using the SSE instruction set
+//:   up to SSE4.2.  Substring search compares the first and last characters
+//:   of the substring with two overlapping loads of the searched range,
+//:   yielding a mask of the (few) positions at which the remainder must be
+//:   compared.  Character-set search classifies each character by looking up
+//:   its low and high nibbles in the bitmap of the set with 'pshufb'.
+//:
+//: 'e_AVX2': As 'e_SSE42', but examining 32 characters at a time.
+//
+// On first use, the most capable kernel supported by both the compiler and
+// the processor (as reported by 'cpuid') is selected; the portable kernel is
+// always used on platforms other than x86 compiled by GCC or clang.  The
+// selection may be inspected with 'kernel' and overridden with 'setKernel',
+// which is intended for testing and benchmarking.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Splitting a Delimited Record
+///- - - - - - - - - - - - - - - - - - - -
+// Suppose we need to find the fields of a record in which fields are
+// separated by either a comma or a semicolon.
+//
+// First, we define the record and the set of delimiters:
+//..
+//  const char   *record       = "IBM,155.2;100,NYSE";
+//  const size_t  length       = native_std::strlen(record);
+//  const char    delimiters[] = ",;";
+//..
+// Then, we find the first delimiter:
+//..
+//  const char *delimiter = bslstl::StringSearchUtil::findFirstOf(record,
+//                                                                length,
+//                                                                delimiters,
+//                                                                2);
+//  assert(record + 3 == delimiter);
+//..
+// Next, we find the last delimiter, which precedes the final field:
+//..
+//  delimiter = bslstl::StringSearchUtil::findLastOf(record,
+//                                                   length,
+//                                                   delimiters,
+//                                                   2);
+//  assert(record + 13 == delimiter);
+//..
+// Finally, we look for a substring, which yields a null pointer if it is not
+// present:
+//..
+//  assert(record + 14 == bslstl::StringSearchUtil::findSubstring(record,
+//                                                                length,
+//                                                                "NYSE",
+//                                                                4));
+//  assert(0 == bslstl::StringSearchUtil::findSubstring(record,
+//                                                      length,
+//                                                      "LSE",
+//                                                      3));
+//..
+
+// Prevent 'bslstl' headers from being included directly in 'BSL_OVERRIDES_STD'
+// mode.  Doing so is unsupported, and is likely to cause compilation errors.
+#if defined(BSL_OVERRIDES_STD) && !defined(BSL_STDHDRS_PROLOGUE_IN_EFFECT)
+#error "include <bsl_string.h> instead of <bslstl_stringsearchutil.h> in \
+BSL_OVERRIDES_STD mode"
+#endif
+
+#ifndef INCLUDED_BSLSCM_VERSION
+#include <bslscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ATOMICOPERATIONS
+#include <bsls_atomicoperations.h>
+#endif
+
+#ifndef INCLUDED_BSLS_NATIVESTD
+#include <bsls_nativestd.h>
+#endif
+
+#ifndef INCLUDED_CSTDDEF
+#include <cstddef>
+#define INCLUDED_CSTDDEF
+#endif
+
+namespace BloombergLP {
+
+namespace bslstl {
+
+                        // =======================
+                        // struct StringSearchUtil
+                        // =======================
+
+struct StringSearchUtil {
+    // This 'struct' provides a namespace for functions that search a range of
+    // 'char' for a substring or for members of a set of characters, using the
+    // fastest implementation available on the executing processor.
+
+    // TYPES
+    enum Kernel {
+        // Enumerate the implementations of the search functions.
+
+        e_SCALAR = 0,  // portable implementation
+        e_SSE42  = 1,  // 16 characters at a time (SSE4.2)
+        e_AVX2   = 2   // 32 characters at a time (AVX2)
+    };
+
+  private:
+    // CLASS DATA
+    static bsls::AtomicOperations::AtomicTypes::Int s_kernel;
+                                    // selected 'Kernel', or -1 if no kernel
+                                    // has been selected yet
+
+    // PRIVATE CLASS METHODS
+    static Kernel currentKernel();
+        // Return the kernel to be used by the search functions, selecting the
+        // most capable supported kernel if none has been selected yet.
+
+  public:
+    // CLASS METHODS
+    static const char *findSubstring(const char         *string,
+                                     native_std::size_t  length,
+                                     const char         *substring,
+                                     native_std::size_t  substringLength);
+        // Return the address of the first occurrence of the specified
+        // 'substring' having the specified 'substringLength' in the specified
+        // 'string' having the specified 'length', or 0 if there is no such
+        // occurrence.  Return 'string' if '0 == substringLength'.  The
+        // behavior is undefined unless 'string' refers to at least 'length'
+        // characters and 'substring' refers to at least 'substringLength'
+        // characters.
+
+    static const char *findFirstOf(const char         *string,
+                                   native_std::size_t  length,
+                                   const char         *characterSet,
+                                   native_std::size_t  setLength);
+        // Return the address of the first character in the specified 'string'
+        // having the specified 'length' that is equal to any of the characters
+        // in the specified 'characterSet' having the specified 'setLength', or
+        // 0 if there is no such character.  The behavior is undefined unless
+        // 'string' refers to at least 'length' characters and 'characterSet'
+        // refers to at least 'setLength' characters.
+
+    static const char *findFirstNotOf(const char         *string,
+                                      native_std::size_t  length,
+                                      const char         *characterSet,
+                                      native_std::size_t  setLength);
+        // Return the address of the first character in the specified 'string'
+        // having the specified 'length' that is not equal to any of the
+        // characters in the specified 'characterSet' having the specified
+        // 'setLength', or 0 if there is no such character.  The behavior is
+        // undefined unless 'string' refers to at least 'length' characters
+        // and 'characterSet' refers to at least 'setLength' characters.
+
+    static const char *findLastOf(const char         *string,
+                                  native_std::size_t  length,
+                                  const char         *characterSet,
+                                  native_std::size_t  setLength);
+        // Return the address of the last character in the specified 'string'
+        // having the specified 'length' that is equal to any of the characters
+        // in the specified 'characterSet' having the specified 'setLength', or
+        // 0 if there is no such character.  The behavior is undefined unless
+        // 'string' refers to at least 'length' characters and 'characterSet'
+        // refers to at least 'setLength' characters.
+
+    static const char *findLastNotOf(const char         *string,
+                                     native_std::size_t  length,
+                                     const char         *characterSet,
+                                     native_std::size_t  setLength);
+        // Return the address of the last character in the specified 'string'
+        // having the specified 'length' that is not equal to any of the
+        // characters in the specified 'characterSet' having the specified
+        // 'setLength', or 0 if there is no such character.  The behavior is
+        // undefined unless 'string' refers to at least 'length' characters
+        // and 'characterSet' refers to at least 'setLength' characters.
+
+    static bool isKernelSupported(Kernel kernel);
+        // Return 'true' if the specified 'kernel' is supported by both the
+        // compiler used to build this component and the executing processor,
+        // and 'false' otherwise.  Note that 'e_SCALAR' is always supported.
+
+    static Kernel kernel();
+        // Return the kernel used by the search functions of this component.
+
+    static void setKernel(Kernel kernel);
+        // Use the specified 'kernel' for all subsequent searches.  The
+        // behavior is undefined unless 'isKernelSupported(kernel)'.  Note that
+        // this function is intended for testing and benchmarking, and that
+        // the most capable supported kernel is used by default.
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
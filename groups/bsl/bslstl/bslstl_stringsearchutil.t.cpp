@@ -0,0 +1,687 @@
+// bslstl_stringsearchutil.t.cpp                                      -*-C++-*-
+
+#include <bslstl_stringsearchutil.h>
+
+#include <bsls_bsltestutil.h>
+#include <bsls_nativestd.h>
+
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+using namespace BloombergLP;
+using namespace std;
+
+//=============================================================================
+//                             TEST PLAN
+//-----------------------------------------------------------------------------
+//                             Overview
+//                             --------
+// The component under test provides search functions having several
+// implementations ("kernels"), one of which is selected at run time.  Every
+// search function is verified, for every kernel supported on the executing
+// processor, against a brute-force oracle over all combinations of string
+// length and position of the sought characters within a range covering
+// several vector widths.  The searched range is embedded in a buffer whose
+// surrounding characters would change the result if they were examined, so
+// that a kernel reading outside of the range is detected.
+//-----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 2] const char *findSubstring(string, length, substring, substringLength);
+// [ 3] const char *findFirstOf(string, length, characterSet, setLength);
+// [ 3] const char *findFirstNotOf(string, length, characterSet, setLength);
+// [ 3] const char *findLastOf(string, length, characterSet, setLength);
+// [ 3] const char *findLastNotOf(string, length, characterSet, setLength);
+// [ 4] bool isKernelSupported(Kernel kernel);
+// [ 4] Kernel kernel();
+// [ 4] void setKernel(Kernel kernel);
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 5] USAGE EXAMPLE
+
+//=============================================================================
+//                  STANDARD BDE ASSERT TEST MACRO
+//-----------------------------------------------------------------------------
+static int testStatus = 0;
+
+static void aSsErT(bool b, const char *s, int i) {
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+//=============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef bslstl::StringSearchUtil Util;
+
+static const Util::Kernel KERNELS[] = {
+    Util::e_SCALAR,
+    Util::e_SSE42,
+    Util::e_AVX2
+};
+static const int NUM_KERNELS = sizeof KERNELS / sizeof *KERNELS;
+
+static const int MAX_LENGTH = 100;  // longest searched range; spans several
+                                    // 32-character blocks
+
+static const int PADDING = 40;      // characters on either side of the range
+
+namespace {
+
+const char *oracleFindSubstring(const char         *string,
+                                native_std::size_t  length,
+                                const char         *substring,
+                                native_std::size_t  substringLength)
+    // Return the address of the first occurrence of the specified 'substring'
+    // having the specified 'substringLength' in the specified 'string' having
+    // the specified 'length', or 0 if there is no such occurrence.
+{
+    for (native_std::size_t i = 0; i + substringLength <= length; ++i) {
+        native_std::size_t j = 0;
+        while (j < substringLength && string[i + j] == substring[j]) {
+            ++j;
+        }
+        if (j == substringLength) {
+            return string + i;                                        // RETURN
+        }
+    }
+    return 0;
+}
+
+bool isMemberOf(char c, const char *characterSet, native_std::size_t setLength)
+    // Return 'true' if the specified 'c' is one of the specified 'setLength'
+    // characters at the specified 'characterSet', and 'false' otherwise.
+{
+    for (native_std::size_t i = 0; i < setLength; ++i) {
+        if (characterSet[i] == c) {
+            return true;                                              // RETURN
+        }
+    }
+    return false;
+}
+
+const char *oracleFind(const char         *string,
+                       native_std::size_t  length,
+                       const char         *characterSet,
+                       native_std::size_t  setLength,
+                       bool                isMember,
+                       bool                isLast)
+    // Return the address of the first, or last if the specified 'isLast' is
+    // 'true', character in the specified 'string' having the specified
+    // 'length' whose membership in the set of the specified 'setLength'
+    // characters at the specified 'characterSet' is the specified 'isMember',
+    // or 0 if there is no such character.
+{
+    const char *result = 0;
+    for (native_std::size_t i = 0; i < length; ++i) {
+        if (isMemberOf(string[i], characterSet, setLength) == isMember) {
+            result = string + i;
+            if (!isLast) {
+                break;
+            }
+        }
+    }
+    return result;
+}
+
+class Random {
+    // This class provides a simple, deterministic pseudo-random sequence.
+
+    // DATA
+    unsigned int d_state;
+
+  public:
+    // CREATORS
+    explicit Random(unsigned int seed) : d_state(seed) {}
+        // Create a generator having the specified 'seed'.
+
+    // MANIPULATORS
+    unsigned int operator()()
+        // Return the next value of the sequence.
+    {
+        d_state = d_state * 1103515245u + 12345u;
+        return d_state >> 8;
+    }
+};
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+    bool     veryVeryVerbose = argc > 4;
+    bool veryVeryVeryVerbose = argc > 5;
+
+    (void) veryVeryVerbose;
+    (void) veryVeryVeryVerbose;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 5: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Splitting a Delimited Record
+///- - - - - - - - - - - - - - - - - - - -
+// Suppose we need to find the fields of a record in which fields are
+// separated by either a comma or a semicolon.
+//
+// First, we define the record and the set of delimiters:
+//..
+    const char   *record       = "IBM,155.2;100,NYSE";
+    const size_t  length       = native_std::strlen(record);
+    const char    delimiters[] = ",;";
+//..
+// Then, we find the first delimiter:
+//..
+    const char *delimiter = bslstl::StringSearchUtil::findFirstOf(record,
+                                                                  length,
+                                                                  delimiters,
+                                                                  2);
+    ASSERT(record + 3 == delimiter);
+//..
+// Next, we find the last delimiter, which precedes the final field:
+//..
+    delimiter = bslstl::StringSearchUtil::findLastOf(record,
+                                                     length,
+                                                     delimiters,
+                                                     2);
+    ASSERT(record + 13 == delimiter);
+//..
+// Finally, we look for a substring, which yields a null pointer if it is not
+// present:
+//..
+    ASSERT(record + 14 == bslstl::StringSearchUtil::findSubstring(record,
+                                                                  length,
+                                                                  "NYSE",
+                                                                  4));
+    ASSERT(0 == bslstl::StringSearchUtil::findSubstring(record,
+                                                        length,
+                                                        "LSE",
+                                                        3));
+//..
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // KERNEL SELECTION
+        //
+        // Concerns:
+        //: 1 The portable kernel is always supported.
+        //:
+        //: 2 By default, the most capable supported kernel is selected.
+        //:
+        //: 3 'setKernel' selects the specified kernel, which is then reported
+        //:   by 'kernel'.
+        //
+        // Plan:
+        //: 1 Verify that 'e_SCALAR' is supported.  (C-1)
+        //:
+        //: 2 Verify that the kernel reported before any other call is the
+        //:   last supported kernel in the order of the enumeration.  (C-2)
+        //:
+        //: 3 Select each supported kernel in turn and verify the value of
+        //:   'kernel'.  (C-3)
+        //
+        // Testing:
+        //   bool isKernelSupported(Kernel kernel);
+        //   Kernel kernel();
+        //   void setKernel(Kernel kernel);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nKERNEL SELECTION"
+                            "\n================\n");
+
+        ASSERT(Util::isKernelSupported(Util::e_SCALAR));
+
+        Util::Kernel expected = Util::e_SCALAR;
+        for (int ti = 0; ti < NUM_KERNELS; ++ti) {
+            if (veryVerbose) {
+                T_ P_(KERNELS[ti]) P(Util::isKernelSupported(KERNELS[ti]));
+            }
+            if (Util::isKernelSupported(KERNELS[ti])) {
+                expected = KERNELS[ti];
+            }
+        }
+        ASSERTV(expected, Util::kernel(), expected == Util::kernel());
+
+        for (int ti = 0; ti < NUM_KERNELS; ++ti) {
+            if (!Util::isKernelSupported(KERNELS[ti])) {
+                continue;
+            }
+            Util::setKernel(KERNELS[ti]);
+            ASSERTV(ti, KERNELS[ti] == Util::kernel());
+        }
+        Util::setKernel(expected);
+        ASSERT(expected == Util::kernel());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // CHARACTER-SET SEARCH
+        //
+        // Concerns:
+        //: 1 Each function returns the address of the first (or last)
+        //:   character of the range that is (or is not) a member of the set,
+        //:   or 0 if there is no such character.
+        //:
+        //: 2 Every character value, including '\0' and values having the high
+        //:   bit set, is classified correctly.
+        //:
+        //: 3 Sets of any size, including the empty set and sets of one
+        //:   character, are supported.
+        //:
+        //: 4 The result is correct for every length of the range and every
+        //:   position of the sought character, in particular across the
+        //:   boundaries of the blocks examined by the vectorized kernels.
+        //:
+        //: 5 No character outside of the range is examined.
+        //:
+        //: 6 Every supported kernel produces the same results.
+        //
+        // Plan:
+        //: 1 For each supported kernel, for each of a set of character sets,
+        //:   and for each length in '[0 .. MAX_LENGTH]', fill the range with
+        //:   characters that are not members of the set, surrounded by
+        //:   characters that are, and verify the results of all four
+        //:   functions against a brute-force oracle.  Then, for each position
+        //:   in the range, place a member of the set at that position and
+        //:   verify again.  Repeat with the roles of members and non-members
+        //:   interchanged for the 'Not' variants.  (C-1, 3..6)
+        //:
+        //: 2 For each supported kernel and for each character value, verify
+        //:   the results for a pseudo-randomly generated range against the
+        //:   oracle, using a set holding that value and a number of other
+        //:   pseudo-random values.  (C-2, 6)
+        //
+        // Testing:
+        //   const char *findFirstOf(string, length, characterSet, setLength);
+        //   const char *findFirstNotOf(string, length, characterSet, setLen);
+        //   const char *findLastOf(string, length, characterSet, setLength);
+        //   const char *findLastNotOf(string, length, characterSet, setLen);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCHARACTER-SET SEARCH"
+                            "\n====================\n");
+
+        static const struct {
+            int         d_line;       // source line number
+            const char *d_set;        // members of the set
+            int         d_setLength;  // number of members
+            char        d_member;     // a member of the set
+            char        d_other;      // a character that is not a member
+        } DATA[] = {
+            //LINE  SET                       LEN  MEMBER  OTHER
+            //----  ------------------------  ---  ------  -----
+            { L_,   "",                         0,   'a',   'a'   },
+            { L_,   ",",                        1,   ',',   'x'   },
+            { L_,   "\0",                       1,  '\0',   'x'   },
+            { L_,   "\x80",                     1, '\x80',  '\0'  },
+            { L_,   ",;",                       2,   ';',   ','+1 },
+            { L_,   "\r\n\t ",                  4,  '\t',   'A'   },
+            { L_,   "\xff\x7f\x80\x01",         4, '\xff',  '\xfe'},
+            { L_,   "0123456789",              10,   '7',   'a'   },
+            { L_,   "abcdefghijklmnopq",       17,   'q',   'r'   },
+            { L_,   "\x01\x11\x21\x31\x41\x51\x61\x71"
+                    "\x81\x91\xa1\xb1\xc1\xd1\xe1\xf1",
+                                               16, '\xb1',  '\x02'},
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        char buffer[MAX_LENGTH + 2 * PADDING];
+
+        for (int ti = 0; ti < NUM_KERNELS; ++ti) {
+            const Util::Kernel KERNEL = KERNELS[ti];
+            if (!Util::isKernelSupported(KERNEL)) {
+                continue;
+            }
+            Util::setKernel(KERNEL);
+
+            if (veryVerbose) { T_ P(KERNEL) }
+
+            for (int tj = 0; tj < NUM_DATA; ++tj) {
+                const int   LINE   = DATA[tj].d_line;
+                const char *SET    = DATA[tj].d_set;
+                const int   SETLEN = DATA[tj].d_setLength;
+
+                for (int inverted = 0; inverted < 2; ++inverted) {
+                    // In the inverted configuration, the range is filled with
+                    // members and the sought character is a non-member.
+
+                    const char FILL   = inverted ? DATA[tj].d_member
+                                                 : DATA[tj].d_other;
+                    const char SOUGHT = inverted ? DATA[tj].d_other
+                                                 : DATA[tj].d_member;
+
+                    for (int len = 0; len <= MAX_LENGTH; ++len) {
+                        for (int pos = -1; pos < len; ++pos) {
+                            native_std::memset(buffer, SOUGHT, sizeof buffer);
+                            char *string = buffer + PADDING;
+                            native_std::memset(string, FILL, len);
+                            if (0 <= pos) {
+                                string[pos] = SOUGHT;
+                            }
+
+                            for (int isNot = 0; isNot < 2; ++isNot) {
+                                const bool MEMBER = !isNot;
+                                const int  CONFIG = 2 * inverted + isNot;
+
+                                const char *EXP_FIRST = oracleFind(string,
+                                                                   len,
+                                                                   SET,
+                                                                   SETLEN,
+                                                                   MEMBER,
+                                                                   false);
+                                const char *EXP_LAST  = oracleFind(string,
+                                                                   len,
+                                                                   SET,
+                                                                   SETLEN,
+                                                                   MEMBER,
+                                                                   true);
+
+                                const char *first = isNot
+                                       ? Util::findFirstNotOf(string,
+                                                              len,
+                                                              SET,
+                                                              SETLEN)
+                                       : Util::findFirstOf(string,
+                                                           len,
+                                                           SET,
+                                                           SETLEN);
+                                const char *last  = isNot
+                                       ? Util::findLastNotOf(string,
+                                                             len,
+                                                             SET,
+                                                             SETLEN)
+                                       : Util::findLastOf(string,
+                                                          len,
+                                                          SET,
+                                                          SETLEN);
+
+                                ASSERTV(KERNEL, LINE, CONFIG, len, pos,
+                                        EXP_FIRST == first);
+                                ASSERTV(KERNEL, LINE, CONFIG, len, pos,
+                                        EXP_LAST  == last);
+                            }
+                        }
+                    }
+                }
+            }
+
+            Random random(ti);
+
+            for (int value = 0; value < 256; ++value) {
+                char set[8];
+                set[0] = static_cast<char>(value);
+                for (int i = 1; i < 8; ++i) {
+                    set[i] = static_cast<char>(random());
+                }
+
+                char *string = buffer + PADDING;
+                for (int i = 0; i < MAX_LENGTH; ++i) {
+                    string[i] = static_cast<char>(
+                                         random() % 4 ? random() : value);
+                }
+
+                for (int setLen = 1; setLen <= 8; setLen += 7) {
+                    ASSERTV(KERNEL, value, setLen,
+                            oracleFind(string, MAX_LENGTH, set, setLen,
+                                       true, false)
+                         == Util::findFirstOf(string, MAX_LENGTH, set,
+                                              setLen));
+                    ASSERTV(KERNEL, value, setLen,
+                            oracleFind(string, MAX_LENGTH, set, setLen,
+                                       false, false)
+                         == Util::findFirstNotOf(string, MAX_LENGTH, set,
+                                                 setLen));
+                    ASSERTV(KERNEL, value, setLen,
+                            oracleFind(string, MAX_LENGTH, set, setLen,
+                                       true, true)
+                         == Util::findLastOf(string, MAX_LENGTH, set,
+                                             setLen));
+                    ASSERTV(KERNEL, value, setLen,
+                            oracleFind(string, MAX_LENGTH, set, setLen,
+                                       false, true)
+                         == Util::findLastNotOf(string, MAX_LENGTH, set,
+                                                setLen));
+                }
+            }
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // SUBSTRING SEARCH
+        //
+        // Concerns:
+        //: 1 'findSubstring' returns the address of the first occurrence of
+        //:   the substring, or 0 if there is none.
+        //:
+        //: 2 An empty substring is found at the start of any range, and a
+        //:   substring longer than the range is never found.
+        //:
+        //: 3 Partial matches, including those matching the first and last
+        //:   characters of the substring only, are rejected.
+        //:
+        //: 4 The result is correct for every length of the range and every
+        //:   position of the substring, in particular across the boundaries
+        //:   of the blocks examined by the vectorized kernels.
+        //:
+        //: 5 No character outside of the range is examined.
+        //:
+        //: 6 Every supported kernel produces the same results.
+        //
+        // Plan:
+        //: 1 For each supported kernel, for each of a set of substrings, and
+        //:   for each length in '[0 .. MAX_LENGTH]', fill the range with a
+        //:   decoy (a copy of the substring differing only in a middle
+        //:   character, where possible) repeated, surrounded by copies of the
+        //:   substring, and verify the result against a brute-force oracle.
+        //:   Then, for each position in the range, place the substring at
+        //:   that position and verify again.  (C-1..6)
+        //
+        // Testing:
+        //   const char *findSubstring(string, length, substring, substrLen);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nSUBSTRING SEARCH"
+                            "\n================\n");
+
+        static const struct {
+            int         d_line;       // source line number
+            const char *d_substring;  // sought substring
+            int         d_length;     // length of 'd_substring'
+        } DATA[] = {
+            //LINE  SUBSTRING                                      LEN
+            //----  ---------------------------------------------  ---
+            { L_,   "",                                              0 },
+            { L_,   "a",                                             1 },
+            { L_,   "\0",                                            1 },
+            { L_,   "ab",                                            2 },
+            { L_,   "aa",                                            2 },
+            { L_,   "a\0b",                                          3 },
+            { L_,   "8=FIX",                                         5 },
+            { L_,   "\xff\x80\xff",                                  3 },
+            { L_,   "abcdefghijklmnopqrstuvwxyz0123456789ABCDEFGH", 44 },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        char buffer[MAX_LENGTH + 2 * PADDING];
+
+        for (int ti = 0; ti < NUM_KERNELS; ++ti) {
+            const Util::Kernel KERNEL = KERNELS[ti];
+            if (!Util::isKernelSupported(KERNEL)) {
+                continue;
+            }
+            Util::setKernel(KERNEL);
+
+            if (veryVerbose) { T_ P(KERNEL) }
+
+            for (int tj = 0; tj < NUM_DATA; ++tj) {
+                const int   LINE   = DATA[tj].d_line;
+                const char *SUB    = DATA[tj].d_substring;
+                const int   SUBLEN = DATA[tj].d_length;
+
+                // The decoy matches the first and last characters of the
+                // substring, so that it survives the filtering of the
+                // vectorized kernels.
+
+                char decoy[64];
+                native_std::memcpy(decoy, SUB, SUBLEN);
+                if (2 < SUBLEN) {
+                    decoy[SUBLEN / 2] = static_cast<char>(
+                                                     decoy[SUBLEN / 2] + 1);
+                }
+                else if (0 < SUBLEN) {
+                    decoy[0] = static_cast<char>(decoy[0] + 1);
+                }
+
+                for (int len = 0; len <= MAX_LENGTH; ++len) {
+                    for (int pos = -1; pos + SUBLEN <= len; ++pos) {
+                        for (int i = 0; i < (int)sizeof buffer; ++i) {
+                            buffer[i] = SUBLEN ? SUB[i % SUBLEN] : 'x';
+                        }
+                        char *string = buffer + PADDING;
+                        for (int i = 0; i < len; ++i) {
+                            string[i] = SUBLEN ? decoy[i % SUBLEN] : 'y';
+                        }
+                        if (0 <= pos) {
+                            native_std::memcpy(string + pos, SUB, SUBLEN);
+                        }
+
+                        const char *EXP = oracleFindSubstring(string,
+                                                              len,
+                                                              SUB,
+                                                              SUBLEN);
+
+                        ASSERTV(KERNEL, LINE, len, pos,
+                                EXP == Util::findSubstring(string,
+                                                           len,
+                                                           SUB,
+                                                           SUBLEN));
+                    }
+                }
+            }
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Perform each search on a short string.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        if (verbose) { P(Util::kernel()) }
+
+        const char   *STRING = "8=FIX.4.2|9=65|35=A|";
+        const size_t  LENGTH = native_std::strlen(STRING);
+
+        ASSERT(STRING + 10 == Util::findSubstring(STRING, LENGTH, "9=", 2));
+        ASSERT(STRING + 15 == Util::findSubstring(STRING, LENGTH, "35=A", 4));
+        ASSERT(0           == Util::findSubstring(STRING, LENGTH, "35=B", 4));
+        ASSERT(STRING      == Util::findSubstring(STRING, LENGTH, "", 0));
+
+        ASSERT(STRING + 1  == Util::findFirstOf(STRING, LENGTH, "=|", 2));
+        ASSERT(STRING + 19 == Util::findLastOf(STRING, LENGTH, "=|", 2));
+        ASSERT(STRING + 1  == Util::findFirstNotOf(STRING, LENGTH,
+                                                   "0123456789", 10));
+        ASSERT(STRING + 18 == Util::findLastNotOf(STRING, LENGTH, "|", 1));
+        ASSERT(0           == Util::findFirstOf(STRING, LENGTH, "#", 1));
+        ASSERT(0           == Util::findLastOf(STRING, LENGTH, "", 0));
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -12,7 +12,8 @@ BSLS_IDENT("$Id: $")
 //@CLASSES:
 //   bslstl::TreeNode: a tree node holding a parameterized value
 //
-//@SEE_ALSO: bslstl_treenodefactory, bslstl_set, bslstl_map
+//@SEE_ALSO: bslstl_treenodefactory, bslstl_set, bslstl_map,
+//           bslalg_rbtreecountednode
 //
 //@DESCRIPTION: This component provides a single POD-like class, 'TreeNode',
 // used to represent a node in a red-black binary search tree holding a value
@@ -52,6 +53,13 @@ BSLS_IDENT("$Id: $")
 // modifiable reference to the object that may be constructed in-place by the
 // appropriate 'bsl::allocator_traits' object.
 //
+// By default, a 'TreeNode' derives from 'bslalg::RbTreeNode'.  A type derived
+// from 'bslalg::RbTreeNode' that adds (trivially-constructible) attributes may
+// be supplied instead as the optional (template parameter) type 'BASE'; for
+// example, a 'TreeNode<VALUE, bslalg::RbTreeCountedNode>' additionally records
+// the size of its subtree, and so may be used with the order-statistic
+// functions of 'bslalg::RbTreeUtil' (see 'bslalg_rbtreeutil').
+//
 ///Usage
 ///-----
 // In this section we show intended usage of this component.
@@ -341,8 +349,8 @@ namespace bslstl {
                         // class TreeNode
                         // ==============
 
-template <class VALUE>
-class TreeNode : public bslalg::RbTreeNode {
+template <class VALUE, class BASE = bslalg::RbTreeNode>
+class TreeNode : public BASE {
     // This POD-like 'class' describes a node suitable for use in a red-black
     // binary search tree of values of the parameterized 'VALUE'.  This class
     // is a "POD-like" to facilitate efficient allocation and use in the
@@ -350,7 +358,8 @@ class TreeNode : public bslalg::RbTreeNode {
     // requirements of a POD type, this 'class' does not define a constructor
     // or destructor.  The manipulator, 'value', returns a modifiable reference
     // to 'd_value' so that it may be constructed in-place by the appropriate
-    // 'bsl::allocator_traits' object.
+    // 'bsl::allocator_traits' object.  The (template parameter) type 'BASE'
+    // shall be 'bslalg::RbTreeNode' or a POD-like type derived from it.
 
     // DATA
     VALUE d_value;  // payload value
@@ -382,16 +391,16 @@ class TreeNode : public bslalg::RbTreeNode {
 //                  TEMPLATE AND INLINE FUNCTION DEFINITIONS
 // ===========================================================================
 
-template <class VALUE>
+template <class VALUE, class BASE>
 inline
-VALUE& TreeNode<VALUE>::value()
+VALUE& TreeNode<VALUE, BASE>::value()
 {
     return d_value;
 }
 
-template <class VALUE>
+template <class VALUE, class BASE>
 inline
-const VALUE& TreeNode<VALUE>::value() const
+const VALUE& TreeNode<VALUE, BASE>::value() const
 {
     return d_value;
 }
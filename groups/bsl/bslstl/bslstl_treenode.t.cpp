@@ -6,6 +6,7 @@
 #include <bslstl_string.h>
 
 #include <bslalg_rbtreeanchor.h>
+#include <bslalg_rbtreecountednode.h>
 #include <bslalg_rbtreenode.h>
 #include <bslalg_rbtreeutil.h>
 
@@ -517,6 +518,10 @@ int main(int argc, char *argv[])
         //: 2 Accessor return value set by manipulator.
         //:
         //: 3 Accessor is declared const.
+        //:
+        //: 4 A 'TreeNode' having a 'BASE' of 'bslalg::RbTreeCountedNode'
+        //:   provides the attributes of both 'BASE' and 'TreeNode', and they
+        //:   can be set independently.
         //
         // Plan:
         //: 1 Create a 'TreeNode' with 'VALUE_TYPE' as 'int' and set 'value'
@@ -525,6 +530,10 @@ int main(int argc, char *argv[])
         //: 2 Create a 'TreeNode' with a type that has a constructor that can
         //:   be verified if it has been invoked.  Verify that the constructor
         //:   is invoked when 'allocator_traits::construct' is used.
+        //:
+        //: 3 Create a 'TreeNode' with 'VALUE_TYPE' as 'int' and 'BASE' as
+        //:   'bslalg::RbTreeCountedNode', set its 'value' and 'subtreeSize'
+        //:   to distinct numbers, and verify each with its accessor.  (C-4)
         //
         // Testing:
         //   VALUE_TYPE& value();
@@ -609,6 +618,39 @@ int main(int argc, char *argv[])
             AllocTraits::deallocate(allocator, &mX, 1);
             ASSERTV(0 == oa.numBlocksInUse());
         }
+
+        if (verbose) printf(
+                  "\nTesting manipulator and accessor for a counted node.\n");
+        {
+            typedef int                                       Type;
+            typedef TreeNode<Type, bslalg::RbTreeCountedNode> Obj;
+
+            typedef bsl::allocator<Obj>          Alloc;
+            typedef bsl::allocator_traits<Alloc> AllocTraits;
+
+            Alloc allocator(&oa);
+            Obj *xPtr = AllocTraits::allocate(allocator, 1);
+            Obj& mX = *xPtr; const Obj& X = mX;
+
+            mX.value() = 1;
+            mX.setSubtreeSize(2);
+            ASSERTV(X.value(),       1 == X.value());
+            ASSERTV(X.subtreeSize(), 2 == X.subtreeSize());
+
+            mX.value() = INT_MAX;
+            ASSERTV(X.value(),       INT_MAX == X.value());
+            ASSERTV(X.subtreeSize(), 2       == X.subtreeSize());
+
+            mX.setSubtreeSize(INT_MAX);
+            ASSERTV(X.value(),       INT_MAX == X.value());
+            ASSERTV(X.subtreeSize(), INT_MAX == X.subtreeSize());
+
+            ASSERTV(0 == da.numBlocksTotal());
+            ASSERTV(1 == oa.numBlocksInUse());
+
+            AllocTraits::deallocate(allocator, &mX, 1);
+            ASSERTV(0 == oa.numBlocksInUse());
+        }
       } break;
       case 1: {
         // --------------------------------------------------------------------
@@ -26,6 +26,13 @@ BSLS_IDENT("$Id: $")
 // Subsequent allocations double the number of memory blocks of the previous
 // allocation up to an implementation defined maximum number of blocks.
 //
+// By default, the nodes are of type 'bslstl::TreeNode<VALUE>'.  A 'TreeNode'
+// having a different base class, such as
+// 'bslstl::TreeNode<VALUE, bslalg::RbTreeCountedNode>', may be supplied
+// instead as the optional (template parameter) type 'NODE'; the pool
+// constructs and destroys only the 'value' attribute of each node, leaving
+// any additional attributes for the client to initialize.
+//
 ///Usage
 ///-----
 // This section illustrates intended use of this component.
@@ -222,6 +229,10 @@ BSL_OVERRIDES_STD mode"
 #include <bslstl_allocatortraits.h>
 #endif
 
+#ifndef INCLUDED_BSLSTL_NODEHANDLE
+#include <bslstl_nodehandle.h>
+#endif
+
 #ifndef INCLUDED_BSLSTL_SIMPLEPOOL
 #include <bslstl_simplepool.h>
 #endif
@@ -238,6 +249,18 @@ BSL_OVERRIDES_STD mode"
 #include <bslma_deallocatorproctor.h>
 #endif
 
+#ifndef INCLUDED_BSLMA_DESTRUCTORPROCTOR
+#include <bslma_destructorproctor.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_REMOVECONST
+#include <bslmf_removeconst.h>
+#endif
+
+#ifndef INCLUDED_BSLS_COMPILERFEATURES
+#include <bsls_compilerfeatures.h>
+#endif
+
 #ifndef INCLUDED_BSLS_UTIL
 #include <bsls_util.h>
 #endif
@@ -249,16 +272,18 @@ namespace bslstl {
                        // class TreeNodePool
                        // ==================
 
-template <class VALUE, class ALLOCATOR>
+template <class VALUE, class ALLOCATOR, class NODE = TreeNode<VALUE> >
 class TreeNodePool {
-    // This class provides methods for creating and deleting nodes using the
-    // appropriate allocator-traits of the parameterized 'ALLOCATOR'.  This
-    // type is intended to be used as a private base-class for a node-based
-    // container, in order to take advantage of the empty-base-class
-    // optimization in the case where the base-class has 0 size (as may the
-    // case if the parameterized 'ALLOCATOR' is not a 'bslma::Allocator').
-
-    typedef SimplePool<TreeNode<VALUE>, ALLOCATOR> Pool;
+    // This class provides methods for creating and deleting nodes of the
+    // (template parameter) type 'NODE' using the appropriate allocator-traits
+    // of the parameterized 'ALLOCATOR'.  'NODE' shall be a 'TreeNode' holding
+    // a 'VALUE' (see 'bslstl_treenode').  This type is intended to be used as
+    // a private base-class for a node-based container, in order to take
+    // advantage of the empty-base-class optimization in the case where the
+    // base-class has 0 size (as may the case if the parameterized 'ALLOCATOR'
+    // is not a 'bslma::Allocator').
+
+    typedef SimplePool<NODE, ALLOCATOR>            Pool;
         // Alias for the memory pool allocator.
 
     typedef typename Pool::AllocatorTraits         AllocatorTraits;
@@ -298,23 +323,120 @@ class TreeNodePool {
     bslalg::RbTreeNode *createNode(const bslalg::RbTreeNode& original);
         // Allocate a node object having a copy-constructed 'VALUE' of
         // 'value()' of the specified 'original'.  The behavior is undefined
-        // unless 'original' refers to a 'TreeNode<VALUE>'.
+        // unless 'original' refers to a 'NODE'.
 
     bslalg::RbTreeNode *createNode(const VALUE& value);
         // Allocate a node object having the specified 'value'.  This operation
         // will copy-construct 'value' into the value of the returned node.
 
+    template <class FIRST_ARG>
+    bslalg::RbTreeNode *createNodePiecewise(const FIRST_ARG& first);
+
+    template <class FIRST_ARG, class ARG_1>
+    bslalg::RbTreeNode *createNodePiecewise(
+                                const FIRST_ARG&                         first,
+                                BSLS_COMPILERFEATURES_FORWARD_REF(ARG_1) arg1);
+
+    template <class FIRST_ARG, class ARG_1, class ARG_2>
+    bslalg::RbTreeNode *createNodePiecewise(
+                                const FIRST_ARG&                         first,
+                                BSLS_COMPILERFEATURES_FORWARD_REF(ARG_1) arg1,
+                                BSLS_COMPILERFEATURES_FORWARD_REF(ARG_2) arg2);
+
+    template <class FIRST_ARG, class ARG_1, class ARG_2, class ARG_3>
+    bslalg::RbTreeNode *createNodePiecewise(
+                                const FIRST_ARG&                         first,
+                                BSLS_COMPILERFEATURES_FORWARD_REF(ARG_1) arg1,
+                                BSLS_COMPILERFEATURES_FORWARD_REF(ARG_2) arg2,
+                                BSLS_COMPILERFEATURES_FORWARD_REF(ARG_3) arg3);
+        // Allocate a node object whose 'VALUE', which must be a 'bsl::pair'
+        // (or have compatible 'first' and 'second' members), is constructed
+        // piecewise: its 'first' member from the specified 'first', and its
+        // 'second' member from the optionally specified 'arg1', 'arg2', and
+        // 'arg3', or value-initialized if no such arguments are supplied.
+        // Both members are constructed through the allocator traits of
+        // 'allocator()', so an allocator-aware member is supplied with the
+        // allocator of this pool, and no temporary 'VALUE' is created.  If an
+        // exception is thrown, this pool is left unchanged.
+
+    bslalg::RbTreeNode *createNodeByRelocation(VALUE *original,
+                                               bool   isSameAllocator);
+        // Allocate a node object, and relocate into its 'VALUE' the object at
+        // the specified 'original' address, ending the lifetime of that
+        // object (see 'NodeHandleUtil::relocate').  The specified
+        // 'isSameAllocator' indicates whether the object at 'original' was
+        // created using an allocator that compares equal to 'allocator()'.  If
+        // an exception is thrown, the object at 'original' is unchanged.
+
+    bslalg::RbTreeNode *createDetachedNode(bslalg::RbTreeNode *original);
+        // Allocate a detached node object, which is not owned by this pool
+        // (see {'bslstl_simplepool'|Detached Blocks}), relocate into its
+        // 'VALUE' the 'VALUE' of the specified 'original' node, ending the
+        // lifetime of that object (see 'NodeHandleUtil::relocate'), and return
+        // the address of the new node.  The memory footprint of 'original' is
+        // left to the caller to deallocate (see 'deallocateNode').  If an
+        // exception is thrown, no memory is allocated and 'original' is
+        // unchanged.  The behavior is undefined unless 'original' refers to a
+        // 'NODE' created by this pool.  Note that the returned node is
+        // intended to be owned by a 'NodeHandle', and that its memory remains
+        // valid after this pool is released.
+
+    void adopt(TreeNodePool<VALUE, ALLOCATOR, NODE>& other);
+        // Take over the management of all the nodes of the specified 'other'
+        // object, leaving 'other' with no memory, so that the nodes that were
+        // created by 'other' may be deleted (or deallocated) by this object,
+        // and the memory that 'other' has reserved is available for the
+        // creation of nodes by this object.  This method has no effect if
+        // 'other' is this object.  The behavior is undefined unless the
+        // underlying mechanisms of 'allocator()' refers to the same
+        // allocator.  Note that this operation allows a container to take
+        // over the nodes of another container without allocating memory or
+        // copying values.
+
+    void adoptNode(bslalg::RbTreeNode *node);
+        // Take over the ownership of the specified detached 'node', and of its
+        // 'VALUE', so that 'node' may later be deleted (or deallocated) by
+        // this pool (see {'bslstl_simplepool'|Detached Blocks}).  This method
+        // does not allocate memory, and provides the no-throw
+        // exception-safety guarantee.  The behavior is undefined unless
+        // 'node' refers to a 'NODE' created by 'createDetachedNode' from a
+        // pool whose allocator compares equal to 'allocator()', and is not
+        // owned by a pool.
+
+    void deallocateNode(bslalg::RbTreeNode *node);
+        // Return the memory footprint of the specified 'node' to this pool for
+        // potential reuse without destroying its 'VALUE', whose lifetime must
+        // already have ended (e.g., by relocating it).  The behavior is
+        // undefined unless 'node' refers to a 'NODE'.
+
     void deleteNode(bslalg::RbTreeNode *node);
         // Destroy the 'VALUE' value of the specified 'node' and return the
         // memory footprint of 'node' to this pool for potential reuse.  The
-        // behavior is undefined unless 'node' refers to a 'TreeNode<VALUE>'.
+        // behavior is undefined unless 'node' refers to a 'NODE'.
 
     void reserveNodes(size_type numNodes);
         // Reserve memory from this pool to satisfy memory requests for at
         // least the specified 'numNodes' before the pool replenishes.  The
         // behavior is undefined unless '0 < numNodes'.
 
-    void swap(TreeNodePool<VALUE, ALLOCATOR>& other);
+    template <class NODE_HANDLE>
+    bslalg::RbTreeNode *takeNode(NODE_HANDLE *handle, bool isSameAllocator);
+        // Take over the node owned by the specified 'handle', make 'handle'
+        // empty, and return the address of the node holding the element of
+        // 'handle'.  The specified 'isSameAllocator' indicates whether the
+        // element of 'handle' was created using an allocator that compares
+        // equal to 'allocator()'.  If 'isSameAllocator' is 'true' and this
+        // pool has no free node, the node of 'handle' is adopted (see
+        // 'adoptNode'), so that the element keeps its address and no memory is
+        // allocated; otherwise, the element is relocated into a node of this
+        // pool (see 'createNodeByRelocation'), and the node of 'handle' is
+        // returned to the allocator of 'handle', so that adopting nodes never
+        // makes this pool hold more nodes than it has had in use at once.  If
+        // an exception is thrown, this pool and 'handle' are unchanged.  The
+        // behavior is undefined unless 'handle' is a non-empty
+        // 'bslstl::NodeHandle' whose nodes have the type 'NODE'.
+
+    void swap(TreeNodePool<VALUE, ALLOCATOR, NODE>& other);
         // Efficiently exchange the management of nodes of this object and
         // the specified 'other' object.  The behavior is undefined unless the
         // underlying mechanisms of 'allocator()' refers to the same allocator.
@@ -332,27 +454,27 @@ class TreeNodePool {
 // ===========================================================================
 
 // CREATORS
-template <class VALUE, class ALLOCATOR>
+template <class VALUE, class ALLOCATOR, class NODE>
 inline
-TreeNodePool<VALUE, ALLOCATOR>::TreeNodePool(const ALLOCATOR& allocator)
+TreeNodePool<VALUE, ALLOCATOR, NODE>::TreeNodePool(const ALLOCATOR& allocator)
 : d_pool(allocator)
 {
 }
 
 // MANIPULATORS
-template <class VALUE, class ALLOCATOR>
+template <class VALUE, class ALLOCATOR, class NODE>
 inline
-typename SimplePool<TreeNode<VALUE>, ALLOCATOR>::AllocatorType&
-TreeNodePool<VALUE, ALLOCATOR>::allocator()
+typename SimplePool<NODE, ALLOCATOR>::AllocatorType&
+TreeNodePool<VALUE, ALLOCATOR, NODE>::allocator()
 {
     return d_pool.allocator();
 }
 
-template <class VALUE, class ALLOCATOR>
+template <class VALUE, class ALLOCATOR, class NODE>
 inline
-bslalg::RbTreeNode *TreeNodePool<VALUE, ALLOCATOR>::createNode()
+bslalg::RbTreeNode *TreeNodePool<VALUE, ALLOCATOR, NODE>::createNode()
 {
-    TreeNode<VALUE> *node = d_pool.allocate();
+    NODE *node = d_pool.allocate();
     bslma::DeallocatorProctor<Pool> proctor(node, &d_pool);
 
     AllocatorTraits::construct(allocator(),
@@ -362,12 +484,12 @@ bslalg::RbTreeNode *TreeNodePool<VALUE, ALLOCATOR>::createNode()
     return node;
 }
 
-template <class VALUE, class ALLOCATOR>
+template <class VALUE, class ALLOCATOR, class NODE>
 inline
-bslalg::RbTreeNode *TreeNodePool<VALUE, ALLOCATOR>::createNode(
+bslalg::RbTreeNode *TreeNodePool<VALUE, ALLOCATOR, NODE>::createNode(
                                                             const VALUE& value)
 {
-    TreeNode<VALUE> *node = d_pool.allocate();
+    NODE *node = d_pool.allocate();
     bslma::DeallocatorProctor<Pool> proctor(node, &d_pool);
 
     AllocatorTraits::construct(allocator(),
@@ -377,39 +499,237 @@ bslalg::RbTreeNode *TreeNodePool<VALUE, ALLOCATOR>::createNode(
     return node;
 }
 
-template <class VALUE, class ALLOCATOR>
+template <class VALUE, class ALLOCATOR, class NODE>
 inline
-bslalg::RbTreeNode *TreeNodePool<VALUE, ALLOCATOR>::createNode(
+bslalg::RbTreeNode *TreeNodePool<VALUE, ALLOCATOR, NODE>::createNode(
                                             const bslalg::RbTreeNode& original)
 {
-    return createNode(static_cast<const TreeNode<VALUE>&>(original).value());
+    return createNode(static_cast<const NODE&>(original).value());
+}
+
+template <class VALUE, class ALLOCATOR, class NODE>
+template <class FIRST_ARG>
+inline
+bslalg::RbTreeNode *TreeNodePool<VALUE, ALLOCATOR, NODE>::createNodePiecewise(
+                                                        const FIRST_ARG& first)
+{
+    typedef typename bsl::remove_const<typename VALUE::first_type>::type
+                                                                     FirstType;
+
+    NODE *node = d_pool.allocate();
+    bslma::DeallocatorProctor<Pool> proctor(node, &d_pool);
+
+    FirstType *firstAddress = const_cast<FirstType *>(
+                                     BSLS_UTIL_ADDRESSOF(node->value().first));
+    AllocatorTraits::construct(allocator(), firstAddress, first);
+    bslma::DestructorProctor<FirstType> firstProctor(firstAddress);
+
+    AllocatorTraits::construct(allocator(),
+                               BSLS_UTIL_ADDRESSOF(node->value().second));
+    firstProctor.release();
+    proctor.release();
+    return node;
 }
 
-template <class VALUE, class ALLOCATOR>
+template <class VALUE, class ALLOCATOR, class NODE>
+template <class FIRST_ARG, class ARG_1>
 inline
-void TreeNodePool<VALUE, ALLOCATOR>::deleteNode(bslalg::RbTreeNode *node)
+bslalg::RbTreeNode *TreeNodePool<VALUE, ALLOCATOR, NODE>::createNodePiecewise(
+                                const FIRST_ARG&                         first,
+                                BSLS_COMPILERFEATURES_FORWARD_REF(ARG_1) arg1)
+{
+    typedef typename bsl::remove_const<typename VALUE::first_type>::type
+                                                                     FirstType;
+
+    NODE *node = d_pool.allocate();
+    bslma::DeallocatorProctor<Pool> proctor(node, &d_pool);
+
+    FirstType *firstAddress = const_cast<FirstType *>(
+                                     BSLS_UTIL_ADDRESSOF(node->value().first));
+    AllocatorTraits::construct(allocator(), firstAddress, first);
+    bslma::DestructorProctor<FirstType> firstProctor(firstAddress);
+
+    AllocatorTraits::construct(allocator(),
+                               BSLS_UTIL_ADDRESSOF(node->value().second),
+                               BSLS_COMPILERFEATURES_FORWARD(ARG_1, arg1));
+    firstProctor.release();
+    proctor.release();
+    return node;
+}
+
+template <class VALUE, class ALLOCATOR, class NODE>
+template <class FIRST_ARG, class ARG_1, class ARG_2>
+inline
+bslalg::RbTreeNode *TreeNodePool<VALUE, ALLOCATOR, NODE>::createNodePiecewise(
+                                const FIRST_ARG&                         first,
+                                BSLS_COMPILERFEATURES_FORWARD_REF(ARG_1) arg1,
+                                BSLS_COMPILERFEATURES_FORWARD_REF(ARG_2) arg2)
+{
+    typedef typename bsl::remove_const<typename VALUE::first_type>::type
+                                                                     FirstType;
+
+    NODE *node = d_pool.allocate();
+    bslma::DeallocatorProctor<Pool> proctor(node, &d_pool);
+
+    FirstType *firstAddress = const_cast<FirstType *>(
+                                     BSLS_UTIL_ADDRESSOF(node->value().first));
+    AllocatorTraits::construct(allocator(), firstAddress, first);
+    bslma::DestructorProctor<FirstType> firstProctor(firstAddress);
+
+    AllocatorTraits::construct(allocator(),
+                               BSLS_UTIL_ADDRESSOF(node->value().second),
+                               BSLS_COMPILERFEATURES_FORWARD(ARG_1, arg1),
+                               BSLS_COMPILERFEATURES_FORWARD(ARG_2, arg2));
+    firstProctor.release();
+    proctor.release();
+    return node;
+}
+
+template <class VALUE, class ALLOCATOR, class NODE>
+template <class FIRST_ARG, class ARG_1, class ARG_2, class ARG_3>
+inline
+bslalg::RbTreeNode *TreeNodePool<VALUE, ALLOCATOR, NODE>::createNodePiecewise(
+                                const FIRST_ARG&                         first,
+                                BSLS_COMPILERFEATURES_FORWARD_REF(ARG_1) arg1,
+                                BSLS_COMPILERFEATURES_FORWARD_REF(ARG_2) arg2,
+                                BSLS_COMPILERFEATURES_FORWARD_REF(ARG_3) arg3)
+{
+    typedef typename bsl::remove_const<typename VALUE::first_type>::type
+                                                                     FirstType;
+
+    NODE *node = d_pool.allocate();
+    bslma::DeallocatorProctor<Pool> proctor(node, &d_pool);
+
+    FirstType *firstAddress = const_cast<FirstType *>(
+                                     BSLS_UTIL_ADDRESSOF(node->value().first));
+    AllocatorTraits::construct(allocator(), firstAddress, first);
+    bslma::DestructorProctor<FirstType> firstProctor(firstAddress);
+
+    AllocatorTraits::construct(allocator(),
+                               BSLS_UTIL_ADDRESSOF(node->value().second),
+                               BSLS_COMPILERFEATURES_FORWARD(ARG_1, arg1),
+                               BSLS_COMPILERFEATURES_FORWARD(ARG_2, arg2),
+                               BSLS_COMPILERFEATURES_FORWARD(ARG_3, arg3));
+    firstProctor.release();
+    proctor.release();
+    return node;
+}
+
+template <class VALUE, class ALLOCATOR, class NODE>
+inline
+bslalg::RbTreeNode *
+TreeNodePool<VALUE, ALLOCATOR, NODE>::createNodeByRelocation(
+                                                  VALUE *original,
+                                                  bool   isSameAllocator)
+{
+    BSLS_ASSERT_SAFE(original);
+
+    NODE *node = d_pool.allocate();
+    bslma::DeallocatorProctor<Pool> proctor(node, &d_pool);
+
+    NodeHandleUtil::relocate(BSLS_UTIL_ADDRESSOF(node->value()),
+                             original,
+                             &allocator(),
+                             isSameAllocator);
+    proctor.release();
+    return node;
+}
+
+template <class VALUE, class ALLOCATOR, class NODE>
+inline
+bslalg::RbTreeNode *
+TreeNodePool<VALUE, ALLOCATOR, NODE>::createDetachedNode(
+                                                  bslalg::RbTreeNode *original)
+{
+    BSLS_ASSERT_SAFE(original);
+
+    NODE *node = d_pool.allocateDetached();
+    SimplePool_DetachedProctor<NODE, ALLOCATOR> proctor(node, &d_pool);
+
+    NODE *originalNode = static_cast<NODE *>(original);
+    NodeHandleUtil::relocate(BSLS_UTIL_ADDRESSOF(node->value()),
+                             BSLS_UTIL_ADDRESSOF(originalNode->value()),
+                             &allocator(),
+                             true);
+    proctor.release();
+    return node;
+}
+
+template <class VALUE, class ALLOCATOR, class NODE>
+inline
+void TreeNodePool<VALUE, ALLOCATOR, NODE>::adopt(
+                                   TreeNodePool<VALUE, ALLOCATOR, NODE>& other)
+{
+    BSLS_ASSERT_SAFE(allocator() == other.allocator());
+
+    d_pool.adopt(other.d_pool);
+}
+
+template <class VALUE, class ALLOCATOR, class NODE>
+inline
+void TreeNodePool<VALUE, ALLOCATOR, NODE>::adoptNode(bslalg::RbTreeNode *node)
 {
     BSLS_ASSERT(node);
 
-    TreeNode<VALUE> *treeNode = static_cast<TreeNode<VALUE> *>(node);
+    d_pool.adoptDetached(static_cast<NODE *>(node));
+}
+
+template <class VALUE, class ALLOCATOR, class NODE>
+inline
+void TreeNodePool<VALUE, ALLOCATOR, NODE>::deallocateNode(
+                                                      bslalg::RbTreeNode *node)
+{
+    BSLS_ASSERT(node);
+
+    d_pool.deallocate(static_cast<NODE *>(node));
+}
+
+template <class VALUE, class ALLOCATOR, class NODE>
+inline
+void TreeNodePool<VALUE, ALLOCATOR, NODE>::deleteNode(bslalg::RbTreeNode *node)
+{
+    BSLS_ASSERT(node);
+
+    NODE *treeNode = static_cast<NODE *>(node);
     AllocatorTraits::destroy(allocator(),
                              BSLS_UTIL_ADDRESSOF(treeNode->value()));
     d_pool.deallocate(treeNode);
 }
 
-template <class VALUE, class ALLOCATOR>
+template <class VALUE, class ALLOCATOR, class NODE>
 inline
-void TreeNodePool<VALUE, ALLOCATOR>::reserveNodes(size_type numNodes)
+void TreeNodePool<VALUE, ALLOCATOR, NODE>::reserveNodes(size_type numNodes)
 {
     BSLS_ASSERT_SAFE(0 < numNodes);
 
     d_pool.reserve(numNodes);
 }
 
-template <class VALUE, class ALLOCATOR>
+template <class VALUE, class ALLOCATOR, class NODE>
+template <class NODE_HANDLE>
+bslalg::RbTreeNode *
+TreeNodePool<VALUE, ALLOCATOR, NODE>::takeNode(NODE_HANDLE *handle,
+                                               bool         isSameAllocator)
+{
+    BSLS_ASSERT_SAFE(handle);
+    BSLS_ASSERT_SAFE(!handle->empty());
+
+    if (isSameAllocator && !d_pool.hasFreeBlocks()) {
+        adoptNode(handle->node());
+        return handle->releaseNode();                                 // RETURN
+    }
+
+    bslalg::RbTreeNode *node = createNodeByRelocation(
+                                          BSLS_UTIL_ADDRESSOF(handle->value()),
+                                          isSameAllocator);
+    handle->releaseValue();
+    return node;
+}
+
+template <class VALUE, class ALLOCATOR, class NODE>
 inline
-void TreeNodePool<VALUE, ALLOCATOR>::swap(
-                                         TreeNodePool<VALUE, ALLOCATOR>& other)
+void TreeNodePool<VALUE, ALLOCATOR, NODE>::swap(
+                                   TreeNodePool<VALUE, ALLOCATOR, NODE>& other)
 {
     BSLS_ASSERT_SAFE(allocator() == other.allocator());
 
@@ -417,10 +737,10 @@ void TreeNodePool<VALUE, ALLOCATOR>::swap(
 }
 
 // ACCESSORS
-template <class VALUE, class ALLOCATOR>
+template <class VALUE, class ALLOCATOR, class NODE>
 inline
-const typename SimplePool<TreeNode<VALUE>, ALLOCATOR>::AllocatorType&
-TreeNodePool<VALUE, ALLOCATOR>::allocator() const
+const typename SimplePool<NODE, ALLOCATOR>::AllocatorType&
+TreeNodePool<VALUE, ALLOCATOR, NODE>::allocator() const
 {
     return d_pool.allocator();
 }
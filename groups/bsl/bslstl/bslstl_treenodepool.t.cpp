@@ -2,9 +2,12 @@
 #include <bslstl_treenodepool.h>
 
 #include <bslstl_allocator.h>
+#include <bslstl_nodehandle.h>
+#include <bslstl_pair.h>
 
 #include <bslalg_rbtreenode.h>
 #include <bslalg_rbtreeanchor.h>
+#include <bslalg_rbtreecountednode.h>
 #include <bslalg_rbtreeutil.h>
 
 #include <bslma_allocator.h>
@@ -12,6 +15,9 @@
 #include <bslma_testallocatormonitor.h>
 #include <bslma_defaultallocatorguard.h>
 #include <bslma_default.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_nestedtraitdeclaration.h>
 
 #include <bsls_assert.h>
 #include <bsls_asserttest.h>
@@ -48,10 +54,17 @@ using namespace bslstl;
 // [ 2] explicit TreeNodePool(const ALLOCATOR& allocator);
 //
 // MANIPULATORS
+// [11] void adopt(TreeNodePool<VALUE, ALLOCATOR>& other);
 // [ 4] AllocatorType& allocator();
 // [ 2] bslalg::RbTreeNode *createNode();
 // [ 7] bslalg::RbTreeNode *createNode(const bslalg::RbTreeNode& original);
 // [ 7] bslalg::RbTreeNode *createNode(const VALUE& value);
+// [10] createNodePiecewise(const FIRST_ARG& first, ARGS&&... args);
+// [ 9] bslalg::RbTreeNode *createNodeByRelocation(VALUE *, bool);
+// [ 9] void deallocateNode(bslalg::RbTreeNode *node);
+// [ 9] bslalg::RbTreeNode *createDetachedNode(bslalg::RbTreeNode *);
+// [ 9] void adoptNode(bslalg::RbTreeNode *);
+// [ 9] bslalg::RbTreeNode *takeNode(NODE_HANDLE *, bool);
 // [ 5] void deleteNode(bslalg::RbTreeNode *node);
 // [ 6] void reserveNodes(std::size_t numNodes);
 // [ 8] void swap(TreeNodePool<VALUE, ALLOCATOR>& other);
@@ -60,6 +73,8 @@ using namespace bslstl;
 // [ 4] const AllocatorType& allocator() const;
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
+// [12] CONCERN: Node types having a different base class supported.
+// [13] USAGE EXAMPLE
 //-----------------------------------------------------------------------------
 //=============================================================================
 
@@ -192,6 +207,111 @@ struct UsesBslmaAllocator<AllocatingIntType> : bsl::true_type {};
 }
 }
 
+                            // ==================
+                            // class EmplacedType
+                            // ==================
+
+class EmplacedType {
+    // This allocator-aware test type records the number of 'int' arguments it
+    // was constructed from, the sum of those arguments, and the allocator it
+    // was supplied, and counts the objects created by copy construction.
+    // Constructing an object from a negative first argument throws that
+    // argument as an exception.
+
+    // CLASS DATA
+    static int        s_numCopies;    // number of copy-constructed objects
+
+    // DATA
+    int               d_numArgs;      // number of constructor arguments
+    int               d_sum;          // sum of constructor arguments
+    bslma::Allocator *d_allocator_p;  // allocator supplied (held)
+
+    // PRIVATE CLASS METHODS
+    static void throwIfNegative(int value)
+        // Throw the specified 'value' if it is negative and exceptions are
+        // enabled.
+    {
+#ifdef BDE_BUILD_TARGET_EXC
+        if (value < 0) {
+            throw value;
+        }
+#else
+        (void) value;
+#endif
+    }
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(EmplacedType, bslma::UsesBslmaAllocator);
+
+    // CLASS METHODS
+    static int numCopies()
+        // Return the number of 'EmplacedType' objects created by copy
+        // construction since the start of the program.
+    {
+        return s_numCopies;
+    }
+
+    // CREATORS
+    explicit EmplacedType(bslma::Allocator *basicAllocator = 0)
+    : d_numArgs(0)
+    , d_sum(0)
+    , d_allocator_p(bslma::Default::allocator(basicAllocator))
+    {
+    }
+
+    explicit EmplacedType(int a1, bslma::Allocator *basicAllocator = 0)
+    : d_numArgs(1)
+    , d_sum(a1)
+    , d_allocator_p(bslma::Default::allocator(basicAllocator))
+    {
+        throwIfNegative(a1);
+    }
+
+    EmplacedType(int a1, int a2, bslma::Allocator *basicAllocator = 0)
+    : d_numArgs(2)
+    , d_sum(a1 + a2)
+    , d_allocator_p(bslma::Default::allocator(basicAllocator))
+    {
+        throwIfNegative(a1);
+    }
+
+    EmplacedType(int               a1,
+                 int               a2,
+                 int               a3,
+                 bslma::Allocator *basicAllocator = 0)
+    : d_numArgs(3)
+    , d_sum(a1 + a2 + a3)
+    , d_allocator_p(bslma::Default::allocator(basicAllocator))
+    {
+        throwIfNegative(a1);
+    }
+
+    EmplacedType(const EmplacedType&  original,
+                 bslma::Allocator    *basicAllocator = 0)
+    : d_numArgs(original.d_numArgs)
+    , d_sum(original.d_sum)
+    , d_allocator_p(bslma::Default::allocator(basicAllocator))
+    {
+        ++s_numCopies;
+    }
+
+    // MANIPULATORS
+    EmplacedType& operator=(const EmplacedType& rhs)
+    {
+        d_numArgs = rhs.d_numArgs;
+        d_sum     = rhs.d_sum;
+        return *this;
+    }
+
+    // ACCESSORS
+    bslma::Allocator *allocator() const { return d_allocator_p; }
+    int numArgs() const                 { return d_numArgs; }
+    int sum() const                     { return d_sum; }
+};
+
+int EmplacedType::s_numCopies = 0;
+
 //=============================================================================
 //                               TEST FACILITIES
 //-----------------------------------------------------------------------------
@@ -277,12 +397,21 @@ class TestDriver {
 
   public:
     // TEST CASES
-    // static void testCase10();
+    // static void testCase14();
         // Reserved for BSLX.
 
-    static void testCase9();
+    // static void testCase13();
         // Test usage example.
 
+    static void testCase11();
+        // Test 'adopt'.
+
+    static void testCase10();
+        // Test 'createNodePiecewise'.
+
+    static void testCase9();
+        // Test 'createNodeByRelocation' and 'deallocateNode'.
+
     static void testCase8();
         // Test 'swap' member.
 
@@ -361,6 +490,491 @@ void TestDriver<VALUE>::createFreeBlocks(Obj   *result,
     }
 }
 
+template<class VALUE>
+void TestDriver<VALUE>::testCase11()
+{
+    // --------------------------------------------------------------------
+    // MANIPULATOR 'adopt'
+    //
+    // Concerns:
+    //: 1 The nodes created by the adopted object can be deleted by the
+    //:   adopting object, also after the adopted object is destroyed.
+    //:
+    //: 2 The memory reserved by the adopted object is used by the adopting
+    //:   object to create nodes.
+    //:
+    //: 3 No memory is allocated or deallocated by 'adopt'.
+    //:
+    //: 4 All the memory of both objects is released when the adopting object
+    //:   is destroyed.
+    //:
+    //: 5 QoI: Asserted precondition violations are detected when enabled.
+    //
+    // Plan:
+    //: 1 Using a table-based approach:
+    //:
+    //:   1 Create two objects whose nodes have been created and deleted
+    //:     various number of times.
+    //:
+    //:   2 Make the first object adopt the second one, and verify that no
+    //:     memory is allocated or deallocated.  (C-3)
+    //:
+    //:   3 Create nodes from the first object, and verify that the first ones
+    //:     reuse the nodes deleted by the second object.  (C-2)
+    //:
+    //:   4 Destroy the second object, and delete all the nodes, including
+    //:     those created by the second object, with the first object.  (C-1)
+    //:
+    //:   5 Destroy the first object, and verify that no memory is in use.
+    //:     (C-4)
+    //:
+    //: 2 Verify that, in appropriate build modes, defensive checks are
+    //:   triggered (using the 'BSLS_ASSERTTEST_*' macros).  (C-5)
+    //
+    // Testing:
+    //   void adopt(TreeNodePool<VALUE, ALLOCATOR>& other);
+    // --------------------------------------------------------------------
+
+    if (verbose) printf("\nMANIPULATOR 'adopt'"
+                        "\n===================\n");
+
+    bslma::TestAllocator         da("default", veryVeryVeryVerbose);
+    bslma::DefaultAllocatorGuard dag(&da);
+
+    struct {
+        int d_line;
+        int d_numAlloc;
+        int d_numDealloc;
+    } DATA[] = {
+
+    //LINE  ALLOC  DEALLOC
+    //----  -----  -------
+
+    { L_,       0,       0 },
+    { L_,       1,       0 },
+    { L_,       1,       1 },
+    { L_,       3,       1 },
+    { L_,       4,       4 },
+    { L_,      20,       5 }
+
+    };
+    int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+    for (int ti = 0; ti < NUM_DATA; ++ti) {
+        const int LINE1     = DATA[ti].d_line;
+        const int ALLOCS1   = DATA[ti].d_numAlloc;
+        const int DEALLOCS1 = DATA[ti].d_numDealloc;
+
+        for (int tj = 0; tj < NUM_DATA; ++tj) {
+            const int LINE2     = DATA[tj].d_line;
+            const int ALLOCS2   = DATA[tj].d_numAlloc;
+            const int DEALLOCS2 = DATA[tj].d_numDealloc;
+
+            if (veryVerbose) { T_ P_(LINE1) P(LINE2) }
+
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+            {
+                Stack usedX;
+                Stack freeX;
+                Obj mX(&oa);
+                init(&mX, &usedX, &freeX, ALLOCS1, DEALLOCS1);
+
+                Stack usedY;
+                Stack freeY;
+                {
+                    Obj mY(&oa);
+                    init(&mY, &usedY, &freeY, ALLOCS2, DEALLOCS2);
+
+                    bslma::TestAllocatorMonitor oam(&oa);
+
+                    mX.adopt(mY);
+
+                    ASSERTV(LINE1, LINE2, oam.isTotalSame());
+                    ASSERTV(LINE1, LINE2, oam.isInUseSame());
+
+                    while (!freeY.empty()) {
+                        RbNode *ptr = mX.createNode();
+                        ASSERTV(LINE1, LINE2, freeY.back() == ptr);
+                        freeY.pop();
+                        usedX.push(ptr);
+                    }
+                }
+
+                while (!usedY.empty()) {
+                    mX.deleteNode(usedY.back());
+                    usedY.pop();
+                }
+                while (!usedX.empty()) {
+                    mX.deleteNode(usedX.back());
+                    usedX.pop();
+                }
+            }
+
+            ASSERTV(LINE1, LINE2, oa.numBlocksInUse(),
+                    0 == oa.numBlocksInUse());
+        }
+    }
+
+    // Verify no memory is allocated from the default allocator.
+
+    ASSERTV(da.numBlocksTotal(), 0 == da.numBlocksTotal());
+
+    if (verbose) printf("\nNegative Testing.\n");
+    {
+        bsls::AssertFailureHandlerGuard hG(bsls::AssertTest::failTestDriver);
+
+        bslma::TestAllocator oa1("object1", veryVeryVeryVerbose);
+        bslma::TestAllocator oa2("object2", veryVeryVeryVerbose);
+
+        Obj mA(&oa1);  Obj mB(&oa1);
+        Obj mZ(&oa2);
+
+        ASSERT_SAFE_PASS(mA.adopt(mB));
+        ASSERT_SAFE_FAIL(mA.adopt(mZ));
+    }
+}
+
+template<class VALUE>
+void TestDriver<VALUE>::testCase10()
+{
+    // --------------------------------------------------------------------
+    // MANIPULATOR 'createNodePiecewise'
+    //
+    // Concerns:
+    //: 1 The 'first' member of the new node value is copy-constructed from
+    //:   the first argument, and its 'second' member is constructed from the
+    //:   remaining arguments (or value-initialized if there are none).
+    //:
+    //: 2 Both members are supplied with the allocator of the pool, and no
+    //:   memory is allocated from the default allocator.
+    //:
+    //: 3 No temporary value is created: the 'second' member is never
+    //:   copy-constructed.
+    //:
+    //: 4 If constructing the 'second' member throws, the 'first' member is
+    //:   destroyed, the node is returned to the pool, and no memory is
+    //:   leaked.
+    //
+    // Plan:
+    //: 1 Using a pool of 'bsl::pair<const VALUE, EmplacedType>', create a
+    //:   node with each number of mapped arguments, and verify the members of
+    //:   its value, the allocators they hold, and the number of copies of
+    //:   'EmplacedType' made.  (C-1..3)
+    //:
+    //: 2 Supply a negative first mapped argument, so that the constructor of
+    //:   'EmplacedType' throws, and verify that the memory in use is
+    //:   unchanged.  (C-4)
+    //
+    // Testing:
+    //   createNodePiecewise(const FIRST_ARG& first, ARGS&&... args);
+    // --------------------------------------------------------------------
+
+    if (verbose) printf("\nMANIPULATOR 'createNodePiecewise'"
+                        "\n=================================\n");
+
+    typedef bsl::pair<const VALUE, EmplacedType>                      PairType;
+    typedef bslstl::TreeNodePool<PairType, bsl::allocator<PairType> > PairPool;
+    typedef bslstl::TreeNode<PairType>                                PairNode;
+
+    const int TYPE_ALLOC = bslma::UsesBslmaAllocator<VALUE>::value;
+
+    const int NUM_VALUES = 4;
+
+    bslma::TestAllocator da("default", veryVeryVeryVerbose);
+    bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+
+    bslma::DefaultAllocatorGuard dag(&da);
+
+    {
+        bsltf::TestValuesArray<VALUE> VALUES;
+
+        PairPool mX(&oa);
+        mX.reserveNodes(NUM_VALUES + 1);
+
+        Stack used;
+
+        for (int numArgs = 0; numArgs < NUM_VALUES; ++numArgs) {
+            const VALUE& K = VALUES[numArgs];
+
+            const int NUM_COPIES = EmplacedType::numCopies();
+
+            bslma::TestAllocatorMonitor oam(&oa);
+
+            RbNode *node = 0;
+            switch (numArgs) {
+              case 0: node = mX.createNodePiecewise(K);          break;
+              case 1: node = mX.createNodePiecewise(K, 1);       break;
+              case 2: node = mX.createNodePiecewise(K, 1, 2);    break;
+              case 3: node = mX.createNodePiecewise(K, 1, 2, 3); break;
+            }
+
+            const PairType& P = static_cast<PairNode *>(node)->value();
+
+            ASSERTV(numArgs, K       == P.first);
+            ASSERTV(numArgs, numArgs == P.second.numArgs());
+            ASSERTV(numArgs, P.second.sum(),
+                    numArgs * (numArgs + 1) / 2 == P.second.sum());
+            ASSERTV(numArgs, &oa     == P.second.allocator());
+            ASSERTV(numArgs, TYPE_ALLOC == oam.numBlocksInUseChange());
+            ASSERTV(numArgs, NUM_COPIES == EmplacedType::numCopies());
+
+            used.push(node);
+        }
+
+#ifdef BDE_BUILD_TARGET_EXC
+        {
+            bslma::TestAllocatorMonitor oam(&oa);
+
+            bool caught = false;
+            try {
+                mX.createNodePiecewise(VALUES[NUM_VALUES], -1, 2);
+            }
+            catch (int) {
+                caught = true;
+            }
+            ASSERT(caught);
+            ASSERT(oam.isInUseSame());
+
+            // The node is returned to the pool and reused.
+
+            used.push(mX.createNodePiecewise(VALUES[NUM_VALUES], 1));
+            ASSERTV(oam.numBlocksTotalChange(),
+                    2 * TYPE_ALLOC == oam.numBlocksTotalChange());
+        }
+#endif
+
+        while (!used.empty()) {
+            mX.deleteNode(used.back());
+            used.pop();
+        }
+    }
+
+    // Verify all memory is released on object destruction.
+
+    ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+    ASSERTV(da.numBlocksTotal(), 0 == da.numBlocksTotal());
+}
+
+template<class VALUE>
+void TestDriver<VALUE>::testCase9()
+{
+    // --------------------------------------------------------------------
+    // MANIPULATORS 'createNodeByRelocation' and 'deallocateNode'
+    //
+    // Concerns:
+    //: 1 'createNodeByRelocation' creates a node holding the value of the
+    //:   original object, and ends the lifetime of the original.
+    //:
+    //: 2 If 'VALUE' is bitwise moveable and 'isSameAllocator' is 'true', the
+    //:   value is relocated without allocating or deallocating memory.
+    //:
+    //: 3 Otherwise, the value is copied using the allocator of the pool, and
+    //:   the memory of the original object is released.
+    //:
+    //: 4 'deallocateNode' returns a node to the pool without destroying its
+    //:   value.
+    //:
+    //: 5 No memory is leaked, and every value is destroyed once.
+    //:
+    //: 6 'createDetachedNode' relocates the value of a node into a new node,
+    //:   allocated in a single block, that remains valid after its pool is
+    //:   destroyed.
+    //:
+    //: 7 A detached node can be adopted by another pool, by 'adoptNode' or by
+    //:   'takeNode' (if 'isSameAllocator' and the pool has no free node),
+    //:   without allocating memory and without moving its value, and is then
+    //:   deleted by that pool, and deallocated when that pool is destroyed.
+    //:
+    //: 8 'takeNode' relocates the value into a node of the pool, reusing a
+    //:   free node if any, if 'isSameAllocator' is 'false' or the pool has a
+    //:   free node, and deallocates the detached node.
+    //
+    // Plan:
+    //: 1 Create nodes in a pool, and relocate the value of each node into a
+    //:   node of the same pool (reserved beforehand), and into a node of a
+    //:   pool using another allocator, then deallocate the original node
+    //:   with 'deallocateNode'.  Verify the values of the new nodes and,
+    //:   using test allocator monitors, the memory allocated.  (C-1..4)
+    //:
+    //: 2 Delete the remaining nodes, and verify that no memory is in use.
+    //:   (C-5)
+    //:
+    //: 3 Detach the value of a node into a 'bslstl::NodeHandle', destroy the
+    //:   pool, and insert the node into another pool with 'takeNode'.
+    //:   Verify the address of the node and of its value, and the memory
+    //:   allocated.  Repeat with 'adoptNode', with a pool having free
+    //:   nodes, and with a pool using another allocator.  (C-6..8)
+    //
+    // Testing:
+    //   bslalg::RbTreeNode *createNodeByRelocation(VALUE *, bool);
+    //   void deallocateNode(bslalg::RbTreeNode *node);
+    //   bslalg::RbTreeNode *createDetachedNode(bslalg::RbTreeNode *);
+    //   void adoptNode(bslalg::RbTreeNode *);
+    //   bslalg::RbTreeNode *takeNode(NODE_HANDLE *, bool);
+    // --------------------------------------------------------------------
+
+    if (verbose) printf("\nMANIPULATOR 'createNodeByRelocation'"
+                        "\n====================================\n");
+
+    const int TYPE_ALLOC = bslma::UsesBslmaAllocator<VALUE>::value;
+    const int TYPE_MOVE  = bslmf::IsBitwiseMoveable<VALUE>::value;
+
+    const int NUM_VALUES = 16;
+
+    bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+    bslma::TestAllocator za("other",  veryVeryVeryVerbose);
+
+    {
+        bsltf::TestValuesArray<VALUE> VALUES;
+
+        Obj mX(&oa);
+        Obj mY(&za);
+
+        Stack usedX;
+        Stack usedY;
+
+        for (int i = 0; i < NUM_VALUES; ++i) {
+            usedX.push(mX.createNode(VALUES[i]));
+        }
+        mX.reserveNodes(NUM_VALUES);
+        mY.reserveNodes(NUM_VALUES);
+
+        for (int i = 0; i < NUM_VALUES; ++i) {
+            ValueNode *original = static_cast<ValueNode *>(usedX[i]);
+
+            bslma::TestAllocatorMonitor oam(&oa);
+
+            ValueNode *node = static_cast<ValueNode *>(
+                   mX.createNodeByRelocation(&original->value(), true));
+            mX.deallocateNode(original);
+
+            ASSERTV(i, VALUES[i] == node->value());
+            ASSERTV(i, oam.isInUseSame());
+            ASSERTV(i, oam.numBlocksTotalChange(),
+                    (TYPE_MOVE ? 0 : TYPE_ALLOC) ==
+                                                  oam.numBlocksTotalChange());
+
+            usedX.push(node);
+        }
+
+        for (int i = NUM_VALUES; i < 2 * NUM_VALUES; ++i) {
+            ValueNode *original = static_cast<ValueNode *>(usedX[i]);
+
+            bslma::TestAllocatorMonitor oam(&oa);
+            bslma::TestAllocatorMonitor zam(&za);
+
+            ValueNode *node = static_cast<ValueNode *>(
+                   mY.createNodeByRelocation(&original->value(), false));
+            mX.deallocateNode(original);
+
+            ASSERTV(i, VALUES[i - NUM_VALUES] == node->value());
+            ASSERTV(i, -TYPE_ALLOC == oam.numBlocksInUseChange());
+            ASSERTV(i,  TYPE_ALLOC == zam.numBlocksInUseChange());
+
+            usedY.push(node);
+        }
+
+        while (!usedY.empty()) {
+            mY.deleteNode(usedY.back());
+            usedY.pop();
+        }
+    }
+
+    // Verify all memory is released on object destruction.
+
+    ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+    ASSERTV(za.numBlocksInUse(), 0 == za.numBlocksInUse());
+
+    if (verbose) printf("\nMANIPULATORS 'createDetachedNode', 'adoptNode',"
+                        " and 'takeNode'\n");
+    {
+        typedef bsl::allocator<VALUE>                          Allocator;
+        typedef bslstl::NodeHandle<VALUE, ValueNode, Allocator> Handle;
+
+        bsltf::TestValuesArray<VALUE> VALUES;
+
+        Obj  mW(&oa);
+        Obj  mZ(&za);
+        Obj *mX = new (oa) Obj(&oa);
+
+        bslalg::RbTreeNode *original = mX->createNode(VALUES[0]);
+
+        bslma::TestAllocatorMonitor oam(&oa);
+
+        ValueNode *node = static_cast<ValueNode *>(
+                                           mX->createDetachedNode(original));
+        ASSERT(1 == oam.numBlocksInUseChange());
+        ASSERT(VALUES[0] == node->value());
+        mX->deallocateNode(original);
+
+        const VALUE *address = &node->value();
+
+        Handle handle;
+        handle.adoptNode(node, Allocator(&oa));
+
+        oa.deleteObject(mX);
+        ASSERT(VALUES[0] == handle.value());
+        ASSERT(address == &handle.value());
+
+        oam.reset();
+
+        ASSERT(node == mW.takeNode(&handle, true));
+        ASSERT(handle.empty());
+        ASSERT(address == &node->value());
+        ASSERT(VALUES[0] == node->value());
+        ASSERT(oam.isTotalSame());
+        ASSERT(oam.isInUseSame());
+
+        bslalg::RbTreeNode *other   = mW.createNode(VALUES[1]);
+        bslalg::RbTreeNode *adopted = mW.createDetachedNode(other);
+        mW.deallocateNode(other);
+        ASSERT(oam.isInUseUp());
+
+        oam.reset();
+
+        mW.adoptNode(adopted);
+        ASSERT(oam.isTotalSame());
+        ASSERT(oam.isInUseSame());
+
+        mW.deleteNode(adopted);
+
+        // 'mW' now has free nodes, one of which 'takeNode' reuses instead of
+        // adopting the node of the handle.
+
+        bslalg::RbTreeNode *detached = mW.createDetachedNode(node);
+        mW.deallocateNode(node);
+        handle.adoptNode(static_cast<ValueNode *>(detached), Allocator(&oa));
+
+        oam.reset();
+
+        node = static_cast<ValueNode *>(mW.takeNode(&handle, true));
+        ASSERT(handle.empty());
+        ASSERT(detached != node);
+        ASSERT(VALUES[0] == node->value());
+        ASSERTV(oam.numBlocksInUseChange(), -1 == oam.numBlocksInUseChange());
+
+        // Detach the value again, and relocate it into a pool using another
+        // allocator.
+
+        detached = mW.createDetachedNode(node);
+        mW.deallocateNode(node);
+        handle.adoptNode(static_cast<ValueNode *>(detached), Allocator(&oa));
+
+        bslma::TestAllocatorMonitor zam(&za);
+
+        ValueNode *copy = static_cast<ValueNode *>(
+                                                mZ.takeNode(&handle, false));
+        ASSERT(handle.empty());
+        ASSERT(detached != copy);
+        ASSERT(VALUES[0] == copy->value());
+        ASSERT(zam.isTotalUp());
+
+        mZ.deleteNode(copy);
+    }
+    ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+    ASSERTV(za.numBlocksInUse(), 0 == za.numBlocksInUse());
+}
+
 template<class VALUE>
 void TestDriver<VALUE>::testCase8()
 {
@@ -1309,7 +1923,7 @@ int main(int argc, char *argv[])
     printf("TEST " __FILE__ " CASE %d\n", test);
 
     switch (test) { case 0:
-      case 9: {
+      case 13: {
         if (verbose) printf("\nUSAGE EXAMPLE"
                             "\n=============\n");
 
@@ -1344,6 +1958,90 @@ int main(int argc, char *argv[])
     ASSERT(0 <  objectAllocator.numBytesInUse());
 //..
       } break;
+      case 12: {
+        // --------------------------------------------------------------------
+        // CUSTOM NODE TYPE
+        //
+        // Concerns:
+        //: 1 A pool may be instantiated with a 'NODE' type that is a
+        //:   'TreeNode' having a base class other than 'bslalg::RbTreeNode'.
+        //:
+        //: 2 Each node supplied by such a pool is large enough to hold a
+        //:   'NODE', and the additional attributes of 'NODE' are usable.
+        //:
+        //: 3 'createNode' constructs, and 'deleteNode' destroys, the 'value'
+        //:   attribute of such a node, using the allocator supplied at
+        //:   construction.
+        //
+        // Plan:
+        //: 1 Create a pool of 'TreeNode<VALUE, bslalg::RbTreeCountedNode>'
+        //:   nodes holding an allocating type.  Create a node, copy it, and
+        //:   set and observe the subtree size of each.  Delete the nodes, and
+        //:   verify that the memory allocated for the values is released.
+        //:   (C-1..3)
+        //
+        // Testing:
+        //   CONCERN: Node types having a different base class supported.
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCUSTOM NODE TYPE"
+                            "\n================\n");
+
+        typedef bsltf::AllocTestType                                ValueType;
+        typedef TreeNode<ValueType, bslalg::RbTreeCountedNode>      Node;
+        typedef TreeNodePool<ValueType, bsl::allocator<Node>, Node> Obj;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+        bslma::TestAllocator da("default", veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        {
+            const ValueType VALUE(5, &sa);
+
+            Obj mX(&oa);
+
+            Node *node = static_cast<Node *>(mX.createNode(VALUE));
+            node->setSubtreeSize(17);
+
+            const bsls::Types::Int64 BLOCKS = oa.numBlocksInUse();
+
+            Node *copy = static_cast<Node *>(mX.createNode(*node));
+            copy->setSubtreeSize(node->subtreeSize() + 1);
+
+            ASSERTV(oa.numBlocksInUse(), BLOCKS < oa.numBlocksInUse());
+
+            ASSERTV(node->value().data(),     5 == node->value().data());
+            ASSERTV(copy->value().data(),     5 == copy->value().data());
+            ASSERTV(node->subtreeSize(),     17 == node->subtreeSize());
+            ASSERTV(copy->subtreeSize(),     18 == copy->subtreeSize());
+            ASSERTV(&oa == copy->value().allocator());
+
+            const char *nodeAddress = reinterpret_cast<const char *>(node);
+            const char *copyAddress = reinterpret_cast<const char *>(copy);
+            ASSERTV(copyAddress + sizeof(Node) <= nodeAddress
+                 || nodeAddress + sizeof(Node) <= copyAddress);
+
+            mX.deleteNode(copy);
+            mX.deleteNode(node);
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+        ASSERTV(da.numBlocksTotal(), 0 == da.numBlocksTotal());
+      } break;
+      case 11: {
+        TestDriver<bsltf::AllocTestType>::testCase11();
+        TestDriver<bsltf::SimpleTestType>::testCase11();
+      } break;
+      case 10: {
+        TestDriver<bsltf::AllocTestType>::testCase10();
+        TestDriver<bsltf::AllocBitwiseMoveableTestType>::testCase10();
+        TestDriver<bsltf::SimpleTestType>::testCase10();
+      } break;
+      case 9: {
+        TestDriver<bsltf::AllocTestType>::testCase9();
+        TestDriver<bsltf::AllocBitwiseMoveableTestType>::testCase9();
+        TestDriver<bsltf::SimpleTestType>::testCase9();
+      } break;
       case 8: {
         TestDriver<bsltf::AllocTestType>::testCase8();
       } break;
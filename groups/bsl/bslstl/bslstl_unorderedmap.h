@@ -296,6 +296,20 @@ BSLS_IDENT("$Id: $")
 // adapting the existing default hash functions for primitive types, an
 // approach that may not always prove adequate.
 //
+///Heterogeneous Lookup
+///--------------------
+// If both the 'HASH' and 'EQUAL' template parameters are transparent (i.e.,
+// each declares a nested type named 'is_transparent'), the 'find', 'count',
+// 'equal_range', and 'contains' methods of 'unordered_map' accept a key of
+// any type that the two functors accept, which is passed to them without
+// first being converted to 'key_type'.  This allows, for example, an
+// 'unordered_map' having 'bsl::string' keys, 'bsl::hash<bsl::string>' (which
+// is transparent), and 'bsl::equal_to<>' to be searched using a 'const char *'
+// or a 'bslstl::StringRef' without creating (and perhaps allocating memory
+// for) a temporary 'bsl::string'.  The behavior is undefined unless 'HASH'
+// returns the same value for such a key as for every equivalent 'key_type'
+// value.
+//
 ///Usage
 ///-----
 // In this section we show intended use of this component.
@@ -879,6 +893,10 @@ BSL_OVERRIDES_STD mode"
 #include <bslstl_iteratorutil.h>
 #endif
 
+#ifndef INCLUDED_BSLSTL_NODEHANDLE
+#include <bslstl_nodehandle.h>
+#endif
+
 #ifndef INCLUDED_BSLSTL_PAIR
 #include <bslstl_pair.h>
 #endif
@@ -903,10 +921,18 @@ BSL_OVERRIDES_STD mode"
 #include <bslma_usesbslmaallocator.h>
 #endif
 
+#ifndef INCLUDED_BSLMF_ENABLEIF
+#include <bslmf_enableif.h>
+#endif
+
 #ifndef INCLUDED_BSLMF_ISBITWISEMOVEABLE
 #include <bslmf_isbitwisemoveable.h>
 #endif
 
+#ifndef INCLUDED_BSLMF_ISTRANSPARENTPREDICATE
+#include <bslmf_istransparentpredicate.h>
+#endif
+
 #ifndef INCLUDED_BSLMF_NESTEDTRAITDECLARATION
 #include <bslmf_nestedtraitdeclaration.h>
 #endif
@@ -915,6 +941,10 @@ BSL_OVERRIDES_STD mode"
 #include <bsls_assert.h>
 #endif
 
+#ifndef INCLUDED_BSLS_COMPILERFEATURES
+#include <bsls_compilerfeatures.h>
+#endif
+
 #ifndef INCLUDED_CSTDDEF
 #include <cstddef>  // for 'std::size_t'
 #define INCLUDED_CSTDDEF
@@ -1017,6 +1047,8 @@ class unordered_map {
     typedef BloombergLP::bslstl::HashTableBucketIterator<
                        const value_type, difference_type> const_local_iterator;
 
+    typedef typename HashTable::NodeHandleType                      node_type;
+
   private:
     // DATA
     HashTable d_impl;  // underlying hash table used by this unordered map
@@ -1135,10 +1167,11 @@ class unordered_map {
         // associated with the specified 'key' in this unordered map; if this
         // unordered map does not already contain a 'value_type' object with
         // 'key', first insert a new 'value_type' object having 'key' and a
-        // default-constructed 'VALUE' object.  This method requires that the
-        // (template parameter) type 'KEY' is "copy-constructible" and the
-        // (template parameter) 'VALUE' is "default-constructible" (see
-        // {Requirements on 'KEY' and 'VALUE'}).
+        // value-initialized 'VALUE' object, constructed in place as if by
+        // 'try_emplace(key)'.  This method requires that the (template
+        // parameter) type 'KEY' is "copy-constructible" and the (template
+        // parameter) 'VALUE' is "default-constructible" (see {Requirements on
+        // 'KEY' and 'VALUE'}).
 
     mapped_type& at(const key_type& key);
         // Return a reference providing modifiable access to the mapped-value
@@ -1206,6 +1239,26 @@ class unordered_map {
         // object in this unordered map having the specified 'key', if such an
         // entry exists, and the past-the-end iterator ('end') otherwise.
 
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<HASH, LOOKUP_KEY>::value
+     && BloombergLP::bslmf::IsTransparentPredicate<EQUAL, LOOKUP_KEY>::value,
+        iterator>::type
+    find(const LOOKUP_KEY& key)
+        // Return an iterator providing modifiable access to the 'value_type'
+        // object in this unordered map having a key equivalent to the
+        // specified 'key', if such an entry exists, and the past-the-end
+        // iterator ('end') otherwise.  This overload participates in overload
+        // resolution only if both 'HASH' and 'EQUAL' are transparent (i.e.,
+        // declare the nested type 'is_transparent'), in which case 'key' is
+        // passed, without conversion to 'key_type', to the hasher and
+        // comparator of this unordered map.  The behavior is undefined unless
+        // 'HASH' returns the same value for 'key' as for every 'key_type'
+        // value that 'EQUAL' considers equivalent to 'key'.
+    {
+        return iterator(d_impl.findTransparent(key));
+    }
+
     template <class SOURCE_TYPE>
     pair<iterator, bool> insert(const SOURCE_TYPE& value);
         // Insert the specified 'value' into this unordered map if the key (the
@@ -1259,6 +1312,30 @@ class unordered_map {
         // value, 'end()'.  Note that since an unordered map maintains unique
         // keys, the range will contain at most one element.
 
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<HASH, LOOKUP_KEY>::value
+     && BloombergLP::bslmf::IsTransparentPredicate<EQUAL, LOOKUP_KEY>::value,
+        pair<iterator, iterator> >::type
+    equal_range(const LOOKUP_KEY& key)
+        // Return a pair of iterators providing modifiable access to the
+        // sequence of 'value_type' objects in this unordered map having a key
+        // equivalent to the specified 'key', where the first iterator is
+        // positioned at the start of the sequence, and the second is
+        // positioned one past the end of the sequence.  If this unordered map
+        // contains no such 'value_type' object, then the two returned
+        // iterators will have the same value, 'end()'.  This overload
+        // participates in overload resolution only if both 'HASH' and 'EQUAL'
+        // are transparent (see 'find').
+    {
+        typedef bsl::pair<iterator, iterator> ResultType;
+
+        HashTableLink *first = d_impl.findTransparent(key);
+        return first
+             ? ResultType(iterator(first), iterator(first->nextLink()))
+             : ResultType(end(), end());
+    }
+
     void max_load_factor(float newMaxLoadFactor);
         // Set the maximum load factor of this unordered map to the specified
         // 'newMaxLoadFactor'.  If 'newMaxLoadFactor < loadFactor()', this
@@ -1268,6 +1345,162 @@ class unordered_map {
         // allow this operation to rehash, as it requires a constant cost for
         // all (positive) values of 'newMaxLoadFactor'.
 
+    bsl::pair<iterator, bool> try_emplace(const key_type& key);
+
+    template <class ARG_1>
+    bsl::pair<iterator, bool> try_emplace(
+                                const key_type&                          key,
+                                BSLS_COMPILERFEATURES_FORWARD_REF(ARG_1) arg1);
+
+    template <class ARG_1, class ARG_2>
+    bsl::pair<iterator, bool> try_emplace(
+                                const key_type&                          key,
+                                BSLS_COMPILERFEATURES_FORWARD_REF(ARG_1) arg1,
+                                BSLS_COMPILERFEATURES_FORWARD_REF(ARG_2) arg2);
+
+    template <class ARG_1, class ARG_2, class ARG_3>
+    bsl::pair<iterator, bool> try_emplace(
+                                const key_type&                          key,
+                                BSLS_COMPILERFEATURES_FORWARD_REF(ARG_1) arg1,
+                                BSLS_COMPILERFEATURES_FORWARD_REF(ARG_2) arg2,
+                                BSLS_COMPILERFEATURES_FORWARD_REF(ARG_3) arg3);
+        // Insert into this unordered map a newly created 'value_type' object
+        // whose key is a copy of the specified 'key' and whose mapped value is
+        // constructed in place from the optionally specified 'arg1', 'arg2',
+        // and 'arg3' (or value-initialized if no such arguments are supplied),
+        // if 'key' does not already exist in this unordered map; otherwise,
+        // this method has no effect, and in particular constructs no mapped
+        // value and allocates no memory.  Return a pair whose 'first' member
+        // is an iterator referring to the (possibly newly inserted)
+        // 'value_type' object in this unordered map whose key is the same as
+        // 'key', and whose 'second' member is 'true' if a new value was
+        // inserted, and 'false' if the key was already present.  Both the key
+        // and the mapped value are constructed using the allocator of this
+        // unordered map (if they use one), and no temporary 'value_type'
+        // object is created.  This method requires that the (template
+        // parameter) type 'KEY' be "copy-constructible" (see {Requirements on
+        // 'KEY' and 'VALUE'}), and that 'VALUE' be constructible from the
+        // supplied arguments.
+
+    iterator try_emplace(const_iterator hint, const key_type& key);
+
+    template <class ARG_1>
+    iterator try_emplace(
+                                const_iterator                           hint,
+                                const key_type&                          key,
+                                BSLS_COMPILERFEATURES_FORWARD_REF(ARG_1) arg1);
+
+    template <class ARG_1, class ARG_2>
+    iterator try_emplace(
+                                const_iterator                           hint,
+                                const key_type&                          key,
+                                BSLS_COMPILERFEATURES_FORWARD_REF(ARG_1) arg1,
+                                BSLS_COMPILERFEATURES_FORWARD_REF(ARG_2) arg2);
+
+    template <class ARG_1, class ARG_2, class ARG_3>
+    iterator try_emplace(
+                                const_iterator                           hint,
+                                const key_type&                          key,
+                                BSLS_COMPILERFEATURES_FORWARD_REF(ARG_1) arg1,
+                                BSLS_COMPILERFEATURES_FORWARD_REF(ARG_2) arg2,
+                                BSLS_COMPILERFEATURES_FORWARD_REF(ARG_3) arg3);
+        // Insert into this unordered map a newly created 'value_type' object
+        // whose key is a copy of the specified 'key' and whose mapped value is
+        // constructed in place from the optionally specified 'arg1', 'arg2',
+        // and 'arg3' (or value-initialized if no such arguments are supplied),
+        // if 'key' does not already exist in this unordered map; otherwise,
+        // this method has no effect, and in particular constructs no mapped
+        // value and allocates no memory.  Return an iterator referring to the
+        // (possibly newly inserted) 'value_type' object in this unordered map
+        // whose key is the same as 'key'.  The behavior is undefined unless
+        // the specified 'hint' is a valid iterator into this unordered map.
+        // Note that 'hint' is not used by this method.
+
+    template <class OBJECT>
+    bsl::pair<iterator, bool> insert_or_assign(
+                                const key_type&                           key,
+                                BSLS_COMPILERFEATURES_FORWARD_REF(OBJECT) obj);
+        // Assign the specified 'obj' to the mapped value of the 'value_type'
+        // object in this unordered map having the specified 'key', if such an
+        // object exists; otherwise, insert a newly created 'value_type' object
+        // whose key is a copy of 'key' and whose mapped value is constructed
+        // in place from 'obj'.  Return a pair whose 'first' member is an
+        // iterator referring to the 'value_type' object in this unordered map
+        // whose key is the same as 'key', and whose 'second' member is 'true'
+        // if a new value was inserted, and 'false' if an existing mapped value
+        // was assigned.  No temporary 'value_type' object is created.  This
+        // method requires that 'VALUE' be both constructible and assignable
+        // from 'obj'.
+
+    template <class OBJECT>
+    iterator insert_or_assign(
+                                const_iterator                            hint,
+                                const key_type&                           key,
+                                BSLS_COMPILERFEATURES_FORWARD_REF(OBJECT) obj);
+        // Assign the specified 'obj' to the mapped value of the 'value_type'
+        // object in this unordered map having the specified 'key', if such an
+        // object exists; otherwise, insert a newly created 'value_type' object
+        // whose key is a copy of 'key' and whose mapped value is constructed
+        // in place from 'obj'.  Return an iterator referring to the
+        // 'value_type' object in this unordered map whose key is the same as
+        // 'key'.  The behavior is undefined unless the specified 'hint' is a
+        // valid iterator into this unordered map.  This method requires that
+        // 'VALUE' be both constructible and assignable from 'obj'.  Note that
+        // 'hint' is not used by this method.
+
+    node_type extract(const_iterator position);
+        // Remove from this unordered map the 'value_type' object at the
+        // specified 'position', and return a node handle holding that object
+        // (see {'bslstl_nodehandle'}).  The behavior is undefined unless
+        // 'position' refers to a 'value_type' object in this unordered map.
+        // If an exception is thrown, this unordered map is unchanged.  Note
+        // that the object is relocated into a detached node owned by the node
+        // handle (see {'bslstl_nodehandle'|Node Ownership}), without being
+        // copied if 'value_type' is bitwise moveable, and that the node
+        // holding it in this unordered map is kept for reuse.
+
+    node_type extract(const key_type& key);
+        // Remove from this unordered map the 'value_type' object having the
+        // specified 'key', if it exists, and return a node handle holding that
+        // object; otherwise return an empty node handle with no other effect.
+
+    pair<iterator, bool> insert(node_type& node);
+        // Insert the 'value_type' object held by the specified 'node' into
+        // this unordered map, and make 'node' empty, if the key of that object
+        // does not already exist in this unordered map; otherwise, leave
+        // 'node' unchanged.  Return a 'pair' whose 'first' member is an
+        // iterator referring to the (possibly newly inserted) 'value_type'
+        // object in this unordered map whose key is the same as that of the
+        // object held by 'node', and whose 'second' member is 'true' if the
+        // object was inserted, and 'false' otherwise.  If 'node' is empty,
+        // return '(end(), false)' with no other effect.  Note that, if
+        // 'node.get_allocator() == get_allocator()', the node is linked into
+        // this unordered map without moving the object or allocating memory,
+        // so that references to the object remain valid; otherwise, the object
+        // is relocated into a new node.
+
+    iterator insert(const_iterator hint, node_type& node);
+        // Insert the 'value_type' object held by the specified 'node' into
+        // this unordered map, and make 'node' empty, if the key of that object
+        // does not already exist in this unordered map; otherwise, leave
+        // 'node' unchanged.  Return an iterator referring to the (possibly
+        // newly inserted) 'value_type' object in this unordered map whose key
+        // is the same as that of the object held by 'node', or 'end()' if
+        // 'node' is empty.  The behavior is undefined unless the specified
+        // 'hint' is a valid iterator into this unordered map.  Note that
+        // 'hint' is not used by this method.
+
+    void merge(unordered_map& source);
+        // Relocate into this unordered map each 'value_type' object of the
+        // specified 'source' unordered map whose key does not already exist in
+        // this unordered map; the objects whose keys already exist remain in
+        // 'source'.  This method has no effect if 'source' is this unordered
+        // map.  If an exception is thrown, each object is held by exactly one
+        // of the two containers.  Note that no memory is allocated for the
+        // relocated objects (unless the node pool of this unordered map must
+        // grow), and none is deallocated, if 'value_type' is bitwise moveable
+        // and 'source.get_allocator() == get_allocator()'.
+
     void rehash(size_type numBuckets);
         // Change the size of the array of buckets maintained by this unordered
         // map to at least the specified 'numBuckets', and redistribute all the
@@ -1360,12 +1593,44 @@ class unordered_map {
         // unordered map.  The behavior is undefined unless
         // 'index < bucket_count()'.
 
+    bool contains(const key_type& key) const;
+        // Return 'true' if this unordered map contains a 'value_type' object
+        // having the specified 'key', and 'false' otherwise.
+
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<HASH, LOOKUP_KEY>::value
+     && BloombergLP::bslmf::IsTransparentPredicate<EQUAL, LOOKUP_KEY>::value,
+        bool>::type
+    contains(const LOOKUP_KEY& key) const
+        // Return 'true' if this unordered map contains a 'value_type' object
+        // having a key equivalent to the specified 'key', and 'false'
+        // otherwise.  This overload participates in overload resolution only
+        // if both 'HASH' and 'EQUAL' are transparent (see 'find').
+    {
+        return 0 != d_impl.findTransparent(key);
+    }
+
     size_type count(const key_type& key) const;
         // Return the number of 'value_type' objects contained within this
         // unordered map having the specified 'key'.  Note that since an
         // unordered map maintains unique keys, the returned value will be
         // either 0 or 1.
 
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<HASH, LOOKUP_KEY>::value
+     && BloombergLP::bslmf::IsTransparentPredicate<EQUAL, LOOKUP_KEY>::value,
+        size_type>::type
+    count(const LOOKUP_KEY& key) const
+        // Return the number of 'value_type' objects contained within this
+        // unordered map having a key equivalent to the specified 'key'.  This
+        // overload participates in overload resolution only if both 'HASH' and
+        // 'EQUAL' are transparent (see 'find').
+    {
+        return 0 != d_impl.findTransparent(key);
+    }
+
     bool empty() const;
         // Return 'true' if this unordered map contains no elements, and
         // 'false' otherwise.
@@ -1381,12 +1646,53 @@ class unordered_map {
         // value, 'end()'.  Note that since an unordered map maintains unique
         // keys, the range will contain at most one element.
 
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<HASH, LOOKUP_KEY>::value
+     && BloombergLP::bslmf::IsTransparentPredicate<EQUAL, LOOKUP_KEY>::value,
+        pair<const_iterator, const_iterator> >::type
+    equal_range(const LOOKUP_KEY& key) const
+        // Return a pair of iterators providing non-modifiable access to the
+        // sequence of 'value_type' objects in this unordered map having a key
+        // equivalent to the specified 'key', where the first iterator is
+        // positioned at the start of the sequence, and the second is
+        // positioned one past the end of the sequence.  If this unordered map
+        // contains no such 'value_type' object, then the two returned
+        // iterators will have the same value, 'end()'.  This overload
+        // participates in overload resolution only if both 'HASH' and 'EQUAL'
+        // are transparent (see 'find').
+    {
+        typedef bsl::pair<const_iterator, const_iterator> ResultType;
+
+        HashTableLink *first = d_impl.findTransparent(key);
+        return first
+             ? ResultType(const_iterator(first),
+                          const_iterator(first->nextLink()))
+             : ResultType(end(), end());
+    }
+
     const_iterator find(const key_type& key) const;
         // Return an iterator providing non-modifiable access to the
         // 'value_type' object in this unordered map having the specified
         // 'key', if such an entry exists, and the past-the-end iterator
         // ('end') otherwise.
 
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<HASH, LOOKUP_KEY>::value
+     && BloombergLP::bslmf::IsTransparentPredicate<EQUAL, LOOKUP_KEY>::value,
+        const_iterator>::type
+    find(const LOOKUP_KEY& key) const
+        // Return an iterator providing non-modifiable access to the
+        // 'value_type' object in this unordered map having a key equivalent to
+        // the specified 'key', if such an entry exists, and the past-the-end
+        // iterator ('end') otherwise.  This overload participates in overload
+        // resolution only if both 'HASH' and 'EQUAL' are transparent (see
+        // 'find').
+    {
+        return const_iterator(d_impl.findTransparent(key));
+    }
+
     allocator_type get_allocator() const;
         // Return (a copy of) the allocator used for memory allocation by this
         // unordered map.
@@ -1418,6 +1724,13 @@ class unordered_map {
     size_type size() const;
         // Return the number of elements in this unordered map.
 
+    BloombergLP::bslstl::HashTableStatistics statistics() const;
+        // Return a description of the distribution of the elements of this
+        // unordered map among its buckets, and of the memory used by its
+        // internal data structure (see 'bslstl::HashTableStatistics').  Note
+        // that this operation has linear run-time complexity with respect to
+        // the number of buckets and elements.
+
     size_type max_size() const;
         // Return a theoretical upper bound on the largest number of elements
         // that this unordered map could possibly hold.  Note that there is no
@@ -1726,11 +2039,7 @@ void unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::insert(
         this->reserve(this->size() + maxInsertions);
     }
 
-    bool isInsertedFlag;  // not used
-    while (first != last) {
-        d_impl.insertIfMissing(&isInsertedFlag, *first);
-        ++first;
-    }
+    d_impl.insertIfMissingBatch(first, last);
 }
 
 template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
@@ -1757,6 +2066,270 @@ unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::max_load_factor(
     d_impl.setMaxLoadFactor(newMaxLoadFactor);
 }
 
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+bsl::pair<typename unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::iterator,
+          bool>
+unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::try_emplace(
+                                                           const key_type& key)
+{
+    typedef bsl::pair<iterator, bool> ResultType;
+
+    bool isInsertedFlag = false;
+
+    HashTableLink *result = d_impl.tryEmplace(&isInsertedFlag, key);
+
+    return ResultType(iterator(result), isInsertedFlag);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+template <class ARG_1>
+bsl::pair<typename unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::iterator,
+          bool>
+unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::try_emplace(
+                                 const key_type&                          key,
+                                 BSLS_COMPILERFEATURES_FORWARD_REF(ARG_1) arg1)
+{
+    typedef bsl::pair<iterator, bool> ResultType;
+
+    bool isInsertedFlag = false;
+
+    HashTableLink *result = d_impl.tryEmplace(
+                                   &isInsertedFlag,
+                                   key,
+                                   BSLS_COMPILERFEATURES_FORWARD(ARG_1, arg1));
+
+    return ResultType(iterator(result), isInsertedFlag);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+template <class ARG_1, class ARG_2>
+bsl::pair<typename unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::iterator,
+          bool>
+unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::try_emplace(
+                                 const key_type&                          key,
+                                 BSLS_COMPILERFEATURES_FORWARD_REF(ARG_1) arg1,
+                                 BSLS_COMPILERFEATURES_FORWARD_REF(ARG_2) arg2)
+{
+    typedef bsl::pair<iterator, bool> ResultType;
+
+    bool isInsertedFlag = false;
+
+    HashTableLink *result = d_impl.tryEmplace(
+                                   &isInsertedFlag,
+                                   key,
+                                   BSLS_COMPILERFEATURES_FORWARD(ARG_1, arg1),
+                                   BSLS_COMPILERFEATURES_FORWARD(ARG_2, arg2));
+
+    return ResultType(iterator(result), isInsertedFlag);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+template <class ARG_1, class ARG_2, class ARG_3>
+bsl::pair<typename unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::iterator,
+          bool>
+unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::try_emplace(
+                                 const key_type&                          key,
+                                 BSLS_COMPILERFEATURES_FORWARD_REF(ARG_1) arg1,
+                                 BSLS_COMPILERFEATURES_FORWARD_REF(ARG_2) arg2,
+                                 BSLS_COMPILERFEATURES_FORWARD_REF(ARG_3) arg3)
+{
+    typedef bsl::pair<iterator, bool> ResultType;
+
+    bool isInsertedFlag = false;
+
+    HashTableLink *result = d_impl.tryEmplace(
+                                   &isInsertedFlag,
+                                   key,
+                                   BSLS_COMPILERFEATURES_FORWARD(ARG_1, arg1),
+                                   BSLS_COMPILERFEATURES_FORWARD(ARG_2, arg2),
+                                   BSLS_COMPILERFEATURES_FORWARD(ARG_3, arg3));
+
+    return ResultType(iterator(result), isInsertedFlag);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+typename unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::iterator
+unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::try_emplace(
+                                                           const_iterator,
+                                                           const key_type& key)
+{
+    bool isInsertedFlag;  // not used
+
+    HashTableLink *result = d_impl.tryEmplace(&isInsertedFlag, key);
+
+    return iterator(result);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+template <class ARG_1>
+typename unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::iterator
+unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::try_emplace(
+                                 const_iterator,
+                                 const key_type&                          key,
+                                 BSLS_COMPILERFEATURES_FORWARD_REF(ARG_1) arg1)
+{
+    bool isInsertedFlag;  // not used
+
+    HashTableLink *result = d_impl.tryEmplace(
+                                   &isInsertedFlag,
+                                   key,
+                                   BSLS_COMPILERFEATURES_FORWARD(ARG_1, arg1));
+
+    return iterator(result);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+template <class ARG_1, class ARG_2>
+typename unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::iterator
+unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::try_emplace(
+                                 const_iterator,
+                                 const key_type&                          key,
+                                 BSLS_COMPILERFEATURES_FORWARD_REF(ARG_1) arg1,
+                                 BSLS_COMPILERFEATURES_FORWARD_REF(ARG_2) arg2)
+{
+    bool isInsertedFlag;  // not used
+
+    HashTableLink *result = d_impl.tryEmplace(
+                                   &isInsertedFlag,
+                                   key,
+                                   BSLS_COMPILERFEATURES_FORWARD(ARG_1, arg1),
+                                   BSLS_COMPILERFEATURES_FORWARD(ARG_2, arg2));
+
+    return iterator(result);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+template <class ARG_1, class ARG_2, class ARG_3>
+typename unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::iterator
+unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::try_emplace(
+                                 const_iterator,
+                                 const key_type&                          key,
+                                 BSLS_COMPILERFEATURES_FORWARD_REF(ARG_1) arg1,
+                                 BSLS_COMPILERFEATURES_FORWARD_REF(ARG_2) arg2,
+                                 BSLS_COMPILERFEATURES_FORWARD_REF(ARG_3) arg3)
+{
+    bool isInsertedFlag;  // not used
+
+    HashTableLink *result = d_impl.tryEmplace(
+                                   &isInsertedFlag,
+                                   key,
+                                   BSLS_COMPILERFEATURES_FORWARD(ARG_1, arg1),
+                                   BSLS_COMPILERFEATURES_FORWARD(ARG_2, arg2),
+                                   BSLS_COMPILERFEATURES_FORWARD(ARG_3, arg3));
+
+    return iterator(result);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+template <class OBJECT>
+bsl::pair<typename unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::iterator,
+          bool>
+unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::insert_or_assign(
+                                 const key_type&                           key,
+                                 BSLS_COMPILERFEATURES_FORWARD_REF(OBJECT) obj)
+{
+    typedef bsl::pair<iterator, bool> ResultType;
+
+    bool isInsertedFlag = false;
+
+    HashTableLink *result = d_impl.tryEmplace(
+                                   &isInsertedFlag,
+                                   key,
+                                   BSLS_COMPILERFEATURES_FORWARD(OBJECT, obj));
+    if (!isInsertedFlag) {
+        static_cast<HashTableNode *>(result)->value().second =
+                                    BSLS_COMPILERFEATURES_FORWARD(OBJECT, obj);
+    }
+
+    return ResultType(iterator(result), isInsertedFlag);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+template <class OBJECT>
+typename unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::iterator
+unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::insert_or_assign(
+                                 const_iterator,
+                                 const key_type&                           key,
+                                 BSLS_COMPILERFEATURES_FORWARD_REF(OBJECT) obj)
+{
+    bool isInsertedFlag = false;
+
+    HashTableLink *result = d_impl.tryEmplace(
+                                   &isInsertedFlag,
+                                   key,
+                                   BSLS_COMPILERFEATURES_FORWARD(OBJECT, obj));
+    if (!isInsertedFlag) {
+        static_cast<HashTableNode *>(result)->value().second =
+                                    BSLS_COMPILERFEATURES_FORWARD(OBJECT, obj);
+    }
+
+    return iterator(result);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+inline
+typename unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::node_type
+unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::extract(
+                                                       const_iterator position)
+{
+    BSLS_ASSERT(position != this->end());
+
+    node_type result;
+    d_impl.extractNode(&result, position.node());
+    return result;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+inline
+typename unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::node_type
+unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::extract(const key_type& key)
+{
+    node_type result;
+    if (HashTableLink *target = d_impl.find(key)) {
+        d_impl.extractNode(&result, target);
+    }
+    return result;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+inline
+bsl::pair<typename unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::iterator,
+          bool>
+unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::insert(node_type& node)
+{
+    typedef bsl::pair<iterator, bool> ResultType;
+
+    if (node.empty()) {
+        return ResultType(end(), false);                              // RETURN
+    }
+
+    bool isInsertedFlag = false;
+
+    HashTableLink *result = d_impl.insertNodeIfMissing(&isInsertedFlag, &node);
+
+    return ResultType(iterator(result), isInsertedFlag);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+inline
+typename unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::iterator
+unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::insert(const_iterator,
+                                                          node_type&     node)
+{
+    // As for the insertion of a value, the 'hint' does not help to find the
+    // start of the bucket that must be searched for a duplicate key.
+
+    return this->insert(node).first;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+inline
+void unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::merge(
+                                                         unordered_map& source)
+{
+    d_impl.mergeIfMissing(&source.d_impl);
+}
+
 template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
 inline
 void
@@ -1914,6 +2487,15 @@ unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::bucket_size(
 }
 
 
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+inline
+bool
+unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::contains(
+                                                     const key_type& key) const
+{
+    return 0 != d_impl.find(key);
+}
+
 template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
 inline
 typename unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::size_type
@@ -2012,6 +2594,14 @@ unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::size() const
     return d_impl.size();
 }
 
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+inline
+BloombergLP::bslstl::HashTableStatistics
+unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::statistics() const
+{
+    return d_impl.statistics();
+}
+
 template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
 inline
 typename unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::size_type
@@ -1,9 +1,11 @@
 // bslstl_unorderedmap.t.cpp                                          -*-C++-*-
 #include <bslstl_unorderedmap.h>
 
+#include <bslstl_equalto.h>
 #include <bslstl_hash.h>
 #include <bslstl_pair.h>
 #include <bslstl_string.h>
+#include <bslstl_stringref.h>
 #include <bslstl_vector.h>
 
 #include <bslalg_swaputil.h>
@@ -18,6 +20,8 @@
 
 #include <bslmf_haspointersemantics.h>
 #include <bslmf_issame.h>
+#include <bslmf_istransparentpredicate.h>
+#include <bslmf_nestedtraitdeclaration.h>
 
 #include <bsls_assert.h>
 #include <bsls_asserttest.h>
@@ -54,10 +58,22 @@ using namespace BloombergLP;
 // instantiation and test obvious boundary conditions and iterator stability
 // guarantees.
 //-----------------------------------------------------------------------------
-// [ ]
+// [17] TRANSPARENT LOOKUP
+// [18] bslstl::HashTableStatistics statistics() const;
+//
+// [19] node_type extract(const_iterator position);
+// [19] node_type extract(const key_type& key);
+// [19] pair<iterator, bool> insert(node_type& node);
+// [19] iterator insert(const_iterator hint, node_type& node);
+// [19] void merge(unordered_map& source);
+//
+// [20] pair<iterator, bool> try_emplace(const key_type&, Args&&...);
+// [20] iterator try_emplace(const_iterator, const key_type&, Args&&...);
+// [20] pair<iterator, bool> insert_or_assign(const key_type&, OBJ&&);
+// [20] iterator insert_or_assign(const_iterator, const key_type&, OBJ&&);
 //-----------------------------------------------------------------------------
-// [1] BREATHING TEST
-// [2] USAGE EXAMPLE
+// [ 1] BREATHING TEST
+// [21] USAGE EXAMPLE
 //-----------------------------------------------------------------------------
 
 // ============================================================================
@@ -210,6 +226,111 @@ static struct DefaultDataRow {
 static const size_t DEFAULT_NUM_DATA =
                                     sizeof DEFAULT_DATA / sizeof *DEFAULT_DATA;
 
+                            // ==================
+                            // class EmplacedType
+                            // ==================
+
+class EmplacedType {
+    // This allocator-aware test type records the number of 'int' arguments it
+    // was constructed from, the sum of those arguments, and the allocator it
+    // was supplied, and counts the objects created by copy construction.
+    // Constructing an object from a negative first argument throws that
+    // argument as an exception.
+
+    // CLASS DATA
+    static int        s_numCopies;    // number of copy-constructed objects
+
+    // DATA
+    int               d_numArgs;      // number of constructor arguments
+    int               d_sum;          // sum of constructor arguments
+    bslma::Allocator *d_allocator_p;  // allocator supplied (held)
+
+    // PRIVATE CLASS METHODS
+    static void throwIfNegative(int value)
+        // Throw the specified 'value' if it is negative and exceptions are
+        // enabled.
+    {
+#ifdef BDE_BUILD_TARGET_EXC
+        if (value < 0) {
+            throw value;
+        }
+#else
+        (void) value;
+#endif
+    }
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(EmplacedType, bslma::UsesBslmaAllocator);
+
+    // CLASS METHODS
+    static int numCopies()
+        // Return the number of 'EmplacedType' objects created by copy
+        // construction since the start of the program.
+    {
+        return s_numCopies;
+    }
+
+    // CREATORS
+    explicit EmplacedType(bslma::Allocator *basicAllocator = 0)
+    : d_numArgs(0)
+    , d_sum(0)
+    , d_allocator_p(bslma::Default::allocator(basicAllocator))
+    {
+    }
+
+    explicit EmplacedType(int a1, bslma::Allocator *basicAllocator = 0)
+    : d_numArgs(1)
+    , d_sum(a1)
+    , d_allocator_p(bslma::Default::allocator(basicAllocator))
+    {
+        throwIfNegative(a1);
+    }
+
+    EmplacedType(int a1, int a2, bslma::Allocator *basicAllocator = 0)
+    : d_numArgs(2)
+    , d_sum(a1 + a2)
+    , d_allocator_p(bslma::Default::allocator(basicAllocator))
+    {
+        throwIfNegative(a1);
+    }
+
+    EmplacedType(int               a1,
+                 int               a2,
+                 int               a3,
+                 bslma::Allocator *basicAllocator = 0)
+    : d_numArgs(3)
+    , d_sum(a1 + a2 + a3)
+    , d_allocator_p(bslma::Default::allocator(basicAllocator))
+    {
+        throwIfNegative(a1);
+    }
+
+    EmplacedType(const EmplacedType&  original,
+                 bslma::Allocator    *basicAllocator = 0)
+    : d_numArgs(original.d_numArgs)
+    , d_sum(original.d_sum)
+    , d_allocator_p(bslma::Default::allocator(basicAllocator))
+    {
+        ++s_numCopies;
+    }
+
+    // MANIPULATORS
+    EmplacedType& operator=(const EmplacedType& rhs)
+    {
+        d_numArgs = rhs.d_numArgs;
+        d_sum     = rhs.d_sum;
+        return *this;
+    }
+
+    // ACCESSORS
+    bslma::Allocator *allocator() const { return d_allocator_p; }
+    int numArgs() const                 { return d_numArgs; }
+    int sum() const                     { return d_sum; }
+};
+
+int EmplacedType::s_numCopies = 0;
+
 //=============================================================================
 //                  GLOBAL HELPER FUNCTIONS FOR TESTING
 //-----------------------------------------------------------------------------
@@ -9568,7 +9689,7 @@ int main(int argc, char *argv[])
 
     switch (test) { case 0:
 #if !defined(BSLSTL_UNORDEREDMAP_DO_NOT_TEST_USAGE)
-        case 17: {
+        case 21: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //
@@ -9589,6 +9710,591 @@ int main(int argc, char *argv[])
         usage();
       } break;
 #endif
+      case 20: {
+        // --------------------------------------------------------------------
+        // TESTING 'try_emplace' AND 'insert_or_assign'
+        //
+        // Concerns:
+        //: 1 'try_emplace' inserts an element whose key is a copy of the
+        //:   supplied key and whose mapped value is constructed from the
+        //:   remaining arguments (or value-initialized if there are none),
+        //:   using the allocator of the unordered map.
+        //:
+        //: 2 If the key is present, 'try_emplace' constructs no mapped value,
+        //:   allocates no memory, and leaves the element unchanged.
+        //:
+        //: 3 If constructing the mapped value throws, the unordered map is
+        //:   unchanged and the node is returned to its pool.
+        //:
+        //: 4 'insert_or_assign' assigns the supplied object to the mapped
+        //:   value of an element having the supplied key, without allocating
+        //:   memory, and otherwise inserts an element whose mapped value is
+        //:   constructed from that object.
+        //:
+        //: 5 'operator[]' value-initializes the mapped value of a new element
+        //:   in place.
+        //:
+        //: 6 No temporary 'value_type' object is created, no memory is
+        //:   allocated from the default allocator, and no memory is leaked.
+        //
+        // Plan:
+        //: 1 Using an unordered map whose mapped type, 'EmplacedType', records
+        //:   its constructor arguments and allocator and counts its copies,
+        //:   call 'try_emplace' with and without a hint, with each number of
+        //:   mapped arguments, for missing and present keys, and verify the
+        //:   elements, the number of copies made, and (using a test allocator
+        //:   monitor) the memory allocated.  (C-1..2, 6)
+        //:
+        //: 2 Supply a negative mapped argument, so that the constructor of
+        //:   'EmplacedType' throws, twice, and verify that the unordered map
+        //:   is unchanged and that the second attempt allocates no memory.
+        //:   (C-3)
+        //:
+        //: 3 Call 'insert_or_assign', with and without a hint, for present
+        //:   and missing keys, and 'operator[]' for a missing key, and verify
+        //:   the elements and the memory allocated.  (C-4..6)
+        //
+        // Testing:
+        //   pair<iterator, bool> try_emplace(const key_type&, Args&&...);
+        //   iterator try_emplace(const_iterator, const key_type&, Args&&...);
+        //   pair<iterator, bool> insert_or_assign(const key_type&, OBJ&&);
+        //   iterator insert_or_assign(const_iterator, const key_type&, OBJ&&);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf(
+                           "\nTESTING 'try_emplace' AND 'insert_or_assign'"
+                           "\n============================================\n");
+
+        typedef bsl::unordered_map<int, EmplacedType> Obj;
+
+        const int NUM_VALUES = 8;
+
+        bslma::TestAllocator da("default", veryVeryVeryVerbose);
+        bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+
+        bslma::DefaultAllocatorGuard dag(&da);
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+
+            const int NUM_COPIES = EmplacedType::numCopies();
+
+            if (verbose) printf("Testing 'try_emplace'.\n");
+
+            for (int i = 0; i != NUM_VALUES; ++i) {
+                const int NUM_ARGS = i % 4;
+
+                bsl::pair<Obj::iterator, bool> result;
+                switch (NUM_ARGS) {
+                  case 0: result = mX.try_emplace(i);          break;
+                  case 1: result = mX.try_emplace(i, 1);       break;
+                  case 2: result = mX.try_emplace(i, 1, 2);    break;
+                  case 3: result = mX.try_emplace(i, 1, 2, 3); break;
+                }
+
+                const EmplacedType& V = result.first->second;
+
+                ASSERTV(i, result.second);
+                ASSERTV(i, i        == result.first->first);
+                ASSERTV(i, NUM_ARGS == V.numArgs());
+                ASSERTV(i, V.sum(), NUM_ARGS * (NUM_ARGS + 1) / 2 == V.sum());
+                ASSERTV(i, &oa      == V.allocator());
+            }
+            ASSERTV(X.size(), NUM_VALUES == X.size());
+
+            for (int i = 0; i != NUM_VALUES; ++i) {
+                const int NUM_ARGS = i % 4;
+
+                bslma::TestAllocatorMonitor oam(&oa);
+
+                bsl::pair<Obj::iterator, bool> result =
+                                                   mX.try_emplace(i, 5, 6, 7);
+                ASSERTV(i, !result.second);
+                ASSERTV(i, NUM_ARGS == result.first->second.numArgs());
+
+                Obj::iterator it = mX.try_emplace(X.begin(), i, 5);
+                ASSERTV(i, result.first == it);
+                ASSERTV(i, NUM_ARGS == it->second.numArgs());
+
+                it = mX.try_emplace(X.end(), i);
+                ASSERTV(i, result.first == it);
+                ASSERTV(i, NUM_ARGS == it->second.numArgs());
+
+                ASSERTV(i, oam.isTotalSame());
+            }
+            ASSERTV(X.size(), NUM_VALUES == X.size());
+
+            for (int i = NUM_VALUES; i != 2 * NUM_VALUES; ++i) {
+                Obj::iterator it = mX.try_emplace(X.end(), i, i);
+
+                ASSERTV(i, i    == it->first);
+                ASSERTV(i, 1    == it->second.numArgs());
+                ASSERTV(i, i    == it->second.sum());
+                ASSERTV(i, &oa  == it->second.allocator());
+            }
+            ASSERTV(X.size(), 2 * NUM_VALUES == X.size());
+            ASSERTV(EmplacedType::numCopies(),
+                    NUM_COPIES == EmplacedType::numCopies());
+
+#ifdef BDE_BUILD_TARGET_EXC
+            if (verbose) printf("Testing exceptions.\n");
+
+            for (int attempt = 0; attempt != 2; ++attempt) {
+                bslma::TestAllocatorMonitor oam(&oa);
+
+                bool caught = false;
+                try {
+                    mX.try_emplace(X.begin(), 2 * NUM_VALUES, -1, 2);
+                }
+                catch (int) {
+                    caught = true;
+                }
+                ASSERTV(attempt, caught);
+                ASSERTV(attempt, 2 * NUM_VALUES == X.size());
+                ASSERTV(attempt, X.end() == X.find(2 * NUM_VALUES));
+                if (attempt) {
+                    ASSERTV(attempt, oam.isTotalSame());
+                }
+            }
+#endif
+
+            if (verbose) printf("Testing 'insert_or_assign'.\n");
+
+            const EmplacedType V(4, 5, 6);
+            {
+                bslma::TestAllocatorMonitor oam(&oa);
+
+                bsl::pair<Obj::iterator, bool> result =
+                                                    mX.insert_or_assign(0, V);
+                ASSERT(!result.second);
+                ASSERTV(result.first->first, 0 == result.first->first);
+                ASSERTV(result.first->second.sum(),
+                        15 == result.first->second.sum());
+                ASSERT(&oa == result.first->second.allocator());
+
+                Obj::iterator it = mX.insert_or_assign(X.end(), 1, V);
+                ASSERTV(it->first,        1  == it->first);
+                ASSERTV(it->second.sum(), 15 == it->second.sum());
+                ASSERT(&oa == it->second.allocator());
+
+                ASSERT(oam.isTotalSame());
+                ASSERTV(EmplacedType::numCopies(),
+                        NUM_COPIES == EmplacedType::numCopies());
+            }
+
+            bsl::pair<Obj::iterator, bool> result =
+                                     mX.insert_or_assign(2 * NUM_VALUES, V);
+            ASSERT(result.second);
+            ASSERTV(result.first->second.sum(),
+                    15 == result.first->second.sum());
+            ASSERT(&oa == result.first->second.allocator());
+
+            Obj::iterator it = mX.insert_or_assign(X.begin(),
+                                                   2 * NUM_VALUES + 1,
+                                                   V);
+            ASSERTV(it->first, 2 * NUM_VALUES + 1 == it->first);
+            ASSERTV(it->second.sum(), 15 == it->second.sum());
+            ASSERT(&oa == it->second.allocator());
+
+            ASSERTV(X.size(), 2 * NUM_VALUES + 2 == X.size());
+            ASSERTV(EmplacedType::numCopies(),
+                    NUM_COPIES + 2 == EmplacedType::numCopies());
+
+            if (verbose) printf("Testing 'operator[]'.\n");
+
+            EmplacedType& v = mX[3 * NUM_VALUES];
+            ASSERTV(v.numArgs(), 0 == v.numArgs());
+            ASSERT(&oa == v.allocator());
+            ASSERT(&v  == &mX[3 * NUM_VALUES]);
+            ASSERTV(X.size(), 2 * NUM_VALUES + 3 == X.size());
+            ASSERTV(EmplacedType::numCopies(),
+                    NUM_COPIES + 2 == EmplacedType::numCopies());
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+        ASSERTV(da.numBlocksTotal(), 0 == da.numBlocksTotal());
+      } break;
+      case 19: {
+        // --------------------------------------------------------------------
+        // TESTING NODE HANDLES
+        //
+        // Concerns:
+        //: 1 'extract' removes the element at a position, or having a key,
+        //:   and returns a handle holding that element and the allocator of
+        //:   the container; extracting a missing key yields an empty handle.
+        //:
+        //: 2 'insert' inserts the element held by a handle, and empties the
+        //:   handle, unless an element having the same key is present, in
+        //:   which case the handle is left unchanged.  Inserting an empty
+        //:   handle has no effect.
+        //:
+        //: 3 An element held by a handle is inserted into a container using
+        //:   the same allocator without allocating memory, even if the
+        //:   container it was extracted from has been destroyed.
+        //:
+        //: 4 'merge' moves each element of the source whose key is not
+        //:   present in the target, including when the two containers use
+        //:   different allocators, and the moved elements then use the
+        //:   allocator of the target.
+        //:
+        //: 5 Merging a container with itself has no effect.
+        //:
+        //: 6 Repeatedly inserting into a container, and erasing, elements
+        //:   extracted from short-lived containers does not increase the
+        //:   memory used by that container.
+        //:
+        //: 7 No memory is leaked.
+        //
+        // Plan:
+        //: 1 Extract elements from a container, and insert them into the same
+        //:   and another container, verifying the sizes of the containers, the
+        //:   state of the handles, and (using a test allocator monitor) that
+        //:   no memory is allocated by 'insert'.  Repeat with a handle
+        //:   outliving the container it was extracted from.  (C-1..3)
+        //:
+        //: 2 Merge containers using the same and different allocators, and
+        //:   verify the sizes of the containers and the allocators of the
+        //:   moved elements.  (C-4..5)
+        //:
+        //: 3 Repeatedly extract an element from a temporary container, insert
+        //:   it into a container and erase it, and verify that the number of
+        //:   blocks in use does not change.  (C-6)
+        //:
+        //: 4 Verify that no memory is in use once the containers are
+        //:   destroyed.  (C-7)
+        //
+        // Testing:
+        //   node_type extract(const_iterator position);
+        //   node_type extract(const key_type& key);
+        //   bsl::pair<iterator, bool> insert(node_type& node);
+        //   iterator insert(const_iterator hint, node_type& node);
+        //   void merge(unordered_map& source);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING NODE HANDLES"
+                            "\n====================\n");
+
+        typedef bsltf::AllocBitwiseMoveableTestType Element;
+        typedef bsl::unordered_map<int, Element>    Obj;
+        typedef Obj::node_type                      Handle;
+
+        const int NUM_VALUES = 8;
+
+        bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+        bslma::TestAllocator za("other",   veryVeryVeryVerbose);
+        bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+            Obj mY(&oa);  const Obj& Y = mY;
+            Obj mZ(&za);  const Obj& Z = mZ;
+
+            for (int i = 0; i != NUM_VALUES; ++i) {
+                mX.insert(Obj::value_type(i, Element(i, &sa)));
+                if (i % 2) {
+                    mY.insert(Obj::value_type(i, Element(i, &sa)));
+                }
+                if (i >= NUM_VALUES - 2) {
+                    mZ.insert(Obj::value_type(i, Element(i, &sa)));
+                    mZ.insert(Obj::value_type(i + 2, Element(i + 2, &sa)));
+                }
+            }
+            ASSERTV(Z.size(), 4 == Z.size());
+
+            if (verbose) printf("Testing 'extract'.\n");
+
+            Handle mH = mX.extract(X.find(0));  const Handle& H = mH;
+            ASSERT(!H.empty());
+            ASSERTV(H.value().first, 0 == H.value().first);
+            ASSERT(X.get_allocator() == H.get_allocator());
+            ASSERTV(X.size(), NUM_VALUES - 1 == X.size());
+            ASSERT(X.end() == X.find(0));
+
+            Handle mG(mX.extract(1));  const Handle& G = mG;
+            ASSERT(!G.empty());
+            ASSERTV(G.value().first, 1 == G.value().first);
+            ASSERTV(X.size(), NUM_VALUES - 2 == X.size());
+
+            ASSERT(mX.extract(1).empty());
+            ASSERTV(X.size(), NUM_VALUES - 2 == X.size());
+
+            if (verbose) printf("Testing 'insert'.\n");
+
+            const Obj::size_type SIZE_Y = Y.size();
+
+            bsl::pair<Obj::iterator, bool> result = mY.insert(mG);
+            ASSERT(!result.second);
+            ASSERTV(result.first->first, 1 == result.first->first);
+            ASSERT(!G.empty());
+            ASSERTV(Y.size(), SIZE_Y == Y.size());
+
+            // 'X' uses the same allocator as 'H'.
+
+            bslma::TestAllocatorMonitor oam(&oa);
+
+            Obj::iterator hintResult = mX.insert(X.begin(), mH);
+            ASSERTV(hintResult->first, 0 == hintResult->first);
+            ASSERT(H.empty());
+            ASSERTV(X.size(), NUM_VALUES - 1 == X.size());
+
+
+            result = mX.insert(mG);
+            ASSERT(result.second);
+            ASSERTV(result.first->first, 1 == result.first->first);
+            ASSERT(G.empty());
+            ASSERTV(X.size(), NUM_VALUES == X.size());
+            ASSERT(oam.isTotalSame());
+
+            Handle mE;
+            result = mX.insert(mE);
+            ASSERT(!result.second);
+            ASSERT(X.end() == result.first);
+
+            ASSERT(X.end() == mX.insert(X.begin(), mE));
+
+            // A handle keeps its node after the container is destroyed.
+
+            {
+                Obj mW(&oa);
+                mW.insert(Obj::value_type(-1, Element(-1, &sa)));
+
+                mH = mW.extract(-1);
+            }
+            ASSERTV(H.value().first, -1 == H.value().first);
+
+            oam.reset();
+            result = mX.insert(mH);
+            ASSERT(result.second);
+            ASSERT(oam.isTotalSame());
+
+            mX.erase(-1);
+
+            const bsls::Types::Int64 BLOCKS = oa.numBlocksInUse();
+
+            for (int i = 0; i != NUM_VALUES * 4; ++i) {
+                {
+                    Obj mW(&oa);
+                    mW.insert(Obj::value_type(-1, Element(-1, &sa)));
+                    mH = mW.extract(-1);
+                }
+                result = mX.insert(mH);
+                ASSERTV(i, result.second);
+                mX.erase(result.first);
+            }
+            ASSERTV(BLOCKS, oa.numBlocksInUse(),
+                    BLOCKS == oa.numBlocksInUse());
+
+            if (verbose) printf("Testing 'merge'.\n");
+
+            const Obj::size_type SIZE_X = X.size();
+
+            mX.merge(mX);
+            ASSERTV(X.size(), SIZE_X == X.size());
+
+            mX.merge(mZ);
+            ASSERTV(X.size(), SIZE_X + 2 == X.size());
+            ASSERTV(Z.size(), 2 == Z.size());
+            ASSERTV(za.numBlocksInUse(), 0 < za.numBlocksInUse());
+            ASSERT(&oa == X.find(NUM_VALUES)->second.allocator());
+            ASSERT(&oa == X.find(NUM_VALUES + 1)->second.allocator());
+
+            mY.merge(mX);
+            ASSERTV(Y.size(), NUM_VALUES + 2 == Y.size());
+            ASSERTV(X.size(), NUM_VALUES / 2 == X.size());
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+        ASSERTV(za.numBlocksInUse(), 0 == za.numBlocksInUse());
+      } break;
+      case 18: {
+        // --------------------------------------------------------------------
+        // TESTING 'statistics'
+        //
+        // Concerns:
+        //: 1 'statistics' reports the statistics of the underlying hash
+        //:   table, consistent with 'size', 'bucket_count', and
+        //:   'bucket_size'.
+        //
+        // Plan:
+        //: 1 Insert a sequence of elements into a container, and after each
+        //:   insertion compare the statistics with values computed using
+        //:   'bucket_size'.  (C-1)
+        //
+        // Testing:
+        //   bslstl::HashTableStatistics statistics() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING 'statistics'"
+                            "\n====================\n");
+
+        typedef bsl::unordered_map<int, int> Obj;
+        typedef bslstl::HashTableStatistics Stats;
+
+        const int NUM_VALUES = 50;
+
+        bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+
+        Obj mX(&oa);  const Obj& X = mX;
+
+        for (int i = 0; i != NUM_VALUES; ++i) {
+            mX.insert(Obj::value_type(i, i));
+
+            const Stats S = X.statistics();
+            ASSERTV(i, S.d_numElements, X.size() == S.d_numElements);
+            ASSERTV(i, S.d_numBuckets,  X.bucket_count() == S.d_numBuckets);
+
+            Obj::size_type numEmpty  = 0;
+            Obj::size_type maxLength = 0;
+            for (Obj::size_type b = 0; b != X.bucket_count(); ++b) {
+                const Obj::size_type length = X.bucket_size(b);
+                numEmpty  += 0 == length;
+                maxLength  = maxLength < length ? length : maxLength;
+            }
+            ASSERTV(i, S.d_numEmptyBuckets, numEmpty == S.d_numEmptyBuckets);
+            ASSERTV(i, S.d_maxChainLength, maxLength == S.d_maxChainLength);
+            ASSERTV(i, S.d_nodeBytes,        0 < S.d_nodeBytes);
+            ASSERTV(i, S.d_bucketArrayBytes, 0 < S.d_bucketArrayBytes);
+        }
+
+#if !defined(BSLSTL_HASHTABLE_DISABLE_STATISTICS)
+        ASSERTV(X.statistics().d_numRehashes,
+                0 < X.statistics().d_numRehashes);
+#endif
+      } break;
+      case 17: {
+        // --------------------------------------------------------------------
+        // TESTING TRANSPARENT LOOKUP
+        //
+        // Concerns:
+        //: 1 When both 'HASH' and 'EQUAL' are transparent, 'find', 'count',
+        //:   'equal_range', and 'contains' accept a 'const char *' or a
+        //:   'bslstl::StringRef' key without creating a temporary 'key_type'.
+        //:
+        //: 2 A lookup using a key of another type returns the same result as a
+        //:   lookup using the equivalent 'key_type' value, both for keys that
+        //:   are present and keys that are absent.
+        //:
+        //: 3 When 'HASH' and 'EQUAL' are not transparent, a 'const char *' key
+        //:   is still accepted (by conversion to 'key_type').
+        //
+        // Plan:
+        //: 1 Populate a container using 'bsl::hash<bsl::string>' and
+        //:   'bsl::equal_to<>' with strings too long for the short string
+        //:   buffer.  Look up each key, and an absent key, as a 'bsl::string',
+        //:   a 'const char *', and a 'bslstl::StringRef', comparing the
+        //:   results, and verifying that the default allocator is not used by
+        //:   the heterogeneous lookups.  (C-1..2)
+        //:
+        //: 2 Repeat the lookups using a 'const char *' on a container with
+        //:   the default (non-transparent) functors.  (C-3)
+        //
+        // Testing:
+        //   iterator find(const LOOKUP_KEY& key);
+        //   pair<iterator, iterator> equal_range(const LOOKUP_KEY& key);
+        //   bool contains(const key_type& key) const;
+        //   bool contains(const LOOKUP_KEY& key) const;
+        //   size_type count(const LOOKUP_KEY& key) const;
+        //   pair<CIter, CIter> equal_range(const LOOKUP_KEY& key) const;
+        //   const_iterator find(const LOOKUP_KEY& key) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING TRANSPARENT LOOKUP"
+                            "\n==========================\n");
+
+        typedef bsl::unordered_map<bsl::string,
+                                   int,
+                                   bsl::hash<bsl::string>,
+                                   bsl::equal_to<> > Obj;
+        typedef bsl::unordered_map<bsl::string, int> PlainObj;
+
+        static const char *const KEYS[] = {
+            "the first key, too long for the short string buffer",
+            "the second key, too long for the short string buffer",
+            "the third key, too long for the short string buffer",
+            "the fourth key, too long for the short string buffer",
+        };
+        const int NUM_KEYS = static_cast<int>(sizeof KEYS / sizeof *KEYS);
+
+        const char ABSENT[] = "an absent key, too long for the short string";
+
+        bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+        bslma::TestAllocator da("default", veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        if (verbose) printf("\nTesting with transparent functors.\n");
+        {
+            ASSERT((bslmf::IsTransparentPredicate<Obj::hasher,
+                                                  const char *>::value));
+            ASSERT((bslmf::IsTransparentPredicate<Obj::key_equal,
+                                                  const char *>::value));
+
+            Obj mX(&oa);  const Obj& X = mX;
+            for (int i = 0; i < NUM_KEYS; ++i) {
+                mX.insert(Obj::value_type(KEYS[i], i));
+            }
+
+            const bsl::string absent(ABSENT, &oa);
+
+            bslma::TestAllocatorMonitor dam(&da);
+
+            for (int i = 0; i < NUM_KEYS; ++i) {
+                const bsl::string       STRING(KEYS[i], &oa);
+                const char             *CSTR = KEYS[i];
+                const bslstl::StringRef REF(STRING);
+
+                const Obj::iterator EXP = mX.find(STRING);
+                ASSERTV(i, X.end() != EXP);
+
+                ASSERTV(i, EXP == mX.find(CSTR));
+                ASSERTV(i, EXP == mX.find(REF));
+                ASSERTV(i, EXP == X.find(CSTR));
+                ASSERTV(i, EXP == X.find(REF));
+
+                ASSERTV(i, 1 == X.count(STRING));
+                ASSERTV(i, 1 == X.count(CSTR));
+                ASSERTV(i, 1 == X.count(REF));
+
+                ASSERTV(i, X.contains(STRING));
+                ASSERTV(i, X.contains(CSTR));
+                ASSERTV(i, X.contains(REF));
+
+                ASSERTV(i, mX.equal_range(STRING) == mX.equal_range(CSTR));
+                ASSERTV(i, mX.equal_range(STRING) == mX.equal_range(REF));
+                ASSERTV(i, X.equal_range(STRING)  == X.equal_range(CSTR));
+                ASSERTV(i, X.equal_range(STRING)  == X.equal_range(REF));
+            }
+
+            const char              *CSTR = ABSENT;
+            const bslstl::StringRef  REF(ABSENT);
+
+            ASSERT(X.end() == mX.find(CSTR));
+            ASSERT(X.end() == X.find(REF));
+            ASSERT(0       == X.count(CSTR));
+            ASSERT(!X.contains(absent));
+            ASSERT(!X.contains(REF));
+            ASSERT(mX.equal_range(absent) == mX.equal_range(CSTR));
+            ASSERT(X.equal_range(absent)  == X.equal_range(REF));
+
+            ASSERTV(da.numBlocksInUse(), dam.isTotalSame());
+        }
+
+        if (verbose) printf("\nTesting with non-transparent functors.\n");
+        {
+            ASSERT(!(bslmf::IsTransparentPredicate<PlainObj::key_equal,
+                                                   const char *>::value));
+
+            PlainObj mX(&oa);  const PlainObj& X = mX;
+            for (int i = 0; i < NUM_KEYS; ++i) {
+                mX.insert(PlainObj::value_type(KEYS[i], i));
+            }
+
+            for (int i = 0; i < NUM_KEYS; ++i) {
+                const char *CSTR = KEYS[i];
+
+                ASSERTV(i, X.end() != X.find(CSTR));
+                ASSERTV(i, 1       == X.count(CSTR));
+                ASSERTV(i, X.contains(CSTR));
+            }
+            ASSERT(X.end() == X.find(ABSENT));
+            ASSERT(!X.contains(ABSENT));
+        }
+      } break;
       case 16: {
         // --------------------------------------------------------------------
         // GROWING FUNCTIONS
@@ -268,6 +268,14 @@ BSLS_IDENT("$Id: $")
 // the other unordered containers) is the choice of hash function.  Please see
 // the discussion in {'bslstl_unorderedmap'|Practical Requirements on 'HASH'}.
 //
+///Heterogeneous Lookup
+///--------------------
+// As for 'bsl::unordered_map', if both 'HASH' and 'EQUAL' are transparent
+// (i.e., declare the nested type 'is_transparent'), the 'find', 'count',
+// 'equal_range', and 'contains' methods accept a key of any type that the two
+// functors accept, without converting it to 'key_type'.  Please see
+// {'bslstl_unorderedmap'|Heterogeneous Lookup}.
+//
 ///Usage
 ///-----
 // In this section we show intended use of this component.
@@ -512,6 +520,10 @@ BSL_OVERRIDES_STD mode"
 #include <bslstl_iteratorutil.h>
 #endif
 
+#ifndef INCLUDED_BSLSTL_NODEHANDLE
+#include <bslstl_nodehandle.h>
+#endif
+
 #ifndef INCLUDED_BSLSTL_PAIR
 #include <bslstl_pair.h>
 #endif
@@ -536,10 +548,18 @@ BSL_OVERRIDES_STD mode"
 #include <bslma_usesbslmaallocator.h>
 #endif
 
+#ifndef INCLUDED_BSLMF_ENABLEIF
+#include <bslmf_enableif.h>
+#endif
+
 #ifndef INCLUDED_BSLMF_ISBITWISEMOVEABLE
 #include <bslmf_isbitwisemoveable.h>
 #endif
 
+#ifndef INCLUDED_BSLMF_ISTRANSPARENTPREDICATE
+#include <bslmf_istransparentpredicate.h>
+#endif
+
 #ifndef INCLUDED_BSLMF_NESTEDTRAITDECLARATION
 #include <bslmf_nestedtraitdeclaration.h>
 #endif
@@ -617,6 +637,8 @@ class unordered_multimap
                                                            difference_type>
                                                           const_local_iterator;
 
+    typedef typename Impl::NodeHandleType                           node_type;
+
     // TRAITS
     BSLMF_NESTED_TRAIT_DECLARATION_IF(
                          unordered_multimap,
@@ -834,6 +856,26 @@ class unordered_multimap
         // of this container matching the specified 'key', if they exist, and
         // the past-the-end ('end') iterator otherwise.
 
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<HASH, LOOKUP_KEY>::value
+     && BloombergLP::bslmf::IsTransparentPredicate<EQUAL, LOOKUP_KEY>::value,
+        iterator>::type
+    find(const LOOKUP_KEY& key)
+        // Return an iterator providing modifiable access to the first
+        // 'value_type' object in this unordered multimap having a key
+        // equivalent to the specified 'key', if such an entry exists, and the
+        // past-the-end iterator ('end') otherwise.  This overload participates
+        // in overload resolution only if both 'HASH' and 'EQUAL' are
+        // transparent (i.e., declare the nested type 'is_transparent'), in
+        // which case 'key' is passed, without conversion to 'key_type', to the
+        // hasher and comparator of this unordered multimap.  The behavior is
+        // undefined unless 'HASH' returns the same value for 'key' as for
+        // every 'key_type' value that 'EQUAL' considers equivalent to 'key'.
+    {
+        return iterator(d_impl.findTransparent(key));
+    }
+
     pair<iterator, iterator> equal_range(const key_type& key);
         // Return a pair of iterators providing modifiable access to the
         // sequence of 'value_type' objects in this multi-map matching the
@@ -843,12 +885,82 @@ class unordered_multimap
         // 'value_type' objects matching 'key', then the two returned iterators
         // will have the same value.
 
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<HASH, LOOKUP_KEY>::value
+     && BloombergLP::bslmf::IsTransparentPredicate<EQUAL, LOOKUP_KEY>::value,
+        pair<iterator, iterator> >::type
+    equal_range(const LOOKUP_KEY& key)
+        // Return a pair of iterators providing modifiable access to the
+        // sequence of 'value_type' objects in this unordered multimap having a
+        // key equivalent to the specified 'key', where the first iterator is
+        // positioned at the start of the sequence, and the second is
+        // positioned one past the end of the sequence.  If this unordered
+        // multimap contains no such 'value_type' object, then the two returned
+        // iterators will have the same value, 'end()'.  This overload
+        // participates in overload resolution only if both 'HASH' and 'EQUAL'
+        // are transparent (see 'find').
+    {
+        typedef bsl::pair<iterator, iterator> ResultType;
+
+        HashTableLink *first;
+        HashTableLink *last;
+        d_impl.findRangeTransparent(&first, &last, key);
+        return ResultType(iterator(first), iterator(last));
+    }
+
     void max_load_factor(float newLoadFactor);
         // Set the maximum load factor of this container to the specified
         // 'newLoadFactor'.  This operation will not do an immediate rehash of
         // the container, if that is wanted, it is recommended that this call
         // be followed by a call to 'reserve'.
 
+    node_type extract(const_iterator position);
+        // Remove from this unordered multimap the 'value_type' object at the
+        // specified 'position', and return a node handle holding that object
+        // (see {'bslstl_nodehandle'}).  The behavior is undefined unless
+        // 'position' refers to a 'value_type' object in this unordered
+        // multimap.  If an exception is thrown, this unordered multimap is
+        // unchanged.  Note that the object is relocated into a detached node
+        // owned by the node handle (see {'bslstl_nodehandle'|Node Ownership}),
+        // without being copied if 'value_type' is bitwise moveable, and that
+        // the node holding it in this unordered multimap is kept for reuse.
+
+    node_type extract(const key_type& key);
+        // Remove from this unordered multimap the first 'value_type' object
+        // having the specified 'key', if it exists, and return a node handle
+        // holding that object; otherwise return an empty node handle with no
+        // other effect.
+
+    iterator insert(node_type& node);
+        // Insert the 'value_type' object held by the specified 'node' into
+        // this unordered multimap (immediately before the first object having
+        // the same key, if any), make 'node' empty, and return an iterator
+        // referring to the newly inserted 'value_type' object, or 'end()' if
+        // 'node' is empty.  Note that the node held by 'node' is linked into
+        // this unordered multimap if 'node.get_allocator() == get_allocator()'
+        // and this unordered multimap has no free node, and that the object is
+        // otherwise relocated into a node of this unordered multimap (see
+        // {'bslstl_nodehandle'|Node Ownership}).
+
+    iterator insert(const_iterator hint, node_type& node);
+        // Insert the 'value_type' object held by the specified 'node' into
+        // this unordered multimap (immediately before the specified 'hint' if
+        // 'hint' refers to an object having the same key), make 'node' empty,
+        // and return an iterator referring to the newly inserted 'value_type'
+        // object, or 'end()' if 'node' is empty.  The behavior is undefined
+        // unless 'hint' is a valid iterator into this unordered multimap.
+
+    void merge(unordered_multimap& source);
+        // Relocate every 'value_type' object of the specified 'source'
+        // unordered multimap into this unordered multimap, leaving 'source'
+        // empty.  This method has no effect if 'source' is this unordered
+        // multimap.  If an exception is thrown, each object is held by exactly
+        // one of the two containers.  Note that no memory is allocated for the
+        // relocated objects (unless the node pool of this unordered multimap
+        // must grow), and none is deallocated, if 'value_type' is bitwise
+        // moveable and 'source.get_allocator() == get_allocator()'.
+
     void rehash(size_type numBuckets);
         // Change the size of the array of buckets maintained by this container
         // to the specified 'numBuckets', and redistribute all the contained
@@ -932,10 +1044,50 @@ class unordered_multimap
         // specified 'index' in the array of buckets maintained by this
         // container.
 
+    bool contains(const key_type& key) const;
+        // Return 'true' if this unordered multimap contains a 'value_type'
+        // object having the specified 'key', and 'false' otherwise.
+
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<HASH, LOOKUP_KEY>::value
+     && BloombergLP::bslmf::IsTransparentPredicate<EQUAL, LOOKUP_KEY>::value,
+        bool>::type
+    contains(const LOOKUP_KEY& key) const
+        // Return 'true' if this unordered multimap contains a 'value_type'
+        // object having a key equivalent to the specified 'key', and 'false'
+        // otherwise.  This overload participates in overload resolution only
+        // if both 'HASH' and 'EQUAL' are transparent (see 'find').
+    {
+        return 0 != d_impl.findTransparent(key);
+    }
+
     size_type count(const key_type& key) const;
         // Return the number of 'value_type' objects within this container
         // matching the specified 'key'.
 
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<HASH, LOOKUP_KEY>::value
+     && BloombergLP::bslmf::IsTransparentPredicate<EQUAL, LOOKUP_KEY>::value,
+        size_type>::type
+    count(const LOOKUP_KEY& key) const
+        // Return the number of 'value_type' objects contained within this
+        // unordered multimap having a key equivalent to the specified 'key'.
+        // This overload participates in overload resolution only if both
+        // 'HASH' and 'EQUAL' are transparent (see 'find').
+    {
+        HashTableLink *first;
+        HashTableLink *last;
+        d_impl.findRangeTransparent(&first, &last, key);
+
+        size_type result = 0;
+        for (; first != last; first = first->nextLink()) {
+            ++result;
+        }
+        return result;
+    }
+
     bool empty() const;
         // Return 'true' if this container contains no elements, and 'false'
         // otherwise.
@@ -950,6 +1102,30 @@ class unordered_multimap
         // objects matching 'key' then the two returned iterators will have the
         // same value.
 
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<HASH, LOOKUP_KEY>::value
+     && BloombergLP::bslmf::IsTransparentPredicate<EQUAL, LOOKUP_KEY>::value,
+        pair<const_iterator, const_iterator> >::type
+    equal_range(const LOOKUP_KEY& key) const
+        // Return a pair of iterators providing non-modifiable access to the
+        // sequence of 'value_type' objects in this unordered multimap having a
+        // key equivalent to the specified 'key', where the first iterator is
+        // positioned at the start of the sequence, and the second is
+        // positioned one past the end of the sequence.  If this unordered
+        // multimap contains no such 'value_type' object, then the two returned
+        // iterators will have the same value, 'end()'.  This overload
+        // participates in overload resolution only if both 'HASH' and 'EQUAL'
+        // are transparent (see 'find').
+    {
+        typedef bsl::pair<const_iterator, const_iterator> ResultType;
+
+        HashTableLink *first;
+        HashTableLink *last;
+        d_impl.findRangeTransparent(&first, &last, key);
+        return ResultType(const_iterator(first), const_iterator(last));
+    }
+
     const_iterator find(const key_type& key) const;
         // Return an iterator providing non-modifiable access to the first
         // 'value_type' object in the sequence of all the 'value_type' objects
@@ -958,6 +1134,22 @@ class unordered_multimap
         // match 'key', they are guaranteed to be adjacent to each other, and
         // this function will return the first in the sequence.
 
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<HASH, LOOKUP_KEY>::value
+     && BloombergLP::bslmf::IsTransparentPredicate<EQUAL, LOOKUP_KEY>::value,
+        const_iterator>::type
+    find(const LOOKUP_KEY& key) const
+        // Return an iterator providing non-modifiable access to the first
+        // 'value_type' object in this unordered multimap having a key
+        // equivalent to the specified 'key', if such an entry exists, and the
+        // past-the-end iterator ('end') otherwise.  This overload participates
+        // in overload resolution only if both 'HASH' and 'EQUAL' are
+        // transparent (see 'find').
+    {
+        return const_iterator(d_impl.findTransparent(key));
+    }
+
     hasher hash_function() const;
         // Return (a copy of) the hash unary functor used by this container to
         // generate a hash value (of type 'size_t') for a 'key_type' object.
@@ -990,6 +1182,13 @@ class unordered_multimap
 
     size_type size() const;
         // Return the number of elements in this container.
+
+    BloombergLP::bslstl::HashTableStatistics statistics() const;
+        // Return a description of the distribution of the elements of this
+        // container among its buckets, and of the memory used by its
+        // internal data structure (see 'bslstl::HashTableStatistics').  Note
+        // that this operation has linear run-time complexity with respect to
+        // the number of buckets and elements.
 };
 
 template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
@@ -1234,10 +1433,7 @@ void unordered_multimap<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::insert(
         this->reserve(this->size() + maxInsertions);
     }
 
-    while (first != last) {
-        d_impl.insert(*first);
-        ++first;
-    }
+    d_impl.insertBatch(first, last);
 }
 
 template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
@@ -1248,6 +1444,64 @@ void unordered_multimap<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::max_load_factor(
     d_impl.setMaxLoadFactor(newLoadFactor);
 }
 
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+inline
+typename unordered_multimap<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::node_type
+unordered_multimap<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::extract(
+                                                       const_iterator position)
+{
+    BSLS_ASSERT(position != this->end());
+
+    node_type result;
+    d_impl.extractNode(&result, position.node());
+    return result;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+inline
+typename unordered_multimap<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::node_type
+unordered_multimap<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::extract(
+                                                           const key_type& key)
+{
+    node_type result;
+    if (HashTableLink *target = d_impl.find(key)) {
+        d_impl.extractNode(&result, target);
+    }
+    return result;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+inline
+typename unordered_multimap<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::iterator
+unordered_multimap<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::insert(node_type& node)
+{
+    if (node.empty()) {
+        return end();                                                 // RETURN
+    }
+    return iterator(d_impl.insertNode(&node));
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+inline
+typename unordered_multimap<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::iterator
+unordered_multimap<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::insert(
+                                                           const_iterator hint,
+                                                           node_type&     node)
+{
+    if (node.empty()) {
+        return end();                                                 // RETURN
+    }
+    return iterator(d_impl.insertNode(&node, hint.node()));
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+inline
+void unordered_multimap<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::merge(
+                                                    unordered_multimap& source)
+{
+    d_impl.merge(&source.d_impl);
+}
+
 template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
 inline
 void unordered_multimap<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::rehash(
@@ -1390,6 +1644,15 @@ unordered_multimap<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::bucket_size(
     return d_impl.countElementsInBucket(index);
 }
 
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+inline
+bool
+unordered_multimap<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::contains(
+                                                     const key_type& key) const
+{
+    return 0 != d_impl.find(key);
+}
+
 template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
 typename unordered_multimap<KEY, VALUE, HASH, EQUAL, ALLOCATOR>:: size_type
 unordered_multimap<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::count(
@@ -1477,6 +1740,14 @@ unordered_multimap<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::size() const
     return d_impl.size();
 }
 
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+inline
+BloombergLP::bslstl::HashTableStatistics
+unordered_multimap<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::statistics() const
+{
+    return d_impl.statistics();
+}
+
 template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
 bsl::pair<typename unordered_multimap<KEY,
                                       VALUE,
@@ -265,6 +265,14 @@ BSLS_IDENT("$Id: $")
 // the other unordered containers) is the choice of hash function.  Please see
 // the discussion in {'bslstl_unorderedmap'|Practical Requirements on 'HASH'}.
 //
+///Heterogeneous Lookup
+///--------------------
+// As for 'bsl::unordered_map', if both 'HASH' and 'EQUAL' are transparent
+// (i.e., declare the nested type 'is_transparent'), the 'find', 'count',
+// 'equal_range', and 'contains' methods accept a key of any type that the two
+// functors accept, without converting it to 'key_type'.  Please see
+// {'bslstl_unorderedmap'|Heterogeneous Lookup}.
+//
 ///Usage
 ///-----
 // In this section we show intended use of this component.
@@ -586,6 +594,10 @@ BSL_OVERRIDES_STD mode"
 #include <bslstl_iteratorutil.h>
 #endif
 
+#ifndef INCLUDED_BSLSTL_NODEHANDLE
+#include <bslstl_nodehandle.h>
+#endif
+
 #ifndef INCLUDED_BSLSTL_PAIR
 #include <bslstl_pair.h>  // result type of 'equal_range' method
 #endif
@@ -610,10 +622,18 @@ BSL_OVERRIDES_STD mode"
 #include <bslma_usesbslmaallocator.h>
 #endif
 
+#ifndef INCLUDED_BSLMF_ENABLEIF
+#include <bslmf_enableif.h>
+#endif
+
 #ifndef INCLUDED_BSLMF_ISBITWISEMOVEABLE
 #include <bslmf_isbitwisemoveable.h>
 #endif
 
+#ifndef INCLUDED_BSLMF_ISTRANSPARENTPREDICATE
+#include <bslmf_istransparentpredicate.h>
+#endif
+
 #ifndef INCLUDED_BSLMF_NESTEDTRAITDECLARATION
 #include <bslmf_nestedtraitdeclaration.h>
 #endif
@@ -718,6 +738,8 @@ class unordered_multiset
     typedef iterator                                            const_iterator;
     typedef local_iterator                                const_local_iterator;
 
+    typedef typename HashTable::NodeHandleType                      node_type;
+
   private:
     // DATA
     HashTable d_impl;
@@ -859,6 +881,30 @@ class unordered_multiset
         // having 'key', then the two returned iterators will have the same
         // value.
 
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<HASH, LOOKUP_KEY>::value
+     && BloombergLP::bslmf::IsTransparentPredicate<EQUAL, LOOKUP_KEY>::value,
+        pair<iterator, iterator> >::type
+    equal_range(const LOOKUP_KEY& key)
+        // Return a pair of iterators providing modifiable access to the
+        // sequence of elements in this unordered multiset having a key
+        // equivalent to the specified 'key', where the first iterator is
+        // positioned at the start of the sequence, and the second is
+        // positioned one past the end of the sequence.  If this unordered
+        // multiset contains no such element, then the two returned iterators
+        // will have the same value, 'end()'.  This overload participates in
+        // overload resolution only if both 'HASH' and 'EQUAL' are transparent
+        // (see 'find').
+    {
+        typedef bsl::pair<iterator, iterator> ResultType;
+
+        HashTableLink *first;
+        HashTableLink *last;
+        d_impl.findRangeTransparent(&first, &last, key);
+        return ResultType(iterator(first), iterator(last));
+    }
+
     size_type erase(const key_type& key);
         // Remove from this multi-set all 'value_type' objects having the
         // specified 'key', if they exist, and return the number of object
@@ -887,6 +933,26 @@ class unordered_multiset
         // this multi-set having the specified 'key', if such value-elements
         // exist, and the past-the-end ('end') iterator otherwise.
 
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<HASH, LOOKUP_KEY>::value
+     && BloombergLP::bslmf::IsTransparentPredicate<EQUAL, LOOKUP_KEY>::value,
+        iterator>::type
+    find(const LOOKUP_KEY& key)
+        // Return an iterator providing modifiable access to the first element
+        // in this unordered multiset having a key equivalent to the specified
+        // 'key', if such an entry exists, and the past-the-end iterator
+        // ('end') otherwise.  This overload participates in overload
+        // resolution only if both 'HASH' and 'EQUAL' are transparent (i.e.,
+        // declare the nested type 'is_transparent'), in which case 'key' is
+        // passed, without conversion to 'key_type', to the hasher and
+        // comparator of this unordered multiset.  The behavior is undefined
+        // unless 'HASH' returns the same value for 'key' as for every
+        // 'key_type' value that 'EQUAL' considers equivalent to 'key'.
+    {
+        return iterator(d_impl.findTransparent(key));
+    }
+
     iterator insert(const value_type& value);
         // Insert the specified 'value' into multi-set;  if a 'value_type'
         // object having the same key (according to 'key_equal') as 'value'
@@ -927,6 +993,52 @@ class unordered_multiset
         // Set the maximum load factor of this container to the specified
         // 'newLoadFactor'.
 
+    node_type extract(const_iterator position);
+        // Remove from this unordered multiset the 'value_type' object at the
+        // specified 'position', and return a node handle holding that object
+        // (see {'bslstl_nodehandle'}).  The behavior is undefined unless
+        // 'position' refers to a 'value_type' object in this unordered
+        // multiset.  If an exception is thrown, this unordered multiset is
+        // unchanged.  Note that the object is relocated into a detached node
+        // owned by the node handle (see {'bslstl_nodehandle'|Node Ownership}),
+        // without being copied if 'value_type' is bitwise moveable, and that
+        // the node holding it in this unordered multiset is kept for reuse.
+
+    node_type extract(const key_type& key);
+        // Remove from this unordered multiset the first 'value_type' object
+        // having the specified 'key', if it exists, and return a node handle
+        // holding that object; otherwise return an empty node handle with no
+        // other effect.
+
+    iterator insert(node_type& node);
+        // Insert the 'value_type' object held by the specified 'node' into
+        // this unordered multiset (immediately before the first object having
+        // the same key, if any), make 'node' empty, and return an iterator
+        // referring to the newly inserted 'value_type' object, or 'end()' if
+        // 'node' is empty.  Note that the node held by 'node' is linked into
+        // this unordered multiset if 'node.get_allocator() == get_allocator()'
+        // and this unordered multiset has no free node, and that the object is
+        // otherwise relocated into a node of this unordered multiset (see
+        // {'bslstl_nodehandle'|Node Ownership}).
+
+    iterator insert(const_iterator hint, node_type& node);
+        // Insert the 'value_type' object held by the specified 'node' into
+        // this unordered multiset (immediately before the specified 'hint' if
+        // 'hint' refers to an object having the same key), make 'node' empty,
+        // and return an iterator referring to the newly inserted 'value_type'
+        // object, or 'end()' if 'node' is empty.  The behavior is undefined
+        // unless 'hint' is a valid iterator into this unordered multiset.
+
+    void merge(unordered_multiset& source);
+        // Relocate every 'value_type' object of the specified 'source'
+        // unordered multiset into this unordered multiset, leaving 'source'
+        // empty.  This method has no effect if 'source' is this unordered
+        // multiset.  If an exception is thrown, each object is held by exactly
+        // one of the two containers.  Note that no memory is allocated for the
+        // relocated objects (unless the node pool of this unordered multiset
+        // must grow), and none is deallocated, if 'value_type' is bitwise
+        // moveable and 'source.get_allocator() == get_allocator()'.
+
     void rehash(size_type numBuckets);
         // Change the size of the array of buckets maintained by this container
         // to the specified 'numBuckets', and redistribute all the contained
@@ -1000,11 +1112,51 @@ class unordered_multiset
         // specified 'index' in the array of buckets maintained by this
         // container.
 
+    bool contains(const key_type& key) const;
+        // Return 'true' if this unordered multiset contains an element having
+        // the specified 'key', and 'false' otherwise.
+
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<HASH, LOOKUP_KEY>::value
+     && BloombergLP::bslmf::IsTransparentPredicate<EQUAL, LOOKUP_KEY>::value,
+        bool>::type
+    contains(const LOOKUP_KEY& key) const
+        // Return 'true' if this unordered multiset contains an element having
+        // a key equivalent to the specified 'key', and 'false' otherwise.
+        // This overload participates in overload resolution only if both
+        // 'HASH' and 'EQUAL' are transparent (see 'find').
+    {
+        return 0 != d_impl.findTransparent(key);
+    }
+
     size_type count(const key_type& key) const;
         // Return the number of 'value_type' objects within this map having the
         // specified 'key'.  Note that since an unordered set maintains unique
         // keys, the returned value will be either 0 or 1.
 
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<HASH, LOOKUP_KEY>::value
+     && BloombergLP::bslmf::IsTransparentPredicate<EQUAL, LOOKUP_KEY>::value,
+        size_type>::type
+    count(const LOOKUP_KEY& key) const
+        // Return the number of elements contained within this unordered
+        // multiset having a key equivalent to the specified 'key'.  This
+        // overload participates in overload resolution only if both 'HASH' and
+        // 'EQUAL' are transparent (see 'find').
+    {
+        HashTableLink *first;
+        HashTableLink *last;
+        d_impl.findRangeTransparent(&first, &last, key);
+
+        size_type result = 0;
+        for (; first != last; first = first->nextLink()) {
+            ++result;
+        }
+        return result;
+    }
+
     bool empty() const;
         // Return 'true' if multi-set contains no elements, and 'false'
         // otherwise.
@@ -1020,12 +1172,52 @@ class unordered_multiset
         // same value.  Note that since a set maintains unique keys, the range
         // will contain at most one element.
 
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<HASH, LOOKUP_KEY>::value
+     && BloombergLP::bslmf::IsTransparentPredicate<EQUAL, LOOKUP_KEY>::value,
+        pair<const_iterator, const_iterator> >::type
+    equal_range(const LOOKUP_KEY& key) const
+        // Return a pair of iterators providing non-modifiable access to the
+        // sequence of elements in this unordered multiset having a key
+        // equivalent to the specified 'key', where the first iterator is
+        // positioned at the start of the sequence, and the second is
+        // positioned one past the end of the sequence.  If this unordered
+        // multiset contains no such element, then the two returned iterators
+        // will have the same value, 'end()'.  This overload participates in
+        // overload resolution only if both 'HASH' and 'EQUAL' are transparent
+        // (see 'find').
+    {
+        typedef bsl::pair<const_iterator, const_iterator> ResultType;
+
+        HashTableLink *first;
+        HashTableLink *last;
+        d_impl.findRangeTransparent(&first, &last, key);
+        return ResultType(const_iterator(first), const_iterator(last));
+    }
+
     const_iterator find(const key_type& key) const;
         // Return an iterator providing non-modifiable access to the first
         // 'value_type' objects in the sequence of value-elements of this
         // multi-set having the specified 'key', if such value-elements exist,
         // and the past-the-end ('end') iterator otherwise.
 
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<HASH, LOOKUP_KEY>::value
+     && BloombergLP::bslmf::IsTransparentPredicate<EQUAL, LOOKUP_KEY>::value,
+        const_iterator>::type
+    find(const LOOKUP_KEY& key) const
+        // Return an iterator providing non-modifiable access to the first
+        // element in this unordered multiset having a key equivalent to the
+        // specified 'key', if such an entry exists, and the past-the-end
+        // iterator ('end') otherwise.  This overload participates in overload
+        // resolution only if both 'HASH' and 'EQUAL' are transparent (see
+        // 'find').
+    {
+        return const_iterator(d_impl.findTransparent(key));
+    }
+
     allocator_type get_allocator() const;
         // Return (a copy of) the allocator used for memory allocation by this
         // set.
@@ -1067,6 +1259,13 @@ class unordered_multiset
     size_type size() const;
         // Return the number of elements in multi-set.
 
+    BloombergLP::bslstl::HashTableStatistics statistics() const;
+        // Return a description of the distribution of the elements of this
+        // multi-set among its buckets, and of the memory used by its
+        // internal data structure (see 'bslstl::HashTableStatistics').  Note
+        // that this operation has linear run-time complexity with respect to
+        // the number of buckets and elements.
+
     // FRIEND
     template <class KEY2,
               class HASH2,
@@ -1210,6 +1409,14 @@ unordered_multiset<KEY, HASH, EQUAL, ALLOCATOR>::size() const
     return d_impl.size();
 }
 
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+BloombergLP::bslstl::HashTableStatistics
+unordered_multiset<KEY, HASH, EQUAL, ALLOCATOR>::statistics() const
+{
+    return d_impl.statistics();
+}
+
 template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
 typename unordered_multiset<KEY, HASH, EQUAL, ALLOCATOR>::size_type
 unordered_multiset<KEY, HASH, EQUAL, ALLOCATOR>::max_size() const
@@ -1364,10 +1571,7 @@ unordered_multiset<KEY, HASH, EQUAL, ALLOCATOR>::insert(INPUT_ITERATOR first,
         this->reserve(this->size() + maxInsertions);
     }
 
-    while (first != last) {
-        d_impl.insert(*first);
-        ++first;
-    }
+    d_impl.insertBatch(first, last);
 }
 
 template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
@@ -1378,6 +1582,62 @@ void unordered_multiset<KEY, HASH, EQUAL, ALLOCATOR>::max_load_factor(
     d_impl.setMaxLoadFactor(newLoadFactor);
 }
 
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+typename unordered_multiset<KEY, HASH, EQUAL, ALLOCATOR>::node_type
+unordered_multiset<KEY, HASH, EQUAL, ALLOCATOR>::extract(
+                                                       const_iterator position)
+{
+    BSLS_ASSERT(position != this->end());
+
+    node_type result;
+    d_impl.extractNode(&result, position.node());
+    return result;
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+typename unordered_multiset<KEY, HASH, EQUAL, ALLOCATOR>::node_type
+unordered_multiset<KEY, HASH, EQUAL, ALLOCATOR>::extract(const key_type& key)
+{
+    node_type result;
+    if (HashTableLink *target = d_impl.find(key)) {
+        d_impl.extractNode(&result, target);
+    }
+    return result;
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+typename unordered_multiset<KEY, HASH, EQUAL, ALLOCATOR>::iterator
+unordered_multiset<KEY, HASH, EQUAL, ALLOCATOR>::insert(node_type& node)
+{
+    if (node.empty()) {
+        return end();                                                 // RETURN
+    }
+    return iterator(d_impl.insertNode(&node));
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+typename unordered_multiset<KEY, HASH, EQUAL, ALLOCATOR>::iterator
+unordered_multiset<KEY, HASH, EQUAL, ALLOCATOR>::insert(const_iterator hint,
+                                                        node_type&     node)
+{
+    if (node.empty()) {
+        return end();                                                 // RETURN
+    }
+    return iterator(d_impl.insertNode(&node, hint.node()));
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+void unordered_multiset<KEY, HASH, EQUAL, ALLOCATOR>::merge(
+                                                    unordered_multiset& source)
+{
+    d_impl.merge(&source.d_impl);
+}
+
 template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
 inline
 void
@@ -1502,6 +1762,15 @@ unordered_multiset<KEY, HASH, EQUAL, ALLOCATOR>::bucket_size(
     return d_impl.countElementsInBucket(index);
 }
 
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+bool
+unordered_multiset<KEY, HASH, EQUAL, ALLOCATOR>::contains(
+                                                     const key_type& key) const
+{
+    return 0 != d_impl.find(key);
+}
+
 template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
 typename unordered_multiset<KEY, HASH, EQUAL, ALLOCATOR>::size_type
 unordered_multiset<KEY, HASH, EQUAL, ALLOCATOR>::count(
@@ -2,7 +2,10 @@
 
 #include <bslstl_unorderedmultiset.h>
 
+#include <bslstl_equalto.h>
 #include <bslstl_iterator.h>  // for testing only
+#include <bslstl_string.h>
+#include <bslstl_stringref.h>
 
 #include <bslalg_rangecompare.h>
 #include <bslalg_swaputil.h>
@@ -16,6 +19,7 @@
 
 #include <bslmf_haspointersemantics.h>
 #include <bslmf_issame.h>
+#include <bslmf_istransparentpredicate.h>
 
 #include <bsls_asserttest.h>
 #include <bsls_bsltestutil.h>
@@ -162,10 +166,25 @@ using namespace BloombergLP;
 // [ 5] bool operator!=(u_multiset<K, H, E, A>& a, u_multiset<K, H, E, A>& b);
 // [ 8] void swap(u_multiset<K, H, E, A>& a, u_multiset<K, H, E, A>& b);
 //
+// transparent lookup:
+// [16] iterator find(const LOOKUP_KEY& key);
+// [16] pair<iterator, iterator> equal_range(const LOOKUP_KEY& key);
+// [16] bool contains(const key_type& key) const;
+// [16] bool contains(const LOOKUP_KEY& key) const;
+// [16] size_type count(const LOOKUP_KEY& key) const;
+// [16] pair<CIter, CIter> equal_range(const LOOKUP_KEY& key) const;
+// [16] const_iterator find(const LOOKUP_KEY& key) const;
+// [17] bslstl::HashTableStatistics statistics() const;
+//
+// [18] node_type extract(const_iterator position);
+// [18] node_type extract(const key_type& key);
+// [18] iterator insert(node_type& node);
+// [18] iterator insert(const_iterator hint, node_type& node);
+// [18] void merge(unordered_multiset& source);
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
 // [ 2] default construction (only)
-// [ 5] USAGE EXAMPLE
+// [19] USAGE EXAMPLE
 //
 // TEST APPARATUS: GENERATOR FUNCTIONS
 // [ 3] int ggg(unordered_multiset<T,H,E,A> *o, const char *s, int verbose);
@@ -285,6 +304,18 @@ const DefaultDataRow DEFAULT_DATA[] = {
 };
 static const int DEFAULT_NUM_DATA = sizeof DEFAULT_DATA / sizeof *DEFAULT_DATA;
 
+struct TestTypeDataHash {
+    // This 'struct' provides a hash functor for objects of the 'bsltf' test
+    // types, hashing the value of their 'data' attribute.
+
+    template <class TYPE>
+    size_t operator()(const TYPE& value) const
+        // Return a hash code for the specified 'value'.
+    {
+        return static_cast<size_t>(value.data());
+    }
+};
+
 //=============================================================================
 //                              TEST SUPPORT
 //-----------------------------------------------------------------------------
@@ -4529,7 +4560,7 @@ int main(int argc, char *argv[])
     bslma::Default::setDefaultAllocator(&testAlloc);
 
     switch (test) { case 0:
-      case 16: {
+      case 19: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //
@@ -4682,6 +4713,360 @@ int main(int argc, char *argv[])
 // See the material in {'bslstl_unorderedmap'|Example 2}.
 
       } break;
+      case 18: {
+        // --------------------------------------------------------------------
+        // TESTING NODE HANDLES
+        //
+        // Concerns:
+        //: 1 'extract' removes the element at a position, or having a key,
+        //:   and returns a handle holding that element and the allocator of
+        //:   the container; extracting a missing key yields an empty handle.
+        //:
+        //: 2 'insert' inserts the element held by a handle, and empties the
+        //:   handle.  Inserting an empty handle has no effect.
+        //:
+        //: 3 An element held by a handle is inserted into a container using
+        //:   the same allocator without allocating memory, even if the
+        //:   container it was extracted from has been destroyed.
+        //:
+        //: 4 'merge' moves every element of the source, including when the
+        //:   two containers use different allocators, and the moved elements
+        //:   then use the allocator of the target.
+        //:
+        //: 5 Merging a container with itself has no effect.
+        //:
+        //: 6 No memory is leaked.
+        //
+        // Plan:
+        //: 1 Extract elements from a container, and insert them into the same
+        //:   and another container, verifying the sizes of the containers, the
+        //:   state of the handles, and (using a test allocator monitor) that
+        //:   no memory is allocated by 'insert'.  Repeat with a handle
+        //:   outliving the container it was extracted from.  (C-1..3)
+        //:
+        //: 2 Merge containers using the same and different allocators, and
+        //:   verify the sizes of the containers and the allocators of the
+        //:   moved elements.  (C-4..5)
+        //:
+        //: 3 Verify that no memory is in use once the containers are
+        //:   destroyed.  (C-6)
+        //
+        // Testing:
+        //   node_type extract(const_iterator position);
+        //   node_type extract(const key_type& key);
+        //   iterator insert(node_type& node);
+        //   iterator insert(const_iterator hint, node_type& node);
+        //   void merge(unordered_multiset& source);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING NODE HANDLES"
+                            "\n====================\n");
+
+        typedef bsltf::AllocBitwiseMoveableTestType                Element;
+        typedef bsl::unordered_multiset<Element, TestTypeDataHash> Obj;
+        typedef Obj::node_type                                     Handle;
+
+        const int NUM_VALUES = 8;
+
+        bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+        bslma::TestAllocator za("other",   veryVeryVeryVerbose);
+        bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+            Obj mY(&oa);  const Obj& Y = mY;
+            Obj mZ(&za);  const Obj& Z = mZ;
+
+            for (int i = 0; i != NUM_VALUES; ++i) {
+                mX.insert(Element(i, &sa));
+                if (i % 2) {
+                    mY.insert(Element(i, &sa));
+                }
+                if (i >= NUM_VALUES - 2) {
+                    mZ.insert(Element(i, &sa));
+                    mZ.insert(Element(i + 2, &sa));
+                }
+            }
+            ASSERTV(Z.size(), 4 == Z.size());
+
+            if (verbose) printf("Testing 'extract'.\n");
+
+            Handle mH = mX.extract(X.find(Element(0, &sa)));
+            const Handle& H = mH;
+            ASSERT(!H.empty());
+            ASSERTV(H.value().data(), 0 == H.value().data());
+            ASSERT(X.get_allocator() == H.get_allocator());
+            ASSERTV(X.size(), NUM_VALUES - 1 == X.size());
+            ASSERT(X.end() == X.find(Element(0, &sa)));
+
+            Handle mG(mX.extract(Element(1, &sa)));  const Handle& G = mG;
+            ASSERT(!G.empty());
+            ASSERTV(G.value().data(), 1 == G.value().data());
+            ASSERTV(X.size(), NUM_VALUES - 2 == X.size());
+
+            ASSERT(mX.extract(Element(1, &sa)).empty());
+            ASSERTV(X.size(), NUM_VALUES - 2 == X.size());
+
+            if (verbose) printf("Testing 'insert'.\n");
+
+            const Obj::size_type SIZE_Y = Y.size();
+
+            Obj::iterator it = mY.insert(mG);
+            ASSERTV(it->data(), 1 == it->data());
+            ASSERT(G.empty());
+            ASSERTV(Y.size(), SIZE_Y + 1 == Y.size());
+            ASSERTV(Y.count(Element(1, &sa)), 2 == Y.count(Element(1, &sa)));
+
+            // 'X' uses the same allocator as 'H'.
+
+            bslma::TestAllocatorMonitor oam(&oa);
+
+            Obj::iterator hintResult = mX.insert(X.begin(), mH);
+            ASSERTV(hintResult->data(), 0 == hintResult->data());
+            ASSERT(H.empty());
+            ASSERTV(X.size(), NUM_VALUES - 1 == X.size());
+
+            ASSERT(oam.isTotalSame());
+
+            Handle mE;
+            ASSERT(X.end() == mX.insert(mE));
+
+            ASSERT(X.end() == mX.insert(X.begin(), mE));
+
+            // A handle keeps its node after the container is destroyed.
+
+            {
+                Obj mW(&oa);
+                mW.insert(Element(-1, &sa));
+
+                mH = mW.extract(Element(-1, &sa));
+            }
+            ASSERTV(H.value().data(), -1 == H.value().data());
+
+            oam.reset();
+            it = mX.insert(mH);
+            ASSERT(oam.isTotalSame());
+
+            mX.erase(Element(-1, &sa));
+
+            if (verbose) printf("Testing 'merge'.\n");
+
+            const Obj::size_type SIZE_X = X.size();
+
+            mX.merge(mX);
+            ASSERTV(X.size(), SIZE_X == X.size());
+
+            mX.merge(mZ);
+            ASSERTV(X.size(), SIZE_X + 4 == X.size());
+            ASSERTV(Z.size(), 0 == Z.size());
+            ASSERT(&oa == X.find(Element(NUM_VALUES, &sa))->allocator());
+            ASSERT(&oa == X.find(Element(NUM_VALUES + 1, &sa))->allocator());
+
+            mY.merge(mX);
+            ASSERTV(Y.size(), SIZE_Y + 1 + SIZE_X + 4 == Y.size());
+            ASSERTV(X.size(), 0 == X.size());
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+        ASSERTV(za.numBlocksInUse(), 0 == za.numBlocksInUse());
+      } break;
+      case 17: {
+        // --------------------------------------------------------------------
+        // TESTING 'statistics'
+        //
+        // Concerns:
+        //: 1 'statistics' reports the statistics of the underlying hash
+        //:   table, consistent with 'size', 'bucket_count', and
+        //:   'bucket_size'.
+        //
+        // Plan:
+        //: 1 Insert a sequence of values into a container, and after each
+        //:   insertion compare the statistics with values computed using
+        //:   'bucket_size'.  (C-1)
+        //
+        // Testing:
+        //   bslstl::HashTableStatistics statistics() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING 'statistics'"
+                            "\n====================\n");
+
+        typedef bsl::unordered_multiset<int> Obj;
+        typedef bslstl::HashTableStatistics Stats;
+
+        const int NUM_VALUES = 50;
+
+        bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+
+        Obj mX(&oa);  const Obj& X = mX;
+
+        for (int i = 0; i != NUM_VALUES; ++i) {
+            mX.insert(i);
+            mX.insert(i);
+
+            const Stats S = X.statistics();
+            ASSERTV(i, S.d_numElements, X.size() == S.d_numElements);
+            ASSERTV(i, S.d_numBuckets,  X.bucket_count() == S.d_numBuckets);
+
+            Obj::size_type numEmpty  = 0;
+            Obj::size_type maxLength = 0;
+            for (Obj::size_type b = 0; b != X.bucket_count(); ++b) {
+                const Obj::size_type length = X.bucket_size(b);
+                numEmpty  += 0 == length;
+                maxLength  = maxLength < length ? length : maxLength;
+            }
+            ASSERTV(i, S.d_numEmptyBuckets, numEmpty == S.d_numEmptyBuckets);
+            ASSERTV(i, S.d_maxChainLength, maxLength == S.d_maxChainLength);
+            ASSERTV(i, S.d_nodeBytes,        0 < S.d_nodeBytes);
+            ASSERTV(i, S.d_bucketArrayBytes, 0 < S.d_bucketArrayBytes);
+        }
+
+        // Each key is held twice, in the same bucket.
+
+        ASSERTV(X.statistics().d_maxChainLength,
+                2 <= X.statistics().d_maxChainLength);
+
+#if !defined(BSLSTL_HASHTABLE_DISABLE_STATISTICS)
+        ASSERTV(X.statistics().d_numRehashes,
+                0 < X.statistics().d_numRehashes);
+#endif
+      } break;
+      case 16: {
+        // --------------------------------------------------------------------
+        // TESTING TRANSPARENT LOOKUP
+        //
+        // Concerns:
+        //: 1 When both 'HASH' and 'EQUAL' are transparent, 'find', 'count',
+        //:   'equal_range', and 'contains' accept a 'const char *' or a
+        //:   'bslstl::StringRef' key without creating a temporary 'key_type'.
+        //:
+        //: 2 A lookup using a key of another type returns the same result as a
+        //:   lookup using the equivalent 'key_type' value, both for keys that
+        //:   are present and keys that are absent.
+        //:
+        //: 3 When 'HASH' and 'EQUAL' are not transparent, a 'const char *' key
+        //:   is still accepted (by conversion to 'key_type').
+        //
+        // Plan:
+        //: 1 Populate a container using 'bsl::hash<bsl::string>' and
+        //:   'bsl::equal_to<>' with strings too long for the short string
+        //:   buffer.  Look up each key, and an absent key, as a 'bsl::string',
+        //:   a 'const char *', and a 'bslstl::StringRef', comparing the
+        //:   results, and verifying that the default allocator is not used by
+        //:   the heterogeneous lookups.  (C-1..2)
+        //:
+        //: 2 Repeat the lookups using a 'const char *' on a container with
+        //:   the default (non-transparent) functors.  (C-3)
+        //
+        // Testing:
+        //   iterator find(const LOOKUP_KEY& key);
+        //   pair<iterator, iterator> equal_range(const LOOKUP_KEY& key);
+        //   bool contains(const key_type& key) const;
+        //   bool contains(const LOOKUP_KEY& key) const;
+        //   size_type count(const LOOKUP_KEY& key) const;
+        //   pair<CIter, CIter> equal_range(const LOOKUP_KEY& key) const;
+        //   const_iterator find(const LOOKUP_KEY& key) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING TRANSPARENT LOOKUP"
+                            "\n==========================\n");
+
+        typedef bsl::unordered_multiset<bsl::string,
+                                        bsl::hash<bsl::string>,
+                                        bsl::equal_to<> > Obj;
+        typedef bsl::unordered_multiset<bsl::string> PlainObj;
+
+        static const char *const KEYS[] = {
+            "the first key, too long for the short string buffer",
+            "the second key, too long for the short string buffer",
+            "the third key, too long for the short string buffer",
+            "the fourth key, too long for the short string buffer",
+        };
+        const int NUM_KEYS = static_cast<int>(sizeof KEYS / sizeof *KEYS);
+
+        const char ABSENT[] = "an absent key, too long for the short string";
+
+        bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+        bslma::TestAllocator da("default", veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        if (verbose) printf("\nTesting with transparent functors.\n");
+        {
+            ASSERT((bslmf::IsTransparentPredicate<Obj::hasher,
+                                                  const char *>::value));
+            ASSERT((bslmf::IsTransparentPredicate<Obj::key_equal,
+                                                  const char *>::value));
+
+            Obj mX(&oa);  const Obj& X = mX;
+            for (int i = 0; i < NUM_KEYS; ++i) {
+                mX.insert(KEYS[i]);
+            mX.insert(KEYS[i]);    // every key is held twice
+            }
+
+            const bsl::string absent(ABSENT, &oa);
+
+            bslma::TestAllocatorMonitor dam(&da);
+
+            for (int i = 0; i < NUM_KEYS; ++i) {
+                const bsl::string       STRING(KEYS[i], &oa);
+                const char             *CSTR = KEYS[i];
+                const bslstl::StringRef REF(STRING);
+
+                const Obj::iterator EXP = mX.find(STRING);
+                ASSERTV(i, X.end() != EXP);
+
+                ASSERTV(i, EXP == mX.find(CSTR));
+                ASSERTV(i, EXP == mX.find(REF));
+                ASSERTV(i, EXP == X.find(CSTR));
+                ASSERTV(i, EXP == X.find(REF));
+
+                ASSERTV(i, 2 == X.count(STRING));
+                ASSERTV(i, 2 == X.count(CSTR));
+                ASSERTV(i, 2 == X.count(REF));
+
+                ASSERTV(i, X.contains(STRING));
+                ASSERTV(i, X.contains(CSTR));
+                ASSERTV(i, X.contains(REF));
+
+                ASSERTV(i, mX.equal_range(STRING) == mX.equal_range(CSTR));
+                ASSERTV(i, mX.equal_range(STRING) == mX.equal_range(REF));
+                ASSERTV(i, X.equal_range(STRING)  == X.equal_range(CSTR));
+                ASSERTV(i, X.equal_range(STRING)  == X.equal_range(REF));
+            }
+
+            const char              *CSTR = ABSENT;
+            const bslstl::StringRef  REF(ABSENT);
+
+            ASSERT(X.end() == mX.find(CSTR));
+            ASSERT(X.end() == X.find(REF));
+            ASSERT(0       == X.count(CSTR));
+            ASSERT(!X.contains(absent));
+            ASSERT(!X.contains(REF));
+            ASSERT(mX.equal_range(absent) == mX.equal_range(CSTR));
+            ASSERT(X.equal_range(absent)  == X.equal_range(REF));
+
+            ASSERTV(da.numBlocksInUse(), dam.isTotalSame());
+        }
+
+        if (verbose) printf("\nTesting with non-transparent functors.\n");
+        {
+            ASSERT(!(bslmf::IsTransparentPredicate<PlainObj::key_equal,
+                                                   const char *>::value));
+
+            PlainObj mX(&oa);  const PlainObj& X = mX;
+            for (int i = 0; i < NUM_KEYS; ++i) {
+                mX.insert(KEYS[i]);
+            }
+
+            for (int i = 0; i < NUM_KEYS; ++i) {
+                const char *CSTR = KEYS[i];
+
+                ASSERTV(i, X.end() != X.find(CSTR));
+                ASSERTV(i, 1       == X.count(CSTR));
+                ASSERTV(i, X.contains(CSTR));
+            }
+            ASSERT(X.end() == X.find(ABSENT));
+            ASSERT(!X.contains(ABSENT));
+        }
+      } break;
       case 15: {
         // --------------------------------------------------------------------
         // TESTING HASH_FUNCTION AND KEY_EQ
@@ -262,6 +262,14 @@ BSLS_IDENT("$Id: $")
 // other unordered containers) is the choice of hash function.  Please see the
 // discussion in {'bslstl_unorderedmap'|Practical Requirements on 'HASH'}.
 //
+///Heterogeneous Lookup
+///--------------------
+// As for 'bsl::unordered_map', if both 'HASH' and 'EQUAL' are transparent
+// (i.e., declare the nested type 'is_transparent'), the 'find', 'count',
+// 'equal_range', and 'contains' methods accept a key of any type that the two
+// functors accept, without converting it to 'key_type'.  Please see
+// {'bslstl_unorderedmap'|Heterogeneous Lookup}.
+//
 ///Usage
 ///-----
 // In this section we show intended use of this component.
@@ -538,6 +546,10 @@ BSL_OVERRIDES_STD mode"
 #include <bslstl_iteratorutil.h>
 #endif
 
+#ifndef INCLUDED_BSLSTL_NODEHANDLE
+#include <bslstl_nodehandle.h>
+#endif
+
 #ifndef INCLUDED_BSLSTL_PAIR
 #include <bslstl_pair.h>  // result type of 'equal_range' method
 #endif
@@ -558,10 +570,18 @@ BSL_OVERRIDES_STD mode"
 #include <bslma_usesbslmaallocator.h>
 #endif
 
+#ifndef INCLUDED_BSLMF_ENABLEIF
+#include <bslmf_enableif.h>
+#endif
+
 #ifndef INCLUDED_BSLMF_ISBITWISEMOVEABLE
 #include <bslmf_isbitwisemoveable.h>
 #endif
 
+#ifndef INCLUDED_BSLMF_ISTRANSPARENTPREDICATE
+#include <bslmf_istransparentpredicate.h>
+#endif
+
 #ifndef INCLUDED_BSLMF_NESTEDTRAITDECLARATION
 #include <bslmf_nestedtraitdeclaration.h>
 #endif
@@ -666,6 +686,8 @@ class unordered_set
     typedef iterator                                            const_iterator;
     typedef local_iterator                                const_local_iterator;
 
+    typedef typename HashTable::NodeHandleType                      node_type;
+
   private:
     // DATA
     HashTable  d_impl;
@@ -806,6 +828,29 @@ class unordered_set
         // same value.  Note that since a set maintains unique keys, the range
         // will contain at most one element.
 
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<HASH, LOOKUP_KEY>::value
+     && BloombergLP::bslmf::IsTransparentPredicate<EQUAL, LOOKUP_KEY>::value,
+        pair<iterator, iterator> >::type
+    equal_range(const LOOKUP_KEY& key)
+        // Return a pair of iterators providing modifiable access to the
+        // sequence of elements in this unordered set having a key equivalent
+        // to the specified 'key', where the first iterator is positioned at
+        // the start of the sequence, and the second is positioned one past the
+        // end of the sequence.  If this unordered set contains no such
+        // element, then the two returned iterators will have the same value,
+        // 'end()'.  This overload participates in overload resolution only if
+        // both 'HASH' and 'EQUAL' are transparent (see 'find').
+    {
+        typedef bsl::pair<iterator, iterator> ResultType;
+
+        HashTableLink *first = d_impl.findTransparent(key);
+        return first
+             ? ResultType(iterator(first), iterator(first->nextLink()))
+             : ResultType(end(), end());
+    }
+
     size_type erase(const key_type& key);
         // Remove from this set the 'value_type' object having the specified
         // 'key', if it exists, and return 1; otherwise, if there is no
@@ -833,6 +878,26 @@ class unordered_set
         // object in this set having the specified 'key', if such an entry
         // exists, and the past-the-end ('end') iterator otherwise.
 
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<HASH, LOOKUP_KEY>::value
+     && BloombergLP::bslmf::IsTransparentPredicate<EQUAL, LOOKUP_KEY>::value,
+        iterator>::type
+    find(const LOOKUP_KEY& key)
+        // Return an iterator providing modifiable access to the element in
+        // this unordered set having a key equivalent to the specified 'key',
+        // if such an entry exists, and the past-the-end iterator ('end')
+        // otherwise.  This overload participates in overload resolution only
+        // if both 'HASH' and 'EQUAL' are transparent (i.e., declare the nested
+        // type 'is_transparent'), in which case 'key' is passed, without
+        // conversion to 'key_type', to the hasher and comparator of this
+        // unordered set.  The behavior is undefined unless 'HASH' returns the
+        // same value for 'key' as for every 'key_type' value that 'EQUAL'
+        // considers equivalent to 'key'.
+    {
+        return iterator(d_impl.findTransparent(key));
+    }
+
     pair<iterator, bool> insert(const value_type& value);
         // Insert the specified 'value' into this set if the key (the 'first'
         // element) of the 'value' does not already exist in this set;
@@ -878,6 +943,59 @@ class unordered_set
         // Set the maximum load factor of this container to the specified
         // 'newLoadFactor'.
 
+    node_type extract(const_iterator position);
+        // Remove from this unordered set the 'value_type' object at the
+        // specified 'position', and return a node handle holding that object
+        // (see {'bslstl_nodehandle'}).  The behavior is undefined unless
+        // 'position' refers to a 'value_type' object in this unordered set.
+        // If an exception is thrown, this unordered set is unchanged.  Note
+        // that the object is relocated into a detached node owned by the node
+        // handle (see {'bslstl_nodehandle'|Node Ownership}), without being
+        // copied if 'value_type' is bitwise moveable, and that the node
+        // holding it in this unordered set is kept for reuse.
+
+    node_type extract(const key_type& key);
+        // Remove from this unordered set the 'value_type' object having the
+        // specified 'key', if it exists, and return a node handle holding that
+        // object; otherwise return an empty node handle with no other effect.
+
+    pair<iterator, bool> insert(node_type& node);
+        // Insert the 'value_type' object held by the specified 'node' into
+        // this unordered set, and make 'node' empty, if the key of that object
+        // does not already exist in this unordered set; otherwise, leave
+        // 'node' unchanged.  Return a 'pair' whose 'first' member is an
+        // iterator referring to the (possibly newly inserted) 'value_type'
+        // object in this unordered set whose key is the same as that of the
+        // object held by 'node', and whose 'second' member is 'true' if the
+        // object was inserted, and 'false' otherwise.  If 'node' is empty,
+        // return '(end(), false)' with no other effect.  Note that, if
+        // 'node.get_allocator() == get_allocator()', the node is linked into
+        // this unordered set without moving the object or allocating memory,
+        // so that references to the object remain valid; otherwise, the object
+        // is relocated into a new node.
+
+    iterator insert(const_iterator hint, node_type& node);
+        // Insert the 'value_type' object held by the specified 'node' into
+        // this unordered set, and make 'node' empty, if the key of that object
+        // does not already exist in this unordered set; otherwise, leave
+        // 'node' unchanged.  Return an iterator referring to the (possibly
+        // newly inserted) 'value_type' object in this unordered set whose key
+        // is the same as that of the object held by 'node', or 'end()' if
+        // 'node' is empty.  The behavior is undefined unless the specified
+        // 'hint' is a valid iterator into this unordered set.  Note that
+        // 'hint' is not used by this method.
+
+    void merge(unordered_set& source);
+        // Relocate into this unordered set each 'value_type' object of the
+        // specified 'source' unordered set whose key does not already exist in
+        // this unordered set; the objects whose keys already exist remain in
+        // 'source'.  This method has no effect if 'source' is this unordered
+        // set.  If an exception is thrown, each object is held by exactly one
+        // of the two containers.  Note that no memory is allocated for the
+        // relocated objects (unless the node pool of this unordered set must
+        // grow), and none is deallocated, if 'value_type' is bitwise moveable
+        // and 'source.get_allocator() == get_allocator()'.
+
     void rehash(size_type numBuckets);
         // Change the size of the array of buckets maintained by this container
         // to the specified 'numBuckets', and redistribute all the contained
@@ -949,11 +1067,43 @@ class unordered_set
         // specified 'index' in the array of buckets maintained by this
         // container.
 
+    bool contains(const key_type& key) const;
+        // Return 'true' if this unordered set contains an element having the
+        // specified 'key', and 'false' otherwise.
+
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<HASH, LOOKUP_KEY>::value
+     && BloombergLP::bslmf::IsTransparentPredicate<EQUAL, LOOKUP_KEY>::value,
+        bool>::type
+    contains(const LOOKUP_KEY& key) const
+        // Return 'true' if this unordered set contains an element having a key
+        // equivalent to the specified 'key', and 'false' otherwise.  This
+        // overload participates in overload resolution only if both 'HASH' and
+        // 'EQUAL' are transparent (see 'find').
+    {
+        return 0 != d_impl.findTransparent(key);
+    }
+
     size_type count(const key_type& key) const;
         // Return the number of 'value_type' objects within this map having the
         // specified 'key'.  Note that since an unordered set maintains unique
         // keys, the returned value will be either 0 or 1.
 
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<HASH, LOOKUP_KEY>::value
+     && BloombergLP::bslmf::IsTransparentPredicate<EQUAL, LOOKUP_KEY>::value,
+        size_type>::type
+    count(const LOOKUP_KEY& key) const
+        // Return the number of elements contained within this unordered set
+        // having a key equivalent to the specified 'key'.  This overload
+        // participates in overload resolution only if both 'HASH' and 'EQUAL'
+        // are transparent (see 'find').
+    {
+        return 0 != d_impl.findTransparent(key);
+    }
+
     bool empty() const;
         // Return 'true' if this set contains no elements, and 'false'
         // otherwise.
@@ -969,11 +1119,50 @@ class unordered_set
         // same value.  Note that since a set maintains unique keys, the range
         // will contain at most one element.
 
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<HASH, LOOKUP_KEY>::value
+     && BloombergLP::bslmf::IsTransparentPredicate<EQUAL, LOOKUP_KEY>::value,
+        pair<const_iterator, const_iterator> >::type
+    equal_range(const LOOKUP_KEY& key) const
+        // Return a pair of iterators providing non-modifiable access to the
+        // sequence of elements in this unordered set having a key equivalent
+        // to the specified 'key', where the first iterator is positioned at
+        // the start of the sequence, and the second is positioned one past the
+        // end of the sequence.  If this unordered set contains no such
+        // element, then the two returned iterators will have the same value,
+        // 'end()'.  This overload participates in overload resolution only if
+        // both 'HASH' and 'EQUAL' are transparent (see 'find').
+    {
+        typedef bsl::pair<const_iterator, const_iterator> ResultType;
+
+        HashTableLink *first = d_impl.findTransparent(key);
+        return first
+             ? ResultType(const_iterator(first),
+                          const_iterator(first->nextLink()))
+             : ResultType(end(), end());
+    }
+
     const_iterator find(const key_type& key) const;
         // Return an iterator providing non-modifiable access to the
         // 'value_type' object in this set having the specified 'key', if such
         // an entry exists, and the past-the-end ('end') iterator otherwise.
 
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<HASH, LOOKUP_KEY>::value
+     && BloombergLP::bslmf::IsTransparentPredicate<EQUAL, LOOKUP_KEY>::value,
+        const_iterator>::type
+    find(const LOOKUP_KEY& key) const
+        // Return an iterator providing non-modifiable access to the element in
+        // this unordered set having a key equivalent to the specified 'key',
+        // if such an entry exists, and the past-the-end iterator ('end')
+        // otherwise.  This overload participates in overload resolution only
+        // if both 'HASH' and 'EQUAL' are transparent (see 'find').
+    {
+        return const_iterator(d_impl.findTransparent(key));
+    }
+
     allocator_type get_allocator() const;
         // Return (a copy of) the allocator used for memory allocation by this
         // set.
@@ -1014,6 +1203,13 @@ class unordered_set
 
     size_type size() const;
         // Return the number of elements in this set.
+
+    BloombergLP::bslstl::HashTableStatistics statistics() const;
+        // Return a description of the distribution of the elements of this
+        // set among its buckets, and of the memory used by its internal data
+        // structure (see 'bslstl::HashTableStatistics').  Note that this
+        // operation has linear run-time complexity with respect to the number
+        // of buckets and elements.
 };
 
 // FREE FUNCTIONS
@@ -1294,12 +1490,7 @@ void unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::insert(INPUT_ITERATOR first,
         this->reserve(this->size() + maxInsertions);
     }
 
-    bool isInsertedFlag;  // value is not used
-
-    while (first != last) {
-        d_impl.insertIfMissing(&isInsertedFlag, *first);
-        ++first;
-    }
+    d_impl.insertIfMissingBatch(first, last);
 }
 
 template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
@@ -1310,6 +1501,67 @@ void unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::max_load_factor(
     d_impl.setMaxLoadFactor(newLoadFactor);
 }
 
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+typename unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::node_type
+unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::extract(const_iterator position)
+{
+    BSLS_ASSERT(position != this->end());
+
+    node_type result;
+    d_impl.extractNode(&result, position.node());
+    return result;
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+typename unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::node_type
+unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::extract(const key_type& key)
+{
+    node_type result;
+    if (HashTableLink *target = d_impl.find(key)) {
+        d_impl.extractNode(&result, target);
+    }
+    return result;
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+bsl::pair<typename unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::iterator, bool>
+unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::insert(node_type& node)
+{
+    typedef bsl::pair<iterator, bool> ResultType;
+
+    if (node.empty()) {
+        return ResultType(end(), false);                              // RETURN
+    }
+
+    bool isInsertedFlag = false;
+
+    HashTableLink *result = d_impl.insertNodeIfMissing(&isInsertedFlag, &node);
+
+    return ResultType(iterator(result), isInsertedFlag);
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+typename unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::iterator
+unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::insert(const_iterator,
+                                                   node_type&     node)
+{
+    // As for the insertion of a value, the 'hint' does not help to find the
+    // start of the bucket that must be searched for a duplicate key.
+
+    return this->insert(node).first;
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+void unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::merge(unordered_set& source)
+{
+    d_impl.mergeIfMissing(&source.d_impl);
+}
+
 template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
 inline
 void unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::rehash(size_type numBuckets)
@@ -1405,6 +1657,15 @@ unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::bucket_count() const
     return d_impl.numBuckets();
 }
 
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+bool
+unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::contains(
+                                                     const key_type& key) const
+{
+    return 0 != d_impl.find(key);
+}
+
 template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
 inline
 typename unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::size_type
@@ -1532,6 +1793,14 @@ unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::size() const
     return d_impl.size();
 }
 
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+BloombergLP::bslstl::HashTableStatistics
+unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::statistics() const
+{
+    return d_impl.statistics();
+}
+
 template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
 inline
 typename unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::size_type
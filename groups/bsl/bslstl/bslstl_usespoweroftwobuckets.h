@@ -0,0 +1,199 @@
+// bslstl_usespoweroftwobuckets.h                                     -*-C++-*-
+#ifndef INCLUDED_BSLSTL_USESPOWEROFTWOBUCKETS
+#define INCLUDED_BSLSTL_USESPOWEROFTWOBUCKETS
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a trait selecting power-of-two bucket arrays for a hasher.
+//
+//@CLASSES:
+//  bslstl::UsesPowerOfTwoBuckets<HASHER>: trait detection metafunction
+//
+//@SEE_ALSO: bslstl_hashtable, bslalg_hashtableimputil
+//
+//@DESCRIPTION: This component defines a meta-function,
+// 'bslstl::UsesPowerOfTwoBuckets', that may be used to associate a hash
+// functor type with the power-of-two bucket trait, and also to detect whether
+// a hash functor type has been associated with that trait.
+//
+// By default, 'bslstl::HashTable' (and so each of the unordered containers
+// implemented in terms of it) sizes its bucket array from an increasing
+// sequence of prime numbers, and maps a hash code to a bucket index with an
+// integer modulo operation.  The modulo is comparatively expensive (a
+// hardware division) and is computed at least once per lookup.  A hash table
+// whose 'HASHER' is associated with the 'UsesPowerOfTwoBuckets' trait instead
+// sizes its bucket array as a power of two, so that a bucket index is
+// computed by masking off the low-order bits of the hash code.
+//
+// Masking uses only the low-order bits of a hash code, so a hash table in
+// this mode first mixes every hash code returned by the hasher (a multiply by
+// an odd constant followed by folding the high half of the product into the
+// low half).  The mixing step is inexpensive, and guards against weak hash
+// functions (e.g., an identity hash of aligned pointers, whose low-order bits
+// are always zero) that would otherwise populate only a fraction of the
+// buckets.  Note that the mixed hash code is never exposed to clients: the
+// 'hash_function' accessor of a container still returns the supplied hasher.
+//
+// Note that this trait is a property of the hasher, rather than of the
+// container, so that the choice of bucket policy is a compile-time decision
+// that adds no data members to, and no run-time branches within, a hash
+// table.  The trait is not associated with any type by default, and never
+// with a function or reference type.
+//
+///Usage
+///-----
+// This section illustrates intended usage of this component.
+//
+///Example 1: Opting a Hash Functor into Power-of-Two Buckets
+/// - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we have a hash functor for integer identifiers that is used in a
+// performance-critical lookup table, and we want the hash tables using it to
+// avoid the integer division required to map a hash code to a prime-sized
+// bucket array.
+//
+// First, we define the hash functor, and associate it with the
+// 'UsesPowerOfTwoBuckets' trait using the 'BSLMF_NESTED_TRAIT_DECLARATION'
+// macro:
+//..
+//  struct IdentifierHash {
+//      // This 'struct' provides a (deliberately trivial) hash functor for
+//      // integer identifiers that requests power-of-two bucket arrays.
+//
+//      // TRAITS
+//      BSLMF_NESTED_TRAIT_DECLARATION(IdentifierHash,
+//                                     bslstl::UsesPowerOfTwoBuckets);
+//
+//      // ACCESSORS
+//      native_std::size_t operator()(int value) const
+//          // Return the specified 'value' as a hash code.
+//      {
+//          return value;
+//      }
+//  };
+//..
+// Then, we verify that the trait is detected for 'IdentifierHash', but not for
+// the default 'bsl::hash<int>':
+//..
+//  assert(true  == bslstl::UsesPowerOfTwoBuckets<IdentifierHash>::value);
+//  assert(false == bslstl::UsesPowerOfTwoBuckets<bsl::hash<int> >::value);
+//..
+// Finally, we note that an 'bsl::unordered_set<int, IdentifierHash>' will now
+// always report a power of two from its 'bucket_count' method.
+
+#ifndef INCLUDED_BSLSCM_VERSION
+#include <bslscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_DETECTNESTEDTRAIT
+#include <bslmf_detectnestedtrait.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_INTEGRALCONSTANT
+#include <bslmf_integralconstant.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_ISFUNCTION
+#include <bslmf_isfunction.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_ISREFERENCE
+#include <bslmf_isreference.h>
+#endif
+
+namespace BloombergLP {
+
+namespace bslstl {
+
+                        // ===========================
+                        // class UsesPowerOfTwoBuckets
+                        // ===========================
+
+template <class HASHER>
+struct UsesPowerOfTwoBuckets;
+
+template <class HASHER, bool CANNOT_NEST_TRAITS>
+struct UsesPowerOfTwoBuckets_Imp {
+    // This 'struct' provides the trait value for the specified 'HASHER' type
+    // if the specified 'CANNOT_NEST_TRAITS' is 'true', i.e., for function and
+    // reference types, which cannot declare nested traits.
+
+    typedef bsl::false_type Type;
+};
+
+template <class HASHER>
+struct UsesPowerOfTwoBuckets_Imp<HASHER, false> {
+    // This partial specialization provides the trait value for the specified
+    // 'HASHER' type if it may declare nested traits.
+
+    typedef typename bslmf::DetectNestedTrait<HASHER,
+                                              UsesPowerOfTwoBuckets>::type
+                                                                          Type;
+};
+
+template <class HASHER>
+struct UsesPowerOfTwoBuckets
+    : UsesPowerOfTwoBuckets_Imp<HASHER,
+                                bsl::is_function<HASHER>::value
+                             || bsl::is_reference<HASHER>::value>::Type
+{
+    // This metafunction is derived from 'true_type' if hash tables using the
+    // specified 'HASHER' functor should size their bucket arrays as powers of
+    // two, and from 'false_type' otherwise.  Note that this trait must be
+    // explicitly associated with a type, either using the
+    // 'BSLMF_NESTED_TRAIT_DECLARATION' macro or by specializing this template.
+};
+
+template <class HASHER>
+struct UsesPowerOfTwoBuckets<const HASHER>
+    : UsesPowerOfTwoBuckets<HASHER>::type
+{
+    // Specialization that associates the same trait with 'const HASHER' as
+    // with unqualified 'HASHER'.
+};
+
+template <class HASHER>
+struct UsesPowerOfTwoBuckets<volatile HASHER>
+    : UsesPowerOfTwoBuckets<HASHER>::type
+{
+    // Specialization that associates the same trait with 'volatile HASHER' as
+    // with unqualified 'HASHER'.
+};
+
+template <class HASHER>
+struct UsesPowerOfTwoBuckets<const volatile HASHER>
+    : UsesPowerOfTwoBuckets<HASHER>::type
+{
+    // Specialization that associates the same trait with
+    // 'const volatile HASHER' as with unqualified 'HASHER'.
+};
+
+}  // close package namespace
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
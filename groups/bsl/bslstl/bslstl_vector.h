@@ -97,6 +97,19 @@ BSLS_IDENT("$Id: $")
 // of the (template parameter) type 'VALUE_TYPE', if it defines the
 // 'bslalg::TypeTraitUsesBslmaAllocator' trait.
 //
+///Bulk Memory Policy
+///------------------
+// By default, a vector of bit-wise copyable elements copies and fills its
+// array with 'std::memcpy' and 'std::memset'.  If the (template parameter)
+// type 'VALUE_TYPE' is trivially copyable and opts into a bulk memory policy
+// by specializing 'bslalg::UsesBulkMemoryPolicy' (see
+// 'bslalg_bulkmemoryutil'), then 'assign', 'resize', and 'reserve', the
+// constructor taking a number of copies of a value, and the copy
+// constructors, copy and fill large arrays according to that policy instead;
+// e.g., using non-temporal stores, or dividing the work among several
+// threads.  Whether a policy is used is determined at compile time, so that
+// vectors of other types are unaffected.
+//
 ///Operations
 ///----------
 // This section describes the run-time complexity of operations on instances
@@ -504,6 +517,10 @@ BSL_OVERRIDES_STD mode"
 #include <bslalg_arrayprimitives.h>
 #endif
 
+#ifndef INCLUDED_BSLALG_BULKMEMORYUTIL
+#include <bslalg_bulkmemoryutil.h>
+#endif
+
 #ifndef INCLUDED_BSLALG_CONSTRUCTORPROXY
 #include <bslalg_constructorproxy.h>
 #endif
@@ -532,6 +549,10 @@ BSL_OVERRIDES_STD mode"
 #include <bslma_default.h>
 #endif
 
+#ifndef INCLUDED_BSLMF_ASSERT
+#include <bslmf_assert.h>
+#endif
+
 #ifndef INCLUDED_BSLMF_CONDITIONAL
 #include <bslmf_conditional.h>
 #endif
@@ -540,6 +561,14 @@ BSL_OVERRIDES_STD mode"
 #include <bslmf_enableif.h>
 #endif
 
+#ifndef INCLUDED_BSLMF_INTEGRALCONSTANT
+#include <bslmf_integralconstant.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_ISBITWISEMOVEABLE
+#include <bslmf_isbitwisemoveable.h>
+#endif
+
 #ifndef INCLUDED_BSLMF_ISFUNCTION
 #include <bslmf_isfunction.h>
 #endif
@@ -552,6 +581,14 @@ BSL_OVERRIDES_STD mode"
 #include <bslmf_issame.h>
 #endif
 
+#ifndef INCLUDED_BSLMF_ISTRIVIALLYCOPYABLE
+#include <bslmf_istriviallycopyable.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_ISTRIVIALLYDEFAULTCONSTRUCTIBLE
+#include <bslmf_istriviallydefaultconstructible.h>
+#endif
+
 #ifndef INCLUDED_BSLMF_MATCHANYTYPE
 #include <bslmf_matchanytype.h>
 #endif
@@ -584,6 +621,10 @@ BSL_OVERRIDES_STD mode"
 #include <bsls_types.h>
 #endif
 
+#ifndef INCLUDED_BSLS_UTIL
+#include <bsls_util.h>
+#endif
+
 #ifndef INCLUDED_CSTDDEF
 #include <cstddef>
 #define INCLUDED_CSTDDEF
@@ -626,6 +667,38 @@ struct Vector_Util {
         // specified 'b' vector.
 };
 
+                       // ============================
+                       // struct Vector_BulkPolicyUtil
+                       // ============================
+
+template <class VALUE_TYPE, bool USES_BULK_POLICY>
+struct Vector_BulkPolicyUtil {
+    // This 'struct' provides a namespace for a function returning the bulk
+    // memory policy that applies to an array of the parameterized
+    // 'VALUE_TYPE'.  This primary template is used if the parameterized
+    // 'USES_BULK_POLICY' is 'false', and never refers to
+    // 'bslalg::UsesBulkMemoryPolicy<VALUE_TYPE>::policy', which need not
+    // exist for such a 'VALUE_TYPE'.
+
+    // CLASS METHODS
+    static const BloombergLP::bslalg::BulkMemoryPolicy *policy(
+                                                      std::size_t numElements);
+        // Return 0.  Note that the specified 'numElements' is ignored.
+};
+
+template <class VALUE_TYPE>
+struct Vector_BulkPolicyUtil<VALUE_TYPE, true> {
+    // This partial specialization of 'Vector_BulkPolicyUtil' is used for a
+    // 'VALUE_TYPE' for which 'bslalg::UsesBulkMemoryPolicy' is specialized.
+
+    // CLASS METHODS
+    static const BloombergLP::bslalg::BulkMemoryPolicy *policy(
+                                                      std::size_t numElements);
+        // Return the address of the bulk memory policy of 'VALUE_TYPE' if
+        // that policy handles an array of the specified 'numElements' in
+        // bulk, and 0 otherwise.
+};
+
                           // ====================
                           // class Vector_ImpBase
                           // ====================
@@ -842,6 +915,16 @@ class Vector_Imp : public Vector_ImpBase<VALUE_TYPE>
         // Container base type, containing the allocator and applying empty
         // base class optimization (EBO) whenever appropriate.
 
+    typedef BloombergLP::bslalg::BulkMemoryPolicy BulkPolicy;
+        // Policy for copying and filling large arrays of 'VALUE_TYPE'.
+
+    typedef bsl::integral_constant<bool,
+                 BloombergLP::bslalg::UsesBulkMemoryPolicy<VALUE_TYPE>::value
+              && is_trivially_copyable<VALUE_TYPE>::value> UsesBulkPolicy;
+        // 'bsl::true_type' if arrays of 'VALUE_TYPE' are copied and filled
+        // according to the bulk memory policy of 'VALUE_TYPE', and
+        // 'bsl::false_type' otherwise.
+
     class Guard {
         // This class provides a proctor for deallocating an array of
         // 'VALUE_TYPE' objects, to be used in the 'Vector_Imp' constructors.
@@ -908,10 +991,33 @@ class Vector_Imp : public Vector_ImpBase<VALUE_TYPE>
         // duplicate copies after importing from an input iterator into a
         // temporary vector.
 
+    bool privateExpandInPlace(size_type *newCapacity, size_type newSize);
+        // Load into the specified 'newCapacity' the capacity to which this
+        // vector grows to hold the specified 'newSize' elements, and attempt
+        // to extend its array to that capacity without moving its elements.
+        // Return 'true', and update the capacity of this vector, on success,
+        // and 'false' with no effect otherwise.  The behavior is undefined
+        // unless 'capacity() < newSize <= max_size()'.
+
     void privateReserveEmpty(size_type numElements);
         // Reserve exactly the specified 'numElements'.  The behavior is
         // undefined unless this vector is empty and has no capacity.
 
+    void privateBulkAppend(size_type          numElements,
+                           const VALUE_TYPE&  value,
+                           const BulkPolicy&  policy);
+        // Append to this vector the specified 'numElements' copies of the
+        // specified 'value', filling (and, if the array must grow, copying)
+        // the array according to the specified 'policy'.  The behavior is
+        // undefined unless 'VALUE_TYPE' is trivially copyable and
+        // '0 < numElements <= max_size() - size()'.
+
+    // PRIVATE CLASS METHODS
+    static const BulkPolicy *privateBulkPolicy(size_type numElements);
+        // Return the address of the bulk memory policy of 'VALUE_TYPE' if
+        // 'UsesBulkPolicy::value' is 'true' and that policy handles an array
+        // of the specified 'numElements' in bulk, and 0 otherwise.
+
   public:
     // CREATORS
 
@@ -1019,6 +1125,18 @@ class Vector_Imp : public Vector_ImpBase<VALUE_TYPE>
         // specified and "default-constructible" otherwise (see {Requirements
         // on 'VALUE_TYPE'}).
 
+    void resize_default_init(size_type newSize);
+        // Change the size of this vector to the specified 'newSize', erasing
+        // elements at the end if 'newSize < size()' or appending
+        // default-initialized elements at the end if 'size() < newSize'.  Note
+        // that, unlike 'resize', the appended elements are *not*
+        // value-initialized: their values are indeterminate until they are
+        // assigned, so that a vector may be grown and then filled (e.g., by a
+        // 'read' system call) without first being zeroed.  Throw
+        // 'std::length_error' if 'newSize > max_size()'.  This method
+        // requires that the (template parameter) type 'VALUE_TYPE' be
+        // trivially default-constructible.
+
     void reserve(size_type newCapacity);
         // Change the capacity of this vector to the specified 'newCapacity'.
         // Note that the capacity of a vector is the maximum number of elements
@@ -1106,6 +1224,18 @@ class Vector_Imp : public Vector_ImpBase<VALUE_TYPE>
         // Erase the last element from this vector.  The behavior is undefined
         // if this vector is empty.
 
+    VALUE_TYPE *append_uninitialized(size_type numElements);
+        // Append the specified 'numElements' default-initialized elements at
+        // the end of this vector, and return the address of the first of them
+        // (or of the end of this vector if '0 == numElements').  The values of
+        // the appended elements are indeterminate until they are assigned.
+        // Throw 'std::length_error' if 'size() + numElements > max_size()'.
+        // This method provides the strong exception safety guarantee.  This
+        // method requires that the (template parameter) type 'VALUE_TYPE' be
+        // trivially default-constructible.  Note that the capacity grows as
+        // for 'insert', so that repeated appending takes amortized constant
+        // time per element.
+
 #if !BSLS_COMPILERFEATURES_SIMULATE_CPP11_FEATURES
     template <class... Args>
     VALUE_TYPE* emplace(const_iterator position, Args&&... args);
@@ -1526,6 +1656,9 @@ class vector< VALUE_TYPE *, ALLOCATOR >
     void resize(size_type newLength, VALUE_TYPE *value)
         { Base::resize(newLength, (void *)value); }
 
+    // void resize_default_init(size_type newSize);
+    //   This method can be inherited from Base without cast.
+
     // void reserve(size_type newCapacity);
     //   This method can be inherited from Base without cast.
 
@@ -1540,6 +1673,9 @@ class vector< VALUE_TYPE *, ALLOCATOR >
     // void pop_back();
     //   This method can be inherited from Base without cast.
 
+    VALUE_TYPE **append_uninitialized(size_type numElements)
+        { return (VALUE_TYPE **)Base::append_uninitialized(numElements); }
+
     iterator insert(const_iterator position, VALUE_TYPE *value)
         { return (iterator)Base::insert((void *const *)position,
                                         (void *)value); }
@@ -1759,6 +1895,9 @@ class vector< const VALUE_TYPE *, ALLOCATOR >
     void resize(size_type newLength, const VALUE_TYPE *value)
         { Base::resize(newLength, (const void *)value); }
 
+    // void resize_default_init(size_type newSize);
+    //   This method can be inherited from Base without cast.
+
     // void reserve(size_type newCapacity);
     //   This method can be inherited from Base without cast.
 
@@ -1770,6 +1909,10 @@ class vector< const VALUE_TYPE *, ALLOCATOR >
     // void pop_back();
     //   This method can be inherited from Base without cast.
 
+    const VALUE_TYPE **append_uninitialized(size_type numElements)
+        { return (const VALUE_TYPE **)
+                                   Base::append_uninitialized(numElements); }
+
     iterator insert(const_iterator position, const VALUE_TYPE *value)
         { return (iterator)Base::insert((const void *const *)position,
                                         (const void *)value); }
@@ -1949,6 +2092,30 @@ struct Vector_RangeCheck {
 // ============================================================================
 // See IMPLEMENTATION NOTES in the .cpp before modifying anything below.
 
+                       // ----------------------------
+                       // struct Vector_BulkPolicyUtil
+                       // ----------------------------
+
+// CLASS METHODS
+template <class VALUE_TYPE, bool USES_BULK_POLICY>
+inline
+const BloombergLP::bslalg::BulkMemoryPolicy *
+Vector_BulkPolicyUtil<VALUE_TYPE, USES_BULK_POLICY>::policy(std::size_t)
+{
+    return 0;
+}
+
+template <class VALUE_TYPE>
+inline
+const BloombergLP::bslalg::BulkMemoryPolicy *
+Vector_BulkPolicyUtil<VALUE_TYPE, true>::policy(std::size_t numElements)
+{
+    const BloombergLP::bslalg::BulkMemoryPolicy& policy =
+             BloombergLP::bslalg::UsesBulkMemoryPolicy<VALUE_TYPE>::policy();
+
+    return policy.isBulk(numElements * sizeof(VALUE_TYPE)) ? &policy : 0;
+}
+
                           // --------------------
                           // class Vector_ImpBase
                           // --------------------
@@ -2336,11 +2503,9 @@ void Vector_Imp<VALUE_TYPE, ALLOCATOR>::privateInsert(
     }
 
     const size_type newSize = this->size() + n;
-    if (newSize > this->d_capacity) {
-        size_type newCapacity = Vector_Util::computeNewCapacity(
-                                                              newSize,
-                                                              this->d_capacity,
-                                                              maxSize);
+    size_type newCapacity;
+    if (newSize > this->d_capacity
+     && !privateExpandInPlace(&newCapacity, newSize)) {
         Vector_Imp temp(this->get_allocator());
         temp.privateReserveEmpty(newCapacity);
 
@@ -2384,11 +2549,9 @@ void Vector_Imp<VALUE_TYPE, ALLOCATOR>::privateMoveInsert(
     }
 
     const size_type newSize = this->size() + n;
-    if (newSize > this->d_capacity) {
-        const size_type newCapacity = Vector_Util::computeNewCapacity(
-                                                              newSize,
-                                                              this->d_capacity,
-                                                              maxSize);
+    size_type newCapacity;
+    if (newSize > this->d_capacity
+     && !privateExpandInPlace(&newCapacity, newSize)) {
         Vector_Imp temp(this->get_allocator());
         temp.privateReserveEmpty(newCapacity);
 
@@ -2419,6 +2582,25 @@ void Vector_Imp<VALUE_TYPE, ALLOCATOR>::privateMoveInsert(
     }
 }
 
+template <class VALUE_TYPE, class ALLOCATOR>
+inline
+bool Vector_Imp<VALUE_TYPE, ALLOCATOR>::privateExpandInPlace(
+                                                    size_type *newCapacity,
+                                                    size_type  newSize)
+{
+    BSLS_ASSERT_SAFE(this->d_capacity < newSize);
+
+    *newCapacity = Vector_Util::computeNewCapacity(newSize,
+                                                   this->d_capacity,
+                                                   max_size());
+    if (this->d_dataBegin
+     && this->tryExpandN(this->d_dataBegin, this->d_capacity, *newCapacity)) {
+        this->d_capacity = *newCapacity;
+        return true;                                                  // RETURN
+    }
+    return false;
+}
+
 template <class VALUE_TYPE, class ALLOCATOR>
 inline
 void Vector_Imp<VALUE_TYPE, ALLOCATOR>::privateReserveEmpty(
@@ -2432,6 +2614,66 @@ void Vector_Imp<VALUE_TYPE, ALLOCATOR>::privateReserveEmpty(
     this->d_capacity = numElements;
 }
 
+template <class VALUE_TYPE, class ALLOCATOR>
+void Vector_Imp<VALUE_TYPE, ALLOCATOR>::privateBulkAppend(
+                                                size_type          numElements,
+                                                const VALUE_TYPE&  value,
+                                                const BulkPolicy&  policy)
+{
+    typedef BloombergLP::bslalg::BulkMemoryUtil BulkUtil;
+
+    BSLS_ASSERT_SAFE(0 < numElements);
+
+    const size_type oldSize = this->size();
+    const size_type newSize = oldSize + numElements;
+
+    Vector_Imp  temp(this->get_allocator());
+    VALUE_TYPE *array = this->d_dataBegin;
+    size_type   newCapacity;
+    if (newSize > this->d_capacity
+     && !privateExpandInPlace(&newCapacity, newSize)) {
+        temp.privateReserveEmpty(newCapacity);
+        array = temp.d_dataBegin;
+    }
+
+    // Fill the new elements before moving the old ones, as 'value' may be an
+    // element of this vector.
+
+    BulkUtil::copy(array + oldSize,
+                   BSLS_UTIL_ADDRESSOF(value),
+                   sizeof(VALUE_TYPE),
+                   policy);
+    BulkUtil::replicate(array + oldSize,
+                        sizeof(VALUE_TYPE),
+                        numElements * sizeof(VALUE_TYPE),
+                        policy);
+
+    if (array == this->d_dataBegin) {
+        this->d_dataEnd += numElements;
+        return;                                                       // RETURN
+    }
+
+    if (0 < oldSize) {
+        BulkUtil::copy(array,
+                       this->d_dataBegin,
+                       oldSize * sizeof(VALUE_TYPE),
+                       policy);
+    }
+    temp.d_dataEnd += newSize;
+    this->d_dataEnd = this->d_dataBegin;
+    Vector_Util::swap(&this->d_dataBegin, &temp.d_dataBegin);
+}
+
+// PRIVATE CLASS METHODS
+template <class VALUE_TYPE, class ALLOCATOR>
+inline
+const typename Vector_Imp<VALUE_TYPE, ALLOCATOR>::BulkPolicy *
+Vector_Imp<VALUE_TYPE, ALLOCATOR>::privateBulkPolicy(size_type numElements)
+{
+    return Vector_BulkPolicyUtil<VALUE_TYPE, UsesBulkPolicy::value>::policy(
+                                                                  numElements);
+}
+
 // CREATORS
 
                   // *** 23.2.4.1 construct/copy/destroy: ***
@@ -2488,14 +2730,19 @@ Vector_Imp<VALUE_TYPE, ALLOCATOR>::Vector_Imp(size_type         initialSize,
                     this->d_capacity,
                     static_cast<VectorContainerBase *>(this));
 
-        BloombergLP::bslalg::ArrayPrimitives::uninitializedFillN(
+        const BulkPolicy *policy = privateBulkPolicy(initialSize);
+        if (policy) {
+            privateBulkAppend(initialSize, value, *policy);
+        }
+        else {
+            BloombergLP::bslalg::ArrayPrimitives::uninitializedFillN(
                                                        this->d_dataBegin,
                                                        initialSize,
                                                        value,
                                                        this->bslmaAllocator());
-
+            this->d_dataEnd += initialSize;
+        }
         guard.release();
-        this->d_dataEnd += initialSize;
     }
 }
 
@@ -2522,11 +2769,21 @@ Vector_Imp(const Vector_Imp<VALUE_TYPE, ALLOCATOR>& original)
                     this->d_capacity,
                     static_cast<VectorContainerBase *>(this));
 
-        BloombergLP::bslalg::ArrayPrimitives::copyConstruct(
+        const BulkPolicy *policy = privateBulkPolicy(original.size());
+        if (policy) {
+            BloombergLP::bslalg::BulkMemoryUtil::copy(
+                                         this->d_dataBegin,
+                                         original.d_dataBegin,
+                                         original.size() * sizeof(VALUE_TYPE),
+                                         *policy);
+        }
+        else {
+            BloombergLP::bslalg::ArrayPrimitives::copyConstruct(
                                                        this->d_dataBegin,
                                                        original.begin(),
                                                        original.end(),
                                                        this->bslmaAllocator());
+        }
 
         guard.release();
         this->d_dataEnd += original.size();
@@ -2546,11 +2803,21 @@ Vector_Imp(const Vector_Imp<VALUE_TYPE, ALLOCATOR>& original,
                     this->d_capacity,
                     static_cast<VectorContainerBase *>(this));
 
-        BloombergLP::bslalg::ArrayPrimitives::copyConstruct(
+        const BulkPolicy *policy = privateBulkPolicy(original.size());
+        if (policy) {
+            BloombergLP::bslalg::BulkMemoryUtil::copy(
+                                         this->d_dataBegin,
+                                         original.d_dataBegin,
+                                         original.size() * sizeof(VALUE_TYPE),
+                                         *policy);
+        }
+        else {
+            BloombergLP::bslalg::ArrayPrimitives::copyConstruct(
                                                        this->d_dataBegin,
                                                        original.begin(),
                                                        original.end(),
                                                        this->bslmaAllocator());
+        }
 
         guard.release();
         this->d_dataEnd += original.size();
@@ -2667,6 +2934,20 @@ void Vector_Imp<VALUE_TYPE, ALLOCATOR>::resize(size_type         newSize,
     }
 }
 
+template <class VALUE_TYPE, class ALLOCATOR>
+void Vector_Imp<VALUE_TYPE, ALLOCATOR>::resize_default_init(size_type newSize)
+{
+    if (newSize <= this->size()) {
+        BloombergLP::bslalg::ArrayDestructionPrimitives::destroy(
+                                                   this->d_dataBegin + newSize,
+                                                   this->d_dataEnd);
+        this->d_dataEnd = this->d_dataBegin + newSize;
+    }
+    else {
+        append_uninitialized(newSize - this->size());
+    }
+}
+
 template <class VALUE_TYPE, class ALLOCATOR>
 void Vector_Imp<VALUE_TYPE, ALLOCATOR>::reserve(size_type newCapacity)
 {
@@ -2679,18 +2960,51 @@ void Vector_Imp<VALUE_TYPE, ALLOCATOR>::reserve(size_type newCapacity)
         privateReserveEmpty(newCapacity);
     }
     else if (this->d_capacity < newCapacity) {
-        Vector_Imp temp(this->get_allocator());
-        temp.privateReserveEmpty(newCapacity);
-
-        BloombergLP::bslalg::ArrayPrimitives::destructiveMove(
+        const BulkPolicy *policy = privateBulkPolicy(this->size());
+
+        if (BloombergLP::bslmf::IsBitwiseMoveable<VALUE_TYPE>::value
+         && !policy) {
+            // The allocator may relocate bitwise-moveable elements without
+            // copying them (e.g., by extending the array in place, or with
+            // 'realloc').  Arrays large enough to be moved according to the
+            // bulk memory policy of 'VALUE_TYPE' are moved below instead.
+
+            const size_type size = this->size();
+
+            this->d_dataBegin = this->reallocateN(this->d_dataBegin,
+                                                  this->d_capacity,
+                                                  newCapacity);
+            this->d_dataEnd   = this->d_dataBegin + size;
+            this->d_capacity  = newCapacity;
+        }
+        else if (this->tryExpandN(this->d_dataBegin,
+                                  this->d_capacity,
+                                  newCapacity)) {
+            this->d_capacity = newCapacity;
+        }
+        else {
+            Vector_Imp temp(this->get_allocator());
+            temp.privateReserveEmpty(newCapacity);
+
+            if (policy) {
+                BloombergLP::bslalg::BulkMemoryUtil::copy(
+                                            temp.d_dataBegin,
+                                            this->d_dataBegin,
+                                            this->size() * sizeof(VALUE_TYPE),
+                                            *policy);
+            }
+            else {
+                BloombergLP::bslalg::ArrayPrimitives::destructiveMove(
                                                        temp.d_dataBegin,
                                                        this->d_dataBegin,
                                                        this->d_dataEnd,
                                                        this->bslmaAllocator());
+            }
 
-        temp.d_dataEnd += this->size();
-        this->d_dataEnd = this->d_dataBegin;
-        Vector_Util::swap(&this->d_dataBegin, &temp.d_dataBegin);
+            temp.d_dataEnd += this->size();
+            this->d_dataEnd = this->d_dataBegin;
+            Vector_Util::swap(&this->d_dataBegin, &temp.d_dataBegin);
+        }
     }
 }
 
@@ -2954,6 +3268,46 @@ void Vector_Imp<VALUE_TYPE, ALLOCATOR>::pop_back()
                                                   ::destroy(--this->d_dataEnd);
 }
 
+template <class VALUE_TYPE, class ALLOCATOR>
+VALUE_TYPE *
+Vector_Imp<VALUE_TYPE, ALLOCATOR>::append_uninitialized(size_type numElements)
+{
+    BSLMF_ASSERT(is_trivially_default_constructible<VALUE_TYPE>::value);
+
+    const size_type oldSize = this->size();
+    const size_type maxSize = max_size();
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(numElements >
+                                                          maxSize - oldSize)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        BloombergLP::bslstl::StdExceptUtil::throwLengthError(
+                     "vector<...>::append_uninitialized(n): vector too long");
+    }
+
+    const size_type newSize = oldSize + numElements;
+    size_type newCapacity;
+    if (newSize > this->d_capacity
+     && !privateExpandInPlace(&newCapacity, newSize)) {
+        Vector_Imp temp(this->get_allocator());
+        temp.privateReserveEmpty(newCapacity);
+
+        BloombergLP::bslalg::ArrayPrimitives::destructiveMove(
+                                                       temp.d_dataBegin,
+                                                       this->d_dataBegin,
+                                                       this->d_dataEnd,
+                                                       this->bslmaAllocator());
+
+        temp.d_dataEnd += oldSize;
+        this->d_dataEnd = this->d_dataBegin;
+        Vector_Util::swap(&this->d_dataBegin, &temp.d_dataBegin);
+    }
+
+    // Trivially default-constructible elements need no initialization.
+
+    this->d_dataEnd += numElements;
+    return this->d_dataBegin + oldSize;
+}
+
 #if !BSLS_COMPILERFEATURES_SIMULATE_CPP11_FEATURES
 template <class VALUE_TYPE, class ALLOCATOR>
 template <class... Args>
@@ -2976,11 +3330,9 @@ VALUE_TYPE* Vector_Imp<VALUE_TYPE, ALLOCATOR>::emplace(const_iterator position,
     }
 
     const size_type newSize = this->size() + 1;
-    if (newSize > this->d_capacity) {
-        size_type newCapacity = Vector_Util::computeNewCapacity(
-                                                              newSize,
-                                                              this->d_capacity,
-                                                              maxSize);
+    size_type newCapacity;
+    if (newSize > this->d_capacity
+     && !privateExpandInPlace(&newCapacity, newSize)) {
         Vector_Imp temp(this->get_allocator());
         temp.privateReserveEmpty(newCapacity);
 
@@ -3056,11 +3408,9 @@ VALUE_TYPE* Vector_Imp<VALUE_TYPE, ALLOCATOR>::emplace(const_iterator position)
     }
 
     const size_type newSize = this->size() + 1;
-    if (newSize > this->d_capacity) {
-        size_type newCapacity = Vector_Util::computeNewCapacity(
-                                                              newSize,
-                                                              this->d_capacity,
-                                                              maxSize);
+    size_type newCapacity;
+    if (newSize > this->d_capacity
+     && !privateExpandInPlace(&newCapacity, newSize)) {
         Vector_Imp temp(this->get_allocator());
         temp.privateReserveEmpty(newCapacity);
 
@@ -3129,11 +3479,9 @@ VALUE_TYPE* Vector_Imp<VALUE_TYPE, ALLOCATOR>::emplace(const_iterator position,
     }
 
     const size_type newSize = this->size() + 1;
-    if (newSize > this->d_capacity) {
-        size_type newCapacity = Vector_Util::computeNewCapacity(
-                                                              newSize,
-                                                              this->d_capacity,
-                                                              maxSize);
+    size_type newCapacity;
+    if (newSize > this->d_capacity
+     && !privateExpandInPlace(&newCapacity, newSize)) {
         Vector_Imp temp(this->get_allocator());
         temp.privateReserveEmpty(newCapacity);
 
@@ -3208,11 +3556,9 @@ VALUE_TYPE* Vector_Imp<VALUE_TYPE, ALLOCATOR>::emplace(const_iterator position,
     }
 
     const size_type newSize = this->size() + 1;
-    if (newSize > this->d_capacity) {
-        size_type newCapacity = Vector_Util::computeNewCapacity(
-                                                              newSize,
-                                                              this->d_capacity,
-                                                              maxSize);
+    size_type newCapacity;
+    if (newSize > this->d_capacity
+     && !privateExpandInPlace(&newCapacity, newSize)) {
         Vector_Imp temp(this->get_allocator());
         temp.privateReserveEmpty(newCapacity);
 
@@ -3293,11 +3639,9 @@ VALUE_TYPE* Vector_Imp<VALUE_TYPE, ALLOCATOR>::emplace(const_iterator position,
     }
 
     const size_type newSize = this->size() + 1;
-    if (newSize > this->d_capacity) {
-        size_type newCapacity = Vector_Util::computeNewCapacity(
-                                                              newSize,
-                                                              this->d_capacity,
-                                                              maxSize);
+    size_type newCapacity;
+    if (newSize > this->d_capacity
+     && !privateExpandInPlace(&newCapacity, newSize)) {
         Vector_Imp temp(this->get_allocator());
         temp.privateReserveEmpty(newCapacity);
 
@@ -3384,11 +3728,9 @@ VALUE_TYPE* Vector_Imp<VALUE_TYPE, ALLOCATOR>::emplace(const_iterator position,
     }
 
     const size_type newSize = this->size() + 1;
-    if (newSize > this->d_capacity) {
-        size_type newCapacity = Vector_Util::computeNewCapacity(
-                                                              newSize,
-                                                              this->d_capacity,
-                                                              maxSize);
+    size_type newCapacity;
+    if (newSize > this->d_capacity
+     && !privateExpandInPlace(&newCapacity, newSize)) {
         Vector_Imp temp(this->get_allocator());
         temp.privateReserveEmpty(newCapacity);
 
@@ -3481,11 +3823,9 @@ VALUE_TYPE* Vector_Imp<VALUE_TYPE, ALLOCATOR>::emplace(const_iterator position,
     }
 
     const size_type newSize = this->size() + 1;
-    if (newSize > this->d_capacity) {
-        size_type newCapacity = Vector_Util::computeNewCapacity(
-                                                              newSize,
-                                                              this->d_capacity,
-                                                              maxSize);
+    size_type newCapacity;
+    if (newSize > this->d_capacity
+     && !privateExpandInPlace(&newCapacity, newSize)) {
         Vector_Imp temp(this->get_allocator());
         temp.privateReserveEmpty(newCapacity);
 
@@ -3575,11 +3915,9 @@ VALUE_TYPE* Vector_Imp<VALUE_TYPE, ALLOCATOR>::emplace(const_iterator position,
     }
 
     const size_type newSize = this->size() + 1;
-    if (newSize > this->d_capacity) {
-        size_type newCapacity = Vector_Util::computeNewCapacity(
-                                                              newSize,
-                                                              this->d_capacity,
-                                                              maxSize);
+    size_type newCapacity;
+    if (newSize > this->d_capacity
+     && !privateExpandInPlace(&newCapacity, newSize)) {
         Vector_Imp temp(this->get_allocator());
         temp.privateReserveEmpty(newCapacity);
 
@@ -3665,12 +4003,18 @@ void Vector_Imp<VALUE_TYPE, ALLOCATOR>::insert(const_iterator    position,
                               "vector<...>::insert(pos,n,v): vector too long");
     }
 
+    if (UsesBulkPolicy::value && pos == this->d_dataEnd && 0 < numElements) {
+        const BulkPolicy *policy = privateBulkPolicy(numElements);
+        if (policy) {
+            privateBulkAppend(numElements, value, *policy);
+            return;                                                   // RETURN
+        }
+    }
+
     const size_type newSize = this->size() + numElements;
-    if (newSize > this->d_capacity) {
-        size_type newCapacity = Vector_Util::computeNewCapacity(
-                                                              newSize,
-                                                              this->d_capacity,
-                                                              maxSize);
+    size_type newCapacity;
+    if (newSize > this->d_capacity
+     && !privateExpandInPlace(&newCapacity, newSize)) {
         Vector_Imp temp(this->get_allocator());
         temp.privateReserveEmpty(newCapacity);
 
@@ -6,6 +6,8 @@
 #include <bslstl_forwarditerator.h>
 #include <bslstl_iterator.h>
 
+#include <bslalg_bulkmemoryutil.h>
+
 #include <bslma_allocator.h>
 #include <bslma_default.h>
 #include <bslma_defaultallocatorguard.h>
@@ -109,6 +111,7 @@ using namespace bsl;
 // [14] void resize(size_type n, const T& val);
 // [14] void reserve(size_type n);
 // [14] void shrink_to_fit();
+// [27] void resize_default_init(size_type n);
 // [ 2] void clear();
 // [15] reference front();
 // [15] reference back();
@@ -118,6 +121,7 @@ using namespace bsl;
 // [ 2] void push_back(const T&);
 // [17] void push_back(T&&);
 // [18] void pop_back();
+// [27] VALUE_TYPE *append_uninitialized(size_type n);
 // [17] iterator emplace(const_iterator pos, Args...);
 // [17] iterator insert(const_iterator pos, const T& val);
 // [17] iterator insert(const_iterator pos, size_type n, const T& val);
@@ -153,7 +157,8 @@ using namespace bsl;
 //-----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
 // [11] ALLOCATOR-RELATED CONCERNS
-// [25] USAGE EXAMPLE
+// [29] USAGE EXAMPLE
+// [28] CONCERN: Bulk memory policy is applied to opted-in types
 // [21] CONCERN: 'std::length_error' is used properly
 // [23] DRQS 31711031
 // [24] DRQS 34693876
@@ -995,6 +1000,63 @@ void dbg_print(const BitwiseEqComparableTestType& rhs) {
     fflush(stdout);
 }
 
+                             // ==================
+                             // class BulkTestType
+                             // ==================
+
+class BulkTestType {
+    // This bit-wise copyable test type holds an 'int' value, and opts into the
+    // bulk memory policy 'bulkTestTypePolicy'.
+
+    // DATA
+    int d_value;
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(BulkTestType, bsl::is_trivially_copyable);
+
+    // CREATORS
+    BulkTestType()
+    : d_value(0)
+    {
+    }
+
+    explicit
+    BulkTestType(int value)
+    : d_value(value)
+    {
+    }
+
+    // ACCESSORS
+    int value() const
+    {
+        return d_value;
+    }
+};
+
+bool operator==(const BulkTestType& lhs, const BulkTestType& rhs)
+{
+    return lhs.value() == rhs.value();
+}
+
+bslalg::BulkMemoryPolicy bulkTestTypePolicy;
+    // policy applied to arrays of 'BulkTestType'
+
+namespace BloombergLP {
+namespace bslalg {
+
+template <>
+struct UsesBulkMemoryPolicy<BulkTestType> : bsl::true_type {
+    static const BulkMemoryPolicy& policy()
+        // Return a reference to 'bulkTestTypePolicy'.
+    {
+        return bulkTestTypePolicy;
+    }
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+
                                // ==============
                                // class CharList
                                // ==============
@@ -1470,6 +1532,9 @@ struct TestDriver {
     static void testCaseM1();
         // Performance test.
 
+    static void testCase27();
+        // Test 'resize_default_init' and 'append_uninitialized'.
+
     static void testCase22();
         // Test overloaded new/delete.
 
@@ -2310,6 +2375,194 @@ void TestDriver<TYPE,ALLOC>::testCaseM1()
     }
 }
 
+template <class TYPE, class ALLOC>
+void TestDriver<TYPE,ALLOC>::testCase27()
+{
+    // --------------------------------------------------------------------
+    // TESTING 'resize_default_init' AND 'append_uninitialized'
+    //
+    // Concerns:
+    //: 1 'append_uninitialized(n)' increases the size by 'n', preserves the
+    //:   existing elements, and returns the address of the first appended
+    //:   element.
+    //:
+    //: 2 'resize_default_init(n)' brings the size to 'n', truncating or
+    //:   appending elements as needed, and preserves the leading elements.
+    //:
+    //: 3 The capacity grows as for 'insert': no memory is allocated if the
+    //:   new size does not exceed the capacity, and repeated appending
+    //:   allocates a logarithmic number of times.
+    //:
+    //: 4 Both methods provide the strong exception-safety guarantee.
+    //:
+    //: 5 A new size exceeding 'max_size()' throws 'std::length_error'.
+    //
+    // Plan:
+    //: 1 For vectors of various sizes and capacities, append and resize
+    //:   by various amounts, write the appended elements, and verify the
+    //:   value and the allocations, in the standard 'bslma' exception-testing
+    //:   macro block.  (C-1..4)
+    //:
+    //: 2 Append elements one at a time and count the allocations.  (C-3)
+    //:
+    //: 3 Request more than 'max_size()' elements.  (C-5)
+    //
+    // Testing:
+    //   VALUE_TYPE *append_uninitialized(size_type numElements);
+    //   void resize_default_init(size_type newSize);
+    // --------------------------------------------------------------------
+
+    bslma::TestAllocator  testAllocator(veryVeryVerbose);
+    bslma::Allocator     *Z = &testAllocator;
+
+    const TYPE         *values     = 0;
+    const TYPE *const&  VALUES     = values;
+    const int           NUM_VALUES = getValues(&values);
+
+    static const size_t DATA[] = {
+        0, 1, 2, 3, 4, 5, 7, 8, 9, 15, 16, 17
+    };
+    const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+    if (verbose) printf("\tTesting 'append_uninitialized'.\n");
+
+    for (int ti = 0; ti < NUM_DATA; ++ti) {
+        const size_t INIT = DATA[ti];
+
+        for (int tj = 0; tj < NUM_DATA; ++tj) {
+            const size_t NUM = DATA[tj];
+
+            BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(testAllocator) {
+                const bsls::Types::Int64 AL = testAllocator.allocationLimit();
+                testAllocator.setAllocationLimit(-1);
+
+                Obj mX(Z);  const Obj& X = mX;
+                stretch(&mX, INIT, VALUES[0]);
+
+                const size_t             CAP = X.capacity();
+                const bsls::Types::Int64 NA  = testAllocator.numAllocations();
+
+                testAllocator.setAllocationLimit(AL);
+
+                ExceptionGuard<Obj> guard(&mX, X, L_);
+
+                TYPE *result = mX.append_uninitialized(NUM);  // test here
+
+                guard.release();
+
+                LOOP2_ASSERT(ti, tj, INIT + NUM == X.size());
+                LOOP2_ASSERT(ti, tj, X.data() + INIT == result);
+                LOOP2_ASSERT(ti, tj,
+                             (INIT + NUM <= CAP) ==
+                                   (NA == testAllocator.numAllocations()));
+
+                for (size_t i = 0; i < NUM; ++i) {
+                    result[i] = VALUES[1 + i % (NUM_VALUES - 1)];
+                }
+                for (size_t i = 0; i < INIT; ++i) {
+                    LOOP3_ASSERT(ti, tj, i, VALUES[0] == X[i]);
+                }
+                for (size_t i = 0; i < NUM; ++i) {
+                    const TYPE& EXP = VALUES[1 + i % (NUM_VALUES - 1)];
+                    LOOP3_ASSERT(ti, tj, i, EXP == X[INIT + i]);
+                }
+            } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+        }
+    }
+    ASSERT(0 == testAllocator.numBlocksInUse());
+
+    if (verbose) printf("\tTesting 'resize_default_init'.\n");
+
+    for (int ti = 0; ti < NUM_DATA; ++ti) {
+        const size_t INIT = DATA[ti];
+
+        for (int tj = 0; tj < NUM_DATA; ++tj) {
+            const size_t NEW_SIZE = DATA[tj];
+
+            BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(testAllocator) {
+                const bsls::Types::Int64 AL = testAllocator.allocationLimit();
+                testAllocator.setAllocationLimit(-1);
+
+                Obj mX(Z);  const Obj& X = mX;
+                stretch(&mX, INIT, VALUES[0]);
+
+                const size_t             CAP = X.capacity();
+                const bsls::Types::Int64 NA  = testAllocator.numAllocations();
+
+                testAllocator.setAllocationLimit(AL);
+
+                ExceptionGuard<Obj> guard(&mX, X, L_);
+
+                mX.resize_default_init(NEW_SIZE);  // test here
+
+                guard.release();
+
+                LOOP2_ASSERT(ti, tj, NEW_SIZE == X.size());
+                LOOP2_ASSERT(ti, tj,
+                             (NEW_SIZE <= CAP) ==
+                                   (NA == testAllocator.numAllocations()));
+
+                const size_t KEPT = INIT < NEW_SIZE ? INIT : NEW_SIZE;
+                for (size_t i = 0; i < KEPT; ++i) {
+                    LOOP3_ASSERT(ti, tj, i, VALUES[0] == X[i]);
+                }
+                for (size_t i = KEPT; i < NEW_SIZE; ++i) {
+                    mX[i] = VALUES[1];
+                }
+                for (size_t i = KEPT; i < NEW_SIZE; ++i) {
+                    LOOP3_ASSERT(ti, tj, i, VALUES[1] == X[i]);
+                }
+            } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+        }
+    }
+    ASSERT(0 == testAllocator.numBlocksInUse());
+
+    if (verbose) printf("\tTesting amortized growth.\n");
+    {
+        Obj mX(Z);  const Obj& X = mX;
+
+        const bsls::Types::Int64 NA = testAllocator.numAllocations();
+        for (size_t i = 0; i < 1000; ++i) {
+            *mX.append_uninitialized(1) = VALUES[i % NUM_VALUES];
+        }
+        LOOP_ASSERT(testAllocator.numAllocations() - NA,
+                    testAllocator.numAllocations() - NA <= 11);
+        for (size_t i = 0; i < 1000; ++i) {
+            LOOP_ASSERT(i, VALUES[i % NUM_VALUES] == X[i]);
+        }
+    }
+
+#ifdef BDE_BUILD_TARGET_EXC
+    if (verbose) printf("\tTesting 'std::length_error'.\n");
+    {
+        Obj mX(Z);
+        stretch(&mX, 1, VALUES[0]);
+
+        bool exceptionCaught = false;
+        try {
+            mX.append_uninitialized(mX.max_size());
+        }
+        catch (const std::length_error&) {
+            exceptionCaught = true;
+        }
+        ASSERT(exceptionCaught);
+        ASSERT(1 == mX.size());
+
+        if (mX.max_size() < ~(size_t)0) {
+            exceptionCaught = false;
+            try {
+                mX.resize_default_init(mX.max_size() + 1);
+            }
+            catch (const std::length_error&) {
+                exceptionCaught = true;
+            }
+            ASSERT(exceptionCaught);
+            ASSERT(1 == mX.size());
+        }
+    }
+#endif
+}
+
 template <class TYPE, class ALLOC>
 void TestDriver<TYPE,ALLOC>::testCase22()
 {
@@ -9521,7 +9774,7 @@ int main(int argc, char *argv[])
     printf("TEST " __FILE__ " CASE %d\n", test);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 27: {
+      case 29: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //
@@ -9565,6 +9818,234 @@ int main(int argc, char *argv[])
             ASSERT(4 == m1.theValue(1, 1));
         }
       } break;
+      case 28: {
+        // --------------------------------------------------------------------
+        // CONCERN: Bulk memory policy is applied to opted-in types
+        //
+        // Concerns:
+        //: 1 When the element type opts into a bulk memory policy, 'assign',
+        //:   'resize', 'reserve', the constructor taking a number of copies
+        //:   of a value, and copy construction divide large arrays into jobs
+        //:   according to that policy, and produce the same values as with
+        //:   the default policy.
+        //:
+        //: 2 Arrays smaller than the thresholds of the policy are not
+        //:   divided.
+        //:
+        //: 3 Vectors of types that do not opt in never use a bulk policy.
+        //
+        // Plan:
+        //: 1 Configure the policy of 'BulkTestType' to write arrays of at
+        //:   least 64 kilobytes with non-temporal stores, divided among at
+        //:   most 4 jobs by a "parallel for" function that counts its calls
+        //:   and runs the jobs on the calling thread.  Exercise each
+        //:   manipulator on a large and on a small vector, verifying the
+        //:   values and the number of calls.  (C-1..2)
+        //:
+        //: 2 Exercise the same manipulators on a large 'bsl::vector<int>',
+        //:   and verify that the "parallel for" function is not called.
+        //:   (C-3)
+        //
+        // Testing:
+        //   CONCERN: Bulk memory policy is applied to opted-in types
+        // --------------------------------------------------------------------
+
+        if (verbose) printf(
+                  "\nCONCERN: Bulk memory policy is applied to opted-in types"
+                  "\n========================================================"
+                  "\n");
+
+        typedef BloombergLP::bslalg::BulkMemoryPolicy BulkPolicy;
+        typedef BulkTestType                          V;
+
+        struct Counter {
+            static void parallelFor(BulkPolicy::Job  job,
+                                    void            *context,
+                                    size_t           numJobs)
+                // Invoke the specified 'job' with the specified 'context'
+                // for each job index in '[0 .. numJobs - 1]', and count the
+                // call.
+            {
+                ++numCalls();
+                for (size_t i = 0; i < numJobs; ++i) {
+                    job(context, i);
+                }
+            }
+
+            static int& numCalls()
+                // Return a reference providing modifiable access to the
+                // number of calls to 'parallelFor'.
+            {
+                static int count = 0;
+                return count;
+            }
+        };
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        bulkTestTypePolicy.setStreamingThreshold(64 * 1024);
+        bulkTestTypePolicy.setParallelFor(&Counter::parallelFor,
+                                          4,
+                                          64 * 1024);
+
+        const size_t LARGE = 100000;  // elements, at least 64 kilobytes
+        const size_t SMALL = 1000;    // elements, less than 64 kilobytes
+
+        {
+            if (verbose) printf("\tTesting 'assign' and copy construction\n");
+
+            bsl::vector<V> mX(&oa);  const bsl::vector<V>& X = mX;
+
+            Counter::numCalls() = 0;
+            mX.assign(LARGE, V(7));
+            ASSERTV(Counter::numCalls(), 1 == Counter::numCalls());
+            ASSERT(LARGE == X.size());
+            ASSERT(7 == X.front().value());
+            ASSERT(7 == X[LARGE / 2].value());
+            ASSERT(7 == X.back().value());
+
+            mX[LARGE - 1] = V(8);
+
+            Counter::numCalls() = 0;
+            bsl::vector<V> mY(X, &oa);  const bsl::vector<V>& Y = mY;
+            ASSERTV(Counter::numCalls(), 1 == Counter::numCalls());
+            ASSERT(X == Y);
+
+            Counter::numCalls() = 0;
+            bsl::vector<V> mZ(X.begin(), X.begin() + SMALL, &oa);
+            ASSERTV(Counter::numCalls(), 0 == Counter::numCalls());
+            ASSERT(SMALL == mZ.size());
+            ASSERT(7 == mZ.back().value());
+
+            Counter::numCalls() = 0;
+            mZ.assign(LARGE, X[0]);
+            ASSERTV(Counter::numCalls(), 1 == Counter::numCalls());
+            ASSERT(LARGE == mZ.size());
+            ASSERT(7 == mZ.back().value());
+
+            Counter::numCalls() = 0;
+            bsl::vector<V> mW(LARGE, V(9), &oa);
+            ASSERTV(Counter::numCalls(), 1 == Counter::numCalls());
+            ASSERT(LARGE == mW.size());
+            ASSERT(9 == mW.front().value() && 9 == mW.back().value());
+        }
+        {
+            if (verbose) printf("\tTesting 'resize'\n");
+
+            bsl::vector<V> mX(&oa);  const bsl::vector<V>& X = mX;
+
+            Counter::numCalls() = 0;
+            mX.resize(SMALL);
+            ASSERTV(Counter::numCalls(), 0 == Counter::numCalls());
+
+            mX.reserve(SMALL + LARGE);
+
+            Counter::numCalls() = 0;
+            mX.resize(SMALL + LARGE, V(5));
+            ASSERTV(Counter::numCalls(), 1 == Counter::numCalls());
+            ASSERT(SMALL + LARGE == X.size());
+            ASSERT(0 == X[SMALL - 1].value());
+            ASSERT(5 == X[SMALL].value());
+            ASSERT(5 == X.back().value());
+
+            Counter::numCalls() = 0;
+            mX.resize(SMALL + 2 * LARGE, X[0]);
+            ASSERTV(Counter::numCalls(), 1 <= Counter::numCalls());
+            ASSERT(SMALL + 2 * LARGE == X.size());
+            ASSERT(5 == X[SMALL + LARGE - 1].value());
+            ASSERT(0 == X[SMALL + LARGE].value());
+            ASSERT(0 == X.back().value());
+
+            mX.clear();
+
+            Counter::numCalls() = 0;
+            mX.resize(LARGE);
+            ASSERTV(Counter::numCalls(), 1 == Counter::numCalls());
+            ASSERT(0 == X.front().value() && 0 == X.back().value());
+        }
+        {
+            if (verbose) printf("\tTesting 'reserve'\n");
+
+            bsl::vector<V> mX(LARGE, V(3), &oa);
+            const bsl::vector<V>& X = mX;
+
+            for (size_t i = 0; i < LARGE; ++i) {
+                mX[i] = V(static_cast<int>(i));
+            }
+            const V *data = X.data();
+
+            Counter::numCalls() = 0;
+            mX.reserve(2 * LARGE);
+            ASSERT(2 * LARGE <= X.capacity());
+            ASSERTV(Counter::numCalls(),
+                    data == X.data() || 1 == Counter::numCalls());
+
+            bool isSame = true;
+            for (size_t i = 0; i < LARGE; ++i) {
+                isSame = isSame && static_cast<int>(i) == X[i].value();
+            }
+            ASSERT(isSame);
+        }
+        {
+            if (verbose) printf("\tTesting types not opting in\n");
+
+            Counter::numCalls() = 0;
+
+            bsl::vector<int> mX(&oa);  const bsl::vector<int>& X = mX;
+
+            mX.assign(LARGE, 7);
+            mX.resize(2 * LARGE, 8);
+            mX.reserve(8 * LARGE);
+
+            bsl::vector<int> mY(X, &oa);
+
+            ASSERTV(Counter::numCalls(), 0 == Counter::numCalls());
+            ASSERT(X == mY);
+            ASSERT(7 == X.front() && 8 == X.back());
+        }
+
+        bulkTestTypePolicy = BulkPolicy();
+
+        ASSERT(0 == oa.numBlocksInUse());
+      } break;
+      case 27: {
+        // --------------------------------------------------------------------
+        // TESTING 'resize_default_init' AND 'append_uninitialized'
+        //
+        // Concerns:
+        //: 1 The uninitialized-growth methods produce the expected size and
+        //:   value, and grow the capacity as do the other manipulators.
+        //
+        // Plan:
+        //: 1 Run the test for each trivially default-constructible type,
+        //:   including the pointer specializations.  (C-1)
+        //
+        // Testing:
+        //   VALUE_TYPE *append_uninitialized(size_type n);
+        //   void resize_default_init(size_type n);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf(
+                  "\nTESTING 'resize_default_init' AND 'append_uninitialized'"
+                  "\n========================================================"
+                  "\n");
+
+        if (verbose) printf("\n... with 'char'.\n");
+        TestDriver<char>::testCase27();
+
+        if (verbose) printf("\n... with 'int'.\n");
+        TestDriver<int>::testCase27();
+
+        if (verbose) printf("\n... with 'int *'.\n");
+        TestDriver<int *>::testCase27();
+
+        if (verbose) printf("\n... with 'const char *'.\n");
+        TestDriver<const char *>::testCase27();
+
+        if (verbose) printf("\n... with function pointers.\n");
+        TestDriver<char (*)()>::testCase27();
+
+      } break;
       case 26: {
         // --------------------------------------------------------------------
         // TESTING HYMAN'S TEST CASE 2